@@ -23,35 +23,58 @@
 # Run:
 #   ./volk_profile -j volk_results.json
 # Then run this script under python3
+#
+# It also plots the diff of two volk_bench runs, the time of the fastest arch of
+# each kernel relative to the baseline:
+#   ./volk_bench -j baseline.json  (on the old release)
+#   ./volk_bench -j volk_bench.json -B baseline.json
+#   python3 plot_best_vs_generic.py baseline.json volk_bench.json
 
 import matplotlib.pyplot as plt
 import numpy as np
 import json
+import sys
 
-filename = 'volk_results.json'
+def best_bench_times(filename):
+    best = {}
+    with open(filename) as json_file:
+        for point in json.load(json_file)['results']:
+            kernel = point['kernel'][5:] # remove volk_ prefix that they all have
+            best[kernel] = min(best.get(kernel, point['time']), point['time'])
+    return best
 
 operations = []
 metrics = []
-with open(filename) as json_file:
-    data = json.load(json_file)
-    for test in data['volk_tests']:
-        if ('generic' in test['results']) or ('u_generic' in test['results']): # some dont have a generic kernel
-            operations.append(test['name'][5:]) # remove volk_ prefix that they all have
-            extension_performance = []
-            for key, val in test['results'].items():
-                if key not in ['generic', 'u_generic']: # exclude generic results, when trying to find fastest time
-                    extension_performance.append(val['time'])
-            try:
-                generic_time = test['results']['generic']['time']
-            except:
-                generic_time = test['results']['u_generic']['time']
-            metrics.append(extension_performance[np.argmin(extension_performance)]/generic_time)
+if len(sys.argv) == 3:
+    baseline = best_bench_times(sys.argv[1])
+    current = best_bench_times(sys.argv[2])
+    for kernel in sorted(set(baseline) & set(current)):
+        operations.append(kernel)
+        metrics.append(current[kernel]/baseline[kernel])
+    ylabel = 'Time taken of fastest kernel relative to the baseline'
+else:
+    filename = 'volk_results.json'
+    with open(filename) as json_file:
+        data = json.load(json_file)
+        for test in data['volk_tests']:
+            if ('generic' in test['results']) or ('u_generic' in test['results']): # some dont have a generic kernel
+                operations.append(test['name'][5:]) # remove volk_ prefix that they all have
+                extension_performance = []
+                for key, val in test['results'].items():
+                    if key not in ['generic', 'u_generic']: # exclude generic results, when trying to find fastest time
+                        extension_performance.append(val['time'])
+                try:
+                    generic_time = test['results']['generic']['time']
+                except:
+                    generic_time = test['results']['u_generic']['time']
+                metrics.append(extension_performance[np.argmin(extension_performance)]/generic_time)
+    ylabel = 'Time taken of fastest kernel relative to generic kernel'
 
 
 plt.bar(np.arange(len(metrics)), metrics)
 plt.hlines(1.0, -1, len(metrics), colors='r', linestyles='dashed')
 plt.axis([-1, len(metrics), 0, 2])
 plt.xticks(np.arange(len(operations)), operations, rotation=90)
-plt.ylabel('Time taken of fastest kernel relative to generic kernel')
+plt.ylabel(ylabel)
 plt.tight_layout()
 plt.show()
@@ -29,6 +29,7 @@
 #include <string>           // for string
 
 #include "volk/volk.h"           // for volk_get_alignment, volk_get_machine
+#include "volk/volk_cpu.h"       // for volk_get_cpu_signature
 #include "volk_option_helpers.h" // for option_list, option_t
 
 void print_alignment()
@@ -36,6 +37,13 @@ void print_alignment()
     std::cout << "Alignment in bytes: " << volk_get_alignment() << std::endl;
 }
 
+void print_cpu_signature()
+{
+    char signature[128];
+    volk_get_cpu_signature(signature, sizeof(signature));
+    std::cout << signature << std::endl;
+}
+
 void print_malloc()
 {
     // You don't want to change the volk_malloc code, so just copy the if/else
@@ -74,6 +82,10 @@ int main(int argc, char** argv)
                              volk_get_machine()));
     our_options.add(
         option_t("alignment", "", "print the memory alignment", print_alignment));
+    our_options.add(option_t("cpu-signature",
+                             "",
+                             "print the cpu signature naming per cpu configs",
+                             print_cpu_signature));
     our_options.add(option_t("malloc",
                              "",
                              "print the malloc implementation used in volk_malloc",
@@ -0,0 +1,268 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+// volk-stats: prints the kernel statistics which processes publish in shared
+// memory (see volk_publish_kernel_stats()), as text or in the Prometheus text
+// format, e.g. for the textfile collector of the node exporter or an inetd
+// style scrape endpoint. Without --segment every segment of a running
+// process in /dev/shm is read.
+
+#include <dirent.h>           // for opendir, readdir
+#include <fcntl.h>            // for O_RDONLY
+#include <signal.h>           // for kill
+#include <sys/mman.h>         // for shm_open, mmap, munmap
+#include <sys/stat.h>         // for fstat
+#include <unistd.h>           // for close
+#include <volk/volk_stats.h>  // for volk_stats_shm_t, volk_stats_shm_copy
+#include <cerrno>             // for errno, EPERM
+#include <cstring>            // for strncmp, strspn
+#include <ctime>              // for time
+#include <iomanip>            // for setprecision
+#include <iostream>           // for operator<<, basic_ostream
+#include <string>             // for string
+#include <vector>             // for vector
+
+#include "volk_option_helpers.h" // for option_list, option_t
+
+std::vector<std::string> segment_names;
+void add_segment(std::string val) { segment_names.push_back(val); }
+bool prometheus = false;
+void set_prometheus(bool val) { prometheus = val; }
+bool stale = false;
+void set_stale(bool val) { stale = val; }
+
+// a copy of one segment, in 64 bit words to keep the records aligned
+struct segment_t {
+    std::vector<uint64_t> words;
+    volk_stats_shm_t* shm() { return (volk_stats_shm_t*)words.data(); }
+};
+
+// a pid is taken for the default name of that process
+static std::string shm_name(const std::string& name)
+{
+    if (!name.empty() && strspn(name.c_str(), "0123456789") == name.size())
+        return VOLK_STATS_SHM_PREFIX + name;
+    return name[0] == '/' ? name : "/" + name;
+}
+
+static bool read_segment(const std::string& name, segment_t& segment)
+{
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    struct stat st;
+    if (fd < 0)
+        return false;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(volk_stats_shm_t)) {
+        close(fd);
+        return false;
+    }
+    const size_t bytes = (size_t)st.st_size;
+    void* map = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return false;
+    segment.words.resize((bytes + 7) / 8);
+    const bool ok =
+        volk_stats_shm_copy((const volk_stats_shm_t*)map, segment.shm(), bytes);
+    munmap(map, bytes);
+    return ok;
+}
+
+static bool process_alive(int64_t pid)
+{
+    return kill((pid_t)pid, 0) == 0 || errno == EPERM;
+}
+
+static std::vector<std::string> list_segments()
+{
+    std::vector<std::string> names;
+    const std::string prefix(VOLK_STATS_SHM_PREFIX + 1);
+    DIR* dir = opendir("/dev/shm");
+    if (!dir)
+        return names;
+    while (const struct dirent* entry = readdir(dir)) {
+        if (!strncmp(entry->d_name, prefix.c_str(), prefix.size()))
+            names.push_back("/" + std::string(entry->d_name));
+    }
+    closedir(dir);
+    return names;
+}
+
+static std::string escape_label(const char* value)
+{
+    std::string escaped;
+    for (; *value; value++) {
+        if (*value == '\\' || *value == '"')
+            escaped += '\\';
+        if (*value == '\n')
+            escaped += "\\n";
+        else
+            escaped += *value;
+    }
+    return escaped;
+}
+
+static std::string labels(volk_stats_shm_t* shm, const volk_stats_shm_kernel_t* kernel)
+{
+    return "pid=\"" + std::to_string(shm->pid) + "\",process=\"" +
+           escape_label(shm->process) + "\",machine=\"" + escape_label(shm->machine) +
+           "\",kernel=\"" + escape_label(kernel->name) + "\",impl_a=\"" +
+           escape_label(kernel->impl_a) + "\",impl_u=\"" + escape_label(kernel->impl_u) +
+           "\"";
+}
+
+static void print_counter(std::vector<segment_t>& segments,
+                          const char* metric,
+                          const char* help,
+                          uint64_t volk_stats_shm_kernel_t::*counter)
+{
+    std::cout << "# HELP " << metric << " " << help << "\n";
+    std::cout << "# TYPE " << metric << " counter\n";
+    for (segment_t& segment : segments) {
+        volk_stats_shm_t* shm = segment.shm();
+        const volk_stats_shm_kernel_t* kernels = volk_stats_shm_kernels(shm);
+        for (uint32_t i = 0; i < shm->n_kernels; i++) {
+            if (kernels[i].calls) {
+                std::cout << metric << "{" << labels(shm, &kernels[i]) << "} "
+                          << kernels[i].*counter << "\n";
+            }
+        }
+    }
+}
+
+static void print_prometheus(std::vector<segment_t>& segments)
+{
+    print_counter(segments,
+                  "volk_kernel_calls_total",
+                  "Calls of a VOLK kernel.",
+                  &volk_stats_shm_kernel_t::calls);
+    print_counter(segments,
+                  "volk_kernel_points_total",
+                  "Points processed by a VOLK kernel.",
+                  &volk_stats_shm_kernel_t::points);
+    print_counter(segments,
+                  "volk_kernel_bytes_total",
+                  "Bytes of the pointer arguments of a VOLK kernel.",
+                  &volk_stats_shm_kernel_t::bytes);
+
+    // bin b holds the lengths in [2^b, 2^(b+1)), so its bucket is le 2^(b+1) - 1
+    std::cout << "# HELP volk_kernel_length Lengths of the calls of a VOLK kernel.\n";
+    std::cout << "# TYPE volk_kernel_length histogram\n";
+    for (segment_t& segment : segments) {
+        volk_stats_shm_t* shm = segment.shm();
+        const volk_stats_shm_kernel_t* kernels = volk_stats_shm_kernels(shm);
+        for (uint32_t i = 0; i < shm->n_kernels; i++) {
+            // kernels without a length only count their calls
+            uint64_t total = 0;
+            for (unsigned int bin = 0; bin < VOLK_STATS_LENGTH_BINS; bin++)
+                total += kernels[i].lengths[bin];
+            if (!total)
+                continue;
+            const std::string kernel_labels = labels(shm, &kernels[i]);
+            uint64_t cumulative = 0;
+            for (unsigned int bin = 0; bin < VOLK_STATS_LENGTH_BINS; bin++) {
+                cumulative += kernels[i].lengths[bin];
+                std::cout << "volk_kernel_length_bucket{" << kernel_labels << ",le=\""
+                          << ((2ull << bin) - 1) << "\"} " << cumulative << "\n";
+            }
+            std::cout << "volk_kernel_length_bucket{" << kernel_labels
+                      << ",le=\"+Inf\"} " << cumulative << "\n";
+            std::cout << "volk_kernel_length_sum{" << kernel_labels << "} "
+                      << kernels[i].points << "\n";
+            std::cout << "volk_kernel_length_count{" << kernel_labels << "} "
+                      << cumulative << "\n";
+        }
+    }
+
+    std::cout << "# HELP volk_stats_updated_seconds Time of the last copy of the "
+                 "statistics.\n";
+    std::cout << "# TYPE volk_stats_updated_seconds gauge\n";
+    for (segment_t& segment : segments) {
+        volk_stats_shm_t* shm = segment.shm();
+        std::cout << "volk_stats_updated_seconds{pid=\"" << shm->pid << "\",process=\""
+                  << escape_label(shm->process) << "\"} " << std::fixed
+                  << std::setprecision(3) << shm->updated * 1e-9 << "\n";
+    }
+}
+
+static void print_text(std::vector<segment_t>& segments)
+{
+    const uint64_t now = (uint64_t)time(NULL);
+    for (segment_t& segment : segments) {
+        volk_stats_shm_t* shm = segment.shm();
+        const volk_stats_shm_kernel_t* kernels = volk_stats_shm_kernels(shm);
+        std::cout << shm->process << " (pid " << shm->pid << "), machine "
+                  << shm->machine << ", updated "
+                  << now - shm->updated / 1000000000ull << " s ago\n";
+        for (uint32_t i = 0; i < shm->n_kernels; i++) {
+            if (!kernels[i].calls)
+                continue;
+            std::cout << "  " << kernels[i].name << ": " << kernels[i].calls
+                      << " calls, " << kernels[i].points << " points, "
+                      << kernels[i].bytes << " bytes, impl_a " << kernels[i].impl_a
+                      << ", impl_u " << kernels[i].impl_u << "\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    option_list our_options("volk-stats");
+    our_options.add(option_t("segment",
+                             "s",
+                             "read the segment of this name or pid, may be repeated; "
+                             "default: all in /dev/shm",
+                             add_segment));
+    our_options.add(option_t("prometheus",
+                             "p",
+                             "print in the Prometheus text format",
+                             set_prometheus));
+    our_options.add(option_t(
+        "stale", "a", "also print segments of processes which are gone", set_stale));
+    our_options.parse(argc, argv);
+    if (our_options.present("help")) {
+        return 0;
+    }
+
+    const bool listed = segment_names.empty();
+    std::vector<std::string> names = listed ? list_segments() : segment_names;
+    std::vector<segment_t> segments;
+    int status = 0;
+    for (const std::string& name : names) {
+        segment_t segment;
+        if (!read_segment(shm_name(name), segment)) {
+            // a listed segment may have gone away in the meantime
+            if (!listed) {
+                std::cerr << "volk-stats: cannot read the segment " << name << std::endl;
+                status = 1;
+            }
+            continue;
+        }
+        if (stale || process_alive(segment.shm()->pid))
+            segments.push_back(segment);
+    }
+
+    if (prometheus)
+        print_prometheus(segments);
+    else
+        print_text(segments);
+    return status;
+}
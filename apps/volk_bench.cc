@@ -0,0 +1,255 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+// volk_bench: a fixed benchmark matrix over every kernel test, written as
+// JSON and optionally compared against a baseline written by an earlier run.
+
+#include <volk/constants.h> // for volk_version
+#include <volk/volk.h>      // for volk_get_machine
+#include <algorithm>        // for max
+#include <cmath>            // for sqrt
+#include <cstdlib>          // for strtod
+#include <fstream>          // IWYU pragma: keep
+#include <iostream>         // for operator<<, basic_ostream
+#include <map>              // for map
+#include <string>           // for string
+#include <utility>          // for pair
+#include <vector>           // for vector
+
+#include "kernel_tests.h"        // for init_test_list
+#include "qa_utils.h"            // for volk_test_results_t, vol...
+#include "volk_option_helpers.h" // for option_list, option_t
+
+// the matrix is fixed so that runs of different builds are comparable
+volk_test_params_t test_params(1e-6f, 327.f, 131071, 1987, true, "");
+
+void set_vlen(int val) { test_params.set_vlen((unsigned int)val); }
+void set_iter(int val) { test_params.set_iter((unsigned int)val); }
+void set_reps(int val) { test_params.set_reps((unsigned int)val); }
+void set_substr(std::string val) { test_params.set_regex(val); }
+std::string json_filename("volk_bench.json");
+void set_json(std::string val) { json_filename = val; }
+std::string baseline_filename("");
+void set_baseline(std::string val) { baseline_filename = val; }
+float rel_threshold = 5.0f;
+void set_rel_threshold(float val) { rel_threshold = val; }
+float mad_threshold = 4.0f;
+void set_mad_threshold(float val) { mad_threshold = val; }
+bool all_archs = false;
+void set_all_archs(bool val) { all_archs = val; }
+
+typedef struct {
+    double time;
+    double mad;
+    unsigned int reps;
+} bench_point_t;
+
+// keyed by "<kernel> <arch>", plus "<kernel> best" for the fastest arch
+typedef std::map<std::string, bench_point_t> bench_points_t;
+
+static void write_bench_json(const std::string& path,
+                             const std::vector<volk_test_results_t>& results)
+{
+    std::ofstream json_file(path.c_str());
+    json_file << "{" << std::endl;
+    json_file << " \"version\": \"" << volk_version() << "\"," << std::endl;
+    json_file << " \"machine\": \"" << volk_get_machine() << "\"," << std::endl;
+    json_file << " \"vlen\": " << test_params.vlen() << "," << std::endl;
+    json_file << " \"iter\": " << test_params.iter() << "," << std::endl;
+    json_file << " \"reps\": " << test_params.reps() << "," << std::endl;
+    json_file << " \"seed\": " << test_params.seed() << "," << std::endl;
+    json_file << " \"results\": [" << std::endl;
+    bool first = true;
+    for (size_t i = 0; i < results.size(); i++) {
+        std::map<std::string, volk_test_time_t>::const_iterator arch;
+        for (arch = results[i].results.begin(); arch != results[i].results.end();
+             ++arch) {
+            // one point per line, read_bench_json relies on it
+            json_file << (first ? "" : ",\n") << "  { \"kernel\": \"" << results[i].name
+                      << "\", \"arch\": \"" << arch->second.name
+                      << "\", \"time\": " << arch->second.time
+                      << ", \"mad\": " << arch->second.mad
+                      << ", \"reps\": " << arch->second.reps << " }";
+            first = false;
+        }
+    }
+    json_file << std::endl << " ]" << std::endl << "}" << std::endl;
+}
+
+static std::string json_value(const std::string& line, const std::string& key)
+{
+    const std::string pattern = "\"" + key + "\": ";
+    size_t start = line.find(pattern);
+    if (start == std::string::npos) {
+        return "";
+    }
+    start += pattern.size();
+    if (line[start] == '"') {
+        start++;
+        return line.substr(start, line.find('"', start) - start);
+    }
+    return line.substr(start, line.find_first_of(",}", start) - start);
+}
+
+static bool read_bench_json(const std::string& path, bench_points_t& points)
+{
+    std::ifstream json_file(path.c_str());
+    if (!json_file.is_open()) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(json_file, line)) {
+        if (line.find("\"kernel\": ") == std::string::npos) {
+            continue;
+        }
+        bench_point_t point;
+        point.time = strtod(json_value(line, "time").c_str(), NULL);
+        point.mad = strtod(json_value(line, "mad").c_str(), NULL);
+        point.reps = (unsigned int)strtoul(json_value(line, "reps").c_str(), NULL, 10);
+        const std::string kernel = json_value(line, "kernel");
+        points[kernel + " " + json_value(line, "arch")] = point;
+        bench_points_t::iterator best = points.find(kernel + " best");
+        if (best == points.end() || point.time < best->second.time) {
+            points[kernel + " best"] = point;
+        }
+    }
+    return true;
+}
+
+// A point regressed when it is slower than the baseline by more than both the
+// relative threshold and mad_threshold robust standard deviations of the
+// difference, so noisy kernels need a larger slowdown to be flagged.
+static int compare_to_baseline(const bench_points_t& baseline,
+                               const bench_points_t& current)
+{
+    int n_regressions = 0;
+    bench_points_t::const_iterator point;
+    for (point = current.begin(); point != current.end(); ++point) {
+        const bool is_best = point->first.size() > 5 &&
+                             point->first.compare(point->first.size() - 5, 5, " best") == 0;
+        bench_points_t::const_iterator base = baseline.find(point->first);
+        if (is_best == all_archs || base == baseline.end() || base->second.time <= 0) {
+            continue;
+        }
+        const double sigma = 1.4826 * std::sqrt(base->second.mad * base->second.mad +
+                                                point->second.mad * point->second.mad);
+        const double allowed = std::max(base->second.time * rel_threshold / 100.0,
+                                        mad_threshold * sigma);
+        const double change = 100.0 * (point->second.time / base->second.time - 1.0);
+        if (point->second.time > base->second.time + allowed) {
+            std::cout << "REGRESSION " << point->first << ": " << base->second.time
+                      << " ms -> " << point->second.time << " ms (+" << change << "%)"
+                      << std::endl;
+            n_regressions++;
+        } else if (point->second.time < base->second.time - allowed) {
+            std::cout << "improved " << point->first << ": " << base->second.time
+                      << " ms -> " << point->second.time << " ms (" << change << "%)"
+                      << std::endl;
+        }
+    }
+    return n_regressions;
+}
+
+int main(int argc, char* argv[])
+{
+    test_params.set_reps(9);
+    test_params.set_seed(1987);
+    option_list bench_options("volk_bench");
+    bench_options.add(
+        option_t("vlen", "v", "Set the vector length of the matrix", set_vlen));
+    bench_options.add(
+        (option_t("iter", "i", "Set the iterations per kernel of the matrix", set_iter)));
+    bench_options.add((option_t("repetitions",
+                                "N",
+                                "Split the iterations into N timed repetitions "
+                                "(default 9)",
+                                set_reps)));
+    bench_options.add(
+        (option_t("tests-substr", "R", "Run tests matching substring", set_substr)));
+    bench_options.add((option_t("json",
+                                "j",
+                                "Write the results to this file (default "
+                                "volk_bench.json)",
+                                set_json)));
+    bench_options.add((option_t("baseline",
+                                "B",
+                                "Compare against the results of an earlier run and "
+                                "exit with 1 on a slowdown",
+                                set_baseline)));
+    bench_options.add((option_t("threshold",
+                                "T",
+                                "Smallest slowdown in percent reported as a "
+                                "regression (default 5)",
+                                set_rel_threshold)));
+    bench_options.add((option_t("mad-threshold",
+                                "s",
+                                "Smallest slowdown in robust standard deviations "
+                                "reported as a regression (default 4)",
+                                set_mad_threshold)));
+    bench_options.add((option_t("all-archs",
+                                "A",
+                                "Compare every arch rather than the fastest arch "
+                                "of each kernel",
+                                set_all_archs)));
+    bench_options.parse(argc, argv);
+
+    if (bench_options.present("help")) {
+        return 0;
+    }
+
+    bench_points_t baseline;
+    if (baseline_filename != "" && !read_bench_json(baseline_filename, baseline)) {
+        std::cerr << "Cannot read the baseline " << baseline_filename << std::endl;
+        return 2;
+    }
+
+    std::vector<volk_test_results_t> results;
+    std::vector<volk_test_case_t> test_cases = init_test_list(test_params);
+    const std::string substr_to_match(test_params.kernel_regex());
+    for (unsigned int ii = 0; ii < test_cases.size(); ++ii) {
+        volk_test_case_t test_case = test_cases[ii];
+        if (test_case.name().find(substr_to_match) == std::string::npos) {
+            continue;
+        }
+        try {
+            run_volk_tests(test_case.desc(),
+                           test_case.kernel_ptr(),
+                           test_case.name(),
+                           test_case.test_parameters(),
+                           &results,
+                           test_case.puppet_master_name());
+        } catch (std::string& error) {
+            std::cerr << "Caught Exception in 'run_volk_tests': " << error << std::endl;
+        }
+    }
+    write_bench_json(json_filename, results);
+
+    if (baseline_filename == "") {
+        return 0;
+    }
+    bench_points_t current;
+    read_bench_json(json_filename, current);
+    const int n_regressions = compare_to_baseline(baseline, current);
+    std::cout << n_regressions << " regressions against " << baseline_filename
+              << std::endl;
+    return n_regressions ? 1 : 0;
+}
@@ -0,0 +1,597 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+// volk_chains: end to end DSP chains built from the kernels, for telling
+// whether a build speeds up whole receivers rather than single kernels. Each
+// chain runs over frames of synthetic samples; the time of every stage is
+// summed over the frames of a repetition and the median repetition reported,
+// as samples per second of the chain and as ns per sample of each stage.
+
+#include <volk/constants.h> // for volk_version
+#include <volk/volk.h>      // for volk_get_machine and the kernels
+#include <volk/volk_alloc.hh> // for volk::vector
+#include <volk/volk_conv.h>   // for volk_conv_branchtab_init
+#include <volk/volk_fir.h>    // for volk_fir_32f_t, volk_fir_decimator_32fc_t
+#include <algorithm>          // for sort, fill
+#include <chrono>             // for steady_clock
+#include <cmath>              // for sin, cos, sqrt
+#include <cstdlib>            // for strtod
+#include <cstring>            // for memset
+#include <fstream>            // IWYU pragma: keep
+#include <iostream>           // for operator<<, basic_ostream
+#include <map>                // for map
+#include <memory>             // for unique_ptr
+#include <random>             // for mt19937, normal_distribution
+#include <string>             // for string
+#include <vector>             // for vector
+
+#include "volk_option_helpers.h" // for option_list, option_t
+
+int n_frames = 200;
+void set_frames(int val) { n_frames = val > 0 ? val : 1; }
+int n_reps = 9;
+void set_reps(int val) { n_reps = val > 0 ? val : 1; }
+std::string chain_substr("");
+void set_substr(std::string val) { chain_substr = val; }
+std::string json_filename("volk_chains.json");
+void set_json(std::string val) { json_filename = val; }
+std::string baseline_filename("");
+void set_baseline(std::string val) { baseline_filename = val; }
+float rel_threshold = 5.0f;
+void set_rel_threshold(float val) { rel_threshold = val; }
+
+// sums the time since the last start or lap into each stage
+class stage_clock
+{
+public:
+    explicit stage_clock(size_t n_stages) : _ns(n_stages, 0.0) {}
+    void start() { _last = std::chrono::steady_clock::now(); }
+    void lap(size_t stage)
+    {
+        const std::chrono::steady_clock::time_point now =
+            std::chrono::steady_clock::now();
+        _ns[stage] += std::chrono::duration<double, std::nano>(now - _last).count();
+        _last = now;
+    }
+    void clear() { std::fill(_ns.begin(), _ns.end(), 0.0); }
+    const std::vector<double>& ns() const { return _ns; }
+
+private:
+    std::vector<double> _ns;
+    std::chrono::steady_clock::time_point _last;
+};
+
+class dsp_chain
+{
+public:
+    virtual ~dsp_chain() {}
+    virtual std::string name() const = 0;
+    virtual std::vector<std::string> stages() const = 0;
+    // the input samples of a frame, which the rate is counted in
+    virtual unsigned int frame_samples() const = 0;
+    virtual void run_frame(stage_clock& clock) = 0;
+};
+
+// a Hamming windowed sinc low pass, cutoff in cycles per sample
+static std::vector<float> lowpass_taps(unsigned int num_taps, double cutoff)
+{
+    std::vector<float> taps(num_taps);
+    const double middle = (num_taps - 1) / 2.0;
+    double sum = 0.0;
+    for (unsigned int i = 0; i < num_taps; i++) {
+        const double t = i - middle;
+        const double sinc = (t == 0.0) ? 2.0 * cutoff
+                                       : std::sin(2.0 * M_PI * cutoff * t) / (M_PI * t);
+        taps[i] = (float)(sinc * (0.54 - 0.46 * std::cos(2.0 * M_PI * i / (num_taps - 1))));
+        sum += taps[i];
+    }
+    for (unsigned int i = 0; i < num_taps; i++) {
+        taps[i] /= (float)sum;
+    }
+    return taps;
+}
+
+// a tone at frequency cycles per sample in noise, as a 12 bit ADC delivers it
+static void synth_sc16(lv_16sc_t* out, unsigned int n, double frequency, unsigned int seed)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> noise(0.0f, 200.0f);
+    for (unsigned int i = 0; i < n; i++) {
+        const double angle = 2.0 * M_PI * frequency * i;
+        out[i] = lv_cmake((int16_t)(1500.0 * std::cos(angle) + noise(rng)),
+                          (int16_t)(1500.0 * std::sin(angle) + noise(rng)));
+    }
+}
+
+// FM broadcast at 2.4 MS/s: tune the station to DC, filter and decimate to
+// 300 kS/s, discriminate and filter the audio
+class fm_demod_chain : public dsp_chain
+{
+public:
+    static const unsigned int N = 16384;
+    static const unsigned int DECIMATION = 8;
+
+    fm_demod_chain()
+        : _in(N),
+          _iq(N),
+          _tuned(N),
+          _channel(N / DECIMATION + 1),
+          _phase(N / DECIMATION + 1),
+          _demod(N / DECIMATION + 1),
+          _audio(N / DECIMATION + 1),
+          _out(N / DECIMATION + 1),
+          _rotation(lv_cmake(1.0f, 0.0f)),
+          _rotation_inc(lv_cmake((float)std::cos(2.0 * M_PI * 0.1),
+                                 (float)std::sin(2.0 * M_PI * 0.1))),
+          _last_phase(0.0f)
+    {
+        synth_sc16(_in.data(), N, -0.1, 1);
+        const std::vector<float> channel_taps = lowpass_taps(64, 0.5 / DECIMATION);
+        const std::vector<float> audio_taps = lowpass_taps(31, 15e3 / 300e3);
+        volk_fir_decimator_32fc_init(
+            &_channel_fir, channel_taps.data(), channel_taps.size(), DECIMATION);
+        volk_fir_32f_init(&_audio_fir, audio_taps.data(), audio_taps.size());
+    }
+    ~fm_demod_chain()
+    {
+        volk_fir_decimator_32fc_destroy(&_channel_fir);
+        volk_fir_32f_destroy(&_audio_fir);
+    }
+    std::string name() const { return "fm_demod"; }
+    std::vector<std::string> stages() const
+    {
+        return { "convert", "rotate",       "channel_filter", "phase",
+                 "discriminate", "audio_filter", "volume" };
+    }
+    unsigned int frame_samples() const { return N; }
+    void run_frame(stage_clock& clock)
+    {
+        clock.start();
+        volk_16ic_convert_32fc(_iq.data(), _in.data(), N);
+        clock.lap(0);
+        volk_32fc_s32fc_x2_rotator_32fc(
+            _tuned.data(), _iq.data(), _rotation_inc, &_rotation, N);
+        clock.lap(1);
+        const unsigned int n = volk_fir_decimator_32fc_filter(
+            &_channel_fir, _channel.data(), _tuned.data(), N);
+        clock.lap(2);
+        volk_32fc_s32f_atan2_32f(_phase.data(), _channel.data(), (float)M_PI, n);
+        clock.lap(3);
+        volk_32f_s32f_32f_fm_detect_32f(
+            _demod.data(), _phase.data(), 1.0f, &_last_phase, n);
+        clock.lap(4);
+        volk_fir_32f_filter(&_audio_fir, _audio.data(), _demod.data(), n);
+        clock.lap(5);
+        volk_32f_s32f_multiply_32f(_out.data(), _audio.data(), 0.5f, n);
+        clock.lap(6);
+    }
+
+private:
+    volk::vector<lv_16sc_t> _in;
+    volk::vector<lv_32fc_t> _iq, _tuned, _channel;
+    volk::vector<float> _phase, _demod, _audio, _out;
+    lv_32fc_t _rotation, _rotation_inc;
+    float _last_phase;
+    volk_fir_decimator_32fc_t _channel_fir;
+    volk_fir_32f_t _audio_fir;
+};
+
+// a QPSK receiver front end at 4 samples per symbol: correct the carrier
+// offset, matched filter down to the symbols, normalise the level and slice
+class qpsk_frontend_chain : public dsp_chain
+{
+public:
+    static const unsigned int N = 16384;
+    static const unsigned int SPS = 4;
+
+    qpsk_frontend_chain()
+        : _in(N),
+          _iq(N),
+          _corrected(N),
+          _symbols(N / SPS + 1),
+          _power(N / SPS + 1),
+          _scaled(N / SPS + 1),
+          _decisions(N / SPS + 1),
+          _rotation(lv_cmake(1.0f, 0.0f)),
+          _rotation_inc(lv_cmake((float)std::cos(2.0 * M_PI * 1e-3),
+                                 (float)std::sin(2.0 * M_PI * -1e-3)))
+    {
+        synth_sc16(_in.data(), N, 1e-3, 2);
+        const std::vector<float> taps = lowpass_taps(8 * SPS + 1, 0.5 / SPS);
+        volk_fir_decimator_32fc_init(&_matched_fir, taps.data(), taps.size(), SPS);
+    }
+    ~qpsk_frontend_chain() { volk_fir_decimator_32fc_destroy(&_matched_fir); }
+    std::string name() const { return "qpsk_frontend"; }
+    std::vector<std::string> stages() const
+    {
+        return { "convert", "rotate", "matched_filter", "power", "level", "agc", "slice" };
+    }
+    unsigned int frame_samples() const { return N; }
+    void run_frame(stage_clock& clock)
+    {
+        float level;
+        clock.start();
+        volk_16ic_convert_32fc(_iq.data(), _in.data(), N);
+        clock.lap(0);
+        volk_32fc_s32fc_x2_rotator_32fc(
+            _corrected.data(), _iq.data(), _rotation_inc, &_rotation, N);
+        clock.lap(1);
+        const unsigned int n = volk_fir_decimator_32fc_filter(
+            &_matched_fir, _symbols.data(), _corrected.data(), N);
+        clock.lap(2);
+        volk_32fc_magnitude_squared_32f(_power.data(), _symbols.data(), n);
+        clock.lap(3);
+        volk_32f_accumulator_s32f(&level, _power.data(), n);
+        clock.lap(4);
+        const float gain = (level > 0.0f) ? (float)std::sqrt(n / level) : 1.0f;
+        volk_32fc_s32fc_multiply_32fc(
+            _scaled.data(), _symbols.data(), lv_cmake(gain, 0.0f), n);
+        clock.lap(5);
+        volk_32fc_qpsk_slicer_8u(_decisions.data(), _scaled.data(), n);
+        clock.lap(6);
+    }
+
+private:
+    volk::vector<lv_16sc_t> _in;
+    volk::vector<lv_32fc_t> _iq, _corrected, _symbols;
+    volk::vector<float> _power;
+    volk::vector<lv_32fc_t> _scaled;
+    volk::vector<uint8_t> _decisions;
+    lv_32fc_t _rotation, _rotation_inc;
+    volk_fir_decimator_32fc_t _matched_fir;
+};
+
+// a spectrum monitor: 16 windowed 4096 point FFTs per frame, averaged in dB,
+// and the strongest bin of the average
+class spectrum_chain : public dsp_chain
+{
+public:
+    static const unsigned int FFT_LEN = 4096;
+    static const unsigned int N_FFTS = 16;
+
+    spectrum_chain()
+        : _in(FFT_LEN * N_FFTS),
+          _iq(FFT_LEN * N_FFTS),
+          _window(FFT_LEN),
+          _windowed(FFT_LEN),
+          _bins(FFT_LEN),
+          _db(FFT_LEN),
+          _sum(FFT_LEN),
+          _average(FFT_LEN)
+    {
+        synth_sc16(_in.data(), FFT_LEN * N_FFTS, 0.123, 3);
+        for (unsigned int i = 0; i < FFT_LEN; i++) {
+            _window[i] = (float)(0.5 - 0.5 * std::cos(2.0 * M_PI * i / FFT_LEN));
+        }
+    }
+    std::string name() const { return "spectrum"; }
+    std::vector<std::string> stages() const
+    {
+        return { "convert", "window", "fft", "power_spectrum", "average", "peak" };
+    }
+    unsigned int frame_samples() const { return FFT_LEN * N_FFTS; }
+    void run_frame(stage_clock& clock)
+    {
+        uint32_t peak;
+        clock.start();
+        volk_16ic_convert_32fc(_iq.data(), _in.data(), FFT_LEN * N_FFTS);
+        clock.lap(0);
+        for (unsigned int i = 0; i < N_FFTS; i++) {
+            volk_32fc_32f_multiply_32fc(
+                _windowed.data(), _iq.data() + i * FFT_LEN, _window.data(), FFT_LEN);
+            clock.lap(1);
+            volk_32fc_fft_32fc(_bins.data(), _windowed.data(), FFT_LEN);
+            clock.lap(2);
+            volk_32fc_s32f_power_spectrum_32f(
+                _db.data(), _bins.data(), (float)FFT_LEN, FFT_LEN);
+            clock.lap(3);
+            if (i == 0) {
+                std::copy(_db.begin(), _db.end(), _sum.begin());
+            } else {
+                volk_32f_x2_add_32f(_sum.data(), _sum.data(), _db.data(), FFT_LEN);
+            }
+            clock.lap(4);
+        }
+        volk_32f_s32f_multiply_32f(
+            _average.data(), _sum.data(), 1.0f / N_FFTS, FFT_LEN);
+        volk_32f_index_max_32u(&peak, _average.data(), FFT_LEN);
+        clock.lap(5);
+    }
+
+private:
+    volk::vector<lv_16sc_t> _in;
+    volk::vector<lv_32fc_t> _iq;
+    volk::vector<float> _window;
+    volk::vector<lv_32fc_t> _windowed, _bins;
+    volk::vector<float> _db, _sum, _average;
+};
+
+// a frame of 2048 bits with a CRC, K=7 rate 1/2 coded on noisy QPSK:
+// demap to soft bits, decode, trace back, pack and check the CRC
+class viterbi_frame_chain : public dsp_chain
+{
+public:
+    static const unsigned int FRAME_BITS = 2048;
+    static const unsigned int TAIL = 6;
+    static const unsigned int N = FRAME_BITS + TAIL; // QPSK symbols, 2 coded bits each
+
+    viterbi_frame_chain()
+        : _symbols(N),
+          _llrs(2 * N),
+          _syms(2 * N),
+          _metrics(128),
+          _branchtab(64),
+          _dec(8 * N),
+          _bits(N),
+          _packed(FRAME_BITS / 8),
+          _sent(FRAME_BITS)
+    {
+        static const unsigned int polys[2] = { 79, 109 };
+        std::mt19937 rng(4);
+        std::normal_distribution<float> noise(0.0f, 0.3f);
+        unsigned int reg = 0;
+        volk_conv_branchtab_init(_branchtab.data(), polys, 64, 2);
+        for (unsigned int i = 0; i < N; i++) {
+            const unsigned int bit = (i < FRAME_BITS) ? rng() & 1 : 0;
+            if (i < FRAME_BITS)
+                _sent[i] = bit;
+            reg = (reg << 1) | bit;
+            const float coded[2] = { (float)__builtin_parity(reg & polys[0]),
+                                     (float)__builtin_parity(reg & polys[1]) };
+            _symbols[i] = lv_cmake(1.0f - 2.0f * coded[0] + noise(rng),
+                                   1.0f - 2.0f * coded[1] + noise(rng));
+        }
+    }
+    std::string name() const { return "viterbi_frame"; }
+    std::vector<std::string> stages() const
+    {
+        return { "demap", "offset", "decode", "traceback", "pack", "crc" };
+    }
+    unsigned int frame_samples() const { return N; }
+    void run_frame(stage_clock& clock)
+    {
+        uint32_t crc;
+        clock.start();
+        volk_32fc_s32f_qam_llr_8i(_llrs.data(), _symbols.data(), 16.0f, 2, N);
+        clock.lap(0);
+        // the decoder takes offset binary symbols, 0 for a sure 0 bit
+        for (unsigned int i = 0; i < 2 * N; i++) {
+            _syms[i] = (uint8_t)(128 - _llrs[i]);
+        }
+        clock.lap(1);
+        memset(_metrics.data(), 31, 64);
+        volk_8u_x4_conv_k7_r2_8u(_metrics.data() + 64,
+                                 _metrics.data(),
+                                 _syms.data(),
+                                 _dec.data(),
+                                 FRAME_BITS,
+                                 TAIL,
+                                 _branchtab.data());
+        clock.lap(2);
+        volk_8u_x2_conv_k7_traceback_8u(_bits.data(), _dec.data(), _metrics.data(), N);
+        clock.lap(3);
+        volk_8u_pack_8u(_packed.data(), _bits.data(), 0, FRAME_BITS);
+        clock.lap(4);
+        volk_8u_crc_32u(&crc, _packed.data(), 0x04C11DB7, 32, 1, FRAME_BITS / 8);
+        clock.lap(5);
+    }
+    // the bits of the last frame which were decoded wrongly
+    unsigned int bit_errors() const
+    {
+        unsigned int errors = 0;
+        for (unsigned int i = 0; i < FRAME_BITS; i++) {
+            errors += (_bits[i] != _sent[i]);
+        }
+        return errors;
+    }
+
+private:
+    volk::vector<lv_32fc_t> _symbols;
+    volk::vector<int8_t> _llrs;
+    volk::vector<uint8_t> _syms, _metrics, _branchtab, _dec, _bits, _packed;
+    std::vector<uint8_t> _sent;
+};
+
+typedef struct {
+    std::string chain;
+    std::string stage; // "total" for the whole chain
+    double ns_per_sample;
+} chain_point_t;
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+// runs the frames of each repetition and returns the median ns per sample of
+// each stage, and of the whole chain as the last element
+static std::vector<double> time_chain(dsp_chain& chain)
+{
+    const size_t n_stages = chain.stages().size();
+    const double samples = (double)chain.frame_samples() * n_frames;
+    std::vector<std::vector<double>> stage_ns(n_stages + 1);
+    stage_clock clock(n_stages);
+    chain.run_frame(clock); // warm up the caches and the dispatchers
+    for (int rep = 0; rep < n_reps; rep++) {
+        double total = 0.0;
+        clock.clear();
+        for (int frame = 0; frame < n_frames; frame++) {
+            chain.run_frame(clock);
+        }
+        for (size_t stage = 0; stage < n_stages; stage++) {
+            stage_ns[stage].push_back(clock.ns()[stage] / samples);
+            total += clock.ns()[stage];
+        }
+        stage_ns[n_stages].push_back(total / samples);
+    }
+    std::vector<double> medians;
+    for (size_t stage = 0; stage <= n_stages; stage++) {
+        medians.push_back(median(stage_ns[stage]));
+    }
+    return medians;
+}
+
+static void write_chains_json(const std::string& path,
+                              const std::vector<chain_point_t>& points)
+{
+    std::ofstream json_file(path.c_str());
+    json_file << "{" << std::endl;
+    json_file << " \"version\": \"" << volk_version() << "\"," << std::endl;
+    json_file << " \"machine\": \"" << volk_get_machine() << "\"," << std::endl;
+    json_file << " \"frames\": " << n_frames << "," << std::endl;
+    json_file << " \"reps\": " << n_reps << "," << std::endl;
+    json_file << " \"results\": [" << std::endl;
+    for (size_t i = 0; i < points.size(); i++) {
+        // one point per line, read_chains_json relies on it
+        json_file << (i ? ",\n" : "") << "  { \"chain\": \"" << points[i].chain
+                  << "\", \"stage\": \"" << points[i].stage
+                  << "\", \"ns_per_sample\": " << points[i].ns_per_sample << " }";
+    }
+    json_file << std::endl << " ]" << std::endl << "}" << std::endl;
+}
+
+static std::string json_value(const std::string& line, const std::string& key)
+{
+    const std::string pattern = "\"" + key + "\": ";
+    size_t start = line.find(pattern);
+    if (start == std::string::npos) {
+        return "";
+    }
+    start += pattern.size();
+    if (line[start] == '"') {
+        start++;
+        return line.substr(start, line.find('"', start) - start);
+    }
+    return line.substr(start, line.find_first_of(",}", start) - start);
+}
+
+// keyed by "<chain> <stage>"
+static bool read_chains_json(const std::string& path, std::map<std::string, double>& points)
+{
+    std::ifstream json_file(path.c_str());
+    if (!json_file.is_open()) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(json_file, line)) {
+        if (line.find("\"chain\": ") == std::string::npos) {
+            continue;
+        }
+        points[json_value(line, "chain") + " " + json_value(line, "stage")] =
+            strtod(json_value(line, "ns_per_sample").c_str(), NULL);
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    option_list chain_options("volk_chains");
+    chain_options.add(
+        option_t("frames", "f", "Frames per repetition of each chain", set_frames));
+    chain_options.add((option_t("repetitions",
+                                "N",
+                                "Timed repetitions of each chain, the median is "
+                                "reported (default 9)",
+                                set_reps)));
+    chain_options.add(
+        (option_t("chains-substr", "R", "Run chains matching substring", set_substr)));
+    chain_options.add((option_t("json",
+                                "j",
+                                "Write the results to this file (default "
+                                "volk_chains.json)",
+                                set_json)));
+    chain_options.add((option_t("baseline",
+                                "B",
+                                "Compare against the results of an earlier run and "
+                                "exit with 1 if a chain slowed down",
+                                set_baseline)));
+    chain_options.add((option_t("threshold",
+                                "T",
+                                "Smallest slowdown in percent reported as a "
+                                "regression (default 5)",
+                                set_rel_threshold)));
+    chain_options.parse(argc, argv);
+    if (chain_options.present("help")) {
+        return 0;
+    }
+
+    std::vector<std::unique_ptr<dsp_chain>> chains;
+    chains.emplace_back(new fm_demod_chain());
+    chains.emplace_back(new qpsk_frontend_chain());
+    chains.emplace_back(new spectrum_chain());
+    chains.emplace_back(new viterbi_frame_chain());
+
+    std::vector<chain_point_t> points;
+    for (size_t i = 0; i < chains.size(); i++) {
+        dsp_chain& chain = *chains[i];
+        if (chain.name().find(chain_substr) == std::string::npos) {
+            continue;
+        }
+        const std::vector<std::string> stages = chain.stages();
+        const std::vector<double> ns = time_chain(chain);
+        const double total = ns[stages.size()];
+        std::cout << chain.name() << ": " << 1e3 / total << " MS/s, " << total
+                  << " ns/sample" << std::endl;
+        for (size_t stage = 0; stage < stages.size(); stage++) {
+            std::cout << "    " << stages[stage] << ": " << ns[stage] << " ns/sample, "
+                      << 100.0 * ns[stage] / total << "%" << std::endl;
+            points.push_back({ chain.name(), stages[stage], ns[stage] });
+        }
+        points.push_back({ chain.name(), "total", total });
+    }
+    viterbi_frame_chain* viterbi = dynamic_cast<viterbi_frame_chain*>(chains[3].get());
+    if (viterbi->bit_errors()) {
+        std::cerr << "Warning: the Viterbi frame decoded with " << viterbi->bit_errors()
+                  << " bit errors" << std::endl;
+    }
+    write_chains_json(json_filename, points);
+
+    if (baseline_filename.empty()) {
+        return 0;
+    }
+    std::map<std::string, double> baseline;
+    if (!read_chains_json(baseline_filename, baseline)) {
+        std::cerr << "Could not read the baseline " << baseline_filename << std::endl;
+        return 1;
+    }
+    int n_regressions = 0;
+    for (size_t i = 0; i < points.size(); i++) {
+        const std::string key = points[i].chain + " " + points[i].stage;
+        std::map<std::string, double>::const_iterator base = baseline.find(key);
+        if (base == baseline.end() || base->second <= 0) {
+            continue;
+        }
+        const double change = 100.0 * (points[i].ns_per_sample / base->second - 1.0);
+        if (change > rel_threshold) {
+            std::cout << (points[i].stage == "total" ? "REGRESSION " : "slower ") << key
+                      << ": " << base->second << " -> " << points[i].ns_per_sample
+                      << " ns/sample (+" << change << "%)" << std::endl;
+            n_regressions += (points[i].stage == "total");
+        } else if (change < -rel_threshold) {
+            std::cout << "improved " << key << ": " << base->second << " -> "
+                      << points[i].ns_per_sample << " ns/sample (" << change << "%)"
+                      << std::endl;
+        }
+    }
+    return n_regressions ? 1 : 0;
+}
@@ -0,0 +1,329 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+// volk_convert: converts IQ recordings between sample formats with the
+// volk_async_ kernels. The input is memory mapped a chunk at a time; while
+// the pool converts one chunk, the previous one is written out.
+
+#include <fcntl.h>          // for open, O_RDONLY
+#include <sys/mman.h>       // for mmap, munmap, madvise
+#include <sys/stat.h>       // for fstat
+#include <unistd.h>         // for write, close, sysconf
+#include <volk/volk.h>      // for volk_async_t, volk_async_wait
+#include <cerrno>           // for errno, EINTR
+#include <chrono>           // for steady_clock
+#include <cstring>          // for strerror
+#include <iostream>         // for operator<<, basic_ostream
+#include <string>           // for string
+
+#include "volk_option_helpers.h" // for option_list, option_t
+
+std::string input_filename("");
+void set_input(std::string val) { input_filename = val; }
+std::string output_filename("");
+void set_output(std::string val) { output_filename = val; }
+std::string from_format("sc16");
+void set_from(std::string val) { from_format = val; }
+std::string to_format("fc32");
+void set_to(std::string val) { to_format = val; }
+float scale = 1.0f;
+void set_scale(float val) { scale = val; }
+bool swap_bytes = false;
+void set_swap(bool val) { swap_bytes = val; }
+int n_threads = 0;
+void set_threads(int val) { n_threads = val; }
+int chunk_mib = 8;
+void set_chunk(int val) { chunk_mib = val; }
+
+typedef enum {
+    SC16_TO_FC32,
+    SC8_TO_FC32,
+    FC32_TO_SC16,
+    FC32_TO_FC32,
+    SC16_BYTESWAP,
+} conversion_t;
+
+typedef struct {
+    conversion_t conversion;
+    size_t in_point_bytes;
+    size_t out_point_bytes;
+    bool in_place; // converts the private mapping of the input, which is written out
+} converter_t;
+
+// the sample formats and the conversions between them, false if there is none
+static bool find_converter(converter_t& conv)
+{
+    if (from_format == "sc16" && to_format == "fc32" && !swap_bytes) {
+        conv = { SC16_TO_FC32, 4, 8, false };
+    } else if (from_format == "sc8" && to_format == "fc32" && !swap_bytes) {
+        conv = { SC8_TO_FC32, 2, 8, false };
+    } else if (from_format == "fc32" && to_format == "sc16" && !swap_bytes) {
+        conv = { FC32_TO_SC16, 8, 4, false };
+    } else if (from_format == "fc32" && to_format == "fc32" && !swap_bytes) {
+        conv = { FC32_TO_FC32, 8, 8, true };
+    } else if (from_format == "sc16" && to_format == "sc16" && swap_bytes) {
+        conv = { SC16_BYTESWAP, 4, 4, true };
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// start converting num_points samples on the pool; --scale multiplies the samples
+static volk_async_t*
+start_conversion(const converter_t& conv, void* out, void* in, unsigned int num_points)
+{
+    switch (conv.conversion) {
+    case SC16_TO_FC32:
+        if (scale == 1.0f) {
+            return volk_async_volk_16ic_convert_32fc(
+                (lv_32fc_t*)out, (const lv_16sc_t*)in, num_points);
+        }
+        return volk_async_volk_16i_s32f_convert_32f(
+            (float*)out, (const int16_t*)in, 1.0f / scale, 2 * num_points);
+    case SC8_TO_FC32:
+        return volk_async_volk_8i_s32f_convert_32f(
+            (float*)out, (const int8_t*)in, 1.0f / scale, 2 * num_points);
+    case FC32_TO_SC16:
+        if (scale == 1.0f) {
+            return volk_async_volk_32fc_convert_16ic(
+                (lv_16sc_t*)out, (const lv_32fc_t*)in, num_points);
+        }
+        return volk_async_volk_32f_s32f_convert_16i(
+            (int16_t*)out, (const float*)in, scale, 2 * num_points);
+    case FC32_TO_FC32:
+        return volk_async_volk_32f_s32f_multiply_32f(
+            (float*)out, (const float*)in, scale, 2 * num_points);
+    case SC16_BYTESWAP:
+        return volk_async_volk_16u_byteswap((uint16_t*)in, 2 * num_points);
+    }
+    return NULL;
+}
+
+static bool write_all(int fd, const void* data, size_t size)
+{
+    const char* next = (const char*)data;
+    while (size) {
+        const ssize_t written = write(fd, next, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        next += written;
+        size -= (size_t)written;
+    }
+    return true;
+}
+
+// a chunk in flight: its input window, its output and the conversion call
+typedef struct {
+    void* map;
+    size_t map_bytes;
+    void* out;
+    size_t out_bytes;
+    volk_async_t* call;
+} chunk_t;
+
+static void release_chunk(chunk_t& chunk)
+{
+    if (chunk.map) {
+        munmap(chunk.map, chunk.map_bytes);
+    }
+    chunk.map = NULL;
+}
+
+int main(int argc, char* argv[])
+{
+    option_list convert_options("volk_convert");
+    convert_options.add(
+        (option_t("input", "i", "The recording to convert, a regular file", set_input)));
+    convert_options.add(
+        (option_t("output", "o", "The file to write, - for stdout", set_output)));
+    convert_options.add((option_t("from",
+                                  "f",
+                                  "The input format: sc16, sc8 or fc32 (default sc16)",
+                                  set_from)));
+    convert_options.add((option_t("to",
+                                  "t",
+                                  "The output format: fc32 or sc16 (default fc32); "
+                                  "sc16 to fc32, sc8 to fc32, fc32 to sc16 and fc32 "
+                                  "to fc32 convert, sc16 to sc16 needs --swap",
+                                  set_to)));
+    convert_options.add((option_t("scale",
+                                  "s",
+                                  "Multiply the samples by this, e.g. 3.0517578e-5 "
+                                  "for sc16 to fc32 in [-1, 1) (default 1)",
+                                  set_scale)));
+    convert_options.add((option_t(
+        "swap", "w", "Byteswap the 16 bit samples of sc16 to sc16", set_swap)));
+    convert_options.add((option_t("threads",
+                                  "T",
+                                  "Threads of the pool converting the chunks "
+                                  "(default the number of cores)",
+                                  set_threads)));
+    convert_options.add((option_t("chunk",
+                                  "c",
+                                  "MiB of input converted at a time, up to 1024 "
+                                  "(default 8)",
+                                  set_chunk)));
+    convert_options.parse(argc, argv);
+
+    if (convert_options.present("help")) {
+        return 0;
+    }
+
+    converter_t conv;
+    if (input_filename == "" || output_filename == "") {
+        std::cerr << "Both --input and --output are needed" << std::endl;
+        return 2;
+    }
+    if (!find_converter(conv) || scale == 0.0f) {
+        std::cerr << "Cannot convert " << from_format << " to " << to_format
+                  << (swap_bytes ? " with --swap" : "") << " by a scale of " << scale
+                  << std::endl;
+        return 2;
+    }
+
+    const int in_fd = open(input_filename.c_str(), O_RDONLY);
+    struct stat in_stat;
+    if (in_fd < 0 || fstat(in_fd, &in_stat) != 0) {
+        std::cerr << "Cannot open " << input_filename << ": " << strerror(errno)
+                  << std::endl;
+        return 1;
+    }
+    const int out_fd = output_filename == "-"
+                           ? STDOUT_FILENO
+                           : open(output_filename.c_str(),
+                                  O_WRONLY | O_CREAT | O_TRUNC,
+                                  S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (out_fd < 0) {
+        std::cerr << "Cannot create " << output_filename << ": " << strerror(errno)
+                  << std::endl;
+        return 1;
+    }
+
+    // chunks start on a page and a sample, and hold whole samples
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t in_size = (size_t)in_stat.st_size;
+    const size_t n_points = in_size / conv.in_point_bytes;
+    // at most 1024 MiB, so that the kernels' lengths fit an unsigned int
+    size_t chunk_bytes = (size_t)(chunk_mib < 1 ? 1 : chunk_mib > 1024 ? 1024 : chunk_mib)
+                         << 20;
+    chunk_bytes = (chunk_bytes + page - 1) / page * page;
+    while (chunk_bytes % conv.in_point_bytes) {
+        chunk_bytes += page;
+    }
+    const size_t chunk_points = chunk_bytes / conv.in_point_bytes;
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(in_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    if (in_size % conv.in_point_bytes) {
+        std::cerr << "Ignoring the " << in_size % conv.in_point_bytes
+                  << " trailing bytes of a partial sample" << std::endl;
+    }
+
+    // SMT siblings share the vector units, so a thread per core converts as fast
+    volk_set_num_threads(n_threads > 0 ? (unsigned int)n_threads
+                                       : volk_get_cpu_info()->n_cores);
+
+    // two chunks in flight, one converting while the other is written
+    chunk_t chunks[2] = {};
+    for (int i = 0; i < 2 && !conv.in_place; i++) {
+        chunks[i].out = volk_malloc(chunk_points * conv.out_point_bytes,
+                                    volk_get_alignment());
+        if (!chunks[i].out) {
+            std::cerr << "Out of memory for the output buffers" << std::endl;
+            return 1;
+        }
+    }
+
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    const size_t n_chunks = (n_points + chunk_points - 1) / chunk_points;
+    int status = 0;
+    for (size_t ii = 0; ii <= n_chunks && !status; ii++) {
+        if (ii < n_chunks) {
+            chunk_t& chunk = chunks[ii % 2];
+            const size_t offset = ii * chunk_bytes;
+            const size_t points =
+                n_points - ii * chunk_points < chunk_points ? n_points - ii * chunk_points
+                                                            : chunk_points;
+            chunk.map_bytes = points * conv.in_point_bytes;
+            // in place conversions write to a private copy of the pages they touch
+            chunk.map = mmap(NULL,
+                             chunk.map_bytes,
+                             conv.in_place ? PROT_READ | PROT_WRITE : PROT_READ,
+                             MAP_PRIVATE,
+                             in_fd,
+                             (off_t)offset);
+            if (chunk.map == MAP_FAILED) {
+                chunk.map = NULL;
+                std::cerr << "Cannot map " << input_filename << ": " << strerror(errno)
+                          << std::endl;
+                status = 1;
+                break;
+            }
+            madvise(chunk.map, chunk.map_bytes, MADV_WILLNEED);
+            if (conv.in_place) {
+                chunk.out = chunk.map;
+            }
+            chunk.out_bytes = points * conv.out_point_bytes;
+            chunk.call =
+                start_conversion(conv, chunk.out, chunk.map, (unsigned int)points);
+        }
+        if (ii > 0) {
+            chunk_t& done = chunks[(ii - 1) % 2];
+            volk_async_wait(done.call);
+            if (!write_all(out_fd, done.out, done.out_bytes)) {
+                std::cerr << "Cannot write " << output_filename << ": "
+                          << strerror(errno) << std::endl;
+                status = 1;
+            }
+            release_chunk(done);
+        }
+    }
+    // after an error the other chunk may still be converting
+    for (int i = 0; i < 2; i++) {
+        if (chunks[i].map) {
+            volk_async_wait(chunks[i].call);
+            release_chunk(chunks[i]);
+        }
+        if (!conv.in_place) {
+            volk_free(chunks[i].out);
+        }
+    }
+    close(in_fd);
+    if (out_fd != STDOUT_FILENO && close(out_fd) != 0) {
+        std::cerr << "Cannot write " << output_filename << ": " << strerror(errno)
+                  << std::endl;
+        status = 1;
+    }
+
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << n_points << " samples in " << seconds << " s, "
+              << (double)n_points * conv.in_point_bytes / 1e6 / seconds << " MB/s read"
+              << std::endl;
+    return status;
+}
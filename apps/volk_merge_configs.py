@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+# Copyright 2024 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# GNU Radio is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3, or (at your option)
+# any later version.
+#
+# GNU Radio is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with GNU Radio; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+
+
+# This script merges the configs profiled on a fleet of boards into one
+# profile per cpu signature, laid out as the config dir of a target expects:
+#   volk_profile_lite                        (on each board)
+#   python3 volk_merge_configs.py -o deploy board*/volk_config.d/*
+#   cp -r deploy/volk_config.d ~/.volk/      (on each board, or in its image)
+#
+# The signature of a config is its "#cpu" line, as volk_profile_lite writes it,
+# else its file name, as volk_profile --cpu-profile names it. For each kernel
+# line the entry most boards of a signature agree on is kept; a tie goes to
+# the config given first.
+
+import argparse
+import collections
+import os
+import sys
+
+
+def read_config(path):
+    signature = None
+    entries = collections.OrderedDict()
+    with open(path) as config:
+        for line in config:
+            fields = line.split()
+            if not fields:
+                continue
+            if fields[0] == "#cpu" and len(fields) > 1:
+                signature = fields[1]
+            elif fields[0].startswith("volk_") and len(fields) >= 3:
+                # cost model and grain lines are kept whole, the fingerprint
+                # of a preference line differs from board to board
+                key = fields[0]
+                value = tuple(fields[1:]) if "~" in key else tuple(fields[1:3])
+                entries[key] = (value, line.rstrip("\n"))
+    return signature or os.path.basename(path), entries
+
+
+def merge(configs):
+    votes = collections.OrderedDict()
+    for entries in configs:
+        for key, (value, line) in entries.items():
+            kernel = votes.setdefault(key, collections.OrderedDict())
+            if value not in kernel:
+                kernel[value] = [0, line]
+            kernel[value][0] += 1
+    merged = []
+    n_disputed = 0
+    for key, kernel in votes.items():
+        _, line = max(kernel.values(), key=lambda vote: vote[0])
+        merged.append(line)
+        n_disputed += len(kernel) > 1
+    return merged, n_disputed
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Merge volk configs of many boards into per cpu profiles")
+    parser.add_argument("configs", nargs="+", help="configs profiled on the boards")
+    parser.add_argument("-o", "--output", default=".",
+                        help="config dir to write volk_config.d/<signature> to")
+    args = parser.parse_args()
+
+    by_signature = collections.OrderedDict()
+    for path in args.configs:
+        signature, entries = read_config(path)
+        by_signature.setdefault(signature, []).append(entries)
+
+    out_dir = os.path.join(args.output, "volk_config.d")
+    os.makedirs(out_dir, exist_ok=True)
+    for signature, configs in by_signature.items():
+        merged, n_disputed = merge(configs)
+        with open(os.path.join(out_dir, signature), "w") as config:
+            config.write("#this file is generated by volk_merge_configs.py.\n")
+            config.write("#the function name is followed by the preferred architecture.\n")
+            config.write("#cpu %s\n" % signature)
+            config.write("#merged from %d configs\n" % len(configs))
+            for line in merged:
+                config.write(line + "\n")
+        print("%s: %d configs, %d kernels, %d disputed" %
+              (signature, len(configs), len(merged), n_disputed))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -201,6 +201,7 @@ void option_list::parse(int argc, char** argv)
                     } catch (std::exception& exc) {
                         throw std::exception();
                     };
+                    break;
                 case STRING:
                     std::cout << this_option->printval << std::endl;
                     break;
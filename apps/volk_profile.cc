@@ -32,20 +32,34 @@
 #include <boost/filesystem/path_traits.hpp> // for filesystem
 #endif
 #include <stddef.h>          // for size_t
+#include <stdio.h>           // for snprintf
 #include <sys/stat.h>        // for stat
+#include <volk/volk_capture.h> // for volk_capture_load, volk_capture_calls
+#include <volk/volk_cpu.h>   // for volk_get_cpu_signature, volk_get_core_class
 #include <volk/volk_prefs.h> // for volk_get_config_path
+#include <algorithm>         // for max, min
+#include <chrono>            // for steady_clock
+#include <condition_variable> // for condition_variable
 #include <fstream>           // IWYU pragma: keep
 #include <iostream>          // for operator<<, basic_ostream
 #include <map>               // for map, map<>::iterator
+#include <mutex>             // for mutex, unique_lock
+#include <sstream>           // for stringstream
+#include <thread>            // for thread, hardware_concurrency
 #include <utility>           // for pair
 #include <vector>            // for vector, vector<>::const_...
 
 #include "kernel_tests.h"        // for init_test_list
 #include "qa_utils.h"            // for volk_test_results_t, vol...
+#include "volk/constants.h"      // for volk_version
 #include "volk/volk_complex.h"   // for lv_32fc_t
 #include "volk_option_helpers.h" // for option_list, option_t
 #include "volk_profile.h"
 
+#if defined(__linux__)
+#include <sched.h> // for sched_setaffinity
+#endif
+
 #if HAS_STD_FILESYSTEM
 #if HAS_STD_FILESYSTEM_EXPERIMENTAL
 namespace fs = std::experimental::filesystem;
@@ -62,6 +76,24 @@ void set_benchmark(bool val) { test_params.set_benchmark(val); }
 void set_tolerance(float val) { test_params.set_tol(val); }
 void set_vlen(int val) { test_params.set_vlen((unsigned int)val); }
 void set_iter(int val) { test_params.set_iter((unsigned int)val); }
+void set_reps(int val) { test_params.set_reps((unsigned int)val); }
+void set_misalign(int val) { test_params.set_misalign((unsigned int)val); }
+void set_scalar_work(int val) { test_params.set_scalar_work((unsigned int)val); }
+void set_perf_counters(bool val) { test_params.set_perf_counters(val); }
+void set_denormals(bool val) { test_params.set_denormals(val); }
+void set_fast(bool val) { test_params.set_fast(val); }
+void set_latency(bool val) { test_params.set_latency(val); }
+void set_cold(bool val) { test_params.set_cold(val); }
+void set_concurrent(int val) { test_params.set_concurrent((unsigned int)val); }
+void set_metric(std::string val)
+{
+    if (val != "time" && val != "energy") {
+        std::cerr << "Error: unknown metric " << val << ", use time or energy"
+                  << std::endl;
+        exit(1);
+    }
+    test_params.set_energy(val == "energy");
+}
 void set_substr(std::string val) { test_params.set_regex(val); }
 bool update_mode = false;
 void set_update(bool val) { update_mode = val; }
@@ -71,10 +103,37 @@ std::string json_filename("");
 void set_json(std::string val) { json_filename = val; }
 std::string volk_config_path("");
 void set_volk_config(std::string val) { volk_config_path = val; }
+bool length_buckets = false;
+void set_length_buckets(bool val) { length_buckets = val; }
+bool sweep_mode = false;
+void set_sweep(bool val) { sweep_mode = val; }
+bool parallel_grain = false;
+void set_parallel_grain(bool val) { parallel_grain = val; }
+bool cpu_profile = false;
+void set_cpu_profile(bool val) { cpu_profile = val; }
+bool core_classes = false;
+void set_core_classes(bool val) { core_classes = val; }
+std::string replay_filename("");
+void set_replay(std::string val) { replay_filename = val; }
+std::vector<std::string> kernel_modules;
+// the fitted cost models of the config, "cost" and the pair of each length
+// bucket keyed by "<kernel>~<impl>", and the parallel grains, "grain" and
+// the thread count and grain of each bucket keyed by "<kernel>~parallel"
+std::map<std::string, std::string> cost_models;
+void set_modules(std::string val)
+{
+    std::stringstream modules(val);
+    std::string module;
+    while (std::getline(modules, module, ',')) {
+        if (!module.empty())
+            kernel_modules.push_back(module);
+    }
+}
 
 int main(int argc, char* argv[])
 {
 
+    test_params.set_reps(5);
     option_list profile_options("volk_profile");
     profile_options.add(
         option_t("benchmark", "b", "Run all kernels (benchmark mode)", set_benchmark));
@@ -84,10 +143,63 @@ int main(int argc, char* argv[])
         option_t("vlen", "v", "Set the default vector length for tests", set_vlen));
     profile_options.add((option_t(
         "iter", "i", "Set the default number of test iterations per kernel", set_iter)));
+    profile_options.add((option_t("repetitions",
+                                  "N",
+                                  "Split the iterations into N timed repetitions "
+                                  "and rank by their median (default 5)",
+                                  set_reps)));
+    profile_options.add((option_t("misalign",
+                                  "M",
+                                  "Also time unaligned impls on buffers offset by "
+                                  "this many bytes and rank them by that run",
+                                  set_misalign)));
+    profile_options.add((option_t("scalar-work",
+                                  "W",
+                                  "Follow every call with N steps of scalar work, so "
+                                  "ISAs which lower the core clock are charged for it",
+                                  set_scalar_work)));
+    profile_options.add((option_t("perf-counters",
+                                  "P",
+                                  "Collect hardware performance counters around "
+                                  "every arch run (Linux perf_event_open)",
+                                  set_perf_counters)));
+    profile_options.add((option_t("denormals",
+                                  "D",
+                                  "Benchmark on floating point inputs which are all "
+                                  "denormal, to expose impls slowed down by them",
+                                  set_denormals)));
+    profile_options.add((option_t("fast",
+                                  "f",
+                                  "Time impls on short trials and only the close "
+                                  "contenders on longer ones, up to a quarter of iter",
+                                  set_fast)));
+    profile_options.add((option_t("latency",
+                                  "l",
+                                  "Also time single calls, report their p50, p99 and "
+                                  "p99.9 latency and rank impls by the p99",
+                                  set_latency)));
+    profile_options.add((option_t("cold",
+                                  "F",
+                                  "Flush the buffers from the caches before every "
+                                  "call, as for data arriving from a NIC or DMA",
+                                  set_cold)));
+    profile_options.add((option_t("concurrent",
+                                  "T",
+                                  "Run the kernel on N pinned threads at once, sharing "
+                                  "the memory bandwidth, and time one of them",
+                                  set_concurrent)));
+    profile_options.add((option_t("metric",
+                                  "e",
+                                  "Rank impls by time (default) or by energy, the "
+                                  "RAPL or platform energy counters' nJ per point",
+                                  set_metric)));
     profile_options.add(
         (option_t("tests-substr", "R", "Run tests matching substring", set_substr)));
-    profile_options.add(
-        (option_t("update", "u", "Run only kernels missing from config", set_update)));
+    profile_options.add((option_t("update",
+                                  "u",
+                                  "Run only kernels missing from config or profiled "
+                                  "with other impls, version, machine or cpu",
+                                  set_update)));
     profile_options.add(
         (option_t("dry-run",
                   "n",
@@ -97,12 +209,56 @@ int main(int argc, char* argv[])
         "json", "j", "Write results to JSON file named as argument value", set_json)));
     profile_options.add(
         (option_t("path", "p", "Specify the volk_config path", set_volk_config)));
+    profile_options.add((option_t("length-buckets",
+                                  "L",
+                                  "Also rank each kernel for short and for cache exceeding "
+                                  "vector length buckets",
+                                  set_length_buckets)));
+    profile_options.add((option_t("sweep",
+                                  "S",
+                                  "Benchmark each kernel over a geometric range of "
+                                  "vector lengths, also ranks the length buckets "
+                                  "and fits a cost model per impl",
+                                  set_sweep)));
+    profile_options.add((option_t("parallel-grain",
+                                  "G",
+                                  "Measure how the volk_parallel_ kernels scale with "
+                                  "threads and store the thread count and smallest "
+                                  "chunk of each length bucket",
+                                  set_parallel_grain)));
+    profile_options.add((option_t("cpu-profile",
+                                  "c",
+                                  "Write the config for this cpu model only, to "
+                                  "volk_config.d/<cpu signature>",
+                                  set_cpu_profile)));
+    profile_options.add((option_t("core-classes",
+                                  "C",
+                                  "On heterogeneous cpus also profile pinned to each "
+                                  "core class (P/E-cores, big.LITTLE)",
+                                  set_core_classes)));
+    profile_options.add((option_t("modules",
+                                  "m",
+                                  "Load out-of-tree kernel modules (comma separated) "
+                                  "and profile their kernels too",
+                                  set_modules)));
+    profile_options.add((option_t("replay",
+                                  "r",
+                                  "Rank the impls of the kernels of a VOLK_CAPTURE "
+                                  "trace by its mix of lengths, alignments and in "
+                                  "place calls, and only those kernels",
+                                  set_replay)));
     profile_options.parse(argc, argv);
 
     if (profile_options.present("help")) {
         return 0;
     }
 
+    if (test_params.energy() && test_params.latency()) {
+        std::cerr << "Error: --metric energy and --latency rank by different measures"
+                  << std::endl;
+        return 1;
+    }
+
     if (dry_run) {
         std::cout << "Warning: this IS a dry-run. Config will not be written!"
                   << std::endl;
@@ -118,17 +274,41 @@ int main(int argc, char* argv[])
 
     if (volk_config_path != "") {
         config_file = volk_config_path + "/volk_config";
+        if (cpu_profile) {
+            char signature[128];
+            volk_get_cpu_signature(signature, sizeof(signature));
+            config_file = volk_config_path + "/volk_config.d/" + signature;
+        }
+    }
+
+    // the call shapes of each kernel of the trace
+    std::map<std::string, volk_replay_mix_t> replay_mixes;
+    if (replay_filename != "" && !read_replay_trace(replay_filename, &replay_mixes)) {
+        std::cerr << "Error: " << replay_filename << " is no VOLK_CAPTURE trace"
+                  << std::endl;
+        return 1;
     }
 
     // Run tests
     std::vector<volk_test_results_t> results;
-    if (update_mode) {
+    std::vector<volk_test_results_t> sweep_results;
+    // a replay keeps the entries of the kernels it leaves out
+    if (update_mode || replay_filename != "") {
         if (config_file != "")
             read_results(&results, config_file);
         else
             read_results(&results);
     }
 
+    // Modules register their kernels on load, init_test_list picks them up
+    for (size_t ii = 0; ii < kernel_modules.size(); ++ii) {
+        if (!volk_load_kernel_module(kernel_modules[ii].c_str())) {
+            std::cerr << "Error: unable to load the kernel module " << kernel_modules[ii]
+                      << std::endl;
+            return 1;
+        }
+    }
+
     // Initialize the list of tests
     std::vector<volk_test_case_t> test_cases = init_test_list(test_params);
 
@@ -145,26 +325,69 @@ int main(int argc, char* argv[])
         }
 
         // if we are in update mode check if we've already got results
-        // if we have any, then no need to test that kernel
+        // if we have any which were profiled with the same impls, version,
+        // machine and cpu, then no need to test that kernel
+        const std::string fingerprint = kernel_fingerprint(test_case);
         bool update = true;
+        bool stale = false;
         if (update_mode) {
             for (unsigned int jj = 0; jj < results.size(); ++jj) {
                 if (results[jj].name == test_case.name() ||
                     results[jj].name == test_case.puppet_master_name()) {
-                    update = false;
+                    update = stale = results[jj].fingerprint != fingerprint;
                     break;
                 }
             }
         }
 
+        const std::string config_name = test_case.puppet_master_name() == "NULL"
+                                            ? test_case.name()
+                                            : test_case.puppet_master_name();
+        const bool replay = replay_mixes.count(config_name) != 0;
+        if (replay_filename != "") {
+            regex_match = regex_match && replay;
+            update = stale = true;
+        }
+
         if (regex_match && update) {
+            if (stale) {
+                // drop the kernel's old entries, length buckets and core classes too
+                if (!replay) {
+                    std::cout << "Profile of " << config_name << " is out of date"
+                              << std::endl;
+                }
+                for (size_t jj = results.size(); jj-- > 0;) {
+                    if (is_kernel_entry(results[jj], config_name)) {
+                        results.erase(results.begin() + jj);
+                    }
+                }
+                cost_models.erase(cost_models.lower_bound(config_name + "~"),
+                                  cost_models.lower_bound(config_name + "\x7f"));
+            }
             try {
+                if (replay) {
+                    run_replay(test_case, replay_mixes[config_name], &results);
+                    continue;
+                }
                 run_volk_tests(test_case.desc(),
                                test_case.kernel_ptr(),
                                test_case.name(),
                                test_case.test_parameters(),
                                &results,
                                test_case.puppet_master_name());
+                results.back().fingerprint = fingerprint;
+                const volk_test_results_t default_result = results.back();
+                if (sweep_mode) {
+                    run_sweep(test_case, &results, &sweep_results);
+                } else if (length_buckets) {
+                    run_length_buckets(test_case, &results);
+                }
+                if (core_classes) {
+                    run_core_classes(test_case, default_result, &results);
+                }
+                if (parallel_grain) {
+                    run_parallel_grain(test_case, default_result);
+                }
             } catch (std::string& error) {
                 std::cerr << "Caught Exception in 'run_volk_tests': " << error
                           << std::endl;
@@ -175,7 +398,7 @@ int main(int argc, char* argv[])
 
     // Output results according to provided options
     if (json_filename != "") {
-        write_json(json_file, results);
+        write_json(json_file, results, sweep_results);
         json_file.close();
     }
 
@@ -190,10 +413,605 @@ int main(int argc, char* argv[])
     return 0;
 }
 
+std::string kernel_fingerprint(volk_test_case_t& test_case)
+{
+    char signature[128];
+    volk_get_cpu_signature(signature, sizeof(signature));
+    std::string key =
+        std::string(volk_version()) + ";" + volk_get_machine() + ";" + signature;
+    // an energy profile is out of date for a time ranking and the other way round
+    if (test_params.energy()) {
+        key += ";energy";
+    }
+    const volk_func_desc_t desc = test_case.desc();
+    for (size_t i = 0; i < desc.n_impls; ++i) {
+        key += ";" + std::string(desc.impl_names[i]) + ":" +
+               std::to_string(desc.impl_deps[i]) + ":" +
+               std::to_string(desc.impl_alignment[i]);
+    }
+
+    // 64 bit FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < key.size(); ++i) {
+        hash ^= (unsigned char)key[i];
+        hash *= 1099511628211ULL;
+    }
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+    return std::string(hex);
+}
+
+// an entry of the kernel: its default one, or one for a length bucket or core class
+bool is_kernel_entry(const volk_test_results_t& result, const std::string& config_name)
+{
+    const std::string& name = result.config_name;
+    return name.compare(0, config_name.size(), config_name) == 0 &&
+           (name.size() == config_name.size() || name[config_name.size()] == '@' ||
+            name[config_name.size()] == '#');
+}
+
+void run_length_buckets(volk_test_case_t& test_case,
+                        std::vector<volk_test_results_t>* results)
+{
+    const volk_test_results_t& default_result = results->back();
+    const std::string default_a = default_result.best_arch_a;
+    const std::string default_u = default_result.best_arch_u;
+    const std::string config_name = default_result.config_name;
+    volk_test_params_t params = test_case.test_parameters();
+    params.set_offload(true);
+    // keep the number of processed items roughly constant across buckets
+    const unsigned long long total_items =
+        (unsigned long long)params.vlen() * params.iter();
+
+    for (size_t bucket = 0; bucket + 1 < VOLK_N_LENGTH_BUCKETS; ++bucket) {
+        const unsigned int bound = volk_get_length_bucket_bound(bucket);
+        if (bound >= params.vlen()) {
+            continue; // the default run already covers this length
+        }
+        params.set_vlen(bound);
+        params.set_iter((unsigned int)std::max(1ULL, total_items / bound));
+        run_volk_tests(test_case.desc(),
+                       test_case.kernel_ptr(),
+                       test_case.name(),
+                       params,
+                       results,
+                       test_case.puppet_master_name());
+
+        // only store buckets which disagree with the default preference
+        volk_test_results_t& bucket_result = results->back();
+        if (bucket_result.best_arch_a == default_a &&
+            bucket_result.best_arch_u == default_u) {
+            results->pop_back();
+        } else {
+            bucket_result.config_name = config_name + "@" + std::to_string(bound);
+        }
+    }
+
+    // the default run is cache resident; rank the lengths above the last bound,
+    // where streaming stores can win, on buffers larger than the caches
+    const unsigned int last_bound =
+        volk_get_length_bucket_bound(VOLK_N_LENGTH_BUCKETS - 2);
+    if (test_case.test_parameters().vlen() <= last_bound) {
+        params.set_vlen(VOLK_LARGE_BUCKET_VLEN);
+        params.set_iter(
+            (unsigned int)std::max(1ULL, total_items / VOLK_LARGE_BUCKET_VLEN));
+        run_volk_tests(test_case.desc(),
+                       test_case.kernel_ptr(),
+                       test_case.name(),
+                       params,
+                       results,
+                       test_case.puppet_master_name());
+        volk_test_results_t& bucket_result = results->back();
+        if (bucket_result.best_arch_a == default_a &&
+            bucket_result.best_arch_u == default_u) {
+            results->pop_back();
+        } else {
+            bucket_result.config_name = config_name + "@>" + std::to_string(last_bound);
+        }
+    }
+}
+
+bool read_replay_trace(const std::string& path,
+                       std::map<std::string, volk_replay_mix_t>* mixes)
+{
+    volk_capture_header_t* trace = volk_capture_load(path.c_str());
+    if (!trace) {
+        return false;
+    }
+    const volk_capture_call_t* calls = volk_capture_calls(trace);
+    for (uint64_t i = 0; i < trace->n_calls; ++i) {
+        const volk_capture_call_t& call = calls[i];
+        if (call.kernel >= trace->n_kernels) {
+            continue;
+        }
+        volk_replay_shape_t shape;
+        shape.vlen = call.num_points;
+        shape.misalign = 0;
+        for (unsigned int k = 0; k < VOLK_CAPTURE_MAX_POINTERS; ++k) {
+            const unsigned int offset = volk_capture_offset(&call, k);
+            if (trace->alignment && offset % trace->alignment) {
+                shape.misalign = offset;
+                break;
+            }
+        }
+        shape.in_place = call.in_place != 0;
+        shape.aligned = (call.flags & VOLK_CAPTURE_CALL_ALIGNED) != 0;
+        (*mixes)[volk_capture_kernel_name(trace, call.kernel)][shape]++;
+    }
+    std::cout << "Replaying " << trace->n_calls << " calls of " << mixes->size()
+              << " kernels captured on " << trace->machine;
+    if (trace->dropped) {
+        std::cout << ", " << trace->dropped << " more calls were not captured";
+    }
+    std::cout << std::endl;
+    volk_capture_free(trace);
+    return true;
+}
+
+void run_replay(volk_test_case_t& test_case,
+                const volk_replay_mix_t& mix,
+                std::vector<volk_test_results_t>* results)
+{
+    const volk_func_desc_t desc = test_case.desc();
+    const std::string config_name = test_case.puppet_master_name() == "NULL"
+                                        ? test_case.name()
+                                        : test_case.puppet_master_name();
+    volk_test_params_t params = test_case.test_parameters();
+    const unsigned long long total_items =
+        (unsigned long long)params.vlen() * params.iter();
+
+    // the most frequent shapes; the rest are rare enough not to change the ranking
+    std::vector<std::pair<unsigned long long, volk_replay_shape_t>> shapes;
+    volk_replay_mix_t::const_iterator entry;
+    for (entry = mix.begin(); entry != mix.end(); ++entry) {
+        shapes.push_back(std::make_pair(entry->second, entry->first));
+    }
+    std::stable_sort(shapes.begin(),
+                     shapes.end(),
+                     [](const std::pair<unsigned long long, volk_replay_shape_t>& a,
+                        const std::pair<unsigned long long, volk_replay_shape_t>& b) {
+                         return a.first > b.first;
+                     });
+    if (shapes.size() > VOLK_REPLAY_MAX_SHAPES) {
+        shapes.resize(VOLK_REPLAY_MAX_SHAPES);
+    }
+
+    // the ns of a call of each passing impl on each shape: timed on buffers of
+    // the shape's length and misalignment, scaled by the in place run if it was
+    std::vector<volk_test_results_t> shape_results;
+    std::vector<std::map<std::string, double>> shape_ns(shapes.size());
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        const volk_replay_shape_t& shape = shapes[i].second;
+        const unsigned int vlen =
+            shape.vlen ? shape.vlen : test_case.test_parameters().vlen();
+        params.set_vlen(vlen);
+        params.set_iter(
+            (unsigned int)std::max(1ULL, std::min(1ULL << 20, total_items / vlen)));
+        params.set_misalign(shape.aligned ? 0 : shape.misalign);
+        std::cout << "Replaying " << shapes[i].first << " calls of " << vlen
+                  << " points, " << (shape.aligned ? "aligned" : "unaligned")
+                  << (shape.in_place ? ", in place" : "") << std::endl;
+        run_volk_tests(desc,
+                       test_case.kernel_ptr(),
+                       test_case.name(),
+                       params,
+                       &shape_results,
+                       test_case.puppet_master_name());
+        const std::map<std::string, volk_test_time_t>& times =
+            shape_results.back().results;
+        std::map<std::string, volk_test_time_t>::const_iterator time;
+        for (time = times.begin(); time != times.end(); ++time) {
+            const volk_test_time_t& t = time->second;
+            if (!t.pass || !(t.time > 0.0)) {
+                continue;
+            }
+            double ns = t.ns_per_point * vlen;
+            if (!shape.aligned && t.misaligned_time > 0.0) {
+                ns *= t.misaligned_time / t.time;
+            }
+            if (shape.in_place && t.inplace_time > 0.0) {
+                ns *= t.inplace_time / t.time;
+            }
+            shape_ns[i][time->first] = ns;
+        }
+    }
+
+    // the impl with the least ns over the calls of the length bucket, or of all
+    // lengths for bucket VOLK_N_LENGTH_BUCKETS, which went to the aligned or the
+    // unaligned impl; "" if there were none. An impl has to pass on every shape.
+    const auto rank = [&](size_t bucket, bool aligned) {
+        std::map<std::string, double> ns;
+        std::map<std::string, size_t> n_timed;
+        size_t n_shapes = 0;
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            const volk_replay_shape_t& shape = shapes[i].second;
+            if (shape.aligned != aligned ||
+                (bucket < VOLK_N_LENGTH_BUCKETS &&
+                 (!shape.vlen || volk_get_length_bucket(shape.vlen) != bucket))) {
+                continue;
+            }
+            n_shapes++;
+            std::map<std::string, double>::const_iterator impl;
+            for (impl = shape_ns[i].begin(); impl != shape_ns[i].end(); ++impl) {
+                ns[impl->first] += shapes[i].first * impl->second;
+                n_timed[impl->first]++;
+            }
+        }
+        std::string best;
+        double best_ns = 0.0;
+        for (size_t i = 0; i < desc.n_impls; ++i) {
+            const std::string name = desc.impl_names[i];
+            // offloaded impls are only chosen per length bucket, as by the profile
+            if (!n_shapes || n_timed[name] != n_shapes ||
+                (!aligned && desc.impl_alignment[i]) ||
+                (bucket == VOLK_N_LENGTH_BUCKETS &&
+                 (desc.impl_deps[i] & VOLK_OFFLOAD_ARCHS))) {
+                continue;
+            }
+            if (best.empty() || ns[name] < best_ns) {
+                best = name;
+                best_ns = ns[name];
+            }
+        }
+        return best;
+    };
+
+    // without calls to one of the pointers it keeps the ranking of the other
+    volk_test_results_t replay = shape_results.front();
+    const std::string best_a = rank(VOLK_N_LENGTH_BUCKETS, true);
+    const std::string best_u = rank(VOLK_N_LENGTH_BUCKETS, false);
+    replay.config_name = config_name;
+    replay.best_arch_a = !best_a.empty() ? best_a : shape_results.front().best_arch_a;
+    replay.best_arch_u = !best_u.empty() ? best_u : shape_results.front().best_arch_u;
+    replay.fingerprint = kernel_fingerprint(test_case);
+    std::cout << "Best aligned arch of the trace: " << replay.best_arch_a << std::endl;
+    std::cout << "Best unaligned arch of the trace: " << replay.best_arch_u << std::endl;
+    results->push_back(replay);
+
+    // length buckets whose calls prefer other impls get entries of their own
+    for (size_t bucket = 0; bucket < VOLK_N_LENGTH_BUCKETS; ++bucket) {
+        std::string bucket_a = rank(bucket, true);
+        std::string bucket_u = rank(bucket, false);
+        if (bucket_a.empty() && bucket_u.empty()) {
+            continue;
+        }
+        bucket_a = !bucket_a.empty() ? bucket_a : replay.best_arch_a;
+        bucket_u = !bucket_u.empty() ? bucket_u : replay.best_arch_u;
+        if (bucket_a == replay.best_arch_a && bucket_u == replay.best_arch_u) {
+            continue;
+        }
+        volk_test_results_t bucket_result = replay;
+        bucket_result.best_arch_a = bucket_a;
+        bucket_result.best_arch_u = bucket_u;
+        bucket_result.fingerprint.clear();
+        bucket_result.config_name =
+            bucket + 1 < VOLK_N_LENGTH_BUCKETS
+                ? config_name + "@" + std::to_string(volk_get_length_bucket_bound(bucket))
+                : config_name + "@>" +
+                      std::to_string(
+                          volk_get_length_bucket_bound(VOLK_N_LENGTH_BUCKETS - 2));
+        results->push_back(bucket_result);
+    }
+}
+
+// ns to hand a job to n_threads - 1 threads waiting on a condition variable
+// and wait for all of them, as the volk_parallel_ pool does for every call
+static double pool_round_trip_ns(unsigned int n_threads)
+{
+    const unsigned int rounds = 1000;
+    std::mutex lock;
+    std::condition_variable work, done;
+    unsigned long generation = 0;
+    unsigned int finished = 0;
+    bool stop = false;
+    std::vector<std::thread> threads;
+    for (unsigned int thread = 1; thread < n_threads; ++thread) {
+        threads.push_back(std::thread([&]() {
+            unsigned long seen = 0;
+            std::unique_lock<std::mutex> guard(lock);
+            for (;;) {
+                work.wait(guard, [&]() { return stop || generation != seen; });
+                if (stop) {
+                    break;
+                }
+                seen = generation;
+                if (++finished == n_threads - 1) {
+                    done.notify_one();
+                }
+            }
+        }));
+    }
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int round = 0; round < rounds; ++round) {
+        std::unique_lock<std::mutex> guard(lock);
+        finished = 0;
+        generation++;
+        work.notify_all();
+        done.wait(guard, [&]() { return finished == n_threads - 1; });
+    }
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stop = true;
+    }
+    work.notify_all();
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    return elapsed.count() / rounds;
+}
+
+// ns of one call of the impl on vlen points while n_threads - 1 other threads
+// run it on their own buffers, i.e. one slice of a job split n_threads ways
+static double slice_ns(volk_test_case_t& test_case,
+                       const volk_func_desc_t& desc,
+                       volk_test_params_t params,
+                       unsigned int vlen,
+                       unsigned int n_threads)
+{
+    const unsigned long long total_items =
+        (unsigned long long)params.vlen() * params.iter();
+    std::vector<volk_test_results_t> results;
+    params.set_vlen(vlen);
+    params.set_iter(
+        (unsigned int)std::max(1ULL, std::min(1ULL << 20, total_items / vlen)));
+    params.set_concurrent(n_threads);
+    run_volk_tests(desc,
+                   test_case.kernel_ptr(),
+                   test_case.name(),
+                   params,
+                   &results,
+                   test_case.puppet_master_name());
+    const std::map<std::string, volk_test_time_t>& times = results.back().results;
+    const std::map<std::string, volk_test_time_t>::const_iterator time =
+        times.find(desc.impl_names[0]);
+    return time != times.end() ? time->second.ns_per_point * vlen : 0.0;
+}
+
+void run_parallel_grain(volk_test_case_t& test_case,
+                        const volk_test_results_t& default_result)
+{
+    const std::string config_name = default_result.config_name;
+    const unsigned int max_threads = std::thread::hardware_concurrency();
+    if (test_case.puppet_master_name() != "NULL" ||
+        !volk_has_parallel(config_name.c_str()) || max_threads < 2) {
+        return;
+    }
+
+    // only the preferred unaligned impl, the one most chunks run
+    volk_func_desc_t desc = test_case.desc();
+    for (size_t i = 0; i < desc.n_impls; ++i) {
+        if (default_result.best_arch_u == desc.impl_names[i]) {
+            desc.impl_names += i;
+            desc.impl_deps += i;
+            desc.impl_alignment += i;
+            if (desc.impls) {
+                desc.impls += i;
+            }
+            desc.n_impls = 1;
+            break;
+        }
+    }
+    if (desc.n_impls != 1) {
+        return;
+    }
+
+    std::map<unsigned int, double> round_trip_ns;
+    std::stringstream tuning;
+    tuning << "grain";
+    for (size_t bucket = 0; bucket < VOLK_N_LENGTH_BUCKETS; ++bucket) {
+        const unsigned int bound = volk_get_length_bucket_bound(bucket);
+        const unsigned int vlen = bound ? bound : VOLK_LARGE_BUCKET_VLEN;
+        const double serial_ns =
+            slice_ns(test_case, desc, test_case.test_parameters(), vlen, 1);
+        double best_ns = serial_ns;
+        unsigned int best_threads = 1;
+        for (unsigned int n_threads = 2; n_threads <= max_threads;
+             n_threads = n_threads * 2 > max_threads && n_threads < max_threads
+                             ? max_threads
+                             : n_threads * 2) {
+            if (!round_trip_ns.count(n_threads)) {
+                round_trip_ns[n_threads] = pool_round_trip_ns(n_threads);
+            }
+            const double ns = slice_ns(test_case,
+                                       desc,
+                                       test_case.test_parameters(),
+                                       (vlen + n_threads - 1) / n_threads,
+                                       n_threads) +
+                              round_trip_ns[n_threads];
+            // more threads have to pay for themselves, e.g. not once the
+            // memory bandwidth is saturated
+            if (ns > 0.0 && ns < VOLK_GRAIN_MIN_GAIN * best_ns) {
+                best_ns = ns;
+                best_threads = n_threads;
+            }
+        }
+
+        // a chunk has to outweigh the round trip of the pool by a margin
+        const double ns_per_point = serial_ns > 0.0 ? serial_ns / vlen : 0.0;
+        const double trip_ns = round_trip_ns.count(best_threads)
+                                   ? round_trip_ns[best_threads]
+                                   : round_trip_ns.begin()->second;
+        size_t grain = ns_per_point > 0.0
+                           ? (size_t)(VOLK_GRAIN_OVERHEAD_FACTOR * trip_ns / ns_per_point)
+                           : (size_t)vlen;
+        grain = std::max(grain, (size_t)VOLK_GRAIN_MIN);
+        std::cout << config_name << " on " << vlen << " points: " << best_threads
+                  << " threads, grain " << grain << std::endl;
+        tuning << " " << best_threads << " " << grain;
+    }
+    cost_models[config_name + "~parallel"] = tuning.str();
+}
+
+void run_core_classes(volk_test_case_t& test_case,
+                      const volk_test_results_t& default_result,
+                      std::vector<volk_test_results_t>* results)
+{
+#if defined(__linux__)
+    const unsigned int n_core_classes = volk_get_n_core_classes();
+    cpu_set_t all_cpus;
+    if (n_core_classes < 2 || sched_getaffinity(0, sizeof(all_cpus), &all_cpus)) {
+        return;
+    }
+
+    for (unsigned int core_class = 0; core_class < n_core_classes; ++core_class) {
+        cpu_set_t class_cpus;
+        CPU_ZERO(&class_cpus);
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &all_cpus) && volk_get_core_class(cpu) == core_class) {
+                CPU_SET(cpu, &class_cpus);
+            }
+        }
+        if (!CPU_COUNT(&class_cpus) ||
+            sched_setaffinity(0, sizeof(class_cpus), &class_cpus)) {
+            continue;
+        }
+        std::cout << "Pinned to core class " << core_class << std::endl;
+        run_volk_tests(test_case.desc(),
+                       test_case.kernel_ptr(),
+                       test_case.name(),
+                       test_case.test_parameters(),
+                       results,
+                       test_case.puppet_master_name());
+
+        // only store classes which disagree with the default preference
+        volk_test_results_t& class_result = results->back();
+        if (class_result.best_arch_a == default_result.best_arch_a &&
+            class_result.best_arch_u == default_result.best_arch_u) {
+            results->pop_back();
+        } else {
+            class_result.config_name =
+                default_result.config_name + "#" + std::to_string(core_class);
+        }
+    }
+    sched_setaffinity(0, sizeof(all_cpus), &all_cpus);
+#else
+    (void)test_case;
+    (void)default_result;
+    (void)results;
+#endif
+}
+
+void run_sweep(volk_test_case_t& test_case,
+               std::vector<volk_test_results_t>* results,
+               std::vector<volk_test_results_t>* sweep_results)
+{
+    const volk_test_results_t default_result = results->back();
+    volk_test_params_t params = test_case.test_parameters();
+    params.set_offload(true);
+    // keep the number of processed items roughly constant across lengths, but
+    // bound the per call overhead dominated runs at the short end
+    const unsigned long long total_items =
+        (unsigned long long)params.vlen() * params.iter();
+    const unsigned long long max_iter = 1ULL << 20;
+    const unsigned int default_vlen = params.vlen();
+    const size_t first_point = sweep_results->size();
+
+    // the lengths are powers of VOLK_SWEEP_FACTOR, which include the bucket bounds
+    for (unsigned long long vlen = VOLK_SWEEP_MIN_VLEN; vlen < default_vlen;
+         vlen *= VOLK_SWEEP_FACTOR) {
+        params.set_vlen((unsigned int)vlen);
+        params.set_iter(
+            (unsigned int)std::max(1ULL, std::min(max_iter, total_items / vlen)));
+        run_volk_tests(test_case.desc(),
+                       test_case.kernel_ptr(),
+                       test_case.name(),
+                       params,
+                       sweep_results,
+                       test_case.puppet_master_name());
+    }
+    sweep_results->push_back(default_result);
+    fit_cost_models(default_result.config_name,
+                    std::vector<volk_test_results_t>(sweep_results->begin() + first_point,
+                                                     sweep_results->end()));
+
+    // feed the size bucketed dispatch from the sweep points at the bucket bounds
+    for (size_t bucket = 0; bucket + 1 < VOLK_N_LENGTH_BUCKETS; ++bucket) {
+        const unsigned int bound = volk_get_length_bucket_bound(bucket);
+        for (size_t i = sweep_results->size(); i-- > 0;) {
+            const volk_test_results_t& point = (*sweep_results)[i];
+            if (point.name != default_result.name) {
+                break;
+            }
+            if (point.vlen == bound && point.vlen < default_result.vlen &&
+                (point.best_arch_a != default_result.best_arch_a ||
+                 point.best_arch_u != default_result.best_arch_u)) {
+                results->push_back(point);
+                results->back().config_name =
+                    default_result.config_name + "@" + std::to_string(bound);
+            }
+        }
+    }
+}
+
+void fit_cost_models(const std::string& config_name,
+                     const std::vector<volk_test_results_t>& points)
+{
+    // the (points, ns) of each call the impl was timed on
+    std::map<std::string, std::vector<std::pair<double, double>>> calls;
+    for (size_t i = 0; i < points.size(); ++i) {
+        std::map<std::string, volk_test_time_t>::const_iterator result;
+        for (result = points[i].results.begin(); result != points[i].results.end();
+             ++result) {
+            if (result->second.ns_per_point > 0) {
+                calls[result->first].push_back(std::make_pair(
+                    (double)points[i].vlen, result->second.ns_per_point * points[i].vlen));
+            }
+        }
+    }
+
+    // a least squares line per bucket, over the lengths up to its bound from the
+    // bound of the bucket before; one with fewer than two keeps the previous line
+    std::map<std::string, std::vector<std::pair<double, double>>>::const_iterator impl;
+    for (impl = calls.begin(); impl != calls.end(); ++impl) {
+        std::stringstream model;
+        double overhead = 0.0, slope = 0.0;
+        model << "cost";
+        for (size_t bucket = 0; bucket < VOLK_N_LENGTH_BUCKETS; ++bucket) {
+            const double lo = bucket ? volk_get_length_bucket_bound(bucket - 1) : 0.0;
+            const double hi = (bucket + 1 < VOLK_N_LENGTH_BUCKETS)
+                                  ? volk_get_length_bucket_bound(bucket)
+                                  : 1e300;
+            double n = 0.0, sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+            for (size_t i = 0; i < impl->second.size(); ++i) {
+                const double x = impl->second[i].first, y = impl->second[i].second;
+                if (x >= lo && x <= hi) {
+                    n += 1.0;
+                    sx += x;
+                    sy += y;
+                    sxx += x * x;
+                    sxy += x * y;
+                }
+            }
+            if (n >= 2.0 && n * sxx - sx * sx > 0.0) {
+                slope = (n * sxy - sx * sy) / (n * sxx - sx * sx);
+                overhead = (sy - slope * sx) / n;
+                // noise can tip a flat line below zero on either end
+                if (slope < 0.0) {
+                    slope = 0.0;
+                    overhead = sy / n;
+                } else if (overhead < 0.0) {
+                    overhead = 0.0;
+                    slope = sxy / sxx;
+                }
+            }
+            model << " " << overhead << " " << slope;
+        }
+        cost_models[config_name + "~" + impl->first] = model.str();
+    }
+}
+
 void read_results(std::vector<volk_test_results_t>* results)
 {
     char path[1024];
-    volk_get_config_path(path, true);
+    if (cpu_profile) {
+        volk_get_cpu_config_path(path, true);
+    } else {
+        volk_get_config_path(path, true);
+    }
     if (path[0] == 0) {
         std::cout << "No prior test results found ..." << std::endl;
         return;
@@ -238,12 +1056,26 @@ void read_results(std::vector<volk_test_results_t>* results, std::string path)
                 config_str.erase(0, found + 1);
             }
 
-            if (single_kernel_result.size() == 3) {
+            // a cost model or parallel grain, kept as it is until its kernel is
+            // profiled again
+            if (single_kernel_result.size() > 2 &&
+                (single_kernel_result[1] == "cost" || single_kernel_result[1] == "grain") &&
+                single_kernel_result[0].find('~') != std::string::npos) {
+                const std::string line(config_line);
+                cost_models[single_kernel_result[0]] = line.substr(line.find(' ') + 1);
+                continue;
+            }
+
+            // kernel_name aligned unaligned, and the fingerprint if the entry has one
+            if (single_kernel_result.size() == 3 || single_kernel_result.size() == 4) {
                 volk_test_results_t kernel_result;
                 kernel_result.name = std::string(single_kernel_result[0]);
                 kernel_result.config_name = std::string(single_kernel_result[0]);
-                kernel_result.best_arch_u = std::string(single_kernel_result[1]);
-                kernel_result.best_arch_a = std::string(single_kernel_result[2]);
+                kernel_result.best_arch_a = std::string(single_kernel_result[1]);
+                kernel_result.best_arch_u = std::string(single_kernel_result[2]);
+                if (single_kernel_result.size() == 4) {
+                    kernel_result.fingerprint = single_kernel_result[3];
+                }
                 results->push_back(kernel_result);
             }
         }
@@ -253,7 +1085,11 @@ void read_results(std::vector<volk_test_results_t>* results, std::string path)
 void write_results(const std::vector<volk_test_results_t>* results, bool update_result)
 {
     char path[1024];
-    volk_get_config_path(path, false);
+    if (cpu_profile) {
+        volk_get_cpu_config_path(path, false);
+    } else {
+        volk_get_config_path(path, false);
+    }
     if (path[0] == 0) {
         std::cout << "Aborting 'No config save path found' ..." << std::endl;
         return;
@@ -297,6 +1133,13 @@ void write_results(const std::vector<volk_test_results_t>* results,
         config << "\
 #this file is generated by volk_profile.\n\
 #the function name is followed by the preferred architecture.\n\
+#a name suffix @N restricts the entry to vector lengths up to N, @>N to lengths above.\n\
+#the last field fingerprints the impls, version, machine and cpu profiled with;\n\
+#volk_profile --update profiles kernels again when it changed.\n\
+#a <kernel>~<impl> cost line holds the ns of a call, overhead + ns per point * length,\n\
+#as the two numbers of each length bucket.\n\
+#a <kernel>~parallel grain line holds the thread count and smallest chunk of the\n\
+#volk_parallel_ kernel, as the two numbers of each length bucket.\n\
 ";
     }
 
@@ -304,14 +1147,53 @@ void write_results(const std::vector<volk_test_results_t>* results,
     for (profile_results = results->begin(); profile_results != results->end();
          ++profile_results) {
         config << profile_results->config_name << " " << profile_results->best_arch_a
-               << " " << profile_results->best_arch_u << std::endl;
+               << " " << profile_results->best_arch_u;
+        if (!profile_results->fingerprint.empty()) {
+            config << " " << profile_results->fingerprint;
+        }
+        config << std::endl;
+    }
+    if (!update_result) {
+        std::map<std::string, std::string>::const_iterator model;
+        for (model = cost_models.begin(); model != cost_models.end(); ++model) {
+            config << model->first << " " << model->second << std::endl;
+        }
     }
     config.close();
+
+    // the compiled config is always rebuilt from the full set of results
+    if (!update_result) {
+        write_binary_results(results, path + ".bin");
+    }
 }
 
-void write_json(std::ofstream& json_file, std::vector<volk_test_results_t> results)
+void write_binary_results(const std::vector<volk_test_results_t>* results,
+                          const std::string path)
+{
+    std::vector<volk_arch_pref_t> prefs(results->size());
+    for (size_t i = 0; i < results->size(); ++i) {
+        const volk_test_results_t& result = (*results)[i];
+        volk_arch_pref_t& pref = prefs[i];
+        result.config_name.copy(pref.name, sizeof(pref.name) - 1);
+        result.best_arch_a.copy(pref.impl_a, sizeof(pref.impl_a) - 1);
+        result.best_arch_u.copy(pref.impl_u, sizeof(pref.impl_u) - 1);
+        pref.name[std::min(result.config_name.size(), sizeof(pref.name) - 1)] = '\0';
+        pref.impl_a[std::min(result.best_arch_a.size(), sizeof(pref.impl_a) - 1)] = '\0';
+        pref.impl_u[std::min(result.best_arch_u.size(), sizeof(pref.impl_u) - 1)] = '\0';
+    }
+
+    std::cout << "Writing " << path << "..." << std::endl;
+    if (!volk_write_preferences_binary(path.c_str(), prefs.data(), prefs.size())) {
+        std::cout << "Error writing file " << path << std::endl;
+    }
+}
+
+void write_json(std::ofstream& json_file,
+                std::vector<volk_test_results_t> results,
+                const std::vector<volk_test_results_t>& sweep_results)
 {
     json_file << "{" << std::endl;
+    json_file << " \"stream_gbps\": " << volk_qa_stream_gbps() << "," << std::endl;
     json_file << " \"volk_tests\": [" << std::endl;
     size_t len = results.size();
     size_t i = 0;
@@ -337,7 +1219,43 @@ void write_json(std::ofstream& json_file, std::vector<volk_test_results_t> resul
             json_file << "    \"" << time.name << "\": {" << std::endl;
             json_file << "     \"name\": \"" << time.name << "\"," << std::endl;
             json_file << "     \"time\": " << time.time << "," << std::endl;
-            json_file << "     \"units\": \"" << time.units << "\"" << std::endl;
+            json_file << "     \"units\": \"" << time.units << "\"," << std::endl;
+            json_file << "     \"reps\": " << time.reps << "," << std::endl;
+            json_file << "     \"mad\": " << time.mad << "," << std::endl;
+            json_file << "     \"ns_per_point\": " << time.ns_per_point << ","
+                      << std::endl;
+            json_file << "     \"gbps\": " << time.gbps << "," << std::endl;
+            json_file << "     \"cycles_per_point\": " << time.cycles_per_point << ","
+                      << std::endl;
+            json_file << "     \"gflops\": " << time.gflops << "," << std::endl;
+            json_file << "     \"stream_fraction\": " << time.stream_fraction << ","
+                      << std::endl;
+            json_file << "     \"misaligned_time\": " << time.misaligned_time << ","
+                      << std::endl;
+            json_file << "     \"inplace_time\": " << time.inplace_time;
+            if (time.p99_ns > 0) {
+                json_file << "," << std::endl
+                          << "     \"p50_ns\": " << time.p50_ns << "," << std::endl
+                          << "     \"p99_ns\": " << time.p99_ns << "," << std::endl
+                          << "     \"p999_ns\": " << time.p999_ns;
+            }
+            if (time.nj_per_point > 0) {
+                json_file << "," << std::endl
+                          << "     \"nj_per_point\": " << time.nj_per_point;
+            }
+            if (!time.counters.empty()) {
+                json_file << "," << std::endl << "     \"counters\": {";
+                std::map<std::string, double>::const_iterator counter;
+                for (counter = time.counters.begin(); counter != time.counters.end();
+                     ++counter) {
+                    if (counter != time.counters.begin()) {
+                        json_file << ",";
+                    }
+                    json_file << " \"" << counter->first << "\": " << counter->second;
+                }
+                json_file << " }";
+            }
+            json_file << std::endl;
             json_file << "    }";
             if (ri + 1 != results_len) {
                 json_file << ",";
@@ -353,6 +1271,67 @@ void write_json(std::ofstream& json_file, std::vector<volk_test_results_t> resul
         json_file << std::endl;
         i++;
     }
-    json_file << " ]" << std::endl;
+    json_file << " ]";
+    if (!sweep_results.empty()) {
+        json_file << "," << std::endl;
+        write_json_sweeps(json_file, sweep_results);
+    }
+    json_file << std::endl;
     json_file << "}" << std::endl;
 }
+
+void write_json_sweeps(std::ofstream& json_file,
+                       const std::vector<volk_test_results_t>& sweep_results)
+{
+    // the points of one kernel are consecutive and ordered by vector length
+    json_file << " \"sweeps\": [" << std::endl;
+    size_t begin = 0;
+    while (begin < sweep_results.size()) {
+        const std::string& name = sweep_results[begin].name;
+        size_t end = begin;
+        while (end < sweep_results.size() && sweep_results[end].name == name) {
+            end++;
+        }
+
+        json_file << "  {" << std::endl;
+        json_file << "   \"name\": \"" << name << "\"," << std::endl;
+        json_file << "   \"points\": [" << std::endl;
+        for (size_t i = begin; i < end; i++) {
+            const volk_test_results_t& point = sweep_results[i];
+            json_file << "    {\"vlen\": " << point.vlen << ", \"best_arch_a\": \""
+                      << point.best_arch_a << "\", \"best_arch_u\": \""
+                      << point.best_arch_u << "\", \"gbps\": {";
+            std::map<std::string, volk_test_time_t>::const_iterator time;
+            for (time = point.results.begin(); time != point.results.end(); ++time) {
+                if (time != point.results.begin()) {
+                    json_file << ", ";
+                }
+                json_file << "\"" << time->first << "\": " << time->second.gbps;
+            }
+            json_file << "}}" << (i + 1 != end ? "," : "") << std::endl;
+        }
+        json_file << "   ]," << std::endl;
+
+        // lengths at which the best implementation changes
+        json_file << "   \"crossovers\": [";
+        bool first = true;
+        for (size_t i = begin + 1; i < end; i++) {
+            const volk_test_results_t& prev = sweep_results[i - 1];
+            const volk_test_results_t& point = sweep_results[i];
+            if (prev.best_arch_a == point.best_arch_a &&
+                prev.best_arch_u == point.best_arch_u) {
+                continue;
+            }
+            json_file << (first ? "" : ",") << std::endl;
+            json_file << "    {\"vlen\": " << point.vlen << ", \"from_a\": \""
+                      << prev.best_arch_a << "\", \"to_a\": \"" << point.best_arch_a
+                      << "\", \"from_u\": \"" << prev.best_arch_u << "\", \"to_u\": \""
+                      << point.best_arch_u << "\"}";
+            first = false;
+        }
+        json_file << (first ? "" : "\n   ") << "]" << std::endl;
+        json_file << "  }" << (end != sweep_results.size() ? "," : "") << std::endl;
+        begin = end;
+    }
+    json_file << " ]";
+}
@@ -22,15 +22,82 @@
 
 #include <stdbool.h> // for bool
 #include <iosfwd>    // for ofstream
+#include <map>       // for map
 #include <string>    // for string
 #include <vector>    // for vector
 
 class volk_test_results_t;
+class volk_test_case_t;
 
+// shortest length and growth factor of the --sweep vector lengths
+#define VOLK_SWEEP_MIN_VLEN 16
+#define VOLK_SWEEP_FACTOR 4
+
+// length at which --length-buckets ranks the last, unbounded bucket; well
+// above the last bucket bound so that the buffers spill out of the caches
+#define VOLK_LARGE_BUCKET_VLEN (1 << 21)
+
+// --parallel-grain: a chunk costs at least this many pool round trips, and
+// a larger thread count has to cut the time of a call to this share of the best
+#define VOLK_GRAIN_OVERHEAD_FACTOR 4
+#define VOLK_GRAIN_MIN_GAIN 0.9
+// the smallest grain stored, in points
+#define VOLK_GRAIN_MIN 256
+
+// --replay times a kernel on its most frequent call shapes, up to this many
+#define VOLK_REPLAY_MAX_SHAPES 16
+
+// a call shape of a --replay trace
+struct volk_replay_shape_t {
+    unsigned int vlen;
+    unsigned int misalign; // offset of the first misaligned pointer in its line, or 0
+    bool in_place;
+    bool aligned; // the dispatcher called the aligned impl
+    bool operator<(const volk_replay_shape_t& other) const
+    {
+        if (vlen != other.vlen)
+            return vlen < other.vlen;
+        if (misalign != other.misalign)
+            return misalign < other.misalign;
+        if (in_place != other.in_place)
+            return in_place < other.in_place;
+        return aligned < other.aligned;
+    }
+};
+// the calls of each shape of one kernel
+typedef std::map<volk_replay_shape_t, unsigned long long> volk_replay_mix_t;
+
+std::string kernel_fingerprint(volk_test_case_t& test_case);
+bool is_kernel_entry(const volk_test_results_t& result, const std::string& config_name);
+void run_length_buckets(volk_test_case_t& test_case,
+                        std::vector<volk_test_results_t>* results);
+void run_core_classes(volk_test_case_t& test_case,
+                      const volk_test_results_t& default_result,
+                      std::vector<volk_test_results_t>* results);
+void run_parallel_grain(volk_test_case_t& test_case,
+                        const volk_test_results_t& default_result);
+bool read_replay_trace(const std::string& path,
+                       std::map<std::string, volk_replay_mix_t>* mixes);
+void run_replay(volk_test_case_t& test_case,
+                const volk_replay_mix_t& mix,
+                std::vector<volk_test_results_t>* results);
+void run_sweep(volk_test_case_t& test_case,
+               std::vector<volk_test_results_t>* results,
+               std::vector<volk_test_results_t>* sweep_results);
+
+void fit_cost_models(const std::string& config_name,
+                     const std::vector<volk_test_results_t>& points);
 void read_results(std::vector<volk_test_results_t>* results);
 void read_results(std::vector<volk_test_results_t>* results, std::string path);
 void write_results(const std::vector<volk_test_results_t>* results, bool update_result);
 void write_results(const std::vector<volk_test_results_t>* results,
                    bool update_result,
                    const std::string path);
-void write_json(std::ofstream& json_file, std::vector<volk_test_results_t> results);
+void write_binary_results(const std::vector<volk_test_results_t>* results,
+                          const std::string path);
+void write_json(std::ofstream& json_file,
+                std::vector<volk_test_results_t> results,
+                const std::vector<volk_test_results_t>& sweep_results =
+                    std::vector<volk_test_results_t>());
+void write_json_sweeps(std::ofstream& json_file,
+                       const std::vector<volk_test_results_t>& sweep_results);
@@ -0,0 +1,168 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+// volk_profile_lite: the default profile of volk_profile for boards without
+// a toolchain or room for its dependencies. It needs neither boost nor
+// std::filesystem and links statically with ENABLE_STATIC_LIBS. It writes
+// the config of this cpu, headed by its signature, which
+// volk_merge_configs.py merges with the configs of other boards on a host.
+
+#include <volk/volk.h>       // for volk_get_machine
+#include <volk/volk_cpu.h>   // for volk_get_cpu_signature
+#include <volk/volk_prefs.h> // for volk_get_cpu_config_path, volk_arch_pref_t
+#include <cerrno>            // for errno, EEXIST
+#include <cstring>           // for memset
+#include <fstream>           // IWYU pragma: keep
+#include <iostream>          // for operator<<, basic_ostream
+#include <string>            // for string
+#include <vector>            // for vector
+
+#ifdef _WIN32
+#include <direct.h> // for _mkdir
+#else
+#include <sys/stat.h> // for mkdir
+#endif
+
+#include "kernel_tests.h"        // for init_test_list
+#include "qa_utils.h"            // for volk_test_results_t, vol...
+#include "volk_option_helpers.h" // for option_list, option_t
+
+volk_test_params_t test_params(1e-6f, 327.f, 131071, 1987, false, "");
+
+void set_vlen(int val) { test_params.set_vlen((unsigned int)val); }
+void set_iter(int val) { test_params.set_iter((unsigned int)val); }
+void set_reps(int val) { test_params.set_reps((unsigned int)val); }
+void set_substr(std::string val) { test_params.set_regex(val); }
+std::string config_filename("");
+void set_config(std::string val) { config_filename = val; }
+
+// creates the missing dirs of the path up to its file name
+static void make_parent_dirs(const std::string& path)
+{
+    for (size_t slash = path.find('/', 1); slash != std::string::npos;
+         slash = path.find('/', slash + 1)) {
+        const std::string dir = path.substr(0, slash);
+#ifdef _WIN32
+        const int ret = _mkdir(dir.c_str());
+#else
+        const int ret = mkdir(dir.c_str(), 0755);
+#endif
+        if (ret != 0 && errno != EEXIST) {
+            return;
+        }
+    }
+}
+
+static bool write_config(const std::string& path,
+                         const std::vector<volk_test_results_t>& results)
+{
+    char signature[128];
+    volk_get_cpu_signature(signature, sizeof(signature));
+
+    make_parent_dirs(path);
+    std::ofstream config(path.c_str());
+    if (!config.is_open()) {
+        std::cerr << "Error opening file " << path << std::endl;
+        return false;
+    }
+    config << "#this file is generated by volk_profile_lite.\n"
+           << "#the function name is followed by the preferred architecture.\n"
+           << "#cpu " << signature << "\n"
+           << "#machine " << volk_get_machine() << "\n";
+
+    std::vector<volk_arch_pref_t> prefs(results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        const volk_test_results_t& result = results[i];
+        config << result.config_name << " " << result.best_arch_a << " "
+               << result.best_arch_u << std::endl;
+
+        volk_arch_pref_t& pref = prefs[i];
+        memset(&pref, 0, sizeof(pref));
+        result.config_name.copy(pref.name, sizeof(pref.name) - 1);
+        result.best_arch_a.copy(pref.impl_a, sizeof(pref.impl_a) - 1);
+        result.best_arch_u.copy(pref.impl_u, sizeof(pref.impl_u) - 1);
+    }
+    config.close();
+    return !config.fail() &&
+           volk_write_preferences_binary(
+               (path + ".bin").c_str(), prefs.data(), prefs.size());
+}
+
+int main(int argc, char* argv[])
+{
+    test_params.set_reps(5);
+    option_list lite_options("volk_profile_lite");
+    lite_options.add(
+        option_t("vlen", "v", "Set the default vector length for tests", set_vlen));
+    lite_options.add((option_t(
+        "iter", "i", "Set the default number of test iterations per kernel", set_iter)));
+    lite_options.add((option_t("repetitions",
+                               "N",
+                               "Split the iterations into N timed repetitions "
+                               "and rank by their median (default 5)",
+                               set_reps)));
+    lite_options.add(
+        (option_t("tests-substr", "R", "Run tests matching substring", set_substr)));
+    lite_options.add((option_t("config",
+                               "o",
+                               "Write the config to this file (default "
+                               "volk_config.d/<cpu signature> in the config dir)",
+                               set_config)));
+    lite_options.parse(argc, argv);
+
+    if (lite_options.present("help")) {
+        return 0;
+    }
+
+    if (config_filename == "") {
+        char path[1024];
+        volk_get_cpu_config_path(path, false);
+        if (path[0] == 0) {
+            std::cerr << "Aborting 'No config save path found' ..." << std::endl;
+            return 1;
+        }
+        config_filename = path;
+    }
+
+    std::vector<volk_test_results_t> results;
+    std::vector<volk_test_case_t> test_cases = init_test_list(test_params);
+    const std::string substr_to_match(test_params.kernel_regex());
+    for (unsigned int ii = 0; ii < test_cases.size(); ++ii) {
+        volk_test_case_t test_case = test_cases[ii];
+        if (test_case.name().find(substr_to_match) == std::string::npos) {
+            continue;
+        }
+        try {
+            run_volk_tests(test_case.desc(),
+                           test_case.kernel_ptr(),
+                           test_case.name(),
+                           test_case.test_parameters(),
+                           &results,
+                           test_case.puppet_master_name());
+        } catch (std::string& error) {
+            std::cerr << "Caught Exception in 'run_volk_tests': " << error << std::endl;
+        }
+    }
+
+    std::cout << "Writing " << config_filename << "..." << std::endl;
+    return write_config(config_filename, results) ? 0 : 1;
+}
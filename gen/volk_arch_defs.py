@@ -25,7 +25,8 @@ class arch_class(object):
             ('name', str, None),
             ('environment', str, None),
             ('include', str, None),
-            ('alignment', int, 1)
+            ('alignment', int, 1),
+            ('offload', lambda v: v == 'true', False)
         ):
             try: setattr(self, key, cast(kwargs[key]))
             except: setattr(self, key, failval)
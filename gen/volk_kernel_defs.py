@@ -140,6 +140,9 @@ class impl_class(object):
 
         assert self.name
         self.is_aligned = self.name.startswith('a_')
+        #the template impl and the value of its last argument, for a variant
+        self.variant_of = None
+        self.variant_value = None
 
     def __repr__(self):
         return self.name
@@ -155,6 +158,238 @@ def extract_lv_haves(code):
         if have_set: haves.append(have_set)
     return haves
 
+########################################################################
+# Reduction metadata of the kernels with a volk_parallel_ variant.
+# Each entry is (reduction, outputs, option):
+#   map         - element-wise, no outputs to merge
+#   sum         - the partial results are added
+#   argmax      - the index whose value (option: real or magnitude_squared
+#                 of the input) is largest, lowest index on ties
+#   mean_stddev - (stddev, mean) pairs merged with Chan's parallel update
+########################################################################
+parallel_kernels = dict()
+for name in """
+    volk_16i_convert_8i volk_16i_s32f_convert_32f volk_16ic_convert_32fc
+    volk_16ic_deinterleave_16i_x2 volk_16ic_deinterleave_real_16i
+    volk_16ic_deinterleave_real_8i volk_16ic_magnitude_16i
+    volk_16ic_s32f_deinterleave_32f_x2 volk_16ic_s32f_deinterleave_real_32f
+    volk_16ic_s32f_magnitude_32f volk_16ic_x2_multiply_16ic volk_16u_byteswap
+    volk_32f_64f_add_64f volk_32f_64f_multiply_64f volk_32f_acos_32f volk_32f_asin_32f
+    volk_32f_atan_32f volk_32f_binary_slicer_32i volk_32f_binary_slicer_8i
+    volk_32f_convert_64f volk_32f_cos_32f volk_32f_exp_32f volk_32f_expfast_32f
+    volk_32f_invsqrt_32f volk_32f_log2_32f volk_32f_s32f_add_32f
+    volk_32f_s32f_convert_16i volk_32f_s32f_convert_32i volk_32f_s32f_convert_8i
+    volk_32f_s32f_multiply_32f volk_32f_s32f_normalize volk_32f_s32f_power_32f
+    volk_32f_s32f_s32f_mod_range_32f volk_32f_sin_32f volk_32f_sqrt_32f
+    volk_32f_tan_32f volk_32f_tanh_32f volk_32f_x2_add_32f volk_32f_x2_divide_32f
+    volk_32f_x2_interleave_32fc volk_32f_x2_max_32f volk_32f_x2_min_32f
+    volk_32f_x2_multiply_32f volk_32f_x2_pow_32f volk_32f_x2_s32f_interleave_16ic
+    volk_32f_x2_subtract_32f volk_32fc_32f_add_32fc volk_32fc_32f_multiply_32fc
+    volk_32fc_conjugate_32fc volk_32fc_convert_16ic volk_32fc_convert_64fc
+    volk_32fc_deinterleave_32f_x2
+    volk_32fc_deinterleave_64f_x2 volk_32fc_deinterleave_imag_32f
+    volk_32fc_deinterleave_real_32f volk_32fc_deinterleave_real_64f
+    volk_32fc_magnitude_32f volk_32fc_magnitude_squared_32f volk_32fc_s32f_atan2_32f
+    volk_32fc_s32f_deinterleave_real_16i volk_32fc_s32f_magnitude_16i
+    volk_32fc_s32f_power_32fc volk_32fc_s32fc_multiply_32fc volk_32fc_x2_add_32fc
+    volk_32fc_x2_divide_32fc volk_32fc_x2_multiply_32fc
+    volk_32fc_x2_multiply_conjugate_32fc volk_32fc_x2_s32fc_multiply_conjugate_add_32fc
+    volk_32i_s32f_convert_32f volk_32i_s32u_rshift_32i volk_32i_x2_add_32i
+    volk_32i_x2_add_saturated_32i volk_32i_x2_and_32i volk_32i_x2_max_32i
+    volk_32i_x2_min_32i volk_32i_x2_multiply_32i volk_32i_x2_or_32i
+    volk_32i_x2_subtract_32i volk_32u_byteswap volk_32u_reverse_32u
+    volk_32u_x2_add_saturated_32u volk_32u_x2_max_32u volk_32u_x2_min_32u
+    volk_64f_convert_32f volk_64f_x2_add_64f volk_64f_x2_max_64f
+    volk_64f_x2_min_64f volk_64f_x2_multiply_64f volk_64fc_convert_32fc
+    volk_64fc_magnitude_squared_64f volk_64fc_x2_multiply_64fc
+    volk_64fc_x2_multiply_conjugate_64fc volk_64u_byteswap volk_8i_convert_16i
+    volk_8i_s32f_convert_32f volk_8ic_deinterleave_16i_x2 volk_8ic_deinterleave_real_16i
+    volk_8ic_deinterleave_real_8i volk_8ic_s32f_deinterleave_32f_x2
+    volk_8ic_s32f_deinterleave_real_32f volk_8ic_x2_multiply_conjugate_16ic
+    volk_8ic_x2_s32f_multiply_conjugate_32fc
+""".split():
+    parallel_kernels[name] = ('map', (), None)
+for name in """
+    volk_16i_32fc_dot_prod_32fc volk_32f_accumulator_s32f volk_32f_x2_dot_prod_32f
+    volk_32fc_32f_dot_prod_32fc volk_32fc_x2_conjugate_dot_prod_32fc
+    volk_32fc_x2_dot_prod_32fc
+""".split():
+    parallel_kernels[name] = ('sum', ('result',), None)
+parallel_kernels['volk_32f_index_max_32u'] = ('argmax', ('target',), 'real')
+parallel_kernels['volk_32fc_index_max_32u'] = ('argmax', ('target',), 'magnitude_squared')
+parallel_kernels['volk_32f_stddev_and_mean_32f_x2'] = ('mean_stddev', ('stddev', 'mean'), None)
+
+########################################################################
+# In place metadata. An element-wise (map) kernel may be called with its
+# first, output argument equal to any input vector of the same element
+# type: every impl loads a block before it stores the same block. The
+# kernels below break that rule and are left out.
+#   volk_32u_reverse_32u - the bit field impls store bits of a word
+#                          before they have read all of it
+# Kernels which are element-wise in memory but not 'map' kernels, because
+# a point depends on its index, are listed in inplace_kernels.
+########################################################################
+not_inplace_kernels = set(['volk_32u_reverse_32u'])
+inplace_kernels = set(['volk_32fc_32f_window_fftshift_32fc'])
+
+########################################################################
+# Typed operations of volk.hh. The kernels of one operation become
+# overloads told apart by the element types of their arguments. Kernels
+# with a 'sum' reduction return their result instead of writing it
+# through the first pointer.
+########################################################################
+typed_ops = dict()
+for op, names in (
+    ('add', 'volk_32f_x2_add_32f volk_32fc_x2_add_32fc volk_64f_x2_add_64f '
+            'volk_32f_s32f_add_32f volk_32fc_32f_add_32fc volk_32i_x2_add_32i'),
+    ('subtract', 'volk_32f_x2_subtract_32f volk_32i_x2_subtract_32i'),
+    ('multiply', 'volk_32f_x2_multiply_32f volk_32fc_x2_multiply_32fc '
+                 'volk_64f_x2_multiply_64f volk_32f_s32f_multiply_32f '
+                 'volk_32fc_s32fc_multiply_32fc volk_32fc_32f_multiply_32fc '
+                 'volk_64fc_x2_multiply_64fc volk_32i_x2_multiply_32i'),
+    ('divide', 'volk_32f_x2_divide_32f volk_32fc_x2_divide_32fc'),
+    ('max', 'volk_32f_x2_max_32f volk_64f_x2_max_64f volk_32i_x2_max_32i '
+            'volk_32u_x2_max_32u'),
+    ('min', 'volk_32f_x2_min_32f volk_64f_x2_min_64f volk_32i_x2_min_32i '
+            'volk_32u_x2_min_32u'),
+    ('sqrt', 'volk_32f_sqrt_32f'),
+    ('conjugate', 'volk_32fc_conjugate_32fc'),
+    ('magnitude', 'volk_32fc_magnitude_32f'),
+    ('magnitude_squared', 'volk_32fc_magnitude_squared_32f'),
+    ('convert', 'volk_32f_s32f_convert_16i volk_32f_s32f_convert_32i '
+                'volk_32f_s32f_convert_8i volk_16i_s32f_convert_32f '
+                'volk_32i_s32f_convert_32f volk_8i_s32f_convert_32f '
+                'volk_32f_convert_64f volk_64f_convert_32f volk_16i_convert_8i '
+                'volk_8i_convert_16i volk_32fc_convert_16ic volk_16ic_convert_32fc'),
+    ('sum', 'volk_32f_accumulator_s32f'),
+    ('dot', 'volk_32f_x2_dot_prod_32f volk_32fc_x2_dot_prod_32fc '
+            'volk_32fc_32f_dot_prod_32fc volk_16i_32fc_dot_prod_32fc'),
+    ('conjugate_dot', 'volk_32fc_x2_conjugate_dot_prod_32fc'),
+):
+    for name in names.split():
+        typed_ops[name] = op
+
+########################################################################
+# Work volk_plan_create does for a kernel besides binding an impl. The
+# expression runs with the plan in scope; a false result fails the plan.
+########################################################################
+plan_setup = {
+    'volk_32fc_fft_32fc': 'volk_fft_get_twiddles(plan->num_points, false)',
+    'volk_32fc_ifft_32fc': 'volk_fft_get_twiddles(plan->num_points, true)',
+    'volk_32fc_fft_batch_32fc': 'volk_fft_get_twiddles(plan->num_points, false)',
+}
+
+########################################################################
+# Impls written once for several unroll factors or accumulator counts.
+# The impl named here takes the count as an extra last argument, which
+# the generator fixes in a wrapper per value; the compiler propagates it
+# as a constant and unrolls each copy on its own. Each copy is an impl of
+# the kernel named <impl><value>, ranked by volk_profile like the others,
+# so every machine ends up with the count that suits it.
+########################################################################
+impl_variants = {
+    'volk_32f_accumulator_s32f': {'u_avx_acc': (2, 4, 8)},
+    'volk_32f_x2_dot_prod_32f': {'u_avx2_fma_acc': (2, 4, 8), 'neonv8_acc': (2, 4, 8)},
+}
+
+########################################################################
+# Lengths a plan binds an impl compiled for. Each machine builds every impl
+# of these kernels once more per length with num_points a constant, which
+# the compiler unrolls fully; volk_plan_create for one of the lengths binds
+# that build of the ranked impl.
+########################################################################
+fixed_lengths = {
+    'volk_32f_x2_dot_prod_32f': (64, 128),
+    'volk_32fc_x2_dot_prod_32fc': (64, 128),
+    'volk_32fc_32f_dot_prod_32fc': (64, 128),
+    'volk_32fc_x2_conjugate_dot_prod_32fc': (64, 128),
+}
+
+########################################################################
+# Measured max relative error per impl, for volk_set_precision. Measured
+# against double precision libm over the QA inputs, uniform in [-1, 1], on
+# x86; impls not listed (the NEON ones) are unmeasured and only run without
+# a budget. A kernel with a fast variant also takes the variant's impl when
+# the budget allows it.
+########################################################################
+impl_max_errors = dict()
+for name, errors in (
+    ('volk_32f_exp_32f', (('a_generic u_generic', 6.0e-8),
+                          ('a_sse2 u_sse2 a_avx2_fma u_avx2_fma a_avx512f u_avx512f', 7.1e-8))),
+    ('volk_32f_expfast_32f', (('generic', 6.0e-8),
+                              ('a_sse4_1 u_sse4_1 a_avx u_avx a_avx_fma u_avx_fma', 5.7e-2))),
+    ('volk_32f_sin_32f', (('generic', 6.4e-8),
+                          ('a_sse4_1 u_sse4_1 a_avx2 u_avx2 a_avx2_fma u_avx2_fma', 2.2e-7))),
+    ('volk_32f_cos_32f', (('generic', 5.9e-8), ('generic_fast', 2.5e-7),
+                          ('a_sse4_1 u_sse4_1 a_avx2 u_avx2 a_avx2_fma u_avx2_fma', 2.8e-7))),
+    ('volk_32f_tan_32f', (('generic', 7.4e-8),
+                          ('a_sse4_1 u_sse4_1 a_avx2 u_avx2 a_avx2_fma u_avx2_fma', 4.7e-7))),
+    ('volk_32f_atan_32f', (('generic', 8.4e-8),
+                           ('a_sse4_1 u_sse4_1 a_avx u_avx a_avx2_fma u_avx2_fma', 3.1e-4))),
+    ('volk_32f_tanh_32f', (('generic', 1.7e-7),
+                           ('series a_sse u_sse a_avx u_avx a_avx_fma u_avx_fma', 2.2e-7))),
+    ('volk_32f_sqrt_32f', (('generic a_sse a_avx u_avx', 6.0e-8),
+                           ('a_avx512f u_avx512f', 6.4e-8))),
+    ('volk_32f_invsqrt_32f', (('generic a_sse a_avx u_avx', 1.8e-3),
+                              ('a_avx512f u_avx512f', 1.4e-7))),
+    ('volk_32f_x2_divide_32f', (('generic a_sse a_avx u_avx a_avx512f u_avx512f', 6.0e-8),)),
+    ('volk_32f_x2_dividefast_32f', (('generic', 6.0e-8), ('a_avx u_avx', 2.2e-7),
+                                    ('a_avx512f u_avx512f', 1.7e-7))),
+    ('volk_32fc_x2_divide_32fc', (('generic', 6.0e-8), ('a_sse3 u_sse3', 2.5e-7),
+                                  ('a_avx u_avx', 2.3e-7))),
+    ('volk_32fc_x2_dividefast_32fc', (('generic', 6.0e-8), ('a_avx u_avx', 3.2e-7),
+                                      ('a_avx512f u_avx512f', 2.7e-7))),
+    ('volk_32fc_magnitude_32f', (('a_generic generic a_sse u_sse a_sse3 u_sse3 a_avx u_avx',
+                                  1.2e-7),)),
+    ('volk_32fc_magnitude_approx_32f', (('generic u_sse u_avx u_avx512f', 9.8e-3),)),
+):
+    impl_max_errors[name] = dict()
+    for impls, error in errors:
+        for impl in impls.split():
+            impl_max_errors[name][impl] = error
+
+fast_variants = {
+    'volk_32f_exp_32f': 'volk_32f_expfast_32f',
+    'volk_32f_x2_divide_32f': 'volk_32f_x2_dividefast_32f',
+    'volk_32fc_x2_divide_32fc': 'volk_32fc_x2_dividefast_32fc',
+    'volk_32fc_magnitude_32f': 'volk_32fc_magnitude_approx_32f',
+}
+
+########################################################################
+# Scalar arguments of the Python bindings, by type: the PyArg_ParseTuple
+# format, the C type it is parsed into and, for the unsigned ones whose
+# format does not check the range, the O& converter that does. Vectors
+# are passed through the buffer protocol. Kernels with other arguments,
+# such as arrays of vectors, are not bound.
+########################################################################
+py_scalar_formats = {
+    'float': ('f', 'float', None),
+    'double': ('d', 'double', None),
+    'int': ('i', 'int', None),
+    'unsigned int': ('O&', 'unsigned int', 'volk_python_uint'),
+    'uint32_t': ('O&', 'unsigned int', 'volk_python_uint'),
+    'lv_32fc_t': ('D', 'Py_complex', None),
+    'lv_64fc_t': ('D', 'Py_complex', None),
+}
+
+########################################################################
+# Extents of the vectors of the Python bindings: the items of its element
+# type a vector holds, as (per point, fixed) for per * num_points + fixed.
+# The kernels of parallel_kernels read or write num_points items of every
+# vector but their outputs, which hold one item. Other kernels list all
+# their vectors here; a kernel whose extents are not known is not bound,
+# as the module could not check its buffers against num_points.
+########################################################################
+py_extents = {
+    'volk_32f_index_min_32u': {'target': (0, 1), 'src0': (1, 0)},
+    'volk_32fc_index_min_32u': {'target': (0, 1), 'src0': (1, 0)},
+    'volk_32fc_x2_square_dist_32f': {'target': (1, 0), 'src0': (0, 1), 'points': (1, 0)},
+    'volk_32fc_x2_s32f_square_dist_scalar_mult_32f': {
+        'target': (1, 0), 'src0': (0, 1), 'points': (1, 0)},
+}
+for name, (reduction, outputs, option) in parallel_kernels.items():
+    py_extents.setdefault(name, dict((output, (0, 1)) for output in outputs))
+
 ########################################################################
 # Represent a processing kernel, parse from file
 ########################################################################
@@ -175,6 +410,21 @@ class kernel_class(object):
                     kern_name=self.name, header=sub_hdr, body=body,
                 ))
         assert(self._impls)
+        #a template impl becomes one impl per value of its last argument
+        variants = impl_variants.get(self.name, dict())
+        for impl in list(self._impls):
+            if impl.name not in variants: continue
+            index = self._impls.index(impl)
+            copies = list()
+            for value in variants[impl.name]:
+                copy = impl_class.__new__(impl_class)
+                copy.__dict__.update(impl.__dict__)
+                copy.name = '%s%d'%(impl.name, value)
+                copy.args = impl.args[:-1]
+                copy.variant_of = impl.name
+                copy.variant_value = value
+                copies.append(copy)
+            self._impls[index:index + 1] = copies
         self.has_dispatcher = False
         for impl in self._impls:
             if impl.name == 'dispatcher':
@@ -185,6 +435,186 @@ class kernel_class(object):
         self.arglist_types = ', '.join([a[0] for a in self.args])
         self.arglist_full = ', '.join(['%s %s'%a for a in self.args])
         self.arglist_names = ', '.join([a[1] for a in self.args])
+        #the vector length argument used for length bucket dispatch (optional)
+        self.length_arg = None
+        for arg_type, arg_name in self.args:
+            if arg_name == 'num_points' and '*' not in arg_type:
+                self.length_arg = arg_name
+        #bytes touched per point for the kernel statistics, one element per pointer argument
+        self.point_bytes = ' + '.join(['sizeof(%s)'%t.rsplit('*', 1)[0].strip()
+                                       for t, n in self.args if '*' in t]) or '0'
+        #the volk::aligned_span overload takes spans for the vector arguments
+        span_args = list()
+        span_names = list()
+        for arg_type, arg_name in self.args:
+            if arg_type.count('*') == 1:
+                span_args.append('aligned_span<%s> %s'%(arg_type.replace('*', '').strip(), arg_name))
+                span_names.append('%s.data()'%arg_name)
+            else:
+                span_args.append('%s %s'%(arg_type.strip(), arg_name))
+                span_names.append(arg_name)
+        self.span_arglist_full = ', '.join(span_args)
+        self.span_arglist_names = ', '.join(span_names)
+        self.plan_setup = plan_setup.get(self.name)
+        self.fixed_lengths = fixed_lengths.get(self.name, ()) if self.length_arg else ()
+        self.impl_max_errors = impl_max_errors.get(self.name, dict())
+        self.fast_variant = fast_variants.get(self.name)
+        #the arguments of a call with the length fixed, per fixed length
+        self.fixed_arglist_names = dict(
+            (length, ', '.join([str(length) if n == self.length_arg else n
+                                for t, n in self.args]))
+            for length in self.fixed_lengths)
+        #the volk_parallel_ variant; chunks call the dispatcher on [start, start+count)
+        #and write their outputs to per chunk partials which are merged afterwards
+        self.parallel = None
+        if self.length_arg and self.name in parallel_kernels:
+            self.parallel, outputs, option = parallel_kernels[self.name]
+            arg_types = dict((n, t) for t, n in self.args)
+            self.parallel_outputs = [(arg_types[n].replace('*', '').strip(), n) for n in outputs]
+            if self.parallel_outputs:
+                self.parallel_out_type, self.parallel_out = self.parallel_outputs[0]
+            if self.parallel == 'argmax':
+                inputs = [n for t, n in self.args if '*' in t and n not in outputs]
+                value = 'args->%s[index]'%inputs[0]
+                if option == 'magnitude_squared':
+                    value = 'lv_creal(%s) * lv_creal(%s) + lv_cimag(%s) * lv_cimag(%s)'%((value,)*4)
+                self.parallel_value = value
+            chunk_args = list()
+            for arg_type, arg_name in self.args:
+                if arg_name in outputs:
+                    chunk_args.append('&args->partial_%s[chunk]'%arg_name)
+                elif arg_name == self.length_arg:
+                    chunk_args.append('(%s)count'%arg_type.replace('const', '').strip())
+                elif '*' in arg_type:
+                    chunk_args.append('args->%s + start'%arg_name)
+                else:
+                    chunk_args.append('args->%s'%arg_name)
+            self.parallel_chunk_args = ', '.join(chunk_args)
+            #the vector whose pages place the chunks on NUMA nodes, the first one
+            self.parallel_placement = [n for t, n in self.args
+                                       if '*' in t and n not in outputs][0]
+            #the _64 variant; a size_t length split into chunks below the 32-bit
+            #limit, the outputs of which go to partial_<name> and are merged, with
+            #argmax indices widened to 64 bits
+            long_args = list()
+            chunk_args = list()
+            for arg_type, arg_name in self.args:
+                if arg_name in outputs:
+                    if self.parallel == 'argmax':
+                        arg_type = 'uint64_t*'
+                    chunk_args.append('&partial_%s'%arg_name)
+                elif arg_name == self.length_arg:
+                    chunk_args.append('(%s)count'%arg_type.replace('const', '').strip())
+                    arg_type = 'size_t'
+                elif '*' in arg_type:
+                    chunk_args.append('%s + start'%arg_name)
+                else:
+                    chunk_args.append(arg_name)
+                long_args.append('%s %s'%(arg_type.strip(), arg_name))
+            self.long_arglist_full = ', '.join(long_args)
+            self.long_chunk_args = ', '.join(chunk_args)
+            if self.parallel == 'argmax':
+                self.long_value = self.parallel_value.replace('args->', '')
+        #the _batch variant; every pointer argument becomes an array with one
+        #pointer per vector of the batch, the other arguments are shared
+        if self.length_arg:
+            batch_args = list()
+            item_args = list()
+            for arg_type, arg_name in self.args:
+                if '*' in arg_type:
+                    batch_args.append('%s const* %s'%(arg_type.strip(), arg_name))
+                    item_args.append('%s[i]'%arg_name)
+                else:
+                    batch_args.append('%s %s'%(arg_type.strip(), arg_name))
+                    item_args.append(arg_name)
+            self.batch_arglist_full = ', '.join(batch_args + ['size_t count'])
+            self.batch_item_args = ', '.join(item_args)
+        #input vectors which may be the same buffer as the output, run_volk_tests
+        #checks every impl on them; inplace_mask has bit i set for pointer argument i
+        self.inplace_args = list()
+        self.inplace_mask = 0
+        if ((self.parallel == 'map' or self.name in inplace_kernels)
+                and self.name not in not_inplace_kernels):
+            pointers = [(t.replace('const', '').strip(), n, 'const' in t)
+                        for t, n in self.args if '*' in t]
+            for i, (arg_type, arg_name, is_input) in enumerate(pointers[1:]):
+                if is_input and arg_type == pointers[0][0]:
+                    self.inplace_args.append(arg_name)
+                    self.inplace_mask |= 1 << (i + 1)
+        #vectors the kernel only reads, which run_volk_tests shares between the
+        #impls; readonly_mask has bit i set for pointer argument i
+        self.readonly_mask = 0
+        for i, (arg_type, arg_name) in enumerate([a for a in self.args if '*' in a[0]]):
+            if 'const' in arg_type.rsplit('*', 1)[0]:
+                self.readonly_mask |= 1 << i
+        #the volk.hh operation; the vector arguments become spans, the length is
+        #the size of the first of them and a summed result is returned
+        self.typed_op = None
+        if self.length_arg and self.name in typed_ops:
+            self.typed_op = typed_ops[self.name]
+            reduction = parallel_kernels.get(self.name, (None,))[0] == 'sum'
+            self.typed_result = 'void'
+            self.typed_vectors = list()
+            aligned_args = list()
+            span_args = list()
+            call_args = list()
+            for arg_type, arg_name in self.args:
+                base_type = arg_type.replace('*', '').replace('const', '').strip()
+                if arg_name == self.length_arg:
+                    call_args.append(arg_name)
+                elif '*' in arg_type and reduction and self.typed_result == 'void':
+                    self.typed_result = base_type
+                    call_args.append('&result')
+                elif '*' in arg_type:
+                    if 'const' in arg_type:
+                        base_type = 'const ' + base_type
+                    aligned_args.append('aligned_span<%s> %s'%(base_type, arg_name))
+                    span_args.append('span<%s> %s'%(base_type, arg_name))
+                    call_args.append('%s.data()'%arg_name)
+                    self.typed_vectors.append(arg_name)
+                else:
+                    aligned_args.append('%s %s'%(arg_type.strip(), arg_name))
+                    span_args.append('%s %s'%(arg_type.strip(), arg_name))
+                    call_args.append(arg_name)
+            self.typed_aligned_arglist = ', '.join(aligned_args)
+            self.typed_span_arglist = ', '.join(span_args)
+            self.typed_call_args = ', '.join(call_args)
+        #the python binding; vector i is held in views[i], a scalar is parsed
+        #into arg_<name> and cast, complex ones are rebuilt from a Py_complex
+        extents = py_extents.get(self.name) if self.length_arg == 'num_points' else None
+        self.py_bound = extents is not None
+        self.py_buffers = list()
+        self.py_scalars = list()
+        self.py_format = ''
+        parse_args = list()
+        call_args = list()
+        for arg_type, arg_name in self.args:
+            base_type = arg_type.replace('*', '').replace('const', '').strip()
+            if arg_type.count('*') == 1:
+                index = len(self.py_buffers)
+                per_point, fixed = (extents or dict()).get(arg_name, (1, 0))
+                self.py_buffers.append(
+                    (arg_name, base_type, 'const' not in arg_type, per_point, fixed))
+                self.py_format += 'O'
+                parse_args.append('&objs[%d]'%index)
+                call_args.append('(%s)views[%d].buf'%(arg_type.strip(), index))
+            elif '*' not in arg_type and base_type in py_scalar_formats:
+                py_format, c_type, converter = py_scalar_formats[base_type]
+                self.py_scalars.append((c_type, arg_name))
+                self.py_format += py_format
+                if converter:
+                    parse_args.append(converter)
+                parse_args.append('&arg_%s'%arg_name)
+                if c_type == 'Py_complex':
+                    part = 'float' if base_type == 'lv_32fc_t' else 'double'
+                    call_args.append('lv_cmake((%s)arg_%s.real, (%s)arg_%s.imag)'%(
+                        part, arg_name, part, arg_name))
+                else:
+                    call_args.append('(%s)arg_%s'%(base_type, arg_name))
+            else:
+                self.py_bound = False
+        self.py_parse_args = ', '.join(parse_args)
+        self.py_call_args = ', '.join(call_args)
 
     def get_impls(self, archs):
         archs = set(archs)
@@ -197,6 +627,50 @@ class kernel_class(object):
     def __repr__(self):
         return self.name
 
+########################################################################
+# Fused kernels run a chain of kernels tile by tile, so the intermediate
+# results stay in L1 instead of streaming through memory between steps.
+# Each step is a dispatcher call on the tile [start, start+count); the
+# scratch buffers are tile sized and aligned. The kernels used in the
+# steps must be element-wise and safe to run in place.
+########################################################################
+class fused_class(object):
+    def __init__(self, name, arglist_full, scratch, steps):
+        self.name = name
+        self.arglist_full = arglist_full
+        self.args = [tuple(a.strip().rsplit(' ', 1)) for a in arglist_full.split(',')]
+        self.scratch = scratch
+        self.steps = steps
+        self.chain = ' -> '.join([step.split('(')[0] for step in steps])
+
+    def __repr__(self):
+        return self.name
+
+fused_kernels = [
+    fused_class(
+        name='volk_fused_32fc_x2_rotator_window_log2_power_32f',
+        arglist_full='float* outputVector, const lv_32fc_t* inVector, '
+                     'const lv_32fc_t* window, const lv_32fc_t phase_inc, '
+                     'lv_32fc_t* phase, unsigned int num_points',
+        scratch=[('lv_32fc_t', 'tile')],
+        steps=[
+            'volk_32fc_s32fc_x2_rotator_32fc(tile, inVector + start, phase_inc, phase, count)',
+            'volk_32fc_x2_multiply_32fc(tile, tile, window + start, count)',
+            'volk_32fc_magnitude_squared_32f(outputVector + start, tile, count)',
+            'volk_32f_log2_32f(outputVector + start, outputVector + start, count)',
+        ]),
+    fused_class(
+        name='volk_fused_32fc_x2_window_log2_power_32f',
+        arglist_full='float* outputVector, const lv_32fc_t* inVector, '
+                     'const lv_32fc_t* window, unsigned int num_points',
+        scratch=[('lv_32fc_t', 'tile')],
+        steps=[
+            'volk_32fc_x2_multiply_32fc(tile, inVector + start, window + start, count)',
+            'volk_32fc_magnitude_squared_32f(outputVector + start, tile, count)',
+            'volk_32f_log2_32f(outputVector + start, outputVector + start, count)',
+        ]),
+]
+
 ########################################################################
 # Extract information from the VOLK kernels
 ########################################################################
@@ -204,6 +678,9 @@ __file__ = os.path.abspath(__file__)
 srcdir = os.path.dirname(os.path.dirname(__file__))
 kernel_files = sorted(glob.glob(os.path.join(srcdir, "kernels", "volk", "*.h")))
 kernels = list(map(kernel_class, kernel_files))
+for fused in fused_kernels:
+    for step in fused.chain.split(' -> '):
+        assert step in [k.name for k in kernels], '%s uses unknown kernel %s'%(fused, step)
 
 if __name__ == '__main__':
     print(kernels)
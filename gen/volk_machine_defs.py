@@ -21,8 +21,10 @@ machines = list()
 machine_dict = dict()
 
 class machine_class(object):
-    def __init__(self, name, archs):
+    def __init__(self, name, archs, defaults=()):
         self.name = name
+        #(kernel, aligned impl, unaligned impl) ranked first without a volk_config entry
+        self.defaults = sorted(defaults)
         self.archs = list()
         self.arch_names = list()
         for arch_name in archs:
@@ -34,16 +36,16 @@ class machine_class(object):
 
     def __repr__(self): return self.name
 
-def register_machine(name, archs):
+def register_machine(name, archs, defaults=()):
     for i, arch_name in enumerate(archs):
         if '|' in arch_name: #handle special arch names with the '|'
             for arch_sub in arch_name.split('|'):
                 if arch_sub:
-                    register_machine(name+'_'+arch_sub, archs[:i] + [arch_sub] + archs[i+1:])
+                    register_machine(name+'_'+arch_sub, archs[:i] + [arch_sub] + archs[i+1:], defaults)
                 else:
-                    register_machine(name, archs[:i] + archs[i+1:])
+                    register_machine(name, archs[:i] + archs[i+1:], defaults)
             return
-    machine = machine_class(name=name, archs=archs)
+    machine = machine_class(name=name, archs=archs, defaults=defaults)
     machines.append(machine)
     machine_dict[machine.name] = machine
 
@@ -62,10 +64,16 @@ for machine_xml in machines_xml:
     for node in machine_xml.childNodes:
         try:
             name = node.tagName
+            if name == 'default': continue
             val = machine_xml.getElementsByTagName(name)[0].firstChild.data
             kwargs[name] = val
         except: pass
     kwargs['archs'] = kwargs['archs'].split()
+    defaults = list()
+    for default_xml in machine_xml.getElementsByTagName('default'):
+        impls = default_xml.firstChild.data.split()
+        defaults.append((default_xml.attributes['kernel'].value, impls[0], impls[-1]))
+    kwargs['defaults'] = defaults
     register_machine(**kwargs)
 
 if __name__ == '__main__':
@@ -37,6 +37,7 @@ def __parse_tmpl(_tmpl, **kwargs):
         'machines': volk_machine_defs.machines,
         'machine_dict': volk_machine_defs.machine_dict,
         'kernels': volk_kernel_defs.kernels,
+        'fused_kernels': volk_kernel_defs.fused_kernels,
     }
     defs.update(kwargs)
     _tmpl = """
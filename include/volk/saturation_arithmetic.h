@@ -25,6 +25,7 @@
 #define INCLUDED_volk_saturation_arithmetic_H_
 
 #include <limits.h>
+#include <volk/volk_complex.h>
 
 static inline int16_t sat_adds16i(int16_t x, int16_t y)
 {
@@ -50,4 +51,62 @@ static inline int16_t sat_muls16i(int16_t x, int16_t y)
     return res;
 }
 
+static inline int16_t sat_subs16i(int16_t x, int16_t y)
+{
+    int32_t res = (int32_t)x - (int32_t)y;
+
+    if (res < SHRT_MIN)
+        res = SHRT_MIN;
+    if (res > SHRT_MAX)
+        res = SHRT_MAX;
+
+    return res;
+}
+
+static inline int32_t sat_adds32i(int32_t x, int32_t y)
+{
+    int64_t res = (int64_t)x + (int64_t)y;
+
+    if (res < INT32_MIN)
+        res = INT32_MIN;
+    if (res > INT32_MAX)
+        res = INT32_MAX;
+
+    return res;
+}
+
+static inline uint32_t sat_addu32u(uint32_t x, uint32_t y)
+{
+    const uint32_t res = x + y;
+
+    return res < x ? UINT32_MAX : res;
+}
+
+/*
+ * x * y in Q15, rounded to nearest with halves up as pmulhrsw and vqrdmulh do.
+ * Only -1 * -1 overflows; it saturates.
+ */
+static inline int16_t sat_mulq15(int16_t x, int16_t y)
+{
+    int32_t res = ((int32_t)x * (int32_t)y + 0x4000) >> 15;
+
+    if (res > SHRT_MAX)
+        res = SHRT_MAX;
+
+    return res;
+}
+
+/*
+ * a * b of Q15 complex values: the four products are rounded and saturated as
+ * sat_mulq15, then their difference and sum saturated
+ */
+static inline lv_16sc_t sat_cmulq15(lv_16sc_t a, lv_16sc_t b)
+{
+    const int16_t real = sat_subs16i(sat_mulq15(lv_creal(a), lv_creal(b)),
+                                     sat_mulq15(lv_cimag(a), lv_cimag(b)));
+    const int16_t imag = sat_adds16i(sat_mulq15(lv_cimag(a), lv_creal(b)),
+                                     sat_mulq15(lv_creal(a), lv_cimag(b)));
+    return lv_cmake(real, imag);
+}
+
 #endif /* INCLUDED_volk_saturation_arithmetic_H_ */
@@ -23,9 +23,13 @@
 #ifndef INCLUDED_VOLK_ALLOC_H
 #define INCLUDED_VOLK_ALLOC_H
 
+#include <cassert>
+#include <cstdint>
 #include <cstdlib>
 #include <limits>
 #include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <volk/volk.h>
@@ -37,15 +41,25 @@ namespace volk {
  *
  * \details
  *   adapted from https://en.cppreference.com/w/cpp/named_req/Alloc
+ *
+ *   A non-zero Flags policy, an OR of the VOLK_MALLOC_* placement flags,
+ *   allocates with volk_malloc_ex and volk_free_ex instead. With
+ *   VOLK_MALLOC_PREFERRED_ALIGNMENT the storage is aligned to
+ *   volk_get_preferred_alignment(), for buffers split between threads.
  */
-template <class T>
+template <class T, unsigned int Flags = 0>
 struct alloc {
     typedef T value_type;
 
+    template <class U>
+    struct rebind {
+        typedef alloc<U, Flags> other;
+    };
+
     alloc() = default;
 
     template <class U>
-    constexpr alloc(alloc<U> const&) noexcept
+    constexpr alloc(alloc<U, Flags> const&) noexcept
     {
     }
 
@@ -54,27 +68,75 @@ struct alloc {
         if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
             throw std::bad_alloc();
 
-        if (auto p = static_cast<T*>(volk_malloc(n * sizeof(T), volk_get_alignment())))
-            return p;
+        // VOLK_MAX_ALIGNMENT rather than volk_get_alignment(), so that the
+        // storage converts to a volk::aligned_span on every machine
+        size_t alignment = volk_get_alignment();
+        if (alignment < VOLK_MAX_ALIGNMENT)
+            alignment = VOLK_MAX_ALIGNMENT;
+        void* p = Flags ? volk_malloc_ex(n * sizeof(T), alignment, Flags)
+                        : volk_malloc(n * sizeof(T), alignment);
+        if (p)
+            return static_cast<T*>(p);
 
         throw std::bad_alloc();
     }
 
-    void deallocate(T* p, std::size_t) noexcept { volk_free(p); }
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        if (Flags)
+            volk_free_ex(p);
+        else
+            volk_free(p);
+    }
 };
 
-template <class T, class U>
-bool operator==(alloc<T> const&, alloc<U> const&)
+template <class T, class U, unsigned int FlagsT, unsigned int FlagsU>
+bool operator==(alloc<T, FlagsT> const&, alloc<U, FlagsU> const&)
 {
-    return true;
+    return FlagsT == FlagsU;
 }
 
-template <class T, class U>
-bool operator!=(alloc<T> const&, alloc<U> const&)
+template <class T, class U, unsigned int FlagsT, unsigned int FlagsU>
+bool operator!=(alloc<T, FlagsT> const&, alloc<U, FlagsU> const&)
 {
-    return false;
+    return FlagsT != FlagsU;
 }
 
+/*!
+ * \brief volk::alloc which default-initialises instead of value-initialising
+ *
+ * \details
+ *   Containers using it leave elements of trivial types such as float or
+ *   lv_32fc_t uninitialised when they are created or resized without a value,
+ *   so that output buffers are not zero-filled before a kernel writes them.
+ *   Constructing with arguments behaves as usual.
+ */
+template <class T, unsigned int Flags = 0>
+struct default_init_alloc : alloc<T, Flags> {
+    template <class U>
+    struct rebind {
+        typedef default_init_alloc<U, Flags> other;
+    };
+
+    default_init_alloc() = default;
+
+    template <class U>
+    constexpr default_init_alloc(default_init_alloc<U, Flags> const&) noexcept
+    {
+    }
+
+    template <class U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        ::new (static_cast<void*>(p)) U;
+    }
+
+    template <class U, class... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
 
 /*!
  * \brief type alias for std::vector using volk::alloc
@@ -82,9 +144,371 @@ bool operator!=(alloc<T> const&, alloc<U> const&)
  * \details
  * example code:
  *   volk::vector<float> v(100); // vector using volk_malloc, volk_free
+ *   volk::vector<float, VOLK_MALLOC_HUGEPAGES> capture(1 << 26);
+ */
+template <class T, unsigned int Flags = 0>
+using vector = std::vector<T, alloc<T, Flags>>;
+
+/*!
+ * \brief type alias for std::vector using volk::default_init_alloc
+ *
+ * \details
+ * example code:
+ *   volk::uninitialized_vector<float> out(1 << 24); // allocated, not zeroed
+ *   volk_32f_x2_add_32f(out.data(), a.data(), b.data(), out.size());
+ */
+template <class T, unsigned int Flags = 0>
+using uninitialized_vector = std::vector<T, default_init_alloc<T, Flags>>;
+
+/*!
+ * \brief Owner of a volk_arena_t
+ *
+ * \details
+ *   Move-only; the arena is destroyed with the object. Containers using
+ *   volk::arena_alloc on it must be gone before reset() or destruction.
+ */
+class arena
+{
+public:
+    explicit arena(std::size_t size) : _arena(volk_arena_create(size))
+    {
+        if (!_arena)
+            throw std::bad_alloc();
+    }
+
+    ~arena() { volk_arena_destroy(_arena); }
+
+    arena(arena&& other) noexcept : _arena(other._arena) { other._arena = nullptr; }
+
+    arena& operator=(arena&& other) noexcept
+    {
+        std::swap(_arena, other._arena);
+        return *this;
+    }
+
+    arena(arena const&) = delete;
+    arena& operator=(arena const&) = delete;
+
+    void reset() noexcept { volk_arena_reset(_arena); }
+    std::size_t used() const noexcept { return volk_arena_used(_arena); }
+    std::size_t peak() const noexcept { return volk_arena_peak(_arena); }
+    volk_arena_t* get() const noexcept { return _arena; }
+
+private:
+    volk_arena_t* _arena;
+};
+
+/*!
+ * \brief Stateful C++11 allocator taking memory from a volk_arena_t
+ *
+ * \details
+ *   Storage is aligned to VOLK_MAX_ALIGNMENT and only returned by resetting
+ *   the arena, so reserve containers to their final size: a growing vector
+ *   leaves its old storage behind. Throws std::bad_alloc when the arena is
+ *   exhausted.
+ *
+ *   example code:
+ *     volk::arena scratch(1 << 20);
+ *     volk::arena_vector<float> tmp(n, volk::arena_alloc<float>(scratch));
+ */
+template <class T>
+struct arena_alloc {
+    typedef T value_type;
+
+    template <class U>
+    struct rebind {
+        typedef arena_alloc<U> other;
+    };
+
+    arena_alloc(volk_arena_t* a) noexcept : _arena(a) {}
+
+    arena_alloc(arena& a) noexcept : _arena(a.get()) {}
+
+    template <class U>
+    constexpr arena_alloc(arena_alloc<U> const& other) noexcept : _arena(other.get())
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_alloc();
+
+        const std::size_t alignment =
+            alignof(T) > VOLK_MAX_ALIGNMENT ? alignof(T) : VOLK_MAX_ALIGNMENT;
+        void* p = volk_arena_alloc(_arena, n * sizeof(T), alignment);
+        if (p)
+            return static_cast<T*>(p);
+
+        throw std::bad_alloc();
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    constexpr volk_arena_t* get() const noexcept { return _arena; }
+
+private:
+    volk_arena_t* _arena;
+};
+
+template <class T, class U>
+bool operator==(arena_alloc<T> const& a, arena_alloc<U> const& b)
+{
+    return a.get() == b.get();
+}
+
+template <class T, class U>
+bool operator!=(arena_alloc<T> const& a, arena_alloc<U> const& b)
+{
+    return a.get() != b.get();
+}
+
+/*!
+ * \brief type alias for std::vector using volk::arena_alloc
  */
 template <class T>
-using vector = std::vector<T, alloc<T>>;
+using arena_vector = std::vector<T, arena_alloc<T>>;
+
+template <class A>
+struct is_volk_alloc : std::false_type {
+};
+
+template <class T>
+struct is_volk_alloc<arena_alloc<T>> : std::true_type {
+};
+
+template <class T, unsigned int Flags>
+struct is_volk_alloc<alloc<T, Flags>> : std::true_type {
+};
+
+template <class T, unsigned int Flags>
+struct is_volk_alloc<default_init_alloc<T, Flags>> : std::true_type {
+};
+
+/*!
+ * \brief View of contiguous elements whose type carries their alignment
+ *
+ * \details
+ * The first element is aligned to Align bytes. With the default of
+ * VOLK_MAX_ALIGNMENT that satisfies the aligned implementations of every
+ * machine, which lets the overloads in volk/volk_span.hh call the _a kernel
+ * pointers without checking. Spans convert to spans of const elements and
+ * of smaller alignments. volk::vector and volk::uninitialized_vector convert
+ * implicitly, since volk::alloc allocates to VOLK_MAX_ALIGNMENT; raw
+ * pointers are wrapped explicitly and checked in debug builds.
+ */
+template <class T, std::size_t Align = VOLK_MAX_ALIGNMENT>
+class aligned_span
+{
+    static_assert(Align && (Align & (Align - 1)) == 0,
+                  "aligned_span alignment must be a power of two");
+
+public:
+    typedef T element_type;
+    typedef T* iterator;
+    static constexpr std::size_t alignment = Align;
+
+    constexpr aligned_span() noexcept : _data(nullptr), _size(0) {}
+
+    //! wrap memory the caller guarantees to be Align aligned
+    aligned_span(T* data, std::size_t size) noexcept : _data(data), _size(size)
+    {
+        assert(reinterpret_cast<std::uintptr_t>(data) % Align == 0);
+    }
+
+    template <class U,
+              std::size_t UAlign,
+              class = typename std::enable_if<
+                  UAlign >= Align && std::is_convertible<U (*)[], T (*)[]>::value>::type>
+    constexpr aligned_span(aligned_span<U, UAlign> const& other) noexcept
+        : _data(other.data()), _size(other.size())
+    {
+    }
+
+    template <class U,
+              class A,
+              class = typename std::enable_if<
+                  is_volk_alloc<A>::value && Align <= VOLK_MAX_ALIGNMENT &&
+                  std::is_convertible<U (*)[], T (*)[]>::value>::type>
+    aligned_span(std::vector<U, A>& v) noexcept : _data(v.data()), _size(v.size())
+    {
+    }
+
+    template <class U,
+              class A,
+              class = typename std::enable_if<
+                  is_volk_alloc<A>::value && Align <= VOLK_MAX_ALIGNMENT &&
+                  std::is_convertible<const U (*)[], T (*)[]>::value>::type>
+    aligned_span(std::vector<U, A> const& v) noexcept : _data(v.data()), _size(v.size())
+    {
+    }
+
+    constexpr T* data() const noexcept { return _data; }
+    constexpr std::size_t size() const noexcept { return _size; }
+    constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr iterator begin() const noexcept { return _data; }
+    constexpr iterator end() const noexcept { return _data + _size; }
+    T& operator[](std::size_t i) const noexcept { return _data[i]; }
+
+    //! the first count elements, which keep the alignment
+    aligned_span first(std::size_t count) const noexcept
+    {
+        assert(count <= _size);
+        return aligned_span(_data, count);
+    }
+
+    //! elements from offset on, which must itself be on an Align boundary
+    aligned_span subspan(std::size_t offset, std::size_t count) const noexcept
+    {
+        assert(offset + count <= _size && (offset * sizeof(T)) % Align == 0);
+        return aligned_span(_data + offset, count);
+    }
+
+private:
+    T* _data;
+    std::size_t _size;
+};
+
+/*!
+ * \brief View of contiguous elements without an alignment guarantee
+ *
+ * \details
+ * The vector arguments of the operations in volk/volk.hh. Any std::vector
+ * and any aligned_span convert implicitly; the operations pass the data to
+ * the kernel dispatcher, which checks the alignment at run time.
+ */
+template <class T>
+class span
+{
+public:
+    typedef T element_type;
+    typedef T* iterator;
+
+    constexpr span() noexcept : _data(nullptr), _size(0) {}
+
+    constexpr span(T* data, std::size_t size) noexcept : _data(data), _size(size) {}
+
+    template <class U,
+              class = typename std::enable_if<
+                  std::is_convertible<U (*)[], T (*)[]>::value>::type>
+    constexpr span(span<U> const& other) noexcept
+        : _data(other.data()), _size(other.size())
+    {
+    }
+
+    template <class U,
+              std::size_t UAlign,
+              class = typename std::enable_if<
+                  std::is_convertible<U (*)[], T (*)[]>::value>::type>
+    constexpr span(aligned_span<U, UAlign> const& other) noexcept
+        : _data(other.data()), _size(other.size())
+    {
+    }
+
+    template <class U,
+              class A,
+              class = typename std::enable_if<
+                  std::is_convertible<U (*)[], T (*)[]>::value>::type>
+    span(std::vector<U, A>& v) noexcept : _data(v.data()), _size(v.size())
+    {
+    }
+
+    template <class U,
+              class A,
+              class = typename std::enable_if<
+                  std::is_convertible<const U (*)[], T (*)[]>::value>::type>
+    span(std::vector<U, A> const& v) noexcept : _data(v.data()), _size(v.size())
+    {
+    }
+
+    constexpr T* data() const noexcept { return _data; }
+    constexpr std::size_t size() const noexcept { return _size; }
+    constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr iterator begin() const noexcept { return _data; }
+    constexpr iterator end() const noexcept { return _data + _size; }
+    T& operator[](std::size_t i) const noexcept { return _data[i]; }
+
+    span first(std::size_t count) const noexcept
+    {
+        assert(count <= _size);
+        return span(_data, count);
+    }
+
+    span subspan(std::size_t offset, std::size_t count) const noexcept
+    {
+        assert(offset + count <= _size);
+        return span(_data + offset, count);
+    }
+
+private:
+    T* _data;
+    std::size_t _size;
+};
+
+/*!
+ * \brief Circular buffer whose storage is mapped twice, back to back
+ *
+ * \details
+ * Any window of up to capacity() elements is contiguous, also where it wraps
+ * around the end, so streaming code can hand it to one kernel call without
+ * copying. The capacity is rounded up to whole pages.
+ *
+ * example code:
+ *   volk::ring_buffer<float> ring(1 << 16);
+ *   // write n samples at ring.window(head), process them in place:
+ *   volk_32f_s32f_multiply_32f(ring.window(head), ring.window(head), 2.f, n);
+ *   head = (head + n) % ring.capacity();
+ */
+template <class T>
+class ring_buffer
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ring_buffer elements must be trivially copyable");
+
+public:
+    explicit ring_buffer(std::size_t min_capacity)
+        : _data(static_cast<T*>(volk_malloc_ring(min_capacity, sizeof(T), &_capacity)))
+    {
+        if (_data == nullptr)
+            throw std::bad_alloc();
+    }
+
+    ~ring_buffer() { volk_free_ring(_data, _capacity, sizeof(T)); }
+
+    ring_buffer(ring_buffer const&) = delete;
+    ring_buffer& operator=(ring_buffer const&) = delete;
+
+    ring_buffer(ring_buffer&& other) noexcept
+        : _data(other._data), _capacity(other._capacity)
+    {
+        other._data = nullptr;
+        other._capacity = 0;
+    }
+
+    ring_buffer& operator=(ring_buffer&& other) noexcept
+    {
+        std::swap(_data, other._data);
+        std::swap(_capacity, other._capacity);
+        return *this;
+    }
+
+    std::size_t capacity() const noexcept { return _capacity; }
+
+    //! start of the 2 * capacity() elements long mapping
+    T* data() noexcept { return _data; }
+    const T* data() const noexcept { return _data; }
+
+    //! contiguous window of up to capacity() elements from position pos
+    T* window(std::size_t pos) noexcept { return _data + pos % _capacity; }
+    const T* window(std::size_t pos) const noexcept { return _data + pos % _capacity; }
+
+    T& operator[](std::size_t pos) noexcept { return _data[pos % _capacity]; }
+    const T& operator[](std::size_t pos) const noexcept { return _data[pos % _capacity]; }
+
+private:
+    T* _data;
+    std::size_t _capacity;
+};
 
 } // namespace volk
 #endif // INCLUDED_VOLK_ALLOC_H
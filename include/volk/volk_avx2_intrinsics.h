@@ -77,21 +77,41 @@ static inline __m256 _mm256_polar_sign_mask_avx2(__m128i fbits)
     return _mm256_castsi256_ps(sign_bits);
 }
 
-static inline __m256
-_mm256_polar_fsign_add_llrs_avx2(__m256 src0, __m256 src1, __m128i fbits)
+/* llr1 plus llr0 negated where the byte of fbits is 1, see llr_even() */
+static inline __m256 _mm256_polar_fsign_add_avx2(__m256 llr0, __m256 llr1, __m128i fbits)
 {
     // prepare sign mask for correct +-
     __m256 sign_mask = _mm256_polar_sign_mask_avx2(fbits);
 
-    __m256 llr0, llr1;
-    _mm256_polar_deinterleave(&llr0, &llr1, src0, src1);
-
     // calculate result
     llr0 = _mm256_xor_ps(llr0, sign_mask);
     __m256 dst = _mm256_add_ps(llr0, llr1);
     return dst;
 }
 
+static inline __m256
+_mm256_polar_fsign_add_llrs_avx2(__m256 src0, __m256 src1, __m128i fbits)
+{
+    __m256 llr0, llr1;
+    _mm256_polar_deinterleave(&llr0, &llr1, src0, src1);
+
+    return _mm256_polar_fsign_add_avx2(llr0, llr1, fbits);
+}
+
+/*
+ * Picks lane i of the 16 floats of lo and hi, lo first, by the low 4 bits of
+ * lane i of idx: the two source permute of AVX-512 built from two
+ * _mm256_permutevar8x32_ps.
+ */
+static inline __m256 _mm256_permutex2var_ps_avx2(__m256 lo, __m256i idx, __m256 hi)
+{
+    // bit 3 of the index moved to the sign bit selects hi
+    const __m256 select = _mm256_castsi256_ps(_mm256_slli_epi32(idx, 28));
+    return _mm256_blendv_ps(_mm256_permutevar8x32_ps(lo, idx),
+                            _mm256_permutevar8x32_ps(hi, idx),
+                            select);
+}
+
 static inline __m256 _mm256_magnitudesquared_ps_avx2(const __m256 cplxValue0,
                                                      const __m256 cplxValue1)
 {
@@ -102,6 +122,108 @@ static inline __m256 _mm256_magnitudesquared_ps_avx2(const __m256 cplxValue0,
     return _mm256_permutevar8x32_ps(complex_result, idx);
 }
 
+/* log2(x) for x >= 0, the 8 wide version of _mm_log2_ps_sse3 */
+static inline __m256 _mm256_log2_ps_avx2(const __m256 x)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256i bits = _mm256_castps_si256(x);
+    const __m256 exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(
+        _mm256_srli_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7f800000)), 23),
+        _mm256_set1_epi32(127)));
+    const __m256 frac = _mm256_or_ps(
+        one, _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffff))));
+
+    __m256 mantissa = _mm256_set1_ps(-3.4436006e-2f);
+    mantissa =
+        _mm256_add_ps(_mm256_mul_ps(mantissa, frac), _mm256_set1_ps(3.1821337e-1f));
+    mantissa = _mm256_add_ps(_mm256_mul_ps(mantissa, frac), _mm256_set1_ps(-1.2315303f));
+    mantissa = _mm256_add_ps(_mm256_mul_ps(mantissa, frac), _mm256_set1_ps(2.5988452f));
+    mantissa = _mm256_add_ps(_mm256_mul_ps(mantissa, frac), _mm256_set1_ps(-3.3241990f));
+    mantissa = _mm256_add_ps(_mm256_mul_ps(mantissa, frac), _mm256_set1_ps(3.1157899f));
+
+    return _mm256_add_ps(_mm256_mul_ps(mantissa, _mm256_sub_ps(frac, one)), exponent);
+}
+
+/* sin(x) and cos(x), the 8 wide version of _mm_sincos_ps_sse3 */
+static inline void _mm256_sincos_ps_avx2(__m256 x, __m256* sine, __m256* cosine)
+{
+    const __m256 sign_bit = _mm256_set1_ps(-0.f);
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256i four = _mm256_set1_epi32(4);
+    __m256 sign_sin = _mm256_and_ps(x, sign_bit);
+    x = _mm256_andnot_ps(sign_bit, x);
+
+    // octant j of |x|, rounded up to even
+    __m256i j =
+        _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f)));
+    j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)),
+                         _mm256_set1_epi32(~1));
+    const __m256 y = _mm256_cvtepi32_ps(j);
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(0.78515625f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(2.4187564849853515625e-4f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(3.77489497744594108e-8f)));
+
+    sign_sin = _mm256_xor_ps(sign_sin,
+                             _mm256_castsi256_ps(
+                                 _mm256_slli_epi32(_mm256_and_si256(j, four), 29)));
+    const __m256 sign_cos = _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(j, two), four), 29));
+    const __m256 swap =
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, two), two));
+
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 poly_cos = _mm256_set1_ps(2.443315711809948e-5f);
+    poly_cos =
+        _mm256_add_ps(_mm256_mul_ps(poly_cos, z), _mm256_set1_ps(-1.388731625493765e-3f));
+    poly_cos =
+        _mm256_add_ps(_mm256_mul_ps(poly_cos, z), _mm256_set1_ps(4.166664568298827e-2f));
+    poly_cos = _mm256_mul_ps(_mm256_mul_ps(poly_cos, z), z);
+    poly_cos = _mm256_sub_ps(poly_cos, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    poly_cos = _mm256_add_ps(poly_cos, _mm256_set1_ps(1.f));
+
+    __m256 poly_sin = _mm256_set1_ps(-1.9515295891e-4f);
+    poly_sin =
+        _mm256_add_ps(_mm256_mul_ps(poly_sin, z), _mm256_set1_ps(8.3321608736e-3f));
+    poly_sin =
+        _mm256_add_ps(_mm256_mul_ps(poly_sin, z), _mm256_set1_ps(-1.6666654611e-1f));
+    poly_sin = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(poly_sin, z), x), x);
+
+    *sine = _mm256_xor_ps(_mm256_blendv_ps(poly_sin, poly_cos, swap), sign_sin);
+    *cosine = _mm256_xor_ps(_mm256_blendv_ps(poly_cos, poly_sin, swap), sign_cos);
+}
+
+/* Four quadrant arctangent of y/x, the 8 wide version of _vatan2q_f32 */
+static inline __m256 _mm256_atan2_ps_avx2(const __m256 y, const __m256 x)
+{
+    const __m256 sign_bit = _mm256_set1_ps(-0.f);
+    const __m256 abs_x = _mm256_andnot_ps(sign_bit, x);
+    const __m256 abs_y = _mm256_andnot_ps(sign_bit, y);
+    const __m256 den = _mm256_max_ps(abs_x, abs_y);
+    // 0/0 is 0, as atan2f(0, 0)
+    const __m256 ratio =
+        _mm256_andnot_ps(_mm256_cmp_ps(den, _mm256_setzero_ps(), _CMP_EQ_OQ),
+                         _mm256_div_ps(_mm256_min_ps(abs_x, abs_y), den));
+    const __m256 ratio2 = _mm256_mul_ps(ratio, ratio);
+
+    __m256 res = _mm256_set1_ps(-0.00478018541f);
+    res = _mm256_add_ps(_mm256_mul_ps(res, ratio2), _mm256_set1_ps(0.0245562103f));
+    res = _mm256_add_ps(_mm256_mul_ps(res, ratio2), _mm256_set1_ps(-0.0599035136f));
+    res = _mm256_add_ps(_mm256_mul_ps(res, ratio2), _mm256_set1_ps(0.0994268283f));
+    res = _mm256_add_ps(_mm256_mul_ps(res, ratio2), _mm256_set1_ps(-0.140293956f));
+    res = _mm256_add_ps(_mm256_mul_ps(res, ratio2), _mm256_set1_ps(0.199713722f));
+    res = _mm256_add_ps(_mm256_mul_ps(res, ratio2), _mm256_set1_ps(-0.333320946f));
+    res = _mm256_add_ps(_mm256_mul_ps(res, ratio2), _mm256_set1_ps(0.99999994f));
+    res = _mm256_mul_ps(res, ratio);
+
+    res = _mm256_blendv_ps(res,
+                           _mm256_sub_ps(_mm256_set1_ps(1.57079633f), res),
+                           _mm256_cmp_ps(abs_y, abs_x, _CMP_GT_OQ));
+    // blendv picks by the sign bit, so x = -0 gives pi as atan2f does
+    res = _mm256_blendv_ps(res, _mm256_sub_ps(_mm256_set1_ps(3.14159265f), res), x);
+    // take the sign of y
+    return _mm256_or_ps(res, _mm256_and_ps(y, sign_bit));
+}
+
 static inline __m256 _mm256_scaled_norm_dist_ps_avx2(const __m256 symbols0,
                                                      const __m256 symbols1,
                                                      const __m256 points0,
@@ -119,4 +241,685 @@ static inline __m256 _mm256_scaled_norm_dist_ps_avx2(const __m256 symbols0,
     return _mm256_mul_ps(norms, scalar);
 }
 
+/*
+ * The decoding loop of the convolutional decoders, see volk_conv.h: num_bits
+ * steps of a rate 1/rate code over num_states states, at least 64. Handles
+ * 32 butterflies per vector.
+ */
+static inline void _mm256_conv_decode_avx2(unsigned char* Y,
+                                           unsigned char* X,
+                                           const unsigned char* syms,
+                                           unsigned char* dec,
+                                           unsigned int num_bits,
+                                           const unsigned char* Branchtab,
+                                           unsigned int num_states,
+                                           unsigned int rate)
+{
+    const unsigned int half = num_states / 2;
+    const unsigned int shift = rate > 2 ? 2 : 1;
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    const __m256i symbol_mask = _mm256_set1_epi8((char)(255 >> shift));
+    const __m256i metric_mask = _mm256_set1_epi8(63);
+    const __m256i max_metric = _mm256_set1_epi8((char)((rate * (255 >> shift)) >> 2));
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    unsigned int s, i, j;
+    __m256i metric, comp, old0, old1, m0, m1, m2, m3, s0, s1, d0, d1, lo, hi, m, min;
+    __m128i m128;
+
+    for (s = 0; s < num_bits; s++) {
+        for (i = 0; i < half; i += 32) {
+            old0 = _mm256_loadu_si256((const __m256i*)(old_metrics + i));
+            old1 = _mm256_loadu_si256((const __m256i*)(old_metrics + half + i));
+
+            // shifted in 16 bit lanes, masked to drop the bits of the next byte
+            metric = _mm256_setzero_si256();
+            for (j = 0; j < rate; j++) {
+                const __m256i diff = _mm256_xor_si256(
+                    _mm256_set1_epi8((char)syms[j]),
+                    _mm256_loadu_si256((const __m256i*)(Branchtab + j * half + i)));
+                metric = _mm256_add_epi8(
+                    metric,
+                    _mm256_and_si256(_mm256_srl_epi16(diff, shift_count), symbol_mask));
+            }
+            metric = _mm256_and_si256(_mm256_srli_epi16(metric, 2), metric_mask);
+            comp = _mm256_sub_epi8(max_metric, metric);
+
+            m0 = _mm256_adds_epu8(old0, metric);
+            m1 = _mm256_adds_epu8(old1, comp);
+            m2 = _mm256_adds_epu8(old0, comp);
+            m3 = _mm256_adds_epu8(old1, metric);
+            s0 = _mm256_min_epu8(m0, m1);
+            s1 = _mm256_min_epu8(m2, m3);
+            d0 = _mm256_cmpeq_epi8(s0, m1);
+            d1 = _mm256_cmpeq_epi8(s1, m3);
+
+            // the unpacks interleave within 128 bit lanes, so lo holds the new
+            // states 0-15 and 32-47 of the block and hi 16-31 and 48-63
+            lo = _mm256_unpacklo_epi8(s0, s1);
+            hi = _mm256_unpackhi_epi8(s0, s1);
+            _mm256_storeu_si256((__m256i*)(new_metrics + 2 * i),
+                                _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i*)(new_metrics + 2 * i + 32),
+                                _mm256_permute2x128_si256(lo, hi, 0x31));
+            lo = _mm256_unpacklo_epi8(d0, d1);
+            hi = _mm256_unpackhi_epi8(d0, d1);
+            *(unsigned int*)(dec + i / 4) = (unsigned int)_mm256_movemask_epi8(
+                _mm256_permute2x128_si256(lo, hi, 0x20));
+            *(unsigned int*)(dec + i / 4 + 4) = (unsigned int)_mm256_movemask_epi8(
+                _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+
+        if (new_metrics[0] > 210) {
+            m = _mm256_loadu_si256((const __m256i*)new_metrics);
+            for (i = 32; i < num_states; i += 32) {
+                m = _mm256_min_epu8(
+                    m, _mm256_loadu_si256((const __m256i*)(new_metrics + i)));
+            }
+            m128 = _mm_min_epu8(_mm256_castsi256_si128(m),
+                                _mm256_extracti128_si256(m, 1));
+            m128 = _mm_min_epu8(m128, _mm_srli_si128(m128, 8));
+            m128 = _mm_min_epu8(m128, _mm_srli_si128(m128, 4));
+            m128 = _mm_min_epu8(m128, _mm_srli_si128(m128, 2));
+            m128 = _mm_min_epu8(m128, _mm_srli_si128(m128, 1));
+            min = _mm256_broadcastb_epi8(m128);
+            for (i = 0; i < num_states; i += 32) {
+                m = _mm256_loadu_si256((const __m256i*)(new_metrics + i));
+                _mm256_storeu_si256((__m256i*)(new_metrics + i),
+                                    _mm256_subs_epu8(m, min));
+            }
+        }
+
+        syms += rate;
+        dec += num_states / 8;
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (old_metrics != X) {
+        for (i = 0; i < num_states; i += 32) {
+            _mm256_storeu_si256((__m256i*)(X + i),
+                                _mm256_loadu_si256((const __m256i*)(old_metrics + i)));
+        }
+    }
+}
+
+/*
+ * The max* of the turbo and trellis kernels: a where a - b, wrapped to 16 bits, is
+ * positive, else b, so that metrics which wrap around still compare right
+ */
+static inline __m256i _mm256_max_star_epi16(const __m256i a, const __m256i b)
+{
+    const __m256i a_wins =
+        _mm256_cmpgt_epi16(_mm256_sub_epi16(a, b), _mm256_setzero_si256());
+    return _mm256_blendv_epi8(b, a, a_wins);
+}
+
+/*
+ * x * y in Q15 as pmulhrsw, but with -1 * -1, the one product it wraps to -1,
+ * saturated as vqrdmulh does
+ */
+static inline __m256i _mm256_mulhrs_sat_epi16(const __m256i x, const __m256i y)
+{
+    const __m256i res = _mm256_mulhrs_epi16(x, y);
+    const __m256i wrapped = _mm256_and_si256(
+        _mm256_cmpeq_epi16(res, _mm256_set1_epi16(-32768)), _mm256_cmpeq_epi16(x, y));
+    return _mm256_xor_si256(res, wrapped);
+}
+
+/*
+ * Q15 x * y of interleaved complex values, with the real and imaginary parts of
+ * y each repeated over both halves of its value: the four products are rounded
+ * and saturated, then their difference and sum.
+ */
+static inline __m256i
+_mm256_complexmul_q15_epi16(const __m256i x, const __m256i yReal, const __m256i yImag)
+{
+    const __m256i xyReal = _mm256_mulhrs_sat_epi16(x, yReal); // xr * yr, xi * yr
+    __m256i xyImag = _mm256_mulhrs_sat_epi16(x, yImag);       // xr * yi, xi * yi
+    xyImag = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(xyImag, 0xb1), 0xb1);
+    return _mm256_blend_epi16(
+        _mm256_subs_epi16(xyReal, xyImag), _mm256_adds_epi16(xyReal, xyImag), 0xaa);
+}
+
+/* The set bits of each 64-bit lane, from nibble lookups summed with vpsadbw */
+static inline __m256i _mm256_popcnt_epi64_avx2(const __m256i v)
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3,
+                                            4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3,
+                                            3, 4);
+    const __m256i lowMask = _mm256_set1_epi8(0x0f);
+    const __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, lowMask));
+    const __m256i hi = _mm256_shuffle_epi8(
+        lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), lowMask));
+    return _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256());
+}
+
+/* Carry save adder: h and l get the twos and ones bits of a + b + c */
+static inline void _mm256_csa_si256(
+    __m256i* h, __m256i* l, const __m256i a, const __m256i b, const __m256i c)
+{
+    const __m256i u = _mm256_xor_si256(a, b);
+    *h = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+    *l = _mm256_xor_si256(u, c);
+}
+
+/*
+ * The set bits of num_vectors unaligned vectors at a, or of a ^ b when b is not
+ * NULL, in each 64-bit lane. Harley-Seal: a tree of carry save adders sums 16
+ * vectors into bit planes, so only the sixteens are looked up in the loop.
+ */
+static inline __m256i _mm256_popcnt_harley_seal_avx2(const __m256i* a,
+                                                     const __m256i* b,
+                                                     unsigned int num_vectors)
+{
+    __m256i total = _mm256_setzero_si256();
+    __m256i ones = _mm256_setzero_si256();
+    __m256i twos = _mm256_setzero_si256();
+    __m256i fours = _mm256_setzero_si256();
+    __m256i eights = _mm256_setzero_si256();
+    __m256i sixteens, twosA, twosB, foursA, foursB, eightsA, eightsB;
+    __m256i v[16];
+    unsigned int number = 0;
+    unsigned int i;
+
+    for (; number + 16 <= num_vectors; number += 16) {
+        for (i = 0; i < 16; i++) {
+            v[i] = _mm256_loadu_si256(a + number + i);
+            if (b) {
+                v[i] = _mm256_xor_si256(v[i], _mm256_loadu_si256(b + number + i));
+            }
+        }
+        _mm256_csa_si256(&twosA, &ones, ones, v[0], v[1]);
+        _mm256_csa_si256(&twosB, &ones, ones, v[2], v[3]);
+        _mm256_csa_si256(&foursA, &twos, twos, twosA, twosB);
+        _mm256_csa_si256(&twosA, &ones, ones, v[4], v[5]);
+        _mm256_csa_si256(&twosB, &ones, ones, v[6], v[7]);
+        _mm256_csa_si256(&foursB, &twos, twos, twosA, twosB);
+        _mm256_csa_si256(&eightsA, &fours, fours, foursA, foursB);
+        _mm256_csa_si256(&twosA, &ones, ones, v[8], v[9]);
+        _mm256_csa_si256(&twosB, &ones, ones, v[10], v[11]);
+        _mm256_csa_si256(&foursA, &twos, twos, twosA, twosB);
+        _mm256_csa_si256(&twosA, &ones, ones, v[12], v[13]);
+        _mm256_csa_si256(&twosB, &ones, ones, v[14], v[15]);
+        _mm256_csa_si256(&foursB, &twos, twos, twosA, twosB);
+        _mm256_csa_si256(&eightsB, &fours, fours, foursA, foursB);
+        _mm256_csa_si256(&sixteens, &eights, eights, eightsA, eightsB);
+
+        total = _mm256_add_epi64(total, _mm256_popcnt_epi64_avx2(sixteens));
+    }
+
+    // weigh the sixteens and the bit planes left over
+    total = _mm256_slli_epi64(total, 4);
+    eights = _mm256_slli_epi64(_mm256_popcnt_epi64_avx2(eights), 3);
+    fours = _mm256_slli_epi64(_mm256_popcnt_epi64_avx2(fours), 2);
+    twos = _mm256_slli_epi64(_mm256_popcnt_epi64_avx2(twos), 1);
+    ones = _mm256_popcnt_epi64_avx2(ones);
+    total = _mm256_add_epi64(_mm256_add_epi64(total, eights),
+                             _mm256_add_epi64(_mm256_add_epi64(fours, twos), ones));
+
+    for (; number < num_vectors; number++) {
+        v[0] = _mm256_loadu_si256(a + number);
+        if (b) {
+            v[0] = _mm256_xor_si256(v[0], _mm256_loadu_si256(b + number));
+        }
+        total = _mm256_add_epi64(total, _mm256_popcnt_epi64_avx2(v[0]));
+    }
+    return total;
+}
+
+/*
+ * Inclusive prefix sum of the eight 32-bit integers, wrapping modulo 2^32: two
+ * shift and add steps within the 128-bit lanes, then the last sum of the lower
+ * lane added to the upper.
+ */
+static inline __m256i _mm256_scan_epi32(__m256i x)
+{
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+    return _mm256_add_epi32(
+        x,
+        _mm256_permute2x128_si256(
+            _mm256_shuffle_epi32(x, 0xff), _mm256_setzero_si256(), 0x08));
+}
+
+/* Inclusive prefix sum of the four complex 32-bit integers, wrapping */
+static inline __m256i _mm256_scan_complex_epi32(__m256i x)
+{
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+    return _mm256_add_epi32(
+        x,
+        _mm256_permute2x128_si256(
+            _mm256_shuffle_epi32(x, 0xee), _mm256_setzero_si256(), 0x08));
+}
+
+/*
+ * A xoshiro128+ step of eight generators, word w of each in s[w]: returns their
+ * next words, whose low bits are the weakest
+ */
+static inline __m256i _mm256_xoshiro128p_epi32(__m256i* s)
+{
+    const __m256i result = _mm256_add_epi32(s[0], s[3]);
+    const __m256i t = _mm256_slli_epi32(s[1], 9);
+
+    s[2] = _mm256_xor_si256(s[2], s[0]);
+    s[3] = _mm256_xor_si256(s[3], s[1]);
+    s[1] = _mm256_xor_si256(s[1], s[2]);
+    s[0] = _mm256_xor_si256(s[0], s[3]);
+    s[2] = _mm256_xor_si256(s[2], t);
+    s[3] = _mm256_or_si256(_mm256_slli_epi32(s[3], 11), _mm256_srli_epi32(s[3], 21));
+    return result;
+}
+
+/* MSVC's /arch:AVX2, which the fma arch uses, brings FMA without __FMA__ */
+#if defined(__FMA__) || defined(_MSC_VER)
+/*
+ * exp(x) within 2 ulp, after cephes' expf: x = n ln(2) + r with |r| <= ln(2) / 2
+ * and a degree 6 polynomial for exp(r). 2^n is applied in two halves, so the
+ * results that fall into the denormals round once.
+ */
+static inline __m256 _mm256_exp_ps_avx2_fma(__m256 x)
+{
+    __m256 n, r, poly;
+    __m256i k, half;
+
+    // min and max return their second operand for NaN, which passes through
+    x = _mm256_max_ps(_mm256_set1_ps(-104.f), _mm256_min_ps(_mm256_set1_ps(89.f), x));
+    n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)),
+                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), x);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4f), r);
+
+    poly = _mm256_set1_ps(1.9875691500e-4f);
+    poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(1.3981999507e-3f));
+    poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(8.3334519073e-3f));
+    poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(4.1665795894e-2f));
+    poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(1.6666665459e-1f));
+    poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(5.0000001201e-1f));
+    poly = _mm256_fmadd_ps(poly, _mm256_mul_ps(r, r), r);
+    poly = _mm256_add_ps(poly, _mm256_set1_ps(1.f));
+
+    k = _mm256_cvtps_epi32(n);
+    half = _mm256_srai_epi32(k, 1);
+    k = _mm256_sub_epi32(k, half);
+    poly = _mm256_mul_ps(poly,
+                         _mm256_castsi256_ps(_mm256_slli_epi32(
+                             _mm256_add_epi32(half, _mm256_set1_epi32(127)), 23)));
+    return _mm256_mul_ps(
+        poly,
+        _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_add_epi32(k, _mm256_set1_epi32(127)), 23)));
+}
+
+/*
+ * log(x) for normal x > 0 within 2 ulp, after cephes' logf: x = 2^e m with m
+ * in [sqrt(1/2), sqrt(2)) and a degree 8 polynomial in m - 1, so that results
+ * next to x = 1 keep the relative accuracy _mm256_log2_ps_avx2 loses there.
+ */
+static inline __m256 _mm256_log_ps_avx2_fma(const __m256 x)
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256i bits = _mm256_castps_si256(x);
+    __m256 e, m, small, z, poly;
+
+    // m in [1/2, 1), then times 2 below sqrt(1/2)
+    e = _mm256_cvtepi32_ps(
+        _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+    m = _mm256_castsi256_ps(
+        _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x7fffff)),
+                        _mm256_set1_epi32(0x3f000000)));
+    small = _mm256_cmp_ps(m, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+    e = _mm256_sub_ps(e, _mm256_and_ps(small, one));
+    m = _mm256_add_ps(_mm256_sub_ps(m, one), _mm256_and_ps(small, m));
+
+    z = _mm256_mul_ps(m, m);
+    poly = _mm256_set1_ps(7.0376836292e-2f);
+    poly = _mm256_fmadd_ps(poly, m, _mm256_set1_ps(-1.1514610310e-1f));
+    poly = _mm256_fmadd_ps(poly, m, _mm256_set1_ps(1.1676998740e-1f));
+    poly = _mm256_fmadd_ps(poly, m, _mm256_set1_ps(-1.2420140846e-1f));
+    poly = _mm256_fmadd_ps(poly, m, _mm256_set1_ps(1.4249322787e-1f));
+    poly = _mm256_fmadd_ps(poly, m, _mm256_set1_ps(-1.6668057665e-1f));
+    poly = _mm256_fmadd_ps(poly, m, _mm256_set1_ps(2.0000714765e-1f));
+    poly = _mm256_fmadd_ps(poly, m, _mm256_set1_ps(-2.4999993993e-1f));
+    poly = _mm256_fmadd_ps(poly, m, _mm256_set1_ps(3.3333331174e-1f));
+    poly = _mm256_mul_ps(_mm256_mul_ps(poly, m), z);
+    // ln(2) in two parts
+    poly = _mm256_fmadd_ps(e, _mm256_set1_ps(-2.12194440e-4f), poly);
+    poly = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), poly);
+    return _mm256_fmadd_ps(e, _mm256_set1_ps(0.693359375f), _mm256_add_ps(m, poly));
+}
+
+/*
+ * Eight unit power complex Gaussian points by Box-Muller from two steps of the
+ * generators s, interleaved: points 0 to 3 in lo and 4 to 7 in hi. The top 24
+ * bits of the first words give the radius sqrt(-log(u)) for u in (0, 1], of
+ * the second the angle in [-pi, pi).
+ */
+static inline void _mm256_rand_gaussian_ps_avx2_fma(__m256i* s, __m256* lo, __m256* hi)
+{
+    const __m256i u = _mm256_xoshiro128p_epi32(s);
+    const __m256i v = _mm256_xoshiro128p_epi32(s);
+    const __m256i top = _mm256_add_epi32(_mm256_srli_epi32(u, 8), _mm256_set1_epi32(1));
+    const __m256 x =
+        _mm256_mul_ps(_mm256_cvtepi32_ps(top), _mm256_set1_ps(1.f / 16777216.f));
+    const __m256 radius =
+        _mm256_sqrt_ps(_mm256_sub_ps(_mm256_setzero_ps(), _mm256_log_ps_avx2_fma(x)));
+    // 2 pi / 2^24 a step
+    const __m256 angle = _mm256_mul_ps(
+        _mm256_cvtepi32_ps(
+            _mm256_sub_epi32(_mm256_srli_epi32(v, 8), _mm256_set1_epi32(8388608))),
+        _mm256_set1_ps(3.74507028e-7f));
+    __m256 sine, cosine, re, im;
+
+    _mm256_sincos_ps_avx2(angle, &sine, &cosine);
+    re = _mm256_mul_ps(radius, cosine);
+    im = _mm256_mul_ps(radius, sine);
+    // points 0, 1, 4, 5 and 2, 3, 6, 7
+    *lo = _mm256_unpacklo_ps(re, im);
+    *hi = _mm256_unpackhi_ps(re, im);
+    re = _mm256_permute2f128_ps(*lo, *hi, 0x20);
+    *hi = _mm256_permute2f128_ps(*lo, *hi, 0x31);
+    *lo = re;
+}
+
+/*
+ * log2(x) for positive doubles to about 1e-15, with the exponent and mantissa
+ * split of _mm256_log2_ps_avx2: the mantissa m is taken into [sqrt(1/2),
+ * sqrt(2)) and log(m) = 2 atanh(s), s = (m - 1) / (m + 1), as a series in s.
+ * Zero gives -1023 and infinity 1024.
+ */
+static inline __m256d _mm256_log2_pd_avx2_fma(const __m256d x)
+{
+    // 2^52, whose bits or'ed with a biased exponent make 2^52 plus it
+    const __m256d two52 = _mm256_set1_pd(4503599627370496.0);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256i bits = _mm256_castpd_si256(x);
+    __m256d exponent, m, big, s, s2, poly;
+
+    exponent = _mm256_castsi256_pd(
+        _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(two52)));
+    exponent = _mm256_sub_pd(exponent, _mm256_add_pd(two52, _mm256_set1_pd(1023.0)));
+    m = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(0xfffffffffffffLL)),
+        _mm256_castpd_si256(one)));
+    big = _mm256_cmp_pd(m, _mm256_set1_pd(1.4142135623730951), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+    exponent = _mm256_add_pd(exponent, _mm256_and_pd(big, one));
+
+    s = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+    s2 = _mm256_mul_pd(s, s);
+    poly = _mm256_set1_pd(1.0 / 13);
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(1.0 / 11));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(1.0 / 9));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(1.0 / 7));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(1.0 / 5));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(1.0 / 3));
+    poly = _mm256_fmadd_pd(poly, s2, one);
+    // 2 / ln(2)
+    return _mm256_fmadd_pd(
+        _mm256_mul_pd(s, poly), _mm256_set1_pd(2.8853900817779268), exponent);
+}
+
+/*
+ * 2^x to about 1e-13, clamped to +-160 beyond which floats are 0 or infinite:
+ * x = n + f with |f| <= 1/2, exp(f ln(2)) as a degree 10 Taylor series and n
+ * added to the exponent.
+ */
+static inline __m256d _mm256_exp2_pd_avx2_fma(__m256d x)
+{
+    // n + 1.5 * 2^52 holds n in its low bits
+    const __m256d shift = _mm256_set1_pd(6755399441055744.0);
+    __m256d n, f, poly;
+    __m256i scale;
+
+    x = _mm256_max_pd(_mm256_set1_pd(-160.0), _mm256_min_pd(_mm256_set1_pd(160.0), x));
+    n = _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    f = _mm256_mul_pd(_mm256_sub_pd(x, n), _mm256_set1_pd(0.6931471805599453));
+
+    poly = _mm256_set1_pd(1.0 / 3628800);
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0 / 362880));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0 / 40320));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0 / 5040));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0 / 720));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0 / 120));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0 / 24));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0 / 6));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(0.5));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0));
+    poly = _mm256_fmadd_pd(poly, f, _mm256_set1_pd(1.0));
+
+    scale = _mm256_add_epi64(_mm256_castpd_si256(_mm256_add_pd(n, shift)),
+                             _mm256_set1_epi64x(1023));
+    return _mm256_mul_pd(poly, _mm256_castsi256_pd(_mm256_slli_epi64(scale, 52)));
+}
+
+/*
+ * sin(x) and cos(x) in double to about 1e-16 for |x| below 2^30, after cephes'
+ * sin and cos: |x| is reduced by its octant as in _mm256_sincos_ps_avx2, with
+ * pi/4 in three parts, and degree 6 polynomials in x^2 give sine and cosine.
+ */
+static inline void _mm256_sincos_pd_avx2_fma(__m256d x, __m256d* sine, __m256d* cosine)
+{
+    const __m256d sign_bit = _mm256_set1_pd(-0.0);
+    // y + 1.5 * 2^52 holds the integer y in its low bits
+    const __m256d shift = _mm256_set1_pd(6755399441055744.0);
+    const __m256i two = _mm256_set1_epi64x(2);
+    const __m256i four = _mm256_set1_epi64x(4);
+    __m256d sign_sin = _mm256_and_pd(x, sign_bit);
+    __m256d y, z, poly_sin, poly_cos;
+    __m256i j;
+    x = _mm256_andnot_pd(sign_bit, x);
+
+    // octant j of |x|, rounded up to even
+    y = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.2732395447351628)),
+                        _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    j = _mm256_castpd_si256(_mm256_add_pd(y, shift));
+    j = _mm256_and_si256(_mm256_add_epi64(j, _mm256_set1_epi64x(1)),
+                         _mm256_set1_epi64x(~1LL));
+    y = _mm256_sub_pd(_mm256_castsi256_pd(j), shift);
+    x = _mm256_fnmadd_pd(y, _mm256_set1_pd(7.85398125648498535156e-1), x);
+    x = _mm256_fnmadd_pd(y, _mm256_set1_pd(3.77489470793079817668e-8), x);
+    x = _mm256_fnmadd_pd(y, _mm256_set1_pd(2.69515142907905952645e-15), x);
+
+    sign_sin = _mm256_xor_pd(
+        sign_sin,
+        _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(j, four), 61)));
+    const __m256d sign_cos = _mm256_castsi256_pd(
+        _mm256_slli_epi64(_mm256_andnot_si256(_mm256_sub_epi64(j, two), four), 61));
+    const __m256d swap =
+        _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(j, two), two));
+
+    z = _mm256_mul_pd(x, x);
+    poly_cos = _mm256_set1_pd(-1.13585365213876817300e-11);
+    poly_cos = _mm256_fmadd_pd(poly_cos, z, _mm256_set1_pd(2.08757008419747316778e-9));
+    poly_cos = _mm256_fmadd_pd(poly_cos, z, _mm256_set1_pd(-2.75573141792967388112e-7));
+    poly_cos = _mm256_fmadd_pd(poly_cos, z, _mm256_set1_pd(2.48015872888517045348e-5));
+    poly_cos = _mm256_fmadd_pd(poly_cos, z, _mm256_set1_pd(-1.38888888888730564116e-3));
+    poly_cos = _mm256_fmadd_pd(poly_cos, z, _mm256_set1_pd(4.16666666666665929218e-2));
+    poly_cos = _mm256_fmadd_pd(
+        _mm256_mul_pd(poly_cos, z),
+        z,
+        _mm256_fnmadd_pd(z, _mm256_set1_pd(0.5), _mm256_set1_pd(1.0)));
+
+    poly_sin = _mm256_set1_pd(1.58962301576546568060e-10);
+    poly_sin = _mm256_fmadd_pd(poly_sin, z, _mm256_set1_pd(-2.50507477628578072866e-8));
+    poly_sin = _mm256_fmadd_pd(poly_sin, z, _mm256_set1_pd(2.75573136213857245213e-6));
+    poly_sin = _mm256_fmadd_pd(poly_sin, z, _mm256_set1_pd(-1.98412698295895385996e-4));
+    poly_sin = _mm256_fmadd_pd(poly_sin, z, _mm256_set1_pd(8.33333333332211858878e-3));
+    poly_sin = _mm256_fmadd_pd(poly_sin, z, _mm256_set1_pd(-1.66666666666666307295e-1));
+    poly_sin = _mm256_fmadd_pd(_mm256_mul_pd(poly_sin, z), x, x);
+
+    *sine = _mm256_xor_pd(_mm256_blendv_pd(poly_sin, poly_cos, swap), sign_sin);
+    *cosine = _mm256_xor_pd(_mm256_blendv_pd(poly_cos, poly_sin, swap), sign_cos);
+}
+
+/*
+ * exp(x) in double within an ulp, the double version of _mm256_exp_ps_avx2_fma:
+ * ln(2) in two parts and a degree 13 Taylor series for exp(r), |r| <= ln(2) / 2.
+ */
+static inline __m256d _mm256_exp_pd_avx2_fma(__m256d x)
+{
+    // n + 1.5 * 2^52 holds n in its low bits
+    const __m256d shift = _mm256_set1_pd(6755399441055744.0);
+    __m256d n, half, r, poly;
+    __m256i k;
+
+    // min and max return their second operand for NaN, which passes through
+    x = _mm256_max_pd(_mm256_set1_pd(-746.0), _mm256_min_pd(_mm256_set1_pd(710.0), x));
+    n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.4426950408889634)),
+                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    r = _mm256_fnmadd_pd(n, _mm256_set1_pd(0.6931471805599453), x);
+    r = _mm256_fnmadd_pd(n, _mm256_set1_pd(2.3190468138462996e-17), r);
+
+    poly = _mm256_set1_pd(1.0 / 6227020800);
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 479001600));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 39916800));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 3628800));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 362880));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 40320));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 5040));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 720));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 120));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 24));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(1.0 / 6));
+    poly = _mm256_fmadd_pd(poly, r, _mm256_set1_pd(0.5));
+    poly = _mm256_fmadd_pd(poly, _mm256_mul_pd(r, r), r);
+    poly = _mm256_add_pd(poly, _mm256_set1_pd(1.0));
+
+    // 2^n in two halves, so the results that fall into the denormals round once
+    half = _mm256_round_pd(_mm256_mul_pd(n, _mm256_set1_pd(0.5)),
+                           _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    n = _mm256_sub_pd(n, half);
+    k = _mm256_add_epi64(_mm256_castpd_si256(_mm256_add_pd(half, shift)),
+                         _mm256_set1_epi64x(1023));
+    poly = _mm256_mul_pd(poly, _mm256_castsi256_pd(_mm256_slli_epi64(k, 52)));
+    k = _mm256_add_epi64(_mm256_castpd_si256(_mm256_add_pd(n, shift)),
+                         _mm256_set1_epi64x(1023));
+    return _mm256_mul_pd(poly, _mm256_castsi256_pd(_mm256_slli_epi64(k, 52)));
+}
+
+/*
+ * log(x) in double within an ulp, the natural log of _mm256_log2_pd_avx2_fma
+ * with the series taken to s^21. Denormals are scaled up first; as log() does,
+ * zero gives -infinity, infinity itself, and negative x and NaN give NaN.
+ */
+static inline __m256d _mm256_log_pd_avx2_fma(const __m256d x)
+{
+    // 2^52, whose bits or'ed with a biased exponent make 2^52 plus it
+    const __m256d two52 = _mm256_set1_pd(4503599627370496.0);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d infinity =
+        _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff0000000000000LL));
+    // below the smallest normal
+    const __m256d tiny =
+        _mm256_cmp_pd(x, _mm256_set1_pd(2.2250738585072014e-308), _CMP_LT_OQ);
+    const __m256i bits =
+        _mm256_castpd_si256(_mm256_blendv_pd(x, _mm256_mul_pd(x, two52), tiny));
+    __m256d exponent, m, big, f, s, s2, poly, half_f2, res;
+
+    exponent = _mm256_castsi256_pd(
+        _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(two52)));
+    exponent = _mm256_sub_pd(exponent, _mm256_add_pd(two52, _mm256_set1_pd(1023.0)));
+    exponent = _mm256_sub_pd(exponent, _mm256_and_pd(tiny, _mm256_set1_pd(52.0)));
+    m = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(0xfffffffffffffLL)),
+        _mm256_castpd_si256(one)));
+    big = _mm256_cmp_pd(m, _mm256_set1_pd(1.4142135623730951), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+    exponent = _mm256_add_pd(exponent, _mm256_and_pd(big, one));
+
+    // log(1 + f) = f - s f + s R, with s = f / (2 + f) and R the series in s^2
+    f = _mm256_sub_pd(m, one);
+    s = _mm256_div_pd(f, _mm256_add_pd(f, _mm256_set1_pd(2.0)));
+    s2 = _mm256_mul_pd(s, s);
+    poly = _mm256_set1_pd(2.0 / 21);
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 19));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 17));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 15));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 13));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 11));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 9));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 7));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 5));
+    poly = _mm256_fmadd_pd(poly, s2, _mm256_set1_pd(2.0 / 3));
+    half_f2 = _mm256_mul_pd(_mm256_mul_pd(f, f), _mm256_set1_pd(0.5));
+    // ln(2) in two parts
+    res = _mm256_fmadd_pd(
+        s,
+        _mm256_fmadd_pd(poly, s2, half_f2),
+        _mm256_mul_pd(exponent, _mm256_set1_pd(2.3190468138462996e-17)));
+    res = _mm256_add_pd(_mm256_sub_pd(res, half_f2), f);
+    res = _mm256_fmadd_pd(exponent, _mm256_set1_pd(0.6931471805599453), res);
+
+    res = _mm256_blendv_pd(res,
+                           _mm256_xor_pd(infinity, _mm256_set1_pd(-0.0)),
+                           _mm256_cmp_pd(x, zero, _CMP_EQ_OQ));
+    res = _mm256_blendv_pd(res, x, _mm256_cmp_pd(x, infinity, _CMP_EQ_OQ));
+    return _mm256_blendv_pd(res,
+                            _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff8000000000000LL)),
+                            _mm256_cmp_pd(x, zero, _CMP_NGE_UQ));
+}
+
+/*
+ * powf(x, y) to within an ulp. The power scales the error of log2(x), so the
+ * log and exp run in double; the rest follows powf: x = 1 or y = 0 give 1,
+ * NaN otherwise propagates, a negative x gives the sign of an odd integer y
+ * and NaN for a y that is no integer.
+ */
+static inline __m256 _mm256_pow_ps_avx2_fma(const __m256 x, const __m256 y)
+{
+    const __m256 sign_bit = _mm256_set1_ps(-0.f);
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 infinity = _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000));
+    const __m256 abs_x = _mm256_andnot_ps(sign_bit, x);
+    const __m256 y_half = _mm256_mul_ps(y, _mm256_set1_ps(0.5f));
+    __m256d low, high;
+    __m256 res, integer, odd, nan;
+
+    low = _mm256_cvtps_pd(_mm256_castps256_ps128(abs_x));
+    high = _mm256_cvtps_pd(_mm256_extractf128_ps(abs_x, 1));
+    low = _mm256_exp2_pd_avx2_fma(_mm256_mul_pd(
+        _mm256_cvtps_pd(_mm256_castps256_ps128(y)), _mm256_log2_pd_avx2_fma(low)));
+    high = _mm256_exp2_pd_avx2_fma(_mm256_mul_pd(
+        _mm256_cvtps_pd(_mm256_extractf128_ps(y, 1)), _mm256_log2_pd_avx2_fma(high)));
+    res = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm256_cvtpd_ps(low)), _mm256_cvtpd_ps(high), 1);
+
+    res = _mm256_blendv_ps(res, one, _mm256_cmp_ps(abs_x, one, _CMP_EQ_OQ));
+    nan = _mm256_and_ps(_mm256_cmp_ps(x, x, _CMP_UNORD_Q),
+                        _mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_NEQ_UQ));
+    res = _mm256_blendv_ps(res, x, nan);
+
+    integer = _mm256_cmp_ps(_mm256_round_ps(y, _MM_FROUND_TO_ZERO), y, _CMP_EQ_OQ);
+    odd = _mm256_cmp_ps(_mm256_round_ps(y_half, _MM_FROUND_TO_ZERO), y_half, _CMP_NEQ_UQ);
+    odd = _mm256_and_ps(odd, integer);
+    res = _mm256_or_ps(res, _mm256_and_ps(_mm256_and_ps(x, sign_bit), odd));
+    // x = -0 and -infinity take no NaN
+    nan = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ),
+                        _mm256_cmp_ps(abs_x, infinity, _CMP_LT_OQ));
+    nan = _mm256_andnot_ps(integer, nan);
+    return _mm256_or_ps(
+        res, _mm256_and_ps(nan, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fc00000))));
+}
+/* _mm256_complexmul_pd with the real products fused */
+static inline __m256d _mm256_complexmul_pd_avx2_fma(__m256d x, __m256d y)
+{
+    const __m256d yl = _mm256_movedup_pd(y);
+    const __m256d yh = _mm256_permute_pd(y, 0xF);
+    return _mm256_fmaddsub_pd(x, yl, _mm256_mul_pd(_mm256_permute_pd(x, 0x5), yh));
+}
+
+/* _mm256_complexconjugatemul_pd with the real products fused */
+static inline __m256d _mm256_complexconjugatemul_pd_avx2_fma(__m256d x, __m256d y)
+{
+    const __m256d yl = _mm256_movedup_pd(y);
+    const __m256d yh = _mm256_permute_pd(y, 0xF);
+    return _mm256_fmsubadd_pd(x, yl, _mm256_mul_pd(_mm256_permute_pd(x, 0x5), yh));
+}
+
+#endif /* __FMA__ || _MSC_VER */
+
 #endif /* INCLUDE_VOLK_VOLK_AVX2_INTRINSICS_H_ */
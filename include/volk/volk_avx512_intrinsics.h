@@ -0,0 +1,798 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This file is intended to hold AVX512F intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-paste.
+ */
+
+#ifndef INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_
+#define INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_
+#include <immintrin.h>
+
+static inline __m512 _mm512_complexmul_ps(__m512 x, __m512 y)
+{
+    const __m512 yl = _mm512_moveldup_ps(y); // cr,cr,dr,dr ...
+    const __m512 yh = _mm512_movehdup_ps(y); // ci,ci,di,di ...
+    const __m512 tmp2 = _mm512_mul_ps(_mm512_permute_ps(x, 0xB1), yh);
+
+    // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di ...
+    return _mm512_fmaddsub_ps(x, yl, tmp2);
+}
+
+static inline __m512 _mm512_complexconjugatemul_ps(__m512 x, __m512 y)
+{
+    const __m512 yl = _mm512_moveldup_ps(y); // cr,cr,dr,dr ...
+    const __m512 yh = _mm512_movehdup_ps(y); // ci,ci,di,di ...
+    const __m512 tmp2 = _mm512_mul_ps(_mm512_permute_ps(x, 0xB1), yh);
+
+    // ar*cr+ai*ci, ai*cr-ar*ci, br*dr+bi*di, bi*dr-br*di ...
+    return _mm512_fmsubadd_ps(x, yl, tmp2);
+}
+
+/* The complex double _mm512_complexmul_ps, four complex values a register */
+static inline __m512d _mm512_complexmul_pd(__m512d x, __m512d y)
+{
+    const __m512d yl = _mm512_movedup_pd(y);       // cr,cr,dr,dr ...
+    const __m512d yh = _mm512_permute_pd(y, 0xFF); // ci,ci,di,di ...
+    const __m512d tmp2 = _mm512_mul_pd(_mm512_permute_pd(x, 0x55), yh);
+    return _mm512_fmaddsub_pd(x, yl, tmp2);
+}
+
+static inline __m512d _mm512_complexconjugatemul_pd(__m512d x, __m512d y)
+{
+    const __m512d yl = _mm512_movedup_pd(y);
+    const __m512d yh = _mm512_permute_pd(y, 0xFF);
+    const __m512d tmp2 = _mm512_mul_pd(_mm512_permute_pd(x, 0x55), yh);
+    return _mm512_fmsubadd_pd(x, yl, tmp2);
+}
+
+/* Scales the four complex doubles to unit magnitude */
+static inline __m512d _mm512_normalize_pd(__m512d val)
+{
+    const __m512d tmp1 = _mm512_mul_pd(val, val);
+    const __m512d mag2 = _mm512_add_pd(tmp1, _mm512_permute_pd(tmp1, 0x55));
+    const __m512d mag = _mm512_sqrt_pd(mag2);
+    return _mm512_div_pd(val, mag);
+}
+
+/* The 16 wide _mm256_complexmul_parts_ps */
+static inline __m512 _mm512_complexmul_parts_ps(__m512 xyReal, __m512 xyImag)
+{
+    return _mm512_fmaddsub_ps(
+        xyReal, _mm512_set1_ps(1.f), _mm512_permute_ps(xyImag, 0xB1));
+}
+
+/* |x|^2 of the 16 complex values in cplxValue0 and cplxValue1, in order */
+static inline __m512 _mm512_magnitudesquared_ps(__m512 cplxValue0, __m512 cplxValue1)
+{
+    const __m512i realIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imagIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    const __m512 real = _mm512_permutex2var_ps(cplxValue0, realIdx, cplxValue1);
+    const __m512 imag = _mm512_permutex2var_ps(cplxValue0, imagIdx, cplxValue1);
+    return _mm512_fmadd_ps(real, real, _mm512_mul_ps(imag, imag));
+}
+
+/* Inclusive prefix sum of the 16 floats, in four steps of shifts in zeros */
+static inline __m512 _mm512_scan_ps(__m512 x)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    x = _mm512_add_ps(
+        x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 15)));
+    x = _mm512_add_ps(
+        x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 14)));
+    x = _mm512_add_ps(
+        x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 12)));
+    return _mm512_add_ps(
+        x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 8)));
+}
+
+/* Inclusive prefix sum of the eight complex values */
+static inline __m512 _mm512_scan_complex_ps(__m512 x)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    x = _mm512_add_ps(
+        x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 14)));
+    x = _mm512_add_ps(
+        x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 12)));
+    return _mm512_add_ps(
+        x, _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 8)));
+}
+
+/* Inclusive prefix sum of the 16 32-bit integers, wrapping modulo 2^32 */
+static inline __m512i _mm512_scan_epi32(__m512i x)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 15));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 14));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 12));
+    return _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 8));
+}
+
+/* Inclusive prefix sum of the eight complex 32-bit integers, wrapping */
+static inline __m512i _mm512_scan_complex_epi32(__m512i x)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 14));
+    x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 12));
+    return _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 8));
+}
+
+/* A xoshiro128+ step of 16 generators, the 16 wide _mm256_xoshiro128p_epi32 */
+static inline __m512i _mm512_xoshiro128p_epi32(__m512i* s)
+{
+    const __m512i result = _mm512_add_epi32(s[0], s[3]);
+    const __m512i t = _mm512_slli_epi32(s[1], 9);
+
+    s[2] = _mm512_xor_si512(s[2], s[0]);
+    s[3] = _mm512_xor_si512(s[3], s[1]);
+    s[1] = _mm512_xor_si512(s[1], s[2]);
+    s[0] = _mm512_xor_si512(s[0], s[3]);
+    s[2] = _mm512_xor_si512(s[2], t);
+    s[3] = _mm512_rol_epi32(s[3], 11);
+    return result;
+}
+
+/*
+ * Inclusive scan of the affine maps g -> a * g + b of the 16 lanes, the 16
+ * wide _mm_scan_affine_ps, in four steps of lane permutes.
+ */
+static inline void _mm512_scan_affine_ps(__m512* a, __m512* b)
+{
+    const __m512i lanes =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512 zero = _mm512_setzero_ps();
+    __m512i below;
+    __m512 belowA, belowB;
+    unsigned int distance;
+
+    for (distance = 1; distance < 16; distance *= 2) {
+        below = _mm512_sub_epi32(lanes, _mm512_set1_epi32(distance));
+        belowA = _mm512_mask_permutexvar_ps(one, 0xffff << distance, below, *a);
+        belowB = _mm512_mask_permutexvar_ps(zero, 0xffff << distance, below, *b);
+        *b = _mm512_fmadd_ps(*a, belowB, *b);
+        *a = _mm512_mul_ps(*a, belowA);
+    }
+}
+
+/*
+ * Sorts each lane across the vectors v[0] to v[n - 1] into ascending order,
+ * n a power of two, with a bitonic network whose comparators all put the
+ * minimum first. Each lane sorts a set of its own.
+ */
+static inline void _mm512_sort_network_ps(__m512* v, unsigned int n)
+{
+    __m512 low;
+    unsigned int size, step, flip, base, i, j;
+
+    for (size = 2; size <= n; size *= 2) {
+        for (step = size / 2; step > 0; step /= 2) {
+            // the first step compares the halves of each block mirrored
+            flip = step == size / 2 ? size - 1 : step;
+            // i takes the lower index of each pair
+            for (base = 0; base < n; base += 2 * step) {
+                for (i = base; i < base + step; i++) {
+                    j = i ^ flip;
+                    low = _mm512_min_ps(v[i], v[j]);
+                    v[j] = _mm512_max_ps(v[i], v[j]);
+                    v[i] = low;
+                }
+            }
+        }
+    }
+}
+
+/* log2(x) for x >= 0, the 16 wide version of _mm256_log2_ps_avx2 */
+static inline __m512 _mm512_log2_ps(const __m512 x)
+{
+    const __m512 one = _mm512_set1_ps(1.0f);
+    const __m512i bits = _mm512_castps_si512(x);
+    const __m512 exponent = _mm512_cvtepi32_ps(_mm512_sub_epi32(
+        _mm512_srli_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x7f800000)), 23),
+        _mm512_set1_epi32(127)));
+    const __m512 frac = _mm512_castsi512_ps(_mm512_or_si512(
+        _mm512_castps_si512(one), _mm512_and_si512(bits, _mm512_set1_epi32(0x7fffff))));
+
+    __m512 mantissa = _mm512_set1_ps(-3.4436006e-2f);
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(3.1821337e-1f));
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(-1.2315303f));
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(2.5988452f));
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(-3.3241990f));
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(3.1157899f));
+
+    return _mm512_fmadd_ps(mantissa, _mm512_sub_ps(frac, one), exponent);
+}
+
+/* Four quadrant arctangent of y/x, the 16 wide version of _mm256_atan2_ps_avx2 */
+static inline __m512 _mm512_atan2_ps(const __m512 y, const __m512 x)
+{
+    const __m512i sign_bit = _mm512_set1_epi32(0x80000000);
+    const __m512 abs_x = _mm512_abs_ps(x);
+    const __m512 abs_y = _mm512_abs_ps(y);
+    const __m512 den = _mm512_max_ps(abs_x, abs_y);
+    // 0/0 is 0, as atan2f(0, 0)
+    const __m512 ratio =
+        _mm512_maskz_div_ps(_mm512_cmp_ps_mask(den, _mm512_setzero_ps(), _CMP_NEQ_UQ),
+                            _mm512_min_ps(abs_x, abs_y),
+                            den);
+    const __m512 ratio2 = _mm512_mul_ps(ratio, ratio);
+
+    __m512 res = _mm512_set1_ps(-0.00478018541f);
+    res = _mm512_fmadd_ps(res, ratio2, _mm512_set1_ps(0.0245562103f));
+    res = _mm512_fmadd_ps(res, ratio2, _mm512_set1_ps(-0.0599035136f));
+    res = _mm512_fmadd_ps(res, ratio2, _mm512_set1_ps(0.0994268283f));
+    res = _mm512_fmadd_ps(res, ratio2, _mm512_set1_ps(-0.140293956f));
+    res = _mm512_fmadd_ps(res, ratio2, _mm512_set1_ps(0.199713722f));
+    res = _mm512_fmadd_ps(res, ratio2, _mm512_set1_ps(-0.333320946f));
+    res = _mm512_fmadd_ps(res, ratio2, _mm512_set1_ps(0.99999994f));
+    res = _mm512_mul_ps(res, ratio);
+
+    res = _mm512_mask_sub_ps(res,
+                             _mm512_cmp_ps_mask(abs_y, abs_x, _CMP_GT_OQ),
+                             _mm512_set1_ps(1.57079633f),
+                             res);
+    res = _mm512_mask_sub_ps(res,
+                             _mm512_test_epi32_mask(_mm512_castps_si512(x), sign_bit),
+                             _mm512_set1_ps(3.14159265f),
+                             res);
+    // take the sign of y
+    return _mm512_castsi512_ps(_mm512_or_epi32(
+        _mm512_castps_si512(res), _mm512_and_epi32(_mm512_castps_si512(y), sign_bit)));
+}
+
+/* The radix-4 FFT pass of _mm_fft_radix4_pass_sse3, eight points per step, h % 8 == 0 */
+static inline void _mm512_fft_radix4_pass_avx512f(float* data,
+                                                  unsigned int num_points,
+                                                  unsigned int h,
+                                                  const float* twiddles)
+{
+    unsigned int block, j;
+    for (block = 0; block < num_points; block += 4 * h) {
+        float* x0 = data + 2 * block;
+        float* x1 = x0 + 2 * h;
+        float* x2 = x1 + 2 * h;
+        float* x3 = x2 + 2 * h;
+        for (j = 0; j < 2 * h; j += 16) {
+            const __m512 w1 = _mm512_loadu_ps(twiddles + 2 * h + j);
+            const __m512 w2 = _mm512_loadu_ps(twiddles + 4 * h + j);
+            const __m512 w3 = _mm512_loadu_ps(twiddles + 6 * h + j);
+            const __m512 a0 = _mm512_loadu_ps(x0 + j);
+            const __m512 a2 = _mm512_loadu_ps(x2 + j);
+            const __m512 t1 = _mm512_complexmul_ps(_mm512_loadu_ps(x1 + j), w1);
+            const __m512 t3 = _mm512_complexmul_ps(_mm512_loadu_ps(x3 + j), w1);
+
+            const __m512 y0 = _mm512_add_ps(a0, t1);
+            const __m512 y1 = _mm512_sub_ps(a0, t1);
+            const __m512 u2 = _mm512_complexmul_ps(_mm512_add_ps(a2, t3), w2);
+            const __m512 u3 = _mm512_complexmul_ps(_mm512_sub_ps(a2, t3), w3);
+            _mm512_storeu_ps(x0 + j, _mm512_add_ps(y0, u2));
+            _mm512_storeu_ps(x2 + j, _mm512_sub_ps(y0, u2));
+            _mm512_storeu_ps(x1 + j, _mm512_add_ps(y1, u3));
+            _mm512_storeu_ps(x3 + j, _mm512_sub_ps(y1, u3));
+        }
+    }
+}
+
+/*
+ * Split 16 pairs of polar LLRs, interleaved across src0 and src1, into the
+ * even ones in llr0 and the odd ones in llr1.
+ */
+static inline void
+_mm512_polar_deinterleave(__m512* llr0, __m512* llr1, __m512 src0, __m512 src1)
+{
+    const __m512i even =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    *llr0 = _mm512_permutex2var_ps(src0, even, src1);
+    *llr1 = _mm512_permutex2var_ps(src0, odd, src1);
+}
+
+/* The min-sum of llr0 and llr1, as _mm256_polar_minsum() */
+static inline __m512 _mm512_polar_minsum(__m512 llr0, __m512 llr1)
+{
+    const __m512i sign_mask = _mm512_set1_epi32(0x80000000);
+
+    // xor of the signs, without AVX512DQ
+    const __m512i sign = _mm512_and_si512(
+        _mm512_xor_si512(_mm512_castps_si512(llr0), _mm512_castps_si512(llr1)),
+        sign_mask);
+    const __m512 dst = _mm512_min_ps(_mm512_abs_ps(llr0), _mm512_abs_ps(llr1));
+    return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(dst), sign));
+}
+
+/* The min-sum of the LLR pairs, as _mm256_polar_minsum_llrs() */
+static inline __m512 _mm512_polar_minsum_llrs(__m512 src0, __m512 src1)
+{
+    __m512 llr0, llr1;
+    _mm512_polar_deinterleave(&llr0, &llr1, src0, src1);
+
+    return _mm512_polar_minsum(llr0, llr1);
+}
+
+/* llr1 plus llr0 negated where the byte of fbits is set */
+static inline __m512 _mm512_polar_fsign_add(__m512 llr0, __m512 llr1, __m128i fbits)
+{
+    const __mmask16 flip =
+        _mm512_cmpneq_epi32_mask(_mm512_cvtepu8_epi32(fbits), _mm512_setzero_si512());
+
+    const __m512i even = _mm512_castps_si512(llr0);
+    llr0 = _mm512_castsi512_ps(
+        _mm512_mask_xor_epi32(even, flip, even, _mm512_set1_epi32(0x80000000)));
+    return _mm512_add_ps(llr0, llr1);
+}
+
+/*
+ * The sum of the LLR pairs with the even one negated where the byte of fbits
+ * is set, as _mm256_polar_fsign_add_llrs().
+ */
+static inline __m512 _mm512_polar_fsign_add_llrs(__m512 src0, __m512 src1, __m128i fbits)
+{
+    __m512 llr0, llr1;
+    _mm512_polar_deinterleave(&llr0, &llr1, src0, src1);
+
+    return _mm512_polar_fsign_add(llr0, llr1, fbits);
+}
+
+/* sin(x) and cos(x), the 16 wide version of _mm256_sincos_ps_avx2 */
+static inline void _mm512_sincos_ps(__m512 x, __m512* sine, __m512* cosine)
+{
+    const __m512i sign_bit = _mm512_set1_epi32(0x80000000);
+    const __m512i two = _mm512_set1_epi32(2);
+    const __m512i four = _mm512_set1_epi32(4);
+    __m512i sign_sin = _mm512_and_epi32(_mm512_castps_si512(x), sign_bit);
+    x = _mm512_abs_ps(x);
+
+    // octant j of |x|, rounded up to even
+    __m512i j = _mm512_cvttps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f)));
+    j = _mm512_and_epi32(_mm512_add_epi32(j, _mm512_set1_epi32(1)),
+                         _mm512_set1_epi32(~1));
+    const __m512 y = _mm512_cvtepi32_ps(j);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(0.78515625f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(2.4187564849853515625e-4f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(3.77489497744594108e-8f), x);
+
+    sign_sin =
+        _mm512_xor_epi32(sign_sin, _mm512_slli_epi32(_mm512_and_epi32(j, four), 29));
+    const __m512i sign_cos =
+        _mm512_slli_epi32(_mm512_andnot_epi32(_mm512_sub_epi32(j, two), four), 29);
+    const __mmask16 swap = _mm512_test_epi32_mask(j, two);
+
+    const __m512 z = _mm512_mul_ps(x, x);
+    __m512 poly_cos = _mm512_set1_ps(2.443315711809948e-5f);
+    poly_cos = _mm512_fmadd_ps(poly_cos, z, _mm512_set1_ps(-1.388731625493765e-3f));
+    poly_cos = _mm512_fmadd_ps(poly_cos, z, _mm512_set1_ps(4.166664568298827e-2f));
+    poly_cos = _mm512_mul_ps(_mm512_mul_ps(poly_cos, z), z);
+    poly_cos = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), poly_cos);
+    poly_cos = _mm512_add_ps(poly_cos, _mm512_set1_ps(1.f));
+
+    __m512 poly_sin = _mm512_set1_ps(-1.9515295891e-4f);
+    poly_sin = _mm512_fmadd_ps(poly_sin, z, _mm512_set1_ps(8.3321608736e-3f));
+    poly_sin = _mm512_fmadd_ps(poly_sin, z, _mm512_set1_ps(-1.6666654611e-1f));
+    poly_sin = _mm512_fmadd_ps(_mm512_mul_ps(poly_sin, z), x, x);
+
+    *sine = _mm512_castsi512_ps(_mm512_xor_epi32(
+        _mm512_castps_si512(_mm512_mask_blend_ps(swap, poly_sin, poly_cos)), sign_sin));
+    *cosine = _mm512_castsi512_ps(_mm512_xor_epi32(
+        _mm512_castps_si512(_mm512_mask_blend_ps(swap, poly_cos, poly_sin)), sign_cos));
+}
+
+/* exp(x) within 2 ulp, the 16 wide version of _mm256_exp_ps_avx2_fma */
+static inline __m512 _mm512_exp_ps(__m512 x)
+{
+    __m512 n, r, poly;
+
+    // min and max return their second operand for NaN, which passes through
+    x = _mm512_max_ps(_mm512_set1_ps(-104.f), _mm512_min_ps(_mm512_set1_ps(89.f), x));
+    n = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(1.44269504088896341f)),
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    r = _mm512_fnmadd_ps(n, _mm512_set1_ps(0.693359375f), x);
+    r = _mm512_fnmadd_ps(n, _mm512_set1_ps(-2.12194440e-4f), r);
+
+    poly = _mm512_set1_ps(1.9875691500e-4f);
+    poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(1.3981999507e-3f));
+    poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(8.3334519073e-3f));
+    poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(4.1665795894e-2f));
+    poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(1.6666665459e-1f));
+    poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(5.0000001201e-1f));
+    poly = _mm512_fmadd_ps(poly, _mm512_mul_ps(r, r), r);
+    poly = _mm512_add_ps(poly, _mm512_set1_ps(1.f));
+
+    // scalef rounds once into the denormals
+    return _mm512_scalef_ps(poly, n);
+}
+
+/* log(x) for normal x > 0 within 2 ulp, the 16 wide version of
+ * _mm256_log_ps_avx2_fma */
+static inline __m512 _mm512_log_ps(const __m512 x)
+{
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512i bits = _mm512_castps_si512(x);
+    __m512 e, m, z, poly;
+    __mmask16 small;
+
+    // m in [1/2, 1), then times 2 below sqrt(1/2)
+    e = _mm512_cvtepi32_ps(
+        _mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(126)));
+    m = _mm512_castsi512_ps(
+        _mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x7fffff)),
+                        _mm512_set1_epi32(0x3f000000)));
+    small = _mm512_cmp_ps_mask(m, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+    e = _mm512_mask_sub_ps(e, small, e, one);
+    m = _mm512_mask_add_ps(_mm512_sub_ps(m, one), small, _mm512_sub_ps(m, one), m);
+
+    z = _mm512_mul_ps(m, m);
+    poly = _mm512_set1_ps(7.0376836292e-2f);
+    poly = _mm512_fmadd_ps(poly, m, _mm512_set1_ps(-1.1514610310e-1f));
+    poly = _mm512_fmadd_ps(poly, m, _mm512_set1_ps(1.1676998740e-1f));
+    poly = _mm512_fmadd_ps(poly, m, _mm512_set1_ps(-1.2420140846e-1f));
+    poly = _mm512_fmadd_ps(poly, m, _mm512_set1_ps(1.4249322787e-1f));
+    poly = _mm512_fmadd_ps(poly, m, _mm512_set1_ps(-1.6668057665e-1f));
+    poly = _mm512_fmadd_ps(poly, m, _mm512_set1_ps(2.0000714765e-1f));
+    poly = _mm512_fmadd_ps(poly, m, _mm512_set1_ps(-2.4999993993e-1f));
+    poly = _mm512_fmadd_ps(poly, m, _mm512_set1_ps(3.3333331174e-1f));
+    poly = _mm512_mul_ps(_mm512_mul_ps(poly, m), z);
+    // ln(2) in two parts
+    poly = _mm512_fmadd_ps(e, _mm512_set1_ps(-2.12194440e-4f), poly);
+    poly = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), poly);
+    return _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), _mm512_add_ps(m, poly));
+}
+
+/*
+ * 16 Gaussian points of the generators s, the 16 wide
+ * _mm256_rand_gaussian_ps_avx2_fma: points 0 to 7 in lo and 8 to 15 in hi
+ */
+static inline void _mm512_rand_gaussian_ps(__m512i* s, __m512* lo, __m512* hi)
+{
+    const __m512i u = _mm512_xoshiro128p_epi32(s);
+    const __m512i v = _mm512_xoshiro128p_epi32(s);
+    const __m512i top = _mm512_add_epi32(_mm512_srli_epi32(u, 8), _mm512_set1_epi32(1));
+    const __m512 x =
+        _mm512_mul_ps(_mm512_cvtepi32_ps(top), _mm512_set1_ps(1.f / 16777216.f));
+    const __m512 radius =
+        _mm512_sqrt_ps(_mm512_sub_ps(_mm512_setzero_ps(), _mm512_log_ps(x)));
+    const __m512 angle = _mm512_mul_ps(
+        _mm512_cvtepi32_ps(
+            _mm512_sub_epi32(_mm512_srli_epi32(v, 8), _mm512_set1_epi32(8388608))),
+        _mm512_set1_ps(3.74507028e-7f));
+    const __m512i index_lo =
+        _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i index_hi =
+        _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    __m512 sine, cosine, re, im;
+
+    _mm512_sincos_ps(angle, &sine, &cosine);
+    re = _mm512_mul_ps(radius, cosine);
+    im = _mm512_mul_ps(radius, sine);
+    *lo = _mm512_permutex2var_ps(re, index_lo, im);
+    *hi = _mm512_permutex2var_ps(re, index_hi, im);
+}
+
+/* log2(x) for positive doubles, the eight wide version of _mm256_log2_pd_avx2_fma */
+static inline __m512d _mm512_log2_pd(const __m512d x)
+{
+    const __m512d one = _mm512_set1_pd(1.0);
+    __m512d exponent, m, s, s2, poly;
+    __mmask8 big;
+
+    exponent = _mm512_getexp_pd(x);
+    m = _mm512_getmant_pd(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+    big = _mm512_cmp_pd_mask(m, _mm512_set1_pd(1.4142135623730951), _CMP_GT_OQ);
+    m = _mm512_mask_mul_pd(m, big, m, _mm512_set1_pd(0.5));
+    exponent = _mm512_mask_add_pd(exponent, big, exponent, one);
+
+    s = _mm512_div_pd(_mm512_sub_pd(m, one), _mm512_add_pd(m, one));
+    s2 = _mm512_mul_pd(s, s);
+    poly = _mm512_set1_pd(1.0 / 13);
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(1.0 / 11));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(1.0 / 9));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(1.0 / 7));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(1.0 / 5));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(1.0 / 3));
+    poly = _mm512_fmadd_pd(poly, s2, one);
+    // 2 / ln(2)
+    return _mm512_fmadd_pd(
+        _mm512_mul_pd(s, poly), _mm512_set1_pd(2.8853900817779268), exponent);
+}
+
+/* 2^x, the eight wide version of _mm256_exp2_pd_avx2_fma */
+static inline __m512d _mm512_exp2_pd(__m512d x)
+{
+    __m512d n, f, poly;
+
+    x = _mm512_max_pd(_mm512_set1_pd(-160.0), _mm512_min_pd(_mm512_set1_pd(160.0), x));
+    n = _mm512_roundscale_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    f = _mm512_mul_pd(_mm512_sub_pd(x, n), _mm512_set1_pd(0.6931471805599453));
+
+    poly = _mm512_set1_pd(1.0 / 3628800);
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0 / 362880));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0 / 40320));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0 / 5040));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0 / 720));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0 / 120));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0 / 24));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0 / 6));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(0.5));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0));
+    poly = _mm512_fmadd_pd(poly, f, _mm512_set1_pd(1.0));
+
+    return _mm512_scalef_pd(poly, n);
+}
+
+/* sin(x) and cos(x) in double, the eight wide version of _mm256_sincos_pd_avx2_fma */
+static inline void _mm512_sincos_pd(__m512d x, __m512d* sine, __m512d* cosine)
+{
+    const __m512i sign_bit = _mm512_set1_epi64(0x8000000000000000LL);
+    // y + 1.5 * 2^52 holds the integer y in its low bits
+    const __m512d shift = _mm512_set1_pd(6755399441055744.0);
+    const __m512i two = _mm512_set1_epi64(2);
+    const __m512i four = _mm512_set1_epi64(4);
+    __m512i sign_sin = _mm512_and_epi64(_mm512_castpd_si512(x), sign_bit);
+    __m512d y, z, poly_sin, poly_cos;
+    __m512i j;
+    x = _mm512_abs_pd(x);
+
+    // octant j of |x|, rounded up to even
+    y = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(1.2732395447351628)),
+                             _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    j = _mm512_castpd_si512(_mm512_add_pd(y, shift));
+    j = _mm512_and_epi64(_mm512_add_epi64(j, _mm512_set1_epi64(1)),
+                         _mm512_set1_epi64(~1LL));
+    y = _mm512_sub_pd(_mm512_castsi512_pd(j), shift);
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(7.85398125648498535156e-1), x);
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(3.77489470793079817668e-8), x);
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(2.69515142907905952645e-15), x);
+
+    sign_sin =
+        _mm512_xor_epi64(sign_sin, _mm512_slli_epi64(_mm512_and_epi64(j, four), 61));
+    const __m512i sign_cos =
+        _mm512_slli_epi64(_mm512_andnot_epi64(_mm512_sub_epi64(j, two), four), 61);
+    const __mmask8 swap = _mm512_test_epi64_mask(j, two);
+
+    z = _mm512_mul_pd(x, x);
+    poly_cos = _mm512_set1_pd(-1.13585365213876817300e-11);
+    poly_cos = _mm512_fmadd_pd(poly_cos, z, _mm512_set1_pd(2.08757008419747316778e-9));
+    poly_cos = _mm512_fmadd_pd(poly_cos, z, _mm512_set1_pd(-2.75573141792967388112e-7));
+    poly_cos = _mm512_fmadd_pd(poly_cos, z, _mm512_set1_pd(2.48015872888517045348e-5));
+    poly_cos = _mm512_fmadd_pd(poly_cos, z, _mm512_set1_pd(-1.38888888888730564116e-3));
+    poly_cos = _mm512_fmadd_pd(poly_cos, z, _mm512_set1_pd(4.16666666666665929218e-2));
+    poly_cos = _mm512_fmadd_pd(
+        _mm512_mul_pd(poly_cos, z),
+        z,
+        _mm512_fnmadd_pd(z, _mm512_set1_pd(0.5), _mm512_set1_pd(1.0)));
+
+    poly_sin = _mm512_set1_pd(1.58962301576546568060e-10);
+    poly_sin = _mm512_fmadd_pd(poly_sin, z, _mm512_set1_pd(-2.50507477628578072866e-8));
+    poly_sin = _mm512_fmadd_pd(poly_sin, z, _mm512_set1_pd(2.75573136213857245213e-6));
+    poly_sin = _mm512_fmadd_pd(poly_sin, z, _mm512_set1_pd(-1.98412698295895385996e-4));
+    poly_sin = _mm512_fmadd_pd(poly_sin, z, _mm512_set1_pd(8.33333333332211858878e-3));
+    poly_sin = _mm512_fmadd_pd(poly_sin, z, _mm512_set1_pd(-1.66666666666666307295e-1));
+    poly_sin = _mm512_fmadd_pd(_mm512_mul_pd(poly_sin, z), x, x);
+
+    *sine = _mm512_castsi512_pd(_mm512_xor_epi64(
+        _mm512_castpd_si512(_mm512_mask_blend_pd(swap, poly_sin, poly_cos)), sign_sin));
+    *cosine = _mm512_castsi512_pd(_mm512_xor_epi64(
+        _mm512_castpd_si512(_mm512_mask_blend_pd(swap, poly_cos, poly_sin)), sign_cos));
+}
+
+/* exp(x) in double, the eight wide version of _mm256_exp_pd_avx2_fma */
+static inline __m512d _mm512_exp_pd(__m512d x)
+{
+    __m512d n, r, poly;
+
+    // min and max return their second operand for NaN, which passes through
+    x = _mm512_max_pd(_mm512_set1_pd(-746.0), _mm512_min_pd(_mm512_set1_pd(710.0), x));
+    n = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(1.4426950408889634)),
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    r = _mm512_fnmadd_pd(n, _mm512_set1_pd(0.6931471805599453), x);
+    r = _mm512_fnmadd_pd(n, _mm512_set1_pd(2.3190468138462996e-17), r);
+
+    poly = _mm512_set1_pd(1.0 / 6227020800);
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 479001600));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 39916800));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 3628800));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 362880));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 40320));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 5040));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 720));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 120));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 24));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(1.0 / 6));
+    poly = _mm512_fmadd_pd(poly, r, _mm512_set1_pd(0.5));
+    poly = _mm512_fmadd_pd(poly, _mm512_mul_pd(r, r), r);
+    poly = _mm512_add_pd(poly, _mm512_set1_pd(1.0));
+
+    // scalef rounds once into the denormals
+    return _mm512_scalef_pd(poly, n);
+}
+
+/*
+ * log(x) in double, the eight wide version of _mm256_log_pd_avx2_fma; getexp and
+ * getmant take denormals as they are.
+ */
+static inline __m512d _mm512_log_pd(const __m512d x)
+{
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d infinity = _mm512_castsi512_pd(_mm512_set1_epi64(0x7ff0000000000000LL));
+    __m512d exponent, m, f, s, s2, poly, half_f2, res;
+    __mmask8 big;
+
+    exponent = _mm512_getexp_pd(x);
+    m = _mm512_getmant_pd(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+    big = _mm512_cmp_pd_mask(m, _mm512_set1_pd(1.4142135623730951), _CMP_GT_OQ);
+    m = _mm512_mask_mul_pd(m, big, m, _mm512_set1_pd(0.5));
+    exponent = _mm512_mask_add_pd(exponent, big, exponent, one);
+
+    // log(1 + f) = f - s f + s R, with s = f / (2 + f) and R the series in s^2
+    f = _mm512_sub_pd(m, one);
+    s = _mm512_div_pd(f, _mm512_add_pd(f, _mm512_set1_pd(2.0)));
+    s2 = _mm512_mul_pd(s, s);
+    poly = _mm512_set1_pd(2.0 / 21);
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 19));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 17));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 15));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 13));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 11));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 9));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 7));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 5));
+    poly = _mm512_fmadd_pd(poly, s2, _mm512_set1_pd(2.0 / 3));
+    half_f2 = _mm512_mul_pd(_mm512_mul_pd(f, f), _mm512_set1_pd(0.5));
+    // ln(2) in two parts
+    res = _mm512_fmadd_pd(
+        s,
+        _mm512_fmadd_pd(poly, s2, half_f2),
+        _mm512_mul_pd(exponent, _mm512_set1_pd(2.3190468138462996e-17)));
+    res = _mm512_add_pd(_mm512_sub_pd(res, half_f2), f);
+    res = _mm512_fmadd_pd(exponent, _mm512_set1_pd(0.6931471805599453), res);
+
+    res = _mm512_mask_mov_pd(res,
+                             _mm512_cmp_pd_mask(x, zero, _CMP_EQ_OQ),
+                             _mm512_sub_pd(zero, infinity));
+    res = _mm512_mask_mov_pd(res, _mm512_cmp_pd_mask(x, infinity, _CMP_EQ_OQ), x);
+    return _mm512_mask_mov_pd(
+        res,
+        _mm512_cmp_pd_mask(x, zero, _CMP_NGE_UQ),
+        _mm512_castsi512_pd(_mm512_set1_epi64(0x7ff8000000000000LL)));
+}
+
+/* powf(x, y), the 16 wide version of _mm256_pow_ps_avx2_fma */
+static inline __m512 _mm512_pow_ps(const __m512 x, const __m512 y)
+{
+    const __m512i sign_bit = _mm512_set1_epi32(0x80000000);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 infinity = _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000));
+    const __m512 abs_x = _mm512_abs_ps(x);
+    const __m512 y_half = _mm512_mul_ps(y, _mm512_set1_ps(0.5f));
+    __m512d low, high;
+    __m512 res;
+    __mmask16 integer, odd, nan;
+
+    low = _mm512_cvtps_pd(_mm512_castps512_ps256(abs_x));
+    high = _mm512_cvtps_pd(
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(abs_x), 1)));
+    low = _mm512_exp2_pd(_mm512_mul_pd(_mm512_cvtps_pd(_mm512_castps512_ps256(y)),
+                                       _mm512_log2_pd(low)));
+    high = _mm512_exp2_pd(_mm512_mul_pd(
+        _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(y), 1))),
+        _mm512_log2_pd(high)));
+    res = _mm512_castpd_ps(
+        _mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(low))),
+                           _mm256_castps_pd(_mm512_cvtpd_ps(high)),
+                           1));
+
+    res = _mm512_mask_mov_ps(res, _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), x);
+    res = _mm512_mask_mov_ps(res,
+                             _mm512_cmp_ps_mask(abs_x, _mm512_set1_ps(1.f), _CMP_EQ_OQ) |
+                                 _mm512_cmp_ps_mask(y, zero, _CMP_EQ_OQ),
+                             _mm512_set1_ps(1.f));
+
+    integer = _mm512_cmp_ps_mask(
+        _mm512_roundscale_ps(y, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), y, _CMP_EQ_OQ);
+    odd = _mm512_mask_cmp_ps_mask(
+        integer,
+        _mm512_roundscale_ps(y_half, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC),
+        y_half,
+        _CMP_NEQ_UQ);
+    res = _mm512_castsi512_ps(_mm512_mask_or_epi32(
+        _mm512_castps_si512(res),
+        odd,
+        _mm512_castps_si512(res),
+        _mm512_and_epi32(_mm512_castps_si512(x), sign_bit)));
+    // x = -0 and -infinity take no NaN
+    nan = _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ) &
+          _mm512_cmp_ps_mask(abs_x, infinity, _CMP_LT_OQ) & ~integer;
+    return _mm512_mask_mov_ps(
+        res, nan, _mm512_castsi512_ps(_mm512_set1_epi32(0x7fc00000)));
+}
+
+#ifdef __AVX512BW__
+/* a where a - b, wrapped to 16 bits, is positive, else b, as the turbo kernels */
+static inline __m512i _mm512_max_star_epi16(const __m512i a, const __m512i b)
+{
+    return _mm512_mask_blend_epi16(
+        _mm512_cmpgt_epi16_mask(_mm512_sub_epi16(a, b), _mm512_setzero_si512()), b, a);
+}
+
+/* x * y in Q15 as pmulhrsw, with -1 * -1 saturated as vqrdmulh does */
+static inline __m512i _mm512_mulhrs_sat_epi16(const __m512i x, const __m512i y)
+{
+    const __m512i res = _mm512_mulhrs_epi16(x, y);
+    return _mm512_mask_mov_epi16(
+        res,
+        _mm512_cmpeq_epi16_mask(res, _mm512_set1_epi16(-32768)) &
+            _mm512_cmpeq_epi16_mask(x, y),
+        _mm512_set1_epi16(32767));
+}
+
+/*
+ * Q15 x * y of interleaved complex values, with the real and imaginary parts of
+ * y each repeated over both halves of its value
+ */
+static inline __m512i
+_mm512_complexmul_q15_epi16(const __m512i x, const __m512i yReal, const __m512i yImag)
+{
+    const __m512i xyReal = _mm512_mulhrs_sat_epi16(x, yReal); // xr * yr, xi * yr
+    __m512i xyImag = _mm512_mulhrs_sat_epi16(x, yImag);       // xr * yi, xi * yi
+    xyImag = _mm512_shufflehi_epi16(_mm512_shufflelo_epi16(xyImag, 0xb1), 0xb1);
+    return _mm512_mask_blend_epi16(_cvtu32_mask32(0xaaaaaaaa),
+                                   _mm512_subs_epi16(xyReal, xyImag),
+                                   _mm512_adds_epi16(xyReal, xyImag));
+}
+#endif /* __AVX512BW__ */
+
+#ifdef __AVX512CD__
+/*
+ * Adds one to histogram[idx] for each of the 16 indices selected by k,
+ * duplicates included. The conflict detection gives each lane the earlier
+ * lanes with its index, so it adds their number plus one to the count it
+ * gathered; the scatter writes the lanes in order, so the last of them, which
+ * holds the total, lands last.
+ */
+static inline void
+_mm512_mask_histogram_add_epi32(uint32_t* histogram, __mmask16 k, __m512i idx)
+{
+    const __m512i m1 = _mm512_set1_epi32(0x5555);
+    const __m512i m2 = _mm512_set1_epi32(0x3333);
+    const __m512i m4 = _mm512_set1_epi32(0x0f0f);
+    __m512i dups, counts;
+
+    dups = _mm512_and_si512(_mm512_conflict_epi32(idx), _mm512_set1_epi32(k));
+    // population count of the at most 15 bits
+    dups = _mm512_sub_epi32(dups, _mm512_and_si512(_mm512_srli_epi32(dups, 1), m1));
+    dups = _mm512_add_epi32(_mm512_and_si512(dups, m2),
+                            _mm512_and_si512(_mm512_srli_epi32(dups, 2), m2));
+    dups = _mm512_and_si512(_mm512_add_epi32(dups, _mm512_srli_epi32(dups, 4)), m4);
+    dups = _mm512_and_si512(_mm512_add_epi32(dups, _mm512_srli_epi32(dups, 8)),
+                            _mm512_set1_epi32(0x1f));
+
+    counts = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), k, idx, histogram, 4);
+    counts = _mm512_add_epi32(counts, _mm512_add_epi32(dups, _mm512_set1_epi32(1)));
+    _mm512_mask_i32scatter_epi32(histogram, k, idx, counts, 4);
+}
+#endif /* __AVX512CD__ */
+
+#endif /* INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_ */
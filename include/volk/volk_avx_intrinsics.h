@@ -42,6 +42,16 @@ static inline __m256 _mm256_complexmul_ps(__m256 x, __m256 y)
     return _mm256_addsub_ps(tmp1, tmp2);
 }
 
+/*
+ * x * y from xyReal = x * real(y) and xyImag = x * imag(y), for products summed
+ * over many y before the two parts are combined.
+ */
+static inline __m256 _mm256_complexmul_parts_ps(__m256 xyReal, __m256 xyImag)
+{
+    // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di
+    return _mm256_addsub_ps(xyReal, _mm256_permute_ps(xyImag, 0xB1));
+}
+
 static inline __m256 _mm256_conjugate_ps(__m256 x)
 {
     const __m256 conjugator = _mm256_setr_ps(0, -0.f, 0, -0.f, 0, -0.f, 0, -0.f);
@@ -70,6 +80,39 @@ static inline __m256 _mm256_normalize_ps(__m256 val)
     return _mm256_div_ps(val, tmp1);
 }
 
+/* The complex double _mm256_complexmul_ps, two complex values a register */
+static inline __m256d _mm256_complexmul_pd(__m256d x, __m256d y)
+{
+    const __m256d yl = _mm256_movedup_pd(y);      // cr,cr,dr,dr
+    const __m256d yh = _mm256_permute_pd(y, 0xF); // ci,ci,di,di
+    const __m256d tmp1 = _mm256_mul_pd(x, yl);    // ar*cr,ai*cr,br*dr,bi*dr
+    const __m256d tmp2 = _mm256_mul_pd(_mm256_permute_pd(x, 0x5), yh); // ai*ci,ar*ci,...
+
+    // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di
+    return _mm256_addsub_pd(tmp1, tmp2);
+}
+
+/* x * conj(y) of two complex doubles */
+static inline __m256d _mm256_complexconjugatemul_pd(__m256d x, __m256d y)
+{
+    const __m256d conjugator = _mm256_setr_pd(0, -0., 0, -0.);
+    const __m256d yl = _mm256_movedup_pd(y);
+    const __m256d yh = _mm256_xor_pd(_mm256_permute_pd(y, 0xF), conjugator);
+    const __m256d tmp1 = _mm256_mul_pd(x, yl);
+    const __m256d tmp2 = _mm256_mul_pd(_mm256_permute_pd(x, 0x5), yh);
+
+    // ar*cr+ai*ci, ai*cr-ar*ci, br*dr+bi*di, bi*dr-br*di
+    return _mm256_add_pd(tmp1, tmp2);
+}
+
+/* Scales the two complex doubles to unit magnitude */
+static inline __m256d _mm256_normalize_pd(__m256d val)
+{
+    const __m256d tmp1 = _mm256_mul_pd(val, val);
+    const __m256d mag = _mm256_sqrt_pd(_mm256_hadd_pd(tmp1, tmp1));
+    return _mm256_div_pd(val, mag);
+}
+
 static inline __m256 _mm256_magnitudesquared_ps(__m256 cplxValue1, __m256 cplxValue2)
 {
     __m256 complex1, complex2;
@@ -164,15 +207,13 @@ _mm256_polar_deinterleave(__m256* llr0, __m256* llr1, __m256 src0, __m256 src1)
     *llr1 = _mm256_shuffle_ps(part0, part1, 0xdd);
 }
 
-static inline __m256 _mm256_polar_minsum_llrs(__m256 src0, __m256 src1)
+/* The min-sum of llr0 and llr1, see llr_odd() */
+static inline __m256 _mm256_polar_minsum(__m256 llr0, __m256 llr1)
 {
     const __m256 sign_mask = _mm256_set1_ps(-0.0f);
     const __m256 abs_mask =
         _mm256_andnot_ps(sign_mask, _mm256_castsi256_ps(_mm256_set1_epi8(0xff)));
 
-    __m256 llr0, llr1;
-    _mm256_polar_deinterleave(&llr0, &llr1, src0, src1);
-
     // calculate result
     __m256 sign =
         _mm256_xor_ps(_mm256_and_ps(llr0, sign_mask), _mm256_and_ps(llr1, sign_mask));
@@ -181,6 +222,14 @@ static inline __m256 _mm256_polar_minsum_llrs(__m256 src0, __m256 src1)
     return _mm256_or_ps(dst, sign);
 }
 
+static inline __m256 _mm256_polar_minsum_llrs(__m256 src0, __m256 src1)
+{
+    __m256 llr0, llr1;
+    _mm256_polar_deinterleave(&llr0, &llr1, src0, src1);
+
+    return _mm256_polar_minsum(llr0, llr1);
+}
+
 static inline __m256 _mm256_polar_fsign_add_llrs(__m256 src0, __m256 src1, __m128i fbits)
 {
     // prepare sign mask for correct +-
@@ -195,4 +244,143 @@ static inline __m256 _mm256_polar_fsign_add_llrs(__m256 src0, __m256 src1, __m12
     return dst;
 }
 
+/* The radix-4 FFT pass of _mm_fft_radix4_pass_sse3, four points per step, h % 4 == 0 */
+static inline void _mm256_fft_radix4_pass_avx(float* data,
+                                              unsigned int num_points,
+                                              unsigned int h,
+                                              const float* twiddles)
+{
+    unsigned int block, j;
+    for (block = 0; block < num_points; block += 4 * h) {
+        float* x0 = data + 2 * block;
+        float* x1 = x0 + 2 * h;
+        float* x2 = x1 + 2 * h;
+        float* x3 = x2 + 2 * h;
+        for (j = 0; j < 2 * h; j += 8) {
+            const __m256 w1 = _mm256_loadu_ps(twiddles + 2 * h + j);
+            const __m256 w2 = _mm256_loadu_ps(twiddles + 4 * h + j);
+            const __m256 w3 = _mm256_loadu_ps(twiddles + 6 * h + j);
+            const __m256 a0 = _mm256_loadu_ps(x0 + j);
+            const __m256 a2 = _mm256_loadu_ps(x2 + j);
+            const __m256 t1 = _mm256_complexmul_ps(_mm256_loadu_ps(x1 + j), w1);
+            const __m256 t3 = _mm256_complexmul_ps(_mm256_loadu_ps(x3 + j), w1);
+
+            const __m256 y0 = _mm256_add_ps(a0, t1);
+            const __m256 y1 = _mm256_sub_ps(a0, t1);
+            const __m256 u2 = _mm256_complexmul_ps(_mm256_add_ps(a2, t3), w2);
+            const __m256 u3 = _mm256_complexmul_ps(_mm256_sub_ps(a2, t3), w3);
+            _mm256_storeu_ps(x0 + j, _mm256_add_ps(y0, u2));
+            _mm256_storeu_ps(x2 + j, _mm256_sub_ps(y0, u2));
+            _mm256_storeu_ps(x1 + j, _mm256_add_ps(y1, u3));
+            _mm256_storeu_ps(x3 + j, _mm256_sub_ps(y1, u3));
+        }
+    }
+}
+
+/* Transpose the 8x8 matrix of floats whose rows are the eight vectors, in place */
+static inline void _mm256_transpose8_ps(__m256* rows)
+{
+    const __m256 t0 = _mm256_unpacklo_ps(rows[0], rows[1]);
+    const __m256 t1 = _mm256_unpackhi_ps(rows[0], rows[1]);
+    const __m256 t2 = _mm256_unpacklo_ps(rows[2], rows[3]);
+    const __m256 t3 = _mm256_unpackhi_ps(rows[2], rows[3]);
+    const __m256 t4 = _mm256_unpacklo_ps(rows[4], rows[5]);
+    const __m256 t5 = _mm256_unpackhi_ps(rows[4], rows[5]);
+    const __m256 t6 = _mm256_unpacklo_ps(rows[6], rows[7]);
+    const __m256 t7 = _mm256_unpackhi_ps(rows[6], rows[7]);
+    // columns 0 1 4 5 of rows 0-3 and 4-7 in s0 s1 s4 s5, 2 3 6 7 in the others
+    const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+    rows[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    rows[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    rows[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    rows[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    rows[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    rows[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    rows[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    rows[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+/*
+ * Inclusive prefix sum of the eight floats: two shift and add steps within
+ * the 128-bit lanes, then the last sum of the lower lane added to the upper.
+ */
+static inline __m256 _mm256_scan_ps(__m256 x)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    x = _mm256_add_ps(
+        x, _mm256_blend_ps(_mm256_permute_ps(x, _MM_SHUFFLE(2, 1, 0, 3)), zero, 0x11));
+    x = _mm256_add_ps(
+        x, _mm256_blend_ps(_mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2)), zero, 0x33));
+    return _mm256_add_ps(
+        x, _mm256_permute2f128_ps(_mm256_permute_ps(x, 0xff), zero, 0x08));
+}
+
+/* Inclusive prefix sum of the four complex values */
+static inline __m256 _mm256_scan_complex_ps(__m256 x)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    x = _mm256_add_ps(
+        x, _mm256_blend_ps(_mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2)), zero, 0x33));
+    return _mm256_add_ps(
+        x, _mm256_permute2f128_ps(_mm256_permute_ps(x, 0xee), zero, 0x08));
+}
+
+/*
+ * Inclusive scan of the affine maps g -> a * g + b of the eight lanes, the
+ * eight wide _mm_scan_affine_ps: two steps within the 128-bit lanes, then
+ * the last map of the lower lane runs before the upper lane.
+ */
+static inline void _mm256_scan_affine_ps(__m256* a, __m256* b)
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 zero = _mm256_setzero_ps();
+    __m256 belowA, belowB;
+    belowA = _mm256_blend_ps(_mm256_permute_ps(*a, _MM_SHUFFLE(2, 1, 0, 3)), one, 0x11);
+    belowB = _mm256_blend_ps(_mm256_permute_ps(*b, _MM_SHUFFLE(2, 1, 0, 3)), zero, 0x11);
+    *b = _mm256_add_ps(_mm256_mul_ps(*a, belowB), *b);
+    *a = _mm256_mul_ps(*a, belowA);
+    belowA = _mm256_blend_ps(_mm256_permute_ps(*a, _MM_SHUFFLE(1, 0, 3, 2)), one, 0x33);
+    belowB = _mm256_blend_ps(_mm256_permute_ps(*b, _MM_SHUFFLE(1, 0, 3, 2)), zero, 0x33);
+    *b = _mm256_add_ps(_mm256_mul_ps(*a, belowB), *b);
+    *a = _mm256_mul_ps(*a, belowA);
+    belowA = _mm256_permute2f128_ps(_mm256_permute_ps(*a, 0xff), one, 0x02);
+    belowB = _mm256_permute2f128_ps(_mm256_permute_ps(*b, 0xff), zero, 0x02);
+    *b = _mm256_add_ps(_mm256_mul_ps(*a, belowB), *b);
+    *a = _mm256_mul_ps(*a, belowA);
+}
+
+/*
+ * Sorts each lane across the vectors v[0] to v[n - 1] into ascending order,
+ * n a power of two, with a bitonic network whose comparators all put the
+ * minimum first. Each lane sorts a set of its own.
+ */
+static inline void _mm256_sort_network_ps(__m256* v, unsigned int n)
+{
+    __m256 low;
+    unsigned int size, step, flip, base, i, j;
+
+    for (size = 2; size <= n; size *= 2) {
+        for (step = size / 2; step > 0; step /= 2) {
+            // the first step compares the halves of each block mirrored
+            flip = step == size / 2 ? size - 1 : step;
+            // i takes the lower index of each pair
+            for (base = 0; base < n; base += 2 * step) {
+                for (i = base; i < base + step; i++) {
+                    j = i ^ flip;
+                    low = _mm256_min_ps(v[i], v[j]);
+                    v[j] = _mm256_max_ps(v[i], v[j]);
+                    v[i] = low;
+                }
+            }
+        }
+    }
+}
+
 #endif /* INCLUDE_VOLK_VOLK_AVX_INTRINSICS_H_ */
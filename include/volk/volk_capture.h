@@ -0,0 +1,145 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * Capturing the call shapes of a production workload, for volk_profile
+ * --replay to rank the impls of each kernel by.
+ *
+ * While a capture runs, every dispatched call appends a record to a
+ * buffer allocated up front: the kernel, num_points, where each pointer
+ * argument lies within a 64 byte line, which of them alias the first
+ * one and whether the aligned impl was called, in the order of the
+ * calls. Calls past the size of the buffer are counted as dropped. A
+ * record is 12 bytes and costs an atomic add, so capturing a busy
+ * process for seconds is fine but not for hours.
+ *
+ * The trace file is a volk_capture_header_t, the n_kernels names of
+ * VOLK_CAPTURE_NAME_LEN bytes the records index into and the n_calls
+ * records. Capturing needs the kernel statistics to be built in, see
+ * volk_get_kernel_stats(); setting the VOLK_CAPTURE environment variable
+ * to a path captures from the first kernel call to the exit, with up to
+ * VOLK_CAPTURE_CALLS calls if that is set.
+ */
+
+#ifndef INCLUDED_VOLK_CAPTURE_H
+#define INCLUDED_VOLK_CAPTURE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <volk/volk_common.h>
+
+__VOLK_DECL_BEGIN
+
+//! "VOLKCAPT" in the first eight bytes of a trace
+#define VOLK_CAPTURE_MAGIC 0x545041434b4c4f56ull
+#define VOLK_CAPTURE_VERSION 1
+//! The length of a kernel name in a trace, with the terminating zero
+#define VOLK_CAPTURE_NAME_LEN 64
+//! The pointer arguments of a call whose offsets are recorded
+#define VOLK_CAPTURE_MAX_POINTERS 5
+//! The calls a capture holds unless told otherwise, 12 MB of records
+#define VOLK_CAPTURE_DEFAULT_CALLS (1u << 20)
+
+//! Flags of a record: it was written, rather than reserved by a call racing the stop
+#define VOLK_CAPTURE_CALL_VALID 1u
+//! Flags of a record: all pointers were aligned and the aligned impl was called
+#define VOLK_CAPTURE_CALL_ALIGNED 2u
+
+//! One dispatched call
+typedef struct volk_capture_call {
+    uint32_t num_points; //!< 0 for kernels without a length
+    uint32_t offsets;    //!< bits 6k to 6k + 5: pointer argument k's address mod 64
+    uint16_t kernel;     //!< the index of the kernel's name in the trace
+    uint8_t in_place;    //!< bit k - 1: pointer argument k is the same as the first
+    uint8_t flags;
+} volk_capture_call_t;
+
+//! The header of a trace, followed by the kernel names and the records
+typedef struct volk_capture_header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t n_kernels;
+    uint64_t n_calls;
+    uint64_t dropped;   //!< calls past the end of the buffer, not recorded
+    uint32_t alignment; //!< volk_get_alignment() of the capturing process
+    uint32_t call_size; //!< sizeof(volk_capture_call_t) of the capturing process
+    char machine[32];
+} volk_capture_header_t;
+
+//! The name of kernel k of a loaded trace
+static inline const char* volk_capture_kernel_name(const volk_capture_header_t* trace,
+                                                   size_t k)
+{
+    return (const char*)(trace + 1) + k * VOLK_CAPTURE_NAME_LEN;
+}
+
+//! The records of a loaded trace, in the order of the calls
+static inline const volk_capture_call_t*
+volk_capture_calls(const volk_capture_header_t* trace)
+{
+    return (const volk_capture_call_t*)volk_capture_kernel_name(trace, trace->n_kernels);
+}
+
+//! The offset in its 64 byte line of pointer argument k of a call
+static inline unsigned int volk_capture_offset(const volk_capture_call_t* call,
+                                               unsigned int k)
+{
+    return (call->offsets >> (6 * k)) & 63;
+}
+
+/*!
+ * \brief Start capturing the dispatched calls.
+ *
+ * \param path The trace file written by volk_capture_stop() or at exit.
+ * \param max_calls The calls to make room for, 0 for
+ * VOLK_CAPTURE_DEFAULT_CALLS.
+ * \return false if the statistics were not built in, a capture already
+ * runs or the buffer could not be allocated
+ */
+VOLK_API bool volk_capture_start(const char* path, size_t max_calls);
+
+/*!
+ * \brief Stop capturing and write the trace.
+ *
+ * Calls from other threads which are recording while the capture stops
+ * may be left out. The buffer is kept for the next capture.
+ *
+ * \return false if no capture ran or the trace could not be written
+ */
+VOLK_API bool volk_capture_stop(void);
+
+/*!
+ * \brief Read a trace written by volk_capture_stop().
+ *
+ * \return the trace, to be released with volk_capture_free(), or NULL if
+ * the file cannot be read or is no trace of this version and layout
+ */
+VOLK_API volk_capture_header_t* volk_capture_load(const char* path);
+
+//! Release a trace of volk_capture_load(), NULL is ignored
+VOLK_API void volk_capture_free(volk_capture_header_t* trace);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_CAPTURE_H */
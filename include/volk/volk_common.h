@@ -1,6 +1,11 @@
 #ifndef INCLUDED_LIBVOLK_COMMON_H
 #define INCLUDED_LIBVOLK_COMMON_H
 
+#ifdef VOLK_STATIC_INLINE
+// sets the LV_HAVE_* of the static target before the code below reads them
+#include <volk/volk_config_fixed.h>
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 // Cross-platform attribute macros
 ////////////////////////////////////////////////////////////////////////
@@ -8,6 +13,7 @@
 #define __VOLK_ATTR_ALIGNED(x) __declspec(align(x))
 #define __VOLK_ATTR_UNUSED
 #define __VOLK_ATTR_INLINE __forceinline
+#define __VOLK_ATTR_FLATTEN
 #define __VOLK_ATTR_DEPRECATED __declspec(deprecated)
 #define __VOLK_ATTR_EXPORT __declspec(dllexport)
 #define __VOLK_ATTR_IMPORT __declspec(dllimport)
@@ -21,6 +27,7 @@
 #define __VOLK_ATTR_ALIGNED(x) __attribute__((aligned(x)))
 #define __VOLK_ATTR_UNUSED __attribute__((unused))
 #define __VOLK_ATTR_INLINE __attribute__((always_inline))
+#define __VOLK_ATTR_FLATTEN __attribute__((flatten))
 #define __VOLK_ATTR_DEPRECATED __attribute__((deprecated))
 #define __VOLK_ASM __asm__
 #define __VOLK_VOLATILE __volatile__
@@ -31,6 +38,7 @@
 #define __VOLK_ATTR_ALIGNED(x) __attribute__((aligned(x)))
 #define __VOLK_ATTR_UNUSED __attribute__((unused))
 #define __VOLK_ATTR_INLINE __attribute__((always_inline))
+#define __VOLK_ATTR_FLATTEN __attribute__((flatten))
 #define __VOLK_ATTR_DEPRECATED __attribute__((deprecated))
 #define __VOLK_ASM __asm__
 #define __VOLK_VOLATILE __volatile__
@@ -46,6 +54,7 @@
 #define __VOLK_ATTR_ALIGNED(x) __declspec(align(x))
 #define __VOLK_ATTR_UNUSED
 #define __VOLK_ATTR_INLINE __forceinline
+#define __VOLK_ATTR_FLATTEN
 #define __VOLK_ATTR_DEPRECATED __declspec(deprecated)
 #define __VOLK_ATTR_EXPORT __declspec(dllexport)
 #define __VOLK_ATTR_IMPORT __declspec(dllimport)
@@ -56,6 +65,7 @@
 #define __VOLK_ATTR_ALIGNED(x)
 #define __VOLK_ATTR_UNUSED
 #define __VOLK_ATTR_INLINE
+#define __VOLK_ATTR_FLATTEN
 #define __VOLK_ATTR_DEPRECATED
 #define __VOLK_ATTR_EXPORT
 #define __VOLK_ATTR_IMPORT
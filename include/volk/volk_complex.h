@@ -65,7 +65,7 @@ inline T lv_conj(const T& x)
 
 typedef char complex lv_8sc_t;
 typedef short complex lv_16sc_t;
-typedef long complex lv_32sc_t;
+typedef int complex lv_32sc_t;
 typedef long long complex lv_64sc_t;
 typedef float complex lv_32fc_t;
 typedef double complex lv_64fc_t;
@@ -0,0 +1,220 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Shared parts of the Viterbi decoder kernels volk_8u_x4_conv_k*_r*_8u
+ * other than the K=7 rate 1/2 one, which keeps its own.
+ *
+ * A code of constraint length K has num_states = 2^(K-1) states. The
+ * encoder shifts each input bit into the low end of its state, so the new
+ * states 2i and 2i + 1 both come from the old states i and i + num_states / 2:
+ * the add-compare-select butterfly i, as BFLY() of volk_8u_x4_conv_k7_r2_8u.
+ * The branch table holds the rate expected symbols of the transitions from
+ * state i to 2i, Branchtab[j * num_states / 2 + i] for symbol j, as 0 or 255;
+ * the other three transitions of the butterfly expect the same symbols or
+ * their complements. The metrics are bytes which saturate, and are
+ * renormalised to a smallest metric of 0 whenever the metric of state 0
+ * passes 210. The decision vector of a step is num_states bits, bit n set
+ * when the new state n came from its predecessor in the upper half.
+ *
+ * The SIMD versions of the decoding loop are in the intrinsics headers and
+ * give the same metrics and decisions as volk_conv_decode_generic().
+ */
+
+#ifndef INCLUDED_VOLK_CONV_H
+#define INCLUDED_VOLK_CONV_H
+
+#include <string.h>
+#include <volk/volk_common.h>
+
+__VOLK_DECL_BEGIN
+
+#define VOLK_CONV_RENORMALIZE_THRESHOLD 210
+
+//! The prototype of the decoder kernels, see volk_8u_x4_conv_k9_r2_8u
+typedef void (*volk_conv_kernel_t)(unsigned char* Y,
+                                   unsigned char* X,
+                                   unsigned char* syms,
+                                   unsigned char* dec,
+                                   unsigned int framebits,
+                                   unsigned int excess,
+                                   unsigned char* Branchtab);
+
+/*
+ * The shift of each symbol difference before they are summed, for a sum
+ * of rate of them to fit a byte; rate is 2 to 4.
+ */
+static inline unsigned int volk_conv_metric_shift(unsigned int rate)
+{
+    return rate > 2 ? 2 : 1;
+}
+
+//! The largest branch metric of a rate 1/rate code
+static inline unsigned char volk_conv_max_metric(unsigned int rate)
+{
+    return (unsigned char)((rate * (255 >> volk_conv_metric_shift(rate))) >> 2);
+}
+
+/*
+ * Fill the branch table of a code whose rate generator polynomials
+ * polys[j] have bit 0 for the newest input bit.
+ */
+static inline void volk_conv_branchtab_init(unsigned char* Branchtab,
+                                            const unsigned int* polys,
+                                            unsigned int num_states,
+                                            unsigned int rate)
+{
+    unsigned int i, j, reg;
+    for (j = 0; j < rate; j++) {
+        for (i = 0; i < num_states / 2; i++) {
+            reg = (2 * i) & polys[j];
+            reg ^= reg >> 16;
+            reg ^= reg >> 8;
+            reg ^= reg >> 4;
+            reg ^= reg >> 2;
+            reg ^= reg >> 1;
+            Branchtab[j * num_states / 2 + i] = (reg & 1) ? 255 : 0;
+        }
+    }
+}
+
+static inline unsigned char volk_conv_adds(unsigned char a, unsigned char b)
+{
+    const unsigned int sum = (unsigned int)a + b;
+    return sum > 255 ? 255 : (unsigned char)sum;
+}
+
+// Butterfly i of the step with the symbols syms, as BFLY() of the K=7 kernel
+static inline void volk_conv_bfly(unsigned int i,
+                                  const unsigned char* syms,
+                                  unsigned char* Y,
+                                  const unsigned char* X,
+                                  unsigned char* d,
+                                  const unsigned char* Branchtab,
+                                  unsigned int num_states,
+                                  unsigned int rate)
+{
+    const unsigned int shift = volk_conv_metric_shift(rate);
+    const unsigned char max = volk_conv_max_metric(rate);
+    unsigned int j, decision0, decision1;
+    unsigned char metric = 0, m0, m1, m2, m3;
+
+    for (j = 0; j < rate; j++)
+        metric += (Branchtab[i + j * num_states / 2] ^ syms[j]) >> shift;
+    metric = metric >> 2;
+
+    m0 = volk_conv_adds(X[i], metric);
+    m1 = volk_conv_adds(X[i + num_states / 2], max - metric);
+    m2 = volk_conv_adds(X[i], max - metric);
+    m3 = volk_conv_adds(X[i + num_states / 2], metric);
+
+    decision0 = m1 <= m0;
+    decision1 = m3 <= m2;
+
+    Y[2 * i] = decision0 ? m1 : m0;
+    Y[2 * i + 1] = decision1 ? m3 : m2;
+
+    d[i / 4] |= (decision0 | decision1 << 1) << ((2 * i) & 7);
+}
+
+static inline void volk_conv_renormalize(unsigned char* X, unsigned int num_states)
+{
+    unsigned int i;
+    unsigned char min = X[0];
+
+    if (min <= VOLK_CONV_RENORMALIZE_THRESHOLD)
+        return;
+    for (i = 1; i < num_states; i++)
+        if (min > X[i])
+            min = X[i];
+    for (i = 0; i < num_states; i++)
+        X[i] -= min;
+}
+
+/*
+ * Run num_bits steps of the decoder, taking rate symbols per step from
+ * syms and writing num_states / 8 bytes of decisions per step to dec. The
+ * path metrics start in X and end in X, Y is scratch.
+ */
+static inline void volk_conv_decode_generic(unsigned char* Y,
+                                            unsigned char* X,
+                                            const unsigned char* syms,
+                                            unsigned char* dec,
+                                            unsigned int num_bits,
+                                            const unsigned char* Branchtab,
+                                            unsigned int num_states,
+                                            unsigned int rate)
+{
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    unsigned int s, i;
+
+    for (s = 0; s < num_bits; s++) {
+        memset(dec, 0, num_states / 8);
+        for (i = 0; i < num_states / 2; i++) {
+            volk_conv_bfly(
+                i, syms, new_metrics, old_metrics, dec, Branchtab, num_states, rate);
+        }
+        volk_conv_renormalize(new_metrics, num_states);
+
+        syms += rate;
+        dec += num_states / 8;
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (old_metrics != X)
+        memcpy(X, old_metrics, num_states);
+}
+
+/*
+ * Decode num_bits bits, one per byte, from the decisions of as many steps,
+ * starting from the state with the smallest of the final path metrics, the
+ * first one on ties.
+ */
+static inline void volk_conv_traceback_generic(unsigned char* data,
+                                               const unsigned char* dec,
+                                               const unsigned char* metrics,
+                                               unsigned int num_bits,
+                                               unsigned int num_states)
+{
+    unsigned int state = 0, high_bit = num_states / 2, i;
+    const unsigned char* d;
+
+    for (i = 1; i < num_states; i++) {
+        if (metrics[i] < metrics[state]) {
+            state = i;
+        }
+    }
+
+    while (num_bits-- > 0) {
+        d = dec + num_bits * (num_states / 8);
+        data[num_bits] = state & 1;
+        state = (state >> 1) | (((d[state >> 3] >> (state & 7)) & 1) ? high_bit : 0);
+    }
+}
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_CONV_H */
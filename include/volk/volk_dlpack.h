@@ -0,0 +1,99 @@
+/* -*- c -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Exchange of VOLK buffers with frameworks such as PyTorch, JAX or ONNX
+ * Runtime through DLPack, without copies; built with -DENABLE_DLPACK=ON,
+ * which needs dlpack/dlpack.h. An exported buffer becomes a 1-D tensor,
+ * or a 2-D one with a column per component for the complex integer types,
+ * which the frameworks lack; an imported tensor is a pointer VOLK kernels
+ * write into directly, e.g. the input tensor of a model.
+ *
+ * example code:
+ *   // hand a spectrum from volk_malloc to the framework, which frees it
+ *   float* power = (float*)volk_malloc(n * sizeof(float), volk_get_alignment());
+ *   volk_32fc_s32f_power_spectrum_32f(power, fft_out, 1.f, n);
+ *   DLManagedTensor* tensor = volk_dlpack_export(
+ *       power, n, (DLDataType){ kDLFloat, 32, 1 }, 1, volk_free, power);
+ *
+ *   // or write into a tensor the framework allocated
+ *   size_t n_values, alignment;
+ *   float* in = (float*)volk_dlpack_import(
+ *       &model_input->dl_tensor, (DLDataType){ kDLFloat, 32, 1 }, &n_values, &alignment);
+ */
+
+#ifndef INCLUDED_VOLK_DLPACK_H
+#define INCLUDED_VOLK_DLPACK_H
+
+#include <dlpack/dlpack.h>
+#include <stddef.h>
+#include <volk/volk_common.h>
+
+__VOLK_DECL_BEGIN
+
+/*!
+ * \brief Wrap n_items items of data as a DLPack tensor on the CPU.
+ *
+ * \details
+ * An item is n_components values of dtype: with 1 the tensor has the
+ * shape [n_items], otherwise [n_items, n_components], e.g. n_components 2
+ * with int16 for lv_16sc_t. The tensor's deleter, which the consumer calls
+ * once it is done, calls release(owner), e.g. volk_free on data itself or
+ * the delete of a C++ container; with a NULL release the caller keeps
+ * owning data and must keep it alive until then. The data pointer goes
+ * out unchanged with a byte_offset of 0, so consumers see the alignment of
+ * the buffer itself; those wanting 256 bytes get it from volk_malloc asked
+ * for that alignment.
+ *
+ * \return the tensor, or NULL if out of memory, in which case release is
+ * not called.
+ */
+VOLK_API DLManagedTensor* volk_dlpack_export(void* data,
+                                             size_t n_items,
+                                             DLDataType dtype,
+                                             size_t n_components,
+                                             void (*release)(void* owner),
+                                             void* owner);
+
+/*!
+ * \brief The data of a DLPack tensor, for use by VOLK kernels in place.
+ *
+ * \details
+ * The tensor must be in memory the CPU reads, i.e. on kDLCPU or
+ * kDLCUDAHost, C contiguous and of values of dtype; its owner keeps it.
+ *
+ * \param tensor The tensor, e.g. &managed->dl_tensor.
+ * \param dtype The value type the kernel takes.
+ * \param n_values Set to the number of values, the product of the shape.
+ * \param alignment If not NULL, set to the largest power of two up to 4096
+ * that the data is aligned to, the alignment volk_is_aligned() checks
+ * against being volk_get_alignment().
+ * \return the first value, NULL if the tensor cannot be used so.
+ */
+VOLK_API void* volk_dlpack_import(const DLTensor* tensor,
+                                  DLDataType dtype,
+                                  size_t* n_values,
+                                  size_t* alignment);
+
+__VOLK_DECL_END
+
+#endif /*INCLUDED_VOLK_DLPACK_H*/
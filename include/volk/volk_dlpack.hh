@@ -0,0 +1,122 @@
+/* -*- C++ -*- */
+/*
+ * Copyright 2019 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_DLPACK_HH
+#define INCLUDED_VOLK_DLPACK_HH
+
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include <volk/volk_alloc.hh>
+#include <volk/volk_complex.h>
+#include <volk/volk_dlpack.h>
+
+namespace volk {
+
+/*!
+ * \brief The DLPack value type of T and the values per element
+ *
+ * \details
+ * Complex integers, which DLPack lacks, are two integer values.
+ */
+template <class T>
+struct dlpack_type;
+
+#define VOLK_DLPACK_TYPE(T, CODE, BITS, COMPONENTS)                   \
+    template <>                                                       \
+    struct dlpack_type<T> {                                           \
+        static constexpr DLDataType dtype() { return { CODE, BITS, 1 }; } \
+        static constexpr std::size_t components = COMPONENTS;         \
+    }
+
+VOLK_DLPACK_TYPE(float, kDLFloat, 32, 1);
+VOLK_DLPACK_TYPE(double, kDLFloat, 64, 1);
+VOLK_DLPACK_TYPE(int8_t, kDLInt, 8, 1);
+VOLK_DLPACK_TYPE(int16_t, kDLInt, 16, 1);
+VOLK_DLPACK_TYPE(int32_t, kDLInt, 32, 1);
+VOLK_DLPACK_TYPE(int64_t, kDLInt, 64, 1);
+VOLK_DLPACK_TYPE(uint8_t, kDLUInt, 8, 1);
+VOLK_DLPACK_TYPE(uint16_t, kDLUInt, 16, 1);
+VOLK_DLPACK_TYPE(uint32_t, kDLUInt, 32, 1);
+VOLK_DLPACK_TYPE(uint64_t, kDLUInt, 64, 1);
+VOLK_DLPACK_TYPE(lv_32fc_t, kDLComplex, 64, 1);
+VOLK_DLPACK_TYPE(lv_64fc_t, kDLComplex, 128, 1);
+VOLK_DLPACK_TYPE(lv_8sc_t, kDLInt, 8, 2);
+VOLK_DLPACK_TYPE(lv_16sc_t, kDLInt, 16, 2);
+VOLK_DLPACK_TYPE(lv_32sc_t, kDLInt, 32, 2);
+
+#undef VOLK_DLPACK_TYPE
+
+/*!
+ * \brief Export a volk::vector as a DLPack tensor, without copying
+ *
+ * \details
+ * The storage moves into the tensor, which owns it until the consumer
+ * calls its deleter; v is left empty. Throws std::bad_alloc.
+ *
+ * example code:
+ *   volk::vector<float> spectrum(n);
+ *   volk_32fc_s32f_power_spectrum_32f(spectrum.data(), fft_out, 1.f, n);
+ *   DLManagedTensor* tensor = volk::to_dlpack(std::move(spectrum));
+ */
+template <class T, unsigned int Flags>
+DLManagedTensor* to_dlpack(vector<T, Flags>&& v)
+{
+    typedef vector<T, Flags> owner_t;
+    owner_t* owner = new owner_t(std::move(v));
+    DLManagedTensor* tensor =
+        volk_dlpack_export(owner->data(),
+                           owner->size(),
+                           dlpack_type<T>::dtype(),
+                           dlpack_type<T>::components,
+                           [](void* p) { delete static_cast<owner_t*>(p); },
+                           owner);
+    if (!tensor) {
+        delete owner;
+        throw std::bad_alloc();
+    }
+    return tensor;
+}
+
+/*!
+ * \brief The elements of a DLPack tensor, for VOLK kernels to use in place
+ *
+ * \details
+ * The tensor keeps owning them. Throws std::invalid_argument when the
+ * tensor is not contiguous in host memory or not of elements of T, as
+ * volk_dlpack_import() checks; volk_is_aligned() tells whether the data
+ * also suits an aligned_span.
+ */
+template <class T>
+span<T> from_dlpack(DLTensor const& tensor)
+{
+    std::size_t n_values;
+    void* data = volk_dlpack_import(&tensor, dlpack_type<T>::dtype(), &n_values, nullptr);
+    if (!data || n_values % dlpack_type<T>::components)
+        throw std::invalid_argument("volk::from_dlpack: tensor is not of this type");
+    return span<T>(static_cast<T*>(data), n_values / dlpack_type<T>::components);
+}
+
+} // namespace volk
+#endif // INCLUDED_VOLK_DLPACK_HH
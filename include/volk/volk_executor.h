@@ -0,0 +1,90 @@
+/* -*- c -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * By default the volk_parallel_ and volk_async_ kernels run on a pool of
+ * volk_set_num_threads() threads of VOLK's own. A host with a scheduler of
+ * its own, such as oneTBB or OpenMP, hands the chunks to it instead, so
+ * that the two do not oversubscribe the cores. VOLK still splits the
+ * vectors and merges the partial results; the executor only runs tasks.
+ */
+
+#ifndef INCLUDED_VOLK_EXECUTOR_H
+#define INCLUDED_VOLK_EXECUTOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <volk/volk_common.h>
+
+__VOLK_DECL_BEGIN
+
+//! A task of a submit, the task index runs from 0 to n_tasks - 1
+typedef void (*volk_task_fn)(void* arg, size_t task);
+
+/*!
+ * Start fn(arg, task) for every task below n_tasks and return a handle
+ * for the wait, which may be NULL. The tasks may run on any threads, in
+ * any order and at once, and may also all run before submit returns.
+ */
+typedef void* (*volk_executor_submit_fn)(void* ctx,
+                                         size_t n_tasks,
+                                         volk_task_fn fn,
+                                         void* arg);
+
+/*!
+ * Return once every task of the submit that returned handle has returned,
+ * and release the handle. The thread waiting may differ from the one that
+ * submitted, for a volk_async_ call.
+ */
+typedef void (*volk_executor_wait_fn)(void* ctx, void* handle);
+
+/*!
+ * Run the parallel kernels through submit and wait, called with ctx; NULL
+ * for submit returns to the internal pool. Its threads stop, and the
+ * cores are the host's. volk_set_num_threads() above 1 still caps the
+ * chunks of a call run at once, as do the thread counts of
+ * volk_profile --parallel-grain. Must not be called while a parallel or
+ * async kernel runs. Builds without thread support run every kernel on
+ * the calling thread.
+ */
+VOLK_API void volk_set_executor(volk_executor_submit_fn submit,
+                                volk_executor_wait_fn wait,
+                                void* ctx);
+
+/*!
+ * Run fn(arg, task) for every task below n_tasks on the executor, or on the
+ * internal pool and the calling thread, and return once all have returned.
+ * Tasks may wait on one another only if any one of them can finish the
+ * work alone: with a single thread they run one after the other. They
+ * must not call the parallel or async kernels.
+ */
+VOLK_API void volk_run_tasks(size_t n_tasks, volk_task_fn fn, void* arg);
+
+//! Run the parallel kernels on OpenMP; false if built without -DENABLE_OPENMP_EXECUTOR=ON
+VOLK_API bool volk_use_openmp_executor(void);
+
+//! Run the parallel kernels on oneTBB; false if built without -DENABLE_TBB_EXECUTOR=ON
+VOLK_API bool volk_use_tbb_executor(void);
+
+__VOLK_DECL_END
+
+#endif /*INCLUDED_VOLK_EXECUTOR_H*/
@@ -0,0 +1,136 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Shared parts of the volk_32fc_fft_32fc and volk_32fc_ifft_32fc kernels.
+ *
+ * The transforms are decimation in time: the input is copied to the
+ * output in bit reversed order, then every stage combines pairs of
+ * half length transforms in place. Two stages at a time are fused into
+ * a radix-4 pass, which loads and stores the data once per two stages;
+ * a log2 length that is odd starts with one radix-2 stage. The SIMD
+ * versions of the radix-4 pass are in the intrinsics headers.
+ */
+
+#ifndef INCLUDED_VOLK_FFT_H
+#define INCLUDED_VOLK_FFT_H
+
+#include <stdbool.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+__VOLK_DECL_BEGIN
+
+/*!
+ * \brief Get the twiddle factors of a power of two transform length.
+ *
+ * \details
+ * Entry h + j is exp(-i pi j / h) for the stage combining transforms of
+ * length h, with h = 1, 2, 4 ... num_points / 2 and 0 <= j < h; the
+ * inverse table holds the conjugates. Each table is computed in double
+ * precision on first use and kept for the life of the process, so
+ * repeated transforms of one length share it between calls and threads.
+ * Where a warm-start cache dir exists, see volk_get_cache_path(), tables
+ * of 4096 points and more are stored there and later processes map them
+ * instead. The table is aligned to volk_get_alignment().
+ *
+ * \param num_points The transform length, a power of two.
+ * \param inverse Get the table of the inverse transform.
+ * \return The table of num_points entries, NULL if num_points is not a
+ * power of two or out of memory.
+ */
+VOLK_API const lv_32fc_t* volk_fft_get_twiddles(unsigned int num_points, bool inverse);
+
+/*
+ * Copy input to output in bit reversed order and run the radix-2 stage
+ * of a length whose log2 is odd. Returns the half length h of the first
+ * radix-4 pass; the passes follow for h, 4h, 16h ... while 4h <= num_points.
+ */
+static inline unsigned int volk_fft_first_stages(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 unsigned int num_points)
+{
+    unsigned int i, reversed = 0, log2_points = 0;
+    for (i = 0; i < num_points; i++) {
+        output[reversed] = input[i];
+        // add one to the reversed index, carrying from the top bit down
+        unsigned int bit = num_points >> 1;
+        while (reversed & bit) {
+            reversed ^= bit;
+            bit >>= 1;
+        }
+        reversed |= bit;
+    }
+
+    while ((2u << log2_points) <= num_points)
+        log2_points++;
+    if ((log2_points & 1) == 0)
+        return 1;
+
+    // the twiddle factor of the length 2 transforms is 1
+    for (i = 0; i < num_points; i += 2) {
+        const lv_32fc_t a = output[i];
+        const lv_32fc_t b = output[i + 1];
+        output[i] = a + b;
+        output[i + 1] = a - b;
+    }
+    return 2;
+}
+
+/*
+ * The stages combining transforms of length h and then 2h, in place on
+ * blocks of 4h points. Element j of the four length h transforms of a
+ * block is at j, j + h, j + 2h and j + 3h.
+ */
+static inline void volk_fft_radix4_pass_generic(lv_32fc_t* data,
+                                                unsigned int num_points,
+                                                unsigned int h,
+                                                const lv_32fc_t* twiddles)
+{
+    unsigned int block, j;
+    for (block = 0; block < num_points; block += 4 * h) {
+        lv_32fc_t* x = data + block;
+        for (j = 0; j < h; j++) {
+            const lv_32fc_t w1 = twiddles[h + j];
+            const lv_32fc_t w2 = twiddles[2 * h + j];
+            const lv_32fc_t w3 = twiddles[3 * h + j];
+
+            const lv_32fc_t t1 = x[j + h] * w1;
+            const lv_32fc_t t3 = x[j + 3 * h] * w1;
+            const lv_32fc_t y0 = x[j] + t1;
+            const lv_32fc_t y1 = x[j] - t1;
+            const lv_32fc_t y2 = x[j + 2 * h] + t3;
+            const lv_32fc_t y3 = x[j + 2 * h] - t3;
+
+            const lv_32fc_t u2 = y2 * w2;
+            const lv_32fc_t u3 = y3 * w3;
+            x[j] = y0 + u2;
+            x[j + 2 * h] = y0 - u2;
+            x[j + h] = y1 + u3;
+            x[j + 3 * h] = y1 - u3;
+        }
+    }
+}
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_FFT_H */
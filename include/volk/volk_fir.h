@@ -0,0 +1,360 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Streaming FIR filters on top of the volk_32f_fir_32f,
+ * volk_32fc_32f_fir_32fc and volk_32fc_x2_fir_32fc kernels.
+ *
+ * The caller owns the state structs, e.g. as members of a signal
+ * processing block; init allocates the tap copy and the delay line they
+ * point to and destroy releases them. Each filter call produces one
+ * output per input and keeps the last num_taps - 1 inputs for the next
+ * call. Only the first num_taps - 1 outputs of a call are computed from
+ * the delay line; the rest are computed from the caller's input in place,
+ * without copying it. A state must not be used by two threads at once.
+ *
+ * The decimating, interpolating and resampling filters of complex samples
+ * with real taps work the same way on top of the polyphase kernels
+ * volk_32fc_32f_fir_decimate_32fc, volk_32fc_32f_fir_interpolate_32fc and
+ * volk_32fc_32f_fir_resample_32fc, computing only the outputs they keep.
+ * The fractional resampler keeps three inputs for the cubic interpolator
+ * of volk_32fc_s64f_x2_farrow_resample_32fc.
+ *
+ * A halfband cascade decimates by a power of two with one
+ * volk_32fc_32f_halfband_decimate2_32fc stage per factor of two. Each
+ * call is cut into blocks which pass through all the stages before the
+ * next one is read, so the intermediate samples stay in cache.
+ */
+
+#ifndef INCLUDED_VOLK_FIR_H
+#define INCLUDED_VOLK_FIR_H
+
+#include <stdbool.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+__VOLK_DECL_BEGIN
+
+//! A real filter of real samples, see volk_fir_32f_init()
+typedef struct volk_fir_32f {
+    float* taps;    //!< time reversed copy of the taps, as the kernel takes them
+    float* history; //!< the last num_taps - 1 inputs, then room for as many more
+    unsigned int num_taps;
+} volk_fir_32f_t;
+
+//! A real or complex filter of complex samples, see volk_fir_32fc_init()
+typedef struct volk_fir_32fc {
+    float* taps;             //!< time reversed real taps, NULL for complex ones
+    lv_32fc_t* complex_taps; //!< time reversed complex taps, NULL for real ones
+    lv_32fc_t* history;      //!< the last num_taps - 1 inputs, then room for as many more
+    unsigned int num_taps;
+} volk_fir_32fc_t;
+
+/*!
+ * \brief Set up a filter with the given taps and a zeroed delay line.
+ *
+ * \param fir The state to initialise, owned by the caller.
+ * \param taps The impulse response, taps[0] applies to the newest input.
+ * \param num_taps The number of taps, at least 1.
+ * \return false if num_taps is 0 or out of memory, fir is then unchanged.
+ */
+VOLK_API bool
+volk_fir_32f_init(volk_fir_32f_t* fir, const float* taps, unsigned int num_taps);
+
+/*!
+ * \brief Filter num_points inputs into num_points outputs.
+ *
+ * output[i] = sum of taps[k] * x[i - k], where x continues the inputs of
+ * the earlier calls. output and input must not overlap.
+ */
+VOLK_API void volk_fir_32f_filter(volk_fir_32f_t* fir,
+                                  float* output,
+                                  const float* input,
+                                  unsigned int num_points);
+
+//! Zero the delay line, as after volk_fir_32f_init()
+VOLK_API void volk_fir_32f_reset(volk_fir_32f_t* fir);
+
+//! Release the taps and delay line of the filter
+VOLK_API void volk_fir_32f_destroy(volk_fir_32f_t* fir);
+
+//! Set up a filter of complex samples with real taps, as volk_fir_32f_init()
+VOLK_API bool
+volk_fir_32fc_init(volk_fir_32fc_t* fir, const float* taps, unsigned int num_taps);
+
+//! Set up a filter of complex samples with complex taps, as volk_fir_32f_init()
+VOLK_API bool volk_fir_32fc_init_complex(volk_fir_32fc_t* fir,
+                                         const lv_32fc_t* taps,
+                                         unsigned int num_taps);
+
+//! Filter num_points complex inputs, as volk_fir_32f_filter()
+VOLK_API void volk_fir_32fc_filter(volk_fir_32fc_t* fir,
+                                   lv_32fc_t* output,
+                                   const lv_32fc_t* input,
+                                   unsigned int num_points);
+
+//! Zero the delay line, as after volk_fir_32fc_init()
+VOLK_API void volk_fir_32fc_reset(volk_fir_32fc_t* fir);
+
+//! Release the taps and delay line of the filter
+VOLK_API void volk_fir_32fc_destroy(volk_fir_32fc_t* fir);
+
+//! A decimating filter of complex samples with real taps
+typedef struct volk_fir_decimator_32fc {
+    float* taps;        //!< time reversed copy of the taps, as the kernel takes them
+    lv_32fc_t* history; //!< the last num_taps - 1 inputs, then room for as many more
+    unsigned int num_taps;
+    unsigned int decimation;
+    unsigned int offset; //!< where the next output's window starts in the history
+} volk_fir_decimator_32fc_t;
+
+//! An interpolating filter of complex samples with real taps
+typedef struct volk_fir_interpolator_32fc {
+    float* taps;        //!< the phases of the filter, each time reversed
+    lv_32fc_t* history; //!< the last taps_per_phase - 1 inputs, then as many more
+    unsigned int taps_per_phase;
+    unsigned int interpolation;
+} volk_fir_interpolator_32fc_t;
+
+//! A rational resampler of complex samples with real taps
+typedef struct volk_fir_resampler_32fc {
+    float* taps;        //!< the phases of the filter, each time reversed
+    lv_32fc_t* history; //!< the last taps_per_phase - 1 inputs, then as many more
+    unsigned int taps_per_phase;
+    unsigned int interpolation;
+    unsigned int decimation;
+    unsigned int offset; //!< where the next output's window starts, in phases
+} volk_fir_resampler_32fc_t;
+
+//! One stage of a halfband cascade, see volk_halfband_cascade_32fc_init()
+typedef struct volk_halfband_stage_32fc {
+    float* taps;        //!< the outer taps, then the center tap, as the kernel takes them
+    lv_32fc_t* history; //!< the last 4 * num_taps - 2 inputs, then as many more
+    unsigned int num_taps;
+    unsigned int offset; //!< where the next output's window starts in the history
+} volk_halfband_stage_32fc_t;
+
+//! A cascade of halfband filters of complex samples, each decimating by 2
+typedef struct volk_halfband_cascade_32fc {
+    volk_halfband_stage_32fc_t* stages;
+    lv_32fc_t* scratch; //!< two blocks of outputs between the stages
+    unsigned int num_stages;
+} volk_halfband_cascade_32fc_t;
+
+//! A fractional resampler of complex samples with a cubic interpolator
+typedef struct volk_farrow_resampler_32fc {
+    lv_32fc_t* history; //!< the last 3 inputs, then as many more
+    double step;        //!< inputs per output
+    double offset;      //!< where the next output's window starts, in inputs
+} volk_farrow_resampler_32fc_t;
+
+/*!
+ * \brief Set up a filter which keeps every decimation-th output.
+ *
+ * The first output of the first call is the one for the first input, then
+ * every decimation-th input gives one, across calls.
+ *
+ * \param fir The state to initialise, owned by the caller.
+ * \param taps The impulse response, taps[0] applies to the newest input.
+ * \param num_taps The number of taps, at least 1.
+ * \param decimation The number of inputs per output, at least 1.
+ * \return false if num_taps or decimation is 0 or out of memory, fir is then
+ * unchanged.
+ */
+VOLK_API bool volk_fir_decimator_32fc_init(volk_fir_decimator_32fc_t* fir,
+                                           const float* taps,
+                                           unsigned int num_taps,
+                                           unsigned int decimation);
+
+/*!
+ * \brief Filter num_points inputs, keeping every decimation-th output.
+ *
+ * output needs room for num_points / decimation + 1 samples and must not
+ * overlap input.
+ *
+ * \return The number of outputs written.
+ */
+VOLK_API unsigned int volk_fir_decimator_32fc_filter(volk_fir_decimator_32fc_t* fir,
+                                                     lv_32fc_t* output,
+                                                     const lv_32fc_t* input,
+                                                     unsigned int num_points);
+
+//! Zero the delay line and restart the decimation, as after init
+VOLK_API void volk_fir_decimator_32fc_reset(volk_fir_decimator_32fc_t* fir);
+
+//! Release the taps and delay line of the filter
+VOLK_API void volk_fir_decimator_32fc_destroy(volk_fir_decimator_32fc_t* fir);
+
+/*!
+ * \brief Set up a filter which upsamples by interpolation.
+ *
+ * The taps are a prototype filter at the output rate, split into
+ * interpolation phases of num_taps / interpolation taps, rounded up.
+ *
+ * \param fir The state to initialise, owned by the caller.
+ * \param taps The impulse response, taps[0] applies to the newest input.
+ * \param num_taps The number of taps, at least 1.
+ * \param interpolation The number of outputs per input, at least 1.
+ * \return false if num_taps or interpolation is 0 or out of memory, fir is
+ * then unchanged.
+ */
+VOLK_API bool volk_fir_interpolator_32fc_init(volk_fir_interpolator_32fc_t* fir,
+                                              const float* taps,
+                                              unsigned int num_taps,
+                                              unsigned int interpolation);
+
+/*!
+ * \brief Filter num_points inputs into num_points * interpolation outputs.
+ *
+ * The output is the input with interpolation - 1 zeros after every sample,
+ * filtered by the prototype. output and input must not overlap.
+ */
+VOLK_API void volk_fir_interpolator_32fc_filter(volk_fir_interpolator_32fc_t* fir,
+                                                lv_32fc_t* output,
+                                                const lv_32fc_t* input,
+                                                unsigned int num_points);
+
+//! Zero the delay line, as after volk_fir_interpolator_32fc_init()
+VOLK_API void volk_fir_interpolator_32fc_reset(volk_fir_interpolator_32fc_t* fir);
+
+//! Release the taps and delay line of the filter
+VOLK_API void volk_fir_interpolator_32fc_destroy(volk_fir_interpolator_32fc_t* fir);
+
+/*!
+ * \brief Set up a filter which resamples by interpolation / decimation.
+ *
+ * The taps are a prototype filter at interpolation times the input rate,
+ * split into interpolation phases as by volk_fir_interpolator_32fc_init().
+ * Of the outputs of that interpolator, every decimation-th is computed,
+ * the first one of the first call and on across calls. Fractions in
+ * lowest terms keep the bank small.
+ *
+ * \param fir The state to initialise, owned by the caller.
+ * \param taps The impulse response, taps[0] applies to the newest input.
+ * \param num_taps The number of taps, at least 1.
+ * \param interpolation The number of phases, at least 1.
+ * \param decimation The number of phases per output, at least 1.
+ * \return false if num_taps, interpolation or decimation is 0 or out of
+ * memory, fir is then unchanged.
+ */
+VOLK_API bool volk_fir_resampler_32fc_init(volk_fir_resampler_32fc_t* fir,
+                                           const float* taps,
+                                           unsigned int num_taps,
+                                           unsigned int interpolation,
+                                           unsigned int decimation);
+
+/*!
+ * \brief Resample num_points inputs.
+ *
+ * output needs room for num_points * interpolation / decimation + 1
+ * samples and must not overlap input.
+ *
+ * \return The number of outputs written.
+ */
+VOLK_API unsigned int volk_fir_resampler_32fc_filter(volk_fir_resampler_32fc_t* fir,
+                                                     lv_32fc_t* output,
+                                                     const lv_32fc_t* input,
+                                                     unsigned int num_points);
+
+//! Zero the delay line and restart at the first phase, as after init
+VOLK_API void volk_fir_resampler_32fc_reset(volk_fir_resampler_32fc_t* fir);
+
+//! Release the taps and delay line of the filter
+VOLK_API void volk_fir_resampler_32fc_destroy(volk_fir_resampler_32fc_t* fir);
+
+/*!
+ * \brief Set up a cascade of halfband filters which decimates by 2^num_stages.
+ *
+ * Stage s filters the outputs of stage s - 1 with a halfband filter of
+ * 4 * num_taps[s] - 1 taps, given as to volk_32fc_32f_halfband_decimate2_32fc.
+ * Every stage keeps the output for its first input, then every second one,
+ * across calls.
+ *
+ * \param cascade The state to initialise, owned by the caller.
+ * \param taps For each stage, its num_taps[s] outer taps, then its center tap.
+ * \param num_taps For each stage, the number of outer taps, at least 1.
+ * \param num_stages The number of stages, at least 1.
+ * \return false if num_stages or a num_taps is 0 or out of memory, cascade is
+ * then unchanged.
+ */
+VOLK_API bool volk_halfband_cascade_32fc_init(volk_halfband_cascade_32fc_t* cascade,
+                                              const float* const* taps,
+                                              const unsigned int* num_taps,
+                                              unsigned int num_stages);
+
+/*!
+ * \brief Decimate num_points inputs through all the stages.
+ *
+ * output needs room for num_points / 2^num_stages + 1 samples and must not
+ * overlap input.
+ *
+ * \return The number of outputs written.
+ */
+VOLK_API unsigned int
+volk_halfband_cascade_32fc_filter(volk_halfband_cascade_32fc_t* cascade,
+                                  lv_32fc_t* output,
+                                  const lv_32fc_t* input,
+                                  unsigned int num_points);
+
+//! Zero the delay lines and restart the decimation, as after init
+VOLK_API void volk_halfband_cascade_32fc_reset(volk_halfband_cascade_32fc_t* cascade);
+
+//! Release the taps and delay lines of the stages
+VOLK_API void volk_halfband_cascade_32fc_destroy(volk_halfband_cascade_32fc_t* cascade);
+
+/*!
+ * \brief Set up a resampler at any ratio with a zeroed delay line.
+ *
+ * The outputs are step inputs apart, the first one on the first input of
+ * the delay line, so the resampled stream lags the input by two samples.
+ *
+ * \param fir The state to initialise, owned by the caller.
+ * \param step The inputs per output, the input rate over the output rate.
+ * \return false if step is not positive or out of memory, fir is then
+ * unchanged.
+ */
+VOLK_API bool volk_farrow_resampler_32fc_init(volk_farrow_resampler_32fc_t* fir,
+                                              double step);
+
+/*!
+ * \brief Resample num_points inputs.
+ *
+ * output needs room for num_points / step + 1 samples, rounded up, and must
+ * not overlap input. fir->step may be changed between calls, e.g. by a
+ * clock recovery loop.
+ *
+ * \return The number of outputs written.
+ */
+VOLK_API unsigned int volk_farrow_resampler_32fc_filter(volk_farrow_resampler_32fc_t* fir,
+                                                        lv_32fc_t* output,
+                                                        const lv_32fc_t* input,
+                                                        unsigned int num_points);
+
+//! Zero the delay line and restart on its first input, as after init
+VOLK_API void volk_farrow_resampler_32fc_reset(volk_farrow_resampler_32fc_t* fir);
+
+//! Release the delay line of the resampler
+VOLK_API void volk_farrow_resampler_32fc_destroy(volk_farrow_resampler_32fc_t* fir);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_FIR_H */
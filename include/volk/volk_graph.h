@@ -0,0 +1,126 @@
+/* -*- c -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Chains of kernels over tiles of a long vector, run on the
+ * volk_set_num_threads() pool.
+ *
+ * A graph is a list of nodes, typically each calling a planned kernel, and
+ * of per thread buffers for the intermediate results between them. A run
+ * cuts the vector into tiles sized so that a tile of every buffer and of
+ * the caller's vectors fits in half the L2 cache, and each tile goes
+ * through all the nodes, in the order they were added, on one thread, so
+ * the intermediates never leave that core's cache. The threads start on
+ * equal shares of the tiles and steal half of the remaining share of
+ * another thread when theirs runs out.
+ *
+ * Nodes run concurrently on different tiles and in no particular tile
+ * order, so a node must only touch the points of its tile. Stateful
+ * kernels such as the rotator must start each tile from its own state,
+ * e.g. a phase derived from the tile's start. Nodes must not call the
+ * volk_parallel_ kernels or run another graph, and plans of fused kernels,
+ * which own their scratch, must not be shared between the threads. A
+ * graph must not be changed or run by two threads at once.
+ *
+ * example code:
+ *   // convert -> rotate -> magnitude into the caller's vector
+ *   volk_graph_t* graph = volk_graph_create();
+ *   volk_graph_add_buffer(graph, sizeof(lv_32fc_t));
+ *   volk_graph_add_node(graph, convert_tile, &state, 2 * sizeof(int16_t));
+ *   volk_graph_add_node(graph, rotate_tile, &state, 0);
+ *   volk_graph_add_node(graph, magnitude_tile, &state, sizeof(float));
+ *   volk_graph_run(graph, num_points);
+ */
+
+#ifndef INCLUDED_VOLK_GRAPH_H
+#define INCLUDED_VOLK_GRAPH_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+
+__VOLK_DECL_BEGIN
+
+//! A chain of nodes run tile by tile over the pool, see volk_graph_create()
+typedef struct volk_graph volk_graph_t;
+
+/*!
+ * \brief A node, run on the points [start, start + count) of a tile.
+ *
+ * \param ctx The context given to volk_graph_add_node().
+ * \param buffers The calling thread's graph buffers for this tile, in the
+ * order they were added; element 0 of each is point start. They keep their
+ * contents between the nodes of a tile, but not between tiles.
+ * \param start The first point of the tile.
+ * \param count The points in the tile, at most volk_graph_get_tile_len().
+ */
+typedef void (*volk_graph_node_fn)(void* ctx,
+                                   void* const* buffers,
+                                   size_t start,
+                                   size_t count);
+
+//! Make an empty graph, NULL if out of memory
+VOLK_API volk_graph_t* volk_graph_create(void);
+
+//! Release a graph and its buffers, NULL is ignored
+VOLK_API void volk_graph_destroy(volk_graph_t* graph);
+
+/*!
+ * \brief Add a per thread buffer of bytes_per_point bytes for each point of a tile.
+ *
+ * Each buffer is aligned to volk_get_alignment().
+ * \return the buffer's index in the nodes' buffers, -1 if out of memory
+ */
+VOLK_API int volk_graph_add_buffer(volk_graph_t* graph, size_t bytes_per_point);
+
+/*!
+ * \brief Add a node which runs after the nodes already added.
+ *
+ * \param io_bytes_per_point The bytes per point the node reads and writes
+ * in the caller's vectors, for the tile size; the graph buffers are counted
+ * already.
+ * \return the node's index, -1 if out of memory
+ */
+VOLK_API int volk_graph_add_node(volk_graph_t* graph,
+                                 volk_graph_node_fn fn,
+                                 void* ctx,
+                                 size_t io_bytes_per_point);
+
+/*!
+ * \brief Set the points per tile, 0 to size tiles from the L2 cache again.
+ *
+ * The length is rounded up to keep every tile but the last aligned.
+ */
+VOLK_API void volk_graph_set_tile_len(volk_graph_t* graph, size_t tile_len);
+
+//! The points per tile a run uses
+VOLK_API size_t volk_graph_get_tile_len(const volk_graph_t* graph);
+
+/*!
+ * \brief Run every node over the points [0, num_points) and wait for them.
+ *
+ * \return 0, or -1 if out of memory for the buffers, with no node run
+ */
+VOLK_API int volk_graph_run(volk_graph_t* graph, size_t num_points);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_GRAPH_H */
@@ -0,0 +1,116 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Scalar conversions between float and the 16-bit floating point formats of
+ * the volk_*_convert_16f and volk_*_convert_16bf kernels, which keep the
+ * values as their uint16_t bit patterns:
+ *
+ * - half is IEEE 754 binary16, 5 exponent and 10 mantissa bits, the format
+ *   of the x86 F16C and the ARM fcvt instructions;
+ * - bfloat16 is the upper half of a float, 8 exponent and 7 mantissa bits.
+ *
+ * Both narrowing conversions round to nearest even, overflow to infinity
+ * and quiet NaNs, as the hardware does in its default rounding mode. The
+ * SIMD kernels give the same bits.
+ */
+
+#ifndef INCLUDED_VOLK_HALF_H
+#define INCLUDED_VOLK_HALF_H
+
+#include <stdint.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+__VOLK_DECL_BEGIN
+
+static inline uint32_t volk_float_bits(float f)
+{
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    return x;
+}
+
+static inline float volk_bits_float(uint32_t x)
+{
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+static inline uint16_t volk_float_to_half(float f)
+{
+    const uint32_t x = volk_float_bits(f);
+    const uint16_t sign = (x >> 16) & 0x8000;
+    uint32_t abs = x & 0x7fffffff;
+    uint32_t mant, shift, half, rem;
+
+    if (abs > 0x7f800000) // NaN, quieted, with the top of its payload
+        return sign | 0x7e00 | ((abs >> 13) & 0x3ff);
+    if (abs >= 0x477ff000) // 65520 and above round to infinity
+        return sign | 0x7c00;
+    if (abs >= 0x38800000) { // normal, 2^-14 and above
+        abs += 0xfff + ((abs >> 13) & 1);
+        return sign | ((abs - 0x38000000) >> 13);
+    }
+    if (abs < 0x33000000) // 2^-25 and below round to zero
+        return sign;
+    // subnormal, in units of 2^-24
+    mant = (abs & 0x7fffff) | 0x800000;
+    shift = 126 - (abs >> 23);
+    half = 1u << (shift - 1);
+    rem = mant & ((half << 1) - 1);
+    mant >>= shift;
+    if (rem > half || (rem == half && (mant & 1)))
+        mant++;
+    return sign | mant;
+}
+
+static inline float volk_half_to_float(uint16_t h)
+{
+    const uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    const uint32_t exponent = (h >> 10) & 0x1f;
+    const uint32_t mant = h & 0x3ff;
+
+    if (exponent == 0x1f)
+        return volk_bits_float(sign | 0x7f800000 | (mant << 13) | (mant ? 0x400000 : 0));
+    if (exponent == 0) // zero or subnormal, exact in a float
+        return volk_bits_float(sign | volk_float_bits((float)mant * (1.f / 16777216.f)));
+    return volk_bits_float(sign | ((exponent + 112) << 23) | (mant << 13));
+}
+
+static inline uint16_t volk_float_to_bfloat16(float f)
+{
+    const uint32_t x = volk_float_bits(f);
+    if ((x & 0x7fffffff) > 0x7f800000)
+        return (x >> 16) | 0x40;
+    return (x + 0x7fff + ((x >> 16) & 1)) >> 16;
+}
+
+static inline float volk_bfloat16_to_float(uint16_t b)
+{
+    return volk_bits_float((uint32_t)b << 16);
+}
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_HALF_H */
@@ -23,6 +23,7 @@
 #ifndef INCLUDED_VOLK_MALLOC_H
 #define INCLUDED_VOLK_MALLOC_H
 
+#include <stdbool.h>
 #include <stdlib.h>
 #include <volk/volk_common.h>
 
@@ -70,6 +71,162 @@ VOLK_API void* volk_malloc(size_t size, size_t alignment);
  */
 VOLK_API void volk_free(void* aptr);
 
+/*! \brief Back the block with transparent huge pages (madvise MADV_HUGEPAGE). */
+#define VOLK_MALLOC_HUGEPAGES (1u << 0)
+/*! \brief Back the block with explicit huge pages (MAP_HUGETLB), falling back to
+ * transparent ones when the huge page pool is exhausted. */
+#define VOLK_MALLOC_HUGETLB (1u << 1)
+/*! \brief Prefer the NUMA node of the cpu the calling thread runs on. */
+#define VOLK_MALLOC_NUMA_LOCAL (1u << 2)
+/*! \brief Touch every page from the calling thread before returning. */
+#define VOLK_MALLOC_PREFAULT (1u << 3)
+/*! \brief Prefer the given NUMA node, 0 to 65534. */
+#define VOLK_MALLOC_NUMA_NODE(node) ((((unsigned int)(node) + 1u) & 0xffffu) << 16)
+#define VOLK_MALLOC_NUMA_NODE_MASK 0xffff0000u
+/*! \brief Raise the alignment to volk_get_preferred_alignment(), so that blocks
+ * carved at multiples of it do not share cache lines. Needs no mapping. */
+#define VOLK_MALLOC_PREFERRED_ALIGNMENT (1u << 4)
+/*! \brief Interleave the pages over all NUMA nodes, for buffers every node's
+ * threads use alike. Takes precedence over the other NUMA flags. */
+#define VOLK_MALLOC_NUMA_INTERLEAVE (1u << 5)
+
+/*!
+ * \brief Allocate \p size bytes aligned to \p alignment with placement options.
+ *
+ * \details
+ * \p flags is an OR of the VOLK_MALLOC_* flags above. With any of them but
+ * VOLK_MALLOC_PREFERRED_ALIGNMENT set the block gets an anonymous mapping of
+ * its own, which suits large, long lived buffers; huge pages cut the TLB
+ * misses when streaming through them and the NUMA flags keep them on the
+ * node of the threads using them. Options the platform lacks are ignored.
+ * Without mmap, or without such flags, the block comes from the heap like
+ * volk_malloc.
+ *
+ * Blocks must be freed with volk_free_ex, not volk_free.
+ *
+ * \param size The number of bytes to allocate.
+ * \param alignment The byte alignment of the allocated memory.
+ * \param flags VOLK_MALLOC_* placement flags.
+ * \return pointer to aligned memory, NULL on failure.
+ */
+VOLK_API void* volk_malloc_ex(size_t size, size_t alignment, unsigned int flags);
+
+/*!
+ * \brief Free memory allocated by volk_malloc_ex.
+ *
+ * \param aptr The aligned pointer allocated by volk_malloc_ex, or NULL.
+ */
+VOLK_API void volk_free_ex(void* aptr);
+
+/*!
+ * \brief Allocate a ring buffer whose pages are mapped twice, back to back.
+ *
+ * \details
+ * Element i and element i + capacity share the same memory, so a window of
+ * up to capacity elements starting at any index below capacity is
+ * contiguous and can be passed to a single kernel call even where it wraps.
+ * The capacity is \p n_items rounded up to whole pages (allocation
+ * granularity on Windows) of whole items; the buffer is page aligned and
+ * thus aligned to volk_get_alignment(). Linux and other POSIX systems use
+ * a memfd or shm_open object, Windows VirtualAlloc2 (Windows 10 1803 on).
+ *
+ * \param n_items The minimum capacity in items.
+ * \param item_size The size of one item in bytes, not 0.
+ * \param capacity Set to the capacity in items.
+ * \return the start of the 2 * capacity items long mapping, NULL on failure,
+ * also where the mapping would not fit the address space.
+ */
+VOLK_API void* volk_malloc_ring(size_t n_items, size_t item_size, size_t* capacity);
+
+/*!
+ * \brief Free a ring buffer allocated by volk_malloc_ring.
+ *
+ * \param aptr The pointer returned by volk_malloc_ring, or NULL.
+ * \param capacity The capacity volk_malloc_ring returned.
+ * \param item_size The item size it was called with.
+ */
+VOLK_API void volk_free_ring(void* aptr, size_t capacity, size_t item_size);
+
+/*!
+ * \brief Counters of the pooled allocator.
+ *
+ * \details
+ * Setting the VOLK_MALLOC_POOL environment variable makes volk_malloc serve
+ * requests of up to 1 MiB, aligned to at most 64 bytes, from per-thread
+ * caches of power of two size classes, with global lists behind them.
+ * Blocks freed with volk_free are kept for reuse instead of returned to the
+ * system. The mode is fixed at the first volk_malloc or volk_free call.
+ */
+typedef struct volk_malloc_pool_stats {
+    long long allocations;   //!< volk_malloc calls
+    long long thread_hits;   //!< served from the calling thread's cache
+    long long global_hits;   //!< served from the global lists
+    long long system_allocs; //!< blocks taken from the system allocator
+    long long frees;         //!< volk_free calls
+    long long system_frees;  //!< blocks handed back to the system allocator
+    long long cached_bytes;  //!< bytes held in the caches and lists
+} volk_malloc_pool_stats_t;
+
+/*!
+ * \brief Read the counters of the pooled allocator.
+ *
+ * \param stats Filled with the counters, zeroed if the pool is off.
+ * \return true when the pooled mode is enabled.
+ */
+VOLK_API bool volk_get_malloc_pool_stats(volk_malloc_pool_stats_t* stats);
+
+/*!
+ * \brief Return the blocks held in the global lists and in the calling
+ * thread's cache to the system. Does nothing unless the pool is enabled.
+ */
+VOLK_API void volk_malloc_pool_trim(void);
+
+/*!
+ * \brief Bump allocator over one volk_malloc block.
+ *
+ * \details
+ * For the temporaries of a work call: volk_arena_alloc hands out aligned
+ * pieces of the block by advancing an offset, and volk_arena_reset takes
+ * them all back at once, so a processing loop sized by volk_arena_peak
+ * does no malloc or free at all. An arena is not thread safe; give every
+ * thread its own.
+ */
+typedef struct volk_arena volk_arena_t;
+
+/*!
+ * \brief Reserve an arena of \p size bytes.
+ * \return the arena, NULL on failure.
+ */
+VOLK_API volk_arena_t* volk_arena_create(size_t size);
+
+/*!
+ * \brief Free an arena and everything allocated from it.
+ * \param arena The arena, or NULL.
+ */
+VOLK_API void volk_arena_destroy(volk_arena_t* arena);
+
+/*!
+ * \brief Take \p size bytes from the arena.
+ *
+ * \param arena The arena.
+ * \param size The number of bytes.
+ * \param alignment A power of two, 0 for volk_get_alignment().
+ * \return pointer to aligned memory, NULL when the arena is exhausted.
+ */
+VOLK_API void* volk_arena_alloc(volk_arena_t* arena, size_t size, size_t alignment);
+
+/*!
+ * \brief Release everything allocated from the arena since it was created
+ * or last reset. The memory stays reserved.
+ */
+VOLK_API void volk_arena_reset(volk_arena_t* arena);
+
+//! Bytes in use by the allocations since the last reset, including padding
+VOLK_API size_t volk_arena_used(const volk_arena_t* arena);
+
+//! The most bytes that were ever in use at once, for sizing the arena
+VOLK_API size_t volk_arena_peak(const volk_arena_t* arena);
+
 __VOLK_DECL_END
 
 #endif /* INCLUDED_VOLK_MALLOC_H */
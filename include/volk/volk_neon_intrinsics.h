@@ -278,4 +278,712 @@ static inline float32x4_t _vtanq_f32(float32x4_t x)
 }
 
 
+/* The radix-4 FFT pass of _mm_fft_radix4_pass_sse3, four points per step, h % 4 == 0 */
+static inline void _vfft_radix4_passq_f32(float* data,
+                                          unsigned int num_points,
+                                          unsigned int h,
+                                          const float* twiddles)
+{
+    unsigned int block, j;
+    for (block = 0; block < num_points; block += 4 * h) {
+        float* x0 = data + 2 * block;
+        float* x1 = x0 + 2 * h;
+        float* x2 = x1 + 2 * h;
+        float* x3 = x2 + 2 * h;
+        for (j = 0; j < 2 * h; j += 8) {
+            // val[0] holds the real and val[1] the imaginary parts
+            const float32x4x2_t w1 = vld2q_f32(twiddles + 2 * h + j);
+            const float32x4x2_t w2 = vld2q_f32(twiddles + 4 * h + j);
+            const float32x4x2_t w3 = vld2q_f32(twiddles + 6 * h + j);
+            const float32x4x2_t a0 = vld2q_f32(x0 + j);
+            const float32x4x2_t a2 = vld2q_f32(x2 + j);
+            const float32x4x2_t t1 = _vmultiply_complexq_f32(vld2q_f32(x1 + j), w1);
+            const float32x4x2_t t3 = _vmultiply_complexq_f32(vld2q_f32(x3 + j), w1);
+
+            float32x4x2_t y0, y1, y2, y3, u2, u3, z;
+            y0.val[0] = vaddq_f32(a0.val[0], t1.val[0]);
+            y0.val[1] = vaddq_f32(a0.val[1], t1.val[1]);
+            y1.val[0] = vsubq_f32(a0.val[0], t1.val[0]);
+            y1.val[1] = vsubq_f32(a0.val[1], t1.val[1]);
+            y2.val[0] = vaddq_f32(a2.val[0], t3.val[0]);
+            y2.val[1] = vaddq_f32(a2.val[1], t3.val[1]);
+            y3.val[0] = vsubq_f32(a2.val[0], t3.val[0]);
+            y3.val[1] = vsubq_f32(a2.val[1], t3.val[1]);
+            u2 = _vmultiply_complexq_f32(y2, w2);
+            u3 = _vmultiply_complexq_f32(y3, w3);
+
+            z.val[0] = vaddq_f32(y0.val[0], u2.val[0]);
+            z.val[1] = vaddq_f32(y0.val[1], u2.val[1]);
+            vst2q_f32(x0 + j, z);
+            z.val[0] = vsubq_f32(y0.val[0], u2.val[0]);
+            z.val[1] = vsubq_f32(y0.val[1], u2.val[1]);
+            vst2q_f32(x2 + j, z);
+            z.val[0] = vaddq_f32(y1.val[0], u3.val[0]);
+            z.val[1] = vaddq_f32(y1.val[1], u3.val[1]);
+            vst2q_f32(x1 + j, z);
+            z.val[0] = vsubq_f32(y1.val[0], u3.val[0]);
+            z.val[1] = vsubq_f32(y1.val[1], u3.val[1]);
+            vst2q_f32(x3 + j, z);
+        }
+    }
+}
+
+/* The min-sum of the LLR pairs which vld2q_f32 splits, see llr_odd() */
+static inline float32x4_t _vpolar_minsum_llrsq_f32(float32x4x2_t llrs)
+{
+    const uint32x4_t sign =
+        vandq_u32(veorq_u32(vreinterpretq_u32_f32(llrs.val[0]),
+                            vreinterpretq_u32_f32(llrs.val[1])),
+                  vdupq_n_u32(0x80000000));
+    const float32x4_t dst = vminq_f32(vabsq_f32(llrs.val[0]), vabsq_f32(llrs.val[1]));
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(dst), sign));
+}
+
+/*
+ * The sum of the LLR pairs which vld2q_f32 splits, with the first one
+ * negated where fbits is not 0, see llr_even().
+ */
+static inline float32x4_t _vpolar_fsign_add_llrsq_f32(float32x4x2_t llrs,
+                                                      uint32x4_t fbits)
+{
+    const uint32x4_t flip = vandq_u32(vtstq_u32(fbits, fbits), vdupq_n_u32(0x80000000));
+    return vaddq_f32(
+        vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(llrs.val[0]), flip)),
+        llrs.val[1]);
+}
+
+/*
+ * The decoding loop of _mm_conv_decode_sse3, 16 butterflies per vector, the
+ * 8 of a 16 state code in the lower half.
+ */
+static inline void _vconv_decodeq_u8(unsigned char* Y,
+                                     unsigned char* X,
+                                     const unsigned char* syms,
+                                     unsigned char* dec,
+                                     unsigned int num_bits,
+                                     const unsigned char* Branchtab,
+                                     unsigned int num_states,
+                                     unsigned int rate)
+{
+    const unsigned int half = num_states / 2;
+    const int8x16_t shift = vdupq_n_s8(rate > 2 ? -2 : -1);
+    const uint8x16_t max_metric =
+        vdupq_n_u8((uint8_t)((rate * (255 >> (rate > 2 ? 2 : 1))) >> 2));
+    // the bits of the two decisions of butterfly i are 2 * i and 2 * i + 1
+    const uint8x16_t weight0 = vreinterpretq_u8_u32(vdupq_n_u32(0x40100401));
+    const uint8x16_t weight1 = vreinterpretq_u8_u32(vdupq_n_u32(0x80200802));
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    unsigned int s, i, j;
+    uint8x16_t metric, comp, old0, old1, m0, m1, m2, m3, s0, s1, bits, m;
+    uint8x16x2_t survivors;
+    uint8x8_t packed;
+
+    for (s = 0; s < num_bits; s++) {
+        for (i = 0; i < half; i += 16) {
+            if (half < 16) {
+                old0 = vcombine_u8(vld1_u8(old_metrics), vdup_n_u8(0));
+                old1 = vcombine_u8(vld1_u8(old_metrics + half), vdup_n_u8(0));
+            } else {
+                old0 = vld1q_u8(old_metrics + i);
+                old1 = vld1q_u8(old_metrics + half + i);
+            }
+
+            metric = vdupq_n_u8(0);
+            for (j = 0; j < rate; j++) {
+                const uint8x16_t bt =
+                    half < 16 ? vcombine_u8(vld1_u8(Branchtab + j * half), vdup_n_u8(0))
+                              : vld1q_u8(Branchtab + j * half + i);
+                metric = vaddq_u8(metric,
+                                  vshlq_u8(veorq_u8(vdupq_n_u8(syms[j]), bt), shift));
+            }
+            metric = vshrq_n_u8(metric, 2);
+            comp = vsubq_u8(max_metric, metric);
+
+            m0 = vqaddq_u8(old0, metric);
+            m1 = vqaddq_u8(old1, comp);
+            m2 = vqaddq_u8(old0, comp);
+            m3 = vqaddq_u8(old1, metric);
+            s0 = vminq_u8(m0, m1);
+            s1 = vminq_u8(m2, m3);
+
+            bits = vorrq_u8(vandq_u8(vceqq_u8(s0, m1), weight0),
+                            vandq_u8(vceqq_u8(s1, m3), weight1));
+            packed = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+            packed = vpadd_u8(packed, packed);
+            if (half < 16) {
+                vst1_lane_u16((uint16_t*)dec, vreinterpret_u16_u8(packed), 0);
+                survivors = vzipq_u8(s0, s1);
+                vst1q_u8(new_metrics, survivors.val[0]);
+            } else {
+                vst1_lane_u32((uint32_t*)(dec + i / 4), vreinterpret_u32_u8(packed), 0);
+                survivors.val[0] = s0;
+                survivors.val[1] = s1;
+                vst2q_u8(new_metrics + 2 * i, survivors);
+            }
+        }
+
+        if (new_metrics[0] > 210) {
+            m = vld1q_u8(new_metrics);
+            for (i = 16; i < num_states; i += 16) {
+                m = vminq_u8(m, vld1q_u8(new_metrics + i));
+            }
+            packed = vpmin_u8(vget_low_u8(m), vget_high_u8(m));
+            packed = vpmin_u8(packed, packed);
+            packed = vpmin_u8(packed, packed);
+            packed = vpmin_u8(packed, packed);
+            m = vdupq_lane_u8(packed, 0);
+            for (i = 0; i < num_states; i += 16) {
+                vst1q_u8(new_metrics + i, vqsubq_u8(vld1q_u8(new_metrics + i), m));
+            }
+        }
+
+        syms += rate;
+        dec += num_states / 8;
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (old_metrics != X) {
+        for (i = 0; i < num_states; i += 16) {
+            vst1q_u8(X + i, vld1q_u8(old_metrics + i));
+        }
+    }
+}
+
+/* Inclusive prefix sum of the four floats, in two shift and add steps */
+static inline float32x4_t _vscanq_f32(float32x4_t x)
+{
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    x = vaddq_f32(x, vextq_f32(zero, x, 3));
+    return vaddq_f32(x, vextq_f32(zero, x, 2));
+}
+
+/* Inclusive prefix sum of the two complex values */
+static inline float32x4_t _vscan_complexq_f32(float32x4_t x)
+{
+    return vaddq_f32(x, vextq_f32(vdupq_n_f32(0.f), x, 2));
+}
+
+/* Inclusive prefix sum of the four 32-bit integers, wrapping modulo 2^32 */
+static inline uint32x4_t _vscanq_u32(uint32x4_t x)
+{
+    const uint32x4_t zero = vdupq_n_u32(0);
+    x = vaddq_u32(x, vextq_u32(zero, x, 3));
+    return vaddq_u32(x, vextq_u32(zero, x, 2));
+}
+
+/* Inclusive prefix sum of the two complex 32-bit integers, wrapping */
+static inline uint32x4_t _vscan_complexq_u32(uint32x4_t x)
+{
+    return vaddq_u32(x, vextq_u32(vdupq_n_u32(0), x, 2));
+}
+
+/*
+ * Inclusive scan of the affine maps g -> a * g + b of the four lanes: lane k
+ * becomes the map of lanes 0 to k applied in turn, in two steps.
+ */
+static inline void _vscan_affineq_f32(float32x4_t* a, float32x4_t* b)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    *b = vmlaq_f32(*b, *a, vextq_f32(zero, *b, 3));
+    *a = vmulq_f32(*a, vextq_f32(one, *a, 3));
+    *b = vmlaq_f32(*b, *a, vextq_f32(zero, *b, 2));
+    *a = vmulq_f32(*a, vextq_f32(one, *a, 2));
+}
+
+/*
+ * Sorts each lane across the vectors v[0] to v[n - 1] into ascending order,
+ * n a power of two, with a bitonic network whose comparators all put the
+ * minimum first. Each lane sorts a set of its own.
+ */
+static inline void _vsort_networkq_f32(float32x4_t* v, unsigned int n)
+{
+    float32x4_t low;
+    unsigned int size, step, flip, base, i, j;
+
+    for (size = 2; size <= n; size *= 2) {
+        for (step = size / 2; step > 0; step /= 2) {
+            // the first step compares the halves of each block mirrored
+            flip = step == size / 2 ? size - 1 : step;
+            // i takes the lower index of each pair
+            for (base = 0; base < n; base += 2 * step) {
+                for (i = base; i < base + step; i++) {
+                    j = i ^ flip;
+                    low = vminq_f32(v[i], v[j]);
+                    v[j] = vmaxq_f32(v[i], v[j]);
+                    v[i] = low;
+                }
+            }
+        }
+    }
+}
+
+/* a where a - b, wrapped to 16 bits, is positive, else b, as the turbo kernels */
+static inline int16x8_t _vmax_starq_s16(const int16x8_t a, const int16x8_t b)
+{
+    return vbslq_s16(vcgtq_s16(vsubq_s16(a, b), vdupq_n_s16(0)), a, b);
+}
+
+/*
+ * Q15 a * b of deinterleaved complex values: the four products are rounded and
+ * saturated, then their difference and sum
+ */
+static inline int16x8x2_t _vcomplexmul_q15q_s16(const int16x8x2_t a, const int16x8x2_t b)
+{
+    int16x8x2_t c;
+    c.val[0] = vqsubq_s16(vqrdmulhq_s16(a.val[0], b.val[0]),
+                          vqrdmulhq_s16(a.val[1], b.val[1]));
+    c.val[1] = vqaddq_s16(vqrdmulhq_s16(a.val[1], b.val[0]),
+                          vqrdmulhq_s16(a.val[0], b.val[1]));
+    return c;
+}
+
+/* A xoshiro128+ step of four generators, the four wide _mm256_xoshiro128p_epi32 */
+static inline uint32x4_t _vxoshiro128pq_u32(uint32x4_t* s)
+{
+    const uint32x4_t result = vaddq_u32(s[0], s[3]);
+    const uint32x4_t t = vshlq_n_u32(s[1], 9);
+
+    s[2] = veorq_u32(s[2], s[0]);
+    s[3] = veorq_u32(s[3], s[1]);
+    s[1] = veorq_u32(s[1], s[2]);
+    s[0] = veorq_u32(s[0], s[3]);
+    s[2] = veorq_u32(s[2], t);
+    s[3] = vsriq_n_u32(vshlq_n_u32(s[3], 11), s[3], 21);
+    return result;
+}
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+/* The following need the AArch64 fused multiply-add, division and square root */
+
+/*
+ * x * y of interleaved complex values from xyReal = x * real(y) and
+ * xyImag = x * imag(y), for products summed over many y first.
+ */
+static inline float32x4_t _vcomplexmul_partsq_f32(float32x4_t xyReal,
+                                                   float32x4_t xyImag)
+{
+    static const float signs[4] = { -1.f, 1.f, -1.f, 1.f };
+    return vfmaq_f32(xyReal, vrev64q_f32(xyImag), vld1q_f32(signs));
+}
+
+/* Complex multiplication for float32x4x2_t with fused multiply-add */
+static inline float32x4x2_t _vmultiply_complexq_f32_fma(float32x4x2_t a_val,
+                                                        float32x4x2_t b_val)
+{
+    float32x4x2_t c_val;
+    // a0r*b0r-a0i*b0i|...
+    c_val.val[0] =
+        vfmsq_f32(vmulq_f32(a_val.val[0], b_val.val[0]), a_val.val[1], b_val.val[1]);
+    // a0r*b0i+a0i*b0r|...
+    c_val.val[1] =
+        vfmaq_f32(vmulq_f32(a_val.val[0], b_val.val[1]), a_val.val[1], b_val.val[0]);
+    return c_val;
+}
+
+/* Scale complex values to unit magnitude, exactly rounded unlike _vinvsqrtq_f32 */
+static inline float32x4x2_t _vnormalize_complexq_f32(float32x4x2_t cmplxValue)
+{
+    const float32x4_t mag = vsqrtq_f32(vfmaq_f32(
+        vmulq_f32(cmplxValue.val[0], cmplxValue.val[0]), cmplxValue.val[1], cmplxValue.val[1]));
+    cmplxValue.val[0] = vdivq_f32(cmplxValue.val[0], mag);
+    cmplxValue.val[1] = vdivq_f32(cmplxValue.val[1], mag);
+    return cmplxValue;
+}
+
+/* The complex double _vmultiply_complexq_f32_fma, real and imaginary parts split */
+static inline float64x2x2_t _vmultiply_complexq_f64(float64x2x2_t a_val,
+                                                    float64x2x2_t b_val)
+{
+    float64x2x2_t c_val;
+    c_val.val[0] =
+        vfmsq_f64(vmulq_f64(a_val.val[0], b_val.val[0]), a_val.val[1], b_val.val[1]);
+    c_val.val[1] =
+        vfmaq_f64(vmulq_f64(a_val.val[0], b_val.val[1]), a_val.val[1], b_val.val[0]);
+    return c_val;
+}
+
+static inline float64x2x2_t _vnormalize_complexq_f64(float64x2x2_t cmplxValue)
+{
+    const float64x2_t mag2 = vfmaq_f64(vmulq_f64(cmplxValue.val[0], cmplxValue.val[0]),
+                                       cmplxValue.val[1],
+                                       cmplxValue.val[1]);
+    const float64x2_t mag = vsqrtq_f64(mag2);
+    cmplxValue.val[0] = vdivq_f64(cmplxValue.val[0], mag);
+    cmplxValue.val[1] = vdivq_f64(cmplxValue.val[1], mag);
+    return cmplxValue;
+}
+
+/* Arctangent of x in [-1, 1], odd polynomial of degree 15
+ * with a relative error below 2e-7 */
+static inline float32x4_t _varctan_polyq_f32(float32x4_t x)
+{
+    const float32x4_t x2 = vmulq_f32(x, x);
+    float32x4_t p = vdupq_n_f32(-0.00478018541f);
+    p = vfmaq_f32(vdupq_n_f32(0.0245562103f), p, x2);
+    p = vfmaq_f32(vdupq_n_f32(-0.0599035136f), p, x2);
+    p = vfmaq_f32(vdupq_n_f32(0.0994268283f), p, x2);
+    p = vfmaq_f32(vdupq_n_f32(-0.140293956f), p, x2);
+    p = vfmaq_f32(vdupq_n_f32(0.199713722f), p, x2);
+    p = vfmaq_f32(vdupq_n_f32(-0.333320946f), p, x2);
+    p = vfmaq_f32(vdupq_n_f32(0.99999994f), p, x2);
+    return vmulq_f32(p, x);
+}
+
+/* Arctangent, using atan(x) = +-pi/2 - atan(1/x) for |x| > 1 */
+static inline float32x4_t _vatanq_f32(float32x4_t x)
+{
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+    const uint32x4_t swap = vcgtq_f32(vabsq_f32(x), vdupq_n_f32(1.f));
+    const float32x4_t arg = vbslq_f32(swap, vdivq_f32(vdupq_n_f32(1.f), x), x);
+    const float32x4_t res = _varctan_polyq_f32(arg);
+    const float32x4_t pi_2 = vbslq_f32(sign_mask, x, vdupq_n_f32(1.57079633f));
+    return vbslq_f32(swap, vsubq_f32(pi_2, res), res);
+}
+
+/* Four quadrant arctangent of y/x */
+static inline float32x4_t _vatan2q_f32(float32x4_t y, float32x4_t x)
+{
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+    const float32x4_t abs_x = vabsq_f32(x);
+    const float32x4_t abs_y = vabsq_f32(y);
+    const float32x4_t num = vminq_f32(abs_x, abs_y);
+    const float32x4_t den = vmaxq_f32(abs_x, abs_y);
+    // 0/0 is 0, as atan2f(0, 0)
+    const float32x4_t ratio = vbslq_f32(
+        vceqq_f32(den, vdupq_n_f32(0.f)), vdupq_n_f32(0.f), vdivq_f32(num, den));
+    float32x4_t res = _varctan_polyq_f32(ratio);
+    res = vbslq_f32(
+        vcgtq_f32(abs_y, abs_x), vsubq_f32(vdupq_n_f32(1.57079633f), res), res);
+    // by the sign bit, so x = -0 gives pi as atan2f does
+    res = vbslq_f32(vcltq_s32(vreinterpretq_s32_f32(x), vdupq_n_s32(0)),
+                    vsubq_f32(vdupq_n_f32(3.14159265f), res),
+                    res);
+    // take the sign of y
+    return vbslq_f32(sign_mask, y, res);
+}
+
+/* exp(x) within 2 ulp, the four wide version of _mm256_exp_ps_avx2_fma */
+static inline float32x4_t _vexpq_f32(float32x4_t x)
+{
+    float32x4_t n, r, poly;
+    int32x4_t k, half;
+
+    // NaN passes through vminq and vmaxq
+    x = vmaxq_f32(vdupq_n_f32(-104.f), vminq_f32(vdupq_n_f32(89.f), x));
+    n = vrndnq_f32(vmulq_f32(x, vdupq_n_f32(1.44269504088896341f)));
+    r = vfmsq_f32(x, n, vdupq_n_f32(0.693359375f));
+    r = vfmsq_f32(r, n, vdupq_n_f32(-2.12194440e-4f));
+
+    poly = vdupq_n_f32(1.9875691500e-4f);
+    poly = vfmaq_f32(vdupq_n_f32(1.3981999507e-3f), poly, r);
+    poly = vfmaq_f32(vdupq_n_f32(8.3334519073e-3f), poly, r);
+    poly = vfmaq_f32(vdupq_n_f32(4.1665795894e-2f), poly, r);
+    poly = vfmaq_f32(vdupq_n_f32(1.6666665459e-1f), poly, r);
+    poly = vfmaq_f32(vdupq_n_f32(5.0000001201e-1f), poly, r);
+    poly = vfmaq_f32(r, poly, vmulq_f32(r, r));
+    poly = vaddq_f32(poly, vdupq_n_f32(1.f));
+
+    k = vcvtq_s32_f32(n);
+    half = vshrq_n_s32(k, 1);
+    k = vsubq_s32(k, half);
+    half = vshlq_n_s32(vaddq_s32(half, vdupq_n_s32(127)), 23);
+    k = vshlq_n_s32(vaddq_s32(k, vdupq_n_s32(127)), 23);
+    poly = vmulq_f32(poly, vreinterpretq_f32_s32(half));
+    return vmulq_f32(poly, vreinterpretq_f32_s32(k));
+}
+
+/* log(x) for normal x > 0 within 2 ulp, the four wide version of
+ * _mm256_log_ps_avx2_fma; unlike _vlogq_f32 it stays accurate next to 1 */
+static inline float32x4_t _vlogq_f32_fma(float32x4_t x)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const uint32x4_t bits = vreinterpretq_u32_f32(x);
+    float32x4_t e, m, z, poly;
+    uint32x4_t small;
+
+    // m in [1/2, 1), then times 2 below sqrt(1/2)
+    e = vcvtq_f32_s32(
+        vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(126)));
+    m = vreinterpretq_f32_u32(
+        vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x7fffff)), vdupq_n_u32(0x3f000000)));
+    small = vcltq_f32(m, vdupq_n_f32(0.707106781186547524f));
+    e = vsubq_f32(e, vreinterpretq_f32_u32(vandq_u32(small, vreinterpretq_u32_f32(one))));
+    m = vaddq_f32(vsubq_f32(m, one),
+                  vreinterpretq_f32_u32(vandq_u32(small, vreinterpretq_u32_f32(m))));
+
+    z = vmulq_f32(m, m);
+    poly = vdupq_n_f32(7.0376836292e-2f);
+    poly = vfmaq_f32(vdupq_n_f32(-1.1514610310e-1f), poly, m);
+    poly = vfmaq_f32(vdupq_n_f32(1.1676998740e-1f), poly, m);
+    poly = vfmaq_f32(vdupq_n_f32(-1.2420140846e-1f), poly, m);
+    poly = vfmaq_f32(vdupq_n_f32(1.4249322787e-1f), poly, m);
+    poly = vfmaq_f32(vdupq_n_f32(-1.6668057665e-1f), poly, m);
+    poly = vfmaq_f32(vdupq_n_f32(2.0000714765e-1f), poly, m);
+    poly = vfmaq_f32(vdupq_n_f32(-2.4999993993e-1f), poly, m);
+    poly = vfmaq_f32(vdupq_n_f32(3.3333331174e-1f), poly, m);
+    poly = vmulq_f32(vmulq_f32(poly, m), z);
+    // ln(2) in two parts
+    poly = vfmaq_f32(poly, e, vdupq_n_f32(-2.12194440e-4f));
+    poly = vfmsq_f32(poly, z, vdupq_n_f32(0.5f));
+    return vfmaq_f32(vaddq_f32(m, poly), e, vdupq_n_f32(0.693359375f));
+}
+
+/*
+ * Four Gaussian points of the generators s, the four wide
+ * _mm256_rand_gaussian_ps_avx2_fma, with the real parts in val[0]
+ */
+static inline float32x4x2_t _vrand_gaussianq_f32(uint32x4_t* s)
+{
+    const uint32x4_t u = _vxoshiro128pq_u32(s);
+    const uint32x4_t v = _vxoshiro128pq_u32(s);
+    const float32x4_t x = vmulq_n_f32(
+        vcvtq_f32_u32(vaddq_u32(vshrq_n_u32(u, 8), vdupq_n_u32(1))), 1.f / 16777216.f);
+    const float32x4_t radius = vsqrtq_f32(vnegq_f32(_vlogq_f32_fma(x)));
+    const float32x4_t angle = vmulq_n_f32(
+        vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(v, 8)),
+                                vdupq_n_s32(8388608))),
+        3.74507028e-7f);
+    const float32x4x2_t sincos = _vsincosq_f32(angle);
+    float32x4x2_t points;
+
+    points.val[0] = vmulq_f32(radius, sincos.val[1]);
+    points.val[1] = vmulq_f32(radius, sincos.val[0]);
+    return points;
+}
+
+/* log2(x) for positive doubles, the two wide version of _mm256_log2_pd_avx2_fma */
+static inline float64x2_t _vlog2q_f64(float64x2_t x)
+{
+    const float64x2_t one = vdupq_n_f64(1.0);
+    const uint64x2_t bits = vreinterpretq_u64_f64(x);
+    float64x2_t exponent, m, s, s2, poly;
+    uint64x2_t big;
+
+    exponent = vsubq_f64(vcvtq_f64_u64(vshrq_n_u64(bits, 52)), vdupq_n_f64(1023.0));
+    m = vreinterpretq_f64_u64(vorrq_u64(vandq_u64(bits, vdupq_n_u64(0xfffffffffffffULL)),
+                                        vreinterpretq_u64_f64(one)));
+    big = vcgtq_f64(m, vdupq_n_f64(1.4142135623730951));
+    m = vbslq_f64(big, vmulq_f64(m, vdupq_n_f64(0.5)), m);
+    exponent = vaddq_f64(
+        exponent, vreinterpretq_f64_u64(vandq_u64(big, vreinterpretq_u64_f64(one))));
+
+    s = vdivq_f64(vsubq_f64(m, one), vaddq_f64(m, one));
+    s2 = vmulq_f64(s, s);
+    poly = vdupq_n_f64(1.0 / 13);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 11), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 9), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 7), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 5), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 3), poly, s2);
+    poly = vfmaq_f64(one, poly, s2);
+    // 2 / ln(2)
+    return vfmaq_f64(exponent, vmulq_f64(s, poly), vdupq_n_f64(2.8853900817779268));
+}
+
+/* 2^x, the two wide version of _mm256_exp2_pd_avx2_fma */
+static inline float64x2_t _vexp2q_f64(float64x2_t x)
+{
+    float64x2_t n, f, poly;
+    int64x2_t scale;
+
+    x = vmaxq_f64(vdupq_n_f64(-160.0), vminq_f64(vdupq_n_f64(160.0), x));
+    n = vrndnq_f64(x);
+    f = vmulq_f64(vsubq_f64(x, n), vdupq_n_f64(0.6931471805599453));
+
+    poly = vdupq_n_f64(1.0 / 3628800);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 362880), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 40320), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 5040), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 720), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 120), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 24), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 6), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(0.5), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(1.0), poly, f);
+    poly = vfmaq_f64(vdupq_n_f64(1.0), poly, f);
+
+    scale = vshlq_n_s64(vaddq_s64(vcvtq_s64_f64(n), vdupq_n_s64(1023)), 52);
+    return vmulq_f64(poly, vreinterpretq_f64_s64(scale));
+}
+
+/* sin(x) and cos(x) in double, the two wide version of _mm256_sincos_pd_avx2_fma */
+static inline float64x2x2_t _vsincosq_f64(float64x2_t x)
+{
+    const uint64x2_t sign_bit = vdupq_n_u64(0x8000000000000000ULL);
+    const int64x2_t two = vdupq_n_s64(2);
+    const int64x2_t four = vdupq_n_s64(4);
+    uint64x2_t sign_sin = vandq_u64(vreinterpretq_u64_f64(x), sign_bit);
+    float64x2_t y, z, poly_sin, poly_cos;
+    int64x2_t j;
+    float64x2x2_t sincos;
+    x = vabsq_f64(x);
+
+    // octant j of |x|, rounded up to even
+    y = vrndq_f64(vmulq_f64(x, vdupq_n_f64(1.2732395447351628)));
+    j = vcvtq_s64_f64(y);
+    y = vaddq_f64(y, vcvtq_f64_s64(vandq_s64(j, vdupq_n_s64(1))));
+    j = vaddq_s64(j, vandq_s64(j, vdupq_n_s64(1)));
+    x = vfmsq_f64(x, y, vdupq_n_f64(7.85398125648498535156e-1));
+    x = vfmsq_f64(x, y, vdupq_n_f64(3.77489470793079817668e-8));
+    x = vfmsq_f64(x, y, vdupq_n_f64(2.69515142907905952645e-15));
+
+    sign_sin =
+        veorq_u64(sign_sin, vreinterpretq_u64_s64(vshlq_n_s64(vandq_s64(j, four), 61)));
+    const uint64x2_t sign_cos =
+        vreinterpretq_u64_s64(vshlq_n_s64(vbicq_s64(four, vsubq_s64(j, two)), 61));
+    const uint64x2_t swap = vtstq_s64(j, two);
+
+    z = vmulq_f64(x, x);
+    poly_cos = vdupq_n_f64(-1.13585365213876817300e-11);
+    poly_cos = vfmaq_f64(vdupq_n_f64(2.08757008419747316778e-9), poly_cos, z);
+    poly_cos = vfmaq_f64(vdupq_n_f64(-2.75573141792967388112e-7), poly_cos, z);
+    poly_cos = vfmaq_f64(vdupq_n_f64(2.48015872888517045348e-5), poly_cos, z);
+    poly_cos = vfmaq_f64(vdupq_n_f64(-1.38888888888730564116e-3), poly_cos, z);
+    poly_cos = vfmaq_f64(vdupq_n_f64(4.16666666666665929218e-2), poly_cos, z);
+    poly_cos = vfmaq_f64(vfmsq_f64(vdupq_n_f64(1.0), z, vdupq_n_f64(0.5)),
+                         vmulq_f64(poly_cos, z),
+                         z);
+
+    poly_sin = vdupq_n_f64(1.58962301576546568060e-10);
+    poly_sin = vfmaq_f64(vdupq_n_f64(-2.50507477628578072866e-8), poly_sin, z);
+    poly_sin = vfmaq_f64(vdupq_n_f64(2.75573136213857245213e-6), poly_sin, z);
+    poly_sin = vfmaq_f64(vdupq_n_f64(-1.98412698295895385996e-4), poly_sin, z);
+    poly_sin = vfmaq_f64(vdupq_n_f64(8.33333333332211858878e-3), poly_sin, z);
+    poly_sin = vfmaq_f64(vdupq_n_f64(-1.66666666666666307295e-1), poly_sin, z);
+    poly_sin = vfmaq_f64(x, vmulq_f64(poly_sin, z), x);
+
+    sincos.val[0] = vreinterpretq_f64_u64(veorq_u64(
+        vreinterpretq_u64_f64(vbslq_f64(swap, poly_cos, poly_sin)), sign_sin));
+    sincos.val[1] = vreinterpretq_f64_u64(veorq_u64(
+        vreinterpretq_u64_f64(vbslq_f64(swap, poly_sin, poly_cos)), sign_cos));
+    return sincos;
+}
+
+/* exp(x) in double, the two wide version of _mm256_exp_pd_avx2_fma */
+static inline float64x2_t _vexpq_f64(float64x2_t x)
+{
+    float64x2_t n, r, poly;
+    int64x2_t k, half;
+
+    // vmaxq and vminq return NaN for NaN, which passes through
+    x = vmaxq_f64(vdupq_n_f64(-746.0), vminq_f64(vdupq_n_f64(710.0), x));
+    n = vrndnq_f64(vmulq_f64(x, vdupq_n_f64(1.4426950408889634)));
+    r = vfmsq_f64(x, n, vdupq_n_f64(0.6931471805599453));
+    r = vfmsq_f64(r, n, vdupq_n_f64(2.3190468138462996e-17));
+
+    poly = vdupq_n_f64(1.0 / 6227020800);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 479001600), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 39916800), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 3628800), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 362880), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 40320), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 5040), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 720), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 120), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 24), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(1.0 / 6), poly, r);
+    poly = vfmaq_f64(vdupq_n_f64(0.5), poly, r);
+    poly = vfmaq_f64(r, poly, vmulq_f64(r, r));
+    poly = vaddq_f64(poly, vdupq_n_f64(1.0));
+
+    k = vcvtq_s64_f64(n);
+    half = vshrq_n_s64(k, 1);
+    k = vsubq_s64(k, half);
+    half = vshlq_n_s64(vaddq_s64(half, vdupq_n_s64(1023)), 52);
+    k = vshlq_n_s64(vaddq_s64(k, vdupq_n_s64(1023)), 52);
+    poly = vmulq_f64(poly, vreinterpretq_f64_s64(half));
+    return vmulq_f64(poly, vreinterpretq_f64_s64(k));
+}
+
+/* log(x) in double, the two wide version of _mm256_log_pd_avx2_fma */
+static inline float64x2_t _vlogq_f64(float64x2_t x)
+{
+    const float64x2_t one = vdupq_n_f64(1.0);
+    const float64x2_t zero = vdupq_n_f64(0.0);
+    const float64x2_t infinity =
+        vreinterpretq_f64_u64(vdupq_n_u64(0x7ff0000000000000ULL));
+    // below the smallest normal
+    const uint64x2_t tiny = vcltq_f64(x, vdupq_n_f64(2.2250738585072014e-308));
+    const uint64x2_t bits = vreinterpretq_u64_f64(
+        vbslq_f64(tiny, vmulq_f64(x, vdupq_n_f64(4503599627370496.0)), x));
+    float64x2_t exponent, m, f, s, s2, poly, half_f2, res;
+    uint64x2_t big;
+
+    exponent = vsubq_f64(vcvtq_f64_u64(vshrq_n_u64(bits, 52)), vdupq_n_f64(1023.0));
+    exponent = vsubq_f64(
+        exponent,
+        vreinterpretq_f64_u64(vandq_u64(tiny, vreinterpretq_u64_f64(vdupq_n_f64(52.0)))));
+    m = vreinterpretq_f64_u64(vorrq_u64(vandq_u64(bits, vdupq_n_u64(0xfffffffffffffULL)),
+                                        vreinterpretq_u64_f64(one)));
+    big = vcgtq_f64(m, vdupq_n_f64(1.4142135623730951));
+    m = vbslq_f64(big, vmulq_f64(m, vdupq_n_f64(0.5)), m);
+    exponent = vaddq_f64(
+        exponent, vreinterpretq_f64_u64(vandq_u64(big, vreinterpretq_u64_f64(one))));
+
+    // log(1 + f) = f - s f + s R, with s = f / (2 + f) and R the series in s^2
+    f = vsubq_f64(m, one);
+    s = vdivq_f64(f, vaddq_f64(f, vdupq_n_f64(2.0)));
+    s2 = vmulq_f64(s, s);
+    poly = vdupq_n_f64(2.0 / 21);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 19), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 17), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 15), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 13), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 11), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 9), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 7), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 5), poly, s2);
+    poly = vfmaq_f64(vdupq_n_f64(2.0 / 3), poly, s2);
+    half_f2 = vmulq_f64(vmulq_f64(f, f), vdupq_n_f64(0.5));
+    // ln(2) in two parts
+    res = vfmaq_f64(vmulq_f64(exponent, vdupq_n_f64(2.3190468138462996e-17)),
+                    s,
+                    vfmaq_f64(half_f2, poly, s2));
+    res = vaddq_f64(vsubq_f64(res, half_f2), f);
+    res = vfmaq_f64(res, exponent, vdupq_n_f64(0.6931471805599453));
+
+    res = vbslq_f64(vceqq_f64(x, zero), vnegq_f64(infinity), res);
+    res = vbslq_f64(vceqq_f64(x, infinity), x, res);
+    return vbslq_f64(vcgeq_f64(x, zero),
+                     res,
+                     vreinterpretq_f64_u64(vdupq_n_u64(0x7ff8000000000000ULL)));
+}
+
+/* powf(x, y), the four wide version of _mm256_pow_ps_avx2_fma */
+static inline float32x4_t _vpowq_f32(float32x4_t x, float32x4_t y)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t abs_x = vabsq_f32(x);
+    const float32x4_t y_half = vmulq_f32(y, vdupq_n_f32(0.5f));
+    float64x2_t low, high;
+    float32x4_t res;
+    uint32x4_t integer, odd, nan;
+
+    low = _vexp2q_f64(vmulq_f64(vcvt_f64_f32(vget_low_f32(y)),
+                                _vlog2q_f64(vcvt_f64_f32(vget_low_f32(abs_x)))));
+    high = _vexp2q_f64(
+        vmulq_f64(vcvt_high_f64_f32(y), _vlog2q_f64(vcvt_high_f64_f32(abs_x))));
+    res = vcvt_high_f32_f64(vcvt_f32_f64(low), high);
+
+    res = vbslq_f32(vceqq_f32(abs_x, one), one, res);
+    nan = vbicq_u32(vmvnq_u32(vceqq_f32(x, x)), vceqq_f32(y, vdupq_n_f32(0.f)));
+    res = vbslq_f32(nan, x, res);
+
+    integer = vceqq_f32(vrndq_f32(y), y);
+    odd = vbicq_u32(integer, vceqq_f32(vrndq_f32(y_half), y_half));
+    res = vbslq_f32(vandq_u32(odd, vdupq_n_u32(0x80000000)), x, res);
+    // x = -0 and -infinity take no NaN
+    nan = vandq_u32(vcltq_f32(x, vdupq_n_f32(0.f)),
+                    vcltq_f32(abs_x, vreinterpretq_f32_u32(vdupq_n_u32(0x7f800000))));
+    nan = vbicq_u32(nan, integer);
+    return vbslq_f32(nan, vreinterpretq_f32_u32(vdupq_n_u32(0x7fc00000)), res);
+}
+#endif /* __aarch64__ */
+
+
 #endif /* INCLUDE_VOLK_VOLK_NEON_INTRINSICS_H_ */
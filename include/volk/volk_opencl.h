@@ -0,0 +1,83 @@
+/* -*- c -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * The opencl arch, built with -DENABLE_OPENCL=ON, runs the _opencl impls of
+ * a few bulk kernels on the first OpenCL GPU or accelerator. Launching them
+ * costs tens of microseconds, so the default ranking never picks them; a
+ * profile made with volk_profile --length-buckets names them for the lengths
+ * the device wins at.
+ *
+ * Vectors the kernels get from volk_opencl_malloc() are device buffers: they
+ * stay shared with the device across calls, so on devices sharing memory
+ * with the host no data is copied and on others it moves by DMA from pinned
+ * memory. Any other vector is wrapped for the call only. Device buffers are
+ * ordinary host memory to every other kernel and to the caller, but must
+ * not be used by two threads at once.
+ */
+
+#ifndef INCLUDED_VOLK_OPENCL_H
+#define INCLUDED_VOLK_OPENCL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+__VOLK_DECL_BEGIN
+
+//! Whether an OpenCL device the opencl arch can use is present
+VOLK_API bool volk_opencl_available(void);
+
+/*!
+ * \brief Allocate a device buffer of size bytes.
+ *
+ * Without a device this is volk_malloc() with the machine's alignment.
+ * \return NULL if out of memory; release it with volk_opencl_free().
+ */
+VOLK_API void* volk_opencl_malloc(size_t size);
+
+//! Release a buffer from volk_opencl_malloc()
+VOLK_API void volk_opencl_free(void* ptr);
+
+// the device side of the _opencl impls; false if the device could not run
+// the kernel, which then leaves the outputs unchanged
+VOLK_API bool volk_opencl_32fc_x2_multiply_32fc(lv_32fc_t* cVector,
+                                                const lv_32fc_t* aVector,
+                                                const lv_32fc_t* bVector,
+                                                unsigned int num_points);
+VOLK_API bool volk_opencl_32fc_magnitude_squared_32f(float* magnitudeVector,
+                                                     const lv_32fc_t* complexVector,
+                                                     unsigned int num_points);
+VOLK_API bool volk_opencl_32f_s32f_convert_16i(int16_t* outputVector,
+                                               const float* inputVector,
+                                               const float scalar,
+                                               unsigned int num_points);
+VOLK_API bool volk_opencl_32fc_x2_dot_prod_32fc(lv_32fc_t* result,
+                                                const lv_32fc_t* input,
+                                                const lv_32fc_t* taps,
+                                                unsigned int num_points);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_OPENCL_H */
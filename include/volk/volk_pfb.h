@@ -0,0 +1,124 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Polyphase filter bank channelizers of complex streams.
+ *
+ * A channelizer splits a stream into num_channels channels spaced by
+ * 1 / num_channels of its sample rate, channel k centered on k /
+ * num_channels, each filtered by the prototype low pass and mixed down to
+ * DC. It outputs a frame of all channels every hop inputs: every
+ * num_channels inputs when critically sampled, every num_channels / 2 with
+ * VOLK_PFB_OVERSAMPLED, which keeps the band edges of the channels free of
+ * aliases for a prototype cut off between 1 / (2 num_channels) and
+ * 1 / num_channels.
+ *
+ * Each frame is the commutated polyphase FIR of all branches,
+ * volk_32fc_32f_pfb_fold_32fc over the window of the newest
+ * taps_per_branch * num_channels inputs, and a transform of the branch
+ * sums, both through plans made once for the channel count; the sums of up
+ * to 16 frames are transformed by one volk_32fc_fft_batch_32fc call. An
+ * oversampled bank rotates the sums by half the channels every other frame,
+ * so that the channels stay mixed down to DC rather than alternate in sign.
+ *
+ * The channelizer keeps the last window less one inputs between calls, as
+ * the filters of volk_fir.h do; only the frames whose window reaches into
+ * them read a copy, the others read the caller's input in place. The
+ * frames of a call are shared out in contiguous runs between the
+ * volk_set_num_threads() pool, a run being at least VOLK_PARALLEL_GRAIN
+ * points of windows, so short calls stay on the calling thread. A
+ * channelizer must not be used by two threads at once.
+ *
+ * The frames are written one after the other, channel k of frame f at
+ * output[f * num_channels + k]. Channel k of the frame after input t is
+ *
+ *   sum over n of taps[n] * x[t - n] * exp(-2 pi i k (t - n) / num_channels)
+ *
+ * with x the inputs of this and the earlier calls, zero before the first.
+ *
+ * example code:
+ *   // 1024 channels, twice oversampled, out of an 8192 tap prototype
+ *   volk_pfb_channelizer_t* pfb =
+ *       volk_pfb_channelizer_create(1024, taps, 8192, VOLK_PFB_OVERSAMPLED);
+ *   frames = volk_pfb_channelizer_compute(pfb, channels, samples, num_points);
+ *   volk_pfb_channelizer_destroy(pfb);
+ */
+
+#ifndef INCLUDED_VOLK_PFB_H
+#define INCLUDED_VOLK_PFB_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+__VOLK_DECL_BEGIN
+
+//! A channelizer of one channel count, see volk_pfb_channelizer_create()
+typedef struct volk_pfb_channelizer volk_pfb_channelizer_t;
+
+//! Flags: output a frame every num_channels / 2 inputs rather than num_channels
+#define VOLK_PFB_OVERSAMPLED 1u
+
+/*!
+ * \brief Make a channelizer of num_channels channels.
+ *
+ * \param num_channels The number of channels, a power of two of at least 2.
+ * \param taps The num_taps taps of the prototype low pass, copied; taps[0]
+ * applies to the newest input. They are padded with zeros to a multiple of
+ * num_channels.
+ * \param num_taps The number of taps, at least 1.
+ * \param flags 0 or VOLK_PFB_OVERSAMPLED.
+ * \return the channelizer, NULL if the arguments are out of range or out of
+ * memory
+ */
+VOLK_API volk_pfb_channelizer_t* volk_pfb_channelizer_create(unsigned int num_channels,
+                                                             const float* taps,
+                                                             unsigned int num_taps,
+                                                             unsigned int flags);
+
+//! Release a channelizer and its buffers, NULL is ignored
+VOLK_API void volk_pfb_channelizer_destroy(volk_pfb_channelizer_t* pfb);
+
+//! Zero the inputs kept, as after volk_pfb_channelizer_create()
+VOLK_API void volk_pfb_channelizer_reset(volk_pfb_channelizer_t* pfb);
+
+//! The number of frames the next call with num_points inputs outputs
+VOLK_API size_t volk_pfb_channelizer_frames(const volk_pfb_channelizer_t* pfb,
+                                            size_t num_points);
+
+/*!
+ * \brief Channelize num_points inputs.
+ *
+ * output needs room for volk_pfb_channelizer_frames() frames of
+ * num_channels samples and must not overlap input.
+ *
+ * \return the number of frames written, or -1 if out of memory for the
+ * buffers, with the inputs kept unchanged
+ */
+VOLK_API ptrdiff_t volk_pfb_channelizer_compute(volk_pfb_channelizer_t* pfb,
+                                                lv_32fc_t* output,
+                                                const lv_32fc_t* input,
+                                                size_t num_points);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_PFB_H */
@@ -0,0 +1,387 @@
+/* -*- C++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * A stream of chunks through a chain of stages, e.g. read, convert, rotate,
+ * filter and write, each stage a C++20 coroutine. Between two stages sit
+ * depth buffers of a chunk each, carved from one arena: a stage waits for
+ * a filled buffer from the stage before it and for an empty one to fill,
+ * so a slow stage holds the ones before it back. The coroutines run on
+ * volk_run_tasks(), i.e. on the executor of volk_set_executor() or on the
+ * volk_set_num_threads() pool, with any free thread picking up any stage
+ * that can go on, so a source blocked reading a file leaves the other
+ * threads to convert and filter the chunks it read before. A stage runs
+ * on one thread at a time and sees the chunks in order, which lets plans
+ * such as a volk_fir_32fc_t keep their state from one chunk to the next.
+ * Needs C++20; the library itself builds without it.
+ *
+ * Stages must not call the volk_parallel_ or volk_async_ kernels. With a
+ * single thread everything still runs, one stage after the other.
+ *
+ * example code:
+ *   volk::pipeline p(1 << 16);
+ *   p.source<lv_16sc_t>([&](volk::aligned_span<lv_16sc_t> out) {
+ *       return fread(out.data(), sizeof(lv_16sc_t), out.size(), in_file);
+ *   });
+ *   p.stage(volk_16ic_convert_32fc);
+ *   p.stage<lv_32fc_t, lv_32fc_t>([&](auto in, auto out) {
+ *       volk_fir_32fc_filter(fir, out.data(), in.data(), in.size());
+ *   });
+ *   p.sink<lv_32fc_t>([&](volk::aligned_span<const lv_32fc_t> in) {
+ *       fwrite(in.data(), sizeof(lv_32fc_t), in.size(), out_file);
+ *   });
+ *   p.run();
+ */
+
+#ifndef INCLUDED_VOLK_PIPELINE_HH
+#define INCLUDED_VOLK_PIPELINE_HH
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <typeinfo>
+#include <vector>
+
+#include <volk/volk.h>
+#include <volk/volk_alloc.hh>
+#include <volk/volk_executor.h>
+
+namespace volk {
+
+/*!
+ * \brief Chain of stages streaming chunks through bounded buffers
+ *
+ * \details
+ * Stages are added in order: one source, any number of stages, one sink.
+ * Each stage after the source takes the element type the one before it
+ * produces, and produces as many points as it takes. Adding stages that
+ * do not fit throws std::logic_error.
+ */
+class pipeline
+{
+public:
+    //! chunks of at most chunk_len points, depth buffers between two stages
+    explicit pipeline(std::size_t chunk_len, std::size_t depth = 2)
+        : _chunk_len(chunk_len), _depth(depth ? depth : 1)
+    {
+    }
+
+    pipeline(pipeline const&) = delete;
+    pipeline& operator=(pipeline const&) = delete;
+
+    /*!
+     * The first stage; read fills up to out.size() points and returns how
+     * many it wrote, 0 at the end of the stream.
+     */
+    template <class T>
+    pipeline& source(std::function<std::size_t(aligned_span<T>)> read)
+    {
+        if (!_stages.empty())
+            throw std::logic_error("volk::pipeline: the source must come first");
+        _stages.push_back(
+            [read = std::move(read)](const void*, void* out, std::size_t n) {
+                return read(aligned_span<T>(static_cast<T*>(out), n));
+            });
+        _type = &typeid(T);
+        return *this;
+    }
+
+    //! A stage writing a point of out for every point of in
+    template <class In, class Out>
+    pipeline& stage(std::function<void(aligned_span<const In>, aligned_span<Out>)> fn)
+    {
+        add_link(typeid(In), sizeof(In));
+        _stages.push_back([fn = std::move(fn)](const void* in, void* out, std::size_t n) {
+            fn(aligned_span<const In>(static_cast<const In*>(in), n),
+               aligned_span<Out>(static_cast<Out*>(out), n));
+            return n;
+        });
+        _type = &typeid(Out);
+        return *this;
+    }
+
+    //! A stage calling a kernel such as volk_16ic_convert_32fc on each chunk
+    template <class In, class Out>
+    pipeline& stage(void (*kernel)(Out*, const In*, unsigned int))
+    {
+        return stage<In, Out>([kernel](aligned_span<const In> in, aligned_span<Out> out) {
+            kernel(out.data(), in.data(), static_cast<unsigned int>(in.size()));
+        });
+    }
+
+    //! The last stage, called on every chunk in order
+    template <class T>
+    pipeline& sink(std::function<void(aligned_span<const T>)> write)
+    {
+        add_link(typeid(T), sizeof(T));
+        _stages.push_back(
+            [write = std::move(write)](const void* in, void*, std::size_t n) {
+                write(aligned_span<const T>(static_cast<const T*>(in), n));
+                return n;
+            });
+        _type = nullptr;
+        return *this;
+    }
+
+    /*!
+     * Stream until the source returns 0 and the sink has written every
+     * chunk. An exception thrown by a stage stops the stream and is thrown
+     * again here. The pipeline can run again afterwards.
+     */
+    void run()
+    {
+        if (_stages.size() < 2 || _type)
+            throw std::logic_error("volk::pipeline: needs a source and a sink");
+
+        std::size_t size = 0;
+        for (auto& l : _links)
+            size += _depth * (buffer_size(l) + VOLK_MAX_ALIGNMENT);
+        volk::arena buffers(size);
+        for (auto& l : _links) {
+            l.free.clear();
+            l.full.clear();
+            l.closed = false;
+            for (std::size_t i = 0; i < _depth; i++) {
+                void* b =
+                    volk_arena_alloc(buffers.get(), buffer_size(l), VOLK_MAX_ALIGNMENT);
+                if (!b)
+                    throw std::bad_alloc();
+                l.free.push_back(b);
+            }
+        }
+
+        _running = _stages.size();
+        _done = false;
+        _error = nullptr;
+        for (std::size_t i = 0; i < _stages.size(); i++) {
+            _tasks.push_back(run_stage(i).handle);
+            _ready.push_back(_tasks.back());
+        }
+        volk_run_tasks(_stages.size(), &pipeline::drive, this);
+        for (auto h : _tasks)
+            h.destroy();
+        _tasks.clear();
+        _ready.clear();
+        if (_error)
+            std::rethrow_exception(_error);
+    }
+
+private:
+    // the buffers between two stages, a producer and a consumer
+    struct link {
+        std::size_t item_size = 0;
+        std::vector<void*> free;                         // empty buffers
+        std::deque<std::pair<void*, std::size_t>> full; // filled, in order
+        bool closed = false;                             // the producer is done
+        std::coroutine_handle<> producer, consumer;      // waiting, if any
+    };
+
+    // a stage, started suspended and destroyed by run
+    struct task {
+        struct promise_type {
+            task get_return_object()
+            {
+                return { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    // wait for an empty buffer of l to fill; the awaiter lives in the frame,
+    // which another thread may resume as soon as the lock is released
+    struct acquire {
+        pipeline* p;
+        link* l;
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h)
+        {
+            std::lock_guard<std::mutex> lock(p->_lock);
+            if (!l->free.empty())
+                return false;
+            l->producer = h;
+            return true;
+        }
+        void* await_resume()
+        {
+            std::lock_guard<std::mutex> lock(p->_lock);
+            void* b = l->free.back();
+            l->free.pop_back();
+            return b;
+        }
+    };
+
+    // wait for the next filled buffer of l, a null one at the end
+    struct next {
+        pipeline* p;
+        link* l;
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h)
+        {
+            std::lock_guard<std::mutex> lock(p->_lock);
+            if (!l->full.empty() || l->closed)
+                return false;
+            l->consumer = h;
+            return true;
+        }
+        std::pair<void*, std::size_t> await_resume()
+        {
+            std::lock_guard<std::mutex> lock(p->_lock);
+            if (l->full.empty())
+                return { nullptr, 0 };
+            auto chunk = l->full.front();
+            l->full.pop_front();
+            return chunk;
+        }
+    };
+
+    std::size_t buffer_size(link const& l) const
+    {
+        const std::size_t bytes = _chunk_len * l.item_size;
+        return (bytes + VOLK_MAX_ALIGNMENT - 1) / VOLK_MAX_ALIGNMENT * VOLK_MAX_ALIGNMENT;
+    }
+
+    void add_link(std::type_info const& type, std::size_t item_size)
+    {
+        if (!_type || *_type != type)
+            throw std::logic_error("volk::pipeline: stage input does not match");
+        _links.emplace_back();
+        _links.back().item_size = item_size;
+    }
+
+    // with the lock held, queue a waiting stage to run
+    void wake(std::coroutine_handle<>& h)
+    {
+        if (h) {
+            _ready.push_back(h);
+            h = nullptr;
+            _work.notify_one();
+        }
+    }
+
+    void push(link* l, void* buffer, std::size_t count)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        l->full.emplace_back(buffer, count);
+        wake(l->consumer);
+    }
+
+    void release(link* l, void* buffer)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        l->free.push_back(buffer);
+        wake(l->producer);
+    }
+
+    void close(link* l)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        l->closed = true;
+        wake(l->consumer);
+    }
+
+    // a stage returned, or threw, which stops the others where they wait
+    void finish(std::exception_ptr error)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (error && !_error)
+            _error = error;
+        if (error || --_running == 0) {
+            _done = true;
+            _work.notify_all();
+        }
+    }
+
+    task run_stage(std::size_t i)
+    {
+        link* in = i ? &_links[i - 1] : nullptr;
+        link* out = i < _links.size() ? &_links[i] : nullptr;
+        std::exception_ptr error;
+        try {
+            for (;;) {
+                std::pair<void*, std::size_t> chunk(nullptr, _chunk_len);
+                if (in) {
+                    chunk = co_await next{ this, in };
+                    if (!chunk.first)
+                        break;
+                }
+                void* buffer = out ? co_await acquire{ this, out } : nullptr;
+                const std::size_t count = _stages[i](chunk.first, buffer, chunk.second);
+                if (in)
+                    release(in, chunk.first);
+                if (!in && !count) {
+                    release(out, buffer);
+                    break;
+                }
+                if (out)
+                    push(out, buffer, count);
+            }
+            if (out)
+                close(out);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        finish(error);
+    }
+
+    // a thread of the run, resuming whichever stage can go on
+    static void drive(void* arg, std::size_t)
+    {
+        pipeline* p = static_cast<pipeline*>(arg);
+        std::unique_lock<std::mutex> lock(p->_lock);
+        for (;;) {
+            while (p->_ready.empty() && !p->_done)
+                p->_work.wait(lock);
+            if (p->_done)
+                break;
+            std::coroutine_handle<> h = p->_ready.front();
+            p->_ready.pop_front();
+            lock.unlock();
+            h.resume();
+            lock.lock();
+        }
+    }
+
+    std::size_t _chunk_len, _depth;
+    std::vector<std::function<std::size_t(const void*, void*, std::size_t)>> _stages;
+    std::vector<link> _links;
+    std::type_info const* _type = nullptr; // produced by the last stage added
+
+    std::mutex _lock; // protects the links and everything below
+    std::condition_variable _work;
+    std::deque<std::coroutine_handle<>> _ready;
+    std::vector<std::coroutine_handle<>> _tasks;
+    std::size_t _running = 0;
+    bool _done = false;
+    std::exception_ptr _error;
+};
+
+} // namespace volk
+#endif // INCLUDED_VOLK_PIPELINE_HH
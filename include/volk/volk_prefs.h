@@ -13,6 +13,33 @@ typedef struct volk_arch_pref {
     char impl_u[128]; // best unaligned impl
 } volk_arch_pref_t;
 
+////////////////////////////////////////////////////////////////////////
+// vector length buckets: kernels taking num_points are ranked once per
+// bucket, so short vectors can use a different implementation than
+// long ones. A bucket covers all lengths up to and including its bound.
+// Bucket preferences are stored in volk_config as "<kernel>@<bound>".
+// The last bucket holds the lengths above the last bound, too large for
+// the caches, where e.g. streaming stores pay off. Its preference is
+// "<kernel>@><bound>"; without one it uses the default preference.
+////////////////////////////////////////////////////////////////////////
+#define VOLK_N_LENGTH_BUCKETS 4
+#define VOLK_LENGTH_BUCKET_BOUND_0 256
+#define VOLK_LENGTH_BUCKET_BOUND_1 4096
+#define VOLK_LENGTH_BUCKET_BOUND_2 262144
+
+static inline size_t volk_get_length_bucket(const size_t num_points)
+{
+    return (num_points > VOLK_LENGTH_BUCKET_BOUND_0) +
+           (num_points > VOLK_LENGTH_BUCKET_BOUND_1) +
+           (num_points > VOLK_LENGTH_BUCKET_BOUND_2);
+}
+
+////////////////////////////////////////////////////////////////////////
+// get the upper length bound of a bucket; returns 0 for the unbounded
+// last bucket and for out of range bucket indices.
+////////////////////////////////////////////////////////////////////////
+VOLK_API unsigned int volk_get_length_bucket_bound(size_t bucket);
+
 ////////////////////////////////////////////////////////////////////////
 // get path to volk_config profiling info; second arguments specifies
 // if config file should be tested on existence for reading.
@@ -20,11 +47,84 @@ typedef struct volk_arch_pref {
 ////////////////////////////////////////////////////////////////////////
 VOLK_API void volk_get_config_path(char*, bool);
 
+////////////////////////////////////////////////////////////////////////
+// get path to the volk_config of this cpu, volk_config.d/<signature>
+// next to volk_config, see volk_get_cpu_signature. Profiles for a
+// heterogeneous fleet can share one config dir this way. When loading,
+// a cpu profile is preferred over volk_config in the same dir.
+////////////////////////////////////////////////////////////////////////
+VOLK_API void volk_get_cpu_config_path(char*, bool);
+
+////////////////////////////////////////////////////////////////////////
+// get the warm-start cache dir of this cpu, volk_cache/<signature> next
+// to volk_config. Plans keep the tables they build there and map them
+// again in later processes. The cache is only used where a volk_cache
+// dir was made by hand; returns \0 in the argument without one.
+////////////////////////////////////////////////////////////////////////
+VOLK_API void volk_get_cache_path(char*);
+
 ////////////////////////////////////////////////////////////////////////
 // load prefs into global prefs struct
 ////////////////////////////////////////////////////////////////////////
 VOLK_API size_t volk_load_preferences(volk_arch_pref_t**);
 
+////////////////////////////////////////////////////////////////////////
+// write prefs into the text config at path: lines of kernels already
+// in the file are replaced, all other lines are kept and kernels new
+// to the file are appended. Returns false on failure.
+////////////////////////////////////////////////////////////////////////
+VOLK_API bool volk_update_preferences(const char* path,
+                                      const volk_arch_pref_t* prefs,
+                                      size_t n_prefs);
+
+////////////////////////////////////////////////////////////////////////
+// write prefs as a compiled config, a sorted index that is mmap'd at
+// load time; volk_profile stores it next to the text config as
+// volk_config.bin. The compiled config is used while it is not older
+// than the text config. Returns false on failure.
+////////////////////////////////////////////////////////////////////////
+VOLK_API bool volk_write_preferences_binary(const char* path,
+                                            const volk_arch_pref_t* prefs,
+                                            size_t n_prefs);
+
+////////////////////////////////////////////////////////////////////////
+// look up the preferred aligned or unaligned impl of a kernel in the
+// loaded profile; returns NULL when the profile has no entry for it.
+////////////////////////////////////////////////////////////////////////
+VOLK_API const char* volk_get_preferred_impl(const char* kern_name, bool align);
+
+////////////////////////////////////////////////////////////////////////
+// read the config again: later lookups see the new preferences and cost
+// models. volk_reload_config() also rebinds the kernels to them.
+////////////////////////////////////////////////////////////////////////
+VOLK_API void volk_reload_preferences(void);
+
+////////////////////////////////////////////////////////////////////////
+// get the cost model volk_profile --sweep fitted for an impl of a kernel:
+// a call on num_points of the given length bucket takes about
+// overhead_ns + ns_per_point * num_points. The text config stores it as
+// "<kernel>~<impl> cost" followed by the overhead and ns per point of
+// each bucket. Returns false when the profile has no model for the impl.
+////////////////////////////////////////////////////////////////////////
+VOLK_API bool volk_get_cost_model(const char* kern_name,
+                                  const char* impl_name,
+                                  size_t bucket,
+                                  double* overhead_ns,
+                                  double* ns_per_point);
+
+////////////////////////////////////////////////////////////////////////
+// get the threading volk_profile --parallel-grain measured for a kernel:
+// its volk_parallel_ variant on num_points of the given length bucket
+// runs on at most n_threads threads, in chunks of at least grain points,
+// and serially below two grains. The text config stores it as
+// "<kernel>~parallel grain" followed by the thread count and grain of
+// each bucket. Returns false when the profile has none for the kernel.
+////////////////////////////////////////////////////////////////////////
+VOLK_API bool volk_get_parallel_grain(const char* kern_name,
+                                      size_t bucket,
+                                      unsigned int* n_threads,
+                                      size_t* grain);
+
 __VOLK_DECL_END
 
 #endif // INCLUDED_VOLK_PREFS_H
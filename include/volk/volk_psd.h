@@ -0,0 +1,111 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Welch power spectral density estimates of complex captures.
+ *
+ * The capture is cut into segments of fft_len points, hop points apart, so
+ * that they overlap for a hop below fft_len. Each segment is windowed, by
+ * volk_32fc_32f_multiply_32fc or volk_32fc_32f_window_fftshift_32fc,
+ * transformed by volk_32fc_fft_32fc and its power added into a running
+ * mean by volk_32fc_s32f_x2_power_average_32f with a weight of 1 / k for
+ * the k-th segment, all through plans made once for the length. A segment
+ * goes through the whole chain in two buffers of fft_len points before the
+ * next is read, so nothing but the capture and the means leaves the cache.
+ *
+ * The segments are shared out in contiguous runs between the
+ * volk_set_num_threads() pool, each thread keeping a mean of its own, and
+ * the means are merged weighted by their segment counts. A run is at least
+ * VOLK_PARALLEL_GRAIN points of transforms, so short captures stay on the
+ * calling thread.
+ *
+ * The estimate is the mean of |X[k]|^2 / (sample_rate * sum of window[n]^2),
+ * the one sided density of scipy.signal.welch with scaling="density", but
+ * for all fft_len bins of a complex signal: a white noise of variance s^2
+ * gives s^2 / sample_rate in every bin.
+ *
+ * example code:
+ *   // 4096 bins with Hann windows overlapping by half
+ *   volk_psd_welch_t* welch = volk_psd_welch_create(4096, 2048, NULL, fs, 0);
+ *   volk_psd_welch_compute(welch, psd, capture, num_points);
+ *   volk_psd_welch_destroy(welch);
+ */
+
+#ifndef INCLUDED_VOLK_PSD_H
+#define INCLUDED_VOLK_PSD_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+__VOLK_DECL_BEGIN
+
+//! A Welch estimator for one segment length, see volk_psd_welch_create()
+typedef struct volk_psd_welch volk_psd_welch_t;
+
+//! Flags: put DC in bin fft_len / 2, as volk_32fc_32f_window_fftshift_32fc does
+#define VOLK_PSD_WELCH_CENTERED 1u
+
+/*!
+ * \brief Make an estimator for segments of fft_len points hop points apart.
+ *
+ * \param fft_len The segment and transform length, a power of two of at
+ * least 2.
+ * \param hop The points from the start of one segment to the next, at least
+ * 1; fft_len / 2 overlaps them by half.
+ * \param window The fft_len window taps, copied; NULL for a periodic Hann
+ * window.
+ * \param sample_rate The sample rate the density is scaled for, 1 for a
+ * density per bin.
+ * \param flags 0 or VOLK_PSD_WELCH_CENTERED.
+ * \return the estimator, NULL if the arguments are out of range or out of
+ * memory
+ */
+VOLK_API volk_psd_welch_t* volk_psd_welch_create(unsigned int fft_len,
+                                                 unsigned int hop,
+                                                 const float* window,
+                                                 float sample_rate,
+                                                 unsigned int flags);
+
+//! Release an estimator and its buffers, NULL is ignored
+VOLK_API void volk_psd_welch_destroy(volk_psd_welch_t* welch);
+
+//! The number of segments of a capture of num_points points, 0 below fft_len
+VOLK_API size_t volk_psd_welch_segments(const volk_psd_welch_t* welch,
+                                        size_t num_points);
+
+/*!
+ * \brief Estimate the density of num_points points into fft_len bins.
+ *
+ * The points after the last whole segment are left out.
+ *
+ * \return 0, or -1 if the capture is shorter than fft_len or out of memory
+ * for the buffers, with psd unchanged
+ */
+VOLK_API int volk_psd_welch_compute(volk_psd_welch_t* welch,
+                                    float* psd,
+                                    const lv_32fc_t* input,
+                                    size_t num_points);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_PSD_H */
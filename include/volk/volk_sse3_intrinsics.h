@@ -60,6 +60,80 @@ static inline __m128 _mm_magnitude_ps_sse3(__m128 cplxValue1, __m128 cplxValue2)
     return _mm_sqrt_ps(_mm_magnitudesquared_ps_sse3(cplxValue1, cplxValue2));
 }
 
+/*
+ * log2(x) for x >= 0 as the exponent plus a degree 6 minimax polynomial of the
+ * mantissa in [1, 2), like volk_32f_log2_32f; the error is below 1e-5 and
+ * 0 maps to -127 as in log2f_non_ieee.
+ */
+static inline __m128 _mm_log2_ps_sse3(const __m128 x)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128i bits = _mm_castps_si128(x);
+    const __m128 exponent = _mm_cvtepi32_ps(_mm_sub_epi32(
+        _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7f800000)), 23),
+        _mm_set1_epi32(127)));
+    const __m128 frac =
+        _mm_or_ps(one, _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7fffff))));
+
+    __m128 mantissa = _mm_set1_ps(-3.4436006e-2f);
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(3.1821337e-1f));
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(-1.2315303f));
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(2.5988452f));
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(-3.3241990f));
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(3.1157899f));
+
+    return _mm_add_ps(_mm_mul_ps(mantissa, _mm_sub_ps(frac, one)), exponent);
+}
+
+/*
+ * sin(x) and cos(x) from one range reduction, as _vsincosq_f32 for NEON:
+ * x is reduced to [-pi/4, pi/4] in three parts (cephes), both minimax
+ * polynomials are evaluated and swapped per octant. The error is within a
+ * few 1e-7 for |x| up to 8192.
+ */
+static inline void _mm_sincos_ps_sse3(__m128 x, __m128* sine, __m128* cosine)
+{
+    const __m128 sign_bit = _mm_set1_ps(-0.f);
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128i four = _mm_set1_epi32(4);
+    __m128 sign_sin = _mm_and_ps(x, sign_bit);
+    x = _mm_andnot_ps(sign_bit, x);
+
+    // octant j of |x|, rounded up to even
+    __m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+    j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+    const __m128 y = _mm_cvtepi32_ps(j);
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));
+
+    sign_sin = _mm_xor_ps(
+        sign_sin, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, four), 29)));
+    const __m128 sign_cos = _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, two), four), 29));
+    // octants 1 and 2 of a quadrant pair take the other polynomial
+    const __m128 swap =
+        _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, two), two));
+
+    const __m128 z = _mm_mul_ps(x, x);
+    __m128 poly_cos = _mm_set1_ps(2.443315711809948e-5f);
+    poly_cos = _mm_add_ps(_mm_mul_ps(poly_cos, z), _mm_set1_ps(-1.388731625493765e-3f));
+    poly_cos = _mm_add_ps(_mm_mul_ps(poly_cos, z), _mm_set1_ps(4.166664568298827e-2f));
+    poly_cos = _mm_mul_ps(_mm_mul_ps(poly_cos, z), z);
+    poly_cos = _mm_sub_ps(poly_cos, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    poly_cos = _mm_add_ps(poly_cos, _mm_set1_ps(1.f));
+
+    __m128 poly_sin = _mm_set1_ps(-1.9515295891e-4f);
+    poly_sin = _mm_add_ps(_mm_mul_ps(poly_sin, z), _mm_set1_ps(8.3321608736e-3f));
+    poly_sin = _mm_add_ps(_mm_mul_ps(poly_sin, z), _mm_set1_ps(-1.6666654611e-1f));
+    poly_sin = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(poly_sin, z), x), x);
+
+    *sine = _mm_xor_ps(
+        _mm_or_ps(_mm_and_ps(swap, poly_cos), _mm_andnot_ps(swap, poly_sin)), sign_sin);
+    *cosine = _mm_xor_ps(
+        _mm_or_ps(_mm_and_ps(swap, poly_sin), _mm_andnot_ps(swap, poly_cos)), sign_cos);
+}
+
 static inline __m128 _mm_scaled_norm_dist_ps_sse3(const __m128 symbols0,
                                                   const __m128 symbols1,
                                                   const __m128 points0,
@@ -77,4 +151,145 @@ static inline __m128 _mm_scaled_norm_dist_ps_sse3(const __m128 symbols0,
     return _mm_mul_ps(norms, scalar);
 }
 
+/*
+ * One radix-4 pass of volk_32fc_fft_32fc, see volk_fft.h: the stages
+ * combining transforms of h and then 2h complex points, in place on
+ * interleaved complex floats. Handles two points per step, h must be even.
+ */
+static inline void _mm_fft_radix4_pass_sse3(float* data,
+                                            unsigned int num_points,
+                                            unsigned int h,
+                                            const float* twiddles)
+{
+    unsigned int block, j;
+    for (block = 0; block < num_points; block += 4 * h) {
+        float* x0 = data + 2 * block;
+        float* x1 = x0 + 2 * h;
+        float* x2 = x1 + 2 * h;
+        float* x3 = x2 + 2 * h;
+        for (j = 0; j < 2 * h; j += 4) {
+            const __m128 w1 = _mm_loadu_ps(twiddles + 2 * h + j);
+            const __m128 w2 = _mm_loadu_ps(twiddles + 4 * h + j);
+            const __m128 w3 = _mm_loadu_ps(twiddles + 6 * h + j);
+            const __m128 a0 = _mm_loadu_ps(x0 + j);
+            const __m128 a2 = _mm_loadu_ps(x2 + j);
+            const __m128 t1 = _mm_complexmul_ps(_mm_loadu_ps(x1 + j), w1);
+            const __m128 t3 = _mm_complexmul_ps(_mm_loadu_ps(x3 + j), w1);
+
+            const __m128 y0 = _mm_add_ps(a0, t1);
+            const __m128 y1 = _mm_sub_ps(a0, t1);
+            const __m128 u2 = _mm_complexmul_ps(_mm_add_ps(a2, t3), w2);
+            const __m128 u3 = _mm_complexmul_ps(_mm_sub_ps(a2, t3), w3);
+            _mm_storeu_ps(x0 + j, _mm_add_ps(y0, u2));
+            _mm_storeu_ps(x2 + j, _mm_sub_ps(y0, u2));
+            _mm_storeu_ps(x1 + j, _mm_add_ps(y1, u3));
+            _mm_storeu_ps(x3 + j, _mm_sub_ps(y1, u3));
+        }
+    }
+}
+
+/*
+ * The decoding loop of the convolutional decoders, see volk_conv.h: num_bits
+ * steps of a rate 1/rate code over num_states states, at least 16. Handles
+ * 16 butterflies per vector, the 8 of a 16 state code in the lower half.
+ */
+static inline void _mm_conv_decode_sse3(unsigned char* Y,
+                                        unsigned char* X,
+                                        const unsigned char* syms,
+                                        unsigned char* dec,
+                                        unsigned int num_bits,
+                                        const unsigned char* Branchtab,
+                                        unsigned int num_states,
+                                        unsigned int rate)
+{
+    const unsigned int half = num_states / 2;
+    const unsigned int shift = rate > 2 ? 2 : 1;
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    const __m128i symbol_mask = _mm_set1_epi8((char)(255 >> shift));
+    const __m128i metric_mask = _mm_set1_epi8(63);
+    const __m128i max_metric =
+        _mm_set1_epi8((char)((rate * (255 >> shift)) >> 2));
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    unsigned int s, i, j;
+    __m128i metric, comp, old0, old1, m0, m1, m2, m3, s0, s1, d0, d1, m;
+
+    for (s = 0; s < num_bits; s++) {
+        for (i = 0; i < half; i += 16) {
+            if (half < 16) {
+                old0 = _mm_loadl_epi64((const __m128i*)old_metrics);
+                old1 = _mm_loadl_epi64((const __m128i*)(old_metrics + half));
+            } else {
+                old0 = _mm_loadu_si128((const __m128i*)(old_metrics + i));
+                old1 = _mm_loadu_si128((const __m128i*)(old_metrics + half + i));
+            }
+
+            // shifted in 16 bit lanes, masked to drop the bits of the next byte
+            metric = _mm_setzero_si128();
+            for (j = 0; j < rate; j++) {
+                const __m128i bt =
+                    half < 16
+                        ? _mm_loadl_epi64((const __m128i*)(Branchtab + j * half))
+                        : _mm_loadu_si128((const __m128i*)(Branchtab + j * half + i));
+                const __m128i diff = _mm_xor_si128(_mm_set1_epi8((char)syms[j]), bt);
+                metric = _mm_add_epi8(
+                    metric, _mm_and_si128(_mm_srl_epi16(diff, shift_count), symbol_mask));
+            }
+            metric = _mm_and_si128(_mm_srli_epi16(metric, 2), metric_mask);
+            comp = _mm_sub_epi8(max_metric, metric);
+
+            m0 = _mm_adds_epu8(old0, metric);
+            m1 = _mm_adds_epu8(old1, comp);
+            m2 = _mm_adds_epu8(old0, comp);
+            m3 = _mm_adds_epu8(old1, metric);
+            s0 = _mm_min_epu8(m0, m1);
+            s1 = _mm_min_epu8(m2, m3);
+            d0 = _mm_cmpeq_epi8(s0, m1);
+            d1 = _mm_cmpeq_epi8(s1, m3);
+
+            // the new states 2i and 2i + 1 are next to each other
+            _mm_storeu_si128((__m128i*)(new_metrics + 2 * i), _mm_unpacklo_epi8(s0, s1));
+            *(unsigned short*)(dec + i / 4) =
+                (unsigned short)_mm_movemask_epi8(_mm_unpacklo_epi8(d0, d1));
+            if (half >= 16) {
+                _mm_storeu_si128((__m128i*)(new_metrics + 2 * i + 16),
+                                 _mm_unpackhi_epi8(s0, s1));
+                *(unsigned short*)(dec + i / 4 + 2) =
+                    (unsigned short)_mm_movemask_epi8(_mm_unpackhi_epi8(d0, d1));
+            }
+        }
+
+        if (new_metrics[0] > 210) {
+            m = _mm_loadu_si128((const __m128i*)new_metrics);
+            for (i = 16; i < num_states; i += 16) {
+                m = _mm_min_epu8(m, _mm_loadu_si128((const __m128i*)(new_metrics + i)));
+            }
+            m = _mm_min_epu8(m, _mm_srli_si128(m, 8));
+            m = _mm_min_epu8(m, _mm_srli_si128(m, 4));
+            m = _mm_min_epu8(m, _mm_srli_si128(m, 2));
+            m = _mm_min_epu8(m, _mm_srli_si128(m, 1));
+            m = _mm_set1_epi8((char)_mm_cvtsi128_si32(m));
+            for (i = 0; i < num_states; i += 16) {
+                _mm_storeu_si128(
+                    (__m128i*)(new_metrics + i),
+                    _mm_subs_epu8(_mm_loadu_si128((const __m128i*)(new_metrics + i)), m));
+            }
+        }
+
+        syms += rate;
+        dec += num_states / 8;
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (old_metrics != X) {
+        for (i = 0; i < num_states; i += 16) {
+            _mm_storeu_si128((__m128i*)(X + i),
+                             _mm_loadu_si128((const __m128i*)(old_metrics + i)));
+        }
+    }
+}
+
 #endif /* INCLUDE_VOLK_VOLK_SSE3_INTRINSICS_H_ */
@@ -0,0 +1,62 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This file is intended to hold SSE4.1 intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-pasta.
+ */
+
+#ifndef INCLUDE_VOLK_VOLK_SSE4_1_INTRINSICS_H_
+#define INCLUDE_VOLK_VOLK_SSE4_1_INTRINSICS_H_
+#include <smmintrin.h>
+
+/* Four quadrant arctangent of y/x, the 4 wide version of _mm256_atan2_ps_avx2 */
+static inline __m128 _mm_atan2_ps_sse4_1(const __m128 y, const __m128 x)
+{
+    const __m128 sign_bit = _mm_set1_ps(-0.f);
+    const __m128 abs_x = _mm_andnot_ps(sign_bit, x);
+    const __m128 abs_y = _mm_andnot_ps(sign_bit, y);
+    const __m128 den = _mm_max_ps(abs_x, abs_y);
+    // 0/0 is 0, as atan2f(0, 0)
+    const __m128 ratio = _mm_andnot_ps(_mm_cmpeq_ps(den, _mm_setzero_ps()),
+                                       _mm_div_ps(_mm_min_ps(abs_x, abs_y), den));
+    const __m128 ratio2 = _mm_mul_ps(ratio, ratio);
+
+    __m128 res = _mm_set1_ps(-0.00478018541f);
+    res = _mm_add_ps(_mm_mul_ps(res, ratio2), _mm_set1_ps(0.0245562103f));
+    res = _mm_add_ps(_mm_mul_ps(res, ratio2), _mm_set1_ps(-0.0599035136f));
+    res = _mm_add_ps(_mm_mul_ps(res, ratio2), _mm_set1_ps(0.0994268283f));
+    res = _mm_add_ps(_mm_mul_ps(res, ratio2), _mm_set1_ps(-0.140293956f));
+    res = _mm_add_ps(_mm_mul_ps(res, ratio2), _mm_set1_ps(0.199713722f));
+    res = _mm_add_ps(_mm_mul_ps(res, ratio2), _mm_set1_ps(-0.333320946f));
+    res = _mm_add_ps(_mm_mul_ps(res, ratio2), _mm_set1_ps(0.99999994f));
+    res = _mm_mul_ps(res, ratio);
+
+    res = _mm_blendv_ps(
+        res, _mm_sub_ps(_mm_set1_ps(1.57079633f), res), _mm_cmpgt_ps(abs_y, abs_x));
+    // blendv picks by the sign bit, so x = -0 gives pi as atan2f does
+    res = _mm_blendv_ps(res, _mm_sub_ps(_mm_set1_ps(3.14159265f), res), x);
+    // take the sign of y
+    return _mm_or_ps(res, _mm_and_ps(y, sign_bit));
+}
+
+#endif /* INCLUDE_VOLK_VOLK_SSE4_1_INTRINSICS_H_ */
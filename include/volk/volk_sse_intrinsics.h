@@ -59,4 +59,65 @@ static inline __m128 _mm_scaled_norm_dist_ps_sse(const __m128 symbols0,
     return _mm_mul_ps(norms, scalar);
 }
 
+/* Inclusive prefix sum of the four floats, in two shift and add steps */
+static inline __m128 _mm_scan_ps(__m128 x)
+{
+    const __m128 shift2 = _mm_movelh_ps(_mm_setzero_ps(), x); // 0, 0, x0, x1
+    x = _mm_add_ps(x, _mm_shuffle_ps(shift2, x, _MM_SHUFFLE(2, 1, 2, 0)));
+    return _mm_add_ps(x, _mm_movelh_ps(_mm_setzero_ps(), x));
+}
+
+/* Inclusive prefix sum of the two complex values */
+static inline __m128 _mm_scan_complex_ps(__m128 x)
+{
+    return _mm_add_ps(x, _mm_movelh_ps(_mm_setzero_ps(), x));
+}
+
+/*
+ * Inclusive scan of the affine maps g -> a * g + b of the four lanes: lane k
+ * becomes the map of lanes 0 to k applied in turn, as a recursion over
+ * samples whose update is linear in its state, in two steps.
+ */
+static inline void _mm_scan_affine_ps(__m128* a, __m128* b)
+{
+    const __m128 one = _mm_set1_ps(1.f);
+    // the map of the lane below runs first, the identity below lane 0
+    __m128 belowA = _mm_move_ss(_mm_shuffle_ps(*a, *a, _MM_SHUFFLE(2, 1, 0, 3)), one);
+    __m128 belowB =
+        _mm_move_ss(_mm_shuffle_ps(*b, *b, _MM_SHUFFLE(2, 1, 0, 3)), _mm_setzero_ps());
+    *b = _mm_add_ps(_mm_mul_ps(*a, belowB), *b);
+    *a = _mm_mul_ps(*a, belowA);
+    belowA = _mm_movelh_ps(one, *a);
+    belowB = _mm_movelh_ps(_mm_setzero_ps(), *b);
+    *b = _mm_add_ps(_mm_mul_ps(*a, belowB), *b);
+    *a = _mm_mul_ps(*a, belowA);
+}
+
+/*
+ * Sorts each lane across the vectors v[0] to v[n - 1] into ascending order,
+ * n a power of two, with a bitonic network whose comparators all put the
+ * minimum first. Each lane sorts a set of its own.
+ */
+static inline void _mm_sort_network_ps(__m128* v, unsigned int n)
+{
+    __m128 low;
+    unsigned int size, step, flip, base, i, j;
+
+    for (size = 2; size <= n; size *= 2) {
+        for (step = size / 2; step > 0; step /= 2) {
+            // the first step compares the halves of each block mirrored
+            flip = step == size / 2 ? size - 1 : step;
+            // i takes the lower index of each pair
+            for (base = 0; base < n; base += 2 * step) {
+                for (i = base; i < base + step; i++) {
+                    j = i ^ flip;
+                    low = _mm_min_ps(v[i], v[j]);
+                    v[j] = _mm_max_ps(v[i], v[j]);
+                    v[i] = low;
+                }
+            }
+        }
+    }
+}
+
 #endif /* INCLUDE_VOLK_VOLK_SSE_INTRINSICS_H_ */
@@ -0,0 +1,117 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Publishing the kernel statistics of volk_get_kernel_stats() in a named
+ * POSIX shared memory segment, for monitoring agents outside the process.
+ *
+ * A thread of the publishing process copies the counters into the segment
+ * every period. The segment is a volk_stats_shm_t header followed by
+ * n_kernels volk_stats_shm_kernel_t records, all guarded by the seqlock
+ * seq: the publisher makes seq odd, writes, then makes it even again. A
+ * reader never blocks the publisher; it copies the segment and retries
+ * if seq was odd or changed meanwhile, see volk_stats_shm_copy(). The
+ * volk-stats tool prints the segments as text or in the Prometheus text
+ * format.
+ */
+
+#ifndef INCLUDED_VOLK_STATS_H
+#define INCLUDED_VOLK_STATS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <volk/volk.h>
+
+__VOLK_DECL_BEGIN
+
+//! "VOLKSTAT" in the first eight bytes of a segment
+#define VOLK_STATS_SHM_MAGIC 0x544154534b4c4f56ull
+#define VOLK_STATS_SHM_VERSION 1
+//! Prefix of the default segment names, followed by the pid
+#define VOLK_STATS_SHM_PREFIX "/volk-stats."
+
+//! The counters of one kernel in a segment
+typedef struct volk_stats_shm_kernel {
+    char name[64];
+    char impl_a[32]; //!< empty until the kernel is resolved
+    char impl_u[32];
+    uint64_t calls;
+    uint64_t points;
+    uint64_t bytes;
+    uint64_t lengths[VOLK_STATS_LENGTH_BINS]; //!< as in volk_kernel_stats_t
+} volk_stats_shm_kernel_t;
+
+//! The header of a segment, followed by the kernel records
+typedef struct volk_stats_shm {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t n_kernels;
+    uint32_t kernel_size; //!< sizeof(volk_stats_shm_kernel_t) of the publisher
+    uint32_t period_ms;
+    uint64_t seq;     //!< odd while the publisher writes
+    int64_t pid;
+    uint64_t updated; //!< CLOCK_REALTIME of the last copy, in ns
+    char process[32]; //!< the command name of the publisher, if known
+    char machine[32];
+} volk_stats_shm_t;
+
+//! The kernel records after a segment header
+static inline volk_stats_shm_kernel_t* volk_stats_shm_kernels(volk_stats_shm_t* shm)
+{
+    return (volk_stats_shm_kernel_t*)(shm + 1);
+}
+
+/*!
+ * \brief Publish the kernel statistics in a shared memory segment.
+ *
+ * Creates the segment, or replaces one of the same name, and starts the
+ * thread copying the counters into it. A second call moves publishing
+ * to the new name. The segment is unlinked when publishing stops or the
+ * process exits. Setting the VOLK_STATS_SHM environment variable to a
+ * name, or to nothing for the default one, publishes from the first
+ * kernel call on.
+ *
+ * \param name The segment name, or "" for VOLK_STATS_SHM_PREFIX and the
+ * pid. A name without a leading '/' gets one. NULL stops publishing.
+ * \param period_ms The time between copies, 0 for 1000 ms.
+ * \return false if the statistics were not built in (see
+ * volk_get_kernel_stats()), the platform has no POSIX shared memory or
+ * the segment could not be created
+ */
+VOLK_API bool volk_publish_kernel_stats(const char* name, unsigned int period_ms);
+
+/*!
+ * \brief Take a consistent copy of a mapped segment.
+ *
+ * \param shm The segment, e.g. mapped read only by a monitoring agent.
+ * \param copy Where to copy bytes of it to.
+ * \param bytes The size of the segment.
+ * \return false if the segment is no VOLK statistics segment of this
+ * layout, or was being written on every one of many tries
+ */
+VOLK_API bool
+volk_stats_shm_copy(const volk_stats_shm_t* shm, volk_stats_shm_t* copy, size_t bytes);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_STATS_H */
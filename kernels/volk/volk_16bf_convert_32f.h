@@ -0,0 +1,232 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16bf_convert_32f
+ *
+ * \b Overview
+ *
+ * Converts bfloat16 values, the upper 16 bits of a float stored as their
+ * uint16_t bit patterns, into floats. The conversion is exact.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16bf_convert_32f(float* outputVector, const uint16_t* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The bfloat16 bit patterns to convert.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The floats.
+ *
+ * \b Example
+ * Read back a ramp stored in bfloat16.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint16_t* bf = (uint16_t*)volk_malloc(sizeof(uint16_t)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.1f * ii;
+ *   }
+ *
+ *   volk_32f_convert_16bf(bf, in, N);
+ *   volk_16bf_convert_32f(out, bf, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %1.6f, error %g\n", ii, out[ii], out[ii] - in[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(bf);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16bf_convert_32f_u_H
+#define INCLUDED_volk_16bf_convert_32f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_half.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16bf_convert_32f_generic(float* outputVector,
+                                                 const uint16_t* inputVector,
+                                                 unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = volk_bfloat16_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16bf_convert_32f_u_avx512f(float* outputVector,
+                                                   const uint16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    __m512i words;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        words = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)inputVectorPtr));
+        _mm512_storeu_si512(outputVectorPtr, _mm512_slli_epi32(words, 16));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_bfloat16_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16bf_convert_32f_u_avx2(float* outputVector,
+                                                const uint16_t* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    __m256i words;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        words = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)inputVectorPtr));
+        _mm256_storeu_si256((__m256i*)outputVectorPtr, _mm256_slli_epi32(words, 16));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_bfloat16_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16bf_convert_32f_neon(float* outputVector,
+                                              const uint16_t* inputVector,
+                                              unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    uint16x8_t halves;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        halves = vld1q_u16(inputVectorPtr);
+        vst1q_u32((uint32_t*)outputVectorPtr, vshll_n_u16(vget_low_u16(halves), 16));
+        vst1q_u32((uint32_t*)outputVectorPtr + 4, vshll_n_u16(vget_high_u16(halves), 16));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_bfloat16_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16bf_convert_32f_u_H */
+
+#ifndef INCLUDED_volk_16bf_convert_32f_a_H
+#define INCLUDED_volk_16bf_convert_32f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_half.h>
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16bf_convert_32f_a_avx512f(float* outputVector,
+                                                   const uint16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    __m512i words;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        words = _mm512_cvtepu16_epi32(_mm256_load_si256((const __m256i*)inputVectorPtr));
+        _mm512_store_si512(outputVectorPtr, _mm512_slli_epi32(words, 16));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_bfloat16_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16bf_convert_32f_a_avx2(float* outputVector,
+                                                const uint16_t* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    __m256i words;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        words = _mm256_cvtepu16_epi32(_mm_load_si128((const __m128i*)inputVectorPtr));
+        _mm256_store_si256((__m256i*)outputVectorPtr, _mm256_slli_epi32(words, 16));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_bfloat16_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_16bf_convert_32f_a_H */
@@ -0,0 +1,150 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16bfc_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex bfloat16 values, the real and imaginary parts interleaved
+ * as for lv_32fc_t, each the uint16_t bit pattern of the upper half of a
+ * float, into complex floats. The conversion is exact.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16bfc_convert_32fc(lv_32fc_t* outputVector, const uint16_t* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The 2 * num_points bfloat16 bit patterns to convert.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * Store a complex tone in bfloat16 and read it back.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   uint16_t* bf = (uint16_t*)volk_malloc(2*sizeof(uint16_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cosf(0.3f * ii), sinf(0.3f * ii));
+ *   }
+ *
+ *   volk_32fc_convert_16bfc(bf, in, N);
+ *   volk_16bfc_convert_32fc(out, bf, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.6f %+1.6fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(bf);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16bfc_convert_32fc_u_H
+#define INCLUDED_volk_16bfc_convert_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_16bf_convert_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16bfc_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                   const uint16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    volk_16bf_convert_32f_generic((float*)outputVector, inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_16bfc_convert_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                     const uint16_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_16bf_convert_32f_u_avx512f((float*)outputVector, inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16bfc_convert_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_16bf_convert_32f_u_avx2((float*)outputVector, inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_16bfc_convert_32fc_neon(lv_32fc_t* outputVector,
+                                                const uint16_t* inputVector,
+                                                unsigned int num_points)
+{
+    volk_16bf_convert_32f_neon((float*)outputVector, inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16bfc_convert_32fc_u_H */
+
+#ifndef INCLUDED_volk_16bfc_convert_32fc_a_H
+#define INCLUDED_volk_16bfc_convert_32fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_16bf_convert_32f.h>
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_16bfc_convert_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                                     const uint16_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_16bf_convert_32f_a_avx512f((float*)outputVector, inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16bfc_convert_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_16bf_convert_32f_a_avx2((float*)outputVector, inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_16bfc_convert_32fc_a_H */
@@ -0,0 +1,233 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16f_convert_32f
+ *
+ * \b Overview
+ *
+ * Converts half precision values, IEEE 754 binary16 stored as their uint16_t
+ * bit patterns, into floats. Every half, subnormals included, is exact in a
+ * float; NaNs are quieted.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16f_convert_32f(float* outputVector, const uint16_t* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The half precision bit patterns to convert.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The floats.
+ *
+ * \b Example
+ * Read back a ramp stored in half precision.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint16_t* half = (uint16_t*)volk_malloc(sizeof(uint16_t)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.1f * ii;
+ *   }
+ *
+ *   volk_32f_convert_16f(half, in, N);
+ *   volk_16f_convert_32f(out, half, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %1.6f, error %g\n", ii, out[ii], out[ii] - in[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(half);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16f_convert_32f_u_H
+#define INCLUDED_volk_16f_convert_32f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_half.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16f_convert_32f_generic(float* outputVector,
+                                                const uint16_t* inputVector,
+                                                unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = volk_half_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_u_avx512f(float* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        _mm512_storeu_ps(
+            outputVectorPtr,
+            _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)inputVectorPtr)));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_half_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_u_avx_f16c(float* outputVector,
+                                                   const uint16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        _mm256_storeu_ps(
+            outputVectorPtr,
+            _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)inputVectorPtr)));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_half_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16f_convert_32f_neonv8(float* outputVector,
+                                               const uint16_t* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    float16x8_t halves;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        halves = vreinterpretq_f16_u16(vld1q_u16(inputVectorPtr));
+        vst1q_f32(outputVectorPtr, vcvt_f32_f16(vget_low_f16(halves)));
+        vst1q_f32(outputVectorPtr + 4, vcvt_high_f32_f16(halves));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_half_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16f_convert_32f_u_H */
+
+#ifndef INCLUDED_volk_16f_convert_32f_a_H
+#define INCLUDED_volk_16f_convert_32f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_half.h>
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_a_avx512f(float* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        _mm512_store_ps(
+            outputVectorPtr,
+            _mm512_cvtph_ps(_mm256_load_si256((const __m256i*)inputVectorPtr)));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_half_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_a_avx_f16c(float* outputVector,
+                                                   const uint16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const uint16_t* inputVectorPtr = inputVector;
+    float* outputVectorPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        _mm256_store_ps(
+            outputVectorPtr,
+            _mm256_cvtph_ps(_mm_load_si128((const __m128i*)inputVectorPtr)));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_half_to_float(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+#endif /* INCLUDED_volk_16f_convert_32f_a_H */
@@ -149,6 +149,72 @@ static inline void volk_16i_32fc_dot_prod_32fc_neon(lv_32fc_t* result,
 
 #endif /*LV_HAVE_NEON*/
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16i_32fc_dot_prod_32fc_neonv8(lv_32fc_t* result,
+                                                      const short* input,
+                                                      const lv_32fc_t* taps,
+                                                      unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float res[2];
+    float *realpt = &res[0], *imagpt = &res[1];
+    const short* inputPtr = input;
+    const float* tapsPtr = (float*)taps;
+
+    int16x8_t in01, in23;
+    float32x4_t x0, x1, x2, x3;
+    float32x4x2_t tap0, tap1, tap2, tap3;
+
+    // four pairs of fused sums hide the FMA latency
+    float32x4_t real0 = vdupq_n_f32(0.0f), imag0 = vdupq_n_f32(0.0f);
+    float32x4_t real1 = vdupq_n_f32(0.0f), imag1 = vdupq_n_f32(0.0f);
+    float32x4_t real2 = vdupq_n_f32(0.0f), imag2 = vdupq_n_f32(0.0f);
+    float32x4_t real3 = vdupq_n_f32(0.0f), imag3 = vdupq_n_f32(0.0f);
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        in01 = vld1q_s16(inputPtr);
+        in23 = vld1q_s16(inputPtr + 8);
+        x0 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(in01)));
+        x1 = vcvtq_f32_s32(vmovl_high_s16(in01));
+        x2 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(in23)));
+        x3 = vcvtq_f32_s32(vmovl_high_s16(in23));
+        tap0 = vld2q_f32(tapsPtr);
+        tap1 = vld2q_f32(tapsPtr + 8);
+        tap2 = vld2q_f32(tapsPtr + 16);
+        tap3 = vld2q_f32(tapsPtr + 24);
+
+        real0 = vfmaq_f32(real0, tap0.val[0], x0);
+        imag0 = vfmaq_f32(imag0, tap0.val[1], x0);
+        real1 = vfmaq_f32(real1, tap1.val[0], x1);
+        imag1 = vfmaq_f32(imag1, tap1.val[1], x1);
+        real2 = vfmaq_f32(real2, tap2.val[0], x2);
+        imag2 = vfmaq_f32(imag2, tap2.val[1], x2);
+        real3 = vfmaq_f32(real3, tap3.val[0], x3);
+        imag3 = vfmaq_f32(imag3, tap3.val[1], x3);
+
+        inputPtr += 16;
+        tapsPtr += 32;
+    }
+
+    real0 = vaddq_f32(vaddq_f32(real0, real1), vaddq_f32(real2, real3));
+    imag0 = vaddq_f32(vaddq_f32(imag0, imag1), vaddq_f32(imag2, imag3));
+    *realpt = vaddvq_f32(real0);
+    *imagpt = vaddvq_f32(imag0);
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *realpt += ((*inputPtr) * (*tapsPtr++));
+        *imagpt += ((*inputPtr++) * (*tapsPtr++));
+    }
+
+    *result = *(lv_32fc_t*)(&res[0]);
+}
+
+#endif /*LV_HAVE_NEONV8*/
+
 #if LV_HAVE_SSE && LV_HAVE_MMX
 
 static inline void volk_16i_32fc_dot_prod_32fc_u_sse(lv_32fc_t* result,
@@ -424,6 +490,114 @@ static inline void volk_16i_32fc_dot_prod_32fc_u_avx2(lv_32fc_t* result,
 
 #endif /*LV_HAVE_AVX2*/
 
+#ifdef LV_HAVE_AVX512F
+
+#include <immintrin.h>
+
+static inline void volk_16i_32fc_dot_prod_32fc_u_avx512f(lv_32fc_t* result,
+                                                         const short* input,
+                                                         const lv_32fc_t* taps,
+                                                         unsigned int num_points)
+{
+
+    unsigned int number = 0;
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float res[2];
+    float *realpt = &res[0], *imagpt = &res[1];
+    const short* aPtr = input;
+    const float* bPtr = (float*)taps;
+
+    // i0|i0|i1|i1|...|i7|i7 and i8|i8|...|i15|i15 of 16 inputs
+    const __m512i loIdx =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    const __m512i hiIdx =
+        _mm512_set_epi32(15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8);
+
+    __m512 x0Val, x1Val, x2Val, x3Val;
+
+    // eight independent sums keep both FMA ports busy through the FMA latency
+    __m512 dotProdVal0 = _mm512_setzero_ps();
+    __m512 dotProdVal1 = _mm512_setzero_ps();
+    __m512 dotProdVal2 = _mm512_setzero_ps();
+    __m512 dotProdVal3 = _mm512_setzero_ps();
+    __m512 dotProdVal4 = _mm512_setzero_ps();
+    __m512 dotProdVal5 = _mm512_setzero_ps();
+    __m512 dotProdVal6 = _mm512_setzero_ps();
+    __m512 dotProdVal7 = _mm512_setzero_ps();
+
+    for (; number < sixtyfourthPoints; number++) {
+
+        x0Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i const*)aPtr)));
+        x1Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i const*)(aPtr + 16))));
+        x2Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i const*)(aPtr + 32))));
+        x3Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i const*)(aPtr + 48))));
+
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x0Val), _mm512_loadu_ps(bPtr), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x0Val), _mm512_loadu_ps(bPtr + 16), dotProdVal1);
+        dotProdVal2 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x1Val), _mm512_loadu_ps(bPtr + 32), dotProdVal2);
+        dotProdVal3 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x1Val), _mm512_loadu_ps(bPtr + 48), dotProdVal3);
+        dotProdVal4 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x2Val), _mm512_loadu_ps(bPtr + 64), dotProdVal4);
+        dotProdVal5 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x2Val), _mm512_loadu_ps(bPtr + 80), dotProdVal5);
+        dotProdVal6 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x3Val), _mm512_loadu_ps(bPtr + 96), dotProdVal6);
+        dotProdVal7 = _mm512_fmadd_ps(_mm512_permutexvar_ps(hiIdx, x3Val),
+                                      _mm512_loadu_ps(bPtr + 112),
+                                      dotProdVal7);
+
+        aPtr += 64;
+        bPtr += 128;
+    }
+
+    // the remaining blocks of 16 points
+    for (number = sixtyfourthPoints * 4; number < sixteenthPoints; number++) {
+
+        x0Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i const*)aPtr)));
+
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x0Val), _mm512_loadu_ps(bPtr), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x0Val), _mm512_loadu_ps(bPtr + 16), dotProdVal1);
+
+        aPtr += 16;
+        bPtr += 32;
+    }
+
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal1);
+    dotProdVal2 = _mm512_add_ps(dotProdVal2, dotProdVal3);
+    dotProdVal4 = _mm512_add_ps(dotProdVal4, dotProdVal5);
+    dotProdVal6 = _mm512_add_ps(dotProdVal6, dotProdVal7);
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal2);
+    dotProdVal4 = _mm512_add_ps(dotProdVal4, dotProdVal6);
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal4);
+
+    // the real parts are in the even lanes, the imaginary parts in the odd ones
+    *realpt = _mm512_mask_reduce_add_ps(0x5555, dotProdVal0);
+    *imagpt = _mm512_mask_reduce_add_ps(0xAAAA, dotProdVal0);
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *realpt += ((*aPtr) * (*bPtr++));
+        *imagpt += ((*aPtr++) * (*bPtr++));
+    }
+
+    *result = *(lv_32fc_t*)(&res[0]);
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
 
 #if LV_HAVE_SSE && LV_HAVE_MMX
 
@@ -701,5 +875,112 @@ static inline void volk_16i_32fc_dot_prod_32fc_a_avx2_fma(lv_32fc_t* result,
 
 #endif /*LV_HAVE_AVX2 && LV_HAVE_FMA*/
 
+#ifdef LV_HAVE_AVX512F
+
+#include <immintrin.h>
+
+static inline void volk_16i_32fc_dot_prod_32fc_a_avx512f(lv_32fc_t* result,
+                                                         const short* input,
+                                                         const lv_32fc_t* taps,
+                                                         unsigned int num_points)
+{
+
+    unsigned int number = 0;
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float res[2];
+    float *realpt = &res[0], *imagpt = &res[1];
+    const short* aPtr = input;
+    const float* bPtr = (float*)taps;
+
+    // i0|i0|i1|i1|...|i7|i7 and i8|i8|...|i15|i15 of 16 inputs
+    const __m512i loIdx =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    const __m512i hiIdx =
+        _mm512_set_epi32(15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8);
+
+    __m512 x0Val, x1Val, x2Val, x3Val;
+
+    // eight independent sums keep both FMA ports busy through the FMA latency
+    __m512 dotProdVal0 = _mm512_setzero_ps();
+    __m512 dotProdVal1 = _mm512_setzero_ps();
+    __m512 dotProdVal2 = _mm512_setzero_ps();
+    __m512 dotProdVal3 = _mm512_setzero_ps();
+    __m512 dotProdVal4 = _mm512_setzero_ps();
+    __m512 dotProdVal5 = _mm512_setzero_ps();
+    __m512 dotProdVal6 = _mm512_setzero_ps();
+    __m512 dotProdVal7 = _mm512_setzero_ps();
+
+    for (; number < sixtyfourthPoints; number++) {
+
+        x0Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_load_si256((__m256i const*)aPtr)));
+        x1Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_load_si256((__m256i const*)(aPtr + 16))));
+        x2Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_load_si256((__m256i const*)(aPtr + 32))));
+        x3Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_load_si256((__m256i const*)(aPtr + 48))));
+
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x0Val), _mm512_load_ps(bPtr), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x0Val), _mm512_load_ps(bPtr + 16), dotProdVal1);
+        dotProdVal2 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x1Val), _mm512_load_ps(bPtr + 32), dotProdVal2);
+        dotProdVal3 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x1Val), _mm512_load_ps(bPtr + 48), dotProdVal3);
+        dotProdVal4 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x2Val), _mm512_load_ps(bPtr + 64), dotProdVal4);
+        dotProdVal5 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x2Val), _mm512_load_ps(bPtr + 80), dotProdVal5);
+        dotProdVal6 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x3Val), _mm512_load_ps(bPtr + 96), dotProdVal6);
+        dotProdVal7 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x3Val), _mm512_load_ps(bPtr + 112), dotProdVal7);
+
+        aPtr += 64;
+        bPtr += 128;
+    }
+
+    // the remaining blocks of 16 points
+    for (number = sixtyfourthPoints * 4; number < sixteenthPoints; number++) {
+
+        x0Val = _mm512_cvtepi32_ps(
+            _mm512_cvtepi16_epi32(_mm256_load_si256((__m256i const*)aPtr)));
+
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(loIdx, x0Val), _mm512_load_ps(bPtr), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_permutexvar_ps(hiIdx, x0Val), _mm512_load_ps(bPtr + 16), dotProdVal1);
+
+        aPtr += 16;
+        bPtr += 32;
+    }
+
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal1);
+    dotProdVal2 = _mm512_add_ps(dotProdVal2, dotProdVal3);
+    dotProdVal4 = _mm512_add_ps(dotProdVal4, dotProdVal5);
+    dotProdVal6 = _mm512_add_ps(dotProdVal6, dotProdVal7);
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal2);
+    dotProdVal4 = _mm512_add_ps(dotProdVal4, dotProdVal6);
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal4);
+
+    // the real parts are in the even lanes, the imaginary parts in the odd ones
+    *realpt = _mm512_mask_reduce_add_ps(0x5555, dotProdVal0);
+    *imagpt = _mm512_mask_reduce_add_ps(0xAAAA, dotProdVal0);
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *realpt += ((*aPtr) * (*bPtr++));
+        *imagpt += ((*aPtr++) * (*bPtr++));
+    }
+
+    *result = *(lv_32fc_t*)(&res[0]);
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
 
 #endif /*INCLUDED_volk_16i_32fc_dot_prod_32fc_H*/
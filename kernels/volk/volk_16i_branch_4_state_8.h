@@ -164,6 +164,135 @@ static inline void volk_16i_branch_4_state_8_a_ssse3(short* target,
 
 #endif /*LV_HAVE_SSEs*/
 
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16i_branch_4_state_8_a_avx2(short* target,
+                                                    short* src0,
+                                                    char** permuters,
+                                                    short* cntl2,
+                                                    short* cntl3,
+                                                    short* scalars)
+{
+    const __m256i scalar2 = _mm256_set1_epi16(scalars[2]);
+    const __m256i scalar3 = _mm256_set1_epi16(scalars[3]);
+    // branch i adds scalars[0] when i is even and scalars[1] when i is below 2
+    const __m256i branch01 =
+        _mm256_inserti128_si256(_mm256_set1_epi16(scalars[0] + scalars[1]),
+                                _mm_set1_epi16(scalars[1]),
+                                1);
+    const __m256i branch23 = _mm256_inserti128_si256(
+        _mm256_set1_epi16(scalars[0]), _mm_setzero_si128(), 1);
+    // the eight states in both halves, for two permuters at once
+    const __m256i states =
+        _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)src0));
+    __m256i target01, target23;
+
+    target01 = _mm256_shuffle_epi8(
+        states,
+        _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_load_si128((const __m128i*)permuters[0])),
+            _mm_load_si128((const __m128i*)permuters[1]),
+            1));
+    target23 = _mm256_shuffle_epi8(
+        states,
+        _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_load_si128((const __m128i*)permuters[2])),
+            _mm_load_si128((const __m128i*)permuters[3]),
+            1));
+
+    target01 = _mm256_add_epi16(target01, branch01);
+    target01 = _mm256_add_epi16(
+        target01, _mm256_and_si256(_mm256_load_si256((const __m256i*)cntl2), scalar2));
+    target01 = _mm256_add_epi16(
+        target01, _mm256_and_si256(_mm256_load_si256((const __m256i*)cntl3), scalar3));
+    target23 = _mm256_add_epi16(target23, branch23);
+    target23 = _mm256_add_epi16(
+        target23,
+        _mm256_and_si256(_mm256_load_si256((const __m256i*)(cntl2 + 16)), scalar2));
+    target23 = _mm256_add_epi16(
+        target23,
+        _mm256_and_si256(_mm256_load_si256((const __m256i*)(cntl3 + 16)), scalar3));
+
+    _mm256_store_si256((__m256i*)target, target01);
+    _mm256_store_si256((__m256i*)(target + 16), target23);
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16i_branch_4_state_8_a_avx512bw(short* target,
+                                                        short* src0,
+                                                        char** permuters,
+                                                        short* cntl2,
+                                                        short* cntl3,
+                                                        short* scalars)
+{
+    // branch i adds scalars[0] when i is even and scalars[1] when i is below 2
+    __m512i branches =
+        _mm512_castsi128_si512(_mm_set1_epi16(scalars[0] + scalars[1]));
+    __m512i permute =
+        _mm512_castsi128_si512(_mm_load_si128((const __m128i*)permuters[0]));
+    __m512i result;
+
+    branches = _mm512_inserti32x4(branches, _mm_set1_epi16(scalars[1]), 1);
+    branches = _mm512_inserti32x4(branches, _mm_set1_epi16(scalars[0]), 2);
+    branches = _mm512_inserti32x4(branches, _mm_setzero_si128(), 3);
+    permute =
+        _mm512_inserti32x4(permute, _mm_load_si128((const __m128i*)permuters[1]), 1);
+    permute =
+        _mm512_inserti32x4(permute, _mm_load_si128((const __m128i*)permuters[2]), 2);
+    permute =
+        _mm512_inserti32x4(permute, _mm_load_si128((const __m128i*)permuters[3]), 3);
+
+    // all four permutations of the eight states at once
+    result = _mm512_shuffle_epi8(
+        _mm512_broadcast_i32x4(_mm_load_si128((const __m128i*)src0)), permute);
+    result = _mm512_add_epi16(result, branches);
+    result = _mm512_add_epi16(result,
+                              _mm512_and_si512(_mm512_load_si512((const void*)cntl2),
+                                               _mm512_set1_epi16(scalars[2])));
+    result = _mm512_add_epi16(result,
+                              _mm512_and_si512(_mm512_load_si512((const void*)cntl3),
+                                               _mm512_set1_epi16(scalars[3])));
+    _mm512_store_si512((void*)target, result);
+}
+
+#endif /*LV_HAVE_AVX512F && LV_HAVE_AVX512BW*/
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16i_branch_4_state_8_neonv8(short* target,
+                                                    short* src0,
+                                                    char** permuters,
+                                                    short* cntl2,
+                                                    short* cntl3,
+                                                    short* scalars)
+{
+    const uint8x16_t states = vld1q_u8((const uint8_t*)src0);
+    const int16x8_t scalar2 = vdupq_n_s16(scalars[2]);
+    const int16x8_t scalar3 = vdupq_n_s16(scalars[3]);
+    int16x8_t result;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        // the table lookup zeroes the out of range indices as pshufb does
+        result = vreinterpretq_s16_u8(
+            vqtbl1q_u8(states, vld1q_u8((const uint8_t*)permuters[i])));
+        result = vaddq_s16(
+            result,
+            vdupq_n_s16((i + 1) % 2 * scalars[0] + ((i >> 1) ^ 1) * scalars[1]));
+        result = vaddq_s16(result, vandq_s16(vld1q_s16(cntl2 + 8 * i), scalar2));
+        result = vaddq_s16(result, vandq_s16(vld1q_s16(cntl3 + 8 * i), scalar3));
+        vst1q_s16(target + 8 * i, result);
+    }
+}
+
+#endif /*LV_HAVE_NEONV8*/
+
 #ifdef LV_HAVE_GENERIC
 static inline void volk_16i_branch_4_state_8_generic(short* target,
                                                      short* src0,
@@ -0,0 +1,136 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_16i_branch_4_state_8.h'
+ */
+
+#ifndef INCLUDED_volk_16i_branch_4_state_8puppet_16i_H
+#define INCLUDED_volk_16i_branch_4_state_8puppet_16i_H
+
+#include <string.h>
+#include <volk/volk_16i_branch_4_state_8.h>
+
+/*
+ * Runs one call per block of 32 points. The block holds the eight states in
+ * its first points and is the cntl2 of the call, cntl3 is the block reversed.
+ * The permuters pick the state of each output by the low bits of its point
+ * in the block and the scalars are points 8 to 11. The points past the last
+ * block are 0.
+ */
+static inline void volk_16i_branch_4_state_8_puppet(
+    void (*kernel)(short*, short*, char**, short*, short*, short*),
+    short* target,
+    short* src0,
+    unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) short cntl3[32];
+    __VOLK_ATTR_ALIGNED(16) char permute[4][16];
+    __VOLK_ATTR_ALIGNED(16) short scalars[8] = { 0 };
+    char* permuters[4] = { permute[0], permute[1], permute[2], permute[3] };
+    const unsigned int blocks = num_points / 32;
+    unsigned int block, i, j;
+
+    for (block = 0; block < blocks; block++) {
+        short* points = src0 + 32 * block;
+        for (i = 0; i < 4; i++) {
+            for (j = 0; j < 8; j++) {
+                permute[i][2 * j] = (char)(2 * (points[8 * i + j] & 7));
+                permute[i][2 * j + 1] = (char)(2 * (points[8 * i + j] & 7) + 1);
+            }
+        }
+        for (i = 0; i < 32; i++) {
+            cntl3[i] = points[31 - i];
+        }
+        for (i = 0; i < 4; i++) {
+            scalars[i] = points[8 + i];
+        }
+        kernel(target + 32 * block, points, permuters, points, cntl3, scalars);
+    }
+    memset(target + 32 * blocks, 0, sizeof(short) * (num_points - 32 * blocks));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_branch_4_state_8puppet_16i_generic(short* target,
+                                                               short* src0,
+                                                               unsigned int num_points)
+{
+    volk_16i_branch_4_state_8_puppet(
+        volk_16i_branch_4_state_8_generic, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_16i_branch_4_state_8puppet_16i_a_ssse3(short* target,
+                                                               short* src0,
+                                                               unsigned int num_points)
+{
+    volk_16i_branch_4_state_8_puppet(
+        volk_16i_branch_4_state_8_a_ssse3, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16i_branch_4_state_8puppet_16i_a_avx2(short* target,
+                                                              short* src0,
+                                                              unsigned int num_points)
+{
+    volk_16i_branch_4_state_8_puppet(
+        volk_16i_branch_4_state_8_a_avx2, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+
+static inline void volk_16i_branch_4_state_8puppet_16i_a_avx512bw(
+    short* target, short* src0, unsigned int num_points)
+{
+    volk_16i_branch_4_state_8_puppet(
+        volk_16i_branch_4_state_8_a_avx512bw, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_16i_branch_4_state_8puppet_16i_neonv8(short* target,
+                                                              short* src0,
+                                                              unsigned int num_points)
+{
+    volk_16i_branch_4_state_8_puppet(
+        volk_16i_branch_4_state_8_neonv8, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16i_branch_4_state_8puppet_16i_H */
@@ -0,0 +1,332 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_16i_cic_decimate_32i
+ *
+ * \b Overview
+ *
+ * Decimates 16-bit samples with a cascaded integrator-comb filter of the given
+ * order and a differential delay of 1: order integrators at the input rate,
+ * one output per decimation inputs, and order combs at the output rate. The
+ * response is that of order moving sums of decimation points, with a gain of
+ * decimation^order.
+ *
+ * The integrators and combs wrap modulo 2^32 as a CIC filter is meant to, so
+ * the outputs are exact as long as 16 + order * log2(decimation) bits hold
+ * them, and are the same on every machine. The SIMD versions take each
+ * integrator as a log-step prefix sum of a vector, carrying its last value
+ * into the next vector; the combs run on the decimated outputs.
+ *
+ * The integrators and comb delays are carried from call to call in the state,
+ * so a stream cut into buffers of whole decimation periods is filtered by
+ * passing the same state to every call.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16i_cic_decimate_32i(int32_t* outputVector, const int16_t* inputVector,
+ * int32_t* state, unsigned int order, unsigned int decimation,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: num_points * decimation samples.
+ * \li state: 2 * order values, the integrators from the input on and then the
+ * comb delays, zero to start.
+ * \li order: The number of integrators and of combs, 1 to 8.
+ * \li decimation: The number of inputs per output, at least 1.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li outputVector: The decimated outputs.
+ * \li state: The integrators and comb delays, to carry into the next buffer.
+ *
+ * \b Example
+ * Decimate by 16 with a fourth order filter, whose gain of 2^16 fits.
+ * \code
+ *   unsigned int N = 64;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int16_t* in = (int16_t*)volk_malloc(sizeof(int16_t)*N*16, alignment);
+ *   int32_t* out = (int32_t*)volk_malloc(sizeof(int32_t)*N, alignment);
+ *   int32_t state[8] = { 0 };
+ *
+ *   for(unsigned int ii = 0; ii < N*16; ++ii){
+ *       in[ii] = 1000;
+ *   }
+ *
+ *   volk_16i_cic_decimate_32i(out, in, state, 4, 16, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %f\n", ii, out[ii] / 65536.f);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16i_cic_decimate_32i_H
+#define INCLUDED_volk_16i_cic_decimate_32i_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/* The combs on an output, stride apart in the delays, in unsigned wrapping */
+static inline uint32_t
+volk_cic_comb(uint32_t* delays, unsigned int stride, uint32_t value, unsigned int order)
+{
+    unsigned int stage;
+    for (stage = 0; stage < order; stage++) {
+        const uint32_t delayed = delays[stage * stride];
+        delays[stage * stride] = value;
+        value -= delayed;
+    }
+    return value;
+}
+
+/* The integrators on an input, stride apart, returning the last of them */
+static inline uint32_t volk_cic_integrate(uint32_t* integrators,
+                                          unsigned int stride,
+                                          uint32_t value,
+                                          unsigned int order)
+{
+    unsigned int stage;
+    for (stage = 0; stage < order; stage++) {
+        integrators[stage * stride] += value;
+        value = integrators[stage * stride];
+    }
+    return value;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_cic_decimate_32i_generic(int32_t* outputVector,
+                                                     const int16_t* inputVector,
+                                                     int32_t* state,
+                                                     unsigned int order,
+                                                     unsigned int decimation,
+                                                     unsigned int num_points)
+{
+    uint32_t* integrators = (uint32_t*)state;
+    uint32_t* delays = integrators + order;
+    uint32_t value = 0;
+    unsigned int number, k;
+
+    for (number = 0; number < num_points; number++) {
+        for (k = 0; k < decimation; k++) {
+            value = volk_cic_integrate(integrators, 1, (uint32_t)*inputVector++, order);
+        }
+        outputVector[number] = (int32_t)volk_cic_comb(delays, 1, value, order);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16i_cic_decimate_32i_u_avx2(int32_t* outputVector,
+                                                    const int16_t* inputVector,
+                                                    int32_t* state,
+                                                    unsigned int order,
+                                                    unsigned int decimation,
+                                                    unsigned int num_points)
+{
+    uint32_t* integrators = (uint32_t*)state;
+    uint32_t* delays = integrators + order;
+    const unsigned int total = num_points * decimation;
+    const unsigned int eighthPoints = total / 8;
+    const __m256i last = _mm256_set1_epi32(7);
+    __VOLK_ATTR_ALIGNED(32) uint32_t lastStage[8];
+    __m256i carry[8];
+    __m256i x;
+    // the inputs up to and including the one of the next output
+    unsigned int countdown = decimation;
+    unsigned int number, stage, lane;
+
+    for (stage = 0; stage < order; stage++) {
+        carry[stage] = _mm256_set1_epi32((int)integrators[stage]);
+    }
+
+    for (number = 0; number < eighthPoints; number++) {
+        x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)inputVector));
+        for (stage = 0; stage < order; stage++) {
+            x = _mm256_add_epi32(_mm256_scan_epi32(x), carry[stage]);
+            carry[stage] = _mm256_permutevar8x32_epi32(x, last);
+        }
+
+        if (countdown <= 8) {
+            _mm256_store_si256((__m256i*)lastStage, x);
+            for (lane = countdown - 1; lane < 8; lane += decimation) {
+                *outputVector++ =
+                    (int32_t)volk_cic_comb(delays, 1, lastStage[lane], order);
+            }
+            countdown = lane - 7;
+        } else {
+            countdown -= 8;
+        }
+        inputVector += 8;
+    }
+
+    for (stage = 0; stage < order; stage++) {
+        integrators[stage] = (uint32_t)_mm256_cvtsi256_si32(carry[stage]);
+    }
+    for (number = eighthPoints * 8; number < total; number++) {
+        const uint32_t value =
+            volk_cic_integrate(integrators, 1, (uint32_t)*inputVector++, order);
+        if (--countdown == 0) {
+            *outputVector++ = (int32_t)volk_cic_comb(delays, 1, value, order);
+            countdown = decimation;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16i_cic_decimate_32i_u_avx512f(int32_t* outputVector,
+                                                       const int16_t* inputVector,
+                                                       int32_t* state,
+                                                       unsigned int order,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    uint32_t* integrators = (uint32_t*)state;
+    uint32_t* delays = integrators + order;
+    const unsigned int total = num_points * decimation;
+    const unsigned int sixteenthPoints = total / 16;
+    const __m512i last = _mm512_set1_epi32(15);
+    __VOLK_ATTR_ALIGNED(64) uint32_t lastStage[16];
+    __m512i carry[8];
+    __m512i x;
+    // the inputs up to and including the one of the next output
+    unsigned int countdown = decimation;
+    unsigned int number, stage, lane;
+
+    for (stage = 0; stage < order; stage++) {
+        carry[stage] = _mm512_set1_epi32((int)integrators[stage]);
+    }
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)inputVector));
+        for (stage = 0; stage < order; stage++) {
+            x = _mm512_add_epi32(_mm512_scan_epi32(x), carry[stage]);
+            carry[stage] = _mm512_permutexvar_epi32(last, x);
+        }
+
+        if (countdown <= 16) {
+            _mm512_store_si512(lastStage, x);
+            for (lane = countdown - 1; lane < 16; lane += decimation) {
+                *outputVector++ =
+                    (int32_t)volk_cic_comb(delays, 1, lastStage[lane], order);
+            }
+            countdown = lane - 15;
+        } else {
+            countdown -= 16;
+        }
+        inputVector += 16;
+    }
+
+    for (stage = 0; stage < order; stage++) {
+        integrators[stage] = (uint32_t)_mm512_cvtsi512_si32(carry[stage]);
+    }
+    for (number = sixteenthPoints * 16; number < total; number++) {
+        const uint32_t value =
+            volk_cic_integrate(integrators, 1, (uint32_t)*inputVector++, order);
+        if (--countdown == 0) {
+            *outputVector++ = (int32_t)volk_cic_comb(delays, 1, value, order);
+            countdown = decimation;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16i_cic_decimate_32i_neon(int32_t* outputVector,
+                                                  const int16_t* inputVector,
+                                                  int32_t* state,
+                                                  unsigned int order,
+                                                  unsigned int decimation,
+                                                  unsigned int num_points)
+{
+    uint32_t* integrators = (uint32_t*)state;
+    uint32_t* delays = integrators + order;
+    const unsigned int total = num_points * decimation;
+    const unsigned int quarterPoints = total / 4;
+    uint32_t lastStage[4];
+    uint32x4_t carry[8];
+    uint32x4_t x;
+    // the inputs up to and including the one of the next output
+    unsigned int countdown = decimation;
+    unsigned int number, stage, lane;
+
+    for (stage = 0; stage < order; stage++) {
+        carry[stage] = vdupq_n_u32(integrators[stage]);
+    }
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = vreinterpretq_u32_s32(vmovl_s16(vld1_s16(inputVector)));
+        for (stage = 0; stage < order; stage++) {
+            x = vaddq_u32(_vscanq_u32(x), carry[stage]);
+            carry[stage] = vdupq_n_u32(vgetq_lane_u32(x, 3));
+        }
+
+        if (countdown <= 4) {
+            vst1q_u32(lastStage, x);
+            for (lane = countdown - 1; lane < 4; lane += decimation) {
+                *outputVector++ =
+                    (int32_t)volk_cic_comb(delays, 1, lastStage[lane], order);
+            }
+            countdown = lane - 3;
+        } else {
+            countdown -= 4;
+        }
+        inputVector += 4;
+    }
+
+    for (stage = 0; stage < order; stage++) {
+        integrators[stage] = vgetq_lane_u32(carry[stage], 0);
+    }
+    for (number = quarterPoints * 4; number < total; number++) {
+        const uint32_t value =
+            volk_cic_integrate(integrators, 1, (uint32_t)*inputVector++, order);
+        if (--countdown == 0) {
+            *outputVector++ = (int32_t)volk_cic_comb(delays, 1, value, order);
+            countdown = decimation;
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_cic_decimate_32i_H */
@@ -0,0 +1,119 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_16i_cic_decimate_32i.h'
+ */
+
+#ifndef INCLUDED_volk_16i_cic_decimatepuppet_32i_H
+#define INCLUDED_volk_16i_cic_decimatepuppet_32i_H
+
+#include <string.h>
+#include <volk/volk_16i_cic_decimate_32i.h>
+
+/*
+ * Decimates with a fourth order filter in calls of up to 8 outputs, by 5 and
+ * 17 in turn to take outputs both within and across vectors, carrying the
+ * state from each call into the next, until the input runs out. The outputs
+ * past the last call are 0.
+ */
+static inline void
+volk_16i_cic_decimate_puppet(void (*kernel)(int32_t*,
+                                            const int16_t*,
+                                            int32_t*,
+                                            unsigned int,
+                                            unsigned int,
+                                            unsigned int),
+                             int32_t* outputVector,
+                             const int16_t* inputVector,
+                             unsigned int num_points)
+{
+    int32_t state[8] = { 0 };
+    unsigned int inputs = 0, outputs = 0, decimation = 5, count;
+
+    memset(outputVector, 0, sizeof(*outputVector) * num_points);
+    for (;;) {
+        count = (num_points - inputs) / decimation;
+        count = count < 8 ? count : 8;
+        if (count == 0) {
+            break;
+        }
+        kernel(outputVector + outputs, inputVector + inputs, state, 4, decimation, count);
+        inputs += count * decimation;
+        outputs += count;
+        decimation = 22 - decimation;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_cic_decimatepuppet_32i_generic(int32_t* outputVector,
+                                                           const int16_t* inputVector,
+                                                           unsigned int num_points)
+{
+    volk_16i_cic_decimate_puppet(
+        volk_16i_cic_decimate_32i_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16i_cic_decimatepuppet_32i_u_avx2(int32_t* outputVector,
+                                                          const int16_t* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_16i_cic_decimate_puppet(
+        volk_16i_cic_decimate_32i_u_avx2, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_16i_cic_decimatepuppet_32i_u_avx512f(int32_t* outputVector,
+                                                             const int16_t* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_16i_cic_decimate_puppet(
+        volk_16i_cic_decimate_32i_u_avx512f, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_16i_cic_decimatepuppet_32i_neon(int32_t* outputVector,
+                                                        const int16_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_16i_cic_decimate_puppet(
+        volk_16i_cic_decimate_32i_neon, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_cic_decimatepuppet_32i_H */
@@ -0,0 +1,105 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16i_histogram_32u
+ *
+ * \b Overview
+ *
+ * Counts the values of a vector of 16 bit samples into a histogram of 65536
+ * bins, bin b counting the value b - 32768. The counts are added to the
+ * histogram, so zero it before the first call and keep adding the following
+ * buffers to it.
+ *
+ * The avx512cd version counts 16 samples at a time with conflict detection,
+ * so runs of equal samples do not serialize on the table.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16i_histogram_32u(uint32_t* histogram, const int16_t* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li histogram: The 65536 counts to add to.
+ * \li inputVector: The samples.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li histogram: The counts, with those of the samples added.
+ *
+ * \b Example
+ * The number of samples of a 12 bit ADC at full scale.
+ * \code
+ *   uint32_t* histogram = (uint32_t*)calloc(65536, sizeof(uint32_t));
+ *
+ *   volk_16i_histogram_32u(histogram, samples, N);
+ *
+ *   printf("clipped %u\n", histogram[32768 - 2048] + histogram[32768 + 2047]);
+ *   free(histogram);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16i_histogram_32u_H
+#define INCLUDED_volk_16i_histogram_32u_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_histogram_32u_generic(uint32_t* histogram,
+                                                  const int16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        histogram[(uint16_t)inputVector[number] ^ 0x8000]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16i_histogram_32u_avx512cd(uint32_t* histogram,
+                                                   const int16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const __m512i offset = _mm512_set1_epi32(32768);
+    __m512i idx;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        idx = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)inputVector));
+        _mm512_mask_histogram_add_epi32(histogram, 0xffff, _mm512_add_epi32(idx, offset));
+        inputVector += 16;
+    }
+
+    volk_16i_histogram_32u_generic(histogram, inputVector, num_points - number * 16);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_volk_16i_histogram_32u_H */
@@ -55,6 +55,7 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <volk/volk_common.h>
 
 #ifdef LV_HAVE_SSSE3
 
@@ -120,6 +121,79 @@ volk_16i_max_star_16i_a_ssse3(short* target, short* src0, unsigned int num_point
 
 #endif /*LV_HAVE_SSSE3*/
 
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void
+volk_16i_max_star_16i_a_avx2(short* target, short* src0, unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    short candidate = src0[0];
+    __VOLK_ATTR_ALIGNED(32) short cands[16];
+    const short* p_src0 = src0;
+    unsigned int number;
+
+    __m256i max_vec = _mm256_set1_epi16(candidate);
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        max_vec = _mm256_max_epi16(max_vec, _mm256_load_si256((const __m256i*)p_src0));
+        p_src0 += 16;
+    }
+
+    _mm256_store_si256((__m256i*)cands, max_vec);
+
+    for (number = 0; number < 16; ++number) {
+        candidate = ((short)(candidate - cands[number]) > 0) ? candidate : cands[number];
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; ++number) {
+        candidate = ((short)(candidate - src0[number]) > 0) ? candidate : src0[number];
+    }
+
+    target[0] = candidate;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void
+volk_16i_max_star_16i_a_avx512bw(short* target, short* src0, unsigned int num_points)
+{
+    const unsigned int nPerSet = 32;
+    const unsigned int nSets = num_points / nPerSet;
+    const unsigned int nRemaining = num_points % nPerSet;
+
+    short candidate = src0[0];
+    short cands[32];
+    const short* p_src0 = src0;
+
+    __m512i max_vec = _mm512_set1_epi16(candidate);
+
+    for (unsigned int number = 0; number < nSets; number++) {
+        max_vec = _mm512_max_epi16(max_vec, _mm512_load_si512((void*)p_src0));
+        p_src0 += nPerSet;
+    }
+
+    // the masked out lanes of the tail load keep the first point
+    if (nRemaining) {
+        const __mmask32 mask = _cvtu32_mask32((1u << nRemaining) - 1);
+        max_vec = _mm512_max_epi16(max_vec, _mm512_mask_loadu_epi16(max_vec, mask, p_src0));
+    }
+
+    _mm512_storeu_si512((void*)cands, max_vec);
+
+    for (unsigned int i = 0; i < nPerSet; ++i) {
+        candidate = ((short)(candidate - cands[i]) > 0) ? candidate : cands[i];
+    }
+
+    target[0] = candidate;
+}
+
+#endif /*LV_HAVE_AVX512F && LV_HAVE_AVX512BW*/
+
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
 
@@ -166,6 +166,78 @@ static inline void volk_16i_max_star_horizontal_16i_a_ssse3(int16_t* target,
 
 #endif /*LV_HAVE_SSSE3*/
 
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16i_max_star_horizontal_16i_a_avx2(int16_t* target,
+                                                           int16_t* src0,
+                                                           unsigned int num_points)
+{
+    const unsigned int thirtysecondPoints = num_points / 32;
+    __m256i x0, x1, even, odd;
+    unsigned int number;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        x0 = _mm256_load_si256((const __m256i*)src0);
+        x1 = _mm256_load_si256((const __m256i*)(src0 + 16));
+        // the first and the second value of each pair, sign extended and packed back
+        even = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(x0, 16), 16),
+                                  _mm256_srai_epi32(_mm256_slli_epi32(x1, 16), 16));
+        odd = _mm256_packs_epi32(_mm256_srai_epi32(x0, 16), _mm256_srai_epi32(x1, 16));
+        // the packs interleave the 128-bit halves of x0 and x1
+        _mm256_store_si256(
+            (__m256i*)target,
+            _mm256_permute4x64_epi64(_mm256_max_star_epi16(even, odd), 0xd8));
+        src0 += 32;
+        target += 16;
+    }
+
+    for (number = 0; number < num_points % 32; number += 2) {
+        target[number >> 1] = ((int16_t)(src0[number] - src0[number + 1]) > 0)
+                                  ? src0[number]
+                                  : src0[number + 1];
+    }
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16i_max_star_horizontal_16i_a_avx512bw(int16_t* target,
+                                                               int16_t* src0,
+                                                               unsigned int num_points)
+{
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    // the packs interleave the 128-bit lanes of x0 and x1
+    const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+    __m512i x0, x1, even, odd;
+    unsigned int number;
+
+    for (number = 0; number < sixtyfourthPoints; number++) {
+        x0 = _mm512_load_si512((const void*)src0);
+        x1 = _mm512_load_si512((const void*)(src0 + 32));
+        even = _mm512_packs_epi32(_mm512_srai_epi32(_mm512_slli_epi32(x0, 16), 16),
+                                  _mm512_srai_epi32(_mm512_slli_epi32(x1, 16), 16));
+        odd = _mm512_packs_epi32(_mm512_srai_epi32(x0, 16), _mm512_srai_epi32(x1, 16));
+        _mm512_store_si512(
+            (void*)target,
+            _mm512_permutexvar_epi64(order, _mm512_max_star_epi16(even, odd)));
+        src0 += 64;
+        target += 32;
+    }
+
+    for (number = 0; number < num_points % 64; number += 2) {
+        target[number >> 1] = ((int16_t)(src0[number] - src0[number + 1]) > 0)
+                                  ? src0[number]
+                                  : src0[number + 1];
+    }
+}
+
+#endif /*LV_HAVE_AVX512F && LV_HAVE_AVX512BW*/
+
 #ifdef LV_HAVE_NEON
 
 #include <arm_neon.h>
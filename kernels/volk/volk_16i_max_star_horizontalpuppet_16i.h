@@ -0,0 +1,118 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_16i_max_star_horizontal_16i.h'
+ */
+
+#ifndef INCLUDED_volk_16i_max_star_horizontalpuppet_16i_H
+#define INCLUDED_volk_16i_max_star_horizontalpuppet_16i_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_16i_max_star_horizontal_16i.h>
+
+/*
+ * The kernel takes the inputs in pairs, so an odd num_points would read
+ * one past src0; the last input is paired with a zero in a copy instead.
+ */
+static inline void volk_16i_max_star_horizontal_puppet(void (*kernel)(int16_t*,
+                                                                      int16_t*,
+                                                                      unsigned int),
+                                                       int16_t* target,
+                                                       int16_t* src0,
+                                                       unsigned int num_points)
+{
+    const unsigned int even_points = num_points + (num_points & 1);
+    int16_t* paired =
+        (int16_t*)volk_malloc(sizeof(int16_t) * even_points, volk_get_alignment());
+
+    memcpy(paired, src0, sizeof(int16_t) * num_points);
+    if (num_points & 1)
+        paired[num_points] = 0;
+    kernel(target, paired, even_points);
+
+    volk_free(paired);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_max_star_horizontalpuppet_16i_generic(int16_t* target,
+                                                                  int16_t* src0,
+                                                                  unsigned int num_points)
+{
+    volk_16i_max_star_horizontal_puppet(
+        volk_16i_max_star_horizontal_16i_generic, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_16i_max_star_horizontalpuppet_16i_a_ssse3(int16_t* target,
+                                                                  int16_t* src0,
+                                                                  unsigned int num_points)
+{
+    volk_16i_max_star_horizontal_puppet(
+        volk_16i_max_star_horizontal_16i_a_ssse3, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16i_max_star_horizontalpuppet_16i_a_avx2(int16_t* target,
+                                                                 int16_t* src0,
+                                                                 unsigned int num_points)
+{
+    volk_16i_max_star_horizontal_puppet(
+        volk_16i_max_star_horizontal_16i_a_avx2, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+
+static inline void volk_16i_max_star_horizontalpuppet_16i_a_avx512bw(
+    int16_t* target, int16_t* src0, unsigned int num_points)
+{
+    volk_16i_max_star_horizontal_puppet(
+        volk_16i_max_star_horizontal_16i_a_avx512bw, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_16i_max_star_horizontalpuppet_16i_neon(int16_t* target,
+                                                               int16_t* src0,
+                                                               unsigned int num_points)
+{
+    volk_16i_max_star_horizontal_puppet(
+        volk_16i_max_star_horizontal_16i_neon, target, src0, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_max_star_horizontalpuppet_16i_H */
@@ -61,6 +61,7 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <volk/volk_common.h>
 
 #ifdef LV_HAVE_SSE2
 
@@ -174,6 +175,110 @@ static inline void volk_16i_permute_and_scalar_add_a_sse2(short* target,
 #endif /*LV_HAVE_SSE*/
 
 
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16i_permute_and_scalar_add_a_avx2(short* target,
+                                                          short* src0,
+                                                          short* permute_indexes,
+                                                          short* cntl0,
+                                                          short* cntl1,
+                                                          short* cntl2,
+                                                          short* cntl3,
+                                                          short* scalars,
+                                                          unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256i scalar0 = _mm256_set1_epi16(scalars[0]);
+    const __m256i scalar1 = _mm256_set1_epi16(scalars[1]);
+    const __m256i scalar2 = _mm256_set1_epi16(scalars[2]);
+    const __m256i scalar3 = _mm256_set1_epi16(scalars[3]);
+    __VOLK_ATTR_ALIGNED(32) short permuted[16];
+    __m256i sum01, sum23;
+    unsigned int number, k;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // there is no 16-bit gather, the permuted points go through the stack
+        for (k = 0; k < 16; k++) {
+            permuted[k] = src0[permute_indexes[16 * number + k]];
+        }
+
+        sum01 = _mm256_add_epi16(
+            _mm256_and_si256(_mm256_load_si256((const __m256i*)cntl0), scalar0),
+            _mm256_and_si256(_mm256_load_si256((const __m256i*)cntl1), scalar1));
+        sum23 = _mm256_add_epi16(
+            _mm256_and_si256(_mm256_load_si256((const __m256i*)cntl2), scalar2),
+            _mm256_and_si256(_mm256_load_si256((const __m256i*)cntl3), scalar3));
+        _mm256_store_si256(
+            (__m256i*)target,
+            _mm256_add_epi16(_mm256_load_si256((const __m256i*)permuted),
+                             _mm256_add_epi16(sum01, sum23)));
+
+        cntl0 += 16;
+        cntl1 += 16;
+        cntl2 += 16;
+        cntl3 += 16;
+        target += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; ++number) {
+        *target++ = src0[permute_indexes[number]] + (*cntl0++ & scalars[0]) +
+                    (*cntl1++ & scalars[1]) + (*cntl2++ & scalars[2]) +
+                    (*cntl3++ & scalars[3]);
+    }
+}
+#endif /*LV_HAVE_AVX2*/
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16i_permute_and_scalar_add_neon(short* target,
+                                                        short* src0,
+                                                        short* permute_indexes,
+                                                        short* cntl0,
+                                                        short* cntl1,
+                                                        short* cntl2,
+                                                        short* cntl3,
+                                                        short* scalars,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const int16x8_t scalar0 = vdupq_n_s16(scalars[0]);
+    const int16x8_t scalar1 = vdupq_n_s16(scalars[1]);
+    const int16x8_t scalar2 = vdupq_n_s16(scalars[2]);
+    const int16x8_t scalar3 = vdupq_n_s16(scalars[3]);
+    short permuted[8];
+    int16x8_t sum01, sum23;
+    unsigned int number, k;
+
+    for (number = 0; number < eighthPoints; number++) {
+        for (k = 0; k < 8; k++) {
+            permuted[k] = src0[permute_indexes[8 * number + k]];
+        }
+
+        sum01 = vaddq_s16(vandq_s16(vld1q_s16(cntl0), scalar0),
+                          vandq_s16(vld1q_s16(cntl1), scalar1));
+        sum23 = vaddq_s16(vandq_s16(vld1q_s16(cntl2), scalar2),
+                          vandq_s16(vld1q_s16(cntl3), scalar3));
+        vst1q_s16(target, vaddq_s16(vld1q_s16(permuted), vaddq_s16(sum01, sum23)));
+
+        cntl0 += 8;
+        cntl1 += 8;
+        cntl2 += 8;
+        cntl3 += 8;
+        target += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; ++number) {
+        *target++ = src0[permute_indexes[number]] + (*cntl0++ & scalars[0]) +
+                    (*cntl1++ & scalars[1]) + (*cntl2++ & scalars[2]) +
+                    (*cntl3++ & scalars[3]);
+    }
+}
+#endif /*LV_HAVE_NEON*/
+
+
 #ifdef LV_HAVE_GENERIC
 static inline void volk_16i_permute_and_scalar_add_generic(short* target,
                                                            short* src0,
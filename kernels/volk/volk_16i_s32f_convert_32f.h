@@ -57,6 +57,36 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16i_s32f_convert_32f_u_avx512f(float* outputVector,
+                                                       const int16_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(1.0 / scalar);
+    const int16_t* in = inputVector;
+    float* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m256i value = _mm256_loadu_si256((const __m256i*)in);
+        const __m512 ret = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(value));
+        _mm512_storeu_ps(out, _mm512_mul_ps(ret, invScalar));
+        in += 16;
+        out += 16;
+    }
+
+    // a masked load of 16 bit values needs AVX512BW, the tail is scalar
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *out++ = ((float)(*in++)) / scalar;
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -304,6 +334,44 @@ static inline void volk_16i_s32f_convert_32f_neon(float* outputVector,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_16i_s32f_convert_32f_sve(float* outputVector,
+                                                 const int16_t* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    const float invScalar = 1.0f / scalar;
+
+    for (unsigned int number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32_u32(number, num_points);
+        // sign extending load of one int16 per 32 bit lane
+        const svfloat32_t f = svcvt_f32_s32_x(pg, svld1sh_s32(pg, inputVector + number));
+        svst1_f32(pg, outputVector + number, svmul_n_f32_x(pg, f, invScalar));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_16i_s32f_convert_32f_rvv(float* outputVector,
+                                                 const int16_t* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    const float invScalar = 1.0f / scalar;
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, inputVector += vl, outputVector += vl) {
+        vl = __riscv_vsetvl_e16m4(n);
+        // widening convert, int16 to float32 in twice the registers
+        const vfloat32m8_t f = __riscv_vfwcvt_f_x_v_f32m8(__riscv_vle16_v_i16m4(inputVector, vl), vl);
+        __riscv_vse32_v_f32m8(outputVector, __riscv_vfmul_vf_f32m8(f, invScalar, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 
 #endif /* INCLUDED_volk_16i_s32f_convert_32f_u_H */
 #ifndef INCLUDED_volk_16i_s32f_convert_32f_a_H
@@ -312,6 +380,36 @@ static inline void volk_16i_s32f_convert_32f_neon(float* outputVector,
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16i_s32f_convert_32f_a_avx512f(float* outputVector,
+                                                       const int16_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(1.0 / scalar);
+    const int16_t* in = inputVector;
+    float* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m256i value = _mm256_load_si256((const __m256i*)in);
+        const __m512 ret = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(value));
+        _mm512_store_ps(out, _mm512_mul_ps(ret, invScalar));
+        in += 16;
+        out += 16;
+    }
+
+    // a masked load of 16 bit values needs AVX512BW, the tail is scalar
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *out++ = ((float)(*in++)) / scalar;
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -0,0 +1,124 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_16i_x5_add_quad_max_star_16i.h'
+ */
+
+#ifndef INCLUDED_volk_16i_x3_add_quad_max_starpuppet_16i_H
+#define INCLUDED_volk_16i_x3_add_quad_max_starpuppet_16i_H
+
+#include <volk/volk.h>
+#include <volk/volk_16i_x5_add_quad_max_star_16i.h>
+
+/*
+ * Takes the state metrics from src0 and the first two branch metrics from
+ * src1 and src2; the last two are src1 and src2 reversed.
+ */
+static inline void volk_16i_add_quad_max_star_puppet(
+    void (*kernel)(short*, short*, short*, short*, short*, short*, unsigned int),
+    short* target,
+    short* src0,
+    short* src1,
+    short* src2,
+    unsigned int num_points)
+{
+    const size_t alignment = volk_get_alignment();
+    short* src3 = (short*)volk_malloc(sizeof(short) * num_points, alignment);
+    short* src4 = (short*)volk_malloc(sizeof(short) * num_points, alignment);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        src3[number] = src1[num_points - 1 - number];
+        src4[number] = src2[num_points - 1 - number];
+    }
+    kernel(target, src0, src1, src2, src3, src4, num_points);
+
+    volk_free(src3);
+    volk_free(src4);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_x3_add_quad_max_starpuppet_16i_generic(
+    short* target, short* src0, short* src1, short* src2, unsigned int num_points)
+{
+    volk_16i_add_quad_max_star_puppet(volk_16i_x5_add_quad_max_star_16i_generic,
+                                      target,
+                                      src0,
+                                      src1,
+                                      src2,
+                                      num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16i_x3_add_quad_max_starpuppet_16i_u_avx2(
+    short* target, short* src0, short* src1, short* src2, unsigned int num_points)
+{
+    volk_16i_add_quad_max_star_puppet(volk_16i_x5_add_quad_max_star_16i_u_avx2,
+                                      target,
+                                      src0,
+                                      src1,
+                                      src2,
+                                      num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+
+static inline void volk_16i_x3_add_quad_max_starpuppet_16i_u_avx512bw(
+    short* target, short* src0, short* src1, short* src2, unsigned int num_points)
+{
+    volk_16i_add_quad_max_star_puppet(volk_16i_x5_add_quad_max_star_16i_u_avx512bw,
+                                      target,
+                                      src0,
+                                      src1,
+                                      src2,
+                                      num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_16i_x3_add_quad_max_starpuppet_16i_neon(
+    short* target, short* src0, short* src1, short* src2, unsigned int num_points)
+{
+    volk_16i_add_quad_max_star_puppet(volk_16i_x5_add_quad_max_star_16i_neon,
+                                      target,
+                                      src0,
+                                      src1,
+                                      src2,
+                                      num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_x3_add_quad_max_starpuppet_16i_H */
@@ -0,0 +1,124 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_16i_permute_and_scalar_add.h'
+ */
+
+#ifndef INCLUDED_volk_16i_x3_permute_and_scalar_addpuppet_16i_H
+#define INCLUDED_volk_16i_x3_permute_and_scalar_addpuppet_16i_H
+
+#include <volk/volk.h>
+#include <volk/volk_16i_permute_and_scalar_add.h>
+
+/*
+ * Permutes src0 by indexes taken from src1, which stay below num_points and
+ * in range of a short. The controls are src1, src2 and both reversed, the
+ * scalars the first points of src2; the SSE2 version loads them as a vector.
+ */
+static inline void volk_16i_permute_and_scalar_add_puppet(void (*kernel)(short*,
+                                                                         short*,
+                                                                         short*,
+                                                                         short*,
+                                                                         short*,
+                                                                         short*,
+                                                                         short*,
+                                                                         short*,
+                                                                         unsigned int),
+                                                          short* target,
+                                                          short* src0,
+                                                          short* src1,
+                                                          short* src2,
+                                                          unsigned int num_points)
+{
+    const size_t alignment = volk_get_alignment();
+    const unsigned int range = num_points < 32768 ? num_points : 32768;
+    short* indexes = (short*)volk_malloc(sizeof(short) * num_points, alignment);
+    short* cntl2 = (short*)volk_malloc(sizeof(short) * num_points, alignment);
+    short* cntl3 = (short*)volk_malloc(sizeof(short) * num_points, alignment);
+    __VOLK_ATTR_ALIGNED(16) short scalars[8] = { 0 };
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        indexes[number] = (short)((unsigned short)src1[number] % range);
+        cntl2[number] = src1[num_points - 1 - number];
+        cntl3[number] = src2[num_points - 1 - number];
+    }
+    for (number = 0; number < 4 && number < num_points; number++) {
+        scalars[number] = src2[number];
+    }
+    kernel(target, src0, indexes, src1, src2, cntl2, cntl3, scalars, num_points);
+
+    volk_free(indexes);
+    volk_free(cntl2);
+    volk_free(cntl3);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_x3_permute_and_scalar_addpuppet_16i_generic(
+    short* target, short* src0, short* src1, short* src2, unsigned int num_points)
+{
+    volk_16i_permute_and_scalar_add_puppet(
+        volk_16i_permute_and_scalar_add_generic, target, src0, src1, src2, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_16i_x3_permute_and_scalar_addpuppet_16i_a_sse2(
+    short* target, short* src0, short* src1, short* src2, unsigned int num_points)
+{
+    volk_16i_permute_and_scalar_add_puppet(
+        volk_16i_permute_and_scalar_add_a_sse2, target, src0, src1, src2, num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16i_x3_permute_and_scalar_addpuppet_16i_a_avx2(
+    short* target, short* src0, short* src1, short* src2, unsigned int num_points)
+{
+    volk_16i_permute_and_scalar_add_puppet(
+        volk_16i_permute_and_scalar_add_a_avx2, target, src0, src1, src2, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_16i_x3_permute_and_scalar_addpuppet_16i_neon(
+    short* target, short* src0, short* src1, short* src2, unsigned int num_points)
+{
+    volk_16i_permute_and_scalar_add_puppet(
+        volk_16i_permute_and_scalar_add_neon, target, src0, src1, src2, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_x3_permute_and_scalar_addpuppet_16i_H */
@@ -205,6 +205,91 @@ static inline void volk_16i_x4_quad_max_star_16i_a_sse2(short* target,
 
 #endif /*LV_HAVE_SSE2*/
 
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16i_x4_quad_max_star_16i_a_avx2(short* target,
+                                                        short* src0,
+                                                        short* src1,
+                                                        short* src2,
+                                                        short* src3,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m256i max01, max23;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        max01 = _mm256_max_star_epi16(_mm256_load_si256((const __m256i*)src0),
+                                      _mm256_load_si256((const __m256i*)src1));
+        max23 = _mm256_max_star_epi16(_mm256_load_si256((const __m256i*)src2),
+                                      _mm256_load_si256((const __m256i*)src3));
+        _mm256_store_si256((__m256i*)target, _mm256_max_star_epi16(max01, max23));
+        src0 += 16;
+        src1 += 16;
+        src2 += 16;
+        src3 += 16;
+        target += 16;
+    }
+
+    short temp0 = 0;
+    short temp1 = 0;
+    for (number = sixteenthPoints * 16; number < num_points; ++number) {
+        temp0 = ((short)(*src0 - *src1) > 0) ? *src0 : *src1;
+        temp1 = ((short)(*src2 - *src3) > 0) ? *src2 : *src3;
+        *target++ = ((short)(temp0 - temp1) > 0) ? temp0 : temp1;
+        src0++;
+        src1++;
+        src2++;
+        src3++;
+    }
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16i_x4_quad_max_star_16i_a_avx512bw(short* target,
+                                                            short* src0,
+                                                            short* src1,
+                                                            short* src2,
+                                                            short* src3,
+                                                            unsigned int num_points)
+{
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const unsigned int nRemaining = num_points % 32;
+    __m512i max01, max23;
+    unsigned int number;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        max01 = _mm512_max_star_epi16(_mm512_load_si512((const void*)src0),
+                                      _mm512_load_si512((const void*)src1));
+        max23 = _mm512_max_star_epi16(_mm512_load_si512((const void*)src2),
+                                      _mm512_load_si512((const void*)src3));
+        _mm512_store_si512((void*)target, _mm512_max_star_epi16(max01, max23));
+        src0 += 32;
+        src1 += 32;
+        src2 += 32;
+        src3 += 32;
+        target += 32;
+    }
+
+    // the remaining points with masked loads and a masked store
+    if (nRemaining) {
+        const __mmask32 mask = _cvtu32_mask32((1u << nRemaining) - 1);
+        max01 = _mm512_max_star_epi16(_mm512_maskz_loadu_epi16(mask, src0),
+                                      _mm512_maskz_loadu_epi16(mask, src1));
+        max23 = _mm512_max_star_epi16(_mm512_maskz_loadu_epi16(mask, src2),
+                                      _mm512_maskz_loadu_epi16(mask, src3));
+        _mm512_mask_storeu_epi16(target, mask, _mm512_max_star_epi16(max01, max23));
+    }
+}
+
+#endif /*LV_HAVE_AVX512F && LV_HAVE_AVX512BW*/
+
 #ifdef LV_HAVE_NEON
 
 #include <arm_neon.h>
@@ -176,6 +176,128 @@ static inline void volk_16i_x5_add_quad_16i_x4_a_sse2(short* target0,
 }
 #endif /*LV_HAVE_SSE2*/
 
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16i_x5_add_quad_16i_x4_a_avx2(short* target0,
+                                                      short* target1,
+                                                      short* target2,
+                                                      short* target3,
+                                                      short* src0,
+                                                      short* src1,
+                                                      short* src2,
+                                                      short* src3,
+                                                      short* src4,
+                                                      unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m256i src0_vec;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        src0_vec = _mm256_load_si256((const __m256i*)src0);
+        _mm256_store_si256(
+            (__m256i*)target0,
+            _mm256_add_epi16(src0_vec, _mm256_load_si256((const __m256i*)src1)));
+        _mm256_store_si256(
+            (__m256i*)target1,
+            _mm256_add_epi16(src0_vec, _mm256_load_si256((const __m256i*)src2)));
+        _mm256_store_si256(
+            (__m256i*)target2,
+            _mm256_add_epi16(src0_vec, _mm256_load_si256((const __m256i*)src3)));
+        _mm256_store_si256(
+            (__m256i*)target3,
+            _mm256_add_epi16(src0_vec, _mm256_load_si256((const __m256i*)src4)));
+        src0 += 16;
+        src1 += 16;
+        src2 += 16;
+        src3 += 16;
+        src4 += 16;
+        target0 += 16;
+        target1 += 16;
+        target2 += 16;
+        target3 += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; ++number) {
+        *target0++ = *src0 + *src1++;
+        *target1++ = *src0 + *src2++;
+        *target2++ = *src0 + *src3++;
+        *target3++ = *src0++ + *src4++;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16i_x5_add_quad_16i_x4_a_avx512bw(short* target0,
+                                                          short* target1,
+                                                          short* target2,
+                                                          short* target3,
+                                                          short* src0,
+                                                          short* src1,
+                                                          short* src2,
+                                                          short* src3,
+                                                          short* src4,
+                                                          unsigned int num_points)
+{
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const unsigned int nRemaining = num_points % 32;
+    __m512i src0_vec;
+    unsigned int number;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        src0_vec = _mm512_load_si512((const void*)src0);
+        _mm512_store_si512(
+            (void*)target0,
+            _mm512_add_epi16(src0_vec, _mm512_load_si512((const void*)src1)));
+        _mm512_store_si512(
+            (void*)target1,
+            _mm512_add_epi16(src0_vec, _mm512_load_si512((const void*)src2)));
+        _mm512_store_si512(
+            (void*)target2,
+            _mm512_add_epi16(src0_vec, _mm512_load_si512((const void*)src3)));
+        _mm512_store_si512(
+            (void*)target3,
+            _mm512_add_epi16(src0_vec, _mm512_load_si512((const void*)src4)));
+        src0 += 32;
+        src1 += 32;
+        src2 += 32;
+        src3 += 32;
+        src4 += 32;
+        target0 += 32;
+        target1 += 32;
+        target2 += 32;
+        target3 += 32;
+    }
+
+    // the remaining points with masked loads and masked stores
+    if (nRemaining) {
+        const __mmask32 mask = _cvtu32_mask32((1u << nRemaining) - 1);
+        src0_vec = _mm512_maskz_loadu_epi16(mask, src0);
+        _mm512_mask_storeu_epi16(
+            target0,
+            mask,
+            _mm512_add_epi16(src0_vec, _mm512_maskz_loadu_epi16(mask, src1)));
+        _mm512_mask_storeu_epi16(
+            target1,
+            mask,
+            _mm512_add_epi16(src0_vec, _mm512_maskz_loadu_epi16(mask, src2)));
+        _mm512_mask_storeu_epi16(
+            target2,
+            mask,
+            _mm512_add_epi16(src0_vec, _mm512_maskz_loadu_epi16(mask, src3)));
+        _mm512_mask_storeu_epi16(
+            target3,
+            mask,
+            _mm512_add_epi16(src0_vec, _mm512_maskz_loadu_epi16(mask, src4)));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
 
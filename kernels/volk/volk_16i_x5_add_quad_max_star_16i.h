@@ -0,0 +1,237 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16i_x5_add_quad_max_star_16i
+ *
+ * \b Overview
+ *
+ * One trellis step of a turbo decoder in a single pass: adds src0 to each of
+ * the four branch metrics src1 to src4 and keeps the max* of the four sums,
+ * as volk_16i_x5_add_quad_16i_x4 followed by volk_16i_x4_quad_max_star_16i
+ * do, without the four intermediate vectors. As there, the max* of a and b
+ * is a where a - b wrapped to 16 bits is positive, else b, and the sums wrap.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16i_x5_add_quad_max_star_16i(short* target, short* src0, short* src1,
+ * short* src2, short* src3, short* src4, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li src0: The state metrics.
+ * \li src1: The branch metrics of the first branch.
+ * \li src2: The branch metrics of the second branch.
+ * \li src3: The branch metrics of the third branch.
+ * \li src4: The branch metrics of the fourth branch.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li target: max*(max*(src0 + src1, src0 + src2), max*(src0 + src3, src0 + src4)).
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 64;
+ *   unsigned int alignment = volk_get_alignment();
+ *   short* metrics = (short*)volk_malloc(sizeof(short) * N, alignment);
+ *   short* branches = (short*)volk_malloc(sizeof(short) * 4 * N, alignment);
+ *   short* next = (short*)volk_malloc(sizeof(short) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       metrics[ii] = ii;
+ *       for (unsigned int b = 0; b < 4; ++b) {
+ *           branches[b * N + ii] = (ii + b) % 5;
+ *       }
+ *   }
+ *
+ *   volk_16i_x5_add_quad_max_star_16i(next,
+ *                                     metrics,
+ *                                     branches,
+ *                                     branches + N,
+ *                                     branches + 2 * N,
+ *                                     branches + 3 * N,
+ *                                     N);
+ *
+ *   volk_free(metrics);
+ *   volk_free(branches);
+ *   volk_free(next);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16i_x5_add_quad_max_star_16i_H
+#define INCLUDED_volk_16i_x5_add_quad_max_star_16i_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/* The max* of the four sums of one point */
+static inline short volk_16i_add_quad_max_star(short src0,
+                                               short src1,
+                                               short src2,
+                                               short src3,
+                                               short src4)
+{
+    const short sum1 = src0 + src1;
+    const short sum2 = src0 + src2;
+    const short sum3 = src0 + src3;
+    const short sum4 = src0 + src4;
+    const short max12 = ((short)(sum1 - sum2) > 0) ? sum1 : sum2;
+    const short max34 = ((short)(sum3 - sum4) > 0) ? sum3 : sum4;
+    return ((short)(max12 - max34) > 0) ? max12 : max34;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_x5_add_quad_max_star_16i_generic(short* target,
+                                                             short* src0,
+                                                             short* src1,
+                                                             short* src2,
+                                                             short* src3,
+                                                             short* src4,
+                                                             unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; ++number) {
+        target[number] = volk_16i_add_quad_max_star(
+            src0[number], src1[number], src2[number], src3[number], src4[number]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16i_x5_add_quad_max_star_16i_u_avx2(short* target,
+                                                            short* src0,
+                                                            short* src1,
+                                                            short* src2,
+                                                            short* src3,
+                                                            short* src4,
+                                                            unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m256i metrics, max12, max34;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        metrics = _mm256_loadu_si256((const __m256i*)src0);
+        max12 = _mm256_max_star_epi16(
+            _mm256_add_epi16(metrics, _mm256_loadu_si256((const __m256i*)src1)),
+            _mm256_add_epi16(metrics, _mm256_loadu_si256((const __m256i*)src2)));
+        max34 = _mm256_max_star_epi16(
+            _mm256_add_epi16(metrics, _mm256_loadu_si256((const __m256i*)src3)),
+            _mm256_add_epi16(metrics, _mm256_loadu_si256((const __m256i*)src4)));
+        _mm256_storeu_si256((__m256i*)target, _mm256_max_star_epi16(max12, max34));
+        src0 += 16;
+        src1 += 16;
+        src2 += 16;
+        src3 += 16;
+        src4 += 16;
+        target += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; ++number) {
+        *target++ =
+            volk_16i_add_quad_max_star(*src0++, *src1++, *src2++, *src3++, *src4++);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_16i_x5_add_quad_max_star_16i_u_avx512bw(short* target,
+                                             short* src0,
+                                             short* src1,
+                                             short* src2,
+                                             short* src3,
+                                             short* src4,
+                                             unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += 32) {
+        // the last points with masked loads and a masked store
+        const unsigned int remaining = num_points - number;
+        const __mmask32 mask =
+            _cvtu32_mask32(remaining < 32 ? (1u << remaining) - 1 : 0xffffffff);
+        const __m512i metrics = _mm512_maskz_loadu_epi16(mask, src0 + number);
+        const __m512i max12 = _mm512_max_star_epi16(
+            _mm512_add_epi16(metrics, _mm512_maskz_loadu_epi16(mask, src1 + number)),
+            _mm512_add_epi16(metrics, _mm512_maskz_loadu_epi16(mask, src2 + number)));
+        const __m512i max34 = _mm512_max_star_epi16(
+            _mm512_add_epi16(metrics, _mm512_maskz_loadu_epi16(mask, src3 + number)),
+            _mm512_add_epi16(metrics, _mm512_maskz_loadu_epi16(mask, src4 + number)));
+        _mm512_mask_storeu_epi16(
+            target + number, mask, _mm512_max_star_epi16(max12, max34));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16i_x5_add_quad_max_star_16i_neon(short* target,
+                                                          short* src0,
+                                                          short* src1,
+                                                          short* src2,
+                                                          short* src3,
+                                                          short* src4,
+                                                          unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    int16x8_t metrics, max12, max34;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        metrics = vld1q_s16(src0);
+        max12 = _vmax_starq_s16(vaddq_s16(metrics, vld1q_s16(src1)),
+                                vaddq_s16(metrics, vld1q_s16(src2)));
+        max34 = _vmax_starq_s16(vaddq_s16(metrics, vld1q_s16(src3)),
+                                vaddq_s16(metrics, vld1q_s16(src4)));
+        vst1q_s16(target, _vmax_starq_s16(max12, max34));
+        src0 += 8;
+        src1 += 8;
+        src2 += 8;
+        src3 += 8;
+        src4 += 8;
+        target += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; ++number) {
+        *target++ =
+            volk_16i_add_quad_max_star(*src0++, *src1++, *src2++, *src3++, *src4++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_x5_add_quad_max_star_16i_H */
@@ -0,0 +1,283 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_bfp_compress_8u
+ *
+ * \b Overview
+ *
+ * Compresses 16 bit complex samples into O-RAN fronthaul block floating
+ * point, in the format volk_8u_s32u_bfp_decompress_16ic decompresses. Each
+ * PRB of 12 samples gets the smallest exponent for which all its 24
+ * components, shifted right by it, fit into bits wide mantissas; the shift
+ * rounds towards minus infinity. The exponent is found from the largest
+ * magnitude of the PRB and its count of leading zeros. The reserved high
+ * bits of the udCompParam byte are 0.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_bfp_compress_8u(uint8_t* outVector, const lv_16sc_t* inVector,
+ * unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The samples to compress.
+ * \li bits: The width of a mantissa, 1 to 16.
+ * \li num_points: The number of complex samples, a multiple of 12; the
+ * samples of a last partial PRB are left out.
+ *
+ * \b Outputs
+ * \li outVector: The compressed PRBs, num_points / 12 * (1 + 3 * bits) bytes.
+ *
+ * \b Example
+ * Compress the N / 12 PRBs of a symbol to 9 bit mantissas.
+ * \code
+ *   volk_16ic_bfp_compress_8u(compressed, samples, 9, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_bfp_compress_8u_H
+#define INCLUDED_volk_16ic_bfp_compress_8u_H
+
+#include <inttypes.h>
+#include <volk/volk_8u_s32u_bfp_decompress_16ic.h>
+
+/*
+ * The exponent which fits components of up to magnitude into bits wide
+ * mantissas: the length of magnitude >> (bits - 1), 32 less its leading
+ * zeros, found by a binary search.
+ */
+static inline unsigned int volk_bfp_exponent(uint32_t magnitude, unsigned int bits)
+{
+    unsigned int exponent = 0;
+
+    magnitude >>= bits - 1;
+    if (magnitude >> 8) {
+        exponent += 8;
+        magnitude >>= 8;
+    }
+    if (magnitude >> 4) {
+        exponent += 4;
+        magnitude >>= 4;
+    }
+    if (magnitude >> 2) {
+        exponent += 2;
+        magnitude >>= 2;
+    }
+    if (magnitude >> 1) {
+        exponent += 1;
+        magnitude >>= 1;
+    }
+    return exponent + magnitude;
+}
+
+/*
+ * Compresses the 24 components in into a PRB. x ^ (x >> 15) is x for positive
+ * and -x - 1 for negative components, whose mantissas may be one larger in
+ * magnitude; its length is that of the mantissa less the sign bit.
+ */
+static inline void
+volk_bfp_compress_prb(uint8_t* out, const int16_t* in, unsigned int bits)
+{
+    const uint32_t mask = (1u << bits) - 1;
+    uint32_t magnitude = 0, bit_buffer = 0;
+    unsigned int exponent, buffered = 0, n;
+
+    for (n = 0; n < 24; n++) {
+        magnitude |= (uint16_t)(in[n] ^ (in[n] >> 15));
+    }
+    exponent = volk_bfp_exponent(magnitude, bits);
+    *out++ = (uint8_t)exponent;
+    for (n = 0; n < 24; n++) {
+        bit_buffer = (bit_buffer << bits) | ((uint32_t)(in[n] >> exponent) & mask);
+        buffered += bits;
+        while (buffered >= 8) {
+            buffered -= 8;
+            *out++ = (uint8_t)(bit_buffer >> buffered);
+        }
+    }
+}
+
+/*
+ * The SIMD versions pack the mantissas of a PRB in three groups of 8, each
+ * bits bytes long and in a 128 bit lane: pairs of mantissas are joined in 32
+ * bit lanes and pairs of those in 64 bit lanes, first on top, and the two
+ * halves of the group moved together to the top of the 128 bit lane. Output
+ * byte k is lane byte index[k], most significant byte first.
+ */
+static inline void volk_bfp_compress_layout(uint8_t* index, unsigned int bits)
+{
+    unsigned int k, byte;
+
+    for (k = 0; k < 3 * bits; k++) {
+        byte = k % bits;
+        index[k] = (uint8_t)(16 * (k / bits) + (byte < 8 ? 7 - byte : 23 - byte));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_bfp_compress_8u_generic(uint8_t* outVector,
+                                                     const lv_16sc_t* inVector,
+                                                     unsigned int bits,
+                                                     unsigned int num_points)
+{
+    const unsigned int num_prbs = num_points / 12;
+    unsigned int number;
+
+    for (number = 0; number < num_prbs; number++) {
+        volk_bfp_compress_prb(outVector, (const int16_t*)(inVector + 12 * number), bits);
+        outVector += 1 + 3 * bits;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512BW && LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void volk_16ic_bfp_compress_8u_avx512vbmi(uint8_t* outVector,
+                                                        const lv_16sc_t* inVector,
+                                                        unsigned int bits,
+                                                        unsigned int num_points)
+{
+    const unsigned int num_prbs = num_points / 12;
+    const int16_t* in = (const int16_t*)inVector;
+    __VOLK_ATTR_ALIGNED(64) uint8_t index_bytes[64] = { 0 };
+    unsigned int number;
+    uint32_t magnitude;
+
+    volk_bfp_compress_layout(index_bytes, bits);
+    const __m512i index = _mm512_load_si512(index_bytes);
+    const __m512i mask = _mm512_set1_epi16((int16_t)(uint16_t)((1u << bits) - 1));
+    const __m128i join16 = _mm_cvtsi32_si128(16 - bits);
+    const __m128i join32 = _mm_cvtsi32_si128(32 - 2 * bits);
+    const __m128i top = _mm_cvtsi32_si128(64 - 4 * bits);
+    const __m128i half = _mm_cvtsi32_si128(4 * bits);
+    const __mmask64 store_mask = ((__mmask64)1 << (3 * bits)) - 1;
+    __m512i x, y, hi, lo;
+
+    for (number = 0; number < num_prbs; number++) {
+        x = _mm512_maskz_loadu_epi16(0xffffff, in);
+        y = _mm512_xor_si512(x, _mm512_srai_epi16(x, 15));
+        magnitude = (uint32_t)_mm512_reduce_or_epi32(y);
+        magnitude = (magnitude | (magnitude >> 16)) & 0xffff;
+        *outVector = (uint8_t)volk_bfp_exponent(magnitude, bits);
+
+        x = _mm512_sra_epi16(x, _mm_cvtsi32_si128(*outVector));
+        x = _mm512_and_si512(x, mask);
+        // 2 mantissas in 32 bits, 4 in 64 bits, all 8 at the top of 128 bits
+        x = _mm512_or_si512(_mm512_srl_epi32(_mm512_slli_epi32(x, 16), join16),
+                            _mm512_srli_epi32(x, 16));
+        x = _mm512_or_si512(_mm512_srl_epi64(_mm512_slli_epi64(x, 32), join32),
+                            _mm512_srli_epi64(x, 32));
+        x = _mm512_sll_epi64(x, top);
+        hi = _mm512_unpacklo_epi64(x, _mm512_setzero_si512());
+        lo = _mm512_unpackhi_epi64(_mm512_srl_epi64(x, half), _mm512_sll_epi64(x, top));
+        x = _mm512_permutexvar_epi8(index, _mm512_or_si512(hi, lo));
+        _mm512_mask_storeu_epi8(outVector + 1, store_mask, x);
+        outVector += 1 + 3 * bits;
+        in += 24;
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW && LV_HAVE_AVX512VBMI */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16ic_bfp_compress_8u_neonv8(uint8_t* outVector,
+                                                    const lv_16sc_t* inVector,
+                                                    unsigned int bits,
+                                                    unsigned int num_points)
+{
+    const unsigned int num_prbs = num_points / 12;
+    const unsigned int chunks = (3 * bits + 15) / 16;
+    const int16_t* in = (const int16_t*)inVector;
+    uint8_t index_bytes[48] = { 0 };
+    uint8x16_t index[3];
+    unsigned int prbs, number, k;
+
+    volk_bfp_compress_layout(index_bytes, bits);
+    for (k = 0; k < 3; k++) {
+        // past the PRB the indices are 0; those bytes belong to the next one
+        index[k] = vld1q_u8(index_bytes + 16 * k);
+    }
+    const uint16x8_t mask = vdupq_n_u16((uint16_t)((1u << bits) - 1));
+    const uint32x4_t low16 = vdupq_n_u32(0xffff);
+    const uint64x2_t low32 = vdupq_n_u64(0xffffffff);
+    const int32x4_t join16 = vdupq_n_s32((int32_t)bits);
+    const int64x2_t join32 = vdupq_n_s64(2 * bits);
+    const int64x2_t top = vdupq_n_s64(64 - 4 * bits);
+    const int64x2_t half = vdupq_n_s64(-(int64_t)(4 * bits));
+    const uint64x2_t zero = vdupq_n_u64(0);
+    int16x8_t x[3];
+    uint32x4_t pairs;
+    uint64x2_t quads;
+    uint8x16x3_t groups;
+    uint16x8_t magnitude;
+    int16x8_t exponent;
+
+    // the chunks of 16 bytes of the last PRBs would run past the stream
+    prbs = volk_bfp_prbs(1 + 3 * bits, num_prbs, 1 + 16 * chunks);
+    for (number = 0; number < prbs; number++) {
+        magnitude = vdupq_n_u16(0);
+        for (k = 0; k < 3; k++) {
+            x[k] = vld1q_s16(in + 8 * k);
+            magnitude = vorrq_u16(
+                magnitude, vreinterpretq_u16_s16(veorq_s16(x[k], vshrq_n_s16(x[k], 15))));
+        }
+        *outVector = (uint8_t)volk_bfp_exponent(vmaxvq_u16(magnitude), bits);
+        exponent = vdupq_n_s16(-(int16_t)*outVector);
+
+        for (k = 0; k < 3; k++) {
+            x[k] = vandq_s16(vshlq_s16(x[k], exponent), vreinterpretq_s16_u16(mask));
+            // 2 mantissas in 32 bits, 4 in 64 bits, all 8 at the top of 128 bits
+            pairs = vreinterpretq_u32_s16(x[k]);
+            pairs = vorrq_u32(vshlq_u32(vandq_u32(pairs, low16), join16),
+                              vshrq_n_u32(pairs, 16));
+            quads = vreinterpretq_u64_u32(pairs);
+            quads = vorrq_u64(vshlq_u64(vandq_u64(quads, low32), join32),
+                              vshrq_n_u64(quads, 32));
+            quads = vshlq_u64(quads, top);
+            quads = vorrq_u64(vzip1q_u64(quads, zero),
+                              vzip2q_u64(vshlq_u64(quads, half), vshlq_u64(quads, top)));
+            groups.val[k] = vreinterpretq_u8_u64(quads);
+        }
+        for (k = 0; k < chunks; k++) {
+            vst1q_u8(outVector + 1 + 16 * k, vqtbl3q_u8(groups, index[k]));
+        }
+        outVector += 1 + 3 * bits;
+        in += 24;
+    }
+
+    for (; number < num_prbs; number++) {
+        volk_bfp_compress_prb(outVector, in, bits);
+        outVector += 1 + 3 * bits;
+        in += 24;
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16ic_bfp_compress_8u_H */
@@ -0,0 +1,102 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_16ic_bfp_compress_8u.h'
+ */
+
+#ifndef INCLUDED_volk_16ic_bfp_compresspuppet_8u_H
+#define INCLUDED_volk_16ic_bfp_compresspuppet_8u_H
+
+#include <string.h>
+#include <volk/volk_16ic_bfp_compress_8u.h>
+
+/*
+ * Compresses to 4, 9, 12 and 16 bit mantissas into quarters of the output,
+ * as many whole PRBs as fit. A PRB of 4 bits or more is longer than its 12
+ * samples, so the input is never overrun.
+ */
+static inline void
+volk_bfp_compress_puppet(void (*kernel)(uint8_t*,
+                                        const lv_16sc_t*,
+                                        unsigned int,
+                                        unsigned int),
+                         uint8_t* outVector,
+                         const lv_16sc_t* inVector,
+                         unsigned int num_points)
+{
+    const unsigned int widths[4] = { 4, 9, 12, 16 };
+    const unsigned int quarter = num_points / 4;
+    unsigned int k;
+
+    memset(outVector, 0, num_points);
+    for (k = 0; k < 4; k++) {
+        kernel(outVector + k * quarter,
+               inVector + k * quarter,
+               widths[k],
+               12 * (quarter / (1 + 3 * widths[k])));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_bfp_compresspuppet_8u_generic(uint8_t* outVector,
+                                                           const lv_16sc_t* inVector,
+                                                           unsigned int num_points)
+{
+    volk_bfp_compress_puppet(
+        volk_16ic_bfp_compress_8u_generic, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512BW && LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void
+volk_16ic_bfp_compresspuppet_8u_avx512vbmi(uint8_t* outVector,
+                                           const lv_16sc_t* inVector,
+                                           unsigned int num_points)
+{
+    volk_bfp_compress_puppet(
+        volk_16ic_bfp_compress_8u_avx512vbmi, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512BW && LV_HAVE_AVX512VBMI */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16ic_bfp_compresspuppet_8u_neonv8(uint8_t* outVector,
+                                                          const lv_16sc_t* inVector,
+                                                          unsigned int num_points)
+{
+    volk_bfp_compress_puppet(
+        volk_16ic_bfp_compress_8u_neonv8, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16ic_bfp_compresspuppet_8u_H */
@@ -0,0 +1,322 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_16ic_cic_decimate_32ic
+ *
+ * \b Overview
+ *
+ * Decimates complex 16-bit samples with a cascaded integrator-comb filter of
+ * the given order and a differential delay of 1, the real and imaginary parts
+ * filtered as volk_16i_cic_decimate_32i filters a real stream: order
+ * integrators at the input rate, one output per decimation inputs, and order
+ * combs at the output rate, with a gain of decimation^order.
+ *
+ * The integrators and combs wrap modulo 2^32, so the outputs are exact as long
+ * as 16 + order * log2(decimation) bits hold them. The SIMD versions take each
+ * integrator as a log-step prefix sum of the complex values of a vector.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_cic_decimate_32ic(lv_32sc_t* outputVector,
+ * const lv_16sc_t* inputVector, lv_32sc_t* state, unsigned int order,
+ * unsigned int decimation, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: num_points * decimation complex samples.
+ * \li state: 2 * order complex values, the integrators from the input on and
+ * then the comb delays, zero to start.
+ * \li order: The number of integrators and of combs, 1 to 8.
+ * \li decimation: The number of inputs per output, at least 1.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li outputVector: The decimated outputs.
+ * \li state: The integrators and comb delays, to carry into the next buffer.
+ *
+ * \b Example
+ * Decimate by 64 with a third order filter, whose gain of 2^18 fits.
+ * \code
+ *   unsigned int N = 64;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*N*64, alignment);
+ *   lv_32sc_t* out = (lv_32sc_t*)volk_malloc(sizeof(lv_32sc_t)*N, alignment);
+ *   lv_32sc_t state[6] = { 0 };
+ *
+ *   volk_16ic_cic_decimate_32ic(out, in, state, 3, 64, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_cic_decimate_32ic_H
+#define INCLUDED_volk_16ic_cic_decimate_32ic_H
+
+#include <inttypes.h>
+#include <volk/volk_16i_cic_decimate_32i.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_cic_decimate_32ic_generic(lv_32sc_t* outputVector,
+                                                       const lv_16sc_t* inputVector,
+                                                       lv_32sc_t* state,
+                                                       unsigned int order,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    const int16_t* in = (const int16_t*)inputVector;
+    int32_t* out = (int32_t*)outputVector;
+    uint32_t* integrators = (uint32_t*)state;
+    uint32_t* delays = integrators + 2 * order;
+    uint32_t real = 0, imag = 0;
+    unsigned int number, k;
+
+    for (number = 0; number < num_points; number++) {
+        for (k = 0; k < decimation; k++) {
+            real = volk_cic_integrate(integrators, 2, (uint32_t)*in++, order);
+            imag = volk_cic_integrate(integrators + 1, 2, (uint32_t)*in++, order);
+        }
+        *out++ = (int32_t)volk_cic_comb(delays, 2, real, order);
+        *out++ = (int32_t)volk_cic_comb(delays + 1, 2, imag, order);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16ic_cic_decimate_32ic_u_avx2(lv_32sc_t* outputVector,
+                                                      const lv_16sc_t* inputVector,
+                                                      lv_32sc_t* state,
+                                                      unsigned int order,
+                                                      unsigned int decimation,
+                                                      unsigned int num_points)
+{
+    const int16_t* in = (const int16_t*)inputVector;
+    int32_t* out = (int32_t*)outputVector;
+    uint32_t* integrators = (uint32_t*)state;
+    uint32_t* delays = integrators + 2 * order;
+    const unsigned int total = num_points * decimation;
+    const unsigned int quarterPoints = total / 4;
+    const __m256i last = _mm256_setr_epi32(6, 7, 6, 7, 6, 7, 6, 7);
+    __VOLK_ATTR_ALIGNED(32) uint32_t lastStage[8];
+    __m256i carry[8];
+    __m256i x;
+    // the inputs up to and including the one of the next output
+    unsigned int countdown = decimation;
+    unsigned int number, stage, lane;
+
+    for (stage = 0; stage < order; stage++) {
+        // one complex value as a 64-bit lane, real part low
+        carry[stage] = _mm256_set1_epi64x(
+            (long long)((uint64_t)integrators[2 * stage + 1] << 32 |
+                        integrators[2 * stage]));
+    }
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)in));
+        for (stage = 0; stage < order; stage++) {
+            x = _mm256_add_epi32(_mm256_scan_complex_epi32(x), carry[stage]);
+            carry[stage] = _mm256_permutevar8x32_epi32(x, last);
+        }
+
+        if (countdown <= 4) {
+            _mm256_store_si256((__m256i*)lastStage, x);
+            for (lane = countdown - 1; lane < 4; lane += decimation) {
+                *out++ = (int32_t)volk_cic_comb(delays, 2, lastStage[2 * lane], order);
+                *out++ =
+                    (int32_t)volk_cic_comb(delays + 1, 2, lastStage[2 * lane + 1], order);
+            }
+            countdown = lane - 3;
+        } else {
+            countdown -= 4;
+        }
+        in += 8;
+    }
+
+    for (stage = 0; stage < order; stage++) {
+        _mm_storel_epi64((__m128i*)(integrators + 2 * stage),
+                         _mm256_castsi256_si128(carry[stage]));
+    }
+    for (number = quarterPoints * 4; number < total; number++) {
+        const uint32_t real = volk_cic_integrate(integrators, 2, (uint32_t)*in++, order);
+        const uint32_t imag =
+            volk_cic_integrate(integrators + 1, 2, (uint32_t)*in++, order);
+        if (--countdown == 0) {
+            *out++ = (int32_t)volk_cic_comb(delays, 2, real, order);
+            *out++ = (int32_t)volk_cic_comb(delays + 1, 2, imag, order);
+            countdown = decimation;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16ic_cic_decimate_32ic_u_avx512f(lv_32sc_t* outputVector,
+                                                         const lv_16sc_t* inputVector,
+                                                         lv_32sc_t* state,
+                                                         unsigned int order,
+                                                         unsigned int decimation,
+                                                         unsigned int num_points)
+{
+    const int16_t* in = (const int16_t*)inputVector;
+    int32_t* out = (int32_t*)outputVector;
+    uint32_t* integrators = (uint32_t*)state;
+    uint32_t* delays = integrators + 2 * order;
+    const unsigned int total = num_points * decimation;
+    const unsigned int eighthPoints = total / 8;
+    const __m512i last =
+        _mm512_setr_epi32(14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15);
+    __VOLK_ATTR_ALIGNED(64) uint32_t lastStage[16];
+    __m512i carry[8];
+    __m512i x;
+    // the inputs up to and including the one of the next output
+    unsigned int countdown = decimation;
+    unsigned int number, stage, lane;
+
+    for (stage = 0; stage < order; stage++) {
+        // one complex value as a 64-bit lane, real part low
+        carry[stage] = _mm512_set1_epi64(
+            (long long)((uint64_t)integrators[2 * stage + 1] << 32 |
+                        integrators[2 * stage]));
+    }
+
+    for (number = 0; number < eighthPoints; number++) {
+        x = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)in));
+        for (stage = 0; stage < order; stage++) {
+            x = _mm512_add_epi32(_mm512_scan_complex_epi32(x), carry[stage]);
+            carry[stage] = _mm512_permutexvar_epi32(last, x);
+        }
+
+        if (countdown <= 8) {
+            _mm512_store_si512(lastStage, x);
+            for (lane = countdown - 1; lane < 8; lane += decimation) {
+                *out++ = (int32_t)volk_cic_comb(delays, 2, lastStage[2 * lane], order);
+                *out++ =
+                    (int32_t)volk_cic_comb(delays + 1, 2, lastStage[2 * lane + 1], order);
+            }
+            countdown = lane - 7;
+        } else {
+            countdown -= 8;
+        }
+        in += 16;
+    }
+
+    for (stage = 0; stage < order; stage++) {
+        _mm_storel_epi64((__m128i*)(integrators + 2 * stage),
+                         _mm512_castsi512_si128(carry[stage]));
+    }
+    for (number = eighthPoints * 8; number < total; number++) {
+        const uint32_t real = volk_cic_integrate(integrators, 2, (uint32_t)*in++, order);
+        const uint32_t imag =
+            volk_cic_integrate(integrators + 1, 2, (uint32_t)*in++, order);
+        if (--countdown == 0) {
+            *out++ = (int32_t)volk_cic_comb(delays, 2, real, order);
+            *out++ = (int32_t)volk_cic_comb(delays + 1, 2, imag, order);
+            countdown = decimation;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16ic_cic_decimate_32ic_neon(lv_32sc_t* outputVector,
+                                                    const lv_16sc_t* inputVector,
+                                                    lv_32sc_t* state,
+                                                    unsigned int order,
+                                                    unsigned int decimation,
+                                                    unsigned int num_points)
+{
+    const int16_t* in = (const int16_t*)inputVector;
+    int32_t* out = (int32_t*)outputVector;
+    uint32_t* integrators = (uint32_t*)state;
+    uint32_t* delays = integrators + 2 * order;
+    const unsigned int total = num_points * decimation;
+    const unsigned int halfPoints = total / 2;
+    uint32_t lastStage[4];
+    uint32x4_t carry[8];
+    uint32x4_t x;
+    // the inputs up to and including the one of the next output
+    unsigned int countdown = decimation;
+    unsigned int number, stage, lane;
+
+    for (stage = 0; stage < order; stage++) {
+        const uint32x2_t value = vld1_u32(integrators + 2 * stage);
+        carry[stage] = vcombine_u32(value, value);
+    }
+
+    for (number = 0; number < halfPoints; number++) {
+        x = vreinterpretq_u32_s32(vmovl_s16(vld1_s16(in)));
+        for (stage = 0; stage < order; stage++) {
+            x = vaddq_u32(_vscan_complexq_u32(x), carry[stage]);
+            carry[stage] = vcombine_u32(vget_high_u32(x), vget_high_u32(x));
+        }
+
+        if (countdown <= 2) {
+            vst1q_u32(lastStage, x);
+            for (lane = countdown - 1; lane < 2; lane += decimation) {
+                *out++ = (int32_t)volk_cic_comb(delays, 2, lastStage[2 * lane], order);
+                *out++ =
+                    (int32_t)volk_cic_comb(delays + 1, 2, lastStage[2 * lane + 1], order);
+            }
+            countdown = lane - 1;
+        } else {
+            countdown -= 2;
+        }
+        in += 4;
+    }
+
+    for (stage = 0; stage < order; stage++) {
+        vst1_u32(integrators + 2 * stage, vget_low_u32(carry[stage]));
+    }
+    for (number = halfPoints * 2; number < total; number++) {
+        const uint32_t real = volk_cic_integrate(integrators, 2, (uint32_t)*in++, order);
+        const uint32_t imag =
+            volk_cic_integrate(integrators + 1, 2, (uint32_t)*in++, order);
+        if (--countdown == 0) {
+            *out++ = (int32_t)volk_cic_comb(delays, 2, real, order);
+            *out++ = (int32_t)volk_cic_comb(delays + 1, 2, imag, order);
+            countdown = decimation;
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_cic_decimate_32ic_H */
@@ -56,6 +56,62 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_deinterleave_16i_x2_a_avx512bw(int16_t* iBuffer,
+                                                            int16_t* qBuffer,
+                                                            const lv_16sc_t* complexVector,
+                                                            unsigned int num_points)
+{
+    const int16_t* complexVectorPtr = (const int16_t*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+    int16_t* qBufferPtr = qBuffer;
+
+    // even and odd int16 of the two loaded vectors
+    const __m512i iIndex = _mm512_set_epi16(62, 60, 58, 56, 54, 52, 50, 48,
+                                            46, 44, 42, 40, 38, 36, 34, 32,
+                                            30, 28, 26, 24, 22, 20, 18, 16,
+                                            14, 12, 10, 8,  6,  4,  2,  0);
+    const __m512i qIndex = _mm512_add_epi16(iIndex, _mm512_set1_epi16(1));
+
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const unsigned int nRemaining = num_points % 32;
+
+    for (unsigned int number = 0; number < thirtysecondPoints; number++) {
+        const __m512i complexVal1 = _mm512_load_si512((void*)complexVectorPtr);
+        const __m512i complexVal2 = _mm512_load_si512((void*)(complexVectorPtr + 32));
+        complexVectorPtr += 64;
+
+        _mm512_store_si512((void*)iBufferPtr,
+                           _mm512_permutex2var_epi16(complexVal1, iIndex, complexVal2));
+        _mm512_store_si512((void*)qBufferPtr,
+                           _mm512_permutex2var_epi16(complexVal1, qIndex, complexVal2));
+
+        iBufferPtr += 32;
+        qBufferPtr += 32;
+    }
+
+    // Deinterleave the remaining points with masked loads and stores, one
+    // 32 bit element per complex point
+    if (nRemaining) {
+        const __mmask16 loMask =
+            _cvtu32_mask16((nRemaining >= 16) ? 0xffff : (1u << nRemaining) - 1);
+        const __mmask16 hiMask =
+            _cvtu32_mask16((nRemaining > 16) ? (1u << (nRemaining - 16)) - 1 : 0);
+        const __mmask32 outMask = _cvtu32_mask32((1u << nRemaining) - 1);
+        const __m512i complexVal1 = _mm512_maskz_loadu_epi32(loMask, complexVectorPtr);
+        const __m512i complexVal2 =
+            _mm512_maskz_loadu_epi32(hiMask, complexVectorPtr + 32);
+
+        _mm512_mask_storeu_epi16(
+            iBufferPtr, outMask, _mm512_permutex2var_epi16(complexVal1, iIndex, complexVal2));
+        _mm512_mask_storeu_epi16(
+            qBufferPtr, outMask, _mm512_permutex2var_epi16(complexVal1, qIndex, complexVal2));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -305,6 +361,62 @@ static inline void volk_16ic_deinterleave_16i_x2_u_orc(int16_t* iBuffer,
 
 #include <inttypes.h>
 #include <stdio.h>
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_deinterleave_16i_x2_u_avx512bw(int16_t* iBuffer,
+                                                            int16_t* qBuffer,
+                                                            const lv_16sc_t* complexVector,
+                                                            unsigned int num_points)
+{
+    const int16_t* complexVectorPtr = (const int16_t*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+    int16_t* qBufferPtr = qBuffer;
+
+    // even and odd int16 of the two loaded vectors
+    const __m512i iIndex = _mm512_set_epi16(62, 60, 58, 56, 54, 52, 50, 48,
+                                            46, 44, 42, 40, 38, 36, 34, 32,
+                                            30, 28, 26, 24, 22, 20, 18, 16,
+                                            14, 12, 10, 8,  6,  4,  2,  0);
+    const __m512i qIndex = _mm512_add_epi16(iIndex, _mm512_set1_epi16(1));
+
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const unsigned int nRemaining = num_points % 32;
+
+    for (unsigned int number = 0; number < thirtysecondPoints; number++) {
+        const __m512i complexVal1 = _mm512_loadu_si512((void*)complexVectorPtr);
+        const __m512i complexVal2 = _mm512_loadu_si512((void*)(complexVectorPtr + 32));
+        complexVectorPtr += 64;
+
+        _mm512_storeu_si512((void*)iBufferPtr,
+                           _mm512_permutex2var_epi16(complexVal1, iIndex, complexVal2));
+        _mm512_storeu_si512((void*)qBufferPtr,
+                           _mm512_permutex2var_epi16(complexVal1, qIndex, complexVal2));
+
+        iBufferPtr += 32;
+        qBufferPtr += 32;
+    }
+
+    // Deinterleave the remaining points with masked loads and stores, one
+    // 32 bit element per complex point
+    if (nRemaining) {
+        const __mmask16 loMask =
+            _cvtu32_mask16((nRemaining >= 16) ? 0xffff : (1u << nRemaining) - 1);
+        const __mmask16 hiMask =
+            _cvtu32_mask16((nRemaining > 16) ? (1u << (nRemaining - 16)) - 1 : 0);
+        const __mmask32 outMask = _cvtu32_mask32((1u << nRemaining) - 1);
+        const __m512i complexVal1 = _mm512_maskz_loadu_epi32(loMask, complexVectorPtr);
+        const __m512i complexVal2 =
+            _mm512_maskz_loadu_epi32(hiMask, complexVectorPtr + 32);
+
+        _mm512_mask_storeu_epi16(
+            iBufferPtr, outMask, _mm512_permutex2var_epi16(complexVal1, iIndex, complexVal2));
+        _mm512_mask_storeu_epi16(
+            qBufferPtr, outMask, _mm512_permutex2var_epi16(complexVal1, qIndex, complexVal2));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
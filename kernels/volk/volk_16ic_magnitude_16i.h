@@ -26,7 +26,8 @@
  * \b Overview
  *
  * Computes the magnitude of the complexVector and stores the results
- * in the magnitudeVector.
+ * in the magnitudeVector. The magnitudes of full scale values above SHRT_MAX
+ * saturate to it.
  *
  * <b>Dispatcher Prototype</b>
  * \code
@@ -60,6 +61,13 @@
 #include <stdio.h>
 #include <volk/volk_common.h>
 
+/* Rounds a magnitude to nearest, saturating as the packing SIMD versions do */
+static inline int16_t volk_16ic_magnitude_round(float magnitude)
+{
+    magnitude = rintf(magnitude);
+    return (int16_t)(magnitude > SHRT_MAX ? SHRT_MAX : magnitude);
+}
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -121,7 +129,7 @@ static inline void volk_16ic_magnitude_16i_a_avx2(int16_t* magnitudeVector,
         const float val1Imag = (float)(*complexVectorPtr++) / SHRT_MAX;
         const float val1Result =
             sqrtf((val1Real * val1Real) + (val1Imag * val1Imag)) * SHRT_MAX;
-        *magnitudeVectorPtr++ = (int16_t)rintf(val1Result);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(val1Result);
     }
 }
 #endif /* LV_HAVE_AVX2 */
@@ -177,10 +185,10 @@ static inline void volk_16ic_magnitude_16i_a_sse3(int16_t* magnitudeVector,
         result = _mm_mul_ps(result, vScalar); // Scale the results
 
         _mm_store_ps(outputFloatBuffer, result);
-        *magnitudeVectorPtr++ = (int16_t)rintf(outputFloatBuffer[0]);
-        *magnitudeVectorPtr++ = (int16_t)rintf(outputFloatBuffer[1]);
-        *magnitudeVectorPtr++ = (int16_t)rintf(outputFloatBuffer[2]);
-        *magnitudeVectorPtr++ = (int16_t)rintf(outputFloatBuffer[3]);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(outputFloatBuffer[0]);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(outputFloatBuffer[1]);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(outputFloatBuffer[2]);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(outputFloatBuffer[3]);
     }
 
     number = quarterPoints * 4;
@@ -191,7 +199,7 @@ static inline void volk_16ic_magnitude_16i_a_sse3(int16_t* magnitudeVector,
         const float val1Imag = (float)(*complexVectorPtr++) / SHRT_MAX;
         const float val1Result =
             sqrtf((val1Real * val1Real) + (val1Imag * val1Imag)) * SHRT_MAX;
-        *magnitudeVectorPtr++ = (int16_t)rintf(val1Result);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(val1Result);
     }
 }
 #endif /* LV_HAVE_SSE3 */
@@ -253,10 +261,10 @@ static inline void volk_16ic_magnitude_16i_a_sse(int16_t* magnitudeVector,
         result = _mm_mul_ps(result, vScalar); // Scale the results
 
         _mm_store_ps(outputFloatBuffer, result);
-        *magnitudeVectorPtr++ = (int16_t)rintf(outputFloatBuffer[0]);
-        *magnitudeVectorPtr++ = (int16_t)rintf(outputFloatBuffer[1]);
-        *magnitudeVectorPtr++ = (int16_t)rintf(outputFloatBuffer[2]);
-        *magnitudeVectorPtr++ = (int16_t)rintf(outputFloatBuffer[3]);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(outputFloatBuffer[0]);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(outputFloatBuffer[1]);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(outputFloatBuffer[2]);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(outputFloatBuffer[3]);
     }
 
     number = quarterPoints * 4;
@@ -267,7 +275,7 @@ static inline void volk_16ic_magnitude_16i_a_sse(int16_t* magnitudeVector,
         const float val1Imag = (float)(*complexVectorPtr++) / SHRT_MAX;
         const float val1Result =
             sqrtf((val1Real * val1Real) + (val1Imag * val1Imag)) * SHRT_MAX;
-        *magnitudeVectorPtr++ = (int16_t)rintf(val1Result);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(val1Result);
     }
 }
 #endif /* LV_HAVE_SSE */
@@ -286,7 +294,7 @@ static inline void volk_16ic_magnitude_16i_generic(int16_t* magnitudeVector,
         float real = ((float)(*complexVectorPtr++)) / scalar;
         float imag = ((float)(*complexVectorPtr++)) / scalar;
         *magnitudeVectorPtr++ =
-            (int16_t)rintf(sqrtf((real * real) + (imag * imag)) * scalar);
+            volk_16ic_magnitude_round(sqrtf((real * real) + (imag * imag)) * scalar);
     }
 }
 #endif /* LV_HAVE_GENERIC */
@@ -379,11 +387,49 @@ static inline void volk_16ic_magnitude_16i_u_avx2(int16_t* magnitudeVector,
         const float val1Imag = (float)(*complexVectorPtr++) / SHRT_MAX;
         const float val1Result =
             sqrtf((val1Real * val1Real) + (val1Imag * val1Imag)) * SHRT_MAX;
-        *magnitudeVectorPtr++ = (int16_t)rintf(val1Result);
+        *magnitudeVectorPtr++ = volk_16ic_magnitude_round(val1Result);
     }
 }
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16ic_magnitude_16i_u_avx512f(int16_t* magnitudeVector,
+                                                     const lv_16sc_t* complexVector,
+                                                     unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int nRemaining = num_points % 16;
+
+    const __m512 vScalar = _mm512_set1_ps(SHRT_MAX);
+    const __m512 invScalar = _mm512_set1_ps(1.0f / SHRT_MAX);
+    __m512i values;
+    __m512 real, imag, result;
+    unsigned int number;
+
+    for (number = 0; number <= sixteenthPoints; number++) {
+        // the last points with a masked load and a masked store
+        const __mmask16 mask =
+            number < sixteenthPoints ? 0xffff : _cvtu32_mask16((1u << nRemaining) - 1);
+        values = _mm512_maskz_loadu_epi32(mask, complexVector + 16 * number);
+
+        // sign extend the real and the imaginary part of each value
+        real = _mm512_cvtepi32_ps(_mm512_srai_epi32(_mm512_slli_epi32(values, 16), 16));
+        imag = _mm512_cvtepi32_ps(_mm512_srai_epi32(values, 16));
+        real = _mm512_mul_ps(real, invScalar);
+        imag = _mm512_mul_ps(imag, invScalar);
+
+        result = _mm512_add_ps(_mm512_mul_ps(real, real), _mm512_mul_ps(imag, imag));
+        result = _mm512_mul_ps(_mm512_sqrt_ps(result), vScalar);
+
+        // round to nearest and saturate
+        _mm512_mask_cvtsepi32_storeu_epi16(
+            magnitudeVector + 16 * number, mask, _mm512_cvtps_epi32(result));
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
 #ifdef LV_HAVE_NEONV7
 #include <arm_neon.h>
 #include <volk/volk_neon_intrinsics.h>
@@ -420,7 +466,7 @@ static inline void volk_16ic_magnitude_16i_neonv7(int16_t* magnitudeVector,
         // Add 0.5 for correct rounding because vcvtq_s32_f32 truncates.
         // This works because the magnitude is always positive.
         mag_vec = vaddq_f32(mag_vec, vdupq_n_f32(0.5));
-        const int16x4_t mag16_vec = vmovn_s32(vcvtq_s32_f32(mag_vec));
+        const int16x4_t mag16_vec = vqmovn_s32(vcvtq_s32_f32(mag_vec));
         vst1_s16(magnitudeVectorPtr, mag16_vec);
         // Advance pointers
         magnitudeVectorPtr += 4;
@@ -432,11 +478,61 @@ static inline void volk_16ic_magnitude_16i_neonv7(int16_t* magnitudeVector,
         const float real = lv_creal(*complexVectorPtr) * inv_scalar;
         const float imag = lv_cimag(*complexVectorPtr) * inv_scalar;
         *magnitudeVectorPtr =
-            (int16_t)rintf(sqrtf((real * real) + (imag * imag)) * scalar);
+            volk_16ic_magnitude_round(sqrtf((real * real) + (imag * imag)) * scalar);
         complexVectorPtr++;
         magnitudeVectorPtr++;
     }
 }
 #endif /* LV_HAVE_NEONV7 */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16ic_magnitude_16i_neonv8(int16_t* magnitudeVector,
+                                                  const lv_16sc_t* complexVector,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float scalar = SHRT_MAX;
+    const float inv_scalar = 1.0f / scalar;
+
+    int16_t* magnitudeVectorPtr = magnitudeVector;
+    const lv_16sc_t* complexVectorPtr = complexVector;
+
+    float32x4_t re0, im0, re1, im1;
+    int16x8x2_t c16_vec;
+
+    for (number = 0; number < eighthPoints; number++) {
+        c16_vec = vld2q_s16((const int16_t*)complexVectorPtr);
+        re0 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(c16_vec.val[0])));
+        im0 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(c16_vec.val[1])));
+        re1 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(c16_vec.val[0])));
+        im1 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(c16_vec.val[1])));
+        re0 = vmulq_n_f32(re0, inv_scalar);
+        im0 = vmulq_n_f32(im0, inv_scalar);
+        re1 = vmulq_n_f32(re1, inv_scalar);
+        im1 = vmulq_n_f32(im1, inv_scalar);
+        re0 = vsqrtq_f32(vaddq_f32(vmulq_f32(re0, re0), vmulq_f32(im0, im0)));
+        re1 = vsqrtq_f32(vaddq_f32(vmulq_f32(re1, re1), vmulq_f32(im1, im1)));
+        // round to nearest and saturate
+        vst1q_s16(magnitudeVectorPtr,
+                  vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(re0, scalar))),
+                               vqmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(re1, scalar)))));
+        magnitudeVectorPtr += 8;
+        complexVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        const float real = lv_creal(*complexVectorPtr) * inv_scalar;
+        const float imag = lv_cimag(*complexVectorPtr) * inv_scalar;
+        *magnitudeVectorPtr =
+            volk_16ic_magnitude_round(sqrtf((real * real) + (imag * imag)) * scalar);
+        complexVectorPtr++;
+        magnitudeVectorPtr++;
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
 #endif /* INCLUDED_volk_16ic_magnitude_16i_u_H */
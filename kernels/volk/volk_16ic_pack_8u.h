@@ -0,0 +1,284 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_pack_8u
+ *
+ * \b Overview
+ *
+ * Packs 16 bit complex samples into complex samples of bits wide two's
+ * complement components, in the format volk_8u_unpack_16ic unpacks, e.g. for
+ * a radio which takes 12 bit SC12 or 4 bit SC4 samples to transmit. Components
+ * outside the range of bits bits saturate. The unused bits of a last partial
+ * byte are 0.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_pack_8u(uint8_t* outVector, const lv_16sc_t* inVector,
+ * unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The samples to pack.
+ * \li bits: The width of a component, 1 to 16.
+ * \li num_points: The number of complex samples.
+ *
+ * \b Outputs
+ * \li outVector: The packed samples, (2 * num_points * bits + 7) / 8 bytes.
+ *
+ * \b Example
+ * Pack N samples to 12 bits.
+ * \code
+ *   volk_16ic_pack_8u(packed, samples, 12, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_pack_8u_H
+#define INCLUDED_volk_16ic_pack_8u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_8u_unpack_16ic.h>
+
+/* Saturates and packs num_values components into the bit stream out. */
+static inline void volk_packed_pack(uint8_t* out,
+                                    const int16_t* in,
+                                    unsigned int bits,
+                                    unsigned int num_values)
+{
+    const int32_t max = (1 << (bits - 1)) - 1;
+    const int32_t min = -max - 1;
+    const uint32_t mask = (1u << bits) - 1;
+    uint32_t bit_buffer = 0;
+    unsigned int buffered = 0, n;
+    int32_t value;
+
+    for (n = 0; n < num_values; n++) {
+        value = *in++;
+        value = value > max ? max : (value < min ? min : value);
+        bit_buffer |= ((uint32_t)value & mask) << buffered;
+        buffered += bits;
+        while (buffered >= 8) {
+            *out++ = (uint8_t)bit_buffer;
+            bit_buffer >>= 8;
+            buffered -= 8;
+        }
+    }
+    if (buffered) {
+        *out = (uint8_t)bit_buffer;
+    }
+}
+
+/*
+ * The SIMD versions pack a group of 8 saturated components into a 16 byte
+ * vector, of which the first bits bytes are the group: 16 bit lane j is
+ * masked and multiplied by scale[j] to the bit offset of component j within
+ * its first byte, and output byte k is the or of the lane bytes which
+ * shuffle[0][k] to shuffle[3][k] pick, the low bytes of the components which
+ * start in byte k and the high bytes of those which spill over into it.
+ * Returns 0 for the widths left to the generic version.
+ */
+static inline int
+volk_packed_pack_layout(uint8_t shuffle[4][16], int16_t* scale, unsigned int bits)
+{
+    unsigned int low[16] = { 0 }, high[16] = { 0 };
+    unsigned int j, k, offset;
+
+    if (bits < 4 || bits > 16) {
+        return 0;
+    }
+    memset(shuffle, 0x80, 4 * 16);
+    for (j = 0; j < 8; j++) {
+        offset = j * bits;
+        k = offset / 8;
+        if (offset % 8 + bits > 16) {
+            return 0;
+        }
+        scale[j] = (int16_t)(1 << (offset % 8));
+        shuffle[low[k]++][k] = (uint8_t)(2 * j);
+        if (offset % 8 + bits > 8) {
+            shuffle[2 + high[k + 1]++][k + 1] = (uint8_t)(2 * j + 1);
+        }
+    }
+    return 1;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_pack_8u_generic(uint8_t* outVector,
+                                             const lv_16sc_t* inVector,
+                                             unsigned int bits,
+                                             unsigned int num_points)
+{
+    volk_packed_pack(outVector, (const int16_t*)inVector, bits, 2 * num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_16ic_pack_8u_ssse3(uint8_t* outVector,
+                                           const lv_16sc_t* inVector,
+                                           unsigned int bits,
+                                           unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    const int16_t* in = (const int16_t*)inVector;
+    __VOLK_ATTR_ALIGNED(16) uint8_t shuffle_bytes[4][16];
+    __VOLK_ATTR_ALIGNED(16) int16_t scale_words[8];
+    unsigned int groups = 0, number;
+
+    if (volk_packed_pack_layout(shuffle_bytes, scale_words, bits)) {
+        const __m128i shuffle0 = _mm_load_si128((const __m128i*)shuffle_bytes[0]);
+        const __m128i shuffle1 = _mm_load_si128((const __m128i*)shuffle_bytes[1]);
+        const __m128i shuffle2 = _mm_load_si128((const __m128i*)shuffle_bytes[2]);
+        const __m128i shuffle3 = _mm_load_si128((const __m128i*)shuffle_bytes[3]);
+        const __m128i scale = _mm_load_si128((const __m128i*)scale_words);
+        const __m128i max = _mm_set1_epi16((int16_t)((1 << (bits - 1)) - 1));
+        const __m128i min = _mm_set1_epi16((int16_t)(-(1 << (bits - 1))));
+        const __m128i mask = _mm_set1_epi16((int16_t)(uint16_t)((1u << bits) - 1));
+        __m128i x;
+
+        groups = volk_packed_groups(bits, num_values, 16);
+        for (number = 0; number < groups; number++) {
+            x = _mm_max_epi16(_mm_min_epi16(_mm_loadu_si128((const __m128i*)in), max),
+                              min);
+            x = _mm_mullo_epi16(_mm_and_si128(x, mask), scale);
+            x = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(x, shuffle0),
+                                          _mm_shuffle_epi8(x, shuffle1)),
+                             _mm_or_si128(_mm_shuffle_epi8(x, shuffle2),
+                                          _mm_shuffle_epi8(x, shuffle3)));
+            // the bytes after the group are overwritten by the next one
+            _mm_storeu_si128((__m128i*)outVector, x);
+            outVector += bits;
+            in += 8;
+        }
+    }
+
+    volk_packed_pack(outVector, in, bits, num_values - groups * 8);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_8u_avx2(uint8_t* outVector,
+                                          const lv_16sc_t* inVector,
+                                          unsigned int bits,
+                                          unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    const int16_t* in = (const int16_t*)inVector;
+    __VOLK_ATTR_ALIGNED(16) uint8_t shuffle_bytes[4][16];
+    __VOLK_ATTR_ALIGNED(16) int16_t scale_words[8];
+    unsigned int pairs = 0, number;
+
+    if (volk_packed_pack_layout(shuffle_bytes, scale_words, bits)) {
+        const __m256i shuffle0 = _mm256_broadcastsi128_si256(
+            _mm_load_si128((const __m128i*)shuffle_bytes[0]));
+        const __m256i shuffle1 = _mm256_broadcastsi128_si256(
+            _mm_load_si128((const __m128i*)shuffle_bytes[1]));
+        const __m256i shuffle2 = _mm256_broadcastsi128_si256(
+            _mm_load_si128((const __m128i*)shuffle_bytes[2]));
+        const __m256i shuffle3 = _mm256_broadcastsi128_si256(
+            _mm_load_si128((const __m128i*)shuffle_bytes[3]));
+        const __m256i scale =
+            _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)scale_words));
+        const __m256i max = _mm256_set1_epi16((int16_t)((1 << (bits - 1)) - 1));
+        const __m256i min = _mm256_set1_epi16((int16_t)(-(1 << (bits - 1))));
+        const __m256i mask = _mm256_set1_epi16((int16_t)(uint16_t)((1u << bits) - 1));
+        __m256i x;
+
+        // a group in each 128 bit lane
+        pairs = volk_packed_groups(bits, num_values, 16) / 2;
+        for (number = 0; number < pairs; number++) {
+            x = _mm256_max_epi16(
+                _mm256_min_epi16(_mm256_loadu_si256((const __m256i*)in), max), min);
+            x = _mm256_mullo_epi16(_mm256_and_si256(x, mask), scale);
+            x = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(x, shuffle0),
+                                                _mm256_shuffle_epi8(x, shuffle1)),
+                                _mm256_or_si256(_mm256_shuffle_epi8(x, shuffle2),
+                                                _mm256_shuffle_epi8(x, shuffle3)));
+            // the bytes after each group are overwritten by the next one
+            _mm_storeu_si128((__m128i*)outVector, _mm256_castsi256_si128(x));
+            _mm_storeu_si128((__m128i*)(outVector + bits),
+                             _mm256_extracti128_si256(x, 1));
+            outVector += 2 * bits;
+            in += 16;
+        }
+    }
+
+    volk_packed_pack(outVector, in, bits, num_values - pairs * 16);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16ic_pack_8u_neonv8(uint8_t* outVector,
+                                            const lv_16sc_t* inVector,
+                                            unsigned int bits,
+                                            unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    const int16_t* in = (const int16_t*)inVector;
+    uint8_t shuffle_bytes[4][16];
+    int16_t scale_words[8];
+    unsigned int groups = 0, number;
+
+    if (volk_packed_pack_layout(shuffle_bytes, scale_words, bits)) {
+        const uint8x16_t shuffle0 = vld1q_u8(shuffle_bytes[0]);
+        const uint8x16_t shuffle1 = vld1q_u8(shuffle_bytes[1]);
+        const uint8x16_t shuffle2 = vld1q_u8(shuffle_bytes[2]);
+        const uint8x16_t shuffle3 = vld1q_u8(shuffle_bytes[3]);
+        const int16x8_t scale = vld1q_s16(scale_words);
+        const int16x8_t max = vdupq_n_s16((int16_t)((1 << (bits - 1)) - 1));
+        const int16x8_t min = vdupq_n_s16((int16_t)(-(1 << (bits - 1))));
+        const uint16x8_t mask = vdupq_n_u16((uint16_t)((1u << bits) - 1));
+        int16x8_t x;
+        uint8x16_t y;
+
+        groups = volk_packed_groups(bits, num_values, 16);
+        for (number = 0; number < groups; number++) {
+            x = vmaxq_s16(vminq_s16(vld1q_s16(in), max), min);
+            x = vandq_s16(x, vreinterpretq_s16_u16(mask));
+            y = vreinterpretq_u8_s16(vmulq_s16(x, scale));
+            y = vorrq_u8(vorrq_u8(vqtbl1q_u8(y, shuffle0), vqtbl1q_u8(y, shuffle1)),
+                         vorrq_u8(vqtbl1q_u8(y, shuffle2), vqtbl1q_u8(y, shuffle3)));
+            // the bytes after the group are overwritten by the next one
+            vst1q_u8(outVector, y);
+            outVector += bits;
+            in += 8;
+        }
+    }
+
+    volk_packed_pack(outVector, in, bits, num_values - groups * 8);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16ic_pack_8u_H */
@@ -0,0 +1,215 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_s32f_byteswap_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex 16-bit integers in network (big endian) byte order, as carried
+ * by VITA-49 and SigMF streams, to complex floats divided by scalar. The bytes are
+ * swapped inside the conversion, so the input is read once and left as it is.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_s32f_byteswap_convert_32fc(lv_32fc_t* outputVector,
+ *                                           const lv_16sc_t* inputVector,
+ *                                           const float scalar,
+ *                                           unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The big endian complex samples.
+ * \li scalar: The value each component is divided by, e.g. 32768 for a full
+ *     scale of 1.
+ * \li num_points: The number of complex samples.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * \code
+ *   volk_16ic_s32f_byteswap_convert_32fc(samples, packet_payload, 32768.f, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_s32f_byteswap_convert_32fc_H
+#define INCLUDED_volk_16ic_s32f_byteswap_convert_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+/* The big endian int16 at x, as an int16 of this machine */
+static inline int16_t volk_16i_load_be(const int16_t* x)
+{
+    const uint16_t value = *(const uint16_t*)x;
+    return (int16_t)(((value >> 8) & 0xff) | ((value << 8) & 0xff00));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_16ic_s32f_byteswap_convert_32fc_generic(lv_32fc_t* outputVector,
+                                             const lv_16sc_t* inputVector,
+                                             const float scalar,
+                                             unsigned int num_points)
+{
+    float* outputVectorPtr = (float*)outputVector;
+    const int16_t* inputVectorPtr = (const int16_t*)inputVector;
+    unsigned int number;
+
+    for (number = 0; number < 2 * num_points; number++) {
+        *outputVectorPtr++ = (float)volk_16i_load_be(inputVectorPtr++) / scalar;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void
+volk_16ic_s32f_byteswap_convert_32fc_a_avx2(lv_32fc_t* outputVector,
+                                            const lv_16sc_t* inputVector,
+                                            const float scalar,
+                                            unsigned int num_points)
+{
+    float* outputVectorPtr = (float*)outputVector;
+    const int16_t* inputVectorPtr = (const int16_t*)inputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const __m256 invScalar = _mm256_set1_ps(1.0f / scalar);
+    const __m256i swapIdx = _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5,
+                                            2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9,
+                                            6, 7, 4, 5, 2, 3, 0, 1);
+    __m256i inputVal;
+    __m256 outputVal1, outputVal2;
+
+    for (number = 0; number < eighthPoints; number++) {
+        inputVal = _mm256_load_si256((const __m256i*)inputVectorPtr);
+        inputVal = _mm256_shuffle_epi8(inputVal, swapIdx);
+
+        outputVal1 = _mm256_cvtepi32_ps(
+            _mm256_cvtepi16_epi32(_mm256_castsi256_si128(inputVal)));
+        outputVal2 = _mm256_cvtepi32_ps(
+            _mm256_cvtepi16_epi32(_mm256_extracti128_si256(inputVal, 1)));
+
+        _mm256_store_ps(outputVectorPtr, _mm256_mul_ps(outputVal1, invScalar));
+        _mm256_store_ps(outputVectorPtr + 8, _mm256_mul_ps(outputVal2, invScalar));
+
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = eighthPoints * 16; number < 2 * num_points; number++) {
+        *outputVectorPtr++ = (float)volk_16i_load_be(inputVectorPtr++) / scalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void
+volk_16ic_s32f_byteswap_convert_32fc_u_avx2(lv_32fc_t* outputVector,
+                                            const lv_16sc_t* inputVector,
+                                            const float scalar,
+                                            unsigned int num_points)
+{
+    float* outputVectorPtr = (float*)outputVector;
+    const int16_t* inputVectorPtr = (const int16_t*)inputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const __m256 invScalar = _mm256_set1_ps(1.0f / scalar);
+    const __m256i swapIdx = _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5,
+                                            2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9,
+                                            6, 7, 4, 5, 2, 3, 0, 1);
+    __m256i inputVal;
+    __m256 outputVal1, outputVal2;
+
+    for (number = 0; number < eighthPoints; number++) {
+        inputVal = _mm256_loadu_si256((const __m256i*)inputVectorPtr);
+        inputVal = _mm256_shuffle_epi8(inputVal, swapIdx);
+
+        outputVal1 = _mm256_cvtepi32_ps(
+            _mm256_cvtepi16_epi32(_mm256_castsi256_si128(inputVal)));
+        outputVal2 = _mm256_cvtepi32_ps(
+            _mm256_cvtepi16_epi32(_mm256_extracti128_si256(inputVal, 1)));
+
+        _mm256_storeu_ps(outputVectorPtr, _mm256_mul_ps(outputVal1, invScalar));
+        _mm256_storeu_ps(outputVectorPtr + 8, _mm256_mul_ps(outputVal2, invScalar));
+
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = eighthPoints * 16; number < 2 * num_points; number++) {
+        *outputVectorPtr++ = (float)volk_16i_load_be(inputVectorPtr++) / scalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_16ic_s32f_byteswap_convert_32fc_neon(lv_32fc_t* outputVector,
+                                          const lv_16sc_t* inputVector,
+                                          const float scalar,
+                                          unsigned int num_points)
+{
+    float* outputVectorPtr = (float*)outputVector;
+    const int16_t* inputVectorPtr = (const int16_t*)inputVector;
+    const unsigned int quarterPoints = num_points / 4;
+    const float invScalar = 1.0f / scalar;
+    unsigned int number;
+
+    int16x8_t inputVal;
+
+    for (number = 0; number < quarterPoints; number++) {
+        inputVal =
+            vreinterpretq_s16_u8(vrev16q_u8(vld1q_u8((const uint8_t*)inputVectorPtr)));
+
+        vst1q_f32(outputVectorPtr,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(inputVal))),
+                              invScalar));
+        vst1q_f32(outputVectorPtr + 4,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(inputVal))),
+                              invScalar));
+
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = quarterPoints * 8; number < 2 * num_points; number++) {
+        *outputVectorPtr++ = (float)volk_16i_load_be(inputVectorPtr++) / scalar;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_s32f_byteswap_convert_32fc_H */
@@ -0,0 +1,225 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_s32f_byteswap_deinterleave_32f_x2
+ *
+ * \b Overview
+ *
+ * Deinterleaves complex 16-bit integers in network (big endian) byte order into
+ * I and Q float vectors divided by scalar, as volk_16ic_s32f_deinterleave_32f_x2
+ * does for samples in the byte order of the machine. The bytes are swapped inside
+ * the conversion, so the input is read once and left as it is.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_s32f_byteswap_deinterleave_32f_x2(float* iBuffer, float* qBuffer,
+ *                                                  const lv_16sc_t* complexVector,
+ *                                                  const float scalar,
+ *                                                  unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li complexVector: The big endian complex samples.
+ * \li scalar: The value each component is divided by.
+ * \li num_points: The number of complex samples.
+ *
+ * \b Outputs
+ * \li iBuffer: The I components.
+ * \li qBuffer: The Q components.
+ *
+ * \b Example
+ * \code
+ *   volk_16ic_s32f_byteswap_deinterleave_32f_x2(i, q, packet_payload, 32768.f, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_s32f_byteswap_deinterleave_32f_x2_H
+#define INCLUDED_volk_16ic_s32f_byteswap_deinterleave_32f_x2_H
+
+#include <inttypes.h>
+#include <volk/volk_16ic_s32f_byteswap_convert_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_16ic_s32f_byteswap_deinterleave_32f_x2_generic(float* iBuffer,
+                                                    float* qBuffer,
+                                                    const lv_16sc_t* complexVector,
+                                                    const float scalar,
+                                                    unsigned int num_points)
+{
+    const int16_t* complexVectorPtr = (const int16_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        *iBufferPtr++ = (float)volk_16i_load_be(complexVectorPtr++) / scalar;
+        *qBufferPtr++ = (float)volk_16i_load_be(complexVectorPtr++) / scalar;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void
+volk_16ic_s32f_byteswap_deinterleave_32f_x2_a_avx2(float* iBuffer,
+                                                   float* qBuffer,
+                                                   const lv_16sc_t* complexVector,
+                                                   const float scalar,
+                                                   unsigned int num_points)
+{
+    const int16_t* complexVectorPtr = (const int16_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const __m256 invScalar = _mm256_set1_ps(1.0f / scalar);
+    const __m256i swapIdx = _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5,
+                                            2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9,
+                                            6, 7, 4, 5, 2, 3, 0, 1);
+    __m256i complexVal, iVal, qVal;
+
+    for (number = 0; number < eighthPoints; number++) {
+        // each 32-bit lane holds one sample once the bytes are swapped, I in its
+        // low and Q in its high half, so shifts sign extend them in order
+        complexVal = _mm256_load_si256((const __m256i*)complexVectorPtr);
+        complexVal = _mm256_shuffle_epi8(complexVal, swapIdx);
+        iVal = _mm256_srai_epi32(_mm256_slli_epi32(complexVal, 16), 16);
+        qVal = _mm256_srai_epi32(complexVal, 16);
+
+        _mm256_store_ps(iBufferPtr, _mm256_mul_ps(_mm256_cvtepi32_ps(iVal), invScalar));
+        _mm256_store_ps(qBufferPtr, _mm256_mul_ps(_mm256_cvtepi32_ps(qVal), invScalar));
+
+        complexVectorPtr += 16;
+        iBufferPtr += 8;
+        qBufferPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *iBufferPtr++ = (float)volk_16i_load_be(complexVectorPtr++) / scalar;
+        *qBufferPtr++ = (float)volk_16i_load_be(complexVectorPtr++) / scalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void
+volk_16ic_s32f_byteswap_deinterleave_32f_x2_u_avx2(float* iBuffer,
+                                                   float* qBuffer,
+                                                   const lv_16sc_t* complexVector,
+                                                   const float scalar,
+                                                   unsigned int num_points)
+{
+    const int16_t* complexVectorPtr = (const int16_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const __m256 invScalar = _mm256_set1_ps(1.0f / scalar);
+    const __m256i swapIdx = _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5,
+                                            2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9,
+                                            6, 7, 4, 5, 2, 3, 0, 1);
+    __m256i complexVal, iVal, qVal;
+
+    for (number = 0; number < eighthPoints; number++) {
+        // each 32-bit lane holds one sample once the bytes are swapped, I in its
+        // low and Q in its high half, so shifts sign extend them in order
+        complexVal = _mm256_loadu_si256((const __m256i*)complexVectorPtr);
+        complexVal = _mm256_shuffle_epi8(complexVal, swapIdx);
+        iVal = _mm256_srai_epi32(_mm256_slli_epi32(complexVal, 16), 16);
+        qVal = _mm256_srai_epi32(complexVal, 16);
+
+        _mm256_storeu_ps(iBufferPtr, _mm256_mul_ps(_mm256_cvtepi32_ps(iVal), invScalar));
+        _mm256_storeu_ps(qBufferPtr, _mm256_mul_ps(_mm256_cvtepi32_ps(qVal), invScalar));
+
+        complexVectorPtr += 16;
+        iBufferPtr += 8;
+        qBufferPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *iBufferPtr++ = (float)volk_16i_load_be(complexVectorPtr++) / scalar;
+        *qBufferPtr++ = (float)volk_16i_load_be(complexVectorPtr++) / scalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_16ic_s32f_byteswap_deinterleave_32f_x2_neon(float* iBuffer,
+                                                 float* qBuffer,
+                                                 const lv_16sc_t* complexVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    const int16_t* complexVectorPtr = (const int16_t*)complexVector;
+    float* iBufferPtr = iBuffer;
+    float* qBufferPtr = qBuffer;
+    const unsigned int eighthPoints = num_points / 8;
+    const float invScalar = 1.0f / scalar;
+    unsigned int number;
+
+    int16x8x2_t complexVal;
+    int16x8_t iVal, qVal;
+
+    for (number = 0; number < eighthPoints; number++) {
+        complexVal = vld2q_s16(complexVectorPtr);
+        iVal = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(complexVal.val[0])));
+        qVal = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(complexVal.val[1])));
+
+        vst1q_f32(iBufferPtr,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(iVal))), invScalar));
+        vst1q_f32(iBufferPtr + 4,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(iVal))), invScalar));
+        vst1q_f32(qBufferPtr,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(qVal))), invScalar));
+        vst1q_f32(qBufferPtr + 4,
+                  vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(qVal))), invScalar));
+
+        complexVectorPtr += 16;
+        iBufferPtr += 8;
+        qBufferPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *iBufferPtr++ = (float)volk_16i_load_be(complexVectorPtr++) / scalar;
+        *qBufferPtr++ = (float)volk_16i_load_be(complexVectorPtr++) / scalar;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_s32f_byteswap_deinterleave_32f_x2_H */
@@ -0,0 +1,109 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_16ic_s32fc_x2_q15_rotator_16ic.h'
+ */
+
+#ifndef INCLUDED_volk_16ic_s32fc_q15_rotatorpuppet_16ic_H
+#define INCLUDED_volk_16ic_s32fc_q15_rotatorpuppet_16ic_H
+
+#include <volk/volk_16ic_s32fc_x2_q15_rotator_16ic.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_16ic_s32fc_q15_rotatorpuppet_16ic_generic(lv_16sc_t* outVector,
+                                               const lv_16sc_t* inVector,
+                                               const lv_32fc_t phase_inc,
+                                               unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32fc_x2_q15_rotator_16ic_generic(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_16ic_s32fc_q15_rotatorpuppet_16ic_u_avx2(lv_16sc_t* outVector,
+                                              const lv_16sc_t* inVector,
+                                              const lv_32fc_t phase_inc,
+                                              unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32fc_x2_q15_rotator_16ic_u_avx2(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+
+static inline void
+volk_16ic_s32fc_q15_rotatorpuppet_16ic_u_avx512bw(lv_16sc_t* outVector,
+                                                  const lv_16sc_t* inVector,
+                                                  const lv_32fc_t phase_inc,
+                                                  unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32fc_x2_q15_rotator_16ic_u_avx512bw(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void
+volk_16ic_s32fc_q15_rotatorpuppet_16ic_neonv8(lv_16sc_t* outVector,
+                                              const lv_16sc_t* inVector,
+                                              const lv_32fc_t phase_inc,
+                                              unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32fc_x2_q15_rotator_16ic_neonv8(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16ic_s32fc_q15_rotatorpuppet_16ic_H */
@@ -0,0 +1,314 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_s32fc_x2_q15_rotator_16ic
+ *
+ * \b Overview
+ *
+ * Rotates a Q15 complex vector at a fixed rate per sample from an initial
+ * phase, as volk_32fc_s32fc_x2_rotator_32fc does for floats. The phase is
+ * kept in floating point; the phase of each sample is rounded to Q15, with
+ * one at 32767, and multiplied into it as by volk_16ic_x2_q15_multiply_16ic.
+ *
+ * The SIMD versions keep the phases of consecutive samples in the lanes of
+ * float registers and step them by phase_inc to the power of the lane count.
+ * Every ROTATOR_RELOAD samples they re-seed the lanes from phases computed in
+ * double precision, so the rounding does not build up. A phase rounded to
+ * the other side moves each part of an output by up to two counts from the
+ * generic one.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_s32fc_x2_q15_rotator_16ic(lv_16sc_t* outVector,
+ * const lv_16sc_t* inVector, const lv_32fc_t phase_inc, lv_32fc_t* phase,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The vector to rotate.
+ * \li phase_inc: The rotation per sample, of magnitude one.
+ * \li phase: The initial phase, of magnitude one; updated to the phase of the
+ *     next sample.
+ * \li num_points: The number of complex values.
+ *
+ * \b Outputs
+ * \li outVector: The rotated vector.
+ *
+ * \b Example
+ * Shift a constant input by f=0.1 in Q15.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(16384, 0);
+ *   }
+ *   lv_32fc_t phase_increment = lv_cmake(std::cos(0.1f), std::sin(0.1f));
+ *   lv_32fc_t phase = lv_cmake(1.f, 0.f);
+ *
+ *   volk_16ic_s32fc_x2_q15_rotator_16ic(out, in, phase_increment, &phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %i + %ij\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_s32fc_x2_q15_rotator_16ic_H
+#define INCLUDED_volk_16ic_s32fc_x2_q15_rotator_16ic_H
+
+#include <math.h>
+#include <volk/saturation_arithmetic.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+/* The Q15 value of a phase of magnitude one, rounded to nearest */
+static inline lv_16sc_t volk_rotator_q15_phase(lv_32fc_t phase)
+{
+    return lv_cmake((int16_t)rintf(32767.f * lv_creal(phase)),
+                    (int16_t)rintf(32767.f * lv_cimag(phase)));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_s32fc_x2_q15_rotator_16ic_generic(lv_16sc_t* outVector,
+                                                               const lv_16sc_t* inVector,
+                                                               const lv_32fc_t phase_inc,
+                                                               lv_32fc_t* phase,
+                                                               unsigned int num_points)
+{
+    unsigned int i = 0;
+    int j = 0;
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        for (j = 0; j < ROTATOR_RELOAD; ++j) {
+            *outVector++ = sat_cmulq15(*inVector++, volk_rotator_q15_phase(*phase));
+            (*phase) *= phase_inc;
+        }
+
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+    for (i = 0; i < num_points % ROTATOR_RELOAD; ++i) {
+        *outVector++ = sat_cmulq15(*inVector++, volk_rotator_q15_phase(*phase));
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16ic_s32fc_x2_q15_rotator_16ic_u_avx2(lv_16sc_t* outVector,
+                                                              const lv_16sc_t* inVector,
+                                                              const lv_32fc_t phase_inc,
+                                                              lv_32fc_t* phase,
+                                                              unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t phases[8];
+    const __m256 scale = _mm256_set1_ps(32767.f);
+    // repeat the real and the imaginary part of each phase over both halves
+    const __m256i dupReal = _mm256_setr_epi8(0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8, 9, 12,
+                                             13, 12, 13, 0, 1, 0, 1, 4, 5, 4, 5, 8, 9,
+                                             8, 9, 12, 13, 12, 13);
+    const __m256i dupImag = _mm256_setr_epi8(2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10, 11,
+                                             14, 15, 14, 15, 2, 3, 2, 3, 6, 7, 6, 7,
+                                             10, 11, 10, 11, 14, 15, 14, 15);
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    __m256 p0, p1;
+    __m256i q;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 8, 1);
+    const __m256 incVec = _mm256_setr_ps(lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_exact_phases(phases, *phase, phase_inc, i, 8);
+        p0 = _mm256_load_ps((const float*)phases);
+        p1 = _mm256_load_ps((const float*)(phases + 4));
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 8; j++) {
+            // the pack interleaves the 128-bit halves, put the phases back in order
+            q = _mm256_packs_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(p0, scale)),
+                                   _mm256_cvtps_epi32(_mm256_mul_ps(p1, scale)));
+            q = _mm256_permute4x64_epi64(q, 0xd8);
+            _mm256_storeu_si256(
+                (__m256i*)outVector,
+                _mm256_complexmul_q15_epi16(_mm256_loadu_si256((const __m256i*)inVector),
+                                            _mm256_shuffle_epi8(q, dupReal),
+                                            _mm256_shuffle_epi8(q, dupImag)));
+            p0 = _mm256_complexmul_ps(p0, incVec);
+            p1 = _mm256_complexmul_ps(p1, incVec);
+            inVector += 8;
+            outVector += 8;
+        }
+
+        // the lanes hold the phases of the samples left in the block
+        _mm256_store_ps((float*)phases, p0);
+        _mm256_store_ps((float*)(phases + 4), p1);
+        for (j = 0; j < block_points % 8; j++) {
+            *outVector++ = sat_cmulq15(*inVector++, volk_rotator_q15_phase(phases[j]));
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_16ic_s32fc_x2_q15_rotator_16ic_u_avx512bw(lv_16sc_t* outVector,
+                                               const lv_16sc_t* inVector,
+                                               const lv_32fc_t phase_inc,
+                                               lv_32fc_t* phase,
+                                               unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phases[16];
+    const __m512 scale = _mm512_set1_ps(32767.f);
+    // the pack interleaves the 128-bit lanes of its two inputs
+    const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+    const __m512i dupReal = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8, 9, 12, 13, 12, 13));
+    const __m512i dupImag = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10, 11, 14, 15, 14, 15));
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    __m512 p0, p1;
+    __m512i q, x;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 16, 1);
+    const __m512 incVec = _mm512_setr4_ps(
+        lv_creal(incr), lv_cimag(incr), lv_creal(incr), lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_exact_phases(phases, *phase, phase_inc, i, 16);
+        p0 = _mm512_load_ps((const float*)phases);
+        p1 = _mm512_load_ps((const float*)(phases + 8));
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points; j += 16) {
+            // the samples left in the block with masked loads and a masked store
+            const __mmask16 mask = _cvtu32_mask16(
+                block_points - j < 16 ? (1u << (block_points - j)) - 1 : 0xffff);
+            q = _mm512_packs_epi32(_mm512_cvtps_epi32(_mm512_mul_ps(p0, scale)),
+                                   _mm512_cvtps_epi32(_mm512_mul_ps(p1, scale)));
+            q = _mm512_permutexvar_epi64(order, q);
+            x = _mm512_maskz_loadu_epi32(mask, inVector);
+            _mm512_mask_storeu_epi32(
+                outVector,
+                mask,
+                _mm512_complexmul_q15_epi16(
+                    x, _mm512_shuffle_epi8(q, dupReal), _mm512_shuffle_epi8(q, dupImag)));
+            p0 = _mm512_complexmul_ps(p0, incVec);
+            p1 = _mm512_complexmul_ps(p1, incVec);
+            inVector += 16;
+            outVector += 16;
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16ic_s32fc_x2_q15_rotator_16ic_neonv8(lv_16sc_t* outVector,
+                                                              const lv_16sc_t* inVector,
+                                                              const lv_32fc_t phase_inc,
+                                                              lv_32fc_t* phase,
+                                                              unsigned int num_points)
+{
+    lv_32fc_t phases[8];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    float32x4x2_t p0, p1, incVec;
+    int16x8x2_t q;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 8, 1);
+    incVec.val[0] = vdupq_n_f32(lv_creal(incr));
+    incVec.val[1] = vdupq_n_f32(lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_exact_phases(phases, *phase, phase_inc, i, 8);
+        p0 = vld2q_f32((const float*)phases);
+        p1 = vld2q_f32((const float*)(phases + 4));
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 8; j++) {
+            q.val[0] = vcombine_s16(
+                vqmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(p0.val[0], 32767.f))),
+                vqmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(p1.val[0], 32767.f))));
+            q.val[1] = vcombine_s16(
+                vqmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(p0.val[1], 32767.f))),
+                vqmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(p1.val[1], 32767.f))));
+            vst2q_s16((int16_t*)outVector,
+                      _vcomplexmul_q15q_s16(vld2q_s16((const int16_t*)inVector), q));
+            p0 = _vmultiply_complexq_f32_fma(p0, incVec);
+            p1 = _vmultiply_complexq_f32_fma(p1, incVec);
+            inVector += 8;
+            outVector += 8;
+        }
+
+        // the lanes hold the phases of the samples left in the block
+        vst2q_f32((float*)phases, p0);
+        vst2q_f32((float*)(phases + 4), p1);
+        for (j = 0; j < block_points % 8; j++) {
+            *outVector++ = sat_cmulq15(*inVector++, volk_rotator_q15_phase(phases[j]));
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16ic_s32fc_x2_q15_rotator_16ic_H */
@@ -0,0 +1,370 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_x2_dot_prod_32ic
+ *
+ * \b Overview
+ *
+ * Multiplies two complex 16-bit integer vectors point by point and accumulates the
+ * products in 32-bit integers, without the saturation of
+ * volk_16ic_x2_dot_prod_16ic and without a conversion to float. The products are
+ * exact and the sums wrap modulo 2^32, so the result is the same on every machine
+ * and exact as long as it fits in 32 bits; volk_16ic_x2_dot_prod_64ic never wraps.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_x2_dot_prod_32ic(lv_32sc_t* result, const lv_16sc_t* in_a,
+ *                                 const lv_16sc_t* in_b, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_a: One of the vectors to be multiplied and accumulated.
+ * \li in_b: The other vector to be multiplied and accumulated.
+ * \li num_points: The number of complex values to be multiplied and accumulated.
+ *
+ * \b Outputs
+ * \li result: The accumulated result.
+ *
+ */
+
+#ifndef INCLUDED_volk_16ic_x2_dot_prod_32ic_H
+#define INCLUDED_volk_16ic_x2_dot_prod_32ic_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_x2_dot_prod_32ic_generic(lv_32sc_t* result,
+                                                      const lv_16sc_t* in_a,
+                                                      const lv_16sc_t* in_b,
+                                                      unsigned int num_points)
+{
+    const int16_t* a = (const int16_t*)in_a;
+    const int16_t* b = (const int16_t*)in_b;
+    // unsigned sums wrap where signed ones would overflow
+    uint32_t real = 0, imag = 0;
+    unsigned int n;
+
+    for (n = 0; n < num_points; n++) {
+        real += (uint32_t)(a[2 * n] * b[2 * n]) - (uint32_t)(a[2 * n + 1] * b[2 * n + 1]);
+        imag += (uint32_t)(a[2 * n] * b[2 * n + 1]) + (uint32_t)(a[2 * n + 1] * b[2 * n]);
+    }
+
+    ((int32_t*)result)[0] = (int32_t)real;
+    ((int32_t*)result)[1] = (int32_t)imag;
+}
+
+#endif /*LV_HAVE_GENERIC*/
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_dot_prod_32ic_a_avx2(lv_32sc_t* result,
+                                                     const lv_16sc_t* in_a,
+                                                     const lv_16sc_t* in_b,
+                                                     unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    // pmaddwd against br|0 and 0|bi gives ar*br and ai*bi without the overflow of
+    // negating bi = -32768, against bi|br the imaginary part in one go
+    const __m256i realMask = _mm256_set1_epi32(0x0000ffff);
+    const __m256i imagMask = _mm256_set1_epi32((int)0xffff0000);
+    const __m256i swapIdx = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6,
+                                            1, 0, 3, 2, 13, 12, 15, 14, 9, 8, 11, 10,
+                                            5, 4, 7, 6, 1, 0, 3, 2);
+    __m256i a, b, realAcc, imagAcc;
+    realAcc = _mm256_setzero_si256();
+    imagAcc = _mm256_setzero_si256();
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = _mm256_load_si256((const __m256i*)aPtr);
+        b = _mm256_load_si256((const __m256i*)bPtr);
+
+        realAcc = _mm256_add_epi32(
+            realAcc,
+            _mm256_sub_epi32(_mm256_madd_epi16(a, _mm256_and_si256(b, realMask)),
+                             _mm256_madd_epi16(a, _mm256_and_si256(b, imagMask))));
+        imagAcc = _mm256_add_epi32(
+            imagAcc, _mm256_madd_epi16(a, _mm256_shuffle_epi8(b, swapIdx)));
+
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) int32_t realVector[8];
+    __VOLK_ATTR_ALIGNED(32) int32_t imagVector[8];
+    _mm256_store_si256((__m256i*)realVector, realAcc);
+    _mm256_store_si256((__m256i*)imagVector, imagAcc);
+
+    uint32_t real = 0, imag = 0;
+    for (number = 0; number < 8; number++) {
+        real += (uint32_t)realVector[number];
+        imag += (uint32_t)imagVector[number];
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        real += (uint32_t)(aPtr[0] * bPtr[0]) - (uint32_t)(aPtr[1] * bPtr[1]);
+        imag += (uint32_t)(aPtr[0] * bPtr[1]) + (uint32_t)(aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int32_t*)result)[0] = (int32_t)real;
+    ((int32_t*)result)[1] = (int32_t)imag;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_dot_prod_32ic_a_avx512bw(lv_32sc_t* result,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    const __m512i realMask = _mm512_set1_epi32(0x0000ffff);
+    const __m512i imagMask = _mm512_set1_epi32((int)0xffff0000);
+    const __m512i swapIdx =
+        _mm512_set4_epi32(0x0d0c0f0e, 0x09080b0a, 0x05040706, 0x01000302);
+    __m512i a, b, realAcc, imagAcc;
+    realAcc = _mm512_setzero_si512();
+    imagAcc = _mm512_setzero_si512();
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        a = _mm512_load_si512((const void*)aPtr);
+        b = _mm512_load_si512((const void*)bPtr);
+
+        realAcc = _mm512_add_epi32(
+            realAcc,
+            _mm512_sub_epi32(_mm512_madd_epi16(a, _mm512_and_si512(b, realMask)),
+                             _mm512_madd_epi16(a, _mm512_and_si512(b, imagMask))));
+        imagAcc = _mm512_add_epi32(
+            imagAcc, _mm512_madd_epi16(a, _mm512_shuffle_epi8(b, swapIdx)));
+
+        aPtr += 32;
+        bPtr += 32;
+    }
+
+    uint32_t real = (uint32_t)_mm512_reduce_add_epi32(realAcc);
+    uint32_t imag = (uint32_t)_mm512_reduce_add_epi32(imagAcc);
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        real += (uint32_t)(aPtr[0] * bPtr[0]) - (uint32_t)(aPtr[1] * bPtr[1]);
+        imag += (uint32_t)(aPtr[0] * bPtr[1]) + (uint32_t)(aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int32_t*)result)[0] = (int32_t)real;
+    ((int32_t*)result)[1] = (int32_t)imag;
+}
+
+#endif /*LV_HAVE_AVX512BW*/
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_dot_prod_32ic_u_avx2(lv_32sc_t* result,
+                                                     const lv_16sc_t* in_a,
+                                                     const lv_16sc_t* in_b,
+                                                     unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    // pmaddwd against br|0 and 0|bi gives ar*br and ai*bi without the overflow of
+    // negating bi = -32768, against bi|br the imaginary part in one go
+    const __m256i realMask = _mm256_set1_epi32(0x0000ffff);
+    const __m256i imagMask = _mm256_set1_epi32((int)0xffff0000);
+    const __m256i swapIdx = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6,
+                                            1, 0, 3, 2, 13, 12, 15, 14, 9, 8, 11, 10,
+                                            5, 4, 7, 6, 1, 0, 3, 2);
+    __m256i a, b, realAcc, imagAcc;
+    realAcc = _mm256_setzero_si256();
+    imagAcc = _mm256_setzero_si256();
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = _mm256_loadu_si256((const __m256i*)aPtr);
+        b = _mm256_loadu_si256((const __m256i*)bPtr);
+
+        realAcc = _mm256_add_epi32(
+            realAcc,
+            _mm256_sub_epi32(_mm256_madd_epi16(a, _mm256_and_si256(b, realMask)),
+                             _mm256_madd_epi16(a, _mm256_and_si256(b, imagMask))));
+        imagAcc = _mm256_add_epi32(
+            imagAcc, _mm256_madd_epi16(a, _mm256_shuffle_epi8(b, swapIdx)));
+
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) int32_t realVector[8];
+    __VOLK_ATTR_ALIGNED(32) int32_t imagVector[8];
+    _mm256_store_si256((__m256i*)realVector, realAcc);
+    _mm256_store_si256((__m256i*)imagVector, imagAcc);
+
+    uint32_t real = 0, imag = 0;
+    for (number = 0; number < 8; number++) {
+        real += (uint32_t)realVector[number];
+        imag += (uint32_t)imagVector[number];
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        real += (uint32_t)(aPtr[0] * bPtr[0]) - (uint32_t)(aPtr[1] * bPtr[1]);
+        imag += (uint32_t)(aPtr[0] * bPtr[1]) + (uint32_t)(aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int32_t*)result)[0] = (int32_t)real;
+    ((int32_t*)result)[1] = (int32_t)imag;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_dot_prod_32ic_u_avx512bw(lv_32sc_t* result,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    const __m512i realMask = _mm512_set1_epi32(0x0000ffff);
+    const __m512i imagMask = _mm512_set1_epi32((int)0xffff0000);
+    const __m512i swapIdx =
+        _mm512_set4_epi32(0x0d0c0f0e, 0x09080b0a, 0x05040706, 0x01000302);
+    __m512i a, b, realAcc, imagAcc;
+    realAcc = _mm512_setzero_si512();
+    imagAcc = _mm512_setzero_si512();
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        a = _mm512_loadu_si512((const void*)aPtr);
+        b = _mm512_loadu_si512((const void*)bPtr);
+
+        realAcc = _mm512_add_epi32(
+            realAcc,
+            _mm512_sub_epi32(_mm512_madd_epi16(a, _mm512_and_si512(b, realMask)),
+                             _mm512_madd_epi16(a, _mm512_and_si512(b, imagMask))));
+        imagAcc = _mm512_add_epi32(
+            imagAcc, _mm512_madd_epi16(a, _mm512_shuffle_epi8(b, swapIdx)));
+
+        aPtr += 32;
+        bPtr += 32;
+    }
+
+    uint32_t real = (uint32_t)_mm512_reduce_add_epi32(realAcc);
+    uint32_t imag = (uint32_t)_mm512_reduce_add_epi32(imagAcc);
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        real += (uint32_t)(aPtr[0] * bPtr[0]) - (uint32_t)(aPtr[1] * bPtr[1]);
+        imag += (uint32_t)(aPtr[0] * bPtr[1]) + (uint32_t)(aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int32_t*)result)[0] = (int32_t)real;
+    ((int32_t*)result)[1] = (int32_t)imag;
+}
+
+#endif /*LV_HAVE_AVX512BW*/
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16ic_x2_dot_prod_32ic_neon(lv_32sc_t* result,
+                                                   const lv_16sc_t* in_a,
+                                                   const lv_16sc_t* in_b,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    int16x8x2_t a, b;
+    int32x4_t realAcc0 = vdupq_n_s32(0), imagAcc0 = vdupq_n_s32(0);
+    int32x4_t realAcc1 = vdupq_n_s32(0), imagAcc1 = vdupq_n_s32(0);
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = vld2q_s16(aPtr);
+        b = vld2q_s16(bPtr);
+
+        realAcc0 = vmlal_s16(realAcc0, vget_low_s16(a.val[0]), vget_low_s16(b.val[0]));
+        realAcc0 = vmlsl_s16(realAcc0, vget_low_s16(a.val[1]), vget_low_s16(b.val[1]));
+        imagAcc0 = vmlal_s16(imagAcc0, vget_low_s16(a.val[0]), vget_low_s16(b.val[1]));
+        imagAcc0 = vmlal_s16(imagAcc0, vget_low_s16(a.val[1]), vget_low_s16(b.val[0]));
+        realAcc1 = vmlal_s16(realAcc1, vget_high_s16(a.val[0]), vget_high_s16(b.val[0]));
+        realAcc1 = vmlsl_s16(realAcc1, vget_high_s16(a.val[1]), vget_high_s16(b.val[1]));
+        imagAcc1 = vmlal_s16(imagAcc1, vget_high_s16(a.val[0]), vget_high_s16(b.val[1]));
+        imagAcc1 = vmlal_s16(imagAcc1, vget_high_s16(a.val[1]), vget_high_s16(b.val[0]));
+
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(16) int32_t realVector[4];
+    __VOLK_ATTR_ALIGNED(16) int32_t imagVector[4];
+    vst1q_s32(realVector, vaddq_s32(realAcc0, realAcc1));
+    vst1q_s32(imagVector, vaddq_s32(imagAcc0, imagAcc1));
+
+    uint32_t real = 0, imag = 0;
+    for (number = 0; number < 4; number++) {
+        real += (uint32_t)realVector[number];
+        imag += (uint32_t)imagVector[number];
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        real += (uint32_t)(aPtr[0] * bPtr[0]) - (uint32_t)(aPtr[1] * bPtr[1]);
+        imag += (uint32_t)(aPtr[0] * bPtr[1]) + (uint32_t)(aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int32_t*)result)[0] = (int32_t)real;
+    ((int32_t*)result)[1] = (int32_t)imag;
+}
+
+#endif /*LV_HAVE_NEON*/
+
+#endif /*INCLUDED_volk_16ic_x2_dot_prod_32ic_H*/
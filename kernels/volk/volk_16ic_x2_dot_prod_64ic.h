@@ -0,0 +1,399 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_x2_dot_prod_64ic
+ *
+ * \b Overview
+ *
+ * Multiplies two complex 16-bit integer vectors point by point and accumulates the
+ * products in 64-bit integers. The result is exact for any input and length up to
+ * 2^32 points, so long correlations keep their full precision while the data stays
+ * 16-bit end to end.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_x2_dot_prod_64ic(lv_64sc_t* result, const lv_16sc_t* in_a,
+ *                                 const lv_16sc_t* in_b, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_a: One of the vectors to be multiplied and accumulated.
+ * \li in_b: The other vector to be multiplied and accumulated.
+ * \li num_points: The number of complex values to be multiplied and accumulated.
+ *
+ * \b Outputs
+ * \li result: The accumulated result.
+ *
+ */
+
+#ifndef INCLUDED_volk_16ic_x2_dot_prod_64ic_H
+#define INCLUDED_volk_16ic_x2_dot_prod_64ic_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_x2_dot_prod_64ic_generic(lv_64sc_t* result,
+                                                      const lv_16sc_t* in_a,
+                                                      const lv_16sc_t* in_b,
+                                                      unsigned int num_points)
+{
+    const int16_t* a = (const int16_t*)in_a;
+    const int16_t* b = (const int16_t*)in_b;
+    int64_t real = 0, imag = 0;
+    unsigned int n;
+
+    for (n = 0; n < num_points; n++) {
+        real += (int64_t)(a[2 * n] * b[2 * n]) - (a[2 * n + 1] * b[2 * n + 1]);
+        imag += (int64_t)(a[2 * n] * b[2 * n + 1]) + (a[2 * n + 1] * b[2 * n]);
+    }
+
+    ((int64_t*)result)[0] = real;
+    ((int64_t*)result)[1] = imag;
+}
+
+#endif /*LV_HAVE_GENERIC*/
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_dot_prod_64ic_a_avx2(lv_64sc_t* result,
+                                                     const lv_16sc_t* in_a,
+                                                     const lv_16sc_t* in_b,
+                                                     unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    // ar*br - ai*bi always fits 32 bits, ar*bi + ai*br does not for -32768 all
+    // around, so its two products are widened separately
+    const __m256i realMask = _mm256_set1_epi32(0x0000ffff);
+    const __m256i imagMask = _mm256_set1_epi32((int)0xffff0000);
+    const __m256i swapIdx = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6,
+                                            1, 0, 3, 2, 13, 12, 15, 14, 9, 8, 11, 10,
+                                            5, 4, 7, 6, 1, 0, 3, 2);
+    __m256i a, b, bSwap, real, imag0, imag1, realAcc, imagAcc;
+    realAcc = _mm256_setzero_si256();
+    imagAcc = _mm256_setzero_si256();
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = _mm256_load_si256((const __m256i*)aPtr);
+        b = _mm256_load_si256((const __m256i*)bPtr);
+        bSwap = _mm256_shuffle_epi8(b, swapIdx);
+
+        real = _mm256_sub_epi32(_mm256_madd_epi16(a, _mm256_and_si256(b, realMask)),
+                                _mm256_madd_epi16(a, _mm256_and_si256(b, imagMask)));
+        imag0 = _mm256_madd_epi16(a, _mm256_and_si256(bSwap, realMask));
+        imag1 = _mm256_madd_epi16(a, _mm256_and_si256(bSwap, imagMask));
+
+        realAcc = _mm256_add_epi64(
+            realAcc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(real)));
+        realAcc = _mm256_add_epi64(
+            realAcc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(real, 1)));
+        imagAcc = _mm256_add_epi64(
+            imagAcc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(imag0)));
+        imagAcc = _mm256_add_epi64(
+            imagAcc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(imag0, 1)));
+        imagAcc = _mm256_add_epi64(
+            imagAcc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(imag1)));
+        imagAcc = _mm256_add_epi64(
+            imagAcc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(imag1, 1)));
+
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) int64_t realVector[4];
+    __VOLK_ATTR_ALIGNED(32) int64_t imagVector[4];
+    _mm256_store_si256((__m256i*)realVector, realAcc);
+    _mm256_store_si256((__m256i*)imagVector, imagAcc);
+
+    int64_t realSum = realVector[0] + realVector[1] + realVector[2] + realVector[3];
+    int64_t imagSum = imagVector[0] + imagVector[1] + imagVector[2] + imagVector[3];
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        realSum += (int64_t)(aPtr[0] * bPtr[0]) - (aPtr[1] * bPtr[1]);
+        imagSum += (int64_t)(aPtr[0] * bPtr[1]) + (aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int64_t*)result)[0] = realSum;
+    ((int64_t*)result)[1] = imagSum;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_dot_prod_64ic_a_avx512bw(lv_64sc_t* result,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    const __m512i realMask = _mm512_set1_epi32(0x0000ffff);
+    const __m512i imagMask = _mm512_set1_epi32((int)0xffff0000);
+    const __m512i swapIdx =
+        _mm512_set4_epi32(0x0d0c0f0e, 0x09080b0a, 0x05040706, 0x01000302);
+    __m512i a, b, bSwap, real, imag0, imag1, realAcc, imagAcc;
+    realAcc = _mm512_setzero_si512();
+    imagAcc = _mm512_setzero_si512();
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        a = _mm512_load_si512((const void*)aPtr);
+        b = _mm512_load_si512((const void*)bPtr);
+        bSwap = _mm512_shuffle_epi8(b, swapIdx);
+
+        real = _mm512_sub_epi32(_mm512_madd_epi16(a, _mm512_and_si512(b, realMask)),
+                                _mm512_madd_epi16(a, _mm512_and_si512(b, imagMask)));
+        imag0 = _mm512_madd_epi16(a, _mm512_and_si512(bSwap, realMask));
+        imag1 = _mm512_madd_epi16(a, _mm512_and_si512(bSwap, imagMask));
+
+        realAcc = _mm512_add_epi64(
+            realAcc, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(real)));
+        realAcc = _mm512_add_epi64(
+            realAcc, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(real, 1)));
+        imagAcc = _mm512_add_epi64(
+            imagAcc, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(imag0)));
+        imagAcc = _mm512_add_epi64(
+            imagAcc, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(imag0, 1)));
+        imagAcc = _mm512_add_epi64(
+            imagAcc, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(imag1)));
+        imagAcc = _mm512_add_epi64(
+            imagAcc, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(imag1, 1)));
+
+        aPtr += 32;
+        bPtr += 32;
+    }
+
+    int64_t realSum = _mm512_reduce_add_epi64(realAcc);
+    int64_t imagSum = _mm512_reduce_add_epi64(imagAcc);
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        realSum += (int64_t)(aPtr[0] * bPtr[0]) - (aPtr[1] * bPtr[1]);
+        imagSum += (int64_t)(aPtr[0] * bPtr[1]) + (aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int64_t*)result)[0] = realSum;
+    ((int64_t*)result)[1] = imagSum;
+}
+
+#endif /*LV_HAVE_AVX512BW*/
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_dot_prod_64ic_u_avx2(lv_64sc_t* result,
+                                                     const lv_16sc_t* in_a,
+                                                     const lv_16sc_t* in_b,
+                                                     unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    // ar*br - ai*bi always fits 32 bits, ar*bi + ai*br does not for -32768 all
+    // around, so its two products are widened separately
+    const __m256i realMask = _mm256_set1_epi32(0x0000ffff);
+    const __m256i imagMask = _mm256_set1_epi32((int)0xffff0000);
+    const __m256i swapIdx = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6,
+                                            1, 0, 3, 2, 13, 12, 15, 14, 9, 8, 11, 10,
+                                            5, 4, 7, 6, 1, 0, 3, 2);
+    __m256i a, b, bSwap, real, imag0, imag1, realAcc, imagAcc;
+    realAcc = _mm256_setzero_si256();
+    imagAcc = _mm256_setzero_si256();
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = _mm256_loadu_si256((const __m256i*)aPtr);
+        b = _mm256_loadu_si256((const __m256i*)bPtr);
+        bSwap = _mm256_shuffle_epi8(b, swapIdx);
+
+        real = _mm256_sub_epi32(_mm256_madd_epi16(a, _mm256_and_si256(b, realMask)),
+                                _mm256_madd_epi16(a, _mm256_and_si256(b, imagMask)));
+        imag0 = _mm256_madd_epi16(a, _mm256_and_si256(bSwap, realMask));
+        imag1 = _mm256_madd_epi16(a, _mm256_and_si256(bSwap, imagMask));
+
+        realAcc = _mm256_add_epi64(
+            realAcc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(real)));
+        realAcc = _mm256_add_epi64(
+            realAcc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(real, 1)));
+        imagAcc = _mm256_add_epi64(
+            imagAcc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(imag0)));
+        imagAcc = _mm256_add_epi64(
+            imagAcc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(imag0, 1)));
+        imagAcc = _mm256_add_epi64(
+            imagAcc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(imag1)));
+        imagAcc = _mm256_add_epi64(
+            imagAcc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(imag1, 1)));
+
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) int64_t realVector[4];
+    __VOLK_ATTR_ALIGNED(32) int64_t imagVector[4];
+    _mm256_store_si256((__m256i*)realVector, realAcc);
+    _mm256_store_si256((__m256i*)imagVector, imagAcc);
+
+    int64_t realSum = realVector[0] + realVector[1] + realVector[2] + realVector[3];
+    int64_t imagSum = imagVector[0] + imagVector[1] + imagVector[2] + imagVector[3];
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        realSum += (int64_t)(aPtr[0] * bPtr[0]) - (aPtr[1] * bPtr[1]);
+        imagSum += (int64_t)(aPtr[0] * bPtr[1]) + (aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int64_t*)result)[0] = realSum;
+    ((int64_t*)result)[1] = imagSum;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_dot_prod_64ic_u_avx512bw(lv_64sc_t* result,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    const __m512i realMask = _mm512_set1_epi32(0x0000ffff);
+    const __m512i imagMask = _mm512_set1_epi32((int)0xffff0000);
+    const __m512i swapIdx =
+        _mm512_set4_epi32(0x0d0c0f0e, 0x09080b0a, 0x05040706, 0x01000302);
+    __m512i a, b, bSwap, real, imag0, imag1, realAcc, imagAcc;
+    realAcc = _mm512_setzero_si512();
+    imagAcc = _mm512_setzero_si512();
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        a = _mm512_loadu_si512((const void*)aPtr);
+        b = _mm512_loadu_si512((const void*)bPtr);
+        bSwap = _mm512_shuffle_epi8(b, swapIdx);
+
+        real = _mm512_sub_epi32(_mm512_madd_epi16(a, _mm512_and_si512(b, realMask)),
+                                _mm512_madd_epi16(a, _mm512_and_si512(b, imagMask)));
+        imag0 = _mm512_madd_epi16(a, _mm512_and_si512(bSwap, realMask));
+        imag1 = _mm512_madd_epi16(a, _mm512_and_si512(bSwap, imagMask));
+
+        realAcc = _mm512_add_epi64(
+            realAcc, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(real)));
+        realAcc = _mm512_add_epi64(
+            realAcc, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(real, 1)));
+        imagAcc = _mm512_add_epi64(
+            imagAcc, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(imag0)));
+        imagAcc = _mm512_add_epi64(
+            imagAcc, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(imag0, 1)));
+        imagAcc = _mm512_add_epi64(
+            imagAcc, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(imag1)));
+        imagAcc = _mm512_add_epi64(
+            imagAcc, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(imag1, 1)));
+
+        aPtr += 32;
+        bPtr += 32;
+    }
+
+    int64_t realSum = _mm512_reduce_add_epi64(realAcc);
+    int64_t imagSum = _mm512_reduce_add_epi64(imagAcc);
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        realSum += (int64_t)(aPtr[0] * bPtr[0]) - (aPtr[1] * bPtr[1]);
+        imagSum += (int64_t)(aPtr[0] * bPtr[1]) + (aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int64_t*)result)[0] = realSum;
+    ((int64_t*)result)[1] = imagSum;
+}
+
+#endif /*LV_HAVE_AVX512BW*/
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16ic_x2_dot_prod_64ic_neon(lv_64sc_t* result,
+                                                   const lv_16sc_t* in_a,
+                                                   const lv_16sc_t* in_b,
+                                                   unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const int16_t* aPtr = (const int16_t*)in_a;
+    const int16_t* bPtr = (const int16_t*)in_b;
+    unsigned int number;
+
+    int16x4x2_t a, b;
+    int32x4_t real;
+    int64x2_t realAcc = vdupq_n_s64(0), imagAcc = vdupq_n_s64(0);
+
+    for (number = 0; number < quarterPoints; number++) {
+        a = vld2_s16(aPtr);
+        b = vld2_s16(bPtr);
+
+        // ar*br - ai*bi fits 32 bits, the two imaginary products are added long
+        real = vmlsl_s16(vmull_s16(a.val[0], b.val[0]), a.val[1], b.val[1]);
+        realAcc = vpadalq_s32(realAcc, real);
+        imagAcc = vpadalq_s32(imagAcc, vmull_s16(a.val[0], b.val[1]));
+        imagAcc = vpadalq_s32(imagAcc, vmull_s16(a.val[1], b.val[0]));
+
+        aPtr += 8;
+        bPtr += 8;
+    }
+
+    int64_t realSum = vgetq_lane_s64(realAcc, 0) + vgetq_lane_s64(realAcc, 1);
+    int64_t imagSum = vgetq_lane_s64(imagAcc, 0) + vgetq_lane_s64(imagAcc, 1);
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        realSum += (int64_t)(aPtr[0] * bPtr[0]) - (aPtr[1] * bPtr[1]);
+        imagSum += (int64_t)(aPtr[0] * bPtr[1]) + (aPtr[1] * bPtr[0]);
+        aPtr += 2;
+        bPtr += 2;
+    }
+
+    ((int64_t*)result)[0] = realSum;
+    ((int64_t*)result)[1] = imagSum;
+}
+
+#endif /*LV_HAVE_NEON*/
+
+#endif /*INCLUDED_volk_16ic_x2_dot_prod_64ic_H*/
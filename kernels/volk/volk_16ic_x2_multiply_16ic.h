@@ -426,6 +426,102 @@ static inline void volk_16ic_x2_multiply_16ic_a_avx2(lv_16sc_t* out,
 #endif /* LV_HAVE_AVX2  */
 
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_multiply_16ic_u_avx512bw(lv_16sc_t* out,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int nRemaining = num_points % 16;
+
+    const lv_16sc_t* _in_a = in_a;
+    const lv_16sc_t* _in_b = in_b;
+    lv_16sc_t* _out = out;
+
+    __m512i a, b, c, real, imag;
+    // real parts a.r*b.r-a.i*b.i in the even lanes, imag parts a.i*b.r+b.i*a.r in the odd ones
+    const __mmask32 imag_lanes = _cvtu32_mask32(0xAAAAAAAA);
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        a = _mm512_loadu_si512((void*)_in_a);
+        b = _mm512_loadu_si512((void*)_in_b);
+        c = _mm512_mullo_epi16(a, b);
+        real = _mm512_subs_epi16(c, _mm512_bsrli_epi128(c, 2));
+        imag = _mm512_adds_epi16(_mm512_mullo_epi16(a, _mm512_bslli_epi128(b, 2)),
+                                 _mm512_mullo_epi16(b, _mm512_bslli_epi128(a, 2)));
+        _mm512_storeu_si512((void*)_out, _mm512_mask_blend_epi16(imag_lanes, real, imag));
+
+        _in_a += 16;
+        _in_b += 16;
+        _out += 16;
+    }
+
+    // Multiply the remaining points with masked loads and a masked store
+    if (nRemaining) {
+        const __mmask16 mask = _cvtu32_mask16((1u << nRemaining) - 1);
+        a = _mm512_maskz_loadu_epi32(mask, _in_a);
+        b = _mm512_maskz_loadu_epi32(mask, _in_b);
+        c = _mm512_mullo_epi16(a, b);
+        real = _mm512_subs_epi16(c, _mm512_bsrli_epi128(c, 2));
+        imag = _mm512_adds_epi16(_mm512_mullo_epi16(a, _mm512_bslli_epi128(b, 2)),
+                                 _mm512_mullo_epi16(b, _mm512_bslli_epi128(a, 2)));
+        _mm512_mask_storeu_epi32(_out, mask, _mm512_mask_blend_epi16(imag_lanes, real, imag));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_x2_multiply_16ic_a_avx512bw(lv_16sc_t* out,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int nRemaining = num_points % 16;
+
+    const lv_16sc_t* _in_a = in_a;
+    const lv_16sc_t* _in_b = in_b;
+    lv_16sc_t* _out = out;
+
+    __m512i a, b, c, real, imag;
+    // real parts a.r*b.r-a.i*b.i in the even lanes, imag parts a.i*b.r+b.i*a.r in the odd ones
+    const __mmask32 imag_lanes = _cvtu32_mask32(0xAAAAAAAA);
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        a = _mm512_load_si512((void*)_in_a);
+        b = _mm512_load_si512((void*)_in_b);
+        c = _mm512_mullo_epi16(a, b);
+        real = _mm512_subs_epi16(c, _mm512_bsrli_epi128(c, 2));
+        imag = _mm512_adds_epi16(_mm512_mullo_epi16(a, _mm512_bslli_epi128(b, 2)),
+                                 _mm512_mullo_epi16(b, _mm512_bslli_epi128(a, 2)));
+        _mm512_store_si512((void*)_out, _mm512_mask_blend_epi16(imag_lanes, real, imag));
+
+        _in_a += 16;
+        _in_b += 16;
+        _out += 16;
+    }
+
+    // Multiply the remaining points with masked loads and a masked store
+    if (nRemaining) {
+        const __mmask16 mask = _cvtu32_mask16((1u << nRemaining) - 1);
+        a = _mm512_maskz_loadu_epi32(mask, _in_a);
+        b = _mm512_maskz_loadu_epi32(mask, _in_b);
+        c = _mm512_mullo_epi16(a, b);
+        real = _mm512_subs_epi16(c, _mm512_bsrli_epi128(c, 2));
+        imag = _mm512_adds_epi16(_mm512_mullo_epi16(a, _mm512_bslli_epi128(b, 2)),
+                                 _mm512_mullo_epi16(b, _mm512_bslli_epi128(a, 2)));
+        _mm512_mask_storeu_epi32(_out, mask, _mm512_mask_blend_epi16(imag_lanes, real, imag));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
 
@@ -475,4 +571,29 @@ static inline void volk_16ic_x2_multiply_16ic_neon(lv_16sc_t* out,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_SVE2
+#include <arm_sve.h>
+
+static inline void volk_16ic_x2_multiply_16ic_sve2(lv_16sc_t* out,
+                                                   const lv_16sc_t* in_a,
+                                                   const lv_16sc_t* in_b,
+                                                   unsigned int num_points)
+{
+    const int16_t* a = (const int16_t*)in_a;
+    const int16_t* b = (const int16_t*)in_b;
+    int16_t* c = (int16_t*)out;
+    const unsigned int n = 2 * num_points;
+
+    for (unsigned int i = 0; i < n; i += svcnth()) {
+        const svbool_t pg = svwhilelt_b16_u32(i, n);
+        const svint16_t va = svld1_s16(pg, a + i);
+        const svint16_t vb = svld1_s16(pg, b + i);
+        // wrapping like the generic kernel: re = ar*br - ai*bi, im = ar*bi + ai*br
+        svint16_t acc = svcmla_s16(svdup_n_s16(0), va, vb, 0);
+        acc = svcmla_s16(acc, va, vb, 90);
+        svst1_s16(pg, c + i, acc);
+    }
+}
+#endif /* LV_HAVE_SVE2 */
+
 #endif /*INCLUDED_volk_16ic_x2_multiply_16ic_H*/
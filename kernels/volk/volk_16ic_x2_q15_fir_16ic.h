@@ -0,0 +1,220 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_x2_q15_fir_16ic
+ *
+ * \b Overview
+ *
+ * Filters a block of Q15 complex samples with Q15 complex taps, computing
+ * num_points outputs in one call. Output i is the dot product of the taps
+ * with the num_taps inputs starting at i, so the input holds
+ * num_points + num_taps - 1 samples: the num_taps - 1 samples of history,
+ * then the new ones. The taps are in time reversed order.
+ *
+ * Each product is rounded and saturated as by volk_16ic_x2_q15_multiply_16ic
+ * and the products are summed with saturation in tap order, as
+ * volk_16ic_x2_dot_prod_16ic does, so every implementation gives the same
+ * outputs. Scale the taps so that the sums stay in range.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_x2_q15_fir_16ic(lv_16sc_t* output, const lv_16sc_t* input,
+ * const lv_16sc_t* taps, unsigned int num_taps, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: num_points + num_taps - 1 samples, the oldest first.
+ * \li taps: The filter taps, time reversed.
+ * \li num_taps: The number of taps, at least 1.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: output[i] = sum of input[i + k] * taps[k] over k < num_taps.
+ *
+ * \b Example
+ * Average four samples.
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*(N + 3), alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*N, alignment);
+ *   lv_16sc_t taps[4];
+ *
+ *   for(unsigned int ii = 0; ii < 4; ++ii){
+ *       taps[ii] = lv_cmake(8192, 0);
+ *   }
+ *
+ *   volk_16ic_x2_q15_fir_16ic(out, in, taps, 4, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_x2_q15_fir_16ic_H
+#define INCLUDED_volk_16ic_x2_q15_fir_16ic_H
+
+#include <volk/saturation_arithmetic.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_x2_q15_fir_16ic_generic(lv_16sc_t* output,
+                                                     const lv_16sc_t* input,
+                                                     const lv_16sc_t* taps,
+                                                     unsigned int num_taps,
+                                                     unsigned int num_points)
+{
+    unsigned int number, k;
+    for (number = 0; number < num_points; number++) {
+        int16_t real = 0, imag = 0;
+        for (k = 0; k < num_taps; k++) {
+            const lv_16sc_t product = sat_cmulq15(input[number + k], taps[k]);
+            real = sat_adds16i(real, lv_creal(product));
+            imag = sat_adds16i(imag, lv_cimag(product));
+        }
+        output[number] = lv_cmake(real, imag);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16ic_x2_q15_fir_16ic_u_avx2(lv_16sc_t* output,
+                                                    const lv_16sc_t* input,
+                                                    const lv_16sc_t* taps,
+                                                    unsigned int num_taps,
+                                                    unsigned int num_points)
+{
+    unsigned int number = 0, k;
+
+    // two vectors of outputs share every tap
+    for (; number + 16 <= num_points; number += 16) {
+        const lv_16sc_t* in = input + number;
+        __m256i sum0 = _mm256_setzero_si256();
+        __m256i sum1 = _mm256_setzero_si256();
+        for (k = 0; k < num_taps; k++) {
+            const __m256i tap_re = _mm256_set1_epi16(lv_creal(taps[k]));
+            const __m256i tap_im = _mm256_set1_epi16(lv_cimag(taps[k]));
+            const __m256i x0 = _mm256_loadu_si256((const __m256i*)(in + k));
+            const __m256i x1 = _mm256_loadu_si256((const __m256i*)(in + k + 8));
+            sum0 = _mm256_adds_epi16(sum0,
+                                     _mm256_complexmul_q15_epi16(x0, tap_re, tap_im));
+            sum1 = _mm256_adds_epi16(sum1,
+                                     _mm256_complexmul_q15_epi16(x1, tap_re, tap_im));
+        }
+        _mm256_storeu_si256((__m256i*)(output + number), sum0);
+        _mm256_storeu_si256((__m256i*)(output + number + 8), sum1);
+    }
+
+    for (; number < num_points; number++) {
+        int16_t real = 0, imag = 0;
+        for (k = 0; k < num_taps; k++) {
+            const lv_16sc_t product = sat_cmulq15(input[number + k], taps[k]);
+            real = sat_adds16i(real, lv_creal(product));
+            imag = sat_adds16i(imag, lv_cimag(product));
+        }
+        output[number] = lv_cmake(real, imag);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16ic_x2_q15_fir_16ic_u_avx512bw(lv_16sc_t* output,
+                                                        const lv_16sc_t* input,
+                                                        const lv_16sc_t* taps,
+                                                        unsigned int num_taps,
+                                                        unsigned int num_points)
+{
+    unsigned int number = 0, k;
+
+    for (; number < num_points; number += 16) {
+        const lv_16sc_t* in = input + number;
+        // the last outputs with masked loads and a masked store
+        const unsigned int remaining = num_points - number;
+        const __mmask16 mask =
+            _cvtu32_mask16(remaining < 16 ? (1u << remaining) - 1 : 0xffff);
+        __m512i sum = _mm512_setzero_si512();
+        for (k = 0; k < num_taps; k++) {
+            const __m512i tap_re = _mm512_set1_epi16(lv_creal(taps[k]));
+            const __m512i tap_im = _mm512_set1_epi16(lv_cimag(taps[k]));
+            const __m512i x = _mm512_maskz_loadu_epi32(mask, in + k);
+            sum = _mm512_adds_epi16(sum, _mm512_complexmul_q15_epi16(x, tap_re, tap_im));
+        }
+        _mm512_mask_storeu_epi32(output + number, mask, sum);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16ic_x2_q15_fir_16ic_neon(lv_16sc_t* output,
+                                                  const lv_16sc_t* input,
+                                                  const lv_16sc_t* taps,
+                                                  unsigned int num_taps,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0, k;
+
+    for (; number + 8 <= num_points; number += 8) {
+        const lv_16sc_t* in = input + number;
+        int16x8x2_t sum, tap, product;
+        sum.val[0] = vdupq_n_s16(0);
+        sum.val[1] = vdupq_n_s16(0);
+        for (k = 0; k < num_taps; k++) {
+            tap.val[0] = vdupq_n_s16(lv_creal(taps[k]));
+            tap.val[1] = vdupq_n_s16(lv_cimag(taps[k]));
+            product = _vcomplexmul_q15q_s16(vld2q_s16((const int16_t*)(in + k)), tap);
+            sum.val[0] = vqaddq_s16(sum.val[0], product.val[0]);
+            sum.val[1] = vqaddq_s16(sum.val[1], product.val[1]);
+        }
+        vst2q_s16((int16_t*)(output + number), sum);
+    }
+
+    for (; number < num_points; number++) {
+        int16_t real = 0, imag = 0;
+        for (k = 0; k < num_taps; k++) {
+            const lv_16sc_t product = sat_cmulq15(input[number + k], taps[k]);
+            real = sat_adds16i(real, lv_creal(product));
+            imag = sat_adds16i(imag, lv_cimag(product));
+        }
+        output[number] = lv_cmake(real, imag);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_x2_q15_fir_16ic_H */
@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_16IC_X2_Q15_FIRPUPPET_16IC_H
+#define INCLUDED_VOLK_16IC_X2_Q15_FIRPUPPET_16IC_H
+
+#include <volk/volk_16ic_x2_q15_fir_16ic.h>
+#include <volk/volk_32f_firpuppet_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_16ic_x2_q15_firpuppet_16ic_generic(lv_16sc_t* output,
+                                                           const lv_16sc_t* input,
+                                                           const lv_16sc_t* taps,
+                                                           unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_16ic_x2_q15_fir_16ic_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_16ic_x2_q15_firpuppet_16ic_u_avx2(lv_16sc_t* output,
+                                                          const lv_16sc_t* input,
+                                                          const lv_16sc_t* taps,
+                                                          unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_16ic_x2_q15_fir_16ic_u_avx2);
+}
+#endif /* LV_HAVE_AVX2 */
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+static inline void volk_16ic_x2_q15_firpuppet_16ic_u_avx512bw(lv_16sc_t* output,
+                                                              const lv_16sc_t* input,
+                                                              const lv_16sc_t* taps,
+                                                              unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_16ic_x2_q15_fir_16ic_u_avx512bw);
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_16ic_x2_q15_firpuppet_16ic_neon(lv_16sc_t* output,
+                                                        const lv_16sc_t* input,
+                                                        const lv_16sc_t* taps,
+                                                        unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_16ic_x2_q15_fir_16ic_neon);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_16IC_X2_Q15_FIRPUPPET_16IC_H */
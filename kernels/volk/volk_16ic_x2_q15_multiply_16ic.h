@@ -0,0 +1,215 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_16ic_x2_q15_multiply_16ic
+ *
+ * \b Overview
+ *
+ * Multiplies two Q15 complex vectors point by point. Each of the four real products
+ * is rounded to Q15 and saturated, and so are their difference and sum, which makes
+ * the result the same on every machine:
+ *
+ * result[i] = (a_r * b_r - a_i * b_i) + j (a_i * b_r + a_r * b_i)
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_x2_q15_multiply_16ic(lv_16sc_t* result, const lv_16sc_t* in_a,
+ *                                     const lv_16sc_t* in_b, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_a: One of the vectors to be multiplied.
+ * \li in_b: The other vector to be multiplied.
+ * \li num_points: The number of complex data points to be multiplied.
+ *
+ * \b Outputs
+ * \li result: The vector where the results will be stored.
+ *
+ * \b Example
+ * Shift a tone by a quarter of the sample rate in Q15.
+ * \code
+ *   int N = 8;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*N, alignment);
+ *   lv_16sc_t* shift = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*N, alignment);
+ *   const lv_16sc_t quarter[4] = { lv_cmake(32767, 0), lv_cmake(0, 32767),
+ *                                  lv_cmake(-32767, 0), lv_cmake(0, -32767) };
+ *
+ *   for(int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(16384, 0);
+ *       shift[ii] = quarter[ii % 4];
+ *   }
+ *
+ *   volk_16ic_x2_q15_multiply_16ic(out, in, shift, N);
+ *
+ *   for(int ii = 0; ii < N; ++ii){
+ *       printf("out[%i] = %i + %ij\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(shift);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_x2_q15_multiply_16ic_H
+#define INCLUDED_volk_16ic_x2_q15_multiply_16ic_H
+
+#include <volk/saturation_arithmetic.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_x2_q15_multiply_16ic_generic(lv_16sc_t* result,
+                                                          const lv_16sc_t* in_a,
+                                                          const lv_16sc_t* in_b,
+                                                          unsigned int num_points)
+{
+    unsigned int n;
+    for (n = 0; n < num_points; n++) {
+        result[n] = sat_cmulq15(in_a[n], in_b[n]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16ic_x2_q15_multiply_16ic_u_avx2(lv_16sc_t* result,
+                                                         const lv_16sc_t* in_a,
+                                                         const lv_16sc_t* in_b,
+                                                         unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    // repeat the real and the imaginary part of each value of b over both halves
+    const __m256i dupReal = _mm256_setr_epi8(0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8, 9, 12,
+                                             13, 12, 13, 0, 1, 0, 1, 4, 5, 4, 5, 8, 9,
+                                             8, 9, 12, 13, 12, 13);
+    const __m256i dupImag = _mm256_setr_epi8(2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10, 11,
+                                             14, 15, 14, 15, 2, 3, 2, 3, 6, 7, 6, 7,
+                                             10, 11, 10, 11, 14, 15, 14, 15);
+    __m256i a, b;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = _mm256_loadu_si256((const __m256i*)in_a);
+        b = _mm256_loadu_si256((const __m256i*)in_b);
+        _mm256_storeu_si256((__m256i*)result,
+                            _mm256_complexmul_q15_epi16(a,
+                                                        _mm256_shuffle_epi8(b, dupReal),
+                                                        _mm256_shuffle_epi8(b, dupImag)));
+        in_a += 8;
+        in_b += 8;
+        result += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *result++ = sat_cmulq15(*in_a++, *in_b++);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16ic_x2_q15_multiply_16ic_u_avx512bw(lv_16sc_t* result,
+                                                             const lv_16sc_t* in_a,
+                                                             const lv_16sc_t* in_b,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int nRemaining = num_points % 16;
+    // repeat the real and the imaginary part of each value of b over both halves
+    const __m512i dupReal = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8, 9, 12, 13, 12, 13));
+    const __m512i dupImag = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10, 11, 14, 15, 14, 15));
+    __m512i a, b;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        a = _mm512_loadu_si512((const void*)in_a);
+        b = _mm512_loadu_si512((const void*)in_b);
+        _mm512_storeu_si512((void*)result,
+                            _mm512_complexmul_q15_epi16(a,
+                                                        _mm512_shuffle_epi8(b, dupReal),
+                                                        _mm512_shuffle_epi8(b, dupImag)));
+        in_a += 16;
+        in_b += 16;
+        result += 16;
+    }
+
+    // Multiply the remaining points with masked loads and a masked store
+    if (nRemaining) {
+        const __mmask16 mask = _cvtu32_mask16((1u << nRemaining) - 1);
+        a = _mm512_maskz_loadu_epi32(mask, in_a);
+        b = _mm512_maskz_loadu_epi32(mask, in_b);
+        _mm512_mask_storeu_epi32(
+            result,
+            mask,
+            _mm512_complexmul_q15_epi16(
+                a, _mm512_shuffle_epi8(b, dupReal), _mm512_shuffle_epi8(b, dupImag)));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16ic_x2_q15_multiply_16ic_neon(lv_16sc_t* result,
+                                                       const lv_16sc_t* in_a,
+                                                       const lv_16sc_t* in_b,
+                                                       unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    int16x8x2_t a, b;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = vld2q_s16((const int16_t*)in_a);
+        b = vld2q_s16((const int16_t*)in_b);
+        vst2q_s16((int16_t*)result, _vcomplexmul_q15q_s16(a, b));
+        in_a += 8;
+        in_b += 8;
+        result += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *result++ = sat_cmulq15(*in_a++, *in_b++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_x2_q15_multiply_16ic_H */
@@ -0,0 +1,162 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_16u_32f_lut_32f
+ *
+ * \b Overview
+ *
+ * Maps each 16-bit sample to the float at its index in a table, e.g. to
+ * correct the non-linearity of a 12-bit ADC in the same pass as the
+ * conversion to float. Only the low table_bits bits of a sample index the
+ * table, so the samples of a 12-bit ADC index a table of 4096 entries
+ * whether they come sign extended or not, by their two's complement code.
+ *
+ * The SIMD versions gather eight or sixteen entries at once, leaving the
+ * choice between them and the generic loop to volk_profile.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16u_32f_lut_32f(float* outputVector, const uint16_t* inputVector,
+ * const float* table, unsigned int table_bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The samples whose low bits index the table.
+ * \li table: The 2^table_bits floats to map the samples to.
+ * \li table_bits: The number of index bits, 1 to 16.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: outputVector[n] = table[inputVector[n] & (2^table_bits - 1)].
+ *
+ * \b Example
+ * Convert the samples of a 12-bit ADC with a small second order error,
+ * indexing the table by the two's complement code.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int16_t* in = (int16_t*)volk_malloc(sizeof(int16_t)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* table = (float*)volk_malloc(sizeof(float)*4096, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < 4096; ++ii){
+ *       float x = (float)(ii < 2048 ? (int)ii : (int)ii - 4096) / 2048.f;
+ *       table[ii] = x - 0.001f * x * x;
+ *   }
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = (int16_t)(ii * 7 % 4096) - 2048;
+ *   }
+ *
+ *   volk_16u_32f_lut_32f(out, (const uint16_t*)in, table, 12, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ *   volk_free(table);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16u_32f_lut_32f_u_H
+#define INCLUDED_volk_16u_32f_lut_32f_u_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16u_32f_lut_32f_generic(float* outputVector,
+                                                const uint16_t* inputVector,
+                                                const float* table,
+                                                unsigned int table_bits,
+                                                unsigned int num_points)
+{
+    const unsigned int mask = (1u << table_bits) - 1;
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = table[inputVector[number] & mask];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16u_32f_lut_32f_u_avx2_gather(float* outputVector,
+                                                      const uint16_t* inputVector,
+                                                      const float* table,
+                                                      unsigned int table_bits,
+                                                      unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int mask = (1u << table_bits) - 1;
+    const __m256i maskVector = _mm256_set1_epi32((int)mask);
+    __m256i index;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        index = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)inputVector));
+        index = _mm256_and_si256(index, maskVector);
+        _mm256_storeu_ps(outputVector, _mm256_i32gather_ps(table, index, 4));
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++ & mask];
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16u_32f_lut_32f_u_avx512f_gather(float* outputVector,
+                                                         const uint16_t* inputVector,
+                                                         const float* table,
+                                                         unsigned int table_bits,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int mask = (1u << table_bits) - 1;
+    const __m512i maskVector = _mm512_set1_epi32((int)mask);
+    __m512i index;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        index = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)inputVector));
+        index = _mm512_and_si512(index, maskVector);
+        _mm512_storeu_ps(outputVector, _mm512_i32gather_ps(index, table, 4));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++ & mask];
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_16u_32f_lut_32f_u_H */
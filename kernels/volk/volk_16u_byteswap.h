@@ -187,6 +187,36 @@ static inline void volk_16u_byteswap_u_sse2(uint16_t* intsToSwap, unsigned int n
 #endif /* LV_HAVE_SSE2 */
 
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+static inline void volk_16u_byteswap_u_avx512bw(uint16_t* intsToSwap,
+                                                 unsigned int num_points)
+{
+    const unsigned int nPerSet = 32;
+    const unsigned int nSets = num_points / nPerSet;
+    const unsigned int nRemaining = num_points % nPerSet;
+
+    uint16_t* inputPtr = intsToSwap;
+
+    for (unsigned int number = 0; number < nSets; number++) {
+        const __m512i input = _mm512_loadu_si512((void*)inputPtr);
+        const __m512i output =
+            _mm512_or_si512(_mm512_slli_epi16(input, 8), _mm512_srli_epi16(input, 8));
+        _mm512_storeu_si512((void*)inputPtr, output);
+        inputPtr += nPerSet;
+    }
+
+    // Byteswap the remaining points with a masked load and store
+    if (nRemaining) {
+        const __mmask32 mask = _cvtu32_mask32((1u << nRemaining) - 1);
+        const __m512i input = _mm512_maskz_loadu_epi16(mask, inputPtr);
+        const __m512i output =
+            _mm512_or_si512(_mm512_slli_epi16(input, 8), _mm512_srli_epi16(input, 8));
+        _mm512_mask_storeu_epi16(inputPtr, mask, output);
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #endif /* INCLUDED_volk_16u_byteswap_u_H */
 #ifndef INCLUDED_volk_16u_byteswap_a_H
 #define INCLUDED_volk_16u_byteswap_a_H
@@ -313,4 +343,34 @@ static inline void volk_16u_byteswap_u_orc(uint16_t* intsToSwap, unsigned int nu
 #endif /* LV_HAVE_ORC */
 
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+static inline void volk_16u_byteswap_a_avx512bw(uint16_t* intsToSwap,
+                                                 unsigned int num_points)
+{
+    const unsigned int nPerSet = 32;
+    const unsigned int nSets = num_points / nPerSet;
+    const unsigned int nRemaining = num_points % nPerSet;
+
+    uint16_t* inputPtr = intsToSwap;
+
+    for (unsigned int number = 0; number < nSets; number++) {
+        const __m512i input = _mm512_load_si512((void*)inputPtr);
+        const __m512i output =
+            _mm512_or_si512(_mm512_slli_epi16(input, 8), _mm512_srli_epi16(input, 8));
+        _mm512_store_si512((void*)inputPtr, output);
+        inputPtr += nPerSet;
+    }
+
+    // Byteswap the remaining points with a masked load and store
+    if (nRemaining) {
+        const __mmask32 mask = _cvtu32_mask32((1u << nRemaining) - 1);
+        const __m512i input = _mm512_maskz_loadu_epi16(mask, inputPtr);
+        const __m512i output =
+            _mm512_or_si512(_mm512_slli_epi16(input, 8), _mm512_srli_epi16(input, 8));
+        _mm512_mask_storeu_epi16(inputPtr, mask, output);
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #endif /* INCLUDED_volk_16u_byteswap_a_H */
@@ -83,4 +83,26 @@ static inline void volk_16u_byteswappuppet_16u_a_avx2(uint16_t* output,
 }
 #endif
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+static inline void volk_16u_byteswappuppet_16u_u_avx512bw(uint16_t* output,
+                                                          uint16_t* intsToSwap,
+                                                          unsigned int num_points)
+{
+
+    volk_16u_byteswap_u_avx512bw((uint16_t*)intsToSwap, num_points);
+    memcpy((void*)output, (void*)intsToSwap, num_points * sizeof(uint16_t));
+}
+#endif
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+static inline void volk_16u_byteswappuppet_16u_a_avx512bw(uint16_t* output,
+                                                          uint16_t* intsToSwap,
+                                                          unsigned int num_points)
+{
+
+    volk_16u_byteswap_a_avx512bw((uint16_t*)intsToSwap, num_points);
+    memcpy((void*)output, (void*)intsToSwap, num_points * sizeof(uint16_t));
+}
+#endif
+
 #endif
@@ -0,0 +1,349 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_32f_polyval_32f
+ *
+ * \b Overview
+ *
+ * Evaluates a polynomial at each point of the input with Horner's scheme:
+ *
+ * out[i] = coeffs[0] * in[i]^order + coeffs[1] * in[i]^(order - 1) + ... +
+ * coeffs[order]
+ *
+ * with the coefficients highest power first, as numpy.polyval takes them.
+ *
+ * A Horner step depends on the one before, so the SIMD versions run four
+ * vectors of points through each coefficient to keep the multipliers busy.
+ * The FMA versions round once per step instead of twice.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_32f_polyval_32f(float* outputVector, const float* inputVector,
+ * const float* coeffs, unsigned int order, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The points to evaluate the polynomial at.
+ * \li coeffs: The order + 1 coefficients, highest power first.
+ * \li order: The order of the polynomial.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li outputVector: The values of the polynomial.
+ *
+ * \b Example
+ * A cubic AM/AM correction, out = x - 0.1 x^3.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   const float coeffs[4] = { -0.1f, 0.f, 1.f, 0.f };
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.1f * ii;
+ *   }
+ *
+ *   volk_32f_32f_polyval_32f(out, in, coeffs, 3, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out(%1.1f) = %1.4f\n", in[ii], out[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_32f_polyval_32f_H
+#define INCLUDED_volk_32f_32f_polyval_32f_H
+
+#include <inttypes.h>
+
+static inline float volk_polyval(float x, const float* coeffs, unsigned int order)
+{
+    float value = coeffs[0];
+    unsigned int k;
+
+    for (k = 1; k <= order; k++) {
+        value = value * x + coeffs[k];
+    }
+    return value;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_32f_polyval_32f_generic(float* outputVector,
+                                                    const float* inputVector,
+                                                    const float* coeffs,
+                                                    unsigned int order,
+                                                    unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = volk_polyval(inputVector[number], coeffs, order);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_32f_polyval_32f_u_avx(float* outputVector,
+                                                  const float* inputVector,
+                                                  const float* coeffs,
+                                                  unsigned int order,
+                                                  unsigned int num_points)
+{
+    __m256 x0, x1, x2, x3, y0, y1, y2, y3, c;
+    unsigned int number, k;
+
+    for (number = 0; num_points - number >= 32; number += 32) {
+        x0 = _mm256_loadu_ps(inputVector + number);
+        x1 = _mm256_loadu_ps(inputVector + number + 8);
+        x2 = _mm256_loadu_ps(inputVector + number + 16);
+        x3 = _mm256_loadu_ps(inputVector + number + 24);
+        y0 = y1 = y2 = y3 = _mm256_set1_ps(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            c = _mm256_set1_ps(coeffs[k]);
+            y0 = _mm256_add_ps(_mm256_mul_ps(y0, x0), c);
+            y1 = _mm256_add_ps(_mm256_mul_ps(y1, x1), c);
+            y2 = _mm256_add_ps(_mm256_mul_ps(y2, x2), c);
+            y3 = _mm256_add_ps(_mm256_mul_ps(y3, x3), c);
+        }
+        _mm256_storeu_ps(outputVector + number, y0);
+        _mm256_storeu_ps(outputVector + number + 8, y1);
+        _mm256_storeu_ps(outputVector + number + 16, y2);
+        _mm256_storeu_ps(outputVector + number + 24, y3);
+    }
+
+    for (; num_points - number >= 8; number += 8) {
+        x0 = _mm256_loadu_ps(inputVector + number);
+        y0 = _mm256_set1_ps(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            y0 = _mm256_add_ps(_mm256_mul_ps(y0, x0), _mm256_set1_ps(coeffs[k]));
+        }
+        _mm256_storeu_ps(outputVector + number, y0);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_polyval(inputVector[number], coeffs, order);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_32f_polyval_32f_u_avx2_fma(float* outputVector,
+                                                       const float* inputVector,
+                                                       const float* coeffs,
+                                                       unsigned int order,
+                                                       unsigned int num_points)
+{
+    __m256 x0, x1, x2, x3, y0, y1, y2, y3, c;
+    unsigned int number, k;
+
+    for (number = 0; num_points - number >= 32; number += 32) {
+        x0 = _mm256_loadu_ps(inputVector + number);
+        x1 = _mm256_loadu_ps(inputVector + number + 8);
+        x2 = _mm256_loadu_ps(inputVector + number + 16);
+        x3 = _mm256_loadu_ps(inputVector + number + 24);
+        y0 = y1 = y2 = y3 = _mm256_set1_ps(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            c = _mm256_set1_ps(coeffs[k]);
+            y0 = _mm256_fmadd_ps(y0, x0, c);
+            y1 = _mm256_fmadd_ps(y1, x1, c);
+            y2 = _mm256_fmadd_ps(y2, x2, c);
+            y3 = _mm256_fmadd_ps(y3, x3, c);
+        }
+        _mm256_storeu_ps(outputVector + number, y0);
+        _mm256_storeu_ps(outputVector + number + 8, y1);
+        _mm256_storeu_ps(outputVector + number + 16, y2);
+        _mm256_storeu_ps(outputVector + number + 24, y3);
+    }
+
+    for (; num_points - number >= 8; number += 8) {
+        x0 = _mm256_loadu_ps(inputVector + number);
+        y0 = _mm256_set1_ps(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            y0 = _mm256_fmadd_ps(y0, x0, _mm256_set1_ps(coeffs[k]));
+        }
+        _mm256_storeu_ps(outputVector + number, y0);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_polyval(inputVector[number], coeffs, order);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_32f_polyval_32f_u_avx512f(float* outputVector,
+                                                      const float* inputVector,
+                                                      const float* coeffs,
+                                                      unsigned int order,
+                                                      unsigned int num_points)
+{
+    __m512 x0, x1, x2, x3, y0, y1, y2, y3, c;
+    __mmask16 tail;
+    unsigned int number, k;
+
+    for (number = 0; num_points - number >= 64; number += 64) {
+        x0 = _mm512_loadu_ps(inputVector + number);
+        x1 = _mm512_loadu_ps(inputVector + number + 16);
+        x2 = _mm512_loadu_ps(inputVector + number + 32);
+        x3 = _mm512_loadu_ps(inputVector + number + 48);
+        y0 = y1 = y2 = y3 = _mm512_set1_ps(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            c = _mm512_set1_ps(coeffs[k]);
+            y0 = _mm512_fmadd_ps(y0, x0, c);
+            y1 = _mm512_fmadd_ps(y1, x1, c);
+            y2 = _mm512_fmadd_ps(y2, x2, c);
+            y3 = _mm512_fmadd_ps(y3, x3, c);
+        }
+        _mm512_storeu_ps(outputVector + number, y0);
+        _mm512_storeu_ps(outputVector + number + 16, y1);
+        _mm512_storeu_ps(outputVector + number + 32, y2);
+        _mm512_storeu_ps(outputVector + number + 48, y3);
+    }
+
+    for (; number < num_points; number += 16) {
+        tail = num_points - number >= 16 ? 0xffff
+                                         : (__mmask16)((1u << (num_points - number)) - 1);
+        x0 = _mm512_maskz_loadu_ps(tail, inputVector + number);
+        y0 = _mm512_set1_ps(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            y0 = _mm512_fmadd_ps(y0, x0, _mm512_set1_ps(coeffs[k]));
+        }
+        _mm512_mask_storeu_ps(outputVector + number, tail, y0);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_32f_polyval_32f_neon(float* outputVector,
+                                                 const float* inputVector,
+                                                 const float* coeffs,
+                                                 unsigned int order,
+                                                 unsigned int num_points)
+{
+    float32x4_t x0, x1, x2, x3, y0, y1, y2, y3, c;
+    unsigned int number, k;
+
+    for (number = 0; num_points - number >= 16; number += 16) {
+        x0 = vld1q_f32(inputVector + number);
+        x1 = vld1q_f32(inputVector + number + 4);
+        x2 = vld1q_f32(inputVector + number + 8);
+        x3 = vld1q_f32(inputVector + number + 12);
+        y0 = y1 = y2 = y3 = vdupq_n_f32(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            c = vdupq_n_f32(coeffs[k]);
+            y0 = vmlaq_f32(c, y0, x0);
+            y1 = vmlaq_f32(c, y1, x1);
+            y2 = vmlaq_f32(c, y2, x2);
+            y3 = vmlaq_f32(c, y3, x3);
+        }
+        vst1q_f32(outputVector + number, y0);
+        vst1q_f32(outputVector + number + 4, y1);
+        vst1q_f32(outputVector + number + 8, y2);
+        vst1q_f32(outputVector + number + 12, y3);
+    }
+
+    for (; num_points - number >= 4; number += 4) {
+        x0 = vld1q_f32(inputVector + number);
+        y0 = vdupq_n_f32(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            y0 = vmlaq_f32(vdupq_n_f32(coeffs[k]), y0, x0);
+        }
+        vst1q_f32(outputVector + number, y0);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_polyval(inputVector[number], coeffs, order);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_32f_polyval_32f_neonv8(float* outputVector,
+                                                   const float* inputVector,
+                                                   const float* coeffs,
+                                                   unsigned int order,
+                                                   unsigned int num_points)
+{
+    float32x4_t x0, x1, x2, x3, y0, y1, y2, y3, c;
+    unsigned int number, k;
+
+    for (number = 0; num_points - number >= 16; number += 16) {
+        x0 = vld1q_f32(inputVector + number);
+        x1 = vld1q_f32(inputVector + number + 4);
+        x2 = vld1q_f32(inputVector + number + 8);
+        x3 = vld1q_f32(inputVector + number + 12);
+        y0 = y1 = y2 = y3 = vdupq_n_f32(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            c = vdupq_n_f32(coeffs[k]);
+            y0 = vfmaq_f32(c, y0, x0);
+            y1 = vfmaq_f32(c, y1, x1);
+            y2 = vfmaq_f32(c, y2, x2);
+            y3 = vfmaq_f32(c, y3, x3);
+        }
+        vst1q_f32(outputVector + number, y0);
+        vst1q_f32(outputVector + number + 4, y1);
+        vst1q_f32(outputVector + number + 8, y2);
+        vst1q_f32(outputVector + number + 12, y3);
+    }
+
+    for (; num_points - number >= 4; number += 4) {
+        x0 = vld1q_f32(inputVector + number);
+        y0 = vdupq_n_f32(coeffs[0]);
+        for (k = 1; k <= order; k++) {
+            y0 = vfmaq_f32(vdupq_n_f32(coeffs[k]), y0, x0);
+        }
+        vst1q_f32(outputVector + number, y0);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_polyval(inputVector[number], coeffs, order);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_32f_polyval_32f_H */
@@ -0,0 +1,149 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_32f_polyval_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_32f_polyvalpuppet_32f_H
+#define INCLUDED_volk_32f_32f_polyvalpuppet_32f_H
+
+#include <volk/volk_32f_32f_polyval_32f.h>
+
+/* Evaluates a polynomial of order 9, taking its coefficients from the second input */
+static inline void volk_32f_32f_polyval_puppet(
+    void (*kernel)(float*, const float*, const float*, unsigned int, unsigned int),
+    float* outputVector,
+    const float* inputVector,
+    const float* coeffs,
+    unsigned int num_points)
+{
+    const unsigned int order = num_points > 9 ? 9 : num_points - 1;
+
+    if (num_points > 0) {
+        kernel(outputVector, inputVector, coeffs, order, num_points);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_32f_polyvalpuppet_32f_generic(float* outputVector,
+                                                          const float* inputVector,
+                                                          const float* coeffs,
+                                                          unsigned int num_points)
+{
+    volk_32f_32f_polyval_puppet(volk_32f_32f_polyval_32f_generic,
+                                outputVector,
+                                inputVector,
+                                coeffs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_32f_polyvalpuppet_32f_u_avx(float* outputVector,
+                                                        const float* inputVector,
+                                                        const float* coeffs,
+                                                        unsigned int num_points)
+{
+    volk_32f_32f_polyval_puppet(volk_32f_32f_polyval_32f_u_avx,
+                                outputVector,
+                                inputVector,
+                                coeffs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32f_32f_polyvalpuppet_32f_u_avx2_fma(float* outputVector,
+                                                             const float* inputVector,
+                                                             const float* coeffs,
+                                                             unsigned int num_points)
+{
+    volk_32f_32f_polyval_puppet(volk_32f_32f_polyval_32f_u_avx2_fma,
+                                outputVector,
+                                inputVector,
+                                coeffs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_32f_polyvalpuppet_32f_u_avx512f(float* outputVector,
+                                                            const float* inputVector,
+                                                            const float* coeffs,
+                                                            unsigned int num_points)
+{
+    volk_32f_32f_polyval_puppet(volk_32f_32f_polyval_32f_u_avx512f,
+                                outputVector,
+                                inputVector,
+                                coeffs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_32f_polyvalpuppet_32f_neon(float* outputVector,
+                                                       const float* inputVector,
+                                                       const float* coeffs,
+                                                       unsigned int num_points)
+{
+    volk_32f_32f_polyval_puppet(volk_32f_32f_polyval_32f_neon,
+                                outputVector,
+                                inputVector,
+                                coeffs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32f_32f_polyvalpuppet_32f_neonv8(float* outputVector,
+                                                         const float* inputVector,
+                                                         const float* coeffs,
+                                                         unsigned int num_points)
+{
+    volk_32f_32f_polyval_puppet(volk_32f_32f_polyval_32f_neonv8,
+                                outputVector,
+                                inputVector,
+                                coeffs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_32f_polyvalpuppet_32f_H */
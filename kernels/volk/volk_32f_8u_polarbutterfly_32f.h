@@ -408,4 +408,181 @@ static inline void volk_32f_8u_polarbutterfly_32f_u_avx2(float* llrs,
 
 #endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_8u_polarbutterfly_32f_u_avx512f(float* llrs,
+                                                            unsigned char* u,
+                                                            const int frame_exp,
+                                                            const int stage,
+                                                            const int u_num,
+                                                            const int row)
+{
+    const int frame_size = 0x01 << frame_exp;
+    if (row % 2) { // for odd rows just do the only necessary calculation and return.
+        const float* next_llrs = llrs + frame_size + row;
+        *(llrs + row) = llr_even(*(next_llrs - 1), *next_llrs, u[u_num - 1]);
+        return;
+    }
+
+    const int max_stage_depth = calculate_max_stage_depth_for_row(frame_exp, row);
+    if (max_stage_depth < 4) { // vectorized version needs larger vectors.
+        volk_32f_8u_polarbutterfly_32f_generic(llrs, u, frame_exp, stage, u_num, row);
+        return;
+    }
+
+    int loop_stage = max_stage_depth;
+    int stage_size = 0x01 << loop_stage;
+
+    float* src_llr_ptr;
+    float* dst_llr_ptr;
+
+    __m512 src0, src1, dst;
+
+    if (row) { // not necessary for ZERO row. == first bit to be decoded.
+        // first do bit combination for all stages
+        // effectively encode some decoded bits again.
+        unsigned char* u_target = u + frame_size;
+        unsigned char* u_temp = u + 2 * frame_size;
+        memcpy(u_temp, u + u_num - stage_size, sizeof(unsigned char) * stage_size);
+
+        volk_8u_x2_encodeframepolar_8u_u_ssse3(u_target, u_temp, stage_size);
+
+        src_llr_ptr = llrs + (max_stage_depth + 1) * frame_size + row - stage_size;
+        dst_llr_ptr = llrs + max_stage_depth * frame_size + row;
+
+        __m128i fbits;
+
+        int p;
+        for (p = 0; p < stage_size; p += 16) {
+            fbits = _mm_loadu_si128((__m128i*)u_target);
+            u_target += 16;
+
+            src0 = _mm512_loadu_ps(src_llr_ptr);
+            src1 = _mm512_loadu_ps(src_llr_ptr + 16);
+            src_llr_ptr += 32;
+
+            dst = _mm512_polar_fsign_add_llrs(src0, src1, fbits);
+
+            _mm512_storeu_ps(dst_llr_ptr, dst);
+            dst_llr_ptr += 16;
+        }
+
+        --loop_stage;
+        stage_size >>= 1;
+    }
+
+    const int min_stage = stage > 3 ? stage : 3;
+
+    int el;
+    while (min_stage < loop_stage) {
+        dst_llr_ptr = llrs + loop_stage * frame_size + row;
+        src_llr_ptr = dst_llr_ptr + frame_size;
+        for (el = 0; el < stage_size; el += 16) {
+            src0 = _mm512_loadu_ps(src_llr_ptr);
+            src_llr_ptr += 16;
+            src1 = _mm512_loadu_ps(src_llr_ptr);
+            src_llr_ptr += 16;
+
+            dst = _mm512_polar_minsum_llrs(src0, src1);
+
+            _mm512_storeu_ps(dst_llr_ptr, dst);
+            dst_llr_ptr += 16;
+        }
+
+        --loop_stage;
+        stage_size >>= 1;
+    }
+
+    // for stages < 4 vectors are too small!.
+    llr_odd_stages(llrs, stage, loop_stage + 1, frame_size, row);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_8u_polarbutterfly_32f_neon(float* llrs,
+                                                       unsigned char* u,
+                                                       const int frame_exp,
+                                                       const int stage,
+                                                       const int u_num,
+                                                       const int row)
+{
+    const int frame_size = 0x01 << frame_exp;
+    if (row % 2) { // for odd rows just do the only necessary calculation and return.
+        const float* next_llrs = llrs + frame_size + row;
+        *(llrs + row) = llr_even(*(next_llrs - 1), *next_llrs, u[u_num - 1]);
+        return;
+    }
+
+    const int max_stage_depth = calculate_max_stage_depth_for_row(frame_exp, row);
+    if (max_stage_depth < 2) { // vectorized version needs larger vectors.
+        volk_32f_8u_polarbutterfly_32f_generic(llrs, u, frame_exp, stage, u_num, row);
+        return;
+    }
+
+    int loop_stage = max_stage_depth;
+    int stage_size = 0x01 << loop_stage;
+
+    float* src_llr_ptr;
+    float* dst_llr_ptr;
+
+    if (row) { // not necessary for ZERO row. == first bit to be decoded.
+        // first do bit combination for all stages
+        // effectively encode some decoded bits again.
+        unsigned char* u_target = u + frame_size;
+        unsigned char* u_temp = u + 2 * frame_size;
+        memcpy(u_temp, u + u_num - stage_size, sizeof(unsigned char) * stage_size);
+
+        volk_8u_x2_encodeframepolar_8u_generic(u_target, u_temp, stage_size);
+
+        src_llr_ptr = llrs + (max_stage_depth + 1) * frame_size + row - stage_size;
+        dst_llr_ptr = llrs + max_stage_depth * frame_size + row;
+
+        uint32_t packed;
+        uint32x4_t fbits;
+
+        int p;
+        for (p = 0; p < stage_size; p += 4) {
+            memcpy(&packed, u_target, sizeof(packed));
+            fbits = vmovl_u16(
+                vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed)))));
+            u_target += 4;
+
+            vst1q_f32(dst_llr_ptr,
+                      _vpolar_fsign_add_llrsq_f32(vld2q_f32(src_llr_ptr), fbits));
+            src_llr_ptr += 8;
+            dst_llr_ptr += 4;
+        }
+
+        --loop_stage;
+        stage_size >>= 1;
+    }
+
+    const int min_stage = stage > 1 ? stage : 1;
+
+    int el;
+    while (min_stage < loop_stage) {
+        dst_llr_ptr = llrs + loop_stage * frame_size + row;
+        src_llr_ptr = dst_llr_ptr + frame_size;
+        for (el = 0; el < stage_size; el += 4) {
+            vst1q_f32(dst_llr_ptr, _vpolar_minsum_llrsq_f32(vld2q_f32(src_llr_ptr)));
+            src_llr_ptr += 8;
+            dst_llr_ptr += 4;
+        }
+
+        --loop_stage;
+        stage_size >>= 1;
+    }
+
+    // for stages < 2 vectors are too small!.
+    llr_odd_stages(llrs, stage, loop_stage + 1, frame_size, row);
+}
+
+#endif /* LV_HAVE_NEON */
+
 #endif /* VOLK_KERNELS_VOLK_VOLK_32F_8U_POLARBUTTERFLY_32F_H_ */
@@ -0,0 +1,124 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_8u_polarsclf_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_8u_polarsclfpuppet_32f_H
+#define INCLUDED_volk_32f_8u_polarsclfpuppet_32f_H
+
+#include <string.h>
+#include <volk/volk_32f_8u_polarsclf_32f.h>
+
+/*
+ * Runs the kernel with 4, 8 and 16 paths on thirds of the buffers, with the
+ * parents in the first bytes of each third of paths.
+ */
+static inline void
+volk_polar_scl_f_puppet(void (*kernel)(float*,
+                                       const float*,
+                                       const unsigned char*,
+                                       unsigned int,
+                                       unsigned int),
+                        float* dst,
+                        const float* src,
+                        unsigned char* paths,
+                        unsigned int num_points)
+{
+    const unsigned int third = num_points / 3;
+    unsigned int k, l, list_size;
+
+    memset(dst, 0, sizeof(float) * num_points);
+    for (k = 0, list_size = 4; k < 3; k++, list_size *= 2) {
+        if (third < 2 * list_size)
+            continue;
+        for (l = 0; l < list_size; l++) {
+            paths[k * third + l] &= list_size - 1;
+        }
+        kernel(dst + k * third,
+               src + k * third,
+               paths + k * third,
+               list_size,
+               third / (2 * list_size));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_8u_polarsclfpuppet_32f_generic(float* dst,
+                                                           const float* src,
+                                                           unsigned char* paths,
+                                                           unsigned int num_points)
+{
+    volk_polar_scl_f_puppet(
+        volk_32f_8u_polarsclf_32f_generic, dst, src, paths, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_8u_polarsclfpuppet_32f_avx2(float* dst,
+                                                        const float* src,
+                                                        unsigned char* paths,
+                                                        unsigned int num_points)
+{
+    volk_polar_scl_f_puppet(volk_32f_8u_polarsclf_32f_avx2, dst, src, paths, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_8u_polarsclfpuppet_32f_avx512f(float* dst,
+                                                           const float* src,
+                                                           unsigned char* paths,
+                                                           unsigned int num_points)
+{
+    volk_polar_scl_f_puppet(
+        volk_32f_8u_polarsclf_32f_avx512f, dst, src, paths, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_8u_polarsclfpuppet_32f_neonv8(float* dst,
+                                                          const float* src,
+                                                          unsigned char* paths,
+                                                          unsigned int num_points)
+{
+    volk_polar_scl_f_puppet(
+        volk_32f_8u_polarsclf_32f_neonv8, dst, src, paths, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_8u_polarsclfpuppet_32f_H */
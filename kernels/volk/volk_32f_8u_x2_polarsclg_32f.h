@@ -0,0 +1,268 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_8u_x2_polarsclg_32f
+ *
+ * \b Overview
+ *
+ * Computes the lower branch LLRs, llr_even() of volk_32f_8u_polarbutterfly_32f,
+ * for all list_size paths of a successive cancellation list decoder at once,
+ * in the path-interleaved layout of volk_32f_8u_polarsclf_32f. bits holds the
+ * partial sums of the upper branch of every path, in the layout of the output:
+ *
+ * dst[i * list_size + l] = llr_even(src[2i * list_size + paths[l]],
+ *                                   src[(2i + 1) * list_size + paths[l]],
+ *                                   bits[i * list_size + l])
+ *
+ * The SIMD versions handle list sizes which are powers of two up to twice their
+ * vector length, other list sizes run generic.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_8u_x2_polarsclg_32f(float* dst, const float* src, const unsigned
+ * char* bits, const unsigned char* paths, unsigned int list_size, unsigned int
+ * num_points) \endcode
+ *
+ * \b Inputs
+ * \li src: The LLRs of the stage, 2 * num_points * list_size values.
+ * \li bits: The partial sums, 0 or 1, num_points * list_size values.
+ * \li paths: The parent path of every path, all less than list_size.
+ * \li list_size: The number of paths.
+ * \li num_points: The number of elements to compute per path.
+ *
+ * \b Outputs
+ * \li dst: The LLRs of the next stage, num_points * list_size values.
+ *
+ * \b Example
+ * The lower half of a stage of 2N elements of 8 paths, once the upper half
+ * is decided.
+ * \code
+ *   volk_32f_8u_x2_polarsclg_32f(next_llrs, llrs, partial_sums, paths, 8, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_8u_x2_polarsclg_32f_H
+#define INCLUDED_volk_32f_8u_x2_polarsclg_32f_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_32f_8u_polarsclf_32f.h>
+
+static inline void volk_polar_scl_g(float* dst,
+                                    const float* src,
+                                    const unsigned char* bits,
+                                    const unsigned char* paths,
+                                    unsigned int list_size,
+                                    unsigned int num_points)
+{
+    unsigned int i, l;
+    for (i = 0; i < num_points; i++) {
+        for (l = 0; l < list_size; l++) {
+            *dst++ = llr_even(src[paths[l]], src[list_size + paths[l]], *bits++);
+        }
+        src += 2 * list_size;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_8u_x2_polarsclg_32f_generic(float* dst,
+                                                        const float* src,
+                                                        const unsigned char* bits,
+                                                        const unsigned char* paths,
+                                                        unsigned int list_size,
+                                                        unsigned int num_points)
+{
+    volk_polar_scl_g(dst, src, bits, paths, list_size, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_8u_x2_polarsclg_32f_avx2(float* dst,
+                                                     const float* src,
+                                                     const unsigned char* bits,
+                                                     const unsigned char* paths,
+                                                     unsigned int list_size,
+                                                     unsigned int num_points)
+{
+    int32_t a_idx[16], b_idx[16];
+    unsigned int done = 0;
+
+    if (volk_polar_scl_offsets(a_idx, b_idx, paths, list_size, 8)) {
+        const unsigned int block = list_size > 8 ? list_size : 8;
+        const unsigned int b_offset = list_size > 8 ? list_size : 0;
+        const unsigned int num_blocks = num_points * list_size / block;
+        unsigned int n, j;
+        __m256i a_offsets[2], b_offsets[2];
+        __m256 a, b;
+
+        for (j = 0; j < block / 8; j++) {
+            a_offsets[j] = _mm256_loadu_si256((const __m256i*)(a_idx + 8 * j));
+            b_offsets[j] = _mm256_loadu_si256((const __m256i*)(b_idx + 8 * j));
+        }
+
+        for (n = 0; n < num_blocks; n++) {
+            for (j = 0; j < block / 8; j++) {
+                a = _mm256_permutex2var_ps_avx2(
+                    _mm256_loadu_ps(src), a_offsets[j], _mm256_loadu_ps(src + 8));
+                b = _mm256_permutex2var_ps_avx2(_mm256_loadu_ps(src + b_offset),
+                                                b_offsets[j],
+                                                _mm256_loadu_ps(src + b_offset + 8));
+                _mm256_storeu_ps(
+                    dst,
+                    _mm256_polar_fsign_add_avx2(
+                        a, b, _mm_loadl_epi64((const __m128i*)bits)));
+                dst += 8;
+                bits += 8;
+            }
+            src += 2 * block;
+        }
+        done = num_blocks * block / list_size;
+    }
+
+    volk_polar_scl_g(dst, src, bits, paths, list_size, num_points - done);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_8u_x2_polarsclg_32f_avx512f(float* dst,
+                                                        const float* src,
+                                                        const unsigned char* bits,
+                                                        const unsigned char* paths,
+                                                        unsigned int list_size,
+                                                        unsigned int num_points)
+{
+    int32_t a_idx[32], b_idx[32];
+    unsigned int done = 0;
+
+    if (volk_polar_scl_offsets(a_idx, b_idx, paths, list_size, 16)) {
+        const unsigned int block = list_size > 16 ? list_size : 16;
+        const unsigned int b_offset = list_size > 16 ? list_size : 0;
+        const unsigned int num_blocks = num_points * list_size / block;
+        unsigned int n, j;
+        __m512i a_offsets[2], b_offsets[2];
+        __m512 a, b;
+
+        for (j = 0; j < block / 16; j++) {
+            a_offsets[j] = _mm512_loadu_si512(a_idx + 16 * j);
+            b_offsets[j] = _mm512_loadu_si512(b_idx + 16 * j);
+        }
+
+        for (n = 0; n < num_blocks; n++) {
+            for (j = 0; j < block / 16; j++) {
+                a = _mm512_permutex2var_ps(
+                    _mm512_loadu_ps(src), a_offsets[j], _mm512_loadu_ps(src + 16));
+                b = _mm512_permutex2var_ps(_mm512_loadu_ps(src + b_offset),
+                                           b_offsets[j],
+                                           _mm512_loadu_ps(src + b_offset + 16));
+                _mm512_storeu_ps(
+                    dst,
+                    _mm512_polar_fsign_add(
+                        a, b, _mm_loadu_si128((const __m128i*)bits)));
+                dst += 16;
+                bits += 16;
+            }
+            src += 2 * block;
+        }
+        done = num_blocks * block / list_size;
+    }
+
+    volk_polar_scl_g(dst, src, bits, paths, list_size, num_points - done);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_8u_x2_polarsclg_32f_neonv8(float* dst,
+                                                       const float* src,
+                                                       const unsigned char* bits,
+                                                       const unsigned char* paths,
+                                                       unsigned int list_size,
+                                                       unsigned int num_points)
+{
+    int32_t a_idx[8], b_idx[8];
+    unsigned int done = 0;
+
+    if (volk_polar_scl_offsets(a_idx, b_idx, paths, list_size, 4)) {
+        const unsigned int block = list_size > 4 ? list_size : 4;
+        const unsigned int b_offset = list_size > 4 ? list_size : 0;
+        const unsigned int num_blocks = num_points * list_size / block;
+        unsigned int n, j;
+        uint32_t packed;
+        uint8_t a_bytes[32], b_bytes[32];
+        uint8x16_t a_offsets[2], b_offsets[2];
+        uint8x16x2_t a_window, b_window;
+        uint32x4_t fbits;
+        float32x4x2_t llrs;
+
+        // the table lookups pick bytes, 4 per float
+        for (j = 0; j < 4 * block; j++) {
+            a_bytes[j] = (uint8_t)(4 * a_idx[j / 4] + j % 4);
+            b_bytes[j] = (uint8_t)(4 * b_idx[j / 4] + j % 4);
+        }
+        for (j = 0; j < block / 4; j++) {
+            a_offsets[j] = vld1q_u8(a_bytes + 16 * j);
+            b_offsets[j] = vld1q_u8(b_bytes + 16 * j);
+        }
+
+        for (n = 0; n < num_blocks; n++) {
+            a_window.val[0] = vreinterpretq_u8_f32(vld1q_f32(src));
+            a_window.val[1] = vreinterpretq_u8_f32(vld1q_f32(src + 4));
+            b_window.val[0] = vreinterpretq_u8_f32(vld1q_f32(src + b_offset));
+            b_window.val[1] = vreinterpretq_u8_f32(vld1q_f32(src + b_offset + 4));
+            for (j = 0; j < block / 4; j++) {
+                memcpy(&packed, bits, sizeof(packed));
+                fbits = vmovl_u16(
+                    vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed)))));
+                llrs.val[0] = vreinterpretq_f32_u8(vqtbl2q_u8(a_window, a_offsets[j]));
+                llrs.val[1] = vreinterpretq_f32_u8(vqtbl2q_u8(b_window, b_offsets[j]));
+                vst1q_f32(dst, _vpolar_fsign_add_llrsq_f32(llrs, fbits));
+                dst += 4;
+                bits += 4;
+            }
+            src += 2 * block;
+        }
+        done = num_blocks * block / list_size;
+    }
+
+    volk_polar_scl_g(dst, src, bits, paths, list_size, num_points - done);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_8u_x2_polarsclg_32f_H */
@@ -152,6 +152,54 @@ static inline void volk_32f_accumulator_s32f_u_avx(float* result,
 #endif /* LV_HAVE_AVX */
 
 
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+/* A template for impl_variants in gen/volk_kernel_defs.py, built as u_avx_acc2,
+ * u_avx_acc4 and u_avx_acc8: n_acc independent sums, at most 8, hide the
+ * latency of the adds, which a single sum waits for on every vector. */
+static inline void volk_32f_accumulator_s32f_u_avx_acc(float* result,
+                                                       const float* inputBuffer,
+                                                       unsigned int num_points,
+                                                       const unsigned int n_acc)
+{
+    unsigned int number = 0, k;
+    const unsigned int block = 8 * n_acc;
+    const unsigned int blocks = num_points / block;
+    const float* aPtr = inputBuffer;
+    __VOLK_ATTR_ALIGNED(32) float tempBuffer[8];
+    __m256 accumulator[8];
+
+    for (k = 0; k < n_acc; k++) {
+        accumulator[k] = _mm256_setzero_ps();
+    }
+    for (; number < blocks; number++) {
+        for (k = 0; k < n_acc; k++) {
+            accumulator[k] = _mm256_add_ps(accumulator[k], _mm256_loadu_ps(aPtr + 8 * k));
+        }
+        aPtr += block;
+    }
+    for (number = blocks * block; number + 8 <= num_points; number += 8) {
+        accumulator[0] = _mm256_add_ps(accumulator[0], _mm256_loadu_ps(aPtr));
+        aPtr += 8;
+    }
+    for (k = 1; k < n_acc; k++) {
+        accumulator[0] = _mm256_add_ps(accumulator[0], accumulator[k]);
+    }
+
+    _mm256_store_ps(tempBuffer, accumulator[0]);
+    float returnValue = tempBuffer[0];
+    for (k = 1; k < 8; k++) {
+        returnValue += tempBuffer[k];
+    }
+    for (; number < num_points; number++) {
+        returnValue += (*aPtr++);
+    }
+    *result = returnValue;
+}
+#endif /* LV_HAVE_AVX */
+
+
 #ifdef LV_HAVE_SSE
 #include <xmmintrin.h>
 
@@ -245,4 +293,24 @@ static inline void volk_32f_accumulator_s32f_generic(float* result,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_accumulator_s32f_rvv(float* result,
+                                                 const float* inputBuffer,
+                                                 unsigned int num_points)
+{
+    vfloat32m8_t acc = __riscv_vfmv_v_f_f32m8(0.f, __riscv_vsetvlmax_e32m8());
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, inputBuffer += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        acc = __riscv_vfadd_vv_f32m8_tu(acc, acc, __riscv_vle32_v_f32m8(inputBuffer, vl), vl);
+    }
+    // ordered over the lanes, so the result does not depend on the
+    // reduction tree the hardware picks
+    *result = __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredosum_vs_f32m8_f32m1(
+        acc, __riscv_vfmv_s_f_f32m1(0.f, 1), __riscv_vsetvlmax_e32m8()));
+}
+#endif /* LV_HAVE_RVV */
+
 #endif /* INCLUDED_volk_32f_accumulator_s32f_a_H */
@@ -480,4 +480,33 @@ volk_32f_atan_32f_generic(float* bVector, const float* aVector, unsigned int num
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32f_atan_32f_neonv8(float* bVector, const float* aVector, unsigned int num_points)
+{
+    float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (; number < eighthPoints; number++) {
+        const float32x4_t aVal0 = vld1q_f32(aPtr);
+        const float32x4_t aVal1 = vld1q_f32(aPtr + 4);
+        vst1q_f32(bPtr, _vatanq_f32(aVal0));
+        vst1q_f32(bPtr + 4, _vatanq_f32(aVal1));
+        aPtr += 8;
+        bPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *bPtr++ = atanf(*aPtr++);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
 #endif /* INCLUDED_volk_32f_atan_32f_u_H */
@@ -0,0 +1,282 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_biquad_cascade_32f
+ *
+ * \b Overview
+ *
+ * Runs the same cascade of biquad IIR sections over num_channels
+ * independent channels of interleaved samples, such as the channels of an
+ * audio stream or the beams of an array. Each section computes
+ *
+ * y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+ *
+ * in transposed direct form II, and feeds the next one. An IIR filter
+ * can not be vectorised along time, so the SIMD versions give each
+ * channel a lane and filter eight or sixteen channels at once with fused
+ * multiply-adds, which round a little differently from the generic
+ * version.
+ *
+ * The two delays of every section and channel are carried from call to
+ * call in the state, so a stream cut into buffers is filtered by passing
+ * the same state to every call.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_biquad_cascade_32f(float* outputVector, const float* inputVector,
+ * const float* coeffs, float* state, unsigned int num_stages,
+ * unsigned int num_channels, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: num_points frames of num_channels samples each.
+ * \li coeffs: b0, b1, b2, a1 and a2 of each section, with a0 = 1.
+ * \li state: 2 * num_stages * num_channels delays, zero to start. Section s
+ * keeps its first delays at state[2 * s * num_channels + c] and its second
+ * delays num_channels later.
+ * \li num_stages: The number of sections.
+ * \li num_channels: The number of samples in a frame.
+ * \li num_points: The number of frames.
+ *
+ * \b Outputs
+ * \li outputVector: The filtered frames, interleaved as the input.
+ * \li state: The delays, to carry into the next buffer.
+ *
+ * \b Example
+ * Remove the DC of 32 channels with a single section blocker.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int C = 32;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N*C, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N*C, alignment);
+ *   float coeffs[5] = { 1.f, -1.f, 0.f, -0.995f, 0.f };
+ *   float state[64] = { 0 };
+ *
+ *   for(unsigned int ii = 0; ii < N*C; ++ii){
+ *       in[ii] = 1.f + (float)(ii % C);
+ *   }
+ *
+ *   volk_32f_biquad_cascade_32f(out, in, coeffs, state, 1, C, N);
+ *
+ *   printf("last frame, channel 0: %f\n", out[(N - 1) * C]);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_biquad_cascade_32f_H
+#define INCLUDED_volk_32f_biquad_cascade_32f_H
+
+#include <inttypes.h>
+
+/* The sections on one sample, their delays stride apart in the state */
+static inline float volk_biquad_cascade(const float* coeffs,
+                                        float* state,
+                                        unsigned int stride,
+                                        float value,
+                                        unsigned int num_stages)
+{
+    unsigned int stage;
+    for (stage = 0; stage < num_stages; stage++) {
+        const float* b = coeffs + 5 * stage;
+        float* z = state + 2 * stage * stride;
+        const float out = b[0] * value + z[0];
+        z[0] = b[1] * value - b[3] * out + z[stride];
+        z[stride] = b[2] * value - b[4] * out;
+        value = out;
+    }
+    return value;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_biquad_cascade_32f_generic(float* outputVector,
+                                                       const float* inputVector,
+                                                       const float* coeffs,
+                                                       float* state,
+                                                       unsigned int num_stages,
+                                                       unsigned int num_channels,
+                                                       unsigned int num_points)
+{
+    unsigned int number, channel;
+    for (number = 0; number < num_points; number++) {
+        for (channel = 0; channel < num_channels; channel++) {
+            *outputVector++ = volk_biquad_cascade(
+                coeffs, state + channel, num_channels, *inputVector++, num_stages);
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_biquad_cascade_32f_u_avx2_fma(float* outputVector,
+                                                          const float* inputVector,
+                                                          const float* coeffs,
+                                                          float* state,
+                                                          unsigned int num_stages,
+                                                          unsigned int num_channels,
+                                                          unsigned int num_points)
+{
+    const unsigned int vector_channels = num_channels & ~7u;
+    unsigned int number, channel, stage;
+
+    for (number = 0; number < num_points; number++) {
+        // the state of a frame's channels stays in L1 from frame to frame
+        for (channel = 0; channel < vector_channels; channel += 8) {
+            __m256 x = _mm256_loadu_ps(inputVector + channel);
+            for (stage = 0; stage < num_stages; stage++) {
+                const float* b = coeffs + 5 * stage;
+                float* z1 = state + 2 * stage * num_channels + channel;
+                float* z2 = z1 + num_channels;
+                const __m256 y =
+                    _mm256_fmadd_ps(_mm256_set1_ps(b[0]), x, _mm256_loadu_ps(z1));
+                _mm256_storeu_ps(
+                    z1,
+                    _mm256_fmadd_ps(
+                        _mm256_set1_ps(b[1]),
+                        x,
+                        _mm256_fnmadd_ps(_mm256_set1_ps(b[3]), y, _mm256_loadu_ps(z2))));
+                _mm256_storeu_ps(
+                    z2,
+                    _mm256_fnmadd_ps(_mm256_set1_ps(b[4]),
+                                     y,
+                                     _mm256_mul_ps(_mm256_set1_ps(b[2]), x)));
+                x = y;
+            }
+            _mm256_storeu_ps(outputVector + channel, x);
+        }
+        for (; channel < num_channels; channel++) {
+            outputVector[channel] = volk_biquad_cascade(
+                coeffs, state + channel, num_channels, inputVector[channel], num_stages);
+        }
+        inputVector += num_channels;
+        outputVector += num_channels;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_biquad_cascade_32f_u_avx512f(float* outputVector,
+                                                         const float* inputVector,
+                                                         const float* coeffs,
+                                                         float* state,
+                                                         unsigned int num_stages,
+                                                         unsigned int num_channels,
+                                                         unsigned int num_points)
+{
+    unsigned int number, channel, stage;
+
+    for (number = 0; number < num_points; number++) {
+        // the last channels of a frame take the low lanes of a masked vector
+        for (channel = 0; channel < num_channels; channel += 16) {
+            const __mmask16 lanes =
+                num_channels - channel < 16
+                    ? (__mmask16)((1u << (num_channels - channel)) - 1)
+                    : (__mmask16)0xffff;
+            __m512 x = _mm512_maskz_loadu_ps(lanes, inputVector + channel);
+            for (stage = 0; stage < num_stages; stage++) {
+                const float* b = coeffs + 5 * stage;
+                float* z1 = state + 2 * stage * num_channels + channel;
+                float* z2 = z1 + num_channels;
+                const __m512 y = _mm512_fmadd_ps(
+                    _mm512_set1_ps(b[0]), x, _mm512_maskz_loadu_ps(lanes, z1));
+                _mm512_mask_storeu_ps(
+                    z1,
+                    lanes,
+                    _mm512_fmadd_ps(_mm512_set1_ps(b[1]),
+                                    x,
+                                    _mm512_fnmadd_ps(_mm512_set1_ps(b[3]),
+                                                     y,
+                                                     _mm512_maskz_loadu_ps(lanes, z2))));
+                _mm512_mask_storeu_ps(
+                    z2,
+                    lanes,
+                    _mm512_fnmadd_ps(_mm512_set1_ps(b[4]),
+                                     y,
+                                     _mm512_mul_ps(_mm512_set1_ps(b[2]), x)));
+                x = y;
+            }
+            _mm512_mask_storeu_ps(outputVector + channel, lanes, x);
+        }
+        inputVector += num_channels;
+        outputVector += num_channels;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_biquad_cascade_32f_neonv8(float* outputVector,
+                                                      const float* inputVector,
+                                                      const float* coeffs,
+                                                      float* state,
+                                                      unsigned int num_stages,
+                                                      unsigned int num_channels,
+                                                      unsigned int num_points)
+{
+    const unsigned int vector_channels = num_channels & ~3u;
+    unsigned int number, channel, stage;
+
+    for (number = 0; number < num_points; number++) {
+        for (channel = 0; channel < vector_channels; channel += 4) {
+            float32x4_t x = vld1q_f32(inputVector + channel);
+            for (stage = 0; stage < num_stages; stage++) {
+                const float* b = coeffs + 5 * stage;
+                float* z1 = state + 2 * stage * num_channels + channel;
+                float* z2 = z1 + num_channels;
+                const float32x4_t y = vfmaq_f32(vld1q_f32(z1), vdupq_n_f32(b[0]), x);
+                vst1q_f32(z1,
+                          vfmaq_f32(vfmsq_f32(vld1q_f32(z2), vdupq_n_f32(b[3]), y),
+                                    vdupq_n_f32(b[1]),
+                                    x));
+                vst1q_f32(z2,
+                          vfmsq_f32(vmulq_n_f32(x, b[2]), vdupq_n_f32(b[4]), y));
+                x = y;
+            }
+            vst1q_f32(outputVector + channel, x);
+        }
+        for (; channel < num_channels; channel++) {
+            outputVector[channel] = volk_biquad_cascade(
+                coeffs, state + channel, num_channels, inputVector[channel], num_stages);
+        }
+        inputVector += num_channels;
+        outputVector += num_channels;
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_biquad_cascade_32f_H */
@@ -0,0 +1,122 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_biquad_cascade_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_biquad_cascadepuppet_32f_H
+#define INCLUDED_volk_32f_biquad_cascadepuppet_32f_H
+
+#include <string.h>
+#include <volk/volk_32f_biquad_cascade_32f.h>
+
+/*
+ * Filters 19 channels, one vector and a tail on every machine, with a low
+ * pass and a high pass section, in calls of 50 frames carrying the state.
+ * The samples past the last whole frame are copies of the input.
+ */
+static inline void volk_32f_biquad_cascade_puppet(void (*kernel)(float*,
+                                                                 const float*,
+                                                                 const float*,
+                                                                 float*,
+                                                                 unsigned int,
+                                                                 unsigned int,
+                                                                 unsigned int),
+                                                  float* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    static const float coeffs[10] = { 0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f,
+                                      0.6389f, -1.2779f, 0.6389f, -1.1430f, 0.4128f };
+    const unsigned int channels = 19;
+    const unsigned int frames = num_points / channels;
+    float state[2 * 2 * 19] = { 0.f };
+    unsigned int number;
+
+    for (number = 0; number < frames; number += 50) {
+        kernel(outputVector + number * channels,
+               inputVector + number * channels,
+               coeffs,
+               state,
+               2,
+               channels,
+               frames - number < 50 ? frames - number : 50);
+    }
+    memcpy(outputVector + frames * channels,
+           inputVector + frames * channels,
+           (num_points - frames * channels) * sizeof(float));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_biquad_cascadepuppet_32f_generic(float* outputVector,
+                                                             const float* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_32f_biquad_cascade_puppet(
+        volk_32f_biquad_cascade_32f_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32f_biquad_cascadepuppet_32f_u_avx2_fma(float* outputVector,
+                                                                const float* inputVector,
+                                                                unsigned int num_points)
+{
+    volk_32f_biquad_cascade_puppet(
+        volk_32f_biquad_cascade_32f_u_avx2_fma, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_biquad_cascadepuppet_32f_u_avx512f(float* outputVector,
+                                                               const float* inputVector,
+                                                               unsigned int num_points)
+{
+    volk_32f_biquad_cascade_puppet(
+        volk_32f_biquad_cascade_32f_u_avx512f, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32f_biquad_cascadepuppet_32f_neonv8(float* outputVector,
+                                                            const float* inputVector,
+                                                            unsigned int num_points)
+{
+    volk_32f_biquad_cascade_puppet(
+        volk_32f_biquad_cascade_32f_neonv8, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_biquad_cascadepuppet_32f_H */
@@ -0,0 +1,256 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_compensated_accumulator_s32f
+ *
+ * \b Overview
+ *
+ * Accumulates the values in the input buffer like volk_32f_accumulator_s32f,
+ * but without the error growing with the length: the error of a plain float
+ * sum grows with the number of points, and over 10^8 of them swamps the
+ * result.
+ *
+ * The SIMD versions keep a compensated sum in each float lane and add the
+ * lanes up in double at the end. Each add goes through TwoSum, which gets
+ * its rounding error exactly whatever the magnitudes, into a second float
+ * accumulator; it costs five more adds per vector and leaves the kernel
+ * bound by memory. Kahan's cheaper update is not enough: it loses the error
+ * whenever an input is larger than the lane sum, as it is each time a sum
+ * of mixed signs comes by zero. The generic version sums in double.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_compensated_accumulator_s32f(float* result, const float* inputBuffer,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: The buffer of data to be accumulated.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li result: The accumulated result.
+ *
+ * \b Example
+ * Integrate a long stream of power samples.
+ * \code
+ *   int N = 1 << 24;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* power = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float energy;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       power[ii] = 0.1f;
+ *   }
+ *
+ *   volk_32f_accumulator_s32f(&energy, power, N);
+ *   printf("plain sum %1.1f\n", energy);
+ *   volk_32f_compensated_accumulator_s32f(&energy, power, N);
+ *   printf("compensated sum %1.1f\n", energy);
+ *
+ *   volk_free(power);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_compensated_accumulator_s32f_H
+#define INCLUDED_volk_32f_compensated_accumulator_s32f_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/* Adds up lane sums and the rounding errors they missed in double */
+static inline double volk_compensated_lanes_sum(const float* laneSums,
+                                                const float* laneErrors,
+                                                unsigned int lanes)
+{
+    double sum = 0.0;
+    unsigned int lane;
+
+    for (lane = 0; lane < lanes; lane++) {
+        sum += (double)laneSums[lane] + (double)laneErrors[lane];
+    }
+    return sum;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_compensated_accumulator_s32f_generic(
+    float* result, const float* inputBuffer, unsigned int num_points)
+{
+    double sum = 0.0;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        sum += inputBuffer[number];
+    }
+    *result = (float)sum;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_compensated_accumulator_s32f_u_sse(
+    float* result, const float* inputBuffer, unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* aPtr = inputBuffer;
+    __m128 sum = _mm_setzero_ps(), error = _mm_setzero_ps(), x, t, z;
+    __VOLK_ATTR_ALIGNED(16) float laneSums[4];
+    __VOLK_ATTR_ALIGNED(16) float laneErrors[4];
+    unsigned int number;
+    double total;
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = _mm_loadu_ps(aPtr);
+        t = _mm_add_ps(sum, x);
+        z = _mm_sub_ps(t, sum);
+        error = _mm_add_ps(
+            error, _mm_add_ps(_mm_sub_ps(sum, _mm_sub_ps(t, z)), _mm_sub_ps(x, z)));
+        sum = t;
+        aPtr += 4;
+    }
+
+    _mm_store_ps(laneSums, sum);
+    _mm_store_ps(laneErrors, error);
+    total = volk_compensated_lanes_sum(laneSums, laneErrors, 4);
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        total += inputBuffer[number];
+    }
+    *result = (float)total;
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_compensated_accumulator_s32f_u_avx(
+    float* result, const float* inputBuffer, unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* aPtr = inputBuffer;
+    __m256 sum = _mm256_setzero_ps(), error = _mm256_setzero_ps(), x, t, z;
+    __VOLK_ATTR_ALIGNED(32) float laneSums[8];
+    __VOLK_ATTR_ALIGNED(32) float laneErrors[8];
+    unsigned int number;
+    double total;
+
+    for (number = 0; number < eighthPoints; number++) {
+        x = _mm256_loadu_ps(aPtr);
+        t = _mm256_add_ps(sum, x);
+        z = _mm256_sub_ps(t, sum);
+        error = _mm256_add_ps(
+            error,
+            _mm256_add_ps(_mm256_sub_ps(sum, _mm256_sub_ps(t, z)), _mm256_sub_ps(x, z)));
+        sum = t;
+        aPtr += 8;
+    }
+
+    _mm256_store_ps(laneSums, sum);
+    _mm256_store_ps(laneErrors, error);
+    total = volk_compensated_lanes_sum(laneSums, laneErrors, 8);
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        total += inputBuffer[number];
+    }
+    *result = (float)total;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_compensated_accumulator_s32f_u_avx512f(
+    float* result, const float* inputBuffer, unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* aPtr = inputBuffer;
+    __m512 sum = _mm512_setzero_ps(), error = _mm512_setzero_ps(), x, t, z;
+    __VOLK_ATTR_ALIGNED(64) float laneSums[16];
+    __VOLK_ATTR_ALIGNED(64) float laneErrors[16];
+    unsigned int number;
+    double total;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = _mm512_loadu_ps(aPtr);
+        t = _mm512_add_ps(sum, x);
+        z = _mm512_sub_ps(t, sum);
+        error = _mm512_add_ps(
+            error,
+            _mm512_add_ps(_mm512_sub_ps(sum, _mm512_sub_ps(t, z)), _mm512_sub_ps(x, z)));
+        sum = t;
+        aPtr += 16;
+    }
+
+    _mm512_store_ps(laneSums, sum);
+    _mm512_store_ps(laneErrors, error);
+    total = volk_compensated_lanes_sum(laneSums, laneErrors, 16);
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        total += inputBuffer[number];
+    }
+    *result = (float)total;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_compensated_accumulator_s32f_neon(
+    float* result, const float* inputBuffer, unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* aPtr = inputBuffer;
+    float32x4_t sum = vdupq_n_f32(0.f), error = vdupq_n_f32(0.f), x, t, z;
+    float laneSums[4];
+    float laneErrors[4];
+    unsigned int number;
+    double total;
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = vld1q_f32(aPtr);
+        t = vaddq_f32(sum, x);
+        z = vsubq_f32(t, sum);
+        error = vaddq_f32(error,
+                          vaddq_f32(vsubq_f32(sum, vsubq_f32(t, z)), vsubq_f32(x, z)));
+        sum = t;
+        aPtr += 4;
+    }
+
+    vst1q_f32(laneSums, sum);
+    vst1q_f32(laneErrors, error);
+    total = volk_compensated_lanes_sum(laneSums, laneErrors, 4);
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        total += inputBuffer[number];
+    }
+    *result = (float)total;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_compensated_accumulator_s32f_H */
@@ -0,0 +1,305 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_convert_16bf
+ *
+ * \b Overview
+ *
+ * Converts floats into bfloat16 values, the upper 16 bits of a float, stored
+ * as their uint16_t bit patterns. The values are rounded to nearest even and
+ * NaNs are quieted. bfloat16 keeps the range of a float with about two
+ * decimal digits, and halves the memory and bandwidth of stored vectors.
+ * Subnormal floats are rounded like any other, not flushed to zero.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_convert_16bf(uint16_t* outputVector, const float* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The vector of floats to convert.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The bfloat16 bit patterns.
+ *
+ * \b Example
+ * Store a ramp in bfloat16 and read it back.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint16_t* bf = (uint16_t*)volk_malloc(sizeof(uint16_t)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.1f * ii;
+ *   }
+ *
+ *   volk_32f_convert_16bf(bf, in, N);
+ *   volk_16bf_convert_32f(out, bf, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %1.6f (0x%04x)\n", ii, out[ii], bf[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(bf);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_convert_16bf_u_H
+#define INCLUDED_volk_32f_convert_16bf_u_H
+
+#include <inttypes.h>
+#include <volk/volk_half.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_convert_16bf_generic(uint16_t* outputVector,
+                                                 const float* inputVector,
+                                                 unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = volk_float_to_bfloat16(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16bf_u_avx512f(uint16_t* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    const __m512i bias = _mm512_set1_epi32(0x7fff);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i quiet = _mm512_set1_epi32(0x400000);
+    __m512 x;
+    __m512i bits, lsb, words;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = _mm512_loadu_ps(inputVectorPtr);
+        bits = _mm512_castps_si512(x);
+        // round to nearest even, or quiet a NaN, in the upper half
+        lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), one);
+        words = _mm512_add_epi32(bits, _mm512_add_epi32(bias, lsb));
+        words = _mm512_mask_or_epi32(
+            words, _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), bits, quiet);
+        _mm256_storeu_si256((__m256i*)outputVectorPtr,
+                            _mm512_cvtepi32_epi16(_mm512_srli_epi32(words, 16)));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_float_to_bfloat16(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16bf_u_avx2(uint16_t* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    const __m256i bias = _mm256_set1_epi32(0x7fff);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i quiet = _mm256_set1_epi32(0x400000);
+    __m256 x;
+    __m256i bits, lsb, nan, words[2];
+    unsigned int i;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        for (i = 0; i < 2; i++) {
+            x = _mm256_loadu_ps(inputVectorPtr + 8 * i);
+            bits = _mm256_castps_si256(x);
+            // round to nearest even, or quiet a NaN, in the upper half
+            lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+            words[i] = _mm256_add_epi32(bits, _mm256_add_epi32(bias, lsb));
+            nan = _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+            words[i] = _mm256_blendv_epi8(words[i], _mm256_or_si256(bits, quiet), nan);
+            words[i] = _mm256_srli_epi32(words[i], 16);
+        }
+        // the packing interleaves the 128-bit lanes of its operands
+        _mm256_storeu_si256(
+            (__m256i*)outputVectorPtr,
+            _mm256_permute4x64_epi64(_mm256_packus_epi32(words[0], words[1]), 0xd8));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_float_to_bfloat16(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_convert_16bf_neon(uint16_t* outputVector,
+                                              const float* inputVector,
+                                              unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    const uint32x4_t bias = vdupq_n_u32(0x7fff);
+    const uint32x4_t one = vdupq_n_u32(1);
+    const uint32x4_t quiet = vdupq_n_u32(0x400000);
+    const uint32x4_t abs_mask = vdupq_n_u32(0x7fffffff);
+    const uint32x4_t inf = vdupq_n_u32(0x7f800000);
+    uint32x4_t bits, lsb, words[2];
+    unsigned int i;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        for (i = 0; i < 2; i++) {
+            bits = vld1q_u32((const uint32_t*)inputVectorPtr + 4 * i);
+            // round to nearest even, or quiet a NaN, in the upper half
+            lsb = vandq_u32(vshrq_n_u32(bits, 16), one);
+            words[i] = vaddq_u32(bits, vaddq_u32(bias, lsb));
+            words[i] = vbslq_u32(vcgtq_u32(vandq_u32(bits, abs_mask), inf),
+                                 vorrq_u32(bits, quiet),
+                                 words[i]);
+        }
+        vst1q_u16(outputVectorPtr,
+                  vcombine_u16(vshrn_n_u32(words[0], 16), vshrn_n_u32(words[1], 16)));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_float_to_bfloat16(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_convert_16bf_u_H */
+
+#ifndef INCLUDED_volk_32f_convert_16bf_a_H
+#define INCLUDED_volk_32f_convert_16bf_a_H
+
+#include <inttypes.h>
+#include <volk/volk_half.h>
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16bf_a_avx512f(uint16_t* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    const __m512i bias = _mm512_set1_epi32(0x7fff);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i quiet = _mm512_set1_epi32(0x400000);
+    __m512 x;
+    __m512i bits, lsb, words;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = _mm512_load_ps(inputVectorPtr);
+        bits = _mm512_castps_si512(x);
+        // round to nearest even, or quiet a NaN, in the upper half
+        lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), one);
+        words = _mm512_add_epi32(bits, _mm512_add_epi32(bias, lsb));
+        words = _mm512_mask_or_epi32(
+            words, _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), bits, quiet);
+        _mm256_store_si256((__m256i*)outputVectorPtr,
+                           _mm512_cvtepi32_epi16(_mm512_srli_epi32(words, 16)));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_float_to_bfloat16(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16bf_a_avx2(uint16_t* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    const __m256i bias = _mm256_set1_epi32(0x7fff);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i quiet = _mm256_set1_epi32(0x400000);
+    __m256 x;
+    __m256i bits, lsb, nan, words[2];
+    unsigned int i;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        for (i = 0; i < 2; i++) {
+            x = _mm256_load_ps(inputVectorPtr + 8 * i);
+            bits = _mm256_castps_si256(x);
+            // round to nearest even, or quiet a NaN, in the upper half
+            lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+            words[i] = _mm256_add_epi32(bits, _mm256_add_epi32(bias, lsb));
+            nan = _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+            words[i] = _mm256_blendv_epi8(words[i], _mm256_or_si256(bits, quiet), nan);
+            words[i] = _mm256_srli_epi32(words[i], 16);
+        }
+        // the packing interleaves the 128-bit lanes of its operands
+        _mm256_store_si256(
+            (__m256i*)outputVectorPtr,
+            _mm256_permute4x64_epi64(_mm256_packus_epi32(words[0], words[1]), 0xd8));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_float_to_bfloat16(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_32f_convert_16bf_a_H */
@@ -0,0 +1,235 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_convert_16f
+ *
+ * \b Overview
+ *
+ * Converts floats into half precision values, IEEE 754 binary16, stored as
+ * their uint16_t bit patterns. The values are rounded to nearest even; those
+ * beyond the largest half, 65504, overflow to infinity, and NaNs are quieted.
+ * Half precision keeps about three decimal digits over a range of 6e-8 to
+ * 65504, and halves the memory and bandwidth of stored vectors.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_convert_16f(uint16_t* outputVector, const float* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The vector of floats to convert.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The half precision bit patterns.
+ *
+ * \b Example
+ * Store a ramp in half precision and read it back.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint16_t* half = (uint16_t*)volk_malloc(sizeof(uint16_t)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.1f * ii;
+ *   }
+ *
+ *   volk_32f_convert_16f(half, in, N);
+ *   volk_16f_convert_32f(out, half, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %1.6f (0x%04x)\n", ii, out[ii], half[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(half);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_convert_16f_u_H
+#define INCLUDED_volk_32f_convert_16f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_half.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_convert_16f_generic(uint16_t* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = volk_float_to_half(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_u_avx512f(uint16_t* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        _mm256_storeu_si256((__m256i*)outputVectorPtr,
+                            _mm512_cvtps_ph(_mm512_loadu_ps(inputVectorPtr),
+                                            _MM_FROUND_TO_NEAREST_INT));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_float_to_half(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_u_avx_f16c(uint16_t* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        _mm_storeu_si128((__m128i*)outputVectorPtr,
+                         _mm256_cvtps_ph(_mm256_loadu_ps(inputVectorPtr),
+                                         _MM_FROUND_TO_NEAREST_INT));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_float_to_half(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_convert_16f_neonv8(uint16_t* outputVector,
+                                               const float* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    float16x8_t halves;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        halves = vcvt_high_f16_f32(vcvt_f16_f32(vld1q_f32(inputVectorPtr)),
+                                   vld1q_f32(inputVectorPtr + 4));
+        vst1q_u16(outputVectorPtr, vreinterpretq_u16_f16(halves));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_float_to_half(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_convert_16f_u_H */
+
+#ifndef INCLUDED_volk_32f_convert_16f_a_H
+#define INCLUDED_volk_32f_convert_16f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_half.h>
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_a_avx512f(uint16_t* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        _mm256_store_si256((__m256i*)outputVectorPtr,
+                           _mm512_cvtps_ph(_mm512_load_ps(inputVectorPtr),
+                                           _MM_FROUND_TO_NEAREST_INT));
+        inputVectorPtr += 16;
+        outputVectorPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        outputVector[number] = volk_float_to_half(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_a_avx_f16c(uint16_t* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* inputVectorPtr = inputVector;
+    uint16_t* outputVectorPtr = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        _mm_store_si128((__m128i*)outputVectorPtr,
+                        _mm256_cvtps_ph(_mm256_load_ps(inputVectorPtr),
+                                        _MM_FROUND_TO_NEAREST_INT));
+        inputVectorPtr += 8;
+        outputVectorPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        outputVector[number] = volk_float_to_half(inputVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+#endif /* INCLUDED_volk_32f_convert_16f_a_H */
@@ -69,6 +69,42 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_64f_u_avx512f(double* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* in = inputVector;
+    double* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512 value = _mm512_loadu_ps(in);
+        const __m256 high =
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value), 1));
+        _mm512_storeu_pd(out, _mm512_cvtps_pd(_mm512_castps512_ps256(value)));
+        _mm512_storeu_pd(out + 8, _mm512_cvtps_pd(high));
+        in += 16;
+        out += 16;
+    }
+
+    // the last points with a masked load, the store mask split over two registers
+    const unsigned int remaining = num_points & 15;
+    const __mmask16 mask = _cvtu32_mask16((1u << remaining) - 1);
+    const __mmask8 mask0 = (__mmask8)(((1u << remaining) - 1) & 0xff);
+    const __mmask8 mask1 = (__mmask8)(((1u << remaining) - 1) >> 8);
+    const __m512 value = _mm512_maskz_loadu_ps(mask, in);
+    const __m256 high =
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value), 1));
+    _mm512_mask_storeu_pd(out, mask0, _mm512_cvtps_pd(_mm512_castps512_ps256(value)));
+    _mm512_mask_storeu_pd(out + 8, mask1, _mm512_cvtps_pd(high));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
@@ -161,6 +197,31 @@ static inline void volk_32f_convert_64f_generic(double* outputVector,
 #endif /* LV_HAVE_GENERIC */
 
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_convert_64f_neonv8(double* outputVector,
+                                               const float* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* in = inputVector;
+    double* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const float32x4_t value = vld1q_f32(in);
+        vst1q_f64(out, vcvt_f64_f32(vget_low_f32(value)));
+        vst1q_f64(out + 2, vcvt_high_f64_f32(value));
+        in += 4;
+        out += 4;
+    }
+
+    volk_32f_convert_64f_generic(out, in, num_points & 3);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+
 #endif /* INCLUDED_volk_32f_convert_64f_u_H */
 
 
@@ -170,6 +231,42 @@ static inline void volk_32f_convert_64f_generic(double* outputVector,
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_64f_a_avx512f(double* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* in = inputVector;
+    double* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512 value = _mm512_load_ps(in);
+        const __m256 high =
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value), 1));
+        _mm512_store_pd(out, _mm512_cvtps_pd(_mm512_castps512_ps256(value)));
+        _mm512_store_pd(out + 8, _mm512_cvtps_pd(high));
+        in += 16;
+        out += 16;
+    }
+
+    // the last points with a masked load, the store mask split over two registers
+    const unsigned int remaining = num_points & 15;
+    const __mmask16 mask = _cvtu32_mask16((1u << remaining) - 1);
+    const __mmask8 mask0 = (__mmask8)(((1u << remaining) - 1) & 0xff);
+    const __mmask8 mask1 = (__mmask8)(((1u << remaining) - 1) >> 8);
+    const __m512 value = _mm512_maskz_load_ps(mask, in);
+    const __m256 high =
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value), 1));
+    _mm512_mask_store_pd(out, mask0, _mm512_cvtps_pd(_mm512_castps512_ps256(value)));
+    _mm512_mask_store_pd(out + 8, mask1, _mm512_cvtps_pd(high));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
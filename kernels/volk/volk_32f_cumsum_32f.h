@@ -0,0 +1,192 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_cumsum_32f
+ *
+ * \b Overview
+ *
+ * Computes the running sum of the input vector, each output being the sum of
+ * the inputs up to and including its own, plus the running sum carried in:
+ *
+ * outputVector[n] = runningSum + inputVector[0] + ... + inputVector[n]
+ *
+ * The running sum is updated to the last output, so a stream cut into buffers
+ * is summed by passing the same variable to every call. The SIMD versions sum
+ * each vector with a log-step scan and add the sum carried from the previous
+ * vector, which rounds differently from the sequential generic version.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_cumsum_32f(float* outputVector, const float* inputVector,
+ * float* runningSum, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The values to sum.
+ * \li runningSum: The sum carried in from the previous buffers, 0 to start.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The running sums.
+ * \li runningSum: The last running sum, to carry into the next buffer.
+ *
+ * \b Example
+ * The energy of a stream integrated over two buffers.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* power = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* energy = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float sum = 0.f;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       power[ii] = 0.5f;
+ *   }
+ *
+ *   volk_32f_cumsum_32f(energy, power, &sum, N);
+ *   volk_32f_cumsum_32f(energy, power, &sum, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("energy[%u] = %1.2f\n", N + ii, energy[ii]);
+ *   }
+ *
+ *   volk_free(power);
+ *   volk_free(energy);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_cumsum_32f_H
+#define INCLUDED_volk_32f_cumsum_32f_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_cumsum_32f_generic(float* outputVector,
+                                               const float* inputVector,
+                                               float* runningSum,
+                                               unsigned int num_points)
+{
+    float sum = *runningSum;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        sum += inputVector[number];
+        outputVector[number] = sum;
+    }
+    *runningSum = sum;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <volk/volk_sse_intrinsics.h>
+#include <xmmintrin.h>
+
+static inline void volk_32f_cumsum_32f_u_sse(float* outputVector,
+                                             const float* inputVector,
+                                             float* runningSum,
+                                             unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __m128 carry = _mm_set1_ps(*runningSum);
+    __m128 sum;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        sum = _mm_add_ps(_mm_scan_ps(_mm_loadu_ps(inputVector)), carry);
+        _mm_storeu_ps(outputVector, sum);
+        carry = _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(3, 3, 3, 3));
+        inputVector += 4;
+        outputVector += 4;
+    }
+    *runningSum = _mm_cvtss_f32(carry);
+
+    volk_32f_cumsum_32f_generic(
+        outputVector, inputVector, runningSum, num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_cumsum_32f_u_avx(float* outputVector,
+                                             const float* inputVector,
+                                             float* runningSum,
+                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __m256 carry = _mm256_set1_ps(*runningSum);
+    __m256 sum;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        sum = _mm256_add_ps(_mm256_scan_ps(_mm256_loadu_ps(inputVector)), carry);
+        _mm256_storeu_ps(outputVector, sum);
+        sum = _mm256_permute_ps(sum, 0xff);
+        carry = _mm256_permute2f128_ps(sum, sum, 0x11);
+        inputVector += 8;
+        outputVector += 8;
+    }
+    *runningSum = _mm256_cvtss_f32(carry);
+
+    volk_32f_cumsum_32f_generic(
+        outputVector, inputVector, runningSum, num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_cumsum_32f_neon(float* outputVector,
+                                            const float* inputVector,
+                                            float* runningSum,
+                                            unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    float32x4_t carry = vdupq_n_f32(*runningSum);
+    float32x4_t sum;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        sum = vaddq_f32(_vscanq_f32(vld1q_f32(inputVector)), carry);
+        vst1q_f32(outputVector, sum);
+        carry = vdupq_n_f32(vgetq_lane_f32(sum, 3));
+        inputVector += 4;
+        outputVector += 4;
+    }
+    *runningSum = vgetq_lane_f32(carry, 0);
+
+    volk_32f_cumsum_32f_generic(
+        outputVector, inputVector, runningSum, num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_cumsum_32f_H */
@@ -0,0 +1,120 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_cumsum_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_cumsumpuppet_32f_H
+#define INCLUDED_volk_32f_cumsumpuppet_32f_H
+
+#include <volk/volk_32f_cumsum_32f.h>
+
+/*
+ * Sums the input in calls of 100 points, carrying the running sum from each
+ * call into the next but restarting it every other call to keep the rounding
+ * differences between the versions small.
+ */
+static inline void
+volk_32f_cumsum_puppet(void (*kernel)(float*,
+                                      const float*,
+                                      float*,
+                                      unsigned int),
+                       float* outputVector,
+                       const float* inputVector,
+                       unsigned int num_points)
+{
+    float runningSum = 0.5f;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += 100) {
+        if (number % 200 == 0) {
+            runningSum = 0.5f;
+        }
+        kernel(outputVector + number,
+               inputVector + number,
+               &runningSum,
+               num_points - number < 100 ? num_points - number : 100);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_cumsumpuppet_32f_generic(float* outputVector,
+                                                     const float* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_32f_cumsum_puppet(volk_32f_cumsum_32f_generic,
+                           outputVector,
+                           inputVector,
+                           num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_cumsumpuppet_32f_u_sse(float* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    volk_32f_cumsum_puppet(volk_32f_cumsum_32f_u_sse,
+                           outputVector,
+                           inputVector,
+                           num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_cumsumpuppet_32f_u_avx(float* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    volk_32f_cumsum_puppet(volk_32f_cumsum_32f_u_avx,
+                           outputVector,
+                           inputVector,
+                           num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_cumsumpuppet_32f_neon(float* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_32f_cumsum_puppet(volk_32f_cumsum_32f_neon,
+                           outputVector,
+                           inputVector,
+                           num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_cumsumpuppet_32f_H */
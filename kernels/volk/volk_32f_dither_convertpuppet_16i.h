@@ -0,0 +1,153 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_s32f_x2_dither_convert_16i.h'
+ */
+
+#ifndef INCLUDED_volk_32f_dither_convertpuppet_16i_H
+#define INCLUDED_volk_32f_dither_convertpuppet_16i_H
+
+#include <volk/volk_32f_s32f_x2_dither_convert_16i.h>
+
+/*
+ * Quantises the input scaled to clip about a third of it in calls of 192
+ * points, which keep the buffers of the aligned versions aligned, carrying the
+ * state from each call into the next: the first half with plain dither, the
+ * second with shaping.
+ */
+static inline void
+volk_dither_convert_16i_puppet(void (*kernel)(int16_t*,
+                                              const float*,
+                                              const float,
+                                              const float,
+                                              uint32_t*,
+                                              unsigned int),
+                               int16_t* outputVector,
+                               const float* inputVector,
+                               unsigned int num_points)
+{
+    uint32_t state[VOLK_DITHER_STATE_WORDS];
+    unsigned int number;
+
+    volk_dither_seed(state, 1);
+    for (number = 0; number < num_points; number += 192) {
+        kernel(outputVector + number,
+               inputVector + number,
+               49000.f,
+               number < num_points / 2 ? 0.f : 1.f,
+               state,
+               num_points - number < 192 ? num_points - number : 192);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_dither_convertpuppet_16i_generic(int16_t* outputVector,
+                                                             const float* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_dither_convert_16i_puppet(volk_32f_s32f_x2_dither_convert_16i_generic,
+                                   outputVector,
+                                   inputVector,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_dither_convertpuppet_16i_a_avx2(int16_t* outputVector,
+                                                            const float* inputVector,
+                                                            unsigned int num_points)
+{
+    volk_dither_convert_16i_puppet(volk_32f_s32f_x2_dither_convert_16i_a_avx2,
+                                   outputVector,
+                                   inputVector,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_dither_convertpuppet_16i_u_avx2(int16_t* outputVector,
+                                                            const float* inputVector,
+                                                            unsigned int num_points)
+{
+    volk_dither_convert_16i_puppet(volk_32f_s32f_x2_dither_convert_16i_u_avx2,
+                                   outputVector,
+                                   inputVector,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_dither_convertpuppet_16i_a_avx512f(int16_t* outputVector,
+                                                               const float* inputVector,
+                                                               unsigned int num_points)
+{
+    volk_dither_convert_16i_puppet(volk_32f_s32f_x2_dither_convert_16i_a_avx512f,
+                                   outputVector,
+                                   inputVector,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_dither_convertpuppet_16i_u_avx512f(int16_t* outputVector,
+                                                               const float* inputVector,
+                                                               unsigned int num_points)
+{
+    volk_dither_convert_16i_puppet(volk_32f_s32f_x2_dither_convert_16i_u_avx512f,
+                                   outputVector,
+                                   inputVector,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32f_dither_convertpuppet_16i_neonv8(int16_t* outputVector,
+                                                            const float* inputVector,
+                                                            unsigned int num_points)
+{
+    volk_dither_convert_16i_puppet(volk_32f_s32f_x2_dither_convert_16i_neonv8,
+                                   outputVector,
+                                   inputVector,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_dither_convertpuppet_16i_H */
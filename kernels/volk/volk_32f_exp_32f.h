@@ -53,6 +53,10 @@
  *
  * Computes exponential of input vector and stores results in output vector.
  *
+ * The AVX2, AVX-512 and NEON versions stay within 2 ulp of expf, down into the
+ * denormals; the SSE2 version flushes results below 2^-126. For a faster,
+ * coarser exponential see volk_32f_expfast_32f.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32f_exp_32f(float* bVector, const float* aVector, unsigned int num_points)
@@ -178,6 +182,50 @@ volk_32f_exp_32f_a_sse2(float* bVector, const float* aVector, unsigned int num_p
 #endif /* LV_HAVE_SSE2 for aligned */
 
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void
+volk_32f_exp_32f_a_avx2_fma(float* bVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_points; number += 8) {
+        _mm256_store_ps(bVector + number,
+                        _mm256_exp_ps_avx2_fma(_mm256_load_ps(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = expf(aVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA for aligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32f_exp_32f_a_avx512f(float* bVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 16 <= num_points; number += 16) {
+        _mm512_store_ps(bVector + number,
+                        _mm512_exp_ps(_mm512_load_ps(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = expf(aVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
+
 #ifdef LV_HAVE_GENERIC
 
 static inline void
@@ -279,6 +327,72 @@ volk_32f_exp_32f_u_sse2(float* bVector, const float* aVector, unsigned int num_p
 #endif /* LV_HAVE_SSE2 for unaligned */
 
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void
+volk_32f_exp_32f_u_avx2_fma(float* bVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_points; number += 8) {
+        _mm256_storeu_ps(bVector + number,
+                         _mm256_exp_ps_avx2_fma(_mm256_loadu_ps(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = expf(aVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA for unaligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32f_exp_32f_u_avx512f(float* bVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 16 <= num_points; number += 16) {
+        _mm512_storeu_ps(bVector + number,
+                         _mm512_exp_ps(_mm512_loadu_ps(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = expf(aVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32f_exp_32f_neonv8(float* bVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 4 <= num_points; number += 4) {
+        vst1q_f32(bVector + number, _vexpq_f32(vld1q_f32(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = expf(aVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+
 #ifdef LV_HAVE_GENERIC
 
 static inline void
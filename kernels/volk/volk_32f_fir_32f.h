@@ -0,0 +1,304 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_fir_32f
+ *
+ * \b Overview
+ *
+ * Filters a block of real samples with real taps, computing num_points
+ * outputs in one call instead of one volk_32f_x2_dot_prod_32f call per
+ * output. Output i is the dot product of the taps with the num_taps
+ * inputs starting at i, so the input holds num_points + num_taps - 1
+ * samples: the num_taps - 1 samples of history, then the new ones. The
+ * taps are in time reversed order, as for the dot product.
+ *
+ * The SIMD implementations compute several vectors of consecutive
+ * outputs at once, loading each tap once for all of them.
+ *
+ * For a filter running over a stream, volk_fir_32f_init() in volk_fir.h
+ * keeps the history between blocks in a caller-owned state.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_fir_32f(float* output, const float* input, const float* taps,
+ * unsigned int num_taps, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: num_points + num_taps - 1 samples, the oldest first.
+ * \li taps: The filter taps, time reversed.
+ * \li num_taps: The number of taps, at least 1.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: output[i] = sum of input[i + k] * taps[k] over k < num_taps.
+ *
+ * \b Example
+ * A 4 tap moving average.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*(N + 3), alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float taps[4] = { 0.25f, 0.25f, 0.25f, 0.25f };
+ *
+ *   volk_32f_fir_32f(out, in, taps, 4, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_fir_32f_u_H
+#define INCLUDED_volk_32f_fir_32f_u_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_fir_32f_generic(float* output,
+                                            const float* input,
+                                            const float* taps,
+                                            unsigned int num_taps,
+                                            unsigned int num_points)
+{
+    unsigned int number, k;
+    for (number = 0; number < num_points; number++) {
+        float sum = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_fir_32f_sse(float* output,
+                                        const float* input,
+                                        const float* taps,
+                                        unsigned int num_taps,
+                                        unsigned int num_points)
+{
+    unsigned int number = 0, k;
+
+    // four vectors of outputs share every tap load
+    for (; number + 16 <= num_points; number += 16) {
+        const float* in = input + number;
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps();
+        __m128 acc3 = _mm_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            const __m128 tap = _mm_set1_ps(taps[k]);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(in + k), tap));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(in + k + 4), tap));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(in + k + 8), tap));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(in + k + 12), tap));
+        }
+        _mm_storeu_ps(output + number, acc0);
+        _mm_storeu_ps(output + number + 4, acc1);
+        _mm_storeu_ps(output + number + 8, acc2);
+        _mm_storeu_ps(output + number + 12, acc3);
+    }
+
+    for (; number + 4 <= num_points; number += 4) {
+        __m128 acc = _mm_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            acc = _mm_add_ps(
+                acc, _mm_mul_ps(_mm_loadu_ps(input + number + k), _mm_set1_ps(taps[k])));
+        }
+        _mm_storeu_ps(output + number, acc);
+    }
+
+    for (; number < num_points; number++) {
+        float sum = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_fir_32f_avx(float* output,
+                                        const float* input,
+                                        const float* taps,
+                                        unsigned int num_taps,
+                                        unsigned int num_points)
+{
+    unsigned int number = 0, k;
+
+    // four vectors of outputs share every tap load
+    for (; number + 32 <= num_points; number += 32) {
+        const float* in = input + number;
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps();
+        __m256 acc3 = _mm256_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            const __m256 tap = _mm256_broadcast_ss(taps + k);
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(in + k), tap));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(in + k + 8), tap));
+            acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(_mm256_loadu_ps(in + k + 16), tap));
+            acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(_mm256_loadu_ps(in + k + 24), tap));
+        }
+        _mm256_storeu_ps(output + number, acc0);
+        _mm256_storeu_ps(output + number + 8, acc1);
+        _mm256_storeu_ps(output + number + 16, acc2);
+        _mm256_storeu_ps(output + number + 24, acc3);
+    }
+
+    for (; number + 8 <= num_points; number += 8) {
+        __m256 acc = _mm256_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            acc = _mm256_add_ps(acc,
+                                _mm256_mul_ps(_mm256_loadu_ps(input + number + k),
+                                              _mm256_broadcast_ss(taps + k)));
+        }
+        _mm256_storeu_ps(output + number, acc);
+    }
+
+    for (; number < num_points; number++) {
+        float sum = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_fir_32f_avx512f(float* output,
+                                            const float* input,
+                                            const float* taps,
+                                            unsigned int num_taps,
+                                            unsigned int num_points)
+{
+    unsigned int number = 0, k;
+
+    // four vectors of outputs share every tap load
+    for (; number + 64 <= num_points; number += 64) {
+        const float* in = input + number;
+        __m512 acc0 = _mm512_setzero_ps();
+        __m512 acc1 = _mm512_setzero_ps();
+        __m512 acc2 = _mm512_setzero_ps();
+        __m512 acc3 = _mm512_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            const __m512 tap = _mm512_set1_ps(taps[k]);
+            acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(in + k), tap, acc0);
+            acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(in + k + 16), tap, acc1);
+            acc2 = _mm512_fmadd_ps(_mm512_loadu_ps(in + k + 32), tap, acc2);
+            acc3 = _mm512_fmadd_ps(_mm512_loadu_ps(in + k + 48), tap, acc3);
+        }
+        _mm512_storeu_ps(output + number, acc0);
+        _mm512_storeu_ps(output + number + 16, acc1);
+        _mm512_storeu_ps(output + number + 32, acc2);
+        _mm512_storeu_ps(output + number + 48, acc3);
+    }
+
+    for (; number + 16 <= num_points; number += 16) {
+        __m512 acc = _mm512_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            acc = _mm512_fmadd_ps(
+                _mm512_loadu_ps(input + number + k), _mm512_set1_ps(taps[k]), acc);
+        }
+        _mm512_storeu_ps(output + number, acc);
+    }
+
+    for (; number < num_points; number++) {
+        float sum = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_fir_32f_neon(float* output,
+                                         const float* input,
+                                         const float* taps,
+                                         unsigned int num_taps,
+                                         unsigned int num_points)
+{
+    unsigned int number = 0, k;
+
+    // four vectors of outputs share every tap load
+    for (; number + 16 <= num_points; number += 16) {
+        const float* in = input + number;
+        float32x4_t acc0 = vdupq_n_f32(0.f);
+        float32x4_t acc1 = vdupq_n_f32(0.f);
+        float32x4_t acc2 = vdupq_n_f32(0.f);
+        float32x4_t acc3 = vdupq_n_f32(0.f);
+        for (k = 0; k < num_taps; k++) {
+            const float32x4_t tap = vdupq_n_f32(taps[k]);
+            acc0 = vmlaq_f32(acc0, vld1q_f32(in + k), tap);
+            acc1 = vmlaq_f32(acc1, vld1q_f32(in + k + 4), tap);
+            acc2 = vmlaq_f32(acc2, vld1q_f32(in + k + 8), tap);
+            acc3 = vmlaq_f32(acc3, vld1q_f32(in + k + 12), tap);
+        }
+        vst1q_f32(output + number, acc0);
+        vst1q_f32(output + number + 4, acc1);
+        vst1q_f32(output + number + 8, acc2);
+        vst1q_f32(output + number + 12, acc3);
+    }
+
+    for (; number + 4 <= num_points; number += 4) {
+        float32x4_t acc = vdupq_n_f32(0.f);
+        for (k = 0; k < num_taps; k++) {
+            acc = vmlaq_f32(acc, vld1q_f32(input + number + k), vdupq_n_f32(taps[k]));
+        }
+        vst1q_f32(output + number, acc);
+    }
+
+    for (; number < num_points; number++) {
+        float sum = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_fir_32f_u_H */
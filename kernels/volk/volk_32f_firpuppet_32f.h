@@ -0,0 +1,89 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32F_FIRPUPPET_32F_H
+#define INCLUDED_VOLK_32F_FIRPUPPET_32F_H
+
+#include <string.h>
+#include <volk/volk_32f_fir_32f.h>
+
+/* Filters with 23 taps, or 1 for short vectors, reading the taps from the
+ * start of the second buffer. The last num_taps - 1 outputs would read
+ * past the input, they are copies of it. */
+#define VOLK_FIRPUPPET(impl)                                                  \
+    const unsigned int num_taps = num_points < 23 ? 1 : 23;                  \
+    const unsigned int num_outputs = num_points - num_taps + 1;              \
+    impl(output, input, taps, num_taps, num_outputs);                        \
+    memcpy(output + num_outputs, input + num_outputs,                        \
+           (num_taps - 1) * sizeof(*output));
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32f_firpuppet_32f_generic(float* output,
+                                                  const float* input,
+                                                  const float* taps,
+                                                  unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_32f_fir_32f_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+static inline void volk_32f_firpuppet_32f_sse(float* output,
+                                              const float* input,
+                                              const float* taps,
+                                              unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_32f_fir_32f_sse);
+}
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32f_firpuppet_32f_avx(float* output,
+                                              const float* input,
+                                              const float* taps,
+                                              unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_32f_fir_32f_avx);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32f_firpuppet_32f_avx512f(float* output,
+                                                  const float* input,
+                                                  const float* taps,
+                                                  unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_32f_fir_32f_avx512f);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32f_firpuppet_32f_neon(float* output,
+                                               const float* input,
+                                               const float* taps,
+                                               unsigned int num_points)
+{
+    VOLK_FIRPUPPET(volk_32f_fir_32f_neon);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32F_FIRPUPPET_32F_H */
@@ -0,0 +1,121 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_s32f_goertzel_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32f_goertzelpuppet_32fc_H
+#define INCLUDED_volk_32f_goertzelpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_32f_s32f_goertzel_32fc.h>
+
+#define VOLK_GOERTZEL_PUPPET_BINS 37
+
+/* Evaluates up to 37 bins spread over 0.05 to 0.45 cycles per sample in two
+ * calls, which carry the state over, and zeroes the rest of the output. */
+static inline void volk_goertzel_puppet(void (*kernel)(lv_32fc_t*,
+                                                       const float*,
+                                                       const float*,
+                                                       float*,
+                                                       unsigned int,
+                                                       unsigned int),
+                                        lv_32fc_t* outputVector,
+                                        const float* inputVector,
+                                        unsigned int num_points)
+{
+    float frequencies[VOLK_GOERTZEL_PUPPET_BINS];
+    float state[2 * VOLK_GOERTZEL_PUPPET_BINS];
+    unsigned int numBins = num_points < VOLK_GOERTZEL_PUPPET_BINS
+                               ? num_points
+                               : VOLK_GOERTZEL_PUPPET_BINS;
+    unsigned int bin;
+
+    for (bin = 0; bin < numBins; bin++) {
+        frequencies[bin] = 0.05f + 0.4f * bin / VOLK_GOERTZEL_PUPPET_BINS;
+        state[bin] = state[numBins + bin] = 0.f;
+    }
+    memset(outputVector, 0, sizeof(lv_32fc_t) * num_points);
+    kernel(outputVector, inputVector, frequencies, state, numBins, num_points / 3);
+    kernel(outputVector,
+           inputVector + num_points / 3,
+           frequencies,
+           state,
+           numBins,
+           num_points - num_points / 3);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_goertzelpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                        const float* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_goertzel_puppet(
+        volk_32f_s32f_goertzel_32fc_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+
+static inline void volk_32f_goertzelpuppet_32fc_u_avx_fma(lv_32fc_t* outputVector,
+                                                          const float* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_goertzel_puppet(
+        volk_32f_s32f_goertzel_32fc_u_avx_fma, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_goertzelpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                          const float* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_goertzel_puppet(
+        volk_32f_s32f_goertzel_32fc_u_avx512f, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32f_goertzelpuppet_32fc_neonv8(lv_32fc_t* outputVector,
+                                                       const float* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_goertzel_puppet(
+        volk_32f_s32f_goertzel_32fc_neonv8, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_goertzelpuppet_32fc_H */
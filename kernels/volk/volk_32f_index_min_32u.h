@@ -0,0 +1,145 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_index_min_32u
+ *
+ * \b Overview
+ *
+ * Returns Argmin_i x[i]. Finds and returns the index which contains the first minimum
+ * value in the given vector.
+ *
+ * This is volk_32f_index_min_64u_32f without the value, for vectors of less
+ * than 2^32 points.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_index_min_32u(uint32_t* target, const float* src0, uint32_t num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li src0: The input vector of floats.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li target: The index of the first minimum value in the input buffer.
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   uint32_t alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint32_t* out = (uint32_t*)volk_malloc(sizeof(uint32_t), alignment);
+ *
+ *   for(uint32_t ii = 0; ii < N; ++ii){
+ *       float x = (float)ii;
+ *       // a parabola with a minimum at x=4
+ *       in[ii] = (x-4) * (x-4) - 5;
+ *   }
+ *
+ *   volk_32f_index_min_32u(out, in, N);
+ *
+ *   printf("minimum is %1.2f at index %u\n", in[*out], *out);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_index_min_32u_H
+#define INCLUDED_volk_32f_index_min_32u_H
+
+#include <inttypes.h>
+#include <volk/volk_32f_index_min_64u_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_index_min_32u_generic(uint32_t* target,
+                                                  const float* src0,
+                                                  uint32_t num_points)
+{
+    uint64_t index;
+    float min;
+
+    if (num_points > 0) {
+        volk_32f_index_min_64u_32f_generic(&index, &min, src0, num_points);
+        *target = (uint32_t)index;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+
+static inline void volk_32f_index_min_32u_u_sse4_1(uint32_t* target,
+                                                   const float* src0,
+                                                   uint32_t num_points)
+{
+    uint64_t index;
+    float min;
+
+    if (num_points > 0) {
+        volk_32f_index_min_64u_32f_u_sse4_1(&index, &min, src0, num_points);
+        *target = (uint32_t)index;
+    }
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_index_min_32u_u_avx(uint32_t* target,
+                                                const float* src0,
+                                                uint32_t num_points)
+{
+    uint64_t index;
+    float min;
+
+    if (num_points > 0) {
+        volk_32f_index_min_64u_32f_u_avx(&index, &min, src0, num_points);
+        *target = (uint32_t)index;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_index_min_32u_neon(uint32_t* target,
+                                               const float* src0,
+                                               uint32_t num_points)
+{
+    uint64_t index;
+    float min;
+
+    if (num_points > 0) {
+        volk_32f_index_min_64u_32f_neon(&index, &min, src0, num_points);
+        *target = (uint32_t)index;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_index_min_32u_H */
@@ -0,0 +1,285 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_index_min_64u_32f
+ *
+ * \b Overview
+ *
+ * Returns the index and the value of the first minimum of the input
+ * vector, with a 64 bit index and count for buffers of more than 2^32 points.
+ * NaNs are skipped unless the first point is one. The index and value are
+ * those volk_32f_index_min_32u and a read of the point would give.
+ *
+ * The SIMD versions keep the minimum and its index in each lane, the indices
+ * relative to chunks of 2^24 points which their float lanes hold exactly.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_index_min_64u_32f(uint64_t* target, float* value, const float* src0,
+ * uint64_t num_points) \endcode
+ *
+ * \b Inputs
+ * \li src0: The input vector.
+ * \li num_points: The number of points; with none the outputs are left unchanged.
+ *
+ * \b Outputs
+ * \li target: The index of the minimum.
+ * \li value: The minimum value.
+ *
+ * \b Example
+ * Find the trough of a parabola.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint64_t index;
+ *   float min;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       float x = (float)ii;
+ *       in[ii] = (x-4) * (x-4) + 5;
+ *   }
+ *
+ *   volk_32f_index_min_64u_32f(&index, &min, in, N);
+ *
+ *   printf("minimum is %1.2f at index %" PRIu64 "\n", min, index);
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_index_min_64u_32f_H
+#define INCLUDED_volk_32f_index_min_64u_32f_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/*
+ * Folds the lanes of a chunk starting at base into the minimum so far. The
+ * lanes start from the minimum so far and only take an index from a point
+ * improving on it, so only the lanes which improved on it are considered, the
+ * lowest index winning ties as in the sequential scan.
+ */
+static inline void volk_index_min_fold_lanes(float* min,
+                                             uint64_t* index,
+                                             const float* laneValues,
+                                             const uint32_t* laneIndexes,
+                                             unsigned int lanes,
+                                             uint64_t base)
+{
+    const float previous = *min;
+    unsigned int lane;
+
+    for (lane = 0; lane < lanes; lane++) {
+        if (laneValues[lane] < *min ||
+            (laneValues[lane] == *min && laneValues[lane] < previous &&
+             base + laneIndexes[lane] < *index)) {
+            *min = laneValues[lane];
+            *index = base + laneIndexes[lane];
+        }
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_index_min_64u_32f_generic(uint64_t* target,
+                                                      float* value,
+                                                      const float* src0,
+                                                      uint64_t num_points)
+{
+    uint64_t index = 0, number;
+    float min;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    min = src0[0];
+    for (number = 1; number < num_points; number++) {
+        if (src0[number] < min) {
+            index = number;
+            min = src0[number];
+        }
+    }
+    *target = index;
+    *value = min;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_32f_index_min_64u_32f_u_sse4_1(uint64_t* target,
+                                                       float* value,
+                                                       const float* src0,
+                                                       uint64_t num_points)
+{
+    const uint64_t chunk = 1 << 24;
+    const __m128 indexIncrement = _mm_set1_ps(4);
+    __m128 laneMin, laneIndex, indexes, values, compare;
+    __VOLK_ATTR_ALIGNED(16) float laneValues[4];
+    __VOLK_ATTR_ALIGNED(16) uint32_t laneIndexes[4];
+    uint64_t base, index = 0, number, points;
+    float min;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    min = src0[0];
+    for (base = 0; num_points - base >= 4; base += points) {
+        points = num_points - base < chunk ? (num_points - base) & ~(uint64_t)3 : chunk;
+        laneMin = _mm_set1_ps(min);
+        laneIndex = _mm_setzero_ps();
+        indexes = _mm_set_ps(3, 2, 1, 0);
+        for (number = 0; number < points; number += 4) {
+            values = _mm_loadu_ps(src0 + base + number);
+            compare = _mm_cmplt_ps(values, laneMin);
+            laneIndex = _mm_blendv_ps(laneIndex, indexes, compare);
+            laneMin = _mm_blendv_ps(laneMin, values, compare);
+            indexes = _mm_add_ps(indexes, indexIncrement);
+        }
+        _mm_store_ps(laneValues, laneMin);
+        _mm_store_si128((__m128i*)laneIndexes, _mm_cvttps_epi32(laneIndex));
+        volk_index_min_fold_lanes(&min, &index, laneValues, laneIndexes, 4, base);
+    }
+
+    for (number = base; number < num_points; number++) {
+        if (src0[number] < min) {
+            index = number;
+            min = src0[number];
+        }
+    }
+    *target = index;
+    *value = min;
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_index_min_64u_32f_u_avx(uint64_t* target,
+                                                    float* value,
+                                                    const float* src0,
+                                                    uint64_t num_points)
+{
+    const uint64_t chunk = 1 << 24;
+    const __m256 indexIncrement = _mm256_set1_ps(8);
+    __m256 laneMin, laneIndex, indexes, values, compare;
+    __VOLK_ATTR_ALIGNED(32) float laneValues[8];
+    __VOLK_ATTR_ALIGNED(32) uint32_t laneIndexes[8];
+    uint64_t base, index = 0, number, points;
+    float min;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    min = src0[0];
+    for (base = 0; num_points - base >= 8; base += points) {
+        points = num_points - base < chunk ? (num_points - base) & ~(uint64_t)7 : chunk;
+        laneMin = _mm256_set1_ps(min);
+        laneIndex = _mm256_setzero_ps();
+        indexes = _mm256_set_ps(7, 6, 5, 4, 3, 2, 1, 0);
+        for (number = 0; number < points; number += 8) {
+            values = _mm256_loadu_ps(src0 + base + number);
+            compare = _mm256_cmp_ps(values, laneMin, _CMP_LT_OS);
+            laneIndex = _mm256_blendv_ps(laneIndex, indexes, compare);
+            laneMin = _mm256_blendv_ps(laneMin, values, compare);
+            indexes = _mm256_add_ps(indexes, indexIncrement);
+        }
+        _mm256_store_ps(laneValues, laneMin);
+        _mm256_store_si256((__m256i*)laneIndexes, _mm256_cvttps_epi32(laneIndex));
+        volk_index_min_fold_lanes(&min, &index, laneValues, laneIndexes, 8, base);
+    }
+
+    for (number = base; number < num_points; number++) {
+        if (src0[number] < min) {
+            index = number;
+            min = src0[number];
+        }
+    }
+    *target = index;
+    *value = min;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_index_min_64u_32f_neon(uint64_t* target,
+                                                   float* value,
+                                                   const float* src0,
+                                                   uint64_t num_points)
+{
+    const uint64_t chunk = 1 << 24;
+    const uint32_t firstIndexes[4] = { 0, 1, 2, 3 };
+    const uint32x4_t indexIncrement = vdupq_n_u32(4);
+    float32x4_t laneMin, values;
+    uint32x4_t laneIndex, indexes, compare;
+    float laneValues[4];
+    uint32_t laneIndexes[4];
+    uint64_t base, index = 0, number, points;
+    float min;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    min = src0[0];
+    for (base = 0; num_points - base >= 4; base += points) {
+        points = num_points - base < chunk ? (num_points - base) & ~(uint64_t)3 : chunk;
+        laneMin = vdupq_n_f32(min);
+        laneIndex = vdupq_n_u32(0);
+        indexes = vld1q_u32(firstIndexes);
+        for (number = 0; number < points; number += 4) {
+            values = vld1q_f32(src0 + base + number);
+            compare = vcltq_f32(values, laneMin);
+            laneIndex = vbslq_u32(compare, indexes, laneIndex);
+            laneMin = vbslq_f32(compare, values, laneMin);
+            indexes = vaddq_u32(indexes, indexIncrement);
+        }
+        vst1q_f32(laneValues, laneMin);
+        vst1q_u32(laneIndexes, laneIndex);
+        volk_index_min_fold_lanes(&min, &index, laneValues, laneIndexes, 4, base);
+    }
+
+    for (number = base; number < num_points; number++) {
+        if (src0[number] < min) {
+            index = number;
+            min = src0[number];
+        }
+    }
+    *target = index;
+    *value = min;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_index_min_64u_32f_H */
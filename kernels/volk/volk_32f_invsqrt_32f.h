@@ -89,6 +89,45 @@ static inline float Q_rsqrt(float number)
     return u.f;
 }
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_invsqrt_32f_a_avx512f(float* cVector,
+                                                  const float* aVector,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512 threehalfs = _mm512_set1_ps(1.5f);
+    const __m512 inf = _mm512_set1_ps(INFINITY);
+    __m512 aVal, cVal, hy;
+    __mmask16 refine;
+    for (; number < sixteenthPoints; number++) {
+        aVal = _mm512_load_ps(aPtr);
+        // the 14 bit estimate and one Newton step, y * (1.5 - x / 2 * y * y),
+        // which would make nan of 0 and inf where the estimate is exact
+        cVal = _mm512_rsqrt14_ps(aVal);
+        refine = _mm512_cmp_ps_mask(aVal, _mm512_setzero_ps(), _CMP_NEQ_OQ) &
+                 _mm512_cmp_ps_mask(aVal, inf, _CMP_NEQ_OQ);
+        hy = _mm512_mul_ps(_mm512_mul_ps(aVal, half), cVal);
+        cVal = _mm512_mask_mul_ps(
+            cVal, refine, cVal, _mm512_fnmadd_ps(hy, cVal, threehalfs));
+        _mm512_store_ps(cPtr, cVal);
+        aPtr += 16;
+        cPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++)
+        *cPtr++ = 1.0f / sqrtf(*aPtr++);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
@@ -175,6 +214,37 @@ volk_32f_invsqrt_32f_neon(float* cVector, const float* aVector, unsigned int num
 #endif /* LV_HAVE_NEON */
 
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32f_invsqrt_32f_neonv8(float* cVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int quarter_points = num_points / 4;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    float32x4_t a_val, c_val;
+    for (number = 0; number < quarter_points; ++number) {
+        a_val = vld1q_f32(aPtr);
+        // the 8 bit estimate and one Newton step; vrsqrts returns 1.5 for
+        // 0 * inf, so 0 and inf keep their exact estimates when y * y is
+        // formed first
+        c_val = vrsqrteq_f32(a_val);
+        c_val = vmulq_f32(c_val, vrsqrtsq_f32(a_val, vmulq_f32(c_val, c_val)));
+        vst1q_f32(cPtr, c_val);
+        aPtr += 4;
+        cPtr += 4;
+    }
+
+    for (number = quarter_points * 4; number < num_points; number++)
+        *cPtr++ = 1.0f / sqrtf(*aPtr++);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+
+
 #ifdef LV_HAVE_GENERIC
 
 static inline void volk_32f_invsqrt_32f_generic(float* cVector,
@@ -216,4 +286,42 @@ volk_32f_invsqrt_32f_u_avx(float* cVector, const float* aVector, unsigned int nu
 }
 #endif /* LV_HAVE_AVX */
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_invsqrt_32f_u_avx512f(float* cVector,
+                                                  const float* aVector,
+                                                  unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512 threehalfs = _mm512_set1_ps(1.5f);
+    const __m512 inf = _mm512_set1_ps(INFINITY);
+    __m512 aVal, cVal, hy;
+    __mmask16 refine;
+    for (; number < sixteenthPoints; number++) {
+        aVal = _mm512_loadu_ps(aPtr);
+        // the 14 bit estimate and one Newton step, y * (1.5 - x / 2 * y * y),
+        // which would make nan of 0 and inf where the estimate is exact
+        cVal = _mm512_rsqrt14_ps(aVal);
+        refine = _mm512_cmp_ps_mask(aVal, _mm512_setzero_ps(), _CMP_NEQ_OQ) &
+                 _mm512_cmp_ps_mask(aVal, inf, _CMP_NEQ_OQ);
+        hy = _mm512_mul_ps(_mm512_mul_ps(aVal, half), cVal);
+        cVal = _mm512_mask_mul_ps(
+            cVal, refine, cVal, _mm512_fnmadd_ps(hy, cVal, threehalfs));
+        _mm512_storeu_ps(cPtr, cVal);
+        aPtr += 16;
+        cPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++)
+        *cPtr++ = 1.0f / sqrtf(*aPtr++);
+}
+#endif /* LV_HAVE_AVX512F */
+
 #endif /* INCLUDED_volk_32f_invsqrt_32f_a_H */
@@ -0,0 +1,135 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_s32u_median_filter_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_median_filterpuppet_32f_H
+#define INCLUDED_volk_32f_median_filterpuppet_32f_H
+
+#include <string.h>
+#include <volk/volk_32f_s32u_median_filter_32f.h>
+
+/*
+ * Filters the input over windows of 21 points in calls of 1000 outputs,
+ * each reading the last 20 points of the previous one as its history. The
+ * last 20 outputs, whose windows would run past the input, are zeroed.
+ */
+static inline void
+volk_32f_median_filter_puppet(void (*kernel)(float*,
+                                             const float*,
+                                             const unsigned int,
+                                             unsigned int),
+                              float* outputVector,
+                              const float* inputVector,
+                              unsigned int num_points)
+{
+    const unsigned int num_outputs = num_points >= 21 ? num_points - 20 : 0;
+    unsigned int number;
+
+    for (number = 0; number < num_outputs; number += 1000) {
+        kernel(outputVector + number,
+               inputVector + number,
+               21,
+               num_outputs - number < 1000 ? num_outputs - number : 1000);
+    }
+    memset(outputVector + num_outputs, 0, sizeof(float) * (num_points - num_outputs));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_median_filterpuppet_32f_generic(float* outputVector,
+                                                            const float* inputVector,
+                                                            unsigned int num_points)
+{
+    volk_32f_median_filter_puppet(volk_32f_s32u_median_filter_32f_generic,
+                                  outputVector,
+                                  inputVector,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_median_filterpuppet_32f_u_sse(float* outputVector,
+                                                          const float* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_32f_median_filter_puppet(volk_32f_s32u_median_filter_32f_u_sse,
+                                  outputVector,
+                                  inputVector,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_median_filterpuppet_32f_u_avx(float* outputVector,
+                                                          const float* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_32f_median_filter_puppet(volk_32f_s32u_median_filter_32f_u_avx,
+                                  outputVector,
+                                  inputVector,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_median_filterpuppet_32f_u_avx512f(float* outputVector,
+                                                              const float* inputVector,
+                                                              unsigned int num_points)
+{
+    volk_32f_median_filter_puppet(volk_32f_s32u_median_filter_32f_u_avx512f,
+                                  outputVector,
+                                  inputVector,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_median_filterpuppet_32f_neon(float* outputVector,
+                                                         const float* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_32f_median_filter_puppet(volk_32f_s32u_median_filter_32f_neon,
+                                  outputVector,
+                                  inputVector,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_median_filterpuppet_32f_H */
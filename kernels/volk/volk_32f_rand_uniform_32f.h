@@ -0,0 +1,246 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_rand_uniform_32f
+ *
+ * \b Overview
+ *
+ * Fills a vector with uniform random numbers in [0, 1), multiples of 2^-24.
+ *
+ * The numbers come from 16 xoshiro128+ generators in the state; point n of a
+ * call takes the next word of generator n % 16 and keeps its top 24 bits. The
+ * SIMD versions run the generators in their lanes and give the same points
+ * as the generic version. The generators are carried from call to call in
+ * the state, so a long stream cut into buffers is the same whatever the
+ * buffer lengths, as long as they are multiples of 16.
+ *
+ * volk_32fc_rand_gaussian_32fc and volk_32fc_s32f_x2_add_awgn_32fc draw from
+ * the same state.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_rand_uniform_32f(float* outputVector, uint32_t* state,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li state: VOLK_RAND_STATE_WORDS words set up by volk_rand_seed().
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The random numbers.
+ * \li state: The generators, to carry into the next buffer.
+ *
+ * \b Example
+ * Draw N uniform random numbers.
+ * \code
+ *   uint32_t state[VOLK_RAND_STATE_WORDS];
+ *
+ *   volk_rand_seed(state, 1);
+ *   volk_32f_rand_uniform_32f(out, state, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_rand_uniform_32f_H
+#define INCLUDED_volk_32f_rand_uniform_32f_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/* The number of generators, which is also the points of a SIMD block. */
+#define VOLK_RAND_LANES 16
+/*
+ * The words of a state: word w of the four of every generator, for all
+ * generators in turn, so that the SIMD versions load the lanes in one go.
+ */
+#define VOLK_RAND_STATE_WORDS (4 * VOLK_RAND_LANES)
+
+/* Seeds the generators of state from seed. */
+static inline void volk_rand_seed(uint32_t* state, uint32_t seed)
+{
+    uint32_t z;
+    unsigned int word;
+
+    for (word = 0; word < VOLK_RAND_STATE_WORDS; word++) {
+        // the finaliser of MurmurHash3 spreads seeds which differ in few bits
+        z = seed + 0x9e3779b9u * (word + 1);
+        z = (z ^ (z >> 16)) * 0x85ebca6bu;
+        z = (z ^ (z >> 13)) * 0xc2b2ae35u;
+        z ^= z >> 16;
+        // a generator must not be all zero
+        state[word] = (z == 0 && word < VOLK_RAND_LANES) ? 1 : z;
+    }
+}
+
+/* Steps generator lane of the state, returning its next word. */
+static inline uint32_t volk_rand_next(uint32_t* state, unsigned int lane)
+{
+    uint32_t* s = state + lane;
+    const uint32_t result = s[0] + s[3 * VOLK_RAND_LANES];
+    const uint32_t t = s[VOLK_RAND_LANES] << 9;
+
+    s[2 * VOLK_RAND_LANES] ^= s[0];
+    s[3 * VOLK_RAND_LANES] ^= s[VOLK_RAND_LANES];
+    s[VOLK_RAND_LANES] ^= s[2 * VOLK_RAND_LANES];
+    s[0] ^= s[3 * VOLK_RAND_LANES];
+    s[2 * VOLK_RAND_LANES] ^= t;
+    s[3 * VOLK_RAND_LANES] =
+        (s[3 * VOLK_RAND_LANES] << 11) | (s[3 * VOLK_RAND_LANES] >> 21);
+    return result;
+}
+
+/* The number in [0, 1) of a generator word, from its top 24 bits. */
+static inline float volk_rand_uniform(uint32_t x)
+{
+    return (float)(int32_t)(x >> 8) * (1.f / 16777216.f);
+}
+
+/* Draws points from generator 0 on. */
+static inline void
+volk_rand_uniform_points(float* outputVector, uint32_t* state, unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] =
+            volk_rand_uniform(volk_rand_next(state, number % VOLK_RAND_LANES));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_rand_uniform_32f_generic(float* outputVector,
+                                                     uint32_t* state,
+                                                     unsigned int num_points)
+{
+    volk_rand_uniform_points(outputVector, state, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_rand_uniform_32f_u_avx2(float* outputVector,
+                                                    uint32_t* state,
+                                                    unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const __m256 scale = _mm256_set1_ps(1.f / 16777216.f);
+    unsigned int number, k, w;
+    __m256i s[2][4];
+    __m256 x;
+
+    // generators 0 to 7 in s[0], 8 to 15 in s[1]
+    for (k = 0; k < 2; k++) {
+        for (w = 0; w < 4; w++) {
+            s[k][w] = _mm256_loadu_si256((const __m256i*)(state + 16 * w + 8 * k));
+        }
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 2; k++) {
+            x = _mm256_cvtepi32_ps(_mm256_srli_epi32(_mm256_xoshiro128p_epi32(s[k]), 8));
+            _mm256_storeu_ps(outputVector + 8 * k, _mm256_mul_ps(x, scale));
+        }
+        outputVector += 16;
+    }
+    for (k = 0; k < 2; k++) {
+        for (w = 0; w < 4; w++) {
+            _mm256_storeu_si256((__m256i*)(state + 16 * w + 8 * k), s[k][w]);
+        }
+    }
+
+    volk_rand_uniform_points(outputVector, state, num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_rand_uniform_32f_u_avx512f(float* outputVector,
+                                                       uint32_t* state,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const __m512 scale = _mm512_set1_ps(1.f / 16777216.f);
+    unsigned int number, w;
+    __m512i s[4];
+    __m512 x;
+
+    for (w = 0; w < 4; w++) {
+        s[w] = _mm512_loadu_si512(state + 16 * w);
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        x = _mm512_cvtepi32_ps(_mm512_srli_epi32(_mm512_xoshiro128p_epi32(s), 8));
+        _mm512_storeu_ps(outputVector, _mm512_mul_ps(x, scale));
+        outputVector += 16;
+    }
+    for (w = 0; w < 4; w++) {
+        _mm512_storeu_si512(state + 16 * w, s[w]);
+    }
+
+    volk_rand_uniform_points(outputVector, state, num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_rand_uniform_32f_neonv8(float* outputVector,
+                                                    uint32_t* state,
+                                                    unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    unsigned int number, k, w;
+    uint32x4_t s[4][4];
+    float32x4_t x;
+
+    // generators 4 * k to 4 * k + 3 in s[k]
+    for (k = 0; k < 4; k++) {
+        for (w = 0; w < 4; w++) {
+            s[k][w] = vld1q_u32(state + 16 * w + 4 * k);
+        }
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 4; k++) {
+            x = vcvtq_f32_u32(vshrq_n_u32(_vxoshiro128pq_u32(s[k]), 8));
+            vst1q_f32(outputVector + 4 * k, vmulq_n_f32(x, 1.f / 16777216.f));
+        }
+        outputVector += 16;
+    }
+    for (k = 0; k < 4; k++) {
+        for (w = 0; w < 4; w++) {
+            vst1q_u32(state + 16 * w + 4 * k, s[k][w]);
+        }
+    }
+
+    volk_rand_uniform_points(outputVector, state, num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_rand_uniform_32f_H */
@@ -0,0 +1,115 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_rand_uniform_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_rand_uniformpuppet_32f_H
+#define INCLUDED_volk_32f_rand_uniformpuppet_32f_H
+
+#include <volk/volk_32f_rand_uniform_32f.h>
+
+/*
+ * Draws from a state seeded with 1 in calls of 100 points, which leave a tail
+ * in every call, carrying the state from each call into the next. The input
+ * only gives the tests a signature.
+ */
+static inline void
+volk_rand_uniform_puppet(void (*kernel)(float*, uint32_t*, unsigned int),
+                         float* outputVector,
+                         const float* inputVector,
+                         unsigned int num_points)
+{
+    uint32_t state[VOLK_RAND_STATE_WORDS];
+    unsigned int number;
+    (void)inputVector;
+
+    volk_rand_seed(state, 1);
+    for (number = 0; number < num_points; number += 100) {
+        kernel(outputVector + number,
+               state,
+               num_points - number < 100 ? num_points - number : 100);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_rand_uniformpuppet_32f_generic(float* outputVector,
+                                                           const float* inputVector,
+                                                           unsigned int num_points)
+{
+    volk_rand_uniform_puppet(volk_32f_rand_uniform_32f_generic,
+                             outputVector,
+                             inputVector,
+                             num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_rand_uniformpuppet_32f_u_avx2(float* outputVector,
+                                                          const float* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_rand_uniform_puppet(volk_32f_rand_uniform_32f_u_avx2,
+                             outputVector,
+                             inputVector,
+                             num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_rand_uniformpuppet_32f_u_avx512f(float* outputVector,
+                                                             const float* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_rand_uniform_puppet(volk_32f_rand_uniform_32f_u_avx512f,
+                             outputVector,
+                             inputVector,
+                             num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32f_rand_uniformpuppet_32f_neonv8(float* outputVector,
+                                                          const float* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_rand_uniform_puppet(volk_32f_rand_uniform_32f_neonv8,
+                             outputVector,
+                             inputVector,
+                             num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_rand_uniformpuppet_32f_H */
@@ -33,6 +33,10 @@
  * exceed the mean by the spectralExclusionValue (in dB).  Provides a
  * rough estimation of the signal noise floor.
  *
+ * Strong or wideband signals pull up the first mean; for an estimate that
+ * only depends on the order of the points, see
+ * volk_32f_s32f_percentile_noise_floor_32f.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32f_s32f_calc_spectral_noise_floor_32f(float* noiseFloorAmplitude, const
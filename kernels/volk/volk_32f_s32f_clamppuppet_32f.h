@@ -0,0 +1,83 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_s32f_x2_clamp_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_clamppuppet_32f_H
+#define INCLUDED_volk_32f_s32f_clamppuppet_32f_H
+
+#include <volk/volk_32f_s32f_x2_clamp_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32f_s32f_clamppuppet_32f_generic(float* out,
+                                                         const float* in,
+                                                         const float bound,
+                                                         unsigned int num_points)
+{
+    volk_32f_s32f_x2_clamp_32f_generic(out, in, -bound, bound, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+static inline void volk_32f_s32f_clamppuppet_32f_u_sse(float* out,
+                                                       const float* in,
+                                                       const float bound,
+                                                       unsigned int num_points)
+{
+    volk_32f_s32f_x2_clamp_32f_u_sse(out, in, -bound, bound, num_points);
+}
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32f_s32f_clamppuppet_32f_u_avx(float* out,
+                                                       const float* in,
+                                                       const float bound,
+                                                       unsigned int num_points)
+{
+    volk_32f_s32f_x2_clamp_32f_u_avx(out, in, -bound, bound, num_points);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32f_s32f_clamppuppet_32f_u_avx512f(float* out,
+                                                           const float* in,
+                                                           const float bound,
+                                                           unsigned int num_points)
+{
+    volk_32f_s32f_x2_clamp_32f_u_avx512f(out, in, -bound, bound, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32f_s32f_clamppuppet_32f_neon(float* out,
+                                                      const float* in,
+                                                      const float bound,
+                                                      unsigned int num_points)
+{
+    volk_32f_s32f_x2_clamp_32f_neon(out, in, -bound, bound, num_points);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_clamppuppet_32f_H */
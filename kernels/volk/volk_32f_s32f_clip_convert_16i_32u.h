@@ -0,0 +1,284 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_s32f_clip_convert_16i_32u
+ *
+ * \b Overview
+ *
+ * Scales a floating point vector, saturates it to 16-bit shorts as
+ * volk_32f_s32f_convert_16i does and counts the points which had to be clipped,
+ * those whose scaled value was above SHRT_MAX or below SHRT_MIN. Clipping the
+ * transmit samples, converting them and counting the clipped ones for crest factor
+ * reduction then takes a single pass over the samples.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_clip_convert_16i_32u(int16_t* outputVector, uint32_t* clipped,
+ *                                         const float* inputVector, const float scalar,
+ *                                         unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input vector of floats.
+ * \li scalar: The value multiplied against each point in the input buffer.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The output vector.
+ * \li clipped: The number of points which were clipped.
+ *
+ * \b Example
+ * Convert a ramp over [-1, 1) with a gain that clips the outer fifth of it.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   int16_t* out = (int16_t*)volk_malloc(sizeof(int16_t)*N, alignment);
+ *   uint32_t clipped;
+ *
+ *   for(int ii = 0; ii < N; ++ii){
+ *       in[ii] = 2.f * ((float)ii / (float)N) - 1.f;
+ *   }
+ *
+ *   volk_32f_s32f_clip_convert_16i_32u(out, &clipped, in, 40000.f, N);
+ *
+ *   printf("%u of %i points clipped\n", clipped, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_clip_convert_16i_32u_H
+#define INCLUDED_volk_32f_s32f_clip_convert_16i_32u_H
+
+#include <inttypes.h>
+#include <limits.h>
+#include <math.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_clip_convert_16i_32u_generic(int16_t* outputVector,
+                                                              uint32_t* clipped,
+                                                              const float* inputVector,
+                                                              const float scalar,
+                                                              unsigned int num_points)
+{
+    const float min_val = SHRT_MIN;
+    const float max_val = SHRT_MAX;
+    uint32_t count = 0;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        float r = inputVector[number] * scalar;
+        if (r > max_val) {
+            r = max_val;
+            count++;
+        } else if (r < min_val) {
+            r = min_val;
+            count++;
+        }
+        outputVector[number] = (int16_t)rintf(r);
+    }
+    *clipped = count;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32f_s32f_clip_convert_16i_32u_u_sse2(int16_t* outputVector,
+                                                             uint32_t* clipped,
+                                                             const float* inputVector,
+                                                             const float scalar,
+                                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128 vScalar = _mm_set1_ps(scalar);
+    const __m128 vmin_val = _mm_set1_ps(SHRT_MIN);
+    const __m128 vmax_val = _mm_set1_ps(SHRT_MAX);
+    __VOLK_ATTR_ALIGNED(16) uint32_t counts[4];
+    // the compare masks are -1 where a point clips, subtracting them counts it
+    __m128i count = _mm_setzero_si128();
+    __m128 value1, value2, clip1, clip2;
+    uint32_t tail;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        value1 = _mm_mul_ps(_mm_loadu_ps(inputVector), vScalar);
+        value2 = _mm_mul_ps(_mm_loadu_ps(inputVector + 4), vScalar);
+        clip1 = _mm_or_ps(_mm_cmpgt_ps(value1, vmax_val), _mm_cmplt_ps(value1, vmin_val));
+        clip2 = _mm_or_ps(_mm_cmpgt_ps(value2, vmax_val), _mm_cmplt_ps(value2, vmin_val));
+        count = _mm_sub_epi32(count, _mm_castps_si128(clip1));
+        count = _mm_sub_epi32(count, _mm_castps_si128(clip2));
+        value1 = _mm_max_ps(_mm_min_ps(value1, vmax_val), vmin_val);
+        value2 = _mm_max_ps(_mm_min_ps(value2, vmax_val), vmin_val);
+        _mm_storeu_si128(
+            (__m128i*)outputVector,
+            _mm_packs_epi32(_mm_cvtps_epi32(value1), _mm_cvtps_epi32(value2)));
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    _mm_store_si128((__m128i*)counts, count);
+    volk_32f_s32f_clip_convert_16i_32u_generic(
+        outputVector, &tail, inputVector, scalar, num_points & 7);
+    *clipped = counts[0] + counts[1] + counts[2] + counts[3] + tail;
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_clip_convert_16i_32u_u_avx2(int16_t* outputVector,
+                                                             uint32_t* clipped,
+                                                             const float* inputVector,
+                                                             const float scalar,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256 vScalar = _mm256_set1_ps(scalar);
+    const __m256 vmin_val = _mm256_set1_ps(SHRT_MIN);
+    const __m256 vmax_val = _mm256_set1_ps(SHRT_MAX);
+    __VOLK_ATTR_ALIGNED(32) uint32_t counts[8];
+    // the compare masks are -1 where a point clips, subtracting them counts it
+    __m256i count = _mm256_setzero_si256();
+    __m256 value1, value2, clip1, clip2;
+    __m256i packed;
+    uint32_t tail;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        value1 = _mm256_mul_ps(_mm256_loadu_ps(inputVector), vScalar);
+        value2 = _mm256_mul_ps(_mm256_loadu_ps(inputVector + 8), vScalar);
+        clip1 = _mm256_or_ps(_mm256_cmp_ps(value1, vmax_val, _CMP_GT_OQ),
+                             _mm256_cmp_ps(value1, vmin_val, _CMP_LT_OQ));
+        clip2 = _mm256_or_ps(_mm256_cmp_ps(value2, vmax_val, _CMP_GT_OQ),
+                             _mm256_cmp_ps(value2, vmin_val, _CMP_LT_OQ));
+        count = _mm256_sub_epi32(count, _mm256_castps_si256(clip1));
+        count = _mm256_sub_epi32(count, _mm256_castps_si256(clip2));
+        value1 = _mm256_max_ps(_mm256_min_ps(value1, vmax_val), vmin_val);
+        value2 = _mm256_max_ps(_mm256_min_ps(value2, vmax_val), vmin_val);
+        // the pack works per 128-bit lane, the permute puts the points back in order
+        packed =
+            _mm256_packs_epi32(_mm256_cvtps_epi32(value1), _mm256_cvtps_epi32(value2));
+        _mm256_storeu_si256((__m256i*)outputVector,
+                            _mm256_permute4x64_epi64(packed, 0xd8));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    _mm256_store_si256((__m256i*)counts, count);
+    volk_32f_s32f_clip_convert_16i_32u_generic(
+        outputVector, &tail, inputVector, scalar, num_points & 15);
+    *clipped = counts[0] + counts[1] + counts[2] + counts[3] + counts[4] + counts[5] +
+               counts[6] + counts[7] + tail;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_clip_convert_16i_32u_u_avx512f(int16_t* outputVector,
+                                                                uint32_t* clipped,
+                                                                const float* inputVector,
+                                                                const float scalar,
+                                                                unsigned int num_points)
+{
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(SHRT_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(SHRT_MAX);
+    const __m512i one = _mm512_set1_epi32(1);
+    __m512i count = _mm512_setzero_si512();
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += 16) {
+        // the last points with a masked load and store, the zeroed lanes never clip
+        const unsigned int remaining = num_points - number;
+        const __mmask16 mask =
+            _cvtu32_mask16(remaining < 16 ? (1u << remaining) - 1 : 0xffff);
+        const __m512 value =
+            _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, inputVector + number), vScalar);
+        const __mmask16 clip = _mm512_cmp_ps_mask(value, vmax_val, _CMP_GT_OQ) |
+                               _mm512_cmp_ps_mask(value, vmin_val, _CMP_LT_OQ);
+        count = _mm512_mask_add_epi32(count, clip, count, one);
+        _mm512_mask_cvtsepi32_storeu_epi16(
+            outputVector + number,
+            mask,
+            _mm512_cvtps_epi32(_mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val)));
+    }
+
+    *clipped = (uint32_t)_mm512_reduce_add_epi32(count);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_clip_convert_16i_32u_neonv8(int16_t* outputVector,
+                                                             uint32_t* clipped,
+                                                             const float* inputVector,
+                                                             const float scalar,
+                                                             unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float32x4_t vmin_val = vdupq_n_f32(SHRT_MIN);
+    const float32x4_t vmax_val = vdupq_n_f32(SHRT_MAX);
+    // the compare masks are all ones where a point clips, subtracting them counts it
+    uint32x4_t count = vdupq_n_u32(0);
+    float32x4_t value1, value2;
+    uint32_t tail;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        value1 = vmulq_n_f32(vld1q_f32(inputVector), scalar);
+        value2 = vmulq_n_f32(vld1q_f32(inputVector + 4), scalar);
+        count = vsubq_u32(
+            count, vorrq_u32(vcgtq_f32(value1, vmax_val), vcltq_f32(value1, vmin_val)));
+        count = vsubq_u32(
+            count, vorrq_u32(vcgtq_f32(value2, vmax_val), vcltq_f32(value2, vmin_val)));
+        // round to nearest even as rintf does, the conversion saturates
+        vst1q_s16(outputVector,
+                  vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(value1)),
+                               vqmovn_s32(vcvtnq_s32_f32(value2))));
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    volk_32f_s32f_clip_convert_16i_32u_generic(
+        outputVector, &tail, inputVector, scalar, num_points & 7);
+    *clipped = vaddvq_u32(count) + tail;
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_s32f_clip_convert_16i_32u_H */
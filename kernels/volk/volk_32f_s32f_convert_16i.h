@@ -72,6 +72,41 @@
 #include <limits.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_convert_16i_u_avx512f(int16_t* outputVector,
+                                                       const float* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(SHRT_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(SHRT_MAX);
+    const float* in = inputVector;
+    int16_t* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // Scale and clip, the narrowing saturates as well
+        const __m512 value = _mm512_mul_ps(_mm512_loadu_ps(in), vScalar);
+        const __m512 ret = _mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val);
+        const __m256i narrow = _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(ret));
+        _mm256_storeu_si256((__m256i*)out, narrow);
+        in += 16;
+        out += 16;
+    }
+
+    // the last points with a masked load and a masked narrowing store
+    const __mmask16 mask = _cvtu32_mask16((1u << (num_points & 15)) - 1);
+    const __m512 value = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, in), vScalar);
+    const __m512 ret = _mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val);
+    _mm512_mask_cvtsepi32_storeu_epi16(out, mask, _mm512_cvtps_epi32(ret));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -327,6 +362,59 @@ static inline void volk_32f_s32f_convert_16i_generic(int16_t* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_OPENCL
+#include <volk/volk_opencl.h>
+
+static inline void volk_32f_s32f_convert_16i_opencl(int16_t* outputVector,
+                                                    const float* inputVector,
+                                                    const float scalar,
+                                                    unsigned int num_points)
+{
+    if (!volk_opencl_32f_s32f_convert_16i(outputVector, inputVector, scalar, num_points))
+        volk_32f_s32f_convert_16i_generic(outputVector, inputVector, scalar, num_points);
+}
+#endif /* LV_HAVE_OPENCL */
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32f_s32f_convert_16i_sve(int16_t* outputVector,
+                                                 const float* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    const svfloat32_t min_val = svdup_n_f32(SHRT_MIN);
+    const svfloat32_t max_val = svdup_n_f32(SHRT_MAX);
+
+    for (unsigned int number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32_u32(number, num_points);
+        svfloat32_t r = svmul_n_f32_x(pg, svld1_f32(pg, inputVector + number), scalar);
+        r = svmax_f32_x(pg, svmin_f32_x(pg, r, max_val), min_val);
+        // round in the current mode like rintf, then store the low halves
+        svst1h_s32(pg, outputVector + number, svcvt_s32_f32_x(pg, svrintx_f32_x(pg, r)));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_s32f_convert_16i_rvv(int16_t* outputVector,
+                                                 const float* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, inputVector += vl, outputVector += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        vfloat32m8_t r = __riscv_vfmul_vf_f32m8(__riscv_vle32_v_f32m8(inputVector, vl), scalar, vl);
+        r = __riscv_vfmax_vf_f32m8(__riscv_vfmin_vf_f32m8(r, SHRT_MAX, vl), SHRT_MIN, vl);
+        // narrowing convert in the dynamic rounding mode, like rintf
+        __riscv_vse16_v_i16m4(outputVector, __riscv_vfncvt_x_f_w_i16m4(r, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 
 #endif /* INCLUDED_volk_32f_s32f_convert_16i_u_H */
 #ifndef INCLUDED_volk_32f_s32f_convert_16i_a_H
@@ -337,6 +425,41 @@ static inline void volk_32f_s32f_convert_16i_generic(int16_t* outputVector,
 #include <stdio.h>
 #include <volk/volk_common.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_convert_16i_a_avx512f(int16_t* outputVector,
+                                                       const float* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(SHRT_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(SHRT_MAX);
+    const float* in = inputVector;
+    int16_t* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // Scale and clip, the narrowing saturates as well
+        const __m512 value = _mm512_mul_ps(_mm512_load_ps(in), vScalar);
+        const __m512 ret = _mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val);
+        const __m256i narrow = _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(ret));
+        _mm256_store_si256((__m256i*)out, narrow);
+        in += 16;
+        out += 16;
+    }
+
+    // the last points with a masked load and a masked narrowing store
+    const __mmask16 mask = _cvtu32_mask16((1u << (num_points & 15)) - 1);
+    const __m512 value = _mm512_mul_ps(_mm512_maskz_load_ps(mask, in), vScalar);
+    const __m512 ret = _mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val);
+    _mm512_mask_cvtsepi32_storeu_epi16(out, mask, _mm512_cvtps_epi32(ret));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -395,6 +518,66 @@ static inline void volk_32f_s32f_convert_16i_a_avx2(int16_t* outputVector,
         outputVector[number] = (int16_t)rintf(r);
     }
 }
+
+// non-temporal variant of the above: the stores bypass the caches, which
+// pays off when the output is far larger than the last level cache
+static inline void volk_32f_s32f_convert_16i_a_avx2_nt(int16_t* outputVector,
+                                                       const float* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* inputVectorPtr = (const float*)inputVector;
+    int16_t* outputVectorPtr = outputVector;
+
+    float min_val = SHRT_MIN;
+    float max_val = SHRT_MAX;
+    float r;
+
+    __m256 vScalar = _mm256_set1_ps(scalar);
+    __m256 inputVal1, inputVal2;
+    __m256i intInputVal1, intInputVal2;
+    __m256 ret1, ret2;
+    __m256 vmin_val = _mm256_set1_ps(min_val);
+    __m256 vmax_val = _mm256_set1_ps(max_val);
+
+    for (; number < sixteenthPoints; number++) {
+        inputVal1 = _mm256_load_ps(inputVectorPtr);
+        inputVectorPtr += 8;
+        inputVal2 = _mm256_load_ps(inputVectorPtr);
+        inputVectorPtr += 8;
+
+        // Scale and clip
+        ret1 = _mm256_max_ps(_mm256_min_ps(_mm256_mul_ps(inputVal1, vScalar), vmax_val),
+                             vmin_val);
+        ret2 = _mm256_max_ps(_mm256_min_ps(_mm256_mul_ps(inputVal2, vScalar), vmax_val),
+                             vmin_val);
+
+        intInputVal1 = _mm256_cvtps_epi32(ret1);
+        intInputVal2 = _mm256_cvtps_epi32(ret2);
+
+        intInputVal1 = _mm256_packs_epi32(intInputVal1, intInputVal2);
+        intInputVal1 = _mm256_permute4x64_epi64(intInputVal1, 0b11011000);
+
+        _mm256_stream_si256((__m256i*)outputVectorPtr, intInputVal1);
+        outputVectorPtr += 16;
+    }
+    // order the streaming stores before any later store
+    _mm_sfence();
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        r = inputVector[number] * scalar;
+        if (r > max_val)
+            r = max_val;
+        else if (r < min_val)
+            r = min_val;
+        outputVector[number] = (int16_t)rintf(r);
+    }
+}
 #endif /* LV_HAVE_AVX2 */
 
 
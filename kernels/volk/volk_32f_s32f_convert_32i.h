@@ -74,6 +74,40 @@
 #include <limits.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_convert_32i_u_avx512f(int32_t* outputVector,
+                                                       const float* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(INT_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(INT_MAX);
+    const float* in = inputVector;
+    int32_t* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // Scale and clip
+        const __m512 value = _mm512_mul_ps(_mm512_loadu_ps(in), vScalar);
+        const __m512 ret = _mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val);
+        _mm512_storeu_si512(out, _mm512_cvtps_epi32(ret));
+        in += 16;
+        out += 16;
+    }
+
+    // the last points with a masked load and store
+    const __mmask16 mask = _cvtu32_mask16((1u << (num_points & 15)) - 1);
+    const __m512 value = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, in), vScalar);
+    const __m512 ret = _mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val);
+    _mm512_mask_storeu_epi32(out, mask, _mm512_cvtps_epi32(ret));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
@@ -263,6 +297,40 @@ static inline void volk_32f_s32f_convert_32i_generic(int32_t* outputVector,
 #include <stdio.h>
 #include <volk/volk_common.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_convert_32i_a_avx512f(int32_t* outputVector,
+                                                       const float* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(INT_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(INT_MAX);
+    const float* in = inputVector;
+    int32_t* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // Scale and clip
+        const __m512 value = _mm512_mul_ps(_mm512_load_ps(in), vScalar);
+        const __m512 ret = _mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val);
+        _mm512_store_si512(out, _mm512_cvtps_epi32(ret));
+        in += 16;
+        out += 16;
+    }
+
+    // the last points with a masked load and store
+    const __mmask16 mask = _cvtu32_mask16((1u << (num_points & 15)) - 1);
+    const __m512 value = _mm512_mul_ps(_mm512_maskz_load_ps(mask, in), vScalar);
+    const __m512 ret = _mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val);
+    _mm512_mask_store_epi32(out, mask, _mm512_cvtps_epi32(ret));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
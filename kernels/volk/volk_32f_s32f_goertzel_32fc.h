@@ -0,0 +1,304 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_s32f_goertzel_32fc
+ *
+ * \b Overview
+ *
+ * Evaluates numBins DFT bins of a real stream with the Goertzel recursion, for
+ * tone detection where a full FFT would compute mostly unwanted bins. Each bin
+ * at normalised frequency f (cycles per sample) runs
+ *
+ * s[n] = x[n] + 2 cos(2 pi f) s[n - 1] - s[n - 2]
+ *
+ * and the state holds s[n - 1] and s[n - 2] from one call to the next, so a
+ * stream gives the same bins in blocks of any size. After each call
+ *
+ * bins[k] = sum over the samples so far of x[n] exp(-2 pi j f (n - last))
+ *
+ * that is the DFT with its phase referred to the latest sample. Zero the state
+ * to start a new block; the error grows with the samples since, and with the
+ * inverse of sin(2 pi f) squared toward 0 and the Nyquist frequency.
+ *
+ * The SIMD versions update a bin in each lane, for up to four registers of
+ * bins per pass over the input, and the fused multiply-add shortens the
+ * recursion, which is otherwise bound by its latency.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_goertzel_32fc(lv_32fc_t* bins, const float* inputVector,
+ * const float* frequencies, float* state, unsigned int numBins,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The samples.
+ * \li frequencies: The frequency of each bin, in cycles per sample.
+ * \li state: 2 * numBins values, s[n - 1] of each bin then s[n - 2] of each;
+ *     updated.
+ * \li numBins: The number of bins.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li bins: The numBins bins.
+ *
+ * \b Example
+ * Detect the DTMF tones in blocks of 205 samples at 8 kHz.
+ * \code
+ *   const float tones[8] = { 697, 770, 852, 941, 1209, 1336, 1477, 1633 };
+ *   float frequencies[8], state[16];
+ *   lv_32fc_t bins[8];
+ *
+ *   for (int k = 0; k < 8; k++) {
+ *       frequencies[k] = tones[k] / 8000.f;
+ *   }
+ *   // for each block of 205 samples
+ *   memset(state, 0, sizeof(state));
+ *   volk_32f_s32f_goertzel_32fc(bins, samples, frequencies, state, 8, 205);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_goertzel_32fc_H
+#define INCLUDED_volk_32f_s32f_goertzel_32fc_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/* Loads lanes bins from bin on into coefficients, s1 and s2, padding them with
+ * idle lanes past numBins. */
+static inline void volk_goertzel_load(float* coefficients,
+                                      float* s1,
+                                      float* s2,
+                                      const float* frequencies,
+                                      const float* state,
+                                      unsigned int numBins,
+                                      unsigned int bin,
+                                      unsigned int lanes)
+{
+    unsigned int lane;
+
+    for (lane = 0; lane < lanes; lane++) {
+        if (bin + lane < numBins) {
+            coefficients[lane] = (float)(2. * cos(2. * M_PI * frequencies[bin + lane]));
+            s1[lane] = state[bin + lane];
+            s2[lane] = state[numBins + bin + lane];
+        } else {
+            coefficients[lane] = s1[lane] = s2[lane] = 0.f;
+        }
+    }
+}
+
+/* Stores the state of the bins loaded by volk_goertzel_load back */
+static inline void volk_goertzel_store(float* state,
+                                       const float* s1,
+                                       const float* s2,
+                                       unsigned int numBins,
+                                       unsigned int bin,
+                                       unsigned int lanes)
+{
+    unsigned int lane;
+
+    for (lane = 0; lane < lanes && bin + lane < numBins; lane++) {
+        state[bin + lane] = s1[lane];
+        state[numBins + bin + lane] = s2[lane];
+    }
+}
+
+/* The bins from the state, s[n - 1] - exp(-2 pi j f) s[n - 2] */
+static inline void volk_goertzel_bins(lv_32fc_t* bins,
+                                      const float* frequencies,
+                                      const float* state,
+                                      unsigned int numBins)
+{
+    double omega;
+    unsigned int bin;
+
+    for (bin = 0; bin < numBins; bin++) {
+        omega = 2. * M_PI * frequencies[bin];
+        bins[bin] = lv_cmake((float)(state[bin] - cos(omega) * state[numBins + bin]),
+                             (float)(sin(omega) * state[numBins + bin]));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_goertzel_32fc_generic(lv_32fc_t* bins,
+                                                       const float* inputVector,
+                                                       const float* frequencies,
+                                                       float* state,
+                                                       unsigned int numBins,
+                                                       unsigned int num_points)
+{
+    float coefficient, s0, s1, s2;
+    unsigned int bin, number;
+
+    for (bin = 0; bin < numBins; bin++) {
+        volk_goertzel_load(&coefficient, &s1, &s2, frequencies, state, numBins, bin, 1);
+        for (number = 0; number < num_points; number++) {
+            s0 = (inputVector[number] - s2) + coefficient * s1;
+            s2 = s1;
+            s1 = s0;
+        }
+        volk_goertzel_store(state, &s1, &s2, numBins, bin, 1);
+    }
+    volk_goertzel_bins(bins, frequencies, state, numBins);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_goertzel_32fc_u_avx_fma(lv_32fc_t* bins,
+                                                         const float* inputVector,
+                                                         const float* frequencies,
+                                                         float* state,
+                                                         unsigned int numBins,
+                                                         unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) float coefficients[32];
+    __VOLK_ATTR_ALIGNED(32) float s1Lanes[32];
+    __VOLK_ATTR_ALIGNED(32) float s2Lanes[32];
+    __m256 coefficient[4], s0, s1[4], s2[4], in;
+    unsigned int bin, number, i;
+
+    // four chains of bins hide the latency of the recursion, so a short last
+    // pass costs as much as a full one and pads its lanes
+    for (bin = 0; bin < numBins; bin += 32) {
+        volk_goertzel_load(
+            coefficients, s1Lanes, s2Lanes, frequencies, state, numBins, bin, 32);
+        for (i = 0; i < 4; i++) {
+            coefficient[i] = _mm256_load_ps(coefficients + 8 * i);
+            s1[i] = _mm256_load_ps(s1Lanes + 8 * i);
+            s2[i] = _mm256_load_ps(s2Lanes + 8 * i);
+        }
+        for (number = 0; number < num_points; number++) {
+            in = _mm256_broadcast_ss(inputVector + number);
+            for (i = 0; i < 4; i++) {
+                s0 = _mm256_fmadd_ps(coefficient[i], s1[i], _mm256_sub_ps(in, s2[i]));
+                s2[i] = s1[i];
+                s1[i] = s0;
+            }
+        }
+        for (i = 0; i < 4; i++) {
+            _mm256_store_ps(s1Lanes + 8 * i, s1[i]);
+            _mm256_store_ps(s2Lanes + 8 * i, s2[i]);
+        }
+        volk_goertzel_store(state, s1Lanes, s2Lanes, numBins, bin, 32);
+    }
+    volk_goertzel_bins(bins, frequencies, state, numBins);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_goertzel_32fc_u_avx512f(lv_32fc_t* bins,
+                                                         const float* inputVector,
+                                                         const float* frequencies,
+                                                         float* state,
+                                                         unsigned int numBins,
+                                                         unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) float coefficients[64];
+    __VOLK_ATTR_ALIGNED(64) float s1Lanes[64];
+    __VOLK_ATTR_ALIGNED(64) float s2Lanes[64];
+    __m512 coefficient[4], s0, s1[4], s2[4], in;
+    unsigned int bin, number, i;
+
+    // four chains of bins hide the latency of the recursion, so a short last
+    // pass costs as much as a full one and pads its lanes
+    for (bin = 0; bin < numBins; bin += 64) {
+        volk_goertzel_load(
+            coefficients, s1Lanes, s2Lanes, frequencies, state, numBins, bin, 64);
+        for (i = 0; i < 4; i++) {
+            coefficient[i] = _mm512_load_ps(coefficients + 16 * i);
+            s1[i] = _mm512_load_ps(s1Lanes + 16 * i);
+            s2[i] = _mm512_load_ps(s2Lanes + 16 * i);
+        }
+        for (number = 0; number < num_points; number++) {
+            in = _mm512_set1_ps(inputVector[number]);
+            for (i = 0; i < 4; i++) {
+                s0 = _mm512_fmadd_ps(coefficient[i], s1[i], _mm512_sub_ps(in, s2[i]));
+                s2[i] = s1[i];
+                s1[i] = s0;
+            }
+        }
+        for (i = 0; i < 4; i++) {
+            _mm512_store_ps(s1Lanes + 16 * i, s1[i]);
+            _mm512_store_ps(s2Lanes + 16 * i, s2[i]);
+        }
+        volk_goertzel_store(state, s1Lanes, s2Lanes, numBins, bin, 64);
+    }
+    volk_goertzel_bins(bins, frequencies, state, numBins);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_goertzel_32fc_neonv8(lv_32fc_t* bins,
+                                                      const float* inputVector,
+                                                      const float* frequencies,
+                                                      float* state,
+                                                      unsigned int numBins,
+                                                      unsigned int num_points)
+{
+    float coefficients[16], s1Lanes[16], s2Lanes[16];
+    float32x4_t coefficient[4], s0, s1[4], s2[4], in;
+    unsigned int bin, number, i;
+
+    // four chains of bins hide the latency of the recursion, so a short last
+    // pass costs as much as a full one and pads its lanes
+    for (bin = 0; bin < numBins; bin += 16) {
+        volk_goertzel_load(
+            coefficients, s1Lanes, s2Lanes, frequencies, state, numBins, bin, 16);
+        for (i = 0; i < 4; i++) {
+            coefficient[i] = vld1q_f32(coefficients + 4 * i);
+            s1[i] = vld1q_f32(s1Lanes + 4 * i);
+            s2[i] = vld1q_f32(s2Lanes + 4 * i);
+        }
+        for (number = 0; number < num_points; number++) {
+            in = vdupq_n_f32(inputVector[number]);
+            for (i = 0; i < 4; i++) {
+                s0 = vfmaq_f32(vsubq_f32(in, s2[i]), coefficient[i], s1[i]);
+                s2[i] = s1[i];
+                s1[i] = s0;
+            }
+        }
+        for (i = 0; i < 4; i++) {
+            vst1q_f32(s1Lanes + 4 * i, s1[i]);
+            vst1q_f32(s2Lanes + 4 * i, s2[i]);
+        }
+        volk_goertzel_store(state, s1Lanes, s2Lanes, numBins, bin, 16);
+    }
+    volk_goertzel_bins(bins, frequencies, state, numBins);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_s32f_goertzel_32fc_H */
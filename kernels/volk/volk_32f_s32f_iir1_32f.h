@@ -0,0 +1,311 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_s32f_iir1_32f
+ *
+ * \b Overview
+ *
+ * Runs the single pole recursion
+ *
+ * outputVector[n] = pole * outputVector[n - 1] + inputVector[n]
+ *
+ * over the input, the building block of exponential smoothers, envelope
+ * followers and, on the first difference of a signal, DC blockers. The
+ * SIMD versions take each vector as a prefix sum scaled by the powers of
+ * the pole, in log steps, then add the last output of the vector before
+ * scaled by the powers of the pole. They round a little differently from
+ * the recursion.
+ *
+ * The last output is carried from call to call in the state, so a stream
+ * cut into buffers is filtered by passing the same variable to every call.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_iir1_32f(float* outputVector, const float* inputVector,
+ * const float pole, float* state, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The samples to filter.
+ * \li pole: The feedback coefficient, between -1 and 1 for a stable filter.
+ * \li state: The output before the first input, 0 to start.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The filtered samples.
+ * \li state: The last output, to carry into the next buffer.
+ *
+ * \b Example
+ * Smooth a magnitude with a time constant of 100 samples, the input scaled
+ * by 1 - pole for a gain of 1.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float state = 0.f;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.01f * (ii % 2 ? 1.5f : 0.5f);
+ *   }
+ *
+ *   volk_32f_s32f_iir1_32f(out, in, 0.99f, &state, N);
+ *
+ *   printf("smoothed: %f\n", out[N - 1]);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_iir1_32f_u_H
+#define INCLUDED_volk_32f_s32f_iir1_32f_u_H
+
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_iir1_32f_generic(float* outputVector,
+                                                  const float* inputVector,
+                                                  const float pole,
+                                                  float* state,
+                                                  unsigned int num_points)
+{
+    float last = *state;
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        last = pole * last + inputVector[number];
+        outputVector[number] = last;
+    }
+    *state = last;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_s32f_iir1_32f_u_sse(float* outputVector,
+                                                const float* inputVector,
+                                                const float pole,
+                                                float* state,
+                                                unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 pole1 = _mm_set1_ps(pole);
+    const __m128 pole2 = _mm_set1_ps(pole * pole);
+    const __m128 powers =
+        _mm_setr_ps(pole, pole * pole, pole * pole * pole, pole * pole * pole * pole);
+    __m128 last = _mm_set1_ps(*state);
+    __m128 x, shift2;
+    float carry;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = _mm_loadu_ps(inputVector);
+        // 0, 0, x0, x1 and 0, x0, x1, x2
+        shift2 = _mm_movelh_ps(zero, x);
+        x = _mm_add_ps(
+            x, _mm_mul_ps(pole1, _mm_shuffle_ps(shift2, x, _MM_SHUFFLE(2, 1, 2, 0))));
+        x = _mm_add_ps(x, _mm_mul_ps(pole2, _mm_movelh_ps(zero, x)));
+        x = _mm_add_ps(x, _mm_mul_ps(powers, last));
+        _mm_storeu_ps(outputVector, x);
+        last = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+        inputVector += 4;
+        outputVector += 4;
+    }
+
+    carry = _mm_cvtss_f32(last);
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        carry = pole * carry + *inputVector++;
+        *outputVector++ = carry;
+    }
+    *state = carry;
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_iir1_32f_u_avx(float* outputVector,
+                                                const float* inputVector,
+                                                const float pole,
+                                                float* state,
+                                                unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 pole1 = _mm256_set1_ps(pole);
+    const __m256 pole2 = _mm256_set1_ps(pole * pole);
+    __VOLK_ATTR_ALIGNED(32) float powerVector[8];
+    __m256 powers, upperPowers, last, x, below;
+    float power = pole, carry;
+    unsigned int number;
+
+    for (number = 0; number < 8; number++) {
+        powerVector[number] = power;
+        power *= pole;
+    }
+    powers = _mm256_load_ps(powerVector);
+    // the upper lane scales the last sum of the lower one by pole to pole^4
+    upperPowers = _mm256_permute2f128_ps(powers, powers, 0x00);
+    last = _mm256_set1_ps(*state);
+
+    for (number = 0; number < eighthPoints; number++) {
+        x = _mm256_loadu_ps(inputVector);
+        // the sums within the 128-bit lanes, then the lower lane's into the upper
+        below =
+            _mm256_blend_ps(_mm256_permute_ps(x, _MM_SHUFFLE(2, 1, 0, 3)), zero, 0x11);
+        x = _mm256_add_ps(x, _mm256_mul_ps(pole1, below));
+        below =
+            _mm256_blend_ps(_mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2)), zero, 0x33);
+        x = _mm256_add_ps(x, _mm256_mul_ps(pole2, below));
+        below = _mm256_permute2f128_ps(_mm256_permute_ps(x, 0xff), zero, 0x08);
+        x = _mm256_add_ps(x, _mm256_mul_ps(upperPowers, below));
+        x = _mm256_add_ps(x, _mm256_mul_ps(powers, last));
+        _mm256_storeu_ps(outputVector, x);
+        last = _mm256_permute_ps(x, 0xff);
+        last = _mm256_permute2f128_ps(last, last, 0x11);
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    carry = _mm256_cvtss_f32(last);
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        carry = pole * carry + *inputVector++;
+        *outputVector++ = carry;
+    }
+    *state = carry;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_iir1_32f_u_avx512f(float* outputVector,
+                                                    const float* inputVector,
+                                                    const float pole,
+                                                    float* state,
+                                                    unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i lastLane = _mm512_set1_epi32(15);
+    __VOLK_ATTR_ALIGNED(64) float powerVector[16];
+    __m512 powers, pole1, pole2, pole4, pole8, last, x;
+    float power = pole, carry;
+    unsigned int number;
+
+    for (number = 0; number < 16; number++) {
+        powerVector[number] = power;
+        power *= pole;
+    }
+    powers = _mm512_load_ps(powerVector);
+    pole1 = _mm512_set1_ps(powerVector[0]);
+    pole2 = _mm512_set1_ps(powerVector[1]);
+    pole4 = _mm512_set1_ps(powerVector[3]);
+    pole8 = _mm512_set1_ps(powerVector[7]);
+    last = _mm512_set1_ps(*state);
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // lane k gathers the inputs k - 2^s + 1 to k, each step shifting in zeros
+        x = _mm512_loadu_ps(inputVector);
+        x = _mm512_fmadd_ps(
+            pole1,
+            _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 15)),
+            x);
+        x = _mm512_fmadd_ps(
+            pole2,
+            _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 14)),
+            x);
+        x = _mm512_fmadd_ps(
+            pole4,
+            _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 12)),
+            x);
+        x = _mm512_fmadd_ps(
+            pole8,
+            _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 8)),
+            x);
+        x = _mm512_fmadd_ps(powers, last, x);
+        _mm512_storeu_ps(outputVector, x);
+        last = _mm512_permutexvar_ps(lastLane, x);
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    carry = _mm512_cvtss_f32(last);
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        carry = pole * carry + *inputVector++;
+        *outputVector++ = carry;
+    }
+    *state = carry;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_iir1_32f_neon(float* outputVector,
+                                               const float* inputVector,
+                                               const float pole,
+                                               float* state,
+                                               unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float powerVector[4] = { pole, pole * pole, pole * pole * pole,
+                                   pole * pole * pole * pole };
+    const float32x4_t powers = vld1q_f32(powerVector);
+    float32x4_t x;
+    float carry = *state;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = vld1q_f32(inputVector);
+        x = vmlaq_n_f32(x, vextq_f32(zero, x, 3), powerVector[0]);
+        x = vmlaq_n_f32(x, vextq_f32(zero, x, 2), powerVector[1]);
+        x = vmlaq_n_f32(x, powers, carry);
+        vst1q_f32(outputVector, x);
+        carry = vgetq_lane_f32(x, 3);
+        inputVector += 4;
+        outputVector += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        carry = pole * carry + *inputVector++;
+        *outputVector++ = carry;
+    }
+    *state = carry;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_iir1_32f_u_H */
@@ -0,0 +1,236 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_s32f_percentile_noise_floor_32f
+ *
+ * \b Overview
+ *
+ * Estimates the noise floor of a power spectrum as the mean of the points at
+ * or below the given percentile of them.
+ *
+ * Unlike volk_32f_s32f_calc_spectral_noise_floor_32f, whose first mean is
+ * pulled up by strong signals and which then keeps the points within a fixed
+ * distance of it, the points kept here depend only on their order: as long
+ * as signals occupy less than 1 - percentile of the spectrum, none of them
+ * enters the mean. The percentile comes from volk_32f_s32f_quantile_32f, so
+ * the same points are averaged by all versions.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_percentile_noise_floor_32f(float* noiseFloorAmplitude,
+ * const float* realDataPoints, const float percentile, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li realDataPoints: The input power spectrum, e.g. in dB.
+ * \li percentile: The fraction of the points that may be averaged, in (0, 1];
+ * 0.5 averages the lower half of the spectrum.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li noiseFloorAmplitude: The noise floor of the input spectrum, in the units
+ * of the input. It is 0 if there are no points.
+ *
+ * \b Example
+ * \code
+ *   int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* spectrum = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float noise_floor;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       spectrum[ii] = ii % 64 < 8 ? -40.f : -90.f + (float)(ii % 7);
+ *   }
+ *
+ *   volk_32f_s32f_percentile_noise_floor_32f(&noise_floor, spectrum, 0.5f, N);
+ *   printf("noise floor = %f dB\n", noise_floor);
+ *
+ *   volk_free(spectrum);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_percentile_noise_floor_32f_H
+#define INCLUDED_volk_32f_s32f_percentile_noise_floor_32f_H
+
+#include <volk/volk_32f_s32f_quantile_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32f_s32f_percentile_noise_floor_32f_generic(float* noiseFloorAmplitude,
+                                                 const float* realDataPoints,
+                                                 const float percentile,
+                                                 unsigned int num_points)
+{
+    float threshold, sum = 0.f;
+    unsigned int number, count = 0;
+
+    volk_32f_s32f_quantile_32f_generic(
+        &threshold, realDataPoints, percentile, num_points);
+
+    for (number = 0; number < num_points; number++) {
+        if (realDataPoints[number] <= threshold) {
+            sum += realDataPoints[number];
+            count++;
+        }
+    }
+    *noiseFloorAmplitude = count ? sum / (float)count : threshold;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void
+volk_32f_s32f_percentile_noise_floor_32f_u_avx2(float* noiseFloorAmplitude,
+                                                const float* realDataPoints,
+                                                const float percentile,
+                                                unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __VOLK_ATTR_ALIGNED(32) float sums[8];
+    __VOLK_ATTR_ALIGNED(32) int counts[8];
+    float threshold, sum = 0.f;
+    unsigned int number, count = 0;
+    __m256 data, kept, vthreshold, vsum = _mm256_setzero_ps();
+    __m256i vcount = _mm256_setzero_si256();
+
+    volk_32f_s32f_quantile_32f_u_avx2(
+        &threshold, realDataPoints, percentile, num_points);
+    vthreshold = _mm256_set1_ps(threshold);
+
+    for (number = 0; number < eighthPoints; number++) {
+        data = _mm256_loadu_ps(realDataPoints + 8 * number);
+        kept = _mm256_cmp_ps(data, vthreshold, _CMP_LE_OQ);
+        vsum = _mm256_add_ps(vsum, _mm256_and_ps(data, kept));
+        // the kept lanes are -1
+        vcount = _mm256_sub_epi32(vcount, _mm256_castps_si256(kept));
+    }
+    _mm256_store_ps(sums, vsum);
+    _mm256_store_si256((__m256i*)counts, vcount);
+    for (number = 0; number < 8; number++) {
+        sum += sums[number];
+        count += counts[number];
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        if (realDataPoints[number] <= threshold) {
+            sum += realDataPoints[number];
+            count++;
+        }
+    }
+    *noiseFloorAmplitude = count ? sum / (float)count : threshold;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_s32f_percentile_noise_floor_32f_u_avx512f(float* noiseFloorAmplitude,
+                                                   const float* realDataPoints,
+                                                   const float percentile,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    float threshold, sum;
+    unsigned int number, count = 0;
+    __m512 data, vthreshold, vsum = _mm512_setzero_ps();
+    __mmask16 kept;
+
+    volk_32f_s32f_quantile_32f_u_avx512f(
+        &threshold, realDataPoints, percentile, num_points);
+    vthreshold = _mm512_set1_ps(threshold);
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        data = _mm512_loadu_ps(realDataPoints + 16 * number);
+        kept = _mm512_cmp_ps_mask(data, vthreshold, _CMP_LE_OQ);
+        vsum = _mm512_mask_add_ps(vsum, kept, vsum, data);
+        count += __builtin_popcount(kept);
+    }
+    sum = _mm512_reduce_add_ps(vsum);
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        if (realDataPoints[number] <= threshold) {
+            sum += realDataPoints[number];
+            count++;
+        }
+    }
+    *noiseFloorAmplitude = count ? sum / (float)count : threshold;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_32f_s32f_percentile_noise_floor_32f_neon(float* noiseFloorAmplitude,
+                                              const float* realDataPoints,
+                                              const float percentile,
+                                              unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    float sums[4];
+    uint32_t counts[4];
+    float threshold, sum = 0.f;
+    unsigned int number, count = 0;
+    float32x4_t data, vthreshold, vsum = vdupq_n_f32(0.f);
+    uint32x4_t kept, vcount = vdupq_n_u32(0);
+
+    volk_32f_s32f_quantile_32f_neon(&threshold, realDataPoints, percentile, num_points);
+    vthreshold = vdupq_n_f32(threshold);
+
+    for (number = 0; number < quarterPoints; number++) {
+        data = vld1q_f32(realDataPoints + 4 * number);
+        kept = vcleq_f32(data, vthreshold);
+        vsum = vaddq_f32(
+            vsum, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(data), kept)));
+        // the kept lanes are all ones
+        vcount = vsubq_u32(vcount, kept);
+    }
+    vst1q_f32(sums, vsum);
+    vst1q_u32(counts, vcount);
+    for (number = 0; number < 4; number++) {
+        sum += sums[number];
+        count += counts[number];
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        if (realDataPoints[number] <= threshold) {
+            sum += realDataPoints[number];
+            count++;
+        }
+    }
+    *noiseFloorAmplitude = count ? sum / (float)count : threshold;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_percentile_noise_floor_32f_H */
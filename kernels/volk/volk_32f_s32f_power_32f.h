@@ -28,6 +28,10 @@
  * Takes each input vector value to the specified power and stores the
  * results in the return vector.
  *
+ * The AVX2, AVX-512 and NEON versions take the logarithm and exponential in
+ * double precision, since the power scales the error of the logarithm, and
+ * stay within an ulp of powf, special cases included.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32f_s32f_power_32f(float* cVector, const float* aVector, const float power,
@@ -211,3 +215,84 @@ static inline void volk_32f_s32f_power_32f_generic(float* cVector,
 
 
 #endif /* INCLUDED_volk_32f_s32f_power_32f_a_H */
+
+#ifndef INCLUDED_volk_32f_s32f_power_32f_u_H
+#define INCLUDED_volk_32f_s32f_power_32f_u_H
+
+#include <math.h>
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_s32f_power_32f_u_avx2_fma(float* cVector,
+                                                      const float* aVector,
+                                                      const float power,
+                                                      unsigned int num_points)
+{
+    const __m256 vPower = _mm256_set1_ps(power);
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_points; number += 8) {
+        _mm256_storeu_ps(
+            cVector + number,
+            _mm256_pow_ps_avx2_fma(_mm256_loadu_ps(aVector + number), vPower));
+    }
+
+    for (; number < num_points; number++) {
+        cVector[number] = powf(aVector[number], power);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_s32f_power_32f_u_avx512f(float* cVector,
+                                                     const float* aVector,
+                                                     const float power,
+                                                     unsigned int num_points)
+{
+    const __m512 vPower = _mm512_set1_ps(power);
+    unsigned int number = 0;
+
+    for (; number + 16 <= num_points; number += 16) {
+        _mm512_storeu_ps(cVector + number,
+                         _mm512_pow_ps(_mm512_loadu_ps(aVector + number), vPower));
+    }
+
+    for (; number < num_points; number++) {
+        cVector[number] = powf(aVector[number], power);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_s32f_power_32f_neonv8(float* cVector,
+                                                  const float* aVector,
+                                                  const float power,
+                                                  unsigned int num_points)
+{
+    const float32x4_t vPower = vdupq_n_f32(power);
+    unsigned int number = 0;
+
+    for (; number + 4 <= num_points; number += 4) {
+        vst1q_f32(cVector + number, _vpowq_f32(vld1q_f32(aVector + number), vPower));
+    }
+
+    for (; number < num_points; number++) {
+        cVector[number] = powf(aVector[number], power);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_s32f_power_32f_u_H */
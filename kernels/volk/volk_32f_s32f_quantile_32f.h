@@ -0,0 +1,344 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_s32f_quantile_32f
+ *
+ * \b Overview
+ *
+ * Finds the given quantile of the input points, the point that would be at
+ * index round(quantile * (num_points - 1)) if they were sorted, without
+ * sorting them or needing a buffer.
+ *
+ * The points are mapped to unsigned keys in the same order and the rank is
+ * selected one digit of the keys at a time, from the top 11 bits over the
+ * next 11 to the last 10, each pass counting the next digit of the points
+ * that share the digits found so far. The SIMD versions compute the keys and
+ * skip the vectors with no point matching those digits, which after the
+ * first pass are most of them. The result is exact, so it is the same for
+ * all versions; NaN inputs sort above or below everything by their sign.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_quantile_32f(float* result, const float* inputVector,
+ * const float quantile, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input points.
+ * \li quantile: The quantile to find, 0 for the minimum, 0.5 for the median and
+ * 1 for the maximum. Values outside [0, 1] are clamped.
+ * \li num_points: The number of points. The result is 0 if there are none.
+ *
+ * \b Outputs
+ * \li result: The quantile of the points.
+ *
+ * \b Example
+ * Find the median of a vector.
+ * \code
+ *   int N = 1001;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float median;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = (float)((ii * 37) % N);
+ *   }
+ *
+ *   volk_32f_s32f_quantile_32f(&median, in, 0.5f, N);
+ *   printf("median = %f\n", median);
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_quantile_32f_H
+#define INCLUDED_volk_32f_s32f_quantile_32f_H
+
+#include <inttypes.h>
+#include <string.h>
+
+/* The shifts and widths of the digits of the keys, from the top */
+static const unsigned int volk_quantile_shifts[3] = { 21, 10, 0 };
+static const unsigned int volk_quantile_bits[3] = { 11, 11, 10 };
+
+/* The index of the point the quantile selects among num_points > 0 */
+static inline unsigned int volk_quantile_rank(float quantile, unsigned int num_points)
+{
+    if (!(quantile > 0.f)) {
+        return 0;
+    }
+    if (quantile >= 1.f) {
+        return num_points - 1;
+    }
+    return (unsigned int)(quantile * (float)(num_points - 1) + 0.5f);
+}
+
+/* Maps a float to an unsigned key of the same order */
+static inline uint32_t volk_quantile_key(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits & 0x80000000 ? ~bits : bits | 0x80000000;
+}
+
+static inline float volk_quantile_value(uint32_t key)
+{
+    uint32_t bits = key & 0x80000000 ? key & 0x7fffffff : ~key;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*
+ * Finds the digit the rank falls into from the counts of the digits, and
+ * makes the rank relative to the points with a lower one
+ */
+static inline uint32_t volk_quantile_digit(const uint32_t* counts,
+                                           unsigned int* rank)
+{
+    uint32_t digit = 0;
+    while (*rank >= counts[digit]) {
+        *rank -= counts[digit++];
+    }
+    return digit;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_quantile_32f_generic(float* result,
+                                                      const float* inputVector,
+                                                      const float quantile,
+                                                      unsigned int num_points)
+{
+    uint32_t counts[2048];
+    uint32_t prefix = 0, prefixMask = 0, key, digitMask;
+    unsigned int rank, pass, shift, number;
+
+    if (num_points == 0) {
+        *result = 0.f;
+        return;
+    }
+    rank = volk_quantile_rank(quantile, num_points);
+
+    for (pass = 0; pass < 3; pass++) {
+        shift = volk_quantile_shifts[pass];
+        digitMask = (1u << volk_quantile_bits[pass]) - 1;
+        memset(counts, 0, sizeof(counts));
+        for (number = 0; number < num_points; number++) {
+            key = volk_quantile_key(inputVector[number]);
+            if ((key & prefixMask) == prefix) {
+                counts[(key >> shift) & digitMask]++;
+            }
+        }
+        prefix |= volk_quantile_digit(counts, &rank) << shift;
+        prefixMask |= digitMask << shift;
+    }
+
+    *result = volk_quantile_value(prefix);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_quantile_32f_u_avx2(float* result,
+                                                     const float* inputVector,
+                                                     const float quantile,
+                                                     unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i signBit = _mm256_set1_epi32((int)0x80000000);
+    uint32_t counts[2048];
+    __VOLK_ATTR_ALIGNED(32) uint32_t keys[8];
+    uint32_t prefix = 0, prefixMask = 0, key, digitMask;
+    unsigned int rank, pass, shift, number, matches;
+    __m256i bits, vkey, vprefix, vprefixMask;
+
+    if (num_points == 0) {
+        *result = 0.f;
+        return;
+    }
+    rank = volk_quantile_rank(quantile, num_points);
+
+    for (pass = 0; pass < 3; pass++) {
+        shift = volk_quantile_shifts[pass];
+        digitMask = (1u << volk_quantile_bits[pass]) - 1;
+        vprefix = _mm256_set1_epi32((int)prefix);
+        vprefixMask = _mm256_set1_epi32((int)prefixMask);
+        memset(counts, 0, sizeof(counts));
+        for (number = 0; number < eighthPoints; number++) {
+            // flip all the bits of negative points and the sign of the others
+            bits = _mm256_loadu_si256((const __m256i*)(inputVector + 8 * number));
+            vkey = _mm256_xor_si256(
+                bits, _mm256_or_si256(_mm256_srai_epi32(bits, 31), signBit));
+            matches = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(
+                _mm256_and_si256(vkey, vprefixMask), vprefix)));
+            if (matches) {
+                _mm256_store_si256((__m256i*)keys, vkey);
+                while (matches) {
+                    counts[(keys[__builtin_ctz(matches)] >> shift) & digitMask]++;
+                    matches &= matches - 1;
+                }
+            }
+        }
+        for (number = eighthPoints * 8; number < num_points; number++) {
+            key = volk_quantile_key(inputVector[number]);
+            if ((key & prefixMask) == prefix) {
+                counts[(key >> shift) & digitMask]++;
+            }
+        }
+        prefix |= volk_quantile_digit(counts, &rank) << shift;
+        prefixMask |= digitMask << shift;
+    }
+
+    *result = volk_quantile_value(prefix);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_quantile_32f_u_avx512f(float* result,
+                                                        const float* inputVector,
+                                                        const float quantile,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i signBit = _mm512_set1_epi32((int)0x80000000);
+    uint32_t counts[2048];
+    __VOLK_ATTR_ALIGNED(64) uint32_t keys[16];
+    uint32_t prefix = 0, prefixMask = 0, key, digitMask;
+    unsigned int rank, pass, shift, number, matches;
+    __m512i bits, vkey, vprefix, vprefixMask;
+
+    if (num_points == 0) {
+        *result = 0.f;
+        return;
+    }
+    rank = volk_quantile_rank(quantile, num_points);
+
+    for (pass = 0; pass < 3; pass++) {
+        shift = volk_quantile_shifts[pass];
+        digitMask = (1u << volk_quantile_bits[pass]) - 1;
+        vprefix = _mm512_set1_epi32((int)prefix);
+        vprefixMask = _mm512_set1_epi32((int)prefixMask);
+        memset(counts, 0, sizeof(counts));
+        for (number = 0; number < sixteenthPoints; number++) {
+            // flip all the bits of negative points and the sign of the others
+            bits = _mm512_loadu_si512((const void*)(inputVector + 16 * number));
+            vkey = _mm512_xor_si512(
+                bits, _mm512_or_si512(_mm512_srai_epi32(bits, 31), signBit));
+            matches = _mm512_cmpeq_epi32_mask(_mm512_and_si512(vkey, vprefixMask),
+                                              vprefix);
+            if (matches) {
+                _mm512_store_si512((void*)keys, vkey);
+                while (matches) {
+                    counts[(keys[__builtin_ctz(matches)] >> shift) & digitMask]++;
+                    matches &= matches - 1;
+                }
+            }
+        }
+        for (number = sixteenthPoints * 16; number < num_points; number++) {
+            key = volk_quantile_key(inputVector[number]);
+            if ((key & prefixMask) == prefix) {
+                counts[(key >> shift) & digitMask]++;
+            }
+        }
+        prefix |= volk_quantile_digit(counts, &rank) << shift;
+        prefixMask |= digitMask << shift;
+    }
+
+    *result = volk_quantile_value(prefix);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_quantile_32f_neon(float* result,
+                                                   const float* inputVector,
+                                                   const float quantile,
+                                                   unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const uint32x4_t signBit = vdupq_n_u32(0x80000000);
+    uint32_t counts[2048];
+    uint32_t keys[4], lanes[4];
+    uint32_t prefix = 0, prefixMask = 0, key, digitMask;
+    unsigned int rank, pass, shift, number, lane;
+    uint32x4_t bits, vkey, vprefix, vprefixMask, matches;
+
+    if (num_points == 0) {
+        *result = 0.f;
+        return;
+    }
+    rank = volk_quantile_rank(quantile, num_points);
+
+    for (pass = 0; pass < 3; pass++) {
+        shift = volk_quantile_shifts[pass];
+        digitMask = (1u << volk_quantile_bits[pass]) - 1;
+        vprefix = vdupq_n_u32(prefix);
+        vprefixMask = vdupq_n_u32(prefixMask);
+        memset(counts, 0, sizeof(counts));
+        for (number = 0; number < quarterPoints; number++) {
+            // flip all the bits of negative points and the sign of the others
+            bits = vreinterpretq_u32_f32(vld1q_f32(inputVector + 4 * number));
+            vkey = veorq_u32(
+                bits,
+                vorrq_u32(vreinterpretq_u32_s32(
+                              vshrq_n_s32(vreinterpretq_s32_u32(bits), 31)),
+                          signBit));
+            matches = vceqq_u32(vandq_u32(vkey, vprefixMask), vprefix);
+            // any lane matching leaves a set bit in the narrowed mask
+            if (vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(matches)), 0)) {
+                vst1q_u32(keys, vkey);
+                vst1q_u32(lanes, matches);
+                for (lane = 0; lane < 4; lane++) {
+                    if (lanes[lane]) {
+                        counts[(keys[lane] >> shift) & digitMask]++;
+                    }
+                }
+            }
+        }
+        for (number = quarterPoints * 4; number < num_points; number++) {
+            key = volk_quantile_key(inputVector[number]);
+            if ((key & prefixMask) == prefix) {
+                counts[(key >> shift) & digitMask]++;
+            }
+        }
+        prefix |= volk_quantile_digit(counts, &rank) << shift;
+        prefixMask |= digitMask << shift;
+    }
+
+    *result = volk_quantile_value(prefix);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_quantile_32f_H */
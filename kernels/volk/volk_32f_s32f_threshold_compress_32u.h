@@ -0,0 +1,237 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_s32f_threshold_compress_32u
+ *
+ * \b Overview
+ *
+ * Picks the points of the input above a threshold: writes the indexes and
+ * the values of the points greater than the threshold, in order, and their
+ * number. NaNs are never picked.
+ *
+ * The AVX-512 version packs the picked points of each vector with the
+ * compress stores; the AVX and NEON versions skip the vectors without any,
+ * which are most of them for a detection threshold.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_threshold_compress_32u(uint32_t* outputIndexes, float*
+ * outputValues, uint32_t* numOutputs, const float* inputVector, const float
+ * threshold, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input vector.
+ * \li threshold: The value the picked points exceed.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li outputIndexes: The indexes of the picked points, room for num_points.
+ * \li outputValues: The values of the picked points, room for num_points.
+ * \li numOutputs: The number of picked points.
+ *
+ * \b Example
+ * List the bins of a spectrum 10 dB above the noise floor.
+ * \code
+ *   int N = 65536;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* dB = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint32_t* bins = (uint32_t*)volk_malloc(sizeof(uint32_t)*N, alignment);
+ *   float* levels = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint32_t found;
+ *
+ *   // compute the spectrum in dB and its noise floor, then
+ *   volk_32f_s32f_threshold_compress_32u(bins, levels, &found, dB, floor + 10.f, N);
+ *
+ *   for(uint32_t ii = 0; ii < found; ++ii){
+ *       printf("bin %u at %1.1f dB\n", bins[ii], levels[ii]);
+ *   }
+ *
+ *   volk_free(dB);
+ *   volk_free(bins);
+ *   volk_free(levels);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_threshold_compress_32u_H
+#define INCLUDED_volk_32f_s32f_threshold_compress_32u_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32f_s32f_threshold_compress_32u_generic(uint32_t* outputIndexes,
+                                             float* outputValues,
+                                             uint32_t* numOutputs,
+                                             const float* inputVector,
+                                             const float threshold,
+                                             unsigned int num_points)
+{
+    uint32_t count = 0;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        if (inputVector[number] > threshold) {
+            outputIndexes[count] = number;
+            outputValues[count] = inputVector[number];
+            count++;
+        }
+    }
+    *numOutputs = count;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void
+volk_32f_s32f_threshold_compress_32u_u_avx(uint32_t* outputIndexes,
+                                           float* outputValues,
+                                           uint32_t* numOutputs,
+                                           const float* inputVector,
+                                           const float threshold,
+                                           unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 thresholdVal = _mm256_set1_ps(threshold);
+    __m256 values;
+    uint32_t count = 0;
+    unsigned int number, lane;
+    int mask;
+
+    for (number = 0; number < eighthPoints * 8; number += 8) {
+        values = _mm256_loadu_ps(inputVector + number);
+        mask = _mm256_movemask_ps(_mm256_cmp_ps(values, thresholdVal, _CMP_GT_OQ));
+        for (lane = 0; mask != 0; lane++, mask >>= 1) {
+            if (mask & 1) {
+                outputIndexes[count] = number + lane;
+                outputValues[count] = inputVector[number + lane];
+                count++;
+            }
+        }
+    }
+
+    for (; number < num_points; number++) {
+        if (inputVector[number] > threshold) {
+            outputIndexes[count] = number;
+            outputValues[count] = inputVector[number];
+            count++;
+        }
+    }
+    *numOutputs = count;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_POPCOUNT
+#include <immintrin.h>
+
+static inline void
+volk_32f_s32f_threshold_compress_32u_u_avx512f(uint32_t* outputIndexes,
+                                               float* outputValues,
+                                               uint32_t* numOutputs,
+                                               const float* inputVector,
+                                               const float threshold,
+                                               unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 thresholdVal = _mm512_set1_ps(threshold);
+    const __m512i indexIncrement = _mm512_set1_epi32(16);
+    __m512i indexes =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m512 values;
+    __mmask16 picked;
+    uint32_t count = 0;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints * 16; number += 16) {
+        values = _mm512_loadu_ps(inputVector + number);
+        picked = _mm512_cmp_ps_mask(values, thresholdVal, _CMP_GT_OQ);
+        _mm512_mask_compressstoreu_epi32(outputIndexes + count, picked, indexes);
+        _mm512_mask_compressstoreu_ps(outputValues + count, picked, values);
+        count += _mm_popcnt_u32(picked);
+        indexes = _mm512_add_epi32(indexes, indexIncrement);
+    }
+
+    for (; number < num_points; number++) {
+        if (inputVector[number] > threshold) {
+            outputIndexes[count] = number;
+            outputValues[count] = inputVector[number];
+            count++;
+        }
+    }
+    *numOutputs = count;
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_POPCOUNT */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_32f_s32f_threshold_compress_32u_neon(uint32_t* outputIndexes,
+                                          float* outputValues,
+                                          uint32_t* numOutputs,
+                                          const float* inputVector,
+                                          const float threshold,
+                                          unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t thresholdVal = vdupq_n_f32(threshold);
+    uint32x4_t picked;
+    uint32x2_t any;
+    uint32_t count = 0;
+    unsigned int number, lane;
+
+    for (number = 0; number < quarterPoints * 4; number += 4) {
+        picked = vcgtq_f32(vld1q_f32(inputVector + number), thresholdVal);
+        any = vorr_u32(vget_low_u32(picked), vget_high_u32(picked));
+        if (vget_lane_u32(vpmax_u32(any, any), 0) == 0) {
+            continue;
+        }
+        for (lane = 0; lane < 4; lane++) {
+            if (inputVector[number + lane] > threshold) {
+                outputIndexes[count] = number + lane;
+                outputValues[count] = inputVector[number + lane];
+                count++;
+            }
+        }
+    }
+
+    for (; number < num_points; number++) {
+        if (inputVector[number] > threshold) {
+            outputIndexes[count] = number;
+            outputValues[count] = inputVector[number];
+            count++;
+        }
+    }
+    *numOutputs = count;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_threshold_compress_32u_H */
@@ -0,0 +1,288 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_s32f_unwrap_32f
+ *
+ * \b Overview
+ *
+ * Unwraps a phase which wraps with the given period, such as the output of
+ * volk_32fc_s32f_atan2_32f, adding to each input the whole periods that keep
+ * it within half a period of the one before:
+ *
+ * turns += floor((previous - inputVector[n]) / period + 1/2)
+ * outputVector[n] = inputVector[n] + turns * period
+ *
+ * The last unwrapped phase is carried from call to call, so a stream cut into
+ * buffers is unwrapped by passing the same variable to every call; the first
+ * input of a call follows it as the others follow their previous input. The
+ * turns are the prefix sum of the wrapped differences, which the SIMD versions
+ * take with a log-step scan of each vector, and stay exact whole numbers.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_unwrap_32f(float* outputVector, const float* inputVector,
+ * const float period, float* lastPhase, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The wrapped phases.
+ * \li period: The period of the wrapping, 2 pi for radians.
+ * \li lastPhase: The phase carried in from the previous buffers; 0 to start
+ * a stream whose first phase is within half a period of 0.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The unwrapped phases.
+ * \li lastPhase: The last unwrapped phase, to carry into the next buffer.
+ *
+ * \b Example
+ * The phase of a tone which turns faster than pi per buffer.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* wrapped = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* phase = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float lastPhase = 0.f;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       wrapped[ii] = remainderf(2.5f * ii, 2.f * M_PI);
+ *   }
+ *
+ *   volk_32f_s32f_unwrap_32f(phase, wrapped, 2.f * M_PI, &lastPhase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("phase[%u] = %1.2f\n", ii, phase[ii]);
+ *   }
+ *
+ *   volk_free(wrapped);
+ *   volk_free(phase);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_unwrap_32f_H
+#define INCLUDED_volk_32f_s32f_unwrap_32f_H
+
+#include <inttypes.h>
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_unwrap_32f_generic(float* outputVector,
+                                                    const float* inputVector,
+                                                    const float period,
+                                                    float* lastPhase,
+                                                    unsigned int num_points)
+{
+    const float invPeriod = 1.f / period;
+    float previous = *lastPhase;
+    float turns = 0.f;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        const float phase = inputVector[number];
+        turns += floorf((previous - phase) * invPeriod + 0.5f);
+        previous = phase;
+        outputVector[number] = phase + turns * period;
+    }
+    if (num_points > 0) {
+        *lastPhase = outputVector[num_points - 1];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_s32f_unwrap_32f_u_avx2(float* outputVector,
+                                                   const float* inputVector,
+                                                   const float period,
+                                                   float* lastPhase,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float invPeriod = 1.f / period;
+    const __m256 periodVal = _mm256_set1_ps(period);
+    const __m256 invPeriodVal = _mm256_set1_ps(invPeriod);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256i rotate = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    const __m256i last = _mm256_set1_epi32(7);
+    // lane 0 holds the phase before the vector, the lanes of the turns are equal
+    __m256 carry = _mm256_set1_ps(*lastPhase);
+    __m256 turns = _mm256_setzero_ps();
+    __m256 phase, rotated, previous, steps;
+    float previousPhase, turnsSum;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        phase = _mm256_loadu_ps(inputVector);
+        rotated = _mm256_permutevar8x32_ps(phase, rotate);
+        previous = _mm256_blend_ps(rotated, carry, 0x01);
+        carry = rotated;
+
+        steps = _mm256_floor_ps(_mm256_add_ps(
+            _mm256_mul_ps(_mm256_sub_ps(previous, phase), invPeriodVal), half));
+        turns = _mm256_add_ps(_mm256_scan_ps(steps), turns);
+        _mm256_storeu_ps(outputVector,
+                         _mm256_add_ps(phase, _mm256_mul_ps(turns, periodVal)));
+        turns = _mm256_permutevar8x32_ps(turns, last);
+
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    previousPhase = _mm256_cvtss_f32(carry);
+    turnsSum = _mm256_cvtss_f32(turns);
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        const float value = *inputVector++;
+        turnsSum += floorf((previousPhase - value) * invPeriod + 0.5f);
+        previousPhase = value;
+        *outputVector++ = value + turnsSum * period;
+    }
+    if (num_points > 0) {
+        *lastPhase = outputVector[-1];
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_s32f_unwrap_32f_u_avx512f(float* outputVector,
+                                                      const float* inputVector,
+                                                      const float period,
+                                                      float* lastPhase,
+                                                      unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float invPeriod = 1.f / period;
+    const __m512 periodVal = _mm512_set1_ps(period);
+    const __m512 invPeriodVal = _mm512_set1_ps(invPeriod);
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512i last = _mm512_set1_epi32(15);
+    // lane 15 holds the phase before the vector, the lanes of the turns are equal
+    __m512 carry = _mm512_set1_ps(*lastPhase);
+    __m512 turns = _mm512_setzero_ps();
+    __m512 phase, previous, steps;
+    float previousPhase, turnsSum;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        phase = _mm512_loadu_ps(inputVector);
+        previous = _mm512_castsi512_ps(_mm512_alignr_epi32(
+            _mm512_castps_si512(phase), _mm512_castps_si512(carry), 15));
+        carry = phase;
+
+        steps = _mm512_roundscale_ps(
+            _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(previous, phase), invPeriodVal),
+                          half),
+            _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        turns = _mm512_add_ps(_mm512_scan_ps(steps), turns);
+        _mm512_storeu_ps(outputVector,
+                         _mm512_add_ps(phase, _mm512_mul_ps(turns, periodVal)));
+        turns = _mm512_permutexvar_ps(last, turns);
+
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    previousPhase = _mm512_cvtss_f32(_mm512_permutexvar_ps(last, carry));
+    turnsSum = _mm512_cvtss_f32(turns);
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        const float value = *inputVector++;
+        turnsSum += floorf((previousPhase - value) * invPeriod + 0.5f);
+        previousPhase = value;
+        *outputVector++ = value + turnsSum * period;
+    }
+    if (num_points > 0) {
+        *lastPhase = outputVector[-1];
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_s32f_unwrap_32f_neon(float* outputVector,
+                                                 const float* inputVector,
+                                                 const float period,
+                                                 float* lastPhase,
+                                                 unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float invPeriod = 1.f / period;
+    const float32x4_t periodVal = vdupq_n_f32(period);
+    const float32x4_t invPeriodVal = vdupq_n_f32(invPeriod);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const uint32x4_t one = vreinterpretq_u32_f32(vdupq_n_f32(1.f));
+    // lane 3 holds the phase before the vector, the lanes of the turns are equal
+    float32x4_t carry = vdupq_n_f32(*lastPhase);
+    float32x4_t turns = vdupq_n_f32(0.f);
+    float32x4_t phase, previous, steps, truncated;
+    float previousPhase, turnsSum;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        phase = vld1q_f32(inputVector);
+        previous = vextq_f32(carry, phase, 3);
+        carry = phase;
+
+        // floor as the truncation less one where that rounded up, which armv7
+        // has no instruction for
+        steps = vaddq_f32(vmulq_f32(vsubq_f32(previous, phase), invPeriodVal), half);
+        truncated = vcvtq_f32_s32(vcvtq_s32_f32(steps));
+        steps = vsubq_f32(
+            truncated,
+            vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(truncated, steps), one)));
+        turns = vaddq_f32(_vscanq_f32(steps), turns);
+        vst1q_f32(outputVector, vaddq_f32(phase, vmulq_f32(turns, periodVal)));
+        turns = vdupq_n_f32(vgetq_lane_f32(turns, 3));
+
+        inputVector += 4;
+        outputVector += 4;
+    }
+
+    previousPhase = vgetq_lane_f32(carry, 3);
+    turnsSum = vgetq_lane_f32(turns, 0);
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        const float value = *inputVector++;
+        turnsSum += floorf((previousPhase - value) * invPeriod + 0.5f);
+        previousPhase = value;
+        *outputVector++ = value + turnsSum * period;
+    }
+    if (num_points > 0) {
+        *lastPhase = outputVector[-1];
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_unwrap_32f_H */
@@ -0,0 +1,194 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_s32f_x2_clamp_32f
+ *
+ * \b Overview
+ *
+ * Clamps each point of the input vector to the range [min, max].
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_x2_clamp_32f(float* out, const float* in, const float min,
+ *                                 const float max, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in: The input vector.
+ * \li min: The lower bound, at most max.
+ * \li max: The upper bound.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li out: The clamped vector.
+ *
+ * \b Example
+ * Clip a ramp to [-0.5, 0.5].
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(int ii = 0; ii < N; ++ii){
+ *       in[ii] = 2.f * ((float)ii / (float)N) - 1.f;
+ *   }
+ *
+ *   volk_32f_s32f_x2_clamp_32f(out, in, -0.5f, 0.5f, N);
+ *
+ *   for(int ii = 0; ii < N; ++ii){
+ *       printf("out[%i] = %f\n", ii, out[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_x2_clamp_32f_H
+#define INCLUDED_volk_32f_s32f_x2_clamp_32f_H
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_x2_clamp_32f_generic(float* out,
+                                                      const float* in,
+                                                      const float min,
+                                                      const float max,
+                                                      unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        const float value = in[number];
+        out[number] = (value > max) ? max : ((value < min) ? min : value);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_s32f_x2_clamp_32f_u_sse(float* out,
+                                                    const float* in,
+                                                    const float min,
+                                                    const float max,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128 vmin = _mm_set1_ps(min);
+    const __m128 vmax = _mm_set1_ps(max);
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        _mm_storeu_ps(out, _mm_max_ps(_mm_min_ps(_mm_loadu_ps(in), vmax), vmin));
+        in += 4;
+        out += 4;
+    }
+
+    volk_32f_s32f_x2_clamp_32f_generic(out, in, min, max, num_points & 3);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_clamp_32f_u_avx(float* out,
+                                                    const float* in,
+                                                    const float min,
+                                                    const float max,
+                                                    unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 vmin = _mm256_set1_ps(min);
+    const __m256 vmax = _mm256_set1_ps(max);
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        _mm256_storeu_ps(out,
+                         _mm256_max_ps(_mm256_min_ps(_mm256_loadu_ps(in), vmax), vmin));
+        in += 8;
+        out += 8;
+    }
+
+    volk_32f_s32f_x2_clamp_32f_generic(out, in, min, max, num_points & 7);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_clamp_32f_u_avx512f(float* out,
+                                                        const float* in,
+                                                        const float min,
+                                                        const float max,
+                                                        unsigned int num_points)
+{
+    const __m512 vmin = _mm512_set1_ps(min);
+    const __m512 vmax = _mm512_set1_ps(max);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += 16) {
+        // the last points with a masked load and store
+        const unsigned int remaining = num_points - number;
+        const __mmask16 mask =
+            _cvtu32_mask16(remaining < 16 ? (1u << remaining) - 1 : 0xffff);
+        const __m512 value = _mm512_maskz_loadu_ps(mask, in + number);
+        _mm512_mask_storeu_ps(
+            out + number, mask, _mm512_max_ps(_mm512_min_ps(value, vmax), vmin));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_x2_clamp_32f_neon(float* out,
+                                                   const float* in,
+                                                   const float min,
+                                                   const float max,
+                                                   unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t vmin = vdupq_n_f32(min);
+    const float32x4_t vmax = vdupq_n_f32(max);
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        vst1q_f32(out, vmaxq_f32(vminq_f32(vld1q_f32(in), vmax), vmin));
+        in += 4;
+        out += 4;
+    }
+
+    volk_32f_s32f_x2_clamp_32f_generic(out, in, min, max, num_points & 3);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_x2_clamp_32f_H */
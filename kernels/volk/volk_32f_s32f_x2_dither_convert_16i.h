@@ -0,0 +1,464 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_s32f_x2_dither_convert_16i
+ *
+ * \b Overview
+ *
+ * Converts floats to 16 bit integers after applying a scaling factor, with
+ * TPDF dither and optional first order noise shaping. It works like
+ * volk_32f_s32f_x2_dither_convert_8i, whose documentation describes the
+ * dither, the shaping and the state, but clips to the 16 bit range.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_x2_dither_convert_16i(int16_t* outputVector, const float*
+ * inputVector, const float scalar, const float shaping, uint32_t* state,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The samples to quantise.
+ * \li scalar: The value multiplied against each point in the input buffer.
+ * \li shaping: The error feedback coefficient, 0 for plain dither to 1.
+ * \li state: VOLK_DITHER_STATE_WORDS words set up by volk_dither_seed().
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The quantised samples.
+ * \li state: The generators and the last error, to carry into the next buffer.
+ *
+ * \b Example
+ * Quantise a buffer of samples in [-1, 1] with plain dither.
+ * \code
+ *   uint32_t state[VOLK_DITHER_STATE_WORDS];
+ *
+ *   volk_dither_seed(state, 1);
+ *   volk_32f_s32f_x2_dither_convert_16i(out, in, 32767.f, 0.f, state, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_x2_dither_convert_16i_H
+#define INCLUDED_volk_32f_s32f_x2_dither_convert_16i_H
+
+#include <inttypes.h>
+#include <volk/volk_32f_s32f_x2_dither_convert_8i.h>
+
+/* Quantises points from generator 0 on. */
+static inline void volk_dither_convert_16i_points(int16_t* outputVector,
+                                                  const float* inputVector,
+                                                  float scalar,
+                                                  float shaping,
+                                                  uint32_t* state,
+                                                  float* error,
+                                                  unsigned int num_points)
+{
+    unsigned int number;
+    float t;
+
+    for (number = 0; number < num_points; number++) {
+        t = volk_dither_point(inputVector[number],
+                              scalar,
+                              shaping,
+                              state + number % VOLK_DITHER_LANES,
+                              error);
+        outputVector[number] = (int16_t)volk_dither_clamp(t, INT16_MIN, INT16_MAX);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_x2_dither_convert_16i_generic(int16_t* outputVector,
+                                                               const float* inputVector,
+                                                               const float scalar,
+                                                               const float shaping,
+                                                               uint32_t* state,
+                                                               unsigned int num_points)
+{
+    float error = volk_dither_get_error(state);
+
+    volk_dither_convert_16i_points(
+        outputVector, inputVector, scalar, shaping, state, &error, num_points);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_dither_convert_16i_a_avx2(int16_t* outputVector,
+                                                              const float* inputVector,
+                                                              const float scalar,
+                                                              const float shaping,
+                                                              uint32_t* state,
+                                                              unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    __VOLK_ATTR_ALIGNED(32) float w_buf[16];
+    __VOLK_ATTR_ALIGNED(32) float d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number, k;
+
+    const __m256 vScalar = _mm256_set1_ps(scalar);
+    const __m256 vmin_val = _mm256_set1_ps(INT16_MIN);
+    const __m256 vmax_val = _mm256_set1_ps(INT16_MAX);
+    const __m256i low16 = _mm256_set1_epi32(0xffff);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256 lsb = _mm256_set1_ps(1.f / 65536.f);
+    const __m256 vone = _mm256_set1_ps(1.f);
+    __m256i r[2], x, q[2];
+    __m256 w[2], d[2];
+
+    r[0] = _mm256_loadu_si256((const __m256i*)state);
+    r[1] = _mm256_loadu_si256((const __m256i*)(state + 8));
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 2; k++) {
+            x = _mm256_xor_si256(r[k], _mm256_slli_epi32(r[k], 13));
+            x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 17));
+            r[k] = _mm256_xor_si256(x, _mm256_slli_epi32(x, 5));
+            x = _mm256_and_si256(r[k], low16);
+            x = _mm256_add_epi32(_mm256_add_epi32(x, _mm256_srli_epi32(r[k], 16)), one);
+            d[k] = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(x), lsb), vone);
+            w[k] = _mm256_mul_ps(_mm256_load_ps(inputVector + 8 * k), vScalar);
+        }
+        if (shaping != 0.f) {
+            for (k = 0; k < 2; k++) {
+                _mm256_store_ps(w_buf + 8 * k, w[k]);
+                _mm256_store_ps(d_buf + 8 * k, d[k]);
+            }
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            for (k = 0; k < 2; k++) {
+                w[k] = _mm256_load_ps(w_buf + 8 * k);
+            }
+        } else {
+            for (k = 0; k < 2; k++) {
+                w[k] = _mm256_add_ps(w[k], d[k]);
+            }
+        }
+        for (k = 0; k < 2; k++) {
+            w[k] = _mm256_max_ps(_mm256_min_ps(w[k], vmax_val), vmin_val);
+            q[k] = _mm256_cvtps_epi32(w[k]);
+        }
+        x = _mm256_permute4x64_epi64(_mm256_packs_epi32(q[0], q[1]), 0xd8);
+        _mm256_store_si256((__m256i*)outputVector, x);
+        inputVector += 16;
+        outputVector += 16;
+    }
+    _mm256_storeu_si256((__m256i*)state, r[0]);
+    _mm256_storeu_si256((__m256i*)(state + 8), r[1]);
+
+    volk_dither_convert_16i_points(outputVector,
+                                   inputVector,
+                                   scalar,
+                                   shaping,
+                                   state,
+                                   &error,
+                                   num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_dither_convert_16i_u_avx2(int16_t* outputVector,
+                                                              const float* inputVector,
+                                                              const float scalar,
+                                                              const float shaping,
+                                                              uint32_t* state,
+                                                              unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    __VOLK_ATTR_ALIGNED(32) float w_buf[16];
+    __VOLK_ATTR_ALIGNED(32) float d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number, k;
+
+    const __m256 vScalar = _mm256_set1_ps(scalar);
+    const __m256 vmin_val = _mm256_set1_ps(INT16_MIN);
+    const __m256 vmax_val = _mm256_set1_ps(INT16_MAX);
+    const __m256i low16 = _mm256_set1_epi32(0xffff);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256 lsb = _mm256_set1_ps(1.f / 65536.f);
+    const __m256 vone = _mm256_set1_ps(1.f);
+    __m256i r[2], x, q[2];
+    __m256 w[2], d[2];
+
+    r[0] = _mm256_loadu_si256((const __m256i*)state);
+    r[1] = _mm256_loadu_si256((const __m256i*)(state + 8));
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 2; k++) {
+            x = _mm256_xor_si256(r[k], _mm256_slli_epi32(r[k], 13));
+            x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 17));
+            r[k] = _mm256_xor_si256(x, _mm256_slli_epi32(x, 5));
+            x = _mm256_and_si256(r[k], low16);
+            x = _mm256_add_epi32(_mm256_add_epi32(x, _mm256_srli_epi32(r[k], 16)), one);
+            d[k] = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(x), lsb), vone);
+            w[k] = _mm256_mul_ps(_mm256_loadu_ps(inputVector + 8 * k), vScalar);
+        }
+        if (shaping != 0.f) {
+            for (k = 0; k < 2; k++) {
+                _mm256_store_ps(w_buf + 8 * k, w[k]);
+                _mm256_store_ps(d_buf + 8 * k, d[k]);
+            }
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            for (k = 0; k < 2; k++) {
+                w[k] = _mm256_load_ps(w_buf + 8 * k);
+            }
+        } else {
+            for (k = 0; k < 2; k++) {
+                w[k] = _mm256_add_ps(w[k], d[k]);
+            }
+        }
+        for (k = 0; k < 2; k++) {
+            w[k] = _mm256_max_ps(_mm256_min_ps(w[k], vmax_val), vmin_val);
+            q[k] = _mm256_cvtps_epi32(w[k]);
+        }
+        x = _mm256_permute4x64_epi64(_mm256_packs_epi32(q[0], q[1]), 0xd8);
+        _mm256_storeu_si256((__m256i*)outputVector, x);
+        inputVector += 16;
+        outputVector += 16;
+    }
+    _mm256_storeu_si256((__m256i*)state, r[0]);
+    _mm256_storeu_si256((__m256i*)(state + 8), r[1]);
+
+    volk_dither_convert_16i_points(outputVector,
+                                   inputVector,
+                                   scalar,
+                                   shaping,
+                                   state,
+                                   &error,
+                                   num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_s32f_x2_dither_convert_16i_a_avx512f(int16_t* outputVector,
+                                              const float* inputVector,
+                                              const float scalar,
+                                              const float shaping,
+                                              uint32_t* state,
+                                              unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    __VOLK_ATTR_ALIGNED(64) float w_buf[16];
+    __VOLK_ATTR_ALIGNED(64) float d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number;
+
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(INT16_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(INT16_MAX);
+    const __m512i low16 = _mm512_set1_epi32(0xffff);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512 lsb = _mm512_set1_ps(1.f / 65536.f);
+    const __m512 vone = _mm512_set1_ps(1.f);
+    __m512i r, x, q;
+    __m512 w, d;
+
+    r = _mm512_loadu_si512(state);
+    for (number = 0; number < sixteenth_points; number++) {
+        x = _mm512_xor_si512(r, _mm512_slli_epi32(r, 13));
+        x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 17));
+        r = _mm512_xor_si512(x, _mm512_slli_epi32(x, 5));
+        x = _mm512_and_si512(r, low16);
+        x = _mm512_add_epi32(_mm512_add_epi32(x, _mm512_srli_epi32(r, 16)), one);
+        d = _mm512_sub_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(x), lsb), vone);
+        w = _mm512_mul_ps(_mm512_load_ps(inputVector), vScalar);
+        if (shaping != 0.f) {
+            _mm512_store_ps(w_buf, w);
+            _mm512_store_ps(d_buf, d);
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            w = _mm512_load_ps(w_buf);
+        } else {
+            w = _mm512_add_ps(w, d);
+        }
+        q = _mm512_cvtps_epi32(_mm512_max_ps(_mm512_min_ps(w, vmax_val), vmin_val));
+        _mm256_store_si256((__m256i*)outputVector, _mm512_cvtepi32_epi16(q));
+        inputVector += 16;
+        outputVector += 16;
+    }
+    _mm512_storeu_si512(state, r);
+
+    volk_dither_convert_16i_points(outputVector,
+                                   inputVector,
+                                   scalar,
+                                   shaping,
+                                   state,
+                                   &error,
+                                   num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_s32f_x2_dither_convert_16i_u_avx512f(int16_t* outputVector,
+                                              const float* inputVector,
+                                              const float scalar,
+                                              const float shaping,
+                                              uint32_t* state,
+                                              unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    __VOLK_ATTR_ALIGNED(64) float w_buf[16];
+    __VOLK_ATTR_ALIGNED(64) float d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number;
+
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(INT16_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(INT16_MAX);
+    const __m512i low16 = _mm512_set1_epi32(0xffff);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512 lsb = _mm512_set1_ps(1.f / 65536.f);
+    const __m512 vone = _mm512_set1_ps(1.f);
+    __m512i r, x, q;
+    __m512 w, d;
+
+    r = _mm512_loadu_si512(state);
+    for (number = 0; number < sixteenth_points; number++) {
+        x = _mm512_xor_si512(r, _mm512_slli_epi32(r, 13));
+        x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 17));
+        r = _mm512_xor_si512(x, _mm512_slli_epi32(x, 5));
+        x = _mm512_and_si512(r, low16);
+        x = _mm512_add_epi32(_mm512_add_epi32(x, _mm512_srli_epi32(r, 16)), one);
+        d = _mm512_sub_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(x), lsb), vone);
+        w = _mm512_mul_ps(_mm512_loadu_ps(inputVector), vScalar);
+        if (shaping != 0.f) {
+            _mm512_store_ps(w_buf, w);
+            _mm512_store_ps(d_buf, d);
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            w = _mm512_load_ps(w_buf);
+        } else {
+            w = _mm512_add_ps(w, d);
+        }
+        q = _mm512_cvtps_epi32(_mm512_max_ps(_mm512_min_ps(w, vmax_val), vmin_val));
+        _mm256_storeu_si256((__m256i*)outputVector, _mm512_cvtepi32_epi16(q));
+        inputVector += 16;
+        outputVector += 16;
+    }
+    _mm512_storeu_si512(state, r);
+
+    volk_dither_convert_16i_points(outputVector,
+                                   inputVector,
+                                   scalar,
+                                   shaping,
+                                   state,
+                                   &error,
+                                   num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_x2_dither_convert_16i_neonv8(int16_t* outputVector,
+                                                              const float* inputVector,
+                                                              const float scalar,
+                                                              const float shaping,
+                                                              uint32_t* state,
+                                                              unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    float w_buf[16], d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number, k;
+
+    const float32x4_t vScalar = vdupq_n_f32(scalar);
+    const uint32x4_t low16 = vdupq_n_u32(0xffff);
+    const uint32x4_t one = vdupq_n_u32(1);
+    const float32x4_t lsb = vdupq_n_f32(1.f / 65536.f);
+    const float32x4_t vone = vdupq_n_f32(1.f);
+    uint32x4_t r[4], x;
+    float32x4_t w[4], d[4];
+    int32x4_t q[4];
+
+    for (k = 0; k < 4; k++) {
+        r[k] = vld1q_u32(state + 4 * k);
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 4; k++) {
+            x = veorq_u32(r[k], vshlq_n_u32(r[k], 13));
+            x = veorq_u32(x, vshrq_n_u32(x, 17));
+            r[k] = veorq_u32(x, vshlq_n_u32(x, 5));
+            x = vaddq_u32(vaddq_u32(vandq_u32(r[k], low16), vshrq_n_u32(r[k], 16)), one);
+            d[k] = vsubq_f32(vmulq_f32(vcvtq_f32_u32(x), lsb), vone);
+            w[k] = vmulq_f32(vld1q_f32(inputVector + 4 * k), vScalar);
+        }
+        if (shaping != 0.f) {
+            for (k = 0; k < 4; k++) {
+                vst1q_f32(w_buf + 4 * k, w[k]);
+                vst1q_f32(d_buf + 4 * k, d[k]);
+            }
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            for (k = 0; k < 4; k++) {
+                w[k] = vld1q_f32(w_buf + 4 * k);
+            }
+        } else {
+            for (k = 0; k < 4; k++) {
+                w[k] = vaddq_f32(w[k], d[k]);
+            }
+        }
+        // the conversion and the narrowing saturate, which is the clamping
+        for (k = 0; k < 4; k++) {
+            q[k] = vcvtnq_s32_f32(w[k]);
+        }
+        vst1q_s16(outputVector, vcombine_s16(vqmovn_s32(q[0]), vqmovn_s32(q[1])));
+        vst1q_s16(outputVector + 8, vcombine_s16(vqmovn_s32(q[2]), vqmovn_s32(q[3])));
+        inputVector += 16;
+        outputVector += 16;
+    }
+    for (k = 0; k < 4; k++) {
+        vst1q_u32(state + 4 * k, r[k]);
+    }
+
+    volk_dither_convert_16i_points(outputVector,
+                                   inputVector,
+                                   scalar,
+                                   shaping,
+                                   state,
+                                   &error,
+                                   num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_s32f_x2_dither_convert_16i_H */
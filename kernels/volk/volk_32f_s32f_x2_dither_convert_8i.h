@@ -0,0 +1,590 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_s32f_x2_dither_convert_8i
+ *
+ * \b Overview
+ *
+ * Converts floats to 8 bit integers after applying a scaling factor, like
+ * volk_32f_s32f_convert_8i, but adds triangular (TPDF) dither of -1 to 1 LSB
+ * before rounding, which makes the quantisation error independent of the
+ * signal, and optionally shapes the error with a first order feedback:
+ *
+ * v[n] = scalar * inputVector[n] - shaping * e[n - 1]
+ * outputVector[n] = clamp(rint(v[n] + d[n]))
+ * e[n] = rint(v[n] + d[n]) - v[n]
+ *
+ * A shaping of 1 gives the error the highpass response 1 - z^-1, moving it
+ * out of the low frequencies. The error is taken before clipping, so
+ * overload does not upset the feedback.
+ *
+ * The dither comes from 16 xorshift32 generators in the state; point n of a
+ * call takes the next word of generator n % 16 and adds its two 16 bit
+ * halves. The SIMD versions run the generators in their lanes and give the
+ * same points as the generic version; with shaping they quantise each
+ * vector in a scalar pass, as the feedback is sequential. A compiler which
+ * fuses the multiplications and additions of the shaping may make their
+ * points differ by 1 here and there.
+ *
+ * The generators and the last error are carried from call to call in the
+ * state, so a stream cut into buffers is quantised by passing the same state
+ * to every call. A call with a shaping of 0 leaves an error of 0.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_x2_dither_convert_8i(int8_t* outputVector, const float*
+ * inputVector, const float scalar, const float shaping, uint32_t* state,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The samples to quantise.
+ * \li scalar: The value multiplied against each point in the input buffer.
+ * \li shaping: The error feedback coefficient, 0 for plain dither to 1.
+ * \li state: VOLK_DITHER_STATE_WORDS words set up by volk_dither_seed().
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The quantised samples.
+ * \li state: The generators and the last error, to carry into the next buffer.
+ *
+ * \b Example
+ * Archive a baseband stream in 8 bits, the noise shaped out of the band.
+ * \code
+ *   uint32_t state[VOLK_DITHER_STATE_WORDS];
+ *
+ *   volk_dither_seed(state, 1);
+ *   while (read_samples(in, N)) {
+ *       volk_32f_s32f_x2_dither_convert_8i(out, in, 100.f, 1.f, state, N);
+ *       write_samples(out, N);
+ *   }
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_x2_dither_convert_8i_H
+#define INCLUDED_volk_32f_s32f_x2_dither_convert_8i_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+/* The number of generators, which is also the points of a SIMD block. */
+#define VOLK_DITHER_LANES 16
+/* The words of a state: the generators, then the bits of the last error. */
+#define VOLK_DITHER_STATE_WORDS (VOLK_DITHER_LANES + 1)
+
+/* Seeds the generators of state from seed, with an error of 0. */
+static inline void volk_dither_seed(uint32_t* state, uint32_t seed)
+{
+    uint32_t z;
+    unsigned int lane;
+
+    for (lane = 0; lane < VOLK_DITHER_LANES; lane++) {
+        // the finaliser of MurmurHash3 spreads seeds which differ in few bits
+        z = seed + 0x9e3779b9u * (lane + 1);
+        z = (z ^ (z >> 16)) * 0x85ebca6bu;
+        z = (z ^ (z >> 13)) * 0xc2b2ae35u;
+        z ^= z >> 16;
+        state[lane] = z ? z : 1;
+    }
+    state[VOLK_DITHER_LANES] = 0;
+}
+
+static inline uint32_t volk_dither_xorshift(uint32_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+/*
+ * The dither of a generator word: the sum of its halves plus 1 is triangular
+ * from 1 to 131071 around 65536, so the dither has a mean of 0; it and its
+ * scaling are exact in floats.
+ */
+static inline float volk_dither_tpdf(uint32_t x)
+{
+    return (float)(int32_t)((x & 0xffff) + (x >> 16) + 1) * (1.f / 65536.f) - 1.f;
+}
+
+static inline float volk_dither_get_error(const uint32_t* state)
+{
+    float error;
+
+    memcpy(&error, state + VOLK_DITHER_LANES, sizeof(error));
+    return error;
+}
+
+static inline void volk_dither_set_error(uint32_t* state, float error)
+{
+    memcpy(state + VOLK_DITHER_LANES, &error, sizeof(error));
+}
+
+/* Quantises the scaled point w with dither d, updating the error. */
+static inline float volk_dither_step(float w, float d, float shaping, float* error)
+{
+    const float v = w - shaping * *error;
+    const float t = rintf(v + d);
+
+    *error = t - v;
+    return t;
+}
+
+/*
+ * Quantises the points of a SIMD block, w scaled and d their dither, in
+ * place into w.
+ */
+static inline void
+volk_dither_shape(float* w, const float* d, float shaping, float* error)
+{
+    unsigned int k;
+
+    for (k = 0; k < VOLK_DITHER_LANES; k++) {
+        w[k] = volk_dither_step(w[k], d[k], shaping, error);
+    }
+}
+
+/*
+ * Quantises the point x with generator lane of the state. The SIMD versions
+ * round the scaled point before shaping it, so it is rounded here too: a
+ * volatile, since GCC would otherwise fuse the scaling into the shaping
+ * across statements, and the shaped error would then drift from theirs.
+ */
+static inline float volk_dither_point(
+    float x, float scalar, float shaping, uint32_t* lane, float* error)
+{
+    volatile float w = x * scalar;
+
+    *lane = volk_dither_xorshift(*lane);
+    return volk_dither_step(w, volk_dither_tpdf(*lane), shaping, error);
+}
+
+static inline float volk_dither_clamp(float t, float min_val, float max_val)
+{
+    return t > max_val ? max_val : (t < min_val ? min_val : t);
+}
+
+/* Quantises points from generator 0 on. */
+static inline void volk_dither_convert_8i_points(int8_t* outputVector,
+                                                 const float* inputVector,
+                                                 float scalar,
+                                                 float shaping,
+                                                 uint32_t* state,
+                                                 float* error,
+                                                 unsigned int num_points)
+{
+    unsigned int number;
+    float t;
+
+    for (number = 0; number < num_points; number++) {
+        t = volk_dither_point(inputVector[number],
+                              scalar,
+                              shaping,
+                              state + number % VOLK_DITHER_LANES,
+                              error);
+        outputVector[number] = (int8_t)volk_dither_clamp(t, INT8_MIN, INT8_MAX);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_x2_dither_convert_8i_generic(int8_t* outputVector,
+                                                              const float* inputVector,
+                                                              const float scalar,
+                                                              const float shaping,
+                                                              uint32_t* state,
+                                                              unsigned int num_points)
+{
+    float error = volk_dither_get_error(state);
+
+    volk_dither_convert_8i_points(
+        outputVector, inputVector, scalar, shaping, state, &error, num_points);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_dither_convert_8i_a_avx2(int8_t* outputVector,
+                                                             const float* inputVector,
+                                                             const float scalar,
+                                                             const float shaping,
+                                                             uint32_t* state,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    __VOLK_ATTR_ALIGNED(32) float w_buf[16];
+    __VOLK_ATTR_ALIGNED(32) float d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number, k;
+
+    const __m256 vScalar = _mm256_set1_ps(scalar);
+    const __m256 vmin_val = _mm256_set1_ps(INT8_MIN);
+    const __m256 vmax_val = _mm256_set1_ps(INT8_MAX);
+    const __m256i low16 = _mm256_set1_epi32(0xffff);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256 lsb = _mm256_set1_ps(1.f / 65536.f);
+    const __m256 vone = _mm256_set1_ps(1.f);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    __m256i r[2], x, q[2];
+    __m256 w[2], d[2];
+
+    r[0] = _mm256_loadu_si256((const __m256i*)state);
+    r[1] = _mm256_loadu_si256((const __m256i*)(state + 8));
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 2; k++) {
+            x = _mm256_xor_si256(r[k], _mm256_slli_epi32(r[k], 13));
+            x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 17));
+            r[k] = _mm256_xor_si256(x, _mm256_slli_epi32(x, 5));
+            x = _mm256_and_si256(r[k], low16);
+            x = _mm256_add_epi32(_mm256_add_epi32(x, _mm256_srli_epi32(r[k], 16)), one);
+            d[k] = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(x), lsb), vone);
+            w[k] = _mm256_mul_ps(_mm256_load_ps(inputVector + 8 * k), vScalar);
+        }
+        if (shaping != 0.f) {
+            for (k = 0; k < 2; k++) {
+                _mm256_store_ps(w_buf + 8 * k, w[k]);
+                _mm256_store_ps(d_buf + 8 * k, d[k]);
+            }
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            for (k = 0; k < 2; k++) {
+                w[k] = _mm256_load_ps(w_buf + 8 * k);
+            }
+        } else {
+            for (k = 0; k < 2; k++) {
+                w[k] = _mm256_add_ps(w[k], d[k]);
+            }
+        }
+        for (k = 0; k < 2; k++) {
+            w[k] = _mm256_max_ps(_mm256_min_ps(w[k], vmax_val), vmin_val);
+            q[k] = _mm256_cvtps_epi32(w[k]);
+        }
+        x = _mm256_packs_epi32(q[0], q[1]);
+        x = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(x, x), order);
+        _mm_store_si128((__m128i*)outputVector, _mm256_castsi256_si128(x));
+        inputVector += 16;
+        outputVector += 16;
+    }
+    _mm256_storeu_si256((__m256i*)state, r[0]);
+    _mm256_storeu_si256((__m256i*)(state + 8), r[1]);
+
+    volk_dither_convert_8i_points(outputVector,
+                                  inputVector,
+                                  scalar,
+                                  shaping,
+                                  state,
+                                  &error,
+                                  num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_dither_convert_8i_u_avx2(int8_t* outputVector,
+                                                             const float* inputVector,
+                                                             const float scalar,
+                                                             const float shaping,
+                                                             uint32_t* state,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    __VOLK_ATTR_ALIGNED(32) float w_buf[16];
+    __VOLK_ATTR_ALIGNED(32) float d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number, k;
+
+    const __m256 vScalar = _mm256_set1_ps(scalar);
+    const __m256 vmin_val = _mm256_set1_ps(INT8_MIN);
+    const __m256 vmax_val = _mm256_set1_ps(INT8_MAX);
+    const __m256i low16 = _mm256_set1_epi32(0xffff);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256 lsb = _mm256_set1_ps(1.f / 65536.f);
+    const __m256 vone = _mm256_set1_ps(1.f);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    __m256i r[2], x, q[2];
+    __m256 w[2], d[2];
+
+    r[0] = _mm256_loadu_si256((const __m256i*)state);
+    r[1] = _mm256_loadu_si256((const __m256i*)(state + 8));
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 2; k++) {
+            x = _mm256_xor_si256(r[k], _mm256_slli_epi32(r[k], 13));
+            x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 17));
+            r[k] = _mm256_xor_si256(x, _mm256_slli_epi32(x, 5));
+            x = _mm256_and_si256(r[k], low16);
+            x = _mm256_add_epi32(_mm256_add_epi32(x, _mm256_srli_epi32(r[k], 16)), one);
+            d[k] = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(x), lsb), vone);
+            w[k] = _mm256_mul_ps(_mm256_loadu_ps(inputVector + 8 * k), vScalar);
+        }
+        if (shaping != 0.f) {
+            for (k = 0; k < 2; k++) {
+                _mm256_store_ps(w_buf + 8 * k, w[k]);
+                _mm256_store_ps(d_buf + 8 * k, d[k]);
+            }
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            for (k = 0; k < 2; k++) {
+                w[k] = _mm256_load_ps(w_buf + 8 * k);
+            }
+        } else {
+            for (k = 0; k < 2; k++) {
+                w[k] = _mm256_add_ps(w[k], d[k]);
+            }
+        }
+        for (k = 0; k < 2; k++) {
+            w[k] = _mm256_max_ps(_mm256_min_ps(w[k], vmax_val), vmin_val);
+            q[k] = _mm256_cvtps_epi32(w[k]);
+        }
+        x = _mm256_packs_epi32(q[0], q[1]);
+        x = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(x, x), order);
+        _mm_storeu_si128((__m128i*)outputVector, _mm256_castsi256_si128(x));
+        inputVector += 16;
+        outputVector += 16;
+    }
+    _mm256_storeu_si256((__m256i*)state, r[0]);
+    _mm256_storeu_si256((__m256i*)(state + 8), r[1]);
+
+    volk_dither_convert_8i_points(outputVector,
+                                  inputVector,
+                                  scalar,
+                                  shaping,
+                                  state,
+                                  &error,
+                                  num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_dither_convert_8i_a_avx512f(int8_t* outputVector,
+                                                                const float* inputVector,
+                                                                const float scalar,
+                                                                const float shaping,
+                                                                uint32_t* state,
+                                                                unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    __VOLK_ATTR_ALIGNED(64) float w_buf[16];
+    __VOLK_ATTR_ALIGNED(64) float d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number;
+
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(INT8_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(INT8_MAX);
+    const __m512i low16 = _mm512_set1_epi32(0xffff);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512 lsb = _mm512_set1_ps(1.f / 65536.f);
+    const __m512 vone = _mm512_set1_ps(1.f);
+    __m512i r, x, q;
+    __m512 w, d;
+
+    r = _mm512_loadu_si512(state);
+    for (number = 0; number < sixteenth_points; number++) {
+        x = _mm512_xor_si512(r, _mm512_slli_epi32(r, 13));
+        x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 17));
+        r = _mm512_xor_si512(x, _mm512_slli_epi32(x, 5));
+        x = _mm512_and_si512(r, low16);
+        x = _mm512_add_epi32(_mm512_add_epi32(x, _mm512_srli_epi32(r, 16)), one);
+        d = _mm512_sub_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(x), lsb), vone);
+        w = _mm512_mul_ps(_mm512_load_ps(inputVector), vScalar);
+        if (shaping != 0.f) {
+            _mm512_store_ps(w_buf, w);
+            _mm512_store_ps(d_buf, d);
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            w = _mm512_load_ps(w_buf);
+        } else {
+            w = _mm512_add_ps(w, d);
+        }
+        q = _mm512_cvtps_epi32(_mm512_max_ps(_mm512_min_ps(w, vmax_val), vmin_val));
+        _mm_store_si128((__m128i*)outputVector, _mm512_cvtepi32_epi8(q));
+        inputVector += 16;
+        outputVector += 16;
+    }
+    _mm512_storeu_si512(state, r);
+
+    volk_dither_convert_8i_points(outputVector,
+                                  inputVector,
+                                  scalar,
+                                  shaping,
+                                  state,
+                                  &error,
+                                  num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_dither_convert_8i_u_avx512f(int8_t* outputVector,
+                                                                const float* inputVector,
+                                                                const float scalar,
+                                                                const float shaping,
+                                                                uint32_t* state,
+                                                                unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    __VOLK_ATTR_ALIGNED(64) float w_buf[16];
+    __VOLK_ATTR_ALIGNED(64) float d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number;
+
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(INT8_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(INT8_MAX);
+    const __m512i low16 = _mm512_set1_epi32(0xffff);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512 lsb = _mm512_set1_ps(1.f / 65536.f);
+    const __m512 vone = _mm512_set1_ps(1.f);
+    __m512i r, x, q;
+    __m512 w, d;
+
+    r = _mm512_loadu_si512(state);
+    for (number = 0; number < sixteenth_points; number++) {
+        x = _mm512_xor_si512(r, _mm512_slli_epi32(r, 13));
+        x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 17));
+        r = _mm512_xor_si512(x, _mm512_slli_epi32(x, 5));
+        x = _mm512_and_si512(r, low16);
+        x = _mm512_add_epi32(_mm512_add_epi32(x, _mm512_srli_epi32(r, 16)), one);
+        d = _mm512_sub_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(x), lsb), vone);
+        w = _mm512_mul_ps(_mm512_loadu_ps(inputVector), vScalar);
+        if (shaping != 0.f) {
+            _mm512_store_ps(w_buf, w);
+            _mm512_store_ps(d_buf, d);
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            w = _mm512_load_ps(w_buf);
+        } else {
+            w = _mm512_add_ps(w, d);
+        }
+        q = _mm512_cvtps_epi32(_mm512_max_ps(_mm512_min_ps(w, vmax_val), vmin_val));
+        _mm_storeu_si128((__m128i*)outputVector, _mm512_cvtepi32_epi8(q));
+        inputVector += 16;
+        outputVector += 16;
+    }
+    _mm512_storeu_si512(state, r);
+
+    volk_dither_convert_8i_points(outputVector,
+                                  inputVector,
+                                  scalar,
+                                  shaping,
+                                  state,
+                                  &error,
+                                  num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_x2_dither_convert_8i_neonv8(int8_t* outputVector,
+                                                             const float* inputVector,
+                                                             const float scalar,
+                                                             const float shaping,
+                                                             uint32_t* state,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    float w_buf[16], d_buf[16];
+    float error = volk_dither_get_error(state);
+    unsigned int number, k;
+
+    const float32x4_t vScalar = vdupq_n_f32(scalar);
+    const uint32x4_t low16 = vdupq_n_u32(0xffff);
+    const uint32x4_t one = vdupq_n_u32(1);
+    const float32x4_t lsb = vdupq_n_f32(1.f / 65536.f);
+    const float32x4_t vone = vdupq_n_f32(1.f);
+    uint32x4_t r[4], x;
+    float32x4_t w[4], d[4];
+    int32x4_t q[4];
+    int16x8_t h0, h1;
+
+    for (k = 0; k < 4; k++) {
+        r[k] = vld1q_u32(state + 4 * k);
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 4; k++) {
+            x = veorq_u32(r[k], vshlq_n_u32(r[k], 13));
+            x = veorq_u32(x, vshrq_n_u32(x, 17));
+            r[k] = veorq_u32(x, vshlq_n_u32(x, 5));
+            x = vaddq_u32(vaddq_u32(vandq_u32(r[k], low16), vshrq_n_u32(r[k], 16)), one);
+            d[k] = vsubq_f32(vmulq_f32(vcvtq_f32_u32(x), lsb), vone);
+            w[k] = vmulq_f32(vld1q_f32(inputVector + 4 * k), vScalar);
+        }
+        if (shaping != 0.f) {
+            for (k = 0; k < 4; k++) {
+                vst1q_f32(w_buf + 4 * k, w[k]);
+                vst1q_f32(d_buf + 4 * k, d[k]);
+            }
+            volk_dither_shape(w_buf, d_buf, shaping, &error);
+            for (k = 0; k < 4; k++) {
+                w[k] = vld1q_f32(w_buf + 4 * k);
+            }
+        } else {
+            for (k = 0; k < 4; k++) {
+                w[k] = vaddq_f32(w[k], d[k]);
+            }
+        }
+        // the conversion and the narrowing saturate, which is the clamping
+        for (k = 0; k < 4; k++) {
+            q[k] = vcvtnq_s32_f32(w[k]);
+        }
+        h0 = vcombine_s16(vqmovn_s32(q[0]), vqmovn_s32(q[1]));
+        h1 = vcombine_s16(vqmovn_s32(q[2]), vqmovn_s32(q[3]));
+        vst1q_s8(outputVector, vcombine_s8(vqmovn_s16(h0), vqmovn_s16(h1)));
+        inputVector += 16;
+        outputVector += 16;
+    }
+    for (k = 0; k < 4; k++) {
+        vst1q_u32(state + 4 * k, r[k]);
+    }
+
+    volk_dither_convert_8i_points(outputVector,
+                                  inputVector,
+                                  scalar,
+                                  shaping,
+                                  state,
+                                  &error,
+                                  num_points - sixteenth_points * 16);
+    volk_dither_set_error(state, shaping != 0.f ? error : 0.f);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_s32f_x2_dither_convert_8i_H */
@@ -0,0 +1,225 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_s32f_x2_histogram_32u
+ *
+ * \b Overview
+ *
+ * Counts a vector of floats into a histogram of num_bins equal bins spanning
+ * [lower, upper). Values below lower count in the first bin and values from
+ * upper on in the last one; NaNs are not counted. The counts are added to the
+ * histogram, so zero it before the first call and keep adding the following
+ * buffers to it.
+ *
+ * The bin of x is (x - lower) * (num_bins / (upper - lower)), truncated, so a
+ * value within a rounding error of a bin edge may count in either bin next to
+ * it; every version computes the same bins as the generic one.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_x2_histogram_32u(uint32_t* histogram, const float* inputVector,
+ * const float lower, const float upper, unsigned int num_bins, unsigned int
+ * num_points) \endcode
+ *
+ * \b Inputs
+ * \li histogram: The num_bins counts to add to.
+ * \li inputVector: The samples.
+ * \li lower: The lower edge of the first bin.
+ * \li upper: The upper edge of the last bin, greater than lower.
+ * \li num_bins: The number of bins, at least 1 and at most 2^24.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li histogram: The counts, with those of the samples added.
+ *
+ * \b Example
+ * The distribution of the amplitudes of a block of samples, in 100 bins of
+ * 0.01.
+ * \code
+ *   uint32_t histogram[100] = { 0 };
+ *
+ *   volk_32fc_magnitude_32f(amplitude, samples, N);
+ *   volk_32f_s32f_x2_histogram_32u(histogram, amplitude, 0.f, 1.f, 100, N);
+ *
+ *   for(unsigned int ii = 0; ii < 100; ++ii){
+ *       printf("%4.2f %u\n", 0.01f * ii, histogram[ii]);
+ *   }
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_x2_histogram_32u_H
+#define INCLUDED_volk_32f_s32f_x2_histogram_32u_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_x2_histogram_32u_generic(uint32_t* histogram,
+                                                          const float* inputVector,
+                                                          const float lower,
+                                                          const float upper,
+                                                          unsigned int num_bins,
+                                                          unsigned int num_points)
+{
+    const float scale = (float)num_bins / (upper - lower);
+    const float last = (float)(num_bins - 1);
+    unsigned int number;
+    float v;
+
+    for (number = 0; number < num_points; number++) {
+        if (inputVector[number] != inputVector[number]) {
+            continue;
+        }
+        v = (inputVector[number] - lower) * scale;
+        v = v > 0.f ? v : 0.f;
+        v = v < last ? v : last;
+        histogram[(int32_t)v]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_histogram_32u_avx2(uint32_t* histogram,
+                                                       const float* inputVector,
+                                                       const float lower,
+                                                       const float upper,
+                                                       unsigned int num_bins,
+                                                       unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const float scale = (float)num_bins / (upper - lower);
+    const __m256 lowerVal = _mm256_set1_ps(lower);
+    const __m256 scaleVal = _mm256_set1_ps(scale);
+    const __m256 lastVal = _mm256_set1_ps((float)(num_bins - 1));
+    const __m256i skip = _mm256_set1_epi32(-1);
+    __VOLK_ATTR_ALIGNED(32) int32_t bins[8];
+    __m256 x, v, ordered;
+    unsigned int number, lane;
+
+    for (number = 0; number < eighth_points; number++) {
+        x = _mm256_loadu_ps(inputVector);
+        ordered = _mm256_cmp_ps(x, x, _CMP_ORD_Q);
+        v = _mm256_mul_ps(_mm256_sub_ps(x, lowerVal), scaleVal);
+        v = _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), lastVal);
+        // NaNs get bin -1, which is not counted
+        _mm256_store_si256((__m256i*)bins,
+                           _mm256_blendv_epi8(skip,
+                                              _mm256_cvttps_epi32(v),
+                                              _mm256_castps_si256(ordered)));
+        for (lane = 0; lane < 8; lane++) {
+            if (bins[lane] >= 0) {
+                histogram[bins[lane]]++;
+            }
+        }
+        inputVector += 8;
+    }
+
+    volk_32f_s32f_x2_histogram_32u_generic(
+        histogram, inputVector, lower, upper, num_bins, num_points - number * 8);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_s32f_x2_histogram_32u_avx512cd(uint32_t* histogram,
+                                                           const float* inputVector,
+                                                           const float lower,
+                                                           const float upper,
+                                                           unsigned int num_bins,
+                                                           unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const float scale = (float)num_bins / (upper - lower);
+    const __m512 lowerVal = _mm512_set1_ps(lower);
+    const __m512 scaleVal = _mm512_set1_ps(scale);
+    const __m512 lastVal = _mm512_set1_ps((float)(num_bins - 1));
+    __m512 x, v;
+    __mmask16 ordered;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        x = _mm512_loadu_ps(inputVector);
+        ordered = _mm512_cmp_ps_mask(x, x, _CMP_ORD_Q);
+        v = _mm512_mul_ps(_mm512_sub_ps(x, lowerVal), scaleVal);
+        v = _mm512_min_ps(_mm512_max_ps(v, _mm512_setzero_ps()), lastVal);
+        _mm512_mask_histogram_add_epi32(histogram, ordered, _mm512_cvttps_epi32(v));
+        inputVector += 16;
+    }
+
+    volk_32f_s32f_x2_histogram_32u_generic(
+        histogram, inputVector, lower, upper, num_bins, num_points - number * 16);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_x2_histogram_32u_neon(uint32_t* histogram,
+                                                       const float* inputVector,
+                                                       const float lower,
+                                                       const float upper,
+                                                       unsigned int num_bins,
+                                                       unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const float scale = (float)num_bins / (upper - lower);
+    const float32x4_t lowerVal = vdupq_n_f32(lower);
+    const float32x4_t lastVal = vdupq_n_f32((float)(num_bins - 1));
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    int32_t bins[4];
+    float32x4_t x, v;
+    uint32x4_t ordered;
+    unsigned int number, lane;
+
+    for (number = 0; number < quarter_points; number++) {
+        x = vld1q_f32(inputVector);
+        ordered = vceqq_f32(x, x);
+        v = vmulq_n_f32(vsubq_f32(x, lowerVal), scale);
+        v = vminq_f32(vmaxq_f32(v, zero), lastVal);
+        // NaNs get bin -1, which is not counted
+        vst1q_s32(bins, vornq_s32(vcvtq_s32_f32(v), vreinterpretq_s32_u32(ordered)));
+        for (lane = 0; lane < 4; lane++) {
+            if (bins[lane] >= 0) {
+                histogram[bins[lane]]++;
+            }
+        }
+        inputVector += 4;
+    }
+
+    volk_32f_s32f_x2_histogram_32u_generic(
+        histogram, inputVector, lower, upper, num_bins, num_points - number * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_x2_histogram_32u_H */
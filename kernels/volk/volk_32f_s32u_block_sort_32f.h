@@ -0,0 +1,250 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_s32u_block_sort_32f
+ *
+ * \b Overview
+ *
+ * Sorts each block of length consecutive points into ascending order, e.g.
+ * to take order statistics of many short windows at once.
+ *
+ * The SIMD versions sort eight or sixteen blocks at a time, one per lane,
+ * with a bitonic network of min and max operations over the points of the
+ * blocks transposed into vectors and padded with infinities up to a power of
+ * two. As they only move points, the results are the same as those of the
+ * generic version for inputs without NaN.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32u_block_sort_32f(float* outputVector, const float* inputVector,
+ * const unsigned int length, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The points to sort. It may be the same as outputVector.
+ * \li length: The number of points in a block, 1 to 32.
+ * \li num_points: The number of points. If it is not a multiple of length,
+ * the points after the last whole block are sorted as a shorter block.
+ *
+ * \b Outputs
+ * \li outputVector: The sorted blocks.
+ *
+ * \b Example
+ * Sort blocks of 8 points.
+ * \code
+ *   int N = 64;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = (float)((ii * 5) % 8);
+ *   }
+ *
+ *   volk_32f_s32u_block_sort_32f(out, in, 8, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32u_block_sort_32f_H
+#define INCLUDED_volk_32f_s32u_block_sort_32f_H
+
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32u_block_sort_32f_generic(float* outputVector,
+                                                        const float* inputVector,
+                                                        const unsigned int length,
+                                                        unsigned int num_points)
+{
+    float value;
+    unsigned int number, block, k, j;
+
+    for (number = 0; number < num_points; number += length) {
+        block = num_points - number < length ? num_points - number : length;
+        // insertion sort, reading each point before its place can be written
+        for (k = 0; k < block; k++) {
+            value = inputVector[number + k];
+            for (j = k; j > 0 && outputVector[number + j - 1] > value; j--) {
+                outputVector[number + j] = outputVector[number + j - 1];
+            }
+            outputVector[number + j] = value;
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_s32u_block_sort_32f_u_avx(float* outputVector,
+                                                      const float* inputVector,
+                                                      const unsigned int length,
+                                                      unsigned int num_points)
+{
+    const unsigned int eighthBlocks = num_points / length / 8;
+    unsigned int size = 1;
+    __VOLK_ATTR_ALIGNED(32) float lanes[32 * 8];
+    __m256 window[32];
+    unsigned int number, k, j;
+
+    while (size < length) {
+        size *= 2;
+    }
+
+    for (number = 0; number < eighthBlocks; number++) {
+        // transpose the blocks so each takes a lane
+        for (j = 0; j < 8; j++) {
+            for (k = 0; k < length; k++) {
+                lanes[8 * k + j] = inputVector[length * j + k];
+            }
+        }
+        for (k = 0; k < length; k++) {
+            window[k] = _mm256_load_ps(lanes + 8 * k);
+        }
+        for (; k < size; k++) {
+            window[k] = _mm256_set1_ps(INFINITY);
+        }
+        _mm256_sort_network_ps(window, size);
+        for (k = 0; k < length; k++) {
+            _mm256_store_ps(lanes + 8 * k, window[k]);
+        }
+        for (j = 0; j < 8; j++) {
+            for (k = 0; k < length; k++) {
+                outputVector[length * j + k] = lanes[8 * k + j];
+            }
+        }
+        inputVector += 8 * length;
+        outputVector += 8 * length;
+    }
+
+    volk_32f_s32u_block_sort_32f_generic(
+        outputVector, inputVector, length, num_points - eighthBlocks * 8 * length);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_s32u_block_sort_32f_u_avx512f(float* outputVector,
+                                                          const float* inputVector,
+                                                          const unsigned int length,
+                                                          unsigned int num_points)
+{
+    const unsigned int sixteenthBlocks = num_points / length / 16;
+    // the offsets of the blocks, one per lane
+    const __m512i offsets =
+        _mm512_mullo_epi32(_mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8,
+                                            7, 6, 5, 4, 3, 2, 1, 0),
+                           _mm512_set1_epi32((int)length));
+    unsigned int size = 1;
+    __m512 window[32];
+    unsigned int number, k;
+
+    while (size < length) {
+        size *= 2;
+    }
+
+    for (number = 0; number < sixteenthBlocks; number++) {
+        for (k = 0; k < length; k++) {
+            window[k] = _mm512_i32gather_ps(offsets, inputVector + k, 4);
+        }
+        for (; k < size; k++) {
+            window[k] = _mm512_set1_ps(INFINITY);
+        }
+        _mm512_sort_network_ps(window, size);
+        for (k = 0; k < length; k++) {
+            _mm512_i32scatter_ps(outputVector + k, offsets, window[k], 4);
+        }
+        inputVector += 16 * length;
+        outputVector += 16 * length;
+    }
+
+    volk_32f_s32u_block_sort_32f_generic(
+        outputVector, inputVector, length, num_points - sixteenthBlocks * 16 * length);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_s32u_block_sort_32f_neon(float* outputVector,
+                                                     const float* inputVector,
+                                                     const unsigned int length,
+                                                     unsigned int num_points)
+{
+    const unsigned int quarterBlocks = num_points / length / 4;
+    unsigned int size = 1;
+    float lanes[32 * 4];
+    float32x4_t window[32];
+    unsigned int number, k, j;
+
+    while (size < length) {
+        size *= 2;
+    }
+
+    for (number = 0; number < quarterBlocks; number++) {
+        // transpose the blocks so each takes a lane
+        for (j = 0; j < 4; j++) {
+            for (k = 0; k < length; k++) {
+                lanes[4 * k + j] = inputVector[length * j + k];
+            }
+        }
+        for (k = 0; k < length; k++) {
+            window[k] = vld1q_f32(lanes + 4 * k);
+        }
+        for (; k < size; k++) {
+            window[k] = vdupq_n_f32(INFINITY);
+        }
+        _vsort_networkq_f32(window, size);
+        for (k = 0; k < length; k++) {
+            vst1q_f32(lanes + 4 * k, window[k]);
+        }
+        for (j = 0; j < 4; j++) {
+            for (k = 0; k < length; k++) {
+                outputVector[length * j + k] = lanes[4 * k + j];
+            }
+        }
+        inputVector += 4 * length;
+        outputVector += 4 * length;
+    }
+
+    volk_32f_s32u_block_sort_32f_generic(
+        outputVector, inputVector, length, num_points - quarterBlocks * 4 * length);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32u_block_sort_32f_H */
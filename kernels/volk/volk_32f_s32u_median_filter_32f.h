@@ -0,0 +1,287 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_s32u_median_filter_32f
+ *
+ * \b Overview
+ *
+ * Computes the running median of the input over a window of length points,
+ * e.g. to remove impulse noise:
+ *
+ * outputVector[n] = median of inputVector[n] to inputVector[n + length - 1]
+ *
+ * The input holds num_points + length - 1 points: to filter a stream cut
+ * into buffers, keep the last length - 1 points of each buffer in front of
+ * the next one, as for volk_32f_s32u_moving_average_32f.
+ *
+ * The SIMD versions give each of four to sixteen consecutive outputs a lane
+ * and sort the length windows with a bitonic network of min and max
+ * operations, padded with infinities up to a power of two, so their medians
+ * come out in one vector. As they only select points, the results are the
+ * same as those of the generic version for inputs without NaN.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32u_median_filter_32f(float* outputVector, const float* inputVector,
+ * const unsigned int length, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The num_points + length - 1 points to filter.
+ * \li length: The number of points in a window, 1 to 31. For an even length,
+ * the output is the upper of the two middle points. Any other length leaves
+ * the output untouched.
+ * \li num_points: The number of outputs.
+ *
+ * \b Outputs
+ * \li outputVector: The running medians.
+ *
+ * \b Example
+ * Remove the spikes from a stream with windows of 5 points.
+ * \code
+ *   int N = 1024;
+ *   unsigned int L = 5;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*(N + L - 1), alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N + L - 1; ++ii){
+ *       in[ii] = ii % 37 == 0 ? 100.f : 1.f;
+ *   }
+ *
+ *   volk_32f_s32u_median_filter_32f(out, in, L, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32u_median_filter_32f_H
+#define INCLUDED_volk_32f_s32u_median_filter_32f_H
+
+#include <math.h>
+
+/* The longest window; the windows are sorted on the stack */
+#define VOLK_MEDIAN_MAX_LENGTH 31
+
+/* The power of two number of vectors the sorting network of a window takes */
+static inline unsigned int volk_median_network_size(unsigned int length)
+{
+    unsigned int size = 1;
+    while (size < length) {
+        size *= 2;
+    }
+    return size;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32u_median_filter_32f_generic(float* outputVector,
+                                                           const float* inputVector,
+                                                           const unsigned int length,
+                                                           unsigned int num_points)
+{
+    float sorted[VOLK_MEDIAN_MAX_LENGTH];
+    float value;
+    unsigned int number, k, j;
+
+    if (length == 0 || length > VOLK_MEDIAN_MAX_LENGTH) {
+        return;
+    }
+
+    for (number = 0; number < num_points; number++) {
+        // insertion sort of the window
+        for (k = 0; k < length; k++) {
+            value = inputVector[number + k];
+            for (j = k; j > 0 && sorted[j - 1] > value; j--) {
+                sorted[j] = sorted[j - 1];
+            }
+            sorted[j] = value;
+        }
+        outputVector[number] = sorted[length / 2];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <volk/volk_sse_intrinsics.h>
+#include <xmmintrin.h>
+
+static inline void volk_32f_s32u_median_filter_32f_u_sse(float* outputVector,
+                                                         const float* inputVector,
+                                                         const unsigned int length,
+                                                         unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const unsigned int size = volk_median_network_size(length);
+    __m128 window[32];
+    unsigned int number, k;
+
+    if (length == 0 || length > VOLK_MEDIAN_MAX_LENGTH) {
+        return;
+    }
+
+    // the padding sorts to the top, so it stays in place from one window on
+    for (k = length; k < size; k++) {
+        window[k] = _mm_set1_ps(INFINITY);
+    }
+
+    for (number = 0; number < quarterPoints; number++) {
+        for (k = 0; k < length; k++) {
+            window[k] = _mm_loadu_ps(inputVector + k);
+        }
+        _mm_sort_network_ps(window, size);
+        _mm_storeu_ps(outputVector, window[length / 2]);
+        inputVector += 4;
+        outputVector += 4;
+    }
+
+    volk_32f_s32u_median_filter_32f_generic(
+        outputVector, inputVector, length, num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_s32u_median_filter_32f_u_avx(float* outputVector,
+                                                         const float* inputVector,
+                                                         const unsigned int length,
+                                                         unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int size = volk_median_network_size(length);
+    __m256 window[32];
+    unsigned int number, k;
+
+    if (length == 0 || length > VOLK_MEDIAN_MAX_LENGTH) {
+        return;
+    }
+
+    // the padding sorts to the top, so it stays in place from one window on
+    for (k = length; k < size; k++) {
+        window[k] = _mm256_set1_ps(INFINITY);
+    }
+
+    for (number = 0; number < eighthPoints; number++) {
+        for (k = 0; k < length; k++) {
+            window[k] = _mm256_loadu_ps(inputVector + k);
+        }
+        _mm256_sort_network_ps(window, size);
+        _mm256_storeu_ps(outputVector, window[length / 2]);
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    volk_32f_s32u_median_filter_32f_generic(
+        outputVector, inputVector, length, num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_s32u_median_filter_32f_u_avx512f(float* outputVector,
+                                                             const float* inputVector,
+                                                             const unsigned int length,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int size = volk_median_network_size(length);
+    __m512 window[32];
+    unsigned int number, k;
+
+    if (length == 0 || length > VOLK_MEDIAN_MAX_LENGTH) {
+        return;
+    }
+
+    // the padding sorts to the top, so it stays in place from one window on
+    for (k = length; k < size; k++) {
+        window[k] = _mm512_set1_ps(INFINITY);
+    }
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        for (k = 0; k < length; k++) {
+            window[k] = _mm512_loadu_ps(inputVector + k);
+        }
+        _mm512_sort_network_ps(window, size);
+        _mm512_storeu_ps(outputVector, window[length / 2]);
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    volk_32f_s32u_median_filter_32f_generic(
+        outputVector, inputVector, length, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_s32u_median_filter_32f_neon(float* outputVector,
+                                                        const float* inputVector,
+                                                        const unsigned int length,
+                                                        unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const unsigned int size = volk_median_network_size(length);
+    float32x4_t window[32];
+    unsigned int number, k;
+
+    if (length == 0 || length > VOLK_MEDIAN_MAX_LENGTH) {
+        return;
+    }
+
+    // the padding sorts to the top, so it stays in place from one window on
+    for (k = length; k < size; k++) {
+        window[k] = vdupq_n_f32(INFINITY);
+    }
+
+    for (number = 0; number < quarterPoints; number++) {
+        for (k = 0; k < length; k++) {
+            window[k] = vld1q_f32(inputVector + k);
+        }
+        _vsort_networkq_f32(window, size);
+        vst1q_f32(outputVector, window[length / 2]);
+        inputVector += 4;
+        outputVector += 4;
+    }
+
+    volk_32f_s32u_median_filter_32f_generic(
+        outputVector, inputVector, length, num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32u_median_filter_32f_H */
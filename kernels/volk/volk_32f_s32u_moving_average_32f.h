@@ -0,0 +1,244 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_s32u_moving_average_32f
+ *
+ * \b Overview
+ *
+ * Computes the moving average of the input over a window of length points:
+ *
+ * outputVector[n] = (inputVector[n] + ... + inputVector[n + length - 1]) / length
+ *
+ * The input holds num_points + length - 1 points: to average a stream cut
+ * into buffers, keep the last length - 1 points of each buffer in front of the
+ * next one, as the history of a FIR filter.
+ *
+ * The window sum is computed in full for the first output of each call and
+ * then updated by the difference of the points entering and leaving it. The
+ * SIMD versions scan these differences a vector at a time, carrying the window
+ * sum from one vector to the next, which rounds differently from the generic
+ * version.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32u_moving_average_32f(float* outputVector, const float* inputVector,
+ * const unsigned int length, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The num_points + length - 1 points to average.
+ * \li length: The number of points averaged, at least 1.
+ * \li num_points: The number of outputs.
+ *
+ * \b Outputs
+ * \li outputVector: The moving averages.
+ *
+ * \b Example
+ * Smooth the envelope of a stream over windows of 16 points.
+ * \code
+ *   int N = 1024;
+ *   unsigned int L = 16;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*(N + L - 1), alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   memset(in, 0, sizeof(float)*(L - 1));
+ *   for(unsigned int block = 0; block < 100; ++block){
+ *       // read N points of the envelope into in + L - 1, then
+ *       volk_32f_s32u_moving_average_32f(out, in, L, N);
+ *       memmove(in, in + N, sizeof(float)*(L - 1));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32u_moving_average_32f_H
+#define INCLUDED_volk_32f_s32u_moving_average_32f_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32u_moving_average_32f_generic(float* outputVector,
+                                                            const float* inputVector,
+                                                            const unsigned int length,
+                                                            unsigned int num_points)
+{
+    const float scale = 1.f / (float)length;
+    float sum = 0.f;
+    unsigned int number;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    for (number = 0; number < length; number++) {
+        sum += inputVector[number];
+    }
+    outputVector[0] = sum * scale;
+
+    for (number = 1; number < num_points; number++) {
+        sum += inputVector[number + length - 1] - inputVector[number - 1];
+        outputVector[number] = sum * scale;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <volk/volk_sse_intrinsics.h>
+#include <xmmintrin.h>
+
+static inline void volk_32f_s32u_moving_average_32f_u_sse(float* outputVector,
+                                                          const float* inputVector,
+                                                          const unsigned int length,
+                                                          unsigned int num_points)
+{
+    const float scale = 1.f / (float)length;
+    const __m128 scaleVal = _mm_set1_ps(scale);
+    unsigned int quarterPoints, number;
+    __m128 carry, diff;
+    float sum = 0.f;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    for (number = 0; number < length; number++) {
+        sum += inputVector[number];
+    }
+    outputVector[0] = sum * scale;
+
+    // the window sums of the outputs from 1 on
+    quarterPoints = (num_points - 1) / 4;
+    carry = _mm_set1_ps(sum);
+    for (number = 0; number < quarterPoints; number++) {
+        diff = _mm_sub_ps(_mm_loadu_ps(inputVector + 4 * number + length),
+                          _mm_loadu_ps(inputVector + 4 * number));
+        carry = _mm_add_ps(_mm_scan_ps(diff), carry);
+        _mm_storeu_ps(outputVector + 4 * number + 1, _mm_mul_ps(carry, scaleVal));
+        carry = _mm_shuffle_ps(carry, carry, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    sum = _mm_cvtss_f32(carry);
+
+    for (number = quarterPoints * 4 + 1; number < num_points; number++) {
+        sum += inputVector[number + length - 1] - inputVector[number - 1];
+        outputVector[number] = sum * scale;
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_s32u_moving_average_32f_u_avx(float* outputVector,
+                                                          const float* inputVector,
+                                                          const unsigned int length,
+                                                          unsigned int num_points)
+{
+    const float scale = 1.f / (float)length;
+    const __m256 scaleVal = _mm256_set1_ps(scale);
+    unsigned int eighthPoints, number;
+    __m256 carry, diff;
+    float sum = 0.f;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    for (number = 0; number < length; number++) {
+        sum += inputVector[number];
+    }
+    outputVector[0] = sum * scale;
+
+    // the window sums of the outputs from 1 on
+    eighthPoints = (num_points - 1) / 8;
+    carry = _mm256_set1_ps(sum);
+    for (number = 0; number < eighthPoints; number++) {
+        diff = _mm256_sub_ps(_mm256_loadu_ps(inputVector + 8 * number + length),
+                             _mm256_loadu_ps(inputVector + 8 * number));
+        carry = _mm256_add_ps(_mm256_scan_ps(diff), carry);
+        _mm256_storeu_ps(outputVector + 8 * number + 1, _mm256_mul_ps(carry, scaleVal));
+        carry = _mm256_permute_ps(carry, 0xff);
+        carry = _mm256_permute2f128_ps(carry, carry, 0x11);
+    }
+    sum = _mm256_cvtss_f32(carry);
+
+    for (number = eighthPoints * 8 + 1; number < num_points; number++) {
+        sum += inputVector[number + length - 1] - inputVector[number - 1];
+        outputVector[number] = sum * scale;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_s32u_moving_average_32f_neon(float* outputVector,
+                                                         const float* inputVector,
+                                                         const unsigned int length,
+                                                         unsigned int num_points)
+{
+    const float scale = 1.f / (float)length;
+    unsigned int quarterPoints, number;
+    float32x4_t carry, diff;
+    float sum = 0.f;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    for (number = 0; number < length; number++) {
+        sum += inputVector[number];
+    }
+    outputVector[0] = sum * scale;
+
+    // the window sums of the outputs from 1 on
+    quarterPoints = (num_points - 1) / 4;
+    carry = vdupq_n_f32(sum);
+    for (number = 0; number < quarterPoints; number++) {
+        diff = vsubq_f32(vld1q_f32(inputVector + 4 * number + length),
+                         vld1q_f32(inputVector + 4 * number));
+        carry = vaddq_f32(_vscanq_f32(diff), carry);
+        vst1q_f32(outputVector + 4 * number + 1, vmulq_n_f32(carry, scale));
+        carry = vdupq_n_f32(vgetq_lane_f32(carry, 3));
+    }
+    sum = vgetq_lane_f32(carry, 0);
+
+    for (number = quarterPoints * 4 + 1; number < num_points; number++) {
+        sum += inputVector[number + length - 1] - inputVector[number - 1];
+        outputVector[number] = sum * scale;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32u_moving_average_32f_H */
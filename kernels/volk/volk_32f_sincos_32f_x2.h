@@ -0,0 +1,253 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_sincos_32f_x2
+ *
+ * \b Overview
+ *
+ * Computes the sine and the cosine of the input vector, sharing the range
+ * reduction and the polynomial evaluation between them. This is cheaper
+ * than volk_32f_sin_32f and volk_32f_cos_32f on the same input.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_sincos_32f_x2(float* sinVector, float* cosVector,
+ * const float* inVector, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The input vector of angles in radians.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li sinVector: The sine of each input.
+ * \li cosVector: The cosine of each input.
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* s = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* c = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.35f * ii;
+ *   }
+ *
+ *   volk_32f_sincos_32f_x2(s, c, in, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("sincos(%1.3f) = (%1.3f, %1.3f)\n", in[ii], s[ii], c[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(s);
+ *   volk_free(c);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_sincos_32f_x2_u_H
+#define INCLUDED_volk_32f_sincos_32f_x2_u_H
+
+#include <inttypes.h>
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_sincos_32f_x2_generic(float* sinVector,
+                                                  float* cosVector,
+                                                  const float* inVector,
+                                                  unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        sinVector[number] = sinf(inVector[number]);
+        cosVector[number] = cosf(inVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_u_sse3(float* sinVector,
+                                                 float* cosVector,
+                                                 const float* inVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+    __m128 sine, cosine;
+
+    for (number = 0; number < quarter_points; number++) {
+        _mm_sincos_ps_sse3(_mm_loadu_ps(inVector), &sine, &cosine);
+        _mm_storeu_ps(sinVector, sine);
+        _mm_storeu_ps(cosVector, cosine);
+        inVector += 4;
+        sinVector += 4;
+        cosVector += 4;
+    }
+
+    for (number = quarter_points * 4; number < num_points; number++) {
+        *sinVector++ = sinf(*inVector);
+        *cosVector++ = cosf(*inVector++);
+    }
+}
+
+#endif /* LV_HAVE_SSE3 for unaligned */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_u_avx2(float* sinVector,
+                                                 float* cosVector,
+                                                 const float* inVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+    __m256 sine, cosine;
+
+    for (number = 0; number < eighth_points; number++) {
+        _mm256_sincos_ps_avx2(_mm256_loadu_ps(inVector), &sine, &cosine);
+        _mm256_storeu_ps(sinVector, sine);
+        _mm256_storeu_ps(cosVector, cosine);
+        inVector += 8;
+        sinVector += 8;
+        cosVector += 8;
+    }
+
+    for (number = eighth_points * 8; number < num_points; number++) {
+        *sinVector++ = sinf(*inVector);
+        *cosVector++ = cosf(*inVector++);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 for unaligned */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_neon(float* sinVector,
+                                               float* cosVector,
+                                               const float* inVector,
+                                               unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const float32x4x2_t sincos = _vsincosq_f32(vld1q_f32(inVector));
+        vst1q_f32(sinVector, sincos.val[0]);
+        vst1q_f32(cosVector, sincos.val[1]);
+        inVector += 4;
+        sinVector += 4;
+        cosVector += 4;
+    }
+
+    for (number = quarter_points * 4; number < num_points; number++) {
+        *sinVector++ = sinf(*inVector);
+        *cosVector++ = cosf(*inVector++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_sincos_32f_x2_u_H */
+
+
+#ifndef INCLUDED_volk_32f_sincos_32f_x2_a_H
+#define INCLUDED_volk_32f_sincos_32f_x2_a_H
+
+#include <inttypes.h>
+#include <math.h>
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_a_sse3(float* sinVector,
+                                                 float* cosVector,
+                                                 const float* inVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+    __m128 sine, cosine;
+
+    for (number = 0; number < quarter_points; number++) {
+        _mm_sincos_ps_sse3(_mm_load_ps(inVector), &sine, &cosine);
+        _mm_store_ps(sinVector, sine);
+        _mm_store_ps(cosVector, cosine);
+        inVector += 4;
+        sinVector += 4;
+        cosVector += 4;
+    }
+
+    for (number = quarter_points * 4; number < num_points; number++) {
+        *sinVector++ = sinf(*inVector);
+        *cosVector++ = cosf(*inVector++);
+    }
+}
+
+#endif /* LV_HAVE_SSE3 for aligned */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_a_avx2(float* sinVector,
+                                                 float* cosVector,
+                                                 const float* inVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+    __m256 sine, cosine;
+
+    for (number = 0; number < eighth_points; number++) {
+        _mm256_sincos_ps_avx2(_mm256_load_ps(inVector), &sine, &cosine);
+        _mm256_store_ps(sinVector, sine);
+        _mm256_store_ps(cosVector, cosine);
+        inVector += 8;
+        sinVector += 8;
+        cosVector += 8;
+    }
+
+    for (number = eighth_points * 8; number < num_points; number++) {
+        *sinVector++ = sinf(*inVector);
+        *cosVector++ = cosf(*inVector++);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 for aligned */
+
+#endif /* INCLUDED_volk_32f_sincos_32f_x2_a_H */
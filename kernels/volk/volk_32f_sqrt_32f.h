@@ -101,6 +101,46 @@ volk_32f_sqrt_32f_a_sse(float* cVector, const float* aVector, unsigned int num_p
 
 #endif /* LV_HAVE_SSE */
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_sqrt_32f_a_avx512f(float* cVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512 inf = _mm512_set1_ps(INFINITY);
+    __m512 aVal, yVal, cVal;
+    __mmask16 refine;
+    for (; number < sixteenthPoints; number++) {
+        aVal = _mm512_load_ps(aPtr);
+        // s = x * rsqrt14(x) refined by one Newton step, s + y / 2 * (x - s * s);
+        // 0 and inf, which the estimate turns into nan, are their own roots
+        yVal = _mm512_rsqrt14_ps(aVal);
+        refine = _mm512_cmp_ps_mask(aVal, _mm512_setzero_ps(), _CMP_NEQ_OQ) &
+                 _mm512_cmp_ps_mask(aVal, inf, _CMP_NEQ_OQ);
+        cVal = _mm512_mul_ps(aVal, yVal);
+        cVal = _mm512_fmadd_ps(_mm512_fnmadd_ps(cVal, cVal, aVal),
+                               _mm512_mul_ps(yVal, half),
+                               cVal);
+        cVal = _mm512_mask_mov_ps(aVal, refine, cVal);
+        _mm512_store_ps(cPtr, cVal);
+        aPtr += 16;
+        cPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *cPtr++ = sqrtf(*aPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
@@ -163,6 +203,43 @@ volk_32f_sqrt_32f_neon(float* cVector, const float* aVector, unsigned int num_po
 #endif /* LV_HAVE_NEON */
 
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32f_sqrt_32f_neonv8(float* cVector, const float* aVector, unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    unsigned int number = 0;
+    unsigned int quarter_points = num_points / 4;
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t inf = vdupq_n_f32(INFINITY);
+    float32x4_t in_vec, est_vec, out_vec;
+    uint32x4_t own_root;
+
+    for (number = 0; number < quarter_points; number++) {
+        in_vec = vld1q_f32(aPtr);
+        // x times the estimate of 1 / sqrt(x) after one Newton step, which is
+        // nan for 0 and inf, so those are passed through as their own roots
+        est_vec = vrsqrteq_f32(in_vec);
+        est_vec = vmulq_f32(est_vec, vrsqrtsq_f32(in_vec, vmulq_f32(est_vec, est_vec)));
+        out_vec = vmulq_f32(in_vec, est_vec);
+        own_root = vorrq_u32(vceqq_f32(in_vec, zero), vceqq_f32(in_vec, inf));
+        out_vec = vbslq_f32(own_root, in_vec, out_vec);
+        vst1q_f32(cPtr, out_vec);
+        aPtr += 4;
+        cPtr += 4;
+    }
+
+    for (number = quarter_points * 4; number < num_points; number++) {
+        *cPtr++ = sqrtf(*aPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+
 #ifdef LV_HAVE_GENERIC
 
 static inline void
@@ -231,4 +308,44 @@ volk_32f_sqrt_32f_u_avx(float* cVector, const float* aVector, unsigned int num_p
 }
 
 #endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_sqrt_32f_u_avx512f(float* cVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512 inf = _mm512_set1_ps(INFINITY);
+    __m512 aVal, yVal, cVal;
+    __mmask16 refine;
+    for (; number < sixteenthPoints; number++) {
+        aVal = _mm512_loadu_ps(aPtr);
+        // s = x * rsqrt14(x) refined by one Newton step, s + y / 2 * (x - s * s);
+        // 0 and inf, which the estimate turns into nan, are their own roots
+        yVal = _mm512_rsqrt14_ps(aVal);
+        refine = _mm512_cmp_ps_mask(aVal, _mm512_setzero_ps(), _CMP_NEQ_OQ) &
+                 _mm512_cmp_ps_mask(aVal, inf, _CMP_NEQ_OQ);
+        cVal = _mm512_mul_ps(aVal, yVal);
+        cVal = _mm512_fmadd_ps(_mm512_fnmadd_ps(cVal, cVal, aVal),
+                               _mm512_mul_ps(yVal, half),
+                               cVal);
+        cVal = _mm512_mask_mov_ps(aVal, refine, cVal);
+        _mm512_storeu_ps(cPtr, cVal);
+        aPtr += 16;
+        cPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *cPtr++ = sqrtf(*aPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
 #endif /* INCLUDED_volk_32f_sqrt_32f_u_H */
@@ -0,0 +1,102 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_sqrt_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_sqrt_refinedpuppet_32f_H
+#define INCLUDED_volk_32f_sqrt_refinedpuppet_32f_H
+
+#include <volk/volk_32f_sqrt_32f.h>
+
+/*
+ * The exact and refined impls of volk_32f_sqrt_32f, held to a tighter
+ * tolerance than the raw estimate of its neon impl.
+ */
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32f_sqrt_refinedpuppet_32f_generic(float* cVector,
+                                                           const float* aVector,
+                                                           unsigned int num_points)
+{
+    volk_32f_sqrt_32f_generic(cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+static inline void volk_32f_sqrt_refinedpuppet_32f_a_sse(float* cVector,
+                                                         const float* aVector,
+                                                         unsigned int num_points)
+{
+    volk_32f_sqrt_32f_a_sse(cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32f_sqrt_refinedpuppet_32f_a_avx(float* cVector,
+                                                         const float* aVector,
+                                                         unsigned int num_points)
+{
+    volk_32f_sqrt_32f_a_avx(cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32f_sqrt_refinedpuppet_32f_u_avx(float* cVector,
+                                                         const float* aVector,
+                                                         unsigned int num_points)
+{
+    volk_32f_sqrt_32f_u_avx(cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32f_sqrt_refinedpuppet_32f_a_avx512f(float* cVector,
+                                                             const float* aVector,
+                                                             unsigned int num_points)
+{
+    volk_32f_sqrt_32f_a_avx512f(cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32f_sqrt_refinedpuppet_32f_u_avx512f(float* cVector,
+                                                             const float* aVector,
+                                                             unsigned int num_points)
+{
+    volk_32f_sqrt_32f_u_avx512f(cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+static inline void volk_32f_sqrt_refinedpuppet_32f_neonv8(float* cVector,
+                                                          const float* aVector,
+                                                          unsigned int num_points)
+{
+    volk_32f_sqrt_32f_neonv8(cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_sqrt_refinedpuppet_32f_H */
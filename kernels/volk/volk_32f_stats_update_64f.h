@@ -0,0 +1,320 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_stats_update_64f
+ *
+ * \b Overview
+ *
+ * Adds a buffer of samples to running statistics, for the mean and variance
+ * of a stream which never ends. The state is three doubles, zeroed to start:
+ *
+ * state[0]: the number of samples so far
+ * state[1]: their mean
+ * state[2]: the sum of their squared deviations from the mean
+ *
+ * so the variance is state[2] / state[0], and the sample variance
+ * state[2] / (state[0] - 1).
+ *
+ * The SIMD versions sum the samples and their squares in float lanes, offset
+ * by the mean so far so the squares do not cancel, over blocks short enough
+ * for float sums to stay exact to a few ulps. Each block is merged into the
+ * state in double with Chan's formula. The generic version updates the state
+ * sample by sample with Welford's.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_stats_update_64f(double* state, const float* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li state: The statistics so far.
+ * \li inputVector: The new samples.
+ * \li num_points: The number of new samples.
+ *
+ * \b Outputs
+ * \li state: The statistics with the new samples.
+ *
+ * \b Example
+ * Track the noise floor of a channel across buffers.
+ * \code
+ *   int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* power = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   double state[3] = { 0.0, 0.0, 0.0 };
+ *
+ *   for(unsigned int buffer = 0; buffer < 100; ++buffer){
+ *       // read the next buffer of power samples, then
+ *       volk_32f_stats_update_64f(state, power, N);
+ *   }
+ *   printf("mean %g, standard deviation %g\n", state[1], sqrt(state[2] / state[0]));
+ *
+ *   volk_free(power);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_stats_update_64f_H
+#define INCLUDED_volk_32f_stats_update_64f_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/*
+ * The points per lane a SIMD block sums in float before merging into the
+ * state
+ */
+#define VOLK_STATS_BLOCK 256
+
+/*
+ * Merges a block of count samples, given the sums of (x - shift) and of
+ * (x - shift)^2, into the state with Chan's formula.
+ */
+static inline void volk_stats_merge(
+    double* state, double count, double sum, double sumSquares, double shift)
+{
+    const double total = state[0] + count;
+    const double mean = shift + sum / count;
+    const double delta = mean - state[1];
+
+    state[2] += sumSquares - sum * sum / count + delta * delta * state[0] * count / total;
+    state[1] += delta * count / total;
+    state[0] = total;
+}
+
+/* Merges the samples past the last full vector */
+static inline void
+volk_stats_merge_tail(double* state, const float* inputVector, unsigned int num_points)
+{
+    double shift, sum = 0.0, sumSquares = 0.0, deviation;
+    unsigned int number;
+
+    if (num_points == 0) {
+        return;
+    }
+    shift = state[0] > 0.0 ? state[1] : inputVector[0];
+    for (number = 0; number < num_points; number++) {
+        deviation = inputVector[number] - shift;
+        sum += deviation;
+        sumSquares += deviation * deviation;
+    }
+    volk_stats_merge(state, num_points, sum, sumSquares, shift);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_stats_update_64f_generic(double* state,
+                                                     const float* inputVector,
+                                                     unsigned int num_points)
+{
+    double count = state[0], mean = state[1], deviations = state[2], delta;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        count += 1.0;
+        delta = inputVector[number] - mean;
+        mean += delta / count;
+        deviations += delta * (inputVector[number] - mean);
+    }
+    state[0] = count;
+    state[1] = mean;
+    state[2] = deviations;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_stats_update_64f_u_sse(double* state,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    __m128 shifts, sums, squares, deviations;
+    __VOLK_ATTR_ALIGNED(16) float laneSums[4];
+    __VOLK_ATTR_ALIGNED(16) float laneSquares[4];
+    unsigned int number = 0, points, end, lane;
+    double sum, sumSquares;
+    float shift;
+
+    while (num_points - number >= 4) {
+        points = num_points - number < VOLK_STATS_BLOCK * 4
+                     ? (num_points - number) / 4 * 4
+                     : VOLK_STATS_BLOCK * 4;
+        shift = state[0] > 0.0 ? (float)state[1] : inputVector[number];
+        shifts = _mm_set1_ps(shift);
+        sums = _mm_setzero_ps();
+        squares = _mm_setzero_ps();
+        for (end = number + points; number < end; number += 4) {
+            deviations = _mm_sub_ps(_mm_loadu_ps(inputVector + number), shifts);
+            sums = _mm_add_ps(sums, deviations);
+            squares = _mm_add_ps(squares, _mm_mul_ps(deviations, deviations));
+        }
+        _mm_store_ps(laneSums, sums);
+        _mm_store_ps(laneSquares, squares);
+        sum = 0.0;
+        sumSquares = 0.0;
+        for (lane = 0; lane < 4; lane++) {
+            sum += laneSums[lane];
+            sumSquares += laneSquares[lane];
+        }
+        volk_stats_merge(state, points, sum, sumSquares, shift);
+    }
+
+    volk_stats_merge_tail(state, inputVector + number, num_points - number);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_stats_update_64f_u_avx(double* state,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    __m256 shifts, sums, squares, deviations;
+    __VOLK_ATTR_ALIGNED(32) float laneSums[8];
+    __VOLK_ATTR_ALIGNED(32) float laneSquares[8];
+    unsigned int number = 0, points, end, lane;
+    double sum, sumSquares;
+    float shift;
+
+    while (num_points - number >= 8) {
+        points = num_points - number < VOLK_STATS_BLOCK * 8
+                     ? (num_points - number) / 8 * 8
+                     : VOLK_STATS_BLOCK * 8;
+        shift = state[0] > 0.0 ? (float)state[1] : inputVector[number];
+        shifts = _mm256_set1_ps(shift);
+        sums = _mm256_setzero_ps();
+        squares = _mm256_setzero_ps();
+        for (end = number + points; number < end; number += 8) {
+            deviations = _mm256_sub_ps(_mm256_loadu_ps(inputVector + number), shifts);
+            sums = _mm256_add_ps(sums, deviations);
+            squares = _mm256_add_ps(squares, _mm256_mul_ps(deviations, deviations));
+        }
+        _mm256_store_ps(laneSums, sums);
+        _mm256_store_ps(laneSquares, squares);
+        sum = 0.0;
+        sumSquares = 0.0;
+        for (lane = 0; lane < 8; lane++) {
+            sum += laneSums[lane];
+            sumSquares += laneSquares[lane];
+        }
+        volk_stats_merge(state, points, sum, sumSquares, shift);
+    }
+
+    volk_stats_merge_tail(state, inputVector + number, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_stats_update_64f_u_avx512f(double* state,
+                                                       const float* inputVector,
+                                                       unsigned int num_points)
+{
+    __m512 shifts, sums, squares, deviations;
+    __VOLK_ATTR_ALIGNED(64) float laneSums[16];
+    __VOLK_ATTR_ALIGNED(64) float laneSquares[16];
+    unsigned int number = 0, points, end, lane;
+    double sum, sumSquares;
+    float shift;
+
+    while (num_points - number >= 16) {
+        points = num_points - number < VOLK_STATS_BLOCK * 16
+                     ? (num_points - number) / 16 * 16
+                     : VOLK_STATS_BLOCK * 16;
+        shift = state[0] > 0.0 ? (float)state[1] : inputVector[number];
+        shifts = _mm512_set1_ps(shift);
+        sums = _mm512_setzero_ps();
+        squares = _mm512_setzero_ps();
+        for (end = number + points; number < end; number += 16) {
+            deviations = _mm512_sub_ps(_mm512_loadu_ps(inputVector + number), shifts);
+            sums = _mm512_add_ps(sums, deviations);
+            squares = _mm512_add_ps(squares, _mm512_mul_ps(deviations, deviations));
+        }
+        _mm512_store_ps(laneSums, sums);
+        _mm512_store_ps(laneSquares, squares);
+        sum = 0.0;
+        sumSquares = 0.0;
+        for (lane = 0; lane < 16; lane++) {
+            sum += laneSums[lane];
+            sumSquares += laneSquares[lane];
+        }
+        volk_stats_merge(state, points, sum, sumSquares, shift);
+    }
+
+    volk_stats_merge_tail(state, inputVector + number, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_stats_update_64f_neon(double* state,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    float32x4_t shifts, sums, squares, deviations;
+    float laneSums[4];
+    float laneSquares[4];
+    unsigned int number = 0, points, end, lane;
+    double sum, sumSquares;
+    float shift;
+
+    while (num_points - number >= 4) {
+        points = num_points - number < VOLK_STATS_BLOCK * 4
+                     ? (num_points - number) / 4 * 4
+                     : VOLK_STATS_BLOCK * 4;
+        shift = state[0] > 0.0 ? (float)state[1] : inputVector[number];
+        shifts = vdupq_n_f32(shift);
+        sums = vdupq_n_f32(0.f);
+        squares = vdupq_n_f32(0.f);
+        for (end = number + points; number < end; number += 4) {
+            deviations = vsubq_f32(vld1q_f32(inputVector + number), shifts);
+            sums = vaddq_f32(sums, deviations);
+            squares = vaddq_f32(squares, vmulq_f32(deviations, deviations));
+        }
+        vst1q_f32(laneSums, sums);
+        vst1q_f32(laneSquares, squares);
+        sum = 0.0;
+        sumSquares = 0.0;
+        for (lane = 0; lane < 4; lane++) {
+            sum += laneSums[lane];
+            sumSquares += laneSquares[lane];
+        }
+        volk_stats_merge(state, points, sum, sumSquares, shift);
+    }
+
+    volk_stats_merge_tail(state, inputVector + number, num_points - number);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_stats_update_64f_H */
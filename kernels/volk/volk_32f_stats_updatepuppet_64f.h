@@ -0,0 +1,132 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_stats_update_64f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_stats_updatepuppet_64f_H
+#define INCLUDED_volk_32f_stats_updatepuppet_64f_H
+
+#include <string.h>
+#include <volk/volk_32f_stats_update_64f.h>
+
+/*
+ * Updates zeroed statistics with the two halves of the input and writes the
+ * count, the mean and the variance.
+ */
+static inline void volk_32f_stats_update_puppet(void (*kernel)(double*,
+                                                               const float*,
+                                                               unsigned int),
+                                                double* output,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    double state[3] = { 0.0, 0.0, 0.0 };
+
+    kernel(state, inputVector, num_points / 2);
+    kernel(state, inputVector + num_points / 2, num_points - num_points / 2);
+
+    memset(output, 0, sizeof(double) * num_points);
+    if (num_points >= 3) {
+        output[0] = state[0];
+        output[1] = state[1];
+        output[2] = state[2] / state[0];
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_stats_updatepuppet_64f_generic(double* output,
+                                                           const float* inputVector,
+                                                           unsigned int num_points)
+{
+    volk_32f_stats_update_puppet(volk_32f_stats_update_64f_generic,
+                                 output,
+                                 inputVector,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_stats_updatepuppet_64f_u_sse(double* output,
+                                                         const float* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_32f_stats_update_puppet(volk_32f_stats_update_64f_u_sse,
+                                 output,
+                                 inputVector,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_stats_updatepuppet_64f_u_avx(double* output,
+                                                         const float* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_32f_stats_update_puppet(volk_32f_stats_update_64f_u_avx,
+                                 output,
+                                 inputVector,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_stats_updatepuppet_64f_u_avx512f(double* output,
+                                                             const float* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_32f_stats_update_puppet(volk_32f_stats_update_64f_u_avx512f,
+                                 output,
+                                 inputVector,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_stats_updatepuppet_64f_neon(double* output,
+                                                        const float* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_32f_stats_update_puppet(volk_32f_stats_update_64f_neon,
+                                 output,
+                                 inputVector,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_stats_updatepuppet_64f_H */
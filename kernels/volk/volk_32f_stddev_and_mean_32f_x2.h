@@ -27,6 +27,12 @@
  *
  * Computes the standard deviation and mean of the input buffer.
  *
+ * The input is read once. Each SIMD lane keeps a running mean and sum of
+ * squared deviations (Welford), and the lanes are merged pairwise at the
+ * end (Chan et al.), so a large DC offset does not cancel the variance as
+ * it does with a sum of squares. The generic implementation accumulates in
+ * double and serves as the reference.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32f_stddev_and_mean_32f_x2(float* stddev, float* mean, const float*
@@ -74,6 +80,63 @@
 #include <stdio.h>
 #include <volk/volk_common.h>
 
+/*
+ * Merge the Welford accumulator (mean_b, m2_b) of count_b points into
+ * (mean, m2) of count points.
+ */
+static inline void volk_32f_stddev_and_mean_merge(
+    float* mean, float* m2, float count, float mean_b, float m2_b, float count_b)
+{
+    const float total = count + count_b;
+    const float delta = mean_b - *mean;
+    if (count_b == 0.f)
+        return;
+    *mean += delta * (count_b / total);
+    *m2 += m2_b + delta * delta * (count * (count_b / total));
+}
+
+/*
+ * Merge the n_lanes lane accumulators, count points each, pairwise into
+ * means[0] and m2s[0], then add the remaining points of the tail one by one.
+ */
+static inline void volk_32f_stddev_and_mean_finish(float* stddev,
+                                                   float* mean,
+                                                   float* means,
+                                                   float* m2s,
+                                                   unsigned int n_lanes,
+                                                   unsigned int count,
+                                                   const float* tail,
+                                                   unsigned int num_points)
+{
+    float lane_count = (float)count;
+    float mean_all, m2_all, n;
+    unsigned int width, i;
+
+    for (width = n_lanes / 2; width > 0; width /= 2) {
+        for (i = 0; i < width; i++) {
+            volk_32f_stddev_and_mean_merge(&means[i],
+                                           &m2s[i],
+                                           lane_count,
+                                           means[i + width],
+                                           m2s[i + width],
+                                           lane_count);
+        }
+        lane_count *= 2.f;
+    }
+
+    mean_all = means[0];
+    m2_all = m2s[0];
+    n = (float)(count * n_lanes);
+    for (i = count * n_lanes; i < num_points; i++) {
+        const float delta = tail[i] - mean_all;
+        n += 1.f;
+        mean_all += delta / n;
+        m2_all += delta * (tail[i] - mean_all);
+    }
+    *stddev = sqrtf(m2_all / (float)num_points);
+    *mean = mean_all;
+}
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
@@ -82,81 +145,41 @@ static inline void volk_32f_stddev_and_mean_32f_x2_a_avx(float* stddev,
                                                          const float* inputBuffer,
                                                          unsigned int num_points)
 {
-    float stdDev = 0;
-    float newMean = 0;
-    if (num_points > 0) {
-        unsigned int number = 0;
-        const unsigned int thirtySecondthPoints = num_points / 32;
-
-        const float* aPtr = inputBuffer;
-        __VOLK_ATTR_ALIGNED(32) float meanBuffer[8];
-        __VOLK_ATTR_ALIGNED(32) float squareBuffer[8];
-
-        __m256 accumulator = _mm256_setzero_ps();
-        __m256 squareAccumulator = _mm256_setzero_ps();
-        __m256 aVal1, aVal2, aVal3, aVal4;
-        __m256 cVal1, cVal2, cVal3, cVal4;
-        for (; number < thirtySecondthPoints; number++) {
-            aVal1 = _mm256_load_ps(aPtr);
-            aPtr += 8;
-            cVal1 = _mm256_dp_ps(aVal1, aVal1, 0xF1);
-            accumulator = _mm256_add_ps(accumulator, aVal1); // accumulator += x
-
-            aVal2 = _mm256_load_ps(aPtr);
-            aPtr += 8;
-            cVal2 = _mm256_dp_ps(aVal2, aVal2, 0xF2);
-            accumulator = _mm256_add_ps(accumulator, aVal2); // accumulator += x
-
-            aVal3 = _mm256_load_ps(aPtr);
-            aPtr += 8;
-            cVal3 = _mm256_dp_ps(aVal3, aVal3, 0xF4);
-            accumulator = _mm256_add_ps(accumulator, aVal3); // accumulator += x
-
-            aVal4 = _mm256_load_ps(aPtr);
-            aPtr += 8;
-            cVal4 = _mm256_dp_ps(aVal4, aVal4, 0xF8);
-            accumulator = _mm256_add_ps(accumulator, aVal4); // accumulator += x
-
-            cVal1 = _mm256_or_ps(cVal1, cVal2);
-            cVal3 = _mm256_or_ps(cVal3, cVal4);
-            cVal1 = _mm256_or_ps(cVal1, cVal3);
-
-            squareAccumulator =
-                _mm256_add_ps(squareAccumulator, cVal1); // squareAccumulator += x^2
-        }
-        _mm256_store_ps(meanBuffer,
-                        accumulator); // Store the results back into the C container
-        _mm256_store_ps(squareBuffer,
-                        squareAccumulator); // Store the results back into the C container
-        newMean = meanBuffer[0];
-        newMean += meanBuffer[1];
-        newMean += meanBuffer[2];
-        newMean += meanBuffer[3];
-        newMean += meanBuffer[4];
-        newMean += meanBuffer[5];
-        newMean += meanBuffer[6];
-        newMean += meanBuffer[7];
-        stdDev = squareBuffer[0];
-        stdDev += squareBuffer[1];
-        stdDev += squareBuffer[2];
-        stdDev += squareBuffer[3];
-        stdDev += squareBuffer[4];
-        stdDev += squareBuffer[5];
-        stdDev += squareBuffer[6];
-        stdDev += squareBuffer[7];
-
-        number = thirtySecondthPoints * 32;
-        for (; number < num_points; number++) {
-            stdDev += (*aPtr) * (*aPtr);
-            newMean += *aPtr++;
-        }
-        newMean /= num_points;
-        stdDev /= num_points;
-        stdDev -= (newMean * newMean);
-        stdDev = sqrtf(stdDev);
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* aPtr = inputBuffer;
+    __VOLK_ATTR_ALIGNED(32) float means[16];
+    __VOLK_ATTR_ALIGNED(32) float m2s[16];
+    __m256 mean0 = _mm256_setzero_ps(), mean1 = _mm256_setzero_ps();
+    __m256 m20 = _mm256_setzero_ps(), m21 = _mm256_setzero_ps();
+    __m256 x0, x1, delta0, delta1, rcp;
+    unsigned int number;
+
+    if (num_points == 0) {
+        *stddev = 0.f;
+        *mean = 0.f;
+        return;
+    }
+
+    // two sets of 8 lanes, each lane sees every 16th point
+    for (number = 1; number <= sixteenthPoints; number++) {
+        rcp = _mm256_set1_ps(1.f / (float)number);
+        x0 = _mm256_load_ps(aPtr);
+        x1 = _mm256_load_ps(aPtr + 8);
+        aPtr += 16;
+        delta0 = _mm256_sub_ps(x0, mean0);
+        delta1 = _mm256_sub_ps(x1, mean1);
+        mean0 = _mm256_add_ps(mean0, _mm256_mul_ps(delta0, rcp));
+        mean1 = _mm256_add_ps(mean1, _mm256_mul_ps(delta1, rcp));
+        m20 = _mm256_add_ps(m20, _mm256_mul_ps(delta0, _mm256_sub_ps(x0, mean0)));
+        m21 = _mm256_add_ps(m21, _mm256_mul_ps(delta1, _mm256_sub_ps(x1, mean1)));
     }
-    *stddev = stdDev;
-    *mean = newMean;
+    _mm256_store_ps(means, mean0);
+    _mm256_store_ps(means + 8, mean1);
+    _mm256_store_ps(m2s, m20);
+    _mm256_store_ps(m2s + 8, m21);
+
+    volk_32f_stddev_and_mean_finish(
+        stddev, mean, means, m2s, 16, sixteenthPoints, inputBuffer, num_points);
 }
 #endif /* LV_HAVE_AVX */
 
@@ -169,161 +192,90 @@ static inline void volk_32f_stddev_and_mean_32f_x2_u_avx(float* stddev,
                                                          const float* inputBuffer,
                                                          unsigned int num_points)
 {
-    float stdDev = 0;
-    float newMean = 0;
-    if (num_points > 0) {
-        unsigned int number = 0;
-        const unsigned int thirtySecondthPoints = num_points / 32;
-
-        const float* aPtr = inputBuffer;
-        __VOLK_ATTR_ALIGNED(32) float meanBuffer[8];
-        __VOLK_ATTR_ALIGNED(32) float squareBuffer[8];
-
-        __m256 accumulator = _mm256_setzero_ps();
-        __m256 squareAccumulator = _mm256_setzero_ps();
-        __m256 aVal1, aVal2, aVal3, aVal4;
-        __m256 cVal1, cVal2, cVal3, cVal4;
-        for (; number < thirtySecondthPoints; number++) {
-            aVal1 = _mm256_loadu_ps(aPtr);
-            aPtr += 8;
-            cVal1 = _mm256_dp_ps(aVal1, aVal1, 0xF1);
-            accumulator = _mm256_add_ps(accumulator, aVal1); // accumulator += x
-
-            aVal2 = _mm256_loadu_ps(aPtr);
-            aPtr += 8;
-            cVal2 = _mm256_dp_ps(aVal2, aVal2, 0xF2);
-            accumulator = _mm256_add_ps(accumulator, aVal2); // accumulator += x
-
-            aVal3 = _mm256_loadu_ps(aPtr);
-            aPtr += 8;
-            cVal3 = _mm256_dp_ps(aVal3, aVal3, 0xF4);
-            accumulator = _mm256_add_ps(accumulator, aVal3); // accumulator += x
-
-            aVal4 = _mm256_loadu_ps(aPtr);
-            aPtr += 8;
-            cVal4 = _mm256_dp_ps(aVal4, aVal4, 0xF8);
-            accumulator = _mm256_add_ps(accumulator, aVal4); // accumulator += x
-
-            cVal1 = _mm256_or_ps(cVal1, cVal2);
-            cVal3 = _mm256_or_ps(cVal3, cVal4);
-            cVal1 = _mm256_or_ps(cVal1, cVal3);
-
-            squareAccumulator =
-                _mm256_add_ps(squareAccumulator, cVal1); // squareAccumulator += x^2
-        }
-        _mm256_store_ps(meanBuffer,
-                        accumulator); // Store the results back into the C container
-        _mm256_store_ps(squareBuffer,
-                        squareAccumulator); // Store the results back into the C container
-        newMean = meanBuffer[0];
-        newMean += meanBuffer[1];
-        newMean += meanBuffer[2];
-        newMean += meanBuffer[3];
-        newMean += meanBuffer[4];
-        newMean += meanBuffer[5];
-        newMean += meanBuffer[6];
-        newMean += meanBuffer[7];
-        stdDev = squareBuffer[0];
-        stdDev += squareBuffer[1];
-        stdDev += squareBuffer[2];
-        stdDev += squareBuffer[3];
-        stdDev += squareBuffer[4];
-        stdDev += squareBuffer[5];
-        stdDev += squareBuffer[6];
-        stdDev += squareBuffer[7];
-
-        number = thirtySecondthPoints * 32;
-        for (; number < num_points; number++) {
-            stdDev += (*aPtr) * (*aPtr);
-            newMean += *aPtr++;
-        }
-        newMean /= num_points;
-        stdDev /= num_points;
-        stdDev -= (newMean * newMean);
-        stdDev = sqrtf(stdDev);
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* aPtr = inputBuffer;
+    __VOLK_ATTR_ALIGNED(32) float means[16];
+    __VOLK_ATTR_ALIGNED(32) float m2s[16];
+    __m256 mean0 = _mm256_setzero_ps(), mean1 = _mm256_setzero_ps();
+    __m256 m20 = _mm256_setzero_ps(), m21 = _mm256_setzero_ps();
+    __m256 x0, x1, delta0, delta1, rcp;
+    unsigned int number;
+
+    if (num_points == 0) {
+        *stddev = 0.f;
+        *mean = 0.f;
+        return;
+    }
+
+    // two sets of 8 lanes, each lane sees every 16th point
+    for (number = 1; number <= sixteenthPoints; number++) {
+        rcp = _mm256_set1_ps(1.f / (float)number);
+        x0 = _mm256_loadu_ps(aPtr);
+        x1 = _mm256_loadu_ps(aPtr + 8);
+        aPtr += 16;
+        delta0 = _mm256_sub_ps(x0, mean0);
+        delta1 = _mm256_sub_ps(x1, mean1);
+        mean0 = _mm256_add_ps(mean0, _mm256_mul_ps(delta0, rcp));
+        mean1 = _mm256_add_ps(mean1, _mm256_mul_ps(delta1, rcp));
+        m20 = _mm256_add_ps(m20, _mm256_mul_ps(delta0, _mm256_sub_ps(x0, mean0)));
+        m21 = _mm256_add_ps(m21, _mm256_mul_ps(delta1, _mm256_sub_ps(x1, mean1)));
     }
-    *stddev = stdDev;
-    *mean = newMean;
+    _mm256_store_ps(means, mean0);
+    _mm256_store_ps(means + 8, mean1);
+    _mm256_store_ps(m2s, m20);
+    _mm256_store_ps(m2s + 8, m21);
+
+    volk_32f_stddev_and_mean_finish(
+        stddev, mean, means, m2s, 16, sixteenthPoints, inputBuffer, num_points);
 }
 #endif /* LV_HAVE_AVX */
 
 
-#ifdef LV_HAVE_SSE4_1
-#include <smmintrin.h>
-static inline void volk_32f_stddev_and_mean_32f_x2_a_sse4_1(float* stddev,
-                                                            float* mean,
-                                                            const float* inputBuffer,
-                                                            unsigned int num_points)
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_stddev_and_mean_32f_x2_u_avx512f(float* stddev,
+                                                             float* mean,
+                                                             const float* inputBuffer,
+                                                             unsigned int num_points)
 {
-    float returnValue = 0;
-    float newMean = 0;
-    if (num_points > 0) {
-        unsigned int number = 0;
-        const unsigned int sixteenthPoints = num_points / 16;
-
-        const float* aPtr = inputBuffer;
-        __VOLK_ATTR_ALIGNED(16) float meanBuffer[4];
-        __VOLK_ATTR_ALIGNED(16) float squareBuffer[4];
-
-        __m128 accumulator = _mm_setzero_ps();
-        __m128 squareAccumulator = _mm_setzero_ps();
-        __m128 aVal1, aVal2, aVal3, aVal4;
-        __m128 cVal1, cVal2, cVal3, cVal4;
-        for (; number < sixteenthPoints; number++) {
-            aVal1 = _mm_load_ps(aPtr);
-            aPtr += 4;
-            cVal1 = _mm_dp_ps(aVal1, aVal1, 0xF1);
-            accumulator = _mm_add_ps(accumulator, aVal1); // accumulator += x
-
-            aVal2 = _mm_load_ps(aPtr);
-            aPtr += 4;
-            cVal2 = _mm_dp_ps(aVal2, aVal2, 0xF2);
-            accumulator = _mm_add_ps(accumulator, aVal2); // accumulator += x
-
-            aVal3 = _mm_load_ps(aPtr);
-            aPtr += 4;
-            cVal3 = _mm_dp_ps(aVal3, aVal3, 0xF4);
-            accumulator = _mm_add_ps(accumulator, aVal3); // accumulator += x
-
-            aVal4 = _mm_load_ps(aPtr);
-            aPtr += 4;
-            cVal4 = _mm_dp_ps(aVal4, aVal4, 0xF8);
-            accumulator = _mm_add_ps(accumulator, aVal4); // accumulator += x
-
-            cVal1 = _mm_or_ps(cVal1, cVal2);
-            cVal3 = _mm_or_ps(cVal3, cVal4);
-            cVal1 = _mm_or_ps(cVal1, cVal3);
-
-            squareAccumulator =
-                _mm_add_ps(squareAccumulator, cVal1); // squareAccumulator += x^2
-        }
-        _mm_store_ps(meanBuffer,
-                     accumulator); // Store the results back into the C container
-        _mm_store_ps(squareBuffer,
-                     squareAccumulator); // Store the results back into the C container
-        newMean = meanBuffer[0];
-        newMean += meanBuffer[1];
-        newMean += meanBuffer[2];
-        newMean += meanBuffer[3];
-        returnValue = squareBuffer[0];
-        returnValue += squareBuffer[1];
-        returnValue += squareBuffer[2];
-        returnValue += squareBuffer[3];
-
-        number = sixteenthPoints * 16;
-        for (; number < num_points; number++) {
-            returnValue += (*aPtr) * (*aPtr);
-            newMean += *aPtr++;
-        }
-        newMean /= num_points;
-        returnValue /= num_points;
-        returnValue -= (newMean * newMean);
-        returnValue = sqrtf(returnValue);
+    const unsigned int thirtySecondPoints = num_points / 32;
+    const float* aPtr = inputBuffer;
+    __VOLK_ATTR_ALIGNED(64) float means[32];
+    __VOLK_ATTR_ALIGNED(64) float m2s[32];
+    __m512 mean0 = _mm512_setzero_ps(), mean1 = _mm512_setzero_ps();
+    __m512 m20 = _mm512_setzero_ps(), m21 = _mm512_setzero_ps();
+    __m512 x0, x1, delta0, delta1, rcp;
+    unsigned int number;
+
+    if (num_points == 0) {
+        *stddev = 0.f;
+        *mean = 0.f;
+        return;
     }
-    *stddev = returnValue;
-    *mean = newMean;
+
+    // two sets of 16 lanes, each lane sees every 32nd point
+    for (number = 1; number <= thirtySecondPoints; number++) {
+        rcp = _mm512_set1_ps(1.f / (float)number);
+        x0 = _mm512_loadu_ps(aPtr);
+        x1 = _mm512_loadu_ps(aPtr + 16);
+        aPtr += 32;
+        delta0 = _mm512_sub_ps(x0, mean0);
+        delta1 = _mm512_sub_ps(x1, mean1);
+        mean0 = _mm512_fmadd_ps(delta0, rcp, mean0);
+        mean1 = _mm512_fmadd_ps(delta1, rcp, mean1);
+        m20 = _mm512_fmadd_ps(delta0, _mm512_sub_ps(x0, mean0), m20);
+        m21 = _mm512_fmadd_ps(delta1, _mm512_sub_ps(x1, mean1), m21);
+    }
+    _mm512_store_ps(means, mean0);
+    _mm512_store_ps(means + 16, mean1);
+    _mm512_store_ps(m2s, m20);
+    _mm512_store_ps(m2s + 16, m21);
+
+    volk_32f_stddev_and_mean_finish(
+        stddev, mean, means, m2s, 32, thirtySecondPoints, inputBuffer, num_points);
 }
-#endif /* LV_HAVE_SSE4_1 */
+#endif /* LV_HAVE_AVX512F */
 
 
 #ifdef LV_HAVE_SSE
@@ -334,55 +286,94 @@ static inline void volk_32f_stddev_and_mean_32f_x2_a_sse(float* stddev,
                                                          const float* inputBuffer,
                                                          unsigned int num_points)
 {
-    float returnValue = 0;
-    float newMean = 0;
-    if (num_points > 0) {
-        unsigned int number = 0;
-        const unsigned int quarterPoints = num_points / 4;
-
-        const float* aPtr = inputBuffer;
-        __VOLK_ATTR_ALIGNED(16) float meanBuffer[4];
-        __VOLK_ATTR_ALIGNED(16) float squareBuffer[4];
-
-        __m128 accumulator = _mm_setzero_ps();
-        __m128 squareAccumulator = _mm_setzero_ps();
-        __m128 aVal = _mm_setzero_ps();
-        for (; number < quarterPoints; number++) {
-            aVal = _mm_load_ps(aPtr);                    // aVal = x
-            accumulator = _mm_add_ps(accumulator, aVal); // accumulator += x
-            aVal = _mm_mul_ps(aVal, aVal);               // squareAccumulator += x^2
-            squareAccumulator = _mm_add_ps(squareAccumulator, aVal);
-            aPtr += 4;
-        }
-        _mm_store_ps(meanBuffer,
-                     accumulator); // Store the results back into the C container
-        _mm_store_ps(squareBuffer,
-                     squareAccumulator); // Store the results back into the C container
-        newMean = meanBuffer[0];
-        newMean += meanBuffer[1];
-        newMean += meanBuffer[2];
-        newMean += meanBuffer[3];
-        returnValue = squareBuffer[0];
-        returnValue += squareBuffer[1];
-        returnValue += squareBuffer[2];
-        returnValue += squareBuffer[3];
-
-        number = quarterPoints * 4;
-        for (; number < num_points; number++) {
-            returnValue += (*aPtr) * (*aPtr);
-            newMean += *aPtr++;
-        }
-        newMean /= num_points;
-        returnValue /= num_points;
-        returnValue -= (newMean * newMean);
-        returnValue = sqrtf(returnValue);
+    const unsigned int eighthPoints = num_points / 8;
+    const float* aPtr = inputBuffer;
+    __VOLK_ATTR_ALIGNED(16) float means[8];
+    __VOLK_ATTR_ALIGNED(16) float m2s[8];
+    __m128 mean0 = _mm_setzero_ps(), mean1 = _mm_setzero_ps();
+    __m128 m20 = _mm_setzero_ps(), m21 = _mm_setzero_ps();
+    __m128 x0, x1, delta0, delta1, rcp;
+    unsigned int number;
+
+    if (num_points == 0) {
+        *stddev = 0.f;
+        *mean = 0.f;
+        return;
+    }
+
+    // two sets of 4 lanes, each lane sees every 8th point
+    for (number = 1; number <= eighthPoints; number++) {
+        rcp = _mm_set1_ps(1.f / (float)number);
+        x0 = _mm_load_ps(aPtr);
+        x1 = _mm_load_ps(aPtr + 4);
+        aPtr += 8;
+        delta0 = _mm_sub_ps(x0, mean0);
+        delta1 = _mm_sub_ps(x1, mean1);
+        mean0 = _mm_add_ps(mean0, _mm_mul_ps(delta0, rcp));
+        mean1 = _mm_add_ps(mean1, _mm_mul_ps(delta1, rcp));
+        m20 = _mm_add_ps(m20, _mm_mul_ps(delta0, _mm_sub_ps(x0, mean0)));
+        m21 = _mm_add_ps(m21, _mm_mul_ps(delta1, _mm_sub_ps(x1, mean1)));
     }
-    *stddev = returnValue;
-    *mean = newMean;
+    _mm_store_ps(means, mean0);
+    _mm_store_ps(means + 4, mean1);
+    _mm_store_ps(m2s, m20);
+    _mm_store_ps(m2s + 4, m21);
+
+    volk_32f_stddev_and_mean_finish(
+        stddev, mean, means, m2s, 8, eighthPoints, inputBuffer, num_points);
 }
 #endif /* LV_HAVE_SSE */
 
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_stddev_and_mean_32f_x2_neon(float* stddev,
+                                                        float* mean,
+                                                        const float* inputBuffer,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* aPtr = inputBuffer;
+    __VOLK_ATTR_ALIGNED(16) float means[8];
+    __VOLK_ATTR_ALIGNED(16) float m2s[8];
+    float32x4_t mean0 = vdupq_n_f32(0.f), mean1 = vdupq_n_f32(0.f);
+    float32x4_t m20 = vdupq_n_f32(0.f), m21 = vdupq_n_f32(0.f);
+    float32x4_t x0, x1, delta0, delta1;
+    float rcp;
+    unsigned int number;
+
+    if (num_points == 0) {
+        *stddev = 0.f;
+        *mean = 0.f;
+        return;
+    }
+
+    // two sets of 4 lanes, each lane sees every 8th point
+    for (number = 1; number <= eighthPoints; number++) {
+        rcp = 1.f / (float)number;
+        x0 = vld1q_f32(aPtr);
+        x1 = vld1q_f32(aPtr + 4);
+        __VOLK_PREFETCH(aPtr + 16);
+        aPtr += 8;
+        delta0 = vsubq_f32(x0, mean0);
+        delta1 = vsubq_f32(x1, mean1);
+        mean0 = vmlaq_n_f32(mean0, delta0, rcp);
+        mean1 = vmlaq_n_f32(mean1, delta1, rcp);
+        m20 = vmlaq_f32(m20, delta0, vsubq_f32(x0, mean0));
+        m21 = vmlaq_f32(m21, delta1, vsubq_f32(x1, mean1));
+    }
+    vst1q_f32(means, mean0);
+    vst1q_f32(means + 4, mean1);
+    vst1q_f32(m2s, m20);
+    vst1q_f32(m2s + 4, m21);
+
+    volk_32f_stddev_and_mean_finish(
+        stddev, mean, means, m2s, 8, eighthPoints, inputBuffer, num_points);
+}
+#endif /* LV_HAVE_NEON */
+
+
 #ifdef LV_HAVE_GENERIC
 
 static inline void volk_32f_stddev_and_mean_32f_x2_generic(float* stddev,
@@ -390,23 +381,23 @@ static inline void volk_32f_stddev_and_mean_32f_x2_generic(float* stddev,
                                                            const float* inputBuffer,
                                                            unsigned int num_points)
 {
-    float returnValue = 0;
-    float newMean = 0;
-    if (num_points > 0) {
-        const float* aPtr = inputBuffer;
-        unsigned int number = 0;
+    double sum = 0.0;
+    double squareSum = 0.0;
+    double newMean = 0.0;
+    double variance = 0.0;
+    unsigned int number;
 
+    // double keeps the sum of squares exact enough to serve as the reference
+    if (num_points > 0) {
         for (number = 0; number < num_points; number++) {
-            returnValue += (*aPtr) * (*aPtr);
-            newMean += *aPtr++;
+            sum += inputBuffer[number];
+            squareSum += (double)inputBuffer[number] * inputBuffer[number];
         }
-        newMean /= num_points;
-        returnValue /= num_points;
-        returnValue -= (newMean * newMean);
-        returnValue = sqrtf(returnValue);
+        newMean = sum / num_points;
+        variance = squareSum / num_points - newMean * newMean;
     }
-    *stddev = returnValue;
-    *mean = newMean;
+    *stddev = variance > 0.0 ? (float)sqrt(variance) : 0.f;
+    *mean = (float)newMean;
 }
 #endif /* LV_HAVE_GENERIC */
 
@@ -0,0 +1,146 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_stddev_and_mean_32f_x2.h'
+ */
+
+#ifndef INCLUDED_volk_32f_stddev_and_meanpuppet_32f_x2_H
+#define INCLUDED_volk_32f_stddev_and_meanpuppet_32f_x2_H
+
+#include <volk/volk.h>
+#include <volk/volk_32f_stddev_and_mean_32f_x2.h>
+
+/*
+ * Runs the kernel on the input shifted by a DC offset of 1000, where a
+ * single pass sum of squares cancels the whole variance in float.
+ */
+static inline void volk_stddev_and_mean_puppet(
+    void (*kernel)(float*, float*, const float*, unsigned int),
+    float* stddev,
+    float* mean,
+    const float* inputBuffer,
+    unsigned int num_points)
+{
+    float* shifted =
+        (float*)volk_malloc(sizeof(float) * num_points, volk_get_alignment());
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        shifted[number] = inputBuffer[number] + 1000.f;
+    }
+    kernel(stddev, mean, shifted, num_points);
+
+    volk_free(shifted);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32f_stddev_and_meanpuppet_32f_x2_generic(float* stddev,
+                                              float* mean,
+                                              const float* inputBuffer,
+                                              unsigned int num_points)
+{
+    volk_stddev_and_mean_puppet(
+        volk_32f_stddev_and_mean_32f_x2_generic, stddev, mean, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void
+volk_32f_stddev_and_meanpuppet_32f_x2_a_avx(float* stddev,
+                                            float* mean,
+                                            const float* inputBuffer,
+                                            unsigned int num_points)
+{
+    volk_stddev_and_mean_puppet(
+        volk_32f_stddev_and_mean_32f_x2_a_avx, stddev, mean, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void
+volk_32f_stddev_and_meanpuppet_32f_x2_u_avx(float* stddev,
+                                            float* mean,
+                                            const float* inputBuffer,
+                                            unsigned int num_points)
+{
+    volk_stddev_and_mean_puppet(
+        volk_32f_stddev_and_mean_32f_x2_u_avx, stddev, mean, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32f_stddev_and_meanpuppet_32f_x2_u_avx512f(float* stddev,
+                                                float* mean,
+                                                const float* inputBuffer,
+                                                unsigned int num_points)
+{
+    volk_stddev_and_mean_puppet(
+        volk_32f_stddev_and_mean_32f_x2_u_avx512f, stddev, mean, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void
+volk_32f_stddev_and_meanpuppet_32f_x2_a_sse(float* stddev,
+                                            float* mean,
+                                            const float* inputBuffer,
+                                            unsigned int num_points)
+{
+    volk_stddev_and_mean_puppet(
+        volk_32f_stddev_and_mean_32f_x2_a_sse, stddev, mean, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32f_stddev_and_meanpuppet_32f_x2_neon(float* stddev,
+                                           float* mean,
+                                           const float* inputBuffer,
+                                           unsigned int num_points)
+{
+    volk_stddev_and_mean_puppet(
+        volk_32f_stddev_and_mean_32f_x2_neon, stddev, mean, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_stddev_and_meanpuppet_32f_x2_H */
@@ -425,4 +425,47 @@ volk_32f_tanh_32f_u_avx_fma(float* cVector, const float* aVector, unsigned int n
 }
 #endif /* LV_HAVE_AVX && LV_HAVE_FMA */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32f_tanh_32f_neonv8(float* cVector, const float* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+
+    const float32x4_t const1 = vdupq_n_f32(135135.0f);
+    const float32x4_t const2 = vdupq_n_f32(17325.0f);
+    const float32x4_t const3 = vdupq_n_f32(378.0f);
+    const float32x4_t const4 = vdupq_n_f32(62370.0f);
+    const float32x4_t const5 = vdupq_n_f32(3150.0f);
+    const float32x4_t const6 = vdupq_n_f32(28.0f);
+    const float32x4_t ones = vdupq_n_f32(1.0f);
+    const float32x4_t minus_ones = vdupq_n_f32(-1.0f);
+    float32x4_t aVal[2], x2, a, b;
+    for (; number < eighthPoints; number++) {
+        aVal[0] = vld1q_f32(aPtr);
+        aVal[1] = vld1q_f32(aPtr + 4);
+        for (int k = 0; k < 2; k++) {
+            x2 = vmulq_f32(aVal[k], aVal[k]);
+            a = vmulq_f32(aVal[k],
+                          vfmaq_f32(const1, x2, vfmaq_f32(const2, x2, vaddq_f32(const3, x2))));
+            b = vfmaq_f32(const1, x2, vfmaq_f32(const4, x2, vfmaq_f32(const5, x2, const6)));
+            // the rational approximation overshoots past |x| = 4.97
+            vst1q_f32(cPtr + 4 * k,
+                      vmaxq_f32(vminq_f32(vdivq_f32(a, b), ones), minus_ones));
+        }
+
+        aPtr += 8;
+        cPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    volk_32f_tanh_32f_series(cPtr, aPtr, num_points - number);
+}
+#endif /* LV_HAVE_NEONV8 */
+
 #endif /* INCLUDED_volk_32f_tanh_32f_u_H */
@@ -0,0 +1,130 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_s32f_threshold_compress_32u.h'
+ */
+
+#ifndef INCLUDED_volk_32f_threshold_compresspuppet_32u_H
+#define INCLUDED_volk_32f_threshold_compresspuppet_32u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_32f_s32f_threshold_compress_32u.h>
+
+/*
+ * Picks the points above 0.5 and writes their number and then their indexes
+ * and value bit patterns, interleaved, as far as the outputs go.
+ */
+static inline void
+volk_32f_threshold_compress_puppet(void (*kernel)(uint32_t*,
+                                                  float*,
+                                                  uint32_t*,
+                                                  const float*,
+                                                  const float,
+                                                  unsigned int),
+                                   uint32_t* output,
+                                   const float* inputVector,
+                                   unsigned int num_points)
+{
+    const size_t alignment = volk_get_alignment();
+    uint32_t* indexes = (uint32_t*)volk_malloc(sizeof(uint32_t) * num_points, alignment);
+    float* values = (float*)volk_malloc(sizeof(float) * num_points, alignment);
+    uint32_t count = 0, point;
+
+    kernel(indexes, values, &count, inputVector, 0.5f, num_points);
+
+    memset(output, 0, sizeof(uint32_t) * num_points);
+    if (num_points > 0) {
+        output[0] = count;
+    }
+    for (point = 0; point < count && 2 * point + 2 < num_points; point++) {
+        output[2 * point + 1] = indexes[point];
+        memcpy(output + 2 * point + 2, values + point, sizeof(float));
+    }
+
+    volk_free(indexes);
+    volk_free(values);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_threshold_compresspuppet_32u_generic(uint32_t* output,
+                                                                 const float* inputVector,
+                                                                 unsigned int num_points)
+{
+    volk_32f_threshold_compress_puppet(volk_32f_s32f_threshold_compress_32u_generic,
+                                       output,
+                                       inputVector,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_threshold_compresspuppet_32u_u_avx(uint32_t* output,
+                                                               const float* inputVector,
+                                                               unsigned int num_points)
+{
+    volk_32f_threshold_compress_puppet(volk_32f_s32f_threshold_compress_32u_u_avx,
+                                       output,
+                                       inputVector,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_POPCOUNT
+
+static inline void
+volk_32f_threshold_compresspuppet_32u_u_avx512f(uint32_t* output,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    volk_32f_threshold_compress_puppet(volk_32f_s32f_threshold_compress_32u_u_avx512f,
+                                       output,
+                                       inputVector,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_POPCOUNT */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_threshold_compresspuppet_32u_neon(uint32_t* output,
+                                                              const float* inputVector,
+                                                              unsigned int num_points)
+{
+    volk_32f_threshold_compress_puppet(volk_32f_s32f_threshold_compress_32u_neon,
+                                       output,
+                                       inputVector,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_threshold_compresspuppet_32u_H */
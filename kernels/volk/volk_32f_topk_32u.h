@@ -0,0 +1,315 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_topk_32u
+ *
+ * \b Overview
+ *
+ * Finds the k largest points of the input: writes their indexes and values
+ * from the largest down, equal values in the order of their indexes. NaNs
+ * rank below every number, so they are only returned when fewer than k
+ * points are numbers.
+ *
+ * The k best points so far are kept in a heap in the outputs, its worst point
+ * at the root; the SIMD versions compare whole vectors with that point and
+ * only offer the heap the points which beat it. After the first few thousand
+ * points of a spectrum these are rare, so the cost approaches one compare per
+ * point.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_topk_32u(uint32_t* outputIndexes, float* outputValues, const float*
+ * inputVector, const unsigned int k, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The input vector.
+ * \li k: The number of points to find; all of them if num_points is smaller.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li outputIndexes: The indexes of the k largest points, the largest first.
+ * \li outputValues: Their values.
+ *
+ * \b Example
+ * The 8 strongest bins of a spectrum.
+ * \code
+ *   int N = 65536;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* power = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint32_t bins[8];
+ *   float levels[8];
+ *
+ *   // compute the power spectrum, then
+ *   volk_32f_topk_32u(bins, levels, power, 8, N);
+ *
+ *   for(unsigned int ii = 0; ii < 8; ++ii){
+ *       printf("bin %u power %g\n", bins[ii], levels[ii]);
+ *   }
+ *
+ *   volk_free(power);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_topk_32u_H
+#define INCLUDED_volk_32f_topk_32u_H
+
+#include <inttypes.h>
+#include <math.h>
+
+/* Whether the first point ranks below the second one */
+static inline int
+volk_topk_worse(float value0, uint32_t index0, float value1, uint32_t index1)
+{
+    return value0 < value1 || (value0 == value1 && index0 > index1);
+}
+
+static inline void
+volk_topk_sift_down(float* values, uint32_t* indexes, unsigned int k, unsigned int node)
+{
+    const float value = values[node];
+    const uint32_t index = indexes[node];
+    unsigned int child;
+
+    while ((child = 2 * node + 1) < k) {
+        if (child + 1 < k && volk_topk_worse(values[child + 1],
+                                             indexes[child + 1],
+                                             values[child],
+                                             indexes[child])) {
+            child++;
+        }
+        if (!volk_topk_worse(values[child], indexes[child], value, index)) {
+            break;
+        }
+        values[node] = values[child];
+        indexes[node] = indexes[child];
+        node = child;
+    }
+    values[node] = value;
+    indexes[node] = index;
+}
+
+/* Builds the heap of the first k points, NaNs ranked as -inf */
+static inline void volk_topk_start(float* values,
+                                   uint32_t* indexes,
+                                   const float* inputVector,
+                                   unsigned int k)
+{
+    unsigned int number;
+
+    for (number = 0; number < k; number++) {
+        values[number] = inputVector[number] == inputVector[number] ? inputVector[number]
+                                                                    : -INFINITY;
+        indexes[number] = number;
+    }
+    for (number = k / 2; number > 0; number--) {
+        volk_topk_sift_down(values, indexes, k, number - 1);
+    }
+}
+
+/*
+ * Replaces the worst point of the heap with a later point which beats it.
+ * A later point equal to it ranks below it, and a NaN beats nothing.
+ */
+static inline void volk_topk_offer(
+    float* values, uint32_t* indexes, unsigned int k, float value, uint32_t index)
+{
+    if (value > values[0]) {
+        values[0] = value;
+        indexes[0] = index;
+        volk_topk_sift_down(values, indexes, k, 0);
+    }
+}
+
+/* Sorts the heap from the best point down and restores the NaNs */
+static inline void volk_topk_finish(float* values,
+                                    uint32_t* indexes,
+                                    const float* inputVector,
+                                    unsigned int k)
+{
+    unsigned int last;
+    float value;
+    uint32_t index;
+
+    for (last = k - 1; last > 0; last--) {
+        value = values[0];
+        index = indexes[0];
+        values[0] = values[last];
+        indexes[0] = indexes[last];
+        values[last] = value;
+        indexes[last] = index;
+        volk_topk_sift_down(values, indexes, last, 0);
+    }
+    for (last = 0; last < k; last++) {
+        values[last] = inputVector[indexes[last]];
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_topk_32u_generic(uint32_t* outputIndexes,
+                                             float* outputValues,
+                                             const float* inputVector,
+                                             const unsigned int k,
+                                             unsigned int num_points)
+{
+    const unsigned int count = k < num_points ? k : num_points;
+    unsigned int number;
+
+    if (count == 0) {
+        return;
+    }
+
+    volk_topk_start(outputValues, outputIndexes, inputVector, count);
+    for (number = count; number < num_points; number++) {
+        volk_topk_offer(outputValues, outputIndexes, count, inputVector[number], number);
+    }
+    volk_topk_finish(outputValues, outputIndexes, inputVector, count);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_topk_32u_u_avx(uint32_t* outputIndexes,
+                                           float* outputValues,
+                                           const float* inputVector,
+                                           const unsigned int k,
+                                           unsigned int num_points)
+{
+    const unsigned int count = k < num_points ? k : num_points;
+    unsigned int number, lane;
+    __m256 values;
+    int mask;
+
+    if (count == 0) {
+        return;
+    }
+
+    volk_topk_start(outputValues, outputIndexes, inputVector, count);
+    for (number = count; num_points - number >= 8; number += 8) {
+        values = _mm256_loadu_ps(inputVector + number);
+        mask = _mm256_movemask_ps(
+            _mm256_cmp_ps(values, _mm256_set1_ps(outputValues[0]), _CMP_GT_OQ));
+        for (lane = 0; mask != 0; lane++, mask >>= 1) {
+            if (mask & 1) {
+                volk_topk_offer(outputValues,
+                                outputIndexes,
+                                count,
+                                inputVector[number + lane],
+                                number + lane);
+            }
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_topk_offer(outputValues, outputIndexes, count, inputVector[number], number);
+    }
+    volk_topk_finish(outputValues, outputIndexes, inputVector, count);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_topk_32u_u_avx512f(uint32_t* outputIndexes,
+                                               float* outputValues,
+                                               const float* inputVector,
+                                               const unsigned int k,
+                                               unsigned int num_points)
+{
+    const unsigned int count = k < num_points ? k : num_points;
+    unsigned int number, lane, mask;
+
+    if (count == 0) {
+        return;
+    }
+
+    volk_topk_start(outputValues, outputIndexes, inputVector, count);
+    for (number = count; num_points - number >= 16; number += 16) {
+        mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(inputVector + number),
+                                  _mm512_set1_ps(outputValues[0]),
+                                  _CMP_GT_OQ);
+        for (lane = 0; mask != 0; lane++, mask >>= 1) {
+            if (mask & 1) {
+                volk_topk_offer(outputValues,
+                                outputIndexes,
+                                count,
+                                inputVector[number + lane],
+                                number + lane);
+            }
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_topk_offer(outputValues, outputIndexes, count, inputVector[number], number);
+    }
+    volk_topk_finish(outputValues, outputIndexes, inputVector, count);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_topk_32u_neon(uint32_t* outputIndexes,
+                                          float* outputValues,
+                                          const float* inputVector,
+                                          const unsigned int k,
+                                          unsigned int num_points)
+{
+    const unsigned int count = k < num_points ? k : num_points;
+    unsigned int number, lane;
+    uint32x4_t beats;
+    uint32x2_t any;
+
+    if (count == 0) {
+        return;
+    }
+
+    volk_topk_start(outputValues, outputIndexes, inputVector, count);
+    for (number = count; num_points - number >= 4; number += 4) {
+        beats = vcgtq_f32(vld1q_f32(inputVector + number), vdupq_n_f32(outputValues[0]));
+        any = vorr_u32(vget_low_u32(beats), vget_high_u32(beats));
+        if (vget_lane_u32(vpmax_u32(any, any), 0) == 0) {
+            continue;
+        }
+        for (lane = 0; lane < 4; lane++) {
+            volk_topk_offer(outputValues,
+                            outputIndexes,
+                            count,
+                            inputVector[number + lane],
+                            number + lane);
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_topk_offer(outputValues, outputIndexes, count, inputVector[number], number);
+    }
+    volk_topk_finish(outputValues, outputIndexes, inputVector, count);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_topk_32u_H */
@@ -0,0 +1,110 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_topk_32u.h'
+ */
+
+#ifndef INCLUDED_volk_32f_topkpuppet_32u_H
+#define INCLUDED_volk_32f_topkpuppet_32u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_32f_topk_32u.h>
+
+/*
+ * Finds the top min(num_points / 2, 64) points and writes their indexes and
+ * value bit patterns, interleaved.
+ */
+static inline void
+volk_32f_topk_puppet(void (*kernel)(uint32_t*,
+                                    float*,
+                                    const float*,
+                                    const unsigned int,
+                                    unsigned int),
+                     uint32_t* output,
+                     const float* inputVector,
+                     unsigned int num_points)
+{
+    const unsigned int k = num_points / 2 < 64 ? num_points / 2 : 64;
+    uint32_t indexes[64];
+    float values[64];
+    unsigned int point;
+
+    kernel(indexes, values, inputVector, k, num_points);
+
+    memset(output, 0, sizeof(uint32_t) * num_points);
+    for (point = 0; point < k; point++) {
+        output[2 * point] = indexes[point];
+        memcpy(output + 2 * point + 1, values + point, sizeof(float));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_topkpuppet_32u_generic(uint32_t* output,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    volk_32f_topk_puppet(volk_32f_topk_32u_generic, output, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_topkpuppet_32u_u_avx(uint32_t* output,
+                                                 const float* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_topk_puppet(volk_32f_topk_32u_u_avx, output, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_topkpuppet_32u_u_avx512f(uint32_t* output,
+                                                     const float* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_32f_topk_puppet(volk_32f_topk_32u_u_avx512f, output, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_topkpuppet_32u_neon(uint32_t* output,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    volk_32f_topk_puppet(volk_32f_topk_32u_neon, output, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_topkpuppet_32u_H */
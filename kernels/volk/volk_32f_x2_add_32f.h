@@ -372,6 +372,24 @@ static inline void volk_32f_x2_add_32f_u_neon(float* cVector,
 
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_x2_add_32f_rvv(float* cVector,
+                                           const float* aVector,
+                                           const float* bVector,
+                                           unsigned int num_points)
+{
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, aVector += vl, bVector += vl, cVector += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        const vfloat32m8_t va = __riscv_vle32_v_f32m8(aVector, vl);
+        const vfloat32m8_t vb = __riscv_vle32_v_f32m8(bVector, vl);
+        __riscv_vse32_v_f32m8(cVector, __riscv_vfadd_vv_f32m8(va, vb, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 #ifdef LV_HAVE_NEONV7
 extern void volk_32f_x2_add_32f_a_neonasm(float* cVector,
                                           const float* aVector,
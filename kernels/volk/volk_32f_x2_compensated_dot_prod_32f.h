@@ -0,0 +1,244 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x2_compensated_dot_prod_32f
+ *
+ * \b Overview
+ *
+ * Computes the dot product of two float vectors like volk_32f_x2_dot_prod_32f,
+ * but without the error growing with the length, for long integrations which
+ * would otherwise be promoted to double.
+ *
+ * All versions widen the inputs to double, where the product of two floats
+ * is exact, and sum the products in double lanes. A compensated float sum
+ * of the float products is not enough: their rounding stays in the result,
+ * which leaves few correct digits of a dot product that nearly cancels.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_compensated_dot_prod_32f(float* result, const float* input,
+ * const float* taps, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The first input vector.
+ * \li taps: The second input vector.
+ * \li num_points: The number of values in both vectors.
+ *
+ * \b Outputs
+ * \li result: The dot product.
+ *
+ * \b Example
+ * Correlate a long capture against a reference.
+ * \code
+ *   int N = 1 << 24;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* capture = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* reference = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float correlation;
+ *
+ *   // fill capture and reference, then
+ *   volk_32f_x2_compensated_dot_prod_32f(&correlation, capture, reference, N);
+ *
+ *   printf("correlation %g\n", correlation);
+ *
+ *   volk_free(capture);
+ *   volk_free(reference);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_compensated_dot_prod_32f_H
+#define INCLUDED_volk_32f_x2_compensated_dot_prod_32f_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_compensated_dot_prod_32f_generic(float* result,
+                                                                const float* input,
+                                                                const float* taps,
+                                                                unsigned int num_points)
+{
+    double sum = 0.0;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        sum += (double)input[number] * (double)taps[number];
+    }
+    *result = (float)sum;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32f_x2_compensated_dot_prod_32f_u_sse2(float* result,
+                                                               const float* input,
+                                                               const float* taps,
+                                                               unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* aPtr = input;
+    const float* bPtr = taps;
+    __m128d sum0 = _mm_setzero_pd(), sum1 = _mm_setzero_pd();
+    __m128 a, b;
+    __VOLK_ATTR_ALIGNED(16) double laneSums[2];
+    unsigned int number;
+    double total;
+
+    for (number = 0; number < quarterPoints; number++) {
+        a = _mm_loadu_ps(aPtr);
+        b = _mm_loadu_ps(bPtr);
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_cvtps_pd(a), _mm_cvtps_pd(b)));
+        a = _mm_movehl_ps(a, a);
+        b = _mm_movehl_ps(b, b);
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_cvtps_pd(a), _mm_cvtps_pd(b)));
+        aPtr += 4;
+        bPtr += 4;
+    }
+
+    _mm_store_pd(laneSums, _mm_add_pd(sum0, sum1));
+    total = laneSums[0] + laneSums[1];
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        total += (double)input[number] * (double)taps[number];
+    }
+    *result = (float)total;
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x2_compensated_dot_prod_32f_u_avx(float* result,
+                                                              const float* input,
+                                                              const float* taps,
+                                                              unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* aPtr = input;
+    const float* bPtr = taps;
+    __m256d sum0 = _mm256_setzero_pd(), sum1 = _mm256_setzero_pd();
+    __VOLK_ATTR_ALIGNED(32) double laneSums[4];
+    unsigned int number;
+    double total;
+
+    for (number = 0; number < eighthPoints; number++) {
+        sum0 = _mm256_add_pd(sum0,
+                             _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(aPtr)),
+                                           _mm256_cvtps_pd(_mm_loadu_ps(bPtr))));
+        sum1 = _mm256_add_pd(sum1,
+                             _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(aPtr + 4)),
+                                           _mm256_cvtps_pd(_mm_loadu_ps(bPtr + 4))));
+        aPtr += 8;
+        bPtr += 8;
+    }
+
+    _mm256_store_pd(laneSums, _mm256_add_pd(sum0, sum1));
+    total = (laneSums[0] + laneSums[1]) + (laneSums[2] + laneSums[3]);
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        total += (double)input[number] * (double)taps[number];
+    }
+    *result = (float)total;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_compensated_dot_prod_32f_u_avx512f(float* result,
+                                               const float* input,
+                                               const float* taps,
+                                               unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* aPtr = input;
+    const float* bPtr = taps;
+    __m512d sum0 = _mm512_setzero_pd(), sum1 = _mm512_setzero_pd();
+    unsigned int number;
+    double total;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        sum0 = _mm512_add_pd(sum0,
+                             _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(aPtr)),
+                                           _mm512_cvtps_pd(_mm256_loadu_ps(bPtr))));
+        sum1 = _mm512_add_pd(sum1,
+                             _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(aPtr + 8)),
+                                           _mm512_cvtps_pd(_mm256_loadu_ps(bPtr + 8))));
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    total = _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1));
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        total += (double)input[number] * (double)taps[number];
+    }
+    *result = (float)total;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_compensated_dot_prod_32f_neonv8(float* result,
+                                                               const float* input,
+                                                               const float* taps,
+                                                               unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* aPtr = input;
+    const float* bPtr = taps;
+    float64x2_t sum0 = vdupq_n_f64(0.0), sum1 = vdupq_n_f64(0.0);
+    float32x4_t a, b;
+    unsigned int number;
+    double total;
+
+    for (number = 0; number < quarterPoints; number++) {
+        a = vld1q_f32(aPtr);
+        b = vld1q_f32(bPtr);
+        sum0 = vaddq_f64(sum0,
+                         vmulq_f64(vcvt_f64_f32(vget_low_f32(a)),
+                                   vcvt_f64_f32(vget_low_f32(b))));
+        sum1 = vaddq_f64(sum1, vmulq_f64(vcvt_high_f64_f32(a), vcvt_high_f64_f32(b)));
+        aPtr += 4;
+        bPtr += 4;
+    }
+
+    total = vaddvq_f64(vaddq_f64(sum0, sum1));
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        total += (double)input[number] * (double)taps[number];
+    }
+    *result = (float)total;
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_x2_compensated_dot_prod_32f_H */
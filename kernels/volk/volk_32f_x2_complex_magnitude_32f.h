@@ -0,0 +1,186 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x2_complex_magnitude_32f
+ *
+ * \b Overview
+ *
+ * Calculates the magnitude of a complex vector held as separate real and
+ * imaginary planes, structure of arrays:
+ *
+ * magnitudeVector[n] = sqrt(realVector[n]^2 + imagVector[n]^2)
+ *
+ * The lanes line up without the shuffles that volk_32fc_magnitude_32f needs
+ * to gather the parts of interleaved samples, and the sum of squares is a
+ * fused multiply-add.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_complex_magnitude_32f(float* magnitudeVector,
+ * const float* realVector, const float* imagVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li realVector: The real parts.
+ * \li imagVector: The imaginary parts.
+ * \li num_points: The number of complex values.
+ *
+ * \b Outputs
+ * \li magnitudeVector: The magnitudes.
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* re = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float* im = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float* magnitude = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       re[ii] = 3.f * ii;
+ *       im[ii] = 4.f * ii;
+ *   }
+ *
+ *   // 5, 10, 15, ...
+ *   volk_32f_x2_complex_magnitude_32f(magnitude, re, im, N);
+ *
+ *   volk_free(re);
+ *   volk_free(im);
+ *   volk_free(magnitude);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_complex_magnitude_32f_H
+#define INCLUDED_volk_32f_x2_complex_magnitude_32f_H
+
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_complex_magnitude_32f_generic(float* magnitudeVector,
+                                                             const float* realVector,
+                                                             const float* imagVector,
+                                                             unsigned int num_points)
+{
+    unsigned int i;
+
+    for (i = 0; i < num_points; i++) {
+        magnitudeVector[i] =
+            sqrtf(realVector[i] * realVector[i] + imagVector[i] * imagVector[i]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_u_avx2_fma(float* magnitudeVector,
+                                                                const float* realVector,
+                                                                const float* imagVector,
+                                                                unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+    __m256 re, im;
+
+    for (number = 0; number < eighth_points; number++) {
+        re = _mm256_loadu_ps(realVector);
+        im = _mm256_loadu_ps(imagVector);
+        _mm256_storeu_ps(magnitudeVector,
+                         _mm256_sqrt_ps(_mm256_fmadd_ps(re, re, _mm256_mul_ps(im, im))));
+        realVector += 8;
+        imagVector += 8;
+        magnitudeVector += 8;
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        *magnitudeVector++ =
+            sqrtf(*realVector * *realVector + *imagVector * *imagVector);
+        realVector++;
+        imagVector++;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_u_avx512f(float* magnitudeVector,
+                                                               const float* realVector,
+                                                               const float* imagVector,
+                                                               unsigned int num_points)
+{
+    unsigned int number;
+    __m512 re, im;
+    __mmask16 mask = 0xffff;
+
+    for (number = 0; number < num_points; number += 16) {
+        if (num_points - number < 16) {
+            mask = (__mmask16)((1u << (num_points - number)) - 1);
+        }
+        re = _mm512_maskz_loadu_ps(mask, realVector + number);
+        im = _mm512_maskz_loadu_ps(mask, imagVector + number);
+        re = _mm512_fmadd_ps(re, re, _mm512_mul_ps(im, im));
+        _mm512_mask_storeu_ps(magnitudeVector + number, mask, _mm512_sqrt_ps(re));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_complex_magnitude_32f_neonv8(float* magnitudeVector,
+                                                            const float* realVector,
+                                                            const float* imagVector,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+    float32x4_t re, im;
+
+    for (number = 0; number < quarter_points; number++) {
+        re = vld1q_f32(realVector);
+        im = vld1q_f32(imagVector);
+        vst1q_f32(magnitudeVector, vsqrtq_f32(vfmaq_f32(vmulq_f32(im, im), re, re)));
+        realVector += 4;
+        imagVector += 4;
+        magnitudeVector += 4;
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        *magnitudeVector++ =
+            sqrtf(*realVector * *realVector + *imagVector * *imagVector);
+        realVector++;
+        imagVector++;
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_x2_complex_magnitude_32f_H */
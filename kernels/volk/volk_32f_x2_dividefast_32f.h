@@ -0,0 +1,274 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x2_dividefast_32f
+ *
+ * \b Overview
+ *
+ * Divides aVector by bVector as volk_32f_x2_divide_32f does, but multiplies by
+ * the reciprocal estimate of each divisor, refined by one Newton-Raphson step,
+ * instead of dividing. The result is within a few ulp on x86 (rcpps and
+ * vrcp14ps) and within about 2e-5 on NEON (vrecpe).
+ *
+ * The divisors must be nonzero and of magnitude below 2^126; zero and infinite
+ * divisors give NaN. volk_32f_x2_divide_32f runs this kernel when the
+ * volk_set_precision budget allows it.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_dividefast_32f(float* cVector, const float* aVector,
+ *                                 const float* bVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The dividends.
+ * \li bVector: The divisors.
+ * \li num_points: The number of values in both input vectors.
+ *
+ * \b Outputs
+ * \li cVector: The quotients.
+ *
+ * \b Example
+ * Normalise a power spectrum by its noise floor estimate.
+ * \code
+ *   volk_32f_x2_dividefast_32f(snr, power, noise_floor, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_dividefast_32f_H
+#define INCLUDED_volk_32f_x2_dividefast_32f_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_dividefast_32f_generic(float* cVector,
+                                                      const float* aVector,
+                                                      const float* bVector,
+                                                      unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        cVector[number] = aVector[number] / bVector[number];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_dividefast_32f_a_avx512f(float* cVector,
+                                                        const float* aVector,
+                                                        const float* bVector,
+                                                        unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const float* bPtr = bVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    const __m512 two = _mm512_set1_ps(2.0f);
+    __m512 aVal, bVal, bInv;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        aVal = _mm512_load_ps(aPtr);
+        bVal = _mm512_load_ps(bPtr);
+
+        // 1/b to 14 bits, then one Newton step: x (2 - b x)
+        bInv = _mm512_rcp14_ps(bVal);
+        bInv = _mm512_mul_ps(bInv, _mm512_fnmadd_ps(bVal, bInv, two));
+
+        _mm512_store_ps(cPtr, _mm512_mul_ps(aVal, bInv));
+
+        aPtr += 16;
+        bPtr += 16;
+        cPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_dividefast_32f_u_avx512f(float* cVector,
+                                                        const float* aVector,
+                                                        const float* bVector,
+                                                        unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const float* bPtr = bVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    const __m512 two = _mm512_set1_ps(2.0f);
+    __m512 aVal, bVal, bInv;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        aVal = _mm512_loadu_ps(aPtr);
+        bVal = _mm512_loadu_ps(bPtr);
+
+        // 1/b to 14 bits, then one Newton step: x (2 - b x)
+        bInv = _mm512_rcp14_ps(bVal);
+        bInv = _mm512_mul_ps(bInv, _mm512_fnmadd_ps(bVal, bInv, two));
+
+        _mm512_storeu_ps(cPtr, _mm512_mul_ps(aVal, bInv));
+
+        aPtr += 16;
+        bPtr += 16;
+        cPtr += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x2_dividefast_32f_a_avx(float* cVector,
+                                                    const float* aVector,
+                                                    const float* bVector,
+                                                    unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const float* bPtr = bVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const __m256 two = _mm256_set1_ps(2.0f);
+    __m256 aVal, bVal, bInv;
+
+    for (number = 0; number < eighthPoints; number++) {
+        aVal = _mm256_load_ps(aPtr);
+        bVal = _mm256_load_ps(bPtr);
+
+        // 1/b to 12 bits, then one Newton step: x (2 - b x)
+        bInv = _mm256_rcp_ps(bVal);
+        bInv = _mm256_mul_ps(bInv, _mm256_sub_ps(two, _mm256_mul_ps(bVal, bInv)));
+
+        _mm256_store_ps(cPtr, _mm256_mul_ps(aVal, bInv));
+
+        aPtr += 8;
+        bPtr += 8;
+        cPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x2_dividefast_32f_u_avx(float* cVector,
+                                                    const float* aVector,
+                                                    const float* bVector,
+                                                    unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const float* bPtr = bVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const __m256 two = _mm256_set1_ps(2.0f);
+    __m256 aVal, bVal, bInv;
+
+    for (number = 0; number < eighthPoints; number++) {
+        aVal = _mm256_loadu_ps(aPtr);
+        bVal = _mm256_loadu_ps(bPtr);
+
+        // 1/b to 12 bits, then one Newton step: x (2 - b x)
+        bInv = _mm256_rcp_ps(bVal);
+        bInv = _mm256_mul_ps(bInv, _mm256_sub_ps(two, _mm256_mul_ps(bVal, bInv)));
+
+        _mm256_storeu_ps(cPtr, _mm256_mul_ps(aVal, bInv));
+
+        aPtr += 8;
+        bPtr += 8;
+        cPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_dividefast_32f_neon(float* cVector,
+                                                   const float* aVector,
+                                                   const float* bVector,
+                                                   unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* aPtr = aVector;
+    const float* bPtr = bVector;
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number;
+
+    float32x4_t aVal, bVal, bInv;
+
+    for (number = 0; number < quarterPoints; number++) {
+        aVal = vld1q_f32(aPtr);
+        bVal = vld1q_f32(bPtr);
+
+        bInv = vrecpeq_f32(bVal);
+        bInv = vmulq_f32(bInv, vrecpsq_f32(bInv, bVal));
+
+        vst1q_f32(cPtr, vmulq_f32(aVal, bInv));
+
+        aPtr += 4;
+        bPtr += 4;
+        cPtr += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_dividefast_32f_H */
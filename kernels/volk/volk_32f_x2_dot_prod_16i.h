@@ -691,5 +691,47 @@ static inline void volk_32f_x2_dot_prod_16i_u_avx512f(int16_t* result,
 
 #endif /*LV_HAVE_AVX512F*/
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_dot_prod_16i_neonv8(int16_t* result,
+                                                   const float* input,
+                                                   const float* taps,
+                                                   unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = input;
+    const float* bPtr = taps;
+
+    float32x4_t dotProdVal0 = vdupq_n_f32(0.0f);
+    float32x4_t dotProdVal1 = vdupq_n_f32(0.0f);
+    float32x4_t dotProdVal2 = vdupq_n_f32(0.0f);
+    float32x4_t dotProdVal3 = vdupq_n_f32(0.0f);
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        dotProdVal0 = vfmaq_f32(dotProdVal0, vld1q_f32(aPtr), vld1q_f32(bPtr));
+        dotProdVal1 = vfmaq_f32(dotProdVal1, vld1q_f32(aPtr + 4), vld1q_f32(bPtr + 4));
+        dotProdVal2 = vfmaq_f32(dotProdVal2, vld1q_f32(aPtr + 8), vld1q_f32(bPtr + 8));
+        dotProdVal3 = vfmaq_f32(dotProdVal3, vld1q_f32(aPtr + 12), vld1q_f32(bPtr + 12));
+
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    dotProdVal0 = vaddq_f32(dotProdVal0, dotProdVal1);
+    dotProdVal2 = vaddq_f32(dotProdVal2, dotProdVal3);
+    float dotProduct = vaddvq_f32(vaddq_f32(dotProdVal0, dotProdVal2));
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        dotProduct += ((*aPtr++) * (*bPtr++));
+    }
+
+    *result = (int16_t)dotProduct;
+}
+
+#endif /*LV_HAVE_NEONV8*/
+
 
 #endif /*INCLUDED_volk_32f_x2_dot_prod_16i_H*/
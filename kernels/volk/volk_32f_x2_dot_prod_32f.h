@@ -430,6 +430,64 @@ static inline void volk_32f_x2_dot_prod_32f_u_avx2_fma(float* result,
 }
 #endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+/* A template for impl_variants in gen/volk_kernel_defs.py, built as
+ * u_avx2_fma_acc2, u_avx2_fma_acc4 and u_avx2_fma_acc8: n_acc independent
+ * sums, at most 8, keep as many FMAs in flight as the core has room for. */
+static inline void volk_32f_x2_dot_prod_32f_u_avx2_fma_acc(float* result,
+                                                           const float* input,
+                                                           const float* taps,
+                                                           unsigned int num_points,
+                                                           const unsigned int n_acc)
+{
+    unsigned int number, k;
+    const unsigned int block = 8 * n_acc;
+    const unsigned int blocks = num_points / block;
+
+    const float* aPtr = input;
+    const float* bPtr = taps;
+
+    __m256 dotProdVal[8];
+    for (k = 0; k < n_acc; k++) {
+        dotProdVal[k] = _mm256_setzero_ps();
+    }
+
+    for (number = 0; number < blocks; number++) {
+        for (k = 0; k < n_acc; k++) {
+            dotProdVal[k] = _mm256_fmadd_ps(_mm256_loadu_ps(aPtr + 8 * k),
+                                            _mm256_loadu_ps(bPtr + 8 * k),
+                                            dotProdVal[k]);
+        }
+        aPtr += block;
+        bPtr += block;
+    }
+    for (number = blocks * block; number + 8 <= num_points; number += 8) {
+        dotProdVal[0] =
+            _mm256_fmadd_ps(_mm256_loadu_ps(aPtr), _mm256_loadu_ps(bPtr), dotProdVal[0]);
+        aPtr += 8;
+        bPtr += 8;
+    }
+    for (k = 1; k < n_acc; k++) {
+        dotProdVal[0] = _mm256_add_ps(dotProdVal[0], dotProdVal[k]);
+    }
+
+    __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
+    _mm256_store_ps(dotProductVector, dotProdVal[0]);
+    _mm256_zeroupper();
+
+    float dotProduct = dotProductVector[0] + dotProductVector[1] + dotProductVector[2] +
+                       dotProductVector[3] + dotProductVector[4] + dotProductVector[5] +
+                       dotProductVector[6] + dotProductVector[7];
+
+    for (; number < num_points; number++) {
+        dotProduct += ((*aPtr++) * (*bPtr++));
+    }
+
+    *result = dotProduct;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
 #if LV_HAVE_AVX512F
 #include <immintrin.h>
 static inline void volk_32f_x2_dot_prod_32f_u_avx512f(float* result,
@@ -974,6 +1032,123 @@ static inline void volk_32f_x2_dot_prod_32f_neon(float* result,
 
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+/* A template for impl_variants in gen/volk_kernel_defs.py, built as
+ * neonv8_acc2, neonv8_acc4 and neonv8_acc8: n_acc independent sums, at most
+ * 8. The loop is software pipelined as the ARMv7 neonasm_opts is: the FMAs of
+ * a block use the operands loaded during the block before, so the loads of
+ * the next block issue while they wait out the FMA latency. */
+static inline void volk_32f_x2_dot_prod_32f_neonv8_acc(float* result,
+                                                       const float* input,
+                                                       const float* taps,
+                                                       unsigned int num_points,
+                                                       const unsigned int n_acc)
+{
+    unsigned int number, k;
+    const unsigned int block = 4 * n_acc;
+    const unsigned int blocks = num_points / block;
+
+    const float* aPtr = input;
+    const float* bPtr = taps;
+
+    float32x4_t acc[8], a[8], b[8];
+    for (k = 0; k < n_acc; k++) {
+        acc[k] = vdupq_n_f32(0.0f);
+    }
+
+    if (blocks) {
+        for (k = 0; k < n_acc; k++) {
+            a[k] = vld1q_f32(aPtr + 4 * k);
+            b[k] = vld1q_f32(bPtr + 4 * k);
+        }
+        for (number = 1; number < blocks; number++) {
+            aPtr += block;
+            bPtr += block;
+            for (k = 0; k < n_acc; k++) {
+                acc[k] = vfmaq_f32(acc[k], a[k], b[k]);
+                a[k] = vld1q_f32(aPtr + 4 * k);
+                b[k] = vld1q_f32(bPtr + 4 * k);
+            }
+        }
+        for (k = 0; k < n_acc; k++) {
+            acc[k] = vfmaq_f32(acc[k], a[k], b[k]);
+        }
+        aPtr += block;
+        bPtr += block;
+    }
+    for (number = blocks * block; number + 4 <= num_points; number += 4) {
+        acc[0] = vfmaq_f32(acc[0], vld1q_f32(aPtr), vld1q_f32(bPtr));
+        aPtr += 4;
+        bPtr += 4;
+    }
+    for (k = 1; k < n_acc; k++) {
+        acc[0] = vaddq_f32(acc[0], acc[k]);
+    }
+
+    float dotProduct = vaddvq_f32(acc[0]);
+
+    for (; number < num_points; number++) {
+        dotProduct += ((*aPtr++) * (*bPtr++));
+    }
+
+    *result = dotProduct;
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32f_x2_dot_prod_32f_sve(float* result,
+                                                const float* input,
+                                                const float* taps,
+                                                unsigned int num_points)
+{
+    const unsigned int vl = svcntw();
+    const svbool_t all = svptrue_b32();
+    svfloat32_t acc0 = svdup_n_f32(0.f);
+    svfloat32_t acc1 = svdup_n_f32(0.f);
+    unsigned int number = 0;
+
+    // two accumulators hide the latency of the fused multiply adds
+    for (; number + 2 * vl <= num_points; number += 2 * vl) {
+        acc0 = svmla_f32_x(all, acc0, svld1_f32(all, input + number), svld1_f32(all, taps + number));
+        acc1 = svmla_f32_x(
+            all, acc1, svld1_f32(all, input + number + vl), svld1_f32(all, taps + number + vl));
+    }
+
+    for (; number < num_points; number += vl) {
+        const svbool_t pg = svwhilelt_b32_u32(number, num_points);
+        acc0 = svmla_f32_m(pg, acc0, svld1_f32(pg, input + number), svld1_f32(pg, taps + number));
+    }
+
+    *result = svaddv_f32(all, svadd_f32_x(all, acc0, acc1));
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_x2_dot_prod_32f_rvv(float* result,
+                                                const float* input,
+                                                const float* taps,
+                                                unsigned int num_points)
+{
+    // one partial sum per lane, the tail undisturbed on the last short pass
+    vfloat32m8_t acc = __riscv_vfmv_v_f_f32m8(0.f, __riscv_vsetvlmax_e32m8());
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, input += vl, taps += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        const vfloat32m8_t a = __riscv_vle32_v_f32m8(input, vl);
+        const vfloat32m8_t b = __riscv_vle32_v_f32m8(taps, vl);
+        acc = __riscv_vfmacc_vv_f32m8_tu(acc, a, b, vl);
+    }
+    const size_t vlmax = __riscv_vsetvlmax_e32m8();
+    *result = __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredusum_vs_f32m8_f32m1(
+        acc, __riscv_vfmv_s_f_f32m1(0.f, 1), vlmax));
+}
+#endif /* LV_HAVE_RVV */
+
 #ifdef LV_HAVE_NEONV7
 extern void volk_32f_x2_dot_prod_32f_a_neonasm(float* cVector,
                                                const float* aVector,
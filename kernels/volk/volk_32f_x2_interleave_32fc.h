@@ -76,6 +76,48 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_interleave_32fc_a_avx512f(lv_32fc_t* complexVector,
+                                                         const float* iBuffer,
+                                                         const float* qBuffer,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i lowIdx =
+        _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i highIdx =
+        _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    float* out = (float*)complexVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512 iValue = _mm512_load_ps(iBuffer);
+        const __m512 qValue = _mm512_load_ps(qBuffer);
+        _mm512_store_ps(out, _mm512_permutex2var_ps(iValue, lowIdx, qValue));
+        _mm512_store_ps(out + 16, _mm512_permutex2var_ps(iValue, highIdx, qValue));
+        iBuffer += 16;
+        qBuffer += 16;
+        out += 32;
+    }
+
+    // the last points with masked stores, two floats a point split over two registers
+    const unsigned int remaining = num_points & 15;
+    const unsigned int low = remaining < 8 ? remaining : 8;
+    const __mmask16 mask0 = _cvtu32_mask16((1u << (2 * low)) - 1);
+    const __mmask16 mask1 = _cvtu32_mask16((1u << (2 * (remaining - low))) - 1);
+    const __mmask16 mask = _cvtu32_mask16((1u << remaining) - 1);
+    const __m512 iValue = _mm512_maskz_load_ps(mask, iBuffer);
+    const __m512 qValue = _mm512_maskz_load_ps(mask, qBuffer);
+    const __m512 cplxValue0 = _mm512_permutex2var_ps(iValue, lowIdx, qValue);
+    const __m512 cplxValue1 = _mm512_permutex2var_ps(iValue, highIdx, qValue);
+    _mm512_mask_store_ps(out, mask0, cplxValue0);
+    _mm512_mask_store_ps(out + 16, mask1, cplxValue1);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
@@ -223,6 +265,48 @@ static inline void volk_32f_x2_interleave_32fc_generic(lv_32fc_t* complexVector,
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_interleave_32fc_u_avx512f(lv_32fc_t* complexVector,
+                                                         const float* iBuffer,
+                                                         const float* qBuffer,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i lowIdx =
+        _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i highIdx =
+        _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    float* out = (float*)complexVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512 iValue = _mm512_loadu_ps(iBuffer);
+        const __m512 qValue = _mm512_loadu_ps(qBuffer);
+        _mm512_storeu_ps(out, _mm512_permutex2var_ps(iValue, lowIdx, qValue));
+        _mm512_storeu_ps(out + 16, _mm512_permutex2var_ps(iValue, highIdx, qValue));
+        iBuffer += 16;
+        qBuffer += 16;
+        out += 32;
+    }
+
+    // the last points with masked stores, two floats a point split over two registers
+    const unsigned int remaining = num_points & 15;
+    const unsigned int low = remaining < 8 ? remaining : 8;
+    const __mmask16 mask0 = _cvtu32_mask16((1u << (2 * low)) - 1);
+    const __mmask16 mask1 = _cvtu32_mask16((1u << (2 * (remaining - low))) - 1);
+    const __mmask16 mask = _cvtu32_mask16((1u << remaining) - 1);
+    const __m512 iValue = _mm512_maskz_loadu_ps(mask, iBuffer);
+    const __m512 qValue = _mm512_maskz_loadu_ps(mask, qBuffer);
+    const __m512 cplxValue0 = _mm512_permutex2var_ps(iValue, lowIdx, qValue);
+    const __m512 cplxValue1 = _mm512_permutex2var_ps(iValue, highIdx, qValue);
+    _mm512_mask_storeu_ps(out, mask0, cplxValue0);
+    _mm512_mask_storeu_ps(out + 16, mask1, cplxValue1);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
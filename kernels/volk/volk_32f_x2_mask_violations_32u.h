@@ -0,0 +1,273 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x2_mask_violations_32u
+ *
+ * \b Overview
+ *
+ * Checks a power spectrum against a mask of per bin limits in one pass:
+ * writes the indexes of the bins above their limit, in order, their number,
+ * and the worst margin, the smallest limit less power over all bins, which
+ * is negative when any bin violates the mask. NaNs never violate and are
+ * left out of the margin; without points the margin is +inf.
+ *
+ * The AVX-512 version packs the indexes of the violations of each vector
+ * with a compress store; the AVX and NEON versions walk the lanes of the
+ * vectors with any, which a compliant transmitter makes rare.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_mask_violations_32u(uint32_t* outputIndexes, uint32_t*
+ * numViolations, float* worstMargin, const float* psdVector, const float*
+ * maskVector, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li psdVector: The power of each bin, e.g. in dB.
+ * \li maskVector: The limit of each bin, in the same unit.
+ * \li num_points: The number of bins.
+ *
+ * \b Outputs
+ * \li outputIndexes: The indexes of the violating bins, room for num_points.
+ * \li numViolations: The number of violating bins.
+ * \li worstMargin: The smallest maskVector[n] - psdVector[n].
+ *
+ * \b Example
+ * Check a frame of the transmit monitor against the emission mask.
+ * \code
+ *   int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* psd = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* mask = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint32_t* bins = (uint32_t*)volk_malloc(sizeof(uint32_t)*N, alignment);
+ *   uint32_t violations;
+ *   float margin;
+ *
+ *   // compute the psd of the frame and load the mask in dB, then
+ *   volk_32f_x2_mask_violations_32u(bins, &violations, &margin, psd, mask, N);
+ *
+ *   printf("%u bins over the mask, worst margin %1.1f dB\n", violations, margin);
+ *
+ *   volk_free(psd);
+ *   volk_free(mask);
+ *   volk_free(bins);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_mask_violations_32u_H
+#define INCLUDED_volk_32f_x2_mask_violations_32u_H
+
+#include <inttypes.h>
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_mask_violations_32u_generic(uint32_t* outputIndexes,
+                                                           uint32_t* numViolations,
+                                                           float* worstMargin,
+                                                           const float* psdVector,
+                                                           const float* maskVector,
+                                                           unsigned int num_points)
+{
+    float worst = INFINITY, margin;
+    uint32_t count = 0;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        margin = maskVector[number] - psdVector[number];
+        if (margin < worst) {
+            worst = margin;
+        }
+        if (psdVector[number] > maskVector[number]) {
+            outputIndexes[count++] = number;
+        }
+    }
+    *numViolations = count;
+    *worstMargin = worst;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_x2_mask_violations_32u_u_avx(uint32_t* outputIndexes,
+                                                         uint32_t* numViolations,
+                                                         float* worstMargin,
+                                                         const float* psdVector,
+                                                         const float* maskVector,
+                                                         unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __m256 worstVal = _mm256_set1_ps(INFINITY);
+    __m256 psd, limit;
+    __VOLK_ATTR_ALIGNED(32) float worstLanes[8];
+    float worst = INFINITY, margin;
+    uint32_t count = 0;
+    unsigned int number, lane;
+    int mask;
+
+    for (number = 0; number < eighthPoints * 8; number += 8) {
+        psd = _mm256_loadu_ps(psdVector + number);
+        limit = _mm256_loadu_ps(maskVector + number);
+        // min_ps returns its second operand for a NaN margin
+        worstVal = _mm256_min_ps(_mm256_sub_ps(limit, psd), worstVal);
+        mask = _mm256_movemask_ps(_mm256_cmp_ps(psd, limit, _CMP_GT_OQ));
+        for (lane = 0; mask != 0; lane++, mask >>= 1) {
+            if (mask & 1) {
+                outputIndexes[count++] = number + lane;
+            }
+        }
+    }
+    _mm256_store_ps(worstLanes, worstVal);
+    for (lane = 0; lane < 8; lane++) {
+        if (worstLanes[lane] < worst) {
+            worst = worstLanes[lane];
+        }
+    }
+
+    for (; number < num_points; number++) {
+        margin = maskVector[number] - psdVector[number];
+        if (margin < worst) {
+            worst = margin;
+        }
+        if (psdVector[number] > maskVector[number]) {
+            outputIndexes[count++] = number;
+        }
+    }
+    *numViolations = count;
+    *worstMargin = worst;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_POPCOUNT
+#include <immintrin.h>
+
+static inline void volk_32f_x2_mask_violations_32u_u_avx512f(uint32_t* outputIndexes,
+                                                             uint32_t* numViolations,
+                                                             float* worstMargin,
+                                                             const float* psdVector,
+                                                             const float* maskVector,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i indexIncrement = _mm512_set1_epi32(16);
+    __m512i indexes =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m512 worstVal = _mm512_set1_ps(INFINITY);
+    __m512 psd, limit;
+    __mmask16 violating;
+    float worst, margin;
+    uint32_t count = 0;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints * 16; number += 16) {
+        psd = _mm512_loadu_ps(psdVector + number);
+        limit = _mm512_loadu_ps(maskVector + number);
+        // min_ps returns its second operand for a NaN margin
+        worstVal = _mm512_min_ps(_mm512_sub_ps(limit, psd), worstVal);
+        violating = _mm512_cmp_ps_mask(psd, limit, _CMP_GT_OQ);
+        _mm512_mask_compressstoreu_epi32(outputIndexes + count, violating, indexes);
+        count += _mm_popcnt_u32(violating);
+        indexes = _mm512_add_epi32(indexes, indexIncrement);
+    }
+    worst = _mm512_reduce_min_ps(worstVal);
+
+    for (; number < num_points; number++) {
+        margin = maskVector[number] - psdVector[number];
+        if (margin < worst) {
+            worst = margin;
+        }
+        if (psdVector[number] > maskVector[number]) {
+            outputIndexes[count++] = number;
+        }
+    }
+    *numViolations = count;
+    *worstMargin = worst;
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_POPCOUNT */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_mask_violations_32u_neon(uint32_t* outputIndexes,
+                                                        uint32_t* numViolations,
+                                                        float* worstMargin,
+                                                        const float* psdVector,
+                                                        const float* maskVector,
+                                                        unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    float32x4_t worstVal = vdupq_n_f32(INFINITY);
+    float32x4_t psd, limit, margins;
+    uint32x4_t violating;
+    uint32x2_t any;
+    float worstLanes[4];
+    float worst = INFINITY, margin;
+    uint32_t count = 0;
+    unsigned int number, lane;
+
+    for (number = 0; number < quarterPoints * 4; number += 4) {
+        psd = vld1q_f32(psdVector + number);
+        limit = vld1q_f32(maskVector + number);
+        margins = vsubq_f32(limit, psd);
+        // vminq_f32 would let a NaN margin through
+        worstVal = vbslq_f32(vcltq_f32(margins, worstVal), margins, worstVal);
+        violating = vcgtq_f32(psd, limit);
+        any = vorr_u32(vget_low_u32(violating), vget_high_u32(violating));
+        if (vget_lane_u32(vpmax_u32(any, any), 0) == 0) {
+            continue;
+        }
+        for (lane = 0; lane < 4; lane++) {
+            if (psdVector[number + lane] > maskVector[number + lane]) {
+                outputIndexes[count++] = number + lane;
+            }
+        }
+    }
+    vst1q_f32(worstLanes, worstVal);
+    for (lane = 0; lane < 4; lane++) {
+        if (worstLanes[lane] < worst) {
+            worst = worstLanes[lane];
+        }
+    }
+
+    for (; number < num_points; number++) {
+        margin = maskVector[number] - psdVector[number];
+        if (margin < worst) {
+            worst = margin;
+        }
+        if (psdVector[number] > maskVector[number]) {
+            outputIndexes[count++] = number;
+        }
+    }
+    *numViolations = count;
+    *worstMargin = worst;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_mask_violations_32u_H */
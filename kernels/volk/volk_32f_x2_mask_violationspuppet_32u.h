@@ -0,0 +1,139 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_x2_mask_violations_32u.h'
+ */
+
+#ifndef INCLUDED_volk_32f_x2_mask_violationspuppet_32u_H
+#define INCLUDED_volk_32f_x2_mask_violationspuppet_32u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_32f_x2_mask_violations_32u.h>
+
+/*
+ * Checks the first input against the second as the mask and writes the
+ * number of violations, the bit pattern of the worst margin and then the
+ * indexes of the violations, as far as the output goes.
+ */
+static inline void
+volk_32f_x2_mask_violations_puppet(void (*kernel)(uint32_t*,
+                                                  uint32_t*,
+                                                  float*,
+                                                  const float*,
+                                                  const float*,
+                                                  unsigned int),
+                                   uint32_t* output,
+                                   const float* psdVector,
+                                   const float* maskVector,
+                                   unsigned int num_points)
+{
+    uint32_t* indexes =
+        (uint32_t*)volk_malloc(sizeof(uint32_t) * num_points, volk_get_alignment());
+    uint32_t count = 0;
+    float margin = 0.f;
+
+    kernel(indexes, &count, &margin, psdVector, maskVector, num_points);
+
+    memset(output, 0, sizeof(uint32_t) * num_points);
+    if (num_points > 1) {
+        output[0] = count;
+        memcpy(output + 1, &margin, sizeof(float));
+        memcpy(output + 2,
+               indexes,
+               sizeof(uint32_t) * (count < num_points - 2 ? count : num_points - 2));
+    }
+
+    volk_free(indexes);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_mask_violationspuppet_32u_generic(uint32_t* output,
+                                                                 const float* psdVector,
+                                                                 const float* maskVector,
+                                                                 unsigned int num_points)
+{
+    volk_32f_x2_mask_violations_puppet(volk_32f_x2_mask_violations_32u_generic,
+                                       output,
+                                       psdVector,
+                                       maskVector,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_x2_mask_violationspuppet_32u_u_avx(uint32_t* output,
+                                                               const float* psdVector,
+                                                               const float* maskVector,
+                                                               unsigned int num_points)
+{
+    volk_32f_x2_mask_violations_puppet(volk_32f_x2_mask_violations_32u_u_avx,
+                                       output,
+                                       psdVector,
+                                       maskVector,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_POPCOUNT
+
+static inline void
+volk_32f_x2_mask_violationspuppet_32u_u_avx512f(uint32_t* output,
+                                                const float* psdVector,
+                                                const float* maskVector,
+                                                unsigned int num_points)
+{
+    volk_32f_x2_mask_violations_puppet(volk_32f_x2_mask_violations_32u_u_avx512f,
+                                       output,
+                                       psdVector,
+                                       maskVector,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_POPCOUNT */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_x2_mask_violationspuppet_32u_neon(uint32_t* output,
+                                                              const float* psdVector,
+                                                              const float* maskVector,
+                                                              unsigned int num_points)
+{
+    volk_32f_x2_mask_violations_puppet(volk_32f_x2_mask_violations_32u_neon,
+                                       output,
+                                       psdVector,
+                                       maskVector,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_mask_violationspuppet_32u_H */
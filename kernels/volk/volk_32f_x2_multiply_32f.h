@@ -353,6 +353,42 @@ static inline void volk_32f_x2_multiply_32f_neon(float* cVector,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32f_x2_multiply_32f_sve(float* cVector,
+                                                const float* aVector,
+                                                const float* bVector,
+                                                unsigned int num_points)
+{
+    // the last pass runs under a partial predicate instead of a scalar tail
+    for (unsigned int number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32_u32(number, num_points);
+        const svfloat32_t a = svld1_f32(pg, aVector + number);
+        const svfloat32_t b = svld1_f32(pg, bVector + number);
+        svst1_f32(pg, cVector + number, svmul_f32_x(pg, a, b));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32f_x2_multiply_32f_rvv(float* cVector,
+                                                const float* aVector,
+                                                const float* bVector,
+                                                unsigned int num_points)
+{
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, aVector += vl, bVector += vl, cVector += vl) {
+        vl = __riscv_vsetvl_e32m8(n);
+        const vfloat32m8_t va = __riscv_vle32_v_f32m8(aVector, vl);
+        const vfloat32m8_t vb = __riscv_vle32_v_f32m8(bVector, vl);
+        __riscv_vse32_v_f32m8(cVector, __riscv_vfmul_vv_f32m8(va, vb, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 
 #ifdef LV_HAVE_GENERIC
 
@@ -0,0 +1,198 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x2_polar_to_32fc
+ *
+ * \b Overview
+ *
+ * Makes complex points from their magnitudes and phases, the inverse of
+ * volk_32fc_polar_32f_x2. The sine and the cosine of a phase come from one
+ * shared range reduction, as in volk_32f_sincos_32f_x2, and are scaled and
+ * interleaved in registers, so neither is stored in between.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_polar_to_32fc(lv_32fc_t* complexVector,
+ * const float* magnitudeVector, const float* phaseVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li magnitudeVector: The magnitude of each point.
+ * \li phaseVector: The phase of each point in radians.
+ * \li num_points: The number of complex points.
+ *
+ * \b Outputs
+ * \li complexVector: magnitude * (cos(phase) + j sin(phase)) of each point.
+ *
+ * \b Example
+ * Put back a capture whose phases were unwrapped and corrected.
+ * \code
+ *   volk_32fc_polar_32f_x2(magnitude, phase, samples, N);
+ *   // ... correct the phases
+ *   volk_32f_x2_polar_to_32fc(samples, magnitude, phase, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_polar_to_32fc_H
+#define INCLUDED_volk_32f_x2_polar_to_32fc_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_polar_to_32fc_generic(lv_32fc_t* complexVector,
+                                                     const float* magnitudeVector,
+                                                     const float* phaseVector,
+                                                     unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        const float magnitude = *magnitudeVector++;
+        const float phase = *phaseVector++;
+        *complexVector++ = lv_cmake(magnitude * cosf(phase), magnitude * sinf(phase));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_x2_polar_to_32fc_u_avx2(lv_32fc_t* complexVector,
+                                                    const float* magnitudeVector,
+                                                    const float* phaseVector,
+                                                    unsigned int num_points)
+{
+    float* complexVectorPtr = (float*)complexVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+    __m256 magnitude, sine, cosine, real, imag, lo, hi;
+
+    for (number = 0; number < eighthPoints; number++) {
+        magnitude = _mm256_loadu_ps(magnitudeVector);
+        _mm256_sincos_ps_avx2(_mm256_loadu_ps(phaseVector), &sine, &cosine);
+        real = _mm256_mul_ps(magnitude, cosine);
+        imag = _mm256_mul_ps(magnitude, sine);
+        // points 0, 1, 4, 5 and 2, 3, 6, 7, the lanes swapped into order
+        lo = _mm256_unpacklo_ps(real, imag);
+        hi = _mm256_unpackhi_ps(real, imag);
+        _mm256_storeu_ps(complexVectorPtr, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(complexVectorPtr + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+        magnitudeVector += 8;
+        phaseVector += 8;
+        complexVectorPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        const float magnitude = *magnitudeVector++;
+        const float phase = *phaseVector++;
+        *complexVectorPtr++ = magnitude * cosf(phase);
+        *complexVectorPtr++ = magnitude * sinf(phase);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_x2_polar_to_32fc_u_avx512f(lv_32fc_t* complexVector,
+                                                       const float* magnitudeVector,
+                                                       const float* phaseVector,
+                                                       unsigned int num_points)
+{
+    float* complexVectorPtr = (float*)complexVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i loIdx =
+        _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hiIdx =
+        _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    unsigned int number;
+    __m512 magnitude, sine, cosine, real, imag;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        magnitude = _mm512_loadu_ps(magnitudeVector);
+        _mm512_sincos_ps(_mm512_loadu_ps(phaseVector), &sine, &cosine);
+        real = _mm512_mul_ps(magnitude, cosine);
+        imag = _mm512_mul_ps(magnitude, sine);
+        _mm512_storeu_ps(complexVectorPtr, _mm512_permutex2var_ps(real, loIdx, imag));
+        _mm512_storeu_ps(complexVectorPtr + 16,
+                         _mm512_permutex2var_ps(real, hiIdx, imag));
+        magnitudeVector += 16;
+        phaseVector += 16;
+        complexVectorPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        const float magnitude = *magnitudeVector++;
+        const float phase = *phaseVector++;
+        *complexVectorPtr++ = magnitude * cosf(phase);
+        *complexVectorPtr++ = magnitude * sinf(phase);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_x2_polar_to_32fc_neon(lv_32fc_t* complexVector,
+                                                  const float* magnitudeVector,
+                                                  const float* phaseVector,
+                                                  unsigned int num_points)
+{
+    float* complexVectorPtr = (float*)complexVector;
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number;
+    float32x4x2_t output;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const float32x4_t magnitude = vld1q_f32(magnitudeVector);
+        const float32x4x2_t sincos = _vsincosq_f32(vld1q_f32(phaseVector));
+        output.val[0] = vmulq_f32(magnitude, sincos.val[1]);
+        output.val[1] = vmulq_f32(magnitude, sincos.val[0]);
+        vst2q_f32(complexVectorPtr, output);
+        magnitudeVector += 4;
+        phaseVector += 4;
+        complexVectorPtr += 8;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        const float magnitude = *magnitudeVector++;
+        const float phase = *phaseVector++;
+        *complexVectorPtr++ = magnitude * cosf(phase);
+        *complexVectorPtr++ = magnitude * sinf(phase);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_polar_to_32fc_H */
@@ -0,0 +1,303 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32f_x2_polarsclprune_32f_8u_x2
+ *
+ * \b Overview
+ *
+ * The path metric sort and prune step of a successive cancellation list
+ * decoder: extends each of the list_size paths by a 0 and a 1 bit and keeps the
+ * list_size candidates with the smallest path metrics, sorted by metric. The
+ * metric of a candidate grows by the magnitude of its LLR if the bit
+ * disagrees with the sign of the LLR, positive LLRs favouring 0:
+ *
+ * candidate l, bit 0: metrics[l] + max(-llrs[l], 0)
+ * candidate list_size + l, bit 1: metrics[l] + max(llrs[l], 0)
+ *
+ * Ties go to the lower candidate number, so every machine keeps the same
+ * paths in the same order. The surviving parents are in the format of the
+ * paths argument of volk_32f_8u_polarsclf_32f and volk_32f_8u_x2_polarsclg_32f.
+ *
+ * Paths which are not yet active should start with an infinite metric. For a
+ * frozen bit the decoder keeps to the known bit, so it does not call this
+ * kernel but adds the penalty of that bit itself. The LLRs must not be NaN.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_polarsclprune_32f_8u_x2(float* new_metrics, unsigned char* paths,
+ * unsigned char* bits, const float* metrics, const float* llrs, unsigned int
+ * list_size) \endcode
+ *
+ * \b Inputs
+ * \li metrics: The path metric of every path.
+ * \li llrs: The LLR of the bit to decide of every path.
+ * \li list_size: The number of paths, at most 256.
+ *
+ * \b Outputs
+ * \li new_metrics: The path metrics of the survivors, smallest first.
+ * \li paths: The parent path of every survivor.
+ * \li bits: The decided bit of every survivor.
+ *
+ * \b Example
+ * Decide an information bit of 8 paths.
+ * \code
+ *   volk_32f_x2_polarsclprune_32f_8u_x2(new_metrics, paths, bits, metrics, llrs, 8);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_polarsclprune_32f_8u_x2_H
+#define INCLUDED_volk_32f_x2_polarsclprune_32f_8u_x2_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/* The path metric of candidate c, see the overview. */
+static inline float volk_polar_scl_candidate_metric(const float* metrics,
+                                                    const float* llrs,
+                                                    unsigned int list_size,
+                                                    unsigned int c)
+{
+    const unsigned int l = c < list_size ? c : c - list_size;
+    const float penalty = c < list_size ? -llrs[l] : llrs[l];
+    return metrics[l] + (penalty > 0.f ? penalty : 0.f);
+}
+
+/* Keeps candidate c of metric metric if it ranks among the first list_size. */
+static inline void volk_polar_scl_keep(float* new_metrics,
+                                       unsigned char* paths,
+                                       unsigned char* bits,
+                                       unsigned int list_size,
+                                       unsigned int c,
+                                       unsigned int rank,
+                                       float metric)
+{
+    if (rank < list_size) {
+        new_metrics[rank] = metric;
+        paths[rank] = (unsigned char)(c < list_size ? c : c - list_size);
+        bits[rank] = c >= list_size;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_polarsclprune_32f_8u_x2_generic(float* new_metrics,
+                                                               unsigned char* paths,
+                                                               unsigned char* bits,
+                                                               const float* metrics,
+                                                               const float* llrs,
+                                                               unsigned int list_size)
+{
+    unsigned int c, d, rank;
+    float metric, other;
+
+    for (c = 0; c < 2 * list_size; c++) {
+        metric = volk_polar_scl_candidate_metric(metrics, llrs, list_size, c);
+        rank = 0;
+        for (d = 0; d < 2 * list_size; d++) {
+            other = volk_polar_scl_candidate_metric(metrics, llrs, list_size, d);
+            rank += other < metric || (other == metric && d < c);
+        }
+        volk_polar_scl_keep(new_metrics, paths, bits, list_size, c, rank, metric);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_x2_polarsclprune_32f_8u_x2_avx2(float* new_metrics,
+                                                            unsigned char* paths,
+                                                            unsigned char* bits,
+                                                            const float* metrics,
+                                                            const float* llrs,
+                                                            unsigned int list_size)
+{
+    if (list_size % 8) {
+        volk_32f_x2_polarsclprune_32f_8u_x2_generic(
+            new_metrics, paths, bits, metrics, llrs, list_size);
+        return;
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+    __VOLK_ATTR_ALIGNED(32) float metric[8];
+    __VOLK_ATTR_ALIGNED(32) int32_t rank[8];
+    unsigned int c, d, j;
+    __m256 m, llr, other, less, ties;
+    __m256i candidates, count;
+
+    // 8 candidates at a time against every candidate
+    for (c = 0; c < 2 * list_size; c += 8) {
+        m = _mm256_loadu_ps(metrics + c % list_size);
+        llr = _mm256_loadu_ps(llrs + c % list_size);
+        if (c < list_size) {
+            llr = _mm256_sub_ps(zero, llr);
+        }
+        m = _mm256_add_ps(m, _mm256_max_ps(llr, zero));
+        candidates = _mm256_add_epi32(_mm256_set1_epi32(c),
+                                      _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        count = _mm256_setzero_si256();
+
+        for (d = 0; d < 2 * list_size; d++) {
+            other = _mm256_set1_ps(
+                volk_polar_scl_candidate_metric(metrics, llrs, list_size, d));
+            less = _mm256_cmp_ps(other, m, _CMP_LT_OQ);
+            ties = _mm256_and_ps(_mm256_cmp_ps(other, m, _CMP_EQ_OQ),
+                                 _mm256_castsi256_ps(_mm256_cmpgt_epi32(
+                                     candidates, _mm256_set1_epi32(d))));
+            // the masks are -1 where the candidate ranks behind d
+            count = _mm256_sub_epi32(count,
+                                     _mm256_castps_si256(_mm256_or_ps(less, ties)));
+        }
+
+        _mm256_store_ps(metric, m);
+        _mm256_store_si256((__m256i*)rank, count);
+        for (j = 0; j < 8; j++) {
+            volk_polar_scl_keep(
+                new_metrics, paths, bits, list_size, c + j, rank[j], metric[j]);
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_polarsclprune_32f_8u_x2_avx512f(float* new_metrics,
+                                                               unsigned char* paths,
+                                                               unsigned char* bits,
+                                                               const float* metrics,
+                                                               const float* llrs,
+                                                               unsigned int list_size)
+{
+    if (list_size % 16) {
+        volk_32f_x2_polarsclprune_32f_8u_x2_generic(
+            new_metrics, paths, bits, metrics, llrs, list_size);
+        return;
+    }
+
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512i one = _mm512_set1_epi32(1);
+    __VOLK_ATTR_ALIGNED(64) float metric[16];
+    __VOLK_ATTR_ALIGNED(64) int32_t rank[16];
+    unsigned int c, d, j;
+    __m512 m, llr, other;
+    __m512i candidates, count;
+    __mmask16 behind;
+
+    // 16 candidates at a time against every candidate
+    for (c = 0; c < 2 * list_size; c += 16) {
+        m = _mm512_loadu_ps(metrics + c % list_size);
+        llr = _mm512_loadu_ps(llrs + c % list_size);
+        if (c < list_size) {
+            llr = _mm512_sub_ps(zero, llr);
+        }
+        m = _mm512_add_ps(m, _mm512_max_ps(llr, zero));
+        candidates = _mm512_add_epi32(
+            _mm512_set1_epi32(c),
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        count = _mm512_setzero_si512();
+
+        for (d = 0; d < 2 * list_size; d++) {
+            other = _mm512_set1_ps(
+                volk_polar_scl_candidate_metric(metrics, llrs, list_size, d));
+            behind = _mm512_cmp_ps_mask(other, m, _CMP_LT_OQ) |
+                     (_mm512_cmp_ps_mask(other, m, _CMP_EQ_OQ) &
+                      _mm512_cmpgt_epi32_mask(candidates, _mm512_set1_epi32(d)));
+            count = _mm512_mask_add_epi32(count, behind, count, one);
+        }
+
+        _mm512_store_ps(metric, m);
+        _mm512_store_si512(rank, count);
+        for (j = 0; j < 16; j++) {
+            volk_polar_scl_keep(
+                new_metrics, paths, bits, list_size, c + j, rank[j], metric[j]);
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_polarsclprune_32f_8u_x2_neon(float* new_metrics,
+                                                            unsigned char* paths,
+                                                            unsigned char* bits,
+                                                            const float* metrics,
+                                                            const float* llrs,
+                                                            unsigned int list_size)
+{
+    if (list_size % 4) {
+        volk_32f_x2_polarsclprune_32f_8u_x2_generic(
+            new_metrics, paths, bits, metrics, llrs, list_size);
+        return;
+    }
+
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const uint32_t lanes[4] = { 0, 1, 2, 3 };
+    float metric[4];
+    uint32_t rank[4];
+    unsigned int c, d, j;
+    float32x4_t m, llr, other;
+    uint32x4_t candidates, behind, count;
+
+    // 4 candidates at a time against every candidate
+    for (c = 0; c < 2 * list_size; c += 4) {
+        m = vld1q_f32(metrics + c % list_size);
+        llr = vld1q_f32(llrs + c % list_size);
+        if (c < list_size) {
+            llr = vnegq_f32(llr);
+        }
+        // a select rather than vmaxq_f32, which may give -0 for the penalty
+        m = vaddq_f32(m, vbslq_f32(vcgtq_f32(llr, zero), llr, zero));
+        candidates = vaddq_u32(vdupq_n_u32(c), vld1q_u32(lanes));
+        count = vdupq_n_u32(0);
+
+        for (d = 0; d < 2 * list_size; d++) {
+            other = vdupq_n_f32(
+                volk_polar_scl_candidate_metric(metrics, llrs, list_size, d));
+            behind = vorrq_u32(vcltq_f32(other, m),
+                               vandq_u32(vceqq_f32(other, m),
+                                         vcgtq_u32(candidates, vdupq_n_u32(d))));
+            // the masks are all ones where the candidate ranks behind d
+            count = vsubq_u32(count, behind);
+        }
+
+        vst1q_f32(metric, m);
+        vst1q_u32(rank, count);
+        for (j = 0; j < 4; j++) {
+            volk_polar_scl_keep(
+                new_metrics, paths, bits, list_size, c + j, rank[j], metric[j]);
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_polarsclprune_32f_8u_x2_H */
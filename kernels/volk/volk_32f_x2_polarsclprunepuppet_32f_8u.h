@@ -0,0 +1,142 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_x2_polarsclprune_32f_8u_x2.h'
+ */
+
+#ifndef INCLUDED_volk_32f_x2_polarsclprunepuppet_32f_8u_H
+#define INCLUDED_volk_32f_x2_polarsclprunepuppet_32f_8u_H
+
+#include <string.h>
+#include <volk/volk_32f_x2_polarsclprune_32f_8u_x2.h>
+
+/*
+ * Prunes lists of 16 paths along the buffers, with the decided bits in bit 4
+ * of paths.
+ */
+static inline void
+volk_polar_scl_prune_puppet(void (*kernel)(float*,
+                                           unsigned char*,
+                                           unsigned char*,
+                                           const float*,
+                                           const float*,
+                                           unsigned int),
+                            float* new_metrics,
+                            unsigned char* paths,
+                            const float* metrics,
+                            const float* llrs,
+                            unsigned int num_points)
+{
+    unsigned char bits[16];
+    unsigned int n, l;
+
+    memset(new_metrics, 0, sizeof(float) * num_points);
+    memset(paths, 0, num_points);
+    for (n = 0; n + 16 <= num_points; n += 16) {
+        kernel(new_metrics + n, paths + n, bits, metrics + n, llrs + n, 16);
+        for (l = 0; l < 16; l++) {
+            paths[n + l] |= bits[l] << 4;
+        }
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_polarsclprunepuppet_32f_8u_generic(float* new_metrics,
+                                                                  unsigned char* paths,
+                                                                  const float* metrics,
+                                                                  const float* llrs,
+                                                                  unsigned int num_points)
+{
+    volk_polar_scl_prune_puppet(volk_32f_x2_polarsclprune_32f_8u_x2_generic,
+                                new_metrics,
+                                paths,
+                                metrics,
+                                llrs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_x2_polarsclprunepuppet_32f_8u_avx2(float* new_metrics,
+                                                               unsigned char* paths,
+                                                               const float* metrics,
+                                                               const float* llrs,
+                                                               unsigned int num_points)
+{
+    volk_polar_scl_prune_puppet(volk_32f_x2_polarsclprune_32f_8u_x2_avx2,
+                                new_metrics,
+                                paths,
+                                metrics,
+                                llrs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_polarsclprunepuppet_32f_8u_avx512f(float* new_metrics,
+                                                                  unsigned char* paths,
+                                                                  const float* metrics,
+                                                                  const float* llrs,
+                                                                  unsigned int num_points)
+{
+    volk_polar_scl_prune_puppet(volk_32f_x2_polarsclprune_32f_8u_x2_avx512f,
+                                new_metrics,
+                                paths,
+                                metrics,
+                                llrs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_polarsclprunepuppet_32f_8u_neon(float* new_metrics,
+                                                               unsigned char* paths,
+                                                               const float* metrics,
+                                                               const float* llrs,
+                                                               unsigned int num_points)
+{
+    volk_polar_scl_prune_puppet(volk_32f_x2_polarsclprune_32f_8u_x2_neon,
+                                new_metrics,
+                                paths,
+                                metrics,
+                                llrs,
+                                num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_polarsclprunepuppet_32f_8u_H */
@@ -547,6 +547,141 @@ static inline void volk_32f_x2_pow_32f_generic(float* cVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+#define POLY0_NEONV8(x, c0) vdupq_n_f32(c0)
+#define POLY1_NEONV8(x, c0, c1) vfmaq_f32(vdupq_n_f32(c0), POLY0_NEONV8(x, c1), x)
+#define POLY2_NEONV8(x, c0, c1, c2) \
+    vfmaq_f32(vdupq_n_f32(c0), POLY1_NEONV8(x, c1, c2), x)
+#define POLY3_NEONV8(x, c0, c1, c2, c3) \
+    vfmaq_f32(vdupq_n_f32(c0), POLY2_NEONV8(x, c1, c2, c3), x)
+#define POLY4_NEONV8(x, c0, c1, c2, c3, c4) \
+    vfmaq_f32(vdupq_n_f32(c0), POLY3_NEONV8(x, c1, c2, c3, c4), x)
+#define POLY5_NEONV8(x, c0, c1, c2, c3, c4, c5) \
+    vfmaq_f32(vdupq_n_f32(c0), POLY4_NEONV8(x, c1, c2, c3, c4, c5), x)
+
+static inline void volk_32f_x2_pow_32f_neonv8(float* cVector,
+                                              const float* bVector,
+                                              const float* aVector,
+                                              unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    float32x4_t aVal, bVal, cVal, logarithm, mantissa, frac;
+    float32x4_t tmp, fx, pow2n, z, y;
+    int32x4_t exp, emm0;
+
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t exp_hi = vdupq_n_f32(88.3762626647949f);
+    const float32x4_t exp_lo = vdupq_n_f32(-88.3762626647949f);
+    const float32x4_t ln2 = vdupq_n_f32(0.6931471805f);
+    const float32x4_t log2EF = vdupq_n_f32(1.44269504088896341f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t exp_C1 = vdupq_n_f32(0.693359375f);
+    const float32x4_t exp_C2 = vdupq_n_f32(-2.12194440e-4f);
+    const int32x4_t bias = vdupq_n_s32(127);
+
+    const float32x4_t exp_p0 = vdupq_n_f32(1.9875691500e-4f);
+    const float32x4_t exp_p1 = vdupq_n_f32(1.3981999507e-3f);
+    const float32x4_t exp_p2 = vdupq_n_f32(8.3334519073e-3f);
+    const float32x4_t exp_p3 = vdupq_n_f32(4.1665795894e-2f);
+    const float32x4_t exp_p4 = vdupq_n_f32(1.6666665459e-1f);
+    const float32x4_t exp_p5 = vdupq_n_f32(5.0000001201e-1f);
+
+    for (; number < quarterPoints; number++) {
+        // First compute the logarithm
+        aVal = vld1q_f32(aPtr);
+        exp = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(
+                            vandq_u32(vreinterpretq_u32_f32(aVal), vdupq_n_u32(0x7f800000)),
+                            23)),
+                        bias);
+        logarithm = vcvtq_f32_s32(exp);
+
+        frac = vreinterpretq_f32_u32(
+            vorrq_u32(vreinterpretq_u32_f32(one),
+                      vandq_u32(vreinterpretq_u32_f32(aVal), vdupq_n_u32(0x7fffff))));
+
+#if POW_POLY_DEGREE == 6
+        mantissa = POLY5_NEONV8(frac,
+                                3.1157899f,
+                                -3.3241990f,
+                                2.5988452f,
+                                -1.2315303f,
+                                3.1821337e-1f,
+                                -3.4436006e-2f);
+#elif POW_POLY_DEGREE == 5
+        mantissa = POLY4_NEONV8(frac,
+                                2.8882704548164776201f,
+                                -2.52074962577807006663f,
+                                1.48116647521213171641f,
+                                -0.465725644288844778798f,
+                                0.0596515482674574969533f);
+#elif POW_POLY_DEGREE == 4
+        mantissa = POLY3_NEONV8(frac,
+                                2.61761038894603480148f,
+                                -1.75647175389045657003f,
+                                0.688243882994381274313f,
+                                -0.107254423828329604454f);
+#elif POW_POLY_DEGREE == 3
+        mantissa = POLY2_NEONV8(frac,
+                                2.28330284476918490682f,
+                                -1.04913055217340124191f,
+                                0.204446009836232697516f);
+#else
+#error
+#endif
+
+        logarithm = vfmaq_f32(logarithm, mantissa, vsubq_f32(frac, one));
+        logarithm = vmulq_f32(logarithm, ln2);
+
+        // Now calculate b*lna
+        bVal = vld1q_f32(bPtr);
+        bVal = vmulq_f32(bVal, logarithm);
+
+        // Now compute exp(b*lna)
+        bVal = vmaxq_f32(vminq_f32(bVal, exp_hi), exp_lo);
+
+        // round toward minus infinity in one step
+        fx = vrndmq_f32(vfmaq_f32(half, bVal, log2EF));
+
+        tmp = vfmsq_f32(bVal, fx, exp_C1);
+        bVal = vfmsq_f32(tmp, fx, exp_C2);
+        z = vmulq_f32(bVal, bVal);
+
+        y = vfmaq_f32(exp_p1, exp_p0, bVal);
+        y = vfmaq_f32(exp_p2, y, bVal);
+        y = vfmaq_f32(exp_p3, y, bVal);
+        y = vfmaq_f32(exp_p4, y, bVal);
+        y = vfmaq_f32(exp_p5, y, bVal);
+        y = vfmaq_f32(bVal, y, z);
+        y = vaddq_f32(y, one);
+
+        emm0 = vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(fx), bias), 23);
+
+        pow2n = vreinterpretq_f32_s32(emm0);
+        cVal = vmulq_f32(y, pow2n);
+
+        vst1q_f32(cPtr, cVal);
+
+        aPtr += 4;
+        bPtr += 4;
+        cPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *cPtr++ = powf(*aPtr++, *bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
 
 #ifdef LV_HAVE_SSE4_1
 #include <smmintrin.h>
@@ -0,0 +1,105 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_x2_s32f_x2_axpby_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32f_x2_s32f_axpbypuppet_32f_H
+#define INCLUDED_volk_32f_x2_s32f_axpbypuppet_32f_H
+
+#include <volk/volk_32f_x2_s32f_x2_axpby_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32f_x2_s32f_axpbypuppet_32f_generic(float* cVector,
+                                                            const float* xVector,
+                                                            const float* yVector,
+                                                            const float alpha,
+                                                            unsigned int num_points)
+{
+    volk_32f_x2_s32f_x2_axpby_32f_generic(
+        cVector, xVector, yVector, alpha, 1.0f - alpha, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_32f_x2_s32f_axpbypuppet_32f_a_avx2_fma(float* cVector,
+                                                               const float* xVector,
+                                                               const float* yVector,
+                                                               const float alpha,
+                                                               unsigned int num_points)
+{
+    volk_32f_x2_s32f_x2_axpby_32f_a_avx2_fma(
+        cVector, xVector, yVector, alpha, 1.0f - alpha, num_points);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_32f_x2_s32f_axpbypuppet_32f_u_avx2_fma(float* cVector,
+                                                               const float* xVector,
+                                                               const float* yVector,
+                                                               const float alpha,
+                                                               unsigned int num_points)
+{
+    volk_32f_x2_s32f_x2_axpby_32f_u_avx2_fma(
+        cVector, xVector, yVector, alpha, 1.0f - alpha, num_points);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32f_x2_s32f_axpbypuppet_32f_a_avx512f(float* cVector,
+                                                              const float* xVector,
+                                                              const float* yVector,
+                                                              const float alpha,
+                                                              unsigned int num_points)
+{
+    volk_32f_x2_s32f_x2_axpby_32f_a_avx512f(
+        cVector, xVector, yVector, alpha, 1.0f - alpha, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32f_x2_s32f_axpbypuppet_32f_u_avx512f(float* cVector,
+                                                              const float* xVector,
+                                                              const float* yVector,
+                                                              const float alpha,
+                                                              unsigned int num_points)
+{
+    volk_32f_x2_s32f_x2_axpby_32f_u_avx512f(
+        cVector, xVector, yVector, alpha, 1.0f - alpha, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+static inline void volk_32f_x2_s32f_axpbypuppet_32f_neonv8(float* cVector,
+                                                           const float* xVector,
+                                                           const float* yVector,
+                                                           const float alpha,
+                                                           unsigned int num_points)
+{
+    volk_32f_x2_s32f_x2_axpby_32f_neonv8(
+        cVector, xVector, yVector, alpha, 1.0f - alpha, num_points);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_x2_s32f_axpbypuppet_32f_H */
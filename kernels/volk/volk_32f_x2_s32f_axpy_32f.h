@@ -0,0 +1,214 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x2_s32f_axpy_32f
+ *
+ * \b Overview
+ *
+ * Scales a vector and adds another one, the BLAS-1 axpy:
+ *
+ * cVector[i] = alpha * xVector[i] + yVector[i]
+ *
+ * The SIMD versions compute each point with one fused multiply-add, so they
+ * round once where a scale and an add round twice.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_s32f_axpy_32f(float* cVector, const float* xVector, const float*
+ * yVector, const float alpha, unsigned int num_points); \endcode
+ *
+ * \b Inputs
+ * \li xVector: The vector to scale.
+ * \li yVector: The vector to add.
+ * \li alpha: The scale of xVector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li cVector: The output vector, may be xVector or yVector.
+ *
+ * \b Example
+ * Accumulate a scaled block into a running sum.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* x = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* y = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   // ... fill x and y
+ *
+ *   volk_32f_x2_s32f_axpy_32f(y, x, y, 0.25f, N);
+ *
+ *   volk_free(x);
+ *   volk_free(y);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_s32f_axpy_32f_H
+#define INCLUDED_volk_32f_x2_s32f_axpy_32f_H
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32f_x2_s32f_axpy_32f_generic(float* cVector,
+                                                     const float* xVector,
+                                                     const float* yVector,
+                                                     const float alpha,
+                                                     unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_x2_s32f_axpy_32f_a_avx2_fma(float* cVector,
+                                                        const float* xVector,
+                                                        const float* yVector,
+                                                        const float alpha,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const __m256 a = _mm256_set1_ps(alpha);
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256 x = _mm256_load_ps(xVector + 8 * number);
+        const __m256 y = _mm256_load_ps(yVector + 8 * number);
+        _mm256_store_ps(cVector + 8 * number, _mm256_fmadd_ps(a, x, y));
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_x2_s32f_axpy_32f_u_avx2_fma(float* cVector,
+                                                        const float* xVector,
+                                                        const float* yVector,
+                                                        const float alpha,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const __m256 a = _mm256_set1_ps(alpha);
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256 x = _mm256_loadu_ps(xVector + 8 * number);
+        const __m256 y = _mm256_loadu_ps(yVector + 8 * number);
+        _mm256_storeu_ps(cVector + 8 * number, _mm256_fmadd_ps(a, x, y));
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_s32f_axpy_32f_a_avx512f(float* cVector,
+                                                       const float* xVector,
+                                                       const float* yVector,
+                                                       const float alpha,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const __m512 a = _mm512_set1_ps(alpha);
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        const __m512 x = _mm512_load_ps(xVector + 16 * number);
+        const __m512 y = _mm512_load_ps(yVector + 16 * number);
+        _mm512_store_ps(cVector + 16 * number, _mm512_fmadd_ps(a, x, y));
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_s32f_axpy_32f_u_avx512f(float* cVector,
+                                                       const float* xVector,
+                                                       const float* yVector,
+                                                       const float alpha,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const __m512 a = _mm512_set1_ps(alpha);
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        const __m512 x = _mm512_loadu_ps(xVector + 16 * number);
+        const __m512 y = _mm512_loadu_ps(yVector + 16 * number);
+        _mm512_storeu_ps(cVector + 16 * number, _mm512_fmadd_ps(a, x, y));
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_s32f_axpy_32f_neonv8(float* cVector,
+                                                    const float* xVector,
+                                                    const float* yVector,
+                                                    const float alpha,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const float32x4_t a = vdupq_n_f32(alpha);
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const float32x4_t x = vld1q_f32(xVector + 4 * number);
+        const float32x4_t y = vld1q_f32(yVector + 4 * number);
+        vst1q_f32(cVector + 4 * number, vfmaq_f32(y, a, x));
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_x2_s32f_axpy_32f_H */
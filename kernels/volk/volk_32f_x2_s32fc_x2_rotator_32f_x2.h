@@ -0,0 +1,312 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x2_s32fc_x2_rotator_32f_x2
+ *
+ * \b Overview
+ *
+ * Rotates a complex vector held as separate real and imaginary planes,
+ * structure of arrays, at a fixed rate per sample from an initial phase, as
+ * volk_32fc_s32fc_x2_rotator_32fc does for interleaved vectors.
+ *
+ * The SIMD versions keep the phases of consecutive samples in the lanes of a
+ * real and an imaginary register and step them by phase_inc to the power of
+ * the lane count. Every ROTATOR_RELOAD samples they re-seed the lanes from
+ * phases computed in double precision, so the rounding does not build up.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_s32fc_x2_rotator_32f_x2(float* outReal, float* outImag,
+ * const float* inReal, const float* inImag, const lv_32fc_t phase_inc,
+ * lv_32fc_t* phase, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inReal, inImag: The real and imaginary parts of the vector to rotate.
+ * \li phase_inc: The rotation per sample.
+ * \li phase: The initial phase; updated to the phase of the next sample.
+ * \li num_points: The number of complex values.
+ *
+ * \b Outputs
+ * \li outReal, outImag: The real and imaginary parts of the rotated vector.
+ *     They may be the input planes.
+ *
+ * \b Example
+ * Shift a split tone at f=0.3 up by f=0.1, in place.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* re = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float* im = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       re[ii] = std::cos(0.3f * (float)ii);
+ *       im[ii] = std::sin(0.3f * (float)ii);
+ *   }
+ *   lv_32fc_t phase_increment = lv_cmake(std::cos(0.1f), std::sin(0.1f));
+ *   lv_32fc_t phase = lv_cmake(1.f, 0.f);
+ *
+ *   volk_32f_x2_s32fc_x2_rotator_32f_x2(re, im, re, im, phase_increment, &phase, N);
+ *
+ *   volk_free(re);
+ *   volk_free(im);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_H
+#define INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_H
+
+#include <math.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+/* Writes the exact phases of the num_lanes samples from offset on, split into
+ * their real and imaginary parts. */
+static inline void volk_rotator_split_phases(float* phaseReal,
+                                             float* phaseImag,
+                                             lv_32fc_t phase,
+                                             lv_32fc_t phase_inc,
+                                             unsigned int offset,
+                                             unsigned int num_lanes)
+{
+    lv_32fc_t phases[16];
+    unsigned int k;
+
+    volk_rotator_exact_phases(phases, phase, phase_inc, offset, num_lanes);
+    for (k = 0; k < num_lanes; k++) {
+        phaseReal[k] = lv_creal(phases[k]);
+        phaseImag[k] = lv_cimag(phases[k]);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_s32fc_x2_rotator_32f_x2_generic(float* outReal,
+                                                               float* outImag,
+                                                               const float* inReal,
+                                                               const float* inImag,
+                                                               const lv_32fc_t phase_inc,
+                                                               lv_32fc_t* phase,
+                                                               unsigned int num_points)
+{
+    lv_32fc_t sample;
+    unsigned int i = 0;
+    int j = 0;
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        for (j = 0; j < ROTATOR_RELOAD; ++j) {
+            sample = lv_cmake(*inReal++, *inImag++) * (*phase);
+            *outReal++ = lv_creal(sample);
+            *outImag++ = lv_cimag(sample);
+            (*phase) *= phase_inc;
+        }
+
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+    for (i = 0; i < num_points % ROTATOR_RELOAD; ++i) {
+        sample = lv_cmake(*inReal++, *inImag++) * (*phase);
+        *outReal++ = lv_creal(sample);
+        *outImag++ = lv_cimag(sample);
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        // Make sure, we normalize phase on every call!
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_x2_rotator_32f_x2_u_avx2_fma(float* outReal,
+                                               float* outImag,
+                                               const float* inReal,
+                                               const float* inImag,
+                                               const lv_32fc_t phase_inc,
+                                               lv_32fc_t* phase,
+                                               unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) float phaseReal[8];
+    __VOLK_ATTR_ALIGNED(32) float phaseImag[8];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    __m256 xr, xi, pr, pi, t;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 8, 1);
+    const __m256 incReal = _mm256_set1_ps(lv_creal(incr));
+    const __m256 incImag = _mm256_set1_ps(lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_split_phases(phaseReal, phaseImag, *phase, phase_inc, i, 8);
+        pr = _mm256_load_ps(phaseReal);
+        pi = _mm256_load_ps(phaseImag);
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 8; j++) {
+            xr = _mm256_loadu_ps(inReal);
+            xi = _mm256_loadu_ps(inImag);
+            _mm256_storeu_ps(outReal, _mm256_fmsub_ps(xr, pr, _mm256_mul_ps(xi, pi)));
+            _mm256_storeu_ps(outImag, _mm256_fmadd_ps(xr, pi, _mm256_mul_ps(xi, pr)));
+            t = _mm256_fmsub_ps(pr, incReal, _mm256_mul_ps(pi, incImag));
+            pi = _mm256_fmadd_ps(pr, incImag, _mm256_mul_ps(pi, incReal));
+            pr = t;
+            inReal += 8;
+            inImag += 8;
+            outReal += 8;
+            outImag += 8;
+        }
+
+        // the lanes hold the phases of the samples left in the block
+        _mm256_store_ps(phaseReal, pr);
+        _mm256_store_ps(phaseImag, pi);
+        for (j = 0; j < block_points % 8; j++) {
+            const float real = *inReal * phaseReal[j] - *inImag * phaseImag[j];
+            *outImag++ = *inReal++ * phaseImag[j] + *inImag++ * phaseReal[j];
+            *outReal++ = real;
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32f_x2_s32fc_x2_rotator_32f_x2_u_avx512f(float* outReal,
+                                              float* outImag,
+                                              const float* inReal,
+                                              const float* inImag,
+                                              const lv_32fc_t phase_inc,
+                                              lv_32fc_t* phase,
+                                              unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) float phaseReal[16];
+    __VOLK_ATTR_ALIGNED(64) float phaseImag[16];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    __m512 xr, xi, pr, pi, t;
+    __mmask16 mask = 0xffff;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 16, 1);
+    const __m512 incReal = _mm512_set1_ps(lv_creal(incr));
+    const __m512 incImag = _mm512_set1_ps(lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_split_phases(phaseReal, phaseImag, *phase, phase_inc, i, 16);
+        pr = _mm512_load_ps(phaseReal);
+        pi = _mm512_load_ps(phaseImag);
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points; j += 16) {
+            if (block_points - j < 16) {
+                mask = (__mmask16)((1u << (block_points - j)) - 1);
+            }
+            xr = _mm512_maskz_loadu_ps(mask, inReal + j);
+            xi = _mm512_maskz_loadu_ps(mask, inImag + j);
+            _mm512_mask_storeu_ps(
+                outReal + j, mask, _mm512_fmsub_ps(xr, pr, _mm512_mul_ps(xi, pi)));
+            _mm512_mask_storeu_ps(
+                outImag + j, mask, _mm512_fmadd_ps(xr, pi, _mm512_mul_ps(xi, pr)));
+            t = _mm512_fmsub_ps(pr, incReal, _mm512_mul_ps(pi, incImag));
+            pi = _mm512_fmadd_ps(pr, incImag, _mm512_mul_ps(pi, incReal));
+            pr = t;
+        }
+        inReal += block_points;
+        inImag += block_points;
+        outReal += block_points;
+        outImag += block_points;
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_s32fc_x2_rotator_32f_x2_neonv8(float* outReal,
+                                                              float* outImag,
+                                                              const float* inReal,
+                                                              const float* inImag,
+                                                              const lv_32fc_t phase_inc,
+                                                              lv_32fc_t* phase,
+                                                              unsigned int num_points)
+{
+    float phaseReal[4];
+    float phaseImag[4];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    float32x4_t xr, xi, pr, pi, t;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 4, 1);
+    const float32x4_t incReal = vdupq_n_f32(lv_creal(incr));
+    const float32x4_t incImag = vdupq_n_f32(lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_split_phases(phaseReal, phaseImag, *phase, phase_inc, i, 4);
+        pr = vld1q_f32(phaseReal);
+        pi = vld1q_f32(phaseImag);
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 4; j++) {
+            xr = vld1q_f32(inReal);
+            xi = vld1q_f32(inImag);
+            vst1q_f32(outReal, vfmsq_f32(vmulq_f32(xr, pr), xi, pi));
+            vst1q_f32(outImag, vfmaq_f32(vmulq_f32(xr, pi), xi, pr));
+            t = vfmsq_f32(vmulq_f32(pr, incReal), pi, incImag);
+            pi = vfmaq_f32(vmulq_f32(pr, incImag), pi, incReal);
+            pr = t;
+            inReal += 4;
+            inImag += 4;
+            outReal += 4;
+            outImag += 4;
+        }
+
+        // the lanes hold the phases of the samples left in the block
+        vst1q_f32(phaseReal, pr);
+        vst1q_f32(phaseImag, pi);
+        for (j = 0; j < block_points % 4; j++) {
+            const float real = *inReal * phaseReal[j] - *inImag * phaseImag[j];
+            *outImag++ = *inReal++ * phaseImag[j] + *inImag++ * phaseReal[j];
+            *outReal++ = real;
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_x2_s32fc_x2_rotator_32f_x2_H */
@@ -0,0 +1,238 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x4_complex_dot_prod_32fc
+ *
+ * \b Overview
+ *
+ * Computes the dot product of two complex vectors held as separate real and
+ * imaginary planes, structure of arrays, as volk_32fc_x2_dot_prod_32fc does
+ * for interleaved vectors:
+ *
+ * result = sum over n of (aReal[n] + j aImag[n]) * (bReal[n] + j bImag[n])
+ *
+ * Each of the four products goes into its own accumulator with a fused
+ * multiply-add, and nothing is shuffled until the final sums.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x4_complex_dot_prod_32fc(lv_32fc_t* result, const float* aReal,
+ * const float* aImag, const float* bReal, const float* bImag,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li aReal, aImag: The real and imaginary parts of the input.
+ * \li bReal, bImag: The real and imaginary parts of the taps.
+ * \li num_points: The number of complex values in each.
+ *
+ * \b Outputs
+ * \li result: The dot product.
+ *
+ * \b Example
+ * Correlate a split signal against split taps.
+ * \code
+ *   lv_32fc_t result;
+ *   volk_32f_x4_complex_dot_prod_32fc(&result, sig_re, sig_im, taps_re, taps_im, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x4_complex_dot_prod_32fc_H
+#define INCLUDED_volk_32f_x4_complex_dot_prod_32fc_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x4_complex_dot_prod_32fc_generic(lv_32fc_t* result,
+                                                             const float* aReal,
+                                                             const float* aImag,
+                                                             const float* bReal,
+                                                             const float* bImag,
+                                                             unsigned int num_points)
+{
+    float sumReal = 0.f, sumImag = 0.f;
+    unsigned int i;
+
+    for (i = 0; i < num_points; i++) {
+        sumReal += aReal[i] * bReal[i] - aImag[i] * bImag[i];
+        sumImag += aReal[i] * bImag[i] + aImag[i] * bReal[i];
+    }
+
+    *result = lv_cmake(sumReal, sumImag);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32fc_u_avx2_fma(lv_32fc_t* result,
+                                                                const float* aReal,
+                                                                const float* aImag,
+                                                                const float* bReal,
+                                                                const float* bImag,
+                                                                unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    __VOLK_ATTR_ALIGNED(32) float sumReal[8];
+    __VOLK_ATTR_ALIGNED(32) float sumImag[8];
+    float real = 0.f, imag = 0.f;
+    unsigned int number;
+    __m256 ar, ai, br, bi;
+    __m256 accReal0 = _mm256_setzero_ps();
+    __m256 accReal1 = _mm256_setzero_ps();
+    __m256 accImag0 = _mm256_setzero_ps();
+    __m256 accImag1 = _mm256_setzero_ps();
+
+    for (number = 0; number < eighth_points; number++) {
+        ar = _mm256_loadu_ps(aReal);
+        ai = _mm256_loadu_ps(aImag);
+        br = _mm256_loadu_ps(bReal);
+        bi = _mm256_loadu_ps(bImag);
+        accReal0 = _mm256_fmadd_ps(ar, br, accReal0);
+        accReal1 = _mm256_fnmadd_ps(ai, bi, accReal1);
+        accImag0 = _mm256_fmadd_ps(ar, bi, accImag0);
+        accImag1 = _mm256_fmadd_ps(ai, br, accImag1);
+        aReal += 8;
+        aImag += 8;
+        bReal += 8;
+        bImag += 8;
+    }
+
+    _mm256_store_ps(sumReal, _mm256_add_ps(accReal0, accReal1));
+    _mm256_store_ps(sumImag, _mm256_add_ps(accImag0, accImag1));
+    for (number = 0; number < 8; number++) {
+        real += sumReal[number];
+        imag += sumImag[number];
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        real += *aReal * *bReal - *aImag * *bImag;
+        imag += *aReal++ * *bImag++ + *aImag++ * *bReal++;
+    }
+
+    *result = lv_cmake(real, imag);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32fc_u_avx512f(lv_32fc_t* result,
+                                                               const float* aReal,
+                                                               const float* aImag,
+                                                               const float* bReal,
+                                                               const float* bImag,
+                                                               unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) float sumReal[16];
+    __VOLK_ATTR_ALIGNED(64) float sumImag[16];
+    float real = 0.f, imag = 0.f;
+    unsigned int number;
+    __m512 ar, ai, br, bi;
+    __m512 accReal0 = _mm512_setzero_ps();
+    __m512 accReal1 = _mm512_setzero_ps();
+    __m512 accImag0 = _mm512_setzero_ps();
+    __m512 accImag1 = _mm512_setzero_ps();
+    __mmask16 mask = 0xffff;
+
+    for (number = 0; number < num_points; number += 16) {
+        // the lanes past the end load as zero, which adds nothing
+        if (num_points - number < 16) {
+            mask = (__mmask16)((1u << (num_points - number)) - 1);
+        }
+        ar = _mm512_maskz_loadu_ps(mask, aReal + number);
+        ai = _mm512_maskz_loadu_ps(mask, aImag + number);
+        br = _mm512_maskz_loadu_ps(mask, bReal + number);
+        bi = _mm512_maskz_loadu_ps(mask, bImag + number);
+        accReal0 = _mm512_fmadd_ps(ar, br, accReal0);
+        accReal1 = _mm512_fnmadd_ps(ai, bi, accReal1);
+        accImag0 = _mm512_fmadd_ps(ar, bi, accImag0);
+        accImag1 = _mm512_fmadd_ps(ai, br, accImag1);
+    }
+
+    _mm512_store_ps(sumReal, _mm512_add_ps(accReal0, accReal1));
+    _mm512_store_ps(sumImag, _mm512_add_ps(accImag0, accImag1));
+    for (number = 0; number < 16; number++) {
+        real += sumReal[number];
+        imag += sumImag[number];
+    }
+
+    *result = lv_cmake(real, imag);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x4_complex_dot_prod_32fc_neonv8(lv_32fc_t* result,
+                                                            const float* aReal,
+                                                            const float* aImag,
+                                                            const float* bReal,
+                                                            const float* bImag,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    float real, imag;
+    unsigned int number;
+    float32x4_t ar, ai, br, bi;
+    float32x4_t accReal0 = vdupq_n_f32(0.f);
+    float32x4_t accReal1 = vdupq_n_f32(0.f);
+    float32x4_t accImag0 = vdupq_n_f32(0.f);
+    float32x4_t accImag1 = vdupq_n_f32(0.f);
+
+    for (number = 0; number < quarter_points; number++) {
+        ar = vld1q_f32(aReal);
+        ai = vld1q_f32(aImag);
+        br = vld1q_f32(bReal);
+        bi = vld1q_f32(bImag);
+        accReal0 = vfmaq_f32(accReal0, ar, br);
+        accReal1 = vfmsq_f32(accReal1, ai, bi);
+        accImag0 = vfmaq_f32(accImag0, ar, bi);
+        accImag1 = vfmaq_f32(accImag1, ai, br);
+        aReal += 4;
+        aImag += 4;
+        bReal += 4;
+        bImag += 4;
+    }
+
+    real = vaddvq_f32(vaddq_f32(accReal0, accReal1));
+    imag = vaddvq_f32(vaddq_f32(accImag0, accImag1));
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        real += *aReal * *bReal - *aImag * *bImag;
+        imag += *aReal++ * *bImag++ + *aImag++ * *bReal++;
+    }
+
+    *result = lv_cmake(real, imag);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_x4_complex_dot_prod_32fc_H */
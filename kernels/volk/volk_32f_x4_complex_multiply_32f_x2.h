@@ -0,0 +1,411 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32f_x4_complex_multiply_32f_x2
+ *
+ * \b Overview
+ *
+ * Multiplies two complex vectors held as separate real and imaginary
+ * planes, structure of arrays, into a third split vector:
+ *
+ * cReal[n] + j cImag[n] = (aReal[n] + j aImag[n]) * (bReal[n] + j bImag[n])
+ *
+ * Every lane of a register then holds the same part of another sample, so the
+ * product is four multiplies, two of them fused with the add or subtract,
+ * without the duplicating and swapping shuffles of volk_32fc_x2_multiply_32fc.
+ * Data which is kept split saves the volk_32fc_deinterleave_32f_x2 and
+ * volk_32f_x2_interleave_32fc calls around interleaved kernels.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x4_complex_multiply_32f_x2(float* cReal, float* cImag,
+ * const float* aReal, const float* aImag, const float* bReal, const float* bImag,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li aReal, aImag: The real and imaginary parts of the first vector.
+ * \li bReal, bImag: The real and imaginary parts of the second vector.
+ * \li num_points: The number of complex values.
+ *
+ * \b Outputs
+ * \li cReal, cImag: The real and imaginary parts of the products. They may be
+ *     the planes of either input.
+ *
+ * \b Example
+ * Mix a tone at f=0.3 with one at f=0.1.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* re_1 = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float* im_1 = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float* re_2 = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float* im_2 = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       re_1[ii] = std::cos(0.3f * (float)ii);
+ *       im_1[ii] = std::sin(0.3f * (float)ii);
+ *       re_2[ii] = std::cos(0.1f * (float)ii);
+ *       im_2[ii] = std::sin(0.1f * (float)ii);
+ *   }
+ *
+ *   // a tone at f=0.4, in place of the first
+ *   volk_32f_x4_complex_multiply_32f_x2(re_1, im_1, re_1, im_1, re_2, im_2, N);
+ *
+ *   volk_free(re_1);
+ *   volk_free(im_1);
+ *   volk_free(re_2);
+ *   volk_free(im_2);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x4_complex_multiply_32f_x2_H
+#define INCLUDED_volk_32f_x4_complex_multiply_32f_x2_H
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_generic(float* cReal,
+                                                               float* cImag,
+                                                               const float* aReal,
+                                                               const float* aImag,
+                                                               const float* bReal,
+                                                               const float* bImag,
+                                                               unsigned int num_points)
+{
+    unsigned int i;
+    float re, im;
+
+    for (i = 0; i < num_points; i++) {
+        re = aReal[i] * bReal[i] - aImag[i] * bImag[i];
+        im = aReal[i] * bImag[i] + aImag[i] * bReal[i];
+        cReal[i] = re;
+        cImag[i] = im;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_u_avx2_fma(float* cReal,
+                                                                  float* cImag,
+                                                                  const float* aReal,
+                                                                  const float* aImag,
+                                                                  const float* bReal,
+                                                                  const float* bImag,
+                                                                  unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+    __m256 ar, ai, br, bi, re, im;
+
+    for (number = 0; number < eighth_points; number++) {
+        ar = _mm256_loadu_ps(aReal);
+        ai = _mm256_loadu_ps(aImag);
+        br = _mm256_loadu_ps(bReal);
+        bi = _mm256_loadu_ps(bImag);
+        re = _mm256_fmsub_ps(ar, br, _mm256_mul_ps(ai, bi));
+        im = _mm256_fmadd_ps(ar, bi, _mm256_mul_ps(ai, br));
+        _mm256_storeu_ps(cReal, re);
+        _mm256_storeu_ps(cImag, im);
+        aReal += 8;
+        aImag += 8;
+        bReal += 8;
+        bImag += 8;
+        cReal += 8;
+        cImag += 8;
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        const float real = *aReal * *bReal - *aImag * *bImag;
+        *cImag++ = *aReal++ * *bImag++ + *aImag++ * *bReal++;
+        *cReal++ = real;
+    }
+}
+
+// the loop of the _pf impls, a cache line of each stream per iteration and
+// the four inputs prefetched distance bytes ahead, which helps where the
+// hardware prefetcher does not track six streams
+static inline void volk_32f_x4_complex_multiply_32f_x2_avx2_fma_prefetch(
+    float* cReal,
+    float* cImag,
+    const float* aReal,
+    const float* aImag,
+    const float* bReal,
+    const float* bImag,
+    unsigned int num_points,
+    const unsigned int distance)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const unsigned int ahead = distance / sizeof(float);
+    unsigned int number, i;
+    __m256 ar, ai, br, bi;
+
+    for (number = 0; number < 16 * sixteenth_points; number += 16) {
+        _mm_prefetch((const char*)(aReal + number + ahead), _MM_HINT_T0);
+        _mm_prefetch((const char*)(aImag + number + ahead), _MM_HINT_T0);
+        _mm_prefetch((const char*)(bReal + number + ahead), _MM_HINT_T0);
+        _mm_prefetch((const char*)(bImag + number + ahead), _MM_HINT_T0);
+        for (i = number; i < number + 16; i += 8) {
+            ar = _mm256_loadu_ps(aReal + i);
+            ai = _mm256_loadu_ps(aImag + i);
+            br = _mm256_loadu_ps(bReal + i);
+            bi = _mm256_loadu_ps(bImag + i);
+            _mm256_storeu_ps(cReal + i, _mm256_fmsub_ps(ar, br, _mm256_mul_ps(ai, bi)));
+            _mm256_storeu_ps(cImag + i, _mm256_fmadd_ps(ar, bi, _mm256_mul_ps(ai, br)));
+        }
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        const float real = aReal[number] * bReal[number] - aImag[number] * bImag[number];
+        cImag[number] = aReal[number] * bImag[number] + aImag[number] * bReal[number];
+        cReal[number] = real;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32f_x4_complex_multiply_32f_x2_u_avx2_fma_pf256(float* cReal,
+                                                     float* cImag,
+                                                     const float* aReal,
+                                                     const float* aImag,
+                                                     const float* bReal,
+                                                     const float* bImag,
+                                                     unsigned int num_points)
+{
+    volk_32f_x4_complex_multiply_32f_x2_avx2_fma_prefetch(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points, 256);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32f_x4_complex_multiply_32f_x2_u_avx2_fma_pf1024(float* cReal,
+                                                      float* cImag,
+                                                      const float* aReal,
+                                                      const float* aImag,
+                                                      const float* bReal,
+                                                      const float* bImag,
+                                                      unsigned int num_points)
+{
+    volk_32f_x4_complex_multiply_32f_x2_avx2_fma_prefetch(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points, 1024);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32f_x4_complex_multiply_32f_x2_u_avx2_fma_pf4096(float* cReal,
+                                                      float* cImag,
+                                                      const float* aReal,
+                                                      const float* aImag,
+                                                      const float* bReal,
+                                                      const float* bImag,
+                                                      unsigned int num_points)
+{
+    volk_32f_x4_complex_multiply_32f_x2_avx2_fma_prefetch(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points, 4096);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_u_avx512f(float* cReal,
+                                                                 float* cImag,
+                                                                 const float* aReal,
+                                                                 const float* aImag,
+                                                                 const float* bReal,
+                                                                 const float* bImag,
+                                                                 unsigned int num_points)
+{
+    unsigned int number;
+    __m512 ar, ai, br, bi, re, im;
+    __mmask16 mask = 0xffff;
+
+    for (number = 0; number < num_points; number += 16) {
+        if (num_points - number < 16) {
+            mask = (__mmask16)((1u << (num_points - number)) - 1);
+        }
+        ar = _mm512_maskz_loadu_ps(mask, aReal + number);
+        ai = _mm512_maskz_loadu_ps(mask, aImag + number);
+        br = _mm512_maskz_loadu_ps(mask, bReal + number);
+        bi = _mm512_maskz_loadu_ps(mask, bImag + number);
+        re = _mm512_fmsub_ps(ar, br, _mm512_mul_ps(ai, bi));
+        im = _mm512_fmadd_ps(ar, bi, _mm512_mul_ps(ai, br));
+        _mm512_mask_storeu_ps(cReal + number, mask, re);
+        _mm512_mask_storeu_ps(cImag + number, mask, im);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_x4_complex_multiply_32f_x2_neonv8(float* cReal,
+                                                              float* cImag,
+                                                              const float* aReal,
+                                                              const float* aImag,
+                                                              const float* bReal,
+                                                              const float* bImag,
+                                                              unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+    float32x4_t ar, ai, br, bi, re, im;
+
+    for (number = 0; number < quarter_points; number++) {
+        ar = vld1q_f32(aReal);
+        ai = vld1q_f32(aImag);
+        br = vld1q_f32(bReal);
+        bi = vld1q_f32(bImag);
+        re = vfmsq_f32(vmulq_f32(ar, br), ai, bi);
+        im = vfmaq_f32(vmulq_f32(ar, bi), ai, br);
+        vst1q_f32(cReal, re);
+        vst1q_f32(cImag, im);
+        aReal += 4;
+        aImag += 4;
+        bReal += 4;
+        bImag += 4;
+        cReal += 4;
+        cImag += 4;
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        const float real = *aReal * *bReal - *aImag * *bImag;
+        *cImag++ = *aReal++ * *bImag++ + *aImag++ * *bReal++;
+        *cReal++ = real;
+    }
+}
+
+// the loop of the _pf impls, a cache line of each stream per iteration and
+// the four inputs prefetched distance bytes ahead
+static inline void volk_32f_x4_complex_multiply_32f_x2_neonv8_prefetch(
+    float* cReal,
+    float* cImag,
+    const float* aReal,
+    const float* aImag,
+    const float* bReal,
+    const float* bImag,
+    unsigned int num_points,
+    const unsigned int distance)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const unsigned int ahead = distance / sizeof(float);
+    unsigned int number, i;
+    float32x4_t ar, ai, br, bi;
+
+    for (number = 0; number < 16 * sixteenth_points; number += 16) {
+        __VOLK_PREFETCH(aReal + number + ahead);
+        __VOLK_PREFETCH(aImag + number + ahead);
+        __VOLK_PREFETCH(bReal + number + ahead);
+        __VOLK_PREFETCH(bImag + number + ahead);
+        for (i = number; i < number + 16; i += 4) {
+            ar = vld1q_f32(aReal + i);
+            ai = vld1q_f32(aImag + i);
+            br = vld1q_f32(bReal + i);
+            bi = vld1q_f32(bImag + i);
+            vst1q_f32(cReal + i, vfmsq_f32(vmulq_f32(ar, br), ai, bi));
+            vst1q_f32(cImag + i, vfmaq_f32(vmulq_f32(ar, bi), ai, br));
+        }
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        const float real = aReal[number] * bReal[number] - aImag[number] * bImag[number];
+        cImag[number] = aReal[number] * bImag[number] + aImag[number] * bReal[number];
+        cReal[number] = real;
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32f_x4_complex_multiply_32f_x2_neonv8_pf256(float* cReal,
+                                                 float* cImag,
+                                                 const float* aReal,
+                                                 const float* aImag,
+                                                 const float* bReal,
+                                                 const float* bImag,
+                                                 unsigned int num_points)
+{
+    volk_32f_x4_complex_multiply_32f_x2_neonv8_prefetch(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points, 256);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32f_x4_complex_multiply_32f_x2_neonv8_pf1024(float* cReal,
+                                                  float* cImag,
+                                                  const float* aReal,
+                                                  const float* aImag,
+                                                  const float* bReal,
+                                                  const float* bImag,
+                                                  unsigned int num_points)
+{
+    volk_32f_x4_complex_multiply_32f_x2_neonv8_prefetch(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points, 1024);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32f_x4_complex_multiply_32f_x2_neonv8_pf4096(float* cReal,
+                                                  float* cImag,
+                                                  const float* aReal,
+                                                  const float* aImag,
+                                                  const float* bReal,
+                                                  const float* bImag,
+                                                  unsigned int num_points)
+{
+    volk_32f_x4_complex_multiply_32f_x2_neonv8_prefetch(
+        cReal, cImag, aReal, aImag, bReal, bImag, num_points, 4096);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_x4_complex_multiply_32f_x2_H */
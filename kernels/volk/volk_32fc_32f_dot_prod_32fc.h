@@ -178,6 +178,108 @@ static inline void volk_32fc_32f_dot_prod_32fc_a_avx2_fma(lv_32fc_t* result,
 
 #endif /*LV_HAVE_AVX2 && LV_HAVE_FMA*/
 
+#ifdef LV_HAVE_AVX512F
+
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_dot_prod_32fc_a_avx512f(lv_32fc_t* result,
+                                                         const lv_32fc_t* input,
+                                                         const float* taps,
+                                                         unsigned int num_points)
+{
+
+    unsigned int number = 0;
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float res[2];
+    float *realpt = &res[0], *imagpt = &res[1];
+    const float* aPtr = (float*)input;
+    const float* bPtr = taps;
+
+    // t0|t0|t1|t1|...|t7|t7 and t8|t8|...|t15|t15 of 16 taps
+    const __m512i loIdx =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    const __m512i hiIdx =
+        _mm512_set_epi32(15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8);
+
+    __m512 x0Val, x1Val, x2Val, x3Val;
+
+    // eight independent sums keep both FMA ports busy through the FMA latency
+    __m512 dotProdVal0 = _mm512_setzero_ps();
+    __m512 dotProdVal1 = _mm512_setzero_ps();
+    __m512 dotProdVal2 = _mm512_setzero_ps();
+    __m512 dotProdVal3 = _mm512_setzero_ps();
+    __m512 dotProdVal4 = _mm512_setzero_ps();
+    __m512 dotProdVal5 = _mm512_setzero_ps();
+    __m512 dotProdVal6 = _mm512_setzero_ps();
+    __m512 dotProdVal7 = _mm512_setzero_ps();
+
+    for (; number < sixtyfourthPoints; number++) {
+
+        x0Val = _mm512_load_ps(bPtr);
+        x1Val = _mm512_load_ps(bPtr + 16);
+        x2Val = _mm512_load_ps(bPtr + 32);
+        x3Val = _mm512_load_ps(bPtr + 48);
+
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr), _mm512_permutexvar_ps(loIdx, x0Val), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr + 16), _mm512_permutexvar_ps(hiIdx, x0Val), dotProdVal1);
+        dotProdVal2 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr + 32), _mm512_permutexvar_ps(loIdx, x1Val), dotProdVal2);
+        dotProdVal3 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr + 48), _mm512_permutexvar_ps(hiIdx, x1Val), dotProdVal3);
+        dotProdVal4 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr + 64), _mm512_permutexvar_ps(loIdx, x2Val), dotProdVal4);
+        dotProdVal5 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr + 80), _mm512_permutexvar_ps(hiIdx, x2Val), dotProdVal5);
+        dotProdVal6 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr + 96), _mm512_permutexvar_ps(loIdx, x3Val), dotProdVal6);
+        dotProdVal7 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr + 112), _mm512_permutexvar_ps(hiIdx, x3Val), dotProdVal7);
+
+        aPtr += 128;
+        bPtr += 64;
+    }
+
+    // the remaining blocks of 16 points
+    for (number = sixtyfourthPoints * 4; number < sixteenthPoints; number++) {
+
+        x0Val = _mm512_load_ps(bPtr);
+
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr), _mm512_permutexvar_ps(loIdx, x0Val), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_load_ps(aPtr + 16), _mm512_permutexvar_ps(hiIdx, x0Val), dotProdVal1);
+
+        aPtr += 32;
+        bPtr += 16;
+    }
+
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal1);
+    dotProdVal2 = _mm512_add_ps(dotProdVal2, dotProdVal3);
+    dotProdVal4 = _mm512_add_ps(dotProdVal4, dotProdVal5);
+    dotProdVal6 = _mm512_add_ps(dotProdVal6, dotProdVal7);
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal2);
+    dotProdVal4 = _mm512_add_ps(dotProdVal4, dotProdVal6);
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal4);
+
+    // the real parts are in the even lanes, the imaginary parts in the odd ones
+    *realpt = _mm512_mask_reduce_add_ps(0x5555, dotProdVal0);
+    *imagpt = _mm512_mask_reduce_add_ps(0xAAAA, dotProdVal0);
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *realpt += ((*aPtr++) * (*bPtr));
+        *imagpt += ((*aPtr++) * (*bPtr++));
+    }
+
+    *result = *(lv_32fc_t*)(&res[0]);
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
 #ifdef LV_HAVE_AVX
 
 #include <immintrin.h>
@@ -437,6 +539,109 @@ static inline void volk_32fc_32f_dot_prod_32fc_u_avx2_fma(lv_32fc_t* result,
 
 #endif /*LV_HAVE_AVX2 && LV_HAVE_FMA*/
 
+#ifdef LV_HAVE_AVX512F
+
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_dot_prod_32fc_u_avx512f(lv_32fc_t* result,
+                                                         const lv_32fc_t* input,
+                                                         const float* taps,
+                                                         unsigned int num_points)
+{
+
+    unsigned int number = 0;
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float res[2];
+    float *realpt = &res[0], *imagpt = &res[1];
+    const float* aPtr = (float*)input;
+    const float* bPtr = taps;
+
+    // t0|t0|t1|t1|...|t7|t7 and t8|t8|...|t15|t15 of 16 taps
+    const __m512i loIdx =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    const __m512i hiIdx =
+        _mm512_set_epi32(15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8);
+
+    __m512 x0Val, x1Val, x2Val, x3Val;
+
+    // eight independent sums keep both FMA ports busy through the FMA latency
+    __m512 dotProdVal0 = _mm512_setzero_ps();
+    __m512 dotProdVal1 = _mm512_setzero_ps();
+    __m512 dotProdVal2 = _mm512_setzero_ps();
+    __m512 dotProdVal3 = _mm512_setzero_ps();
+    __m512 dotProdVal4 = _mm512_setzero_ps();
+    __m512 dotProdVal5 = _mm512_setzero_ps();
+    __m512 dotProdVal6 = _mm512_setzero_ps();
+    __m512 dotProdVal7 = _mm512_setzero_ps();
+
+    for (; number < sixtyfourthPoints; number++) {
+
+        x0Val = _mm512_loadu_ps(bPtr);
+        x1Val = _mm512_loadu_ps(bPtr + 16);
+        x2Val = _mm512_loadu_ps(bPtr + 32);
+        x3Val = _mm512_loadu_ps(bPtr + 48);
+
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr), _mm512_permutexvar_ps(loIdx, x0Val), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr + 16), _mm512_permutexvar_ps(hiIdx, x0Val), dotProdVal1);
+        dotProdVal2 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr + 32), _mm512_permutexvar_ps(loIdx, x1Val), dotProdVal2);
+        dotProdVal3 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr + 48), _mm512_permutexvar_ps(hiIdx, x1Val), dotProdVal3);
+        dotProdVal4 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr + 64), _mm512_permutexvar_ps(loIdx, x2Val), dotProdVal4);
+        dotProdVal5 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr + 80), _mm512_permutexvar_ps(hiIdx, x2Val), dotProdVal5);
+        dotProdVal6 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr + 96), _mm512_permutexvar_ps(loIdx, x3Val), dotProdVal6);
+        dotProdVal7 = _mm512_fmadd_ps(_mm512_loadu_ps(aPtr + 112),
+                                      _mm512_permutexvar_ps(hiIdx, x3Val),
+                                      dotProdVal7);
+
+        aPtr += 128;
+        bPtr += 64;
+    }
+
+    // the remaining blocks of 16 points
+    for (number = sixtyfourthPoints * 4; number < sixteenthPoints; number++) {
+
+        x0Val = _mm512_loadu_ps(bPtr);
+
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr), _mm512_permutexvar_ps(loIdx, x0Val), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(aPtr + 16), _mm512_permutexvar_ps(hiIdx, x0Val), dotProdVal1);
+
+        aPtr += 32;
+        bPtr += 16;
+    }
+
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal1);
+    dotProdVal2 = _mm512_add_ps(dotProdVal2, dotProdVal3);
+    dotProdVal4 = _mm512_add_ps(dotProdVal4, dotProdVal5);
+    dotProdVal6 = _mm512_add_ps(dotProdVal6, dotProdVal7);
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal2);
+    dotProdVal4 = _mm512_add_ps(dotProdVal4, dotProdVal6);
+    dotProdVal0 = _mm512_add_ps(dotProdVal0, dotProdVal4);
+
+    // the real parts are in the even lanes, the imaginary parts in the odd ones
+    *realpt = _mm512_mask_reduce_add_ps(0x5555, dotProdVal0);
+    *imagpt = _mm512_mask_reduce_add_ps(0xAAAA, dotProdVal0);
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *realpt += ((*aPtr++) * (*bPtr));
+        *imagpt += ((*aPtr++) * (*bPtr++));
+    }
+
+    *result = *(lv_32fc_t*)(&res[0]);
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
 #ifdef LV_HAVE_AVX
 
 #include <immintrin.h>
@@ -681,6 +886,69 @@ static inline void volk_32fc_32f_dot_prod_32fc_a_neon(lv_32fc_t* __restrict resu
 
 #endif /*LV_HAVE_NEON*/
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_dot_prod_32fc_neonv8(lv_32fc_t* result,
+                                                      const lv_32fc_t* input,
+                                                      const float* taps,
+                                                      unsigned int num_points)
+{
+    unsigned int number;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    float res[2];
+    float *realpt = &res[0], *imagpt = &res[1];
+    const float* inputPtr = (float*)input;
+    const float* tapsPtr = taps;
+
+    float32x4x2_t in0, in1, in2, in3;
+    float32x4_t t0, t1, t2, t3;
+
+    // four pairs of fused sums hide the FMA latency
+    float32x4_t real0 = vdupq_n_f32(0.0f), imag0 = vdupq_n_f32(0.0f);
+    float32x4_t real1 = vdupq_n_f32(0.0f), imag1 = vdupq_n_f32(0.0f);
+    float32x4_t real2 = vdupq_n_f32(0.0f), imag2 = vdupq_n_f32(0.0f);
+    float32x4_t real3 = vdupq_n_f32(0.0f), imag3 = vdupq_n_f32(0.0f);
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        t0 = vld1q_f32(tapsPtr);
+        t1 = vld1q_f32(tapsPtr + 4);
+        t2 = vld1q_f32(tapsPtr + 8);
+        t3 = vld1q_f32(tapsPtr + 12);
+        in0 = vld2q_f32(inputPtr);
+        in1 = vld2q_f32(inputPtr + 8);
+        in2 = vld2q_f32(inputPtr + 16);
+        in3 = vld2q_f32(inputPtr + 24);
+
+        real0 = vfmaq_f32(real0, in0.val[0], t0);
+        imag0 = vfmaq_f32(imag0, in0.val[1], t0);
+        real1 = vfmaq_f32(real1, in1.val[0], t1);
+        imag1 = vfmaq_f32(imag1, in1.val[1], t1);
+        real2 = vfmaq_f32(real2, in2.val[0], t2);
+        imag2 = vfmaq_f32(imag2, in2.val[1], t2);
+        real3 = vfmaq_f32(real3, in3.val[0], t3);
+        imag3 = vfmaq_f32(imag3, in3.val[1], t3);
+
+        tapsPtr += 16;
+        inputPtr += 32;
+    }
+
+    real0 = vaddq_f32(vaddq_f32(real0, real1), vaddq_f32(real2, real3));
+    imag0 = vaddq_f32(vaddq_f32(imag0, imag1), vaddq_f32(imag2, imag3));
+    *realpt = vaddvq_f32(real0);
+    *imagpt = vaddvq_f32(imag0);
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *realpt += ((*inputPtr++) * (*tapsPtr));
+        *imagpt += ((*inputPtr++) * (*tapsPtr++));
+    }
+
+    *result = *(lv_32fc_t*)(&res[0]);
+}
+
+#endif /*LV_HAVE_NEONV8*/
+
 #ifdef LV_HAVE_NEONV7
 extern void volk_32fc_32f_dot_prod_32fc_a_neonasm(lv_32fc_t* result,
                                                   const lv_32fc_t* input,
@@ -0,0 +1,291 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_32f_fir_decimate_32fc
+ *
+ * \b Overview
+ *
+ * Filters complex samples with real taps and keeps every decimation-th
+ * output, computing only the outputs which are kept. Output i is the dot
+ * product of the taps with the num_taps inputs starting at
+ * i * decimation, so the input holds (num_points - 1) * decimation +
+ * num_taps samples. The taps are in time reversed order, as for the dot
+ * product.
+ *
+ * The SIMD implementations vectorise each output over the taps and
+ * compute four outputs at once, sharing every tap vector between them.
+ *
+ * For a decimator running over a stream, volk_fir_decimator_32fc_init()
+ * in volk_fir.h keeps the history and the decimation phase between
+ * blocks in a caller-owned state.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_fir_decimate_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ * const float* taps, unsigned int num_taps, unsigned int decimation,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: (num_points - 1) * decimation + num_taps samples, the oldest first.
+ * \li taps: The filter taps, time reversed.
+ * \li num_taps: The number of taps, at least 1.
+ * \li decimation: The distance in inputs between two outputs, at least 1.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: output[i] = sum of input[i * decimation + k] * taps[k] over k < num_taps.
+ *
+ * \b Example
+ * Decimate by 16 with a 128 tap low pass filter.
+ * \code
+ *   unsigned int N = 256;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*((N - 1) * 16 + 128), alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* taps = (float*)volk_malloc(sizeof(float)*128, alignment);
+ *
+ *   volk_32fc_32f_fir_decimate_32fc(out, in, taps, 128, 16, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ *   volk_free(taps);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_fir_decimate_32fc_u_H
+#define INCLUDED_volk_32fc_32f_fir_decimate_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_fir_decimate_32fc_generic(lv_32fc_t* output,
+                                                           const lv_32fc_t* input,
+                                                           const float* taps,
+                                                           unsigned int num_taps,
+                                                           unsigned int decimation,
+                                                           unsigned int num_points)
+{
+    unsigned int number, k;
+    for (number = 0; number < num_points; number++) {
+        const float* in = (const float*)(input + number * decimation);
+        float sum_re = 0.f;
+        float sum_im = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sum_re += in[2 * k] * taps[k];
+            sum_im += in[2 * k + 1] * taps[k];
+        }
+        output[number] = lv_cmake(sum_re, sum_im);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_32f_fir_decimate_32fc_sse(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       const float* taps,
+                                                       unsigned int num_taps,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    const unsigned int vector_taps = num_taps & ~3u;
+    unsigned int number = 0, k, j;
+
+    // four outputs share every tap vector
+    for (; number + 4 <= num_points; number += 4) {
+        const float* in[4];
+        __m128 acc[4];
+        for (j = 0; j < 4; j++) {
+            in[j] = (const float*)(input + (number + j) * decimation);
+            acc[j] = _mm_setzero_ps();
+        }
+        for (k = 0; k < vector_taps; k += 4) {
+            // one tap per complex sample: t0 t0 t1 t1 and t2 t2 t3 t3
+            const __m128 t = _mm_loadu_ps(taps + k);
+            const __m128 tap_lo = _mm_unpacklo_ps(t, t);
+            const __m128 tap_hi = _mm_unpackhi_ps(t, t);
+            for (j = 0; j < 4; j++) {
+                const __m128 x_lo = _mm_loadu_ps(in[j] + 2 * k);
+                const __m128 x_hi = _mm_loadu_ps(in[j] + 2 * k + 4);
+                acc[j] = _mm_add_ps(acc[j], _mm_mul_ps(x_lo, tap_lo));
+                acc[j] = _mm_add_ps(acc[j], _mm_mul_ps(x_hi, tap_hi));
+            }
+        }
+        // add the two complex sums in each accumulator, two outputs per store
+        _mm_storeu_ps((float*)(output + number),
+                      _mm_add_ps(_mm_movelh_ps(acc[0], acc[1]),
+                                 _mm_movehl_ps(acc[1], acc[0])));
+        _mm_storeu_ps((float*)(output + number + 2),
+                      _mm_add_ps(_mm_movelh_ps(acc[2], acc[3]),
+                                 _mm_movehl_ps(acc[3], acc[2])));
+
+        for (j = 0; j < 4; j++) {
+            for (k = vector_taps; k < num_taps; k++) {
+                output[number + j] += input[(number + j) * decimation + k] * taps[k];
+            }
+        }
+    }
+
+    for (; number < num_points; number++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number * decimation + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_fir_decimate_32fc_avx(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       const float* taps,
+                                                       unsigned int num_taps,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    const unsigned int vector_taps = num_taps & ~3u;
+    unsigned int number = 0, k, j;
+
+    // four outputs share every tap vector
+    for (; number + 4 <= num_points; number += 4) {
+        const float* in[4];
+        __m256 acc[4];
+        __m128 sum[4];
+        for (j = 0; j < 4; j++) {
+            in[j] = (const float*)(input + (number + j) * decimation);
+            acc[j] = _mm256_setzero_ps();
+        }
+        for (k = 0; k < vector_taps; k += 4) {
+            // one tap per complex sample: t0 t0 t1 t1 t2 t2 t3 t3
+            const __m128 t = _mm_loadu_ps(taps + k);
+            const __m256 tap = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_unpacklo_ps(t, t)), _mm_unpackhi_ps(t, t), 1);
+            for (j = 0; j < 4; j++) {
+                const __m256 x = _mm256_loadu_ps(in[j] + 2 * k);
+                acc[j] = _mm256_add_ps(acc[j], _mm256_mul_ps(x, tap));
+            }
+        }
+        // add the four complex sums in each accumulator, two outputs per store
+        for (j = 0; j < 4; j++) {
+            sum[j] = _mm_add_ps(_mm256_castps256_ps128(acc[j]),
+                                _mm256_extractf128_ps(acc[j], 1));
+        }
+        _mm_storeu_ps((float*)(output + number),
+                      _mm_add_ps(_mm_movelh_ps(sum[0], sum[1]),
+                                 _mm_movehl_ps(sum[1], sum[0])));
+        _mm_storeu_ps((float*)(output + number + 2),
+                      _mm_add_ps(_mm_movelh_ps(sum[2], sum[3]),
+                                 _mm_movehl_ps(sum[3], sum[2])));
+
+        for (j = 0; j < 4; j++) {
+            for (k = vector_taps; k < num_taps; k++) {
+                output[number + j] += input[(number + j) * decimation + k] * taps[k];
+            }
+        }
+    }
+
+    for (; number < num_points; number++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number * decimation + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_fir_decimate_32fc_neon(lv_32fc_t* output,
+                                                        const lv_32fc_t* input,
+                                                        const float* taps,
+                                                        unsigned int num_taps,
+                                                        unsigned int decimation,
+                                                        unsigned int num_points)
+{
+    const unsigned int vector_taps = num_taps & ~3u;
+    unsigned int number = 0, k, j;
+
+    // four outputs share every tap vector
+    for (; number + 4 <= num_points; number += 4) {
+        const float* in[4];
+        float32x4_t acc_re[4], acc_im[4];
+        float32x2_t sum_re[4], sum_im[4];
+        float32x4x2_t result;
+        for (j = 0; j < 4; j++) {
+            in[j] = (const float*)(input + (number + j) * decimation);
+            acc_re[j] = vdupq_n_f32(0.f);
+            acc_im[j] = vdupq_n_f32(0.f);
+        }
+        for (k = 0; k < vector_taps; k += 4) {
+            const float32x4_t tap = vld1q_f32(taps + k);
+            for (j = 0; j < 4; j++) {
+                const float32x4x2_t x = vld2q_f32(in[j] + 2 * k);
+                acc_re[j] = vmlaq_f32(acc_re[j], x.val[0], tap);
+                acc_im[j] = vmlaq_f32(acc_im[j], x.val[1], tap);
+            }
+        }
+        // pairwise add the lanes of the four accumulators into one vector
+        for (j = 0; j < 4; j++) {
+            sum_re[j] = vpadd_f32(vget_low_f32(acc_re[j]), vget_high_f32(acc_re[j]));
+            sum_im[j] = vpadd_f32(vget_low_f32(acc_im[j]), vget_high_f32(acc_im[j]));
+        }
+        result.val[0] = vcombine_f32(vpadd_f32(sum_re[0], sum_re[1]),
+                                     vpadd_f32(sum_re[2], sum_re[3]));
+        result.val[1] = vcombine_f32(vpadd_f32(sum_im[0], sum_im[1]),
+                                     vpadd_f32(sum_im[2], sum_im[3]));
+        vst2q_f32((float*)(output + number), result);
+
+        for (j = 0; j < 4; j++) {
+            for (k = vector_taps; k < num_taps; k++) {
+                output[number + j] += input[(number + j) * decimation + k] * taps[k];
+            }
+        }
+    }
+
+    for (; number < num_points; number++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number * decimation + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_fir_decimate_32fc_u_H */
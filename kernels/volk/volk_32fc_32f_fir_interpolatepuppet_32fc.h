@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32FC_32F_FIR_INTERPOLATEPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_32F_FIR_INTERPOLATEPUPPET_32FC_H
+
+#include <string.h>
+#include <volk/volk_32fc_32f_fir_interpolate_32fc.h>
+
+/* Interpolates by 4 with 7 taps per phase, or filters with 1 tap for short
+ * vectors, reading the 28 taps from the start of the second buffer. The
+ * outputs past the last full window are copies of the input. */
+#define VOLK_FIR_INTERPOLATEPUPPET(impl)                                       \
+    const unsigned int interpolation = num_points < 28 ? 1 : 4;                \
+    const unsigned int num_taps = num_points < 28 ? 1 : 7;                     \
+    const unsigned int num_inputs = num_points / interpolation - num_taps + 1; \
+    const unsigned int num_outputs = num_inputs * interpolation;               \
+    impl(output, input, taps, num_taps, interpolation, num_inputs);            \
+    memcpy(output + num_outputs, input + num_outputs,                          \
+           (num_points - num_outputs) * sizeof(*output));
+
+#ifdef LV_HAVE_GENERIC
+static inline void
+volk_32fc_32f_fir_interpolatepuppet_32fc_generic(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 const float* taps,
+                                                 unsigned int num_points)
+{
+    VOLK_FIR_INTERPOLATEPUPPET(volk_32fc_32f_fir_interpolate_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+static inline void volk_32fc_32f_fir_interpolatepuppet_32fc_sse(lv_32fc_t* output,
+                                                                const lv_32fc_t* input,
+                                                                const float* taps,
+                                                                unsigned int num_points)
+{
+    VOLK_FIR_INTERPOLATEPUPPET(volk_32fc_32f_fir_interpolate_32fc_sse);
+}
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32fc_32f_fir_interpolatepuppet_32fc_avx(lv_32fc_t* output,
+                                                                const lv_32fc_t* input,
+                                                                const float* taps,
+                                                                unsigned int num_points)
+{
+    VOLK_FIR_INTERPOLATEPUPPET(volk_32fc_32f_fir_interpolate_32fc_avx);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32fc_32f_fir_interpolatepuppet_32fc_neon(lv_32fc_t* output,
+                                                                 const lv_32fc_t* input,
+                                                                 const float* taps,
+                                                                 unsigned int num_points)
+{
+    VOLK_FIR_INTERPOLATEPUPPET(volk_32fc_32f_fir_interpolate_32fc_neon);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32FC_32F_FIR_INTERPOLATEPUPPET_32FC_H */
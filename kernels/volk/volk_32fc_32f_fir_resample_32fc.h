@@ -0,0 +1,349 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_32f_fir_resample_32fc
+ *
+ * \b Overview
+ *
+ * Resamples complex samples by the rational factor interpolation /
+ * decimation with real taps as a polyphase filter bank, computing only the
+ * outputs it keeps. Output i is at offset + i * decimation in units of
+ * 1 / interpolation of an input: its window starts at the input of that
+ * position divided by interpolation and it is filtered by the phase of the
+ * remainder, so the input holds (offset + (num_points - 1) * decimation) /
+ * interpolation + num_taps samples.
+ *
+ * The taps are stored as for volk_32fc_32f_fir_interpolate_32fc, phase by
+ * phase, num_taps for each, every phase time reversed. With a decimation
+ * of 1 the outputs are those of the interpolating kernel, with an
+ * interpolation of 1 those of the decimating one. For an irrational ratio
+ * or a drifting clock, a bank of many phases gets close, or see
+ * volk_32fc_s64f_x2_farrow_resample_32fc.
+ *
+ * The SIMD implementations vectorise each output over the taps and
+ * compute four outputs at once, each with its own window and phase.
+ *
+ * For a resampler running over a stream, volk_fir_resampler_32fc_init()
+ * in volk_fir.h splits a prototype filter into its phases and keeps the
+ * history and the position of the next output between blocks in a
+ * caller-owned state.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_fir_resample_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ * const float* taps, unsigned int num_taps, unsigned int interpolation,
+ * unsigned int decimation, unsigned int offset, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The samples, the oldest first.
+ * \li taps: interpolation phases of num_taps taps each, every phase time reversed.
+ * \li num_taps: The number of taps per phase, at least 1.
+ * \li interpolation: The number of phases, at least 1.
+ * \li decimation: The step from one output to the next, in phases.
+ * \li offset: The position of the first output, in phases.
+ * \li num_points: The number of outputs.
+ *
+ * \b Outputs
+ * \li output: num_points samples.
+ *
+ * \b Example
+ * Resample 61.44 Msps to 23.04 Msps, by 3 / 8, with 24 taps per phase.
+ * \code
+ *   unsigned int N = 3000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*((N - 1) * 8 / 3 + 24), alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* taps = (float*)volk_malloc(sizeof(float)*3*24, alignment);
+ *
+ *   volk_32fc_32f_fir_resample_32fc(out, in, taps, 24, 3, 8, 0, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ *   volk_free(taps);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_fir_resample_32fc_u_H
+#define INCLUDED_volk_32fc_32f_fir_resample_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+/* Moves a window start and a phase on by one output */
+static inline void volk_fir_resample_next(unsigned int* start,
+                                          unsigned int* phase,
+                                          unsigned int interpolation,
+                                          unsigned int decimation)
+{
+    *start += decimation / interpolation;
+    *phase += decimation % interpolation;
+    if (*phase >= interpolation) {
+        *phase -= interpolation;
+        (*start)++;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_fir_resample_32fc_generic(lv_32fc_t* output,
+                                                           const lv_32fc_t* input,
+                                                           const float* taps,
+                                                           unsigned int num_taps,
+                                                           unsigned int interpolation,
+                                                           unsigned int decimation,
+                                                           unsigned int offset,
+                                                           unsigned int num_points)
+{
+    unsigned int start = offset / interpolation;
+    unsigned int phase = offset % interpolation;
+    unsigned int number, k;
+    for (number = 0; number < num_points; number++) {
+        const float* in = (const float*)(input + start);
+        const float* coeffs = taps + phase * num_taps;
+        float sum_re = 0.f;
+        float sum_im = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sum_re += in[2 * k] * coeffs[k];
+            sum_im += in[2 * k + 1] * coeffs[k];
+        }
+        output[number] = lv_cmake(sum_re, sum_im);
+        volk_fir_resample_next(&start, &phase, interpolation, decimation);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_32f_fir_resample_32fc_sse(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       const float* taps,
+                                                       unsigned int num_taps,
+                                                       unsigned int interpolation,
+                                                       unsigned int decimation,
+                                                       unsigned int offset,
+                                                       unsigned int num_points)
+{
+    const unsigned int vector_taps = num_taps & ~3u;
+    unsigned int start = offset / interpolation;
+    unsigned int phase = offset % interpolation;
+    unsigned int number, k, j;
+
+    for (number = 0; number + 4 <= num_points; number += 4) {
+        const lv_32fc_t* window[4];
+        const float* coeffs[4];
+        __m128 acc[4];
+        for (j = 0; j < 4; j++) {
+            window[j] = input + start;
+            coeffs[j] = taps + phase * num_taps;
+            acc[j] = _mm_setzero_ps();
+            volk_fir_resample_next(&start, &phase, interpolation, decimation);
+        }
+        for (k = 0; k < vector_taps; k += 4) {
+            for (j = 0; j < 4; j++) {
+                // one tap per complex sample: t0 t0 t1 t1 and t2 t2 t3 t3
+                const __m128 t = _mm_loadu_ps(coeffs[j] + k);
+                const __m128 x_lo = _mm_loadu_ps((const float*)(window[j] + k));
+                const __m128 x_hi = _mm_loadu_ps((const float*)(window[j] + k + 2));
+                acc[j] = _mm_add_ps(acc[j], _mm_mul_ps(x_lo, _mm_unpacklo_ps(t, t)));
+                acc[j] = _mm_add_ps(acc[j], _mm_mul_ps(x_hi, _mm_unpackhi_ps(t, t)));
+            }
+        }
+        // add the two complex sums in each accumulator
+        _mm_storeu_ps((float*)(output + number),
+                      _mm_add_ps(_mm_movelh_ps(acc[0], acc[1]),
+                                 _mm_movehl_ps(acc[1], acc[0])));
+        _mm_storeu_ps((float*)(output + number + 2),
+                      _mm_add_ps(_mm_movelh_ps(acc[2], acc[3]),
+                                 _mm_movehl_ps(acc[3], acc[2])));
+
+        for (j = 0; j < 4; j++) {
+            for (k = vector_taps; k < num_taps; k++) {
+                output[number + j] += window[j][k] * coeffs[j][k];
+            }
+        }
+    }
+
+    for (; number < num_points; number++) {
+        const float* coeffs = taps + phase * num_taps;
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[start + k] * coeffs[k];
+        }
+        output[number] = sum;
+        volk_fir_resample_next(&start, &phase, interpolation, decimation);
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_fir_resample_32fc_avx(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       const float* taps,
+                                                       unsigned int num_taps,
+                                                       unsigned int interpolation,
+                                                       unsigned int decimation,
+                                                       unsigned int offset,
+                                                       unsigned int num_points)
+{
+    const unsigned int vector_taps = num_taps & ~3u;
+    unsigned int start = offset / interpolation;
+    unsigned int phase = offset % interpolation;
+    unsigned int number, k, j;
+
+    for (number = 0; number + 4 <= num_points; number += 4) {
+        const lv_32fc_t* window[4];
+        const float* coeffs[4];
+        __m256 acc[4];
+        __m128 sum[4];
+        for (j = 0; j < 4; j++) {
+            window[j] = input + start;
+            coeffs[j] = taps + phase * num_taps;
+            acc[j] = _mm256_setzero_ps();
+            volk_fir_resample_next(&start, &phase, interpolation, decimation);
+        }
+        for (k = 0; k < vector_taps; k += 4) {
+            for (j = 0; j < 4; j++) {
+                // one tap per complex sample: t0 t0 t1 t1 t2 t2 t3 t3, with a
+                // single in-lane shuffle as each output has its own taps
+                const __m256 t = _mm256_insertf128_ps(
+                    _mm256_castps128_ps256(
+                        _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(coeffs[j] + k))),
+                    _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(coeffs[j] + k + 2)),
+                    1);
+                const __m256 tap = _mm256_permute_ps(t, 0x50);
+                const __m256 x = _mm256_loadu_ps((const float*)(window[j] + k));
+                acc[j] = _mm256_add_ps(acc[j], _mm256_mul_ps(x, tap));
+            }
+        }
+        // add the four complex sums in each accumulator
+        for (j = 0; j < 4; j++) {
+            sum[j] = _mm_add_ps(_mm256_castps256_ps128(acc[j]),
+                                _mm256_extractf128_ps(acc[j], 1));
+        }
+        _mm_storeu_ps((float*)(output + number),
+                      _mm_add_ps(_mm_movelh_ps(sum[0], sum[1]),
+                                 _mm_movehl_ps(sum[1], sum[0])));
+        _mm_storeu_ps((float*)(output + number + 2),
+                      _mm_add_ps(_mm_movelh_ps(sum[2], sum[3]),
+                                 _mm_movehl_ps(sum[3], sum[2])));
+
+        for (j = 0; j < 4; j++) {
+            for (k = vector_taps; k < num_taps; k++) {
+                output[number + j] += window[j][k] * coeffs[j][k];
+            }
+        }
+    }
+
+    for (; number < num_points; number++) {
+        const float* coeffs = taps + phase * num_taps;
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[start + k] * coeffs[k];
+        }
+        output[number] = sum;
+        volk_fir_resample_next(&start, &phase, interpolation, decimation);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_fir_resample_32fc_neon(lv_32fc_t* output,
+                                                        const lv_32fc_t* input,
+                                                        const float* taps,
+                                                        unsigned int num_taps,
+                                                        unsigned int interpolation,
+                                                        unsigned int decimation,
+                                                        unsigned int offset,
+                                                        unsigned int num_points)
+{
+    const unsigned int vector_taps = num_taps & ~3u;
+    unsigned int start = offset / interpolation;
+    unsigned int phase = offset % interpolation;
+    unsigned int number, k, j;
+
+    for (number = 0; number + 4 <= num_points; number += 4) {
+        const lv_32fc_t* window[4];
+        const float* coeffs[4];
+        float32x4_t acc_re[4], acc_im[4];
+        float32x2_t sum_re[4], sum_im[4];
+        float32x4x2_t result;
+        for (j = 0; j < 4; j++) {
+            window[j] = input + start;
+            coeffs[j] = taps + phase * num_taps;
+            acc_re[j] = vdupq_n_f32(0.f);
+            acc_im[j] = vdupq_n_f32(0.f);
+            volk_fir_resample_next(&start, &phase, interpolation, decimation);
+        }
+        for (k = 0; k < vector_taps; k += 4) {
+            for (j = 0; j < 4; j++) {
+                const float32x4_t tap = vld1q_f32(coeffs[j] + k);
+                const float32x4x2_t x = vld2q_f32((const float*)(window[j] + k));
+                acc_re[j] = vmlaq_f32(acc_re[j], x.val[0], tap);
+                acc_im[j] = vmlaq_f32(acc_im[j], x.val[1], tap);
+            }
+        }
+        // pairwise add the lanes of the four accumulators
+        for (j = 0; j < 4; j++) {
+            sum_re[j] = vpadd_f32(vget_low_f32(acc_re[j]), vget_high_f32(acc_re[j]));
+            sum_im[j] = vpadd_f32(vget_low_f32(acc_im[j]), vget_high_f32(acc_im[j]));
+        }
+        result = vzipq_f32(vcombine_f32(vpadd_f32(sum_re[0], sum_re[1]),
+                                        vpadd_f32(sum_re[2], sum_re[3])),
+                           vcombine_f32(vpadd_f32(sum_im[0], sum_im[1]),
+                                        vpadd_f32(sum_im[2], sum_im[3])));
+        vst1q_f32((float*)(output + number), result.val[0]);
+        vst1q_f32((float*)(output + number + 2), result.val[1]);
+
+        for (j = 0; j < 4; j++) {
+            for (k = vector_taps; k < num_taps; k++) {
+                output[number + j] += window[j][k] * coeffs[j][k];
+            }
+        }
+    }
+
+    for (; number < num_points; number++) {
+        const float* coeffs = taps + phase * num_taps;
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[start + k] * coeffs[k];
+        }
+        output[number] = sum;
+        volk_fir_resample_next(&start, &phase, interpolation, decimation);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_fir_resample_32fc_u_H */
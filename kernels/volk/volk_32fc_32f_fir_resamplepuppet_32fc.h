@@ -0,0 +1,84 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32FC_32F_FIR_RESAMPLEPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_32F_FIR_RESAMPLEPUPPET_32FC_H
+
+#include <string.h>
+#include <volk/volk_32fc_32f_fir_resample_32fc.h>
+
+/* Resamples by 3 / 5 with 7 taps per phase from the second phase, or filters
+ * with 1 tap for short vectors, reading the 21 taps from the start of the
+ * second buffer. The outputs past the last full window are copies of the
+ * input. */
+#define VOLK_FIR_RESAMPLEPUPPET(impl)                                                  \
+    const unsigned int interpolation = num_points < 21 ? 1 : 3;                        \
+    const unsigned int decimation = num_points < 21 ? 1 : 5;                           \
+    const unsigned int num_taps = num_points < 21 ? 1 : 7;                             \
+    const unsigned int offset = num_points < 21 ? 0 : 2;                               \
+    const unsigned int num_outputs =                                                   \
+        ((num_points - num_taps + 1) * interpolation - 1 - offset) / decimation + 1;   \
+    impl(output, input, taps, num_taps, interpolation, decimation, offset, num_outputs); \
+    memcpy(output + num_outputs, input + num_outputs,                                  \
+           (num_points - num_outputs) * sizeof(*output));
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_32f_fir_resamplepuppet_32fc_generic(lv_32fc_t* output,
+                                                                 const lv_32fc_t* input,
+                                                                 const float* taps,
+                                                                 unsigned int num_points)
+{
+    VOLK_FIR_RESAMPLEPUPPET(volk_32fc_32f_fir_resample_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+static inline void volk_32fc_32f_fir_resamplepuppet_32fc_sse(lv_32fc_t* output,
+                                                             const lv_32fc_t* input,
+                                                             const float* taps,
+                                                             unsigned int num_points)
+{
+    VOLK_FIR_RESAMPLEPUPPET(volk_32fc_32f_fir_resample_32fc_sse);
+}
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32fc_32f_fir_resamplepuppet_32fc_avx(lv_32fc_t* output,
+                                                             const lv_32fc_t* input,
+                                                             const float* taps,
+                                                             unsigned int num_points)
+{
+    VOLK_FIR_RESAMPLEPUPPET(volk_32fc_32f_fir_resample_32fc_avx);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32fc_32f_fir_resamplepuppet_32fc_neon(lv_32fc_t* output,
+                                                              const lv_32fc_t* input,
+                                                              const float* taps,
+                                                              unsigned int num_points)
+{
+    VOLK_FIR_RESAMPLEPUPPET(volk_32fc_32f_fir_resample_32fc_neon);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32FC_32F_FIR_RESAMPLEPUPPET_32FC_H */
@@ -0,0 +1,245 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32fc_32f_halfband_decimate2_32fc
+ *
+ * \b Overview
+ *
+ * Filters complex samples with a halfband filter and keeps every second
+ * output. A halfband filter of 4 * num_taps - 1 taps is symmetric and
+ * every second tap but the center one is zero, so it only takes the
+ * num_taps distinct outer taps and the center tap. The two inputs sharing
+ * an outer tap are added first, leaving num_taps + 1 multiplies per
+ * output instead of the 4 * num_taps - 1 of volk_32fc_32f_fir_decimate_32fc.
+ *
+ * Output i is computed from the 4 * num_taps - 1 inputs starting at 2 * i,
+ * so the input holds 2 * (num_points - 1) + 4 * num_taps - 1 samples. The
+ * filter being symmetric, the taps read the same in either time order.
+ *
+ * The SIMD implementations compute four or eight outputs at once, taking
+ * the even inputs of each window into one vector.
+ *
+ * For a cascade of halfband decimators running over a stream,
+ * volk_halfband_cascade_32fc_init() in volk_fir.h keeps the history of
+ * every stage and passes blocks through all of them while they are in
+ * cache.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_halfband_decimate2_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ * const float* taps, unsigned int num_taps, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: 2 * (num_points - 1) + 4 * num_taps - 1 samples, the oldest first.
+ * \li taps: The num_taps outer taps h[0], h[2], ..., h[2 * num_taps - 2] of
+ * the filter h, then its center tap h[2 * num_taps - 1].
+ * \li num_taps: The number of outer taps on one side, at least 1.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: output[i] = taps[num_taps] * input[2 * i + 2 * num_taps - 1] plus
+ * the sum of taps[k] * (input[2 * i + 2 * k] + input[2 * i + 4 * num_taps - 2 - 2 * k])
+ * over k < num_taps.
+ *
+ * \b Example
+ * Decimate by 2 with an 11 tap halfband filter, whose odd taps but the
+ * center one are zero.
+ * \code
+ *   unsigned int N = 256;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*(2 * (N - 1) + 11), alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float taps[4] = { 0.0118f, -0.0707f, 0.3089f, 0.5f };
+ *
+ *   volk_32fc_32f_halfband_decimate2_32fc(out, in, taps, 3, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_halfband_decimate2_32fc_u_H
+#define INCLUDED_volk_32fc_32f_halfband_decimate2_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_halfband_decimate2_32fc_generic(lv_32fc_t* output,
+                                                                 const lv_32fc_t* input,
+                                                                 const float* taps,
+                                                                 unsigned int num_taps,
+                                                                 unsigned int num_points)
+{
+    const unsigned int last = 4 * num_taps - 2;
+    unsigned int number, k;
+    for (number = 0; number < num_points; number++) {
+        const float* in = (const float*)(input + 2 * number);
+        float sum_re = taps[num_taps] * in[2 * (2 * num_taps - 1)];
+        float sum_im = taps[num_taps] * in[2 * (2 * num_taps - 1) + 1];
+        for (k = 0; k < num_taps; k++) {
+            sum_re += taps[k] * (in[4 * k] + in[2 * (last - 2 * k)]);
+            sum_im += taps[k] * (in[4 * k + 1] + in[2 * (last - 2 * k) + 1]);
+        }
+        output[number] = lv_cmake(sum_re, sum_im);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_halfband_decimate2_32fc_avx(lv_32fc_t* output,
+                                                             const lv_32fc_t* input,
+                                                             const float* taps,
+                                                             unsigned int num_taps,
+                                                             unsigned int num_points)
+{
+    const unsigned int last = 4 * num_taps - 2;
+    unsigned int number = 0, k;
+
+    for (; number + 4 <= num_points; number += 4) {
+        const float* in = (const float*)(input + 2 * number);
+        // the even inputs x0 x4 | x2 x6 of the window at in + 2 * j: the
+        // second load starts at x3 so the last window ends within the input
+        __m256 lo = _mm256_loadu_ps(in + 2 * (2 * num_taps - 1));
+        __m256 hi = _mm256_loadu_ps(in + 2 * (2 * num_taps + 2));
+        __m256 acc = _mm256_mul_ps(
+            _mm256_castpd_ps(_mm256_shuffle_pd(
+                _mm256_castps_pd(lo), _mm256_castps_pd(hi), 0xa)),
+            _mm256_set1_ps(taps[num_taps]));
+        __m128 acc_lo, acc_hi;
+        for (k = 0; k < num_taps; k++) {
+            const __m256 front_lo = _mm256_loadu_ps(in + 4 * k);
+            const __m256 front_hi = _mm256_loadu_ps(in + 4 * k + 6);
+            const __m256 back_lo = _mm256_loadu_ps(in + 2 * (last - 2 * k));
+            const __m256 back_hi = _mm256_loadu_ps(in + 2 * (last - 2 * k) + 6);
+            const __m256d front = _mm256_shuffle_pd(
+                _mm256_castps_pd(front_lo), _mm256_castps_pd(front_hi), 0xa);
+            const __m256d back = _mm256_shuffle_pd(
+                _mm256_castps_pd(back_lo), _mm256_castps_pd(back_hi), 0xa);
+            const __m256 pair =
+                _mm256_add_ps(_mm256_castpd_ps(front), _mm256_castpd_ps(back));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(pair, _mm256_set1_ps(taps[k])));
+        }
+        // the outputs are in the order 0 2 | 1 3
+        acc_lo = _mm256_castps256_ps128(acc);
+        acc_hi = _mm256_extractf128_ps(acc, 1);
+        _mm_storeu_ps((float*)(output + number), _mm_movelh_ps(acc_lo, acc_hi));
+        _mm_storeu_ps((float*)(output + number + 2), _mm_movehl_ps(acc_hi, acc_lo));
+    }
+
+    volk_32fc_32f_halfband_decimate2_32fc_generic(
+        output + number, input + 2 * number, taps, num_taps, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_halfband_decimate2_32fc_avx512f(lv_32fc_t* output,
+                                                                 const lv_32fc_t* input,
+                                                                 const float* taps,
+                                                                 unsigned int num_taps,
+                                                                 unsigned int num_points)
+{
+    const unsigned int last = 4 * num_taps - 2;
+    // the even inputs x0 x2 ... x14 of x0..x7 and x7..x14, the second load
+    // starting at x7 so the last window ends within the input
+    const __m512i even = _mm512_setr_epi64(0, 2, 4, 6, 9, 11, 13, 15);
+    unsigned int number = 0, k;
+
+    for (; number + 8 <= num_points; number += 8) {
+        const float* in = (const float*)(input + 2 * number);
+        const __m512d center_lo = _mm512_loadu_pd(in + 2 * (2 * num_taps - 1));
+        const __m512d center_hi = _mm512_loadu_pd(in + 2 * (2 * num_taps + 6));
+        __m512 acc = _mm512_mul_ps(
+            _mm512_castpd_ps(_mm512_permutex2var_pd(center_lo, even, center_hi)),
+            _mm512_set1_ps(taps[num_taps]));
+        for (k = 0; k < num_taps; k++) {
+            const __m512d front = _mm512_permutex2var_pd(
+                _mm512_loadu_pd(in + 4 * k), even, _mm512_loadu_pd(in + 4 * k + 14));
+            const __m512d back =
+                _mm512_permutex2var_pd(_mm512_loadu_pd(in + 2 * (last - 2 * k)),
+                                       even,
+                                       _mm512_loadu_pd(in + 2 * (last - 2 * k) + 14));
+            const __m512 pair =
+                _mm512_add_ps(_mm512_castpd_ps(front), _mm512_castpd_ps(back));
+            acc = _mm512_add_ps(acc, _mm512_mul_ps(pair, _mm512_set1_ps(taps[k])));
+        }
+        _mm512_storeu_ps((float*)(output + number), acc);
+    }
+
+    volk_32fc_32f_halfband_decimate2_32fc_generic(
+        output + number, input + 2 * number, taps, num_taps, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_halfband_decimate2_32fc_neon(lv_32fc_t* output,
+                                                              const lv_32fc_t* input,
+                                                              const float* taps,
+                                                              unsigned int num_taps,
+                                                              unsigned int num_points)
+{
+    const unsigned int last = 4 * num_taps - 2;
+    unsigned int number = 0, k;
+
+    // vld4q_f32 reads one input past the last window of a block of four,
+    // so the last output is left to the generic loop
+    for (; number + 4 < num_points; number += 4) {
+        const float* in = (const float*)(input + 2 * number);
+        // val[0] and val[1] are the real and imaginary parts of the even inputs
+        const float32x4x4_t center = vld4q_f32(in + 2 * (2 * num_taps - 1));
+        float32x4x2_t acc;
+        acc.val[0] = vmulq_n_f32(center.val[0], taps[num_taps]);
+        acc.val[1] = vmulq_n_f32(center.val[1], taps[num_taps]);
+        for (k = 0; k < num_taps; k++) {
+            const float32x4x4_t front = vld4q_f32(in + 4 * k);
+            const float32x4x4_t back = vld4q_f32(in + 2 * (last - 2 * k));
+            acc.val[0] = vmlaq_n_f32(
+                acc.val[0], vaddq_f32(front.val[0], back.val[0]), taps[k]);
+            acc.val[1] = vmlaq_n_f32(
+                acc.val[1], vaddq_f32(front.val[1], back.val[1]), taps[k]);
+        }
+        vst2q_f32((float*)(output + number), acc);
+    }
+
+    volk_32fc_32f_halfband_decimate2_32fc_generic(
+        output + number, input + 2 * number, taps, num_taps, num_points - number);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_halfband_decimate2_32fc_u_H */
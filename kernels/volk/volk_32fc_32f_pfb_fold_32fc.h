@@ -0,0 +1,239 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_32f_pfb_fold_32fc
+ *
+ * \b Overview
+ *
+ * The polyphase filter of an analysis filter bank for all its branches at
+ * once: multiplies a window of taps_per_branch * num_points samples by as
+ * many real taps and folds the products into num_points sums,
+ *
+ * output[q] = sum over j of input[j * num_points + q] * taps[j * num_points + q].
+ *
+ * With the prototype filter reversed as the taps, output[q] is branch
+ * num_points - 1 - q of the commutated polyphase FIR; a transform of the
+ * sums gives the channels, see volk_pfb_channelizer_create(). The SIMD
+ * versions keep the sums of consecutive branches in registers and run
+ * along the taps of each.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_pfb_fold_32fc(lv_32fc_t* outputVector, const lv_32fc_t*
+ * inputVector, const float* taps, unsigned int taps_per_branch, unsigned int
+ * num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The window, taps_per_branch * num_points samples.
+ * \li taps: The taps, taps_per_branch * num_points of them.
+ * \li taps_per_branch: The number of taps of each branch.
+ * \li num_points: The number of branches.
+ *
+ * \b Outputs
+ * \li outputVector: The num_points branch sums.
+ *
+ * \b Example
+ * The branches of a 1024 channel bank with 8 taps each, for the newest
+ * 8192 samples, with the prototype h reversed.
+ * \code
+ *   unsigned int M = 1024, P = 8;
+ *   for (n = 0; n < P * M; n++)
+ *       reversed[n] = h[P * M - 1 - n];
+ *   volk_32fc_32f_pfb_fold_32fc(sums, samples + t + 1 - P * M, reversed, P, M);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_pfb_fold_32fc_H
+#define INCLUDED_volk_32fc_32f_pfb_fold_32fc_H
+
+#include <volk/volk_complex.h>
+
+// the sum of one branch
+static inline lv_32fc_t volk_pfb_fold_branch(const lv_32fc_t* input,
+                                             const float* taps,
+                                             unsigned int taps_per_branch,
+                                             unsigned int num_points)
+{
+    float sum_re = 0.f, sum_im = 0.f;
+    unsigned int j;
+
+    for (j = 0; j < taps_per_branch; j++) {
+        sum_re += lv_creal(input[j * num_points]) * taps[j * num_points];
+        sum_im += lv_cimag(input[j * num_points]) * taps[j * num_points];
+    }
+    return lv_cmake(sum_re, sum_im);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_pfb_fold_32fc_generic(lv_32fc_t* outputVector,
+                                                       const lv_32fc_t* inputVector,
+                                                       const float* taps,
+                                                       unsigned int taps_per_branch,
+                                                       unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = volk_pfb_fold_branch(
+            inputVector + number, taps + number, taps_per_branch, num_points);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_pfb_fold_32fc_u_avx_fma(lv_32fc_t* outputVector,
+                                                         const lv_32fc_t* inputVector,
+                                                         const float* taps,
+                                                         unsigned int taps_per_branch,
+                                                         unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i permute_mask = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+    __m256 sum1, sum2, tapVal, tapVal1, tapVal2;
+    const float* inPtr;
+    const float* tapPtr;
+    unsigned int number, j;
+
+    for (number = 0; number < eighthPoints * 8; number += 8) {
+        sum1 = _mm256_setzero_ps();
+        sum2 = _mm256_setzero_ps();
+        inPtr = (const float*)(inputVector + number);
+        tapPtr = taps + number;
+        for (j = 0; j < taps_per_branch; j++) {
+            tapVal = _mm256_loadu_ps(tapPtr); // t0|t1|t2|t3|t4|t5|t6|t7
+            tapVal1 = _mm256_permutevar_ps(_mm256_permute2f128_ps(tapVal, tapVal, 0x00),
+                                           permute_mask); // t0|t0|t1|t1|t2|t2|t3|t3
+            tapVal2 = _mm256_permutevar_ps(_mm256_permute2f128_ps(tapVal, tapVal, 0x11),
+                                           permute_mask); // t4|t4|t5|t5|t6|t6|t7|t7
+            sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(inPtr), tapVal1, sum1);
+            sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(inPtr + 8), tapVal2, sum2);
+            inPtr += 2 * num_points;
+            tapPtr += num_points;
+        }
+        _mm256_storeu_ps((float*)(outputVector + number), sum1);
+        _mm256_storeu_ps((float*)(outputVector + number + 4), sum2);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_pfb_fold_branch(
+            inputVector + number, taps + number, taps_per_branch, num_points);
+    }
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_pfb_fold_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                         const lv_32fc_t* inputVector,
+                                                         const float* taps,
+                                                         unsigned int taps_per_branch,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i low_taps =
+        _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i high_taps =
+        _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+    __m512 sum1, sum2, tapVal;
+    const float* inPtr;
+    const float* tapPtr;
+    unsigned int number, j;
+
+    for (number = 0; number < sixteenthPoints * 16; number += 16) {
+        sum1 = _mm512_setzero_ps();
+        sum2 = _mm512_setzero_ps();
+        inPtr = (const float*)(inputVector + number);
+        tapPtr = taps + number;
+        for (j = 0; j < taps_per_branch; j++) {
+            tapVal = _mm512_loadu_ps(tapPtr);
+            sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(inPtr),
+                                   _mm512_permutexvar_ps(low_taps, tapVal),
+                                   sum1);
+            sum2 = _mm512_fmadd_ps(_mm512_loadu_ps(inPtr + 16),
+                                   _mm512_permutexvar_ps(high_taps, tapVal),
+                                   sum2);
+            inPtr += 2 * num_points;
+            tapPtr += num_points;
+        }
+        _mm512_storeu_ps((float*)(outputVector + number), sum1);
+        _mm512_storeu_ps((float*)(outputVector + number + 8), sum2);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_pfb_fold_branch(
+            inputVector + number, taps + number, taps_per_branch, num_points);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_pfb_fold_32fc_neon(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    const float* taps,
+                                                    unsigned int taps_per_branch,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    float32x4x2_t sum, inVal;
+    float32x4_t tapVal;
+    const float* inPtr;
+    const float* tapPtr;
+    unsigned int number, j;
+
+    for (number = 0; number < quarterPoints * 4; number += 4) {
+        sum.val[0] = vdupq_n_f32(0.f);
+        sum.val[1] = vdupq_n_f32(0.f);
+        inPtr = (const float*)(inputVector + number);
+        tapPtr = taps + number;
+        for (j = 0; j < taps_per_branch; j++) {
+            inVal = vld2q_f32(inPtr);
+            tapVal = vld1q_f32(tapPtr);
+            sum.val[0] = vmlaq_f32(sum.val[0], inVal.val[0], tapVal);
+            sum.val[1] = vmlaq_f32(sum.val[1], inVal.val[1], tapVal);
+            inPtr += 2 * num_points;
+            tapPtr += num_points;
+        }
+        vst2q_f32((float*)(outputVector + number), sum);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_pfb_fold_branch(
+            inputVector + number, taps + number, taps_per_branch, num_points);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_pfb_fold_32fc_H */
@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32FC_32F_PFB_FOLDPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_32F_PFB_FOLDPUPPET_32FC_H
+
+#include <string.h>
+#include <volk/volk_32fc_32f_pfb_fold_32fc.h>
+
+/* Folds the buffers into num_points / 4 branches of 4 taps each, reading the
+ * taps from the second buffer. The outputs past the branches are zero. */
+#define VOLK_PFB_FOLDPUPPET(impl)                                          \
+    const unsigned int num_branches = num_points / 4;                      \
+    impl(output, input, taps, 4, num_branches);                            \
+    memset(output + num_branches, 0, (num_points - num_branches) * sizeof(*output));
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_32f_pfb_foldpuppet_32fc_generic(lv_32fc_t* output,
+                                                             const lv_32fc_t* input,
+                                                             const float* taps,
+                                                             unsigned int num_points)
+{
+    VOLK_PFB_FOLDPUPPET(volk_32fc_32f_pfb_fold_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+static inline void volk_32fc_32f_pfb_foldpuppet_32fc_u_avx_fma(lv_32fc_t* output,
+                                                               const lv_32fc_t* input,
+                                                               const float* taps,
+                                                               unsigned int num_points)
+{
+    VOLK_PFB_FOLDPUPPET(volk_32fc_32f_pfb_fold_32fc_u_avx_fma);
+}
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32fc_32f_pfb_foldpuppet_32fc_u_avx512f(lv_32fc_t* output,
+                                                               const lv_32fc_t* input,
+                                                               const float* taps,
+                                                               unsigned int num_points)
+{
+    VOLK_PFB_FOLDPUPPET(volk_32fc_32f_pfb_fold_32fc_u_avx512f);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32fc_32f_pfb_foldpuppet_32fc_neon(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          const float* taps,
+                                                          unsigned int num_points)
+{
+    VOLK_PFB_FOLDPUPPET(volk_32fc_32f_pfb_fold_32fc_neon);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32FC_32F_PFB_FOLDPUPPET_32FC_H */
@@ -0,0 +1,95 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32FC_32F_S32FC_ROTATOR_FIR_DECIMATEPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_32F_S32FC_ROTATOR_FIR_DECIMATEPUPPET_32FC_H
+
+#include <string.h>
+#include <volk/volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc.h>
+
+/* Rotates from a fixed phase and decimates by 8 with 23 taps, or filters
+ * with 1 tap for short vectors, as the decimating filter puppet. */
+#define VOLK_ROTATOR_FIR_DECIMATEPUPPET(impl)                                  \
+    lv_32fc_t phase = lv_cmake(.3f, 0.95393f);                                 \
+    phase /= hypotf(lv_creal(phase), lv_cimag(phase));                         \
+    const lv_32fc_t phase_inc_n =                                              \
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));          \
+    const unsigned int num_taps = num_points < 23 ? 1 : 23;                    \
+    const unsigned int decimation = num_points < 23 ? 1 : 8;                   \
+    const unsigned int num_outputs = (num_points - num_taps) / decimation + 1; \
+    impl(output, input, taps, num_taps, decimation, phase_inc_n, &phase,        \
+         num_outputs);                                                         \
+    memcpy(output + num_outputs, input + num_outputs,                          \
+           (num_points - num_outputs) * sizeof(*output));
+
+#ifdef LV_HAVE_GENERIC
+static inline void
+volk_32fc_32f_s32fc_rotator_fir_decimatepuppet_32fc_generic(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            const float* taps,
+                                                            const lv_32fc_t phase_inc,
+                                                            unsigned int num_points)
+{
+    VOLK_ROTATOR_FIR_DECIMATEPUPPET(
+        volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE4_1
+static inline void
+volk_32fc_32f_s32fc_rotator_fir_decimatepuppet_32fc_sse4_1(lv_32fc_t* output,
+                                                           const lv_32fc_t* input,
+                                                           const float* taps,
+                                                           const lv_32fc_t phase_inc,
+                                                           unsigned int num_points)
+{
+    VOLK_ROTATOR_FIR_DECIMATEPUPPET(
+        volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_sse4_1);
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+#ifdef LV_HAVE_AVX
+static inline void
+volk_32fc_32f_s32fc_rotator_fir_decimatepuppet_32fc_avx(lv_32fc_t* output,
+                                                        const lv_32fc_t* input,
+                                                        const float* taps,
+                                                        const lv_32fc_t phase_inc,
+                                                        unsigned int num_points)
+{
+    VOLK_ROTATOR_FIR_DECIMATEPUPPET(volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_avx);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+static inline void
+volk_32fc_32f_s32fc_rotator_fir_decimatepuppet_32fc_neon(lv_32fc_t* output,
+                                                         const lv_32fc_t* input,
+                                                         const float* taps,
+                                                         const lv_32fc_t phase_inc,
+                                                         unsigned int num_points)
+{
+    VOLK_ROTATOR_FIR_DECIMATEPUPPET(
+        volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_neon);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32FC_32F_S32FC_ROTATOR_FIR_DECIMATEPUPPET_32FC_H */
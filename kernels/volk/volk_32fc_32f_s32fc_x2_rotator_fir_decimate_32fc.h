@@ -0,0 +1,350 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc
+ *
+ * \b Overview
+ *
+ * Shifts complex samples in frequency and filters them with a decimating
+ * FIR filter of real taps in one pass, as
+ * volk_32fc_s32fc_x2_rotator_32fc followed by
+ * volk_32fc_32f_fir_decimate_32fc without the rotated samples going
+ * through memory in between. The samples are rotated an L1 sized tile at
+ * a time into a buffer on the stack, which the filter reads straight away;
+ * the part of a tile which the next tile's windows still need is carried
+ * over instead of being rotated again.
+ *
+ * The phase behaves as for the rotator: *phase is the phase of input[0] on
+ * entry, and on return that of input[num_points * decimation], where the
+ * next block of a stream starts.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc(lv_32fc_t* output,
+ * const lv_32fc_t* input, const float* taps, unsigned int num_taps,
+ * unsigned int decimation, const lv_32fc_t phase_inc, lv_32fc_t* phase,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: (num_points - 1) * decimation + num_taps samples, the oldest first.
+ * \li taps: The filter taps, time reversed.
+ * \li num_taps: The number of taps, at least 1.
+ * \li decimation: The distance in inputs between two outputs, at least 1.
+ * \li phase_inc: The rotation per input sample.
+ * \li phase: The phase of the first input, advanced past the consumed inputs.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: output[i] = sum of input[i * decimation + k] * taps[k] over k <
+ * num_taps, after rotating input[n] by phase * phase_inc^n.
+ *
+ * \b Example
+ * Shift the channel at 0.1 cycles per sample to DC and decimate by 16.
+ * \code
+ *   unsigned int N = 256;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*((N - 1) * 16 + 128), alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* taps = (float*)volk_malloc(sizeof(float)*128, alignment);
+ *   lv_32fc_t phase_inc = lv_cmake(cosf(-0.2f * M_PI), sinf(-0.2f * M_PI));
+ *   lv_32fc_t phase = lv_cmake(1.f, 0.f);
+ *
+ *   volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc(
+ *       out, in, taps, 128, 16, phase_inc, &phase, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ *   volk_free(taps);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_u_H
+#define INCLUDED_volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_u_H
+
+#include <string.h>
+#include <volk/volk_32fc_32f_fir_decimate_32fc.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+// samples per rotated tile, 8 KiB which stays resident in L1
+#define VOLK_ROTATOR_FIR_TILE 1024
+
+typedef void (*volk_rotator_fir_rotate_t)(
+    lv_32fc_t*, const lv_32fc_t*, const lv_32fc_t, lv_32fc_t*, unsigned int);
+typedef void (*volk_rotator_fir_decimate_t)(
+    lv_32fc_t*, const lv_32fc_t*, const float*, unsigned int, unsigned int, unsigned int);
+
+/* Rotates the samples first to last of the input, starting at in, into
+ * out, noting the phase reached at sample mark when it lies in the range. */
+static inline void volk_rotator_fir_rotate(volk_rotator_fir_rotate_t rotate,
+                                           lv_32fc_t* out,
+                                           const lv_32fc_t* in,
+                                           unsigned int first,
+                                           unsigned int last,
+                                           unsigned int mark,
+                                           const lv_32fc_t phase_inc,
+                                           lv_32fc_t* phase,
+                                           lv_32fc_t* mark_phase)
+{
+    if (first <= mark && mark <= last) {
+        rotate(out, in, phase_inc, phase, mark - first);
+        *mark_phase = *phase;
+        rotate(out + (mark - first), in + (mark - first), phase_inc, phase, last - mark);
+    } else {
+        rotate(out, in, phase_inc, phase, last - first);
+    }
+}
+
+/* Advances the phase over the samples between two windows, which no output
+ * reads, by rotating the tile in place. */
+static inline void volk_rotator_fir_skip(volk_rotator_fir_rotate_t rotate,
+                                         lv_32fc_t* tile,
+                                         unsigned int first,
+                                         unsigned int last,
+                                         unsigned int mark,
+                                         const lv_32fc_t phase_inc,
+                                         lv_32fc_t* phase,
+                                         lv_32fc_t* mark_phase)
+{
+    unsigned int count;
+    for (; first < last; first += count) {
+        count = last - first;
+        if (count > VOLK_ROTATOR_FIR_TILE)
+            count = VOLK_ROTATOR_FIR_TILE;
+        volk_rotator_fir_rotate(rotate,
+                                tile,
+                                tile,
+                                first,
+                                first + count,
+                                mark,
+                                phase_inc,
+                                phase,
+                                mark_phase);
+    }
+}
+
+/* Runs the rotator and the decimating filter of one architecture over the
+ * tiles. While the windows of the outputs fit in half a tile, the overlap
+ * of the windows is carried from tile to tile. Longer windows are rotated
+ * piece by piece for each output, restarting at the phase saved at the
+ * start of the next window. */
+static inline void volk_rotator_fir_decimate(volk_rotator_fir_rotate_t rotate,
+                                             volk_rotator_fir_decimate_t decimate,
+                                             lv_32fc_t* output,
+                                             const lv_32fc_t* input,
+                                             const float* taps,
+                                             unsigned int num_taps,
+                                             unsigned int decimation,
+                                             const lv_32fc_t phase_inc,
+                                             lv_32fc_t* phase,
+                                             unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t tile[VOLK_ROTATOR_FIR_TILE];
+    const unsigned int end = num_points * decimation;
+    lv_32fc_t running = *phase;
+    lv_32fc_t end_phase = *phase;
+    unsigned int number, count, first, pos = 0, filled = 0;
+
+    // skipped samples are rotated in place, start from finite values
+    if (decimation > num_taps)
+        memset(tile, 0, sizeof(tile));
+
+    if (2 * num_taps <= VOLK_ROTATOR_FIR_TILE) {
+        // as many outputs as have their windows in one tile
+        const unsigned int per_tile = (VOLK_ROTATOR_FIR_TILE - num_taps) / decimation + 1;
+        for (number = 0; number < num_points; number += count) {
+            count = num_points - number < per_tile ? num_points - number : per_tile;
+            const unsigned int need = (count - 1) * decimation + num_taps;
+            const unsigned int step = count * decimation;
+            volk_rotator_fir_rotate(rotate,
+                                    tile + filled,
+                                    input + pos + filled,
+                                    pos + filled,
+                                    pos + need,
+                                    end,
+                                    phase_inc,
+                                    &running,
+                                    &end_phase);
+            decimate(output + number, tile, taps, num_taps, decimation, count);
+            if (step < need) {
+                filled = need - step;
+                memmove(tile, tile + step, filled * sizeof(lv_32fc_t));
+            } else {
+                filled = 0;
+                volk_rotator_fir_skip(rotate,
+                                      tile,
+                                      pos + need,
+                                      pos + step,
+                                      end,
+                                      phase_inc,
+                                      &running,
+                                      &end_phase);
+            }
+            pos += step;
+        }
+    } else {
+        for (number = 0; number < num_points; number++, pos += decimation) {
+            const unsigned int next = pos + decimation;
+            lv_32fc_t sum = lv_cmake(0.f, 0.f);
+            lv_32fc_t part;
+            running = end_phase;
+            for (first = 0; first < num_taps; first += count) {
+                count = num_taps - first;
+                if (count > VOLK_ROTATOR_FIR_TILE)
+                    count = VOLK_ROTATOR_FIR_TILE;
+                volk_rotator_fir_rotate(rotate,
+                                        tile,
+                                        input + pos + first,
+                                        pos + first,
+                                        pos + first + count,
+                                        next,
+                                        phase_inc,
+                                        &running,
+                                        &end_phase);
+                decimate(&part, tile, taps + first, count, 1, 1);
+                sum += part;
+            }
+            output[number] = sum;
+            volk_rotator_fir_skip(rotate,
+                                  tile,
+                                  pos + num_taps,
+                                  next,
+                                  next,
+                                  phase_inc,
+                                  &running,
+                                  &end_phase);
+        }
+    }
+    *phase = end_phase;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_generic(lv_32fc_t* output,
+                                                         const lv_32fc_t* input,
+                                                         const float* taps,
+                                                         unsigned int num_taps,
+                                                         unsigned int decimation,
+                                                         const lv_32fc_t phase_inc,
+                                                         lv_32fc_t* phase,
+                                                         unsigned int num_points)
+{
+    volk_rotator_fir_decimate(volk_32fc_s32fc_x2_rotator_32fc_generic,
+                              volk_32fc_32f_fir_decimate_32fc_generic,
+                              output,
+                              input,
+                              taps,
+                              num_taps,
+                              decimation,
+                              phase_inc,
+                              phase,
+                              num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+
+static inline void
+volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_sse4_1(lv_32fc_t* output,
+                                                        const lv_32fc_t* input,
+                                                        const float* taps,
+                                                        unsigned int num_taps,
+                                                        unsigned int decimation,
+                                                        const lv_32fc_t phase_inc,
+                                                        lv_32fc_t* phase,
+                                                        unsigned int num_points)
+{
+    volk_rotator_fir_decimate(volk_32fc_s32fc_x2_rotator_32fc_u_sse4_1,
+                              volk_32fc_32f_fir_decimate_32fc_sse,
+                              output,
+                              input,
+                              taps,
+                              num_taps,
+                              decimation,
+                              phase_inc,
+                              phase,
+                              num_points);
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void
+volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_avx(lv_32fc_t* output,
+                                                     const lv_32fc_t* input,
+                                                     const float* taps,
+                                                     unsigned int num_taps,
+                                                     unsigned int decimation,
+                                                     const lv_32fc_t phase_inc,
+                                                     lv_32fc_t* phase,
+                                                     unsigned int num_points)
+{
+    volk_rotator_fir_decimate(volk_32fc_s32fc_x2_rotator_32fc_u_avx,
+                              volk_32fc_32f_fir_decimate_32fc_avx,
+                              output,
+                              input,
+                              taps,
+                              num_taps,
+                              decimation,
+                              phase_inc,
+                              phase,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_neon(lv_32fc_t* output,
+                                                      const lv_32fc_t* input,
+                                                      const float* taps,
+                                                      unsigned int num_taps,
+                                                      unsigned int decimation,
+                                                      const lv_32fc_t phase_inc,
+                                                      lv_32fc_t* phase,
+                                                      unsigned int num_points)
+{
+    volk_rotator_fir_decimate(volk_32fc_s32fc_x2_rotator_32fc_neon,
+                              volk_32fc_32f_fir_decimate_32fc_neon,
+                              output,
+                              input,
+                              taps,
+                              num_taps,
+                              decimation,
+                              phase_inc,
+                              phase,
+                              num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc_u_H */
@@ -0,0 +1,133 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_32f_x2_strobe_gardner_32fc_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_strobe_gardnerpuppet_32fc_32f_H
+#define INCLUDED_volk_32fc_32f_strobe_gardnerpuppet_32fc_32f_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <volk/volk_32fc_32f_x2_strobe_gardner_32fc_32f.h>
+
+/* Recovers symbols with 8 phases of 8 taps, or 1 tap for short vectors, read
+ * from the start of the second buffer, from strobes drifting by half a percent
+ * from 0.3 on, as far as the input goes. The symbols past them are copies of
+ * the input, their errors 0. */
+static inline void volk_strobe_gardner_puppet(void (*kernel)(lv_32fc_t*,
+                                                             float*,
+                                                             const lv_32fc_t*,
+                                                             const float*,
+                                                             const float*,
+                                                             unsigned int,
+                                                             unsigned int,
+                                                             unsigned int),
+                                              lv_32fc_t* symbols,
+                                              float* errors,
+                                              const lv_32fc_t* input,
+                                              const float* taps,
+                                              unsigned int num_points)
+{
+    const unsigned int num_taps = num_points < 64 ? 1 : 8;
+    const unsigned int num_phases = num_points < 64 ? 1 : 8;
+    const unsigned int num_symbols =
+        num_points < num_taps + 1 ? 0 : (num_points - num_taps - 1) / 2;
+    float* positions = (float*)malloc((2 * num_symbols + 1) * sizeof(float));
+    unsigned int j;
+
+    if (!positions) {
+        return;
+    }
+    for (j = 0; j <= 2 * num_symbols; j++) {
+        positions[j] = 0.3f + 0.995f * j;
+    }
+    kernel(symbols, errors, input, taps, positions, num_taps, num_phases, num_symbols);
+    memcpy(symbols + num_symbols,
+           input + num_symbols,
+           (num_points - num_symbols) * sizeof(lv_32fc_t));
+    memset(errors + num_symbols, 0, (num_points - num_symbols) * sizeof(float));
+    free(positions);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_32f_strobe_gardnerpuppet_32fc_32f_generic(lv_32fc_t* symbols,
+                                                    float* errors,
+                                                    const lv_32fc_t* input,
+                                                    const float* taps,
+                                                    unsigned int num_points)
+{
+    volk_strobe_gardner_puppet(volk_32fc_32f_x2_strobe_gardner_32fc_32f_generic,
+                               symbols,
+                               errors,
+                               input,
+                               taps,
+                               num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+
+static inline void
+volk_32fc_32f_strobe_gardnerpuppet_32fc_32f_u_avx_fma(lv_32fc_t* symbols,
+                                                      float* errors,
+                                                      const lv_32fc_t* input,
+                                                      const float* taps,
+                                                      unsigned int num_points)
+{
+    volk_strobe_gardner_puppet(volk_32fc_32f_x2_strobe_gardner_32fc_32f_u_avx_fma,
+                               symbols,
+                               errors,
+                               input,
+                               taps,
+                               num_points);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_32f_strobe_gardnerpuppet_32fc_32f_neon(lv_32fc_t* symbols,
+                                                 float* errors,
+                                                 const lv_32fc_t* input,
+                                                 const float* taps,
+                                                 unsigned int num_points)
+{
+    volk_strobe_gardner_puppet(volk_32fc_32f_x2_strobe_gardner_32fc_32f_neon,
+                               symbols,
+                               errors,
+                               input,
+                               taps,
+                               num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_strobe_gardnerpuppet_32fc_32f_H */
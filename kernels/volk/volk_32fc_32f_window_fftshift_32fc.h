@@ -0,0 +1,249 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_32f_window_fftshift_32fc
+ *
+ * \b Overview
+ *
+ * Prepares a block for a centred spectrum in one pass: multiplies the
+ * complex input by a real window and by (-1)^n,
+ * output[n] = (-1)^n * window[n] * input[n].
+ *
+ * Negating every other point moves the spectrum by half the sample rate,
+ * so the transform of the output, see volk_32fc_fft_32fc, comes out with
+ * DC in bin num_points / 2, the fftshift of the transform of the windowed
+ * input. For an even num_points this is exactly the fftshift; for an odd
+ * one the shift falls half a bin short of it. The sign is counted from
+ * the start of the vector, so a block must not be split across calls at
+ * an odd point.
+ *
+ * Every implementation loads a block before it stores it, output may be
+ * the same buffer as input. The FFT is out of place, so a caller that
+ * keeps one work buffer runs this in place on it before the transform.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_window_fftshift_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ *                                         const float* window, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The complex vector, may be the same buffer as output.
+ * \li window: The real window, one tap per point.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li output: The windowed vector with every odd point negated.
+ *
+ * \b Example
+ * A Hann windowed spectrum with DC in the middle bin.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* buf = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* spectrum = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* window = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       window[ii] = 0.5f - 0.5f * cosf(2.f * M_PI * ii / N);
+ *       buf[ii] = lv_cmake(1.f, 0.f);
+ *   }
+ *
+ *   volk_32fc_32f_window_fftshift_32fc(buf, buf, window, N);
+ *   volk_32fc_fft_32fc(spectrum, buf, N);
+ *   printf("DC: %f\n", lv_creal(spectrum[N / 2])); // N / 2
+ *
+ *   volk_free(buf);
+ *   volk_free(spectrum);
+ *   volk_free(window);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_window_fftshift_32fc_H
+#define INCLUDED_volk_32fc_32f_window_fftshift_32fc_H
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_window_fftshift_32fc_generic(lv_32fc_t* output,
+                                                              const lv_32fc_t* input,
+                                                              const float* window,
+                                                              unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        const float tap = (number & 1) ? -window[number] : window[number];
+        output[number] = lv_cmake(lv_creal(input[number]) * tap,
+                                  lv_cimag(input[number]) * tap);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_32f_window_fftshift_32fc_u_sse(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            const float* window,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    // flips the sign of the odd taps
+    const __m128 odd = _mm_setr_ps(0.f, -0.f, 0.f, -0.f);
+    const float* in = (const float*)input;
+    float* out = (float*)output;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const __m128 taps = _mm_xor_ps(_mm_loadu_ps(window), odd);
+        const __m128 taps0 = _mm_shuffle_ps(taps, taps, _MM_SHUFFLE(1, 1, 0, 0));
+        const __m128 taps1 = _mm_shuffle_ps(taps, taps, _MM_SHUFFLE(3, 3, 2, 2));
+        const __m128 in0 = _mm_loadu_ps(in);
+        const __m128 in1 = _mm_loadu_ps(in + 4);
+        _mm_storeu_ps(out, _mm_mul_ps(in0, taps0));
+        _mm_storeu_ps(out + 4, _mm_mul_ps(in1, taps1));
+        window += 4;
+        in += 8;
+        out += 8;
+    }
+
+    // the tail starts on an even point, so the signs stay in step
+    volk_32fc_32f_window_fftshift_32fc_generic(
+        (lv_32fc_t*)out, (const lv_32fc_t*)in, window, num_points & 3);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_window_fftshift_32fc_u_avx(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            const float* window,
+                                                            unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 odd = _mm256_setr_ps(0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f);
+    const __m256i duplicate = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const float* in = (const float*)input;
+    float* out = (float*)output;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        const __m256 taps = _mm256_xor_ps(_mm256_loadu_ps(window), odd);
+        // t0 t0 t1 t1 t2 t2 t3 t3 and t4 t4 t5 t5 t6 t6 t7 t7
+        const __m256 taps0 = _mm256_permutevar_ps(
+            _mm256_permute2f128_ps(taps, taps, 0x00), duplicate);
+        const __m256 taps1 = _mm256_permutevar_ps(
+            _mm256_permute2f128_ps(taps, taps, 0x11), duplicate);
+        const __m256 in0 = _mm256_loadu_ps(in);
+        const __m256 in1 = _mm256_loadu_ps(in + 8);
+        _mm256_storeu_ps(out, _mm256_mul_ps(in0, taps0));
+        _mm256_storeu_ps(out + 8, _mm256_mul_ps(in1, taps1));
+        window += 8;
+        in += 16;
+        out += 16;
+    }
+
+    volk_32fc_32f_window_fftshift_32fc_generic(
+        (lv_32fc_t*)out, (const lv_32fc_t*)in, window, num_points & 7);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_window_fftshift_32fc_u_avx512f(lv_32fc_t* output,
+                                                                const lv_32fc_t* input,
+                                                                const float* window,
+                                                                unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i odd = _mm512_set4_epi32((int)0x80000000, 0, (int)0x80000000, 0);
+    const __m512i duplicate0 =
+        _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i duplicate1 =
+        _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+    const float* in = (const float*)input;
+    float* out = (float*)output;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // the float xor needs AVX512DQ, flip the sign bits as integers
+        const __m512 taps = _mm512_castsi512_ps(
+            _mm512_xor_si512(_mm512_castps_si512(_mm512_loadu_ps(window)), odd));
+        const __m512 in0 = _mm512_loadu_ps(in);
+        const __m512 in1 = _mm512_loadu_ps(in + 16);
+        _mm512_storeu_ps(out,
+                         _mm512_mul_ps(in0, _mm512_permutexvar_ps(duplicate0, taps)));
+        _mm512_storeu_ps(out + 16,
+                         _mm512_mul_ps(in1, _mm512_permutexvar_ps(duplicate1, taps)));
+        window += 16;
+        in += 32;
+        out += 32;
+    }
+
+    volk_32fc_32f_window_fftshift_32fc_generic(
+        (lv_32fc_t*)out, (const lv_32fc_t*)in, window, num_points & 15);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_window_fftshift_32fc_neon(lv_32fc_t* output,
+                                                           const lv_32fc_t* input,
+                                                           const float* window,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float sign[4] = { 1.f, -1.f, 1.f, -1.f };
+    const float32x4_t odd = vld1q_f32(sign);
+    const float* in = (const float*)input;
+    float* out = (float*)output;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const float32x4_t taps = vmulq_f32(vld1q_f32(window), odd);
+        float32x4x2_t value = vld2q_f32(in); // real parts, imaginary parts
+        value.val[0] = vmulq_f32(value.val[0], taps);
+        value.val[1] = vmulq_f32(value.val[1], taps);
+        vst2q_f32(out, value);
+        window += 4;
+        in += 8;
+        out += 8;
+    }
+
+    volk_32fc_32f_window_fftshift_32fc_generic(
+        (lv_32fc_t*)out, (const lv_32fc_t*)in, window, num_points & 3);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_window_fftshift_32fc_H */
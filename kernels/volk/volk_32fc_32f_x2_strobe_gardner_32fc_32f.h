@@ -0,0 +1,313 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_32f_x2_strobe_gardner_32fc_32f
+ *
+ * \b Overview
+ *
+ * The block stage of a Gardner symbol timing recovery at two samples per
+ * symbol: evaluates a polyphase matched filter at a vector of fractional
+ * strobe positions and computes the timing error of each symbol, so that
+ * the control loop is left with its loop filter and the positions of the
+ * next block.
+ *
+ * Strobe j is the filter output at positions[j], in input samples. As for
+ * volk_32fc_32f_fir_resample_32fc, its window starts at the input of that
+ * position and it is filtered by the phase of the remainder, the position
+ * rounded to the nearest 1 / num_phases of a sample. The strobes alternate
+ * between symbols and the midpoints between them, from the last symbol of
+ * the previous block: positions holds 2 * num_points + 1 of them, symbol k
+ * is strobe 2 * k + 2 and its error
+ *
+ *   errors[k] = Re((strobe[2k + 2] - strobe[2k]) * conj(strobe[2k + 1]))
+ *
+ * The SIMD implementations compute four strobes at once, each gathered
+ * from its own window with its own phase, and vectorise each of them over
+ * the taps.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_x2_strobe_gardner_32fc_32f(lv_32fc_t* symbols, float* errors,
+ * const lv_32fc_t* input, const float* taps, const float* positions,
+ * unsigned int num_taps, unsigned int num_phases, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The samples, the oldest first, up to the last window: at least
+ * positions[2 * num_points] + 1 + num_taps of them.
+ * \li taps: num_phases phases of num_taps taps each, every phase time
+ * reversed, as for volk_32fc_32f_fir_resample_32fc.
+ * \li positions: 2 * num_points + 1 strobe positions, not negative.
+ * \li num_taps: The number of taps per phase, at least 1.
+ * \li num_phases: The number of phases, at least 1.
+ * \li num_points: The number of symbols.
+ *
+ * \b Outputs
+ * \li symbols: The num_points symbol strobes.
+ * \li errors: The Gardner timing error of each symbol.
+ *
+ * \b Example
+ * Recover the timing of a block of N symbols at two samples per symbol
+ * with a 32 phase root raised cosine bank of 12 taps per phase. The strobes
+ * run from tau, the position of the last symbol, at the symbol period the
+ * loop filter tracks.
+ * \code
+ *   for (j = 0; j <= 2 * N; j++) {
+ *       positions[j] = tau + 0.5f * j * period;
+ *   }
+ *   volk_32fc_32f_x2_strobe_gardner_32fc_32f(
+ *       symbols, errors, in, rrc_bank, positions, 12, 32, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_x2_strobe_gardner_32fc_32f_H
+#define INCLUDED_volk_32fc_32f_x2_strobe_gardner_32fc_32f_H
+
+#include <volk/volk_complex.h>
+
+/* The window start and the phase of the strobe at position */
+static inline unsigned int volk_strobe_window(float position,
+                                              unsigned int num_phases,
+                                              unsigned int* phase)
+{
+    const unsigned int steps = (unsigned int)(position * num_phases + 0.5f);
+    *phase = steps % num_phases;
+    return steps / num_phases;
+}
+
+static inline lv_32fc_t volk_strobe_filter(const lv_32fc_t* input,
+                                           const float* taps,
+                                           unsigned int num_taps,
+                                           unsigned int num_phases,
+                                           float position)
+{
+    unsigned int phase, k;
+    const float* in =
+        (const float*)(input + volk_strobe_window(position, num_phases, &phase));
+    const float* coeffs = taps + phase * num_taps;
+    float sum_re = 0.f;
+    float sum_im = 0.f;
+    for (k = 0; k < num_taps; k++) {
+        sum_re += in[2 * k] * coeffs[k];
+        sum_im += in[2 * k + 1] * coeffs[k];
+    }
+    return lv_cmake(sum_re, sum_im);
+}
+
+/* Re((symbol - previous) * conj(middle)) */
+static inline float
+volk_gardner_error(lv_32fc_t previous, lv_32fc_t middle, lv_32fc_t symbol)
+{
+    return (lv_creal(symbol) - lv_creal(previous)) * lv_creal(middle) +
+           (lv_cimag(symbol) - lv_cimag(previous)) * lv_cimag(middle);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_32f_x2_strobe_gardner_32fc_32f_generic(lv_32fc_t* symbols,
+                                                 float* errors,
+                                                 const lv_32fc_t* input,
+                                                 const float* taps,
+                                                 const float* positions,
+                                                 unsigned int num_taps,
+                                                 unsigned int num_phases,
+                                                 unsigned int num_points)
+{
+    lv_32fc_t previous =
+        volk_strobe_filter(input, taps, num_taps, num_phases, positions[0]);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        const lv_32fc_t middle = volk_strobe_filter(
+            input, taps, num_taps, num_phases, positions[2 * number + 1]);
+        const lv_32fc_t symbol = volk_strobe_filter(
+            input, taps, num_taps, num_phases, positions[2 * number + 2]);
+        symbols[number] = symbol;
+        errors[number] = volk_gardner_error(previous, middle, symbol);
+        previous = symbol;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32fc_32f_x2_strobe_gardner_32fc_32f_u_avx_fma(lv_32fc_t* symbols,
+                                                   float* errors,
+                                                   const lv_32fc_t* input,
+                                                   const float* taps,
+                                                   const float* positions,
+                                                   unsigned int num_taps,
+                                                   unsigned int num_phases,
+                                                   unsigned int num_points)
+{
+    const unsigned int vector_taps = num_taps & ~3u;
+    lv_32fc_t previous =
+        volk_strobe_filter(input, taps, num_taps, num_phases, positions[0]);
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t strobe[4];
+    unsigned int number, phase, k, j;
+
+    // two symbols and their midpoints per pass
+    for (number = 0; number + 2 <= num_points; number += 2) {
+        const lv_32fc_t* window[4];
+        const float* coeffs[4];
+        __m256 acc[4];
+        __m128 sum[4];
+        for (j = 0; j < 4; j++) {
+            window[j] = input + volk_strobe_window(
+                                    positions[2 * number + 1 + j], num_phases, &phase);
+            coeffs[j] = taps + phase * num_taps;
+            acc[j] = _mm256_setzero_ps();
+        }
+        for (k = 0; k < vector_taps; k += 4) {
+            for (j = 0; j < 4; j++) {
+                // one tap per complex sample: t0 t0 t1 t1 t2 t2 t3 t3
+                const __m256 t = _mm256_insertf128_ps(
+                    _mm256_castps128_ps256(
+                        _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(coeffs[j] + k))),
+                    _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(coeffs[j] + k + 2)),
+                    1);
+                const __m256 x = _mm256_loadu_ps((const float*)(window[j] + k));
+                acc[j] = _mm256_fmadd_ps(x, _mm256_permute_ps(t, 0x50), acc[j]);
+            }
+        }
+        // add the four complex sums in each accumulator
+        for (j = 0; j < 4; j++) {
+            sum[j] = _mm_add_ps(_mm256_castps256_ps128(acc[j]),
+                                _mm256_extractf128_ps(acc[j], 1));
+        }
+        _mm_store_ps((float*)strobe,
+                     _mm_add_ps(_mm_movelh_ps(sum[0], sum[1]),
+                                _mm_movehl_ps(sum[1], sum[0])));
+        _mm_store_ps((float*)(strobe + 2),
+                     _mm_add_ps(_mm_movelh_ps(sum[2], sum[3]),
+                                _mm_movehl_ps(sum[3], sum[2])));
+
+        for (j = 0; j < 4; j++) {
+            for (k = vector_taps; k < num_taps; k++) {
+                strobe[j] += window[j][k] * coeffs[j][k];
+            }
+        }
+        symbols[number] = strobe[1];
+        symbols[number + 1] = strobe[3];
+        errors[number] = volk_gardner_error(previous, strobe[0], strobe[1]);
+        errors[number + 1] = volk_gardner_error(strobe[1], strobe[2], strobe[3]);
+        previous = strobe[3];
+    }
+
+    for (; number < num_points; number++) {
+        const lv_32fc_t middle = volk_strobe_filter(
+            input, taps, num_taps, num_phases, positions[2 * number + 1]);
+        const lv_32fc_t symbol = volk_strobe_filter(
+            input, taps, num_taps, num_phases, positions[2 * number + 2]);
+        symbols[number] = symbol;
+        errors[number] = volk_gardner_error(previous, middle, symbol);
+        previous = symbol;
+    }
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_32f_x2_strobe_gardner_32fc_32f_neon(lv_32fc_t* symbols,
+                                              float* errors,
+                                              const lv_32fc_t* input,
+                                              const float* taps,
+                                              const float* positions,
+                                              unsigned int num_taps,
+                                              unsigned int num_phases,
+                                              unsigned int num_points)
+{
+    const unsigned int vector_taps = num_taps & ~3u;
+    lv_32fc_t previous =
+        volk_strobe_filter(input, taps, num_taps, num_phases, positions[0]);
+    lv_32fc_t strobe[4];
+    unsigned int number, phase, k, j;
+
+    // two symbols and their midpoints per pass
+    for (number = 0; number + 2 <= num_points; number += 2) {
+        const lv_32fc_t* window[4];
+        const float* coeffs[4];
+        float32x4_t acc_re[4], acc_im[4];
+        float32x2_t sum_re[4], sum_im[4];
+        float32x4x2_t result;
+        for (j = 0; j < 4; j++) {
+            window[j] = input + volk_strobe_window(
+                                    positions[2 * number + 1 + j], num_phases, &phase);
+            coeffs[j] = taps + phase * num_taps;
+            acc_re[j] = vdupq_n_f32(0.f);
+            acc_im[j] = vdupq_n_f32(0.f);
+        }
+        for (k = 0; k < vector_taps; k += 4) {
+            for (j = 0; j < 4; j++) {
+                const float32x4_t tap = vld1q_f32(coeffs[j] + k);
+                const float32x4x2_t x = vld2q_f32((const float*)(window[j] + k));
+                acc_re[j] = vmlaq_f32(acc_re[j], x.val[0], tap);
+                acc_im[j] = vmlaq_f32(acc_im[j], x.val[1], tap);
+            }
+        }
+        // pairwise add the lanes of the four accumulators
+        for (j = 0; j < 4; j++) {
+            sum_re[j] = vpadd_f32(vget_low_f32(acc_re[j]), vget_high_f32(acc_re[j]));
+            sum_im[j] = vpadd_f32(vget_low_f32(acc_im[j]), vget_high_f32(acc_im[j]));
+        }
+        result = vzipq_f32(vcombine_f32(vpadd_f32(sum_re[0], sum_re[1]),
+                                        vpadd_f32(sum_re[2], sum_re[3])),
+                           vcombine_f32(vpadd_f32(sum_im[0], sum_im[1]),
+                                        vpadd_f32(sum_im[2], sum_im[3])));
+        vst1q_f32((float*)strobe, result.val[0]);
+        vst1q_f32((float*)(strobe + 2), result.val[1]);
+
+        for (j = 0; j < 4; j++) {
+            for (k = vector_taps; k < num_taps; k++) {
+                strobe[j] += window[j][k] * coeffs[j][k];
+            }
+        }
+        symbols[number] = strobe[1];
+        symbols[number + 1] = strobe[3];
+        errors[number] = volk_gardner_error(previous, strobe[0], strobe[1]);
+        errors[number + 1] = volk_gardner_error(strobe[1], strobe[2], strobe[3]);
+        previous = strobe[3];
+    }
+
+    for (; number < num_points; number++) {
+        const lv_32fc_t middle = volk_strobe_filter(
+            input, taps, num_taps, num_phases, positions[2 * number + 1]);
+        const lv_32fc_t symbol = volk_strobe_filter(
+            input, taps, num_taps, num_phases, positions[2 * number + 2]);
+        symbols[number] = symbol;
+        errors[number] = volk_gardner_error(previous, middle, symbol);
+        previous = symbol;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_x2_strobe_gardner_32fc_32f_H */
@@ -0,0 +1,170 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32fc_32u_gather_32fc
+ *
+ * \b Overview
+ *
+ * Copies the points of the input at the given indices to the output, e.g.
+ * to extract the data or pilot subcarriers of an OFDM symbol after the FFT:
+ *
+ * outputVector[n] = inputVector[indices[n]]
+ *
+ * The SIMD versions load runs of four or eight consecutive indices directly,
+ * as the subcarriers of a resource block usually are, and gather the others.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32u_gather_32fc(lv_32fc_t* outputVector, const lv_32fc_t*
+ * inputVector, const uint32_t* indices, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The points to gather from.
+ * \li indices: The index of the input point of each output, below 2^31.
+ * \li num_points: The number of indices and outputs.
+ *
+ * \b Outputs
+ * \li outputVector: The gathered points.
+ *
+ * \b Example
+ * Extract the subcarriers of a 64 point symbol that are neither pilots nor
+ * guards.
+ * \code
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* symbol = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*64, alignment);
+ *   lv_32fc_t* data = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*48, alignment);
+ *   uint32_t indices[48];
+ *   unsigned int n = 0;
+ *
+ *   for(unsigned int ii = 0; ii < 64; ++ii){
+ *       symbol[ii] = lv_cmake((float)ii, 0.f);
+ *       if(ii >= 6 && ii < 59 && ii != 32 && ii % 14 != 11){
+ *           indices[n++] = ii;
+ *       }
+ *   }
+ *
+ *   volk_32fc_32u_gather_32fc(data, symbol, indices, n);
+ *
+ *   volk_free(symbol);
+ *   volk_free(data);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32u_gather_32fc_H
+#define INCLUDED_volk_32fc_32u_gather_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32u_gather_32fc_generic(lv_32fc_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     const uint32_t* indices,
+                                                     unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = inputVector[indices[number]];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_32u_gather_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    const uint32_t* indices,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128i ramp = _mm_set_epi32(3, 2, 1, 0);
+    // a complex point moves as a double
+    const double* in = (const double*)inputVector;
+    unsigned int number;
+    __m128i index, run;
+    __m256d points;
+
+    for (number = 0; number < quarterPoints; number++) {
+        index = _mm_loadu_si128((const __m128i*)indices);
+        run = _mm_add_epi32(_mm_set1_epi32((int)indices[0]), ramp);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(index, run)) == 0xffff) {
+            points = _mm256_loadu_pd(in + indices[0]);
+        } else {
+            points = _mm256_i32gather_pd(in, index, 8);
+        }
+        _mm256_storeu_pd((double*)outputVector, points);
+        indices += 4;
+        outputVector += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *outputVector++ = inputVector[*indices++];
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_32u_gather_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                       const lv_32fc_t* inputVector,
+                                                       const uint32_t* indices,
+                                                       unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i ramp = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    // a complex point moves as a double
+    const double* in = (const double*)inputVector;
+    unsigned int number;
+    __m256i index, run;
+    __m512d points;
+
+    for (number = 0; number < eighthPoints; number++) {
+        index = _mm256_loadu_si256((const __m256i*)indices);
+        run = _mm256_add_epi32(_mm256_set1_epi32((int)indices[0]), ramp);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(index, run)) == -1) {
+            points = _mm512_loadu_pd(in + indices[0]);
+        } else {
+            points = _mm512_i32gather_pd(index, in, 8);
+        }
+        _mm512_storeu_pd((double*)outputVector, points);
+        indices += 8;
+        outputVector += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputVector++ = inputVector[*indices++];
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_32u_gather_32fc_H */
@@ -0,0 +1,125 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_s32f_x3_agc_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_agcpuppet_32fc_H
+#define INCLUDED_volk_32fc_agcpuppet_32fc_H
+
+#include <volk/volk_32fc_s32f_x3_agc_32fc.h>
+
+/*
+ * Levels the samples in two calls which carry the gain over, the first from
+ * a gain above its limit and the second with no limit.
+ */
+static inline void volk_agc_puppet(void (*kernel)(lv_32fc_t*,
+                                                  const lv_32fc_t*,
+                                                  const float,
+                                                  const float,
+                                                  const float,
+                                                  float*,
+                                                  unsigned int),
+                                   lv_32fc_t* outputVector,
+                                   const lv_32fc_t* inputVector,
+                                   unsigned int num_points)
+{
+    float gain = 2.5f;
+
+    kernel(outputVector, inputVector, 0.01f, 1.f, 1.3f, &gain, num_points / 2);
+    kernel(outputVector + num_points / 2,
+           inputVector + num_points / 2,
+           0.01f,
+           1.f,
+           0.f,
+           &gain,
+           num_points - num_points / 2);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_agcpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_agc_puppet(
+        volk_32fc_s32f_x3_agc_32fc_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32fc_agcpuppet_32fc_u_sse(lv_32fc_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_agc_puppet(
+        volk_32fc_s32f_x3_agc_32fc_u_sse, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_agcpuppet_32fc_u_avx(lv_32fc_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_agc_puppet(
+        volk_32fc_s32f_x3_agc_32fc_u_avx, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_agcpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                      const lv_32fc_t* inputVector,
+                                                      unsigned int num_points)
+{
+    volk_agc_puppet(
+        volk_32fc_s32f_x3_agc_32fc_u_avx512f, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_agcpuppet_32fc_neonv8(lv_32fc_t* outputVector,
+                                                   const lv_32fc_t* inputVector,
+                                                   unsigned int num_points)
+{
+    volk_agc_puppet(
+        volk_32fc_s32f_x3_agc_32fc_neonv8, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_agcpuppet_32fc_H */
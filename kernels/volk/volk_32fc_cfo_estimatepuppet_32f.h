@@ -0,0 +1,80 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_s32u_x2_cfo_estimate_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_cfo_estimatepuppet_32f_H
+#define INCLUDED_volk_32fc_cfo_estimatepuppet_32f_H
+
+#include <string.h>
+#include <volk/volk_32fc_s32u_x2_cfo_estimate_32f.h>
+
+/* Estimates over a delay of 16 points, in segments of 100 products as far as
+ * the input goes. The outputs past the estimates are 0. */
+#define VOLK_CFO_ESTIMATEPUPPET(impl)                                                  \
+    const unsigned int num_products = num_points > 16 ? num_points - 16 : 0;           \
+    const unsigned int num_estimates = (num_products + 99) / 100;                      \
+    impl(estimates, inputVector, 16, 100, num_products);                               \
+    memset(estimates + num_estimates, 0, (num_points - num_estimates) * sizeof(float));
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_cfo_estimatepuppet_32f_generic(float* estimates,
+                                                            const lv_32fc_t* inputVector,
+                                                            unsigned int num_points)
+{
+    VOLK_CFO_ESTIMATEPUPPET(volk_32fc_s32u_x2_cfo_estimate_32f_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void
+volk_32fc_cfo_estimatepuppet_32f_u_avx2_fma(float* estimates,
+                                            const lv_32fc_t* inputVector,
+                                            unsigned int num_points)
+{
+    VOLK_CFO_ESTIMATEPUPPET(volk_32fc_s32u_x2_cfo_estimate_32f_u_avx2_fma);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+static inline void
+volk_32fc_cfo_estimatepuppet_32f_u_avx512f(float* estimates,
+                                           const lv_32fc_t* inputVector,
+                                           unsigned int num_points)
+{
+    VOLK_CFO_ESTIMATEPUPPET(volk_32fc_s32u_x2_cfo_estimate_32f_u_avx512f);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+static inline void volk_32fc_cfo_estimatepuppet_32f_neonv8(float* estimates,
+                                                           const lv_32fc_t* inputVector,
+                                                           unsigned int num_points)
+{
+    VOLK_CFO_ESTIMATEPUPPET(volk_32fc_s32u_x2_cfo_estimate_32f_neonv8);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_cfo_estimatepuppet_32f_H */
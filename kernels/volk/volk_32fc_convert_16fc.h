@@ -0,0 +1,155 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_convert_16fc
+ *
+ * \b Overview
+ *
+ * Converts complex floats into complex half precision values, the real and
+ * imaginary parts interleaved as for lv_32fc_t, each the uint16_t bit pattern
+ * of an IEEE 754 binary16 value. The parts are rounded as by
+ * volk_32f_convert_16f.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_convert_16fc(uint16_t* outputVector, const lv_32fc_t* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The vector of complex floats to convert.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The 2 * num_points half precision bit patterns.
+ *
+ * \b Example
+ * Store a complex tone in half precision and read it back.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   uint16_t* half = (uint16_t*)volk_malloc(2*sizeof(uint16_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cosf(0.3f * ii), sinf(0.3f * ii));
+ *   }
+ *
+ *   volk_32fc_convert_16fc(half, in, N);
+ *   volk_16fc_convert_32fc(out, half, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.6f %+1.6fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(half);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_convert_16fc_u_H
+#define INCLUDED_volk_32fc_convert_16fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_32f_convert_16f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_convert_16fc_generic(uint16_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_32f_convert_16f_generic(outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_convert_16fc_u_avx512f(uint16_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_32f_convert_16f_u_avx512f(
+        outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+
+static inline void volk_32fc_convert_16fc_u_avx_f16c(uint16_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_32f_convert_16f_u_avx_f16c(
+        outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_convert_16fc_neonv8(uint16_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_convert_16f_neonv8(outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_convert_16fc_u_H */
+
+#ifndef INCLUDED_volk_32fc_convert_16fc_a_H
+#define INCLUDED_volk_32fc_convert_16fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_32f_convert_16f.h>
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_convert_16fc_a_avx512f(uint16_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_32f_convert_16f_a_avx512f(
+        outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+
+static inline void volk_32fc_convert_16fc_a_avx_f16c(uint16_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_32f_convert_16f_a_avx_f16c(
+        outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+#endif /* INCLUDED_volk_32fc_convert_16fc_a_H */
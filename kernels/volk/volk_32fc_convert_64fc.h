@@ -0,0 +1,176 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_convert_64fc
+ *
+ * \b Overview
+ *
+ * Converts complex floats into complex doubles, the real and imaginary
+ * parts each as by volk_32f_convert_64f. The conversion is exact.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_convert_64fc(lv_64fc_t* outputVector, const lv_32fc_t* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex vector to convert.
+ * \li num_points: The number of complex points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex doubles.
+ *
+ * \b Example
+ * Widen a tone for a double precision correlator.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_64fc_t* out = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cosf(0.3f * ii), sinf(0.3f * ii));
+ *   }
+ *
+ *   volk_32fc_convert_64fc(out, in, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.6f %+1.6fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_convert_64fc_u_H
+#define INCLUDED_volk_32fc_convert_64fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_32f_convert_64f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_convert_64fc_generic(lv_64fc_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_32f_convert_64f_generic(
+        (double*)outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_convert_64fc_u_avx512f(lv_64fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_32f_convert_64f_u_avx512f(
+        (double*)outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_convert_64fc_u_avx(lv_64fc_t* outputVector,
+                                                const lv_32fc_t* inputVector,
+                                                unsigned int num_points)
+{
+    volk_32f_convert_64f_u_avx(
+        (double*)outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_32fc_convert_64fc_u_sse2(lv_64fc_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_convert_64f_u_sse2(
+        (double*)outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_convert_64fc_neonv8(lv_64fc_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_convert_64f_neonv8(
+        (double*)outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_convert_64fc_u_H */
+
+#ifndef INCLUDED_volk_32fc_convert_64fc_a_H
+#define INCLUDED_volk_32fc_convert_64fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_32f_convert_64f.h>
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_convert_64fc_a_avx512f(lv_64fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_32f_convert_64f_a_avx512f(
+        (double*)outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_convert_64fc_a_avx(lv_64fc_t* outputVector,
+                                                const lv_32fc_t* inputVector,
+                                                unsigned int num_points)
+{
+    volk_32f_convert_64f_a_avx(
+        (double*)outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_32fc_convert_64fc_a_sse2(lv_64fc_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_convert_64f_a_sse2(
+        (double*)outputVector, (const float*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_SSE2 */
+
+#endif /* INCLUDED_volk_32fc_convert_64fc_a_H */
@@ -0,0 +1,197 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_cumsum_32fc
+ *
+ * \b Overview
+ *
+ * Computes the running sum of the complex input vector, each output being the
+ * sum of the inputs up to and including its own, plus the running sum carried
+ * in:
+ *
+ * outputVector[n] = runningSum + inputVector[0] + ... + inputVector[n]
+ *
+ * The running sum is updated to the last output, so a stream cut into buffers
+ * is summed by passing the same variable to every call. As in
+ * volk_32f_cumsum_32f, the SIMD versions round differently from the generic
+ * one.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_cumsum_32fc(lv_32fc_t* outputVector, const lv_32fc_t* inputVector,
+ * lv_32fc_t* runningSum, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The values to sum.
+ * \li runningSum: The sum carried in from the previous buffers, 0 to start.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The running sums.
+ * \li runningSum: The last running sum, to carry into the next buffer.
+ *
+ * \b Example
+ * Integrate a tone, which traces a circle around 1 / (1 - e^(j0.5)).
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t sum = lv_cmake(0.f, 0.f);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cosf(0.5f * ii), sinf(0.5f * ii));
+ *   }
+ *
+ *   volk_32fc_cumsum_32fc(out, in, &sum, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_cumsum_32fc_H
+#define INCLUDED_volk_32fc_cumsum_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_cumsum_32fc_generic(lv_32fc_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 lv_32fc_t* runningSum,
+                                                 unsigned int num_points)
+{
+    lv_32fc_t sum = *runningSum;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        sum += inputVector[number];
+        outputVector[number] = sum;
+    }
+    *runningSum = sum;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <volk/volk_sse_intrinsics.h>
+#include <xmmintrin.h>
+
+static inline void volk_32fc_cumsum_32fc_u_sse(lv_32fc_t* outputVector,
+                                               const lv_32fc_t* inputVector,
+                                               lv_32fc_t* runningSum,
+                                               unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    __m128 carry = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)runningSum);
+    __m128 sum;
+    unsigned int number;
+
+    carry = _mm_movelh_ps(carry, carry);
+    for (number = 0; number < halfPoints; number++) {
+        sum = _mm_add_ps(_mm_scan_complex_ps(_mm_loadu_ps((const float*)inputVector)),
+                         carry);
+        _mm_storeu_ps((float*)outputVector, sum);
+        carry = _mm_movehl_ps(sum, sum);
+        inputVector += 2;
+        outputVector += 2;
+    }
+    _mm_storel_pi((__m64*)runningSum, carry);
+
+    volk_32fc_cumsum_32fc_generic(
+        outputVector, inputVector, runningSum, num_points - halfPoints * 2);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_cumsum_32fc_u_avx(lv_32fc_t* outputVector,
+                                               const lv_32fc_t* inputVector,
+                                               lv_32fc_t* runningSum,
+                                               unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __m256 carry = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)runningSum));
+    __m256 sum;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        sum = _mm256_add_ps(
+            _mm256_scan_complex_ps(_mm256_loadu_ps((const float*)inputVector)), carry);
+        _mm256_storeu_ps((float*)outputVector, sum);
+        sum = _mm256_permute_ps(sum, 0xee);
+        carry = _mm256_permute2f128_ps(sum, sum, 0x11);
+        inputVector += 4;
+        outputVector += 4;
+    }
+    _mm_storel_pi((__m64*)runningSum, _mm256_castps256_ps128(carry));
+
+    volk_32fc_cumsum_32fc_generic(
+        outputVector, inputVector, runningSum, num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_cumsum_32fc_neon(lv_32fc_t* outputVector,
+                                              const lv_32fc_t* inputVector,
+                                              lv_32fc_t* runningSum,
+                                              unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    float32x2_t carry = vld1_f32((const float*)runningSum);
+    float32x4_t sum;
+    unsigned int number;
+
+    for (number = 0; number < halfPoints; number++) {
+        sum = vaddq_f32(_vscan_complexq_f32(vld1q_f32((const float*)inputVector)),
+                        vcombine_f32(carry, carry));
+        vst1q_f32((float*)outputVector, sum);
+        carry = vget_high_f32(sum);
+        inputVector += 2;
+        outputVector += 2;
+    }
+    vst1_f32((float*)runningSum, carry);
+
+    volk_32fc_cumsum_32fc_generic(
+        outputVector, inputVector, runningSum, num_points - halfPoints * 2);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_cumsum_32fc_H */
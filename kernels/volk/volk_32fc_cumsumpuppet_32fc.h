@@ -0,0 +1,120 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_cumsum_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_cumsumpuppet_32fc_H
+#define INCLUDED_volk_32fc_cumsumpuppet_32fc_H
+
+#include <volk/volk_32fc_cumsum_32fc.h>
+
+/*
+ * Sums the input in calls of 100 points, carrying the running sum from each
+ * call into the next but restarting it every other call to keep the rounding
+ * differences between the versions small.
+ */
+static inline void
+volk_32fc_cumsum_puppet(void (*kernel)(lv_32fc_t*,
+                                       const lv_32fc_t*,
+                                       lv_32fc_t*,
+                                       unsigned int),
+                        lv_32fc_t* outputVector,
+                        const lv_32fc_t* inputVector,
+                        unsigned int num_points)
+{
+    lv_32fc_t runningSum = lv_cmake(0.5f, -0.25f);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += 100) {
+        if (number % 200 == 0) {
+            runningSum = lv_cmake(0.5f, -0.25f);
+        }
+        kernel(outputVector + number,
+               inputVector + number,
+               &runningSum,
+               num_points - number < 100 ? num_points - number : 100);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_cumsumpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                       const lv_32fc_t* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_32fc_cumsum_puppet(volk_32fc_cumsum_32fc_generic,
+                            outputVector,
+                            inputVector,
+                            num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32fc_cumsumpuppet_32fc_u_sse(lv_32fc_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_32fc_cumsum_puppet(volk_32fc_cumsum_32fc_u_sse,
+                            outputVector,
+                            inputVector,
+                            num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_cumsumpuppet_32fc_u_avx(lv_32fc_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_32fc_cumsum_puppet(volk_32fc_cumsum_32fc_u_avx,
+                            outputVector,
+                            inputVector,
+                            num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_cumsumpuppet_32fc_neon(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_32fc_cumsum_puppet(volk_32fc_cumsum_32fc_neon,
+                            outputVector,
+                            inputVector,
+                            num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_cumsumpuppet_32fc_H */
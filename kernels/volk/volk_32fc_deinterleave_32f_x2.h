@@ -76,6 +76,51 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_deinterleave_32f_x2_a_avx512f(float* iBuffer,
+                                        float* qBuffer,
+                                        const lv_32fc_t* complexVector,
+                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i realIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imagIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    const float* in = (const float*)complexVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512 cplxValue0 = _mm512_load_ps(in);
+        const __m512 cplxValue1 = _mm512_load_ps(in + 16);
+        const __m512 iValue = _mm512_permutex2var_ps(cplxValue0, realIdx, cplxValue1);
+        const __m512 qValue = _mm512_permutex2var_ps(cplxValue0, imagIdx, cplxValue1);
+        _mm512_store_ps(iBuffer, iValue);
+        _mm512_store_ps(qBuffer, qValue);
+        in += 32;
+        iBuffer += 16;
+        qBuffer += 16;
+    }
+
+    // the last points with masked loads, two floats a point split over two registers
+    const unsigned int remaining = num_points & 15;
+    const unsigned int low = remaining < 8 ? remaining : 8;
+    const __mmask16 mask0 = _cvtu32_mask16((1u << (2 * low)) - 1);
+    const __mmask16 mask1 = _cvtu32_mask16((1u << (2 * (remaining - low))) - 1);
+    const __mmask16 mask = _cvtu32_mask16((1u << remaining) - 1);
+    const __m512 cplxValue0 = _mm512_maskz_load_ps(mask0, in);
+    const __m512 cplxValue1 = _mm512_maskz_load_ps(mask1, in + 16);
+    _mm512_mask_store_ps(
+        iBuffer, mask, _mm512_permutex2var_ps(cplxValue0, realIdx, cplxValue1));
+    _mm512_mask_store_ps(
+        qBuffer, mask, _mm512_permutex2var_ps(cplxValue0, imagIdx, cplxValue1));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 static inline void volk_32fc_deinterleave_32f_x2_a_avx(float* iBuffer,
@@ -223,6 +268,51 @@ static inline void volk_32fc_deinterleave_32f_x2_generic(float* iBuffer,
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_deinterleave_32f_x2_u_avx512f(float* iBuffer,
+                                        float* qBuffer,
+                                        const lv_32fc_t* complexVector,
+                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i realIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imagIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    const float* in = (const float*)complexVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512 cplxValue0 = _mm512_loadu_ps(in);
+        const __m512 cplxValue1 = _mm512_loadu_ps(in + 16);
+        const __m512 iValue = _mm512_permutex2var_ps(cplxValue0, realIdx, cplxValue1);
+        const __m512 qValue = _mm512_permutex2var_ps(cplxValue0, imagIdx, cplxValue1);
+        _mm512_storeu_ps(iBuffer, iValue);
+        _mm512_storeu_ps(qBuffer, qValue);
+        in += 32;
+        iBuffer += 16;
+        qBuffer += 16;
+    }
+
+    // the last points with masked loads, two floats a point split over two registers
+    const unsigned int remaining = num_points & 15;
+    const unsigned int low = remaining < 8 ? remaining : 8;
+    const __mmask16 mask0 = _cvtu32_mask16((1u << (2 * low)) - 1);
+    const __mmask16 mask1 = _cvtu32_mask16((1u << (2 * (remaining - low))) - 1);
+    const __mmask16 mask = _cvtu32_mask16((1u << remaining) - 1);
+    const __m512 cplxValue0 = _mm512_maskz_loadu_ps(mask0, in);
+    const __m512 cplxValue1 = _mm512_maskz_loadu_ps(mask1, in + 16);
+    _mm512_mask_storeu_ps(
+        iBuffer, mask, _mm512_permutex2var_ps(cplxValue0, realIdx, cplxValue1));
+    _mm512_mask_storeu_ps(
+        qBuffer, mask, _mm512_permutex2var_ps(cplxValue0, imagIdx, cplxValue1));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 static inline void volk_32fc_deinterleave_32f_x2_u_avx(float* iBuffer,
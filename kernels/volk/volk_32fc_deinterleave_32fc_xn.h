@@ -0,0 +1,237 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_deinterleave_32fc_xn
+ *
+ * \b Overview
+ *
+ * Deinterleaves a multi-channel complex vector, holding one sample of
+ * every channel after the other (ch0, ch1, ..., chN-1, ch0, ...), into
+ * one vector per channel.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_deinterleave_32fc_xn(lv_32fc_t** channels, const lv_32fc_t* input,
+ * unsigned int num_channels, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The interleaved input vector of num_channels * num_points samples.
+ * \li num_channels: The number of channels.
+ * \li num_points: The number of samples per channel.
+ *
+ * \b Outputs
+ * \li channels: num_channels pointers to the channel vectors of num_points samples.
+ *
+ * Even channel counts, and in particular 2, 4 and 8 channels, have SIMD
+ * shuffles; other channel counts fall back to a scalar copy. The channel
+ * vectors are not required to be aligned.
+ *
+ * \b Example
+ * Split a four antenna capture into one vector per antenna.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* capture = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*4*N, alignment);
+ *   lv_32fc_t* channels[4];
+ *   for(unsigned int ch = 0; ch < 4; ++ch){
+ *       channels[ch] = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   }
+ *
+ *   volk_32fc_deinterleave_32fc_xn(channels, capture, 4, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_deinterleave_32fc_xn_u_H
+#define INCLUDED_volk_32fc_deinterleave_32fc_xn_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_deinterleave_32fc_xn_generic(lv_32fc_t** channels,
+                                                          const lv_32fc_t* input,
+                                                          unsigned int num_channels,
+                                                          unsigned int num_points)
+{
+    const lv_32fc_t* inputPtr = input;
+    unsigned int number, ch;
+    for (number = 0; number < num_points; number++) {
+        for (ch = 0; ch < num_channels; ch++) {
+            channels[ch][number] = *inputPtr++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32fc_deinterleave_32fc_xn_sse2(lv_32fc_t** channels,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int num_channels,
+                                                       unsigned int num_points)
+{
+    unsigned int number = 0, ch;
+
+    // a complex sample is one 64 bit lane; 2x2 transposes of channel pairs
+    if ((num_channels & 1) == 0) {
+        const unsigned int halfPoints = num_points / 2;
+        for (; number < halfPoints; number++) {
+            const double* inPtr = (const double*)(input + 2 * number * num_channels);
+            for (ch = 0; ch < num_channels; ch += 2) {
+                // s0c0 s0c1 | s1c0 s1c1
+                const __m128d s0 = _mm_loadu_pd(inPtr + ch);
+                const __m128d s1 = _mm_loadu_pd(inPtr + num_channels + ch);
+                _mm_storeu_pd((double*)(channels[ch] + 2 * number),
+                              _mm_unpacklo_pd(s0, s1));
+                _mm_storeu_pd((double*)(channels[ch + 1] + 2 * number),
+                              _mm_unpackhi_pd(s0, s1));
+            }
+        }
+        number = halfPoints * 2;
+    }
+
+    const lv_32fc_t* inputPtr = input + number * num_channels;
+    for (; number < num_points; number++) {
+        for (ch = 0; ch < num_channels; ch++) {
+            channels[ch][number] = *inputPtr++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_deinterleave_32fc_xn_avx(lv_32fc_t** channels,
+                                                      const lv_32fc_t* input,
+                                                      unsigned int num_channels,
+                                                      unsigned int num_points)
+{
+    unsigned int number = 0, ch;
+    const unsigned int quarterPoints = num_points / 4;
+
+    if (num_channels == 2) {
+        lv_32fc_t* ch0 = channels[0];
+        lv_32fc_t* ch1 = channels[1];
+        for (; number < quarterPoints; number++) {
+            const double* inPtr = (const double*)(input + 8 * number);
+            // s0c0 s0c1 s1c0 s1c1 | s2c0 s2c1 s3c0 s3c1
+            const __m256d r0 = _mm256_loadu_pd(inPtr);
+            const __m256d r1 = _mm256_loadu_pd(inPtr + 4);
+            // s0c0 s0c1 s2c0 s2c1 | s1c0 s1c1 s3c0 s3c1
+            const __m256d t0 = _mm256_permute2f128_pd(r0, r1, 0x20);
+            const __m256d t1 = _mm256_permute2f128_pd(r0, r1, 0x31);
+            _mm256_storeu_pd((double*)(ch0 + 4 * number), _mm256_unpacklo_pd(t0, t1));
+            _mm256_storeu_pd((double*)(ch1 + 4 * number), _mm256_unpackhi_pd(t0, t1));
+        }
+        number = quarterPoints * 4;
+    } else if ((num_channels & 3) == 0) {
+        // 4x4 transposes, four samples of four channels at a time
+        for (; number < quarterPoints; number++) {
+            const double* inPtr = (const double*)(input + 4 * number * num_channels);
+            for (ch = 0; ch < num_channels; ch += 4) {
+                const __m256d r0 = _mm256_loadu_pd(inPtr + ch);
+                const __m256d r1 = _mm256_loadu_pd(inPtr + num_channels + ch);
+                const __m256d r2 = _mm256_loadu_pd(inPtr + 2 * num_channels + ch);
+                const __m256d r3 = _mm256_loadu_pd(inPtr + 3 * num_channels + ch);
+                // s0c0 s1c0 s0c2 s1c2, s0c1 s1c1 s0c3 s1c3, ...
+                const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+                const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+                const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+                const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+                _mm256_storeu_pd((double*)(channels[ch] + 4 * number),
+                                 _mm256_permute2f128_pd(t0, t2, 0x20));
+                _mm256_storeu_pd((double*)(channels[ch + 1] + 4 * number),
+                                 _mm256_permute2f128_pd(t1, t3, 0x20));
+                _mm256_storeu_pd((double*)(channels[ch + 2] + 4 * number),
+                                 _mm256_permute2f128_pd(t0, t2, 0x31));
+                _mm256_storeu_pd((double*)(channels[ch + 3] + 4 * number),
+                                 _mm256_permute2f128_pd(t1, t3, 0x31));
+            }
+        }
+        number = quarterPoints * 4;
+    }
+
+    const lv_32fc_t* inputPtr = input + number * num_channels;
+    for (; number < num_points; number++) {
+        for (ch = 0; ch < num_channels; ch++) {
+            channels[ch][number] = *inputPtr++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_deinterleave_32fc_xn_neonv8(lv_32fc_t** channels,
+                                                         const lv_32fc_t* input,
+                                                         unsigned int num_channels,
+                                                         unsigned int num_points)
+{
+    unsigned int number = 0, ch;
+
+    if (num_channels == 4) {
+        // vld4 splits two samples of four channels in one go
+        const unsigned int halfPoints = num_points / 2;
+        for (; number < halfPoints; number++) {
+            const float64x2x4_t s = vld4q_f64((const double*)(input + 8 * number));
+            for (ch = 0; ch < 4; ch++) {
+                vst1q_f64((double*)(channels[ch] + 2 * number), s.val[ch]);
+            }
+        }
+        number = halfPoints * 2;
+    } else if ((num_channels & 1) == 0) {
+        // 2x2 transposes of channel pairs
+        const unsigned int halfPoints = num_points / 2;
+        for (; number < halfPoints; number++) {
+            const double* inPtr = (const double*)(input + 2 * number * num_channels);
+            for (ch = 0; ch < num_channels; ch += 2) {
+                const float64x2_t s0 = vld1q_f64(inPtr + ch);
+                const float64x2_t s1 = vld1q_f64(inPtr + num_channels + ch);
+                vst1q_f64((double*)(channels[ch] + 2 * number), vzip1q_f64(s0, s1));
+                vst1q_f64((double*)(channels[ch + 1] + 2 * number), vzip2q_f64(s0, s1));
+            }
+        }
+        number = halfPoints * 2;
+    }
+
+    const lv_32fc_t* inputPtr = input + number * num_channels;
+    for (; number < num_points; number++) {
+        for (ch = 0; ch < num_channels; ch++) {
+            channels[ch][number] = *inputPtr++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_deinterleave_32fc_xn_u_H */
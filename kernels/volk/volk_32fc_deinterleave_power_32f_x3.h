@@ -0,0 +1,212 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_deinterleave_power_32f_x3
+ *
+ * \b Overview
+ *
+ * Splits complex points into their real and imaginary planes and computes
+ * their power, re^2 + im^2, in the same pass, instead of reading the input
+ * again in volk_32fc_magnitude_squared_32f after
+ * volk_32fc_deinterleave_32f_x2.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_deinterleave_power_32f_x3(float* iBuffer, float* qBuffer,
+ * float* powerBuffer, const lv_32fc_t* complexVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li complexVector: The complex input points.
+ * \li num_points: The number of complex points.
+ *
+ * \b Outputs
+ * \li iBuffer: The real part of each point.
+ * \li qBuffer: The imaginary part of each point.
+ * \li powerBuffer: The power of each point.
+ *
+ * \b Example
+ * \code
+ *   volk_32fc_deinterleave_power_32f_x3(i, q, power, samples, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_deinterleave_power_32f_x3_H
+#define INCLUDED_volk_32fc_deinterleave_power_32f_x3_H
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_deinterleave_power_32f_x3_generic(float* iBuffer,
+                                            float* qBuffer,
+                                            float* powerBuffer,
+                                            const lv_32fc_t* complexVector,
+                                            unsigned int num_points)
+{
+    const float* complexVectorPtr = (const float*)complexVector;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        const float real = *complexVectorPtr++;
+        const float imag = *complexVectorPtr++;
+        *iBuffer++ = real;
+        *qBuffer++ = imag;
+        *powerBuffer++ = real * real + imag * imag;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void
+volk_32fc_deinterleave_power_32f_x3_u_avx2(float* iBuffer,
+                                           float* qBuffer,
+                                           float* powerBuffer,
+                                           const lv_32fc_t* complexVector,
+                                           unsigned int num_points)
+{
+    const float* complexVectorPtr = (const float*)complexVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+    __m256 complex1, complex2, real, imag, power;
+
+    for (number = 0; number < eighthPoints; number++) {
+        complex1 = _mm256_loadu_ps(complexVectorPtr);
+        complex2 = _mm256_loadu_ps(complexVectorPtr + 8);
+        // the parts of points 0, 1, 4, 5, 2, 3, 6, 7, put back in order
+        real = _mm256_shuffle_ps(complex1, complex2, 0x88);
+        imag = _mm256_shuffle_ps(complex1, complex2, 0xdd);
+        real = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(real), 0xd8));
+        imag = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(imag), 0xd8));
+        power = _mm256_add_ps(_mm256_mul_ps(real, real), _mm256_mul_ps(imag, imag));
+        _mm256_storeu_ps(iBuffer, real);
+        _mm256_storeu_ps(qBuffer, imag);
+        _mm256_storeu_ps(powerBuffer, power);
+        complexVectorPtr += 16;
+        iBuffer += 8;
+        qBuffer += 8;
+        powerBuffer += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        const float real = *complexVectorPtr++;
+        const float imag = *complexVectorPtr++;
+        *iBuffer++ = real;
+        *qBuffer++ = imag;
+        *powerBuffer++ = real * real + imag * imag;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_deinterleave_power_32f_x3_u_avx512f(float* iBuffer,
+                                              float* qBuffer,
+                                              float* powerBuffer,
+                                              const lv_32fc_t* complexVector,
+                                              unsigned int num_points)
+{
+    const float* complexVectorPtr = (const float*)complexVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i realIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imagIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    unsigned int number;
+    __m512 complex1, complex2, real, imag;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        complex1 = _mm512_loadu_ps(complexVectorPtr);
+        complex2 = _mm512_loadu_ps(complexVectorPtr + 16);
+        real = _mm512_permutex2var_ps(complex1, realIdx, complex2);
+        imag = _mm512_permutex2var_ps(complex1, imagIdx, complex2);
+        _mm512_storeu_ps(iBuffer, real);
+        _mm512_storeu_ps(qBuffer, imag);
+        _mm512_storeu_ps(
+            powerBuffer,
+            _mm512_add_ps(_mm512_mul_ps(real, real), _mm512_mul_ps(imag, imag)));
+        complexVectorPtr += 32;
+        iBuffer += 16;
+        qBuffer += 16;
+        powerBuffer += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        const float real = *complexVectorPtr++;
+        const float imag = *complexVectorPtr++;
+        *iBuffer++ = real;
+        *qBuffer++ = imag;
+        *powerBuffer++ = real * real + imag * imag;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_deinterleave_power_32f_x3_neon(float* iBuffer,
+                                         float* qBuffer,
+                                         float* powerBuffer,
+                                         const lv_32fc_t* complexVector,
+                                         unsigned int num_points)
+{
+    const float* complexVectorPtr = (const float*)complexVector;
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const float32x4x2_t input = vld2q_f32(complexVectorPtr);
+        __VOLK_PREFETCH(complexVectorPtr + 32);
+        vst1q_f32(iBuffer, input.val[0]);
+        vst1q_f32(qBuffer, input.val[1]);
+        vst1q_f32(powerBuffer,
+                  vaddq_f32(vmulq_f32(input.val[0], input.val[0]),
+                            vmulq_f32(input.val[1], input.val[1])));
+        complexVectorPtr += 8;
+        iBuffer += 4;
+        qBuffer += 4;
+        powerBuffer += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        const float real = *complexVectorPtr++;
+        const float imag = *complexVectorPtr++;
+        *iBuffer++ = real;
+        *qBuffer++ = imag;
+        *powerBuffer++ = real * real + imag * imag;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_deinterleave_power_32f_x3_H */
@@ -0,0 +1,141 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_s32u_x2_delay_correlate_32fc_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_delay_correlatepuppet_32fc_32f_H
+#define INCLUDED_volk_32fc_delay_correlatepuppet_32fc_32f_H
+
+#include <string.h>
+#include <volk/volk_32fc_s32u_x2_delay_correlate_32fc_32f.h>
+
+/*
+ * Correlates windows of 16 points with the input 32 points later in calls
+ * of 1000 outputs, each reading the last 47 points of the previous one as its
+ * history. The last 47 outputs, whose windows would run past the input, are
+ * zeroed.
+ */
+static inline void
+volk_32fc_delay_correlate_puppet(void (*kernel)(lv_32fc_t*,
+                                                float*,
+                                                const lv_32fc_t*,
+                                                const unsigned int,
+                                                const unsigned int,
+                                                unsigned int),
+                                 lv_32fc_t* correlationVector,
+                                 float* energyVector,
+                                 const lv_32fc_t* inputVector,
+                                 unsigned int num_points)
+{
+    const unsigned int num_outputs = num_points >= 48 ? num_points - 47 : 0;
+    unsigned int number;
+
+    for (number = 0; number < num_outputs; number += 1000) {
+        kernel(correlationVector + number,
+               energyVector + number,
+               inputVector + number,
+               32,
+               16,
+               num_outputs - number < 1000 ? num_outputs - number : 1000);
+    }
+    memset(correlationVector + num_outputs,
+           0,
+           sizeof(lv_32fc_t) * (num_points - num_outputs));
+    memset(energyVector + num_outputs, 0, sizeof(float) * (num_points - num_outputs));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_delay_correlatepuppet_32fc_32f_generic(lv_32fc_t* correlationVector,
+                                                 float* energyVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32fc_delay_correlate_puppet(volk_32fc_s32u_x2_delay_correlate_32fc_32f_generic,
+                                     correlationVector,
+                                     energyVector,
+                                     inputVector,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void
+volk_32fc_delay_correlatepuppet_32fc_32f_u_avx(lv_32fc_t* correlationVector,
+                                               float* energyVector,
+                                               const lv_32fc_t* inputVector,
+                                               unsigned int num_points)
+{
+    volk_32fc_delay_correlate_puppet(volk_32fc_s32u_x2_delay_correlate_32fc_32f_u_avx,
+                                     correlationVector,
+                                     energyVector,
+                                     inputVector,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_delay_correlatepuppet_32fc_32f_u_avx512f(lv_32fc_t* correlationVector,
+                                                   float* energyVector,
+                                                   const lv_32fc_t* inputVector,
+                                                   unsigned int num_points)
+{
+    volk_32fc_delay_correlate_puppet(volk_32fc_s32u_x2_delay_correlate_32fc_32f_u_avx512f,
+                                     correlationVector,
+                                     energyVector,
+                                     inputVector,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_delay_correlatepuppet_32fc_32f_neon(lv_32fc_t* correlationVector,
+                                              float* energyVector,
+                                              const lv_32fc_t* inputVector,
+                                              unsigned int num_points)
+{
+    volk_32fc_delay_correlate_puppet(volk_32fc_s32u_x2_delay_correlate_32fc_32f_neon,
+                                     correlationVector,
+                                     energyVector,
+                                     inputVector,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_delay_correlatepuppet_32fc_32f_H */
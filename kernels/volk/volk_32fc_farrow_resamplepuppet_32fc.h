@@ -0,0 +1,119 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_s64f_x2_farrow_resample_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_farrow_resamplepuppet_32fc_H
+#define INCLUDED_volk_32fc_farrow_resamplepuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_32fc_s64f_x2_farrow_resample_32fc.h>
+
+/* Resamples by 1.37 from a quarter of an input, as far as the input goes, and
+ * copies the input past the outputs. */
+static inline void volk_farrow_resample_puppet(void (*kernel)(lv_32fc_t*,
+                                                              const lv_32fc_t*,
+                                                              const double,
+                                                              const double,
+                                                              unsigned int),
+                                               lv_32fc_t* outputVector,
+                                               const lv_32fc_t* inputVector,
+                                               unsigned int num_points)
+{
+    const double step = 1.37;
+    const unsigned int num_outputs =
+        num_points < 4 ? 0 : (unsigned int)((num_points - 4) / step) + 1;
+
+    kernel(outputVector, inputVector, 0.25, step, num_outputs);
+    memcpy(outputVector + num_outputs,
+           inputVector + num_outputs,
+           (num_points - num_outputs) * sizeof(lv_32fc_t));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_farrow_resamplepuppet_32fc_generic(lv_32fc_t* outputVector,
+                                             const lv_32fc_t* inputVector,
+                                             unsigned int num_points)
+{
+    volk_farrow_resample_puppet(volk_32fc_s64f_x2_farrow_resample_32fc_generic,
+                                outputVector,
+                                inputVector,
+                                num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+
+static inline void
+volk_32fc_farrow_resamplepuppet_32fc_u_avx_fma(lv_32fc_t* outputVector,
+                                               const lv_32fc_t* inputVector,
+                                               unsigned int num_points)
+{
+    volk_farrow_resample_puppet(volk_32fc_s64f_x2_farrow_resample_32fc_u_avx_fma,
+                                outputVector,
+                                inputVector,
+                                num_points);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_farrow_resamplepuppet_32fc_u_avx2_gather(lv_32fc_t* outputVector,
+                                                   const lv_32fc_t* inputVector,
+                                                   unsigned int num_points)
+{
+    volk_farrow_resample_puppet(volk_32fc_s64f_x2_farrow_resample_32fc_u_avx2_gather,
+                                outputVector,
+                                inputVector,
+                                num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void
+volk_32fc_farrow_resamplepuppet_32fc_neonv8(lv_32fc_t* outputVector,
+                                            const lv_32fc_t* inputVector,
+                                            unsigned int num_points)
+{
+    volk_farrow_resample_puppet(volk_32fc_s64f_x2_farrow_resample_32fc_neonv8,
+                                outputVector,
+                                inputVector,
+                                num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_farrow_resamplepuppet_32fc_H */
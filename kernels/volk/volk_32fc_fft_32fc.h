@@ -0,0 +1,191 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_fft_32fc
+ *
+ * \b Overview
+ *
+ * Computes the discrete Fourier transform of a complex vector whose
+ * length is a power of two:
+ * output[k] = sum_n input[n] * exp(-2 pi i n k / num_points).
+ *
+ * A radix-2 decimation in time FFT with the stages fused pairwise into
+ * radix-4 passes, which the SIMD implementations run on several
+ * butterflies at once. The twiddle factors are computed once per length
+ * and cached for the life of the process, see volk_fft_get_twiddles();
+ * volk_plan_create() builds the table up front, so no call on the plan
+ * pays for it. The transform is out of place, output must not overlap
+ * input. volk_32fc_ifft_32fc is the inverse.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_fft_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The complex vector to transform.
+ * \li num_points: The transform length, a power of two.
+ *
+ * \b Outputs
+ * \li output: The transform of input.
+ *
+ * \b Example
+ * Power spectrum of a tone in bin 8, planned once for a monitoring loop.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* power = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       float phase = 2.f * M_PI * 8.f * ii / N;
+ *       in[ii] = lv_cmake(cosf(phase), sinf(phase));
+ *   }
+ *
+ *   volk_plan_t* plan = volk_plan_create("volk_32fc_fft_32fc", N, VOLK_PLAN_ALIGNED);
+ *   volk_plan_execute(volk_32fc_fft_32fc, plan, out, in, N);
+ *   volk_32fc_magnitude_squared_32f(power, out, N);
+ *   printf("bin 8: %f\n", power[8]); // N * N
+ *
+ *   volk_plan_destroy(plan);
+ *   volk_free(in);
+ *   volk_free(out);
+ *   volk_free(power);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_fft_32fc_u_H
+#define INCLUDED_volk_32fc_fft_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_fft.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_fft_32fc_generic(lv_32fc_t* output,
+                                              const lv_32fc_t* input,
+                                              unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, false);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4)
+        volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32fc_fft_32fc_sse3(lv_32fc_t* output,
+                                           const lv_32fc_t* input,
+                                           unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, false);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4) {
+        if (h % 2 == 0)
+            _mm_fft_radix4_pass_sse3(
+                (float*)output, num_points, h, (const float*)twiddles);
+        else
+            volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+    }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_fft_32fc_avx(lv_32fc_t* output,
+                                          const lv_32fc_t* input,
+                                          unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, false);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4) {
+        if (h % 4 == 0)
+            _mm256_fft_radix4_pass_avx(
+                (float*)output, num_points, h, (const float*)twiddles);
+        else
+            volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_fft_32fc_avx512f(lv_32fc_t* output,
+                                              const lv_32fc_t* input,
+                                              unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, false);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4) {
+        if (h % 8 == 0)
+            _mm512_fft_radix4_pass_avx512f(
+                (float*)output, num_points, h, (const float*)twiddles);
+        else
+            volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_fft_32fc_neon(lv_32fc_t* output,
+                                           const lv_32fc_t* input,
+                                           unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, false);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4) {
+        if (h % 4 == 0)
+            _vfft_radix4_passq_f32((float*)output, num_points, h, (const float*)twiddles);
+        else
+            volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_fft_32fc_u_H */
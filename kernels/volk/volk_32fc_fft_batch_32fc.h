@@ -0,0 +1,574 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_fft_batch_32fc
+ *
+ * \b Overview
+ *
+ * Computes the discrete Fourier transforms of num_transforms complex
+ * vectors of one power of two length, stored one after the other:
+ * output[t * num_points + k] =
+ * sum_n input[t * num_points + n] * exp(-2 pi i n k / num_points).
+ *
+ * Short transforms, as channelizers, OFDM and short time spectra run by
+ * the thousand, have too few butterflies per stage to fill the vectors of
+ * volk_32fc_fft_32fc. The _lanes implementations instead transpose as
+ * many transforms as a vector has floats into a stack buffer, real and
+ * imaginary parts apart, and run the stages of all of them at once, a
+ * lane per transform, with the twiddle factors broadcast. The other
+ * implementations call volk_32fc_fft_32fc of their architecture per
+ * transform. Which is faster depends on the length, so the dispatcher
+ * looks up the length bucket of num_points, the transform length, and
+ * volk_profile --length-buckets ranks them per bucket. Transforms longer
+ * than VOLK_FFT_BATCH_MAX_LANE_POINTS and those left over from the last
+ * full set of lanes go through volk_32fc_fft_32fc.
+ *
+ * The twiddle factors are those of volk_fft_get_twiddles(), which a
+ * volk_plan_create() of this kernel builds up front. The transforms are
+ * out of place, output must not overlap input.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_fft_batch_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ * unsigned int num_transforms, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The num_transforms vectors to transform, one after the other.
+ * \li num_transforms: The number of transforms.
+ * \li num_points: The transform length, a power of two.
+ *
+ * \b Outputs
+ * \li output: The transforms of the input vectors, one after the other.
+ *
+ * \b Example
+ * Demodulate a block of 1000 OFDM symbols of 64 subcarriers, their cyclic
+ * prefixes already dropped.
+ * \code
+ *   unsigned int N = 64, symbols = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N * symbols, alignment);
+ *   lv_32fc_t* carriers =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N * symbols, alignment);
+ *
+ *   // ... fill in with the received symbols ...
+ *
+ *   volk_plan_t* plan = volk_plan_create("volk_32fc_fft_batch_32fc", N, 0);
+ *   volk_plan_execute(volk_32fc_fft_batch_32fc, plan, carriers, in, symbols, N);
+ *   // subcarrier k of symbol s is carriers[s * N + k]
+ *
+ *   volk_plan_destroy(plan);
+ *   volk_free(in);
+ *   volk_free(carriers);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_fft_batch_32fc_H
+#define INCLUDED_volk_32fc_fft_batch_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_32fc_fft_32fc.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_fft.h>
+
+/* The longest transform run across lanes; a set of lanes of it, 64 KiB at
+ * 16 lanes, stays in the L1 or L2 cache through all stages. */
+#define VOLK_FFT_BATCH_MAX_LANE_POINTS 512
+
+/* Run impl, a volk_32fc_fft_32fc implementation, on each transform from
+ * first on. */
+#define VOLK_FFT_BATCH_EACH(impl, first)                                     \
+    for (unsigned int t = (first); t < num_transforms; t++) {                \
+        impl(output + (size_t)t * num_points,                                \
+             input + (size_t)t * num_points,                                 \
+             num_points);                                                    \
+    }
+
+static inline unsigned int volk_fft_batch_log2(unsigned int num_points)
+{
+    unsigned int log2_points = 0;
+    while ((2u << log2_points) <= num_points)
+        log2_points++;
+    return log2_points;
+}
+
+static inline unsigned int volk_fft_batch_reverse(unsigned int n,
+                                                  unsigned int log2_points)
+{
+    unsigned int reversed = 0, b;
+    for (b = 0; b < log2_points; b++) {
+        reversed = (reversed << 1) | (n & 1);
+        n >>= 1;
+    }
+    return reversed;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_fft_batch_32fc_generic(lv_32fc_t* output,
+                                                    const lv_32fc_t* input,
+                                                    unsigned int num_transforms,
+                                                    unsigned int num_points)
+{
+    VOLK_FFT_BATCH_EACH(volk_32fc_fft_32fc_generic, 0);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32fc_fft_batch_32fc_sse3(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 unsigned int num_transforms,
+                                                 unsigned int num_points)
+{
+    VOLK_FFT_BATCH_EACH(volk_32fc_fft_32fc_sse3, 0);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_fft_batch_32fc_avx(lv_32fc_t* output,
+                                                const lv_32fc_t* input,
+                                                unsigned int num_transforms,
+                                                unsigned int num_points)
+{
+    VOLK_FFT_BATCH_EACH(volk_32fc_fft_32fc_avx, 0);
+}
+
+/* The radix-4 pass of volk_fft_radix4_pass_generic on eight transforms, point
+ * n of lane l at lanes[16 n + l], its imaginary part at lanes[16 n + 8 + l]. */
+static inline void volk_fft_batch_radix4_pass_avx(float* lanes,
+                                                  unsigned int num_points,
+                                                  unsigned int h,
+                                                  const lv_32fc_t* twiddles)
+{
+    unsigned int block, j;
+    for (block = 0; block < num_points; block += 4 * h) {
+        for (j = 0; j < h; j++) {
+            float* x0 = lanes + 16 * (block + j);
+            float* x1 = x0 + 16 * h;
+            float* x2 = x1 + 16 * h;
+            float* x3 = x2 + 16 * h;
+            const __m256 w1r = _mm256_set1_ps(lv_creal(twiddles[h + j]));
+            const __m256 w1i = _mm256_set1_ps(lv_cimag(twiddles[h + j]));
+            const __m256 w2r = _mm256_set1_ps(lv_creal(twiddles[2 * h + j]));
+            const __m256 w2i = _mm256_set1_ps(lv_cimag(twiddles[2 * h + j]));
+            const __m256 w3r = _mm256_set1_ps(lv_creal(twiddles[3 * h + j]));
+            const __m256 w3i = _mm256_set1_ps(lv_cimag(twiddles[3 * h + j]));
+            const __m256 a0r = _mm256_load_ps(x0), a0i = _mm256_load_ps(x0 + 8);
+            const __m256 a1r = _mm256_load_ps(x1), a1i = _mm256_load_ps(x1 + 8);
+            const __m256 a2r = _mm256_load_ps(x2), a2i = _mm256_load_ps(x2 + 8);
+            const __m256 a3r = _mm256_load_ps(x3), a3i = _mm256_load_ps(x3 + 8);
+
+            const __m256 t1r =
+                _mm256_sub_ps(_mm256_mul_ps(a1r, w1r), _mm256_mul_ps(a1i, w1i));
+            const __m256 t1i =
+                _mm256_add_ps(_mm256_mul_ps(a1r, w1i), _mm256_mul_ps(a1i, w1r));
+            const __m256 t3r =
+                _mm256_sub_ps(_mm256_mul_ps(a3r, w1r), _mm256_mul_ps(a3i, w1i));
+            const __m256 t3i =
+                _mm256_add_ps(_mm256_mul_ps(a3r, w1i), _mm256_mul_ps(a3i, w1r));
+            const __m256 y0r = _mm256_add_ps(a0r, t1r), y0i = _mm256_add_ps(a0i, t1i);
+            const __m256 y1r = _mm256_sub_ps(a0r, t1r), y1i = _mm256_sub_ps(a0i, t1i);
+            const __m256 y2r = _mm256_add_ps(a2r, t3r), y2i = _mm256_add_ps(a2i, t3i);
+            const __m256 y3r = _mm256_sub_ps(a2r, t3r), y3i = _mm256_sub_ps(a2i, t3i);
+
+            const __m256 u2r =
+                _mm256_sub_ps(_mm256_mul_ps(y2r, w2r), _mm256_mul_ps(y2i, w2i));
+            const __m256 u2i =
+                _mm256_add_ps(_mm256_mul_ps(y2r, w2i), _mm256_mul_ps(y2i, w2r));
+            const __m256 u3r =
+                _mm256_sub_ps(_mm256_mul_ps(y3r, w3r), _mm256_mul_ps(y3i, w3i));
+            const __m256 u3i =
+                _mm256_add_ps(_mm256_mul_ps(y3r, w3i), _mm256_mul_ps(y3i, w3r));
+            _mm256_store_ps(x0, _mm256_add_ps(y0r, u2r));
+            _mm256_store_ps(x0 + 8, _mm256_add_ps(y0i, u2i));
+            _mm256_store_ps(x2, _mm256_sub_ps(y0r, u2r));
+            _mm256_store_ps(x2 + 8, _mm256_sub_ps(y0i, u2i));
+            _mm256_store_ps(x1, _mm256_add_ps(y1r, u3r));
+            _mm256_store_ps(x1 + 8, _mm256_add_ps(y1i, u3i));
+            _mm256_store_ps(x3, _mm256_sub_ps(y1r, u3r));
+            _mm256_store_ps(x3 + 8, _mm256_sub_ps(y1i, u3i));
+        }
+    }
+}
+
+/* The stages of eight transforms in lanes, their points in bit reversed order */
+static inline void volk_fft_batch_stages_avx(float* lanes,
+                                             unsigned int num_points,
+                                             unsigned int log2_points,
+                                             const lv_32fc_t* twiddles)
+{
+    unsigned int n, h = 1;
+    if (log2_points & 1) {
+        // the twiddle factor of the length 2 transforms is 1
+        for (n = 0; n < num_points; n += 2) {
+            float* x0 = lanes + 16 * n;
+            const __m256 ar = _mm256_load_ps(x0), ai = _mm256_load_ps(x0 + 8);
+            const __m256 br = _mm256_load_ps(x0 + 16), bi = _mm256_load_ps(x0 + 24);
+            _mm256_store_ps(x0, _mm256_add_ps(ar, br));
+            _mm256_store_ps(x0 + 8, _mm256_add_ps(ai, bi));
+            _mm256_store_ps(x0 + 16, _mm256_sub_ps(ar, br));
+            _mm256_store_ps(x0 + 24, _mm256_sub_ps(ai, bi));
+        }
+        h = 2;
+    }
+    for (; 4 * h <= num_points; h *= 4)
+        volk_fft_batch_radix4_pass_avx(lanes, num_points, h, twiddles);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_fft_batch_32fc_avx_lanes(lv_32fc_t* output,
+                                                      const lv_32fc_t* input,
+                                                      unsigned int num_transforms,
+                                                      unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) float lanes[16 * VOLK_FFT_BATCH_MAX_LANE_POINTS];
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, false);
+    const unsigned int log2_points = volk_fft_batch_log2(num_points);
+    unsigned int first = 0, n, k, l;
+    __m256 rows[8];
+
+    if (num_points >= 4 && num_points <= VOLK_FFT_BATCH_MAX_LANE_POINTS) {
+        for (; first + 8 <= num_transforms; first += 8) {
+            const float* in = (const float*)(input + (size_t)first * num_points);
+            float* out = (float*)(output + (size_t)first * num_points);
+            // four points of the eight transforms at a time: the transpose
+            // turns rows of four complex points into vectors of eight lanes
+            for (n = 0; n < num_points; n += 4) {
+                for (l = 0; l < 8; l++)
+                    rows[l] = _mm256_loadu_ps(in + 2 * (l * num_points + n));
+                _mm256_transpose8_ps(rows);
+                for (k = 0; k < 4; k++) {
+                    float* x = lanes + 16 * volk_fft_batch_reverse(n + k, log2_points);
+                    _mm256_store_ps(x, rows[2 * k]);
+                    _mm256_store_ps(x + 8, rows[2 * k + 1]);
+                }
+            }
+            volk_fft_batch_stages_avx(lanes, num_points, log2_points, twiddles);
+            for (n = 0; n < num_points; n += 4) {
+                for (k = 0; k < 8; k++)
+                    rows[k] = _mm256_load_ps(lanes + 16 * n + 8 * k);
+                _mm256_transpose8_ps(rows);
+                for (l = 0; l < 8; l++)
+                    _mm256_storeu_ps(out + 2 * (l * num_points + n), rows[l]);
+            }
+        }
+    }
+    VOLK_FFT_BATCH_EACH(volk_32fc_fft_32fc_avx, first);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_fft_batch_32fc_avx512f(lv_32fc_t* output,
+                                                    const lv_32fc_t* input,
+                                                    unsigned int num_transforms,
+                                                    unsigned int num_points)
+{
+    VOLK_FFT_BATCH_EACH(volk_32fc_fft_32fc_avx512f, 0);
+}
+
+/* volk_fft_batch_radix4_pass_avx on sixteen transforms, point n of lane l at
+ * lanes[32 n + l], its imaginary part at lanes[32 n + 16 + l]. */
+static inline void volk_fft_batch_radix4_pass_avx512f(float* lanes,
+                                                      unsigned int num_points,
+                                                      unsigned int h,
+                                                      const lv_32fc_t* twiddles)
+{
+    unsigned int block, j;
+    for (block = 0; block < num_points; block += 4 * h) {
+        for (j = 0; j < h; j++) {
+            float* x0 = lanes + 32 * (block + j);
+            float* x1 = x0 + 32 * h;
+            float* x2 = x1 + 32 * h;
+            float* x3 = x2 + 32 * h;
+            const __m512 w1r = _mm512_set1_ps(lv_creal(twiddles[h + j]));
+            const __m512 w1i = _mm512_set1_ps(lv_cimag(twiddles[h + j]));
+            const __m512 w2r = _mm512_set1_ps(lv_creal(twiddles[2 * h + j]));
+            const __m512 w2i = _mm512_set1_ps(lv_cimag(twiddles[2 * h + j]));
+            const __m512 w3r = _mm512_set1_ps(lv_creal(twiddles[3 * h + j]));
+            const __m512 w3i = _mm512_set1_ps(lv_cimag(twiddles[3 * h + j]));
+            const __m512 a0r = _mm512_load_ps(x0), a0i = _mm512_load_ps(x0 + 16);
+            const __m512 a1r = _mm512_load_ps(x1), a1i = _mm512_load_ps(x1 + 16);
+            const __m512 a2r = _mm512_load_ps(x2), a2i = _mm512_load_ps(x2 + 16);
+            const __m512 a3r = _mm512_load_ps(x3), a3i = _mm512_load_ps(x3 + 16);
+
+            const __m512 t1r = _mm512_fmsub_ps(a1r, w1r, _mm512_mul_ps(a1i, w1i));
+            const __m512 t1i = _mm512_fmadd_ps(a1r, w1i, _mm512_mul_ps(a1i, w1r));
+            const __m512 t3r = _mm512_fmsub_ps(a3r, w1r, _mm512_mul_ps(a3i, w1i));
+            const __m512 t3i = _mm512_fmadd_ps(a3r, w1i, _mm512_mul_ps(a3i, w1r));
+            const __m512 y0r = _mm512_add_ps(a0r, t1r), y0i = _mm512_add_ps(a0i, t1i);
+            const __m512 y1r = _mm512_sub_ps(a0r, t1r), y1i = _mm512_sub_ps(a0i, t1i);
+            const __m512 y2r = _mm512_add_ps(a2r, t3r), y2i = _mm512_add_ps(a2i, t3i);
+            const __m512 y3r = _mm512_sub_ps(a2r, t3r), y3i = _mm512_sub_ps(a2i, t3i);
+
+            const __m512 u2r = _mm512_fmsub_ps(y2r, w2r, _mm512_mul_ps(y2i, w2i));
+            const __m512 u2i = _mm512_fmadd_ps(y2r, w2i, _mm512_mul_ps(y2i, w2r));
+            const __m512 u3r = _mm512_fmsub_ps(y3r, w3r, _mm512_mul_ps(y3i, w3i));
+            const __m512 u3i = _mm512_fmadd_ps(y3r, w3i, _mm512_mul_ps(y3i, w3r));
+            _mm512_store_ps(x0, _mm512_add_ps(y0r, u2r));
+            _mm512_store_ps(x0 + 16, _mm512_add_ps(y0i, u2i));
+            _mm512_store_ps(x2, _mm512_sub_ps(y0r, u2r));
+            _mm512_store_ps(x2 + 16, _mm512_sub_ps(y0i, u2i));
+            _mm512_store_ps(x1, _mm512_add_ps(y1r, u3r));
+            _mm512_store_ps(x1 + 16, _mm512_add_ps(y1i, u3i));
+            _mm512_store_ps(x3, _mm512_sub_ps(y1r, u3r));
+            _mm512_store_ps(x3 + 16, _mm512_sub_ps(y1i, u3i));
+        }
+    }
+}
+
+/* The stages of sixteen transforms in lanes, their points in bit reversed order */
+static inline void volk_fft_batch_stages_avx512f(float* lanes,
+                                                 unsigned int num_points,
+                                                 unsigned int log2_points,
+                                                 const lv_32fc_t* twiddles)
+{
+    unsigned int n, h = 1;
+    if (log2_points & 1) {
+        // the twiddle factor of the length 2 transforms is 1
+        for (n = 0; n < num_points; n += 2) {
+            float* x0 = lanes + 32 * n;
+            const __m512 ar = _mm512_load_ps(x0), ai = _mm512_load_ps(x0 + 16);
+            const __m512 br = _mm512_load_ps(x0 + 32), bi = _mm512_load_ps(x0 + 48);
+            _mm512_store_ps(x0, _mm512_add_ps(ar, br));
+            _mm512_store_ps(x0 + 16, _mm512_add_ps(ai, bi));
+            _mm512_store_ps(x0 + 32, _mm512_sub_ps(ar, br));
+            _mm512_store_ps(x0 + 48, _mm512_sub_ps(ai, bi));
+        }
+        h = 2;
+    }
+    for (; 4 * h <= num_points; h *= 4)
+        volk_fft_batch_radix4_pass_avx512f(lanes, num_points, h, twiddles);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_fft_batch_32fc_avx512f_lanes(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          unsigned int num_transforms,
+                                                          unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) float lanes[32 * VOLK_FFT_BATCH_MAX_LANE_POINTS];
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, false);
+    const unsigned int log2_points = volk_fft_batch_log2(num_points);
+    unsigned int first = 0, n, k, l;
+    __m256 low[8], high[8];
+
+    if (num_points >= 4 && num_points <= VOLK_FFT_BATCH_MAX_LANE_POINTS) {
+        for (; first + 16 <= num_transforms; first += 16) {
+            const float* in = (const float*)(input + (size_t)first * num_points);
+            float* out = (float*)(output + (size_t)first * num_points);
+            // the 8x8 transposes of lanes 0-7 and 8-15 fill the halves of
+            // the vectors of four points
+            for (n = 0; n < num_points; n += 4) {
+                for (l = 0; l < 8; l++) {
+                    low[l] = _mm256_loadu_ps(in + 2 * (l * num_points + n));
+                    high[l] = _mm256_loadu_ps(in + 2 * ((l + 8) * num_points + n));
+                }
+                _mm256_transpose8_ps(low);
+                _mm256_transpose8_ps(high);
+                for (k = 0; k < 8; k++) {
+                    const unsigned int r = volk_fft_batch_reverse(n + k / 2, log2_points);
+                    const __m512d v = _mm512_insertf64x4(
+                        _mm512_castpd256_pd512(_mm256_castps_pd(low[k])),
+                        _mm256_castps_pd(high[k]),
+                        1);
+                    _mm512_store_ps(lanes + 32 * r + 16 * (k & 1), _mm512_castpd_ps(v));
+                }
+            }
+            volk_fft_batch_stages_avx512f(lanes, num_points, log2_points, twiddles);
+            for (n = 0; n < num_points; n += 4) {
+                for (k = 0; k < 8; k++) {
+                    const __m512 v = _mm512_load_ps(lanes + 32 * n + 16 * k);
+                    low[k] = _mm512_castps512_ps256(v);
+                    high[k] = _mm256_castpd_ps(
+                        _mm512_extractf64x4_pd(_mm512_castps_pd(v), 1));
+                }
+                _mm256_transpose8_ps(low);
+                _mm256_transpose8_ps(high);
+                for (l = 0; l < 8; l++) {
+                    _mm256_storeu_ps(out + 2 * (l * num_points + n), low[l]);
+                    _mm256_storeu_ps(out + 2 * ((l + 8) * num_points + n), high[l]);
+                }
+            }
+        }
+    }
+    VOLK_FFT_BATCH_EACH(volk_32fc_fft_32fc_avx512f, first);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_fft_batch_32fc_neon(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 unsigned int num_transforms,
+                                                 unsigned int num_points)
+{
+    VOLK_FFT_BATCH_EACH(volk_32fc_fft_32fc_neon, 0);
+}
+
+/* Transpose the 4x4 matrix of floats whose rows are the four vectors */
+static inline void volk_fft_batch_transpose4_neon(float32x4_t* rows)
+{
+    const float32x4x2_t t0 = vtrnq_f32(rows[0], rows[1]);
+    const float32x4x2_t t1 = vtrnq_f32(rows[2], rows[3]);
+    rows[0] = vcombine_f32(vget_low_f32(t0.val[0]), vget_low_f32(t1.val[0]));
+    rows[1] = vcombine_f32(vget_low_f32(t0.val[1]), vget_low_f32(t1.val[1]));
+    rows[2] = vcombine_f32(vget_high_f32(t0.val[0]), vget_high_f32(t1.val[0]));
+    rows[3] = vcombine_f32(vget_high_f32(t0.val[1]), vget_high_f32(t1.val[1]));
+}
+
+/* volk_fft_batch_radix4_pass_avx on four transforms, point n of lane l at
+ * lanes[8 n + l], its imaginary part at lanes[8 n + 4 + l]. */
+static inline void volk_fft_batch_radix4_pass_neon(float* lanes,
+                                                   unsigned int num_points,
+                                                   unsigned int h,
+                                                   const lv_32fc_t* twiddles)
+{
+    unsigned int block, j;
+    for (block = 0; block < num_points; block += 4 * h) {
+        for (j = 0; j < h; j++) {
+            float* x0 = lanes + 8 * (block + j);
+            float* x1 = x0 + 8 * h;
+            float* x2 = x1 + 8 * h;
+            float* x3 = x2 + 8 * h;
+            const float w1r = lv_creal(twiddles[h + j]), w1i = lv_cimag(twiddles[h + j]);
+            const float w2r = lv_creal(twiddles[2 * h + j]);
+            const float w2i = lv_cimag(twiddles[2 * h + j]);
+            const float w3r = lv_creal(twiddles[3 * h + j]);
+            const float w3i = lv_cimag(twiddles[3 * h + j]);
+            const float32x4_t a0r = vld1q_f32(x0), a0i = vld1q_f32(x0 + 4);
+            const float32x4_t a1r = vld1q_f32(x1), a1i = vld1q_f32(x1 + 4);
+            const float32x4_t a2r = vld1q_f32(x2), a2i = vld1q_f32(x2 + 4);
+            const float32x4_t a3r = vld1q_f32(x3), a3i = vld1q_f32(x3 + 4);
+
+            const float32x4_t t1r = vmlsq_n_f32(vmulq_n_f32(a1r, w1r), a1i, w1i);
+            const float32x4_t t1i = vmlaq_n_f32(vmulq_n_f32(a1r, w1i), a1i, w1r);
+            const float32x4_t t3r = vmlsq_n_f32(vmulq_n_f32(a3r, w1r), a3i, w1i);
+            const float32x4_t t3i = vmlaq_n_f32(vmulq_n_f32(a3r, w1i), a3i, w1r);
+            const float32x4_t y0r = vaddq_f32(a0r, t1r), y0i = vaddq_f32(a0i, t1i);
+            const float32x4_t y1r = vsubq_f32(a0r, t1r), y1i = vsubq_f32(a0i, t1i);
+            const float32x4_t y2r = vaddq_f32(a2r, t3r), y2i = vaddq_f32(a2i, t3i);
+            const float32x4_t y3r = vsubq_f32(a2r, t3r), y3i = vsubq_f32(a2i, t3i);
+
+            const float32x4_t u2r = vmlsq_n_f32(vmulq_n_f32(y2r, w2r), y2i, w2i);
+            const float32x4_t u2i = vmlaq_n_f32(vmulq_n_f32(y2r, w2i), y2i, w2r);
+            const float32x4_t u3r = vmlsq_n_f32(vmulq_n_f32(y3r, w3r), y3i, w3i);
+            const float32x4_t u3i = vmlaq_n_f32(vmulq_n_f32(y3r, w3i), y3i, w3r);
+            vst1q_f32(x0, vaddq_f32(y0r, u2r));
+            vst1q_f32(x0 + 4, vaddq_f32(y0i, u2i));
+            vst1q_f32(x2, vsubq_f32(y0r, u2r));
+            vst1q_f32(x2 + 4, vsubq_f32(y0i, u2i));
+            vst1q_f32(x1, vaddq_f32(y1r, u3r));
+            vst1q_f32(x1 + 4, vaddq_f32(y1i, u3i));
+            vst1q_f32(x3, vsubq_f32(y1r, u3r));
+            vst1q_f32(x3 + 4, vsubq_f32(y1i, u3i));
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_fft_batch_32fc_neon_lanes(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int num_transforms,
+                                                       unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(16) float lanes[8 * VOLK_FFT_BATCH_MAX_LANE_POINTS];
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, false);
+    const unsigned int log2_points = volk_fft_batch_log2(num_points);
+    unsigned int first = 0, n, k, l, h;
+    float32x4_t rows[4];
+
+    if (num_points >= 2 && num_points <= VOLK_FFT_BATCH_MAX_LANE_POINTS) {
+        for (; first + 4 <= num_transforms; first += 4) {
+            const float* in = (const float*)(input + (size_t)first * num_points);
+            float* out = (float*)(output + (size_t)first * num_points);
+            // two points of the four transforms at a time
+            for (n = 0; n < num_points; n += 2) {
+                for (l = 0; l < 4; l++)
+                    rows[l] = vld1q_f32(in + 2 * (l * num_points + n));
+                volk_fft_batch_transpose4_neon(rows);
+                for (k = 0; k < 2; k++) {
+                    float* x = lanes + 8 * volk_fft_batch_reverse(n + k, log2_points);
+                    vst1q_f32(x, rows[2 * k]);
+                    vst1q_f32(x + 4, rows[2 * k + 1]);
+                }
+            }
+            h = 1;
+            if (log2_points & 1) {
+                // the twiddle factor of the length 2 transforms is 1
+                for (n = 0; n < num_points; n += 2) {
+                    float* x0 = lanes + 8 * n;
+                    const float32x4_t ar = vld1q_f32(x0), ai = vld1q_f32(x0 + 4);
+                    const float32x4_t br = vld1q_f32(x0 + 8), bi = vld1q_f32(x0 + 12);
+                    vst1q_f32(x0, vaddq_f32(ar, br));
+                    vst1q_f32(x0 + 4, vaddq_f32(ai, bi));
+                    vst1q_f32(x0 + 8, vsubq_f32(ar, br));
+                    vst1q_f32(x0 + 12, vsubq_f32(ai, bi));
+                }
+                h = 2;
+            }
+            for (; 4 * h <= num_points; h *= 4)
+                volk_fft_batch_radix4_pass_neon(lanes, num_points, h, twiddles);
+            for (n = 0; n < num_points; n += 2) {
+                for (k = 0; k < 4; k++)
+                    rows[k] = vld1q_f32(lanes + 8 * n + 4 * k);
+                volk_fft_batch_transpose4_neon(rows);
+                for (l = 0; l < 4; l++)
+                    vst1q_f32(out + 2 * (l * num_points + n), rows[l]);
+            }
+        }
+    }
+    VOLK_FFT_BATCH_EACH(volk_32fc_fft_32fc_neon, first);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_fft_batch_32fc_H */
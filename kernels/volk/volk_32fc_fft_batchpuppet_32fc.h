@@ -0,0 +1,121 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32FC_FFT_BATCHPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_FFT_BATCHPUPPET_32FC_H
+
+#include <string.h>
+#include <volk/volk_32fc_fft_batch_32fc.h>
+
+/* Transforms the buffer as at least 16 transforms of the longest power of
+ * two length up to VOLK_FFT_BATCH_MAX_LANE_POINTS, so every set of lanes is
+ * filled; the length grows with num_points, so volk_profile --length-buckets
+ * ranks the buckets on lengths of their own. The outputs past the last
+ * transform are zero. */
+#define VOLK_32FC_FFT_BATCHPUPPET(impl)                                           \
+    unsigned int length = 1, num_transforms;                                     \
+    while (2 * length <= num_points / 16 &&                                      \
+           2 * length <= VOLK_FFT_BATCH_MAX_LANE_POINTS)                         \
+        length *= 2;                                                             \
+    num_transforms = num_points / length;                                        \
+    impl(output, input, num_transforms, length);                                 \
+    memset(output + num_transforms * length,                                     \
+           0,                                                                    \
+           (num_points - num_transforms * length) * sizeof(*output));
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_fft_batchpuppet_32fc_generic(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          unsigned int num_points)
+{
+    VOLK_32FC_FFT_BATCHPUPPET(volk_32fc_fft_batch_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+static inline void volk_32fc_fft_batchpuppet_32fc_sse3(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int num_points)
+{
+    VOLK_32FC_FFT_BATCHPUPPET(volk_32fc_fft_batch_32fc_sse3);
+}
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32fc_fft_batchpuppet_32fc_avx(lv_32fc_t* output,
+                                                      const lv_32fc_t* input,
+                                                      unsigned int num_points)
+{
+    VOLK_32FC_FFT_BATCHPUPPET(volk_32fc_fft_batch_32fc_avx);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32fc_fft_batchpuppet_32fc_avx_lanes(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            unsigned int num_points)
+{
+    VOLK_32FC_FFT_BATCHPUPPET(volk_32fc_fft_batch_32fc_avx_lanes);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32fc_fft_batchpuppet_32fc_avx512f(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          unsigned int num_points)
+{
+    VOLK_32FC_FFT_BATCHPUPPET(volk_32fc_fft_batch_32fc_avx512f);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+static inline void
+volk_32fc_fft_batchpuppet_32fc_avx512f_lanes(lv_32fc_t* output,
+                                             const lv_32fc_t* input,
+                                             unsigned int num_points)
+{
+    VOLK_32FC_FFT_BATCHPUPPET(volk_32fc_fft_batch_32fc_avx512f_lanes);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32fc_fft_batchpuppet_32fc_neon(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int num_points)
+{
+    VOLK_32FC_FFT_BATCHPUPPET(volk_32fc_fft_batch_32fc_neon);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32fc_fft_batchpuppet_32fc_neon_lanes(lv_32fc_t* output,
+                                                             const lv_32fc_t* input,
+                                                             unsigned int num_points)
+{
+    VOLK_32FC_FFT_BATCHPUPPET(volk_32fc_fft_batch_32fc_neon_lanes);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32FC_FFT_BATCHPUPPET_32FC_H */
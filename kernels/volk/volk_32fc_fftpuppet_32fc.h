@@ -0,0 +1,90 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32FC_FFTPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_FFTPUPPET_32FC_H
+
+#include <volk/volk_32fc_fft_32fc.h>
+
+/* Transforms the power of two blocks num_points splits into by its set
+ * bits, largest first, so one QA length covers every transform length
+ * up to it. */
+#define VOLK_32FC_FFTPUPPET(impl)                                             \
+    unsigned int offset = 0, block;                                          \
+    for (block = 1u << 31; block != 0; block >>= 1) {                        \
+        if (num_points & block) {                                            \
+            impl(output + offset, input + offset, block);                    \
+            offset += block;                                                 \
+        }                                                                    \
+    }
+
+#ifdef LV_HAVE_GENERIC
+static inline void
+volk_32fc_fftpuppet_32fc_generic(lv_32fc_t* output,
+                                 const lv_32fc_t* input,
+                                 unsigned int num_points)
+{
+    VOLK_32FC_FFTPUPPET(volk_32fc_fft_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+static inline void
+volk_32fc_fftpuppet_32fc_sse3(lv_32fc_t* output,
+                              const lv_32fc_t* input,
+                              unsigned int num_points)
+{
+    VOLK_32FC_FFTPUPPET(volk_32fc_fft_32fc_sse3);
+}
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_AVX
+static inline void
+volk_32fc_fftpuppet_32fc_avx(lv_32fc_t* output,
+                             const lv_32fc_t* input,
+                             unsigned int num_points)
+{
+    VOLK_32FC_FFTPUPPET(volk_32fc_fft_32fc_avx);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+static inline void
+volk_32fc_fftpuppet_32fc_avx512f(lv_32fc_t* output,
+                                 const lv_32fc_t* input,
+                                 unsigned int num_points)
+{
+    VOLK_32FC_FFTPUPPET(volk_32fc_fft_32fc_avx512f);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+static inline void
+volk_32fc_fftpuppet_32fc_neon(lv_32fc_t* output,
+                              const lv_32fc_t* input,
+                              unsigned int num_points)
+{
+    VOLK_32FC_FFTPUPPET(volk_32fc_fft_32fc_neon);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32FC_FFTPUPPET_32FC_H */
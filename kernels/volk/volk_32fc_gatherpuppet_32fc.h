@@ -0,0 +1,119 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_32u_gather_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_gatherpuppet_32fc_H
+#define INCLUDED_volk_32fc_gatherpuppet_32fc_H
+
+#include <volk/volk_32fc_32u_gather_32fc.h>
+
+/*
+ * Fills in the indices first to first + count - 1 of a permutation of
+ * num_points subcarriers, which moves blocks of 16 to the places a
+ * multiplicative map of their number gives and reverses every other one, so
+ * both runs and scattered indices occur. The points after the last whole
+ * block stay in place.
+ */
+static inline void volk_subcarrier_indices(uint32_t* indices,
+                                           unsigned int first,
+                                           unsigned int count,
+                                           unsigned int num_points)
+{
+    const unsigned int num_blocks = num_points / 16;
+    // a prime that does not divide num_blocks makes the map a permutation
+    const unsigned int step = num_blocks % 7919 ? 7919 : 7927;
+    unsigned int k, block, offset;
+
+    for (k = 0; k < count; k++) {
+        block = (first + k) / 16;
+        offset = (first + k) % 16;
+        if (block < num_blocks) {
+            indices[k] = (uint32_t)((block * (unsigned long long)step) % num_blocks * 16 +
+                                    (block & 1 ? 15 - offset : offset));
+        } else {
+            indices[k] = first + k;
+        }
+    }
+}
+
+static inline void volk_32fc_gather_puppet(void (*kernel)(lv_32fc_t*,
+                                                          const lv_32fc_t*,
+                                                          const uint32_t*,
+                                                          unsigned int),
+                                           lv_32fc_t* outputVector,
+                                           const lv_32fc_t* inputVector,
+                                           unsigned int num_points)
+{
+    uint32_t indices[256];
+    unsigned int number, count;
+
+    for (number = 0; number < num_points; number += count) {
+        count = num_points - number < 256 ? num_points - number : 256;
+        volk_subcarrier_indices(indices, number, count, num_points);
+        kernel(outputVector + number, inputVector, indices, count);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_gatherpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                       const lv_32fc_t* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_32fc_gather_puppet(
+        volk_32fc_32u_gather_32fc_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_gatherpuppet_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                      const lv_32fc_t* inputVector,
+                                                      unsigned int num_points)
+{
+    volk_32fc_gather_puppet(
+        volk_32fc_32u_gather_32fc_u_avx2, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_gatherpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                         const lv_32fc_t* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_32fc_gather_puppet(
+        volk_32fc_32u_gather_32fc_u_avx512f, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_gatherpuppet_32fc_H */
@@ -0,0 +1,178 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_ifft_32fc
+ *
+ * \b Overview
+ *
+ * Computes the unnormalised inverse discrete Fourier transform of a
+ * complex vector whose length is a power of two:
+ * output[k] = sum_n input[n] * exp(2 pi i n k / num_points).
+ * Like FFTW it does not divide by num_points, so an inverse of a forward
+ * transform returns the input times num_points.
+ *
+ * The algorithm and its twiddle factor tables are those of
+ * volk_32fc_fft_32fc, see there.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_ifft_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The complex vector to transform.
+ * \li num_points: The transform length, a power of two.
+ *
+ * \b Outputs
+ * \li output: The inverse transform of input, num_points times the time signal.
+ *
+ * \b Example
+ * Transform a spectrum back to the time domain and undo the scaling.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* spectrum = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* signal = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   volk_32fc_ifft_32fc(signal, spectrum, N);
+ *   volk_32fc_s32fc_multiply_32fc(signal, signal, lv_cmake(1.f / N, 0.f), N);
+ *
+ *   volk_free(spectrum);
+ *   volk_free(signal);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_ifft_32fc_u_H
+#define INCLUDED_volk_32fc_ifft_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_fft.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_ifft_32fc_generic(lv_32fc_t* output,
+                                               const lv_32fc_t* input,
+                                               unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, true);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4)
+        volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32fc_ifft_32fc_sse3(lv_32fc_t* output,
+                                            const lv_32fc_t* input,
+                                            unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, true);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4) {
+        if (h % 2 == 0)
+            _mm_fft_radix4_pass_sse3(
+                (float*)output, num_points, h, (const float*)twiddles);
+        else
+            volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+    }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_ifft_32fc_avx(lv_32fc_t* output,
+                                           const lv_32fc_t* input,
+                                           unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, true);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4) {
+        if (h % 4 == 0)
+            _mm256_fft_radix4_pass_avx(
+                (float*)output, num_points, h, (const float*)twiddles);
+        else
+            volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_ifft_32fc_avx512f(lv_32fc_t* output,
+                                               const lv_32fc_t* input,
+                                               unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, true);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4) {
+        if (h % 8 == 0)
+            _mm512_fft_radix4_pass_avx512f(
+                (float*)output, num_points, h, (const float*)twiddles);
+        else
+            volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_ifft_32fc_neon(lv_32fc_t* output,
+                                            const lv_32fc_t* input,
+                                            unsigned int num_points)
+{
+    const lv_32fc_t* twiddles = volk_fft_get_twiddles(num_points, true);
+    unsigned int h = volk_fft_first_stages(output, input, num_points);
+
+    for (; 4 * h <= num_points; h *= 4) {
+        if (h % 4 == 0)
+            _vfft_radix4_passq_f32((float*)output, num_points, h, (const float*)twiddles);
+        else
+            volk_fft_radix4_pass_generic(output, num_points, h, twiddles);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_ifft_32fc_u_H */
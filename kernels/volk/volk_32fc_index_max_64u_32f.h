@@ -0,0 +1,216 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_index_max_64u_32f
+ *
+ * \b Overview
+ *
+ * Returns the index of the first point of maximum magnitude of the complex
+ * input vector and its magnitude squared, with a 64 bit index and count for
+ * buffers of more than 2^32 points.
+ *
+ * The SIMD versions keep the maximum and its index in each lane, the indices
+ * relative to chunks of 2^24 points which their float lanes hold exactly.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_index_max_64u_32f(uint64_t* target, float* value, const lv_32fc_t* src0,
+ * uint64_t num_points) \endcode
+ *
+ * \b Inputs
+ * \li src0: The input vector.
+ * \li num_points: The number of points; with none the outputs are left unchanged.
+ *
+ * \b Outputs
+ * \li target: The index of the maximum.
+ * \li value: The maximum magnitude squared.
+ *
+ * \b Example
+ * Find the strongest bin of a spectrum.
+ * \code
+ *   int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* bins = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   uint64_t index;
+ *   float power;
+ *
+ *   // compute the FFT into bins, then
+ *   volk_32fc_index_max_64u_32f(&index, &power, bins, N);
+ *
+ *   printf("bin %" PRIu64 ", power %1.2f\n", index, power);
+ *
+ *   volk_free(bins);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_index_max_64u_32f_H
+#define INCLUDED_volk_32fc_index_max_64u_32f_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_32f_index_max_64u_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_index_max_64u_32f_generic(uint64_t* target,
+                                                       float* value,
+                                                       const lv_32fc_t* src0,
+                                                       uint64_t num_points)
+{
+    uint64_t index = 0, number;
+    float max, mag2;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    max = lv_creal(src0[0]) * lv_creal(src0[0]) + lv_cimag(src0[0]) * lv_cimag(src0[0]);
+    for (number = 1; number < num_points; number++) {
+        mag2 = lv_creal(src0[number]) * lv_creal(src0[number]) +
+               lv_cimag(src0[number]) * lv_cimag(src0[number]);
+        if (mag2 > max) {
+            index = number;
+            max = mag2;
+        }
+    }
+    *target = index;
+    *value = max;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_index_max_64u_32f_u_avx2(uint64_t* target,
+                                                      float* value,
+                                                      const lv_32fc_t* src0,
+                                                      uint64_t num_points)
+{
+    const uint64_t chunk = 1 << 24;
+    const __m256 indexIncrement = _mm256_set1_ps(8);
+    __m256 laneMax, laneIndex, indexes, values, compare;
+    __VOLK_ATTR_ALIGNED(32) float laneValues[8];
+    __VOLK_ATTR_ALIGNED(32) uint32_t laneIndexes[8];
+    uint64_t base, index = 0, number, points;
+    float max, mag2;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    max = lv_creal(src0[0]) * lv_creal(src0[0]) + lv_cimag(src0[0]) * lv_cimag(src0[0]);
+    for (base = 0; num_points - base >= 8; base += points) {
+        points = num_points - base < chunk ? (num_points - base) & ~(uint64_t)7 : chunk;
+        laneMax = _mm256_set1_ps(max);
+        laneIndex = _mm256_setzero_ps();
+        indexes = _mm256_set_ps(7, 6, 5, 4, 3, 2, 1, 0);
+        for (number = 0; number < points; number += 8) {
+            values = _mm256_magnitudesquared_ps_avx2(
+                _mm256_loadu_ps((const float*)(src0 + base + number)),
+                _mm256_loadu_ps((const float*)(src0 + base + number + 4)));
+            compare = _mm256_cmp_ps(values, laneMax, _CMP_GT_OS);
+            laneIndex = _mm256_blendv_ps(laneIndex, indexes, compare);
+            laneMax = _mm256_blendv_ps(laneMax, values, compare);
+            indexes = _mm256_add_ps(indexes, indexIncrement);
+        }
+        _mm256_store_ps(laneValues, laneMax);
+        _mm256_store_si256((__m256i*)laneIndexes, _mm256_cvttps_epi32(laneIndex));
+        volk_index_max_fold_lanes(&max, &index, laneValues, laneIndexes, 8, base);
+    }
+
+    for (number = base; number < num_points; number++) {
+        mag2 = lv_creal(src0[number]) * lv_creal(src0[number]) +
+               lv_cimag(src0[number]) * lv_cimag(src0[number]);
+        if (mag2 > max) {
+            index = number;
+            max = mag2;
+        }
+    }
+    *target = index;
+    *value = max;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_index_max_64u_32f_neon(uint64_t* target,
+                                                    float* value,
+                                                    const lv_32fc_t* src0,
+                                                    uint64_t num_points)
+{
+    const uint64_t chunk = 1 << 24;
+    const uint32_t firstIndexes[4] = { 0, 1, 2, 3 };
+    const uint32x4_t indexIncrement = vdupq_n_u32(4);
+    float32x4_t laneMax, values;
+    uint32x4_t laneIndex, indexes, compare;
+    float laneValues[4];
+    uint32_t laneIndexes[4];
+    uint64_t base, index = 0, number, points;
+    float max, mag2;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    max = lv_creal(src0[0]) * lv_creal(src0[0]) + lv_cimag(src0[0]) * lv_cimag(src0[0]);
+    for (base = 0; num_points - base >= 4; base += points) {
+        points = num_points - base < chunk ? (num_points - base) & ~(uint64_t)3 : chunk;
+        laneMax = vdupq_n_f32(max);
+        laneIndex = vdupq_n_u32(0);
+        indexes = vld1q_u32(firstIndexes);
+        for (number = 0; number < points; number += 4) {
+            values = _vmagnitudesquaredq_f32(
+                vld2q_f32((const float*)(src0 + base + number)));
+            compare = vcgtq_f32(values, laneMax);
+            laneIndex = vbslq_u32(compare, indexes, laneIndex);
+            laneMax = vbslq_f32(compare, values, laneMax);
+            indexes = vaddq_u32(indexes, indexIncrement);
+        }
+        vst1q_f32(laneValues, laneMax);
+        vst1q_u32(laneIndexes, laneIndex);
+        volk_index_max_fold_lanes(&max, &index, laneValues, laneIndexes, 4, base);
+    }
+
+    for (number = base; number < num_points; number++) {
+        mag2 = lv_creal(src0[number]) * lv_creal(src0[number]) +
+               lv_cimag(src0[number]) * lv_cimag(src0[number]);
+        if (mag2 > max) {
+            index = number;
+            max = mag2;
+        }
+    }
+    *target = index;
+    *value = max;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_index_max_64u_32f_H */
@@ -0,0 +1,129 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_index_min_32u
+ *
+ * \b Overview
+ *
+ * Returns Argmin_i mag(x[i]). Finds and returns the index which contains the
+ * first point of minimum magnitude in the given vector.
+ *
+ * This is volk_32fc_index_min_64u_32f without the magnitude, for vectors of
+ * less than 2^32 points.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_index_min_32u(uint32_t* target, const lv_32fc_t* src0, uint32_t
+ * num_points) \endcode
+ *
+ * \b Inputs
+ * \li src0: The complex input vector.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li target: The index of the point with minimum magnitude.
+ *
+ * \b Example
+ * Find the null of a beam pattern.
+ * \code
+ *   int N = 64;
+ *   uint32_t alignment = volk_get_alignment();
+ *   lv_32fc_t* in  = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   uint32_t* min = (uint32_t*)volk_malloc(sizeof(uint32_t), alignment);
+ *
+ *   for(uint32_t ii = 0; ii < N; ++ii){
+ *       float phase = 3.14159265f * ((float)ii / N - 0.5f);
+ *       // two elements half a wavelength apart
+ *       in[ii] = lv_cmake(1.f + cosf(phase), sinf(phase));
+ *   }
+ *
+ *   volk_32fc_index_min_32u(min, in, N);
+ *
+ *   printf("index of min value = %u\n",  *min);
+ *
+ *   volk_free(in);
+ *   volk_free(min);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_index_min_32u_H
+#define INCLUDED_volk_32fc_index_min_32u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_32fc_index_min_64u_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_index_min_32u_generic(uint32_t* target,
+                                                   const lv_32fc_t* src0,
+                                                   uint32_t num_points)
+{
+    uint64_t index;
+    float min;
+
+    if (num_points > 0) {
+        volk_32fc_index_min_64u_32f_generic(&index, &min, src0, num_points);
+        *target = (uint32_t)index;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_index_min_32u_u_avx2(uint32_t* target,
+                                                  const lv_32fc_t* src0,
+                                                  uint32_t num_points)
+{
+    uint64_t index;
+    float min;
+
+    if (num_points > 0) {
+        volk_32fc_index_min_64u_32f_u_avx2(&index, &min, src0, num_points);
+        *target = (uint32_t)index;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_index_min_32u_neon(uint32_t* target,
+                                                const lv_32fc_t* src0,
+                                                uint32_t num_points)
+{
+    uint64_t index;
+    float min;
+
+    if (num_points > 0) {
+        volk_32fc_index_min_64u_32f_neon(&index, &min, src0, num_points);
+        *target = (uint32_t)index;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_index_min_32u_H */
@@ -0,0 +1,97 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_index_min_64u_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_index_minpuppet_32f_H
+#define INCLUDED_volk_32fc_index_minpuppet_32f_H
+
+#include <volk/volk_32fc_index_min_64u_32f.h>
+
+/*
+ * Writes the index, as a float, and the value of the minimum to the first
+ * two outputs.
+ */
+static inline void
+volk_32fc_index_min_puppet(void (*kernel)(uint64_t*, float*, const lv_32fc_t*, uint64_t),
+                           float* outputVector,
+                           const lv_32fc_t* src0,
+                           unsigned int num_points)
+{
+    uint64_t index = 0;
+    float value = 0.f;
+
+    kernel(&index, &value, src0, num_points);
+    if (num_points > 1) {
+        outputVector[0] = (float)index;
+        outputVector[1] = value;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_index_minpuppet_32f_generic(float* outputVector,
+                                                         const lv_32fc_t* src0,
+                                                         unsigned int num_points)
+{
+    volk_32fc_index_min_puppet(volk_32fc_index_min_64u_32f_generic,
+                               outputVector,
+                               src0,
+                               num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_index_minpuppet_32f_u_avx2(float* outputVector,
+                                                        const lv_32fc_t* src0,
+                                                        unsigned int num_points)
+{
+    volk_32fc_index_min_puppet(volk_32fc_index_min_64u_32f_u_avx2,
+                               outputVector,
+                               src0,
+                               num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_index_minpuppet_32f_neon(float* outputVector,
+                                                      const lv_32fc_t* src0,
+                                                      unsigned int num_points)
+{
+    volk_32fc_index_min_puppet(volk_32fc_index_min_64u_32f_neon,
+                               outputVector,
+                               src0,
+                               num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_index_minpuppet_32f_H */
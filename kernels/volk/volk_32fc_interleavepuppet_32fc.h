@@ -0,0 +1,61 @@
+#ifndef INCLUDED_VOLK_32FC_INTERLEAVEPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_INTERLEAVEPUPPET_32FC_H
+
+#include <volk/volk_32fc_xn_interleave_32fc.h>
+
+/* Interleaves consecutive channel vectors in each quarter of the input
+ * with another channel count, 2, 4, 8 and an odd one. */
+#define VOLK_32FC_INTERLEAVEPUPPET(impl)                                      \
+    static const unsigned int nchannels[4] = { 2, 4, 8, 3 };                 \
+    const unsigned int quarter = num_points / 4;                             \
+    const lv_32fc_t* channels[8];                                            \
+    unsigned int q, ch, i;                                                   \
+    for (q = 0; q < 4; q++) {                                                \
+        const unsigned int length = (q == 3) ? num_points - 3 * quarter : quarter; \
+        const unsigned int samples = length / nchannels[q];                  \
+        for (ch = 0; ch < nchannels[q]; ch++) {                              \
+            channels[ch] = input + q * quarter + ch * samples;               \
+        }                                                                    \
+        impl(output + q * quarter, channels, nchannels[q], samples);         \
+        for (i = nchannels[q] * samples; i < length; i++) {                  \
+            output[q * quarter + i] = input[q * quarter + i];                \
+        }                                                                    \
+    }
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_interleavepuppet_32fc_generic(lv_32fc_t* output,
+                                                           const lv_32fc_t* input,
+                                                           unsigned int num_points)
+{
+    VOLK_32FC_INTERLEAVEPUPPET(volk_32fc_xn_interleave_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+static inline void volk_32fc_interleavepuppet_32fc_sse2(lv_32fc_t* output,
+                                                        const lv_32fc_t* input,
+                                                        unsigned int num_points)
+{
+    VOLK_32FC_INTERLEAVEPUPPET(volk_32fc_xn_interleave_32fc_sse2);
+}
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX
+static inline void volk_32fc_interleavepuppet_32fc_avx(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int num_points)
+{
+    VOLK_32FC_INTERLEAVEPUPPET(volk_32fc_xn_interleave_32fc_avx);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEONV8
+static inline void volk_32fc_interleavepuppet_32fc_neonv8(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          unsigned int num_points)
+{
+    VOLK_32FC_INTERLEAVEPUPPET(volk_32fc_xn_interleave_32fc_neonv8);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_VOLK_32FC_INTERLEAVEPUPPET_32FC_H */
@@ -374,6 +374,44 @@ static inline void volk_32fc_magnitude_32f_neon(float* magnitudeVector,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32fc_magnitude_32f_sve(float* magnitudeVector,
+                                               const lv_32fc_t* complexVector,
+                                               unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32_u32(number, num_points);
+        // deinterleaving load, real parts in the first vector
+        const svfloat32x2_t c = svld2_f32(pg, (const float*)(complexVector + number));
+        const svfloat32_t re = svget2_f32(c, 0);
+        const svfloat32_t im = svget2_f32(c, 1);
+        svst1_f32(pg, magnitudeVector + number, svsqrt_f32_x(pg, svmla_f32_x(pg, svmul_f32_x(pg, re, re), im, im)));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32fc_magnitude_32f_rvv(float* magnitudeVector,
+                                               const lv_32fc_t* complexVector,
+                                               unsigned int num_points)
+{
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, complexVector += vl, magnitudeVector += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        const vfloat32m4x2_t v = __riscv_vlseg2e32_v_f32m4x2((const float*)complexVector, vl);
+        const vfloat32m4_t re = __riscv_vget_v_f32m4x2_f32m4(v, 0);
+        const vfloat32m4_t im = __riscv_vget_v_f32m4x2_f32m4(v, 1);
+        const vfloat32m4_t mag2 =
+            __riscv_vfmacc_vv_f32m4(__riscv_vfmul_vv_f32m4(re, re, vl), im, im, vl);
+        __riscv_vse32_v_f32m4(magnitudeVector, __riscv_vfsqrt_v_f32m4(mag2, vl), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 
 #ifdef LV_HAVE_NEON
 /*!
@@ -0,0 +1,278 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32fc_magnitude_approx_32f
+ *
+ * \b Overview
+ *
+ * Approximates the magnitude of complex points without a square root, for
+ * envelope detection, squelch and AGC where a percent of error does not
+ * matter. With hi and lo the larger and smaller of |real| and |imag|:
+ *
+ * magnitudeVector[n] = max(a0 * hi + b0 * lo, a1 * hi + b1 * lo)
+ *
+ * the alpha max plus beta min approximation refined with a second line, whose
+ * coefficients make the relative error equioscillate. It is within 0.98% of
+ * the exact magnitude for all inputs, below it or above it; a single line
+ * would be off by up to 4%. Zero maps to zero and the approximation is
+ * monotonic along every ray, so thresholds keep their order.
+ *
+ * volk_32fc_magnitude_32f runs these implementations when the accuracy
+ * budget set by volk_set_precision() allows 1e-2 or more.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_magnitude_approx_32f(float* magnitudeVector, const lv_32fc_t*
+ * complexVector, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li complexVector: The complex input vector.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li magnitudeVector: The approximate magnitudes.
+ *
+ * \b Example
+ * Detect the envelope of a tone.
+ * \code
+ *   int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in  = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* envelope = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cosf(0.1f * ii), sinf(0.1f * ii));
+ *   }
+ *
+ *   volk_32fc_magnitude_approx_32f(envelope, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(envelope);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_magnitude_approx_32f_H
+#define INCLUDED_volk_32fc_magnitude_approx_32f_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+
+// the coefficients of the two lines, fitted for the least max relative error
+#define VOLK_MAGNITUDE_APPROX_A0 0.99028728f
+#define VOLK_MAGNITUDE_APPROX_B0 0.19710623f
+#define VOLK_MAGNITUDE_APPROX_A1 0.83925615f
+#define VOLK_MAGNITUDE_APPROX_B1 0.56139783f
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_magnitude_approx_32f_generic(float* magnitudeVector,
+                                                          const lv_32fc_t* complexVector,
+                                                          unsigned int num_points)
+{
+    float real, imag, hi, lo, line0, line1;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        real = fabsf(lv_creal(complexVector[number]));
+        imag = fabsf(lv_cimag(complexVector[number]));
+        hi = real > imag ? real : imag;
+        lo = real > imag ? imag : real;
+        line0 = VOLK_MAGNITUDE_APPROX_A0 * hi + VOLK_MAGNITUDE_APPROX_B0 * lo;
+        line1 = VOLK_MAGNITUDE_APPROX_A1 * hi + VOLK_MAGNITUDE_APPROX_B1 * lo;
+        magnitudeVector[number] = line0 > line1 ? line0 : line1;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_magnitude_approx_32f_u_sse(float* magnitudeVector,
+                                                        const lv_32fc_t* complexVector,
+                                                        unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* complexVectorPtr = (const float*)complexVector;
+    const __m128 signBit = _mm_set1_ps(-0.f);
+    const __m128 a0 = _mm_set1_ps(VOLK_MAGNITUDE_APPROX_A0);
+    const __m128 b0 = _mm_set1_ps(VOLK_MAGNITUDE_APPROX_B0);
+    const __m128 a1 = _mm_set1_ps(VOLK_MAGNITUDE_APPROX_A1);
+    const __m128 b1 = _mm_set1_ps(VOLK_MAGNITUDE_APPROX_B1);
+    unsigned int number;
+    __m128 cplxValue1, cplxValue2, real, imag, hi, lo;
+
+    for (number = 0; number < quarterPoints; number++) {
+        cplxValue1 = _mm_loadu_ps(complexVectorPtr);
+        cplxValue2 = _mm_loadu_ps(complexVectorPtr + 4);
+        real = _mm_andnot_ps(
+            signBit, _mm_shuffle_ps(cplxValue1, cplxValue2, _MM_SHUFFLE(2, 0, 2, 0)));
+        imag = _mm_andnot_ps(
+            signBit, _mm_shuffle_ps(cplxValue1, cplxValue2, _MM_SHUFFLE(3, 1, 3, 1)));
+        hi = _mm_max_ps(real, imag);
+        lo = _mm_min_ps(real, imag);
+        _mm_storeu_ps(magnitudeVector + 4 * number,
+                      _mm_max_ps(_mm_add_ps(_mm_mul_ps(a0, hi), _mm_mul_ps(b0, lo)),
+                                 _mm_add_ps(_mm_mul_ps(a1, hi), _mm_mul_ps(b1, lo))));
+        complexVectorPtr += 8;
+    }
+
+    volk_32fc_magnitude_approx_32f_generic(magnitudeVector + quarterPoints * 4,
+                                           complexVector + quarterPoints * 4,
+                                           num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_magnitude_approx_32f_u_avx(float* magnitudeVector,
+                                                        const lv_32fc_t* complexVector,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* complexVectorPtr = (const float*)complexVector;
+    const __m256 signBit = _mm256_set1_ps(-0.f);
+    const __m256 a0 = _mm256_set1_ps(VOLK_MAGNITUDE_APPROX_A0);
+    const __m256 b0 = _mm256_set1_ps(VOLK_MAGNITUDE_APPROX_B0);
+    const __m256 a1 = _mm256_set1_ps(VOLK_MAGNITUDE_APPROX_A1);
+    const __m256 b1 = _mm256_set1_ps(VOLK_MAGNITUDE_APPROX_B1);
+    unsigned int number;
+    __m256 cplxValue1, cplxValue2, complex1, complex2, real, imag, hi, lo;
+
+    for (number = 0; number < eighthPoints; number++) {
+        cplxValue1 = _mm256_loadu_ps(complexVectorPtr);
+        cplxValue2 = _mm256_loadu_ps(complexVectorPtr + 8);
+        // the points 0, 1, 4, 5 and 2, 3, 6, 7, which the shuffles put in order
+        complex1 = _mm256_permute2f128_ps(cplxValue1, cplxValue2, 0x20);
+        complex2 = _mm256_permute2f128_ps(cplxValue1, cplxValue2, 0x31);
+        real = _mm256_andnot_ps(
+            signBit, _mm256_shuffle_ps(complex1, complex2, _MM_SHUFFLE(2, 0, 2, 0)));
+        imag = _mm256_andnot_ps(
+            signBit, _mm256_shuffle_ps(complex1, complex2, _MM_SHUFFLE(3, 1, 3, 1)));
+        hi = _mm256_max_ps(real, imag);
+        lo = _mm256_min_ps(real, imag);
+        _mm256_storeu_ps(
+            magnitudeVector + 8 * number,
+            _mm256_max_ps(_mm256_add_ps(_mm256_mul_ps(a0, hi), _mm256_mul_ps(b0, lo)),
+                          _mm256_add_ps(_mm256_mul_ps(a1, hi), _mm256_mul_ps(b1, lo))));
+        complexVectorPtr += 16;
+    }
+
+    volk_32fc_magnitude_approx_32f_generic(magnitudeVector + eighthPoints * 8,
+                                           complexVector + eighthPoints * 8,
+                                           num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_magnitude_approx_32f_u_avx512f(float* magnitudeVector,
+                                         const lv_32fc_t* complexVector,
+                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* complexVectorPtr = (const float*)complexVector;
+    const __m512i realIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imagIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    const __m512i absMask = _mm512_set1_epi32(0x7fffffff);
+    const __m512 a0 = _mm512_set1_ps(VOLK_MAGNITUDE_APPROX_A0);
+    const __m512 b0 = _mm512_set1_ps(VOLK_MAGNITUDE_APPROX_B0);
+    const __m512 a1 = _mm512_set1_ps(VOLK_MAGNITUDE_APPROX_A1);
+    const __m512 b1 = _mm512_set1_ps(VOLK_MAGNITUDE_APPROX_B1);
+    unsigned int number;
+    __m512 cplxValue0, cplxValue1, real, imag, hi, lo;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        cplxValue0 = _mm512_loadu_ps(complexVectorPtr);
+        cplxValue1 = _mm512_loadu_ps(complexVectorPtr + 16);
+        real = _mm512_castsi512_ps(_mm512_and_si512(
+            _mm512_castps_si512(_mm512_permutex2var_ps(cplxValue0, realIdx, cplxValue1)),
+            absMask));
+        imag = _mm512_castsi512_ps(_mm512_and_si512(
+            _mm512_castps_si512(_mm512_permutex2var_ps(cplxValue0, imagIdx, cplxValue1)),
+            absMask));
+        hi = _mm512_max_ps(real, imag);
+        lo = _mm512_min_ps(real, imag);
+        _mm512_storeu_ps(
+            magnitudeVector + 16 * number,
+            _mm512_max_ps(_mm512_add_ps(_mm512_mul_ps(a0, hi), _mm512_mul_ps(b0, lo)),
+                          _mm512_add_ps(_mm512_mul_ps(a1, hi), _mm512_mul_ps(b1, lo))));
+        complexVectorPtr += 32;
+    }
+
+    volk_32fc_magnitude_approx_32f_generic(magnitudeVector + sixteenthPoints * 16,
+                                           complexVector + sixteenthPoints * 16,
+                                           num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_magnitude_approx_32f_neon(float* magnitudeVector,
+                                                       const lv_32fc_t* complexVector,
+                                                       unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* complexVectorPtr = (const float*)complexVector;
+    const float32x4_t a0 = vdupq_n_f32(VOLK_MAGNITUDE_APPROX_A0);
+    const float32x4_t b0 = vdupq_n_f32(VOLK_MAGNITUDE_APPROX_B0);
+    const float32x4_t a1 = vdupq_n_f32(VOLK_MAGNITUDE_APPROX_A1);
+    const float32x4_t b1 = vdupq_n_f32(VOLK_MAGNITUDE_APPROX_B1);
+    unsigned int number;
+    float32x4x2_t cplxValue;
+    float32x4_t real, imag, hi, lo;
+
+    for (number = 0; number < quarterPoints; number++) {
+        cplxValue = vld2q_f32(complexVectorPtr);
+        real = vabsq_f32(cplxValue.val[0]);
+        imag = vabsq_f32(cplxValue.val[1]);
+        hi = vmaxq_f32(real, imag);
+        lo = vminq_f32(real, imag);
+        vst1q_f32(magnitudeVector + 4 * number,
+                  vmaxq_f32(vmlaq_f32(vmulq_f32(a0, hi), b0, lo),
+                            vmlaq_f32(vmulq_f32(a1, hi), b1, lo)));
+        complexVectorPtr += 8;
+    }
+
+    volk_32fc_magnitude_approx_32f_generic(magnitudeVector + quarterPoints * 4,
+                                           complexVector + quarterPoints * 4,
+                                           num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_magnitude_approx_32f_H */
@@ -75,6 +75,41 @@
 #include <math.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_magnitude_squared_32f_u_avx512f(float* magnitudeVector,
+                                          const lv_32fc_t* complexVector,
+                                          unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* in = (const float*)complexVector;
+    float* out = magnitudeVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512 cplxValue0 = _mm512_loadu_ps(in);
+        const __m512 cplxValue1 = _mm512_loadu_ps(in + 16);
+        _mm512_storeu_ps(out, _mm512_magnitudesquared_ps(cplxValue0, cplxValue1));
+        in += 32;
+        out += 16;
+    }
+
+    // the last points with masked loads, two floats a point split over two registers
+    const unsigned int remaining = num_points & 15;
+    const unsigned int low = remaining < 8 ? remaining : 8;
+    const __mmask16 mask0 = _cvtu32_mask16((1u << (2 * low)) - 1);
+    const __mmask16 mask1 = _cvtu32_mask16((1u << (2 * (remaining - low))) - 1);
+    const __mmask16 mask = _cvtu32_mask16((1u << remaining) - 1);
+    const __m512 cplxValue0 = _mm512_maskz_loadu_ps(mask0, in);
+    const __m512 cplxValue1 = _mm512_maskz_loadu_ps(mask1, in + 16);
+    _mm512_mask_storeu_ps(out, mask, _mm512_magnitudesquared_ps(cplxValue0, cplxValue1));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 #include <volk/volk_avx_intrinsics.h>
@@ -203,6 +238,20 @@ static inline void volk_32fc_magnitude_squared_32f_generic(float* magnitudeVecto
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_OPENCL
+#include <volk/volk_opencl.h>
+
+static inline void volk_32fc_magnitude_squared_32f_opencl(float* magnitudeVector,
+                                                          const lv_32fc_t* complexVector,
+                                                          unsigned int num_points)
+{
+    if (!volk_opencl_32fc_magnitude_squared_32f(
+            magnitudeVector, complexVector, num_points))
+        volk_32fc_magnitude_squared_32f_generic(
+            magnitudeVector, complexVector, num_points);
+}
+#endif /* LV_HAVE_OPENCL */
+
 
 #endif /* INCLUDED_volk_32fc_magnitude_32f_u_H */
 #ifndef INCLUDED_volk_32fc_magnitude_squared_32f_a_H
@@ -212,6 +261,41 @@ static inline void volk_32fc_magnitude_squared_32f_generic(float* magnitudeVecto
 #include <math.h>
 #include <stdio.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_magnitude_squared_32f_a_avx512f(float* magnitudeVector,
+                                          const lv_32fc_t* complexVector,
+                                          unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float* in = (const float*)complexVector;
+    float* out = magnitudeVector;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        const __m512 cplxValue0 = _mm512_load_ps(in);
+        const __m512 cplxValue1 = _mm512_load_ps(in + 16);
+        _mm512_store_ps(out, _mm512_magnitudesquared_ps(cplxValue0, cplxValue1));
+        in += 32;
+        out += 16;
+    }
+
+    // the last points with masked loads, two floats a point split over two registers
+    const unsigned int remaining = num_points & 15;
+    const unsigned int low = remaining < 8 ? remaining : 8;
+    const __mmask16 mask0 = _cvtu32_mask16((1u << (2 * low)) - 1);
+    const __mmask16 mask1 = _cvtu32_mask16((1u << (2 * (remaining - low))) - 1);
+    const __mmask16 mask = _cvtu32_mask16((1u << remaining) - 1);
+    const __m512 cplxValue0 = _mm512_maskz_load_ps(mask0, in);
+    const __m512 cplxValue1 = _mm512_maskz_load_ps(mask1, in + 16);
+    _mm512_mask_store_ps(out, mask, _mm512_magnitudesquared_ps(cplxValue0, cplxValue1));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 #include <volk/volk_avx_intrinsics.h>
@@ -363,6 +447,44 @@ static inline void volk_32fc_magnitude_squared_32f_neon(float* magnitudeVector,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32fc_magnitude_squared_32f_sve(float* magnitudeVector,
+                                                       const lv_32fc_t* complexVector,
+                                                       unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32_u32(number, num_points);
+        // deinterleaving load, real parts in the first vector
+        const svfloat32x2_t c = svld2_f32(pg, (const float*)(complexVector + number));
+        const svfloat32_t re = svget2_f32(c, 0);
+        const svfloat32_t im = svget2_f32(c, 1);
+        svst1_f32(pg, magnitudeVector + number, svmla_f32_x(pg, svmul_f32_x(pg, re, re), im, im));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32fc_magnitude_squared_32f_rvv(float* magnitudeVector,
+                                                       const lv_32fc_t* complexVector,
+                                                       unsigned int num_points)
+{
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, complexVector += vl, magnitudeVector += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        const vfloat32m4x2_t v = __riscv_vlseg2e32_v_f32m4x2((const float*)complexVector, vl);
+        const vfloat32m4_t re = __riscv_vget_v_f32m4x2_f32m4(v, 0);
+        const vfloat32m4_t im = __riscv_vget_v_f32m4x2_f32m4(v, 1);
+        const vfloat32m4_t mag2 =
+            __riscv_vfmacc_vv_f32m4(__riscv_vfmul_vv_f32m4(re, re, vl), im, im, vl);
+        __riscv_vse32_v_f32m4(magnitudeVector, mag2, vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 
 #ifdef LV_HAVE_GENERIC
 
@@ -0,0 +1,321 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_normalize_32fc
+ *
+ * \b Overview
+ *
+ * Scales each complex value to unit magnitude, keeping its phase:
+ *
+ * c[i] = a[i] / |a[i]|
+ *
+ * The SIMD versions multiply by the reciprocal square root estimate of |a|^2,
+ * refined by Newton-Raphson steps, instead of taking a square root and dividing.
+ * Values whose |a|^2 is below FLT_MIN, zero among them, give zero; the magnitudes
+ * must stay below about 1.8e19 so that |a|^2 is finite.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_normalize_32fc(lv_32fc_t* cVector, const lv_32fc_t* aVector,
+ *                               unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The input vector.
+ * \li num_points: The number of complex values.
+ *
+ * \b Outputs
+ * \li cVector: The values of unit magnitude.
+ *
+ * \b Example
+ * Strip the amplitude of a signal for a phase detector.
+ * \code
+ *   volk_32fc_normalize_32fc(phasors, samples, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_normalize_32fc_H
+#define INCLUDED_volk_32fc_normalize_32fc_H
+
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_normalize_32fc_generic(lv_32fc_t* cVector,
+                                                    const lv_32fc_t* aVector,
+                                                    unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    float* cPtr = (float*)cVector;
+    float re, im, mag2, magInv;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        re = *aPtr++;
+        im = *aPtr++;
+        mag2 = re * re + im * im;
+        magInv = mag2 >= FLT_MIN ? 1.0f / sqrtf(mag2) : 0.0f;
+        *cPtr++ = re * magInv;
+        *cPtr++ = im * magInv;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_normalize_32fc_a_avx512f(lv_32fc_t* cVector,
+                                                      const lv_32fc_t* aVector,
+                                                      unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    float* cPtr = (float*)cVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512 threeHalves = _mm512_set1_ps(1.5f);
+    const __m512 minMag2 = _mm512_set1_ps(FLT_MIN);
+    unsigned int number;
+
+    __m512 aVal, sq, mag2, magInv;
+    __mmask16 valid;
+
+    for (number = 0; number < eighthPoints; number++) {
+        aVal = _mm512_load_ps(aPtr);
+
+        // |a|^2 in both halves of each complex value
+        sq = _mm512_mul_ps(aVal, aVal);
+        mag2 = _mm512_add_ps(sq, _mm512_permute_ps(sq, 0xb1));
+        valid = _mm512_cmp_ps_mask(mag2, minMag2, _CMP_GE_OQ);
+
+        // 1/sqrt(|a|^2) to 14 bits, then one Newton step: y (3/2 - |a|^2 y^2 / 2)
+        magInv = _mm512_rsqrt14_ps(mag2);
+        magInv = _mm512_mul_ps(
+            magInv,
+            _mm512_fnmadd_ps(
+                _mm512_mul_ps(half, mag2), _mm512_mul_ps(magInv, magInv), threeHalves));
+
+        _mm512_store_ps(cPtr, _mm512_maskz_mul_ps(valid, aVal, magInv));
+
+        aPtr += 16;
+        cPtr += 16;
+    }
+
+    volk_32fc_normalize_32fc_generic((lv_32fc_t*)cPtr,
+                                     (const lv_32fc_t*)aPtr,
+                                     num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_normalize_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                      const lv_32fc_t* aVector,
+                                                      unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    float* cPtr = (float*)cVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512 threeHalves = _mm512_set1_ps(1.5f);
+    const __m512 minMag2 = _mm512_set1_ps(FLT_MIN);
+    unsigned int number;
+
+    __m512 aVal, sq, mag2, magInv;
+    __mmask16 valid;
+
+    for (number = 0; number < eighthPoints; number++) {
+        aVal = _mm512_loadu_ps(aPtr);
+
+        // |a|^2 in both halves of each complex value
+        sq = _mm512_mul_ps(aVal, aVal);
+        mag2 = _mm512_add_ps(sq, _mm512_permute_ps(sq, 0xb1));
+        valid = _mm512_cmp_ps_mask(mag2, minMag2, _CMP_GE_OQ);
+
+        // 1/sqrt(|a|^2) to 14 bits, then one Newton step: y (3/2 - |a|^2 y^2 / 2)
+        magInv = _mm512_rsqrt14_ps(mag2);
+        magInv = _mm512_mul_ps(
+            magInv,
+            _mm512_fnmadd_ps(
+                _mm512_mul_ps(half, mag2), _mm512_mul_ps(magInv, magInv), threeHalves));
+
+        _mm512_storeu_ps(cPtr, _mm512_maskz_mul_ps(valid, aVal, magInv));
+
+        aPtr += 16;
+        cPtr += 16;
+    }
+
+    volk_32fc_normalize_32fc_generic((lv_32fc_t*)cPtr,
+                                     (const lv_32fc_t*)aPtr,
+                                     num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_normalize_32fc_a_avx(lv_32fc_t* cVector,
+                                                  const lv_32fc_t* aVector,
+                                                  unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    float* cPtr = (float*)cVector;
+    const unsigned int quarterPoints = num_points / 4;
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+    const __m256 minMag2 = _mm256_set1_ps(FLT_MIN);
+    unsigned int number;
+
+    __m256 aVal, sq, mag2, magInv, valid;
+
+    for (number = 0; number < quarterPoints; number++) {
+        aVal = _mm256_load_ps(aPtr);
+
+        // |a|^2 in both halves of each complex value
+        sq = _mm256_mul_ps(aVal, aVal);
+        mag2 = _mm256_add_ps(sq, _mm256_permute_ps(sq, 0xb1));
+        valid = _mm256_cmp_ps(mag2, minMag2, _CMP_GE_OQ);
+
+        // 1/sqrt(|a|^2) to 12 bits, then one Newton step: y (3/2 - |a|^2 y^2 / 2)
+        magInv = _mm256_rsqrt_ps(mag2);
+        magInv = _mm256_mul_ps(
+            magInv,
+            _mm256_sub_ps(threeHalves,
+                          _mm256_mul_ps(_mm256_mul_ps(half, mag2),
+                                        _mm256_mul_ps(magInv, magInv))));
+        magInv = _mm256_and_ps(magInv, valid);
+
+        _mm256_store_ps(cPtr, _mm256_mul_ps(aVal, magInv));
+
+        aPtr += 8;
+        cPtr += 8;
+    }
+
+    volk_32fc_normalize_32fc_generic((lv_32fc_t*)cPtr,
+                                     (const lv_32fc_t*)aPtr,
+                                     num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_normalize_32fc_u_avx(lv_32fc_t* cVector,
+                                                  const lv_32fc_t* aVector,
+                                                  unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    float* cPtr = (float*)cVector;
+    const unsigned int quarterPoints = num_points / 4;
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+    const __m256 minMag2 = _mm256_set1_ps(FLT_MIN);
+    unsigned int number;
+
+    __m256 aVal, sq, mag2, magInv, valid;
+
+    for (number = 0; number < quarterPoints; number++) {
+        aVal = _mm256_loadu_ps(aPtr);
+
+        // |a|^2 in both halves of each complex value
+        sq = _mm256_mul_ps(aVal, aVal);
+        mag2 = _mm256_add_ps(sq, _mm256_permute_ps(sq, 0xb1));
+        valid = _mm256_cmp_ps(mag2, minMag2, _CMP_GE_OQ);
+
+        // 1/sqrt(|a|^2) to 12 bits, then one Newton step: y (3/2 - |a|^2 y^2 / 2)
+        magInv = _mm256_rsqrt_ps(mag2);
+        magInv = _mm256_mul_ps(
+            magInv,
+            _mm256_sub_ps(threeHalves,
+                          _mm256_mul_ps(_mm256_mul_ps(half, mag2),
+                                        _mm256_mul_ps(magInv, magInv))));
+        magInv = _mm256_and_ps(magInv, valid);
+
+        _mm256_storeu_ps(cPtr, _mm256_mul_ps(aVal, magInv));
+
+        aPtr += 8;
+        cPtr += 8;
+    }
+
+    volk_32fc_normalize_32fc_generic((lv_32fc_t*)cPtr,
+                                     (const lv_32fc_t*)aPtr,
+                                     num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_normalize_32fc_neon(lv_32fc_t* cVector,
+                                                 const lv_32fc_t* aVector,
+                                                 unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    float* cPtr = (float*)cVector;
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t minMag2 = vdupq_n_f32(FLT_MIN);
+    unsigned int number;
+
+    float32x4x2_t aVal, cVal;
+    float32x4_t mag2, magInv;
+    uint32x4_t valid;
+
+    for (number = 0; number < quarterPoints; number++) {
+        aVal = vld2q_f32(aPtr);
+
+        mag2 = vmulq_f32(aVal.val[0], aVal.val[0]);
+        mag2 = vmlaq_f32(mag2, aVal.val[1], aVal.val[1]);
+        valid = vcgeq_f32(mag2, minMag2);
+
+        // 1/sqrt(|a|^2) to 8 bits, then two Newton steps
+        magInv = vrsqrteq_f32(mag2);
+        magInv = vmulq_f32(magInv, vrsqrtsq_f32(vmulq_f32(mag2, magInv), magInv));
+        magInv = vmulq_f32(magInv, vrsqrtsq_f32(vmulq_f32(mag2, magInv), magInv));
+        magInv = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(magInv), valid));
+
+        cVal.val[0] = vmulq_f32(aVal.val[0], magInv);
+        cVal.val[1] = vmulq_f32(aVal.val[1], magInv);
+        vst2q_f32(cPtr, cVal);
+
+        aPtr += 8;
+        cPtr += 8;
+    }
+
+    volk_32fc_normalize_32fc_generic((lv_32fc_t*)cPtr,
+                                     (const lv_32fc_t*)aPtr,
+                                     num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_normalize_32fc_H */
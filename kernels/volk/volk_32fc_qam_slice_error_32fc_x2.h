@@ -0,0 +1,283 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_qam_slice_error_32fc_x2
+ *
+ * \b Overview
+ *
+ * Decides square QAM symbols for a decision-directed equalizer: writes the
+ * constellation point closest to each symbol and the error, the point minus
+ * the symbol, which an LMS update multiplies into its taps.
+ *
+ * Each axis is decided on its own: the value is moved to the levels
+ * 0, 1, ..., 2^m - 1 of an axis of 2^m points, clamped to them and truncated
+ * to the closest one below, which is the closest odd coordinate in units of
+ * half the distance between points. The SIMD versions do this for the I and
+ * Q values alike, with no compare or branch.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_qam_slice_error_32fc_x2(lv_32fc_t* decisions, lv_32fc_t* errors,
+ * const lv_32fc_t* symbols, unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li symbols: The equalized symbols, the constellation normalized to unit energy.
+ * \li bits: The bits per symbol, 2, 4, 6 or 8 (any even number of up to 16).
+ * \li num_points: The number of symbols.
+ *
+ * \b Outputs
+ * \li decisions: The closest constellation points.
+ * \li errors: The decisions minus the symbols.
+ *
+ * \b Example
+ * The errors of a block of 16QAM symbols.
+ * \code
+ *   int N = 1200;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* symbols = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* decisions = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* errors = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   // equalize the received samples into symbols, then
+ *   volk_32fc_qam_slice_error_32fc_x2(decisions, errors, symbols, 4, N);
+ *
+ *   volk_free(symbols);
+ *   volk_free(decisions);
+ *   volk_free(errors);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_qam_slice_error_32fc_x2_H
+#define INCLUDED_volk_32fc_qam_slice_error_32fc_x2_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/*
+ * The factors from the normalized constellation to levels and back, the
+ * offset of the level of the lowest point and that of the highest one
+ */
+static inline void volk_qam_slice_factors(
+    unsigned int bits, float* toLevels, float* fromLevels, float* offset, float* top)
+{
+    const unsigned int points = 1u << (bits / 2);
+    /* the average energy of the constellation with points at odd coordinates */
+    const float norm = 2.f * (float)((1u << bits) - 1) / 3.f;
+
+    *toLevels = 0.5f * sqrtf(norm);
+    *fromLevels = 2.f / sqrtf(norm);
+    *offset = 0.5f * (float)points;
+    *top = (float)(points - 1);
+}
+
+/* The closest point on one axis */
+static inline float volk_qam_slice_axis(
+    float value, float toLevels, float fromLevels, float offset, float top)
+{
+    float level = value * toLevels + offset;
+
+    level = level < top ? level : top;
+    level = level > 0.f ? level : 0.f;
+    return ((float)(int)level - (offset - 0.5f)) * fromLevels;
+}
+
+static inline void volk_qam_slice_point(lv_32fc_t* decision,
+                                        lv_32fc_t* error,
+                                        lv_32fc_t symbol,
+                                        float toLevels,
+                                        float fromLevels,
+                                        float offset,
+                                        float top)
+{
+    const float i =
+        volk_qam_slice_axis(lv_creal(symbol), toLevels, fromLevels, offset, top);
+    const float q =
+        volk_qam_slice_axis(lv_cimag(symbol), toLevels, fromLevels, offset, top);
+
+    *decision = lv_cmake(i, q);
+    *error = lv_cmake(i - lv_creal(symbol), q - lv_cimag(symbol));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_qam_slice_error_32fc_x2_generic(lv_32fc_t* decisions,
+                                                             lv_32fc_t* errors,
+                                                             const lv_32fc_t* symbols,
+                                                             unsigned int bits,
+                                                             unsigned int num_points)
+{
+    float toLevels, fromLevels, offset, top;
+    unsigned int number;
+
+    volk_qam_slice_factors(bits, &toLevels, &fromLevels, &offset, &top);
+    for (number = 0; number < num_points; number++) {
+        volk_qam_slice_point(decisions + number,
+                             errors + number,
+                             symbols[number],
+                             toLevels,
+                             fromLevels,
+                             offset,
+                             top);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32fc_qam_slice_error_32fc_x2_u_sse2(lv_32fc_t* decisions,
+                                                            lv_32fc_t* errors,
+                                                            const lv_32fc_t* symbols,
+                                                            unsigned int bits,
+                                                            unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    __m128 toLevelsVec, fromLevelsVec, offsets, centers, tops, values, levels, points;
+    float toLevels, fromLevels, offset, top;
+    unsigned int number;
+
+    volk_qam_slice_factors(bits, &toLevels, &fromLevels, &offset, &top);
+    toLevelsVec = _mm_set1_ps(toLevels);
+    fromLevelsVec = _mm_set1_ps(fromLevels);
+    offsets = _mm_set1_ps(offset);
+    centers = _mm_set1_ps(offset - 0.5f);
+    tops = _mm_set1_ps(top);
+
+    for (number = 0; number < halfPoints; number++) {
+        values = _mm_loadu_ps((const float*)(symbols + 2 * number));
+        levels = _mm_add_ps(_mm_mul_ps(values, toLevelsVec), offsets);
+        levels = _mm_max_ps(_mm_min_ps(levels, tops), _mm_setzero_ps());
+        levels = _mm_cvtepi32_ps(_mm_cvttps_epi32(levels));
+        points = _mm_mul_ps(_mm_sub_ps(levels, centers), fromLevelsVec);
+        _mm_storeu_ps((float*)(decisions + 2 * number), points);
+        _mm_storeu_ps((float*)(errors + 2 * number), _mm_sub_ps(points, values));
+    }
+
+    for (number = halfPoints * 2; number < num_points; number++) {
+        volk_qam_slice_point(decisions + number,
+                             errors + number,
+                             symbols[number],
+                             toLevels,
+                             fromLevels,
+                             offset,
+                             top);
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_qam_slice_error_32fc_x2_u_avx(lv_32fc_t* decisions,
+                                                           lv_32fc_t* errors,
+                                                           const lv_32fc_t* symbols,
+                                                           unsigned int bits,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __m256 toLevelsVec, fromLevelsVec, offsets, centers, tops, values, levels, points;
+    float toLevels, fromLevels, offset, top;
+    unsigned int number;
+
+    volk_qam_slice_factors(bits, &toLevels, &fromLevels, &offset, &top);
+    toLevelsVec = _mm256_set1_ps(toLevels);
+    fromLevelsVec = _mm256_set1_ps(fromLevels);
+    offsets = _mm256_set1_ps(offset);
+    centers = _mm256_set1_ps(offset - 0.5f);
+    tops = _mm256_set1_ps(top);
+
+    for (number = 0; number < quarterPoints; number++) {
+        values = _mm256_loadu_ps((const float*)(symbols + 4 * number));
+        levels = _mm256_add_ps(_mm256_mul_ps(values, toLevelsVec), offsets);
+        levels = _mm256_max_ps(_mm256_min_ps(levels, tops), _mm256_setzero_ps());
+        levels = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(levels));
+        points = _mm256_mul_ps(_mm256_sub_ps(levels, centers), fromLevelsVec);
+        _mm256_storeu_ps((float*)(decisions + 4 * number), points);
+        _mm256_storeu_ps((float*)(errors + 4 * number), _mm256_sub_ps(points, values));
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        volk_qam_slice_point(decisions + number,
+                             errors + number,
+                             symbols[number],
+                             toLevels,
+                             fromLevels,
+                             offset,
+                             top);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_qam_slice_error_32fc_x2_neon(lv_32fc_t* decisions,
+                                                          lv_32fc_t* errors,
+                                                          const lv_32fc_t* symbols,
+                                                          unsigned int bits,
+                                                          unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    float32x4_t toLevelsVec, fromLevelsVec, offsets, centers, tops;
+    float32x4_t values, levels, points;
+    float toLevels, fromLevels, offset, top;
+    unsigned int number;
+
+    volk_qam_slice_factors(bits, &toLevels, &fromLevels, &offset, &top);
+    toLevelsVec = vdupq_n_f32(toLevels);
+    fromLevelsVec = vdupq_n_f32(fromLevels);
+    offsets = vdupq_n_f32(offset);
+    centers = vdupq_n_f32(offset - 0.5f);
+    tops = vdupq_n_f32(top);
+
+    for (number = 0; number < halfPoints; number++) {
+        values = vld1q_f32((const float*)(symbols + 2 * number));
+        levels = vaddq_f32(vmulq_f32(values, toLevelsVec), offsets);
+        levels = vmaxq_f32(vminq_f32(levels, tops), vdupq_n_f32(0.f));
+        levels = vcvtq_f32_s32(vcvtq_s32_f32(levels));
+        points = vmulq_f32(vsubq_f32(levels, centers), fromLevelsVec);
+        vst1q_f32((float*)(decisions + 2 * number), points);
+        vst1q_f32((float*)(errors + 2 * number), vsubq_f32(points, values));
+    }
+
+    for (number = halfPoints * 2; number < num_points; number++) {
+        volk_qam_slice_point(decisions + number,
+                             errors + number,
+                             symbols[number],
+                             toLevels,
+                             fromLevels,
+                             offset,
+                             top);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_qam_slice_error_32fc_x2_H */
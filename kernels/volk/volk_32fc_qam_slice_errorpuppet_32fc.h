@@ -0,0 +1,117 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_qam_slice_error_32fc_x2.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_qam_slice_errorpuppet_32fc_H
+#define INCLUDED_volk_32fc_qam_slice_errorpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_32fc_qam_slice_error_32fc_x2.h>
+
+/*
+ * Slices four runs of num_points / 8 symbols, as QPSK, 16QAM, 64QAM and
+ * 256QAM, with the decisions in the first half of the output and the errors
+ * in the second, leaving the remaining outputs zeroed.
+ */
+static inline void volk_32fc_qam_slice_error_puppet_32fc(
+    void (*kernel)(lv_32fc_t*, lv_32fc_t*, const lv_32fc_t*, unsigned int, unsigned int),
+    lv_32fc_t* outputVector,
+    const lv_32fc_t* symbols,
+    unsigned int num_points)
+{
+    const unsigned int run = num_points / 8;
+    lv_32fc_t* errors = outputVector + num_points / 2;
+    unsigned int bits;
+
+    memset(outputVector, 0, sizeof(lv_32fc_t) * num_points);
+    for (bits = 2; bits <= 8; bits += 2) {
+        kernel(outputVector, errors, symbols, bits, run);
+        outputVector += run;
+        errors += run;
+        symbols += run;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_qam_slice_errorpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                                const lv_32fc_t* symbols,
+                                                                unsigned int num_points)
+{
+    volk_32fc_qam_slice_error_puppet_32fc(volk_32fc_qam_slice_error_32fc_x2_generic,
+                                          outputVector,
+                                          symbols,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_32fc_qam_slice_errorpuppet_32fc_u_sse2(lv_32fc_t* outputVector,
+                                                               const lv_32fc_t* symbols,
+                                                               unsigned int num_points)
+{
+    volk_32fc_qam_slice_error_puppet_32fc(volk_32fc_qam_slice_error_32fc_x2_u_sse2,
+                                          outputVector,
+                                          symbols,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_qam_slice_errorpuppet_32fc_u_avx(lv_32fc_t* outputVector,
+                                                              const lv_32fc_t* symbols,
+                                                              unsigned int num_points)
+{
+    volk_32fc_qam_slice_error_puppet_32fc(volk_32fc_qam_slice_error_32fc_x2_u_avx,
+                                          outputVector,
+                                          symbols,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_qam_slice_errorpuppet_32fc_neon(lv_32fc_t* outputVector,
+                                                             const lv_32fc_t* symbols,
+                                                             unsigned int num_points)
+{
+    volk_32fc_qam_slice_error_puppet_32fc(volk_32fc_qam_slice_error_32fc_x2_neon,
+                                          outputVector,
+                                          symbols,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_qam_slice_errorpuppet_32fc_H */
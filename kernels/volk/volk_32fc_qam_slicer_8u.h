@@ -0,0 +1,269 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_qam_slicer_8u
+ *
+ * \b Overview
+ *
+ * Hard decides Gray-mapped square QAM symbols: writes the index of the
+ * constellation point each symbol falls closest to, its bits in the order of
+ * volk_32fc_s32f_qam_llr_32f with the first bit the most significant. The
+ * bits are the signs of the ratios that kernel computes, a 1 for a negative
+ * ratio.
+ *
+ * The SIMD versions split the I and Q values of a few symbols into vectors of
+ * their own and run both through the stages of the ratios, shifting the sign
+ * of each into the indexes; there is no branch or table lookup.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_qam_slicer_8u(uint8_t* symbolIndexes, const lv_32fc_t* symbols,
+ * unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li symbols: The equalized symbols, the constellation normalized to unit energy.
+ * \li bits: The bits per symbol, 2, 4, 6 or 8.
+ * \li num_points: The number of symbols.
+ *
+ * \b Outputs
+ * \li symbolIndexes: The indexes of the closest constellation points.
+ *
+ * \b Example
+ * Decide a block of 64QAM symbols.
+ * \code
+ *   int N = 1200;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* symbols = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   uint8_t* indexes = (uint8_t*)volk_malloc(N, alignment);
+ *
+ *   // equalize the resource elements into symbols, then
+ *   volk_32fc_qam_slicer_8u(indexes, symbols, 6, N);
+ *
+ *   volk_free(symbols);
+ *   volk_free(indexes);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_qam_slicer_8u_H
+#define INCLUDED_volk_32fc_qam_slicer_8u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <string.h>
+#include <volk/volk_32fc_s32f_qam_llr_32f.h>
+
+static inline uint8_t
+volk_qam_slice_symbol(lv_32fc_t symbol, float amplitude, unsigned int bits)
+{
+    float i = lv_creal(symbol) * amplitude, q = lv_cimag(symbol) * amplitude;
+    float level = (float)(1u << (bits / 2 - 1));
+    unsigned int index = (i < 0.f) << 1 | (q < 0.f), bit;
+
+    for (bit = 2; bit < bits; bit += 2) {
+        i = level - fabsf(i);
+        q = level - fabsf(q);
+        index = index << 2 | (i < 0.f) << 1 | (q < 0.f);
+        level *= 0.5f;
+    }
+    return (uint8_t)index;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_qam_slicer_8u_generic(uint8_t* symbolIndexes,
+                                                   const lv_32fc_t* symbols,
+                                                   unsigned int bits,
+                                                   unsigned int num_points)
+{
+    float amplitude, gain;
+    unsigned int number;
+
+    volk_qam_llr_factors(bits, 1.f, &amplitude, &gain);
+    for (number = 0; number < num_points; number++) {
+        symbolIndexes[number] = volk_qam_slice_symbol(symbols[number], amplitude, bits);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32fc_qam_slicer_8u_u_sse2(uint8_t* symbolIndexes,
+                                                  const lv_32fc_t* symbols,
+                                                  unsigned int bits,
+                                                  unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128 signMask = _mm_set1_ps(-0.f), zero = _mm_setzero_ps();
+    __m128 amplitudes, a, b, i, q, levels;
+    __m128i indexI, indexQ, indexes;
+    float amplitude, gain, level;
+    unsigned int number, bit;
+
+    volk_qam_llr_factors(bits, 1.f, &amplitude, &gain);
+    amplitudes = _mm_set1_ps(amplitude);
+
+    for (number = 0; number < quarterPoints; number++) {
+        a = _mm_loadu_ps((const float*)(symbols + 4 * number));
+        b = _mm_loadu_ps((const float*)(symbols + 4 * number + 2));
+        i = _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), amplitudes);
+        q = _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)), amplitudes);
+        indexI = _mm_srli_epi32(_mm_castps_si128(_mm_cmplt_ps(i, zero)), 31);
+        indexQ = _mm_srli_epi32(_mm_castps_si128(_mm_cmplt_ps(q, zero)), 31);
+        level = (float)(1u << (bits / 2 - 1));
+        for (bit = 2; bit < bits; bit += 2) {
+            levels = _mm_set1_ps(level);
+            i = _mm_sub_ps(levels, _mm_andnot_ps(signMask, i));
+            q = _mm_sub_ps(levels, _mm_andnot_ps(signMask, q));
+            indexI = _mm_or_si128(
+                _mm_slli_epi32(indexI, 2),
+                _mm_srli_epi32(_mm_castps_si128(_mm_cmplt_ps(i, zero)), 31));
+            indexQ = _mm_or_si128(
+                _mm_slli_epi32(indexQ, 2),
+                _mm_srli_epi32(_mm_castps_si128(_mm_cmplt_ps(q, zero)), 31));
+            level *= 0.5f;
+        }
+        indexes = _mm_or_si128(_mm_slli_epi32(indexI, 1), indexQ);
+        indexes = _mm_packs_epi32(indexes, indexes);
+        indexes = _mm_packus_epi16(indexes, indexes);
+        memcpy(symbolIndexes + 4 * number, &indexes, 4);
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        symbolIndexes[number] = volk_qam_slice_symbol(symbols[number], amplitude, bits);
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_qam_slicer_8u_u_avx2(uint8_t* symbolIndexes,
+                                                  const lv_32fc_t* symbols,
+                                                  unsigned int bits,
+                                                  unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 signMask = _mm256_set1_ps(-0.f), zero = _mm256_setzero_ps();
+    __m256 amplitudes, a, b, i, q, levels;
+    __m256i indexI, indexQ, indexes;
+    __m128i words;
+    float amplitude, gain, level;
+    unsigned int number, bit;
+
+    volk_qam_llr_factors(bits, 1.f, &amplitude, &gain);
+    amplitudes = _mm256_set1_ps(amplitude);
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = _mm256_loadu_ps((const float*)(symbols + 8 * number));
+        b = _mm256_loadu_ps((const float*)(symbols + 8 * number + 4));
+        /* symbols 0, 1, 4, 5 | 2, 3, 6, 7 */
+        i = _mm256_mul_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), amplitudes);
+        q = _mm256_mul_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)), amplitudes);
+        indexI = _mm256_srli_epi32(
+            _mm256_castps_si256(_mm256_cmp_ps(i, zero, _CMP_LT_OQ)), 31);
+        indexQ = _mm256_srli_epi32(
+            _mm256_castps_si256(_mm256_cmp_ps(q, zero, _CMP_LT_OQ)), 31);
+        level = (float)(1u << (bits / 2 - 1));
+        for (bit = 2; bit < bits; bit += 2) {
+            levels = _mm256_set1_ps(level);
+            i = _mm256_sub_ps(levels, _mm256_andnot_ps(signMask, i));
+            q = _mm256_sub_ps(levels, _mm256_andnot_ps(signMask, q));
+            indexI = _mm256_or_si256(
+                _mm256_slli_epi32(indexI, 2),
+                _mm256_srli_epi32(
+                    _mm256_castps_si256(_mm256_cmp_ps(i, zero, _CMP_LT_OQ)), 31));
+            indexQ = _mm256_or_si256(
+                _mm256_slli_epi32(indexQ, 2),
+                _mm256_srli_epi32(
+                    _mm256_castps_si256(_mm256_cmp_ps(q, zero, _CMP_LT_OQ)), 31));
+            level *= 0.5f;
+        }
+        indexes = _mm256_or_si256(_mm256_slli_epi32(indexI, 1), indexQ);
+        indexes = _mm256_permute4x64_epi64(indexes, _MM_SHUFFLE(3, 1, 2, 0));
+        words = _mm_packs_epi32(_mm256_castsi256_si128(indexes),
+                                _mm256_extracti128_si256(indexes, 1));
+        _mm_storel_epi64((__m128i*)(symbolIndexes + 8 * number),
+                         _mm_packus_epi16(words, words));
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        symbolIndexes[number] = volk_qam_slice_symbol(symbols[number], amplitude, bits);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_qam_slicer_8u_neon(uint8_t* symbolIndexes,
+                                                const lv_32fc_t* symbols,
+                                                unsigned int bits,
+                                                unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    float32x4x2_t values;
+    float32x4_t i, q, levels;
+    uint32x4_t indexI, indexQ;
+    uint16x4_t words;
+    float amplitude, gain, level;
+    unsigned int number, bit;
+
+    volk_qam_llr_factors(bits, 1.f, &amplitude, &gain);
+
+    for (number = 0; number < quarterPoints; number++) {
+        values = vld2q_f32((const float*)(symbols + 4 * number));
+        i = vmulq_n_f32(values.val[0], amplitude);
+        q = vmulq_n_f32(values.val[1], amplitude);
+        indexI = vshrq_n_u32(vcltq_f32(i, zero), 31);
+        indexQ = vshrq_n_u32(vcltq_f32(q, zero), 31);
+        level = (float)(1u << (bits / 2 - 1));
+        for (bit = 2; bit < bits; bit += 2) {
+            levels = vdupq_n_f32(level);
+            i = vsubq_f32(levels, vabsq_f32(i));
+            q = vsubq_f32(levels, vabsq_f32(q));
+            indexI = vsraq_n_u32(vshlq_n_u32(indexI, 2), vcltq_f32(i, zero), 31);
+            indexQ = vsraq_n_u32(vshlq_n_u32(indexQ, 2), vcltq_f32(q, zero), 31);
+            level *= 0.5f;
+        }
+        words = vmovn_u32(vorrq_u32(vshlq_n_u32(indexI, 1), indexQ));
+        vst1_lane_u32((uint32_t*)(symbolIndexes + 4 * number),
+                      vreinterpret_u32_u8(vmovn_u16(vcombine_u16(words, words))),
+                      0);
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        symbolIndexes[number] = volk_qam_slice_symbol(symbols[number], amplitude, bits);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_qam_slicer_8u_H */
@@ -0,0 +1,114 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_qam_slicer_8u.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_qam_slicerpuppet_8u_H
+#define INCLUDED_volk_32fc_qam_slicerpuppet_8u_H
+
+#include <string.h>
+#include <volk/volk_32fc_qam_slicer_8u.h>
+
+/*
+ * Slices four runs of num_points / 4 symbols, as QPSK, 16QAM, 64QAM and
+ * 256QAM, leaving the remaining outputs zeroed.
+ */
+static inline void volk_32fc_qam_slicer_puppet_8u(
+    void (*kernel)(uint8_t*, const lv_32fc_t*, unsigned int, unsigned int),
+    uint8_t* symbolIndexes,
+    const lv_32fc_t* symbols,
+    unsigned int num_points)
+{
+    const unsigned int run = num_points / 4;
+    unsigned int bits;
+
+    memset(symbolIndexes, 0, num_points);
+    for (bits = 2; bits <= 8; bits += 2) {
+        kernel(symbolIndexes, symbols, bits, run);
+        symbolIndexes += run;
+        symbols += run;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_qam_slicerpuppet_8u_generic(uint8_t* symbolIndexes,
+                                                         const lv_32fc_t* symbols,
+                                                         unsigned int num_points)
+{
+    volk_32fc_qam_slicer_puppet_8u(volk_32fc_qam_slicer_8u_generic,
+                                   symbolIndexes,
+                                   symbols,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_32fc_qam_slicerpuppet_8u_u_sse2(uint8_t* symbolIndexes,
+                                                        const lv_32fc_t* symbols,
+                                                        unsigned int num_points)
+{
+    volk_32fc_qam_slicer_puppet_8u(volk_32fc_qam_slicer_8u_u_sse2,
+                                   symbolIndexes,
+                                   symbols,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_qam_slicerpuppet_8u_u_avx2(uint8_t* symbolIndexes,
+                                                        const lv_32fc_t* symbols,
+                                                        unsigned int num_points)
+{
+    volk_32fc_qam_slicer_puppet_8u(volk_32fc_qam_slicer_8u_u_avx2,
+                                   symbolIndexes,
+                                   symbols,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_qam_slicerpuppet_8u_neon(uint8_t* symbolIndexes,
+                                                      const lv_32fc_t* symbols,
+                                                      unsigned int num_points)
+{
+    volk_32fc_qam_slicer_puppet_8u(volk_32fc_qam_slicer_8u_neon,
+                                   symbolIndexes,
+                                   symbols,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_qam_slicerpuppet_8u_H */
@@ -0,0 +1,120 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_qpsk_slicer_8u
+ *
+ * \b Overview
+ *
+ * Hard decides QPSK symbols into their two bit indexes, the sign of I in the
+ * upper bit and the sign of Q in the lower one, a 1 for a negative sign. This
+ * is volk_32fc_qam_slicer_8u with 2 bits per symbol.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_qpsk_slicer_8u(uint8_t* symbolIndexes, const lv_32fc_t* symbols,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li symbols: The equalized symbols.
+ * \li num_points: The number of symbols.
+ *
+ * \b Outputs
+ * \li symbolIndexes: The indexes of the closest constellation points, 0 to 3.
+ *
+ * \b Example
+ * \code
+ *   int N = 4;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* symbols = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   uint8_t* indexes = (uint8_t*)volk_malloc(N, alignment);
+ *
+ *   symbols[0] = lv_cmake(0.7f, 0.7f);
+ *   symbols[1] = lv_cmake(0.7f, -0.7f);
+ *   symbols[2] = lv_cmake(-0.7f, 0.7f);
+ *   symbols[3] = lv_cmake(-0.7f, -0.7f);
+ *
+ *   volk_32fc_qpsk_slicer_8u(indexes, symbols, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("symbol %u: %u\n", ii, indexes[ii]);
+ *   }
+ *
+ *   volk_free(symbols);
+ *   volk_free(indexes);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_qpsk_slicer_8u_H
+#define INCLUDED_volk_32fc_qpsk_slicer_8u_H
+
+#include <inttypes.h>
+#include <volk/volk_32fc_qam_slicer_8u.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_qpsk_slicer_8u_generic(uint8_t* symbolIndexes,
+                                                    const lv_32fc_t* symbols,
+                                                    unsigned int num_points)
+{
+    volk_32fc_qam_slicer_8u_generic(symbolIndexes, symbols, 2, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_32fc_qpsk_slicer_8u_u_sse2(uint8_t* symbolIndexes,
+                                                   const lv_32fc_t* symbols,
+                                                   unsigned int num_points)
+{
+    volk_32fc_qam_slicer_8u_u_sse2(symbolIndexes, symbols, 2, num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_qpsk_slicer_8u_u_avx2(uint8_t* symbolIndexes,
+                                                   const lv_32fc_t* symbols,
+                                                   unsigned int num_points)
+{
+    volk_32fc_qam_slicer_8u_u_avx2(symbolIndexes, symbols, 2, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_qpsk_slicer_8u_neon(uint8_t* symbolIndexes,
+                                                 const lv_32fc_t* symbols,
+                                                 unsigned int num_points)
+{
+    volk_32fc_qam_slicer_8u_neon(symbolIndexes, symbols, 2, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_qpsk_slicer_8u_H */
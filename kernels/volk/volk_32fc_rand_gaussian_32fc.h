@@ -0,0 +1,218 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_rand_gaussian_32fc
+ *
+ * \b Overview
+ *
+ * Fills a vector with circular complex Gaussian random numbers of unit power,
+ * so that the real and the imaginary parts each have a variance of 1/2.
+ *
+ * The numbers come from the generators of volk_32f_rand_uniform_32f by the
+ * Box-Muller transform: point n of a call takes the next two words u and v
+ * of generator n % 16 and is sqrt(-ln(u)) e^(j 2 pi v), with u in (0, 1] and
+ * v in [-1/2, 1/2). The SIMD versions evaluate the logarithm, sine and
+ * cosine by polynomials, within a few ulp of the generic version's libm.
+ *
+ * volk_32fc_s32f_x2_add_awgn_32fc adds these numbers, scaled, to a signal.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_rand_gaussian_32fc(lv_32fc_t* outputVector, uint32_t* state,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li state: VOLK_RAND_STATE_WORDS words set up by volk_rand_seed().
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The random numbers.
+ * \li state: The generators, to carry into the next buffer.
+ *
+ * \b Example
+ * Draw N complex noise samples.
+ * \code
+ *   uint32_t state[VOLK_RAND_STATE_WORDS];
+ *
+ *   volk_rand_seed(state, 1);
+ *   volk_32fc_rand_gaussian_32fc(noise, state, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_rand_gaussian_32fc_H
+#define INCLUDED_volk_32fc_rand_gaussian_32fc_H
+
+#include <math.h>
+#include <volk/volk_32f_rand_uniform_32f.h>
+#include <volk/volk_complex.h>
+
+/* 2 pi / 2^24, the angle of a step of the 24 bits of v */
+#define VOLK_RAND_ANGLE_STEP 3.74507028e-7f
+
+/* The point of the next two words of generator lane of the state. */
+static inline lv_32fc_t volk_rand_gaussian(uint32_t* state, unsigned int lane)
+{
+    const uint32_t u = volk_rand_next(state, lane);
+    const uint32_t v = volk_rand_next(state, lane);
+    // (0, 1], so that the logarithm is finite
+    const float radius =
+        sqrtf(-logf((float)(int32_t)((u >> 8) + 1) * (1.f / 16777216.f)));
+    const float angle = (float)((int32_t)(v >> 8) - 8388608) * VOLK_RAND_ANGLE_STEP;
+
+    return lv_cmake(radius * cosf(angle), radius * sinf(angle));
+}
+
+/* Draws points from generator 0 on. */
+static inline void volk_rand_gaussian_points(lv_32fc_t* outputVector,
+                                             uint32_t* state,
+                                             unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = volk_rand_gaussian(state, number % VOLK_RAND_LANES);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_rand_gaussian_32fc_generic(lv_32fc_t* outputVector,
+                                                        uint32_t* state,
+                                                        unsigned int num_points)
+{
+    volk_rand_gaussian_points(outputVector, state, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_rand_gaussian_32fc_u_avx2_fma(lv_32fc_t* outputVector,
+                                                           uint32_t* state,
+                                                           unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    float* out = (float*)outputVector;
+    unsigned int number, k, w;
+    __m256i s[2][4];
+    __m256 lo, hi;
+
+    // generators 0 to 7 in s[0], 8 to 15 in s[1]
+    for (k = 0; k < 2; k++) {
+        for (w = 0; w < 4; w++) {
+            s[k][w] = _mm256_loadu_si256((const __m256i*)(state + 16 * w + 8 * k));
+        }
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 2; k++) {
+            _mm256_rand_gaussian_ps_avx2_fma(s[k], &lo, &hi);
+            _mm256_storeu_ps(out + 16 * k, lo);
+            _mm256_storeu_ps(out + 16 * k + 8, hi);
+        }
+        out += 32;
+    }
+    for (k = 0; k < 2; k++) {
+        for (w = 0; w < 4; w++) {
+            _mm256_storeu_si256((__m256i*)(state + 16 * w + 8 * k), s[k][w]);
+        }
+    }
+
+    volk_rand_gaussian_points(
+        outputVector + sixteenth_points * 16, state, num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_rand_gaussian_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                          uint32_t* state,
+                                                          unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    float* out = (float*)outputVector;
+    unsigned int number, w;
+    __m512i s[4];
+    __m512 lo, hi;
+
+    for (w = 0; w < 4; w++) {
+        s[w] = _mm512_loadu_si512(state + 16 * w);
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        _mm512_rand_gaussian_ps(s, &lo, &hi);
+        _mm512_storeu_ps(out, lo);
+        _mm512_storeu_ps(out + 16, hi);
+        out += 32;
+    }
+    for (w = 0; w < 4; w++) {
+        _mm512_storeu_si512(state + 16 * w, s[w]);
+    }
+
+    volk_rand_gaussian_points(
+        outputVector + sixteenth_points * 16, state, num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_rand_gaussian_32fc_neonv8(lv_32fc_t* outputVector,
+                                                       uint32_t* state,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    float* out = (float*)outputVector;
+    unsigned int number, k, w;
+    uint32x4_t s[4][4];
+
+    // generators 4 * k to 4 * k + 3 in s[k]
+    for (k = 0; k < 4; k++) {
+        for (w = 0; w < 4; w++) {
+            s[k][w] = vld1q_u32(state + 16 * w + 4 * k);
+        }
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 4; k++) {
+            vst2q_f32(out + 8 * k, _vrand_gaussianq_f32(s[k]));
+        }
+        out += 32;
+    }
+    for (k = 0; k < 4; k++) {
+        for (w = 0; w < 4; w++) {
+            vst1q_u32(state + 16 * w + 4 * k, s[k][w]);
+        }
+    }
+
+    volk_rand_gaussian_points(
+        outputVector + sixteenth_points * 16, state, num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_rand_gaussian_32fc_H */
@@ -0,0 +1,118 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_rand_gaussian_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_rand_gaussianpuppet_32fc_H
+#define INCLUDED_volk_32fc_rand_gaussianpuppet_32fc_H
+
+#include <volk/volk_32fc_rand_gaussian_32fc.h>
+
+/*
+ * Draws from a state seeded with 1 in calls of 100 points, which leave a tail
+ * in every call, carrying the state from each call into the next. The input
+ * only gives the tests a signature.
+ */
+static inline void
+volk_rand_gaussian_puppet(void (*kernel)(lv_32fc_t*, uint32_t*, unsigned int),
+                          lv_32fc_t* outputVector,
+                          const lv_32fc_t* inputVector,
+                          unsigned int num_points)
+{
+    uint32_t state[VOLK_RAND_STATE_WORDS];
+    unsigned int number;
+    (void)inputVector;
+
+    volk_rand_seed(state, 1);
+    for (number = 0; number < num_points; number += 100) {
+        kernel(outputVector + number,
+               state,
+               num_points - number < 100 ? num_points - number : 100);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_rand_gaussianpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                           const lv_32fc_t* inputVector,
+                                           unsigned int num_points)
+{
+    volk_rand_gaussian_puppet(volk_32fc_rand_gaussian_32fc_generic,
+                              outputVector,
+                              inputVector,
+                              num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_rand_gaussianpuppet_32fc_u_avx2_fma(lv_32fc_t* outputVector,
+                                              const lv_32fc_t* inputVector,
+                                              unsigned int num_points)
+{
+    volk_rand_gaussian_puppet(volk_32fc_rand_gaussian_32fc_u_avx2_fma,
+                              outputVector,
+                              inputVector,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_rand_gaussianpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                             const lv_32fc_t* inputVector,
+                                             unsigned int num_points)
+{
+    volk_rand_gaussian_puppet(volk_32fc_rand_gaussian_32fc_u_avx512f,
+                              outputVector,
+                              inputVector,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_rand_gaussianpuppet_32fc_neonv8(lv_32fc_t* outputVector,
+                                                             const lv_32fc_t* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_rand_gaussian_puppet(volk_32fc_rand_gaussian_32fc_neonv8,
+                              outputVector,
+                              inputVector,
+                              num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_rand_gaussianpuppet_32fc_H */
@@ -28,6 +28,10 @@
  * Computes the arctan for each value in a complex vector and applies
  * a normalization factor.
  *
+ * The SIMD versions reduce the ratio of the smaller to the larger of |I| and
+ * |Q| to [0, 1] and evaluate an odd minimax polynomial of degree 15, of
+ * relative error below 2e-7, then restore the octant.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32fc_s32f_atan2_32f(float* outputVector, const lv_32fc_t* complexVector,
@@ -76,14 +80,10 @@
 
 #include <inttypes.h>
 #include <math.h>
-#include <stdio.h>
 
 #ifdef LV_HAVE_SSE4_1
 #include <smmintrin.h>
-
-#ifdef LV_HAVE_LIB_SIMDMATH
-#include <simdmath.h>
-#endif /* LV_HAVE_LIB_SIMDMATH */
+#include <volk/volk_sse4_1_intrinsics.h>
 
 static inline void volk_32fc_s32f_atan2_32f_a_sse4_1(float* outputVector,
                                                      const lv_32fc_t* complexVector,
@@ -95,39 +95,22 @@ static inline void volk_32fc_s32f_atan2_32f_a_sse4_1(float* outputVector,
 
     unsigned int number = 0;
     const float invNormalizeFactor = 1.0 / normalizeFactor;
-
-#ifdef LV_HAVE_LIB_SIMDMATH
     const unsigned int quarterPoints = num_points / 4;
-    __m128 testVector = _mm_set_ps1(2 * M_PI);
-    __m128 correctVector = _mm_set_ps1(M_PI);
-    __m128 vNormalizeFactor = _mm_set_ps1(invNormalizeFactor);
-    __m128 phase;
+    const __m128 vNormalizeFactor = _mm_set_ps1(invNormalizeFactor);
     __m128 complex1, complex2, iValue, qValue;
-    __m128 keepMask;
 
     for (; number < quarterPoints; number++) {
-        // Load IQ data:
         complex1 = _mm_load_ps(complexVectorPtr);
-        complexVectorPtr += 4;
-        complex2 = _mm_load_ps(complexVectorPtr);
-        complexVectorPtr += 4;
-        // Deinterleave IQ data:
+        complex2 = _mm_load_ps(complexVectorPtr + 4);
         iValue = _mm_shuffle_ps(complex1, complex2, _MM_SHUFFLE(2, 0, 2, 0));
         qValue = _mm_shuffle_ps(complex1, complex2, _MM_SHUFFLE(3, 1, 3, 1));
-        // Arctan to get phase:
-        phase = atan2f4(qValue, iValue);
-        // When Q = 0 and I < 0, atan2f4 sucks and returns 2pi vice pi.
-        // Compare to 2pi:
-        keepMask = _mm_cmpneq_ps(phase, testVector);
-        phase = _mm_blendv_ps(correctVector, phase, keepMask);
-        // done with above correction.
-        phase = _mm_mul_ps(phase, vNormalizeFactor);
-        _mm_store_ps((float*)outPtr, phase);
+        _mm_store_ps(outPtr,
+                     _mm_mul_ps(_mm_atan2_ps_sse4_1(qValue, iValue), vNormalizeFactor));
+        complexVectorPtr += 8;
         outPtr += 4;
     }
-    number = quarterPoints * 4;
-#endif /* LV_HAVE_LIB_SIMDMATH */
 
+    number = quarterPoints * 4;
     for (; number < num_points; number++) {
         const float real = *complexVectorPtr++;
         const float imag = *complexVectorPtr++;
@@ -137,66 +120,128 @@ static inline void volk_32fc_s32f_atan2_32f_a_sse4_1(float* outputVector,
 #endif /* LV_HAVE_SSE4_1 */
 
 
-#ifdef LV_HAVE_SSE
-#include <xmmintrin.h>
-
-#ifdef LV_HAVE_LIB_SIMDMATH
-#include <simdmath.h>
-#endif /* LV_HAVE_LIB_SIMDMATH */
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse4_1_intrinsics.h>
 
-static inline void volk_32fc_s32f_atan2_32f_a_sse(float* outputVector,
-                                                  const lv_32fc_t* complexVector,
-                                                  const float normalizeFactor,
-                                                  unsigned int num_points)
+static inline void volk_32fc_s32f_atan2_32f_u_sse4_1(float* outputVector,
+                                                     const lv_32fc_t* complexVector,
+                                                     const float normalizeFactor,
+                                                     unsigned int num_points)
 {
     const float* complexVectorPtr = (float*)complexVector;
     float* outPtr = outputVector;
 
     unsigned int number = 0;
     const float invNormalizeFactor = 1.0 / normalizeFactor;
-
-#ifdef LV_HAVE_LIB_SIMDMATH
     const unsigned int quarterPoints = num_points / 4;
-    __m128 testVector = _mm_set_ps1(2 * M_PI);
-    __m128 correctVector = _mm_set_ps1(M_PI);
-    __m128 vNormalizeFactor = _mm_set_ps1(invNormalizeFactor);
-    __m128 phase;
+    const __m128 vNormalizeFactor = _mm_set_ps1(invNormalizeFactor);
     __m128 complex1, complex2, iValue, qValue;
-    __m128 mask;
-    __m128 keepMask;
 
     for (; number < quarterPoints; number++) {
-        // Load IQ data:
-        complex1 = _mm_load_ps(complexVectorPtr);
-        complexVectorPtr += 4;
-        complex2 = _mm_load_ps(complexVectorPtr);
-        complexVectorPtr += 4;
-        // Deinterleave IQ data:
+        complex1 = _mm_loadu_ps(complexVectorPtr);
+        complex2 = _mm_loadu_ps(complexVectorPtr + 4);
         iValue = _mm_shuffle_ps(complex1, complex2, _MM_SHUFFLE(2, 0, 2, 0));
         qValue = _mm_shuffle_ps(complex1, complex2, _MM_SHUFFLE(3, 1, 3, 1));
-        // Arctan to get phase:
-        phase = atan2f4(qValue, iValue);
-        // When Q = 0 and I < 0, atan2f4 sucks and returns 2pi vice pi.
-        // Compare to 2pi:
-        keepMask = _mm_cmpneq_ps(phase, testVector);
-        phase = _mm_and_ps(phase, keepMask);
-        mask = _mm_andnot_ps(keepMask, correctVector);
-        phase = _mm_or_ps(phase, mask);
-        // done with above correction.
-        phase = _mm_mul_ps(phase, vNormalizeFactor);
-        _mm_store_ps((float*)outPtr, phase);
+        _mm_storeu_ps(outPtr,
+                      _mm_mul_ps(_mm_atan2_ps_sse4_1(qValue, iValue), vNormalizeFactor));
+        complexVectorPtr += 8;
         outPtr += 4;
     }
+
     number = quarterPoints * 4;
-#endif /* LV_HAVE_LIB_SIMDMATH */
+    for (; number < num_points; number++) {
+        const float real = *complexVectorPtr++;
+        const float imag = *complexVectorPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_u_avx2(float* outputVector,
+                                                   const lv_32fc_t* complexVector,
+                                                   const float normalizeFactor,
+                                                   unsigned int num_points)
+{
+    const float* complexVectorPtr = (float*)complexVector;
+    float* outPtr = outputVector;
+
+    unsigned int number = 0;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 vNormalizeFactor = _mm256_set1_ps(invNormalizeFactor);
+    __m256 complex1, complex2, phase;
+
+    for (; number < eighthPoints; number++) {
+        complex1 = _mm256_loadu_ps(complexVectorPtr);
+        complex2 = _mm256_loadu_ps(complexVectorPtr + 8);
+        // the phases of points 0, 1, 4, 5, 2, 3, 6, 7, put back in order
+        phase = _mm256_atan2_ps_avx2(_mm256_shuffle_ps(complex1, complex2, 0xdd),
+                                     _mm256_shuffle_ps(complex1, complex2, 0x88));
+        phase = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(phase), 0xd8));
+        _mm256_storeu_ps(outPtr, _mm256_mul_ps(phase, vNormalizeFactor));
+        complexVectorPtr += 16;
+        outPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const float real = *complexVectorPtr++;
+        const float imag = *complexVectorPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_u_avx512f(float* outputVector,
+                                                      const lv_32fc_t* complexVector,
+                                                      const float normalizeFactor,
+                                                      unsigned int num_points)
+{
+    const float* complexVectorPtr = (float*)complexVector;
+    float* outPtr = outputVector;
+
+    unsigned int number = 0;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i realIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imagIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    const __m512 vNormalizeFactor = _mm512_set1_ps(invNormalizeFactor);
+    __m512 complex1, complex2;
+
+    for (; number < sixteenthPoints; number++) {
+        complex1 = _mm512_loadu_ps(complexVectorPtr);
+        complex2 = _mm512_loadu_ps(complexVectorPtr + 16);
+        _mm512_storeu_ps(
+            outPtr,
+            _mm512_mul_ps(
+                _mm512_atan2_ps(_mm512_permutex2var_ps(complex1, imagIdx, complex2),
+                                _mm512_permutex2var_ps(complex1, realIdx, complex2)),
+                vNormalizeFactor));
+        complexVectorPtr += 32;
+        outPtr += 16;
+    }
 
+    number = sixteenthPoints * 16;
     for (; number < num_points; number++) {
         const float real = *complexVectorPtr++;
         const float imag = *complexVectorPtr++;
         *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
     }
 }
-#endif /* LV_HAVE_SSE */
+#endif /* LV_HAVE_AVX512F */
 
 #ifdef LV_HAVE_GENERIC
 
@@ -217,5 +262,42 @@ static inline void volk_32fc_s32f_atan2_32f_generic(float* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_neonv8(float* outputVector,
+                                                   const lv_32fc_t* inputVector,
+                                                   const float normalizeFactor,
+                                                   unsigned int num_points)
+{
+    const float* complexVectorPtr = (float*)inputVector;
+    float* outPtr = outputVector;
+
+    unsigned int number = 0;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (; number < eighthPoints; number++) {
+        const float32x4x2_t input0 = vld2q_f32(complexVectorPtr);
+        const float32x4x2_t input1 = vld2q_f32(complexVectorPtr + 8);
+        __VOLK_PREFETCH(complexVectorPtr + 32);
+        vst1q_f32(outPtr,
+                  vmulq_n_f32(_vatan2q_f32(input0.val[1], input0.val[0]), invNormalizeFactor));
+        vst1q_f32(outPtr + 4,
+                  vmulq_n_f32(_vatan2q_f32(input1.val[1], input1.val[0]), invNormalizeFactor));
+        complexVectorPtr += 16;
+        outPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const float real = *complexVectorPtr++;
+        const float imag = *complexVectorPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
 
 #endif /* INCLUDED_volk_32fc_s32f_atan2_32f_a_H */
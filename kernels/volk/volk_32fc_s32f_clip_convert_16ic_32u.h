@@ -0,0 +1,312 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32f_clip_convert_16ic_32u
+ *
+ * \b Overview
+ *
+ * Scales a complex floating point vector, saturates both parts to 16-bit shorts
+ * as volk_32fc_convert_16ic does and counts the points which had to be clipped,
+ * those with a scaled real or imaginary part above SHRT_MAX or below SHRT_MIN.
+ * Clipping the transmit samples, converting them and counting the clipped ones for
+ * crest factor reduction then takes a single pass over the samples.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_clip_convert_16ic_32u(lv_16sc_t* outputVector, uint32_t* clipped,
+ *                                           const lv_32fc_t* inputVector,
+ *                                           const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex input vector.
+ * \li scalar: The value multiplied against each part of each point.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex 16-bit output vector.
+ * \li clipped: The number of complex points of which either part was clipped.
+ *
+ * \b Example
+ * Convert a tone with a gain that clips its peaks.
+ * \code
+ *   int N = 16;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t)*N, alignment);
+ *   uint32_t clipped;
+ *
+ *   for(int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cosf(0.4f * ii), sinf(0.4f * ii));
+ *   }
+ *
+ *   volk_32fc_s32f_clip_convert_16ic_32u(out, &clipped, in, 36000.f, N);
+ *
+ *   printf("%u of %i points clipped\n", clipped, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_clip_convert_16ic_32u_H
+#define INCLUDED_volk_32fc_s32f_clip_convert_16ic_32u_H
+
+#include <inttypes.h>
+#include <limits.h>
+#include <math.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_clip_convert_16ic_32u_generic(
+    lv_16sc_t* outputVector,
+    uint32_t* clipped,
+    const lv_32fc_t* inputVector,
+    const float scalar,
+    unsigned int num_points)
+{
+    const float min_val = SHRT_MIN;
+    const float max_val = SHRT_MAX;
+    const float* in = (const float*)inputVector;
+    int16_t* out = (int16_t*)outputVector;
+    uint32_t count = 0;
+    unsigned int number, part;
+
+    for (number = 0; number < num_points; number++) {
+        uint32_t clip = 0;
+        for (part = 0; part < 2; part++) {
+            float r = *in++ * scalar;
+            if (r > max_val) {
+                r = max_val;
+                clip = 1;
+            } else if (r < min_val) {
+                r = min_val;
+                clip = 1;
+            }
+            *out++ = (int16_t)rintf(r);
+        }
+        count += clip;
+    }
+    *clipped = count;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32fc_s32f_clip_convert_16ic_32u_u_sse2(
+    lv_16sc_t* outputVector,
+    uint32_t* clipped,
+    const lv_32fc_t* inputVector,
+    const float scalar,
+    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* in = (const float*)inputVector;
+    const __m128 vScalar = _mm_set1_ps(scalar);
+    const __m128 vmin_val = _mm_set1_ps(SHRT_MIN);
+    const __m128 vmax_val = _mm_set1_ps(SHRT_MAX);
+    __VOLK_ATTR_ALIGNED(16) uint32_t counts[4];
+    // both lanes of a point count it when either part clips, so each counts twice
+    __m128i count = _mm_setzero_si128();
+    __m128 value1, value2, clip1, clip2;
+    uint32_t tail;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        value1 = _mm_mul_ps(_mm_loadu_ps(in), vScalar);
+        value2 = _mm_mul_ps(_mm_loadu_ps(in + 4), vScalar);
+        clip1 = _mm_or_ps(_mm_cmpgt_ps(value1, vmax_val), _mm_cmplt_ps(value1, vmin_val));
+        clip2 = _mm_or_ps(_mm_cmpgt_ps(value2, vmax_val), _mm_cmplt_ps(value2, vmin_val));
+        clip1 = _mm_or_ps(clip1, _mm_shuffle_ps(clip1, clip1, 0xb1));
+        clip2 = _mm_or_ps(clip2, _mm_shuffle_ps(clip2, clip2, 0xb1));
+        count = _mm_sub_epi32(count, _mm_castps_si128(clip1));
+        count = _mm_sub_epi32(count, _mm_castps_si128(clip2));
+        value1 = _mm_max_ps(_mm_min_ps(value1, vmax_val), vmin_val);
+        value2 = _mm_max_ps(_mm_min_ps(value2, vmax_val), vmin_val);
+        _mm_storeu_si128(
+            (__m128i*)outputVector,
+            _mm_packs_epi32(_mm_cvtps_epi32(value1), _mm_cvtps_epi32(value2)));
+        in += 8;
+        outputVector += 4;
+    }
+
+    _mm_store_si128((__m128i*)counts, count);
+    volk_32fc_s32f_clip_convert_16ic_32u_generic(
+        outputVector, &tail, (const lv_32fc_t*)in, scalar, num_points & 3);
+    *clipped = (counts[0] + counts[1] + counts[2] + counts[3]) / 2 + tail;
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_clip_convert_16ic_32u_u_avx2(
+    lv_16sc_t* outputVector,
+    uint32_t* clipped,
+    const lv_32fc_t* inputVector,
+    const float scalar,
+    unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* in = (const float*)inputVector;
+    const __m256 vScalar = _mm256_set1_ps(scalar);
+    const __m256 vmin_val = _mm256_set1_ps(SHRT_MIN);
+    const __m256 vmax_val = _mm256_set1_ps(SHRT_MAX);
+    __VOLK_ATTR_ALIGNED(32) uint32_t counts[8];
+    // both lanes of a point count it when either part clips, so each counts twice
+    __m256i count = _mm256_setzero_si256();
+    __m256 value1, value2, clip1, clip2;
+    __m256i packed;
+    uint32_t tail;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        value1 = _mm256_mul_ps(_mm256_loadu_ps(in), vScalar);
+        value2 = _mm256_mul_ps(_mm256_loadu_ps(in + 8), vScalar);
+        clip1 = _mm256_or_ps(_mm256_cmp_ps(value1, vmax_val, _CMP_GT_OQ),
+                             _mm256_cmp_ps(value1, vmin_val, _CMP_LT_OQ));
+        clip2 = _mm256_or_ps(_mm256_cmp_ps(value2, vmax_val, _CMP_GT_OQ),
+                             _mm256_cmp_ps(value2, vmin_val, _CMP_LT_OQ));
+        clip1 = _mm256_or_ps(clip1, _mm256_permute_ps(clip1, 0xb1));
+        clip2 = _mm256_or_ps(clip2, _mm256_permute_ps(clip2, 0xb1));
+        count = _mm256_sub_epi32(count, _mm256_castps_si256(clip1));
+        count = _mm256_sub_epi32(count, _mm256_castps_si256(clip2));
+        value1 = _mm256_max_ps(_mm256_min_ps(value1, vmax_val), vmin_val);
+        value2 = _mm256_max_ps(_mm256_min_ps(value2, vmax_val), vmin_val);
+        // the pack works per 128-bit lane, the permute puts the points back in order
+        packed =
+            _mm256_packs_epi32(_mm256_cvtps_epi32(value1), _mm256_cvtps_epi32(value2));
+        _mm256_storeu_si256((__m256i*)outputVector,
+                            _mm256_permute4x64_epi64(packed, 0xd8));
+        in += 16;
+        outputVector += 8;
+    }
+
+    _mm256_store_si256((__m256i*)counts, count);
+    for (number = 1; number < 8; number++) {
+        counts[0] += counts[number];
+    }
+    volk_32fc_s32f_clip_convert_16ic_32u_generic(
+        outputVector, &tail, (const lv_32fc_t*)in, scalar, num_points & 7);
+    *clipped = counts[0] / 2 + tail;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_clip_convert_16ic_32u_u_avx512f(
+    lv_16sc_t* outputVector,
+    uint32_t* clipped,
+    const lv_32fc_t* inputVector,
+    const float scalar,
+    unsigned int num_points)
+{
+    const float* in = (const float*)inputVector;
+    int16_t* out = (int16_t*)outputVector;
+    const unsigned int num_values = 2 * num_points;
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 vmin_val = _mm512_set1_ps(SHRT_MIN);
+    const __m512 vmax_val = _mm512_set1_ps(SHRT_MAX);
+    const __m512i one = _mm512_set1_epi32(1);
+    __m512i count = _mm512_setzero_si512();
+    unsigned int number;
+
+    for (number = 0; number < num_values; number += 16) {
+        // the last points with a masked load and store, the zeroed lanes never clip
+        const unsigned int remaining = num_values - number;
+        const __mmask16 mask =
+            _cvtu32_mask16(remaining < 16 ? (1u << remaining) - 1 : 0xffff);
+        const __m512 value =
+            _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, in + number), vScalar);
+        const unsigned int clip =
+            _cvtmask16_u32(_mm512_cmp_ps_mask(value, vmax_val, _CMP_GT_OQ) |
+                           _mm512_cmp_ps_mask(value, vmin_val, _CMP_LT_OQ));
+        // one bit per point, on its real part
+        count = _mm512_mask_add_epi32(
+            count, _cvtu32_mask16((clip | (clip >> 1)) & 0x5555), count, one);
+        _mm512_mask_cvtsepi32_storeu_epi16(
+            out + number,
+            mask,
+            _mm512_cvtps_epi32(_mm512_max_ps(_mm512_min_ps(value, vmax_val), vmin_val)));
+    }
+
+    *clipped = (uint32_t)_mm512_reduce_add_epi32(count);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_clip_convert_16ic_32u_neonv8(
+    lv_16sc_t* outputVector,
+    uint32_t* clipped,
+    const lv_32fc_t* inputVector,
+    const float scalar,
+    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float* in = (const float*)inputVector;
+    const float32x4_t vmin_val = vdupq_n_f32(SHRT_MIN);
+    const float32x4_t vmax_val = vdupq_n_f32(SHRT_MAX);
+    // both lanes of a point count it when either part clips, so each counts twice
+    uint32x4_t count = vdupq_n_u32(0);
+    float32x4_t value1, value2;
+    uint32x4_t clip1, clip2;
+    uint32_t tail;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        value1 = vmulq_n_f32(vld1q_f32(in), scalar);
+        value2 = vmulq_n_f32(vld1q_f32(in + 4), scalar);
+        clip1 = vorrq_u32(vcgtq_f32(value1, vmax_val), vcltq_f32(value1, vmin_val));
+        clip2 = vorrq_u32(vcgtq_f32(value2, vmax_val), vcltq_f32(value2, vmin_val));
+        count = vsubq_u32(count, vorrq_u32(clip1, vrev64q_u32(clip1)));
+        count = vsubq_u32(count, vorrq_u32(clip2, vrev64q_u32(clip2)));
+        // round to nearest even as rintf does, the conversion saturates
+        vst1q_s16((int16_t*)outputVector,
+                  vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(value1)),
+                               vqmovn_s32(vcvtnq_s32_f32(value2))));
+        in += 8;
+        outputVector += 4;
+    }
+
+    volk_32fc_s32f_clip_convert_16ic_32u_generic(
+        outputVector, &tail, (const lv_32fc_t*)in, scalar, num_points & 3);
+    *clipped = vaddvq_u32(count) / 2 + tail;
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_clip_convert_16ic_32u_H */
@@ -0,0 +1,300 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32fc_s32f_iir1_32fc
+ *
+ * \b Overview
+ *
+ * Runs the single pole recursion
+ *
+ * outputVector[n] = pole * outputVector[n - 1] + inputVector[n]
+ *
+ * over complex samples with a real pole, as volk_32f_s32f_iir1_32f does
+ * over real ones, e.g. to smooth a channel estimate or, on the first
+ * difference of a signal, to block DC. The SIMD versions take each vector
+ * as a prefix sum scaled by the powers of the pole and round a little
+ * differently from the recursion.
+ *
+ * The last output is carried from call to call in the state, so a stream
+ * cut into buffers is filtered by passing the same variable to every call.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_iir1_32fc(lv_32fc_t* outputVector, const lv_32fc_t* inputVector,
+ * const float pole, lv_32fc_t* state, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The samples to filter.
+ * \li pole: The feedback coefficient, between -1 and 1 for a stable filter.
+ * \li state: The output before the first input, 0 to start.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The filtered samples.
+ * \li state: The last output, to carry into the next buffer.
+ *
+ * \b Example
+ * Block the DC of a signal, filtering its first difference.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t previous = lv_cmake(0.f, 0.f);
+ *   lv_32fc_t state = lv_cmake(0.f, 0.f);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       lv_32fc_t x = lv_cmake(1.f + cosf(0.1f * ii), 2.f + sinf(0.1f * ii));
+ *       in[ii] = x - previous;
+ *       previous = x;
+ *   }
+ *
+ *   volk_32fc_s32f_iir1_32fc(out, in, 0.995f, &state, N);
+ *
+ *   printf("out[N - 1] = %+f %+fj\n", lv_creal(out[N - 1]), lv_cimag(out[N - 1]));
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_iir1_32fc_u_H
+#define INCLUDED_volk_32fc_s32f_iir1_32fc_u_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_iir1_32fc_generic(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    const float pole,
+                                                    lv_32fc_t* state,
+                                                    unsigned int num_points)
+{
+    lv_32fc_t last = *state;
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        last = pole * last + inputVector[number];
+        outputVector[number] = last;
+    }
+    *state = last;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_s32f_iir1_32fc_u_sse(lv_32fc_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  const float pole,
+                                                  lv_32fc_t* state,
+                                                  unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 pole1 = _mm_set1_ps(pole);
+    const __m128 powers = _mm_setr_ps(pole, pole, pole * pole, pole * pole);
+    __m128 last = _mm_loadl_pi(zero, (const __m64*)state);
+    __m128 x;
+    lv_32fc_t carry;
+    unsigned int number;
+
+    last = _mm_movelh_ps(last, last);
+    for (number = 0; number < halfPoints; number++) {
+        x = _mm_loadu_ps((const float*)inputVector);
+        x = _mm_add_ps(x, _mm_mul_ps(pole1, _mm_movelh_ps(zero, x)));
+        x = _mm_add_ps(x, _mm_mul_ps(powers, last));
+        _mm_storeu_ps((float*)outputVector, x);
+        last = _mm_movehl_ps(x, x);
+        inputVector += 2;
+        outputVector += 2;
+    }
+
+    _mm_storel_pi((__m64*)&carry, last);
+    for (number = halfPoints * 2; number < num_points; number++) {
+        carry = pole * carry + *inputVector++;
+        *outputVector++ = carry;
+    }
+    *state = carry;
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_iir1_32fc_u_avx(lv_32fc_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  const float pole,
+                                                  lv_32fc_t* state,
+                                                  unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float pole2 = pole * pole;
+    const float pole3 = pole2 * pole;
+    const float pole4 = pole2 * pole2;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 pole1 = _mm256_set1_ps(pole);
+    const __m256 powers =
+        _mm256_setr_ps(pole, pole, pole2, pole2, pole3, pole3, pole4, pole4);
+    // the upper lane scales the last sum of the lower one by pole and pole^2
+    const __m256 upperPowers =
+        _mm256_setr_ps(pole, pole, pole2, pole2, pole, pole, pole2, pole2);
+    __m256 last = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)state));
+    __m256 x, below;
+    lv_32fc_t carry;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = _mm256_loadu_ps((const float*)inputVector);
+        below =
+            _mm256_blend_ps(_mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 3, 2)), zero, 0x33);
+        x = _mm256_add_ps(x, _mm256_mul_ps(pole1, below));
+        below = _mm256_permute2f128_ps(_mm256_permute_ps(x, 0xee), zero, 0x08);
+        x = _mm256_add_ps(x, _mm256_mul_ps(upperPowers, below));
+        x = _mm256_add_ps(x, _mm256_mul_ps(powers, last));
+        _mm256_storeu_ps((float*)outputVector, x);
+        last = _mm256_permute_ps(x, 0xee);
+        last = _mm256_permute2f128_ps(last, last, 0x11);
+        inputVector += 4;
+        outputVector += 4;
+    }
+
+    _mm_storel_pi((__m64*)&carry, _mm256_castps256_ps128(last));
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        carry = pole * carry + *inputVector++;
+        *outputVector++ = carry;
+    }
+    *state = carry;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_iir1_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                      const lv_32fc_t* inputVector,
+                                                      const float pole,
+                                                      lv_32fc_t* state,
+                                                      unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i lastLanes = _mm512_set1_epi64(7);
+    __VOLK_ATTR_ALIGNED(64) float powerVector[16];
+    __m512 powers, pole1, pole2, pole4, last, x;
+    float power = pole;
+    lv_32fc_t carry;
+    unsigned int number;
+
+    for (number = 0; number < 8; number++) {
+        powerVector[2 * number] = power;
+        powerVector[2 * number + 1] = power;
+        power *= pole;
+    }
+    powers = _mm512_load_ps(powerVector);
+    pole1 = _mm512_set1_ps(powerVector[0]);
+    pole2 = _mm512_set1_ps(powerVector[2]);
+    pole4 = _mm512_set1_ps(powerVector[6]);
+    last = _mm512_castpd_ps(_mm512_broadcastsd_pd(
+        _mm_castps_pd(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)state))));
+
+    for (number = 0; number < eighthPoints; number++) {
+        // sample k gathers the inputs k - 2^s + 1 to k, each step shifting in zeros
+        x = _mm512_loadu_ps((const float*)inputVector);
+        x = _mm512_fmadd_ps(
+            pole1,
+            _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 14)),
+            x);
+        x = _mm512_fmadd_ps(
+            pole2,
+            _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 12)),
+            x);
+        x = _mm512_fmadd_ps(
+            pole4,
+            _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(x), zero, 8)),
+            x);
+        x = _mm512_fmadd_ps(powers, last, x);
+        _mm512_storeu_ps((float*)outputVector, x);
+        last = _mm512_castpd_ps(_mm512_permutexvar_pd(lastLanes, _mm512_castps_pd(x)));
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    _mm_storel_pi((__m64*)&carry, _mm512_castps512_ps128(last));
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        carry = pole * carry + *inputVector++;
+        *outputVector++ = carry;
+    }
+    *state = carry;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_iir1_32fc_neon(lv_32fc_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 const float pole,
+                                                 lv_32fc_t* state,
+                                                 unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float powerVector[4] = { pole, pole, pole * pole, pole * pole };
+    const float32x4_t powers = vld1q_f32(powerVector);
+    float32x2_t last = vld1_f32((const float*)state);
+    float32x4_t x;
+    lv_32fc_t carry;
+    unsigned int number;
+
+    for (number = 0; number < halfPoints; number++) {
+        x = vld1q_f32((const float*)inputVector);
+        x = vmlaq_n_f32(x, vextq_f32(zero, x, 2), pole);
+        x = vmlaq_f32(x, powers, vcombine_f32(last, last));
+        vst1q_f32((float*)outputVector, x);
+        last = vget_high_f32(x);
+        inputVector += 2;
+        outputVector += 2;
+    }
+
+    vst1_f32((float*)&carry, last);
+    for (number = halfPoints * 2; number < num_points; number++) {
+        carry = pole * carry + *inputVector++;
+        *outputVector++ = carry;
+    }
+    *state = carry;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_iir1_32fc_u_H */
@@ -0,0 +1,282 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32f_nco_32fc
+ *
+ * \b Overview
+ *
+ * Mixes the input vector with a numerically controlled oscillator:
+ * outVector[n] = inVector[n] * exp(j * (phase + n * phase_inc)). Unlike
+ * volk_32fc_s32fc_x2_rotator_32fc, which multiplies a running phasor and
+ * renormalises it, the phase is kept as an angle in double precision and
+ * wrapped into [-pi, pi) as it advances, and each sample takes the sine and
+ * cosine of its own angle. Neither the amplitude nor the frequency drifts,
+ * however long the stream.
+ *
+ * Mixing a vector of ones generates the complex tone itself.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_nco_32fc(lv_32fc_t* outVector, const lv_32fc_t* inVector,
+ * const float phase_inc, double* phase, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The vector to mix.
+ * \li phase_inc: The phase advance per sample in radians.
+ * \li phase: The phase of the first sample in radians.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li outVector: The mixed vector.
+ * \li phase: The phase of the sample after the last one, wrapped into [-pi, pi),
+ * to continue the oscillator in the next call.
+ *
+ * \b Example
+ * Generate a tone at 0.1 radians per sample.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in  = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(1.f, 0.f);
+ *   }
+ *   double phase = 0.;
+ *
+ *   volk_32fc_s32f_nco_32fc(out, in, 0.1f, &phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n",
+ *           ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_nco_32fc_u_H
+#define INCLUDED_volk_32fc_s32f_nco_32fc_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/* Wraps any phase into [-pi, pi). */
+static inline double volk_nco_wrap_phase(double phase)
+{
+    if (phase >= M_PI || phase < -M_PI) {
+        phase -= 2. * M_PI * floor((phase + M_PI) / (2. * M_PI));
+    }
+    return phase;
+}
+
+/* Advances a wrapped phase by a wrapped increment, whose sum is at most one
+ * turn out of range. */
+static inline double volk_nco_step_phase(double phase, double phase_inc)
+{
+    phase += phase_inc;
+    if (phase >= M_PI) {
+        phase -= 2. * M_PI;
+    } else if (phase < -M_PI) {
+        phase += 2. * M_PI;
+    }
+    return phase;
+}
+
+/* Mixes the samples one by one, returning the phase after the last. */
+static inline double volk_nco_mix(lv_32fc_t* outVector,
+                                  const lv_32fc_t* inVector,
+                                  double phase,
+                                  double phase_inc,
+                                  unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        const float angle = (float)phase;
+        outVector[number] = inVector[number] * lv_cmake(cosf(angle), sinf(angle));
+        phase = volk_nco_step_phase(phase, phase_inc);
+    }
+    return phase;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_nco_32fc_generic(lv_32fc_t* outVector,
+                                                   const lv_32fc_t* inVector,
+                                                   const float phase_inc,
+                                                   double* phase,
+                                                   unsigned int num_points)
+{
+    volk_nco_mix(outVector,
+                 inVector,
+                 volk_nco_wrap_phase(*phase),
+                 volk_nco_wrap_phase(phase_inc),
+                 num_points);
+    *phase = volk_nco_wrap_phase(*phase + num_points * (double)phase_inc);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32fc_s32f_nco_32fc_sse3(lv_32fc_t* outVector,
+                                                const lv_32fc_t* inVector,
+                                                const float phase_inc,
+                                                double* phase,
+                                                unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const double sample_inc = volk_nco_wrap_phase(phase_inc);
+    const double block_inc = volk_nco_wrap_phase(4. * phase_inc);
+    // the angles of the four samples of a block relative to its first
+    const __m128 offsets = _mm_setr_ps(0.f,
+                                       (float)sample_inc,
+                                       (float)volk_nco_wrap_phase(2. * phase_inc),
+                                       (float)volk_nco_wrap_phase(3. * phase_inc));
+    double block_phase = volk_nco_wrap_phase(*phase);
+    unsigned int number;
+    __m128 sine, cosine, x0, x1;
+
+    for (number = 0; number < quarter_points; number++) {
+        _mm_sincos_ps_sse3(
+            _mm_add_ps(_mm_set1_ps((float)block_phase), offsets), &sine, &cosine);
+        x0 = _mm_loadu_ps((const float*)inVector);
+        x1 = _mm_loadu_ps((const float*)(inVector + 2));
+        _mm_storeu_ps((float*)outVector,
+                      _mm_complexmul_ps(x0, _mm_unpacklo_ps(cosine, sine)));
+        _mm_storeu_ps((float*)(outVector + 2),
+                      _mm_complexmul_ps(x1, _mm_unpackhi_ps(cosine, sine)));
+        block_phase = volk_nco_step_phase(block_phase, block_inc);
+        inVector += 4;
+        outVector += 4;
+    }
+
+    volk_nco_mix(
+        outVector, inVector, block_phase, sample_inc, num_points - quarter_points * 4);
+    *phase = volk_nco_wrap_phase(*phase + num_points * (double)phase_inc);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s32f_nco_32fc_avx2(lv_32fc_t* outVector,
+                                                const lv_32fc_t* inVector,
+                                                const float phase_inc,
+                                                double* phase,
+                                                unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const double sample_inc = volk_nco_wrap_phase(phase_inc);
+    const double block_inc = volk_nco_wrap_phase(8. * phase_inc);
+    float offset[8];
+    double block_phase = volk_nco_wrap_phase(*phase);
+    unsigned int number;
+    __m256 offsets, sine, cosine, lo, hi;
+
+    // the angles of the eight samples of a block relative to its first
+    for (number = 0; number < 8; number++) {
+        offset[number] = (float)volk_nco_wrap_phase(number * (double)phase_inc);
+    }
+    offsets = _mm256_loadu_ps(offset);
+
+    for (number = 0; number < eighth_points; number++) {
+        _mm256_sincos_ps_avx2(
+            _mm256_add_ps(_mm256_set1_ps((float)block_phase), offsets), &sine, &cosine);
+        // samples 0 1 4 5 and 2 3 6 7 interleaved, put back in order across lanes
+        lo = _mm256_unpacklo_ps(cosine, sine);
+        hi = _mm256_unpackhi_ps(cosine, sine);
+        _mm256_storeu_ps((float*)outVector,
+                         _mm256_complexmul_ps(_mm256_loadu_ps((const float*)inVector),
+                                              _mm256_permute2f128_ps(lo, hi, 0x20)));
+        _mm256_storeu_ps(
+            (float*)(outVector + 4),
+            _mm256_complexmul_ps(_mm256_loadu_ps((const float*)(inVector + 4)),
+                                 _mm256_permute2f128_ps(lo, hi, 0x31)));
+        block_phase = volk_nco_step_phase(block_phase, block_inc);
+        inVector += 8;
+        outVector += 8;
+    }
+
+    volk_nco_mix(
+        outVector, inVector, block_phase, sample_inc, num_points - eighth_points * 8);
+    *phase = volk_nco_wrap_phase(*phase + num_points * (double)phase_inc);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_nco_32fc_neon(lv_32fc_t* outVector,
+                                                const lv_32fc_t* inVector,
+                                                const float phase_inc,
+                                                double* phase,
+                                                unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const double sample_inc = volk_nco_wrap_phase(phase_inc);
+    const double block_inc = volk_nco_wrap_phase(4. * phase_inc);
+    // the angles of the four samples of a block relative to its first
+    const float offset[4] = { 0.f,
+                              (float)sample_inc,
+                              (float)volk_nco_wrap_phase(2. * phase_inc),
+                              (float)volk_nco_wrap_phase(3. * phase_inc) };
+    const float32x4_t offsets = vld1q_f32(offset);
+    double block_phase = volk_nco_wrap_phase(*phase);
+    unsigned int number;
+    float32x4x2_t x, y, sincos;
+
+    for (number = 0; number < quarter_points; number++) {
+        // val[0] is the sine and val[1] the cosine
+        sincos = _vsincosq_f32(vaddq_f32(vdupq_n_f32((float)block_phase), offsets));
+        x = vld2q_f32((const float*)inVector);
+        y.val[0] =
+            vmlsq_f32(vmulq_f32(x.val[0], sincos.val[1]), x.val[1], sincos.val[0]);
+        y.val[1] =
+            vmlaq_f32(vmulq_f32(x.val[0], sincos.val[0]), x.val[1], sincos.val[1]);
+        vst2q_f32((float*)outVector, y);
+        block_phase = volk_nco_step_phase(block_phase, block_inc);
+        inVector += 4;
+        outVector += 4;
+    }
+
+    volk_nco_mix(
+        outVector, inVector, block_phase, sample_inc, num_points - quarter_points * 4);
+    *phase = volk_nco_wrap_phase(*phase + num_points * (double)phase_inc);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_nco_32fc_u_H */
@@ -0,0 +1,74 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32FC_S32F_NCOPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_S32F_NCOPUPPET_32FC_H
+
+#include <volk/volk_32fc_s32f_nco_32fc.h>
+
+/* Mixes from a fixed starting phase, as the oscillator puppet. */
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_s32f_ncopuppet_32fc_generic(lv_32fc_t* outVector,
+                                                         const lv_32fc_t* inVector,
+                                                         const float phase_inc,
+                                                         unsigned int num_points)
+{
+    double phase = 0.3;
+    volk_32fc_s32f_nco_32fc_generic(outVector, inVector, phase_inc, &phase, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+static inline void volk_32fc_s32f_ncopuppet_32fc_sse3(lv_32fc_t* outVector,
+                                                      const lv_32fc_t* inVector,
+                                                      const float phase_inc,
+                                                      unsigned int num_points)
+{
+    double phase = 0.3;
+    volk_32fc_s32f_nco_32fc_sse3(outVector, inVector, phase_inc, &phase, num_points);
+}
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_32fc_s32f_ncopuppet_32fc_avx2(lv_32fc_t* outVector,
+                                                      const lv_32fc_t* inVector,
+                                                      const float phase_inc,
+                                                      unsigned int num_points)
+{
+    double phase = 0.3;
+    volk_32fc_s32f_nco_32fc_avx2(outVector, inVector, phase_inc, &phase, num_points);
+}
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32fc_s32f_ncopuppet_32fc_neon(lv_32fc_t* outVector,
+                                                      const lv_32fc_t* inVector,
+                                                      const float phase_inc,
+                                                      unsigned int num_points)
+{
+    double phase = 0.3;
+    volk_32fc_s32f_nco_32fc_neon(outVector, inVector, phase_inc, &phase, num_points);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32FC_S32F_NCOPUPPET_32FC_H */
@@ -26,8 +26,12 @@
  * \b Overview
  *
  * Takes each the input complex vector value to the specified power
- * and stores the results in the return vector. The output is scaled
- * and converted to 16-bit shorts.
+ * and stores the results in the return vector, on the principal branch:
+ *
+ * c[i] = |a[i]|^power (cos(power arg(a[i])) + j sin(power arg(a[i])))
+ *
+ * The AVX2, AVX-512 and NEON versions raise the magnitude as
+ * volk_32f_s32f_power_32f does, in double precision.
  *
  * <b>Dispatcher Prototype</b>
  * \code
@@ -40,15 +44,28 @@
  * \li num_points: The number of samples.
  *
  * \b Outputs
- * \li cVector: The output value as 16-bit shorts.
+ * \li cVector: The output vector.
  *
  * \b Example
+ * Take the square roots of points on the unit circle.
  * \code
- * int N = 10000;
+ * int N = 8;
+ * unsigned int alignment = volk_get_alignment();
+ * lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ * lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ * for(unsigned int ii = 0; ii < N; ++ii){
+ *     in[ii] = lv_cmake(cosf(0.7f * ii), sinf(0.7f * ii));
+ * }
  *
- * volk_32fc_s32f_power_32fc();
+ * volk_32fc_s32f_power_32fc(out, in, 0.5f, N);
  *
- * volk_free(x);
+ * for(unsigned int ii = 0; ii < N; ++ii){
+ *     printf("out[%u] = %+1.3f %+1.3fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ * }
+ *
+ * volk_free(in);
+ * volk_free(out);
  * \endcode
  */
 
@@ -58,15 +75,16 @@
 #include <inttypes.h>
 #include <math.h>
 #include <stdio.h>
+#include <volk/volk_complex.h>
 
 //! raise a complex float to a real float power
 static inline lv_32fc_t __volk_s32fc_s32f_power_s32fc_a(const lv_32fc_t exp,
                                                         const float power)
 {
-    const float arg = power * atan2f(lv_creal(exp), lv_cimag(exp));
+    const float arg = power * atan2f(lv_cimag(exp), lv_creal(exp));
     const float mag =
         powf(lv_creal(exp) * lv_creal(exp) + lv_cimag(exp) * lv_cimag(exp), power / 2);
-    return mag * lv_cmake(-cosf(arg), sinf(arg));
+    return mag * lv_cmake(cosf(arg), sinf(arg));
 }
 
 #ifdef LV_HAVE_SSE
@@ -170,3 +188,132 @@ static inline void volk_32fc_s32f_power_32fc_generic(lv_32fc_t* cVector,
 
 
 #endif /* INCLUDED_volk_32fc_s32f_power_32fc_a_H */
+
+#ifndef INCLUDED_volk_32fc_s32f_power_32fc_u_H
+#define INCLUDED_volk_32fc_s32f_power_32fc_u_H
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_s32f_power_32fc_u_avx2_fma(lv_32fc_t* cVector,
+                                                        const lv_32fc_t* aVector,
+                                                        const float power,
+                                                        unsigned int num_points)
+{
+    const __m256 vPower = _mm256_set1_ps(power);
+    const __m256 halfPower = _mm256_set1_ps(power / 2);
+    __m256 cplxValue1, cplxValue2, iValue, qValue, magnitude, sine, cosine;
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_points; number += 8) {
+        cplxValue1 = _mm256_loadu_ps((const float*)(aVector + number));
+        cplxValue2 = _mm256_loadu_ps((const float*)(aVector + number + 4));
+        // points 0, 1, 4, 5, 2, 3, 6, 7, which the unpacks below undo
+        iValue = _mm256_shuffle_ps(cplxValue1, cplxValue2, _MM_SHUFFLE(2, 0, 2, 0));
+        qValue = _mm256_shuffle_ps(cplxValue1, cplxValue2, _MM_SHUFFLE(3, 1, 3, 1));
+
+        magnitude = _mm256_add_ps(_mm256_mul_ps(iValue, iValue),
+                                  _mm256_mul_ps(qValue, qValue));
+        magnitude = _mm256_pow_ps_avx2_fma(magnitude, halfPower);
+        _mm256_sincos_ps_avx2(
+            _mm256_mul_ps(vPower, _mm256_atan2_ps_avx2(qValue, iValue)), &sine, &cosine);
+        iValue = _mm256_mul_ps(magnitude, cosine);
+        qValue = _mm256_mul_ps(magnitude, sine);
+
+        _mm256_storeu_ps((float*)(cVector + number), _mm256_unpacklo_ps(iValue, qValue));
+        _mm256_storeu_ps((float*)(cVector + number + 4),
+                         _mm256_unpackhi_ps(iValue, qValue));
+    }
+
+    for (; number < num_points; number++) {
+        cVector[number] = __volk_s32fc_s32f_power_s32fc_a(aVector[number], power);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32f_power_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                       const lv_32fc_t* aVector,
+                                                       const float power,
+                                                       unsigned int num_points)
+{
+    const __m512i realIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imagIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    const __m512i lowIdx =
+        _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i highIdx =
+        _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    const __m512 vPower = _mm512_set1_ps(power);
+    const __m512 halfPower = _mm512_set1_ps(power / 2);
+    __m512 cplxValue1, cplxValue2, iValue, qValue, magnitude, sine, cosine;
+    unsigned int number = 0;
+
+    for (; number + 16 <= num_points; number += 16) {
+        cplxValue1 = _mm512_loadu_ps((const float*)(aVector + number));
+        cplxValue2 = _mm512_loadu_ps((const float*)(aVector + number + 8));
+        iValue = _mm512_permutex2var_ps(cplxValue1, realIdx, cplxValue2);
+        qValue = _mm512_permutex2var_ps(cplxValue1, imagIdx, cplxValue2);
+
+        magnitude = _mm512_add_ps(_mm512_mul_ps(iValue, iValue),
+                                  _mm512_mul_ps(qValue, qValue));
+        magnitude = _mm512_pow_ps(magnitude, halfPower);
+        _mm512_sincos_ps(
+            _mm512_mul_ps(vPower, _mm512_atan2_ps(qValue, iValue)), &sine, &cosine);
+        iValue = _mm512_mul_ps(magnitude, cosine);
+        qValue = _mm512_mul_ps(magnitude, sine);
+
+        _mm512_storeu_ps((float*)(cVector + number),
+                         _mm512_permutex2var_ps(iValue, lowIdx, qValue));
+        _mm512_storeu_ps((float*)(cVector + number + 8),
+                         _mm512_permutex2var_ps(iValue, highIdx, qValue));
+    }
+
+    for (; number < num_points; number++) {
+        cVector[number] = __volk_s32fc_s32f_power_s32fc_a(aVector[number], power);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_power_32fc_neonv8(lv_32fc_t* cVector,
+                                                    const lv_32fc_t* aVector,
+                                                    const float power,
+                                                    unsigned int num_points)
+{
+    const float32x4_t vPower = vdupq_n_f32(power);
+    const float32x4_t halfPower = vdupq_n_f32(power / 2);
+    float32x4x2_t cplxValue, sincos;
+    float32x4_t magnitude;
+    unsigned int number = 0;
+
+    for (; number + 4 <= num_points; number += 4) {
+        cplxValue = vld2q_f32((const float*)(aVector + number));
+        magnitude = _vpowq_f32(_vmagnitudesquaredq_f32(cplxValue), halfPower);
+        sincos = _vsincosq_f32(
+            vmulq_f32(vPower, _vatan2q_f32(cplxValue.val[1], cplxValue.val[0])));
+        cplxValue.val[0] = vmulq_f32(magnitude, sincos.val[1]);
+        cplxValue.val[1] = vmulq_f32(magnitude, sincos.val[0]);
+        vst2q_f32((float*)(cVector + number), cplxValue);
+    }
+
+    for (; number < num_points; number++) {
+        cVector[number] = __volk_s32fc_s32f_power_s32fc_a(aVector[number], power);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_power_32fc_u_H */
@@ -0,0 +1,153 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_s32f_x2_power_average_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_power_averagepuppet_32f_H
+#define INCLUDED_volk_32fc_s32f_power_averagepuppet_32f_H
+
+#include <volk/volk.h>
+#include <volk/volk_32fc_s32f_x2_power_average_32f.h>
+
+/*
+ * Averages two frames of the input into a fixed starting average, the first
+ * without and the second with the dB output.
+ */
+static inline void
+volk_power_average_puppet(void (*kernel)(float*,
+                                         float*,
+                                         const lv_32fc_t*,
+                                         const float,
+                                         const float,
+                                         unsigned int),
+                          float* logPowerOutput,
+                          const lv_32fc_t* complexFFTInput,
+                          const float normalizationFactor,
+                          unsigned int num_points)
+{
+    const size_t alignment = volk_get_alignment();
+    float* average = (float*)volk_malloc(sizeof(float) * num_points, alignment);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        average[number] = 0.1f * (number % 7 + 1);
+    }
+    kernel(NULL, average, complexFFTInput, normalizationFactor, 0.5f, num_points);
+    kernel(
+        logPowerOutput, average, complexFFTInput, normalizationFactor, 0.25f, num_points);
+
+    volk_free(average);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_s32f_power_averagepuppet_32f_generic(float* logPowerOutput,
+                                               const lv_32fc_t* complexFFTInput,
+                                               const float normalizationFactor,
+                                               unsigned int num_points)
+{
+    volk_power_average_puppet(volk_32fc_s32f_x2_power_average_32f_generic,
+                              logPowerOutput,
+                              complexFFTInput,
+                              normalizationFactor,
+                              num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+
+static inline void
+volk_32fc_s32f_power_averagepuppet_32f_u_sse3(float* logPowerOutput,
+                                              const lv_32fc_t* complexFFTInput,
+                                              const float normalizationFactor,
+                                              unsigned int num_points)
+{
+    volk_power_average_puppet(volk_32fc_s32f_x2_power_average_32f_u_sse3,
+                              logPowerOutput,
+                              complexFFTInput,
+                              normalizationFactor,
+                              num_points);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_32fc_s32f_power_averagepuppet_32f_u_avx2(float* logPowerOutput,
+                                              const lv_32fc_t* complexFFTInput,
+                                              const float normalizationFactor,
+                                              unsigned int num_points)
+{
+    volk_power_average_puppet(volk_32fc_s32f_x2_power_average_32f_u_avx2,
+                              logPowerOutput,
+                              complexFFTInput,
+                              normalizationFactor,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_s32f_power_averagepuppet_32f_u_avx512f(float* logPowerOutput,
+                                                 const lv_32fc_t* complexFFTInput,
+                                                 const float normalizationFactor,
+                                                 unsigned int num_points)
+{
+    volk_power_average_puppet(volk_32fc_s32f_x2_power_average_32f_u_avx512f,
+                              logPowerOutput,
+                              complexFFTInput,
+                              normalizationFactor,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_s32f_power_averagepuppet_32f_neon(float* logPowerOutput,
+                                            const lv_32fc_t* complexFFTInput,
+                                            const float normalizationFactor,
+                                            unsigned int num_points)
+{
+    volk_power_average_puppet(volk_32fc_s32f_x2_power_average_32f_neon,
+                              logPowerOutput,
+                              complexFFTInput,
+                              normalizationFactor,
+                              num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_power_averagepuppet_32f_H */
@@ -105,10 +105,7 @@ volk_32fc_s32f_power_spectrum_32f_generic(float* logPowerOutput,
 
 #ifdef LV_HAVE_SSE3
 #include <pmmintrin.h>
-
-#ifdef LV_HAVE_LIB_SIMDMATH
-#include <simdmath.h>
-#endif /* LV_HAVE_LIB_SIMDMATH */
+#include <volk/volk_sse3_intrinsics.h>
 
 static inline void
 volk_32fc_s32f_power_spectrum_32f_a_sse3(float* logPowerOutput,
@@ -118,70 +115,174 @@ volk_32fc_s32f_power_spectrum_32f_a_sse3(float* logPowerOutput,
 {
     const float* inputPtr = (const float*)complexFFTInput;
     float* destPtr = logPowerOutput;
-    uint64_t number = 0;
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
     const float iNormalizationFactor = 1.0 / normalizationFactor;
-#ifdef LV_HAVE_LIB_SIMDMATH
-    __m128 magScalar = _mm_set_ps1(10.0);
-    magScalar = _mm_div_ps(magScalar, logf4(magScalar));
 
-    __m128 invNormalizationFactor = _mm_set_ps1(iNormalizationFactor);
+    const __m128 invNormalizationFactor = _mm_set1_ps(iNormalizationFactor);
+    const __m128 log2to10 = _mm_set1_ps(volk_log2to10factor);
+    __m128 input1, input2, power;
 
-    __m128 power;
-    __m128 input1, input2;
-    const uint64_t quarterPoints = num_points / 4;
     for (; number < quarterPoints; number++) {
-        // Load the complex values
-        input1 = _mm_load_ps(inputPtr);
-        inputPtr += 4;
-        input2 = _mm_load_ps(inputPtr);
-        inputPtr += 4;
-
-        // Apply the normalization factor
-        input1 = _mm_mul_ps(input1, invNormalizationFactor);
-        input2 = _mm_mul_ps(input2, invNormalizationFactor);
-
-        // Multiply each value by itself
-        // (r1*r1), (i1*i1), (r2*r2), (i2*i2)
-        input1 = _mm_mul_ps(input1, input1);
-        // (r3*r3), (i3*i3), (r4*r4), (i4*i4)
-        input2 = _mm_mul_ps(input2, input2);
-
-        // Horizontal add, to add (r*r) + (i*i) for each complex value
-        // (r1*r1)+(i1*i1), (r2*r2) + (i2*i2), (r3*r3)+(i3*i3), (r4*r4)+(i4*i4)
-        power = _mm_hadd_ps(input1, input2);
-
-        // Calculate the natural log power
-        power = logf4(power);
+        // Load the complex values and apply the normalization factor
+        input1 = _mm_mul_ps(_mm_load_ps(inputPtr), invNormalizationFactor);
+        input2 = _mm_mul_ps(_mm_load_ps(inputPtr + 4), invNormalizationFactor);
+        inputPtr += 8;
 
-        // Convert to log10 and multiply by 10.0
-        power = _mm_mul_ps(power, magScalar);
-
-        // Store the floating point results
-        _mm_store_ps(destPtr, power);
+        // (r1*r1)+(i1*i1), (r2*r2) + (i2*i2), (r3*r3)+(i3*i3), (r4*r4)+(i4*i4)
+        power = _mm_magnitudesquared_ps_sse3(input1, input2);
 
+        // 10 * log10(x) = (10 / log2(10)) * log2(x)
+        _mm_store_ps(destPtr, _mm_mul_ps(_mm_log2_ps_sse3(power), log2to10));
         destPtr += 4;
     }
 
     number = quarterPoints * 4;
-#endif /* LV_HAVE_LIB_SIMDMATH */
-    // Calculate the FFT for any remaining points
+    for (; number < num_points; number++) {
+        const float real = *inputPtr++ * iNormalizationFactor;
+        const float imag = *inputPtr++ * iNormalizationFactor;
+
+        *destPtr = volk_log2to10factor * log2f_non_ieee(((real * real) + (imag * imag)));
+        destPtr++;
+    }
+}
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_power_spectrum_32f_a_avx(float* logPowerOutput,
+                                        const lv_32fc_t* complexFFTInput,
+                                        const float normalizationFactor,
+                                        unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* destPtr = logPowerOutput;
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    const float iNormalizationFactor = 1.0 / normalizationFactor;
 
+    const __m256 invNormalizationFactor = _mm256_set1_ps(iNormalizationFactor);
+    const __m256 log2to10 = _mm256_set1_ps(volk_log2to10factor);
+    __m256 input1, input2, power;
+    __m128 log_lo, log_hi;
+
+    for (; number < eighthPoints; number++) {
+        input1 = _mm256_mul_ps(_mm256_load_ps(inputPtr), invNormalizationFactor);
+        input2 = _mm256_mul_ps(_mm256_load_ps(inputPtr + 8), invNormalizationFactor);
+        inputPtr += 16;
+
+        input1 = _mm256_mul_ps(input1, input1);
+        input2 = _mm256_mul_ps(input2, input2);
+        // pair up the lanes so that the horizontal add keeps the points in order
+        power = _mm256_hadd_ps(_mm256_permute2f128_ps(input1, input2, 0x20),
+                               _mm256_permute2f128_ps(input1, input2, 0x31));
+
+        // AVX has no 256 bit integer ops, the exponent is taken per 128 bit half
+        log_lo = _mm_log2_ps_sse3(_mm256_castps256_ps128(power));
+        log_hi = _mm_log2_ps_sse3(_mm256_extractf128_ps(power, 1));
+        power = _mm256_insertf128_ps(_mm256_castps128_ps256(log_lo), log_hi, 1);
+
+        _mm256_store_ps(destPtr, _mm256_mul_ps(power, log2to10));
+        destPtr += 8;
+    }
+
+    number = eighthPoints * 8;
     for (; number < num_points; number++) {
-        // Calculate dBm
-        // 50 ohm load assumption
-        // 10 * log10 (v^2 / (2 * 50.0 * .001)) = 10 * log10( v^2 * 10)
-        // 75 ohm load assumption
-        // 10 * log10 (v^2 / (2 * 75.0 * .001)) = 10 * log10( v^2 * 15)
+        const float real = *inputPtr++ * iNormalizationFactor;
+        const float imag = *inputPtr++ * iNormalizationFactor;
 
+        *destPtr = volk_log2to10factor * log2f_non_ieee(((real * real) + (imag * imag)));
+        destPtr++;
+    }
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_power_spectrum_32f_a_avx2(float* logPowerOutput,
+                                         const lv_32fc_t* complexFFTInput,
+                                         const float normalizationFactor,
+                                         unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* destPtr = logPowerOutput;
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+    const float iNormalizationFactor = 1.0 / normalizationFactor;
+
+    const __m256 invNormalizationFactor = _mm256_set1_ps(iNormalizationFactor);
+    const __m256 log2to10 = _mm256_set1_ps(volk_log2to10factor);
+    __m256 input1, input2, power;
+
+    for (; number < eighthPoints; number++) {
+        input1 = _mm256_mul_ps(_mm256_load_ps(inputPtr), invNormalizationFactor);
+        input2 = _mm256_mul_ps(_mm256_load_ps(inputPtr + 8), invNormalizationFactor);
+        inputPtr += 16;
+
+        power = _mm256_magnitudesquared_ps_avx2(input1, input2);
+
+        _mm256_store_ps(destPtr, _mm256_mul_ps(_mm256_log2_ps_avx2(power), log2to10));
+        destPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
         const float real = *inputPtr++ * iNormalizationFactor;
         const float imag = *inputPtr++ * iNormalizationFactor;
 
         *destPtr = volk_log2to10factor * log2f_non_ieee(((real * real) + (imag * imag)));
+        destPtr++;
+    }
+}
+#endif /* LV_HAVE_AVX2 */
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_power_spectrum_32f_a_avx512f(float* logPowerOutput,
+                                            const lv_32fc_t* complexFFTInput,
+                                            const float normalizationFactor,
+                                            unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* destPtr = logPowerOutput;
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float iNormalizationFactor = 1.0 / normalizationFactor;
+
+    const __m512 invNormalizationFactor = _mm512_set1_ps(iNormalizationFactor);
+    const __m512 log2to10 = _mm512_set1_ps(volk_log2to10factor);
+    __m512 input1, input2, power;
+
+    for (; number < sixteenthPoints; number++) {
+        input1 = _mm512_mul_ps(_mm512_load_ps(inputPtr), invNormalizationFactor);
+        input2 = _mm512_mul_ps(_mm512_load_ps(inputPtr + 16), invNormalizationFactor);
+        inputPtr += 32;
+
+        power = _mm512_magnitudesquared_ps(input1, input2);
+
+        _mm512_store_ps(destPtr, _mm512_mul_ps(_mm512_log2_ps(power), log2to10));
+        destPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const float real = *inputPtr++ * iNormalizationFactor;
+        const float imag = *inputPtr++ * iNormalizationFactor;
+
+        *destPtr = volk_log2to10factor * log2f_non_ieee(((real * real) + (imag * imag)));
         destPtr++;
     }
 }
-#endif /* LV_HAVE_SSE3 */
+#endif /* LV_HAVE_AVX512F */
 
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
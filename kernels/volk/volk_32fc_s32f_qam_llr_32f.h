@@ -0,0 +1,279 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32f_qam_llr_32f
+ *
+ * \b Overview
+ *
+ * Soft demaps Gray-mapped square QAM symbols: writes the max-log
+ * log-likelihood ratios of the bits of each symbol, log(P(0) / P(1)), so a
+ * positive ratio favours a 0 bit.
+ *
+ * The constellation is the one of 3GPP TS 36.211 for QPSK, 16QAM, 64QAM and
+ * 256QAM, normalized to unit average energy, with the bits of a symbol
+ * alternating between the I and Q axes: the first two bits are the signs of
+ * I and Q, the next two pick between the inner and the outer halves of each
+ * axis, and so on. Each axis is demapped with the simplified piecewise-linear
+ * max-log ratios, which keep the signs of the exact ones and only depart from
+ * them towards the outer points; in units of half the distance between points
+ *
+ * L1 = x, L2 = 2^(m-1) - |L1|, L3 = 2^(m-2) - |L2|, ..., Lm = 2 - |Lm-1|
+ *
+ * for an axis of 2^m levels. The ratios are scaled to 4 L / (norm N0), norm
+ * being the energy of the unnormalized constellation (2, 10, 42 and 170 from
+ * QPSK to 256QAM) and the noise variance N0 given as scale = 1 / N0.
+ *
+ * Each ratio is one subtraction and one absolute value from the one before,
+ * so the SIMD versions compute them for a vector of symbols at a time and
+ * write each pair of I and Q ratios to its place in the output.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_qam_llr_32f(float* llrs, const lv_32fc_t* symbols, const float
+ * scale, unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li symbols: The equalized symbols.
+ * \li scale: The inverse of the noise variance per symbol, 1 / N0.
+ * \li bits: The bits per symbol, 2, 4, 6 or 8 (any even number of up to 16).
+ * \li num_points: The number of symbols.
+ *
+ * \b Outputs
+ * \li llrs: The bits * num_points log-likelihood ratios, symbol by symbol.
+ *
+ * \b Example
+ * Demap a block of 16QAM symbols.
+ * \code
+ *   int N = 1200;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* symbols = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* llrs = (float*)volk_malloc(sizeof(float)*4*N, alignment);
+ *   float noise_variance = 0.05f;
+ *
+ *   // equalize the resource elements into symbols, then
+ *   volk_32fc_s32f_qam_llr_32f(llrs, symbols, 1.f / noise_variance, 4, N);
+ *
+ *   volk_free(symbols);
+ *   volk_free(llrs);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_qam_llr_32f_H
+#define INCLUDED_volk_32fc_s32f_qam_llr_32f_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/*
+ * The factor from the normalized constellation to the units of half the
+ * distance between points, and the factor from those units to ratios
+ */
+static inline void volk_qam_llr_factors(unsigned int bits,
+                                        const float scale,
+                                        float* amplitude,
+                                        float* gain)
+{
+    /* the average energy of the constellation with points at odd coordinates */
+    const float norm = 2.f * (float)((1u << bits) - 1) / 3.f;
+
+    *amplitude = sqrtf(norm);
+    *gain = 4.f * scale / norm;
+}
+
+/* Demaps one symbol */
+static inline void volk_qam_llr_symbol(float* llrs,
+                                       lv_32fc_t symbol,
+                                       float amplitude,
+                                       float gain,
+                                       unsigned int bits)
+{
+    float i = lv_creal(symbol) * amplitude, q = lv_cimag(symbol) * amplitude;
+    float level = (float)(1u << (bits / 2 - 1));
+    unsigned int bit;
+
+    llrs[0] = i * gain;
+    llrs[1] = q * gain;
+    for (bit = 2; bit < bits; bit += 2) {
+        i = level - fabsf(i);
+        q = level - fabsf(q);
+        llrs[bit] = i * gain;
+        llrs[bit + 1] = q * gain;
+        level *= 0.5f;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_qam_llr_32f_generic(float* llrs,
+                                                      const lv_32fc_t* symbols,
+                                                      const float scale,
+                                                      unsigned int bits,
+                                                      unsigned int num_points)
+{
+    float amplitude, gain;
+    unsigned int number;
+
+    volk_qam_llr_factors(bits, scale, &amplitude, &gain);
+    for (number = 0; number < num_points; number++) {
+        volk_qam_llr_symbol(llrs + number * bits, symbols[number], amplitude, gain, bits);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_s32f_qam_llr_32f_u_sse(float* llrs,
+                                                    const lv_32fc_t* symbols,
+                                                    const float scale,
+                                                    unsigned int bits,
+                                                    unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    const __m128 signMask = _mm_set1_ps(-0.f);
+    __m128 amplitudes, gains, values, ratios;
+    float amplitude, gain, level;
+    float* out = llrs;
+    unsigned int number, bit;
+
+    volk_qam_llr_factors(bits, scale, &amplitude, &gain);
+    amplitudes = _mm_set1_ps(amplitude);
+    gains = _mm_set1_ps(gain);
+
+    for (number = 0; number < halfPoints; number++) {
+        values = _mm_mul_ps(_mm_loadu_ps((const float*)(symbols + 2 * number)),
+                            amplitudes);
+        level = (float)(1u << (bits / 2 - 1));
+        for (bit = 0; bit < bits; bit += 2) {
+            if (bit > 0) {
+                values = _mm_sub_ps(_mm_set1_ps(level), _mm_andnot_ps(signMask, values));
+                level *= 0.5f;
+            }
+            ratios = _mm_mul_ps(values, gains);
+            _mm_storel_pi((__m64*)(out + bit), ratios);
+            _mm_storeh_pi((__m64*)(out + bits + bit), ratios);
+        }
+        out += 2 * bits;
+    }
+
+    for (number = halfPoints * 2; number < num_points; number++) {
+        volk_qam_llr_symbol(llrs + number * bits, symbols[number], amplitude, gain, bits);
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_qam_llr_32f_u_avx(float* llrs,
+                                                    const lv_32fc_t* symbols,
+                                                    const float scale,
+                                                    unsigned int bits,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+    __m256 amplitudes, gains, values, ratios;
+    __m128 low, high;
+    float amplitude, gain, level;
+    float* out = llrs;
+    unsigned int number, bit;
+
+    volk_qam_llr_factors(bits, scale, &amplitude, &gain);
+    amplitudes = _mm256_set1_ps(amplitude);
+    gains = _mm256_set1_ps(gain);
+
+    for (number = 0; number < quarterPoints; number++) {
+        values = _mm256_mul_ps(_mm256_loadu_ps((const float*)(symbols + 4 * number)),
+                               amplitudes);
+        level = (float)(1u << (bits / 2 - 1));
+        for (bit = 0; bit < bits; bit += 2) {
+            if (bit > 0) {
+                values = _mm256_sub_ps(_mm256_set1_ps(level),
+                                       _mm256_andnot_ps(signMask, values));
+                level *= 0.5f;
+            }
+            ratios = _mm256_mul_ps(values, gains);
+            low = _mm256_castps256_ps128(ratios);
+            high = _mm256_extractf128_ps(ratios, 1);
+            _mm_storel_pi((__m64*)(out + bit), low);
+            _mm_storeh_pi((__m64*)(out + bits + bit), low);
+            _mm_storel_pi((__m64*)(out + 2 * bits + bit), high);
+            _mm_storeh_pi((__m64*)(out + 3 * bits + bit), high);
+        }
+        out += 4 * bits;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        volk_qam_llr_symbol(llrs + number * bits, symbols[number], amplitude, gain, bits);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_qam_llr_32f_neon(float* llrs,
+                                                   const lv_32fc_t* symbols,
+                                                   const float scale,
+                                                   unsigned int bits,
+                                                   unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    float32x4_t values, ratios;
+    float amplitude, gain, level;
+    float* out = llrs;
+    unsigned int number, bit;
+
+    volk_qam_llr_factors(bits, scale, &amplitude, &gain);
+
+    for (number = 0; number < halfPoints; number++) {
+        values = vmulq_n_f32(vld1q_f32((const float*)(symbols + 2 * number)), amplitude);
+        level = (float)(1u << (bits / 2 - 1));
+        for (bit = 0; bit < bits; bit += 2) {
+            if (bit > 0) {
+                values = vsubq_f32(vdupq_n_f32(level), vabsq_f32(values));
+                level *= 0.5f;
+            }
+            ratios = vmulq_n_f32(values, gain);
+            vst1_f32(out + bit, vget_low_f32(ratios));
+            vst1_f32(out + bits + bit, vget_high_f32(ratios));
+        }
+        out += 2 * bits;
+    }
+
+    for (number = halfPoints * 2; number < num_points; number++) {
+        volk_qam_llr_symbol(llrs + number * bits, symbols[number], amplitude, gain, bits);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_qam_llr_32f_H */
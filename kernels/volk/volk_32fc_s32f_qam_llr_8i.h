@@ -0,0 +1,236 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32f_qam_llr_8i
+ *
+ * \b Overview
+ *
+ * Soft demaps Gray-mapped square QAM symbols into 8 bit log-likelihood
+ * ratios, for decoders taking 8 bit soft bits. The ratios are those of
+ * volk_32fc_s32f_qam_llr_32f, rounded to the nearest integer and saturated
+ * to [-127, 127] so they can be negated without overflow; scale sets how
+ * many steps of the 8 bit range a unit of 1 / N0 takes.
+ *
+ * The SIMD versions demap a block of symbols into float ratios on the stack
+ * and convert the block with saturating packs.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_qam_llr_8i(int8_t* llrs, const lv_32fc_t* symbols, const float
+ * scale, unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li symbols: The equalized symbols.
+ * \li scale: The factor of the ratios, e.g. 8 / N0 for 8 steps per unit.
+ * \li bits: The bits per symbol, 2, 4, 6 or 8 (any even number of up to 16).
+ * \li num_points: The number of symbols.
+ *
+ * \b Outputs
+ * \li llrs: The bits * num_points saturated ratios, symbol by symbol.
+ *
+ * \b Example
+ * Demap 64QAM symbols for an 8 bit decoder.
+ * \code
+ *   int N = 1200;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* symbols = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   int8_t* llrs = (int8_t*)volk_malloc(6*N, alignment);
+ *   float noise_variance = 0.02f;
+ *
+ *   // equalize the resource elements into symbols, then
+ *   volk_32fc_s32f_qam_llr_8i(llrs, symbols, 8.f / noise_variance, 6, N);
+ *
+ *   volk_free(symbols);
+ *   volk_free(llrs);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_qam_llr_8i_H
+#define INCLUDED_volk_32fc_s32f_qam_llr_8i_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_32fc_s32f_qam_llr_32f.h>
+#include <volk/volk_common.h>
+
+/* The float ratios a SIMD block holds */
+#define VOLK_QAM_LLR_BLOCK 256
+
+static inline int8_t volk_qam_llr_saturate(float ratio)
+{
+    ratio = ratio < 127.f ? ratio : 127.f;
+    ratio = ratio > -127.f ? ratio : -127.f;
+    return (int8_t)rintf(ratio);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_qam_llr_8i_generic(int8_t* llrs,
+                                                     const lv_32fc_t* symbols,
+                                                     const float scale,
+                                                     unsigned int bits,
+                                                     unsigned int num_points)
+{
+    float amplitude, gain, ratios[16];
+    unsigned int number, bit;
+
+    volk_qam_llr_factors(bits, scale, &amplitude, &gain);
+    for (number = 0; number < num_points; number++) {
+        volk_qam_llr_symbol(ratios, symbols[number], amplitude, gain, bits);
+        for (bit = 0; bit < bits; bit++) {
+            llrs[number * bits + bit] = volk_qam_llr_saturate(ratios[bit]);
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32fc_s32f_qam_llr_8i_u_sse2(int8_t* llrs,
+                                                    const lv_32fc_t* symbols,
+                                                    const float scale,
+                                                    unsigned int bits,
+                                                    unsigned int num_points)
+{
+    const unsigned int block = VOLK_QAM_LLR_BLOCK / bits;
+    const __m128 upper = _mm_set1_ps(127.f), lower = _mm_set1_ps(-127.f);
+    __VOLK_ATTR_ALIGNED(16) float ratios[VOLK_QAM_LLR_BLOCK];
+    __m128i words[4];
+    __m128 values;
+    unsigned int number, points, count, index, lane;
+    int8_t* out;
+
+    for (number = 0; number < num_points; number += points) {
+        points = num_points - number < block ? num_points - number : block;
+        volk_32fc_s32f_qam_llr_32f_u_sse(ratios, symbols + number, scale, bits, points);
+        count = points * bits;
+        out = llrs + number * bits;
+        for (index = 0; count - index >= 16; index += 16) {
+            for (lane = 0; lane < 4; lane++) {
+                values = _mm_load_ps(ratios + index + 4 * lane);
+                values = _mm_max_ps(_mm_min_ps(values, upper), lower);
+                words[lane] = _mm_cvtps_epi32(values);
+            }
+            _mm_storeu_si128((__m128i*)(out + index),
+                             _mm_packs_epi16(_mm_packs_epi32(words[0], words[1]),
+                                             _mm_packs_epi32(words[2], words[3])));
+        }
+        for (; index < count; index++) {
+            out[index] = volk_qam_llr_saturate(ratios[index]);
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_qam_llr_8i_u_avx2(int8_t* llrs,
+                                                    const lv_32fc_t* symbols,
+                                                    const float scale,
+                                                    unsigned int bits,
+                                                    unsigned int num_points)
+{
+    const unsigned int block = VOLK_QAM_LLR_BLOCK / bits;
+    const __m256 upper = _mm256_set1_ps(127.f), lower = _mm256_set1_ps(-127.f);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    __VOLK_ATTR_ALIGNED(32) float ratios[VOLK_QAM_LLR_BLOCK];
+    __m256i words[4], bytes;
+    __m256 values;
+    unsigned int number, points, count, index, lane;
+    int8_t* out;
+
+    for (number = 0; number < num_points; number += points) {
+        points = num_points - number < block ? num_points - number : block;
+        volk_32fc_s32f_qam_llr_32f_u_avx(ratios, symbols + number, scale, bits, points);
+        count = points * bits;
+        out = llrs + number * bits;
+        for (index = 0; count - index >= 32; index += 32) {
+            for (lane = 0; lane < 4; lane++) {
+                values = _mm256_load_ps(ratios + index + 8 * lane);
+                values = _mm256_max_ps(_mm256_min_ps(values, upper), lower);
+                words[lane] = _mm256_cvtps_epi32(values);
+            }
+            /* the packs interleave the 128 bit lanes, put the words back in order */
+            bytes = _mm256_packs_epi16(_mm256_packs_epi32(words[0], words[1]),
+                                       _mm256_packs_epi32(words[2], words[3]));
+            _mm256_storeu_si256((__m256i*)(out + index),
+                                _mm256_permutevar8x32_epi32(bytes, order));
+        }
+        for (; index < count; index++) {
+            out[index] = volk_qam_llr_saturate(ratios[index]);
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_qam_llr_8i_neonv8(int8_t* llrs,
+                                                    const lv_32fc_t* symbols,
+                                                    const float scale,
+                                                    unsigned int bits,
+                                                    unsigned int num_points)
+{
+    const unsigned int block = VOLK_QAM_LLR_BLOCK / bits;
+    const float32x4_t upper = vdupq_n_f32(127.f), lower = vdupq_n_f32(-127.f);
+    float ratios[VOLK_QAM_LLR_BLOCK];
+    int32x4_t words[4];
+    float32x4_t values;
+    unsigned int number, points, count, index, lane;
+    int8_t* out;
+
+    for (number = 0; number < num_points; number += points) {
+        points = num_points - number < block ? num_points - number : block;
+        volk_32fc_s32f_qam_llr_32f_neon(ratios, symbols + number, scale, bits, points);
+        count = points * bits;
+        out = llrs + number * bits;
+        for (index = 0; count - index >= 16; index += 16) {
+            for (lane = 0; lane < 4; lane++) {
+                values = vld1q_f32(ratios + index + 4 * lane);
+                values = vmaxq_f32(vminq_f32(values, upper), lower);
+                words[lane] = vcvtnq_s32_f32(values);
+            }
+            vst1q_s8(out + index,
+                     vcombine_s8(vqmovn_s16(vcombine_s16(vqmovn_s32(words[0]),
+                                                         vqmovn_s32(words[1]))),
+                                 vqmovn_s16(vcombine_s16(vqmovn_s32(words[2]),
+                                                         vqmovn_s32(words[3])))));
+        }
+        for (; index < count; index++) {
+            out[index] = volk_qam_llr_saturate(ratios[index]);
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_qam_llr_8i_H */
@@ -0,0 +1,123 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_s32f_qam_llr_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_qam_llrpuppet_32f_H
+#define INCLUDED_volk_32fc_s32f_qam_llrpuppet_32f_H
+
+#include <string.h>
+#include <volk/volk_32fc_s32f_qam_llr_32f.h>
+
+/*
+ * Demaps four runs of num_points / 20 symbols, as QPSK, 16QAM, 64QAM and
+ * 256QAM, into the first 20 * (num_points / 20) outputs.
+ */
+static inline void volk_32fc_qam_llr_puppet_32f(
+    void (*kernel)(float*, const lv_32fc_t*, const float, unsigned int, unsigned int),
+    float* llrs,
+    const lv_32fc_t* symbols,
+    const float scale,
+    unsigned int num_points)
+{
+    const unsigned int run = num_points / 20;
+    unsigned int bits;
+
+    memset(llrs, 0, sizeof(float) * num_points);
+    for (bits = 2; bits <= 8; bits += 2) {
+        kernel(llrs, symbols, scale, bits, run);
+        llrs += bits * run;
+        symbols += run;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_qam_llrpuppet_32f_generic(float* llrs,
+                                                            const lv_32fc_t* symbols,
+                                                            const float scale,
+                                                            unsigned int num_points)
+{
+    volk_32fc_qam_llr_puppet_32f(volk_32fc_s32f_qam_llr_32f_generic,
+                                 llrs,
+                                 symbols,
+                                 scale,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32fc_s32f_qam_llrpuppet_32f_u_sse(float* llrs,
+                                                          const lv_32fc_t* symbols,
+                                                          const float scale,
+                                                          unsigned int num_points)
+{
+    volk_32fc_qam_llr_puppet_32f(volk_32fc_s32f_qam_llr_32f_u_sse,
+                                 llrs,
+                                 symbols,
+                                 scale,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_s32f_qam_llrpuppet_32f_u_avx(float* llrs,
+                                                          const lv_32fc_t* symbols,
+                                                          const float scale,
+                                                          unsigned int num_points)
+{
+    volk_32fc_qam_llr_puppet_32f(volk_32fc_s32f_qam_llr_32f_u_avx,
+                                 llrs,
+                                 symbols,
+                                 scale,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_s32f_qam_llrpuppet_32f_neon(float* llrs,
+                                                         const lv_32fc_t* symbols,
+                                                         const float scale,
+                                                         unsigned int num_points)
+{
+    volk_32fc_qam_llr_puppet_32f(volk_32fc_s32f_qam_llr_32f_neon,
+                                 llrs,
+                                 symbols,
+                                 scale,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_qam_llrpuppet_32f_H */
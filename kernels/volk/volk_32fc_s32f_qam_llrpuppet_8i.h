@@ -0,0 +1,124 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_s32f_qam_llr_8i.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_qam_llrpuppet_8i_H
+#define INCLUDED_volk_32fc_s32f_qam_llrpuppet_8i_H
+
+#include <string.h>
+#include <volk/volk_32fc_s32f_qam_llr_8i.h>
+
+/*
+ * Demaps four runs of num_points / 20 symbols, as QPSK, 16QAM, 64QAM and
+ * 256QAM, into the first 20 * (num_points / 20) outputs, with a sixteenth of
+ * the scale to keep most ratios off the rails.
+ */
+static inline void volk_32fc_qam_llr_puppet_8i(
+    void (*kernel)(int8_t*, const lv_32fc_t*, const float, unsigned int, unsigned int),
+    int8_t* llrs,
+    const lv_32fc_t* symbols,
+    const float scale,
+    unsigned int num_points)
+{
+    const unsigned int run = num_points / 20;
+    unsigned int bits;
+
+    memset(llrs, 0, sizeof(int8_t) * num_points);
+    for (bits = 2; bits <= 8; bits += 2) {
+        kernel(llrs, symbols, scale / 16.f, bits, run);
+        llrs += bits * run;
+        symbols += run;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_qam_llrpuppet_8i_generic(int8_t* llrs,
+                                                           const lv_32fc_t* symbols,
+                                                           const float scale,
+                                                           unsigned int num_points)
+{
+    volk_32fc_qam_llr_puppet_8i(volk_32fc_s32f_qam_llr_8i_generic,
+                                llrs,
+                                symbols,
+                                scale,
+                                num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_32fc_s32f_qam_llrpuppet_8i_u_sse2(int8_t* llrs,
+                                                          const lv_32fc_t* symbols,
+                                                          const float scale,
+                                                          unsigned int num_points)
+{
+    volk_32fc_qam_llr_puppet_8i(volk_32fc_s32f_qam_llr_8i_u_sse2,
+                                llrs,
+                                symbols,
+                                scale,
+                                num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_s32f_qam_llrpuppet_8i_u_avx2(int8_t* llrs,
+                                                          const lv_32fc_t* symbols,
+                                                          const float scale,
+                                                          unsigned int num_points)
+{
+    volk_32fc_qam_llr_puppet_8i(volk_32fc_s32f_qam_llr_8i_u_avx2,
+                                llrs,
+                                symbols,
+                                scale,
+                                num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_s32f_qam_llrpuppet_8i_neonv8(int8_t* llrs,
+                                                          const lv_32fc_t* symbols,
+                                                          const float scale,
+                                                          unsigned int num_points)
+{
+    volk_32fc_qam_llr_puppet_8i(volk_32fc_s32f_qam_llr_8i_neonv8,
+                                llrs,
+                                symbols,
+                                scale,
+                                num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_qam_llrpuppet_8i_H */
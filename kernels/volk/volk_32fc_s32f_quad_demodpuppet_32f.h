@@ -0,0 +1,126 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_s32f_x2_quad_demod_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_quad_demodpuppet_32f_H
+#define INCLUDED_volk_32fc_s32f_quad_demodpuppet_32f_H
+
+#include <volk/volk_32fc_s32f_x2_quad_demod_32f.h>
+
+/* Demodulates the samples in two calls, which carry the last sample over. */
+static inline void volk_quad_demod_puppet(void (*kernel)(float*,
+                                                         const lv_32fc_t*,
+                                                         const float,
+                                                         lv_32fc_t*,
+                                                         unsigned int),
+                                          float* outputVector,
+                                          const lv_32fc_t* inputVector,
+                                          const float gain,
+                                          unsigned int num_points)
+{
+    lv_32fc_t lastSample = lv_cmake(0.6f, -0.8f);
+
+    kernel(outputVector, inputVector, gain, &lastSample, num_points / 3);
+    kernel(outputVector + num_points / 3,
+           inputVector + num_points / 3,
+           gain,
+           &lastSample,
+           num_points - num_points / 3);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_s32f_quad_demodpuppet_32f_generic(float* outputVector,
+                                            const lv_32fc_t* inputVector,
+                                            const float gain,
+                                            unsigned int num_points)
+{
+    volk_quad_demod_puppet(volk_32fc_s32f_x2_quad_demod_32f_generic,
+                           outputVector,
+                           inputVector,
+                           gain,
+                           num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_32fc_s32f_quad_demodpuppet_32f_u_avx2(float* outputVector,
+                                           const lv_32fc_t* inputVector,
+                                           const float gain,
+                                           unsigned int num_points)
+{
+    volk_quad_demod_puppet(volk_32fc_s32f_x2_quad_demod_32f_u_avx2,
+                           outputVector,
+                           inputVector,
+                           gain,
+                           num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_s32f_quad_demodpuppet_32f_u_avx512f(float* outputVector,
+                                              const lv_32fc_t* inputVector,
+                                              const float gain,
+                                              unsigned int num_points)
+{
+    volk_quad_demod_puppet(volk_32fc_s32f_x2_quad_demod_32f_u_avx512f,
+                           outputVector,
+                           inputVector,
+                           gain,
+                           num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void
+volk_32fc_s32f_quad_demodpuppet_32f_neonv8(float* outputVector,
+                                           const lv_32fc_t* inputVector,
+                                           const float gain,
+                                           unsigned int num_points)
+{
+    volk_quad_demod_puppet(volk_32fc_s32f_x2_quad_demod_32f_neonv8,
+                           outputVector,
+                           inputVector,
+                           gain,
+                           num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_quad_demodpuppet_32f_H */
@@ -0,0 +1,262 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32f_x2_add_awgn_32fc
+ *
+ * \b Overview
+ *
+ * Adds white Gaussian noise to a complex signal for a given signal to noise
+ * ratio:
+ *
+ * outputVector[n] = inputVector[n] + sigma * g[n]
+ * sigma = sqrt(signal_power * 10^(-snr_db / 10))
+ *
+ * where g[n] are the unit power points volk_32fc_rand_gaussian_32fc would
+ * draw from the state, so the noise has a power of signal_power divided by
+ * the SNR. The noise is drawn in the same pass, without a buffer for it.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_x2_add_awgn_32fc(lv_32fc_t* outputVector, const lv_32fc_t*
+ * inputVector, const float snr_db, const float signal_power, uint32_t* state,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The signal.
+ * \li snr_db: The signal to noise ratio in dB.
+ * \li signal_power: The power of the signal the SNR refers to, 1 for a unit
+ * power constellation.
+ * \li state: VOLK_RAND_STATE_WORDS words set up by volk_rand_seed().
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The signal with the noise, may be inputVector.
+ * \li state: The generators, to carry into the next buffer.
+ *
+ * \b Example
+ * Pass QPSK symbols of unit power through a channel at 6 dB SNR.
+ * \code
+ *   uint32_t state[VOLK_RAND_STATE_WORDS];
+ *
+ *   volk_rand_seed(state, 1);
+ *   volk_32fc_s32f_x2_add_awgn_32fc(received, symbols, 6.f, 1.f, state, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_x2_add_awgn_32fc_H
+#define INCLUDED_volk_32fc_s32f_x2_add_awgn_32fc_H
+
+#include <math.h>
+#include <volk/volk_32fc_rand_gaussian_32fc.h>
+
+static inline float volk_awgn_sigma(float snr_db, float signal_power)
+{
+    return sqrtf(signal_power * powf(10.f, -0.1f * snr_db));
+}
+
+/* Adds noise to points from generator 0 on. */
+static inline void volk_awgn_points(lv_32fc_t* outputVector,
+                                    const lv_32fc_t* inputVector,
+                                    float sigma,
+                                    uint32_t* state,
+                                    unsigned int num_points)
+{
+    unsigned int number;
+    lv_32fc_t g;
+
+    for (number = 0; number < num_points; number++) {
+        g = volk_rand_gaussian(state, number % VOLK_RAND_LANES);
+        outputVector[number] =
+            lv_cmake(lv_creal(inputVector[number]) + sigma * lv_creal(g),
+                     lv_cimag(inputVector[number]) + sigma * lv_cimag(g));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_x2_add_awgn_32fc_generic(lv_32fc_t* outputVector,
+                                                           const lv_32fc_t* inputVector,
+                                                           const float snr_db,
+                                                           const float signal_power,
+                                                           uint32_t* state,
+                                                           unsigned int num_points)
+{
+    volk_awgn_points(outputVector,
+                     inputVector,
+                     volk_awgn_sigma(snr_db, signal_power),
+                     state,
+                     num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_add_awgn_32fc_u_avx2_fma(lv_32fc_t* outputVector,
+                                           const lv_32fc_t* inputVector,
+                                           const float snr_db,
+                                           const float signal_power,
+                                           uint32_t* state,
+                                           unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const float sigma = volk_awgn_sigma(snr_db, signal_power);
+    const __m256 vSigma = _mm256_set1_ps(sigma);
+    float* out = (float*)outputVector;
+    const float* in = (const float*)inputVector;
+    unsigned int number, k, w;
+    __m256i s[2][4];
+    __m256 lo, hi;
+
+    // generators 0 to 7 in s[0], 8 to 15 in s[1]
+    for (k = 0; k < 2; k++) {
+        for (w = 0; w < 4; w++) {
+            s[k][w] = _mm256_loadu_si256((const __m256i*)(state + 16 * w + 8 * k));
+        }
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 2; k++) {
+            _mm256_rand_gaussian_ps_avx2_fma(s[k], &lo, &hi);
+            lo = _mm256_fmadd_ps(vSigma, lo, _mm256_loadu_ps(in + 16 * k));
+            hi = _mm256_fmadd_ps(vSigma, hi, _mm256_loadu_ps(in + 16 * k + 8));
+            _mm256_storeu_ps(out + 16 * k, lo);
+            _mm256_storeu_ps(out + 16 * k + 8, hi);
+        }
+        in += 32;
+        out += 32;
+    }
+    for (k = 0; k < 2; k++) {
+        for (w = 0; w < 4; w++) {
+            _mm256_storeu_si256((__m256i*)(state + 16 * w + 8 * k), s[k][w]);
+        }
+    }
+
+    volk_awgn_points(outputVector + sixteenth_points * 16,
+                     inputVector + sixteenth_points * 16,
+                     sigma,
+                     state,
+                     num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32f_x2_add_awgn_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                             const lv_32fc_t* inputVector,
+                                                             const float snr_db,
+                                                             const float signal_power,
+                                                             uint32_t* state,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const float sigma = volk_awgn_sigma(snr_db, signal_power);
+    const __m512 vSigma = _mm512_set1_ps(sigma);
+    float* out = (float*)outputVector;
+    const float* in = (const float*)inputVector;
+    unsigned int number, w;
+    __m512i s[4];
+    __m512 lo, hi;
+
+    for (w = 0; w < 4; w++) {
+        s[w] = _mm512_loadu_si512(state + 16 * w);
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        _mm512_rand_gaussian_ps(s, &lo, &hi);
+        lo = _mm512_fmadd_ps(vSigma, lo, _mm512_loadu_ps(in));
+        hi = _mm512_fmadd_ps(vSigma, hi, _mm512_loadu_ps(in + 16));
+        _mm512_storeu_ps(out, lo);
+        _mm512_storeu_ps(out + 16, hi);
+        in += 32;
+        out += 32;
+    }
+    for (w = 0; w < 4; w++) {
+        _mm512_storeu_si512(state + 16 * w, s[w]);
+    }
+
+    volk_awgn_points(outputVector + sixteenth_points * 16,
+                     inputVector + sixteenth_points * 16,
+                     sigma,
+                     state,
+                     num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_x2_add_awgn_32fc_neonv8(lv_32fc_t* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const float snr_db,
+                                                          const float signal_power,
+                                                          uint32_t* state,
+                                                          unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const float sigma = volk_awgn_sigma(snr_db, signal_power);
+    float* out = (float*)outputVector;
+    const float* in = (const float*)inputVector;
+    unsigned int number, k, w;
+    uint32x4_t s[4][4];
+    float32x4x2_t x, g;
+
+    // generators 4 * k to 4 * k + 3 in s[k]
+    for (k = 0; k < 4; k++) {
+        for (w = 0; w < 4; w++) {
+            s[k][w] = vld1q_u32(state + 16 * w + 4 * k);
+        }
+    }
+    for (number = 0; number < sixteenth_points; number++) {
+        for (k = 0; k < 4; k++) {
+            g = _vrand_gaussianq_f32(s[k]);
+            x = vld2q_f32(in + 8 * k);
+            x.val[0] = vfmaq_n_f32(x.val[0], g.val[0], sigma);
+            x.val[1] = vfmaq_n_f32(x.val[1], g.val[1], sigma);
+            vst2q_f32(out + 8 * k, x);
+        }
+        in += 32;
+        out += 32;
+    }
+    for (k = 0; k < 4; k++) {
+        for (w = 0; w < 4; w++) {
+            vst1q_u32(state + 16 * w + 4 * k, s[k][w]);
+        }
+    }
+
+    volk_awgn_points(outputVector + sixteenth_points * 16,
+                     inputVector + sixteenth_points * 16,
+                     sigma,
+                     state,
+                     num_points - sixteenth_points * 16);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_x2_add_awgn_32fc_H */
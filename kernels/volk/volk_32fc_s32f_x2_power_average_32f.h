@@ -0,0 +1,325 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32f_x2_power_average_32f
+ *
+ * \b Overview
+ *
+ * Updates a running average of the power of each input point and, optionally,
+ * writes the average in dB, in one pass over the vectors. This fuses
+ * volk_32fc_magnitude_squared_32f, an exponential averaging loop and the dB
+ * scaling of volk_32fc_s32f_power_spectrum_32f, for spectrum displays that
+ * average the bins of every FFT frame:
+ *
+ * averagePower[n] += alpha * (|complexFFTInput[n] / normalizationFactor|^2 -
+ * averagePower[n])
+ *
+ * logPowerOutput[n] = 10 * log10(averagePower[n])
+ *
+ * An alpha of 1 replaces the average with the power of the frame, and smaller
+ * ones average over about 1 / alpha frames. The dB values come from the same
+ * log2 approximation as volk_32fc_s32f_power_spectrum_32f, with an error
+ * below 1e-4 dB.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_x2_power_average_32f(float* logPowerOutput, float*
+ * averagePower, const lv_32fc_t* complexFFTInput, const float normalizationFactor,
+ * const float alpha, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li averagePower: The average power of each point, updated in place.
+ * \li complexFFTInput: The complex data output from the FFT.
+ * \li normalizationFactor: This value is divided against all the input values before
+ * the power is calculated.
+ * \li alpha: The weight of the new frame in the average, in (0, 1].
+ * \li num_points: The number of fft data points.
+ *
+ * \b Outputs
+ * \li logPowerOutput: 10 * log10 of the updated averages, or NULL to only update
+ * them.
+ * \li averagePower: The updated averages.
+ *
+ * \b Example
+ * Average the spectrum of 100 frames and display it.
+ * \code
+ *   int N = 65536;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* bins = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* average = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* dB = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   memset(average, 0, sizeof(float)*N);
+ *   for(unsigned int frame = 0; frame < 100; ++frame){
+ *       // compute the FFT of the frame into bins, then
+ *       volk_32fc_s32f_x2_power_average_32f(dB, average, bins, N, 0.1f, N);
+ *       // display dB
+ *   }
+ *
+ *   volk_free(bins);
+ *   volk_free(average);
+ *   volk_free(dB);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_x2_power_average_32f_u_H
+#define INCLUDED_volk_32fc_s32f_x2_power_average_32f_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+/* Averages the points one by one, the reference for the SIMD versions. */
+static inline void volk_power_average(float* logPowerOutput,
+                                      float* averagePower,
+                                      const lv_32fc_t* complexFFTInput,
+                                      float iNormalizationFactor,
+                                      float alpha,
+                                      unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        const float real = lv_creal(complexFFTInput[number]) * iNormalizationFactor;
+        const float imag = lv_cimag(complexFFTInput[number]) * iNormalizationFactor;
+        const float power = (real * real) + (imag * imag);
+        averagePower[number] += alpha * (power - averagePower[number]);
+        if (logPowerOutput) {
+            logPowerOutput[number] =
+                volk_log2to10factor * log2f_non_ieee(averagePower[number]);
+        }
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_s32f_x2_power_average_32f_generic(float* logPowerOutput,
+                                            float* averagePower,
+                                            const lv_32fc_t* complexFFTInput,
+                                            const float normalizationFactor,
+                                            const float alpha,
+                                            unsigned int num_points)
+{
+    volk_power_average(logPowerOutput,
+                       averagePower,
+                       complexFFTInput,
+                       1.f / normalizationFactor,
+                       alpha,
+                       num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_average_32f_u_sse3(float* logPowerOutput,
+                                           float* averagePower,
+                                           const lv_32fc_t* complexFFTInput,
+                                           const float normalizationFactor,
+                                           const float alpha,
+                                           unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    const unsigned int quarterPoints = num_points / 4;
+    const float iNormalizationFactor = 1.f / normalizationFactor;
+    const __m128 invNormalizationFactor = _mm_set1_ps(iNormalizationFactor);
+    const __m128 weight = _mm_set1_ps(alpha);
+    const __m128 log2to10 = _mm_set1_ps(volk_log2to10factor);
+    __m128 input1, input2, power, average;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        input1 = _mm_mul_ps(_mm_loadu_ps(inputPtr), invNormalizationFactor);
+        input2 = _mm_mul_ps(_mm_loadu_ps(inputPtr + 4), invNormalizationFactor);
+        inputPtr += 8;
+        power = _mm_magnitudesquared_ps_sse3(input1, input2);
+
+        average = _mm_loadu_ps(averagePower + 4 * number);
+        average = _mm_add_ps(average, _mm_mul_ps(weight, _mm_sub_ps(power, average)));
+        _mm_storeu_ps(averagePower + 4 * number, average);
+        if (logPowerOutput) {
+            _mm_storeu_ps(logPowerOutput + 4 * number,
+                          _mm_mul_ps(_mm_log2_ps_sse3(average), log2to10));
+        }
+    }
+
+    number = quarterPoints * 4;
+    volk_power_average(logPowerOutput ? logPowerOutput + number : NULL,
+                       averagePower + number,
+                       complexFFTInput + number,
+                       iNormalizationFactor,
+                       alpha,
+                       num_points - number);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_average_32f_u_avx2(float* logPowerOutput,
+                                           float* averagePower,
+                                           const lv_32fc_t* complexFFTInput,
+                                           const float normalizationFactor,
+                                           const float alpha,
+                                           unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    const unsigned int eighthPoints = num_points / 8;
+    const float iNormalizationFactor = 1.f / normalizationFactor;
+    const __m256 invNormalizationFactor = _mm256_set1_ps(iNormalizationFactor);
+    const __m256 weight = _mm256_set1_ps(alpha);
+    const __m256 log2to10 = _mm256_set1_ps(volk_log2to10factor);
+    __m256 input1, input2, power, average;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        input1 = _mm256_mul_ps(_mm256_loadu_ps(inputPtr), invNormalizationFactor);
+        input2 = _mm256_mul_ps(_mm256_loadu_ps(inputPtr + 8), invNormalizationFactor);
+        inputPtr += 16;
+        power = _mm256_magnitudesquared_ps_avx2(input1, input2);
+
+        average = _mm256_loadu_ps(averagePower + 8 * number);
+        average =
+            _mm256_add_ps(average, _mm256_mul_ps(weight, _mm256_sub_ps(power, average)));
+        _mm256_storeu_ps(averagePower + 8 * number, average);
+        if (logPowerOutput) {
+            _mm256_storeu_ps(logPowerOutput + 8 * number,
+                             _mm256_mul_ps(_mm256_log2_ps_avx2(average), log2to10));
+        }
+    }
+
+    number = eighthPoints * 8;
+    volk_power_average(logPowerOutput ? logPowerOutput + number : NULL,
+                       averagePower + number,
+                       complexFFTInput + number,
+                       iNormalizationFactor,
+                       alpha,
+                       num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_average_32f_u_avx512f(float* logPowerOutput,
+                                              float* averagePower,
+                                              const lv_32fc_t* complexFFTInput,
+                                              const float normalizationFactor,
+                                              const float alpha,
+                                              unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float iNormalizationFactor = 1.f / normalizationFactor;
+    const __m512 invNormalizationFactor = _mm512_set1_ps(iNormalizationFactor);
+    const __m512 weight = _mm512_set1_ps(alpha);
+    const __m512 log2to10 = _mm512_set1_ps(volk_log2to10factor);
+    __m512 input1, input2, power, average;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        input1 = _mm512_mul_ps(_mm512_loadu_ps(inputPtr), invNormalizationFactor);
+        input2 = _mm512_mul_ps(_mm512_loadu_ps(inputPtr + 16), invNormalizationFactor);
+        inputPtr += 32;
+        power = _mm512_magnitudesquared_ps(input1, input2);
+
+        average = _mm512_loadu_ps(averagePower + 16 * number);
+        average = _mm512_fmadd_ps(weight, _mm512_sub_ps(power, average), average);
+        _mm512_storeu_ps(averagePower + 16 * number, average);
+        if (logPowerOutput) {
+            _mm512_storeu_ps(logPowerOutput + 16 * number,
+                             _mm512_mul_ps(_mm512_log2_ps(average), log2to10));
+        }
+    }
+
+    number = sixteenthPoints * 16;
+    volk_power_average(logPowerOutput ? logPowerOutput + number : NULL,
+                       averagePower + number,
+                       complexFFTInput + number,
+                       iNormalizationFactor,
+                       alpha,
+                       num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_average_32f_neon(float* logPowerOutput,
+                                         float* averagePower,
+                                         const lv_32fc_t* complexFFTInput,
+                                         const float normalizationFactor,
+                                         const float alpha,
+                                         unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float iNormalizationFactor = 1.f / normalizationFactor;
+    const float inv_ln10_10 = 4.34294481903f; // 10.0/ln(10.)
+    float32x4x2_t fft_vec;
+    float32x4_t power, average;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        fft_vec = vld2q_f32((const float*)(complexFFTInput + 4 * number));
+        fft_vec.val[0] = vmulq_n_f32(fft_vec.val[0], iNormalizationFactor);
+        fft_vec.val[1] = vmulq_n_f32(fft_vec.val[1], iNormalizationFactor);
+        power = _vmagnitudesquaredq_f32(fft_vec);
+
+        average = vld1q_f32(averagePower + 4 * number);
+        average = vmlaq_n_f32(average, vsubq_f32(power, average), alpha);
+        vst1q_f32(averagePower + 4 * number, average);
+        if (logPowerOutput) {
+            vst1q_f32(logPowerOutput + 4 * number,
+                      vmulq_n_f32(_vlogq_f32(average), inv_ln10_10));
+        }
+    }
+
+    number = quarterPoints * 4;
+    volk_power_average(logPowerOutput ? logPowerOutput + number : NULL,
+                       averagePower + number,
+                       complexFFTInput + number,
+                       iNormalizationFactor,
+                       alpha,
+                       num_points - number);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_x2_power_average_32f_u_H */
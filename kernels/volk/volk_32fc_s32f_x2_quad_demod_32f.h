@@ -0,0 +1,233 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32f_x2_quad_demod_32f
+ *
+ * \b Overview
+ *
+ * Quadrature FM demodulation: the angle between each complex sample and the
+ * one before it, times a gain, in one pass. The last sample of a call is kept
+ * in lastSample for the first output of the next, so a stream demodulates the
+ * same in blocks of any size.
+ *
+ * out[i] = gain * arg(in[i] * conj(in[i - 1])), with in[-1] = *lastSample
+ *
+ * The SIMD versions evaluate the four quadrant arctangent with an odd
+ * polynomial of relative error below 2e-7.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_x2_quad_demod_32f(float* outputVector,
+ * const lv_32fc_t* inputVector, const float gain, lv_32fc_t* lastSample,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex samples.
+ * \li gain: The scale of the angles, sample_rate / (2 pi deviation) for FM.
+ * \li lastSample: The sample before the first, updated to the last one.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li outputVector: The demodulated samples.
+ *
+ * \b Example
+ * Demodulate a broadcast FM channel at 480 kHz, 75 kHz deviation, block by block.
+ * \code
+ *   const float gain = 480e3f / (2.f * M_PI * 75e3f);
+ *   lv_32fc_t last = lv_cmake(0.f, 0.f);
+ *
+ *   // for each block of N samples
+ *   volk_32fc_s32f_x2_quad_demod_32f(audio, baseband, gain, &last, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_x2_quad_demod_32f_H
+#define INCLUDED_volk_32fc_s32f_x2_quad_demod_32f_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_x2_quad_demod_32f_generic(float* outputVector,
+                                                            const lv_32fc_t* inputVector,
+                                                            const float gain,
+                                                            lv_32fc_t* lastSample,
+                                                            unsigned int num_points)
+{
+    lv_32fc_t previous = *lastSample, product;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        product = inputVector[number] * lv_conj(previous);
+        outputVector[number] = gain * atan2f(lv_cimag(product), lv_creal(product));
+        previous = inputVector[number];
+    }
+    *lastSample = previous;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_s32f_x2_quad_demod_32f_u_avx2(float* outputVector,
+                                                           const lv_32fc_t* inputVector,
+                                                           const float gain,
+                                                           lv_32fc_t* lastSample,
+                                                           unsigned int num_points)
+{
+    const __m256 gainVal = _mm256_set1_ps(gain);
+    __m256 product0, product1, angle;
+    lv_32fc_t product;
+    unsigned int number;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    product = inputVector[0] * lv_conj(*lastSample);
+    outputVector[0] = gain * atan2f(lv_cimag(product), lv_creal(product));
+    for (number = 1; number + 8 <= num_points; number += 8) {
+        product0 = _mm256_complexconjugatemul_ps(
+            _mm256_loadu_ps((const float*)(inputVector + number)),
+            _mm256_loadu_ps((const float*)(inputVector + number - 1)));
+        product1 = _mm256_complexconjugatemul_ps(
+            _mm256_loadu_ps((const float*)(inputVector + number + 4)),
+            _mm256_loadu_ps((const float*)(inputVector + number + 3)));
+        // the angles of samples 0, 1, 4, 5, 2, 3, 6, 7, put back in order
+        angle = _mm256_atan2_ps_avx2(_mm256_shuffle_ps(product0, product1, 0xdd),
+                                     _mm256_shuffle_ps(product0, product1, 0x88));
+        angle = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(angle), 0xd8));
+        _mm256_storeu_ps(outputVector + number, _mm256_mul_ps(angle, gainVal));
+    }
+
+    for (; number < num_points; number++) {
+        product = inputVector[number] * lv_conj(inputVector[number - 1]);
+        outputVector[number] = gain * atan2f(lv_cimag(product), lv_creal(product));
+    }
+    *lastSample = inputVector[num_points - 1];
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_quad_demod_32f_u_avx512f(float* outputVector,
+                                           const lv_32fc_t* inputVector,
+                                           const float gain,
+                                           lv_32fc_t* lastSample,
+                                           unsigned int num_points)
+{
+    const __m512i realIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i imagIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    const __m512 gainVal = _mm512_set1_ps(gain);
+    __m512 current0, current1, previous0, previous1, currentReal, currentImag;
+    __m512 previousReal, previousImag, real, imag;
+    lv_32fc_t product;
+    unsigned int number;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    product = inputVector[0] * lv_conj(*lastSample);
+    outputVector[0] = gain * atan2f(lv_cimag(product), lv_creal(product));
+    for (number = 1; number + 16 <= num_points; number += 16) {
+        current0 = _mm512_loadu_ps((const float*)(inputVector + number));
+        current1 = _mm512_loadu_ps((const float*)(inputVector + number + 8));
+        previous0 = _mm512_loadu_ps((const float*)(inputVector + number - 1));
+        previous1 = _mm512_loadu_ps((const float*)(inputVector + number + 7));
+        currentReal = _mm512_permutex2var_ps(current0, realIdx, current1);
+        currentImag = _mm512_permutex2var_ps(current0, imagIdx, current1);
+        previousReal = _mm512_permutex2var_ps(previous0, realIdx, previous1);
+        previousImag = _mm512_permutex2var_ps(previous0, imagIdx, previous1);
+        real = _mm512_fmadd_ps(
+            currentReal, previousReal, _mm512_mul_ps(currentImag, previousImag));
+        imag = _mm512_fmsub_ps(
+            currentImag, previousReal, _mm512_mul_ps(currentReal, previousImag));
+        _mm512_storeu_ps(outputVector + number,
+                         _mm512_mul_ps(_mm512_atan2_ps(imag, real), gainVal));
+    }
+
+    for (; number < num_points; number++) {
+        product = inputVector[number] * lv_conj(inputVector[number - 1]);
+        outputVector[number] = gain * atan2f(lv_cimag(product), lv_creal(product));
+    }
+    *lastSample = inputVector[num_points - 1];
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_x2_quad_demod_32f_neonv8(float* outputVector,
+                                                           const lv_32fc_t* inputVector,
+                                                           const float gain,
+                                                           lv_32fc_t* lastSample,
+                                                           unsigned int num_points)
+{
+    float32x4x2_t current, previous;
+    float32x4_t real, imag;
+    lv_32fc_t product;
+    unsigned int number;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    product = inputVector[0] * lv_conj(*lastSample);
+    outputVector[0] = gain * atan2f(lv_cimag(product), lv_creal(product));
+    for (number = 1; number + 4 <= num_points; number += 4) {
+        current = vld2q_f32((const float*)(inputVector + number));
+        previous = vld2q_f32((const float*)(inputVector + number - 1));
+        real = vfmaq_f32(vmulq_f32(current.val[0], previous.val[0]),
+                         current.val[1],
+                         previous.val[1]);
+        imag = vfmsq_f32(vmulq_f32(current.val[1], previous.val[0]),
+                         current.val[0],
+                         previous.val[1]);
+        vst1q_f32(outputVector + number, vmulq_n_f32(_vatan2q_f32(imag, real), gain));
+    }
+
+    for (; number < num_points; number++) {
+        product = inputVector[number] * lv_conj(inputVector[number - 1]);
+        outputVector[number] = gain * atan2f(lv_cimag(product), lv_creal(product));
+    }
+    *lastSample = inputVector[num_points - 1];
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_x2_quad_demod_32f_H */
@@ -0,0 +1,395 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32f_x3_agc_32fc
+ *
+ * \b Overview
+ *
+ * Automatic gain control of a complex stream, the loop of GNU Radio's agc_cc:
+ * each sample is scaled by the gain, which then moves toward the reference
+ * output magnitude,
+ *
+ * out[n] = in[n] g
+ *
+ * g = min(g + rate (reference - |out[n]|), maxGain)
+ *
+ * with no limit for maxGain <= 0. The gain is carried from one call to the
+ * next, so a stream gives the same output in blocks of any size.
+ *
+ * While the gain stays within 0 and maxGain the update is affine in it,
+ * g -> (1 - rate |in[n]|) g + rate reference, so the SIMD versions compose
+ * the maps of a register of samples with a prefix scan and get the gain
+ * before each sample at once, matching the per-sample loop to rounding. A
+ * register whose gains would leave those bounds runs the loop one sample at
+ * a time instead.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_x3_agc_32fc(lv_32fc_t* outputVector,
+ * const lv_32fc_t* inputVector, const float rate, const float reference,
+ * const float maxGain, float* gain, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The samples.
+ * \li rate: The step of the gain update.
+ * \li reference: The output magnitude to settle at.
+ * \li maxGain: The largest gain, or 0 for no limit.
+ * \li gain: The gain for the first sample; updated to the gain for the next.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li outputVector: The scaled samples.
+ *
+ * \b Example
+ * Level a burst to unit magnitude, starting from unit gain.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float gain = 1.f;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(0.1f * cosf(0.01f * ii), 0.1f * sinf(0.01f * ii));
+ *   }
+ *
+ *   volk_32fc_s32f_x3_agc_32fc(out, in, 1e-3f, 1.f, 65536.f, &gain, N);
+ *
+ *   printf("gain %1.3f, last magnitude %1.3f\n", gain, cabsf(out[N - 1]));
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_x3_agc_32fc_H
+#define INCLUDED_volk_32fc_s32f_x3_agc_32fc_H
+
+#include <float.h>
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/* The per-sample loop; returns the gain for the next sample */
+static inline float volk_agc_samples(lv_32fc_t* out,
+                                     const lv_32fc_t* in,
+                                     float rate,
+                                     float reference,
+                                     float limit,
+                                     float gain,
+                                     unsigned int num_points)
+{
+    unsigned int number;
+    float re, im;
+
+    for (number = 0; number < num_points; number++) {
+        re = lv_creal(in[number]) * gain;
+        im = lv_cimag(in[number]) * gain;
+        out[number] = lv_cmake(re, im);
+        gain += rate * (reference - sqrtf(re * re + im * im));
+        if (gain > limit) {
+            gain = limit;
+        }
+    }
+    return gain;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_x3_agc_32fc_generic(lv_32fc_t* outputVector,
+                                                      const lv_32fc_t* inputVector,
+                                                      const float rate,
+                                                      const float reference,
+                                                      const float maxGain,
+                                                      float* gain,
+                                                      unsigned int num_points)
+{
+    *gain = volk_agc_samples(outputVector,
+                             inputVector,
+                             rate,
+                             reference,
+                             maxGain > 0.f ? maxGain : FLT_MAX,
+                             *gain,
+                             num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+#include <volk/volk_sse_intrinsics.h>
+
+static inline void volk_32fc_s32f_x3_agc_32fc_u_sse(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    const float rate,
+                                                    const float reference,
+                                                    const float maxGain,
+                                                    float* gain,
+                                                    unsigned int num_points)
+{
+    const float limit = maxGain > 0.f ? maxGain : FLT_MAX;
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 rates = _mm_set1_ps(rate);
+    const __m128 steps = _mm_set1_ps(rate * reference);
+    const __m128 limits = _mm_set1_ps(limit);
+    __m128 x0, x1, a, b, before, after, outside;
+    __m128 gains = _mm_set1_ps(*gain);
+    unsigned int number;
+
+    for (number = 0; number + 4 <= num_points; number += 4) {
+        x0 = _mm_loadu_ps((const float*)(inputVector + number));
+        x1 = _mm_loadu_ps((const float*)(inputVector + number + 2));
+        a = _mm_sub_ps(one, _mm_mul_ps(rates, _mm_magnitude_ps(x0, x1)));
+        b = steps;
+        _mm_scan_affine_ps(&a, &b);
+        after = _mm_add_ps(_mm_mul_ps(a, gains), b);
+        // shift the gains after each sample up a lane, the incoming gain below
+        before = _mm_shuffle_ps(after, after, _MM_SHUFFLE(2, 1, 0, 3));
+        before = _mm_move_ss(before, gains);
+        outside = _mm_or_ps(_mm_cmpgt_ps(after, limits), _mm_cmplt_ps(before, zero));
+        if (_mm_movemask_ps(outside)) {
+            gains = _mm_set1_ps(volk_agc_samples(outputVector + number,
+                                                 inputVector + number,
+                                                 rate,
+                                                 reference,
+                                                 limit,
+                                                 _mm_cvtss_f32(gains),
+                                                 4));
+            continue;
+        }
+        _mm_storeu_ps((float*)(outputVector + number),
+                      _mm_mul_ps(x0, _mm_unpacklo_ps(before, before)));
+        _mm_storeu_ps((float*)(outputVector + number + 2),
+                      _mm_mul_ps(x1, _mm_unpackhi_ps(before, before)));
+        gains = _mm_shuffle_ps(after, after, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    *gain = volk_agc_samples(outputVector + number,
+                             inputVector + number,
+                             rate,
+                             reference,
+                             limit,
+                             _mm_cvtss_f32(gains),
+                             num_points - number);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s32f_x3_agc_32fc_u_avx(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    const float rate,
+                                                    const float reference,
+                                                    const float maxGain,
+                                                    float* gain,
+                                                    unsigned int num_points)
+{
+    const float limit = maxGain > 0.f ? maxGain : FLT_MAX;
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 rates = _mm256_set1_ps(rate);
+    const __m256 steps = _mm256_set1_ps(rate * reference);
+    const __m256 limits = _mm256_set1_ps(limit);
+    __m256 x0, x1, a, b, before, after, outside, low, high;
+    __m256 gains = _mm256_set1_ps(*gain);
+    unsigned int number;
+
+    for (number = 0; number + 8 <= num_points; number += 8) {
+        x0 = _mm256_loadu_ps((const float*)(inputVector + number));
+        x1 = _mm256_loadu_ps((const float*)(inputVector + number + 4));
+        a = _mm256_sub_ps(one, _mm256_mul_ps(rates, _mm256_magnitude_ps(x0, x1)));
+        b = steps;
+        _mm256_scan_affine_ps(&a, &b);
+        after = _mm256_add_ps(_mm256_mul_ps(a, gains), b);
+        // shift the gains after each sample up a lane, the incoming gain below
+        before = _mm256_permute_ps(after, _MM_SHUFFLE(2, 1, 0, 3));
+        before =
+            _mm256_blend_ps(before, _mm256_permute2f128_ps(before, gains, 0x02), 0x11);
+        outside = _mm256_or_ps(_mm256_cmp_ps(after, limits, _CMP_GT_OQ),
+                               _mm256_cmp_ps(before, zero, _CMP_LT_OQ));
+        if (_mm256_movemask_ps(outside)) {
+            gains = _mm256_set1_ps(volk_agc_samples(outputVector + number,
+                                                    inputVector + number,
+                                                    rate,
+                                                    reference,
+                                                    limit,
+                                                    _mm256_cvtss_f32(gains),
+                                                    8));
+            continue;
+        }
+        low = _mm256_unpacklo_ps(before, before);
+        high = _mm256_unpackhi_ps(before, before);
+        _mm256_storeu_ps((float*)(outputVector + number),
+                         _mm256_mul_ps(x0, _mm256_permute2f128_ps(low, high, 0x20)));
+        _mm256_storeu_ps((float*)(outputVector + number + 4),
+                         _mm256_mul_ps(x1, _mm256_permute2f128_ps(low, high, 0x31)));
+        gains = _mm256_permute_ps(after, _MM_SHUFFLE(3, 3, 3, 3));
+        gains = _mm256_permute2f128_ps(gains, gains, 0x11);
+    }
+
+    *gain = volk_agc_samples(outputVector + number,
+                             inputVector + number,
+                             rate,
+                             reference,
+                             limit,
+                             _mm256_cvtss_f32(gains),
+                             num_points - number);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32f_x3_agc_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                        const lv_32fc_t* inputVector,
+                                                        const float rate,
+                                                        const float reference,
+                                                        const float maxGain,
+                                                        float* gain,
+                                                        unsigned int num_points)
+{
+    const float limit = maxGain > 0.f ? maxGain : FLT_MAX;
+    const __m512i shiftIdx =
+        _mm512_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14);
+    const __m512i lowIdx =
+        _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i highIdx =
+        _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+    const __m512i lastIdx = _mm512_set1_epi32(15);
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 rates = _mm512_set1_ps(rate);
+    const __m512 steps = _mm512_set1_ps(rate * reference);
+    const __m512 limits = _mm512_set1_ps(limit);
+    __m512 x0, x1, a, b, before, after;
+    __m512 gains = _mm512_set1_ps(*gain);
+    __mmask16 outside;
+    unsigned int number;
+
+    for (number = 0; number + 16 <= num_points; number += 16) {
+        x0 = _mm512_loadu_ps((const float*)(inputVector + number));
+        x1 = _mm512_loadu_ps((const float*)(inputVector + number + 8));
+        a = _mm512_sqrt_ps(_mm512_magnitudesquared_ps(x0, x1));
+        a = _mm512_fnmadd_ps(rates, a, one);
+        b = steps;
+        _mm512_scan_affine_ps(&a, &b);
+        after = _mm512_fmadd_ps(a, gains, b);
+        before = _mm512_mask_permutexvar_ps(gains, 0xfffe, shiftIdx, after);
+        outside = _mm512_cmp_ps_mask(after, limits, _CMP_GT_OQ) |
+                  _mm512_cmp_ps_mask(before, zero, _CMP_LT_OQ);
+        if (outside) {
+            gains = _mm512_set1_ps(volk_agc_samples(outputVector + number,
+                                                    inputVector + number,
+                                                    rate,
+                                                    reference,
+                                                    limit,
+                                                    _mm512_cvtss_f32(gains),
+                                                    16));
+            continue;
+        }
+        _mm512_storeu_ps((float*)(outputVector + number),
+                         _mm512_mul_ps(x0, _mm512_permutexvar_ps(lowIdx, before)));
+        _mm512_storeu_ps((float*)(outputVector + number + 8),
+                         _mm512_mul_ps(x1, _mm512_permutexvar_ps(highIdx, before)));
+        gains = _mm512_permutexvar_ps(lastIdx, after);
+    }
+
+    *gain = volk_agc_samples(outputVector + number,
+                             inputVector + number,
+                             rate,
+                             reference,
+                             limit,
+                             _mm512_cvtss_f32(gains),
+                             num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_x3_agc_32fc_neonv8(lv_32fc_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     const float rate,
+                                                     const float reference,
+                                                     const float maxGain,
+                                                     float* gain,
+                                                     unsigned int num_points)
+{
+    const float limit = maxGain > 0.f ? maxGain : FLT_MAX;
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t rates = vdupq_n_f32(rate);
+    const float32x4_t limits = vdupq_n_f32(limit);
+    float32x4x2_t x;
+    float32x4_t a, b, before, after;
+    float32x4_t gains = vdupq_n_f32(*gain);
+    uint32x4_t outside;
+    unsigned int number;
+
+    for (number = 0; number + 4 <= num_points; number += 4) {
+        x = vld2q_f32((const float*)(inputVector + number));
+        a = vfmsq_f32(one, rates, vsqrtq_f32(_vmagnitudesquaredq_f32(x)));
+        b = vdupq_n_f32(rate * reference);
+        _vscan_affineq_f32(&a, &b);
+        after = vfmaq_f32(b, a, gains);
+        before = vextq_f32(gains, after, 3);
+        outside = vorrq_u32(vcgtq_f32(after, limits), vcltq_f32(before, zero));
+        if (vmaxvq_u32(outside)) {
+            gains = vdupq_n_f32(volk_agc_samples(outputVector + number,
+                                                 inputVector + number,
+                                                 rate,
+                                                 reference,
+                                                 limit,
+                                                 vgetq_lane_f32(gains, 0),
+                                                 4));
+            continue;
+        }
+        x.val[0] = vmulq_f32(x.val[0], before);
+        x.val[1] = vmulq_f32(x.val[1], before);
+        vst2q_f32((float*)(outputVector + number), x);
+        gains = vdupq_laneq_f32(after, 3);
+    }
+
+    *gain = volk_agc_samples(outputVector + number,
+                             inputVector + number,
+                             rate,
+                             reference,
+                             limit,
+                             vgetq_lane_f32(gains, 0),
+                             num_points - number);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_x3_agc_32fc_H */
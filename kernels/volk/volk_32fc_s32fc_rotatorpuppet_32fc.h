@@ -37,7 +37,7 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_generic(lv_32fc_t* outVect
                                                               const lv_32fc_t phase_inc,
                                                               unsigned int num_points)
 {
-    lv_32fc_t phase[1] = { lv_cmake(.3, 0.95393) };
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
     (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
     const lv_32fc_t phase_inc_n =
         phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
@@ -57,7 +57,7 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_neon(lv_32fc_t* outVector,
                                                            const lv_32fc_t phase_inc,
                                                            unsigned int num_points)
 {
-    lv_32fc_t phase[1] = { lv_cmake(.3, 0.95393) };
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
     (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
     const lv_32fc_t phase_inc_n =
         phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
@@ -67,6 +67,42 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_neon(lv_32fc_t* outVector,
 
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32fc_rotatorpuppet_32fc_neonv8(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s32fc_x2_rotator_32fc_neonv8(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32fc_s32fc_rotatorpuppet_32fc_sve(lv_32fc_t* outVector,
+                                                          const lv_32fc_t* inVector,
+                                                          const lv_32fc_t phase_inc,
+                                                          unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s32fc_x2_rotator_32fc_sve(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_SVE */
+
 
 #ifdef LV_HAVE_SSE4_1
 #include <smmintrin.h>
@@ -76,7 +112,7 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_a_sse4_1(lv_32fc_t* outVec
                                                                const lv_32fc_t phase_inc,
                                                                unsigned int num_points)
 {
-    lv_32fc_t phase[1] = { lv_cmake(.3, .95393) };
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
     (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
     const lv_32fc_t phase_inc_n =
         phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
@@ -94,7 +130,7 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_u_sse4_1(lv_32fc_t* outVec
                                                                const lv_32fc_t phase_inc,
                                                                unsigned int num_points)
 {
-    lv_32fc_t phase[1] = { lv_cmake(.3, .95393) };
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
     (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
     const lv_32fc_t phase_inc_n =
         phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
@@ -113,7 +149,7 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_a_avx(lv_32fc_t* outVector
                                                             const lv_32fc_t phase_inc,
                                                             unsigned int num_points)
 {
-    lv_32fc_t phase[1] = { lv_cmake(.3, .95393) };
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
     (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
     const lv_32fc_t phase_inc_n =
         phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
@@ -132,7 +168,7 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_u_avx(lv_32fc_t* outVector
                                                             const lv_32fc_t phase_inc,
                                                             unsigned int num_points)
 {
-    lv_32fc_t phase[1] = { lv_cmake(.3, .95393) };
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
     (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
     const lv_32fc_t phase_inc_n =
         phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
@@ -150,7 +186,7 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_a_avx_fma(lv_32fc_t* outVe
                                                                 const lv_32fc_t phase_inc,
                                                                 unsigned int num_points)
 {
-    lv_32fc_t phase[1] = { lv_cmake(.3, .95393) };
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
     (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
     const lv_32fc_t phase_inc_n =
         phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
@@ -169,7 +205,7 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_u_avx_fma(lv_32fc_t* outVe
                                                                 const lv_32fc_t phase_inc,
                                                                 unsigned int num_points)
 {
-    lv_32fc_t phase[1] = { lv_cmake(.3, .95393) };
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
     (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
     const lv_32fc_t phase_inc_n =
         phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
@@ -179,4 +215,41 @@ static inline void volk_32fc_s32fc_rotatorpuppet_32fc_u_avx_fma(lv_32fc_t* outVe
 
 #endif /* LV_HAVE_AVX && LV_HAVE_FMA*/
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32fc_rotatorpuppet_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                                const lv_32fc_t* inVector,
+                                                                const lv_32fc_t phase_inc,
+                                                                unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s32fc_x2_rotator_32fc_a_avx512f(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32fc_rotatorpuppet_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                                const lv_32fc_t* inVector,
+                                                                const lv_32fc_t phase_inc,
+                                                                unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s32fc_x2_rotator_32fc_u_avx512f(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /* INCLUDED_volk_32fc_s32fc_rotatorpuppet_32fc_a_H */
@@ -0,0 +1,142 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_x2_s32fc_x2_rotator_32f_x2.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_s32fc_split_rotatorpuppet_32fc_H
+#define INCLUDED_volk_32fc_s32fc_split_rotatorpuppet_32fc_H
+
+#include <volk/volk.h>
+#include <volk/volk_32f_x2_s32fc_x2_rotator_32f_x2.h>
+
+/* Splits the input into real and imaginary planes, rotates them in place from
+ * the phase and with the normalised increment of
+ * volk_32fc_s32fc_rotatorpuppet_32fc, and interleaves them again. */
+static inline void volk_split_rotator_puppet(void (*kernel)(float*,
+                                                            float*,
+                                                            const float*,
+                                                            const float*,
+                                                            const lv_32fc_t,
+                                                            lv_32fc_t*,
+                                                            unsigned int),
+                                             lv_32fc_t* outVector,
+                                             const lv_32fc_t* inVector,
+                                             const lv_32fc_t phase_inc,
+                                             unsigned int num_points)
+{
+    const size_t alignment = volk_get_alignment();
+    float* planes = (float*)volk_malloc(sizeof(float) * 2 * num_points, alignment);
+    float* imag = planes + num_points;
+    unsigned int number;
+    lv_32fc_t phase[1] = { lv_cmake(.3f, 0.95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+
+    for (number = 0; number < num_points; number++) {
+        planes[number] = lv_creal(inVector[number]);
+        imag[number] = lv_cimag(inVector[number]);
+    }
+    kernel(planes, imag, planes, imag, phase_inc_n, phase, num_points);
+    for (number = 0; number < num_points; number++) {
+        outVector[number] = lv_cmake(planes[number], imag[number]);
+    }
+
+    volk_free(planes);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_s32fc_split_rotatorpuppet_32fc_generic(lv_32fc_t* outVector,
+                                                 const lv_32fc_t* inVector,
+                                                 const lv_32fc_t phase_inc,
+                                                 unsigned int num_points)
+{
+    volk_split_rotator_puppet(volk_32f_x2_s32fc_x2_rotator_32f_x2_generic,
+                              outVector,
+                              inVector,
+                              phase_inc,
+                              num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_s32fc_split_rotatorpuppet_32fc_u_avx2_fma(lv_32fc_t* outVector,
+                                                    const lv_32fc_t* inVector,
+                                                    const lv_32fc_t phase_inc,
+                                                    unsigned int num_points)
+{
+    volk_split_rotator_puppet(volk_32f_x2_s32fc_x2_rotator_32f_x2_u_avx2_fma,
+                              outVector,
+                              inVector,
+                              phase_inc,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_s32fc_split_rotatorpuppet_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                   const lv_32fc_t* inVector,
+                                                   const lv_32fc_t phase_inc,
+                                                   unsigned int num_points)
+{
+    volk_split_rotator_puppet(volk_32f_x2_s32fc_x2_rotator_32f_x2_u_avx512f,
+                              outVector,
+                              inVector,
+                              phase_inc,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void
+volk_32fc_s32fc_split_rotatorpuppet_32fc_neonv8(lv_32fc_t* outVector,
+                                                const lv_32fc_t* inVector,
+                                                const lv_32fc_t phase_inc,
+                                                unsigned int num_points)
+{
+    volk_split_rotator_puppet(volk_32f_x2_s32fc_x2_rotator_32f_x2_neonv8,
+                              outVector,
+                              inVector,
+                              phase_inc,
+                              num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32fc_split_rotatorpuppet_32fc_H */
@@ -90,6 +90,46 @@
 #define ROTATOR_RELOAD_2 (ROTATOR_RELOAD / 2)
 #define ROTATOR_RELOAD_4 (ROTATOR_RELOAD / 4)
 
+/* Writes phase * phase_inc^(offset + k) for k < num_lanes into phases, computed
+ * in double precision and normalised. A rotator re-seeded from these carries
+ * no rounding error over from the samples before offset. */
+static inline void volk_rotator_exact_phases(lv_32fc_t* phases,
+                                             lv_32fc_t phase,
+                                             lv_32fc_t phase_inc,
+                                             unsigned int offset,
+                                             unsigned int num_lanes)
+{
+    const double inc_mag =
+        hypot((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc));
+    const double step_re = lv_creal(phase_inc) / inc_mag;
+    const double step_im = lv_cimag(phase_inc) / inc_mag;
+    double inc_re = step_re, inc_im = step_im;
+    double re = lv_creal(phase), im = lv_cimag(phase), t, mag;
+    unsigned int k;
+
+    // phase * phase_inc^offset by repeated squaring
+    for (; offset; offset >>= 1) {
+        if (offset & 1) {
+            t = re * inc_re - im * inc_im;
+            im = re * inc_im + im * inc_re;
+            re = t;
+        }
+        t = inc_re * inc_re - inc_im * inc_im;
+        inc_im = 2. * inc_re * inc_im;
+        inc_re = t;
+    }
+    mag = hypot(re, im);
+    re /= mag;
+    im /= mag;
+
+    for (k = 0; k < num_lanes; k++) {
+        phases[k] = lv_cmake((float)re, (float)im);
+        t = re * step_re - im * step_im;
+        im = re * step_im + im * step_re;
+        re = t;
+    }
+}
+
 
 #ifdef LV_HAVE_GENERIC
 
@@ -216,6 +256,170 @@ static inline void volk_32fc_s32fc_x2_rotator_32fc_neon(lv_32fc_t* outVector,
 
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32fc_x2_rotator_32fc_neonv8(lv_32fc_t* outVector,
+                                                          const lv_32fc_t* inVector,
+                                                          const lv_32fc_t phase_inc,
+                                                          lv_32fc_t* phase,
+                                                          unsigned int num_points)
+{
+    lv_32fc_t* outputVectorPtr = outVector;
+    const lv_32fc_t* inputVectorPtr = inVector;
+    lv_32fc_t incr = 1;
+    lv_32fc_t phasePtr[8];
+    float32x4x2_t input_vec0, input_vec1;
+    float32x4x2_t phase_vec0, phase_vec1;
+    float32x4x2_t incr_vec;
+
+    unsigned int i = 0, j = 0;
+
+    for (i = 0; i < 8; ++i) {
+        phasePtr[i] = (*phase) * incr;
+        incr *= (phase_inc);
+    }
+
+    // two independent phase vectors, each advanced by eight points at a time
+    incr_vec.val[0] = vdupq_n_f32(lv_creal(incr));
+    incr_vec.val[1] = vdupq_n_f32(lv_cimag(incr));
+    phase_vec0 = vld2q_f32((float*)phasePtr);
+    phase_vec1 = vld2q_f32((float*)(phasePtr + 4));
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD / 8; j++) {
+            input_vec0 = vld2q_f32((float*)inputVectorPtr);
+            input_vec1 = vld2q_f32((float*)(inputVectorPtr + 4));
+            __VOLK_PREFETCH(inputVectorPtr + 16);
+            // Rotate
+            vst2q_f32((float*)outputVectorPtr,
+                      _vmultiply_complexq_f32_fma(input_vec0, phase_vec0));
+            vst2q_f32((float*)(outputVectorPtr + 4),
+                      _vmultiply_complexq_f32_fma(input_vec1, phase_vec1));
+            // Increase phase
+            phase_vec0 = _vmultiply_complexq_f32_fma(phase_vec0, incr_vec);
+            phase_vec1 = _vmultiply_complexq_f32_fma(phase_vec1, incr_vec);
+
+            outputVectorPtr += 8;
+            inputVectorPtr += 8;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        phase_vec0 = _vnormalize_complexq_f32(phase_vec0);
+        phase_vec1 = _vnormalize_complexq_f32(phase_vec1);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 8; i++) {
+        input_vec0 = vld2q_f32((float*)inputVectorPtr);
+        input_vec1 = vld2q_f32((float*)(inputVectorPtr + 4));
+        __VOLK_PREFETCH(inputVectorPtr + 16);
+        vst2q_f32((float*)outputVectorPtr,
+                  _vmultiply_complexq_f32_fma(input_vec0, phase_vec0));
+        vst2q_f32((float*)(outputVectorPtr + 4),
+                  _vmultiply_complexq_f32_fma(input_vec1, phase_vec1));
+        phase_vec0 = _vmultiply_complexq_f32_fma(phase_vec0, incr_vec);
+        phase_vec1 = _vmultiply_complexq_f32_fma(phase_vec1, incr_vec);
+
+        outputVectorPtr += 8;
+        inputVectorPtr += 8;
+    }
+    // if(i) == true means we looped above
+    if (i) {
+        phase_vec0 = _vnormalize_complexq_f32(phase_vec0);
+    }
+    // Store current phase
+    vst2q_f32((float*)phasePtr, phase_vec0);
+
+    // Deal with the rest
+    for (i = 0; i < num_points % 8; i++) {
+        *outputVectorPtr++ = *inputVectorPtr++ * phasePtr[0];
+        phasePtr[0] *= (phase_inc);
+    }
+
+    // For continuous phase next time we need to call this function
+    (*phase) = phasePtr[0];
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32fc_s32fc_x2_rotator_32fc_sve(lv_32fc_t* outVector,
+                                                       const lv_32fc_t* inVector,
+                                                       const lv_32fc_t phase_inc,
+                                                       lv_32fc_t* phase,
+                                                       unsigned int num_points)
+{
+    // complex points per pass, at most 64 with 2048 bit vectors
+    const unsigned int vl = svcntw();
+    const unsigned int reload = (ROTATOR_RELOAD / vl) ? (ROTATOR_RELOAD / vl) : 1;
+    const svbool_t all = svptrue_b32();
+    lv_32fc_t phasePtr[64];
+    lv_32fc_t incr = 1;
+    unsigned int i, number = 0;
+
+    for (i = 0; i < vl; ++i) {
+        phasePtr[i] = (*phase) * incr;
+        incr *= (phase_inc);
+    }
+
+    // incr now advances the phases by one full vector of points
+    const svfloat32_t incr_re = svdup_n_f32(lv_creal(incr));
+    const svfloat32_t incr_im = svdup_n_f32(lv_cimag(incr));
+    const svfloat32x2_t phase_vec = svld2_f32(all, (const float*)phasePtr);
+    svfloat32_t phase_re = svget2_f32(phase_vec, 0);
+    svfloat32_t phase_im = svget2_f32(phase_vec, 1);
+
+    for (i = 1; number + vl <= num_points; number += vl, ++i) {
+        const svfloat32x2_t in = svld2_f32(all, (const float*)(inVector + number));
+        const svfloat32_t in_re = svget2_f32(in, 0);
+        const svfloat32_t in_im = svget2_f32(in, 1);
+        // Rotate
+        const svfloat32_t out_re =
+            svmls_f32_x(all, svmul_f32_x(all, in_re, phase_re), in_im, phase_im);
+        const svfloat32_t out_im =
+            svmla_f32_x(all, svmul_f32_x(all, in_re, phase_im), in_im, phase_re);
+        svst2_f32(all, (float*)(outVector + number), svcreate2_f32(out_re, out_im));
+        // Increase phase
+        const svfloat32_t next_re =
+            svmls_f32_x(all, svmul_f32_x(all, phase_re, incr_re), phase_im, incr_im);
+        phase_im = svmla_f32_x(all, svmul_f32_x(all, phase_re, incr_im), phase_im, incr_re);
+        phase_re = next_re;
+        if (i % reload == 0) {
+            // normalize phase so magnitude doesn't grow because of
+            // floating point rounding error
+            const svfloat32_t mag = svsqrt_f32_x(
+                all, svmla_f32_x(all, svmul_f32_x(all, phase_re, phase_re), phase_im, phase_im));
+            phase_re = svdiv_f32_x(all, phase_re, mag);
+            phase_im = svdiv_f32_x(all, phase_im, mag);
+        }
+    }
+
+    // the remaining points take the first lanes of the phases
+    const svbool_t pg = svwhilelt_b32_u32(number, num_points);
+    if (svptest_any(all, pg)) {
+        const svfloat32x2_t in = svld2_f32(pg, (const float*)(inVector + number));
+        const svfloat32_t in_re = svget2_f32(in, 0);
+        const svfloat32_t in_im = svget2_f32(in, 1);
+        const svfloat32_t out_re =
+            svmls_f32_x(pg, svmul_f32_x(pg, in_re, phase_re), in_im, phase_im);
+        const svfloat32_t out_im =
+            svmla_f32_x(pg, svmul_f32_x(pg, in_re, phase_im), in_im, phase_re);
+        svst2_f32(pg, (float*)(outVector + number), svcreate2_f32(out_re, out_im));
+    }
+
+    // For continuous phase next time we need to call this function, the
+    // phase of the first point not rotated yet
+    svst2_f32(all, (float*)phasePtr, svcreate2_f32(phase_re, phase_im));
+    (*phase) = phasePtr[num_points - number];
+    if (num_points) {
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+#endif /* LV_HAVE_SVE */
+
 
 #ifdef LV_HAVE_SSE4_1
 #include <smmintrin.h>
@@ -438,7 +642,7 @@ static inline void volk_32fc_s32fc_x2_rotator_32fc_a_avx(lv_32fc_t* outVector,
 {
     lv_32fc_t* cPtr = outVector;
     const lv_32fc_t* aPtr = inVector;
-    lv_32fc_t incr = lv_cmake(1.0, 0.0);
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
     lv_32fc_t phase_Ptr[4] = { (*phase), (*phase), (*phase), (*phase) };
 
     unsigned int i, j = 0;
@@ -512,7 +716,7 @@ static inline void volk_32fc_s32fc_x2_rotator_32fc_u_avx(lv_32fc_t* outVector,
 {
     lv_32fc_t* cPtr = outVector;
     const lv_32fc_t* aPtr = inVector;
-    lv_32fc_t incr = lv_cmake(1.0, 0.0);
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
     lv_32fc_t phase_Ptr[4] = { (*phase), (*phase), (*phase), (*phase) };
 
     unsigned int i, j = 0;
@@ -790,4 +994,111 @@ static inline void volk_32fc_s32fc_x2_rotator_32fc_u_avx_fma(lv_32fc_t* outVecto
 
 #endif /* LV_HAVE_AVX && LV_HAVE_FMA*/
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32fc_x2_rotator_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phase_Ptr[8];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    __m512 aVal, phase_Val, inc_Val, z;
+    __mmask16 mask;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 8, 1);
+    inc_Val =
+        _mm512_set4_ps(lv_cimag(incr), lv_creal(incr), lv_cimag(incr), lv_creal(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        // re-seed each block from its exact phase instead of renormalising
+        volk_rotator_exact_phases(phase_Ptr, *phase, phase_inc, i, 8);
+        phase_Val = _mm512_load_ps((float*)phase_Ptr);
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 8; ++j) {
+            aVal = _mm512_load_ps((float*)aPtr);
+            z = _mm512_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps(phase_Val, inc_Val);
+            _mm512_store_ps((float*)cPtr, z);
+            aPtr += 8;
+            cPtr += 8;
+        }
+
+        if (block_points % 8) {
+            mask = (__mmask16)((1u << (2 * (block_points % 8))) - 1);
+            aVal = _mm512_maskz_load_ps(mask, (const float*)aPtr);
+            z = _mm512_complexmul_ps(aVal, phase_Val);
+            _mm512_mask_store_ps((float*)cPtr, mask, z);
+            aPtr += block_points % 8;
+            cPtr += block_points % 8;
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32fc_x2_rotator_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phase_Ptr[8];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    __m512 aVal, phase_Val, inc_Val, z;
+    __mmask16 mask;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 8, 1);
+    inc_Val =
+        _mm512_set4_ps(lv_cimag(incr), lv_creal(incr), lv_cimag(incr), lv_creal(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        // re-seed each block from its exact phase instead of renormalising
+        volk_rotator_exact_phases(phase_Ptr, *phase, phase_inc, i, 8);
+        phase_Val = _mm512_load_ps((float*)phase_Ptr);
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 8; ++j) {
+            aVal = _mm512_loadu_ps((float*)aPtr);
+            z = _mm512_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps(phase_Val, inc_Val);
+            _mm512_storeu_ps((float*)cPtr, z);
+            aPtr += 8;
+            cPtr += 8;
+        }
+
+        if (block_points % 8) {
+            mask = (__mmask16)((1u << (2 * (block_points % 8))) - 1);
+            aVal = _mm512_maskz_loadu_ps(mask, (const float*)aPtr);
+            z = _mm512_complexmul_ps(aVal, phase_Val);
+            _mm512_mask_storeu_ps((float*)cPtr, mask, z);
+            aPtr += block_points % 8;
+            cPtr += block_points % 8;
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /* INCLUDED_volk_32fc_s32fc_rotator_32fc_a_H */
@@ -0,0 +1,242 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32fc_s32u_interp_linear_32fc
+ *
+ * \b Overview
+ *
+ * Interpolates linearly between points at a regular spacing, e.g. between the
+ * channel estimates at the pilot subcarriers of an OFDM symbol:
+ *
+ * outputVector[n] = pilots[k] + (pilots[k + 1] - pilots[k]) * j / spacing,
+ * with k = n / spacing and j = n % spacing
+ *
+ * The pilots are at the outputs 0, spacing, 2 * spacing and so on, and there
+ * are (num_points + spacing - 1) / spacing + 1 of them, so the last one is
+ * at or after the last output. To estimate subcarriers outside the pilots,
+ * extrapolate the pilots first.
+ *
+ * The SIMD versions count the pilot index and offset of each lane and gather
+ * the pilots around it, so any spacing vectorises. To equalise the data
+ * with the estimates in the same pass, see
+ * volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32u_interp_linear_32fc(lv_32fc_t* outputVector, const lv_32fc_t*
+ * pilots, const unsigned int spacing, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li pilots: The (num_points + spacing - 1) / spacing + 1 points to
+ * interpolate between.
+ * \li spacing: The number of outputs from one pilot to the next, at least 1.
+ * \li num_points: The number of outputs.
+ *
+ * \b Outputs
+ * \li outputVector: The interpolated points.
+ *
+ * \b Example
+ * Interpolate the channel over 300 subcarriers from pilots every 6 of them.
+ * \code
+ *   unsigned int N = 300;
+ *   unsigned int spacing = 6;
+ *   unsigned int num_pilots = (N + spacing - 1) / spacing + 1;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* pilots =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*num_pilots, alignment);
+ *   lv_32fc_t* channel = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < num_pilots; ++ii){
+ *       pilots[ii] = lv_cmake(cosf(0.3f * ii), sinf(0.3f * ii));
+ *   }
+ *
+ *   volk_32fc_s32u_interp_linear_32fc(channel, pilots, spacing, N);
+ *
+ *   volk_free(pilots);
+ *   volk_free(channel);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32u_interp_linear_32fc_H
+#define INCLUDED_volk_32fc_s32u_interp_linear_32fc_H
+
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32u_interp_linear_32fc_generic(lv_32fc_t* outputVector,
+                                                             const lv_32fc_t* pilots,
+                                                             const unsigned int spacing,
+                                                             unsigned int num_points)
+{
+    const float scale = 1.f / (float)spacing;
+    unsigned int number, k = 0, j = 0;
+    float weight;
+
+    for (number = 0; number < num_points; number++) {
+        weight = (float)j * scale;
+        outputVector[number] = pilots[k] + (pilots[k + 1] - pilots[k]) * weight;
+        if (++j == spacing) {
+            j = 0;
+            k++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_s32u_interp_linear_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                            const lv_32fc_t* pilots,
+                                                            const unsigned int spacing,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float scale = 1.f / (float)spacing;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256i duplicate = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+    // a complex point moves as a double
+    const double* p = (const double*)pilots;
+    // the pilot index and offset of each lane, and their step over 4 outputs
+    __m128i k = _mm_set_epi32(3 / spacing, 2 / spacing, 1 / spacing, 0);
+    __m128i j = _mm_set_epi32(3 % spacing, 2 % spacing, 1 % spacing, 0);
+    const __m128i kStep = _mm_set1_epi32((int)(4 / spacing));
+    const __m128i jStep = _mm_set1_epi32((int)(4 % spacing));
+    const __m128i last = _mm_set1_epi32((int)spacing - 1);
+    const __m128i vspacing = _mm_set1_epi32((int)spacing);
+    const __m128i one = _mm_set1_epi32(1);
+    unsigned int number, kTail, jTail;
+    __m128i wrap;
+    __m256 p0, p1, weight;
+
+    for (number = 0; number < quarterPoints; number++) {
+        p0 = _mm256_castpd_ps(_mm256_i32gather_pd(p, k, 8));
+        p1 = _mm256_castpd_ps(_mm256_i32gather_pd(p, _mm_add_epi32(k, one), 8));
+        weight = _mm256_mul_ps(
+            _mm256_permutevar8x32_ps(_mm256_castps128_ps256(_mm_cvtepi32_ps(j)),
+                                     duplicate),
+            vscale);
+        _mm256_storeu_ps((float*)outputVector,
+                         _mm256_add_ps(p0, _mm256_mul_ps(_mm256_sub_ps(p1, p0), weight)));
+        outputVector += 4;
+
+        j = _mm_add_epi32(j, jStep);
+        k = _mm_add_epi32(k, kStep);
+        wrap = _mm_cmpgt_epi32(j, last);
+        j = _mm_sub_epi32(j, _mm_and_si128(wrap, vspacing));
+        k = _mm_sub_epi32(k, wrap);
+    }
+
+    kTail = (quarterPoints * 4) / spacing;
+    jTail = (quarterPoints * 4) % spacing;
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *outputVector++ = pilots[kTail] +
+                          (pilots[kTail + 1] - pilots[kTail]) * ((float)jTail * scale);
+        if (++jTail == spacing) {
+            jTail = 0;
+            kTail++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32u_interp_linear_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                               const lv_32fc_t* pilots,
+                                                               const unsigned int spacing,
+                                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float scale = 1.f / (float)spacing;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512i duplicate =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    // a complex point moves as a double
+    const double* p = (const double*)pilots;
+    // the pilot index and offset of each lane, and their step over 8 outputs
+    __m256i k = _mm256_set_epi32(7 / spacing,
+                                 6 / spacing,
+                                 5 / spacing,
+                                 4 / spacing,
+                                 3 / spacing,
+                                 2 / spacing,
+                                 1 / spacing,
+                                 0);
+    __m256i j = _mm256_set_epi32(7 % spacing,
+                                 6 % spacing,
+                                 5 % spacing,
+                                 4 % spacing,
+                                 3 % spacing,
+                                 2 % spacing,
+                                 1 % spacing,
+                                 0);
+    const __m256i kStep = _mm256_set1_epi32((int)(8 / spacing));
+    const __m256i jStep = _mm256_set1_epi32((int)(8 % spacing));
+    const __m256i last = _mm256_set1_epi32((int)spacing - 1);
+    const __m256i vspacing = _mm256_set1_epi32((int)spacing);
+    const __m256i one = _mm256_set1_epi32(1);
+    unsigned int number, kTail, jTail;
+    __m256i wrap;
+    __m512 p0, p1, weight;
+
+    for (number = 0; number < eighthPoints; number++) {
+        p0 = _mm512_castpd_ps(_mm512_i32gather_pd(k, p, 8));
+        p1 = _mm512_castpd_ps(_mm512_i32gather_pd(_mm256_add_epi32(k, one), p, 8));
+        weight = _mm512_mul_ps(
+            _mm512_permutexvar_ps(duplicate,
+                                  _mm512_castps256_ps512(_mm256_cvtepi32_ps(j))),
+            vscale);
+        _mm512_storeu_ps((float*)outputVector,
+                         _mm512_add_ps(p0, _mm512_mul_ps(_mm512_sub_ps(p1, p0), weight)));
+        outputVector += 8;
+
+        j = _mm256_add_epi32(j, jStep);
+        k = _mm256_add_epi32(k, kStep);
+        wrap = _mm256_cmpgt_epi32(j, last);
+        j = _mm256_sub_epi32(j, _mm256_and_si256(wrap, vspacing));
+        k = _mm256_sub_epi32(k, wrap);
+    }
+
+    kTail = (eighthPoints * 8) / spacing;
+    jTail = (eighthPoints * 8) % spacing;
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputVector++ = pilots[kTail] +
+                          (pilots[kTail + 1] - pilots[kTail]) * ((float)jTail * scale);
+        if (++jTail == spacing) {
+            jTail = 0;
+            kTail++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_s32u_interp_linear_32fc_H */
@@ -0,0 +1,257 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s32u_x2_cfo_estimate_32f
+ *
+ * \b Overview
+ *
+ * Estimates a carrier frequency offset from the phase advance over delay
+ * points of a signal that repeats after delay points, such as a preamble
+ * of equal halves or the cyclic prefix of an OFDM symbol:
+ *
+ * estimates[s] = arg(sum of inputVector[n + delay] * conj(inputVector[n])) / delay
+ *
+ * for the n of segment s, in radians per point. The lagged conjugate
+ * products are summed in one pass, without the buffer of a
+ * volk_32fc_x2_multiply_conjugate_32fc and a separate sum. Each segment
+ * of segment products gets an estimate of its own for tracking a drifting
+ * offset; a segment of 0 gives one estimate of the whole input. An offset
+ * is unambiguous up to pi / delay radians per point.
+ *
+ * The SIMD versions multiply the delayed points by the real and by the
+ * imaginary part of the others in two sums of fused multiply-adds, and
+ * combine them into the conjugate product once per segment.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32u_x2_cfo_estimate_32f(float* estimates,
+ * const lv_32fc_t* inputVector, const unsigned int delay,
+ * const unsigned int segment, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: num_points + delay points.
+ * \li delay: The period of the repetition, at least 1.
+ * \li segment: The number of products of an estimate, 0 for all of them.
+ * \li num_points: The number of products.
+ *
+ * \b Outputs
+ * \li estimates: The num_points / segment estimates, rounded up, in radians
+ * per point; the last one is of the remaining products.
+ *
+ * \b Example
+ * Estimate the offset of a preamble of two equal halves of 64 points and
+ * correct it with a rotator.
+ * \code
+ *   float cfo;
+ *   volk_32fc_s32u_x2_cfo_estimate_32f(&cfo, preamble, 64, 0, 64);
+ *   lv_32fc_t phase_inc = lv_cmake(cosf(-cfo), sinf(-cfo));
+ *   lv_32fc_t phase = lv_cmake(1.f, 0.f);
+ *   volk_32fc_s32fc_x2_rotator_32fc(out, in, phase_inc, &phase, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32u_x2_cfo_estimate_32f_H
+#define INCLUDED_volk_32fc_s32u_x2_cfo_estimate_32f_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/* The sum of count products from inputVector on */
+static inline lv_32fc_t volk_cfo_estimate_sum(const lv_32fc_t* inputVector,
+                                              unsigned int delay,
+                                              unsigned int count)
+{
+    lv_32fc_t sum = lv_cmake(0.f, 0.f);
+    unsigned int k;
+
+    for (k = 0; k < count; k++) {
+        sum += inputVector[k + delay] * lv_conj(inputVector[k]);
+    }
+    return sum;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_s32u_x2_cfo_estimate_32f_generic(float* estimates,
+                                           const lv_32fc_t* inputVector,
+                                           const unsigned int delay,
+                                           const unsigned int segment,
+                                           unsigned int num_points)
+{
+    const unsigned int length = segment && segment < num_points ? segment : num_points;
+    unsigned int start;
+
+    for (start = 0; start < num_points; start += length) {
+        const unsigned int count =
+            num_points - start < length ? num_points - start : length;
+        const lv_32fc_t sum = volk_cfo_estimate_sum(inputVector + start, delay, count);
+        *estimates++ = atan2f(lv_cimag(sum), lv_creal(sum)) / delay;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32fc_s32u_x2_cfo_estimate_32f_u_avx2_fma(float* estimates,
+                                              const lv_32fc_t* inputVector,
+                                              const unsigned int delay,
+                                              const unsigned int segment,
+                                              unsigned int num_points)
+{
+    const unsigned int length = segment && segment < num_points ? segment : num_points;
+    const __m256 ones = _mm256_set1_ps(1.f);
+    __VOLK_ATTR_ALIGNED(32) float parts[8];
+    unsigned int start, k, j;
+
+    for (start = 0; start < num_points; start += length) {
+        const unsigned int count =
+            num_points - start < length ? num_points - start : length;
+        const float* x = (const float*)(inputVector + start);
+        const float* delayed = (const float*)(inputVector + start + delay);
+        __m256 by_re0 = _mm256_setzero_ps(), by_im0 = _mm256_setzero_ps();
+        __m256 by_re1 = _mm256_setzero_ps(), by_im1 = _mm256_setzero_ps();
+        lv_32fc_t sum;
+
+        for (k = 0; k + 8 <= count; k += 8) {
+            const __m256 x0 = _mm256_loadu_ps(x + 2 * k);
+            const __m256 x1 = _mm256_loadu_ps(x + 2 * k + 8);
+            const __m256 d0 = _mm256_loadu_ps(delayed + 2 * k);
+            const __m256 d1 = _mm256_loadu_ps(delayed + 2 * k + 8);
+            by_re0 = _mm256_fmadd_ps(d0, _mm256_moveldup_ps(x0), by_re0);
+            by_im0 = _mm256_fmadd_ps(d0, _mm256_movehdup_ps(x0), by_im0);
+            by_re1 = _mm256_fmadd_ps(d1, _mm256_moveldup_ps(x1), by_re1);
+            by_im1 = _mm256_fmadd_ps(d1, _mm256_movehdup_ps(x1), by_im1);
+        }
+        by_re0 = _mm256_add_ps(by_re0, by_re1);
+        by_im0 = _mm256_add_ps(by_im0, by_im1);
+        // dr*xr + di*xi, di*xr - dr*xi
+        _mm256_store_ps(
+            parts, _mm256_fmsubadd_ps(by_re0, ones, _mm256_permute_ps(by_im0, 0xB1)));
+
+        sum = volk_cfo_estimate_sum(inputVector + start + k, delay, count - k);
+        for (j = 0; j < 8; j += 2) {
+            sum += lv_cmake(parts[j], parts[j + 1]);
+        }
+        *estimates++ = atan2f(lv_cimag(sum), lv_creal(sum)) / delay;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_s32u_x2_cfo_estimate_32f_u_avx512f(float* estimates,
+                                             const lv_32fc_t* inputVector,
+                                             const unsigned int delay,
+                                             const unsigned int segment,
+                                             unsigned int num_points)
+{
+    const unsigned int length = segment && segment < num_points ? segment : num_points;
+    const __m512 ones = _mm512_set1_ps(1.f);
+    unsigned int start, k;
+
+    for (start = 0; start < num_points; start += length) {
+        const unsigned int count =
+            num_points - start < length ? num_points - start : length;
+        const float* x = (const float*)(inputVector + start);
+        const float* delayed = (const float*)(inputVector + start + delay);
+        __m512 by_re0 = _mm512_setzero_ps(), by_im0 = _mm512_setzero_ps();
+        __m512 by_re1 = _mm512_setzero_ps(), by_im1 = _mm512_setzero_ps();
+        lv_32fc_t sum;
+
+        for (k = 0; k + 16 <= count; k += 16) {
+            const __m512 x0 = _mm512_loadu_ps(x + 2 * k);
+            const __m512 x1 = _mm512_loadu_ps(x + 2 * k + 16);
+            const __m512 d0 = _mm512_loadu_ps(delayed + 2 * k);
+            const __m512 d1 = _mm512_loadu_ps(delayed + 2 * k + 16);
+            by_re0 = _mm512_fmadd_ps(d0, _mm512_moveldup_ps(x0), by_re0);
+            by_im0 = _mm512_fmadd_ps(d0, _mm512_movehdup_ps(x0), by_im0);
+            by_re1 = _mm512_fmadd_ps(d1, _mm512_moveldup_ps(x1), by_re1);
+            by_im1 = _mm512_fmadd_ps(d1, _mm512_movehdup_ps(x1), by_im1);
+        }
+        by_re0 = _mm512_add_ps(by_re0, by_re1);
+        by_im0 = _mm512_add_ps(by_im0, by_im1);
+        // dr*xr + di*xi, di*xr - dr*xi
+        by_re0 = _mm512_fmsubadd_ps(by_re0, ones, _mm512_permute_ps(by_im0, 0xB1));
+
+        sum = volk_cfo_estimate_sum(inputVector + start + k, delay, count - k);
+        sum += lv_cmake(_mm512_mask_reduce_add_ps(0x5555, by_re0),
+                        _mm512_mask_reduce_add_ps(0xAAAA, by_re0));
+        *estimates++ = atan2f(lv_cimag(sum), lv_creal(sum)) / delay;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_s32u_x2_cfo_estimate_32f_neonv8(float* estimates,
+                                          const lv_32fc_t* inputVector,
+                                          const unsigned int delay,
+                                          const unsigned int segment,
+                                          unsigned int num_points)
+{
+    const unsigned int length = segment && segment < num_points ? segment : num_points;
+    unsigned int start, k;
+
+    for (start = 0; start < num_points; start += length) {
+        const unsigned int count =
+            num_points - start < length ? num_points - start : length;
+        const float* x = (const float*)(inputVector + start);
+        const float* delayed = (const float*)(inputVector + start + delay);
+        float32x4_t re0 = vdupq_n_f32(0.f), im0 = vdupq_n_f32(0.f);
+        float32x4_t re1 = vdupq_n_f32(0.f), im1 = vdupq_n_f32(0.f);
+        lv_32fc_t sum;
+
+        for (k = 0; k + 8 <= count; k += 8) {
+            const float32x4x2_t x0 = vld2q_f32(x + 2 * k);
+            const float32x4x2_t x1 = vld2q_f32(x + 2 * k + 8);
+            const float32x4x2_t d0 = vld2q_f32(delayed + 2 * k);
+            const float32x4x2_t d1 = vld2q_f32(delayed + 2 * k + 8);
+            // dr*xr + di*xi, di*xr - dr*xi
+            re0 = vfmaq_f32(vfmaq_f32(re0, d0.val[0], x0.val[0]), d0.val[1], x0.val[1]);
+            im0 = vfmsq_f32(vfmaq_f32(im0, d0.val[1], x0.val[0]), d0.val[0], x0.val[1]);
+            re1 = vfmaq_f32(vfmaq_f32(re1, d1.val[0], x1.val[0]), d1.val[1], x1.val[1]);
+            im1 = vfmsq_f32(vfmaq_f32(im1, d1.val[1], x1.val[0]), d1.val[0], x1.val[1]);
+        }
+
+        sum = volk_cfo_estimate_sum(inputVector + start + k, delay, count - k);
+        sum += lv_cmake(vaddvq_f32(vaddq_f32(re0, re1)), vaddvq_f32(vaddq_f32(im0, im1)));
+        *estimates++ = atan2f(lv_cimag(sum), lv_creal(sum)) / delay;
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32u_x2_cfo_estimate_32f_H */
@@ -0,0 +1,409 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32fc_s32u_x2_delay_correlate_32fc_32f
+ *
+ * \b Overview
+ *
+ * Correlates the input with itself delayed over a sliding window, and sums
+ * the energy of the delayed window alongside, as the timing metric of
+ * Schmidl and Cox does for a preamble of two equal halves or an OFDM symbol
+ * does with its cyclic prefix:
+ *
+ * correlationVector[n] = sum of inputVector[n + k] * conj(inputVector[n + k + delay])
+ *
+ * energyVector[n] = sum of |inputVector[n + k + delay]|^2
+ *
+ * for k from 0 to length - 1. The timing metric is then
+ * |correlationVector[n]|^2 / energyVector[n]^2.
+ *
+ * The input holds num_points + delay + length - 1 points: to correlate a
+ * stream cut into buffers, keep the last delay + length - 1 points of each
+ * buffer in front of the next one.
+ *
+ * Both sums are computed in full for the first output of each call and then
+ * updated by the products entering and leaving the window. The SIMD versions
+ * scan these differences a vector at a time, carrying the sums from one
+ * vector to the next, which rounds differently from the generic version.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32u_x2_delay_correlate_32fc_32f(lv_32fc_t* correlationVector,
+ * float* energyVector, const lv_32fc_t* inputVector, const unsigned int delay,
+ * const unsigned int length, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The num_points + delay + length - 1 points to correlate.
+ * \li delay: The delay of the input correlated with, e.g. the length of half
+ * the preamble or the FFT length for the cyclic prefix.
+ * \li length: The number of products summed, at least 1.
+ * \li num_points: The number of outputs.
+ *
+ * \b Outputs
+ * \li correlationVector: The sliding correlations.
+ * \li energyVector: The energies of the delayed windows.
+ *
+ * \b Example
+ * Find the timing of a preamble of two equal halves of 64 points.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int L = 64;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*(N + 2 * L - 1), alignment);
+ *   lv_32fc_t* corr = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   float* energy = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N + 2 * L - 1; ++ii){
+ *       float phase = (float)((ii * ii) % 64);
+ *       in[ii] = ii >= 300 && ii < 300 + 2 * L ? lv_cmake(cosf(phase), sinf(phase))
+ *                                              : lv_cmake(0.01f, 0.f);
+ *   }
+ *
+ *   volk_32fc_s32u_x2_delay_correlate_32fc_32f(corr, energy, in, L, L, N);
+ *
+ *   volk_free(in);
+ *   volk_free(corr);
+ *   volk_free(energy);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32u_x2_delay_correlate_32fc_32f_H
+#define INCLUDED_volk_32fc_s32u_x2_delay_correlate_32fc_32f_H
+
+#include <volk/volk_complex.h>
+
+/* The sums of the first window, which the versions all start from */
+static inline void volk_delay_correlate_window(lv_32fc_t* correlation,
+                                               float* energy,
+                                               const lv_32fc_t* inputVector,
+                                               unsigned int delay,
+                                               unsigned int length)
+{
+    lv_32fc_t corr = lv_cmake(0.f, 0.f);
+    float sum = 0.f;
+    unsigned int k;
+
+    for (k = 0; k < length; k++) {
+        corr += inputVector[k] * lv_conj(inputVector[k + delay]);
+        sum += lv_creal(inputVector[k + delay]) * lv_creal(inputVector[k + delay]) +
+               lv_cimag(inputVector[k + delay]) * lv_cimag(inputVector[k + delay]);
+    }
+    *correlation = corr;
+    *energy = sum;
+}
+
+/* Slides the window of the sums one point, to the output number */
+static inline void volk_delay_correlate_step(lv_32fc_t* correlation,
+                                             float* energy,
+                                             const lv_32fc_t* inputVector,
+                                             unsigned int delay,
+                                             unsigned int length,
+                                             unsigned int number)
+{
+    const lv_32fc_t enter = inputVector[number + length - 1];
+    const lv_32fc_t enterDelayed = inputVector[number + length - 1 + delay];
+    const lv_32fc_t leave = inputVector[number - 1];
+    const lv_32fc_t leaveDelayed = inputVector[number - 1 + delay];
+
+    *correlation += enter * lv_conj(enterDelayed) - leave * lv_conj(leaveDelayed);
+    *energy += lv_creal(enterDelayed) * lv_creal(enterDelayed) +
+               lv_cimag(enterDelayed) * lv_cimag(enterDelayed) -
+               (lv_creal(leaveDelayed) * lv_creal(leaveDelayed) +
+                lv_cimag(leaveDelayed) * lv_cimag(leaveDelayed));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_s32u_x2_delay_correlate_32fc_32f_generic(lv_32fc_t* correlationVector,
+                                                   float* energyVector,
+                                                   const lv_32fc_t* inputVector,
+                                                   const unsigned int delay,
+                                                   const unsigned int length,
+                                                   unsigned int num_points)
+{
+    lv_32fc_t correlation;
+    float energy;
+    unsigned int number;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    volk_delay_correlate_window(&correlation, &energy, inputVector, delay, length);
+    correlationVector[0] = correlation;
+    energyVector[0] = energy;
+
+    for (number = 1; number < num_points; number++) {
+        volk_delay_correlate_step(
+            &correlation, &energy, inputVector, delay, length, number);
+        correlationVector[number] = correlation;
+        energyVector[number] = energy;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void
+volk_32fc_s32u_x2_delay_correlate_32fc_32f_u_avx(lv_32fc_t* correlationVector,
+                                                 float* energyVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 const unsigned int delay,
+                                                 const unsigned int length,
+                                                 unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) float carried[8];
+    unsigned int quarterPoints, number;
+    const float* enter;
+    const float* leave;
+    __m256 enterDelayed, leaveDelayed, corrCarry, energyCarry, sums;
+    lv_32fc_t correlation;
+    float energy;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    volk_delay_correlate_window(&correlation, &energy, inputVector, delay, length);
+    correlationVector[0] = correlation;
+    energyVector[0] = energy;
+
+    // the sums of the outputs from 1 on
+    quarterPoints = (num_points - 1) / 4;
+    corrCarry = _mm256_setr_ps(lv_creal(correlation),
+                               lv_cimag(correlation),
+                               lv_creal(correlation),
+                               lv_cimag(correlation),
+                               lv_creal(correlation),
+                               lv_cimag(correlation),
+                               lv_creal(correlation),
+                               lv_cimag(correlation));
+    energyCarry = _mm256_set1_ps(energy);
+    for (number = 0; number < quarterPoints; number++) {
+        enter = (const float*)(inputVector + 4 * number + length);
+        leave = (const float*)(inputVector + 4 * number);
+        enterDelayed = _mm256_loadu_ps(enter + 2 * delay);
+        leaveDelayed = _mm256_loadu_ps(leave + 2 * delay);
+
+        corrCarry = _mm256_add_ps(
+            _mm256_scan_complex_ps(_mm256_sub_ps(
+                _mm256_complexconjugatemul_ps(_mm256_loadu_ps(enter), enterDelayed),
+                _mm256_complexconjugatemul_ps(_mm256_loadu_ps(leave), leaveDelayed))),
+            corrCarry);
+        _mm256_storeu_ps((float*)(correlationVector + 4 * number + 1), corrCarry);
+
+        // the scan of the squared parts holds the energies in its odd lanes
+        sums = _mm256_add_ps(
+            _mm256_scan_ps(_mm256_sub_ps(_mm256_mul_ps(enterDelayed, enterDelayed),
+                                         _mm256_mul_ps(leaveDelayed, leaveDelayed))),
+            energyCarry);
+        _mm_storeu_ps(energyVector + 4 * number + 1,
+                      _mm_shuffle_ps(_mm256_castps256_ps128(sums),
+                                     _mm256_extractf128_ps(sums, 1),
+                                     _MM_SHUFFLE(3, 1, 3, 1)));
+
+        corrCarry = _mm256_permute_ps(corrCarry, 0xee);
+        corrCarry = _mm256_permute2f128_ps(corrCarry, corrCarry, 0x11);
+        energyCarry = _mm256_permute_ps(sums, 0xff);
+        energyCarry = _mm256_permute2f128_ps(energyCarry, energyCarry, 0x11);
+    }
+    _mm256_store_ps(carried, corrCarry);
+    correlation = lv_cmake(carried[0], carried[1]);
+    energy = _mm256_cvtss_f32(energyCarry);
+
+    for (number = quarterPoints * 4 + 1; number < num_points; number++) {
+        volk_delay_correlate_step(
+            &correlation, &energy, inputVector, delay, length, number);
+        correlationVector[number] = correlation;
+        energyVector[number] = energy;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_s32u_x2_delay_correlate_32fc_32f_u_avx512f(lv_32fc_t* correlationVector,
+                                                     float* energyVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     const unsigned int delay,
+                                                     const unsigned int length,
+                                                     unsigned int num_points)
+{
+    const __m512i lastPoint =
+        _mm512_set_epi32(15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14);
+    const __m512i oddLanes =
+        _mm512_set_epi32(15, 13, 11, 9, 7, 5, 3, 1, 15, 13, 11, 9, 7, 5, 3, 1);
+    const __m512i lastLane = _mm512_set1_epi32(15);
+    __VOLK_ATTR_ALIGNED(64) float carried[16];
+    unsigned int eighthPoints, number;
+    const float* enter;
+    const float* leave;
+    __m512 enterDelayed, leaveDelayed, corrCarry, energyCarry, sums;
+    lv_32fc_t correlation;
+    float energy;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    volk_delay_correlate_window(&correlation, &energy, inputVector, delay, length);
+    correlationVector[0] = correlation;
+    energyVector[0] = energy;
+
+    // the sums of the outputs from 1 on
+    eighthPoints = (num_points - 1) / 8;
+    corrCarry = _mm512_mask_mov_ps(_mm512_set1_ps(lv_cimag(correlation)),
+                                   0x5555,
+                                   _mm512_set1_ps(lv_creal(correlation)));
+    energyCarry = _mm512_set1_ps(energy);
+    for (number = 0; number < eighthPoints; number++) {
+        enter = (const float*)(inputVector + 8 * number + length);
+        leave = (const float*)(inputVector + 8 * number);
+        enterDelayed = _mm512_loadu_ps(enter + 2 * delay);
+        leaveDelayed = _mm512_loadu_ps(leave + 2 * delay);
+
+        corrCarry = _mm512_add_ps(
+            _mm512_scan_complex_ps(_mm512_sub_ps(
+                _mm512_complexconjugatemul_ps(_mm512_loadu_ps(enter), enterDelayed),
+                _mm512_complexconjugatemul_ps(_mm512_loadu_ps(leave), leaveDelayed))),
+            corrCarry);
+        _mm512_storeu_ps((float*)(correlationVector + 8 * number + 1), corrCarry);
+
+        // the scan of the squared parts holds the energies in its odd lanes
+        sums = _mm512_add_ps(
+            _mm512_scan_ps(_mm512_sub_ps(_mm512_mul_ps(enterDelayed, enterDelayed),
+                                         _mm512_mul_ps(leaveDelayed, leaveDelayed))),
+            energyCarry);
+        _mm256_storeu_ps(energyVector + 8 * number + 1,
+                         _mm512_castps512_ps256(_mm512_permutexvar_ps(oddLanes, sums)));
+
+        corrCarry = _mm512_permutexvar_ps(lastPoint, corrCarry);
+        energyCarry = _mm512_permutexvar_ps(lastLane, sums);
+    }
+    _mm512_store_ps(carried, corrCarry);
+    correlation = lv_cmake(carried[0], carried[1]);
+    energy = _mm512_cvtss_f32(energyCarry);
+
+    for (number = eighthPoints * 8 + 1; number < num_points; number++) {
+        volk_delay_correlate_step(
+            &correlation, &energy, inputVector, delay, length, number);
+        correlationVector[number] = correlation;
+        energyVector[number] = energy;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32fc_s32u_x2_delay_correlate_32fc_32f_neon(lv_32fc_t* correlationVector,
+                                                float* energyVector,
+                                                const lv_32fc_t* inputVector,
+                                                const unsigned int delay,
+                                                const unsigned int length,
+                                                unsigned int num_points)
+{
+    unsigned int quarterPoints, number;
+    const float* enter;
+    const float* leave;
+    float32x4x2_t a, ad, b, bd, corr;
+    float32x4_t energyCarry, sums;
+    lv_32fc_t correlation;
+    float energy;
+
+    if (num_points == 0) {
+        return;
+    }
+
+    volk_delay_correlate_window(&correlation, &energy, inputVector, delay, length);
+    correlationVector[0] = correlation;
+    energyVector[0] = energy;
+
+    // the sums of the outputs from 1 on, with the parts deinterleaved
+    quarterPoints = (num_points - 1) / 4;
+    corr.val[0] = vdupq_n_f32(lv_creal(correlation));
+    corr.val[1] = vdupq_n_f32(lv_cimag(correlation));
+    energyCarry = vdupq_n_f32(energy);
+    for (number = 0; number < quarterPoints; number++) {
+        enter = (const float*)(inputVector + 4 * number + length);
+        leave = (const float*)(inputVector + 4 * number);
+        a = vld2q_f32(enter);
+        ad = vld2q_f32(enter + 2 * delay);
+        b = vld2q_f32(leave);
+        bd = vld2q_f32(leave + 2 * delay);
+
+        // a * conj(ad) - b * conj(bd)
+        corr.val[0] = vaddq_f32(
+            _vscanq_f32(vsubq_f32(
+                vmlaq_f32(vmulq_f32(a.val[0], ad.val[0]), a.val[1], ad.val[1]),
+                vmlaq_f32(vmulq_f32(b.val[0], bd.val[0]), b.val[1], bd.val[1]))),
+            corr.val[0]);
+        corr.val[1] = vaddq_f32(
+            _vscanq_f32(vsubq_f32(
+                vmlsq_f32(vmulq_f32(a.val[1], ad.val[0]), a.val[0], ad.val[1]),
+                vmlsq_f32(vmulq_f32(b.val[1], bd.val[0]), b.val[0], bd.val[1]))),
+            corr.val[1]);
+        vst2q_f32((float*)(correlationVector + 4 * number + 1), corr);
+
+        sums = vaddq_f32(
+            _vscanq_f32(vsubq_f32(
+                vmlaq_f32(vmulq_f32(ad.val[0], ad.val[0]), ad.val[1], ad.val[1]),
+                vmlaq_f32(vmulq_f32(bd.val[0], bd.val[0]), bd.val[1], bd.val[1]))),
+            energyCarry);
+        vst1q_f32(energyVector + 4 * number + 1, sums);
+
+        corr.val[0] = vdupq_n_f32(vgetq_lane_f32(corr.val[0], 3));
+        corr.val[1] = vdupq_n_f32(vgetq_lane_f32(corr.val[1], 3));
+        energyCarry = vdupq_n_f32(vgetq_lane_f32(sums, 3));
+    }
+    correlation =
+        lv_cmake(vgetq_lane_f32(corr.val[0], 0), vgetq_lane_f32(corr.val[1], 0));
+    energy = vgetq_lane_f32(energyCarry, 0);
+
+    for (number = quarterPoints * 4 + 1; number < num_points; number++) {
+        volk_delay_correlate_step(
+            &correlation, &energy, inputVector, delay, length, number);
+        correlationVector[number] = correlation;
+        energyVector[number] = energy;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32u_x2_delay_correlate_32fc_32f_H */
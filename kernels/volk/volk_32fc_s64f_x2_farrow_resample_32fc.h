@@ -0,0 +1,287 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_s64f_x2_farrow_resample_32fc
+ *
+ * \b Overview
+ *
+ * Resamples complex samples at any ratio with a cubic Lagrange interpolator
+ * in Farrow form. Output i is at t = offset + i * step inputs: with n the
+ * integer part of t and mu the fraction, it is the cubic through inputs n
+ * to n + 3 evaluated mu past input n + 1,
+ *
+ * out = ((c3 * mu + c2) * mu + c1) * mu + in[n + 1]
+ *
+ * where c1, c2 and c3 are fixed combinations of the four inputs, so the
+ * input holds floor(offset + (num_points - 1) * step) + 4 samples.
+ *
+ * The interpolator suits signals well inside the input band: a quarter of
+ * the input rate already loses up to 1 dB between samples, so wider signals
+ * go through an interpolating or resampling FIR first. A polyphase stage
+ * for the bulk of a ratio and this one for the remaining fraction, or to
+ * follow a drifting clock, costs a few operations per output.
+ *
+ * The SIMD implementations compute four outputs at once, from their four
+ * windows either loaded and transposed with shuffles or gathered, which is
+ * faster depending on the machine. For a resampler running over a stream,
+ * volk_farrow_resampler_32fc_init() in volk_fir.h keeps the history and the
+ * position of the next output between blocks in a caller-owned state.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s64f_x2_farrow_resample_32fc(lv_32fc_t* output,
+ * const lv_32fc_t* input, const double offset, const double step,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The samples, the oldest first.
+ * \li offset: The position of the first output, at least 0.
+ * \li step: The inputs per output, the input rate over the output rate.
+ * \li num_points: The number of outputs.
+ *
+ * \b Outputs
+ * \li output: num_points samples.
+ *
+ * \b Example
+ * Resample by 1.0001 to follow a clock 100 ppm slow.
+ * \code
+ *   unsigned int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*(N + 5), alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   volk_32fc_s64f_x2_farrow_resample_32fc(out, in, 0., 1.0001, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s64f_x2_farrow_resample_32fc_u_H
+#define INCLUDED_volk_32fc_s64f_x2_farrow_resample_32fc_u_H
+
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s64f_x2_farrow_resample_32fc_generic(lv_32fc_t* output,
+                                                                  const lv_32fc_t* input,
+                                                                  const double offset,
+                                                                  const double step,
+                                                                  unsigned int num_points)
+{
+    const float half = 0.5f, third = 1.f / 3.f, sixth = 1.f / 6.f;
+    lv_32fc_t xm1, x0, x1, x2, c1, c2, c3;
+    unsigned int number, start;
+    double t;
+    float mu;
+
+    for (number = 0; number < num_points; number++) {
+        t = offset + number * step;
+        start = (unsigned int)t;
+        mu = (float)(t - start);
+        xm1 = input[start];
+        x0 = input[start + 1];
+        x1 = input[start + 2];
+        x2 = input[start + 3];
+        c3 = (x2 - xm1) * sixth + (x0 - x1) * half;
+        c2 = (xm1 + x1) * half - x0;
+        c1 = x1 - x0 * half - xm1 * third - x2 * sixth;
+        output[number] = ((c3 * mu + c2) * mu + c1) * mu + x0;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_s64f_x2_farrow_resample_32fc_u_avx_fma(
+    lv_32fc_t* output,
+    const lv_32fc_t* input,
+    const double offset,
+    const double step,
+    unsigned int num_points)
+{
+    const __m256d offsetVal = _mm256_set1_pd(offset);
+    const __m256d stepVal = _mm256_set1_pd(step);
+    const __m256d lanes = _mm256_set_pd(3., 2., 1., 0.);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 third = _mm256_set1_ps(1.f / 3.f);
+    const __m256 sixth = _mm256_set1_ps(1.f / 6.f);
+    __VOLK_ATTR_ALIGNED(16) int32_t starts[4];
+    __m256d t, row0, row1, row2, row3, low02, low13, high02, high13;
+    __m256 xm1, x0, x1, x2, c1, c2, c3, muVal;
+    __m128i start;
+    __m128 mu;
+    unsigned int number;
+
+    for (number = 0; number + 4 <= num_points; number += 4) {
+        t = _mm256_add_pd(
+            offsetVal,
+            _mm256_mul_pd(_mm256_add_pd(_mm256_set1_pd((double)number), lanes), stepVal));
+        start = _mm256_cvttpd_epi32(t);
+        mu = _mm256_cvtpd_ps(_mm256_sub_pd(t, _mm256_cvtepi32_pd(start)));
+        muVal = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(_mm_unpacklo_ps(mu, mu)), _mm_unpackhi_ps(mu, mu), 1);
+
+        // the four windows are rows of four complex samples, transpose them
+        _mm_store_si128((__m128i*)starts, start);
+        row0 = _mm256_loadu_pd((const double*)(input + starts[0]));
+        row1 = _mm256_loadu_pd((const double*)(input + starts[1]));
+        row2 = _mm256_loadu_pd((const double*)(input + starts[2]));
+        row3 = _mm256_loadu_pd((const double*)(input + starts[3]));
+        low02 = _mm256_permute2f128_pd(row0, row2, 0x20);
+        low13 = _mm256_permute2f128_pd(row1, row3, 0x20);
+        high02 = _mm256_permute2f128_pd(row0, row2, 0x31);
+        high13 = _mm256_permute2f128_pd(row1, row3, 0x31);
+        xm1 = _mm256_castpd_ps(_mm256_unpacklo_pd(low02, low13));
+        x0 = _mm256_castpd_ps(_mm256_unpackhi_pd(low02, low13));
+        x1 = _mm256_castpd_ps(_mm256_unpacklo_pd(high02, high13));
+        x2 = _mm256_castpd_ps(_mm256_unpackhi_pd(high02, high13));
+
+        c3 = _mm256_fmadd_ps(
+            _mm256_sub_ps(x2, xm1), sixth, _mm256_mul_ps(_mm256_sub_ps(x0, x1), half));
+        c2 = _mm256_fmsub_ps(_mm256_add_ps(xm1, x1), half, x0);
+        c1 = _mm256_fnmadd_ps(
+            x2, sixth, _mm256_fnmadd_ps(xm1, third, _mm256_fnmadd_ps(x0, half, x1)));
+        _mm256_storeu_ps(
+            (float*)(output + number),
+            _mm256_fmadd_ps(
+                _mm256_fmadd_ps(_mm256_fmadd_ps(c3, muVal, c2), muVal, c1), muVal, x0));
+    }
+
+    volk_32fc_s64f_x2_farrow_resample_32fc_generic(
+        output + number, input, offset + number * step, step, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_s64f_x2_farrow_resample_32fc_u_avx2_gather(
+    lv_32fc_t* output,
+    const lv_32fc_t* input,
+    const double offset,
+    const double step,
+    unsigned int num_points)
+{
+    const __m256d offsetVal = _mm256_set1_pd(offset);
+    const __m256d stepVal = _mm256_set1_pd(step);
+    const __m256d lanes = _mm256_set_pd(3., 2., 1., 0.);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 third = _mm256_set1_ps(1.f / 3.f);
+    const __m256 sixth = _mm256_set1_ps(1.f / 6.f);
+    const double* samples = (const double*)input;
+    __m256d t;
+    __m256 xm1, x0, x1, x2, c1, c2, c3, muVal;
+    __m128i start;
+    __m128 mu;
+    unsigned int number;
+
+    for (number = 0; number + 4 <= num_points; number += 4) {
+        t = _mm256_add_pd(
+            offsetVal,
+            _mm256_mul_pd(_mm256_add_pd(_mm256_set1_pd((double)number), lanes), stepVal));
+        start = _mm256_cvttpd_epi32(t);
+        mu = _mm256_cvtpd_ps(_mm256_sub_pd(t, _mm256_cvtepi32_pd(start)));
+        muVal = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(_mm_unpacklo_ps(mu, mu)), _mm_unpackhi_ps(mu, mu), 1);
+
+        // a complex sample of each window per gather
+        xm1 = _mm256_castpd_ps(_mm256_i32gather_pd(samples, start, 8));
+        x0 = _mm256_castpd_ps(_mm256_i32gather_pd(samples + 1, start, 8));
+        x1 = _mm256_castpd_ps(_mm256_i32gather_pd(samples + 2, start, 8));
+        x2 = _mm256_castpd_ps(_mm256_i32gather_pd(samples + 3, start, 8));
+
+        c3 = _mm256_fmadd_ps(
+            _mm256_sub_ps(x2, xm1), sixth, _mm256_mul_ps(_mm256_sub_ps(x0, x1), half));
+        c2 = _mm256_fmsub_ps(_mm256_add_ps(xm1, x1), half, x0);
+        c1 = _mm256_fnmadd_ps(
+            x2, sixth, _mm256_fnmadd_ps(xm1, third, _mm256_fnmadd_ps(x0, half, x1)));
+        _mm256_storeu_ps(
+            (float*)(output + number),
+            _mm256_fmadd_ps(
+                _mm256_fmadd_ps(_mm256_fmadd_ps(c3, muVal, c2), muVal, c1), muVal, x0));
+    }
+
+    volk_32fc_s64f_x2_farrow_resample_32fc_generic(
+        output + number, input, offset + number * step, step, num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_s64f_x2_farrow_resample_32fc_neonv8(lv_32fc_t* output,
+                                              const lv_32fc_t* input,
+                                              const double offset,
+                                              const double step,
+                                              unsigned int num_points)
+{
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t third = vdupq_n_f32(1.f / 3.f);
+    const float32x4_t sixth = vdupq_n_f32(1.f / 6.f);
+    float64x2_t low0, high0, low1, high1;
+    float32x4_t xm1, x0, x1, x2, c1, c2, c3, muVal;
+    unsigned int number, start0, start1;
+    double t0, t1;
+
+    for (number = 0; number + 2 <= num_points; number += 2) {
+        t0 = offset + number * step;
+        t1 = offset + (number + 1) * step;
+        start0 = (unsigned int)t0;
+        start1 = (unsigned int)t1;
+        muVal = vcombine_f32(vdup_n_f32((float)(t0 - start0)),
+                             vdup_n_f32((float)(t1 - start1)));
+
+        // the two windows are rows of four complex samples, transpose them
+        low0 = vreinterpretq_f64_f32(vld1q_f32((const float*)(input + start0)));
+        high0 = vreinterpretq_f64_f32(vld1q_f32((const float*)(input + start0 + 2)));
+        low1 = vreinterpretq_f64_f32(vld1q_f32((const float*)(input + start1)));
+        high1 = vreinterpretq_f64_f32(vld1q_f32((const float*)(input + start1 + 2)));
+        xm1 = vreinterpretq_f32_f64(vzip1q_f64(low0, low1));
+        x0 = vreinterpretq_f32_f64(vzip2q_f64(low0, low1));
+        x1 = vreinterpretq_f32_f64(vzip1q_f64(high0, high1));
+        x2 = vreinterpretq_f32_f64(vzip2q_f64(high0, high1));
+
+        c3 = vfmaq_f32(vmulq_f32(vsubq_f32(x0, x1), half), vsubq_f32(x2, xm1), sixth);
+        c2 = vsubq_f32(vmulq_f32(vaddq_f32(xm1, x1), half), x0);
+        c1 = vfmsq_f32(vfmsq_f32(vfmsq_f32(x1, x0, half), xm1, third), x2, sixth);
+        vst1q_f32((float*)(output + number),
+                  vfmaq_f32(x0, vfmaq_f32(c1, vfmaq_f32(c2, c3, muVal), muVal), muVal));
+    }
+
+    volk_32fc_s64f_x2_farrow_resample_32fc_generic(
+        output + number, input, offset + number * step, step, num_points - number);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s64f_x2_farrow_resample_32fc_u_H */
@@ -0,0 +1,92 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_32u_scatter_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_scatterpuppet_32fc_H
+#define INCLUDED_volk_32fc_scatterpuppet_32fc_H
+
+#include <volk/volk_32fc_32u_scatter_32fc.h>
+#include <volk/volk_32fc_gatherpuppet_32fc.h>
+
+/* Scatters the input through the permutation of volk_subcarrier_indices */
+static inline void volk_32fc_scatter_puppet(void (*kernel)(lv_32fc_t*,
+                                                           const lv_32fc_t*,
+                                                           const uint32_t*,
+                                                           unsigned int),
+                                            lv_32fc_t* outputVector,
+                                            const lv_32fc_t* inputVector,
+                                            unsigned int num_points)
+{
+    uint32_t indices[256];
+    unsigned int number, count;
+
+    for (number = 0; number < num_points; number += count) {
+        count = num_points - number < 256 ? num_points - number : 256;
+        volk_subcarrier_indices(indices, number, count, num_points);
+        kernel(outputVector, inputVector + number, indices, count);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_scatterpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                        const lv_32fc_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_32fc_scatter_puppet(
+        volk_32fc_32u_scatter_32fc_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_scatterpuppet_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                       const lv_32fc_t* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_32fc_scatter_puppet(
+        volk_32fc_32u_scatter_32fc_u_avx2, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_scatterpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_32fc_scatter_puppet(
+        volk_32fc_32u_scatter_32fc_u_avx512f, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_scatterpuppet_32fc_H */
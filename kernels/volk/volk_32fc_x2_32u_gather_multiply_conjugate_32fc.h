@@ -0,0 +1,201 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32fc_x2_32u_gather_multiply_conjugate_32fc
+ *
+ * \b Overview
+ *
+ * Gathers the points of the input and of the channel at the given indices
+ * and multiplies each input point by the conjugate of its channel point, e.g.
+ * to extract and equalise the data subcarriers of an OFDM symbol with a
+ * channel estimate over all its subcarriers in one pass:
+ *
+ * outputVector[n] = inputVector[indices[n]] * conj(channelVector[indices[n]])
+ *
+ * Dividing the result by the squared magnitude of the channel completes a
+ * zero forcing equaliser; for soft decisions it is often left as it is.
+ *
+ * The SIMD versions load runs of four or eight consecutive indices directly,
+ * as the subcarriers of a resource block usually are, and gather the others.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_32u_gather_multiply_conjugate_32fc(lv_32fc_t* outputVector,
+ * const lv_32fc_t* inputVector, const lv_32fc_t* channelVector, const uint32_t*
+ * indices, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The points to gather from.
+ * \li channelVector: The channel estimate at each input point.
+ * \li indices: The index of the input point of each output, below 2^31.
+ * \li num_points: The number of indices and outputs.
+ *
+ * \b Outputs
+ * \li outputVector: The gathered points multiplied by the conjugate channel.
+ *
+ * \b Example
+ * Extract the subcarriers of a 64 point symbol that are neither pilots nor
+ * guards, undoing a phase rotation of the channel.
+ * \code
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* symbol = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*64, alignment);
+ *   lv_32fc_t* channel = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*64, alignment);
+ *   lv_32fc_t* data = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*48, alignment);
+ *   uint32_t indices[48];
+ *   unsigned int n = 0;
+ *
+ *   for(unsigned int ii = 0; ii < 64; ++ii){
+ *       channel[ii] = lv_cmake(cosf(0.1f * ii), sinf(0.1f * ii));
+ *       symbol[ii] = channel[ii];
+ *       if(ii >= 6 && ii < 59 && ii != 32 && ii % 14 != 11){
+ *           indices[n++] = ii;
+ *       }
+ *   }
+ *
+ *   volk_32fc_x2_32u_gather_multiply_conjugate_32fc(data, symbol, channel, indices, n);
+ *
+ *   volk_free(symbol);
+ *   volk_free(channel);
+ *   volk_free(data);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_32u_gather_multiply_conjugate_32fc_H
+#define INCLUDED_volk_32fc_x2_32u_gather_multiply_conjugate_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_32u_gather_multiply_conjugate_32fc_generic(lv_32fc_t* outputVector,
+                                                        const lv_32fc_t* inputVector,
+                                                        const lv_32fc_t* channelVector,
+                                                        const uint32_t* indices,
+                                                        unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] =
+            inputVector[indices[number]] * lv_conj(channelVector[indices[number]]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void
+volk_32fc_x2_32u_gather_multiply_conjugate_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                       const lv_32fc_t* inputVector,
+                                                       const lv_32fc_t* channelVector,
+                                                       const uint32_t* indices,
+                                                       unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128i ramp = _mm_set_epi32(3, 2, 1, 0);
+    // a complex point moves as a double
+    const double* in = (const double*)inputVector;
+    const double* channel = (const double*)channelVector;
+    unsigned int number;
+    __m128i index, run;
+    __m256d x, y;
+
+    for (number = 0; number < quarterPoints; number++) {
+        index = _mm_loadu_si128((const __m128i*)indices);
+        run = _mm_add_epi32(_mm_set1_epi32((int)indices[0]), ramp);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(index, run)) == 0xffff) {
+            x = _mm256_loadu_pd(in + indices[0]);
+            y = _mm256_loadu_pd(channel + indices[0]);
+        } else {
+            x = _mm256_i32gather_pd(in, index, 8);
+            y = _mm256_i32gather_pd(channel, index, 8);
+        }
+        _mm256_storeu_ps((float*)outputVector,
+                         _mm256_complexconjugatemul_ps(_mm256_castpd_ps(x),
+                                                       _mm256_castpd_ps(y)));
+        indices += 4;
+        outputVector += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *outputVector++ = inputVector[*indices] * lv_conj(channelVector[*indices]);
+        indices++;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_x2_32u_gather_multiply_conjugate_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const lv_32fc_t* channelVector,
+                                                          const uint32_t* indices,
+                                                          unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i ramp = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    // a complex point moves as a double
+    const double* in = (const double*)inputVector;
+    const double* channel = (const double*)channelVector;
+    unsigned int number;
+    __m256i index, run;
+    __m512d x, y;
+
+    for (number = 0; number < eighthPoints; number++) {
+        index = _mm256_loadu_si256((const __m256i*)indices);
+        run = _mm256_add_epi32(_mm256_set1_epi32((int)indices[0]), ramp);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(index, run)) == -1) {
+            x = _mm512_loadu_pd(in + indices[0]);
+            y = _mm512_loadu_pd(channel + indices[0]);
+        } else {
+            x = _mm512_i32gather_pd(index, in, 8);
+            y = _mm512_i32gather_pd(index, channel, 8);
+        }
+        _mm512_storeu_ps((float*)outputVector,
+                         _mm512_complexconjugatemul_ps(_mm512_castpd_ps(x),
+                                                       _mm512_castpd_ps(y)));
+        indices += 8;
+        outputVector += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputVector++ = inputVector[*indices] * lv_conj(channelVector[*indices]);
+        indices++;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_x2_32u_gather_multiply_conjugate_32fc_H */
@@ -163,6 +163,140 @@ static inline void volk_32fc_x2_conjugate_dot_prod_32fc_u_avx(lv_32fc_t* result,
 
 #endif /* LV_HAVE_AVX */
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+#include <immintrin.h>
+
+static inline void
+volk_32fc_x2_conjugate_dot_prod_32fc_u_avx2_fma(lv_32fc_t* result,
+                                                const lv_32fc_t* input,
+                                                const lv_32fc_t* taps,
+                                                unsigned int num_points)
+{
+    /* The conjugation is deferred to the end: the products with the real and the
+     * imaginary parts of the taps are accumulated separately,
+     * sum_b_real: | ai⋅br | ar⋅br | and sum_b_imag: | ai⋅bi | ar⋅bi |,
+     * so that each iteration is a plain FMA into two chains per sum.
+     */
+    __m256 sum_b_real0 = _mm256_setzero_ps();
+    __m256 sum_b_real1 = _mm256_setzero_ps();
+    __m256 sum_b_imag0 = _mm256_setzero_ps();
+    __m256 sum_b_imag1 = _mm256_setzero_ps();
+    __m256 a0, a1, b0, b1;
+
+    const float* aPtr = (const float*)input;
+    const float* bPtr = (const float*)taps;
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        a0 = _mm256_loadu_ps(aPtr);
+        a1 = _mm256_loadu_ps(aPtr + 8);
+        b0 = _mm256_loadu_ps(bPtr);
+        b1 = _mm256_loadu_ps(bPtr + 8);
+
+        sum_b_real0 = _mm256_fmadd_ps(a0, _mm256_moveldup_ps(b0), sum_b_real0);
+        sum_b_imag0 = _mm256_fmadd_ps(a0, _mm256_movehdup_ps(b0), sum_b_imag0);
+        sum_b_real1 = _mm256_fmadd_ps(a1, _mm256_moveldup_ps(b1), sum_b_real1);
+        sum_b_imag1 = _mm256_fmadd_ps(a1, _mm256_movehdup_ps(b1), sum_b_imag1);
+
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    if (num_points & 4) {
+        a0 = _mm256_loadu_ps(aPtr);
+        b0 = _mm256_loadu_ps(bPtr);
+        sum_b_real0 = _mm256_fmadd_ps(a0, _mm256_moveldup_ps(b0), sum_b_real0);
+        sum_b_imag0 = _mm256_fmadd_ps(a0, _mm256_movehdup_ps(b0), sum_b_imag0);
+    }
+
+    __m256 sum_b_real = _mm256_add_ps(sum_b_real0, sum_b_real1);
+    __m256 sum_b_imag = _mm256_add_ps(sum_b_imag0, sum_b_imag1);
+
+    // | ar⋅bi | ai⋅bi | with the sign of the odd (imaginary) lanes flipped …
+    sum_b_imag = _mm256_permute_ps(sum_b_imag, _MM_SHUFFLE(2, 3, 0, 1));
+    sum_b_imag = _mm256_xor_ps(
+        sum_b_imag, _mm256_setr_ps(0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f));
+    // … gives | ai⋅br − ar⋅bi | ar⋅br + ai⋅bi | per partial sum.
+    __m256 sum = _mm256_add_ps(sum_b_real, sum_b_imag);
+    sum = _mm256_add_ps(sum, _mm256_permute2f128_ps(sum, sum, 0x01));
+    sum = _mm256_add_ps(sum, _mm256_permute_ps(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    __m128 lower = _mm256_extractf128_ps(sum, 0);
+    _mm_storel_pi((__m64*)result, lower);
+
+    for (unsigned int i = num_points & ~3u; i < num_points; ++i) {
+        *result += lv_cmake(lv_creal(input[i]) * lv_creal(taps[i]) +
+                                lv_cimag(input[i]) * lv_cimag(taps[i]),
+                            lv_cimag(input[i]) * lv_creal(taps[i]) -
+                                lv_creal(input[i]) * lv_cimag(taps[i]));
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_conjugate_dot_prod_32fc_u_avx512f(lv_32fc_t* result,
+                                                                  const lv_32fc_t* input,
+                                                                  const lv_32fc_t* taps,
+                                                                  unsigned int num_points)
+{
+    // Same scheme as the avx2_fma protokernel, eight points per vector.
+    __m512 sum_b_real0 = _mm512_setzero_ps();
+    __m512 sum_b_real1 = _mm512_setzero_ps();
+    __m512 sum_b_imag0 = _mm512_setzero_ps();
+    __m512 sum_b_imag1 = _mm512_setzero_ps();
+    __m512 a0, a1, b0, b1;
+
+    const float* aPtr = (const float*)input;
+    const float* bPtr = (const float*)taps;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        a0 = _mm512_loadu_ps(aPtr);
+        a1 = _mm512_loadu_ps(aPtr + 16);
+        b0 = _mm512_loadu_ps(bPtr);
+        b1 = _mm512_loadu_ps(bPtr + 16);
+
+        sum_b_real0 = _mm512_fmadd_ps(a0, _mm512_moveldup_ps(b0), sum_b_real0);
+        sum_b_imag0 = _mm512_fmadd_ps(a0, _mm512_movehdup_ps(b0), sum_b_imag0);
+        sum_b_real1 = _mm512_fmadd_ps(a1, _mm512_moveldup_ps(b1), sum_b_real1);
+        sum_b_imag1 = _mm512_fmadd_ps(a1, _mm512_movehdup_ps(b1), sum_b_imag1);
+
+        aPtr += 32;
+        bPtr += 32;
+    }
+
+    if (num_points & 8) {
+        a0 = _mm512_loadu_ps(aPtr);
+        b0 = _mm512_loadu_ps(bPtr);
+        sum_b_real0 = _mm512_fmadd_ps(a0, _mm512_moveldup_ps(b0), sum_b_real0);
+        sum_b_imag0 = _mm512_fmadd_ps(a0, _mm512_movehdup_ps(b0), sum_b_imag0);
+    }
+
+    const __m512 sum_b_real = _mm512_add_ps(sum_b_real0, sum_b_real1);
+    const __m512 sum_b_imag = _mm512_add_ps(sum_b_imag0, sum_b_imag1);
+
+    // ar⋅br + ai⋅bi from the even and odd lanes, ai⋅br − ar⋅bi likewise
+    float res[2];
+    res[0] = _mm512_mask_reduce_add_ps(0x5555, sum_b_real) +
+             _mm512_mask_reduce_add_ps(0xAAAA, sum_b_imag);
+    res[1] = _mm512_mask_reduce_add_ps(0xAAAA, sum_b_real) -
+             _mm512_mask_reduce_add_ps(0x5555, sum_b_imag);
+    *result = lv_cmake(res[0], res[1]);
+
+    for (unsigned int i = num_points & ~7u; i < num_points; ++i) {
+        *result += lv_cmake(lv_creal(input[i]) * lv_creal(taps[i]) +
+                                lv_cimag(input[i]) * lv_cimag(taps[i]),
+                            lv_cimag(input[i]) * lv_creal(taps[i]) -
+                                lv_creal(input[i]) * lv_cimag(taps[i]));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #ifdef LV_HAVE_SSE3
 
 #include <pmmintrin.h>
@@ -275,6 +409,73 @@ static inline void volk_32fc_x2_conjugate_dot_prod_32fc_neon(lv_32fc_t* result,
 }
 #endif /*LV_HAVE_NEON*/
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+/* Software pipelined as the ARMv7 neonpipeline is: the FMAs of a block of 16
+ * points use the operands loaded during the block before, and four pairs of
+ * sums keep the FMA pipes busy. */
+static inline void
+volk_32fc_x2_conjugate_dot_prod_32fc_neonv8(lv_32fc_t* result,
+                                            const lv_32fc_t* input,
+                                            const lv_32fc_t* taps,
+                                            unsigned int num_points)
+{
+    unsigned int number, k;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (const float*)input;
+    const float* bPtr = (const float*)taps;
+
+    float32x4x2_t a[4], b[4];
+    float32x4_t real[4], imag[4];
+    for (k = 0; k < 4; k++) {
+        real[k] = vdupq_n_f32(0.0f);
+        imag[k] = vdupq_n_f32(0.0f);
+    }
+
+    if (sixteenthPoints) {
+        for (k = 0; k < 4; k++) {
+            a[k] = vld2q_f32(aPtr + 8 * k);
+            b[k] = vld2q_f32(bPtr + 8 * k);
+        }
+        for (number = 1; number < sixteenthPoints; number++) {
+            aPtr += 32;
+            bPtr += 32;
+            for (k = 0; k < 4; k++) {
+                real[k] = vfmaq_f32(real[k], a[k].val[0], b[k].val[0]);
+                imag[k] = vfmsq_f32(imag[k], a[k].val[0], b[k].val[1]);
+                real[k] = vfmaq_f32(real[k], a[k].val[1], b[k].val[1]);
+                imag[k] = vfmaq_f32(imag[k], a[k].val[1], b[k].val[0]);
+                a[k] = vld2q_f32(aPtr + 8 * k);
+                b[k] = vld2q_f32(bPtr + 8 * k);
+            }
+        }
+        for (k = 0; k < 4; k++) {
+            real[k] = vfmaq_f32(real[k], a[k].val[0], b[k].val[0]);
+            imag[k] = vfmsq_f32(imag[k], a[k].val[0], b[k].val[1]);
+            real[k] = vfmaq_f32(real[k], a[k].val[1], b[k].val[1]);
+            imag[k] = vfmaq_f32(imag[k], a[k].val[1], b[k].val[0]);
+        }
+        aPtr += 32;
+        bPtr += 32;
+    }
+
+    real[0] = vaddq_f32(vaddq_f32(real[0], real[1]), vaddq_f32(real[2], real[3]));
+    imag[0] = vaddq_f32(vaddq_f32(imag[0], imag[1]), vaddq_f32(imag[2], imag[3]));
+    lv_32fc_t dotProduct = lv_cmake(vaddvq_f32(real[0]), vaddvq_f32(imag[0]));
+
+    const lv_32fc_t* aTail = (const lv_32fc_t*)aPtr;
+    const lv_32fc_t* bTail = (const lv_32fc_t*)bPtr;
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        dotProduct += (*aTail++) * lv_conj(*bTail++);
+    }
+
+    *result = dotProduct;
+}
+
+#endif /*LV_HAVE_NEONV8*/
+
 #endif /*INCLUDED_volk_32fc_x2_conjugate_dot_prod_32fc_u_H*/
 
 #ifndef INCLUDED_volk_32fc_x2_conjugate_dot_prod_32fc_a_H
@@ -344,6 +545,140 @@ static inline void volk_32fc_x2_conjugate_dot_prod_32fc_a_avx(lv_32fc_t* result,
 }
 #endif /* LV_HAVE_AVX */
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+#include <immintrin.h>
+
+static inline void
+volk_32fc_x2_conjugate_dot_prod_32fc_a_avx2_fma(lv_32fc_t* result,
+                                                const lv_32fc_t* input,
+                                                const lv_32fc_t* taps,
+                                                unsigned int num_points)
+{
+    /* The conjugation is deferred to the end: the products with the real and the
+     * imaginary parts of the taps are accumulated separately,
+     * sum_b_real: | ai⋅br | ar⋅br | and sum_b_imag: | ai⋅bi | ar⋅bi |,
+     * so that each iteration is a plain FMA into two chains per sum.
+     */
+    __m256 sum_b_real0 = _mm256_setzero_ps();
+    __m256 sum_b_real1 = _mm256_setzero_ps();
+    __m256 sum_b_imag0 = _mm256_setzero_ps();
+    __m256 sum_b_imag1 = _mm256_setzero_ps();
+    __m256 a0, a1, b0, b1;
+
+    const float* aPtr = (const float*)input;
+    const float* bPtr = (const float*)taps;
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        a0 = _mm256_load_ps(aPtr);
+        a1 = _mm256_load_ps(aPtr + 8);
+        b0 = _mm256_load_ps(bPtr);
+        b1 = _mm256_load_ps(bPtr + 8);
+
+        sum_b_real0 = _mm256_fmadd_ps(a0, _mm256_moveldup_ps(b0), sum_b_real0);
+        sum_b_imag0 = _mm256_fmadd_ps(a0, _mm256_movehdup_ps(b0), sum_b_imag0);
+        sum_b_real1 = _mm256_fmadd_ps(a1, _mm256_moveldup_ps(b1), sum_b_real1);
+        sum_b_imag1 = _mm256_fmadd_ps(a1, _mm256_movehdup_ps(b1), sum_b_imag1);
+
+        aPtr += 16;
+        bPtr += 16;
+    }
+
+    if (num_points & 4) {
+        a0 = _mm256_load_ps(aPtr);
+        b0 = _mm256_load_ps(bPtr);
+        sum_b_real0 = _mm256_fmadd_ps(a0, _mm256_moveldup_ps(b0), sum_b_real0);
+        sum_b_imag0 = _mm256_fmadd_ps(a0, _mm256_movehdup_ps(b0), sum_b_imag0);
+    }
+
+    __m256 sum_b_real = _mm256_add_ps(sum_b_real0, sum_b_real1);
+    __m256 sum_b_imag = _mm256_add_ps(sum_b_imag0, sum_b_imag1);
+
+    // | ar⋅bi | ai⋅bi | with the sign of the odd (imaginary) lanes flipped …
+    sum_b_imag = _mm256_permute_ps(sum_b_imag, _MM_SHUFFLE(2, 3, 0, 1));
+    sum_b_imag = _mm256_xor_ps(
+        sum_b_imag, _mm256_setr_ps(0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f));
+    // … gives | ai⋅br − ar⋅bi | ar⋅br + ai⋅bi | per partial sum.
+    __m256 sum = _mm256_add_ps(sum_b_real, sum_b_imag);
+    sum = _mm256_add_ps(sum, _mm256_permute2f128_ps(sum, sum, 0x01));
+    sum = _mm256_add_ps(sum, _mm256_permute_ps(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    __m128 lower = _mm256_extractf128_ps(sum, 0);
+    _mm_storel_pi((__m64*)result, lower);
+
+    for (unsigned int i = num_points & ~3u; i < num_points; ++i) {
+        *result += lv_cmake(lv_creal(input[i]) * lv_creal(taps[i]) +
+                                lv_cimag(input[i]) * lv_cimag(taps[i]),
+                            lv_cimag(input[i]) * lv_creal(taps[i]) -
+                                lv_creal(input[i]) * lv_cimag(taps[i]));
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_conjugate_dot_prod_32fc_a_avx512f(lv_32fc_t* result,
+                                                                  const lv_32fc_t* input,
+                                                                  const lv_32fc_t* taps,
+                                                                  unsigned int num_points)
+{
+    // Same scheme as the avx2_fma protokernel, eight points per vector.
+    __m512 sum_b_real0 = _mm512_setzero_ps();
+    __m512 sum_b_real1 = _mm512_setzero_ps();
+    __m512 sum_b_imag0 = _mm512_setzero_ps();
+    __m512 sum_b_imag1 = _mm512_setzero_ps();
+    __m512 a0, a1, b0, b1;
+
+    const float* aPtr = (const float*)input;
+    const float* bPtr = (const float*)taps;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        a0 = _mm512_load_ps(aPtr);
+        a1 = _mm512_load_ps(aPtr + 16);
+        b0 = _mm512_load_ps(bPtr);
+        b1 = _mm512_load_ps(bPtr + 16);
+
+        sum_b_real0 = _mm512_fmadd_ps(a0, _mm512_moveldup_ps(b0), sum_b_real0);
+        sum_b_imag0 = _mm512_fmadd_ps(a0, _mm512_movehdup_ps(b0), sum_b_imag0);
+        sum_b_real1 = _mm512_fmadd_ps(a1, _mm512_moveldup_ps(b1), sum_b_real1);
+        sum_b_imag1 = _mm512_fmadd_ps(a1, _mm512_movehdup_ps(b1), sum_b_imag1);
+
+        aPtr += 32;
+        bPtr += 32;
+    }
+
+    if (num_points & 8) {
+        a0 = _mm512_load_ps(aPtr);
+        b0 = _mm512_load_ps(bPtr);
+        sum_b_real0 = _mm512_fmadd_ps(a0, _mm512_moveldup_ps(b0), sum_b_real0);
+        sum_b_imag0 = _mm512_fmadd_ps(a0, _mm512_movehdup_ps(b0), sum_b_imag0);
+    }
+
+    const __m512 sum_b_real = _mm512_add_ps(sum_b_real0, sum_b_real1);
+    const __m512 sum_b_imag = _mm512_add_ps(sum_b_imag0, sum_b_imag1);
+
+    // ar⋅br + ai⋅bi from the even and odd lanes, ai⋅br − ar⋅bi likewise
+    float res[2];
+    res[0] = _mm512_mask_reduce_add_ps(0x5555, sum_b_real) +
+             _mm512_mask_reduce_add_ps(0xAAAA, sum_b_imag);
+    res[1] = _mm512_mask_reduce_add_ps(0xAAAA, sum_b_real) -
+             _mm512_mask_reduce_add_ps(0x5555, sum_b_imag);
+    *result = lv_cmake(res[0], res[1]);
+
+    for (unsigned int i = num_points & ~7u; i < num_points; ++i) {
+        *result += lv_cmake(lv_creal(input[i]) * lv_creal(taps[i]) +
+                                lv_cimag(input[i]) * lv_cimag(taps[i]),
+                            lv_cimag(input[i]) * lv_creal(taps[i]) -
+                                lv_creal(input[i]) * lv_cimag(taps[i]));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #ifdef LV_HAVE_SSE3
 
 #include <pmmintrin.h>
@@ -389,5 +389,56 @@ static inline void volk_32fc_x2_divide_32fc_neon(lv_32fc_t* cVector,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_divide_32fc_neonv8(lv_32fc_t* cVector,
+                                                   const lv_32fc_t* aVector,
+                                                   const lv_32fc_t* bVector,
+                                                   unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+
+    float32x4x2_t aVal0, bVal0, cVal0, aVal1, bVal1, cVal1;
+    float32x4_t bAbs0, bAbs1;
+
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+    for (; number < eighthPoints; number++) {
+        aVal0 = vld2q_f32((const float*)(aPtr));
+        bVal0 = vld2q_f32((const float*)(bPtr));
+        aVal1 = vld2q_f32((const float*)(aPtr + 4));
+        bVal1 = vld2q_f32((const float*)(bPtr + 4));
+        aPtr += 8;
+        bPtr += 8;
+        __VOLK_PREFETCH(aPtr + 8);
+        __VOLK_PREFETCH(bPtr + 8);
+
+        bAbs0 = vfmaq_f32(vmulq_f32(bVal0.val[0], bVal0.val[0]), bVal0.val[1], bVal0.val[1]);
+        bAbs1 = vfmaq_f32(vmulq_f32(bVal1.val[0], bVal1.val[0]), bVal1.val[1], bVal1.val[1]);
+
+        // a * conj(b) / |b|^2, with a true division instead of the estimate
+        cVal0.val[0] = vfmaq_f32(vmulq_f32(aVal0.val[0], bVal0.val[0]), aVal0.val[1], bVal0.val[1]);
+        cVal0.val[1] = vfmsq_f32(vmulq_f32(aVal0.val[1], bVal0.val[0]), aVal0.val[0], bVal0.val[1]);
+        cVal1.val[0] = vfmaq_f32(vmulq_f32(aVal1.val[0], bVal1.val[0]), aVal1.val[1], bVal1.val[1]);
+        cVal1.val[1] = vfmsq_f32(vmulq_f32(aVal1.val[1], bVal1.val[0]), aVal1.val[0], bVal1.val[1]);
+        cVal0.val[0] = vdivq_f32(cVal0.val[0], bAbs0);
+        cVal0.val[1] = vdivq_f32(cVal0.val[1], bAbs0);
+        cVal1.val[0] = vdivq_f32(cVal1.val[0], bAbs1);
+        cVal1.val[1] = vdivq_f32(cVal1.val[1], bAbs1);
+
+        vst2q_f32((float*)(cPtr), cVal0);
+        vst2q_f32((float*)(cPtr + 4), cVal1);
+        cPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
 
 #endif /* INCLUDED_volk_32fc_x2_divide_32fc_a_H */
@@ -0,0 +1,310 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_dividefast_32fc
+ *
+ * \b Overview
+ *
+ * Divides aVector by bVector as volk_32fc_x2_divide_32fc does, as a conj(b) /
+ * |b|^2, but multiplies by the reciprocal estimate of |b|^2, refined by one
+ * Newton-Raphson step, instead of dividing. The result is within a few ulp on
+ * x86 (rcpps and vrcp14ps) and within about 2e-5 on NEON (vrecpe).
+ *
+ * The divisors must be nonzero and of magnitude between 2^-63 and 2^63, so that
+ * |b|^2 is a normal float; others give NaN or infinities.
+ * volk_32fc_x2_divide_32fc runs this kernel when the volk_set_precision budget
+ * allows it.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_dividefast_32fc(lv_32fc_t* cVector, const lv_32fc_t* aVector,
+ *                                   const lv_32fc_t* bVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The dividends.
+ * \li bVector: The divisors.
+ * \li num_points: The number of complex values in both input vectors.
+ *
+ * \b Outputs
+ * \li cVector: The quotients.
+ *
+ * \b Example
+ * Equalise received symbols by a channel estimate.
+ * \code
+ *   volk_32fc_x2_dividefast_32fc(equalised, received, channel, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_dividefast_32fc_H
+#define INCLUDED_volk_32fc_x2_dividefast_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_dividefast_32fc_generic(lv_32fc_t* cVector,
+                                                        const lv_32fc_t* aVector,
+                                                        const lv_32fc_t* bVector,
+                                                        unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        cVector[number] = aVector[number] / bVector[number];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_dividefast_32fc_a_avx512f(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* aVector,
+                                                          const lv_32fc_t* bVector,
+                                                          unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const __m512 two = _mm512_set1_ps(2.0f);
+    __m512 aVal, bVal, cVal, sq, bAbs, bAbsInv;
+
+    for (number = 0; number < eighthPoints; number++) {
+        aVal = _mm512_load_ps((const float*)aPtr);
+        bVal = _mm512_load_ps((const float*)bPtr);
+
+        // |b|^2 in both halves of each complex value
+        sq = _mm512_mul_ps(bVal, bVal);
+        bAbs = _mm512_add_ps(sq, _mm512_permute_ps(sq, 0xb1));
+
+        bAbsInv = _mm512_rcp14_ps(bAbs);
+        bAbsInv = _mm512_mul_ps(bAbsInv, _mm512_fnmadd_ps(bAbs, bAbsInv, two));
+
+        cVal = _mm512_mul_ps(_mm512_complexconjugatemul_ps(aVal, bVal), bAbsInv);
+        _mm512_store_ps((float*)cPtr, cVal);
+
+        aPtr += 8;
+        bPtr += 8;
+        cPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_dividefast_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* aVector,
+                                                          const lv_32fc_t* bVector,
+                                                          unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const __m512 two = _mm512_set1_ps(2.0f);
+    __m512 aVal, bVal, cVal, sq, bAbs, bAbsInv;
+
+    for (number = 0; number < eighthPoints; number++) {
+        aVal = _mm512_loadu_ps((const float*)aPtr);
+        bVal = _mm512_loadu_ps((const float*)bPtr);
+
+        // |b|^2 in both halves of each complex value
+        sq = _mm512_mul_ps(bVal, bVal);
+        bAbs = _mm512_add_ps(sq, _mm512_permute_ps(sq, 0xb1));
+
+        bAbsInv = _mm512_rcp14_ps(bAbs);
+        bAbsInv = _mm512_mul_ps(bAbsInv, _mm512_fnmadd_ps(bAbs, bAbsInv, two));
+
+        cVal = _mm512_mul_ps(_mm512_complexconjugatemul_ps(aVal, bVal), bAbsInv);
+        _mm512_storeu_ps((float*)cPtr, cVal);
+
+        aPtr += 8;
+        bPtr += 8;
+        cPtr += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_dividefast_32fc_a_avx(lv_32fc_t* cVector,
+                                                      const lv_32fc_t* aVector,
+                                                      const lv_32fc_t* bVector,
+                                                      unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number;
+
+    const __m256 two = _mm256_set1_ps(2.0f);
+    __m256 aVal, bVal, cVal, sq, bAbs, bAbsInv;
+
+    for (number = 0; number < quarterPoints; number++) {
+        aVal = _mm256_load_ps((const float*)aPtr);
+        bVal = _mm256_load_ps((const float*)bPtr);
+
+        // |b|^2 in both halves of each complex value
+        sq = _mm256_mul_ps(bVal, bVal);
+        bAbs = _mm256_add_ps(sq, _mm256_permute_ps(sq, 0xb1));
+
+        bAbsInv = _mm256_rcp_ps(bAbs);
+        bAbsInv =
+            _mm256_mul_ps(bAbsInv, _mm256_sub_ps(two, _mm256_mul_ps(bAbs, bAbsInv)));
+
+        cVal = _mm256_mul_ps(_mm256_complexconjugatemul_ps(aVal, bVal), bAbsInv);
+        _mm256_store_ps((float*)cPtr, cVal);
+
+        aPtr += 4;
+        bPtr += 4;
+        cPtr += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_dividefast_32fc_u_avx(lv_32fc_t* cVector,
+                                                      const lv_32fc_t* aVector,
+                                                      const lv_32fc_t* bVector,
+                                                      unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number;
+
+    const __m256 two = _mm256_set1_ps(2.0f);
+    __m256 aVal, bVal, cVal, sq, bAbs, bAbsInv;
+
+    for (number = 0; number < quarterPoints; number++) {
+        aVal = _mm256_loadu_ps((const float*)aPtr);
+        bVal = _mm256_loadu_ps((const float*)bPtr);
+
+        // |b|^2 in both halves of each complex value
+        sq = _mm256_mul_ps(bVal, bVal);
+        bAbs = _mm256_add_ps(sq, _mm256_permute_ps(sq, 0xb1));
+
+        bAbsInv = _mm256_rcp_ps(bAbs);
+        bAbsInv =
+            _mm256_mul_ps(bAbsInv, _mm256_sub_ps(two, _mm256_mul_ps(bAbs, bAbsInv)));
+
+        cVal = _mm256_mul_ps(_mm256_complexconjugatemul_ps(aVal, bVal), bAbsInv);
+        _mm256_storeu_ps((float*)cPtr, cVal);
+
+        aPtr += 4;
+        bPtr += 4;
+        cPtr += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_dividefast_32fc_neon(lv_32fc_t* cVector,
+                                                     const lv_32fc_t* aVector,
+                                                     const lv_32fc_t* bVector,
+                                                     unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number;
+
+    float32x4x2_t aVal, bVal, cVal;
+    float32x4_t bAbs, bAbsInv;
+
+    for (number = 0; number < quarterPoints; number++) {
+        aVal = vld2q_f32((const float*)aPtr);
+        bVal = vld2q_f32((const float*)bPtr);
+
+        bAbs = vmulq_f32(bVal.val[0], bVal.val[0]);
+        bAbs = vmlaq_f32(bAbs, bVal.val[1], bVal.val[1]);
+
+        bAbsInv = vrecpeq_f32(bAbs);
+        bAbsInv = vmulq_f32(bAbsInv, vrecpsq_f32(bAbsInv, bAbs));
+
+        cVal.val[0] = vmulq_f32(aVal.val[0], bVal.val[0]);
+        cVal.val[0] = vmlaq_f32(cVal.val[0], aVal.val[1], bVal.val[1]);
+        cVal.val[0] = vmulq_f32(cVal.val[0], bAbsInv);
+
+        cVal.val[1] = vmulq_f32(aVal.val[1], bVal.val[0]);
+        cVal.val[1] = vmlsq_f32(cVal.val[1], aVal.val[0], bVal.val[1]);
+        cVal.val[1] = vmulq_f32(cVal.val[1], bAbsInv);
+
+        vst2q_f32((float*)cPtr, cVal);
+
+        aPtr += 4;
+        bPtr += 4;
+        cPtr += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *cPtr++ = (*aPtr++) / (*bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_dividefast_32fc_H */
@@ -103,6 +103,19 @@ static inline void volk_32fc_x2_dot_prod_32fc_generic(lv_32fc_t* result,
 
 #endif /*LV_HAVE_GENERIC*/
 
+#ifdef LV_HAVE_OPENCL
+#include <volk/volk_opencl.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_opencl(lv_32fc_t* result,
+                                                     const lv_32fc_t* input,
+                                                     const lv_32fc_t* taps,
+                                                     unsigned int num_points)
+{
+    if (!volk_opencl_32fc_x2_dot_prod_32fc(result, input, taps, num_points))
+        volk_32fc_x2_dot_prod_32fc_generic(result, input, taps, num_points);
+}
+#endif /* LV_HAVE_OPENCL */
+
 
 #if LV_HAVE_SSE && LV_HAVE_64
 
@@ -1038,6 +1051,72 @@ static inline void volk_32fc_x2_dot_prod_32fc_neon(lv_32fc_t* result,
 }
 #endif /*LV_HAVE_NEON*/
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+/* Software pipelined as the ARMv7 neonpipeline is: the FMAs of a block of 16
+ * points use the operands loaded during the block before, and four pairs of
+ * sums keep the FMA pipes busy. */
+static inline void volk_32fc_x2_dot_prod_32fc_neonv8(lv_32fc_t* result,
+                                                     const lv_32fc_t* input,
+                                                     const lv_32fc_t* taps,
+                                                     unsigned int num_points)
+{
+    unsigned int number, k;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (const float*)input;
+    const float* bPtr = (const float*)taps;
+
+    float32x4x2_t a[4], b[4];
+    float32x4_t real[4], imag[4];
+    for (k = 0; k < 4; k++) {
+        real[k] = vdupq_n_f32(0.0f);
+        imag[k] = vdupq_n_f32(0.0f);
+    }
+
+    if (sixteenthPoints) {
+        for (k = 0; k < 4; k++) {
+            a[k] = vld2q_f32(aPtr + 8 * k);
+            b[k] = vld2q_f32(bPtr + 8 * k);
+        }
+        for (number = 1; number < sixteenthPoints; number++) {
+            aPtr += 32;
+            bPtr += 32;
+            for (k = 0; k < 4; k++) {
+                real[k] = vfmaq_f32(real[k], a[k].val[0], b[k].val[0]);
+                imag[k] = vfmaq_f32(imag[k], a[k].val[0], b[k].val[1]);
+                real[k] = vfmsq_f32(real[k], a[k].val[1], b[k].val[1]);
+                imag[k] = vfmaq_f32(imag[k], a[k].val[1], b[k].val[0]);
+                a[k] = vld2q_f32(aPtr + 8 * k);
+                b[k] = vld2q_f32(bPtr + 8 * k);
+            }
+        }
+        for (k = 0; k < 4; k++) {
+            real[k] = vfmaq_f32(real[k], a[k].val[0], b[k].val[0]);
+            imag[k] = vfmaq_f32(imag[k], a[k].val[0], b[k].val[1]);
+            real[k] = vfmsq_f32(real[k], a[k].val[1], b[k].val[1]);
+            imag[k] = vfmaq_f32(imag[k], a[k].val[1], b[k].val[0]);
+        }
+        aPtr += 32;
+        bPtr += 32;
+    }
+
+    real[0] = vaddq_f32(vaddq_f32(real[0], real[1]), vaddq_f32(real[2], real[3]));
+    imag[0] = vaddq_f32(vaddq_f32(imag[0], imag[1]), vaddq_f32(imag[2], imag[3]));
+    lv_32fc_t dotProduct = lv_cmake(vaddvq_f32(real[0]), vaddvq_f32(imag[0]));
+
+    const lv_32fc_t* aTail = (const lv_32fc_t*)aPtr;
+    const lv_32fc_t* bTail = (const lv_32fc_t*)bPtr;
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        dotProduct += (*aTail++) * (*bTail++);
+    }
+
+    *result = dotProduct;
+}
+
+#endif /*LV_HAVE_NEONV8*/
+
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
 static inline void volk_32fc_x2_dot_prod_32fc_neon_opttests(lv_32fc_t* result,
@@ -1207,6 +1286,69 @@ static inline void volk_32fc_x2_dot_prod_32fc_neon_optfmaunroll(lv_32fc_t* resul
 }
 #endif /*LV_HAVE_NEON*/
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_sve(lv_32fc_t* result,
+                                                  const lv_32fc_t* input,
+                                                  const lv_32fc_t* taps,
+                                                  unsigned int num_points)
+{
+    const float* aPtr = (const float*)input;
+    const float* bPtr = (const float*)taps;
+    const unsigned int num_floats = 2 * num_points;
+    const svbool_t all = svptrue_b32();
+    svfloat32_t acc = svdup_n_f32(0.f);
+
+    for (unsigned int number = 0; number < num_floats; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32_u32(number, num_floats);
+        const svfloat32_t a = svld1_f32(pg, aPtr + number);
+        const svfloat32_t b = svld1_f32(pg, bPtr + number);
+        acc = svcmla_f32_m(pg, acc, a, b, 0);
+        acc = svcmla_f32_m(pg, acc, a, b, 90);
+    }
+
+    // the real parts sit in the even lanes, the imaginary ones in the odd lanes
+    const svbool_t even = svtrn1_b32(all, svpfalse_b());
+    const svbool_t odd = svtrn1_b32(svpfalse_b(), all);
+    *result = lv_cmake(svaddv_f32(even, acc), svaddv_f32(odd, acc));
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32fc_x2_dot_prod_32fc_rvv(lv_32fc_t* result,
+                                                  const lv_32fc_t* input,
+                                                  const lv_32fc_t* taps,
+                                                  unsigned int num_points)
+{
+    const size_t vlmax = __riscv_vsetvlmax_e32m4();
+    vfloat32m4_t acc_r = __riscv_vfmv_v_f_f32m4(0.f, vlmax);
+    vfloat32m4_t acc_i = __riscv_vfmv_v_f_f32m4(0.f, vlmax);
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, input += vl, taps += vl) {
+        vl = __riscv_vsetvl_e32m4(n);
+        const vfloat32m4x2_t va = __riscv_vlseg2e32_v_f32m4x2((const float*)input, vl);
+        const vfloat32m4x2_t vb = __riscv_vlseg2e32_v_f32m4x2((const float*)taps, vl);
+        const vfloat32m4_t ar = __riscv_vget_v_f32m4x2_f32m4(va, 0);
+        const vfloat32m4_t ai = __riscv_vget_v_f32m4x2_f32m4(va, 1);
+        const vfloat32m4_t br = __riscv_vget_v_f32m4x2_f32m4(vb, 0);
+        const vfloat32m4_t bi = __riscv_vget_v_f32m4x2_f32m4(vb, 1);
+        acc_r = __riscv_vfmacc_vv_f32m4_tu(acc_r, ar, br, vl);
+        acc_r = __riscv_vfnmsac_vv_f32m4_tu(acc_r, ai, bi, vl);
+        acc_i = __riscv_vfmacc_vv_f32m4_tu(acc_i, ar, bi, vl);
+        acc_i = __riscv_vfmacc_vv_f32m4_tu(acc_i, ai, br, vl);
+    }
+    const vfloat32m1_t zero = __riscv_vfmv_s_f_f32m1(0.f, 1);
+    const float re =
+        __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredusum_vs_f32m4_f32m1(acc_r, zero, vlmax));
+    const float im =
+        __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredusum_vs_f32m4_f32m1(acc_i, zero, vlmax));
+    *result = lv_cmake(re, im);
+}
+#endif /* LV_HAVE_RVV */
+
 
 #ifdef LV_HAVE_AVX
 
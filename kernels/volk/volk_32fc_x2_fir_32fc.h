@@ -0,0 +1,295 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_fir_32fc
+ *
+ * \b Overview
+ *
+ * Filters a block of complex samples with complex taps, computing
+ * num_points outputs in one call instead of one
+ * volk_32fc_x2_dot_prod_32fc call per output. Output i is the dot
+ * product of the taps with the num_taps inputs starting at i, so the
+ * input holds num_points + num_taps - 1 samples: the num_taps - 1
+ * samples of history, then the new ones. The taps are in time reversed
+ * order, as for the dot product.
+ *
+ * The SIMD implementations compute several vectors of consecutive
+ * outputs at once, loading each tap once for all of them. They sum the
+ * samples times the real and times the imaginary part of the taps
+ * separately and combine the two sums into complex products only once
+ * per output.
+ *
+ * For a filter running over a stream, volk_fir_32fc_init_complex() in
+ * volk_fir.h keeps the history between blocks in a caller-owned state.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_fir_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ * const lv_32fc_t* taps, unsigned int num_taps, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: num_points + num_taps - 1 samples, the oldest first.
+ * \li taps: The filter taps, time reversed.
+ * \li num_taps: The number of taps, at least 1.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: output[i] = sum of input[i + k] * taps[k] over k < num_taps.
+ *
+ * \b Example
+ * Select the band around a quarter of the sample rate with a 32 tap
+ * band pass filter.
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*(N + 31), alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* taps = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*32, alignment);
+ *
+ *   volk_32fc_x2_fir_32fc(out, in, taps, 32, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ *   volk_free(taps);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_fir_32fc_u_H
+#define INCLUDED_volk_32fc_x2_fir_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_fir_32fc_generic(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 const lv_32fc_t* taps,
+                                                 unsigned int num_taps,
+                                                 unsigned int num_points)
+{
+    unsigned int number, k;
+    for (number = 0; number < num_points; number++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_32fc_x2_fir_32fc_sse3(lv_32fc_t* output,
+                                              const lv_32fc_t* input,
+                                              const lv_32fc_t* taps,
+                                              unsigned int num_taps,
+                                              unsigned int num_points)
+{
+    const float* tap = (const float*)taps;
+    float* out = (float*)output;
+    unsigned int number = 0, k;
+
+    // two vectors of outputs share every tap load
+    for (; number + 4 <= num_points; number += 4) {
+        const float* in = (const float*)(input + number);
+        __m128 re0 = _mm_setzero_ps(), im0 = _mm_setzero_ps();
+        __m128 re1 = _mm_setzero_ps(), im1 = _mm_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            const __m128 tap_re = _mm_set1_ps(tap[2 * k]);
+            const __m128 tap_im = _mm_set1_ps(tap[2 * k + 1]);
+            const __m128 x0 = _mm_loadu_ps(in + 2 * k);
+            const __m128 x1 = _mm_loadu_ps(in + 2 * k + 4);
+            re0 = _mm_add_ps(re0, _mm_mul_ps(x0, tap_re));
+            im0 = _mm_add_ps(im0, _mm_mul_ps(x0, tap_im));
+            re1 = _mm_add_ps(re1, _mm_mul_ps(x1, tap_re));
+            im1 = _mm_add_ps(im1, _mm_mul_ps(x1, tap_im));
+        }
+        // xr*tr - xi*ti, xi*tr + xr*ti
+        _mm_storeu_ps(out + 2 * number,
+                      _mm_addsub_ps(re0, _mm_shuffle_ps(im0, im0, 0xB1)));
+        _mm_storeu_ps(out + 2 * number + 4,
+                      _mm_addsub_ps(re1, _mm_shuffle_ps(im1, im1, 0xB1)));
+    }
+
+    for (; number < num_points; number++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_fir_32fc_avx(lv_32fc_t* output,
+                                             const lv_32fc_t* input,
+                                             const lv_32fc_t* taps,
+                                             unsigned int num_taps,
+                                             unsigned int num_points)
+{
+    const float* tap = (const float*)taps;
+    float* out = (float*)output;
+    unsigned int number = 0, k;
+
+    // two vectors of outputs share every tap load
+    for (; number + 8 <= num_points; number += 8) {
+        const float* in = (const float*)(input + number);
+        __m256 re0 = _mm256_setzero_ps(), im0 = _mm256_setzero_ps();
+        __m256 re1 = _mm256_setzero_ps(), im1 = _mm256_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            const __m256 tap_re = _mm256_broadcast_ss(tap + 2 * k);
+            const __m256 tap_im = _mm256_broadcast_ss(tap + 2 * k + 1);
+            const __m256 x0 = _mm256_loadu_ps(in + 2 * k);
+            const __m256 x1 = _mm256_loadu_ps(in + 2 * k + 8);
+            re0 = _mm256_add_ps(re0, _mm256_mul_ps(x0, tap_re));
+            im0 = _mm256_add_ps(im0, _mm256_mul_ps(x0, tap_im));
+            re1 = _mm256_add_ps(re1, _mm256_mul_ps(x1, tap_re));
+            im1 = _mm256_add_ps(im1, _mm256_mul_ps(x1, tap_im));
+        }
+        // xr*tr - xi*ti, xi*tr + xr*ti
+        _mm256_storeu_ps(out + 2 * number,
+                         _mm256_addsub_ps(re0, _mm256_permute_ps(im0, 0xB1)));
+        _mm256_storeu_ps(out + 2 * number + 8,
+                         _mm256_addsub_ps(re1, _mm256_permute_ps(im1, 0xB1)));
+    }
+
+    for (; number < num_points; number++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_fir_32fc_avx512f(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 const lv_32fc_t* taps,
+                                                 unsigned int num_taps,
+                                                 unsigned int num_points)
+{
+    const float* tap = (const float*)taps;
+    float* out = (float*)output;
+    const __m512 one = _mm512_set1_ps(1.f);
+    unsigned int number = 0, k;
+
+    // two vectors of outputs share every tap load
+    for (; number + 16 <= num_points; number += 16) {
+        const float* in = (const float*)(input + number);
+        __m512 re0 = _mm512_setzero_ps(), im0 = _mm512_setzero_ps();
+        __m512 re1 = _mm512_setzero_ps(), im1 = _mm512_setzero_ps();
+        for (k = 0; k < num_taps; k++) {
+            const __m512 tap_re = _mm512_set1_ps(tap[2 * k]);
+            const __m512 tap_im = _mm512_set1_ps(tap[2 * k + 1]);
+            const __m512 x0 = _mm512_loadu_ps(in + 2 * k);
+            const __m512 x1 = _mm512_loadu_ps(in + 2 * k + 16);
+            re0 = _mm512_fmadd_ps(x0, tap_re, re0);
+            im0 = _mm512_fmadd_ps(x0, tap_im, im0);
+            re1 = _mm512_fmadd_ps(x1, tap_re, re1);
+            im1 = _mm512_fmadd_ps(x1, tap_im, im1);
+        }
+        // xr*tr - xi*ti, xi*tr + xr*ti
+        _mm512_storeu_ps(out + 2 * number,
+                         _mm512_fmaddsub_ps(re0, one, _mm512_permute_ps(im0, 0xB1)));
+        _mm512_storeu_ps(out + 2 * number + 16,
+                         _mm512_fmaddsub_ps(re1, one, _mm512_permute_ps(im1, 0xB1)));
+    }
+
+    for (; number < num_points; number++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_fir_32fc_neon(lv_32fc_t* output,
+                                              const lv_32fc_t* input,
+                                              const lv_32fc_t* taps,
+                                              unsigned int num_taps,
+                                              unsigned int num_points)
+{
+    const float* tap = (const float*)taps;
+    float* out = (float*)output;
+    unsigned int number = 0, k;
+
+    // two vectors of outputs share every tap load; val[0] holds the
+    // real and val[1] the imaginary parts
+    for (; number + 8 <= num_points; number += 8) {
+        const float* in = (const float*)(input + number);
+        float32x4x2_t acc0, acc1;
+        acc0.val[0] = acc0.val[1] = vdupq_n_f32(0.f);
+        acc1.val[0] = acc1.val[1] = vdupq_n_f32(0.f);
+        for (k = 0; k < num_taps; k++) {
+            const float32x4_t tap_re = vdupq_n_f32(tap[2 * k]);
+            const float32x4_t tap_im = vdupq_n_f32(tap[2 * k + 1]);
+            const float32x4x2_t x0 = vld2q_f32(in + 2 * k);
+            const float32x4x2_t x1 = vld2q_f32(in + 2 * k + 8);
+            acc0.val[0] = vmlaq_f32(acc0.val[0], x0.val[0], tap_re);
+            acc0.val[0] = vmlsq_f32(acc0.val[0], x0.val[1], tap_im);
+            acc0.val[1] = vmlaq_f32(acc0.val[1], x0.val[0], tap_im);
+            acc0.val[1] = vmlaq_f32(acc0.val[1], x0.val[1], tap_re);
+            acc1.val[0] = vmlaq_f32(acc1.val[0], x1.val[0], tap_re);
+            acc1.val[0] = vmlsq_f32(acc1.val[0], x1.val[1], tap_im);
+            acc1.val[1] = vmlaq_f32(acc1.val[1], x1.val[0], tap_im);
+            acc1.val[1] = vmlaq_f32(acc1.val[1], x1.val[1], tap_re);
+        }
+        vst2q_f32(out + 2 * number, acc0);
+        vst2q_f32(out + 2 * number + 8, acc1);
+    }
+
+    for (; number < num_points; number++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += input[number + k] * taps[k];
+        }
+        output[number] = sum;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_fir_32fc_u_H */
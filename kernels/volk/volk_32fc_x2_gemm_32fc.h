@@ -0,0 +1,404 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_gemm_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies two complex matrices, each stored row by row:
+ *
+ * cMatrix[r * num_points + n] = sum over k of aMatrix[r * inner + k] *
+ *                                             bMatrix[k * num_points + n]
+ *
+ * It is meant for a small aMatrix applied to many columns, such as
+ * num_rows beams formed from inner array elements over num_points
+ * snapshots, with the snapshots of each element in one row of bMatrix.
+ *
+ * The SIMD versions work on tiles of four rows of cMatrix by one or two
+ * registers of columns, which stay in registers over the whole sum. Each
+ * step of the sum loads a row of the tile from bMatrix once for all four
+ * rows, and broadcasts each value of aMatrix once for all columns of the
+ * tile; the real and imaginary parts of aMatrix go to separate
+ * accumulators, which are combined once at the end.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_gemm_32fc(lv_32fc_t* cMatrix, const lv_32fc_t* aMatrix,
+ * const lv_32fc_t* bMatrix, unsigned int num_rows, unsigned int inner,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li aMatrix: num_rows rows of inner values each.
+ * \li bMatrix: inner rows of num_points values each.
+ * \li num_rows: The number of rows of aMatrix and cMatrix.
+ * \li inner: The number of columns of aMatrix and rows of bMatrix.
+ * \li num_points: The number of columns of bMatrix and cMatrix.
+ *
+ * \b Outputs
+ * \li cMatrix: num_rows rows of num_points values each.
+ *
+ * \b Example
+ * Form 16 beams from 1024 snapshots of a 32 element array.
+ * \code
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* weights =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * 16 * 32, alignment);
+ *   lv_32fc_t* snapshots =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * 32 * 1024, alignment);
+ *   lv_32fc_t* beams =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * 16 * 1024, alignment);
+ *
+ *   // fill in the conjugated steering vectors, one beam per row, and the
+ *   // snapshots, one element per row
+ *   volk_32fc_x2_gemm_32fc(beams, weights, snapshots, 16, 32, 1024);
+ *
+ *   volk_free(weights);
+ *   volk_free(snapshots);
+ *   volk_free(beams);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_gemm_32fc_H
+#define INCLUDED_volk_32fc_x2_gemm_32fc_H
+
+#include <volk/volk_complex.h>
+
+/* Computes the columns of cMatrix from firstColumn on */
+static inline void volk_gemm_columns(lv_32fc_t* cMatrix,
+                                     const lv_32fc_t* aMatrix,
+                                     const lv_32fc_t* bMatrix,
+                                     unsigned int num_rows,
+                                     unsigned int inner,
+                                     unsigned int num_points,
+                                     unsigned int firstColumn)
+{
+    unsigned int row, column, k;
+
+    for (row = 0; row < num_rows; row++) {
+        const float* a = (const float*)(aMatrix + (size_t)row * inner);
+        for (column = firstColumn; column < num_points; column++) {
+            const float* b = (const float*)(bMatrix + column);
+            float sumReal = 0.f, sumImag = 0.f;
+            for (k = 0; k < inner; k++) {
+                sumReal += a[2 * k] * b[0] - a[2 * k + 1] * b[1];
+                sumImag += a[2 * k] * b[1] + a[2 * k + 1] * b[0];
+                b += 2 * (size_t)num_points;
+            }
+            cMatrix[(size_t)row * num_points + column] = lv_cmake(sumReal, sumImag);
+        }
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_gemm_32fc_generic(lv_32fc_t* cMatrix,
+                                                  const lv_32fc_t* aMatrix,
+                                                  const lv_32fc_t* bMatrix,
+                                                  unsigned int num_rows,
+                                                  unsigned int inner,
+                                                  unsigned int num_points)
+{
+    volk_gemm_columns(cMatrix, aMatrix, bMatrix, num_rows, inner, num_points, 0);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_gemm_32fc_u_avx2_fma(lv_32fc_t* cMatrix,
+                                                     const lv_32fc_t* aMatrix,
+                                                     const lv_32fc_t* bMatrix,
+                                                     unsigned int num_rows,
+                                                     unsigned int inner,
+                                                     unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const float* a[4];
+    lv_32fc_t* c;
+    unsigned int first, rows, r, column, k;
+    __m256 b, ar, ai;
+    __m256 accReal0, accImag0, accReal1, accImag1;
+    __m256 accReal2, accImag2, accReal3, accImag3;
+
+    // tiles of four rows, the missing ones repeating the first, by four columns
+    for (first = 0; first < num_rows; first += 4) {
+        rows = num_rows - first < 4 ? num_rows - first : 4;
+        for (r = 0; r < 4; r++) {
+            a[r] = (const float*)(aMatrix + (size_t)(first + (r < rows ? r : 0)) * inner);
+        }
+
+        for (column = 0; column < 4 * quarter_points; column += 4) {
+            accReal0 = accImag0 = accReal1 = accImag1 = _mm256_setzero_ps();
+            accReal2 = accImag2 = accReal3 = accImag3 = _mm256_setzero_ps();
+
+            for (k = 0; k < inner; k++) {
+                b = _mm256_loadu_ps(
+                    (const float*)(bMatrix + (size_t)k * num_points + column));
+                ar = _mm256_broadcast_ss(a[0] + 2 * k);
+                ai = _mm256_broadcast_ss(a[0] + 2 * k + 1);
+                accReal0 = _mm256_fmadd_ps(ar, b, accReal0);
+                accImag0 = _mm256_fmadd_ps(ai, b, accImag0);
+                ar = _mm256_broadcast_ss(a[1] + 2 * k);
+                ai = _mm256_broadcast_ss(a[1] + 2 * k + 1);
+                accReal1 = _mm256_fmadd_ps(ar, b, accReal1);
+                accImag1 = _mm256_fmadd_ps(ai, b, accImag1);
+                ar = _mm256_broadcast_ss(a[2] + 2 * k);
+                ai = _mm256_broadcast_ss(a[2] + 2 * k + 1);
+                accReal2 = _mm256_fmadd_ps(ar, b, accReal2);
+                accImag2 = _mm256_fmadd_ps(ai, b, accImag2);
+                ar = _mm256_broadcast_ss(a[3] + 2 * k);
+                ai = _mm256_broadcast_ss(a[3] + 2 * k + 1);
+                accReal3 = _mm256_fmadd_ps(ar, b, accReal3);
+                accImag3 = _mm256_fmadd_ps(ai, b, accImag3);
+            }
+
+            c = cMatrix + (size_t)first * num_points + column;
+            _mm256_storeu_ps((float*)c, _mm256_complexmul_parts_ps(accReal0, accImag0));
+            if (rows > 1) {
+                c += num_points;
+                _mm256_storeu_ps((float*)c,
+                                 _mm256_complexmul_parts_ps(accReal1, accImag1));
+            }
+            if (rows > 2) {
+                c += num_points;
+                _mm256_storeu_ps((float*)c,
+                                 _mm256_complexmul_parts_ps(accReal2, accImag2));
+            }
+            if (rows > 3) {
+                c += num_points;
+                _mm256_storeu_ps((float*)c,
+                                 _mm256_complexmul_parts_ps(accReal3, accImag3));
+            }
+        }
+    }
+
+    volk_gemm_columns(
+        cMatrix, aMatrix, bMatrix, num_rows, inner, num_points, 4 * quarter_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_gemm_32fc_u_avx512f(lv_32fc_t* cMatrix,
+                                                    const lv_32fc_t* aMatrix,
+                                                    const lv_32fc_t* bMatrix,
+                                                    unsigned int num_rows,
+                                                    unsigned int inner,
+                                                    unsigned int num_points)
+{
+    const float* a[4];
+    const float* b;
+    lv_32fc_t* c;
+    unsigned int first, rows, r, column, columns, k;
+    __mmask16 mask0, mask1;
+    __m512 b0, b1, ar, ai;
+    __m512 accReal00, accImag00, accReal01, accImag01;
+    __m512 accReal10, accImag10, accReal11, accImag11;
+    __m512 accReal20, accImag20, accReal21, accImag21;
+    __m512 accReal30, accImag30, accReal31, accImag31;
+
+    // tiles of four rows, the missing ones repeating the first, by sixteen columns
+    for (first = 0; first < num_rows; first += 4) {
+        rows = num_rows - first < 4 ? num_rows - first : 4;
+        for (r = 0; r < 4; r++) {
+            a[r] = (const float*)(aMatrix + (size_t)(first + (r < rows ? r : 0)) * inner);
+        }
+
+        for (column = 0; column < num_points; column += 16) {
+            // the columns past the end load as zero and are not stored
+            columns = num_points - column;
+            mask0 = columns >= 8 ? 0xffff : (__mmask16)((1u << (2 * columns)) - 1);
+            mask1 = columns >= 16 ? 0xffff
+                    : columns > 8 ? (__mmask16)((1u << (2 * (columns - 8))) - 1)
+                                  : 0;
+            accReal00 = accImag00 = accReal01 = accImag01 = _mm512_setzero_ps();
+            accReal10 = accImag10 = accReal11 = accImag11 = _mm512_setzero_ps();
+            accReal20 = accImag20 = accReal21 = accImag21 = _mm512_setzero_ps();
+            accReal30 = accImag30 = accReal31 = accImag31 = _mm512_setzero_ps();
+
+            for (k = 0; k < inner; k++) {
+                b = (const float*)(bMatrix + (size_t)k * num_points + column);
+                b0 = _mm512_maskz_loadu_ps(mask0, b);
+                b1 = _mm512_maskz_loadu_ps(mask1, b + 16);
+                ar = _mm512_set1_ps(a[0][2 * k]);
+                ai = _mm512_set1_ps(a[0][2 * k + 1]);
+                accReal00 = _mm512_fmadd_ps(ar, b0, accReal00);
+                accImag00 = _mm512_fmadd_ps(ai, b0, accImag00);
+                accReal01 = _mm512_fmadd_ps(ar, b1, accReal01);
+                accImag01 = _mm512_fmadd_ps(ai, b1, accImag01);
+                ar = _mm512_set1_ps(a[1][2 * k]);
+                ai = _mm512_set1_ps(a[1][2 * k + 1]);
+                accReal10 = _mm512_fmadd_ps(ar, b0, accReal10);
+                accImag10 = _mm512_fmadd_ps(ai, b0, accImag10);
+                accReal11 = _mm512_fmadd_ps(ar, b1, accReal11);
+                accImag11 = _mm512_fmadd_ps(ai, b1, accImag11);
+                ar = _mm512_set1_ps(a[2][2 * k]);
+                ai = _mm512_set1_ps(a[2][2 * k + 1]);
+                accReal20 = _mm512_fmadd_ps(ar, b0, accReal20);
+                accImag20 = _mm512_fmadd_ps(ai, b0, accImag20);
+                accReal21 = _mm512_fmadd_ps(ar, b1, accReal21);
+                accImag21 = _mm512_fmadd_ps(ai, b1, accImag21);
+                ar = _mm512_set1_ps(a[3][2 * k]);
+                ai = _mm512_set1_ps(a[3][2 * k + 1]);
+                accReal30 = _mm512_fmadd_ps(ar, b0, accReal30);
+                accImag30 = _mm512_fmadd_ps(ai, b0, accImag30);
+                accReal31 = _mm512_fmadd_ps(ar, b1, accReal31);
+                accImag31 = _mm512_fmadd_ps(ai, b1, accImag31);
+            }
+
+            c = cMatrix + (size_t)first * num_points + column;
+            _mm512_mask_storeu_ps(
+                (float*)c, mask0, _mm512_complexmul_parts_ps(accReal00, accImag00));
+            _mm512_mask_storeu_ps(
+                (float*)(c + 8), mask1, _mm512_complexmul_parts_ps(accReal01, accImag01));
+            if (rows > 1) {
+                c += num_points;
+                _mm512_mask_storeu_ps(
+                    (float*)c, mask0, _mm512_complexmul_parts_ps(accReal10, accImag10));
+                _mm512_mask_storeu_ps((float*)(c + 8),
+                                      mask1,
+                                      _mm512_complexmul_parts_ps(accReal11, accImag11));
+            }
+            if (rows > 2) {
+                c += num_points;
+                _mm512_mask_storeu_ps(
+                    (float*)c, mask0, _mm512_complexmul_parts_ps(accReal20, accImag20));
+                _mm512_mask_storeu_ps((float*)(c + 8),
+                                      mask1,
+                                      _mm512_complexmul_parts_ps(accReal21, accImag21));
+            }
+            if (rows > 3) {
+                c += num_points;
+                _mm512_mask_storeu_ps(
+                    (float*)c, mask0, _mm512_complexmul_parts_ps(accReal30, accImag30));
+                _mm512_mask_storeu_ps((float*)(c + 8),
+                                      mask1,
+                                      _mm512_complexmul_parts_ps(accReal31, accImag31));
+            }
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_x2_gemm_32fc_neonv8(lv_32fc_t* cMatrix,
+                                                 const lv_32fc_t* aMatrix,
+                                                 const lv_32fc_t* bMatrix,
+                                                 unsigned int num_rows,
+                                                 unsigned int inner,
+                                                 unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const float* a[4];
+    const float* b;
+    lv_32fc_t* c;
+    unsigned int first, rows, r, column, k;
+    float32x4_t b0, b1;
+    float32x2_t ak;
+    float32x4_t accReal00, accImag00, accReal01, accImag01;
+    float32x4_t accReal10, accImag10, accReal11, accImag11;
+    float32x4_t accReal20, accImag20, accReal21, accImag21;
+    float32x4_t accReal30, accImag30, accReal31, accImag31;
+
+    // tiles of four rows, the missing ones repeating the first, by four columns
+    for (first = 0; first < num_rows; first += 4) {
+        rows = num_rows - first < 4 ? num_rows - first : 4;
+        for (r = 0; r < 4; r++) {
+            a[r] = (const float*)(aMatrix + (size_t)(first + (r < rows ? r : 0)) * inner);
+        }
+
+        for (column = 0; column < 4 * quarter_points; column += 4) {
+            accReal00 = accImag00 = accReal01 = accImag01 = vdupq_n_f32(0.f);
+            accReal10 = accImag10 = accReal11 = accImag11 = vdupq_n_f32(0.f);
+            accReal20 = accImag20 = accReal21 = accImag21 = vdupq_n_f32(0.f);
+            accReal30 = accImag30 = accReal31 = accImag31 = vdupq_n_f32(0.f);
+
+            for (k = 0; k < inner; k++) {
+                b = (const float*)(bMatrix + (size_t)k * num_points + column);
+                b0 = vld1q_f32(b);
+                b1 = vld1q_f32(b + 4);
+                ak = vld1_f32(a[0] + 2 * k);
+                accReal00 = vfmaq_lane_f32(accReal00, b0, ak, 0);
+                accImag00 = vfmaq_lane_f32(accImag00, b0, ak, 1);
+                accReal01 = vfmaq_lane_f32(accReal01, b1, ak, 0);
+                accImag01 = vfmaq_lane_f32(accImag01, b1, ak, 1);
+                ak = vld1_f32(a[1] + 2 * k);
+                accReal10 = vfmaq_lane_f32(accReal10, b0, ak, 0);
+                accImag10 = vfmaq_lane_f32(accImag10, b0, ak, 1);
+                accReal11 = vfmaq_lane_f32(accReal11, b1, ak, 0);
+                accImag11 = vfmaq_lane_f32(accImag11, b1, ak, 1);
+                ak = vld1_f32(a[2] + 2 * k);
+                accReal20 = vfmaq_lane_f32(accReal20, b0, ak, 0);
+                accImag20 = vfmaq_lane_f32(accImag20, b0, ak, 1);
+                accReal21 = vfmaq_lane_f32(accReal21, b1, ak, 0);
+                accImag21 = vfmaq_lane_f32(accImag21, b1, ak, 1);
+                ak = vld1_f32(a[3] + 2 * k);
+                accReal30 = vfmaq_lane_f32(accReal30, b0, ak, 0);
+                accImag30 = vfmaq_lane_f32(accImag30, b0, ak, 1);
+                accReal31 = vfmaq_lane_f32(accReal31, b1, ak, 0);
+                accImag31 = vfmaq_lane_f32(accImag31, b1, ak, 1);
+            }
+
+            c = cMatrix + (size_t)first * num_points + column;
+            vst1q_f32((float*)c, _vcomplexmul_partsq_f32(accReal00, accImag00));
+            vst1q_f32((float*)(c + 2), _vcomplexmul_partsq_f32(accReal01, accImag01));
+            if (rows > 1) {
+                c += num_points;
+                vst1q_f32((float*)c, _vcomplexmul_partsq_f32(accReal10, accImag10));
+                vst1q_f32((float*)(c + 2),
+                          _vcomplexmul_partsq_f32(accReal11, accImag11));
+            }
+            if (rows > 2) {
+                c += num_points;
+                vst1q_f32((float*)c, _vcomplexmul_partsq_f32(accReal20, accImag20));
+                vst1q_f32((float*)(c + 2),
+                          _vcomplexmul_partsq_f32(accReal21, accImag21));
+            }
+            if (rows > 3) {
+                c += num_points;
+                vst1q_f32((float*)c, _vcomplexmul_partsq_f32(accReal30, accImag30));
+                vst1q_f32((float*)(c + 2),
+                          _vcomplexmul_partsq_f32(accReal31, accImag31));
+            }
+        }
+    }
+
+    volk_gemm_columns(
+        cMatrix, aMatrix, bMatrix, num_rows, inner, num_points, 4 * quarter_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_gemm_32fc_H */
@@ -0,0 +1,115 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_x2_gemm_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_gemmpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_gemmpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_32fc_x2_gemm_32fc.h>
+
+/* Multiplies an 11 by 16 matrix at the start of aMatrix by a 16 by
+ * (num_points / 16) matrix in bMatrix, and clears the rest of the output.
+ * Shorter inputs are treated as single values and rows. */
+static inline void volk_gemm_puppet(void (*kernel)(lv_32fc_t*,
+                                                   const lv_32fc_t*,
+                                                   const lv_32fc_t*,
+                                                   unsigned int,
+                                                   unsigned int,
+                                                   unsigned int),
+                                    lv_32fc_t* cMatrix,
+                                    const lv_32fc_t* aMatrix,
+                                    const lv_32fc_t* bMatrix,
+                                    unsigned int num_points)
+{
+    const unsigned int num_rows = num_points < 11 * 16 ? 1 : 11;
+    const unsigned int inner = num_points < 11 * 16 ? 1 : 16;
+    const unsigned int columns = num_points / inner;
+
+    kernel(cMatrix, aMatrix, bMatrix, num_rows, inner, columns);
+    memset(cMatrix + num_rows * columns,
+           0,
+           sizeof(lv_32fc_t) * (num_points - num_rows * columns));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_gemmpuppet_32fc_generic(lv_32fc_t* cMatrix,
+                                                        const lv_32fc_t* aMatrix,
+                                                        const lv_32fc_t* bMatrix,
+                                                        unsigned int num_points)
+{
+    volk_gemm_puppet(
+        volk_32fc_x2_gemm_32fc_generic, cMatrix, aMatrix, bMatrix, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_x2_gemmpuppet_32fc_u_avx2_fma(lv_32fc_t* cMatrix,
+                                                           const lv_32fc_t* aMatrix,
+                                                           const lv_32fc_t* bMatrix,
+                                                           unsigned int num_points)
+{
+    volk_gemm_puppet(
+        volk_32fc_x2_gemm_32fc_u_avx2_fma, cMatrix, aMatrix, bMatrix, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_x2_gemmpuppet_32fc_u_avx512f(lv_32fc_t* cMatrix,
+                                                          const lv_32fc_t* aMatrix,
+                                                          const lv_32fc_t* bMatrix,
+                                                          unsigned int num_points)
+{
+    volk_gemm_puppet(
+        volk_32fc_x2_gemm_32fc_u_avx512f, cMatrix, aMatrix, bMatrix, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_x2_gemmpuppet_32fc_neonv8(lv_32fc_t* cMatrix,
+                                                       const lv_32fc_t* aMatrix,
+                                                       const lv_32fc_t* bMatrix,
+                                                       unsigned int num_points)
+{
+    volk_gemm_puppet(
+        volk_32fc_x2_gemm_32fc_neonv8, cMatrix, aMatrix, bMatrix, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_gemmpuppet_32fc_H */
@@ -0,0 +1,127 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see
+ * 'kernels/volk/volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_interp_linear_multiply_conjugatepuppet_32fc_x2_H
+#define INCLUDED_volk_32fc_x2_interp_linear_multiply_conjugatepuppet_32fc_x2_H
+
+#include <string.h>
+#include <volk/volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2.h>
+
+/*
+ * Interpolates between the first input points every 6 outputs and equalises
+ * the second input. The last outputs, for which the pilots could run past the
+ * input, are zeroed.
+ */
+static inline void volk_32fc_x2_interp_linear_multiply_conjugate_puppet(
+    void (*kernel)(lv_32fc_t*,
+                   lv_32fc_t*,
+                   const lv_32fc_t*,
+                   const lv_32fc_t*,
+                   const unsigned int,
+                   unsigned int),
+    lv_32fc_t* channelVector,
+    lv_32fc_t* outputVector,
+    const lv_32fc_t* pilots,
+    const lv_32fc_t* inputVector,
+    unsigned int num_points)
+{
+    if (num_points == 0) {
+        return;
+    }
+    kernel(channelVector, outputVector, pilots, inputVector, 6, num_points - 1);
+    memset(channelVector + num_points - 1, 0, sizeof(lv_32fc_t));
+    memset(outputVector + num_points - 1, 0, sizeof(lv_32fc_t));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_interp_linear_multiply_conjugatepuppet_32fc_x2_generic(
+    lv_32fc_t* channelVector,
+    lv_32fc_t* outputVector,
+    const lv_32fc_t* pilots,
+    const lv_32fc_t* inputVector,
+    unsigned int num_points)
+{
+    volk_32fc_x2_interp_linear_multiply_conjugate_puppet(
+        volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_generic,
+        channelVector,
+        outputVector,
+        pilots,
+        inputVector,
+        num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_32fc_x2_interp_linear_multiply_conjugatepuppet_32fc_x2_u_avx2(
+    lv_32fc_t* channelVector,
+    lv_32fc_t* outputVector,
+    const lv_32fc_t* pilots,
+    const lv_32fc_t* inputVector,
+    unsigned int num_points)
+{
+    volk_32fc_x2_interp_linear_multiply_conjugate_puppet(
+        volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_u_avx2,
+        channelVector,
+        outputVector,
+        pilots,
+        inputVector,
+        num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_x2_interp_linear_multiply_conjugatepuppet_32fc_x2_u_avx512f(
+    lv_32fc_t* channelVector,
+    lv_32fc_t* outputVector,
+    const lv_32fc_t* pilots,
+    const lv_32fc_t* inputVector,
+    unsigned int num_points)
+{
+    volk_32fc_x2_interp_linear_multiply_conjugate_puppet(
+        volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_u_avx512f,
+        channelVector,
+        outputVector,
+        pilots,
+        inputVector,
+        num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_x2_interp_linear_multiply_conjugatepuppet_32fc_x2_H */
@@ -0,0 +1,296 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_matvec_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies a complex matrix, stored row by row, by a complex vector:
+ *
+ * outputVector[r] = sum over k of matrix[r * num_points + k] * inputVector[k]
+ *
+ * for each of the num_rows rows, as in forming beams from the channels of one
+ * array snapshot. The SIMD versions take four rows at a time, so each load of
+ * the input and its duplicated real and imaginary parts serves four rows
+ * instead of one as with repeated volk_32fc_x2_dot_prod_32fc calls. Use
+ * volk_32fc_x2_gemm_32fc for many snapshots at once.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_matvec_32fc(lv_32fc_t* outputVector, const lv_32fc_t* matrix,
+ * const lv_32fc_t* inputVector, unsigned int num_rows, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li matrix: num_rows rows of num_points values each.
+ * \li inputVector: num_points values.
+ * \li num_rows: The number of rows.
+ * \li num_points: The number of columns of the matrix and values of the input.
+ *
+ * \b Outputs
+ * \li outputVector: num_rows values.
+ *
+ * \b Example
+ * Form 16 beams from one snapshot of a 32 element array.
+ * \code
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* weights =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * 16 * 32, alignment);
+ *   lv_32fc_t* snapshot = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * 32, alignment);
+ *   lv_32fc_t beams[16];
+ *
+ *   // fill in the conjugated steering vectors, one beam per row
+ *   volk_32fc_x2_matvec_32fc(beams, weights, snapshot, 16, 32);
+ *
+ *   volk_free(weights);
+ *   volk_free(snapshot);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_matvec_32fc_H
+#define INCLUDED_volk_32fc_x2_matvec_32fc_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_matvec_32fc_generic(lv_32fc_t* outputVector,
+                                                    const lv_32fc_t* matrix,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_rows,
+                                                    unsigned int num_points)
+{
+    const float* in = (const float*)inputVector;
+    unsigned int row, k;
+
+    for (row = 0; row < num_rows; row++) {
+        const float* a = (const float*)(matrix + (size_t)row * num_points);
+        float sumReal = 0.f, sumImag = 0.f;
+        for (k = 0; k < num_points; k++) {
+            sumReal += a[2 * k] * in[2 * k] - a[2 * k + 1] * in[2 * k + 1];
+            sumImag += a[2 * k] * in[2 * k + 1] + a[2 * k + 1] * in[2 * k];
+        }
+        outputVector[row] = lv_cmake(sumReal, sumImag);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_matvec_32fc_u_avx2_fma(lv_32fc_t* outputVector,
+                                                       const lv_32fc_t* matrix,
+                                                       const lv_32fc_t* inputVector,
+                                                       unsigned int num_rows,
+                                                       unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t products[16];
+    const lv_32fc_t* row[4];
+    unsigned int first, rows, r, k;
+    __m256 x, xReal, xImag;
+    __m256 accReal0, accImag0, accReal1, accImag1;
+    __m256 accReal2, accImag2, accReal3, accImag3;
+
+    // four rows at a time, the missing ones repeating the first
+    for (first = 0; first < num_rows; first += 4) {
+        rows = num_rows - first < 4 ? num_rows - first : 4;
+        for (r = 0; r < 4; r++) {
+            row[r] = matrix + (size_t)(first + (r < rows ? r : 0)) * num_points;
+        }
+        accReal0 = accImag0 = accReal1 = accImag1 = _mm256_setzero_ps();
+        accReal2 = accImag2 = accReal3 = accImag3 = _mm256_setzero_ps();
+
+        for (k = 0; k < 4 * quarter_points; k += 4) {
+            x = _mm256_loadu_ps((const float*)(inputVector + k));
+            xReal = _mm256_moveldup_ps(x);
+            xImag = _mm256_movehdup_ps(x);
+            x = _mm256_loadu_ps((const float*)(row[0] + k));
+            accReal0 = _mm256_fmadd_ps(x, xReal, accReal0);
+            accImag0 = _mm256_fmadd_ps(x, xImag, accImag0);
+            x = _mm256_loadu_ps((const float*)(row[1] + k));
+            accReal1 = _mm256_fmadd_ps(x, xReal, accReal1);
+            accImag1 = _mm256_fmadd_ps(x, xImag, accImag1);
+            x = _mm256_loadu_ps((const float*)(row[2] + k));
+            accReal2 = _mm256_fmadd_ps(x, xReal, accReal2);
+            accImag2 = _mm256_fmadd_ps(x, xImag, accImag2);
+            x = _mm256_loadu_ps((const float*)(row[3] + k));
+            accReal3 = _mm256_fmadd_ps(x, xReal, accReal3);
+            accImag3 = _mm256_fmadd_ps(x, xImag, accImag3);
+        }
+
+        _mm256_store_ps((float*)products, _mm256_complexmul_parts_ps(accReal0, accImag0));
+        _mm256_store_ps((float*)(products + 4),
+                        _mm256_complexmul_parts_ps(accReal1, accImag1));
+        _mm256_store_ps((float*)(products + 8),
+                        _mm256_complexmul_parts_ps(accReal2, accImag2));
+        _mm256_store_ps((float*)(products + 12),
+                        _mm256_complexmul_parts_ps(accReal3, accImag3));
+        for (r = 0; r < rows; r++) {
+            lv_32fc_t sum = (products[4 * r] + products[4 * r + 1]) +
+                            (products[4 * r + 2] + products[4 * r + 3]);
+            for (k = 4 * quarter_points; k < num_points; k++) {
+                sum += row[r][k] * inputVector[k];
+            }
+            outputVector[first + r] = sum;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_matvec_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                      const lv_32fc_t* matrix,
+                                                      const lv_32fc_t* inputVector,
+                                                      unsigned int num_rows,
+                                                      unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t products[32];
+    const lv_32fc_t* row[4];
+    unsigned int first, rows, r, k;
+    __mmask16 mask;
+    __m512 x, xReal, xImag;
+    __m512 accReal0, accImag0, accReal1, accImag1;
+    __m512 accReal2, accImag2, accReal3, accImag3;
+
+    // four rows at a time, the missing ones repeating the first
+    for (first = 0; first < num_rows; first += 4) {
+        rows = num_rows - first < 4 ? num_rows - first : 4;
+        for (r = 0; r < 4; r++) {
+            row[r] = matrix + (size_t)(first + (r < rows ? r : 0)) * num_points;
+        }
+        accReal0 = accImag0 = accReal1 = accImag1 = _mm512_setzero_ps();
+        accReal2 = accImag2 = accReal3 = accImag3 = _mm512_setzero_ps();
+        mask = 0xffff;
+
+        for (k = 0; k < num_points; k += 8) {
+            // the columns past the end load as zero, which adds nothing
+            if (num_points - k < 8) {
+                mask = (__mmask16)((1u << (2 * (num_points - k))) - 1);
+            }
+            x = _mm512_maskz_loadu_ps(mask, (const float*)(inputVector + k));
+            xReal = _mm512_moveldup_ps(x);
+            xImag = _mm512_movehdup_ps(x);
+            x = _mm512_maskz_loadu_ps(mask, (const float*)(row[0] + k));
+            accReal0 = _mm512_fmadd_ps(x, xReal, accReal0);
+            accImag0 = _mm512_fmadd_ps(x, xImag, accImag0);
+            x = _mm512_maskz_loadu_ps(mask, (const float*)(row[1] + k));
+            accReal1 = _mm512_fmadd_ps(x, xReal, accReal1);
+            accImag1 = _mm512_fmadd_ps(x, xImag, accImag1);
+            x = _mm512_maskz_loadu_ps(mask, (const float*)(row[2] + k));
+            accReal2 = _mm512_fmadd_ps(x, xReal, accReal2);
+            accImag2 = _mm512_fmadd_ps(x, xImag, accImag2);
+            x = _mm512_maskz_loadu_ps(mask, (const float*)(row[3] + k));
+            accReal3 = _mm512_fmadd_ps(x, xReal, accReal3);
+            accImag3 = _mm512_fmadd_ps(x, xImag, accImag3);
+        }
+
+        _mm512_store_ps((float*)products, _mm512_complexmul_parts_ps(accReal0, accImag0));
+        _mm512_store_ps((float*)(products + 8),
+                        _mm512_complexmul_parts_ps(accReal1, accImag1));
+        _mm512_store_ps((float*)(products + 16),
+                        _mm512_complexmul_parts_ps(accReal2, accImag2));
+        _mm512_store_ps((float*)(products + 24),
+                        _mm512_complexmul_parts_ps(accReal3, accImag3));
+        for (r = 0; r < rows; r++) {
+            const lv_32fc_t* p = products + 8 * r;
+            outputVector[first + r] =
+                ((p[0] + p[1]) + (p[2] + p[3])) + ((p[4] + p[5]) + (p[6] + p[7]));
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_x2_matvec_32fc_neonv8(lv_32fc_t* outputVector,
+                                                   const lv_32fc_t* matrix,
+                                                   const lv_32fc_t* inputVector,
+                                                   unsigned int num_rows,
+                                                   unsigned int num_points)
+{
+    const unsigned int half_points = num_points / 2;
+    lv_32fc_t products[8];
+    const lv_32fc_t* row[4];
+    unsigned int first, rows, r, k;
+    float32x4_t x, xReal, xImag;
+    float32x4_t accReal0, accImag0, accReal1, accImag1;
+    float32x4_t accReal2, accImag2, accReal3, accImag3;
+
+    // four rows at a time, the missing ones repeating the first
+    for (first = 0; first < num_rows; first += 4) {
+        rows = num_rows - first < 4 ? num_rows - first : 4;
+        for (r = 0; r < 4; r++) {
+            row[r] = matrix + (size_t)(first + (r < rows ? r : 0)) * num_points;
+        }
+        accReal0 = accImag0 = accReal1 = accImag1 = vdupq_n_f32(0.f);
+        accReal2 = accImag2 = accReal3 = accImag3 = vdupq_n_f32(0.f);
+
+        for (k = 0; k < 2 * half_points; k += 2) {
+            x = vld1q_f32((const float*)(inputVector + k));
+            xReal = vtrn1q_f32(x, x);
+            xImag = vtrn2q_f32(x, x);
+            x = vld1q_f32((const float*)(row[0] + k));
+            accReal0 = vfmaq_f32(accReal0, x, xReal);
+            accImag0 = vfmaq_f32(accImag0, x, xImag);
+            x = vld1q_f32((const float*)(row[1] + k));
+            accReal1 = vfmaq_f32(accReal1, x, xReal);
+            accImag1 = vfmaq_f32(accImag1, x, xImag);
+            x = vld1q_f32((const float*)(row[2] + k));
+            accReal2 = vfmaq_f32(accReal2, x, xReal);
+            accImag2 = vfmaq_f32(accImag2, x, xImag);
+            x = vld1q_f32((const float*)(row[3] + k));
+            accReal3 = vfmaq_f32(accReal3, x, xReal);
+            accImag3 = vfmaq_f32(accImag3, x, xImag);
+        }
+
+        vst1q_f32((float*)products, _vcomplexmul_partsq_f32(accReal0, accImag0));
+        vst1q_f32((float*)(products + 2), _vcomplexmul_partsq_f32(accReal1, accImag1));
+        vst1q_f32((float*)(products + 4), _vcomplexmul_partsq_f32(accReal2, accImag2));
+        vst1q_f32((float*)(products + 6), _vcomplexmul_partsq_f32(accReal3, accImag3));
+        for (r = 0; r < rows; r++) {
+            lv_32fc_t sum = products[2 * r] + products[2 * r + 1];
+            if (num_points & 1) {
+                sum += row[r][num_points - 1] * inputVector[num_points - 1];
+            }
+            outputVector[first + r] = sum;
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_matvec_32fc_H */
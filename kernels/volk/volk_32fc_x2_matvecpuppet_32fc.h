@@ -0,0 +1,116 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_x2_matvec_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_matvecpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_matvecpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_32fc_x2_matvec_32fc.h>
+
+/* Applies the first 13 * (num_points / 13) values of matrix as a 13 row matrix
+ * to the start of inputVector, and clears the rest of the output. */
+static inline void volk_matvec_puppet(void (*kernel)(lv_32fc_t*,
+                                                     const lv_32fc_t*,
+                                                     const lv_32fc_t*,
+                                                     unsigned int,
+                                                     unsigned int),
+                                      lv_32fc_t* outputVector,
+                                      const lv_32fc_t* matrix,
+                                      const lv_32fc_t* inputVector,
+                                      unsigned int num_points)
+{
+    const unsigned int num_rows = num_points < 13 ? num_points : 13;
+    const unsigned int columns = num_points / num_rows;
+
+    kernel(outputVector, matrix, inputVector, num_rows, columns);
+    memset(outputVector + num_rows, 0, sizeof(lv_32fc_t) * (num_points - num_rows));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                          const lv_32fc_t* matrix,
+                                                          const lv_32fc_t* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_matvec_puppet(
+        volk_32fc_x2_matvec_32fc_generic, outputVector, matrix, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_u_avx2_fma(lv_32fc_t* outputVector,
+                                                             const lv_32fc_t* matrix,
+                                                             const lv_32fc_t* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_matvec_puppet(volk_32fc_x2_matvec_32fc_u_avx2_fma,
+                       outputVector,
+                       matrix,
+                       inputVector,
+                       num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                            const lv_32fc_t* matrix,
+                                                            const lv_32fc_t* inputVector,
+                                                            unsigned int num_points)
+{
+    volk_matvec_puppet(volk_32fc_x2_matvec_32fc_u_avx512f,
+                       outputVector,
+                       matrix,
+                       inputVector,
+                       num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_neonv8(lv_32fc_t* outputVector,
+                                                         const lv_32fc_t* matrix,
+                                                         const lv_32fc_t* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_matvec_puppet(
+        volk_32fc_x2_matvec_32fc_neonv8, outputVector, matrix, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_matvecpuppet_32fc_H */
@@ -0,0 +1,300 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_mp_dpd_32fc
+ *
+ * \b Overview
+ *
+ * Applies a memory polynomial digital predistorter of num_orders
+ * nonlinear orders and memory_depth memory taps,
+ *
+ *   y(n) = sum over m and k of coeffs[m * num_orders + k] * x(n - m) * |x(n - m)|^k
+ *
+ * in one pass instead of a chain of volk_32fc_magnitude_32f, basis
+ * products and complex multiply-accumulates. Like volk_32fc_x2_fir_32fc,
+ * the input holds num_points + memory_depth - 1 samples, the
+ * memory_depth - 1 samples of history first, so output i is y(n) for
+ * x(n) = input[i + memory_depth - 1].
+ *
+ * The SIMD implementations keep |x| in a register and evaluate the
+ * polynomial of each memory tap in it by Horner's rule, one fused
+ * multiply-add per order for each of its real and imaginary part. They
+ * accumulate x times the real and times the imaginary part of the
+ * polynomials over the taps and combine the two sums into complex
+ * products only once per output.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_mp_dpd_32fc(lv_32fc_t* output, const lv_32fc_t* input,
+ * const lv_32fc_t* coeffs, unsigned int num_orders, unsigned int memory_depth,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: num_points + memory_depth - 1 samples, the oldest first.
+ * \li coeffs: num_orders * memory_depth coefficients, the orders of memory
+ * tap m from coeffs[m * num_orders], orders from 0.
+ * \li num_orders: The number of nonlinear orders K, at least 1.
+ * \li memory_depth: The number of memory taps M, at least 1.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: The predistorted samples.
+ *
+ * \b Example
+ * Predistort a block with the K = 5, M = 4 model of a power amplifier,
+ * keeping the last 3 samples as the history of the next block.
+ * \code
+ *   volk_32fc_x2_mp_dpd_32fc(out, in, coeffs, 5, 4, N);
+ *   memmove(in, in + N, 3 * sizeof(lv_32fc_t));
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_mp_dpd_32fc_H
+#define INCLUDED_volk_32fc_x2_mp_dpd_32fc_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/*
+ * One output, of the memory_depth samples from input on, the newest last:
+ * the polynomial of each tap in |x| by Horner's rule, times x.
+ */
+static inline lv_32fc_t volk_mp_dpd_output(const lv_32fc_t* input,
+                                           const lv_32fc_t* coeffs,
+                                           unsigned int num_orders,
+                                           unsigned int memory_depth)
+{
+    lv_32fc_t sum = lv_cmake(0.f, 0.f);
+    unsigned int m, k;
+
+    for (m = 0; m < memory_depth; m++) {
+        const lv_32fc_t x = input[memory_depth - 1 - m];
+        const lv_32fc_t* c = coeffs + m * num_orders;
+        const float r = sqrtf(lv_creal(x) * lv_creal(x) + lv_cimag(x) * lv_cimag(x));
+        float poly_re = lv_creal(c[num_orders - 1]);
+        float poly_im = lv_cimag(c[num_orders - 1]);
+        for (k = num_orders - 1; k-- > 0;) {
+            poly_re = poly_re * r + lv_creal(c[k]);
+            poly_im = poly_im * r + lv_cimag(c[k]);
+        }
+        sum += x * lv_cmake(poly_re, poly_im);
+    }
+    return sum;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_mp_dpd_32fc_generic(lv_32fc_t* output,
+                                                    const lv_32fc_t* input,
+                                                    const lv_32fc_t* coeffs,
+                                                    unsigned int num_orders,
+                                                    unsigned int memory_depth,
+                                                    unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        output[number] =
+            volk_mp_dpd_output(input + number, coeffs, num_orders, memory_depth);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_mp_dpd_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       const lv_32fc_t* coeffs,
+                                                       unsigned int num_orders,
+                                                       unsigned int memory_depth,
+                                                       unsigned int num_points)
+{
+    const float* c = (const float*)coeffs;
+    float* out = (float*)output;
+    unsigned int number = 0, m, k;
+
+    // two vectors of outputs share every coefficient broadcast
+    for (; number + 8 <= num_points; number += 8) {
+        __m256 re0 = _mm256_setzero_ps(), im0 = _mm256_setzero_ps();
+        __m256 re1 = _mm256_setzero_ps(), im1 = _mm256_setzero_ps();
+        for (m = 0; m < memory_depth; m++) {
+            const float* in = (const float*)(input + number + memory_depth - 1 - m);
+            const float* tap = c + 2 * m * num_orders;
+            const __m256 x0 = _mm256_loadu_ps(in);
+            const __m256 x1 = _mm256_loadu_ps(in + 8);
+            __m256 r0 = _mm256_mul_ps(x0, x0);
+            __m256 r1 = _mm256_mul_ps(x1, x1);
+            // |x| in both parts of each point
+            r0 = _mm256_sqrt_ps(_mm256_add_ps(r0, _mm256_permute_ps(r0, 0xB1)));
+            r1 = _mm256_sqrt_ps(_mm256_add_ps(r1, _mm256_permute_ps(r1, 0xB1)));
+            __m256 poly_re0 = _mm256_set1_ps(tap[2 * num_orders - 2]);
+            __m256 poly_im0 = _mm256_set1_ps(tap[2 * num_orders - 1]);
+            __m256 poly_re1 = poly_re0, poly_im1 = poly_im0;
+            for (k = num_orders - 1; k-- > 0;) {
+                const __m256 c_re = _mm256_set1_ps(tap[2 * k]);
+                const __m256 c_im = _mm256_set1_ps(tap[2 * k + 1]);
+                poly_re0 = _mm256_fmadd_ps(poly_re0, r0, c_re);
+                poly_im0 = _mm256_fmadd_ps(poly_im0, r0, c_im);
+                poly_re1 = _mm256_fmadd_ps(poly_re1, r1, c_re);
+                poly_im1 = _mm256_fmadd_ps(poly_im1, r1, c_im);
+            }
+            re0 = _mm256_fmadd_ps(x0, poly_re0, re0);
+            im0 = _mm256_fmadd_ps(_mm256_permute_ps(x0, 0xB1), poly_im0, im0);
+            re1 = _mm256_fmadd_ps(x1, poly_re1, re1);
+            im1 = _mm256_fmadd_ps(_mm256_permute_ps(x1, 0xB1), poly_im1, im1);
+        }
+        // xr*pr - xi*pi, xi*pr + xr*pi
+        _mm256_storeu_ps(out + 2 * number, _mm256_addsub_ps(re0, im0));
+        _mm256_storeu_ps(out + 2 * number + 8, _mm256_addsub_ps(re1, im1));
+    }
+
+    for (; number < num_points; number++) {
+        output[number] =
+            volk_mp_dpd_output(input + number, coeffs, num_orders, memory_depth);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_mp_dpd_32fc_u_avx512f(lv_32fc_t* output,
+                                                      const lv_32fc_t* input,
+                                                      const lv_32fc_t* coeffs,
+                                                      unsigned int num_orders,
+                                                      unsigned int memory_depth,
+                                                      unsigned int num_points)
+{
+    const float* c = (const float*)coeffs;
+    float* out = (float*)output;
+    const __m512 ones = _mm512_set1_ps(1.f);
+    unsigned int number = 0, m, k;
+
+    // two vectors of outputs share every coefficient broadcast
+    for (; number + 16 <= num_points; number += 16) {
+        __m512 re0 = _mm512_setzero_ps(), im0 = _mm512_setzero_ps();
+        __m512 re1 = _mm512_setzero_ps(), im1 = _mm512_setzero_ps();
+        for (m = 0; m < memory_depth; m++) {
+            const float* in = (const float*)(input + number + memory_depth - 1 - m);
+            const float* tap = c + 2 * m * num_orders;
+            const __m512 x0 = _mm512_loadu_ps(in);
+            const __m512 x1 = _mm512_loadu_ps(in + 16);
+            __m512 r0 = _mm512_mul_ps(x0, x0);
+            __m512 r1 = _mm512_mul_ps(x1, x1);
+            // |x| in both parts of each point
+            r0 = _mm512_sqrt_ps(_mm512_add_ps(r0, _mm512_permute_ps(r0, 0xB1)));
+            r1 = _mm512_sqrt_ps(_mm512_add_ps(r1, _mm512_permute_ps(r1, 0xB1)));
+            __m512 poly_re0 = _mm512_set1_ps(tap[2 * num_orders - 2]);
+            __m512 poly_im0 = _mm512_set1_ps(tap[2 * num_orders - 1]);
+            __m512 poly_re1 = poly_re0, poly_im1 = poly_im0;
+            for (k = num_orders - 1; k-- > 0;) {
+                const __m512 c_re = _mm512_set1_ps(tap[2 * k]);
+                const __m512 c_im = _mm512_set1_ps(tap[2 * k + 1]);
+                poly_re0 = _mm512_fmadd_ps(poly_re0, r0, c_re);
+                poly_im0 = _mm512_fmadd_ps(poly_im0, r0, c_im);
+                poly_re1 = _mm512_fmadd_ps(poly_re1, r1, c_re);
+                poly_im1 = _mm512_fmadd_ps(poly_im1, r1, c_im);
+            }
+            re0 = _mm512_fmadd_ps(x0, poly_re0, re0);
+            im0 = _mm512_fmadd_ps(_mm512_permute_ps(x0, 0xB1), poly_im0, im0);
+            re1 = _mm512_fmadd_ps(x1, poly_re1, re1);
+            im1 = _mm512_fmadd_ps(_mm512_permute_ps(x1, 0xB1), poly_im1, im1);
+        }
+        // xr*pr - xi*pi, xi*pr + xr*pi
+        _mm512_storeu_ps(out + 2 * number, _mm512_fmaddsub_ps(re0, ones, im0));
+        _mm512_storeu_ps(out + 2 * number + 16, _mm512_fmaddsub_ps(re1, ones, im1));
+    }
+
+    for (; number < num_points; number++) {
+        output[number] =
+            volk_mp_dpd_output(input + number, coeffs, num_orders, memory_depth);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_mp_dpd_32fc_neonv8(lv_32fc_t* output,
+                                                   const lv_32fc_t* input,
+                                                   const lv_32fc_t* coeffs,
+                                                   unsigned int num_orders,
+                                                   unsigned int memory_depth,
+                                                   unsigned int num_points)
+{
+    const float* c = (const float*)coeffs;
+    float* out = (float*)output;
+    unsigned int number = 0, m, k;
+    float32x4x2_t y0, y1;
+
+    // two vectors of outputs share every coefficient broadcast
+    for (; number + 8 <= num_points; number += 8) {
+        y0.val[0] = y0.val[1] = y1.val[0] = y1.val[1] = vdupq_n_f32(0.f);
+        for (m = 0; m < memory_depth; m++) {
+            const float* in = (const float*)(input + number + memory_depth - 1 - m);
+            const float* tap = c + 2 * m * num_orders;
+            const float32x4x2_t x0 = vld2q_f32(in);
+            const float32x4x2_t x1 = vld2q_f32(in + 8);
+            const float32x4_t r0 = vsqrtq_f32(vfmaq_f32(
+                vmulq_f32(x0.val[0], x0.val[0]), x0.val[1], x0.val[1]));
+            const float32x4_t r1 = vsqrtq_f32(vfmaq_f32(
+                vmulq_f32(x1.val[0], x1.val[0]), x1.val[1], x1.val[1]));
+            float32x4_t poly_re0 = vdupq_n_f32(tap[2 * num_orders - 2]);
+            float32x4_t poly_im0 = vdupq_n_f32(tap[2 * num_orders - 1]);
+            float32x4_t poly_re1 = poly_re0, poly_im1 = poly_im0;
+            for (k = num_orders - 1; k-- > 0;) {
+                const float32x4_t c_re = vdupq_n_f32(tap[2 * k]);
+                const float32x4_t c_im = vdupq_n_f32(tap[2 * k + 1]);
+                poly_re0 = vfmaq_f32(c_re, poly_re0, r0);
+                poly_im0 = vfmaq_f32(c_im, poly_im0, r0);
+                poly_re1 = vfmaq_f32(c_re, poly_re1, r1);
+                poly_im1 = vfmaq_f32(c_im, poly_im1, r1);
+            }
+            y0.val[0] = vfmaq_f32(y0.val[0], x0.val[0], poly_re0);
+            y0.val[0] = vfmsq_f32(y0.val[0], x0.val[1], poly_im0);
+            y0.val[1] = vfmaq_f32(y0.val[1], x0.val[1], poly_re0);
+            y0.val[1] = vfmaq_f32(y0.val[1], x0.val[0], poly_im0);
+            y1.val[0] = vfmaq_f32(y1.val[0], x1.val[0], poly_re1);
+            y1.val[0] = vfmsq_f32(y1.val[0], x1.val[1], poly_im1);
+            y1.val[1] = vfmaq_f32(y1.val[1], x1.val[1], poly_re1);
+            y1.val[1] = vfmaq_f32(y1.val[1], x1.val[0], poly_im1);
+        }
+        vst2q_f32(out + 2 * number, y0);
+        vst2q_f32(out + 2 * number + 8, y1);
+    }
+
+    for (; number < num_points; number++) {
+        output[number] =
+            volk_mp_dpd_output(input + number, coeffs, num_orders, memory_depth);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_mp_dpd_32fc_H */
@@ -0,0 +1,80 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_32FC_X2_MP_DPDPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_X2_MP_DPDPUPPET_32FC_H
+
+#include <string.h>
+#include <volk/volk_32fc_x2_mp_dpd_32fc.h>
+
+/* The K = 5, M = 4 model of a typical transmitter, or a memoryless one for
+ * short vectors, reading the coefficients from the start of the second
+ * buffer. The last memory_depth - 1 outputs would read past the input, they
+ * are copies of it. */
+#define VOLK_MP_DPDPUPPET(impl)                                               \
+    const unsigned int memory_depth = num_points < 4 ? 1 : 4;                \
+    const unsigned int num_outputs = num_points - memory_depth + 1;          \
+    impl(output, input, coeffs, 5, memory_depth, num_outputs);               \
+    memcpy(output + num_outputs, input + num_outputs,                        \
+           (memory_depth - 1) * sizeof(*output));
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_x2_mp_dpdpuppet_32fc_generic(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          const lv_32fc_t* coeffs,
+                                                          unsigned int num_points)
+{
+    VOLK_MP_DPDPUPPET(volk_32fc_x2_mp_dpd_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_32fc_x2_mp_dpdpuppet_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                             const lv_32fc_t* input,
+                                                             const lv_32fc_t* coeffs,
+                                                             unsigned int num_points)
+{
+    VOLK_MP_DPDPUPPET(volk_32fc_x2_mp_dpd_32fc_u_avx2_fma);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32fc_x2_mp_dpdpuppet_32fc_u_avx512f(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            const lv_32fc_t* coeffs,
+                                                            unsigned int num_points)
+{
+    VOLK_MP_DPDPUPPET(volk_32fc_x2_mp_dpd_32fc_u_avx512f);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+static inline void volk_32fc_x2_mp_dpdpuppet_32fc_neonv8(lv_32fc_t* output,
+                                                         const lv_32fc_t* input,
+                                                         const lv_32fc_t* coeffs,
+                                                         unsigned int num_points)
+{
+    VOLK_MP_DPDPUPPET(volk_32fc_x2_mp_dpd_32fc_neonv8);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_VOLK_32FC_X2_MP_DPDPUPPET_32FC_H */
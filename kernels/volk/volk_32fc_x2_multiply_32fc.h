@@ -75,6 +75,39 @@
 #include <stdio.h>
 #include <volk/volk_complex.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_multiply_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                        const lv_32fc_t* aVector,
+                                                        const lv_32fc_t* bVector,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* a = (const float*)aVector;
+    const float* b = (const float*)bVector;
+    float* c = (float*)cVector;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        const __m512 x = _mm512_loadu_ps(a);
+        const __m512 y = _mm512_loadu_ps(b);
+        _mm512_storeu_ps(c, _mm512_complexmul_ps(x, y));
+        a += 16;
+        b += 16;
+        c += 16;
+    }
+
+    // the last points with a masked load and store, two floats a point
+    const __mmask16 mask = _cvtu32_mask16((1u << (2 * (num_points & 7))) - 1);
+    const __m512 x = _mm512_maskz_loadu_ps(mask, a);
+    const __m512 y = _mm512_maskz_loadu_ps(mask, b);
+    _mm512_mask_storeu_ps(c, mask, _mm512_complexmul_ps(x, y));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #if LV_HAVE_AVX2 && LV_HAVE_FMA
 #include <immintrin.h>
 /*!
@@ -222,6 +255,19 @@ static inline void volk_32fc_x2_multiply_32fc_generic(lv_32fc_t* cVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_OPENCL
+#include <volk/volk_opencl.h>
+
+static inline void volk_32fc_x2_multiply_32fc_opencl(lv_32fc_t* cVector,
+                                                     const lv_32fc_t* aVector,
+                                                     const lv_32fc_t* bVector,
+                                                     unsigned int num_points)
+{
+    if (!volk_opencl_32fc_x2_multiply_32fc(cVector, aVector, bVector, num_points))
+        volk_32fc_x2_multiply_32fc_generic(cVector, aVector, bVector, num_points);
+}
+#endif /* LV_HAVE_OPENCL */
+
 
 #endif /* INCLUDED_volk_32fc_x2_multiply_32fc_u_H */
 #ifndef INCLUDED_volk_32fc_x2_multiply_32fc_a_H
@@ -232,6 +278,39 @@ static inline void volk_32fc_x2_multiply_32fc_generic(lv_32fc_t* cVector,
 #include <stdio.h>
 #include <volk/volk_complex.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_multiply_32fc_a_avx512f(lv_32fc_t* cVector,
+                                                        const lv_32fc_t* aVector,
+                                                        const lv_32fc_t* bVector,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* a = (const float*)aVector;
+    const float* b = (const float*)bVector;
+    float* c = (float*)cVector;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        const __m512 x = _mm512_load_ps(a);
+        const __m512 y = _mm512_load_ps(b);
+        _mm512_store_ps(c, _mm512_complexmul_ps(x, y));
+        a += 16;
+        b += 16;
+        c += 16;
+    }
+
+    // the last points with a masked load and store, two floats a point
+    const __mmask16 mask = _cvtu32_mask16((1u << (2 * (num_points & 7))) - 1);
+    const __m512 x = _mm512_maskz_load_ps(mask, a);
+    const __m512 y = _mm512_maskz_load_ps(mask, b);
+    _mm512_mask_store_ps(c, mask, _mm512_complexmul_ps(x, y));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #if LV_HAVE_AVX2 && LV_HAVE_FMA
 #include <immintrin.h>
 /*!
@@ -469,6 +548,59 @@ static inline void volk_32fc_x2_multiply_32fc_neon_opttests(lv_32fc_t* cVector,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_SVE
+#include <arm_sve.h>
+
+static inline void volk_32fc_x2_multiply_32fc_sve(lv_32fc_t* cVector,
+                                                  const lv_32fc_t* aVector,
+                                                  const lv_32fc_t* bVector,
+                                                  unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    const float* bPtr = (const float*)bVector;
+    float* cPtr = (float*)cVector;
+    const unsigned int num_floats = 2 * num_points;
+    const svfloat32_t zero = svdup_n_f32(0.f);
+
+    for (unsigned int number = 0; number < num_floats; number += svcntw()) {
+        const svbool_t pg = svwhilelt_b32_u32(number, num_floats);
+        const svfloat32_t a = svld1_f32(pg, aPtr + number);
+        const svfloat32_t b = svld1_f32(pg, bPtr + number);
+        // (ar*br, ar*bi), then (-ai*bi, ai*br) on top
+        svfloat32_t c = svcmla_f32_x(pg, zero, a, b, 0);
+        c = svcmla_f32_x(pg, c, a, b, 90);
+        svst1_f32(pg, cPtr + number, c);
+    }
+}
+#endif /* LV_HAVE_SVE */
+
+#ifdef LV_HAVE_RVV
+#include <riscv_vector.h>
+
+static inline void volk_32fc_x2_multiply_32fc_rvv(lv_32fc_t* cVector,
+                                                  const lv_32fc_t* aVector,
+                                                  const lv_32fc_t* bVector,
+                                                  unsigned int num_points)
+{
+    size_t n = num_points;
+    for (size_t vl; n > 0; n -= vl, aVector += vl, bVector += vl, cVector += vl) {
+        // two register groups of four hold the deinterleaved re and im
+        vl = __riscv_vsetvl_e32m4(n);
+        const vfloat32m4x2_t va = __riscv_vlseg2e32_v_f32m4x2((const float*)aVector, vl);
+        const vfloat32m4x2_t vb = __riscv_vlseg2e32_v_f32m4x2((const float*)bVector, vl);
+        const vfloat32m4_t ar = __riscv_vget_v_f32m4x2_f32m4(va, 0);
+        const vfloat32m4_t ai = __riscv_vget_v_f32m4x2_f32m4(va, 1);
+        const vfloat32m4_t br = __riscv_vget_v_f32m4x2_f32m4(vb, 0);
+        const vfloat32m4_t bi = __riscv_vget_v_f32m4x2_f32m4(vb, 1);
+        const vfloat32m4_t cr =
+            __riscv_vfnmsac_vv_f32m4(__riscv_vfmul_vv_f32m4(ar, br, vl), ai, bi, vl);
+        const vfloat32m4_t ci =
+            __riscv_vfmacc_vv_f32m4(__riscv_vfmul_vv_f32m4(ar, bi, vl), ai, br, vl);
+        __riscv_vsseg2e32_v_f32m4x2((float*)cVector, __riscv_vcreate_v_f32m4x2(cr, ci), vl);
+    }
+}
+#endif /* LV_HAVE_RVV */
+
 
 #ifdef LV_HAVE_NEONV7
 
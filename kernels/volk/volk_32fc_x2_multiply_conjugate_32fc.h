@@ -76,6 +76,40 @@
 #include <stdio.h>
 #include <volk/volk_complex.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_x2_multiply_conjugate_32fc_u_avx512f(lv_32fc_t* cVector,
+                                               const lv_32fc_t* aVector,
+                                               const lv_32fc_t* bVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* a = (const float*)aVector;
+    const float* b = (const float*)bVector;
+    float* c = (float*)cVector;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        const __m512 x = _mm512_loadu_ps(a);
+        const __m512 y = _mm512_loadu_ps(b);
+        _mm512_storeu_ps(c, _mm512_complexconjugatemul_ps(x, y));
+        a += 16;
+        b += 16;
+        c += 16;
+    }
+
+    // the last points with a masked load and store, two floats a point
+    const __mmask16 mask = _cvtu32_mask16((1u << (2 * (num_points & 7))) - 1);
+    const __m512 x = _mm512_maskz_loadu_ps(mask, a);
+    const __m512 y = _mm512_maskz_loadu_ps(mask, b);
+    _mm512_mask_storeu_ps(c, mask, _mm512_complexconjugatemul_ps(x, y));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 #include <volk/volk_avx_intrinsics.h>
@@ -178,6 +212,40 @@ static inline void volk_32fc_x2_multiply_conjugate_32fc_generic(lv_32fc_t* cVect
 #include <stdio.h>
 #include <volk/volk_complex.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_x2_multiply_conjugate_32fc_a_avx512f(lv_32fc_t* cVector,
+                                               const lv_32fc_t* aVector,
+                                               const lv_32fc_t* bVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float* a = (const float*)aVector;
+    const float* b = (const float*)bVector;
+    float* c = (float*)cVector;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        const __m512 x = _mm512_load_ps(a);
+        const __m512 y = _mm512_load_ps(b);
+        _mm512_store_ps(c, _mm512_complexconjugatemul_ps(x, y));
+        a += 16;
+        b += 16;
+        c += 16;
+    }
+
+    // the last points with a masked load and store, two floats a point
+    const __mmask16 mask = _cvtu32_mask16((1u << (2 * (num_points & 7))) - 1);
+    const __m512 x = _mm512_maskz_load_ps(mask, a);
+    const __m512 y = _mm512_maskz_load_ps(mask, b);
+    _mm512_mask_store_ps(c, mask, _mm512_complexconjugatemul_ps(x, y));
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 #include <volk/volk_avx_intrinsics.h>
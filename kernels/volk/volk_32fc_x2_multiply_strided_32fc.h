@@ -0,0 +1,209 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_multiply_strided_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies two complex vectors whose elements are spaced by a stride,
+ * such as one channel of an interleaved multi-channel buffer or a column
+ * of a row major matrix, and writes the products with a third stride.
+ * The strides are given in elements; a stride of 1 is a contiguous vector.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_multiply_strided_32fc(lv_32fc_t* cVector, const lv_32fc_t* aVector,
+ * const lv_32fc_t* bVector, unsigned int cStride, unsigned int aStride,
+ * unsigned int bStride, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li aVector: The first input vector.
+ * \li bVector: The second input vector.
+ * \li cStride: The distance in elements between two outputs.
+ * \li aStride: The distance in elements between two elements of aVector.
+ * \li bStride: The distance in elements between two elements of bVector.
+ * \li num_points: The number of products to compute.
+ *
+ * \b Outputs
+ * \li cVector: cVector[i * cStride] = aVector[i * aStride] * bVector[i * bStride].
+ *
+ * \b Example
+ * Apply a window to channel 1 of a four channel interleaved buffer in place.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* capture = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*4*N, alignment);
+ *   lv_32fc_t* window = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   volk_32fc_x2_multiply_strided_32fc(capture + 1, capture + 1, window, 4, 4, 1, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_multiply_strided_32fc_u_H
+#define INCLUDED_volk_32fc_x2_multiply_strided_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_multiply_strided_32fc_generic(lv_32fc_t* cVector,
+                                                              const lv_32fc_t* aVector,
+                                                              const lv_32fc_t* bVector,
+                                                              unsigned int cStride,
+                                                              unsigned int aStride,
+                                                              unsigned int bStride,
+                                                              unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        *cPtr = (*aPtr) * (*bPtr);
+        cPtr += cStride;
+        aPtr += aStride;
+        bPtr += bStride;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_multiply_strided_32fc_avx(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* aVector,
+                                                          const lv_32fc_t* bVector,
+                                                          unsigned int cStride,
+                                                          unsigned int aStride,
+                                                          unsigned int bStride,
+                                                          unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+
+    // a complex sample is one 64 bit lane, gathered and scattered two per half
+    for (; number < quarterPoints; number++) {
+        __m128d lo, hi;
+        lo = _mm_loadh_pd(_mm_load_sd((const double*)aPtr),
+                          (const double*)(aPtr + aStride));
+        hi = _mm_loadh_pd(_mm_load_sd((const double*)(aPtr + 2 * aStride)),
+                          (const double*)(aPtr + 3 * aStride));
+        const __m256 a =
+            _mm256_castpd_ps(_mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1));
+        lo = _mm_loadh_pd(_mm_load_sd((const double*)bPtr),
+                          (const double*)(bPtr + bStride));
+        hi = _mm_loadh_pd(_mm_load_sd((const double*)(bPtr + 2 * bStride)),
+                          (const double*)(bPtr + 3 * bStride));
+        const __m256 b =
+            _mm256_castpd_ps(_mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1));
+
+        const __m256d c = _mm256_castps_pd(_mm256_complexmul_ps(a, b));
+        lo = _mm256_castpd256_pd128(c);
+        hi = _mm256_extractf128_pd(c, 1);
+        _mm_storel_pd((double*)cPtr, lo);
+        _mm_storeh_pd((double*)(cPtr + cStride), lo);
+        _mm_storel_pd((double*)(cPtr + 2 * cStride), hi);
+        _mm_storeh_pd((double*)(cPtr + 3 * cStride), hi);
+
+        aPtr += 4 * aStride;
+        bPtr += 4 * bStride;
+        cPtr += 4 * cStride;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *cPtr = (*aPtr) * (*bPtr);
+        cPtr += cStride;
+        aPtr += aStride;
+        bPtr += bStride;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_x2_multiply_strided_32fc_neon(lv_32fc_t* cVector,
+                                                           const lv_32fc_t* aVector,
+                                                           const lv_32fc_t* bVector,
+                                                           unsigned int cStride,
+                                                           unsigned int aStride,
+                                                           unsigned int bStride,
+                                                           unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+
+    for (; number < quarterPoints; number++) {
+        // gather four samples, then split them into real and imag parts
+        const float32x4_t a01 = vcombine_f32(vld1_f32((const float*)aPtr),
+                                             vld1_f32((const float*)(aPtr + aStride)));
+        const float32x4_t a23 =
+            vcombine_f32(vld1_f32((const float*)(aPtr + 2 * aStride)),
+                         vld1_f32((const float*)(aPtr + 3 * aStride)));
+        const float32x4_t b01 = vcombine_f32(vld1_f32((const float*)bPtr),
+                                             vld1_f32((const float*)(bPtr + bStride)));
+        const float32x4_t b23 =
+            vcombine_f32(vld1_f32((const float*)(bPtr + 2 * bStride)),
+                         vld1_f32((const float*)(bPtr + 3 * bStride)));
+
+        const float32x4x2_t product =
+            _vmultiply_complexq_f32(vuzpq_f32(a01, a23), vuzpq_f32(b01, b23));
+        const float32x4x2_t c = vzipq_f32(product.val[0], product.val[1]);
+        vst1_f32((float*)cPtr, vget_low_f32(c.val[0]));
+        vst1_f32((float*)(cPtr + cStride), vget_high_f32(c.val[0]));
+        vst1_f32((float*)(cPtr + 2 * cStride), vget_low_f32(c.val[1]));
+        vst1_f32((float*)(cPtr + 3 * cStride), vget_high_f32(c.val[1]));
+
+        aPtr += 4 * aStride;
+        bPtr += 4 * bStride;
+        cPtr += 4 * cStride;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *cPtr = (*aPtr) * (*bPtr);
+        cPtr += cStride;
+        aPtr += aStride;
+        bPtr += bStride;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_multiply_strided_32fc_u_H */
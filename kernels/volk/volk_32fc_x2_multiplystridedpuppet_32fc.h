@@ -0,0 +1,49 @@
+#ifndef INCLUDED_VOLK_32FC_X2_MULTIPLYSTRIDEDPUPPET_32FC_H
+#define INCLUDED_VOLK_32FC_X2_MULTIPLYSTRIDEDPUPPET_32FC_H
+
+#include <volk/volk_32fc_x2_multiply_strided_32fc.h>
+
+/* Fills the even outputs from strided a and contiguous b, and the odd
+ * outputs from contiguous a and strided b. */
+#define VOLK_32FC_X2_MULTIPLYSTRIDEDPUPPET(impl)                              \
+    const unsigned int half = num_points / 2;                                \
+    impl(cVector, aVector, bVector, 2, 2, 1, half);                          \
+    impl(cVector + 1, aVector, bVector + 1, 2, 1, 2, half);                  \
+    if (num_points & 1) {                                                    \
+        cVector[half * 2] = aVector[half * 2] * bVector[half * 2];            \
+    }
+
+#ifdef LV_HAVE_GENERIC
+static inline void
+volk_32fc_x2_multiplystridedpuppet_32fc_generic(lv_32fc_t* cVector,
+                                                const lv_32fc_t* aVector,
+                                                const lv_32fc_t* bVector,
+                                                unsigned int num_points)
+{
+    VOLK_32FC_X2_MULTIPLYSTRIDEDPUPPET(volk_32fc_x2_multiply_strided_32fc_generic);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+static inline void
+volk_32fc_x2_multiplystridedpuppet_32fc_avx(lv_32fc_t* cVector,
+                                            const lv_32fc_t* aVector,
+                                            const lv_32fc_t* bVector,
+                                            unsigned int num_points)
+{
+    VOLK_32FC_X2_MULTIPLYSTRIDEDPUPPET(volk_32fc_x2_multiply_strided_32fc_avx);
+}
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+static inline void
+volk_32fc_x2_multiplystridedpuppet_32fc_neon(lv_32fc_t* cVector,
+                                             const lv_32fc_t* aVector,
+                                             const lv_32fc_t* bVector,
+                                             unsigned int num_points)
+{
+    VOLK_32FC_X2_MULTIPLYSTRIDEDPUPPET(volk_32fc_x2_multiply_strided_32fc_neon);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_VOLK_32FC_X2_MULTIPLYSTRIDEDPUPPET_32FC_H */
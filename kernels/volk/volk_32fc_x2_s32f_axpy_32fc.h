@@ -0,0 +1,169 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_s32f_axpy_32fc
+ *
+ * \b Overview
+ *
+ * Scales a complex vector by a real scalar and adds another one:
+ *
+ * cVector[i] = alpha * xVector[i] + yVector[i]
+ *
+ * alpha is real, unlike the complex alpha of volk_32fc_x2_s32fc_axpy_32fc
+ * and the complex alpha and beta of volk_32fc_x2_s32fc_x2_axpby_32fc. The
+ * kernel is volk_32f_x2_s32f_axpy_32f over the interleaved real and
+ * imaginary parts.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_s32f_axpy_32fc(lv_32fc_t* cVector, const lv_32fc_t* xVector,
+ * const lv_32fc_t* yVector, const float alpha, unsigned int num_points); \endcode
+ *
+ * \b Inputs
+ * \li xVector: The vector to scale.
+ * \li yVector: The vector to add.
+ * \li alpha: The real scale of xVector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li cVector: The output vector, may be xVector or yVector.
+ *
+ * \b Example
+ * Add scaled noise to a signal.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* x = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* y = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   // ... fill x and y
+ *
+ *   volk_32fc_x2_s32f_axpy_32fc(y, x, y, 0.01f, N);
+ *
+ *   volk_free(x);
+ *   volk_free(y);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_s32f_axpy_32fc_H
+#define INCLUDED_volk_32fc_x2_s32f_axpy_32fc_H
+
+#include <volk/volk_32f_x2_s32f_axpy_32f.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_x2_s32f_axpy_32fc_generic(lv_32fc_t* cVector,
+                                                       const lv_32fc_t* xVector,
+                                                       const lv_32fc_t* yVector,
+                                                       const float alpha,
+                                                       unsigned int num_points)
+{
+    volk_32f_x2_s32f_axpy_32f_generic((float*)cVector,
+                                      (const float*)xVector,
+                                      (const float*)yVector,
+                                      alpha,
+                                      2 * num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_32fc_x2_s32f_axpy_32fc_a_avx2_fma(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* xVector,
+                                                          const lv_32fc_t* yVector,
+                                                          const float alpha,
+                                                          unsigned int num_points)
+{
+    volk_32f_x2_s32f_axpy_32f_a_avx2_fma((float*)cVector,
+                                         (const float*)xVector,
+                                         (const float*)yVector,
+                                         alpha,
+                                         2 * num_points);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_32fc_x2_s32f_axpy_32fc_u_avx2_fma(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* xVector,
+                                                          const lv_32fc_t* yVector,
+                                                          const float alpha,
+                                                          unsigned int num_points)
+{
+    volk_32f_x2_s32f_axpy_32f_u_avx2_fma((float*)cVector,
+                                         (const float*)xVector,
+                                         (const float*)yVector,
+                                         alpha,
+                                         2 * num_points);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32fc_x2_s32f_axpy_32fc_a_avx512f(lv_32fc_t* cVector,
+                                                         const lv_32fc_t* xVector,
+                                                         const lv_32fc_t* yVector,
+                                                         const float alpha,
+                                                         unsigned int num_points)
+{
+    volk_32f_x2_s32f_axpy_32f_a_avx512f((float*)cVector,
+                                        (const float*)xVector,
+                                        (const float*)yVector,
+                                        alpha,
+                                        2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32fc_x2_s32f_axpy_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                         const lv_32fc_t* xVector,
+                                                         const lv_32fc_t* yVector,
+                                                         const float alpha,
+                                                         unsigned int num_points)
+{
+    volk_32f_x2_s32f_axpy_32f_u_avx512f((float*)cVector,
+                                        (const float*)xVector,
+                                        (const float*)yVector,
+                                        alpha,
+                                        2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+static inline void volk_32fc_x2_s32f_axpy_32fc_neonv8(lv_32fc_t* cVector,
+                                                      const lv_32fc_t* xVector,
+                                                      const lv_32fc_t* yVector,
+                                                      const float alpha,
+                                                      unsigned int num_points)
+{
+    volk_32f_x2_s32f_axpy_32f_neonv8((float*)cVector,
+                                     (const float*)xVector,
+                                     (const float*)yVector,
+                                     alpha,
+                                     2 * num_points);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_s32f_axpy_32fc_H */
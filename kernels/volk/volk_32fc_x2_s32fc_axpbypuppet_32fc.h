@@ -0,0 +1,107 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_x2_s32fc_x2_axpby_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_s32fc_axpbypuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_s32fc_axpbypuppet_32fc_H
+
+#include <volk/volk_32fc_x2_s32fc_x2_axpby_32fc.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_x2_s32fc_axpbypuppet_32fc_generic(lv_32fc_t* cVector,
+                                                               const lv_32fc_t* xVector,
+                                                               const lv_32fc_t* yVector,
+                                                               const lv_32fc_t alpha,
+                                                               unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_x2_axpby_32fc_generic(
+        cVector, xVector, yVector, alpha, lv_cmake(1.0f, 0.0f) - alpha, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void
+volk_32fc_x2_s32fc_axpbypuppet_32fc_a_avx2_fma(lv_32fc_t* cVector,
+                                               const lv_32fc_t* xVector,
+                                               const lv_32fc_t* yVector,
+                                               const lv_32fc_t alpha,
+                                               unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_x2_axpby_32fc_a_avx2_fma(
+        cVector, xVector, yVector, alpha, lv_cmake(1.0f, 0.0f) - alpha, num_points);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void
+volk_32fc_x2_s32fc_axpbypuppet_32fc_u_avx2_fma(lv_32fc_t* cVector,
+                                               const lv_32fc_t* xVector,
+                                               const lv_32fc_t* yVector,
+                                               const lv_32fc_t alpha,
+                                               unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_x2_axpby_32fc_u_avx2_fma(
+        cVector, xVector, yVector, alpha, lv_cmake(1.0f, 0.0f) - alpha, num_points);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32fc_x2_s32fc_axpbypuppet_32fc_a_avx512f(lv_32fc_t* cVector,
+                                                                 const lv_32fc_t* xVector,
+                                                                 const lv_32fc_t* yVector,
+                                                                 const lv_32fc_t alpha,
+                                                                 unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_x2_axpby_32fc_a_avx512f(
+        cVector, xVector, yVector, alpha, lv_cmake(1.0f, 0.0f) - alpha, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32fc_x2_s32fc_axpbypuppet_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                                 const lv_32fc_t* xVector,
+                                                                 const lv_32fc_t* yVector,
+                                                                 const lv_32fc_t alpha,
+                                                                 unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_x2_axpby_32fc_u_avx512f(
+        cVector, xVector, yVector, alpha, lv_cmake(1.0f, 0.0f) - alpha, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+static inline void volk_32fc_x2_s32fc_axpbypuppet_32fc_neonv8(lv_32fc_t* cVector,
+                                                              const lv_32fc_t* xVector,
+                                                              const lv_32fc_t* yVector,
+                                                              const lv_32fc_t alpha,
+                                                              unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_x2_axpby_32fc_neonv8(
+        cVector, xVector, yVector, alpha, lv_cmake(1.0f, 0.0f) - alpha, num_points);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_s32fc_axpbypuppet_32fc_H */
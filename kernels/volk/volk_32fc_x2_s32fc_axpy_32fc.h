@@ -0,0 +1,257 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_s32fc_axpy_32fc
+ *
+ * \b Overview
+ *
+ * Scales a complex vector by a complex scalar and adds another one:
+ *
+ * cVector[i] = alpha * xVector[i] + yVector[i]
+ *
+ * The SIMD versions form the complex product from xVector and its swapped
+ * real and imaginary parts, with two fused multiply-adds onto yVector. For
+ * a real alpha, volk_32fc_x2_s32f_axpy_32fc saves the second one.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_s32fc_axpy_32fc(lv_32fc_t* cVector, const lv_32fc_t* xVector,
+ * const lv_32fc_t* yVector, const lv_32fc_t alpha, unsigned int num_points); \endcode
+ *
+ * \b Inputs
+ * \li xVector: The vector to scale.
+ * \li yVector: The vector to add.
+ * \li alpha: The complex scale of xVector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li cVector: The output vector, may be xVector or yVector.
+ *
+ * \b Example
+ * Mix an interferer with a phase and gain into a signal.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* x = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* y = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   // ... fill x and y
+ *
+ *   volk_32fc_x2_s32fc_axpy_32fc(y, x, y, lv_cmake(0.3f, -0.4f), N);
+ *
+ *   volk_free(x);
+ *   volk_free(y);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_s32fc_axpy_32fc_H
+#define INCLUDED_volk_32fc_x2_s32fc_axpy_32fc_H
+
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_x2_s32fc_axpy_32fc_generic(lv_32fc_t* cVector,
+                                                        const lv_32fc_t* xVector,
+                                                        const lv_32fc_t* yVector,
+                                                        const lv_32fc_t alpha,
+                                                        unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_s32fc_axpy_32fc_a_avx2_fma(lv_32fc_t* cVector,
+                                                           const lv_32fc_t* xVector,
+                                                           const lv_32fc_t* yVector,
+                                                           const lv_32fc_t alpha,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    // alpha * x = x * (ar, ar) + swap(x) * (-ai, ai)
+    const __m256 ar = _mm256_set1_ps(lv_creal(alpha));
+    const float alphaImag = lv_cimag(alpha);
+    const __m256 ai = _mm256_setr_ps(-alphaImag,
+                                     alphaImag,
+                                     -alphaImag,
+                                     alphaImag,
+                                     -alphaImag,
+                                     alphaImag,
+                                     -alphaImag,
+                                     alphaImag);
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m256 x = _mm256_load_ps((const float*)(xVector + 4 * number));
+        const __m256 y = _mm256_load_ps((const float*)(yVector + 4 * number));
+        __m256 c = _mm256_fmadd_ps(x, ar, y);
+        c = _mm256_fmadd_ps(_mm256_permute_ps(x, 0xb1), ai, c);
+        _mm256_store_ps((float*)(cVector + 4 * number), c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_s32fc_axpy_32fc_u_avx2_fma(lv_32fc_t* cVector,
+                                                           const lv_32fc_t* xVector,
+                                                           const lv_32fc_t* yVector,
+                                                           const lv_32fc_t alpha,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    // alpha * x = x * (ar, ar) + swap(x) * (-ai, ai)
+    const __m256 ar = _mm256_set1_ps(lv_creal(alpha));
+    const float alphaImag = lv_cimag(alpha);
+    const __m256 ai = _mm256_setr_ps(-alphaImag,
+                                     alphaImag,
+                                     -alphaImag,
+                                     alphaImag,
+                                     -alphaImag,
+                                     alphaImag,
+                                     -alphaImag,
+                                     alphaImag);
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m256 x = _mm256_loadu_ps((const float*)(xVector + 4 * number));
+        const __m256 y = _mm256_loadu_ps((const float*)(yVector + 4 * number));
+        __m256 c = _mm256_fmadd_ps(x, ar, y);
+        c = _mm256_fmadd_ps(_mm256_permute_ps(x, 0xb1), ai, c);
+        _mm256_storeu_ps((float*)(cVector + 4 * number), c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_s32fc_axpy_32fc_a_avx512f(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* xVector,
+                                                          const lv_32fc_t* yVector,
+                                                          const lv_32fc_t alpha,
+                                                          unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    // alpha * x = x * (ar, ar) + swap(x) * (-ai, ai)
+    const __m512 ar = _mm512_set1_ps(lv_creal(alpha));
+    const float alphaImag = lv_cimag(alpha);
+    const __m512 ai = _mm512_setr4_ps(-alphaImag, alphaImag, -alphaImag, alphaImag);
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m512 x = _mm512_load_ps((const float*)(xVector + 8 * number));
+        const __m512 y = _mm512_load_ps((const float*)(yVector + 8 * number));
+        __m512 c = _mm512_fmadd_ps(x, ar, y);
+        c = _mm512_fmadd_ps(_mm512_permute_ps(x, 0xb1), ai, c);
+        _mm512_store_ps((float*)(cVector + 8 * number), c);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_s32fc_axpy_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* xVector,
+                                                          const lv_32fc_t* yVector,
+                                                          const lv_32fc_t alpha,
+                                                          unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    // alpha * x = x * (ar, ar) + swap(x) * (-ai, ai)
+    const __m512 ar = _mm512_set1_ps(lv_creal(alpha));
+    const float alphaImag = lv_cimag(alpha);
+    const __m512 ai = _mm512_setr4_ps(-alphaImag, alphaImag, -alphaImag, alphaImag);
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m512 x = _mm512_loadu_ps((const float*)(xVector + 8 * number));
+        const __m512 y = _mm512_loadu_ps((const float*)(yVector + 8 * number));
+        __m512 c = _mm512_fmadd_ps(x, ar, y);
+        c = _mm512_fmadd_ps(_mm512_permute_ps(x, 0xb1), ai, c);
+        _mm512_storeu_ps((float*)(cVector + 8 * number), c);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_s32fc_axpy_32fc_neonv8(lv_32fc_t* cVector,
+                                                       const lv_32fc_t* xVector,
+                                                       const lv_32fc_t* yVector,
+                                                       const lv_32fc_t alpha,
+                                                       unsigned int num_points)
+{
+    const unsigned int half_points = num_points / 2;
+    // alpha * x = x * (ar, ar) + swap(x) * (-ai, ai)
+    const float32x4_t ar = vdupq_n_f32(lv_creal(alpha));
+    const float alphaImag = lv_cimag(alpha);
+    const float ai_pairs[4] = { -alphaImag, alphaImag, -alphaImag, alphaImag };
+    const float32x4_t ai = vld1q_f32(ai_pairs);
+    unsigned int number;
+
+    for (number = 0; number < half_points; number++) {
+        const float32x4_t x = vld1q_f32((const float*)(xVector + 2 * number));
+        const float32x4_t y = vld1q_f32((const float*)(yVector + 2 * number));
+        float32x4_t c = vfmaq_f32(y, x, ar);
+        c = vfmaq_f32(c, vrev64q_f32(x), ai);
+        vst1q_f32((float*)(cVector + 2 * number), c);
+    }
+
+    for (number = 2 * half_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_s32fc_axpy_32fc_H */
@@ -0,0 +1,145 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_s32fc_lms_update_dot_prodpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_s32fc_lms_update_dot_prodpuppet_32fc_H
+
+#include <volk/volk.h>
+#include <volk/volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2.h>
+
+/* Updates the first num_points - 1 taps from the input one sample later than
+ * it filters, and stores the filter output after the updated taps. */
+static inline void
+volk_lms_update_dot_prod_puppet(void (*kernel)(lv_32fc_t*,
+                                               lv_32fc_t*,
+                                               const lv_32fc_t*,
+                                               const lv_32fc_t*,
+                                               const lv_32fc_t*,
+                                               const lv_32fc_t,
+                                               unsigned int),
+                                lv_32fc_t* outputTaps,
+                                const lv_32fc_t* taps,
+                                const lv_32fc_t* inputVector,
+                                const lv_32fc_t scalar,
+                                unsigned int num_points)
+{
+    if (num_points == 0) {
+        return;
+    }
+    kernel(outputTaps + num_points - 1,
+           outputTaps,
+           taps,
+           inputVector + 1,
+           inputVector,
+           scalar,
+           num_points - 1);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_s32fc_lms_update_dot_prodpuppet_32fc_generic(lv_32fc_t* outputTaps,
+                                                          const lv_32fc_t* taps,
+                                                          const lv_32fc_t* inputVector,
+                                                          const lv_32fc_t scalar,
+                                                          unsigned int num_points)
+{
+    volk_lms_update_dot_prod_puppet(
+        volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_generic,
+        outputTaps,
+        taps,
+        inputVector,
+        scalar,
+        num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_x2_s32fc_lms_update_dot_prodpuppet_32fc_u_avx2_fma(lv_32fc_t* outputTaps,
+                                                             const lv_32fc_t* taps,
+                                                             const lv_32fc_t* inputVector,
+                                                             const lv_32fc_t scalar,
+                                                             unsigned int num_points)
+{
+    volk_lms_update_dot_prod_puppet(
+        volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_u_avx2_fma,
+        outputTaps,
+        taps,
+        inputVector,
+        scalar,
+        num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_x2_s32fc_lms_update_dot_prodpuppet_32fc_u_avx512f(lv_32fc_t* outputTaps,
+                                                            const lv_32fc_t* taps,
+                                                            const lv_32fc_t* inputVector,
+                                                            const lv_32fc_t scalar,
+                                                            unsigned int num_points)
+{
+    volk_lms_update_dot_prod_puppet(
+        volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_u_avx512f,
+        outputTaps,
+        taps,
+        inputVector,
+        scalar,
+        num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void
+volk_32fc_x2_s32fc_lms_update_dot_prodpuppet_32fc_neonv8(lv_32fc_t* outputTaps,
+                                                         const lv_32fc_t* taps,
+                                                         const lv_32fc_t* inputVector,
+                                                         const lv_32fc_t scalar,
+                                                         unsigned int num_points)
+{
+    volk_lms_update_dot_prod_puppet(volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_neonv8,
+                                    outputTaps,
+                                    taps,
+                                    inputVector,
+                                    scalar,
+                                    num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_s32fc_lms_update_dot_prodpuppet_32fc_H */
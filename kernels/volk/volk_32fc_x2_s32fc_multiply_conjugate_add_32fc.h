@@ -303,6 +303,176 @@ volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_a_sse3(lv_32fc_t* cVector,
 #endif /* LV_HAVE_SSE */
 
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx2_fma(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* aVector,
+                                                          const lv_32fc_t* bVector,
+                                                          const lv_32fc_t scalar,
+                                                          unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const float scalarReal = lv_creal(scalar);
+    // conj(b) * s = b * (sr, -sr) + swap(b) * (si, si)
+    const __m256 sr = _mm256_setr_ps(scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal);
+    const __m256 si = _mm256_set1_ps(lv_cimag(scalar));
+    unsigned int number;
+    __m256 a, b;
+
+    for (number = 0; number < quarter_points; number++) {
+        a = _mm256_loadu_ps((const float*)(aVector + 4 * number));
+        b = _mm256_loadu_ps((const float*)(bVector + 4 * number));
+        a = _mm256_fmadd_ps(b, sr, a);
+        a = _mm256_fmadd_ps(_mm256_permute_ps(b, 0xb1), si, a);
+        _mm256_storeu_ps((float*)(cVector + 4 * number), a);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = aVector[number] + lv_conj(bVector[number]) * scalar;
+    }
+}
+
+// the loop of the _pf impls, a cache line of each stream per iteration and
+// the inputs prefetched distance bytes ahead, which helps where the hardware
+// prefetcher does not track the three streams
+static inline void volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_avx2_fma_prefetch(
+    lv_32fc_t* cVector,
+    const lv_32fc_t* aVector,
+    const lv_32fc_t* bVector,
+    const lv_32fc_t scalar,
+    unsigned int num_points,
+    const unsigned int distance)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const unsigned int ahead = distance / sizeof(lv_32fc_t);
+    const float scalarReal = lv_creal(scalar);
+    // conj(b) * s = b * (sr, -sr) + swap(b) * (si, si)
+    const __m256 sr = _mm256_setr_ps(scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal);
+    const __m256 si = _mm256_set1_ps(lv_cimag(scalar));
+    unsigned int number;
+    __m256 a0, a1, b0, b1;
+
+    for (number = 0; number < eighth_points; number++) {
+        const lv_32fc_t* a = aVector + 8 * number;
+        const lv_32fc_t* b = bVector + 8 * number;
+        _mm_prefetch((const char*)(a + ahead), _MM_HINT_T0);
+        _mm_prefetch((const char*)(b + ahead), _MM_HINT_T0);
+        a0 = _mm256_loadu_ps((const float*)a);
+        a1 = _mm256_loadu_ps((const float*)(a + 4));
+        b0 = _mm256_loadu_ps((const float*)b);
+        b1 = _mm256_loadu_ps((const float*)(b + 4));
+        a0 = _mm256_fmadd_ps(b0, sr, a0);
+        a1 = _mm256_fmadd_ps(b1, sr, a1);
+        a0 = _mm256_fmadd_ps(_mm256_permute_ps(b0, 0xb1), si, a0);
+        a1 = _mm256_fmadd_ps(_mm256_permute_ps(b1, 0xb1), si, a1);
+        _mm256_storeu_ps((float*)(cVector + 8 * number), a0);
+        _mm256_storeu_ps((float*)(cVector + 8 * number + 4), a1);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = aVector[number] + lv_conj(bVector[number]) * scalar;
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx2_fma_pf256(lv_32fc_t* cVector,
+                                                                const lv_32fc_t* aVector,
+                                                                const lv_32fc_t* bVector,
+                                                                const lv_32fc_t scalar,
+                                                                unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_avx2_fma_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 256);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx2_fma_pf1024(lv_32fc_t* cVector,
+                                                                 const lv_32fc_t* aVector,
+                                                                 const lv_32fc_t* bVector,
+                                                                 const lv_32fc_t scalar,
+                                                                 unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_avx2_fma_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 1024);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx2_fma_pf4096(lv_32fc_t* cVector,
+                                                                 const lv_32fc_t* aVector,
+                                                                 const lv_32fc_t* bVector,
+                                                                 const lv_32fc_t scalar,
+                                                                 unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_avx2_fma_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 4096);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                         const lv_32fc_t* aVector,
+                                                         const lv_32fc_t* bVector,
+                                                         const lv_32fc_t scalar,
+                                                         unsigned int num_points)
+{
+    const float scalarReal = lv_creal(scalar);
+    // conj(b) * s = b * (sr, -sr) + swap(b) * (si, si)
+    const __m512 sr = _mm512_mask_blend_ps(
+        0xaaaa, _mm512_set1_ps(scalarReal), _mm512_set1_ps(-scalarReal));
+    const __m512 si = _mm512_set1_ps(lv_cimag(scalar));
+    unsigned int number;
+    __mmask16 mask = 0xffff;
+    __m512 a, b;
+
+    for (number = 0; number < num_points; number += 8) {
+        if (num_points - number < 8) {
+            mask = (__mmask16)((1u << (2 * (num_points - number))) - 1);
+        }
+        a = _mm512_maskz_loadu_ps(mask, (const float*)(aVector + number));
+        b = _mm512_maskz_loadu_ps(mask, (const float*)(bVector + number));
+        a = _mm512_fmadd_ps(b, sr, a);
+        a = _mm512_fmadd_ps(_mm512_permute_ps(b, 0xb1), si, a);
+        _mm512_mask_storeu_ps((float*)(cVector + number), mask, a);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
 
@@ -354,4 +524,127 @@ volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neon(lv_32fc_t* cVector,
 }
 #endif /* LV_HAVE_NEON */
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neonv8(lv_32fc_t* cVector,
+                                                      const lv_32fc_t* aVector,
+                                                      const lv_32fc_t* bVector,
+                                                      const lv_32fc_t scalar,
+                                                      unsigned int num_points)
+{
+    const unsigned int half_points = num_points / 2;
+    // conj(b) * s = b * (sr, -sr) + swap(b) * (si, si)
+    const float srValues[4] = {
+        lv_creal(scalar), -lv_creal(scalar), lv_creal(scalar), -lv_creal(scalar)
+    };
+    const float32x4_t sr = vld1q_f32(srValues);
+    const float32x4_t si = vdupq_n_f32(lv_cimag(scalar));
+    unsigned int number;
+    float32x4_t a, b;
+
+    for (number = 0; number < half_points; number++) {
+        a = vld1q_f32((const float*)(aVector + 2 * number));
+        b = vld1q_f32((const float*)(bVector + 2 * number));
+        a = vfmaq_f32(a, b, sr);
+        a = vfmaq_f32(a, vrev64q_f32(b), si);
+        vst1q_f32((float*)(cVector + 2 * number), a);
+    }
+
+    if (num_points & 1) {
+        cVector[num_points - 1] =
+            aVector[num_points - 1] + lv_conj(bVector[num_points - 1]) * scalar;
+    }
+}
+
+// the loop of the _pf impls, a cache line of each stream per iteration and
+// the inputs prefetched distance bytes ahead
+static inline void volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neonv8_prefetch(
+    lv_32fc_t* cVector,
+    const lv_32fc_t* aVector,
+    const lv_32fc_t* bVector,
+    const lv_32fc_t scalar,
+    unsigned int num_points,
+    const unsigned int distance)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const unsigned int ahead = distance / sizeof(lv_32fc_t);
+    // conj(b) * s = b * (sr, -sr) + swap(b) * (si, si)
+    const float srValues[4] = {
+        lv_creal(scalar), -lv_creal(scalar), lv_creal(scalar), -lv_creal(scalar)
+    };
+    const float32x4_t sr = vld1q_f32(srValues);
+    const float32x4_t si = vdupq_n_f32(lv_cimag(scalar));
+    unsigned int number, i;
+    float32x4_t a, b;
+
+    for (number = 0; number < eighth_points; number++) {
+        const lv_32fc_t* aPtr = aVector + 8 * number;
+        const lv_32fc_t* bPtr = bVector + 8 * number;
+        __VOLK_PREFETCH(aPtr + ahead);
+        __VOLK_PREFETCH(bPtr + ahead);
+        for (i = 0; i < 8; i += 2) {
+            a = vld1q_f32((const float*)(aPtr + i));
+            b = vld1q_f32((const float*)(bPtr + i));
+            a = vfmaq_f32(a, b, sr);
+            a = vfmaq_f32(a, vrev64q_f32(b), si);
+            vst1q_f32((float*)(cVector + 8 * number + i), a);
+        }
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = aVector[number] + lv_conj(bVector[number]) * scalar;
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neonv8_pf256(lv_32fc_t* cVector,
+                                                            const lv_32fc_t* aVector,
+                                                            const lv_32fc_t* bVector,
+                                                            const lv_32fc_t scalar,
+                                                            unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neonv8_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 256);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neonv8_pf1024(lv_32fc_t* cVector,
+                                                             const lv_32fc_t* aVector,
+                                                             const lv_32fc_t* bVector,
+                                                             const lv_32fc_t scalar,
+                                                             unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neonv8_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 1024);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neonv8_pf4096(lv_32fc_t* cVector,
+                                                             const lv_32fc_t* aVector,
+                                                             const lv_32fc_t* bVector,
+                                                             const lv_32fc_t scalar,
+                                                             unsigned int num_points)
+{
+    volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_neonv8_prefetch(
+        cVector, aVector, bVector, scalar, num_points, 4096);
+}
+#endif /* LV_HAVE_NEONV8 */
+
 #endif /* INCLUDED_volk_32fc_x2_s32fc_multiply_conjugate_add_32fc_H */
@@ -0,0 +1,281 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2
+ *
+ * \b Overview
+ *
+ * Interpolates linearly between points at a regular spacing, as
+ * volk_32fc_s32u_interp_linear_32fc does, and multiplies the input by the
+ * conjugate of the result in the same pass, e.g. to estimate the channel of
+ * an OFDM symbol from its pilots and equalise the symbol with it:
+ *
+ * channelVector[n] = pilots[k] + (pilots[k + 1] - pilots[k]) * j / spacing,
+ * with k = n / spacing and j = n % spacing
+ *
+ * outputVector[n] = inputVector[n] * conj(channelVector[n])
+ *
+ * Dividing the result by the squared magnitude of the channel completes a
+ * zero forcing equaliser; for soft decisions it is often left as it is.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2(lv_32fc_t*
+ * channelVector, lv_32fc_t* outputVector, const lv_32fc_t* pilots, const lv_32fc_t*
+ * inputVector, const unsigned int spacing, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li pilots: The (num_points + spacing - 1) / spacing + 1 points to
+ * interpolate between, at the points 0, spacing, 2 * spacing and so on.
+ * \li inputVector: The points to equalise.
+ * \li spacing: The number of points from one pilot to the next, at least 1.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li channelVector: The interpolated points.
+ * \li outputVector: The input multiplied by their conjugates.
+ *
+ * \b Example
+ * Estimate the channel over 300 subcarriers from pilots every 6 of them and
+ * equalise the symbol.
+ * \code
+ *   unsigned int N = 300;
+ *   unsigned int spacing = 6;
+ *   unsigned int num_pilots = (N + spacing - 1) / spacing + 1;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* pilots =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*num_pilots, alignment);
+ *   lv_32fc_t* symbol = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* channel = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* equalised = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < num_pilots; ++ii){
+ *       pilots[ii] = lv_cmake(cosf(0.3f * ii), sinf(0.3f * ii));
+ *   }
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       symbol[ii] = lv_cmake(cosf(0.05f * ii), sinf(0.05f * ii));
+ *   }
+ *
+ *   volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2(
+ *       channel, equalised, pilots, symbol, spacing, N);
+ *
+ *   volk_free(pilots);
+ *   volk_free(symbol);
+ *   volk_free(channel);
+ *   volk_free(equalised);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_H
+#define INCLUDED_volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_H
+
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_generic(
+    lv_32fc_t* channelVector,
+    lv_32fc_t* outputVector,
+    const lv_32fc_t* pilots,
+    const lv_32fc_t* inputVector,
+    const unsigned int spacing,
+    unsigned int num_points)
+{
+    const float scale = 1.f / (float)spacing;
+    unsigned int number, k = 0, j = 0;
+    lv_32fc_t channel;
+
+    for (number = 0; number < num_points; number++) {
+        channel = pilots[k] + (pilots[k + 1] - pilots[k]) * ((float)j * scale);
+        channelVector[number] = channel;
+        outputVector[number] = inputVector[number] * lv_conj(channel);
+        if (++j == spacing) {
+            j = 0;
+            k++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_u_avx2(
+    lv_32fc_t* channelVector,
+    lv_32fc_t* outputVector,
+    const lv_32fc_t* pilots,
+    const lv_32fc_t* inputVector,
+    const unsigned int spacing,
+    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float scale = 1.f / (float)spacing;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256i duplicate = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+    // a complex point moves as a double
+    const double* p = (const double*)pilots;
+    // the pilot index and offset of each lane, and their step over 4 points
+    __m128i k = _mm_set_epi32(3 / spacing, 2 / spacing, 1 / spacing, 0);
+    __m128i j = _mm_set_epi32(3 % spacing, 2 % spacing, 1 % spacing, 0);
+    const __m128i kStep = _mm_set1_epi32((int)(4 / spacing));
+    const __m128i jStep = _mm_set1_epi32((int)(4 % spacing));
+    const __m128i last = _mm_set1_epi32((int)spacing - 1);
+    const __m128i vspacing = _mm_set1_epi32((int)spacing);
+    const __m128i one = _mm_set1_epi32(1);
+    unsigned int number, kTail, jTail;
+    __m128i wrap;
+    __m256 p0, p1, weight, channel;
+    lv_32fc_t estimate;
+
+    for (number = 0; number < quarterPoints; number++) {
+        p0 = _mm256_castpd_ps(_mm256_i32gather_pd(p, k, 8));
+        p1 = _mm256_castpd_ps(_mm256_i32gather_pd(p, _mm_add_epi32(k, one), 8));
+        weight = _mm256_mul_ps(
+            _mm256_permutevar8x32_ps(_mm256_castps128_ps256(_mm_cvtepi32_ps(j)),
+                                     duplicate),
+            vscale);
+        channel = _mm256_add_ps(p0, _mm256_mul_ps(_mm256_sub_ps(p1, p0), weight));
+        _mm256_storeu_ps((float*)channelVector, channel);
+        _mm256_storeu_ps(
+            (float*)outputVector,
+            _mm256_complexconjugatemul_ps(_mm256_loadu_ps((const float*)inputVector),
+                                          channel));
+        channelVector += 4;
+        outputVector += 4;
+        inputVector += 4;
+
+        j = _mm_add_epi32(j, jStep);
+        k = _mm_add_epi32(k, kStep);
+        wrap = _mm_cmpgt_epi32(j, last);
+        j = _mm_sub_epi32(j, _mm_and_si128(wrap, vspacing));
+        k = _mm_sub_epi32(k, wrap);
+    }
+
+    kTail = (quarterPoints * 4) / spacing;
+    jTail = (quarterPoints * 4) % spacing;
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        estimate = pilots[kTail] +
+                   (pilots[kTail + 1] - pilots[kTail]) * ((float)jTail * scale);
+        *channelVector++ = estimate;
+        *outputVector++ = (*inputVector++) * lv_conj(estimate);
+        if (++jTail == spacing) {
+            jTail = 0;
+            kTail++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_u_avx512f(
+    lv_32fc_t* channelVector,
+    lv_32fc_t* outputVector,
+    const lv_32fc_t* pilots,
+    const lv_32fc_t* inputVector,
+    const unsigned int spacing,
+    unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float scale = 1.f / (float)spacing;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512i duplicate =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    // a complex point moves as a double
+    const double* p = (const double*)pilots;
+    // the pilot index and offset of each lane, and their step over 8 points
+    __m256i k = _mm256_set_epi32(7 / spacing,
+                                 6 / spacing,
+                                 5 / spacing,
+                                 4 / spacing,
+                                 3 / spacing,
+                                 2 / spacing,
+                                 1 / spacing,
+                                 0);
+    __m256i j = _mm256_set_epi32(7 % spacing,
+                                 6 % spacing,
+                                 5 % spacing,
+                                 4 % spacing,
+                                 3 % spacing,
+                                 2 % spacing,
+                                 1 % spacing,
+                                 0);
+    const __m256i kStep = _mm256_set1_epi32((int)(8 / spacing));
+    const __m256i jStep = _mm256_set1_epi32((int)(8 % spacing));
+    const __m256i last = _mm256_set1_epi32((int)spacing - 1);
+    const __m256i vspacing = _mm256_set1_epi32((int)spacing);
+    const __m256i one = _mm256_set1_epi32(1);
+    unsigned int number, kTail, jTail;
+    __m256i wrap;
+    __m512 p0, p1, weight, channel;
+    lv_32fc_t estimate;
+
+    for (number = 0; number < eighthPoints; number++) {
+        p0 = _mm512_castpd_ps(_mm512_i32gather_pd(k, p, 8));
+        p1 = _mm512_castpd_ps(_mm512_i32gather_pd(_mm256_add_epi32(k, one), p, 8));
+        weight = _mm512_mul_ps(
+            _mm512_permutexvar_ps(duplicate,
+                                  _mm512_castps256_ps512(_mm256_cvtepi32_ps(j))),
+            vscale);
+        channel = _mm512_add_ps(p0, _mm512_mul_ps(_mm512_sub_ps(p1, p0), weight));
+        _mm512_storeu_ps((float*)channelVector, channel);
+        _mm512_storeu_ps(
+            (float*)outputVector,
+            _mm512_complexconjugatemul_ps(_mm512_loadu_ps((const float*)inputVector),
+                                          channel));
+        channelVector += 8;
+        outputVector += 8;
+        inputVector += 8;
+
+        j = _mm256_add_epi32(j, jStep);
+        k = _mm256_add_epi32(k, kStep);
+        wrap = _mm256_cmpgt_epi32(j, last);
+        j = _mm256_sub_epi32(j, _mm256_and_si256(wrap, vspacing));
+        k = _mm256_sub_epi32(k, wrap);
+    }
+
+    kTail = (eighthPoints * 8) / spacing;
+    jTail = (eighthPoints * 8) % spacing;
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        estimate = pilots[kTail] +
+                   (pilots[kTail + 1] - pilots[kTail]) * ((float)jTail * scale);
+        *channelVector++ = estimate;
+        *outputVector++ = (*inputVector++) * lv_conj(estimate);
+        if (++jTail == spacing) {
+            jTail = 0;
+            kTail++;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2_H */
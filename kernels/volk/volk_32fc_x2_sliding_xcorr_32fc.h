@@ -0,0 +1,291 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_sliding_xcorr_32fc
+ *
+ * \b Overview
+ *
+ * Correlates a reference, such as a preamble, with a stream at num_points
+ * consecutive lags:
+ *
+ * out[k] = sum over j < referenceLength of in[k + j] * conj(reference[j])
+ *
+ * The input holds num_points + referenceLength - 1 samples. The SIMD versions
+ * keep the correlations of 16 or 32 consecutive lags in registers and take each
+ * reference sample once for all of them, where a dot product per lag would
+ * read the whole reference again for each.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_sliding_xcorr_32fc(lv_32fc_t* outputVector,
+ * const lv_32fc_t* inputVector, const lv_32fc_t* reference,
+ * unsigned int referenceLength, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The stream, num_points + referenceLength - 1 samples.
+ * \li reference: The reference.
+ * \li referenceLength: The number of samples of the reference.
+ * \li num_points: The number of lags.
+ *
+ * \b Outputs
+ * \li outputVector: The correlation at each lag.
+ *
+ * \b Example
+ * Correlate a 64 sample preamble with a block of 1024 samples.
+ * \code
+ *   volk_32fc_x2_sliding_xcorr_32fc(corr, samples, preamble, 64, 1024 - 64 + 1);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_sliding_xcorr_32fc_H
+#define INCLUDED_volk_32fc_x2_sliding_xcorr_32fc_H
+
+#include <volk/volk_complex.h>
+
+/* The correlation of the referenceLength samples from inputVector with the reference */
+static inline lv_32fc_t volk_xcorr_lag(const lv_32fc_t* inputVector,
+                                       const lv_32fc_t* reference,
+                                       unsigned int referenceLength)
+{
+    lv_32fc_t sum = lv_cmake(0.f, 0.f);
+    unsigned int number;
+
+    for (number = 0; number < referenceLength; number++) {
+        sum += inputVector[number] * lv_conj(reference[number]);
+    }
+    return sum;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_sliding_xcorr_32fc_generic(lv_32fc_t* outputVector,
+                                                           const lv_32fc_t* inputVector,
+                                                           const lv_32fc_t* reference,
+                                                           unsigned int referenceLength,
+                                                           unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] =
+            volk_xcorr_lag(inputVector + number, reference, referenceLength);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_sliding_xcorr_32fc_u_avx_fma(lv_32fc_t* outputVector,
+                                                             const lv_32fc_t* inputVector,
+                                                             const lv_32fc_t* reference,
+                                                             unsigned int referenceLength,
+                                                             unsigned int num_points)
+{
+    const __m256 negateReal = _mm256_setr_ps(-0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f);
+    __m256 real[4], cross[4], refReal, refImag, in;
+    const lv_32fc_t* window;
+    const float* refPtr;
+    unsigned int number = 0, step, i;
+
+    for (; number + 16 <= num_points; number += 16) {
+        for (i = 0; i < 4; i++) {
+            real[i] = _mm256_setzero_ps();
+            cross[i] = _mm256_setzero_ps();
+        }
+        refPtr = (const float*)reference;
+        window = inputVector + number;
+        for (step = 0; step < referenceLength; step++) {
+            // in times re(ref), and in times (-im(ref), im(ref)) to swap at the end
+            refReal = _mm256_broadcast_ss(refPtr);
+            refImag = _mm256_xor_ps(_mm256_broadcast_ss(refPtr + 1), negateReal);
+            for (i = 0; i < 4; i++) {
+                in = _mm256_loadu_ps((const float*)(window + 4 * i));
+                real[i] = _mm256_fmadd_ps(in, refReal, real[i]);
+                cross[i] = _mm256_fmadd_ps(in, refImag, cross[i]);
+            }
+            refPtr += 2;
+            window++;
+        }
+        for (i = 0; i < 4; i++) {
+            _mm256_storeu_ps((float*)(outputVector + number + 4 * i),
+                             _mm256_add_ps(real[i], _mm256_permute_ps(cross[i], 0xb1)));
+        }
+    }
+
+    for (; number + 4 <= num_points; number += 4) {
+        real[0] = _mm256_setzero_ps();
+        cross[0] = _mm256_setzero_ps();
+        refPtr = (const float*)reference;
+        window = inputVector + number;
+        for (step = 0; step < referenceLength; step++) {
+            refReal = _mm256_broadcast_ss(refPtr);
+            refImag = _mm256_xor_ps(_mm256_broadcast_ss(refPtr + 1), negateReal);
+            in = _mm256_loadu_ps((const float*)window);
+            real[0] = _mm256_fmadd_ps(in, refReal, real[0]);
+            cross[0] = _mm256_fmadd_ps(in, refImag, cross[0]);
+            refPtr += 2;
+            window++;
+        }
+        _mm256_storeu_ps((float*)(outputVector + number),
+                         _mm256_add_ps(real[0], _mm256_permute_ps(cross[0], 0xb1)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] =
+            volk_xcorr_lag(inputVector + number, reference, referenceLength);
+    }
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_x2_sliding_xcorr_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                          const lv_32fc_t* inputVector,
+                                          const lv_32fc_t* reference,
+                                          unsigned int referenceLength,
+                                          unsigned int num_points)
+{
+    const __m512 negateReal =
+        _mm512_mask_blend_ps(0xaaaa, _mm512_set1_ps(-1.f), _mm512_set1_ps(1.f));
+    __m512 real[4], cross[4], refReal, refImag, in;
+    const lv_32fc_t* window;
+    const float* refPtr;
+    unsigned int number = 0, step, i;
+
+    for (; number + 32 <= num_points; number += 32) {
+        for (i = 0; i < 4; i++) {
+            real[i] = _mm512_setzero_ps();
+            cross[i] = _mm512_setzero_ps();
+        }
+        refPtr = (const float*)reference;
+        window = inputVector + number;
+        for (step = 0; step < referenceLength; step++) {
+            // in times re(ref), and in times (-im(ref), im(ref)) to swap at the end
+            refReal = _mm512_set1_ps(refPtr[0]);
+            refImag = _mm512_mul_ps(_mm512_set1_ps(refPtr[1]), negateReal);
+            for (i = 0; i < 4; i++) {
+                in = _mm512_loadu_ps((const float*)(window + 8 * i));
+                real[i] = _mm512_fmadd_ps(in, refReal, real[i]);
+                cross[i] = _mm512_fmadd_ps(in, refImag, cross[i]);
+            }
+            refPtr += 2;
+            window++;
+        }
+        for (i = 0; i < 4; i++) {
+            _mm512_storeu_ps((float*)(outputVector + number + 8 * i),
+                             _mm512_add_ps(real[i], _mm512_permute_ps(cross[i], 0xb1)));
+        }
+    }
+
+    for (; number + 8 <= num_points; number += 8) {
+        real[0] = _mm512_setzero_ps();
+        cross[0] = _mm512_setzero_ps();
+        refPtr = (const float*)reference;
+        window = inputVector + number;
+        for (step = 0; step < referenceLength; step++) {
+            refReal = _mm512_set1_ps(refPtr[0]);
+            refImag = _mm512_mul_ps(_mm512_set1_ps(refPtr[1]), negateReal);
+            in = _mm512_loadu_ps((const float*)window);
+            real[0] = _mm512_fmadd_ps(in, refReal, real[0]);
+            cross[0] = _mm512_fmadd_ps(in, refImag, cross[0]);
+            refPtr += 2;
+            window++;
+        }
+        _mm512_storeu_ps((float*)(outputVector + number),
+                         _mm512_add_ps(real[0], _mm512_permute_ps(cross[0], 0xb1)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] =
+            volk_xcorr_lag(inputVector + number, reference, referenceLength);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_sliding_xcorr_32fc_neon(lv_32fc_t* outputVector,
+                                                        const lv_32fc_t* inputVector,
+                                                        const lv_32fc_t* reference,
+                                                        unsigned int referenceLength,
+                                                        unsigned int num_points)
+{
+    float32x4x2_t sum[4], in;
+    float refReal, refImag;
+    unsigned int number = 0, step, i;
+
+    for (; number + 16 <= num_points; number += 16) {
+        for (i = 0; i < 4; i++) {
+            sum[i].val[0] = vdupq_n_f32(0.f);
+            sum[i].val[1] = vdupq_n_f32(0.f);
+        }
+        for (step = 0; step < referenceLength; step++) {
+            refReal = lv_creal(reference[step]);
+            refImag = lv_cimag(reference[step]);
+            for (i = 0; i < 4; i++) {
+                in = vld2q_f32((const float*)(inputVector + number + step + 4 * i));
+                sum[i].val[0] = vmlaq_n_f32(sum[i].val[0], in.val[0], refReal);
+                sum[i].val[0] = vmlaq_n_f32(sum[i].val[0], in.val[1], refImag);
+                sum[i].val[1] = vmlaq_n_f32(sum[i].val[1], in.val[1], refReal);
+                sum[i].val[1] = vmlsq_n_f32(sum[i].val[1], in.val[0], refImag);
+            }
+        }
+        for (i = 0; i < 4; i++) {
+            vst2q_f32((float*)(outputVector + number + 4 * i), sum[i]);
+        }
+    }
+
+    for (; number + 4 <= num_points; number += 4) {
+        sum[0].val[0] = vdupq_n_f32(0.f);
+        sum[0].val[1] = vdupq_n_f32(0.f);
+        for (step = 0; step < referenceLength; step++) {
+            refReal = lv_creal(reference[step]);
+            refImag = lv_cimag(reference[step]);
+            in = vld2q_f32((const float*)(inputVector + number + step));
+            sum[0].val[0] = vmlaq_n_f32(sum[0].val[0], in.val[0], refReal);
+            sum[0].val[0] = vmlaq_n_f32(sum[0].val[0], in.val[1], refImag);
+            sum[0].val[1] = vmlaq_n_f32(sum[0].val[1], in.val[1], refReal);
+            sum[0].val[1] = vmlsq_n_f32(sum[0].val[1], in.val[0], refImag);
+        }
+        vst2q_f32((float*)(outputVector + number), sum[0]);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] =
+            volk_xcorr_lag(inputVector + number, reference, referenceLength);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_sliding_xcorr_32fc_H */
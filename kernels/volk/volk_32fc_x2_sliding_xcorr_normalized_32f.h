@@ -0,0 +1,198 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x2_sliding_xcorr_normalized_32f
+ *
+ * \b Overview
+ *
+ * The magnitude of the sliding correlation of volk_32fc_x2_sliding_xcorr_32fc,
+ * normalized by the energies of the reference and of the input window, for
+ * threshold detection independent of the signal level:
+ *
+ * out[k] = |c[k]| / sqrt(E_ref * E_in[k]), with
+ * E_in[k] = sum over j < referenceLength of |in[k + j]|^2
+ *
+ * which is 1 where the window is a scaled copy of the reference and 0 where
+ * either energy is. The window energy slides on in double precision.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_sliding_xcorr_normalized_32f(float* outputVector,
+ * const lv_32fc_t* inputVector, const lv_32fc_t* reference,
+ * unsigned int referenceLength, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The stream, num_points + referenceLength - 1 samples.
+ * \li reference: The reference.
+ * \li referenceLength: The number of samples of the reference.
+ * \li num_points: The number of lags.
+ *
+ * \b Outputs
+ * \li outputVector: The normalized correlation magnitude at each lag.
+ *
+ * \b Example
+ * Find the lags where a 64 sample preamble starts.
+ * \code
+ *   volk_32fc_x2_sliding_xcorr_normalized_32f(metric, samples, preamble, 64, lags);
+ *   for (unsigned int k = 0; k < lags; k++) {
+ *       if (metric[k] > 0.8f) {
+ *           // packet at sample k
+ *       }
+ *   }
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_sliding_xcorr_normalized_32f_H
+#define INCLUDED_volk_32fc_x2_sliding_xcorr_normalized_32f_H
+
+#include <math.h>
+#include <volk/volk_32fc_x2_sliding_xcorr_32fc.h>
+
+/* The number of lags correlated at a time */
+#define VOLK_XCORR_CHUNK 256
+
+/* |x|^2 in double precision */
+static inline double volk_xcorr_energy(lv_32fc_t x)
+{
+    return (double)lv_creal(x) * lv_creal(x) + (double)lv_cimag(x) * lv_cimag(x);
+}
+
+/* Normalizes the correlations of a sliding correlation kernel chunk by chunk */
+static inline void volk_xcorr_normalized(void (*xcorr)(lv_32fc_t*,
+                                                       const lv_32fc_t*,
+                                                       const lv_32fc_t*,
+                                                       unsigned int,
+                                                       unsigned int),
+                                         float* outputVector,
+                                         const lv_32fc_t* inputVector,
+                                         const lv_32fc_t* reference,
+                                         unsigned int referenceLength,
+                                         unsigned int num_points)
+{
+    lv_32fc_t correlation[VOLK_XCORR_CHUNK];
+    double referenceEnergy = 0., energy = 0., power, magnitude2;
+    unsigned int chunk, count, number, lag;
+
+    for (number = 0; number < referenceLength; number++) {
+        referenceEnergy += volk_xcorr_energy(reference[number]);
+        energy += volk_xcorr_energy(inputVector[number]);
+    }
+
+    for (chunk = 0; chunk < num_points; chunk += count) {
+        count = num_points - chunk < VOLK_XCORR_CHUNK ? num_points - chunk
+                                                      : VOLK_XCORR_CHUNK;
+        xcorr(correlation, inputVector + chunk, reference, referenceLength, count);
+        for (number = 0; number < count; number++) {
+            lag = chunk + number;
+            if (lag > 0) {
+                // the window takes in one sample and drops one
+                energy += volk_xcorr_energy(inputVector[lag + referenceLength - 1]) -
+                          volk_xcorr_energy(inputVector[lag - 1]);
+            }
+            power = referenceEnergy * energy;
+            magnitude2 = volk_xcorr_energy(correlation[number]);
+            outputVector[lag] = power > 0. ? (float)sqrt(magnitude2 / power) : 0.f;
+        }
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_sliding_xcorr_normalized_32f_generic(float* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  const lv_32fc_t* reference,
+                                                  unsigned int referenceLength,
+                                                  unsigned int num_points)
+{
+    volk_xcorr_normalized(volk_32fc_x2_sliding_xcorr_32fc_generic,
+                          outputVector,
+                          inputVector,
+                          reference,
+                          referenceLength,
+                          num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+
+static inline void
+volk_32fc_x2_sliding_xcorr_normalized_32f_u_avx_fma(float* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    const lv_32fc_t* reference,
+                                                    unsigned int referenceLength,
+                                                    unsigned int num_points)
+{
+    volk_xcorr_normalized(volk_32fc_x2_sliding_xcorr_32fc_u_avx_fma,
+                          outputVector,
+                          inputVector,
+                          reference,
+                          referenceLength,
+                          num_points);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_x2_sliding_xcorr_normalized_32f_u_avx512f(float* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    const lv_32fc_t* reference,
+                                                    unsigned int referenceLength,
+                                                    unsigned int num_points)
+{
+    volk_xcorr_normalized(volk_32fc_x2_sliding_xcorr_32fc_u_avx512f,
+                          outputVector,
+                          inputVector,
+                          reference,
+                          referenceLength,
+                          num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_x2_sliding_xcorr_normalized_32f_neon(float* outputVector,
+                                               const lv_32fc_t* inputVector,
+                                               const lv_32fc_t* reference,
+                                               unsigned int referenceLength,
+                                               unsigned int num_points)
+{
+    volk_xcorr_normalized(volk_32fc_x2_sliding_xcorr_32fc_neon,
+                          outputVector,
+                          inputVector,
+                          reference,
+                          referenceLength,
+                          num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_sliding_xcorr_normalized_32f_H */
@@ -0,0 +1,132 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_x2_sliding_xcorr_normalized_32f.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_sliding_xcorr_normalizedpuppet_32f_H
+#define INCLUDED_volk_32fc_x2_sliding_xcorr_normalizedpuppet_32f_H
+
+#include <string.h>
+#include <volk/volk_32fc_x2_sliding_xcorr_normalized_32f.h>
+
+/* Correlates with the first 67 samples of the reference, zeros after the lags */
+static inline void volk_sliding_xcorr_normalized_puppet(void (*kernel)(float*,
+                                                                       const lv_32fc_t*,
+                                                                       const lv_32fc_t*,
+                                                                       unsigned int,
+                                                                       unsigned int),
+                                                        float* outputVector,
+                                                        const lv_32fc_t* inputVector,
+                                                        const lv_32fc_t* reference,
+                                                        unsigned int num_points)
+{
+    const unsigned int referenceLength = num_points < 67 ? num_points : 67;
+
+    memset(outputVector, 0, num_points * sizeof(float));
+    if (referenceLength > 0) {
+        kernel(outputVector,
+               inputVector,
+               reference,
+               referenceLength,
+               num_points - referenceLength + 1);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_sliding_xcorr_normalizedpuppet_32f_generic(float* outputVector,
+                                                        const lv_32fc_t* inputVector,
+                                                        const lv_32fc_t* reference,
+                                                        unsigned int num_points)
+{
+    volk_sliding_xcorr_normalized_puppet(
+        volk_32fc_x2_sliding_xcorr_normalized_32f_generic,
+        outputVector,
+        inputVector,
+        reference,
+        num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+
+static inline void
+volk_32fc_x2_sliding_xcorr_normalizedpuppet_32f_u_avx_fma(float* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const lv_32fc_t* reference,
+                                                          unsigned int num_points)
+{
+    volk_sliding_xcorr_normalized_puppet(
+        volk_32fc_x2_sliding_xcorr_normalized_32f_u_avx_fma,
+        outputVector,
+        inputVector,
+        reference,
+        num_points);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_x2_sliding_xcorr_normalizedpuppet_32f_u_avx512f(float* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const lv_32fc_t* reference,
+                                                          unsigned int num_points)
+{
+    volk_sliding_xcorr_normalized_puppet(
+        volk_32fc_x2_sliding_xcorr_normalized_32f_u_avx512f,
+        outputVector,
+        inputVector,
+        reference,
+        num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_x2_sliding_xcorr_normalizedpuppet_32f_neon(float* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     const lv_32fc_t* reference,
+                                                     unsigned int num_points)
+{
+    volk_sliding_xcorr_normalized_puppet(volk_32fc_x2_sliding_xcorr_normalized_32f_neon,
+                                         outputVector,
+                                         inputVector,
+                                         reference,
+                                         num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_sliding_xcorr_normalizedpuppet_32f_H */
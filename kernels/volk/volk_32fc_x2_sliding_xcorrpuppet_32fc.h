@@ -0,0 +1,129 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32fc_x2_sliding_xcorr_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_sliding_xcorrpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_sliding_xcorrpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_32fc_x2_sliding_xcorr_32fc.h>
+
+/* Correlates with the first 67 samples of the reference, zeros after the lags */
+static inline void volk_sliding_xcorr_puppet(void (*kernel)(lv_32fc_t*,
+                                                            const lv_32fc_t*,
+                                                            const lv_32fc_t*,
+                                                            unsigned int,
+                                                            unsigned int),
+                                             lv_32fc_t* outputVector,
+                                             const lv_32fc_t* inputVector,
+                                             const lv_32fc_t* reference,
+                                             unsigned int num_points)
+{
+    const unsigned int referenceLength = num_points < 67 ? num_points : 67;
+
+    memset(outputVector, 0, num_points * sizeof(lv_32fc_t));
+    if (referenceLength > 0) {
+        kernel(outputVector,
+               inputVector,
+               reference,
+               referenceLength,
+               num_points - referenceLength + 1);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_sliding_xcorrpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                              const lv_32fc_t* inputVector,
+                                              const lv_32fc_t* reference,
+                                              unsigned int num_points)
+{
+    volk_sliding_xcorr_puppet(volk_32fc_x2_sliding_xcorr_32fc_generic,
+                              outputVector,
+                              inputVector,
+                              reference,
+                              num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+
+static inline void
+volk_32fc_x2_sliding_xcorrpuppet_32fc_u_avx_fma(lv_32fc_t* outputVector,
+                                                const lv_32fc_t* inputVector,
+                                                const lv_32fc_t* reference,
+                                                unsigned int num_points)
+{
+    volk_sliding_xcorr_puppet(volk_32fc_x2_sliding_xcorr_32fc_u_avx_fma,
+                              outputVector,
+                              inputVector,
+                              reference,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_x2_sliding_xcorrpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                const lv_32fc_t* inputVector,
+                                                const lv_32fc_t* reference,
+                                                unsigned int num_points)
+{
+    volk_sliding_xcorr_puppet(volk_32fc_x2_sliding_xcorr_32fc_u_avx512f,
+                              outputVector,
+                              inputVector,
+                              reference,
+                              num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_x2_sliding_xcorrpuppet_32fc_neon(lv_32fc_t* outputVector,
+                                           const lv_32fc_t* inputVector,
+                                           const lv_32fc_t* reference,
+                                           unsigned int num_points)
+{
+    volk_sliding_xcorr_puppet(volk_32fc_x2_sliding_xcorr_32fc_neon,
+                              outputVector,
+                              inputVector,
+                              reference,
+                              num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_sliding_xcorrpuppet_32fc_H */
@@ -0,0 +1,125 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_x4_complex_dot_prod_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_split_dot_prodpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_split_dot_prodpuppet_32fc_H
+
+#include <volk/volk.h>
+#include <volk/volk_32f_x4_complex_dot_prod_32fc.h>
+
+/* Splits the inputs into real and imaginary planes and runs the kernel on
+ * them. */
+static inline void volk_split_dot_prod_puppet(void (*kernel)(lv_32fc_t*,
+                                                             const float*,
+                                                             const float*,
+                                                             const float*,
+                                                             const float*,
+                                                             unsigned int),
+                                              lv_32fc_t* result,
+                                              const lv_32fc_t* input,
+                                              const lv_32fc_t* taps,
+                                              unsigned int num_points)
+{
+    const size_t alignment = volk_get_alignment();
+    float* planes = (float*)volk_malloc(sizeof(float) * 4 * num_points, alignment);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        planes[number] = lv_creal(input[number]);
+        planes[num_points + number] = lv_cimag(input[number]);
+        planes[2 * num_points + number] = lv_creal(taps[number]);
+        planes[3 * num_points + number] = lv_cimag(taps[number]);
+    }
+    kernel(result,
+           planes,
+           planes + num_points,
+           planes + 2 * num_points,
+           planes + 3 * num_points,
+           num_points);
+
+    volk_free(planes);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_split_dot_prodpuppet_32fc_generic(lv_32fc_t* result,
+                                                                  const lv_32fc_t* input,
+                                                                  const lv_32fc_t* taps,
+                                                                  unsigned int num_points)
+{
+    volk_split_dot_prod_puppet(
+        volk_32f_x4_complex_dot_prod_32fc_generic, result, input, taps, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_x2_split_dot_prodpuppet_32fc_u_avx2_fma(lv_32fc_t* result,
+                                                  const lv_32fc_t* input,
+                                                  const lv_32fc_t* taps,
+                                                  unsigned int num_points)
+{
+    volk_split_dot_prod_puppet(
+        volk_32f_x4_complex_dot_prod_32fc_u_avx2_fma, result, input, taps, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_x2_split_dot_prodpuppet_32fc_u_avx512f(lv_32fc_t* result,
+                                                 const lv_32fc_t* input,
+                                                 const lv_32fc_t* taps,
+                                                 unsigned int num_points)
+{
+    volk_split_dot_prod_puppet(
+        volk_32f_x4_complex_dot_prod_32fc_u_avx512f, result, input, taps, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_x2_split_dot_prodpuppet_32fc_neonv8(lv_32fc_t* result,
+                                                                 const lv_32fc_t* input,
+                                                                 const lv_32fc_t* taps,
+                                                                 unsigned int num_points)
+{
+    volk_split_dot_prod_puppet(
+        volk_32f_x4_complex_dot_prod_32fc_neonv8, result, input, taps, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_split_dot_prodpuppet_32fc_H */
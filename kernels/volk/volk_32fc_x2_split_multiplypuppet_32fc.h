@@ -0,0 +1,144 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32f_x4_complex_multiply_32f_x2.h'
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_split_multiplypuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_split_multiplypuppet_32fc_H
+
+#include <volk/volk.h>
+#include <volk/volk_32f_x4_complex_multiply_32f_x2.h>
+
+/* Splits the inputs into real and imaginary planes, runs the kernel on them and
+ * interleaves the products. */
+static inline void volk_split_multiply_puppet(void (*kernel)(float*,
+                                                             float*,
+                                                             const float*,
+                                                             const float*,
+                                                             const float*,
+                                                             const float*,
+                                                             unsigned int),
+                                              lv_32fc_t* cVector,
+                                              const lv_32fc_t* aVector,
+                                              const lv_32fc_t* bVector,
+                                              unsigned int num_points)
+{
+    const size_t alignment = volk_get_alignment();
+    float* planes = (float*)volk_malloc(sizeof(float) * 6 * num_points, alignment);
+    float* c = planes + 4 * num_points;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        planes[number] = lv_creal(aVector[number]);
+        planes[num_points + number] = lv_cimag(aVector[number]);
+        planes[2 * num_points + number] = lv_creal(bVector[number]);
+        planes[3 * num_points + number] = lv_cimag(bVector[number]);
+    }
+    kernel(c,
+           c + num_points,
+           planes,
+           planes + num_points,
+           planes + 2 * num_points,
+           planes + 3 * num_points,
+           num_points);
+    for (number = 0; number < num_points; number++) {
+        cVector[number] = lv_cmake(c[number], c[num_points + number]);
+    }
+
+    volk_free(planes);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_split_multiplypuppet_32fc_generic(lv_32fc_t* cVector,
+                                               const lv_32fc_t* aVector,
+                                               const lv_32fc_t* bVector,
+                                               unsigned int num_points)
+{
+    volk_split_multiply_puppet(volk_32f_x4_complex_multiply_32f_x2_generic,
+                               cVector,
+                               aVector,
+                               bVector,
+                               num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_x2_split_multiplypuppet_32fc_u_avx2_fma(lv_32fc_t* cVector,
+                                                  const lv_32fc_t* aVector,
+                                                  const lv_32fc_t* bVector,
+                                                  unsigned int num_points)
+{
+    volk_split_multiply_puppet(volk_32f_x4_complex_multiply_32f_x2_u_avx2_fma,
+                               cVector,
+                               aVector,
+                               bVector,
+                               num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_x2_split_multiplypuppet_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                 const lv_32fc_t* aVector,
+                                                 const lv_32fc_t* bVector,
+                                                 unsigned int num_points)
+{
+    volk_split_multiply_puppet(volk_32f_x4_complex_multiply_32f_x2_u_avx512f,
+                               cVector,
+                               aVector,
+                               bVector,
+                               num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_x2_split_multiplypuppet_32fc_neonv8(lv_32fc_t* cVector,
+                                                                 const lv_32fc_t* aVector,
+                                                                 const lv_32fc_t* bVector,
+                                                                 unsigned int num_points)
+{
+    volk_split_multiply_puppet(volk_32f_x4_complex_multiply_32f_x2_neonv8,
+                               cVector,
+                               aVector,
+                               bVector,
+                               num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x2_split_multiplypuppet_32fc_H */
@@ -0,0 +1,274 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2
+ *
+ * \b Overview
+ *
+ * Applies an LMS tap update and filters the next input with the updated
+ * taps, in one pass over the taps:
+ *
+ * outputTaps[i] = taps[i] + conj(updateVector[i]) * scalar
+ *
+ * result = sum of outputTaps[i] * inputVector[i]
+ *
+ * This is volk_32fc_x2_s32fc_multiply_conjugate_add_32fc followed by
+ * volk_32fc_x2_dot_prod_32fc, with each updated tap filtered while it is
+ * still in a register instead of being stored and loaded again. outputTaps
+ * may be taps, for an update in place.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2(lv_32fc_t* result,
+ * lv_32fc_t* outputTaps, const lv_32fc_t* taps, const lv_32fc_t* updateVector,
+ * const lv_32fc_t* inputVector, const lv_32fc_t scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li taps: The taps before the update.
+ * \li updateVector: The samples the last output was filtered from.
+ * \li inputVector: The samples to filter with the updated taps.
+ * \li scalar: The step size times the error of the last output.
+ * \li num_points: The number of taps.
+ *
+ * \b Outputs
+ * \li result: The next output, filtered with the updated taps.
+ * \li outputTaps: The updated taps.
+ *
+ * \b Example
+ * A decision directed equaliser of n_taps taps at one sample per symbol, the
+ * newest sample of each window last.
+ * \code
+ *   lv_32fc_t output, decision;
+ *   lv_32fc_t* taps = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * n_taps,
+ *                                             volk_get_alignment());
+ *   // set the centre tap to 1 and the others to 0
+ *
+ *   volk_32fc_x2_dot_prod_32fc(&output, samples, taps, n_taps);
+ *   for (unsigned int n = 1; n < num_symbols; n++) {
+ *       decision = slice(output);
+ *       volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2(&output,
+ *                                                     taps,
+ *                                                     taps,
+ *                                                     samples + n - 1,
+ *                                                     samples + n,
+ *                                                     mu * (decision - output),
+ *                                                     n_taps);
+ *   }
+ *
+ *   volk_free(taps);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_H
+#define INCLUDED_volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_generic(lv_32fc_t* result,
+                                                       lv_32fc_t* outputTaps,
+                                                       const lv_32fc_t* taps,
+                                                       const lv_32fc_t* updateVector,
+                                                       const lv_32fc_t* inputVector,
+                                                       const lv_32fc_t scalar,
+                                                       unsigned int num_points)
+{
+    lv_32fc_t sum = lv_cmake(0.f, 0.f);
+    lv_32fc_t tap;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        tap = taps[number] + lv_conj(updateVector[number]) * scalar;
+        outputTaps[number] = tap;
+        sum += tap * inputVector[number];
+    }
+
+    *result = sum;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void
+volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_u_avx2_fma(lv_32fc_t* result,
+                                                          lv_32fc_t* outputTaps,
+                                                          const lv_32fc_t* taps,
+                                                          const lv_32fc_t* updateVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const lv_32fc_t scalar,
+                                                          unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const float scalarReal = lv_creal(scalar);
+    // conj(u) * s = u * (sr, -sr) + swap(u) * (si, si)
+    const __m256 sr = _mm256_setr_ps(scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal,
+                                     scalarReal,
+                                     -scalarReal);
+    const __m256 si = _mm256_set1_ps(lv_cimag(scalar));
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t products[4];
+    lv_32fc_t sum, tap;
+    unsigned int number;
+    __m256 t, u, x;
+    __m256 accReal = _mm256_setzero_ps();
+    __m256 accImag = _mm256_setzero_ps();
+
+    for (number = 0; number < quarter_points; number++) {
+        t = _mm256_loadu_ps((const float*)(taps + 4 * number));
+        u = _mm256_loadu_ps((const float*)(updateVector + 4 * number));
+        x = _mm256_loadu_ps((const float*)(inputVector + 4 * number));
+        t = _mm256_fmadd_ps(u, sr, t);
+        t = _mm256_fmadd_ps(_mm256_permute_ps(u, 0xb1), si, t);
+        _mm256_storeu_ps((float*)(outputTaps + 4 * number), t);
+        accReal = _mm256_fmadd_ps(t, _mm256_moveldup_ps(x), accReal);
+        accImag = _mm256_fmadd_ps(t, _mm256_movehdup_ps(x), accImag);
+    }
+
+    _mm256_store_ps((float*)products, _mm256_complexmul_parts_ps(accReal, accImag));
+    sum = (products[0] + products[1]) + (products[2] + products[3]);
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        tap = taps[number] + lv_conj(updateVector[number]) * scalar;
+        outputTaps[number] = tap;
+        sum += tap * inputVector[number];
+    }
+
+    *result = sum;
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_u_avx512f(lv_32fc_t* result,
+                                                         lv_32fc_t* outputTaps,
+                                                         const lv_32fc_t* taps,
+                                                         const lv_32fc_t* updateVector,
+                                                         const lv_32fc_t* inputVector,
+                                                         const lv_32fc_t scalar,
+                                                         unsigned int num_points)
+{
+    const float scalarReal = lv_creal(scalar);
+    // conj(u) * s = u * (sr, -sr) + swap(u) * (si, si)
+    const __m512 sr = _mm512_mask_blend_ps(
+        0xaaaa, _mm512_set1_ps(scalarReal), _mm512_set1_ps(-scalarReal));
+    const __m512 si = _mm512_set1_ps(lv_cimag(scalar));
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t products[8];
+    unsigned int number;
+    __mmask16 mask = 0xffff;
+    __m512 t, u, x;
+    __m512 accReal = _mm512_setzero_ps();
+    __m512 accImag = _mm512_setzero_ps();
+
+    for (number = 0; number < num_points; number += 8) {
+        // the taps past the end load as zero, which adds nothing
+        if (num_points - number < 8) {
+            mask = (__mmask16)((1u << (2 * (num_points - number))) - 1);
+        }
+        t = _mm512_maskz_loadu_ps(mask, (const float*)(taps + number));
+        u = _mm512_maskz_loadu_ps(mask, (const float*)(updateVector + number));
+        x = _mm512_maskz_loadu_ps(mask, (const float*)(inputVector + number));
+        t = _mm512_fmadd_ps(u, sr, t);
+        t = _mm512_fmadd_ps(_mm512_permute_ps(u, 0xb1), si, t);
+        _mm512_mask_storeu_ps((float*)(outputTaps + number), mask, t);
+        accReal = _mm512_fmadd_ps(t, _mm512_moveldup_ps(x), accReal);
+        accImag = _mm512_fmadd_ps(t, _mm512_movehdup_ps(x), accImag);
+    }
+
+    _mm512_store_ps((float*)products, _mm512_complexmul_parts_ps(accReal, accImag));
+    *result = ((products[0] + products[1]) + (products[2] + products[3])) +
+              ((products[4] + products[5]) + (products[6] + products[7]));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_neonv8(lv_32fc_t* result,
+                                                      lv_32fc_t* outputTaps,
+                                                      const lv_32fc_t* taps,
+                                                      const lv_32fc_t* updateVector,
+                                                      const lv_32fc_t* inputVector,
+                                                      const lv_32fc_t scalar,
+                                                      unsigned int num_points)
+{
+    const unsigned int half_points = num_points / 2;
+    // conj(u) * s = u * (sr, -sr) + swap(u) * (si, si)
+    const float srValues[4] = {
+        lv_creal(scalar), -lv_creal(scalar), lv_creal(scalar), -lv_creal(scalar)
+    };
+    const float32x4_t sr = vld1q_f32(srValues);
+    const float32x4_t si = vdupq_n_f32(lv_cimag(scalar));
+    lv_32fc_t products[2];
+    lv_32fc_t sum, tap;
+    unsigned int number;
+    float32x4_t t, u, x;
+    float32x4_t accReal = vdupq_n_f32(0.f);
+    float32x4_t accImag = vdupq_n_f32(0.f);
+
+    for (number = 0; number < half_points; number++) {
+        t = vld1q_f32((const float*)(taps + 2 * number));
+        u = vld1q_f32((const float*)(updateVector + 2 * number));
+        x = vld1q_f32((const float*)(inputVector + 2 * number));
+        t = vfmaq_f32(t, u, sr);
+        t = vfmaq_f32(t, vrev64q_f32(u), si);
+        vst1q_f32((float*)(outputTaps + 2 * number), t);
+        accReal = vfmaq_f32(accReal, t, vtrn1q_f32(x, x));
+        accImag = vfmaq_f32(accImag, t, vtrn2q_f32(x, x));
+    }
+
+    vst1q_f32((float*)products, _vcomplexmul_partsq_f32(accReal, accImag));
+    sum = products[0] + products[1];
+
+    if (num_points & 1) {
+        tap = taps[num_points - 1] + lv_conj(updateVector[num_points - 1]) * scalar;
+        outputTaps[num_points - 1] = tap;
+        sum += tap * inputVector[num_points - 1];
+    }
+
+    *result = sum;
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2_H */
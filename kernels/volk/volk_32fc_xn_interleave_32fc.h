@@ -0,0 +1,242 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32fc_xn_interleave_32fc
+ *
+ * \b Overview
+ *
+ * Interleaves one complex vector per channel into a single multi-channel
+ * vector, holding one sample of every channel after the other (ch0, ch1,
+ * ..., chN-1, ch0, ...). This is the inverse of
+ * volk_32fc_deinterleave_32fc_xn.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_xn_interleave_32fc(lv_32fc_t* output, const lv_32fc_t* const* channels,
+ * unsigned int num_channels, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li channels: num_channels pointers to the channel vectors of num_points samples.
+ * \li num_channels: The number of channels.
+ * \li num_points: The number of samples per channel.
+ *
+ * \b Outputs
+ * \li output: The interleaved output vector of num_channels * num_points samples.
+ *
+ * Even channel counts, and in particular 2, 4 and 8 channels, have SIMD
+ * shuffles; other channel counts fall back to a scalar copy. The channel
+ * vectors are not required to be aligned.
+ *
+ * \b Example
+ * Merge four antenna streams into one buffer for a transmitter.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* burst = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*4*N, alignment);
+ *   const lv_32fc_t* channels[4];
+ *   // point channels[0..3] at the per antenna streams
+ *
+ *   volk_32fc_xn_interleave_32fc(burst, channels, 4, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_xn_interleave_32fc_u_H
+#define INCLUDED_volk_32fc_xn_interleave_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_xn_interleave_32fc_generic(lv_32fc_t* output,
+                                                        const lv_32fc_t* const* channels,
+                                                        unsigned int num_channels,
+                                                        unsigned int num_points)
+{
+    lv_32fc_t* outputPtr = output;
+    unsigned int number, ch;
+    for (number = 0; number < num_points; number++) {
+        for (ch = 0; ch < num_channels; ch++) {
+            *outputPtr++ = channels[ch][number];
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32fc_xn_interleave_32fc_sse2(lv_32fc_t* output,
+                                                     const lv_32fc_t* const* channels,
+                                                     unsigned int num_channels,
+                                                     unsigned int num_points)
+{
+    unsigned int number = 0, ch;
+
+    // a complex sample is one 64 bit lane; 2x2 transposes of channel pairs
+    if ((num_channels & 1) == 0) {
+        const unsigned int halfPoints = num_points / 2;
+        for (; number < halfPoints; number++) {
+            double* outPtr = (double*)(output + 2 * number * num_channels);
+            for (ch = 0; ch < num_channels; ch += 2) {
+                // s0c0 s1c0 | s0c1 s1c1
+                const __m128d c0 =
+                    _mm_loadu_pd((const double*)(channels[ch] + 2 * number));
+                const __m128d c1 =
+                    _mm_loadu_pd((const double*)(channels[ch + 1] + 2 * number));
+                _mm_storeu_pd(outPtr + ch, _mm_unpacklo_pd(c0, c1));
+                _mm_storeu_pd(outPtr + num_channels + ch, _mm_unpackhi_pd(c0, c1));
+            }
+        }
+        number = halfPoints * 2;
+    }
+
+    lv_32fc_t* outputPtr = output + number * num_channels;
+    for (; number < num_points; number++) {
+        for (ch = 0; ch < num_channels; ch++) {
+            *outputPtr++ = channels[ch][number];
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_xn_interleave_32fc_avx(lv_32fc_t* output,
+                                                    const lv_32fc_t* const* channels,
+                                                    unsigned int num_channels,
+                                                    unsigned int num_points)
+{
+    unsigned int number = 0, ch;
+    const unsigned int quarterPoints = num_points / 4;
+
+    if (num_channels == 2) {
+        const lv_32fc_t* ch0 = channels[0];
+        const lv_32fc_t* ch1 = channels[1];
+        for (; number < quarterPoints; number++) {
+            double* outPtr = (double*)(output + 8 * number);
+            // s0c0 s1c0 s2c0 s3c0, s0c1 s1c1 s2c1 s3c1
+            const __m256d c0 = _mm256_loadu_pd((const double*)(ch0 + 4 * number));
+            const __m256d c1 = _mm256_loadu_pd((const double*)(ch1 + 4 * number));
+            // s0c0 s0c1 s2c0 s2c1 | s1c0 s1c1 s3c0 s3c1
+            const __m256d t0 = _mm256_unpacklo_pd(c0, c1);
+            const __m256d t1 = _mm256_unpackhi_pd(c0, c1);
+            _mm256_storeu_pd(outPtr, _mm256_permute2f128_pd(t0, t1, 0x20));
+            _mm256_storeu_pd(outPtr + 4, _mm256_permute2f128_pd(t0, t1, 0x31));
+        }
+        number = quarterPoints * 4;
+    } else if ((num_channels & 3) == 0) {
+        // 4x4 transposes, four samples of four channels at a time
+        for (; number < quarterPoints; number++) {
+            double* outPtr = (double*)(output + 4 * number * num_channels);
+            for (ch = 0; ch < num_channels; ch += 4) {
+                const __m256d c0 =
+                    _mm256_loadu_pd((const double*)(channels[ch] + 4 * number));
+                const __m256d c1 =
+                    _mm256_loadu_pd((const double*)(channels[ch + 1] + 4 * number));
+                const __m256d c2 =
+                    _mm256_loadu_pd((const double*)(channels[ch + 2] + 4 * number));
+                const __m256d c3 =
+                    _mm256_loadu_pd((const double*)(channels[ch + 3] + 4 * number));
+                // s0c0 s0c1 s2c0 s2c1, s1c0 s1c1 s3c0 s3c1, ...
+                const __m256d t0 = _mm256_unpacklo_pd(c0, c1);
+                const __m256d t1 = _mm256_unpackhi_pd(c0, c1);
+                const __m256d t2 = _mm256_unpacklo_pd(c2, c3);
+                const __m256d t3 = _mm256_unpackhi_pd(c2, c3);
+                _mm256_storeu_pd(outPtr + ch, _mm256_permute2f128_pd(t0, t2, 0x20));
+                _mm256_storeu_pd(outPtr + num_channels + ch,
+                                 _mm256_permute2f128_pd(t1, t3, 0x20));
+                _mm256_storeu_pd(outPtr + 2 * num_channels + ch,
+                                 _mm256_permute2f128_pd(t0, t2, 0x31));
+                _mm256_storeu_pd(outPtr + 3 * num_channels + ch,
+                                 _mm256_permute2f128_pd(t1, t3, 0x31));
+            }
+        }
+        number = quarterPoints * 4;
+    }
+
+    lv_32fc_t* outputPtr = output + number * num_channels;
+    for (; number < num_points; number++) {
+        for (ch = 0; ch < num_channels; ch++) {
+            *outputPtr++ = channels[ch][number];
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_xn_interleave_32fc_neonv8(lv_32fc_t* output,
+                                                       const lv_32fc_t* const* channels,
+                                                       unsigned int num_channels,
+                                                       unsigned int num_points)
+{
+    unsigned int number = 0, ch;
+
+    if (num_channels == 4) {
+        // vst4 merges two samples of four channels in one go
+        const unsigned int halfPoints = num_points / 2;
+        for (; number < halfPoints; number++) {
+            float64x2x4_t s;
+            for (ch = 0; ch < 4; ch++) {
+                s.val[ch] = vld1q_f64((const double*)(channels[ch] + 2 * number));
+            }
+            vst4q_f64((double*)(output + 8 * number), s);
+        }
+        number = halfPoints * 2;
+    } else if ((num_channels & 1) == 0) {
+        // 2x2 transposes of channel pairs
+        const unsigned int halfPoints = num_points / 2;
+        for (; number < halfPoints; number++) {
+            double* outPtr = (double*)(output + 2 * number * num_channels);
+            for (ch = 0; ch < num_channels; ch += 2) {
+                const float64x2_t c0 =
+                    vld1q_f64((const double*)(channels[ch] + 2 * number));
+                const float64x2_t c1 =
+                    vld1q_f64((const double*)(channels[ch + 1] + 2 * number));
+                vst1q_f64(outPtr + ch, vzip1q_f64(c0, c1));
+                vst1q_f64(outPtr + num_channels + ch, vzip2q_f64(c0, c1));
+            }
+        }
+        number = halfPoints * 2;
+    }
+
+    lv_32fc_t* outputPtr = output + number * num_channels;
+    for (; number < num_points; number++) {
+        for (ch = 0; ch < num_channels; ch++) {
+            *outputPtr++ = channels[ch][number];
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_xn_interleave_32fc_u_H */
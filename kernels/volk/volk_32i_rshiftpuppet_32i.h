@@ -0,0 +1,144 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_32i_s32u_rshift_32i.h'
+ */
+
+#ifndef INCLUDED_volk_32i_rshiftpuppet_32i_H
+#define INCLUDED_volk_32i_rshiftpuppet_32i_H
+
+#include <volk/volk_32i_s32u_rshift_32i.h>
+
+typedef void (*volk_32i_rshift_t)(int32_t*,
+                                  const int32_t*,
+                                  const unsigned int,
+                                  unsigned int);
+
+/*
+ * Shifts the four quarters of the vector by no bits, some, all but the sign
+ * and more than 31. The quarters are multiples of 16 points, which keeps
+ * them aligned for the aligned kernels.
+ */
+static inline void volk_32i_rshiftpuppet_32i_quarters(volk_32i_rshift_t kernel,
+                                                      int32_t* cVector,
+                                                      const int32_t* aVector,
+                                                      unsigned int num_points)
+{
+    const unsigned int shifts[4] = { 0, 7, 31, 40 };
+    const unsigned int quarter_points = num_points / 64 * 16;
+    unsigned int quarter;
+
+    for (quarter = 0; quarter < 3; quarter++) {
+        kernel(cVector + quarter * quarter_points,
+               aVector + quarter * quarter_points,
+               shifts[quarter],
+               quarter_points);
+    }
+    kernel(cVector + 3 * quarter_points,
+           aVector + 3 * quarter_points,
+           shifts[3],
+           num_points - 3 * quarter_points);
+}
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32i_rshiftpuppet_32i_generic(int32_t* cVector,
+                                                     const int32_t* aVector,
+                                                     unsigned int num_points)
+{
+    volk_32i_rshiftpuppet_32i_quarters(
+        volk_32i_s32u_rshift_32i_generic, cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE4_1
+static inline void volk_32i_rshiftpuppet_32i_a_sse4_1(int32_t* cVector,
+                                                      const int32_t* aVector,
+                                                      unsigned int num_points)
+{
+    volk_32i_rshiftpuppet_32i_quarters(
+        volk_32i_s32u_rshift_32i_a_sse4_1, cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+#ifdef LV_HAVE_SSE4_1
+static inline void volk_32i_rshiftpuppet_32i_u_sse4_1(int32_t* cVector,
+                                                      const int32_t* aVector,
+                                                      unsigned int num_points)
+{
+    volk_32i_rshiftpuppet_32i_quarters(
+        volk_32i_s32u_rshift_32i_u_sse4_1, cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_32i_rshiftpuppet_32i_a_avx2(int32_t* cVector,
+                                                    const int32_t* aVector,
+                                                    unsigned int num_points)
+{
+    volk_32i_rshiftpuppet_32i_quarters(
+        volk_32i_s32u_rshift_32i_a_avx2, cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_32i_rshiftpuppet_32i_u_avx2(int32_t* cVector,
+                                                    const int32_t* aVector,
+                                                    unsigned int num_points)
+{
+    volk_32i_rshiftpuppet_32i_quarters(
+        volk_32i_s32u_rshift_32i_u_avx2, cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32i_rshiftpuppet_32i_a_avx512f(int32_t* cVector,
+                                                       const int32_t* aVector,
+                                                       unsigned int num_points)
+{
+    volk_32i_rshiftpuppet_32i_quarters(
+        volk_32i_s32u_rshift_32i_a_avx512f, cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32i_rshiftpuppet_32i_u_avx512f(int32_t* cVector,
+                                                       const int32_t* aVector,
+                                                       unsigned int num_points)
+{
+    volk_32i_rshiftpuppet_32i_quarters(
+        volk_32i_s32u_rshift_32i_u_avx512f, cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32i_rshiftpuppet_32i_neon(int32_t* cVector,
+                                                  const int32_t* aVector,
+                                                  unsigned int num_points)
+{
+    volk_32i_rshiftpuppet_32i_quarters(
+        volk_32i_s32u_rshift_32i_neon, cVector, aVector, num_points);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32i_rshiftpuppet_32i_H */
@@ -0,0 +1,271 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32i_s32u_rshift_32i
+ *
+ * \b Overview
+ *
+ * Shifts a vector of 32-bit integers right by a number of bits, copying the sign bit
+ * into the vacated ones:
+ *
+ * cVector[i] = aVector[i] >> shift
+ *
+ * This divides by 2^shift, rounding towards minus infinity. Shifts of more than 31
+ * bits act as shifts of 31 bits, giving 0 or -1.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32i_s32u_rshift_32i(int32_t* cVector, const int32_t* aVector, const unsigned
+ * int shift, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li aVector: The input vector.
+ * \li shift: The number of bits to shift by.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li cVector: The output vector, may be aVector.
+ *
+ * \b Example
+ * Takes Q16 fixed point phases to whole cycles.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int32_t* x = (int32_t*)volk_malloc(N * sizeof(int32_t), alignment);
+ *   int32_t* z = (int32_t*)volk_malloc(N * sizeof(int32_t), alignment);
+ *
+ *   for (int ii = 0; ii < N; ++ii) {
+ *       x[ii] = (ii - N / 2) * 1000;
+ *   }
+ *
+ *   volk_32i_s32u_rshift_32i(z, x, 16, N);
+ *
+ *   volk_free(x);
+ *   volk_free(z);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32i_s32u_rshift_32i_H
+#define INCLUDED_volk_32i_s32u_rshift_32i_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32i_s32u_rshift_32i_generic(int32_t* cVector,
+                                                    const int32_t* aVector,
+                                                    const unsigned int shift,
+                                                    unsigned int num_points)
+{
+    // shifting by more than 31 bits leaves the sign, as shifting by 31 does
+    const unsigned int bits = shift > 31 ? 31 : shift;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        cVector[number] = aVector[number] >> bits;
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_32i_s32u_rshift_32i_a_sse4_1(int32_t* cVector,
+                                                     const int32_t* aVector,
+                                                     const unsigned int shift,
+                                                     unsigned int num_points)
+{
+    const unsigned int bits = shift > 31 ? 31 : shift;
+    const __m128i count = _mm_cvtsi32_si128((int)bits);
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m128i a = _mm_load_si128((const __m128i*)(aVector + 4 * number));
+        const __m128i c = _mm_sra_epi32(a, count);
+        _mm_store_si128((__m128i*)(cVector + 4 * number), c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = aVector[number] >> bits;
+    }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_32i_s32u_rshift_32i_u_sse4_1(int32_t* cVector,
+                                                     const int32_t* aVector,
+                                                     const unsigned int shift,
+                                                     unsigned int num_points)
+{
+    const unsigned int bits = shift > 31 ? 31 : shift;
+    const __m128i count = _mm_cvtsi32_si128((int)bits);
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(aVector + 4 * number));
+        const __m128i c = _mm_sra_epi32(a, count);
+        _mm_storeu_si128((__m128i*)(cVector + 4 * number), c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = aVector[number] >> bits;
+    }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32i_s32u_rshift_32i_a_avx2(int32_t* cVector,
+                                                   const int32_t* aVector,
+                                                   const unsigned int shift,
+                                                   unsigned int num_points)
+{
+    const unsigned int bits = shift > 31 ? 31 : shift;
+    const __m128i count = _mm_cvtsi32_si128((int)bits);
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256i a = _mm256_load_si256((const __m256i*)(aVector + 8 * number));
+        const __m256i c = _mm256_sra_epi32(a, count);
+        _mm256_store_si256((__m256i*)(cVector + 8 * number), c);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = aVector[number] >> bits;
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32i_s32u_rshift_32i_u_avx2(int32_t* cVector,
+                                                   const int32_t* aVector,
+                                                   const unsigned int shift,
+                                                   unsigned int num_points)
+{
+    const unsigned int bits = shift > 31 ? 31 : shift;
+    const __m128i count = _mm_cvtsi32_si128((int)bits);
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(aVector + 8 * number));
+        const __m256i c = _mm256_sra_epi32(a, count);
+        _mm256_storeu_si256((__m256i*)(cVector + 8 * number), c);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = aVector[number] >> bits;
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32i_s32u_rshift_32i_a_avx512f(int32_t* cVector,
+                                                      const int32_t* aVector,
+                                                      const unsigned int shift,
+                                                      unsigned int num_points)
+{
+    const unsigned int bits = shift > 31 ? 31 : shift;
+    const __m128i count = _mm_cvtsi32_si128((int)bits);
+    const unsigned int sixteenth_points = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        const __m512i a = _mm512_load_si512(aVector + 16 * number);
+        const __m512i c = _mm512_sra_epi32(a, count);
+        _mm512_store_si512(cVector + 16 * number, c);
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        cVector[number] = aVector[number] >> bits;
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32i_s32u_rshift_32i_u_avx512f(int32_t* cVector,
+                                                      const int32_t* aVector,
+                                                      const unsigned int shift,
+                                                      unsigned int num_points)
+{
+    const unsigned int bits = shift > 31 ? 31 : shift;
+    const __m128i count = _mm_cvtsi32_si128((int)bits);
+    const unsigned int sixteenth_points = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        const __m512i a = _mm512_loadu_si512(aVector + 16 * number);
+        const __m512i c = _mm512_sra_epi32(a, count);
+        _mm512_storeu_si512(cVector + 16 * number, c);
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        cVector[number] = aVector[number] >> bits;
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32i_s32u_rshift_32i_neon(int32_t* cVector,
+                                                 const int32_t* aVector,
+                                                 const unsigned int shift,
+                                                 unsigned int num_points)
+{
+    const unsigned int bits = shift > 31 ? 31 : shift;
+    const int32x4_t count = vdupq_n_s32(-(int32_t)bits);
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const int32x4_t a = vld1q_s32(aVector + 4 * number);
+        const int32x4_t c = vshlq_s32(a, count);
+        vst1q_s32(cVector + 4 * number, c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = aVector[number] >> bits;
+    }
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32i_s32u_rshift_32i_H */
@@ -0,0 +1,272 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32i_x2_multiply_32i
+ *
+ * \b Overview
+ *
+ * Multiplies two vectors of 32-bit integers, keeping the low 32 bits of the products:
+ *
+ * cVector[i] = aVector[i] * bVector[i]
+ *
+ * The products wrap around on overflow, as in unsigned arithmetic, so the kernel
+ * serves vectors of uint32_t as well.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32i_x2_multiply_32i(int32_t* cVector, const int32_t* aVector, const int32_t*
+ * bVector, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li aVector: The first input vector.
+ * \li bVector: The second input vector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li cVector: The output vector, may be one of the inputs.
+ *
+ * \b Example
+ * Scales a vector of indices by per channel strides.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int32_t* x = (int32_t*)volk_malloc(N * sizeof(int32_t), alignment);
+ *   int32_t* y = (int32_t*)volk_malloc(N * sizeof(int32_t), alignment);
+ *   int32_t* z = (int32_t*)volk_malloc(N * sizeof(int32_t), alignment);
+ *
+ *   for (int ii = 0; ii < N; ++ii) {
+ *       x[ii] = ii;
+ *       y[ii] = 1 + ii % 4;
+ *   }
+ *
+ *   volk_32i_x2_multiply_32i(z, x, y, N);
+ *
+ *   volk_free(x);
+ *   volk_free(y);
+ *   volk_free(z);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32i_x2_multiply_32i_H
+#define INCLUDED_volk_32i_x2_multiply_32i_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32i_x2_multiply_32i_generic(int32_t* cVector,
+                                                    const int32_t* aVector,
+                                                    const int32_t* bVector,
+                                                    unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        cVector[number] =
+            (int32_t)((uint32_t)aVector[number] * (uint32_t)bVector[number]);
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_32i_x2_multiply_32i_a_sse4_1(int32_t* cVector,
+                                                     const int32_t* aVector,
+                                                     const int32_t* bVector,
+                                                     unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m128i a = _mm_load_si128((const __m128i*)(aVector + 4 * number));
+        const __m128i b = _mm_load_si128((const __m128i*)(bVector + 4 * number));
+        const __m128i c = _mm_mullo_epi32(a, b);
+        _mm_store_si128((__m128i*)(cVector + 4 * number), c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] =
+            (int32_t)((uint32_t)aVector[number] * (uint32_t)bVector[number]);
+    }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_32i_x2_multiply_32i_u_sse4_1(int32_t* cVector,
+                                                     const int32_t* aVector,
+                                                     const int32_t* bVector,
+                                                     unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(aVector + 4 * number));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(bVector + 4 * number));
+        const __m128i c = _mm_mullo_epi32(a, b);
+        _mm_storeu_si128((__m128i*)(cVector + 4 * number), c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] =
+            (int32_t)((uint32_t)aVector[number] * (uint32_t)bVector[number]);
+    }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32i_x2_multiply_32i_a_avx2(int32_t* cVector,
+                                                   const int32_t* aVector,
+                                                   const int32_t* bVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256i a = _mm256_load_si256((const __m256i*)(aVector + 8 * number));
+        const __m256i b = _mm256_load_si256((const __m256i*)(bVector + 8 * number));
+        const __m256i c = _mm256_mullo_epi32(a, b);
+        _mm256_store_si256((__m256i*)(cVector + 8 * number), c);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] =
+            (int32_t)((uint32_t)aVector[number] * (uint32_t)bVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32i_x2_multiply_32i_u_avx2(int32_t* cVector,
+                                                   const int32_t* aVector,
+                                                   const int32_t* bVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(aVector + 8 * number));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(bVector + 8 * number));
+        const __m256i c = _mm256_mullo_epi32(a, b);
+        _mm256_storeu_si256((__m256i*)(cVector + 8 * number), c);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] =
+            (int32_t)((uint32_t)aVector[number] * (uint32_t)bVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32i_x2_multiply_32i_a_avx512f(int32_t* cVector,
+                                                      const int32_t* aVector,
+                                                      const int32_t* bVector,
+                                                      unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        const __m512i a = _mm512_load_si512(aVector + 16 * number);
+        const __m512i b = _mm512_load_si512(bVector + 16 * number);
+        const __m512i c = _mm512_mullo_epi32(a, b);
+        _mm512_store_si512(cVector + 16 * number, c);
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        cVector[number] =
+            (int32_t)((uint32_t)aVector[number] * (uint32_t)bVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32i_x2_multiply_32i_u_avx512f(int32_t* cVector,
+                                                      const int32_t* aVector,
+                                                      const int32_t* bVector,
+                                                      unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        const __m512i a = _mm512_loadu_si512(aVector + 16 * number);
+        const __m512i b = _mm512_loadu_si512(bVector + 16 * number);
+        const __m512i c = _mm512_mullo_epi32(a, b);
+        _mm512_storeu_si512(cVector + 16 * number, c);
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        cVector[number] =
+            (int32_t)((uint32_t)aVector[number] * (uint32_t)bVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32i_x2_multiply_32i_neon(int32_t* cVector,
+                                                 const int32_t* aVector,
+                                                 const int32_t* bVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const int32x4_t a = vld1q_s32(aVector + 4 * number);
+        const int32x4_t b = vld1q_s32(bVector + 4 * number);
+        const int32x4_t c = vmulq_s32(a, b);
+        vst1q_s32(cVector + 4 * number, c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] =
+            (int32_t)((uint32_t)aVector[number] * (uint32_t)bVector[number]);
+    }
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32i_x2_multiply_32i_H */
@@ -263,6 +263,36 @@ static inline void volk_32u_byteswap_generic(uint32_t* intsToSwap,
 #endif /* LV_HAVE_GENERIC */
 
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+static inline void volk_32u_byteswap_u_avx512bw(uint32_t* intsToSwap,
+                                                unsigned int num_points)
+{
+    const unsigned int nPerSet = 16;
+    const unsigned int nSets = num_points / nPerSet;
+    const unsigned int nRemaining = num_points % nPerSet;
+
+    uint32_t* inputPtr = intsToSwap;
+
+    // reverse the bytes of each element within every 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+
+    for (unsigned int number = 0; number < nSets; number++) {
+        const __m512i input = _mm512_loadu_si512((void*)inputPtr);
+        _mm512_storeu_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += nPerSet;
+    }
+
+    // Byteswap the remaining points with a masked load and store
+    if (nRemaining) {
+        const __mmask16 mask = _cvtu32_mask16((1u << nRemaining) - 1);
+        const __m512i input = _mm512_maskz_loadu_epi32(mask, inputPtr);
+        _mm512_mask_storeu_epi32(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #endif /* INCLUDED_volk_32u_byteswap_u_H */
 #ifndef INCLUDED_volk_32u_byteswap_a_H
 #define INCLUDED_volk_32u_byteswap_a_H
@@ -379,4 +409,34 @@ static inline void volk_32u_byteswap_a_generic(uint32_t* intsToSwap,
 #endif /* LV_HAVE_GENERIC */
 
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+static inline void volk_32u_byteswap_a_avx512bw(uint32_t* intsToSwap,
+                                                unsigned int num_points)
+{
+    const unsigned int nPerSet = 16;
+    const unsigned int nSets = num_points / nPerSet;
+    const unsigned int nRemaining = num_points % nPerSet;
+
+    uint32_t* inputPtr = intsToSwap;
+
+    // reverse the bytes of each element within every 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+
+    for (unsigned int number = 0; number < nSets; number++) {
+        const __m512i input = _mm512_load_si512((void*)inputPtr);
+        _mm512_store_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += nPerSet;
+    }
+
+    // Byteswap the remaining points with a masked load and store
+    if (nRemaining) {
+        const __mmask16 mask = _cvtu32_mask16((1u << nRemaining) - 1);
+        const __m512i input = _mm512_maskz_loadu_epi32(mask, inputPtr);
+        _mm512_mask_storeu_epi32(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #endif /* INCLUDED_volk_32u_byteswap_a_H */
@@ -0,0 +1,277 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_32u_x2_min_32u
+ *
+ * \b Overview
+ *
+ * Selects the smaller of two vectors of unsigned 32-bit integers element by element:
+ *
+ * cVector[i] = min(aVector[i], bVector[i])
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32u_x2_min_32u(uint32_t* cVector, const uint32_t* aVector, const uint32_t*
+ * bVector, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li aVector: The first input vector.
+ * \li bVector: The second input vector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li cVector: The output vector, may be one of the inputs.
+ *
+ * \b Example
+ * Clips a vector of counters to per channel limits.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint32_t* x = (uint32_t*)volk_malloc(N * sizeof(uint32_t), alignment);
+ *   uint32_t* y = (uint32_t*)volk_malloc(N * sizeof(uint32_t), alignment);
+ *   uint32_t* z = (uint32_t*)volk_malloc(N * sizeof(uint32_t), alignment);
+ *
+ *   for (int ii = 0; ii < N; ++ii) {
+ *       x[ii] = ii;
+ *       y[ii] = 5000;
+ *   }
+ *
+ *   volk_32u_x2_min_32u(z, x, y, N);
+ *
+ *   volk_free(x);
+ *   volk_free(y);
+ *   volk_free(z);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32u_x2_min_32u_H
+#define INCLUDED_volk_32u_x2_min_32u_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32u_x2_min_32u_generic(uint32_t* cVector,
+                                               const uint32_t* aVector,
+                                               const uint32_t* bVector,
+                                               unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        const uint32_t a = aVector[number];
+        const uint32_t b = bVector[number];
+        cVector[number] = a < b ? a : b;
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_32u_x2_min_32u_a_sse4_1(uint32_t* cVector,
+                                                const uint32_t* aVector,
+                                                const uint32_t* bVector,
+                                                unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m128i a = _mm_load_si128((const __m128i*)(aVector + 4 * number));
+        const __m128i b = _mm_load_si128((const __m128i*)(bVector + 4 * number));
+        const __m128i c = _mm_min_epu32(a, b);
+        _mm_store_si128((__m128i*)(cVector + 4 * number), c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        const uint32_t a = aVector[number];
+        const uint32_t b = bVector[number];
+        cVector[number] = a < b ? a : b;
+    }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_32u_x2_min_32u_u_sse4_1(uint32_t* cVector,
+                                                const uint32_t* aVector,
+                                                const uint32_t* bVector,
+                                                unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(aVector + 4 * number));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(bVector + 4 * number));
+        const __m128i c = _mm_min_epu32(a, b);
+        _mm_storeu_si128((__m128i*)(cVector + 4 * number), c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        const uint32_t a = aVector[number];
+        const uint32_t b = bVector[number];
+        cVector[number] = a < b ? a : b;
+    }
+}
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32u_x2_min_32u_a_avx2(uint32_t* cVector,
+                                              const uint32_t* aVector,
+                                              const uint32_t* bVector,
+                                              unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256i a = _mm256_load_si256((const __m256i*)(aVector + 8 * number));
+        const __m256i b = _mm256_load_si256((const __m256i*)(bVector + 8 * number));
+        const __m256i c = _mm256_min_epu32(a, b);
+        _mm256_store_si256((__m256i*)(cVector + 8 * number), c);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        const uint32_t a = aVector[number];
+        const uint32_t b = bVector[number];
+        cVector[number] = a < b ? a : b;
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32u_x2_min_32u_u_avx2(uint32_t* cVector,
+                                              const uint32_t* aVector,
+                                              const uint32_t* bVector,
+                                              unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(aVector + 8 * number));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(bVector + 8 * number));
+        const __m256i c = _mm256_min_epu32(a, b);
+        _mm256_storeu_si256((__m256i*)(cVector + 8 * number), c);
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        const uint32_t a = aVector[number];
+        const uint32_t b = bVector[number];
+        cVector[number] = a < b ? a : b;
+    }
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32u_x2_min_32u_a_avx512f(uint32_t* cVector,
+                                                 const uint32_t* aVector,
+                                                 const uint32_t* bVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        const __m512i a = _mm512_load_si512(aVector + 16 * number);
+        const __m512i b = _mm512_load_si512(bVector + 16 * number);
+        const __m512i c = _mm512_min_epu32(a, b);
+        _mm512_store_si512(cVector + 16 * number, c);
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        const uint32_t a = aVector[number];
+        const uint32_t b = bVector[number];
+        cVector[number] = a < b ? a : b;
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32u_x2_min_32u_u_avx512f(uint32_t* cVector,
+                                                 const uint32_t* aVector,
+                                                 const uint32_t* bVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        const __m512i a = _mm512_loadu_si512(aVector + 16 * number);
+        const __m512i b = _mm512_loadu_si512(bVector + 16 * number);
+        const __m512i c = _mm512_min_epu32(a, b);
+        _mm512_storeu_si512(cVector + 16 * number, c);
+    }
+
+    for (number = 16 * sixteenth_points; number < num_points; number++) {
+        const uint32_t a = aVector[number];
+        const uint32_t b = bVector[number];
+        cVector[number] = a < b ? a : b;
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32u_x2_min_32u_neon(uint32_t* cVector,
+                                            const uint32_t* aVector,
+                                            const uint32_t* bVector,
+                                            unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const uint32x4_t a = vld1q_u32(aVector + 4 * number);
+        const uint32x4_t b = vld1q_u32(bVector + 4 * number);
+        const uint32x4_t c = vminq_u32(a, b);
+        vst1q_u32(cVector + 4 * number, c);
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        const uint32_t a = aVector[number];
+        const uint32_t b = bVector[number];
+        cVector[number] = a < b ? a : b;
+    }
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32u_x2_min_32u_H */
@@ -0,0 +1,248 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64f_accumulator_s64f
+ *
+ * \b Overview
+ *
+ * Sums the elements of a vector of doubles:
+ *
+ * result = sum(inputBuffer[i])
+ *
+ * The SIMD versions sum in several lanes, so the result may differ from the
+ * generic one in the last bits.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64f_accumulator_s64f(double* result, const double* inputBuffer, unsigned
+ * int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: The vector to sum.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li result: The sum.
+ *
+ * \b Example
+ * The mean of a block of clock offsets.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   double* offsets = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *   double sum;
+ *
+ *   // ... fill offsets
+ *
+ *   volk_64f_accumulator_s64f(&sum, offsets, N);
+ *   printf("mean offset: %g\n", sum / N);
+ *
+ *   volk_free(offsets);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64f_accumulator_s64f_H
+#define INCLUDED_volk_64f_accumulator_s64f_H
+
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_64f_accumulator_s64f_generic(double* result,
+                                                     const double* inputBuffer,
+                                                     unsigned int num_points)
+{
+    double sum = 0.0;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        sum += inputBuffer[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_64f_accumulator_s64f_a_avx2_fma(double* result,
+                                                        const double* inputBuffer,
+                                                        unsigned int num_points)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 8 <= num_points; number += 8) {
+        acc0 = _mm256_add_pd(acc0, _mm256_load_pd(inputBuffer + number));
+        acc1 = _mm256_add_pd(acc1, _mm256_load_pd(inputBuffer + number + 4));
+    }
+    if (number + 4 <= num_points) {
+        acc0 = _mm256_add_pd(acc0, _mm256_load_pd(inputBuffer + number));
+        number += 4;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) double sums[4];
+    _mm256_store_pd(sums, _mm256_add_pd(acc0, acc1));
+    sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+
+    for (; number < num_points; number++) {
+        sum += inputBuffer[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_64f_accumulator_s64f_u_avx2_fma(double* result,
+                                                        const double* inputBuffer,
+                                                        unsigned int num_points)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 8 <= num_points; number += 8) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(inputBuffer + number));
+        acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(inputBuffer + number + 4));
+    }
+    if (number + 4 <= num_points) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(inputBuffer + number));
+        number += 4;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) double sums[4];
+    _mm256_store_pd(sums, _mm256_add_pd(acc0, acc1));
+    sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+
+    for (; number < num_points; number++) {
+        sum += inputBuffer[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_64f_accumulator_s64f_a_avx512f(double* result,
+                                                       const double* inputBuffer,
+                                                       unsigned int num_points)
+{
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 16 <= num_points; number += 16) {
+        acc0 = _mm512_add_pd(acc0, _mm512_load_pd(inputBuffer + number));
+        acc1 = _mm512_add_pd(acc1, _mm512_load_pd(inputBuffer + number + 8));
+    }
+    if (number + 8 <= num_points) {
+        acc0 = _mm512_add_pd(acc0, _mm512_load_pd(inputBuffer + number));
+        number += 8;
+    }
+
+    sum = _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1));
+
+    for (; number < num_points; number++) {
+        sum += inputBuffer[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_64f_accumulator_s64f_u_avx512f(double* result,
+                                                       const double* inputBuffer,
+                                                       unsigned int num_points)
+{
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 16 <= num_points; number += 16) {
+        acc0 = _mm512_add_pd(acc0, _mm512_loadu_pd(inputBuffer + number));
+        acc1 = _mm512_add_pd(acc1, _mm512_loadu_pd(inputBuffer + number + 8));
+    }
+    if (number + 8 <= num_points) {
+        acc0 = _mm512_add_pd(acc0, _mm512_loadu_pd(inputBuffer + number));
+        number += 8;
+    }
+
+    sum = _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1));
+
+    for (; number < num_points; number++) {
+        sum += inputBuffer[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64f_accumulator_s64f_neonv8(double* result,
+                                                    const double* inputBuffer,
+                                                    unsigned int num_points)
+{
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 4 <= num_points; number += 4) {
+        acc0 = vaddq_f64(acc0, vld1q_f64(inputBuffer + number));
+        acc1 = vaddq_f64(acc1, vld1q_f64(inputBuffer + number + 2));
+    }
+    if (number + 2 <= num_points) {
+        acc0 = vaddq_f64(acc0, vld1q_f64(inputBuffer + number));
+        number += 2;
+    }
+
+    sum = vaddvq_f64(vaddq_f64(acc0, acc1));
+
+    for (; number < num_points; number++) {
+        sum += inputBuffer[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64f_accumulator_s64f_H */
@@ -203,6 +203,30 @@ static inline void volk_64f_convert_32f_generic(float* outputVector,
 #endif /* LV_HAVE_GENERIC */
 
 
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64f_convert_32f_neonv8(float* outputVector,
+                                               const double* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const double* in = inputVector;
+    float* out = outputVector;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const float32x2_t low = vcvt_f32_f64(vld1q_f64(in));
+        vst1q_f32(out, vcvt_high_f32_f64(low, vld1q_f64(in + 2)));
+        in += 4;
+        out += 4;
+    }
+
+    volk_64f_convert_32f_generic(out, in, num_points & 3);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+
 #endif /* INCLUDED_volk_64f_convert_32f_u_H */
 #ifndef INCLUDED_volk_64f_convert_32f_a_H
 #define INCLUDED_volk_64f_convert_32f_a_H
@@ -0,0 +1,191 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64f_exp_64f
+ *
+ * \b Overview
+ *
+ * Computes the exponential of a vector of doubles:
+ *
+ * bVector[i] = exp(aVector[i])
+ *
+ * x = n ln(2) + r with ln(2) in two parts, and a degree 13 series for exp(r), within
+ * an ulp. Results beyond the doubles are 0 or infinity, and the denormals round once.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64f_exp_64f(double* bVector, const double* aVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The input vector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li bVector: The output vector, may be aVector.
+ *
+ * \b Example
+ * Decay factors of a clock filter over a range of time constants.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   double* in = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *   double* out = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *
+ *   for (int ii = 0; ii < N; ++ii) {
+ *       in[ii] = -1e-3 * ii;
+ *   }
+ *
+ *   volk_64f_exp_64f(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64f_exp_64f_H
+#define INCLUDED_volk_64f_exp_64f_H
+
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void
+volk_64f_exp_64f_generic(double* bVector, const double* aVector, unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        bVector[number] = exp(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_64f_exp_64f_a_avx2_fma(double* bVector,
+                                               const double* aVector,
+                                               unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 4 <= num_points; number += 4) {
+        _mm256_store_pd(bVector + number,
+                        _mm256_exp_pd_avx2_fma(_mm256_load_pd(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = exp(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_64f_exp_64f_u_avx2_fma(double* bVector,
+                                               const double* aVector,
+                                               unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 4 <= num_points; number += 4) {
+        _mm256_storeu_pd(bVector + number,
+                         _mm256_exp_pd_avx2_fma(_mm256_loadu_pd(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = exp(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_64f_exp_64f_a_avx512f(double* bVector,
+                                              const double* aVector,
+                                              unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_points; number += 8) {
+        _mm512_store_pd(bVector + number,
+                        _mm512_exp_pd(_mm512_load_pd(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = exp(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_64f_exp_64f_u_avx512f(double* bVector,
+                                              const double* aVector,
+                                              unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_points; number += 8) {
+        _mm512_storeu_pd(bVector + number,
+                         _mm512_exp_pd(_mm512_loadu_pd(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = exp(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_64f_exp_64f_neonv8(double* bVector, const double* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 2 <= num_points; number += 2) {
+        vst1q_f64(bVector + number, _vexpq_f64(vld1q_f64(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = exp(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64f_exp_64f_H */
@@ -0,0 +1,192 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64f_log_64f
+ *
+ * \b Overview
+ *
+ * Computes the natural logarithm of a vector of doubles:
+ *
+ * bVector[i] = log(aVector[i])
+ *
+ * The mantissa is taken into [sqrt(1/2), sqrt(2)), whose log is a series as for
+ * volk_32f_log2_32f, within an ulp. As log() does, zero gives -infinity, and negative
+ * inputs and NaN give NaN.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64f_log_64f(double* bVector, const double* aVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The input vector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li bVector: The output vector, may be aVector.
+ *
+ * \b Example
+ * The log of clock variances, e.g. to fit a noise slope.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   double* in = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *   double* out = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *
+ *   for (int ii = 0; ii < N; ++ii) {
+ *       in[ii] = 1e-18 * (ii + 1);
+ *   }
+ *
+ *   volk_64f_log_64f(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64f_log_64f_H
+#define INCLUDED_volk_64f_log_64f_H
+
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void
+volk_64f_log_64f_generic(double* bVector, const double* aVector, unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        bVector[number] = log(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_64f_log_64f_a_avx2_fma(double* bVector,
+                                               const double* aVector,
+                                               unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 4 <= num_points; number += 4) {
+        _mm256_store_pd(bVector + number,
+                        _mm256_log_pd_avx2_fma(_mm256_load_pd(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = log(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_64f_log_64f_u_avx2_fma(double* bVector,
+                                               const double* aVector,
+                                               unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 4 <= num_points; number += 4) {
+        _mm256_storeu_pd(bVector + number,
+                         _mm256_log_pd_avx2_fma(_mm256_loadu_pd(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = log(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_64f_log_64f_a_avx512f(double* bVector,
+                                              const double* aVector,
+                                              unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_points; number += 8) {
+        _mm512_store_pd(bVector + number,
+                        _mm512_log_pd(_mm512_load_pd(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = log(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_64f_log_64f_u_avx512f(double* bVector,
+                                              const double* aVector,
+                                              unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_points; number += 8) {
+        _mm512_storeu_pd(bVector + number,
+                         _mm512_log_pd(_mm512_loadu_pd(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = log(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_64f_log_64f_neonv8(double* bVector, const double* aVector, unsigned int num_points)
+{
+    unsigned int number = 0;
+
+    for (; number + 2 <= num_points; number += 2) {
+        vst1q_f64(bVector + number, _vlogq_f64(vld1q_f64(aVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = log(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64f_log_64f_H */
@@ -0,0 +1,251 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64f_sin_64f
+ *
+ * \b Overview
+ *
+ * Computes the sine of a vector of doubles:
+ *
+ * bVector[i] = sin(aVector[i])
+ *
+ * The argument is reduced by a multiple of pi/4 given in three parts and degree 6
+ * polynomials follow, after cephes, to about 1e-16. From |x| = 2^30 on the reduction
+ * loses accuracy, so a vector holding such an x takes sin() instead.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64f_sin_64f(double* bVector, const double* aVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The input vector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li bVector: The output vector, may be aVector.
+ *
+ * \b Example
+ * The quadrature part of the carrier phase of a GPS L1 replica.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   double* in = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *   double* out = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *
+ *   for (int ii = 0; ii < N; ++ii) {
+ *       in[ii] = 2. * M_PI * 1575.42e6 * ii / 16.368e6;
+ *   }
+ *
+ *   volk_64f_sin_64f(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64f_sin_64f_H
+#define INCLUDED_volk_64f_sin_64f_H
+
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void
+volk_64f_sin_64f_generic(double* bVector, const double* aVector, unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        bVector[number] = sin(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_64f_sin_64f_a_avx2_fma(double* bVector,
+                                               const double* aVector,
+                                               unsigned int num_points)
+{
+    const __m256d limit = _mm256_set1_pd(1073741824.0);
+    unsigned int number = 0;
+    unsigned int i;
+    __m256d x, sine, cosine;
+
+    for (; number + 4 <= num_points; number += 4) {
+        x = _mm256_load_pd(aVector + number);
+        // the reduction loses accuracy from 2^30 on, where sin() takes over
+        if (_mm256_movemask_pd(_mm256_cmp_pd(
+                _mm256_andnot_pd(_mm256_set1_pd(-0.0), x), limit, _CMP_GE_OQ))) {
+            for (i = number; i < number + 4; i++) {
+                bVector[i] = sin(aVector[i]);
+            }
+            continue;
+        }
+        _mm256_sincos_pd_avx2_fma(x, &sine, &cosine);
+        _mm256_store_pd(bVector + number, sine);
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = sin(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_64f_sin_64f_u_avx2_fma(double* bVector,
+                                               const double* aVector,
+                                               unsigned int num_points)
+{
+    const __m256d limit = _mm256_set1_pd(1073741824.0);
+    unsigned int number = 0;
+    unsigned int i;
+    __m256d x, sine, cosine;
+
+    for (; number + 4 <= num_points; number += 4) {
+        x = _mm256_loadu_pd(aVector + number);
+        // the reduction loses accuracy from 2^30 on, where sin() takes over
+        if (_mm256_movemask_pd(_mm256_cmp_pd(
+                _mm256_andnot_pd(_mm256_set1_pd(-0.0), x), limit, _CMP_GE_OQ))) {
+            for (i = number; i < number + 4; i++) {
+                bVector[i] = sin(aVector[i]);
+            }
+            continue;
+        }
+        _mm256_sincos_pd_avx2_fma(x, &sine, &cosine);
+        _mm256_storeu_pd(bVector + number, sine);
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = sin(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_64f_sin_64f_a_avx512f(double* bVector,
+                                              const double* aVector,
+                                              unsigned int num_points)
+{
+    const __m512d limit = _mm512_set1_pd(1073741824.0);
+    unsigned int number = 0;
+    unsigned int i;
+    __m512d x, sine, cosine;
+
+    for (; number + 8 <= num_points; number += 8) {
+        x = _mm512_load_pd(aVector + number);
+        // the reduction loses accuracy from 2^30 on, where sin() takes over
+        if (_mm512_cmp_pd_mask(_mm512_abs_pd(x), limit, _CMP_GE_OQ)) {
+            for (i = number; i < number + 8; i++) {
+                bVector[i] = sin(aVector[i]);
+            }
+            continue;
+        }
+        _mm512_sincos_pd(x, &sine, &cosine);
+        _mm512_store_pd(bVector + number, sine);
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = sin(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_64f_sin_64f_u_avx512f(double* bVector,
+                                              const double* aVector,
+                                              unsigned int num_points)
+{
+    const __m512d limit = _mm512_set1_pd(1073741824.0);
+    unsigned int number = 0;
+    unsigned int i;
+    __m512d x, sine, cosine;
+
+    for (; number + 8 <= num_points; number += 8) {
+        x = _mm512_loadu_pd(aVector + number);
+        // the reduction loses accuracy from 2^30 on, where sin() takes over
+        if (_mm512_cmp_pd_mask(_mm512_abs_pd(x), limit, _CMP_GE_OQ)) {
+            for (i = number; i < number + 8; i++) {
+                bVector[i] = sin(aVector[i]);
+            }
+            continue;
+        }
+        _mm512_sincos_pd(x, &sine, &cosine);
+        _mm512_storeu_pd(bVector + number, sine);
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = sin(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_64f_sin_64f_neonv8(double* bVector, const double* aVector, unsigned int num_points)
+{
+    const float64x2_t limit = vdupq_n_f64(1073741824.0);
+    unsigned int number = 0;
+    unsigned int i;
+    float64x2_t x;
+    float64x2x2_t sincos;
+
+    for (; number + 2 <= num_points; number += 2) {
+        x = vld1q_f64(aVector + number);
+        // the reduction loses accuracy from 2^30 on, where sin() takes over
+        if (vmaxvq_u32(vreinterpretq_u32_u64(vcageq_f64(x, limit)))) {
+            for (i = number; i < number + 2; i++) {
+                bVector[i] = sin(aVector[i]);
+            }
+            continue;
+        }
+        sincos = _vsincosq_f64(x);
+        vst1q_f64(bVector + number, sincos.val[0]);
+    }
+
+    for (; number < num_points; number++) {
+        bVector[number] = sin(aVector[number]);
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64f_sin_64f_H */
@@ -0,0 +1,280 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64f_x2_dot_prod_64f
+ *
+ * \b Overview
+ *
+ * Computes the dot product of two vectors of doubles:
+ *
+ * result = sum(input[i] * taps[i])
+ *
+ * The SIMD versions sum in several lanes and fuse the products, so the result
+ * may differ from the generic one in the last bits.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64f_x2_dot_prod_64f(double* result, const double* input, const double*
+ * taps, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li input: The first vector.
+ * \li taps: The second vector.
+ * \li num_points: The number of points in both vectors.
+ *
+ * \b Outputs
+ * \li result: The dot product.
+ *
+ * \b Example
+ * The squared norm of a vector of pseudoranges.
+ * \code
+ *   int N = 32;
+ *   unsigned int alignment = volk_get_alignment();
+ *   double* ranges = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *   double norm2;
+ *
+ *   // ... fill ranges
+ *
+ *   volk_64f_x2_dot_prod_64f(&norm2, ranges, ranges, N);
+ *
+ *   volk_free(ranges);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64f_x2_dot_prod_64f_H
+#define INCLUDED_volk_64f_x2_dot_prod_64f_H
+
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_64f_x2_dot_prod_64f_generic(double* result,
+                                                    const double* input,
+                                                    const double* taps,
+                                                    unsigned int num_points)
+{
+    double sum = 0.0;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        sum += input[number] * taps[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_64f_x2_dot_prod_64f_a_avx2_fma(double* result,
+                                                       const double* input,
+                                                       const double* taps,
+                                                       unsigned int num_points)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 8 <= num_points; number += 8) {
+        acc0 = _mm256_fmadd_pd(_mm256_load_pd(input + number),
+                               _mm256_load_pd(taps + number),
+                               acc0);
+        acc1 = _mm256_fmadd_pd(_mm256_load_pd(input + number + 4),
+                               _mm256_load_pd(taps + number + 4),
+                               acc1);
+    }
+    if (number + 4 <= num_points) {
+        acc0 = _mm256_fmadd_pd(_mm256_load_pd(input + number),
+                               _mm256_load_pd(taps + number),
+                               acc0);
+        number += 4;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) double sums[4];
+    _mm256_store_pd(sums, _mm256_add_pd(acc0, acc1));
+    sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+
+    for (; number < num_points; number++) {
+        sum += input[number] * taps[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_64f_x2_dot_prod_64f_u_avx2_fma(double* result,
+                                                       const double* input,
+                                                       const double* taps,
+                                                       unsigned int num_points)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 8 <= num_points; number += 8) {
+        acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(input + number),
+                               _mm256_loadu_pd(taps + number),
+                               acc0);
+        acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(input + number + 4),
+                               _mm256_loadu_pd(taps + number + 4),
+                               acc1);
+    }
+    if (number + 4 <= num_points) {
+        acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(input + number),
+                               _mm256_loadu_pd(taps + number),
+                               acc0);
+        number += 4;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) double sums[4];
+    _mm256_store_pd(sums, _mm256_add_pd(acc0, acc1));
+    sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+
+    for (; number < num_points; number++) {
+        sum += input[number] * taps[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_64f_x2_dot_prod_64f_a_avx512f(double* result,
+                                                      const double* input,
+                                                      const double* taps,
+                                                      unsigned int num_points)
+{
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 16 <= num_points; number += 16) {
+        acc0 = _mm512_fmadd_pd(_mm512_load_pd(input + number),
+                               _mm512_load_pd(taps + number),
+                               acc0);
+        acc1 = _mm512_fmadd_pd(_mm512_load_pd(input + number + 8),
+                               _mm512_load_pd(taps + number + 8),
+                               acc1);
+    }
+    if (number + 8 <= num_points) {
+        acc0 = _mm512_fmadd_pd(_mm512_load_pd(input + number),
+                               _mm512_load_pd(taps + number),
+                               acc0);
+        number += 8;
+    }
+
+    sum = _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1));
+
+    for (; number < num_points; number++) {
+        sum += input[number] * taps[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_64f_x2_dot_prod_64f_u_avx512f(double* result,
+                                                      const double* input,
+                                                      const double* taps,
+                                                      unsigned int num_points)
+{
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 16 <= num_points; number += 16) {
+        acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(input + number),
+                               _mm512_loadu_pd(taps + number),
+                               acc0);
+        acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(input + number + 8),
+                               _mm512_loadu_pd(taps + number + 8),
+                               acc1);
+    }
+    if (number + 8 <= num_points) {
+        acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(input + number),
+                               _mm512_loadu_pd(taps + number),
+                               acc0);
+        number += 8;
+    }
+
+    sum = _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1));
+
+    for (; number < num_points; number++) {
+        sum += input[number] * taps[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64f_x2_dot_prod_64f_neonv8(double* result,
+                                                   const double* input,
+                                                   const double* taps,
+                                                   unsigned int num_points)
+{
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = acc0;
+    unsigned int number = 0;
+    double sum;
+
+    // two independent sums hide the latency of the adds
+    for (; number + 4 <= num_points; number += 4) {
+        acc0 = vfmaq_f64(acc0, vld1q_f64(input + number), vld1q_f64(taps + number));
+        acc1 = vfmaq_f64(acc1,
+                         vld1q_f64(input + number + 2),
+                         vld1q_f64(taps + number + 2));
+    }
+    if (number + 2 <= num_points) {
+        acc0 = vfmaq_f64(acc0, vld1q_f64(input + number), vld1q_f64(taps + number));
+        number += 2;
+    }
+
+    sum = vaddvq_f64(vaddq_f64(acc0, acc1));
+
+    for (; number < num_points; number++) {
+        sum += input[number] * taps[number];
+    }
+    *result = sum;
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64f_x2_dot_prod_64f_H */
@@ -0,0 +1,107 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_64f_x2_s64f_axpy_64f.h'
+ */
+
+#ifndef INCLUDED_volk_64f_x2_s32f_axpypuppet_64f_H
+#define INCLUDED_volk_64f_x2_s32f_axpypuppet_64f_H
+
+#include <volk/volk_64f_x2_s64f_axpy_64f.h>
+
+/* The QA scalar is a float, the puppet widens it to the double alpha */
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_64f_x2_s32f_axpypuppet_64f_generic(double* cVector,
+                                                           const double* xVector,
+                                                           const double* yVector,
+                                                           const float alpha,
+                                                           unsigned int num_points)
+{
+    volk_64f_x2_s64f_axpy_64f_generic(
+        cVector, xVector, yVector, (double)alpha, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_64f_x2_s32f_axpypuppet_64f_a_avx2_fma(double* cVector,
+                                                              const double* xVector,
+                                                              const double* yVector,
+                                                              const float alpha,
+                                                              unsigned int num_points)
+{
+    volk_64f_x2_s64f_axpy_64f_a_avx2_fma(
+        cVector, xVector, yVector, (double)alpha, num_points);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_64f_x2_s32f_axpypuppet_64f_u_avx2_fma(double* cVector,
+                                                              const double* xVector,
+                                                              const double* yVector,
+                                                              const float alpha,
+                                                              unsigned int num_points)
+{
+    volk_64f_x2_s64f_axpy_64f_u_avx2_fma(
+        cVector, xVector, yVector, (double)alpha, num_points);
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_64f_x2_s32f_axpypuppet_64f_a_avx512f(double* cVector,
+                                                             const double* xVector,
+                                                             const double* yVector,
+                                                             const float alpha,
+                                                             unsigned int num_points)
+{
+    volk_64f_x2_s64f_axpy_64f_a_avx512f(
+        cVector, xVector, yVector, (double)alpha, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_64f_x2_s32f_axpypuppet_64f_u_avx512f(double* cVector,
+                                                             const double* xVector,
+                                                             const double* yVector,
+                                                             const float alpha,
+                                                             unsigned int num_points)
+{
+    volk_64f_x2_s64f_axpy_64f_u_avx512f(
+        cVector, xVector, yVector, (double)alpha, num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+static inline void volk_64f_x2_s32f_axpypuppet_64f_neonv8(double* cVector,
+                                                          const double* xVector,
+                                                          const double* yVector,
+                                                          const float alpha,
+                                                          unsigned int num_points)
+{
+    volk_64f_x2_s64f_axpy_64f_neonv8(
+        cVector, xVector, yVector, (double)alpha, num_points);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64f_x2_s32f_axpypuppet_64f_H */
@@ -0,0 +1,214 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64f_x2_s64f_axpy_64f
+ *
+ * \b Overview
+ *
+ * Scales a vector and adds another one, the BLAS-1 axpy:
+ *
+ * cVector[i] = alpha * xVector[i] + yVector[i]
+ *
+ * The double precision volk_32f_x2_s32f_axpy_32f: the SIMD versions
+ * compute each point with one fused multiply-add.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64f_x2_s64f_axpy_64f(double* cVector, const double* xVector, const
+ * double* yVector, const double alpha, unsigned int num_points); \endcode
+ *
+ * \b Inputs
+ * \li xVector: The vector to scale.
+ * \li yVector: The vector to add.
+ * \li alpha: The scale of xVector.
+ * \li num_points: The number of points.
+ *
+ * \b Outputs
+ * \li cVector: The output vector, may be xVector or yVector.
+ *
+ * \b Example
+ * Accumulate a scaled block into a running sum.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   double* x = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *   double* y = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *
+ *   // ... fill x and y
+ *
+ *   volk_64f_x2_s64f_axpy_64f(y, x, y, 0.25, N);
+ *
+ *   volk_free(x);
+ *   volk_free(y);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64f_x2_s64f_axpy_64f_H
+#define INCLUDED_volk_64f_x2_s64f_axpy_64f_H
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_64f_x2_s64f_axpy_64f_generic(double* cVector,
+                                                     const double* xVector,
+                                                     const double* yVector,
+                                                     const double alpha,
+                                                     unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_64f_x2_s64f_axpy_64f_a_avx2_fma(double* cVector,
+                                                        const double* xVector,
+                                                        const double* yVector,
+                                                        const double alpha,
+                                                        unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const __m256d a = _mm256_set1_pd(alpha);
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m256d x = _mm256_load_pd(xVector + 4 * number);
+        const __m256d y = _mm256_load_pd(yVector + 4 * number);
+        _mm256_store_pd(cVector + 4 * number, _mm256_fmadd_pd(a, x, y));
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_64f_x2_s64f_axpy_64f_u_avx2_fma(double* cVector,
+                                                        const double* xVector,
+                                                        const double* yVector,
+                                                        const double alpha,
+                                                        unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    const __m256d a = _mm256_set1_pd(alpha);
+    unsigned int number;
+
+    for (number = 0; number < quarter_points; number++) {
+        const __m256d x = _mm256_loadu_pd(xVector + 4 * number);
+        const __m256d y = _mm256_loadu_pd(yVector + 4 * number);
+        _mm256_storeu_pd(cVector + 4 * number, _mm256_fmadd_pd(a, x, y));
+    }
+
+    for (number = 4 * quarter_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_64f_x2_s64f_axpy_64f_a_avx512f(double* cVector,
+                                                       const double* xVector,
+                                                       const double* yVector,
+                                                       const double alpha,
+                                                       unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const __m512d a = _mm512_set1_pd(alpha);
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m512d x = _mm512_load_pd(xVector + 8 * number);
+        const __m512d y = _mm512_load_pd(yVector + 8 * number);
+        _mm512_store_pd(cVector + 8 * number, _mm512_fmadd_pd(a, x, y));
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_64f_x2_s64f_axpy_64f_u_avx512f(double* cVector,
+                                                       const double* xVector,
+                                                       const double* yVector,
+                                                       const double alpha,
+                                                       unsigned int num_points)
+{
+    const unsigned int eighth_points = num_points / 8;
+    const __m512d a = _mm512_set1_pd(alpha);
+    unsigned int number;
+
+    for (number = 0; number < eighth_points; number++) {
+        const __m512d x = _mm512_loadu_pd(xVector + 8 * number);
+        const __m512d y = _mm512_loadu_pd(yVector + 8 * number);
+        _mm512_storeu_pd(cVector + 8 * number, _mm512_fmadd_pd(a, x, y));
+    }
+
+    for (number = 8 * eighth_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64f_x2_s64f_axpy_64f_neonv8(double* cVector,
+                                                    const double* xVector,
+                                                    const double* yVector,
+                                                    const double alpha,
+                                                    unsigned int num_points)
+{
+    const unsigned int half_points = num_points / 2;
+    const float64x2_t a = vdupq_n_f64(alpha);
+    unsigned int number;
+
+    for (number = 0; number < half_points; number++) {
+        const float64x2_t x = vld1q_f64(xVector + 2 * number);
+        const float64x2_t y = vld1q_f64(yVector + 2 * number);
+        vst1q_f64(cVector + 2 * number, vfmaq_f64(y, a, x));
+    }
+
+    for (number = 2 * half_points; number < num_points; number++) {
+        cVector[number] = alpha * xVector[number] + yVector[number];
+    }
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64f_x2_s64f_axpy_64f_H */
@@ -0,0 +1,176 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64fc_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex doubles into complex floats, the real and imaginary
+ * parts each rounded to nearest as by volk_64f_convert_32f.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64fc_convert_32fc(lv_32fc_t* outputVector, const lv_64fc_t* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex vector to convert.
+ * \li num_points: The number of complex points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * Narrow a double precision result for storage.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_64fc_t* in = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cos(0.3 * ii), sin(0.3 * ii));
+ *   }
+ *
+ *   volk_64fc_convert_32fc(out, in, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.6f %+1.6fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64fc_convert_32fc_u_H
+#define INCLUDED_volk_64fc_convert_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_64f_convert_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_64fc_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                  const lv_64fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_64f_convert_32f_generic(
+        (float*)outputVector, (const double*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_64fc_convert_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                    const lv_64fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_64f_convert_32f_u_avx512f(
+        (float*)outputVector, (const double*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_64fc_convert_32fc_u_avx(lv_32fc_t* outputVector,
+                                                const lv_64fc_t* inputVector,
+                                                unsigned int num_points)
+{
+    volk_64f_convert_32f_u_avx(
+        (float*)outputVector, (const double*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_64fc_convert_32fc_u_sse2(lv_32fc_t* outputVector,
+                                                 const lv_64fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_64f_convert_32f_u_sse2(
+        (float*)outputVector, (const double*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_64fc_convert_32fc_neonv8(lv_32fc_t* outputVector,
+                                                 const lv_64fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_64f_convert_32f_neonv8(
+        (float*)outputVector, (const double*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64fc_convert_32fc_u_H */
+
+#ifndef INCLUDED_volk_64fc_convert_32fc_a_H
+#define INCLUDED_volk_64fc_convert_32fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_64f_convert_32f.h>
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_64fc_convert_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                                    const lv_64fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_64f_convert_32f_a_avx512f(
+        (float*)outputVector, (const double*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_64fc_convert_32fc_a_avx(lv_32fc_t* outputVector,
+                                                const lv_64fc_t* inputVector,
+                                                unsigned int num_points)
+{
+    volk_64f_convert_32f_a_avx(
+        (float*)outputVector, (const double*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_64fc_convert_32fc_a_sse2(lv_32fc_t* outputVector,
+                                                 const lv_64fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_64f_convert_32f_a_sse2(
+        (float*)outputVector, (const double*)inputVector, 2 * num_points);
+}
+#endif /* LV_HAVE_SSE2 */
+
+#endif /* INCLUDED_volk_64fc_convert_32fc_a_H */
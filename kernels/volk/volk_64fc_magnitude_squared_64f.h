@@ -0,0 +1,181 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64fc_magnitude_squared_64f
+ *
+ * \b Overview
+ *
+ * Calculates the squared magnitude of each point of a complex double
+ * vector, magnitudeVector[i] = real(complexVector[i])^2 +
+ * imag(complexVector[i])^2.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64fc_magnitude_squared_64f(double* magnitudeVector,
+ *                                      const lv_64fc_t* complexVector,
+ *                                      unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li complexVector: The complex double input vector.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li magnitudeVector: The squared magnitudes.
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_64fc_t* in = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *   double* power = (double*)volk_malloc(sizeof(double)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake((double)ii, -(double)ii);
+ *   }
+ *
+ *   volk_64fc_magnitude_squared_64f(power, in, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("power[%u] = %1.1f\n", ii, power[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(power);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64fc_magnitude_squared_64f_u_H
+#define INCLUDED_volk_64fc_magnitude_squared_64f_u_H
+
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_64fc_magnitude_squared_64f_generic(double* magnitudeVector,
+                                                           const lv_64fc_t* complexVector,
+                                                           unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        const double real = lv_creal(complexVector[number]);
+        const double imag = lv_cimag(complexVector[number]);
+        magnitudeVector[number] = (real * real) + (imag * imag);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_64fc_magnitude_squared_64f_u_avx(double* magnitudeVector,
+                                                         const lv_64fc_t* complexVector,
+                                                         unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const double* in = (const double*)complexVector;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const __m256d cplxValue0 = _mm256_loadu_pd(in);
+        const __m256d cplxValue1 = _mm256_loadu_pd(in + 4);
+        // points 0 and 2, then 1 and 3, so the pairwise add lands them in order
+        const __m256d even = _mm256_permute2f128_pd(cplxValue0, cplxValue1, 0x20);
+        const __m256d odd = _mm256_permute2f128_pd(cplxValue0, cplxValue1, 0x31);
+        const __m256d evenSquared = _mm256_mul_pd(even, even);
+        const __m256d oddSquared = _mm256_mul_pd(odd, odd);
+        _mm256_storeu_pd(magnitudeVector, _mm256_hadd_pd(evenSquared, oddSquared));
+        in += 8;
+        magnitudeVector += 4;
+    }
+
+    volk_64fc_magnitude_squared_64f_generic(
+        magnitudeVector, (const lv_64fc_t*)in, num_points & 3);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_64fc_magnitude_squared_64f_u_avx512f(
+    double* magnitudeVector, const lv_64fc_t* complexVector, unsigned int num_points)
+{
+    const __m512i realIdx = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m512i imagIdx = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+    const double* in = (const double*)complexVector;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += 8) {
+        // the last points with masked loads, two doubles a point over two registers
+        const unsigned int remaining = num_points - number;
+        const unsigned int count = remaining < 8 ? remaining : 8;
+        const unsigned int low = count < 4 ? count : 4;
+        const __mmask8 mask0 = (__mmask8)((1u << (2 * low)) - 1);
+        const __mmask8 mask1 = (__mmask8)((1u << (2 * (count - low))) - 1);
+        const __m512d cplxValue0 = _mm512_maskz_loadu_pd(mask0, in);
+        const __m512d cplxValue1 = _mm512_maskz_loadu_pd(mask1, in + 8);
+        const __m512d real = _mm512_permutex2var_pd(cplxValue0, realIdx, cplxValue1);
+        const __m512d imag = _mm512_permutex2var_pd(cplxValue0, imagIdx, cplxValue1);
+        _mm512_mask_storeu_pd(magnitudeVector + number,
+                              (__mmask8)((1u << count) - 1),
+                              _mm512_fmadd_pd(real, real, _mm512_mul_pd(imag, imag)));
+        in += 16;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64fc_magnitude_squared_64f_neonv8(double* magnitudeVector,
+                                                          const lv_64fc_t* complexVector,
+                                                          unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    const double* in = (const double*)complexVector;
+    unsigned int number;
+
+    for (number = 0; number < halfPoints; number++) {
+        // real parts in val[0], imaginary parts in val[1]
+        const float64x2x2_t value = vld2q_f64(in);
+        vst1q_f64(magnitudeVector,
+                  vfmaq_f64(vmulq_f64(value.val[1], value.val[1]),
+                            value.val[0],
+                            value.val[0]));
+        in += 4;
+        magnitudeVector += 2;
+    }
+
+    volk_64fc_magnitude_squared_64f_generic(
+        magnitudeVector, (const lv_64fc_t*)in, num_points & 1);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64fc_magnitude_squared_64f_u_H */
@@ -0,0 +1,108 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef INCLUDED_volk_64fc_s32fc_rotatorpuppet_64fc_H
+#define INCLUDED_volk_64fc_s32fc_rotatorpuppet_64fc_H
+
+#include <math.h>
+#include <volk/volk_64fc_s64fc_x2_rotator_64fc.h>
+#include <volk/volk_complex.h>
+
+/* The QA scalar is a lv_32fc_t, the puppet widens it to the double phase increment */
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_64fc_s32fc_rotatorpuppet_64fc_generic(lv_64fc_t* outVector,
+                                                              const lv_64fc_t* inVector,
+                                                              const lv_32fc_t phase_inc,
+                                                              unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, 0.95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc));
+    phase_inc_n /= hypot(lv_creal(phase_inc_n), lv_cimag(phase_inc_n));
+    volk_64fc_s64fc_x2_rotator_64fc_generic(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_64fc_s32fc_rotatorpuppet_64fc_u_avx(lv_64fc_t* outVector,
+                                                            const lv_64fc_t* inVector,
+                                                            const lv_32fc_t phase_inc,
+                                                            unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, 0.95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc));
+    phase_inc_n /= hypot(lv_creal(phase_inc_n), lv_cimag(phase_inc_n));
+    volk_64fc_s64fc_x2_rotator_64fc_u_avx(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_64fc_s32fc_rotatorpuppet_64fc_u_avx512f(lv_64fc_t* outVector,
+                                                                const lv_64fc_t* inVector,
+                                                                const lv_32fc_t phase_inc,
+                                                                unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, 0.95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc));
+    phase_inc_n /= hypot(lv_creal(phase_inc_n), lv_cimag(phase_inc_n));
+    volk_64fc_s64fc_x2_rotator_64fc_u_avx512f(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_64fc_s32fc_rotatorpuppet_64fc_neonv8(lv_64fc_t* outVector,
+                                                             const lv_64fc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, 0.95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc));
+    phase_inc_n /= hypot(lv_creal(phase_inc_n), lv_cimag(phase_inc_n));
+    volk_64fc_s64fc_x2_rotator_64fc_neonv8(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64fc_s32fc_rotatorpuppet_64fc_H */
@@ -0,0 +1,278 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64fc_s64fc_x2_rotator_64fc
+ *
+ * \b Overview
+ *
+ * Rotates a complex double vector at a fixed rate per sample from an
+ * initial phase, the double precision volk_32fc_s32fc_x2_rotator_32fc:
+ * outVector[i] = inVector[i] * phase * phase_inc^i. On return phase holds
+ * the phase of the next sample, so consecutive calls continue the rotation.
+ * The phase is scaled back to unit magnitude every 512 samples and at the
+ * end of every call.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64fc_s64fc_x2_rotator_64fc(lv_64fc_t* outVector, const lv_64fc_t* inVector,
+ *                                      const lv_64fc_t phase_inc, lv_64fc_t* phase,
+ *                                      unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: Vector to be rotated.
+ * \li phase_inc: The rotation per sample, of unit magnitude.
+ * \li phase: The initial phase, of unit magnitude.
+ * \li num_points: The number of values in inVector to be rotated.
+ *
+ * \b Outputs
+ * \li outVector: The rotated vector.
+ * \li phase: The phase of the sample after the last one.
+ *
+ * \b Example
+ * Shift a tone at f=0.3 up to f=0.4.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_64fc_t* in  = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *   lv_64fc_t* out = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cos(0.3 * ii), sin(0.3 * ii));
+ *   }
+ *   lv_64fc_t phase_increment = lv_cmake(cos(0.1), sin(0.1));
+ *   lv_64fc_t phase = lv_cmake(1., 0.);
+ *
+ *   volk_64fc_s64fc_x2_rotator_64fc(out, in, phase_increment, &phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.6f %+1.6fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64fc_s64fc_x2_rotator_64fc_u_H
+#define INCLUDED_volk_64fc_s64fc_x2_rotator_64fc_u_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+#define ROTATOR_RELOAD 512
+#define ROTATOR_RELOAD_2 (ROTATOR_RELOAD / 2)
+#define ROTATOR_RELOAD_4 (ROTATOR_RELOAD / 4)
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_64fc_s64fc_x2_rotator_64fc_generic(lv_64fc_t* outVector,
+                                                           const lv_64fc_t* inVector,
+                                                           const lv_64fc_t phase_inc,
+                                                           lv_64fc_t* phase,
+                                                           unsigned int num_points)
+{
+    unsigned int i = 0;
+    int j = 0;
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        for (j = 0; j < ROTATOR_RELOAD; ++j) {
+            *outVector++ = *inVector++ * (*phase);
+            (*phase) *= phase_inc;
+        }
+
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    }
+    for (i = 0; i < num_points % ROTATOR_RELOAD; ++i) {
+        *outVector++ = *inVector++ * (*phase);
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_64fc_s64fc_x2_rotator_64fc_u_avx(lv_64fc_t* outVector,
+                                                         const lv_64fc_t* inVector,
+                                                         const lv_64fc_t phase_inc,
+                                                         lv_64fc_t* phase,
+                                                         unsigned int num_points)
+{
+    lv_64fc_t* cPtr = outVector;
+    const lv_64fc_t* aPtr = inVector;
+    const lv_64fc_t incr = phase_inc * phase_inc;
+    __VOLK_ATTR_ALIGNED(32) lv_64fc_t phase_Ptr[2] = { (*phase), (*phase) * phase_inc };
+    unsigned int i, j;
+
+    __m256d phase_Val = _mm256_load_pd((const double*)phase_Ptr);
+    const __m256d inc_Val =
+        _mm256_setr_pd(lv_creal(incr), lv_cimag(incr), lv_creal(incr), lv_cimag(incr));
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        for (j = 0; j < ROTATOR_RELOAD_2; ++j) {
+            const __m256d aVal = _mm256_loadu_pd((const double*)aPtr);
+            _mm256_storeu_pd((double*)cPtr, _mm256_complexmul_pd(aVal, phase_Val));
+            phase_Val = _mm256_complexmul_pd(phase_Val, inc_Val);
+            aPtr += 2;
+            cPtr += 2;
+        }
+        phase_Val = _mm256_normalize_pd(phase_Val);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 2; ++i) {
+        const __m256d aVal = _mm256_loadu_pd((const double*)aPtr);
+        _mm256_storeu_pd((double*)cPtr, _mm256_complexmul_pd(aVal, phase_Val));
+        phase_Val = _mm256_complexmul_pd(phase_Val, inc_Val);
+        aPtr += 2;
+        cPtr += 2;
+    }
+    if (i) {
+        phase_Val = _mm256_normalize_pd(phase_Val);
+    }
+
+    _mm256_store_pd((double*)phase_Ptr, phase_Val);
+    (*phase) = phase_Ptr[0];
+    volk_64fc_s64fc_x2_rotator_64fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 2);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_64fc_s64fc_x2_rotator_64fc_u_avx512f(lv_64fc_t* outVector,
+                                                             const lv_64fc_t* inVector,
+                                                             const lv_64fc_t phase_inc,
+                                                             lv_64fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_64fc_t* cPtr = outVector;
+    const lv_64fc_t* aPtr = inVector;
+    __VOLK_ATTR_ALIGNED(64) lv_64fc_t phase_Ptr[4];
+    lv_64fc_t incr = lv_cmake(1., 0.);
+    unsigned int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        phase_Ptr[i] = (*phase) * incr;
+        incr *= phase_inc;
+    }
+
+    __m512d phase_Val = _mm512_load_pd((const double*)phase_Ptr);
+    const __m512d inc_Val = _mm512_setr_pd(lv_creal(incr),
+                                           lv_cimag(incr),
+                                           lv_creal(incr),
+                                           lv_cimag(incr),
+                                           lv_creal(incr),
+                                           lv_cimag(incr),
+                                           lv_creal(incr),
+                                           lv_cimag(incr));
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        for (j = 0; j < ROTATOR_RELOAD_4; ++j) {
+            const __m512d aVal = _mm512_loadu_pd((const double*)aPtr);
+            _mm512_storeu_pd((double*)cPtr, _mm512_complexmul_pd(aVal, phase_Val));
+            phase_Val = _mm512_complexmul_pd(phase_Val, inc_Val);
+            aPtr += 4;
+            cPtr += 4;
+        }
+        phase_Val = _mm512_normalize_pd(phase_Val);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 4; ++i) {
+        const __m512d aVal = _mm512_loadu_pd((const double*)aPtr);
+        _mm512_storeu_pd((double*)cPtr, _mm512_complexmul_pd(aVal, phase_Val));
+        phase_Val = _mm512_complexmul_pd(phase_Val, inc_Val);
+        aPtr += 4;
+        cPtr += 4;
+    }
+    if (i) {
+        phase_Val = _mm512_normalize_pd(phase_Val);
+    }
+
+    _mm512_store_pd((double*)phase_Ptr, phase_Val);
+    (*phase) = phase_Ptr[0];
+    volk_64fc_s64fc_x2_rotator_64fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 4);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_64fc_s64fc_x2_rotator_64fc_neonv8(lv_64fc_t* outVector,
+                                                          const lv_64fc_t* inVector,
+                                                          const lv_64fc_t phase_inc,
+                                                          lv_64fc_t* phase,
+                                                          unsigned int num_points)
+{
+    lv_64fc_t* cPtr = outVector;
+    const lv_64fc_t* aPtr = inVector;
+    const lv_64fc_t incr = phase_inc * phase_inc;
+    lv_64fc_t phase_Ptr[2] = { (*phase), (*phase) * phase_inc };
+    unsigned int i, j;
+
+    // real parts in val[0], imaginary parts in val[1]
+    float64x2x2_t phase_Val = vld2q_f64((const double*)phase_Ptr);
+    float64x2x2_t inc_Val;
+    inc_Val.val[0] = vdupq_n_f64(lv_creal(incr));
+    inc_Val.val[1] = vdupq_n_f64(lv_cimag(incr));
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        for (j = 0; j < ROTATOR_RELOAD_2; ++j) {
+            const float64x2x2_t aVal = vld2q_f64((const double*)aPtr);
+            vst2q_f64((double*)cPtr, _vmultiply_complexq_f64(aVal, phase_Val));
+            phase_Val = _vmultiply_complexq_f64(phase_Val, inc_Val);
+            aPtr += 2;
+            cPtr += 2;
+        }
+        phase_Val = _vnormalize_complexq_f64(phase_Val);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 2; ++i) {
+        const float64x2x2_t aVal = vld2q_f64((const double*)aPtr);
+        vst2q_f64((double*)cPtr, _vmultiply_complexq_f64(aVal, phase_Val));
+        phase_Val = _vmultiply_complexq_f64(phase_Val, inc_Val);
+        aPtr += 2;
+        cPtr += 2;
+    }
+    if (i) {
+        phase_Val = _vnormalize_complexq_f64(phase_Val);
+    }
+
+    vst2q_f64((double*)phase_Ptr, phase_Val);
+    (*phase) = phase_Ptr[0];
+    volk_64fc_s64fc_x2_rotator_64fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 2);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64fc_s64fc_x2_rotator_64fc_u_H */
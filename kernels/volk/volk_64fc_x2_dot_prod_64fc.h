@@ -0,0 +1,256 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64fc_x2_dot_prod_64fc
+ *
+ * \b Overview
+ *
+ * The dot product of two complex double vectors, without conjugation:
+ * result = sum over i of input[i] * taps[i].
+ *
+ * The SIMD implementations keep several partial sums and add them at
+ * the end, so their result may differ from the generic one in the last
+ * bits.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64fc_x2_dot_prod_64fc(lv_64fc_t* result, const lv_64fc_t* input,
+ *                                 const lv_64fc_t* taps, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The first vector of complex doubles.
+ * \li taps: The second vector of complex doubles.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li result: The dot product.
+ *
+ * \b Example
+ * Correlate a double precision tone against its replica.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_64fc_t* in = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *   lv_64fc_t* replica = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *   lv_64fc_t result;
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cos(0.3 * ii), sin(0.3 * ii));
+ *       replica[ii] = lv_cmake(cos(0.3 * ii), -sin(0.3 * ii));
+ *   }
+ *
+ *   volk_64fc_x2_dot_prod_64fc(&result, in, replica, N);
+ *   printf("result = %+1.12f %+1.12fj\n", lv_creal(result), lv_cimag(result)); // N
+ *
+ *   volk_free(in);
+ *   volk_free(replica);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64fc_x2_dot_prod_64fc_u_H
+#define INCLUDED_volk_64fc_x2_dot_prod_64fc_u_H
+
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_64fc_x2_dot_prod_64fc_generic(lv_64fc_t* result,
+                                                      const lv_64fc_t* input,
+                                                      const lv_64fc_t* taps,
+                                                      unsigned int num_points)
+{
+    double res[2] = { 0., 0. };
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        const double ar = lv_creal(input[number]);
+        const double ai = lv_cimag(input[number]);
+        const double br = lv_creal(taps[number]);
+        const double bi = lv_cimag(taps[number]);
+        res[0] += ar * br - ai * bi;
+        res[1] += ar * bi + ai * br;
+    }
+
+    *result = lv_cmake(res[0], res[1]);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_64fc_x2_dot_prod_64fc_u_avx(lv_64fc_t* result,
+                                                    const lv_64fc_t* input,
+                                                    const lv_64fc_t* taps,
+                                                    unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    const double* a = (const double*)input;
+    const double* b = (const double*)taps;
+    // x * real(y) and swapped x * imag(y), combined once at the end
+    __m256d sumReal = _mm256_setzero_pd();
+    __m256d sumImag = _mm256_setzero_pd();
+    __VOLK_ATTR_ALIGNED(32) double sums[4];
+    unsigned int number;
+
+    for (number = 0; number < halfPoints; number++) {
+        const __m256d x = _mm256_loadu_pd(a);
+        const __m256d y = _mm256_loadu_pd(b);
+        sumReal = _mm256_add_pd(sumReal, _mm256_mul_pd(x, _mm256_movedup_pd(y)));
+        sumImag = _mm256_add_pd(
+            sumImag, _mm256_mul_pd(_mm256_permute_pd(x, 0x5), _mm256_permute_pd(y, 0xF)));
+        a += 4;
+        b += 4;
+    }
+
+    _mm256_store_pd(sums, _mm256_addsub_pd(sumReal, sumImag));
+    lv_64fc_t tail;
+    volk_64fc_x2_dot_prod_64fc_generic(
+        &tail, (const lv_64fc_t*)a, (const lv_64fc_t*)b, num_points & 1);
+    *result = lv_cmake(sums[0] + sums[2], sums[1] + sums[3]) + tail;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_64fc_x2_dot_prod_64fc_u_avx2_fma(lv_64fc_t* result,
+                                                         const lv_64fc_t* input,
+                                                         const lv_64fc_t* taps,
+                                                         unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const double* a = (const double*)input;
+    const double* b = (const double*)taps;
+    // two sets of sums, so consecutive fused adds do not wait on each other
+    __m256d sumReal0 = _mm256_setzero_pd();
+    __m256d sumImag0 = _mm256_setzero_pd();
+    __m256d sumReal1 = _mm256_setzero_pd();
+    __m256d sumImag1 = _mm256_setzero_pd();
+    __VOLK_ATTR_ALIGNED(32) double sums[4];
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const __m256d x0 = _mm256_loadu_pd(a);
+        const __m256d y0 = _mm256_loadu_pd(b);
+        const __m256d x1 = _mm256_loadu_pd(a + 4);
+        const __m256d y1 = _mm256_loadu_pd(b + 4);
+        sumReal0 = _mm256_fmadd_pd(x0, _mm256_movedup_pd(y0), sumReal0);
+        sumImag0 = _mm256_fmadd_pd(
+            _mm256_permute_pd(x0, 0x5), _mm256_permute_pd(y0, 0xF), sumImag0);
+        sumReal1 = _mm256_fmadd_pd(x1, _mm256_movedup_pd(y1), sumReal1);
+        sumImag1 = _mm256_fmadd_pd(
+            _mm256_permute_pd(x1, 0x5), _mm256_permute_pd(y1, 0xF), sumImag1);
+        a += 8;
+        b += 8;
+    }
+
+    _mm256_store_pd(sums,
+                    _mm256_addsub_pd(_mm256_add_pd(sumReal0, sumReal1),
+                                     _mm256_add_pd(sumImag0, sumImag1)));
+    lv_64fc_t tail;
+    volk_64fc_x2_dot_prod_64fc_generic(
+        &tail, (const lv_64fc_t*)a, (const lv_64fc_t*)b, num_points & 3);
+    *result = lv_cmake(sums[0] + sums[2], sums[1] + sums[3]) + tail;
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_64fc_x2_dot_prod_64fc_u_avx512f(lv_64fc_t* result,
+                                                        const lv_64fc_t* input,
+                                                        const lv_64fc_t* taps,
+                                                        unsigned int num_points)
+{
+    const double* a = (const double*)input;
+    const double* b = (const double*)taps;
+    __m512d sumReal = _mm512_setzero_pd();
+    __m512d sumImag = _mm512_setzero_pd();
+    unsigned int number;
+
+    for (number = 0; number < num_points; number += 4) {
+        // the last points with a masked load, two doubles a point
+        const unsigned int remaining = num_points - number;
+        const __mmask8 mask =
+            (__mmask8)(remaining < 4 ? (1u << (2 * remaining)) - 1 : 0xff);
+        const __m512d x = _mm512_maskz_loadu_pd(mask, a);
+        const __m512d y = _mm512_maskz_loadu_pd(mask, b);
+        sumReal = _mm512_fmadd_pd(x, _mm512_movedup_pd(y), sumReal);
+        sumImag = _mm512_fmadd_pd(
+            _mm512_permute_pd(x, 0x55), _mm512_permute_pd(y, 0xFF), sumImag);
+        a += 8;
+        b += 8;
+    }
+
+    // real parts in the even lanes, imaginary parts in the odd ones
+    const __m512d sum = _mm512_fmaddsub_pd(_mm512_set1_pd(1.), sumReal, sumImag);
+    *result = lv_cmake(_mm512_mask_reduce_add_pd(0x55, sum),
+                       _mm512_mask_reduce_add_pd(0xaa, sum));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_64fc_x2_dot_prod_64fc_neonv8(lv_64fc_t* result,
+                                                     const lv_64fc_t* input,
+                                                     const lv_64fc_t* taps,
+                                                     unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    const double* a = (const double*)input;
+    const double* b = (const double*)taps;
+    float64x2_t sumReal = vdupq_n_f64(0.);
+    float64x2_t sumImag = vdupq_n_f64(0.);
+    unsigned int number;
+
+    for (number = 0; number < halfPoints; number++) {
+        // real parts in val[0], imaginary parts in val[1]
+        const float64x2x2_t x = vld2q_f64(a);
+        const float64x2x2_t y = vld2q_f64(b);
+        sumReal = vfmaq_f64(sumReal, x.val[0], y.val[0]);
+        sumReal = vfmsq_f64(sumReal, x.val[1], y.val[1]);
+        sumImag = vfmaq_f64(sumImag, x.val[0], y.val[1]);
+        sumImag = vfmaq_f64(sumImag, x.val[1], y.val[0]);
+        a += 4;
+        b += 4;
+    }
+
+    lv_64fc_t tail;
+    volk_64fc_x2_dot_prod_64fc_generic(
+        &tail, (const lv_64fc_t*)a, (const lv_64fc_t*)b, num_points & 1);
+    *result = lv_cmake(vaddvq_f64(sumReal), vaddvq_f64(sumImag)) + tail;
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64fc_x2_dot_prod_64fc_u_H */
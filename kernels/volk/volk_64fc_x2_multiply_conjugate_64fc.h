@@ -0,0 +1,217 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_64fc_x2_multiply_conjugate_64fc
+ *
+ * \b Overview
+ *
+ * Multiplies a complex double vector by the complex conjugate of a second
+ * one point by point, cVector[i] = aVector[i] * conj(bVector[i]).
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_64fc_x2_multiply_conjugate_64fc(lv_64fc_t* cVector,
+ *                                           const lv_64fc_t* aVector,
+ *                                           const lv_64fc_t* bVector,
+ *                                           unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The first input vector of complex doubles.
+ * \li bVector: The input vector of complex doubles to conjugate.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li cVector: The products.
+ *
+ * \b Example
+ * Mix a double precision tone down to baseband with the conjugate of
+ * a copy of itself.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_64fc_t* in = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *   lv_64fc_t* lo = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *   lv_64fc_t* out = (lv_64fc_t*)volk_malloc(sizeof(lv_64fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(cos(0.3 * ii), sin(0.3 * ii));
+ *       lo[ii] = lv_cmake(cos(0.3 * ii), sin(0.3 * ii));
+ *   }
+ *
+ *   volk_64fc_x2_multiply_conjugate_64fc(out, in, lo, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.15f %+1.15fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(lo);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_64fc_x2_multiply_conjugate_64fc_u_H
+#define INCLUDED_volk_64fc_x2_multiply_conjugate_64fc_u_H
+
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_64fc_x2_multiply_conjugate_64fc_generic(lv_64fc_t* cVector,
+                                                                const lv_64fc_t* aVector,
+                                                                const lv_64fc_t* bVector,
+                                                                unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        *cVector++ = (*aVector++) * lv_conj(*bVector++);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_64fc_x2_multiply_conjugate_64fc_u_avx(lv_64fc_t* cVector,
+                                                              const lv_64fc_t* aVector,
+                                                              const lv_64fc_t* bVector,
+                                                              unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    unsigned int number;
+
+    for (number = 0; number < halfPoints; number++) {
+        const __m256d x = _mm256_loadu_pd((const double*)aVector);
+        const __m256d y = _mm256_loadu_pd((const double*)bVector);
+        _mm256_storeu_pd((double*)cVector, _mm256_complexconjugatemul_pd(x, y));
+        aVector += 2;
+        bVector += 2;
+        cVector += 2;
+    }
+
+    volk_64fc_x2_multiply_conjugate_64fc_generic(
+        cVector, aVector, bVector, num_points & 1);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void
+volk_64fc_x2_multiply_conjugate_64fc_u_avx2_fma(lv_64fc_t* cVector,
+                                                const lv_64fc_t* aVector,
+                                                const lv_64fc_t* bVector,
+                                                unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    unsigned int number;
+
+    for (number = 0; number < halfPoints; number++) {
+        const __m256d x = _mm256_loadu_pd((const double*)aVector);
+        const __m256d y = _mm256_loadu_pd((const double*)bVector);
+        const __m256d z = _mm256_complexconjugatemul_pd_avx2_fma(x, y);
+        _mm256_storeu_pd((double*)cVector, z);
+        aVector += 2;
+        bVector += 2;
+        cVector += 2;
+    }
+
+    volk_64fc_x2_multiply_conjugate_64fc_generic(
+        cVector, aVector, bVector, num_points & 1);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_64fc_x2_multiply_conjugate_64fc_u_avx512f(lv_64fc_t* cVector,
+                                               const lv_64fc_t* aVector,
+                                               const lv_64fc_t* bVector,
+                                               unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const double* a = (const double*)aVector;
+    const double* b = (const double*)bVector;
+    double* c = (double*)cVector;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        const __m512d x = _mm512_loadu_pd(a);
+        const __m512d y = _mm512_loadu_pd(b);
+        _mm512_storeu_pd(c, _mm512_complexconjugatemul_pd(x, y));
+        a += 8;
+        b += 8;
+        c += 8;
+    }
+
+    // the last points with a masked load and store, two doubles a point
+    const __mmask8 mask = (__mmask8)((1u << (2 * (num_points & 3))) - 1);
+    const __m512d x = _mm512_maskz_loadu_pd(mask, a);
+    const __m512d y = _mm512_maskz_loadu_pd(mask, b);
+    _mm512_mask_storeu_pd(c, mask, _mm512_complexconjugatemul_pd(x, y));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_64fc_x2_multiply_conjugate_64fc_neonv8(lv_64fc_t* cVector,
+                                                               const lv_64fc_t* aVector,
+                                                               const lv_64fc_t* bVector,
+                                                               unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+    unsigned int number;
+
+    for (number = 0; number < halfPoints; number++) {
+        // real parts in val[0], imaginary parts in val[1]
+        const float64x2x2_t x = vld2q_f64((const double*)aVector);
+        float64x2x2_t y = vld2q_f64((const double*)bVector);
+        y.val[1] = vnegq_f64(y.val[1]);
+        vst2q_f64((double*)cVector, _vmultiply_complexq_f64(x, y));
+        aVector += 2;
+        bVector += 2;
+        cVector += 2;
+    }
+
+    volk_64fc_x2_multiply_conjugate_64fc_generic(
+        cVector, aVector, bVector, num_points & 1);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_64fc_x2_multiply_conjugate_64fc_u_H */
@@ -334,6 +334,36 @@ static inline void volk_64u_byteswap_neon(uint64_t* intsToSwap, unsigned int num
 #endif /* LV_HAVE_NEON */
 #endif
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+static inline void volk_64u_byteswap_u_avx512bw(uint64_t* intsToSwap,
+                                                unsigned int num_points)
+{
+    const unsigned int nPerSet = 8;
+    const unsigned int nSets = num_points / nPerSet;
+    const unsigned int nRemaining = num_points % nPerSet;
+
+    uint64_t* inputPtr = intsToSwap;
+
+    // reverse the bytes of each element within every 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    for (unsigned int number = 0; number < nSets; number++) {
+        const __m512i input = _mm512_loadu_si512((void*)inputPtr);
+        _mm512_storeu_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += nPerSet;
+    }
+
+    // Byteswap the remaining points with a masked load and store
+    if (nRemaining) {
+        const __mmask8 mask = _cvtu32_mask8((1u << nRemaining) - 1);
+        const __m512i input = _mm512_maskz_loadu_epi64(mask, inputPtr);
+        _mm512_mask_storeu_epi64(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #endif /* INCLUDED_volk_64u_byteswap_u_H */
 #ifndef INCLUDED_volk_64u_byteswap_a_H
 #define INCLUDED_volk_64u_byteswap_a_H
@@ -513,4 +543,34 @@ static inline void volk_64u_byteswap_a_generic(uint64_t* intsToSwap,
 #endif /* LV_HAVE_GENERIC */
 
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+static inline void volk_64u_byteswap_a_avx512bw(uint64_t* intsToSwap,
+                                                unsigned int num_points)
+{
+    const unsigned int nPerSet = 8;
+    const unsigned int nSets = num_points / nPerSet;
+    const unsigned int nRemaining = num_points % nPerSet;
+
+    uint64_t* inputPtr = intsToSwap;
+
+    // reverse the bytes of each element within every 128 bit lane
+    const __m512i myShuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+
+    for (unsigned int number = 0; number < nSets; number++) {
+        const __m512i input = _mm512_load_si512((void*)inputPtr);
+        _mm512_store_si512((void*)inputPtr, _mm512_shuffle_epi8(input, myShuffle));
+        inputPtr += nPerSet;
+    }
+
+    // Byteswap the remaining points with a masked load and store
+    if (nRemaining) {
+        const __mmask8 mask = _cvtu32_mask8((1u << nRemaining) - 1);
+        const __m512i input = _mm512_maskz_loadu_epi64(mask, inputPtr);
+        _mm512_mask_storeu_epi64(inputPtr, mask, _mm512_shuffle_epi8(input, myShuffle));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #endif /* INCLUDED_volk_64u_byteswap_a_H */
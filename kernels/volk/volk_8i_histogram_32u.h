@@ -0,0 +1,136 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8i_histogram_32u
+ *
+ * \b Overview
+ *
+ * Counts the values of a vector of 8 bit samples into a histogram of 256
+ * bins, bin b counting the value b - 128. The counts are added to the
+ * histogram, so zero it before the first call and keep adding the following
+ * buffers to it.
+ *
+ * Counting in one table stalls on runs of equal samples, each increment
+ * waiting for the store of the previous one: the generic_lanes version counts
+ * into four tables in turn and sums them at the end, the avx512cd version
+ * counts 16 samples at a time with conflict detection.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8i_histogram_32u(uint32_t* histogram, const int8_t* inputVector,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li histogram: The 256 counts to add to.
+ * \li inputVector: The samples.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li histogram: The counts, with those of the samples added.
+ *
+ * \b Example
+ * The fraction of clipped samples of an 8 bit ADC.
+ * \code
+ *   uint32_t histogram[256] = { 0 };
+ *
+ *   volk_8i_histogram_32u(histogram, samples, N);
+ *
+ *   printf("clipped %f\n", (float)(histogram[0] + histogram[255]) / N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8i_histogram_32u_H
+#define INCLUDED_volk_8i_histogram_32u_H
+
+#include <inttypes.h>
+#include <string.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8i_histogram_32u_generic(uint32_t* histogram,
+                                                 const int8_t* inputVector,
+                                                 unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        histogram[(uint8_t)inputVector[number] ^ 0x80]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8i_histogram_32u_generic_lanes(uint32_t* histogram,
+                                                       const int8_t* inputVector,
+                                                       unsigned int num_points)
+{
+    const unsigned int quarter_points = num_points / 4;
+    uint32_t lanes[4][256];
+    unsigned int number, bin;
+
+    memset(lanes, 0, sizeof(lanes));
+    for (number = 0; number < quarter_points; number++) {
+        lanes[0][(uint8_t)inputVector[4 * number] ^ 0x80]++;
+        lanes[1][(uint8_t)inputVector[4 * number + 1] ^ 0x80]++;
+        lanes[2][(uint8_t)inputVector[4 * number + 2] ^ 0x80]++;
+        lanes[3][(uint8_t)inputVector[4 * number + 3] ^ 0x80]++;
+    }
+    for (number = quarter_points * 4; number < num_points; number++) {
+        lanes[0][(uint8_t)inputVector[number] ^ 0x80]++;
+    }
+
+    for (bin = 0; bin < 256; bin++) {
+        histogram[bin] += lanes[0][bin] + lanes[1][bin] + lanes[2][bin] + lanes[3][bin];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_8i_histogram_32u_avx512cd(uint32_t* histogram,
+                                                  const int8_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenth_points = num_points / 16;
+    const __m512i offset = _mm512_set1_epi32(128);
+    __m512i idx;
+    unsigned int number;
+
+    for (number = 0; number < sixteenth_points; number++) {
+        idx = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)inputVector));
+        _mm512_mask_histogram_add_epi32(histogram, 0xffff, _mm512_add_epi32(idx, offset));
+        inputVector += 16;
+    }
+
+    volk_8i_histogram_32u_generic(histogram, inputVector, num_points - number * 16);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_volk_8i_histogram_32u_H */
@@ -0,0 +1,107 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8i_histogram_32u.h'
+ */
+
+#ifndef INCLUDED_volk_8i_histogrampuppet_32u_H
+#define INCLUDED_volk_8i_histogrampuppet_32u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_8i_histogram_32u.h>
+
+/*
+ * Counts the input in two halves into a zeroed table of the 256 bins and
+ * folds the table into the num_points outputs.
+ */
+static inline void
+volk_8i_histogram_puppet(void (*kernel)(uint32_t*, const int8_t*, unsigned int),
+                         uint32_t* histogram,
+                         const int8_t* inputVector,
+                         unsigned int num_points)
+{
+    uint32_t* bins =
+        (uint32_t*)volk_malloc(sizeof(uint32_t) * 256, volk_get_alignment());
+    unsigned int bin;
+
+    memset(bins, 0, sizeof(uint32_t) * 256);
+    kernel(bins, inputVector, num_points / 2);
+    kernel(bins, inputVector + num_points / 2, num_points - num_points / 2);
+
+    memset(histogram, 0, sizeof(uint32_t) * num_points);
+    if (num_points > 0) {
+        for (bin = 0; bin < 256; bin++) {
+            histogram[bin % num_points] += bins[bin];
+        }
+    }
+
+    volk_free(bins);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8i_histogrampuppet_32u_generic(uint32_t* histogram,
+                                                       const int8_t* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_8i_histogram_puppet(volk_8i_histogram_32u_generic,
+                             histogram,
+                             inputVector,
+                             num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8i_histogrampuppet_32u_generic_lanes(uint32_t* histogram,
+                                                             const int8_t* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_8i_histogram_puppet(volk_8i_histogram_32u_generic_lanes,
+                             histogram,
+                             inputVector,
+                             num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512CD
+
+static inline void volk_8i_histogrampuppet_32u_avx512cd(uint32_t* histogram,
+                                                        const int8_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_8i_histogram_puppet(volk_8i_histogram_32u_avx512cd,
+                             histogram,
+                             inputVector,
+                             num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512CD */
+
+#endif /* INCLUDED_volk_8i_histogrampuppet_32u_H */
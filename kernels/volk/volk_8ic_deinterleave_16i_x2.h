@@ -57,6 +57,68 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8ic_deinterleave_16i_x2_a_avx512bw(int16_t* iBuffer,
+                                                           int16_t* qBuffer,
+                                                           const lv_8sc_t* complexVector,
+                                                           unsigned int num_points)
+{
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+    int16_t* qBufferPtr = qBuffer;
+
+    // even and odd int16 of the two widened halves
+    const __m512i iIndex = _mm512_set_epi16(62, 60, 58, 56, 54, 52, 50, 48,
+                                            46, 44, 42, 40, 38, 36, 34, 32,
+                                            30, 28, 26, 24, 22, 20, 18, 16,
+                                            14, 12, 10, 8,  6,  4,  2,  0);
+    const __m512i qIndex = _mm512_add_epi16(iIndex, _mm512_set1_epi16(1));
+
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const unsigned int nRemaining = num_points % 32;
+
+    __m512i complexVal, complexVal1, complexVal2;
+
+    for (unsigned int number = 0; number < thirtysecondPoints; number++) {
+        complexVal = _mm512_load_si512((void*)complexVectorPtr);
+        complexVectorPtr += 64;
+
+        // sign extend and scale by 256
+        complexVal1 = _mm512_slli_epi16(
+            _mm512_cvtepi8_epi16(_mm512_castsi512_si256(complexVal)), 8);
+        complexVal2 = _mm512_slli_epi16(
+            _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(complexVal, 1)), 8);
+
+        _mm512_store_si512((void*)iBufferPtr,
+                           _mm512_permutex2var_epi16(complexVal1, iIndex, complexVal2));
+        _mm512_store_si512((void*)qBufferPtr,
+                           _mm512_permutex2var_epi16(complexVal1, qIndex, complexVal2));
+
+        iBufferPtr += 32;
+        qBufferPtr += 32;
+    }
+
+    // Deinterleave the remaining points with a masked load and stores
+    if (nRemaining) {
+        const __mmask64 inMask = _cvtu64_mask64((1ull << (2 * nRemaining)) - 1);
+        const __mmask32 outMask = _cvtu32_mask32((1u << nRemaining) - 1);
+        complexVal = _mm512_maskz_loadu_epi8(inMask, complexVectorPtr);
+
+        complexVal1 = _mm512_slli_epi16(
+            _mm512_cvtepi8_epi16(_mm512_castsi512_si256(complexVal)), 8);
+        complexVal2 = _mm512_slli_epi16(
+            _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(complexVal, 1)), 8);
+
+        _mm512_mask_storeu_epi16(
+            iBufferPtr, outMask, _mm512_permutex2var_epi16(complexVal1, iIndex, complexVal2));
+        _mm512_mask_storeu_epi16(
+            qBufferPtr, outMask, _mm512_permutex2var_epi16(complexVal1, qIndex, complexVal2));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -324,6 +386,68 @@ static inline void volk_8ic_deinterleave_16i_x2_generic(int16_t* iBuffer,
 #include <inttypes.h>
 #include <stdio.h>
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8ic_deinterleave_16i_x2_u_avx512bw(int16_t* iBuffer,
+                                                           int16_t* qBuffer,
+                                                           const lv_8sc_t* complexVector,
+                                                           unsigned int num_points)
+{
+    const int8_t* complexVectorPtr = (const int8_t*)complexVector;
+    int16_t* iBufferPtr = iBuffer;
+    int16_t* qBufferPtr = qBuffer;
+
+    // even and odd int16 of the two widened halves
+    const __m512i iIndex = _mm512_set_epi16(62, 60, 58, 56, 54, 52, 50, 48,
+                                            46, 44, 42, 40, 38, 36, 34, 32,
+                                            30, 28, 26, 24, 22, 20, 18, 16,
+                                            14, 12, 10, 8,  6,  4,  2,  0);
+    const __m512i qIndex = _mm512_add_epi16(iIndex, _mm512_set1_epi16(1));
+
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const unsigned int nRemaining = num_points % 32;
+
+    __m512i complexVal, complexVal1, complexVal2;
+
+    for (unsigned int number = 0; number < thirtysecondPoints; number++) {
+        complexVal = _mm512_loadu_si512((void*)complexVectorPtr);
+        complexVectorPtr += 64;
+
+        // sign extend and scale by 256
+        complexVal1 = _mm512_slli_epi16(
+            _mm512_cvtepi8_epi16(_mm512_castsi512_si256(complexVal)), 8);
+        complexVal2 = _mm512_slli_epi16(
+            _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(complexVal, 1)), 8);
+
+        _mm512_storeu_si512((void*)iBufferPtr,
+                           _mm512_permutex2var_epi16(complexVal1, iIndex, complexVal2));
+        _mm512_storeu_si512((void*)qBufferPtr,
+                           _mm512_permutex2var_epi16(complexVal1, qIndex, complexVal2));
+
+        iBufferPtr += 32;
+        qBufferPtr += 32;
+    }
+
+    // Deinterleave the remaining points with a masked load and stores
+    if (nRemaining) {
+        const __mmask64 inMask = _cvtu64_mask64((1ull << (2 * nRemaining)) - 1);
+        const __mmask32 outMask = _cvtu32_mask32((1u << nRemaining) - 1);
+        complexVal = _mm512_maskz_loadu_epi8(inMask, complexVectorPtr);
+
+        complexVal1 = _mm512_slli_epi16(
+            _mm512_cvtepi8_epi16(_mm512_castsi512_si256(complexVal)), 8);
+        complexVal2 = _mm512_slli_epi16(
+            _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(complexVal, 1)), 8);
+
+        _mm512_mask_storeu_epi16(
+            iBufferPtr, outMask, _mm512_permutex2var_epi16(complexVal1, iIndex, complexVal2));
+        _mm512_mask_storeu_epi16(
+            qBufferPtr, outMask, _mm512_permutex2var_epi16(complexVal1, qIndex, complexVal2));
+    }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512BW */
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -0,0 +1,127 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_s32f_x2_offset_convert_32fc.h'
+ *
+ * The kernel reads two bytes a point, which the tests only allocate for a
+ * complex input, so the puppet takes the bytes as 8ic and uses the RTL-SDR
+ * offset of 127.5.
+ */
+
+#ifndef INCLUDED_volk_8ic_s32f_offset_convertpuppet_32fc_H
+#define INCLUDED_volk_8ic_s32f_offset_convertpuppet_32fc_H
+
+#include <volk/volk_8u_s32f_x2_offset_convert_32fc.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_8ic_s32f_offset_convertpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                const lv_8sc_t* inputVector,
+                                                const float scale,
+                                                unsigned int num_points)
+{
+    volk_8u_s32f_x2_offset_convert_32fc_generic(
+        outputVector, (const uint8_t*)inputVector, 127.5f, scale, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_8ic_s32f_offset_convertpuppet_32fc_a_avx2(lv_32fc_t* outputVector,
+                                               const lv_8sc_t* inputVector,
+                                               const float scale,
+                                               unsigned int num_points)
+{
+    volk_8u_s32f_x2_offset_convert_32fc_a_avx2(
+        outputVector, (const uint8_t*)inputVector, 127.5f, scale, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_8ic_s32f_offset_convertpuppet_32fc_u_avx2(lv_32fc_t* outputVector,
+                                               const lv_8sc_t* inputVector,
+                                               const float scale,
+                                               unsigned int num_points)
+{
+    volk_8u_s32f_x2_offset_convert_32fc_u_avx2(
+        outputVector, (const uint8_t*)inputVector, 127.5f, scale, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_8ic_s32f_offset_convertpuppet_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                                  const lv_8sc_t* inputVector,
+                                                  const float scale,
+                                                  unsigned int num_points)
+{
+    volk_8u_s32f_x2_offset_convert_32fc_a_avx512f(
+        outputVector, (const uint8_t*)inputVector, 127.5f, scale, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_8ic_s32f_offset_convertpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                  const lv_8sc_t* inputVector,
+                                                  const float scale,
+                                                  unsigned int num_points)
+{
+    volk_8u_s32f_x2_offset_convert_32fc_u_avx512f(
+        outputVector, (const uint8_t*)inputVector, 127.5f, scale, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_8ic_s32f_offset_convertpuppet_32fc_neon(lv_32fc_t* outputVector,
+                                             const lv_8sc_t* inputVector,
+                                             const float scale,
+                                             unsigned int num_points)
+{
+    volk_8u_s32f_x2_offset_convert_32fc_neon(
+        outputVector, (const uint8_t*)inputVector, 127.5f, scale, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8ic_s32f_offset_convertpuppet_32fc_H */
@@ -0,0 +1,292 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8ic_s32fc_x2_rotator_32fc
+ *
+ * \b Overview
+ *
+ * Rotates a complex 8-bit integer vector at a fixed rate per sample from an
+ * initial phase into complex floats, as volk_32fc_s32fc_x2_rotator_32fc does for
+ * floats, so a tuner reads the front end samples once instead of converting them
+ * first and rotating them in a second pass. The outputs are in the units of the
+ * input; a scale can be folded into a later stage such as a filter.
+ *
+ * The SIMD versions keep the phases of consecutive samples in the lanes of float
+ * registers and step them by phase_inc to the power of the lane count. Every
+ * ROTATOR_RELOAD samples they re-seed the lanes from phases computed in double
+ * precision, so the rounding does not build up.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8ic_s32fc_x2_rotator_32fc(lv_32fc_t* outVector, const lv_8sc_t* inVector,
+ * const lv_32fc_t phase_inc, lv_32fc_t* phase, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The vector to rotate.
+ * \li phase_inc: The rotation per sample, of magnitude one.
+ * \li phase: The initial phase, of magnitude one; updated to the phase of the
+ *     next sample.
+ * \li num_points: The number of complex values.
+ *
+ * \b Outputs
+ * \li outVector: The rotated vector.
+ *
+ * \b Example
+ * Shift a constant input by f=0.1.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_8sc_t* in = (lv_8sc_t*)volk_malloc(sizeof(lv_8sc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake(100, 0);
+ *   }
+ *   lv_32fc_t phase_increment = lv_cmake(std::cos(0.1f), std::sin(0.1f));
+ *   lv_32fc_t phase = lv_cmake(1.f, 0.f);
+ *
+ *   volk_8ic_s32fc_x2_rotator_32fc(out, in, phase_increment, &phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8ic_s32fc_x2_rotator_32fc_H
+#define INCLUDED_volk_8ic_s32fc_x2_rotator_32fc_H
+
+#include <math.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+/* An 8ic sample as a complex float */
+static inline lv_32fc_t volk_rotator_8ic_sample(const lv_8sc_t* in)
+{
+    return lv_cmake((float)((const int8_t*)in)[0], (float)((const int8_t*)in)[1]);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8ic_s32fc_x2_rotator_32fc_generic(lv_32fc_t* outVector,
+                                                          const lv_8sc_t* inVector,
+                                                          const lv_32fc_t phase_inc,
+                                                          lv_32fc_t* phase,
+                                                          unsigned int num_points)
+{
+    unsigned int i = 0;
+    int j = 0;
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        for (j = 0; j < ROTATOR_RELOAD; ++j) {
+            *outVector++ = volk_rotator_8ic_sample(inVector++) * (*phase);
+            (*phase) *= phase_inc;
+        }
+
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+    for (i = 0; i < num_points % ROTATOR_RELOAD; ++i) {
+        *outVector++ = volk_rotator_8ic_sample(inVector++) * (*phase);
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_8ic_s32fc_x2_rotator_32fc_u_avx2(lv_32fc_t* outVector,
+                                                         const lv_8sc_t* inVector,
+                                                         const lv_32fc_t phase_inc,
+                                                         lv_32fc_t* phase,
+                                                         unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t phases[8];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    __m256 p0, p1, x0, x1;
+    __m128i x;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 8, 1);
+    const __m256 incVec = _mm256_setr_ps(lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_exact_phases(phases, *phase, phase_inc, i, 8);
+        p0 = _mm256_load_ps((const float*)phases);
+        p1 = _mm256_load_ps((const float*)(phases + 4));
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 8; j++) {
+            x = _mm_loadu_si128((const __m128i*)inVector);
+            x0 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(x));
+            x1 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(x, 8)));
+            _mm256_storeu_ps((float*)outVector, _mm256_complexmul_ps(x0, p0));
+            _mm256_storeu_ps((float*)(outVector + 4), _mm256_complexmul_ps(x1, p1));
+            p0 = _mm256_complexmul_ps(p0, incVec);
+            p1 = _mm256_complexmul_ps(p1, incVec);
+            inVector += 8;
+            outVector += 8;
+        }
+
+        // the lanes hold the phases of the samples left in the block
+        _mm256_store_ps((float*)phases, p0);
+        _mm256_store_ps((float*)(phases + 4), p1);
+        for (j = 0; j < block_points % 8; j++) {
+            *outVector++ = volk_rotator_8ic_sample(inVector++) * phases[j];
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_8ic_s32fc_x2_rotator_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                            const lv_8sc_t* inVector,
+                                                            const lv_32fc_t phase_inc,
+                                                            lv_32fc_t* phase,
+                                                            unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phases[16];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    __m512 p0, p1, x0, x1;
+    __m256i x;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 16, 1);
+    const __m512 incVec = _mm512_setr4_ps(
+        lv_creal(incr), lv_cimag(incr), lv_creal(incr), lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_exact_phases(phases, *phase, phase_inc, i, 16);
+        p0 = _mm512_load_ps((const float*)phases);
+        p1 = _mm512_load_ps((const float*)(phases + 8));
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 16; j++) {
+            x = _mm256_loadu_si256((const __m256i*)inVector);
+            x0 = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm256_castsi256_si128(x)));
+            x1 = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm256_extracti128_si256(x, 1)));
+            _mm512_storeu_ps((float*)outVector, _mm512_complexmul_ps(x0, p0));
+            _mm512_storeu_ps((float*)(outVector + 8), _mm512_complexmul_ps(x1, p1));
+            p0 = _mm512_complexmul_ps(p0, incVec);
+            p1 = _mm512_complexmul_ps(p1, incVec);
+            inVector += 16;
+            outVector += 16;
+        }
+
+        // the lanes hold the phases of the samples left in the block
+        _mm512_store_ps((float*)phases, p0);
+        _mm512_store_ps((float*)(phases + 8), p1);
+        for (j = 0; j < block_points % 16; j++) {
+            *outVector++ = volk_rotator_8ic_sample(inVector++) * phases[j];
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_8ic_s32fc_x2_rotator_32fc_neonv8(lv_32fc_t* outVector,
+                                                         const lv_8sc_t* inVector,
+                                                         const lv_32fc_t phase_inc,
+                                                         lv_32fc_t* phase,
+                                                         unsigned int num_points)
+{
+    lv_32fc_t phases[8];
+    lv_32fc_t incr;
+    unsigned int i, j, block_points;
+    float32x4x2_t p0, p1, incVec, x0, x1;
+    int8x8x2_t x;
+    int16x8_t re, im;
+
+    volk_rotator_exact_phases(&incr, lv_cmake(1.f, 0.f), phase_inc, 8, 1);
+    incVec.val[0] = vdupq_n_f32(lv_creal(incr));
+    incVec.val[1] = vdupq_n_f32(lv_cimag(incr));
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        volk_rotator_exact_phases(phases, *phase, phase_inc, i, 8);
+        p0 = vld2q_f32((const float*)phases);
+        p1 = vld2q_f32((const float*)(phases + 4));
+        block_points =
+            num_points - i < ROTATOR_RELOAD ? num_points - i : ROTATOR_RELOAD;
+
+        for (j = 0; j < block_points / 8; j++) {
+            x = vld2_s8((const int8_t*)inVector);
+            re = vmovl_s8(x.val[0]);
+            im = vmovl_s8(x.val[1]);
+            x0.val[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(re)));
+            x0.val[1] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(im)));
+            x1.val[0] = vcvtq_f32_s32(vmovl_high_s16(re));
+            x1.val[1] = vcvtq_f32_s32(vmovl_high_s16(im));
+            vst2q_f32((float*)outVector, _vmultiply_complexq_f32_fma(x0, p0));
+            vst2q_f32((float*)(outVector + 4), _vmultiply_complexq_f32_fma(x1, p1));
+            p0 = _vmultiply_complexq_f32_fma(p0, incVec);
+            p1 = _vmultiply_complexq_f32_fma(p1, incVec);
+            inVector += 8;
+            outVector += 8;
+        }
+
+        // the lanes hold the phases of the samples left in the block
+        vst2q_f32((float*)phases, p0);
+        vst2q_f32((float*)(phases + 4), p1);
+        for (j = 0; j < block_points % 8; j++) {
+            *outVector++ = volk_rotator_8ic_sample(inVector++) * phases[j];
+        }
+    }
+
+    volk_rotator_exact_phases(phase, *phase, phase_inc, num_points, 1);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8ic_s32fc_x2_rotator_32fc_H */
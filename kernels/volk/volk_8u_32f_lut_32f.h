@@ -0,0 +1,203 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*!
+ * \page volk_8u_32f_lut_32f
+ *
+ * \b Overview
+ *
+ * Maps each byte to the float at its index in a table of 256 entries, e.g.
+ * to expand mu-law or A-law samples or to correct the non-linearity of an
+ * 8-bit ADC in the same pass as the conversion to float.
+ *
+ * Whether a table lookup is fastest as a gather or as a tree of in-register
+ * permutes depends on the machine, so both are offered for volk_profile to
+ * choose from. The AVX-512 permute version keeps the table in 16 registers
+ * and picks each output from eight two-register permutes with the upper
+ * three bits of the index.
+ *
+ * For 12-bit or 16-bit samples, see volk_16u_32f_lut_32f.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_32f_lut_32f(float* outputVector, const uint8_t* inputVector,
+ * const float* table, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The indices into the table.
+ * \li table: The 256 floats to map the bytes to.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: outputVector[n] = table[inputVector[n]].
+ *
+ * \b Example
+ * Expand G.711 mu-law bytes, with a table made once.
+ * \code
+ *   int N = 160;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(sizeof(uint8_t)*N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float table[256];
+ *
+ *   for(unsigned int ii = 0; ii < 256; ++ii){
+ *       unsigned int code = ~ii & 0xff;
+ *       int magnitude = ((((code & 0x0f) << 3) + 0x84) << ((code >> 4) & 7)) - 0x84;
+ *       table[ii] = (code & 0x80 ? -magnitude : magnitude) / 32768.f;
+ *   }
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = (uint8_t)(ii * 37);
+ *   }
+ *
+ *   volk_8u_32f_lut_32f(out, in, table, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_32f_lut_32f_u_H
+#define INCLUDED_volk_8u_32f_lut_32f_u_H
+
+#include <inttypes.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_32f_lut_32f_generic(float* outputVector,
+                                               const uint8_t* inputVector,
+                                               const float* table,
+                                               unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        outputVector[number] = table[inputVector[number]];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_32f_lut_32f_u_avx2_gather(float* outputVector,
+                                                     const uint8_t* inputVector,
+                                                     const float* table,
+                                                     unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __m256i index;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        index = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)inputVector));
+        _mm256_storeu_ps(outputVector, _mm256_i32gather_ps(table, index, 4));
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++];
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_8u_32f_lut_32f_u_avx512f_gather(float* outputVector,
+                                                        const uint8_t* inputVector,
+                                                        const float* table,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m512i index;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        index = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)inputVector));
+        _mm512_storeu_ps(outputVector, _mm512_i32gather_ps(index, table, 4));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++];
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_8u_32f_lut_32f_u_avx512f(float* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 const float* table,
+                                                 unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i bit5 = _mm512_set1_epi32(0x20);
+    const __m512i bit6 = _mm512_set1_epi32(0x40);
+    const __m512i bit7 = _mm512_set1_epi32(0x80);
+    __m512 entries[16];
+    __m512 pairs[8];
+    __m512i index;
+    __mmask16 select;
+    unsigned int number, k;
+
+    for (k = 0; k < 16; k++) {
+        entries[k] = _mm512_loadu_ps(table + 16 * k);
+    }
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        index = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)inputVector));
+        // the low five bits index each 32 entry block, the upper three pick one
+        for (k = 0; k < 8; k++) {
+            pairs[k] = _mm512_permutex2var_ps(entries[2 * k], index, entries[2 * k + 1]);
+        }
+        select = _mm512_test_epi32_mask(index, bit5);
+        for (k = 0; k < 4; k++) {
+            pairs[k] = _mm512_mask_blend_ps(select, pairs[2 * k], pairs[2 * k + 1]);
+        }
+        select = _mm512_test_epi32_mask(index, bit6);
+        for (k = 0; k < 2; k++) {
+            pairs[k] = _mm512_mask_blend_ps(select, pairs[2 * k], pairs[2 * k + 1]);
+        }
+        select = _mm512_test_epi32_mask(index, bit7);
+        _mm512_storeu_ps(outputVector, _mm512_mask_blend_ps(select, pairs[0], pairs[1]));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++];
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_8u_32f_lut_32f_u_H */
@@ -0,0 +1,103 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_s32u_bfp_decompress_16ic.h'
+ */
+
+#ifndef INCLUDED_volk_8u_bfp_decompresspuppet_16ic_H
+#define INCLUDED_volk_8u_bfp_decompresspuppet_16ic_H
+
+#include <string.h>
+#include <volk/volk_8u_s32u_bfp_decompress_16ic.h>
+
+/*
+ * Decompresses 4, 9, 12 and 16 bit mantissas from quarters of the input, as
+ * many whole PRBs as fit; a PRB of 4 bits or more is longer than its 12
+ * samples, so the output is never overrun. The random exponents may be too
+ * large for the width, which checks that the impls wrap around alike.
+ */
+static inline void
+volk_bfp_decompress_puppet(void (*kernel)(lv_16sc_t*,
+                                          const uint8_t*,
+                                          const unsigned int,
+                                          unsigned int),
+                           lv_16sc_t* outVector,
+                           const uint8_t* inVector,
+                           unsigned int num_points)
+{
+    const unsigned int widths[4] = { 4, 9, 12, 16 };
+    const unsigned int quarter = num_points / 4;
+    unsigned int k;
+
+    memset(outVector, 0, sizeof(lv_16sc_t) * num_points);
+    for (k = 0; k < 4; k++) {
+        kernel(outVector + k * quarter,
+               inVector + k * quarter,
+               widths[k],
+               12 * (quarter / (1 + 3 * widths[k])));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_bfp_decompresspuppet_16ic_generic(lv_16sc_t* outVector,
+                                                             const uint8_t* inVector,
+                                                             unsigned int num_points)
+{
+    volk_bfp_decompress_puppet(
+        volk_8u_s32u_bfp_decompress_16ic_generic, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512BW && LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void
+volk_8u_bfp_decompresspuppet_16ic_avx512vbmi(lv_16sc_t* outVector,
+                                             const uint8_t* inVector,
+                                             unsigned int num_points)
+{
+    volk_bfp_decompress_puppet(
+        volk_8u_s32u_bfp_decompress_16ic_avx512vbmi, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512BW && LV_HAVE_AVX512VBMI */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_8u_bfp_decompresspuppet_16ic_neonv8(lv_16sc_t* outVector,
+                                                            const uint8_t* inVector,
+                                                            unsigned int num_points)
+{
+    volk_bfp_decompress_puppet(
+        volk_8u_s32u_bfp_decompress_16ic_neonv8, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_bfp_decompresspuppet_16ic_H */
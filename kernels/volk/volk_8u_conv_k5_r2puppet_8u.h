@@ -0,0 +1,101 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_volk_8u_conv_k5_r2puppet_8u_H
+#define INCLUDED_volk_8u_conv_k5_r2puppet_8u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_8u_x4_conv_k5_r2_8u.h>
+
+/*
+ * Decodes the num_points / 2 steps of syms with one implementation of the
+ * kernel, the last 4 of them as tail bits, into one bit per step.
+ */
+static inline void volk_conv_k5_r2_puppet_decode(volk_conv_kernel_t kernel,
+                                                 unsigned char* syms,
+                                                 unsigned char* dec,
+                                                 unsigned int num_points)
+{
+    const unsigned int polys[2] = { 023, 035 };
+    const unsigned int num_bits = num_points / 2;
+    const size_t alignment = volk_get_alignment();
+    unsigned char *metrics, *branchtab, *decisions;
+
+    memset(dec, 0, num_points);
+    if (num_bits <= 4)
+        return;
+
+    metrics = (unsigned char*)volk_malloc(2 * 16, alignment);
+    branchtab = (unsigned char*)volk_malloc(16, alignment);
+    decisions = (unsigned char*)volk_malloc(num_bits * 2, alignment);
+    volk_conv_branchtab_init(branchtab, polys, 16, 2);
+
+    // unbias the metrics, the encoder may start in any state
+    memset(metrics, 31, 16);
+    kernel(metrics + 16, metrics, syms, decisions, num_bits - 4, 4, branchtab);
+    volk_conv_traceback_generic(dec, decisions, metrics, num_bits, 16);
+
+    volk_free(metrics);
+    volk_free(branchtab);
+    volk_free(decisions);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_conv_k5_r2puppet_8u_generic(unsigned char* syms,
+                                                       unsigned char* dec,
+                                                       unsigned int num_points)
+{
+    volk_conv_k5_r2_puppet_decode(
+        volk_8u_x4_conv_k5_r2_8u_generic, syms, dec, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_8u_conv_k5_r2puppet_8u_sse3(unsigned char* syms,
+                                                    unsigned char* dec,
+                                                    unsigned int num_points)
+{
+    volk_conv_k5_r2_puppet_decode(volk_8u_x4_conv_k5_r2_8u_sse3, syms, dec, num_points);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_conv_k5_r2puppet_8u_neon(unsigned char* syms,
+                                                    unsigned char* dec,
+                                                    unsigned int num_points)
+{
+    volk_conv_k5_r2_puppet_decode(volk_8u_x4_conv_k5_r2_8u_neon, syms, dec, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_conv_k5_r2puppet_8u_H */
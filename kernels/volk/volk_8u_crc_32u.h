@@ -0,0 +1,433 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_crc_32u
+ *
+ * \b Overview
+ *
+ * Updates the cyclic redundancy check of a byte stream, for a CRC of width 1
+ * to 32 bits with any generator polynomial, such as CRC-16/CCITT, the LTE
+ * CRC-24s or CRC-32. The register crc holds the state of the CRC in the usual
+ * (Rocksoft) model: set it to the initial value of the CRC before the first
+ * bytes, update it with the bytes of a message in one or more calls and XOR
+ * it with the final XOR value of the CRC after the last. With reflected, the
+ * bits of each byte are taken least significant first and the register is
+ * reflected, as for CRC-32.
+ *
+ * The generic version uses a byte table. The carry-less multiply versions fold
+ * 64 bytes at a time into four 128 bit remainders, modulo the polynomial
+ * scaled to degree 32, and finish with a Barrett reduction; reflected CRCs
+ * reverse the bits of their bytes to run the same folding.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_crc_32u(uint32_t* crc, const uint8_t* inputBuffer,
+ * const uint32_t polynomial, const unsigned int width, const unsigned int reflected,
+ * unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li crc: The CRC register to update.
+ * \li inputBuffer: The bytes.
+ * \li polynomial: The generator polynomial without its x^width term, most
+ * significant bit first, e.g. 0x04c11db7 for CRC-32.
+ * \li width: The width of the CRC, 1 to 32.
+ * \li reflected: 0 for a CRC which takes the bits of a byte most significant
+ * first, otherwise reflected.
+ * \li num_points: The number of bytes.
+ *
+ * \b Outputs
+ * \li crc: The updated CRC register.
+ *
+ * \b Example
+ * The CRC-32 of a frame.
+ * \code
+ *   uint32_t crc = 0xffffffff;
+ *   volk_8u_crc_32u(&crc, frame, 0x04c11db7, 32, 1, N);
+ *   crc ^= 0xffffffff;
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_crc_32u_H
+#define INCLUDED_volk_8u_crc_32u_H
+
+#include <inttypes.h>
+
+/* The number of bytes from which a byte table pays for building it. */
+#define VOLK_CRC_TABLE_BYTES 16
+
+/* The low width bits of x in reverse order. */
+static inline uint32_t volk_crc_reflect(uint32_t x, unsigned int width)
+{
+    uint32_t r = 0;
+    unsigned int bit;
+
+    for (bit = 0; bit < width; bit++) {
+        r = (r << 1) | (x & 1);
+        x >>= 1;
+    }
+    return r;
+}
+
+/*
+ * The table of the register bits each byte value shifts out: most significant
+ * bit first with the register in the top width bits, or reflected with it in
+ * the bottom ones.
+ */
+static inline void volk_crc_make_table(uint32_t* table,
+                                       uint32_t polynomial,
+                                       unsigned int width,
+                                       unsigned int reflected)
+{
+    const uint32_t top = polynomial << (32 - width);
+    const uint32_t bottom = volk_crc_reflect(polynomial, width);
+    uint32_t r;
+    unsigned int bit, step, v;
+
+    // the table is linear in the byte, so each entry is the XOR of the
+    // entries of its bits
+    table[0] = 0;
+    for (bit = 0; bit < 8; bit++) {
+        r = reflected ? 1u << bit : 1u << (24 + bit);
+        for (step = 0; step < 8; step++) {
+            if (reflected) {
+                r = (r >> 1) ^ (r & 1 ? bottom : 0);
+            } else {
+                r = (r << 1) ^ (r >> 31 ? top : 0);
+            }
+        }
+        for (v = 1u << bit; v < 2u << bit; v++) {
+            table[v] = table[v - (1u << bit)] ^ r;
+        }
+    }
+}
+
+/* Updates the register with num_bytes bytes, a bit at a time for a few. */
+static inline uint32_t volk_crc_update(uint32_t crc,
+                                       const uint8_t* inputBuffer,
+                                       uint32_t polynomial,
+                                       unsigned int width,
+                                       unsigned int reflected,
+                                       unsigned int num_bytes)
+{
+    const unsigned int shift = 32 - width;
+    const uint32_t top = polynomial << shift;
+    const uint32_t bottom = volk_crc_reflect(polynomial, width);
+    uint32_t table[256];
+    uint32_t c = reflected ? crc & (0xffffffffu >> shift) : crc << shift;
+    unsigned int number, step;
+
+    if (num_bytes < VOLK_CRC_TABLE_BYTES) {
+        for (number = 0; number < num_bytes; number++) {
+            if (reflected) {
+                c ^= inputBuffer[number];
+                for (step = 0; step < 8; step++) {
+                    c = (c >> 1) ^ (c & 1 ? bottom : 0);
+                }
+            } else {
+                c ^= (uint32_t)inputBuffer[number] << 24;
+                for (step = 0; step < 8; step++) {
+                    c = (c << 1) ^ (c >> 31 ? top : 0);
+                }
+            }
+        }
+    } else {
+        volk_crc_make_table(table, polynomial, width, reflected);
+        if (reflected) {
+            for (number = 0; number < num_bytes; number++) {
+                c = (c >> 8) ^ table[(c ^ inputBuffer[number]) & 255];
+            }
+        } else {
+            for (number = 0; number < num_bytes; number++) {
+                c = (c << 8) ^ table[(c >> 24) ^ inputBuffer[number]];
+            }
+        }
+    }
+    return reflected ? c : c >> shift;
+}
+
+/*
+ * The constants of the folding versions, which divide most significant bit
+ * first by P = x^32 + (polynomial << (32 - width)): x^(32 k) mod P in
+ * powers[k] for k = 1 to 18, and floor(x^64 / P) less its x^32 term in mu.
+ */
+static inline void volk_crc_fold_constants(uint32_t* powers,
+                                           uint32_t* mu,
+                                           uint32_t polynomial,
+                                           unsigned int width)
+{
+    const uint32_t top = polynomial << (32 - width);
+    uint32_t table[256], r, quotient = 0;
+    unsigned int k, step;
+
+    volk_crc_make_table(table, polynomial, width, 0);
+    powers[1] = top;
+    for (k = 2; k <= 18; k++) {
+        r = powers[k - 1];
+        for (step = 0; step < 4; step++) {
+            r = (r << 8) ^ table[r >> 24];
+        }
+        powers[k] = r;
+    }
+
+    // long division of x^64, whose first step leaves x^64 - x^32 P
+    r = top;
+    for (step = 0; step < 32; step++) {
+        quotient = (quotient << 1) | (r >> 31);
+        r = (r << 1) ^ (r >> 31 ? top : 0);
+    }
+    *mu = quotient;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_crc_32u_generic(uint32_t* crc,
+                                           const uint8_t* inputBuffer,
+                                           const uint32_t polynomial,
+                                           const unsigned int width,
+                                           const unsigned int reflected,
+                                           unsigned int num_points)
+{
+    *crc = volk_crc_update(*crc, inputBuffer, polynomial, width, reflected, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_SSSE3 && LV_HAVE_PCLMUL
+#include <immintrin.h>
+
+static inline void volk_8u_crc_32u_u_ssse3_pclmul(uint32_t* crc,
+                                                  const uint8_t* inputBuffer,
+                                                  const uint32_t polynomial,
+                                                  const unsigned int width,
+                                                  const unsigned int reflected,
+                                                  unsigned int num_points)
+{
+    const unsigned int blocks = num_points / 16;
+    const unsigned int shift = 32 - width;
+    const __m128i byteswap =
+        _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const __m128i nibbles = _mm_set1_epi8(15);
+    // the reversed nibbles, placed low and high
+    const __m128i reverseLow = _mm_setr_epi8(
+        0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+    const __m128i reverseHigh = _mm_slli_epi16(reverseLow, 4);
+    uint32_t powers[19], mu, c;
+    __m128i fold4, fold1, first, data, x[4];
+    unsigned int number, i;
+
+    // the constants cost about what the table does over the first 100 bytes
+    if (blocks < 8) {
+        *crc = volk_crc_update(
+            *crc, inputBuffer, polynomial, width, reflected, num_points);
+        return;
+    }
+
+    volk_crc_fold_constants(powers, &mu, polynomial, width);
+    c = reflected ? volk_crc_reflect(*crc, width) : *crc;
+    // the register adds to the first 32 bits of the message
+    first = _mm_setr_epi32(0, 0, 0, (int)(c << shift));
+    // the low halves multiply by x^D and the high ones by x^(D + 64) to fold
+    // them D bits on
+    fold4 = _mm_setr_epi32((int)powers[16], 0, (int)powers[18], 0);
+    fold1 = _mm_setr_epi32((int)powers[4], 0, (int)powers[6], 0);
+    for (i = 0; i < 4; i++) {
+        x[i] = _mm_setzero_si128();
+    }
+
+    for (number = 0; number + 4 <= blocks; number += 4) {
+        for (i = 0; i < 4; i++) {
+            data = _mm_loadu_si128((const __m128i*)inputBuffer);
+            data = _mm_shuffle_epi8(data, byteswap);
+            if (reflected) {
+                data = _mm_or_si128(
+                    _mm_shuffle_epi8(reverseHigh, _mm_and_si128(data, nibbles)),
+                    _mm_shuffle_epi8(reverseLow,
+                                     _mm_and_si128(_mm_srli_epi16(data, 4), nibbles)));
+            }
+            x[i] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x[i], fold4, 0x00),
+                                               _mm_clmulepi64_si128(x[i], fold4, 0x11)),
+                                 data);
+            inputBuffer += 16;
+        }
+        x[0] = _mm_xor_si128(x[0], first);
+        first = _mm_setzero_si128();
+    }
+
+    // fold the four remainders 384, 256 and 128 bits on into the last
+    for (i = 0; i < 3; i++) {
+        fold4 = _mm_setr_epi32((int)powers[12 - 4 * i], 0, (int)powers[14 - 4 * i], 0);
+        x[3] = _mm_xor_si128(x[3],
+                             _mm_xor_si128(_mm_clmulepi64_si128(x[i], fold4, 0x00),
+                                           _mm_clmulepi64_si128(x[i], fold4, 0x11)));
+    }
+
+    for (; number < blocks; number++) {
+        data = _mm_loadu_si128((const __m128i*)inputBuffer);
+        data = _mm_shuffle_epi8(data, byteswap);
+        if (reflected) {
+            data = _mm_or_si128(
+                _mm_shuffle_epi8(reverseHigh, _mm_and_si128(data, nibbles)),
+                _mm_shuffle_epi8(reverseLow,
+                                 _mm_and_si128(_mm_srli_epi16(data, 4), nibbles)));
+        }
+        x[3] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x[3], fold1, 0x00),
+                                           _mm_clmulepi64_si128(x[3], fold1, 0x11)),
+                             data);
+        inputBuffer += 16;
+    }
+
+    // times x^32, the high half by x^96 and the low one shifted, then the top
+    // 32 of the 96 bits by x^64
+    data = _mm_xor_si128(
+        _mm_clmulepi64_si128(x[3], _mm_cvtsi32_si128((int)powers[3]), 0x01),
+        _mm_slli_si128(_mm_move_epi64(x[3]), 4));
+    data = _mm_xor_si128(_mm_clmulepi64_si128(_mm_srli_si128(data, 8),
+                                              _mm_cvtsi32_si128((int)powers[2]),
+                                              0x00),
+                         _mm_move_epi64(data));
+    // Barrett reduction of the 64 bits: the quotient is the top 32 bits times
+    // mu, divided by x^32
+    x[0] = _mm_setr_epi32((int)mu, 1, (int)(polynomial << shift), 1);
+    x[1] = _mm_clmulepi64_si128(_mm_srli_epi64(data, 32), x[0], 0x00);
+    x[1] = _mm_clmulepi64_si128(_mm_srli_epi64(x[1], 32), x[0], 0x10);
+    c = (uint32_t)_mm_cvtsi128_si32(_mm_xor_si128(data, x[1])) >> shift;
+
+    *crc = volk_crc_update(reflected ? volk_crc_reflect(c, width) : c,
+                           inputBuffer,
+                           polynomial,
+                           width,
+                           reflected,
+                           num_points - blocks * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 && LV_HAVE_PCLMUL */
+
+
+#if LV_HAVE_NEONV8 && LV_HAVE_PMULL
+#include <arm_neon.h>
+
+static inline void volk_8u_crc_32u_neonv8_pmull(uint32_t* crc,
+                                                const uint8_t* inputBuffer,
+                                                const uint32_t polynomial,
+                                                const unsigned int width,
+                                                const unsigned int reflected,
+                                                unsigned int num_points)
+{
+    const unsigned int blocks = num_points / 16;
+    const unsigned int shift = 32 - width;
+    uint32_t powers[19], mu, c;
+    uint64_t lo, hi, t;
+    poly64x2_t fold4, fold1;
+    uint64x2_t first, data, low, high, x[4];
+    uint8x16_t bytes;
+    unsigned int number, i;
+
+    // the constants cost about what the table does over the first 100 bytes
+    if (blocks < 8) {
+        *crc = volk_crc_update(
+            *crc, inputBuffer, polynomial, width, reflected, num_points);
+        return;
+    }
+
+    volk_crc_fold_constants(powers, &mu, polynomial, width);
+    c = reflected ? volk_crc_reflect(*crc, width) : *crc;
+    // the register adds to the first 32 bits of the message
+    first = vcombine_u64(vcreate_u64(0), vcreate_u64((uint64_t)(c << shift) << 32));
+    // the low halves multiply by x^D and the high ones by x^(D + 64) to fold
+    // them D bits on
+    fold4 = vcombine_p64(vcreate_p64(powers[16]), vcreate_p64(powers[18]));
+    fold1 = vcombine_p64(vcreate_p64(powers[4]), vcreate_p64(powers[6]));
+    for (i = 0; i < 4; i++) {
+        x[i] = vdupq_n_u64(0);
+    }
+
+    for (number = 0; number + 4 <= blocks; number += 4) {
+        for (i = 0; i < 4; i++) {
+            bytes = vld1q_u8(inputBuffer);
+            bytes = reflected ? vrbitq_u8(bytes) : bytes;
+            data = vreinterpretq_u64_u8(vrev64q_u8(bytes));
+            data = vextq_u64(data, data, 1);
+            low = vreinterpretq_u64_p128(
+                vmull_p64(vgetq_lane_u64(x[i], 0), vgetq_lane_p64(fold4, 0)));
+            high = vreinterpretq_u64_p128(
+                vmull_high_p64(vreinterpretq_p64_u64(x[i]), fold4));
+            x[i] = veorq_u64(veorq_u64(low, high), data);
+            inputBuffer += 16;
+        }
+        x[0] = veorq_u64(x[0], first);
+        first = vdupq_n_u64(0);
+    }
+
+    // fold the four remainders 384, 256 and 128 bits on into the last
+    for (i = 0; i < 3; i++) {
+        fold4 = vcombine_p64(vcreate_p64(powers[12 - 4 * i]),
+                             vcreate_p64(powers[14 - 4 * i]));
+        low = vreinterpretq_u64_p128(
+            vmull_p64(vgetq_lane_u64(x[i], 0), vgetq_lane_p64(fold4, 0)));
+        high = vreinterpretq_u64_p128(vmull_high_p64(vreinterpretq_p64_u64(x[i]), fold4));
+        x[3] = veorq_u64(x[3], veorq_u64(low, high));
+    }
+
+    for (; number < blocks; number++) {
+        bytes = vld1q_u8(inputBuffer);
+        bytes = reflected ? vrbitq_u8(bytes) : bytes;
+        data = vreinterpretq_u64_u8(vrev64q_u8(bytes));
+        data = vextq_u64(data, data, 1);
+        low = vreinterpretq_u64_p128(
+            vmull_p64(vgetq_lane_u64(x[3], 0), vgetq_lane_p64(fold1, 0)));
+        high = vreinterpretq_u64_p128(vmull_high_p64(vreinterpretq_p64_u64(x[3]), fold1));
+        x[3] = veorq_u64(veorq_u64(low, high), data);
+        inputBuffer += 16;
+    }
+
+    // times x^32, the high half by x^96 and the low one shifted, then the top
+    // 32 of the 96 bits by x^64
+    lo = vgetq_lane_u64(x[3], 0);
+    hi = vgetq_lane_u64(x[3], 1);
+    data = veorq_u64(vreinterpretq_u64_p128(vmull_p64(hi, powers[3])),
+                     vcombine_u64(vcreate_u64(lo << 32), vcreate_u64(lo >> 32)));
+    t = vgetq_lane_u64(vreinterpretq_u64_p128(
+                           vmull_p64(vgetq_lane_u64(data, 1), powers[2])),
+                       0) ^
+        vgetq_lane_u64(data, 0);
+    // Barrett reduction of the 64 bits: the quotient is the top 32 bits times
+    // mu, divided by x^32
+    lo = vgetq_lane_u64(
+        vreinterpretq_u64_p128(vmull_p64(t >> 32, ((uint64_t)1 << 32) | mu)), 0);
+    lo = vgetq_lane_u64(vreinterpretq_u64_p128(vmull_p64(
+                            lo >> 32, ((uint64_t)1 << 32) | (polynomial << shift))),
+                        0);
+    c = (uint32_t)(t ^ lo) >> shift;
+
+    *crc = volk_crc_update(reflected ? volk_crc_reflect(c, width) : c,
+                           inputBuffer,
+                           polynomial,
+                           width,
+                           reflected,
+                           num_points - blocks * 16);
+}
+
+#endif /* LV_HAVE_NEONV8 && LV_HAVE_PMULL */
+
+#endif /* INCLUDED_volk_8u_crc_32u_H */
@@ -0,0 +1,113 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_crc_32u.h'
+ */
+
+#ifndef INCLUDED_volk_8u_crcpuppet_32u_H
+#define INCLUDED_volk_8u_crcpuppet_32u_H
+
+#include <string.h>
+#include <volk/volk_8u_crc_32u.h>
+
+/*
+ * The CRC-32, CRC-32/BZIP2, CRC-32C, LTE CRC-24A, CRC-16/CCITT, CRC-16/ARC,
+ * CRC-8/SMBUS and CRC-5/USB of the bytes, each in two calls, in the first
+ * outputs and zeros after them.
+ */
+static inline void volk_crc_puppet(void (*kernel)(uint32_t*,
+                                                  const uint8_t*,
+                                                  const uint32_t,
+                                                  const unsigned int,
+                                                  const unsigned int,
+                                                  unsigned int),
+                                   uint32_t* outputVector,
+                                   const uint8_t* inputVector,
+                                   unsigned int num_points)
+{
+    const uint32_t polynomials[8] = { 0x04c11db7, 0x04c11db7, 0x1edc6f41, 0x864cfb,
+                                      0x1021,     0x8005,     0x07,       0x05 };
+    const unsigned int widths[8] = { 32, 32, 32, 24, 16, 16, 8, 5 };
+    const unsigned int reflected[8] = { 1, 0, 1, 0, 0, 1, 0, 1 };
+    const uint32_t seeds[8] = {
+        0xffffffff, 0xffffffff, 0xffffffff, 0, 0xffff, 0, 0, 0x1f
+    };
+    unsigned int k;
+
+    memset(outputVector, 0, num_points * sizeof(uint32_t));
+    for (k = 0; k < 8 && k < num_points; k++) {
+        outputVector[k] = seeds[k];
+        kernel(outputVector + k,
+               inputVector,
+               polynomials[k],
+               widths[k],
+               reflected[k],
+               num_points / 3);
+        kernel(outputVector + k,
+               inputVector + num_points / 3,
+               polynomials[k],
+               widths[k],
+               reflected[k],
+               num_points - num_points / 3);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_crcpuppet_32u_generic(uint32_t* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_crc_puppet(volk_8u_crc_32u_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_SSSE3 && LV_HAVE_PCLMUL
+
+static inline void volk_8u_crcpuppet_32u_u_ssse3_pclmul(uint32_t* outputVector,
+                                                        const uint8_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_crc_puppet(
+        volk_8u_crc_32u_u_ssse3_pclmul, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 && LV_HAVE_PCLMUL */
+
+
+#if LV_HAVE_NEONV8 && LV_HAVE_PMULL
+
+static inline void volk_8u_crcpuppet_32u_neonv8_pmull(uint32_t* outputVector,
+                                                      const uint8_t* inputVector,
+                                                      unsigned int num_points)
+{
+    volk_crc_puppet(volk_8u_crc_32u_neonv8_pmull, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 && LV_HAVE_PMULL */
+
+#endif /* INCLUDED_volk_8u_crcpuppet_32u_H */
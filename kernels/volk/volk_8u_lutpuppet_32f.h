@@ -0,0 +1,102 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_32f_lut_32f.h'
+ */
+
+#ifndef INCLUDED_volk_8u_lutpuppet_32f_H
+#define INCLUDED_volk_8u_lutpuppet_32f_H
+
+#include <volk/volk_8u_32f_lut_32f.h>
+
+/* Maps the input through a table of distinct, unevenly spaced entries */
+static inline void volk_8u_32f_lut_puppet(void (*kernel)(float*,
+                                                         const uint8_t*,
+                                                         const float*,
+                                                         unsigned int),
+                                          float* outputVector,
+                                          const uint8_t* inputVector,
+                                          unsigned int num_points)
+{
+    float table[256];
+    unsigned int k;
+
+    for (k = 0; k < 256; k++) {
+        table[k] = (float)(k * k) / 65536.f - 0.5f;
+    }
+    kernel(outputVector, inputVector, table, num_points);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_lutpuppet_32f_generic(float* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_8u_32f_lut_puppet(
+        volk_8u_32f_lut_32f_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_lutpuppet_32f_u_avx2_gather(float* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_8u_32f_lut_puppet(
+        volk_8u_32f_lut_32f_u_avx2_gather, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_8u_lutpuppet_32f_u_avx512f_gather(float* outputVector,
+                                                          const uint8_t* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_8u_32f_lut_puppet(
+        volk_8u_32f_lut_32f_u_avx512f_gather, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_8u_lutpuppet_32f_u_avx512f(float* outputVector,
+                                                   const uint8_t* inputVector,
+                                                   unsigned int num_points)
+{
+    volk_8u_32f_lut_puppet(
+        volk_8u_32f_lut_32f_u_avx512f, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_8u_lutpuppet_32f_H */
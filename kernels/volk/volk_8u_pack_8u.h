@@ -0,0 +1,193 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_pack_8u
+ *
+ * \b Overview
+ *
+ * Packs unpacked bits, one per byte in its least significant bit, into bytes
+ * of 8 bits, the first bit of each byte in its most significant bit or, with
+ * lsbFirst, in its least significant bit. The other bits of the input bytes
+ * are ignored and the unused bits of a last partial byte are 0.
+ *
+ * volk_8u_unpack_8u unpacks bytes back into bits.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_pack_8u(uint8_t* packedBytes, const uint8_t* bitVector,
+ * const unsigned int lsbFirst, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li bitVector: The bits to pack, one per byte.
+ * \li lsbFirst: 0 to pack the first bit of each byte into its most significant
+ * bit, otherwise into its least significant bit.
+ * \li num_points: The number of bits.
+ *
+ * \b Outputs
+ * \li packedBytes: The packed bytes, (num_points + 7) / 8 of them.
+ *
+ * \b Example
+ * Pack the bits of a frame, most significant bit first.
+ * \code
+ *   volk_8u_pack_8u(bytes, bits, 0, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_pack_8u_H
+#define INCLUDED_volk_8u_pack_8u_H
+
+#include <inttypes.h>
+#include <string.h>
+
+/* Packs num_points bits into (num_points + 7) / 8 bytes. */
+static inline void volk_bits_pack(uint8_t* packedBytes,
+                                  const uint8_t* bitVector,
+                                  unsigned int lsbFirst,
+                                  unsigned int num_points)
+{
+    unsigned int number, bit;
+    uint8_t byte;
+
+    for (number = 0; number < num_points; number += 8) {
+        byte = 0;
+        for (bit = 0; bit < 8 && number + bit < num_points; bit++) {
+            byte |= (bitVector[number + bit] & 1) << (lsbFirst ? bit : 7 - bit);
+        }
+        *packedBytes++ = byte;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_pack_8u_generic(uint8_t* packedBytes,
+                                           const uint8_t* bitVector,
+                                           const unsigned int lsbFirst,
+                                           unsigned int num_points)
+{
+    volk_bits_pack(packedBytes, bitVector, lsbFirst, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_pack_8u_u_ssse3(uint8_t* packedBytes,
+                                           const uint8_t* bitVector,
+                                           const unsigned int lsbFirst,
+                                           unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    // movemask gathers the first bit into the least significant bit, so the
+    // most significant bit first order reverses each 8 bits before
+    const __m128i order = lsbFirst ? _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8,
+                                                   9, 10, 11, 12, 13, 14, 15)
+                                   : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15,
+                                                   14, 13, 12, 11, 10, 9, 8);
+    uint16_t word;
+    __m128i x;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)bitVector), order);
+        word = (uint16_t)_mm_movemask_epi8(_mm_slli_epi16(x, 7));
+        memcpy(packedBytes, &word, 2);
+        bitVector += 16;
+        packedBytes += 2;
+    }
+
+    volk_bits_pack(packedBytes, bitVector, lsbFirst, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_pack_8u_u_avx2(uint8_t* packedBytes,
+                                          const uint8_t* bitVector,
+                                          const unsigned int lsbFirst,
+                                          unsigned int num_points)
+{
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const __m256i order =
+        lsbFirst ? _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+                 : _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    uint32_t word;
+    __m256i x;
+    unsigned int number;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        x = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)bitVector), order);
+        word = (uint32_t)_mm256_movemask_epi8(_mm256_slli_epi16(x, 7));
+        memcpy(packedBytes, &word, 4);
+        bitVector += 32;
+        packedBytes += 4;
+    }
+
+    volk_bits_pack(
+        packedBytes, bitVector, lsbFirst, num_points - thirtysecondPoints * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_pack_8u_neon(uint8_t* packedBytes,
+                                        const uint8_t* bitVector,
+                                        const unsigned int lsbFirst,
+                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const int8_t lsbShifts[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    const int8_t msbShifts[8] = { 7, 6, 5, 4, 3, 2, 1, 0 };
+    const int8x8_t shifts = vld1_s8(lsbFirst ? lsbShifts : msbShifts);
+    const uint8x16_t one = vdupq_n_u8(1);
+    uint8x16_t x;
+    uint8x8_t sums;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = vandq_u8(vld1q_u8(bitVector), one);
+        // the shifted bits are disjoint, so three pairwise adds or them together
+        sums = vpadd_u8(vshl_u8(vget_low_u8(x), shifts),
+                        vshl_u8(vget_high_u8(x), shifts));
+        sums = vpadd_u8(sums, sums);
+        sums = vpadd_u8(sums, sums);
+        vst1_lane_u16((uint16_t*)packedBytes, vreinterpret_u16_u8(sums), 0);
+        bitVector += 16;
+        packedBytes += 2;
+    }
+
+    volk_bits_pack(packedBytes, bitVector, lsbFirst, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_pack_8u_H */
@@ -0,0 +1,98 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_pack_8u.h'
+ */
+
+#ifndef INCLUDED_volk_8u_packpuppet_8u_H
+#define INCLUDED_volk_8u_packpuppet_8u_H
+
+#include <string.h>
+#include <volk/volk_8u_pack_8u.h>
+
+/*
+ * Packs the first half of the bits most significant bit first and the second
+ * least significant bit first, leaving the remaining outputs zeroed.
+ */
+static inline void volk_bits_pack_puppet(
+    void (*kernel)(uint8_t*, const uint8_t*, const unsigned int, unsigned int),
+    uint8_t* packedBytes,
+    const uint8_t* bitVector,
+    unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+
+    memset(packedBytes, 0, num_points);
+    kernel(packedBytes, bitVector, 0, half);
+    kernel(packedBytes + (half + 7) / 8, bitVector + half, 1, num_points - half);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_packpuppet_8u_generic(uint8_t* packedBytes,
+                                                 const uint8_t* bitVector,
+                                                 unsigned int num_points)
+{
+    volk_bits_pack_puppet(volk_8u_pack_8u_generic, packedBytes, bitVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_8u_packpuppet_8u_u_ssse3(uint8_t* packedBytes,
+                                                 const uint8_t* bitVector,
+                                                 unsigned int num_points)
+{
+    volk_bits_pack_puppet(volk_8u_pack_8u_u_ssse3, packedBytes, bitVector, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_packpuppet_8u_u_avx2(uint8_t* packedBytes,
+                                                const uint8_t* bitVector,
+                                                unsigned int num_points)
+{
+    volk_bits_pack_puppet(volk_8u_pack_8u_u_avx2, packedBytes, bitVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_packpuppet_8u_neon(uint8_t* packedBytes,
+                                              const uint8_t* bitVector,
+                                              unsigned int num_points)
+{
+    volk_bits_pack_puppet(volk_8u_pack_8u_neon, packedBytes, bitVector, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_packpuppet_8u_H */
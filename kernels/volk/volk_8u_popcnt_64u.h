@@ -0,0 +1,197 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_popcnt_64u
+ *
+ * \b Overview
+ *
+ * Counts the bits that are set in a whole buffer, which volk_64u_popcnt only
+ * does for a single word. The AVX2 implementation uses the Harley-Seal carry
+ * save adder tree, which needs one byte lookup per 16 vectors instead of one
+ * per vector.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_popcnt_64u(uint64_t* count, const uint8_t* inputBuffer,
+ *                         unsigned int num_bytes)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: The bytes to count the set bits of.
+ * \li num_bytes: The number of bytes.
+ *
+ * \b Outputs
+ * \li count: The number of set bits.
+ *
+ * \b Example
+ * \code
+ *   uint64_t ones;
+ *   volk_8u_popcnt_64u(&ones, payload, payload_len);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_popcnt_64u_H
+#define INCLUDED_volk_8u_popcnt_64u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+/* The set bits of a word, also used for the tails of the SIMD kernels */
+static inline uint64_t volk_popcnt_word(uint64_t value)
+{
+    value = value - ((value >> 1) & 0x5555555555555555ull);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (value * 0x0101010101010101ull) >> 56;
+}
+
+/* The set bits of the bytes of a, or of a ^ b when b is not NULL */
+static inline uint64_t
+volk_popcnt_bytes(const uint8_t* a, const uint8_t* b, unsigned int num_bytes)
+{
+    uint64_t count = 0;
+    uint64_t wordA, wordB;
+    unsigned int number = 0;
+
+    for (; number + 8 <= num_bytes; number += 8) {
+        memcpy(&wordA, a + number, 8);
+        if (b) {
+            memcpy(&wordB, b + number, 8);
+            wordA ^= wordB;
+        }
+        count += volk_popcnt_word(wordA);
+    }
+    for (; number < num_bytes; number++) {
+        count += volk_popcnt_word(b ? a[number] ^ b[number] : a[number]);
+    }
+    return count;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_popcnt_64u_generic(uint64_t* count,
+                                              const uint8_t* inputBuffer,
+                                              unsigned int num_bytes)
+{
+    *count = volk_popcnt_bytes(inputBuffer, NULL, num_bytes);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_8u_popcnt_64u_u_avx2(uint64_t* count,
+                                             const uint8_t* inputBuffer,
+                                             unsigned int num_bytes)
+{
+    const unsigned int thirtysecondPoints = num_bytes / 32;
+    __VOLK_ATTR_ALIGNED(32) uint64_t lanes[4];
+
+    _mm256_store_si256((__m256i*)lanes,
+                       _mm256_popcnt_harley_seal_avx2(
+                           (const __m256i*)inputBuffer, NULL, thirtysecondPoints));
+
+    *count = lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+             volk_popcnt_bytes(inputBuffer + thirtysecondPoints * 32,
+                               NULL,
+                               num_bytes - thirtysecondPoints * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VPOPCNTDQ
+#include <immintrin.h>
+
+static inline void volk_8u_popcnt_64u_u_avx512vpopcntdq(uint64_t* count,
+                                                        const uint8_t* inputBuffer,
+                                                        unsigned int num_bytes)
+{
+    const uint8_t* inputPtr = inputBuffer;
+    const unsigned int sixtyfourthPoints = num_bytes / 64;
+    unsigned int number = 0;
+
+    __m512i total0 = _mm512_setzero_si512();
+    __m512i total1 = _mm512_setzero_si512();
+    __m512i total2 = _mm512_setzero_si512();
+    __m512i total3 = _mm512_setzero_si512();
+
+    for (; number + 4 <= sixtyfourthPoints; number += 4) {
+        total0 =
+            _mm512_add_epi64(total0, _mm512_popcnt_epi64(_mm512_loadu_si512(inputPtr)));
+        total1 = _mm512_add_epi64(
+            total1, _mm512_popcnt_epi64(_mm512_loadu_si512(inputPtr + 64)));
+        total2 = _mm512_add_epi64(
+            total2, _mm512_popcnt_epi64(_mm512_loadu_si512(inputPtr + 128)));
+        total3 = _mm512_add_epi64(
+            total3, _mm512_popcnt_epi64(_mm512_loadu_si512(inputPtr + 192)));
+        inputPtr += 256;
+    }
+    for (; number < sixtyfourthPoints; number++) {
+        total0 =
+            _mm512_add_epi64(total0, _mm512_popcnt_epi64(_mm512_loadu_si512(inputPtr)));
+        inputPtr += 64;
+    }
+
+    total0 = _mm512_add_epi64(_mm512_add_epi64(total0, total1),
+                              _mm512_add_epi64(total2, total3));
+    *count = (uint64_t)_mm512_reduce_add_epi64(total0) +
+             volk_popcnt_bytes(inputPtr, NULL, num_bytes - sixtyfourthPoints * 64);
+}
+
+#endif /* LV_HAVE_AVX512VPOPCNTDQ */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_popcnt_64u_neon(uint64_t* count,
+                                           const uint8_t* inputBuffer,
+                                           unsigned int num_bytes)
+{
+    const uint8_t* inputPtr = inputBuffer;
+    const unsigned int sixteenthPoints = num_bytes / 16;
+    unsigned int number = 0;
+    unsigned int blockEnd;
+
+    uint64x2_t total = vdupq_n_u64(0);
+    uint16x8_t partial;
+
+    while (number < sixteenthPoints) {
+        // the 16-bit lanes gain at most 16 per vector
+        blockEnd = number + 4095 < sixteenthPoints ? number + 4095 : sixteenthPoints;
+        partial = vdupq_n_u16(0);
+        for (; number < blockEnd; number++) {
+            partial = vpadalq_u8(partial, vcntq_u8(vld1q_u8(inputPtr)));
+            inputPtr += 16;
+        }
+        total = vpadalq_u32(total, vpaddlq_u16(partial));
+    }
+
+    *count = vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1) +
+             volk_popcnt_bytes(inputPtr, NULL, num_bytes - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_popcnt_64u_H */
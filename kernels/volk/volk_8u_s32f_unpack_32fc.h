@@ -0,0 +1,224 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_s32f_unpack_32fc
+ *
+ * \b Overview
+ *
+ * Unpacks complex samples of bits wide two's complement components in the
+ * packed format of volk_8u_unpack_16ic, and divides them by scalar into
+ * floating point complex samples, e.g. by 2048 for 12 bit samples to a full
+ * scale of 1.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s32f_unpack_32fc(lv_32fc_t* outVector, const uint8_t* inVector,
+ * const float scalar, unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The packed samples, (2 * num_points * bits + 7) / 8 bytes.
+ * \li scalar: The value each component is divided by.
+ * \li bits: The width of a component, 1 to 16.
+ * \li num_points: The number of complex samples.
+ *
+ * \b Outputs
+ * \li outVector: The unpacked samples.
+ *
+ * \b Example
+ * Unpack N samples of 12 bits to a full scale of 1.
+ * \code
+ *   volk_8u_s32f_unpack_32fc(samples, packed, 2048.f, 12, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s32f_unpack_32fc_H
+#define INCLUDED_volk_8u_s32f_unpack_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_8u_unpack_16ic.h>
+
+/* Unpacks num_values components of the bit stream in, multiplied by scale. */
+static inline void volk_packed_unpack_32f(float* out,
+                                          const uint8_t* in,
+                                          float scale,
+                                          unsigned int bits,
+                                          unsigned int num_values)
+{
+    uint32_t bit_buffer = 0;
+    unsigned int buffered = 0, n;
+
+    for (n = 0; n < num_values; n++) {
+        while (buffered < bits) {
+            bit_buffer |= (uint32_t)*in++ << buffered;
+            buffered += 8;
+        }
+        *out++ = (float)((int32_t)(bit_buffer << (32 - bits)) >> (32 - bits)) * scale;
+        bit_buffer >>= bits;
+        buffered -= bits;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32f_unpack_32fc_generic(lv_32fc_t* outVector,
+                                                    const uint8_t* inVector,
+                                                    const float scalar,
+                                                    unsigned int bits,
+                                                    unsigned int num_points)
+{
+    volk_packed_unpack_32f(
+        (float*)outVector, inVector, 1.f / scalar, bits, 2 * num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_s32f_unpack_32fc_ssse3(lv_32fc_t* outVector,
+                                                  const uint8_t* inVector,
+                                                  const float scalar,
+                                                  unsigned int bits,
+                                                  unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    const float inv_scalar = 1.f / scalar;
+    float* out = (float*)outVector;
+    __VOLK_ATTR_ALIGNED(16) uint8_t shuffle_bytes[16];
+    __VOLK_ATTR_ALIGNED(16) int16_t scale_words[8];
+    unsigned int groups = 0, number;
+
+    if (volk_packed_unpack_layout(shuffle_bytes, scale_words, bits)) {
+        const __m128i shuffle = _mm_load_si128((const __m128i*)shuffle_bytes);
+        const __m128i scale = _mm_load_si128((const __m128i*)scale_words);
+        // the components end up in the top halves of 32 bit lanes
+        const __m128i shift = _mm_cvtsi32_si128(32 - bits);
+        const __m128 inv = _mm_set1_ps(inv_scalar);
+        __m128i x;
+
+        groups = volk_packed_groups(bits, num_values, 16);
+        for (number = 0; number < groups; number++) {
+            x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)inVector), shuffle);
+            x = _mm_mullo_epi16(x, scale);
+            _mm_storeu_ps(out,
+                          _mm_mul_ps(_mm_cvtepi32_ps(_mm_sra_epi32(
+                                         _mm_unpacklo_epi16(x, x), shift)),
+                                     inv));
+            _mm_storeu_ps(out + 4,
+                          _mm_mul_ps(_mm_cvtepi32_ps(_mm_sra_epi32(
+                                         _mm_unpackhi_epi16(x, x), shift)),
+                                     inv));
+            inVector += bits;
+            out += 8;
+        }
+    }
+
+    volk_packed_unpack_32f(out, inVector, inv_scalar, bits, num_values - groups * 8);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_32fc_avx2(lv_32fc_t* outVector,
+                                                 const uint8_t* inVector,
+                                                 const float scalar,
+                                                 unsigned int bits,
+                                                 unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    const float inv_scalar = 1.f / scalar;
+    float* out = (float*)outVector;
+    __VOLK_ATTR_ALIGNED(16) uint8_t shuffle_bytes[16];
+    __VOLK_ATTR_ALIGNED(16) int16_t scale_words[8];
+    unsigned int groups = 0, number;
+
+    if (volk_packed_unpack_layout(shuffle_bytes, scale_words, bits)) {
+        const __m128i shuffle = _mm_load_si128((const __m128i*)shuffle_bytes);
+        const __m128i scale = _mm_load_si128((const __m128i*)scale_words);
+        const __m128i shift = _mm_cvtsi32_si128(16 - bits);
+        const __m256 inv = _mm256_set1_ps(inv_scalar);
+        __m128i x;
+
+        groups = volk_packed_groups(bits, num_values, 16);
+        for (number = 0; number < groups; number++) {
+            x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)inVector), shuffle);
+            x = _mm_sra_epi16(_mm_mullo_epi16(x, scale), shift);
+            _mm256_storeu_ps(
+                out, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(x)), inv));
+            inVector += bits;
+            out += 8;
+        }
+    }
+
+    volk_packed_unpack_32f(out, inVector, inv_scalar, bits, num_values - groups * 8);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_8u_s32f_unpack_32fc_neonv8(lv_32fc_t* outVector,
+                                                   const uint8_t* inVector,
+                                                   const float scalar,
+                                                   unsigned int bits,
+                                                   unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    const float inv_scalar = 1.f / scalar;
+    float* out = (float*)outVector;
+    uint8_t shuffle_bytes[16];
+    int16_t scale_words[8];
+    unsigned int groups = 0, number;
+
+    if (volk_packed_unpack_layout(shuffle_bytes, scale_words, bits)) {
+        const uint8x16_t shuffle = vld1q_u8(shuffle_bytes);
+        const int16x8_t scale = vld1q_s16(scale_words);
+        const int16x8_t shift = vdupq_n_s16(-(int16_t)(16 - bits));
+        int16x8_t x;
+
+        groups = volk_packed_groups(bits, num_values, 16);
+        for (number = 0; number < groups; number++) {
+            x = vreinterpretq_s16_u8(vqtbl1q_u8(vld1q_u8(inVector), shuffle));
+            x = vshlq_s16(vmulq_s16(x, scale), shift);
+            vst1q_f32(out,
+                      vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))), inv_scalar));
+            vst1q_f32(
+                out + 4,
+                vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), inv_scalar));
+            inVector += bits;
+            out += 8;
+        }
+    }
+
+    volk_packed_unpack_32f(out, inVector, inv_scalar, bits, num_values - groups * 8);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_s32f_unpack_32fc_H */
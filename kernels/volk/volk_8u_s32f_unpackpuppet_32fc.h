@@ -0,0 +1,121 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_s32f_unpack_32fc.h'
+ */
+
+#ifndef INCLUDED_volk_8u_s32f_unpackpuppet_32fc_H
+#define INCLUDED_volk_8u_s32f_unpackpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_8u_s32f_unpack_32fc.h>
+
+/*
+ * Unpacks 4, 10, 12 and 14 bit samples, the last left to the generic
+ * versions, from quarters of the buffers.
+ */
+static inline void
+volk_packed_unpack_32fc_puppet(void (*kernel)(lv_32fc_t*,
+                                              const uint8_t*,
+                                              const float,
+                                              unsigned int,
+                                              unsigned int),
+                               lv_32fc_t* outVector,
+                               const uint8_t* inVector,
+                               const float scalar,
+                               unsigned int num_points)
+{
+    const unsigned int widths[4] = { 4, 10, 12, 14 };
+    const unsigned int quarter = num_points / 4;
+    unsigned int k;
+
+    memset(outVector, 0, sizeof(lv_32fc_t) * num_points);
+    for (k = 0; k < 4; k++) {
+        kernel(outVector + k * quarter,
+               inVector + k * quarter,
+               scalar,
+               widths[k],
+               quarter * 4 / widths[k]);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32f_unpackpuppet_32fc_generic(lv_32fc_t* outVector,
+                                                          const uint8_t* inVector,
+                                                          const float scalar,
+                                                          unsigned int num_points)
+{
+    volk_packed_unpack_32fc_puppet(
+        volk_8u_s32f_unpack_32fc_generic, outVector, inVector, scalar, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_s32f_unpackpuppet_32fc_ssse3(lv_32fc_t* outVector,
+                                                        const uint8_t* inVector,
+                                                        const float scalar,
+                                                        unsigned int num_points)
+{
+    volk_packed_unpack_32fc_puppet(
+        volk_8u_s32f_unpack_32fc_ssse3, outVector, inVector, scalar, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpackpuppet_32fc_avx2(lv_32fc_t* outVector,
+                                                       const uint8_t* inVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    volk_packed_unpack_32fc_puppet(
+        volk_8u_s32f_unpack_32fc_avx2, outVector, inVector, scalar, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_8u_s32f_unpackpuppet_32fc_neonv8(lv_32fc_t* outVector,
+                                                         const uint8_t* inVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    volk_packed_unpack_32fc_puppet(
+        volk_8u_s32f_unpack_32fc_neonv8, outVector, inVector, scalar, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_s32f_unpackpuppet_32fc_H */
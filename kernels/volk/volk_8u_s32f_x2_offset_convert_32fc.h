@@ -0,0 +1,349 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_s32f_x2_offset_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts interleaved unsigned 8-bit IQ samples in offset binary, as produced by
+ * RTL-SDR class front ends, to complex floats. The offset, typically 127.5, is
+ * subtracted from both parts, which removes the DC of the encoding, and the
+ * difference is scaled:
+ *
+ * output[i] = (input[2i] - offset) * scale + j (input[2i+1] - offset) * scale
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s32f_x2_offset_convert_32fc(lv_32fc_t* outputVector,
+ *                                          const uint8_t* inputVector,
+ *                                          const float offset, const float scale,
+ *                                          unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The I and Q bytes of num_points samples, interleaved.
+ * \li offset: The value subtracted from each byte.
+ * \li scale: The factor the differences are multiplied by.
+ * \li num_points: The number of complex samples.
+ *
+ * \b Outputs
+ * \li outputVector: The complex samples.
+ *
+ * \b Example
+ * Convert a block of RTL-SDR samples to [-1, 1].
+ * \code
+ *   int N = 8;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(2 * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(int ii = 0; ii < 2 * N; ++ii){
+ *       in[ii] = (uint8_t)(ii * 32);
+ *   }
+ *
+ *   volk_8u_s32f_x2_offset_convert_32fc(out, in, 127.5f, 1.f / 127.5f, N);
+ *
+ *   for(int ii = 0; ii < N; ++ii){
+ *       printf("out[%i] = %+1.3f %+1.3fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s32f_x2_offset_convert_32fc_H
+#define INCLUDED_volk_8u_s32f_x2_offset_convert_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32f_x2_offset_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                               const uint8_t* inputVector,
+                                                               const float offset,
+                                                               const float scale,
+                                                               unsigned int num_points)
+{
+    float* outputPtr = (float*)outputVector;
+    const uint8_t* inputPtr = inputVector;
+    unsigned int number;
+
+    for (number = 0; number < 2 * num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offset) * scale;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_x2_offset_convert_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                              const uint8_t* inputVector,
+                                                              const float offset,
+                                                              const float scale,
+                                                              unsigned int num_points)
+{
+    float* outputPtr = (float*)outputVector;
+    const uint8_t* inputPtr = inputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    const __m256 offsetVal = _mm256_set1_ps(offset);
+    const __m256 scaleVal = _mm256_set1_ps(scale);
+    __m128i inputVal;
+    __m256 ret0, ret1, ret2, ret3;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // subtract then scale, as the generic does, so the results are the same
+        inputVal = _mm_loadu_si128((const __m128i*)inputPtr);
+        ret0 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(inputVal));
+        ret1 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(inputVal, 8)));
+        inputVal = _mm_loadu_si128((const __m128i*)(inputPtr + 16));
+        ret2 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(inputVal));
+        ret3 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(inputVal, 8)));
+
+        ret0 = _mm256_mul_ps(_mm256_sub_ps(ret0, offsetVal), scaleVal);
+        ret1 = _mm256_mul_ps(_mm256_sub_ps(ret1, offsetVal), scaleVal);
+        ret2 = _mm256_mul_ps(_mm256_sub_ps(ret2, offsetVal), scaleVal);
+        ret3 = _mm256_mul_ps(_mm256_sub_ps(ret3, offsetVal), scaleVal);
+
+        _mm256_store_ps(outputPtr, ret0);
+        _mm256_store_ps(outputPtr + 8, ret1);
+        _mm256_store_ps(outputPtr + 16, ret2);
+        _mm256_store_ps(outputPtr + 24, ret3);
+
+        inputPtr += 32;
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 32; number < 2 * num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offset) * scale;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_8u_s32f_x2_offset_convert_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                              const uint8_t* inputVector,
+                                              const float offset,
+                                              const float scale,
+                                              unsigned int num_points)
+{
+    float* outputPtr = (float*)outputVector;
+    const uint8_t* inputPtr = inputVector;
+    const unsigned int thirtysecondPoints = num_points / 32;
+    unsigned int number;
+
+    const __m512 offsetVal = _mm512_set1_ps(offset);
+    const __m512 scaleVal = _mm512_set1_ps(scale);
+    __m512 ret0, ret1, ret2, ret3;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        ret0 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)inputPtr)));
+        ret1 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(inputPtr + 16))));
+        ret2 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(inputPtr + 32))));
+        ret3 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(inputPtr + 48))));
+
+        ret0 = _mm512_mul_ps(_mm512_sub_ps(ret0, offsetVal), scaleVal);
+        ret1 = _mm512_mul_ps(_mm512_sub_ps(ret1, offsetVal), scaleVal);
+        ret2 = _mm512_mul_ps(_mm512_sub_ps(ret2, offsetVal), scaleVal);
+        ret3 = _mm512_mul_ps(_mm512_sub_ps(ret3, offsetVal), scaleVal);
+
+        _mm512_store_ps(outputPtr, ret0);
+        _mm512_store_ps(outputPtr + 16, ret1);
+        _mm512_store_ps(outputPtr + 32, ret2);
+        _mm512_store_ps(outputPtr + 48, ret3);
+
+        inputPtr += 64;
+        outputPtr += 64;
+    }
+
+    for (number = thirtysecondPoints * 64; number < 2 * num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offset) * scale;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_x2_offset_convert_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                              const uint8_t* inputVector,
+                                                              const float offset,
+                                                              const float scale,
+                                                              unsigned int num_points)
+{
+    float* outputPtr = (float*)outputVector;
+    const uint8_t* inputPtr = inputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    const __m256 offsetVal = _mm256_set1_ps(offset);
+    const __m256 scaleVal = _mm256_set1_ps(scale);
+    __m128i inputVal;
+    __m256 ret0, ret1, ret2, ret3;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // subtract then scale, as the generic does, so the results are the same
+        inputVal = _mm_loadu_si128((const __m128i*)inputPtr);
+        ret0 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(inputVal));
+        ret1 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(inputVal, 8)));
+        inputVal = _mm_loadu_si128((const __m128i*)(inputPtr + 16));
+        ret2 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(inputVal));
+        ret3 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(inputVal, 8)));
+
+        ret0 = _mm256_mul_ps(_mm256_sub_ps(ret0, offsetVal), scaleVal);
+        ret1 = _mm256_mul_ps(_mm256_sub_ps(ret1, offsetVal), scaleVal);
+        ret2 = _mm256_mul_ps(_mm256_sub_ps(ret2, offsetVal), scaleVal);
+        ret3 = _mm256_mul_ps(_mm256_sub_ps(ret3, offsetVal), scaleVal);
+
+        _mm256_storeu_ps(outputPtr, ret0);
+        _mm256_storeu_ps(outputPtr + 8, ret1);
+        _mm256_storeu_ps(outputPtr + 16, ret2);
+        _mm256_storeu_ps(outputPtr + 24, ret3);
+
+        inputPtr += 32;
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 32; number < 2 * num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offset) * scale;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_8u_s32f_x2_offset_convert_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                              const uint8_t* inputVector,
+                                              const float offset,
+                                              const float scale,
+                                              unsigned int num_points)
+{
+    float* outputPtr = (float*)outputVector;
+    const uint8_t* inputPtr = inputVector;
+    const unsigned int thirtysecondPoints = num_points / 32;
+    unsigned int number;
+
+    const __m512 offsetVal = _mm512_set1_ps(offset);
+    const __m512 scaleVal = _mm512_set1_ps(scale);
+    __m512 ret0, ret1, ret2, ret3;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        ret0 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)inputPtr)));
+        ret1 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(inputPtr + 16))));
+        ret2 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(inputPtr + 32))));
+        ret3 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(inputPtr + 48))));
+
+        ret0 = _mm512_mul_ps(_mm512_sub_ps(ret0, offsetVal), scaleVal);
+        ret1 = _mm512_mul_ps(_mm512_sub_ps(ret1, offsetVal), scaleVal);
+        ret2 = _mm512_mul_ps(_mm512_sub_ps(ret2, offsetVal), scaleVal);
+        ret3 = _mm512_mul_ps(_mm512_sub_ps(ret3, offsetVal), scaleVal);
+
+        _mm512_storeu_ps(outputPtr, ret0);
+        _mm512_storeu_ps(outputPtr + 16, ret1);
+        _mm512_storeu_ps(outputPtr + 32, ret2);
+        _mm512_storeu_ps(outputPtr + 48, ret3);
+
+        inputPtr += 64;
+        outputPtr += 64;
+    }
+
+    for (number = thirtysecondPoints * 64; number < 2 * num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offset) * scale;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_s32f_x2_offset_convert_32fc_neon(lv_32fc_t* outputVector,
+                                                            const uint8_t* inputVector,
+                                                            const float offset,
+                                                            const float scale,
+                                                            unsigned int num_points)
+{
+    float* outputPtr = (float*)outputVector;
+    const uint8_t* inputPtr = inputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number;
+
+    const float32x4_t offsetVal = vdupq_n_f32(offset);
+    uint8x16_t inputVal;
+    uint16x8_t lo, hi;
+
+    for (number = 0; number < eighthPoints; number++) {
+        inputVal = vld1q_u8(inputPtr);
+        lo = vmovl_u8(vget_low_u8(inputVal));
+        hi = vmovl_u8(vget_high_u8(inputVal));
+
+        vst1q_f32(outputPtr,
+                  vmulq_n_f32(vsubq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))),
+                                        offsetVal),
+                              scale));
+        vst1q_f32(outputPtr + 4,
+                  vmulq_n_f32(vsubq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))),
+                                        offsetVal),
+                              scale));
+        vst1q_f32(outputPtr + 8,
+                  vmulq_n_f32(vsubq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))),
+                                        offsetVal),
+                              scale));
+        vst1q_f32(outputPtr + 12,
+                  vmulq_n_f32(vsubq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))),
+                                        offsetVal),
+                              scale));
+
+        inputPtr += 16;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 16; number < 2 * num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offset) * scale;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_s32f_x2_offset_convert_32fc_H */
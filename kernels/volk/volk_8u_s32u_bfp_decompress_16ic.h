@@ -0,0 +1,238 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_s32u_bfp_decompress_16ic
+ *
+ * \b Overview
+ *
+ * Decompresses O-RAN fronthaul IQ samples in block floating point into 16 bit
+ * complex samples. The samples come in PRBs of 12, each of 1 + 3 * bits bytes:
+ * a udCompParam byte with the exponent in its low 4 bits, then the 24
+ * mantissas I0, Q0, I1, ... as bits wide two's complement numbers, most
+ * significant bit first. A component is its mantissa shifted left by the
+ * exponent; exponents too large for the width wrap around in 16 bits.
+ *
+ * volk_16ic_bfp_compress_8u compresses samples into the same format.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s32u_bfp_decompress_16ic(lv_16sc_t* outVector, const uint8_t*
+ * inVector, const unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The compressed PRBs, num_points / 12 * (1 + 3 * bits) bytes.
+ * \li bits: The width of a mantissa, 1 to 16.
+ * \li num_points: The number of complex samples, a multiple of 12; the
+ * samples of a last partial PRB are left alone.
+ *
+ * \b Outputs
+ * \li outVector: The decompressed samples.
+ *
+ * \b Example
+ * Decompress the N / 12 PRBs of a symbol with 9 bit mantissas.
+ * \code
+ *   volk_8u_s32u_bfp_decompress_16ic(samples, compressed, 9, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s32u_bfp_decompress_16ic_H
+#define INCLUDED_volk_8u_s32u_bfp_decompress_16ic_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+/* Decompresses the PRB in into its 24 components. */
+static inline void
+volk_bfp_decompress_prb(int16_t* out, const uint8_t* in, unsigned int bits)
+{
+    const unsigned int exponent = *in++ & 0x0f;
+    uint32_t bit_buffer = 0;
+    unsigned int buffered = 0, n;
+    int32_t mantissa;
+
+    for (n = 0; n < 24; n++) {
+        while (buffered < bits) {
+            bit_buffer = (bit_buffer << 8) | *in++;
+            buffered += 8;
+        }
+        buffered -= bits;
+        mantissa = (int32_t)(bit_buffer << (32 - bits - buffered)) >> (32 - bits);
+        *out++ = (int16_t)((uint32_t)mantissa << exponent);
+    }
+}
+
+/*
+ * The number of PRBs of num_prbs, prb_bytes each, from whose start a SIMD
+ * loop may access width bytes within the stream.
+ */
+static inline unsigned int
+volk_bfp_prbs(unsigned int prb_bytes, unsigned int num_prbs, unsigned int width)
+{
+    const uint64_t num_bytes = (uint64_t)num_prbs * prb_bytes;
+    uint64_t fit;
+
+    if (num_bytes < width) {
+        return 0;
+    }
+    fit = (num_bytes - width) / prb_bytes + 1;
+    return fit < num_prbs ? (unsigned int)fit : num_prbs;
+}
+
+/*
+ * The SIMD versions decompress the mantissas of a PRB in 32 bit lanes: lane j
+ * takes the four bytes from the one holding the first bit of mantissa j, the
+ * first on top, as index[4j] to index[4j + 3] pick them, is shifted left by
+ * shift[j] to move the mantissa to its top bits and back down by 32 - bits,
+ * extending the sign.
+ */
+static inline void
+volk_bfp_decompress_layout(uint8_t* index, int32_t* shift, unsigned int bits)
+{
+    unsigned int j, k;
+
+    for (j = 0; j < 24; j++) {
+        for (k = 0; k < 4; k++) {
+            index[4 * j + k] = (uint8_t)(j * bits / 8 + 3 - k);
+        }
+        shift[j] = (int32_t)(j * bits % 8);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32u_bfp_decompress_16ic_generic(lv_16sc_t* outVector,
+                                                            const uint8_t* inVector,
+                                                            const unsigned int bits,
+                                                            unsigned int num_points)
+{
+    const unsigned int num_prbs = num_points / 12;
+    unsigned int number;
+
+    for (number = 0; number < num_prbs; number++) {
+        volk_bfp_decompress_prb((int16_t*)(outVector + 12 * number), inVector, bits);
+        inVector += 1 + 3 * bits;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX512BW && LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void
+volk_8u_s32u_bfp_decompress_16ic_avx512vbmi(lv_16sc_t* outVector,
+                                            const uint8_t* inVector,
+                                            const unsigned int bits,
+                                            unsigned int num_points)
+{
+    const unsigned int num_prbs = num_points / 12;
+    int16_t* out = (int16_t*)outVector;
+    __VOLK_ATTR_ALIGNED(64) uint8_t index_bytes[128] = { 0 };
+    __VOLK_ATTR_ALIGNED(64) int32_t shift_words[32] = { 0 };
+    unsigned int number;
+
+    volk_bfp_decompress_layout(index_bytes, shift_words, bits);
+    const __m512i index0 = _mm512_load_si512(index_bytes);
+    const __m512i index1 = _mm512_load_si512(index_bytes + 64);
+    const __m512i shift0 = _mm512_load_si512(shift_words);
+    const __m512i shift1 = _mm512_load_si512(shift_words + 16);
+    const __m128i down = _mm_cvtsi32_si128(32 - bits);
+    // the masked load stays within the mantissas of the PRB
+    const __mmask64 mask = ((__mmask64)1 << (3 * bits)) - 1;
+    __m512i x, y0, y1;
+    __m128i exponent;
+
+    for (number = 0; number < num_prbs; number++) {
+        exponent = _mm_cvtsi32_si128(inVector[0] & 0x0f);
+        x = _mm512_maskz_loadu_epi8(mask, inVector + 1);
+        // mantissas 0 to 15, then 16 to 23 in the low half
+        y0 = _mm512_sllv_epi32(_mm512_permutexvar_epi8(index0, x), shift0);
+        y1 = _mm512_sllv_epi32(_mm512_permutexvar_epi8(index1, x), shift1);
+        y0 = _mm512_sll_epi32(_mm512_sra_epi32(y0, down), exponent);
+        y1 = _mm512_sll_epi32(_mm512_sra_epi32(y1, down), exponent);
+        _mm256_storeu_si256((__m256i*)out, _mm512_cvtepi32_epi16(y0));
+        _mm_storeu_si128((__m128i*)(out + 16),
+                         _mm256_castsi256_si128(_mm512_cvtepi32_epi16(y1)));
+        inVector += 1 + 3 * bits;
+        out += 24;
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW && LV_HAVE_AVX512VBMI */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_8u_s32u_bfp_decompress_16ic_neonv8(lv_16sc_t* outVector,
+                                                           const uint8_t* inVector,
+                                                           const unsigned int bits,
+                                                           unsigned int num_points)
+{
+    const unsigned int num_prbs = num_points / 12;
+    int16_t* out = (int16_t*)outVector;
+    uint8_t index_bytes[96];
+    int32_t shift_words[24];
+    uint8x16_t index[6];
+    int32x4_t shift[6];
+    unsigned int prbs, number, k;
+
+    volk_bfp_decompress_layout(index_bytes, shift_words, bits);
+    for (k = 0; k < 6; k++) {
+        index[k] = vld1q_u8(index_bytes + 16 * k);
+        shift[k] = vld1q_s32(shift_words + 4 * k);
+    }
+    const int32x4_t down = vdupq_n_s32(-(int32_t)(32 - bits));
+    int32x4_t exponent, y0, y1;
+    uint8x16x3_t x;
+
+    // a PRB loads the 48 bytes after its exponent
+    prbs = volk_bfp_prbs(1 + 3 * bits, num_prbs, 49);
+    for (number = 0; number < prbs; number++) {
+        exponent = vdupq_n_s32(inVector[0] & 0x0f);
+        x.val[0] = vld1q_u8(inVector + 1);
+        x.val[1] = vld1q_u8(inVector + 17);
+        x.val[2] = vld1q_u8(inVector + 33);
+        for (k = 0; k < 3; k++) {
+            y0 = vreinterpretq_s32_u8(vqtbl3q_u8(x, index[2 * k]));
+            y1 = vreinterpretq_s32_u8(vqtbl3q_u8(x, index[2 * k + 1]));
+            y0 = vshlq_s32(vshlq_s32(vshlq_s32(y0, shift[2 * k]), down), exponent);
+            y1 = vshlq_s32(vshlq_s32(vshlq_s32(y1, shift[2 * k + 1]), down), exponent);
+            vst1q_s16(out + 8 * k, vcombine_s16(vmovn_s32(y0), vmovn_s32(y1)));
+        }
+        inVector += 1 + 3 * bits;
+        out += 24;
+    }
+
+    for (; number < num_prbs; number++) {
+        volk_bfp_decompress_prb(out, inVector, bits);
+        inVector += 1 + 3 * bits;
+        out += 24;
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_s32u_bfp_decompress_16ic_H */
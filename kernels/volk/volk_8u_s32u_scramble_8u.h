@@ -0,0 +1,196 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_s32u_scramble_8u
+ *
+ * \b Overview
+ *
+ * Additively scrambles packed bytes, XORing their bits, most significant bit
+ * first, with the sequence of a linear feedback shift register. Sequence bit
+ * a[n] is the XOR of the a[n - k] for which the generator polynomial has an
+ * x^k term, so 1 + x^4 + x^7 is the IEEE 802.11 scrambler and 1 + x^14 + x^15
+ * the DVB one. Scrambling scrambled bytes again with the same state descrambles
+ * them.
+ *
+ * The state holds the last degree sequence bits, a[n - k] in bit k - 1, and is
+ * updated so that the next call continues the sequence.
+ *
+ * The table driven version generates the sequence 64 bits at a time from four
+ * tables of the bits each byte of the state contributes.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s32u_scramble_8u(uint8_t* outputVector, const uint8_t* inputVector,
+ * const uint32_t polynomial, uint32_t* state, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The bytes to scramble.
+ * \li polynomial: The generator polynomial, bit k holding the coefficient of x^k
+ * and the constant term implied, of degree 1 to 31.
+ * \li state: The shift register, updated on return.
+ * \li num_points: The number of bytes.
+ *
+ * \b Outputs
+ * \li outputVector: The scrambled bytes.
+ *
+ * \b Example
+ * Scramble a frame with the IEEE 802.11 scrambler.
+ * \code
+ *   uint32_t state = 0x5d;
+ *   volk_8u_s32u_scramble_8u(scrambled, frame, 0x91, &state, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s32u_scramble_8u_H
+#define INCLUDED_volk_8u_s32u_scramble_8u_H
+
+#include <inttypes.h>
+
+/* The number of 64 bit blocks below which building the tables does not pay. */
+#define VOLK_SCRAMBLE_TABLE_BLOCKS 64
+
+static inline uint32_t volk_scramble_parity(uint32_t x)
+{
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    return (0x6996 >> (x & 15)) & 1;
+}
+
+/* The mask of the state bits of polynomial, those below its degree. */
+static inline uint32_t volk_scramble_mask(uint32_t polynomial)
+{
+    uint32_t mask = 0;
+
+    while (polynomial >>= 1) {
+        mask = (mask << 1) | 1;
+    }
+    return mask;
+}
+
+/* Scrambles num_bytes bytes a sequence bit at a time. */
+static inline void volk_scramble_bits(uint8_t* outputVector,
+                                      const uint8_t* inputVector,
+                                      uint32_t polynomial,
+                                      uint32_t* state,
+                                      unsigned int num_bytes)
+{
+    const uint32_t taps = polynomial >> 1;
+    const uint32_t mask = volk_scramble_mask(polynomial);
+    uint32_t s = *state & mask, bit;
+    unsigned int number;
+    int shift;
+
+    for (number = 0; number < num_bytes; number++) {
+        uint8_t byte = inputVector[number];
+        for (shift = 7; shift >= 0; shift--) {
+            bit = volk_scramble_parity(s & taps);
+            s = ((s << 1) | bit) & mask;
+            byte ^= bit << shift;
+        }
+        outputVector[number] = byte;
+    }
+    *state = s;
+}
+
+/* The next 64 sequence bits from state s, the first in the most significant. */
+static inline uint64_t volk_scramble_block(uint32_t taps, uint32_t mask, uint32_t s)
+{
+    uint64_t block = 0;
+    uint32_t bit;
+    unsigned int n;
+
+    for (n = 0; n < 64; n++) {
+        bit = volk_scramble_parity(s & taps);
+        s = ((s << 1) | bit) & mask;
+        block = (block << 1) | bit;
+    }
+    return block;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32u_scramble_8u_generic(uint8_t* outputVector,
+                                                    const uint8_t* inputVector,
+                                                    const uint32_t polynomial,
+                                                    uint32_t* state,
+                                                    unsigned int num_points)
+{
+    volk_scramble_bits(outputVector, inputVector, polynomial, state, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32u_scramble_8u_generic_table(uint8_t* outputVector,
+                                                          const uint8_t* inputVector,
+                                                          const uint32_t polynomial,
+                                                          uint32_t* state,
+                                                          unsigned int num_points)
+{
+    const unsigned int blocks = num_points / 8;
+    const uint32_t taps = polynomial >> 1;
+    const uint32_t mask = volk_scramble_mask(polynomial);
+    uint64_t table[4][256], basis, block;
+    uint32_t s = *state & mask;
+    unsigned int number, t, bit, v, i;
+
+    if (blocks < VOLK_SCRAMBLE_TABLE_BLOCKS) {
+        volk_scramble_bits(outputVector, inputVector, polynomial, state, num_points);
+        return;
+    }
+
+    // the sequence is linear in the state, so the block of a state is the XOR
+    // of the blocks of its bits, tabulated a byte of the state at a time
+    for (t = 0; t < 4; t++) {
+        table[t][0] = 0;
+        for (bit = 0; bit < 8; bit++) {
+            basis = volk_scramble_block(taps, mask, (1u << (8 * t + bit)) & mask);
+            for (v = 1u << bit; v < 2u << bit; v++) {
+                table[t][v] = table[t][v - (1u << bit)] ^ basis;
+            }
+        }
+    }
+
+    for (number = 0; number < blocks; number++) {
+        block = table[0][s & 255] ^ table[1][(s >> 8) & 255] ^
+                table[2][(s >> 16) & 255] ^ table[3][s >> 24];
+        for (i = 0; i < 8; i++) {
+            outputVector[i] = inputVector[i] ^ (uint8_t)(block >> (56 - 8 * i));
+        }
+        // the last 64 sequence bits include the degree that make the state
+        s = (uint32_t)block & mask;
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    *state = s;
+    volk_scramble_bits(
+        outputVector, inputVector, polynomial, state, num_points - blocks * 8);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_8u_s32u_scramble_8u_H */
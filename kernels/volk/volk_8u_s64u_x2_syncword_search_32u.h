@@ -0,0 +1,386 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+/*!
+ * \page volk_8u_s64u_x2_syncword_search_32u
+ *
+ * \b Overview
+ *
+ * Searches a packed bitstream for a sync word, such as an access code of 16 to
+ * 64 bits, at every bit offset. Writes, in order, the offsets of the last bit of
+ * every match whose Hamming distance to the sync word is at most the threshold,
+ * and their number. The bits of each byte are taken most significant first.
+ *
+ * The sync word is compared as a shift register of the last 64 bits received,
+ * the latest in the least significant bit, as gr-digital's access code
+ * correlators do; mask selects the bits that count, e.g. (1 << 32) - 1 for a
+ * 32-bit access code. Offsets are only reported once the stream holds as many
+ * bits as mask spans.
+ *
+ * The SIMD versions compare the 8 offsets ending in each of several bytes at
+ * once, with shifts of the surrounding 72 bits and a vector popcount.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s64u_x2_syncword_search_32u(uint32_t* outputOffsets,
+ *                                          uint32_t* numOutputs,
+ *                                          const uint8_t* inputBits,
+ *                                          const uint64_t syncword,
+ *                                          const uint64_t mask,
+ *                                          const unsigned int threshold,
+ *                                          unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBits: The packed bitstream.
+ * \li syncword: The sync word, its last bit in the least significant bit.
+ * \li mask: The bits of the sync word that are compared.
+ * \li threshold: The most bits that may differ in a match.
+ * \li num_points: The number of bytes.
+ *
+ * \b Outputs
+ * \li outputOffsets: The bit offsets of the matches, room for 8 * num_points.
+ * \li numOutputs: The number of matches.
+ *
+ * \b Example
+ * Find the CCSDS attached sync marker with up to 4 bit errors.
+ * \code
+ *   uint32_t* offsets = (uint32_t*)volk_malloc(sizeof(uint32_t) * 8 * N, alignment);
+ *   uint32_t found;
+ *
+ *   volk_8u_s64u_x2_syncword_search_32u(
+ *       offsets, &found, bits, 0x1ACFFC1Dull, 0xFFFFFFFFull, 4, N);
+ *
+ *   for (uint32_t ii = 0; ii < found; ++ii) {
+ *       printf("frame payload at bit %u\n", offsets[ii] + 1);
+ *   }
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s64u_x2_syncword_search_32u_H
+#define INCLUDED_volk_8u_s64u_x2_syncword_search_32u_H
+
+#include <inttypes.h>
+#include <volk/volk_8u_popcnt_64u.h>
+
+/*
+ * Searches the bits of bytes firstByte to lastByte one at a time, continuing the
+ * outputs from count, and returns the new count. The shift register starts from
+ * the bytes before firstByte, and offsets below minOffset are skipped.
+ */
+static inline uint32_t volk_syncword_search_bits(uint32_t* outputOffsets,
+                                                 uint32_t count,
+                                                 const uint8_t* inputBits,
+                                                 const uint64_t syncword,
+                                                 const uint64_t mask,
+                                                 const unsigned int threshold,
+                                                 const unsigned int minOffset,
+                                                 unsigned int firstByte,
+                                                 unsigned int lastByte)
+{
+    uint64_t reg = 0;
+    unsigned int byte, bit, offset;
+
+    for (byte = firstByte >= 8 ? firstByte - 8 : 0; byte < firstByte; byte++) {
+        reg = (reg << 8) | inputBits[byte];
+    }
+    for (byte = firstByte; byte < lastByte; byte++) {
+        for (bit = 0; bit < 8; bit++) {
+            reg = (reg << 1) | ((inputBits[byte] >> (7 - bit)) & 1);
+            offset = 8 * byte + bit;
+            if (offset >= minOffset &&
+                volk_popcnt_word((reg ^ syncword) & mask) <= threshold) {
+                outputOffsets[count++] = offset;
+            }
+        }
+    }
+    return count;
+}
+
+/* The first offset with a full sync word behind it */
+static inline unsigned int volk_syncword_min_offset(uint64_t mask)
+{
+    unsigned int length = 0;
+    while (mask) {
+        mask >>= 1;
+        length++;
+    }
+    return length ? length - 1 : 0;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_8u_s64u_x2_syncword_search_32u_generic(uint32_t* outputOffsets,
+                                            uint32_t* numOutputs,
+                                            const uint8_t* inputBits,
+                                            const uint64_t syncword,
+                                            const uint64_t mask,
+                                            const unsigned int threshold,
+                                            unsigned int num_points)
+{
+    *numOutputs = volk_syncword_search_bits(outputOffsets,
+                                            0,
+                                            inputBits,
+                                            syncword,
+                                            mask,
+                                            threshold,
+                                            volk_syncword_min_offset(mask),
+                                            0,
+                                            num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void
+volk_8u_s64u_x2_syncword_search_32u_u_avx2(uint32_t* outputOffsets,
+                                           uint32_t* numOutputs,
+                                           const uint8_t* inputBits,
+                                           const uint64_t syncword,
+                                           const uint64_t mask,
+                                           const unsigned int threshold,
+                                           unsigned int num_points)
+{
+    const unsigned int minOffset = volk_syncword_min_offset(mask);
+    const __m256i syncVal = _mm256_set1_epi64x((long long)syncword);
+    const __m256i maskVal = _mm256_set1_epi64x((long long)mask);
+    const __m256i limitVal = _mm256_set1_epi64x((long long)threshold + 1);
+    // lane k gets the big endian words of bytes k + 1 to k + 8 and k to k + 7
+    const __m256i lastIdx = _mm256_setr_epi8(8, 7, 6, 5, 4, 3, 2, 1, 9, 8, 7, 6, 5, 4,
+                                             3, 2, 10, 9, 8, 7, 6, 5, 4, 3, 11, 10, 9, 8,
+                                             7, 6, 5, 4);
+    const __m256i prevIdx = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 8, 7, 6, 5, 4, 3,
+                                             2, 1, 9, 8, 7, 6, 5, 4, 3, 2, 10, 9, 8, 7,
+                                             6, 5, 4, 3);
+    __m256i window, last, prev, reg, dist;
+    uint32_t count = 0;
+    unsigned int number = num_points < 8 ? num_points : 8;
+    unsigned int bit, lane, matches[8], any;
+
+    count = volk_syncword_search_bits(
+        outputOffsets, count, inputBits, syncword, mask, threshold, minOffset, 0, number);
+
+    // the window of bytes number - 8 to number + 7 also covers the next 4 bytes
+    for (; number + 8 <= num_points; number += 4) {
+        window = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i*)(inputBits + number - 8)));
+        last = _mm256_shuffle_epi8(window, lastIdx);
+        prev = _mm256_shuffle_epi8(window, prevIdx);
+
+        any = 0;
+        for (bit = 0; bit < 8; bit++) {
+            // the 64 bits up to this bit of each byte, from the 72 bits around it
+            reg = _mm256_or_si256(_mm256_srli_epi64(last, 7 - bit),
+                                  _mm256_slli_epi64(prev, bit + 1));
+            reg = _mm256_and_si256(_mm256_xor_si256(reg, syncVal), maskVal);
+            dist = _mm256_popcnt_epi64_avx2(reg);
+            matches[bit] = _mm256_movemask_pd(
+                _mm256_castsi256_pd(_mm256_cmpgt_epi64(limitVal, dist)));
+            any |= matches[bit];
+        }
+
+        for (lane = 0; any && lane < 4; lane++) {
+            for (bit = 0; bit < 8; bit++) {
+                if ((matches[bit] >> lane) & 1) {
+                    outputOffsets[count++] = 8 * (number + lane) + bit;
+                }
+            }
+        }
+    }
+
+    *numOutputs = volk_syncword_search_bits(outputOffsets,
+                                            count,
+                                            inputBits,
+                                            syncword,
+                                            mask,
+                                            threshold,
+                                            minOffset,
+                                            number,
+                                            num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#if LV_HAVE_AVX512BW && LV_HAVE_AVX512VPOPCNTDQ
+#include <immintrin.h>
+
+static inline void
+volk_8u_s64u_x2_syncword_search_32u_u_avx512vpopcntdq(uint32_t* outputOffsets,
+                                                      uint32_t* numOutputs,
+                                                      const uint8_t* inputBits,
+                                                      const uint64_t syncword,
+                                                      const uint64_t mask,
+                                                      const unsigned int threshold,
+                                                      unsigned int num_points)
+{
+    const unsigned int minOffset = volk_syncword_min_offset(mask);
+    const __m512i syncVal = _mm512_set1_epi64((long long)syncword);
+    const __m512i maskVal = _mm512_set1_epi64((long long)mask);
+    const __m512i thresholdVal = _mm512_set1_epi64((long long)threshold);
+    // lane k gets the big endian words of bytes k + 1 to k + 8 and k to k + 7
+    const __m512i lastIdx = _mm512_set_epi64(0x08090a0b0c0d0e0f,
+                                             0x0708090a0b0c0d0e,
+                                             0x060708090a0b0c0d,
+                                             0x05060708090a0b0c,
+                                             0x0405060708090a0b,
+                                             0x030405060708090a,
+                                             0x0203040506070809,
+                                             0x0102030405060708);
+    const __m512i prevIdx = _mm512_set_epi64(0x0708090a0b0c0d0e,
+                                             0x060708090a0b0c0d,
+                                             0x05060708090a0b0c,
+                                             0x0405060708090a0b,
+                                             0x030405060708090a,
+                                             0x0203040506070809,
+                                             0x0102030405060708,
+                                             0x0001020304050607);
+    __m512i window, last, prev, reg;
+    __mmask8 matches[8], any;
+    uint32_t count = 0;
+    unsigned int number = num_points < 8 ? num_points : 8;
+    unsigned int bit, lane;
+
+    count = volk_syncword_search_bits(
+        outputOffsets, count, inputBits, syncword, mask, threshold, minOffset, 0, number);
+
+    // the window of bytes number - 8 to number + 7 covers the next 8 bytes
+    for (; number + 8 <= num_points; number += 8) {
+        window = _mm512_broadcast_i32x4(
+            _mm_loadu_si128((const __m128i*)(inputBits + number - 8)));
+        last = _mm512_shuffle_epi8(window, lastIdx);
+        prev = _mm512_shuffle_epi8(window, prevIdx);
+
+        any = 0;
+        for (bit = 0; bit < 8; bit++) {
+            // the 64 bits up to this bit of each byte, from the 72 bits around it
+            reg = _mm512_or_si512(_mm512_srli_epi64(last, 7 - bit),
+                                  _mm512_slli_epi64(prev, bit + 1));
+            reg = _mm512_and_si512(_mm512_xor_si512(reg, syncVal), maskVal);
+            matches[bit] =
+                _mm512_cmple_epu64_mask(_mm512_popcnt_epi64(reg), thresholdVal);
+            any |= matches[bit];
+        }
+
+        for (lane = 0; any && lane < 8; lane++) {
+            for (bit = 0; bit < 8; bit++) {
+                if ((matches[bit] >> lane) & 1) {
+                    outputOffsets[count++] = 8 * (number + lane) + bit;
+                }
+            }
+        }
+    }
+
+    *numOutputs = volk_syncword_search_bits(outputOffsets,
+                                            count,
+                                            inputBits,
+                                            syncword,
+                                            mask,
+                                            threshold,
+                                            minOffset,
+                                            number,
+                                            num_points);
+}
+
+#endif /* LV_HAVE_AVX512BW && LV_HAVE_AVX512VPOPCNTDQ */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void
+volk_8u_s64u_x2_syncword_search_32u_neonv8(uint32_t* outputOffsets,
+                                           uint32_t* numOutputs,
+                                           const uint8_t* inputBits,
+                                           const uint64_t syncword,
+                                           const uint64_t mask,
+                                           const unsigned int threshold,
+                                           unsigned int num_points)
+{
+    const unsigned int minOffset = volk_syncword_min_offset(mask);
+    const uint64x2_t syncVal = vdupq_n_u64(syncword);
+    const uint64x2_t maskVal = vdupq_n_u64(mask);
+    const uint64x2_t thresholdVal = vdupq_n_u64(threshold);
+    // lane k gets the big endian words of bytes k + 1 to k + 8 and k to k + 7
+    const uint8_t lastBytes[16] = { 8, 7, 6, 5, 4, 3, 2, 1, 9, 8, 7, 6, 5, 4, 3, 2 };
+    const uint8_t prevBytes[16] = { 7, 6, 5, 4, 3, 2, 1, 0, 8, 7, 6, 5, 4, 3, 2, 1 };
+    const uint8x16_t pairStep = vdupq_n_u8(2);
+    uint8x16_t window, lastIdx, prevIdx;
+    uint64x2_t last, prev, reg, matches[8], any;
+    uint32_t count = 0;
+    unsigned int number = num_points < 8 ? num_points : 8;
+    unsigned int pair, bit, lane;
+
+    count = volk_syncword_search_bits(
+        outputOffsets, count, inputBits, syncword, mask, threshold, minOffset, 0, number);
+
+    // the window of bytes number - 8 to number + 7 covers the next 8 bytes in pairs
+    for (; number + 8 <= num_points; number += 8) {
+        window = vld1q_u8(inputBits + number - 8);
+        lastIdx = vld1q_u8(lastBytes);
+        prevIdx = vld1q_u8(prevBytes);
+
+        for (pair = 0; pair < 4; pair++) {
+            last = vreinterpretq_u64_u8(vqtbl1q_u8(window, lastIdx));
+            prev = vreinterpretq_u64_u8(vqtbl1q_u8(window, prevIdx));
+            lastIdx = vaddq_u8(lastIdx, pairStep);
+            prevIdx = vaddq_u8(prevIdx, pairStep);
+
+            any = vdupq_n_u64(0);
+            for (bit = 0; bit < 8; bit++) {
+                // the 64 bits up to this bit of each byte, from the 72 bits around it
+                reg = vorrq_u64(vshlq_u64(last, vdupq_n_s64(-(int64_t)(7 - bit))),
+                                vshlq_u64(prev, vdupq_n_s64(bit + 1)));
+                reg = vandq_u64(veorq_u64(reg, syncVal), maskVal);
+                reg = vpaddlq_u32(
+                    vpaddlq_u16(vpaddlq_u8(vcntq_u8(vreinterpretq_u8_u64(reg)))));
+                matches[bit] = vcleq_u64(reg, thresholdVal);
+                any = vorrq_u64(any, matches[bit]);
+            }
+
+            if (vgetq_lane_u64(any, 0) | vgetq_lane_u64(any, 1)) {
+                for (lane = 0; lane < 2; lane++) {
+                    for (bit = 0; bit < 8; bit++) {
+                        if (lane ? vgetq_lane_u64(matches[bit], 1)
+                                 : vgetq_lane_u64(matches[bit], 0)) {
+                            outputOffsets[count++] = 8 * (number + 2 * pair + lane) + bit;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    *numOutputs = volk_syncword_search_bits(outputOffsets,
+                                            count,
+                                            inputBits,
+                                            syncword,
+                                            mask,
+                                            threshold,
+                                            minOffset,
+                                            number,
+                                            num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_s64u_x2_syncword_search_32u_H */
@@ -0,0 +1,92 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_s32u_scramble_8u.h'
+ */
+
+#ifndef INCLUDED_volk_8u_scramblepuppet_8u_H
+#define INCLUDED_volk_8u_scramblepuppet_8u_H
+
+#include <string.h>
+#include <volk/volk_8u_s32u_scramble_8u.h>
+
+/*
+ * Scrambles quarters of the bytes with the IEEE 802.11, DVB, PN23 and PN31
+ * scramblers, each in two calls which continue the sequence.
+ */
+static inline void volk_scramble_puppet(void (*kernel)(uint8_t*,
+                                                       const uint8_t*,
+                                                       const uint32_t,
+                                                       uint32_t*,
+                                                       unsigned int),
+                                        uint8_t* outputVector,
+                                        const uint8_t* inputVector,
+                                        unsigned int num_points)
+{
+    const uint32_t polynomials[4] = { 0x91, 0xc001, 0x840001, 0x90000001 };
+    const uint32_t seeds[4] = { 0x5d, 0x4a80, 0x7fffff, 0x12345678 };
+    const unsigned int quarter = num_points / 4;
+    uint32_t state;
+    unsigned int k;
+
+    memset(outputVector, 0, num_points);
+    for (k = 0; k < 4; k++) {
+        state = seeds[k];
+        kernel(outputVector, inputVector, polynomials[k], &state, quarter / 3);
+        kernel(outputVector + quarter / 3,
+               inputVector + quarter / 3,
+               polynomials[k],
+               &state,
+               quarter - quarter / 3);
+        outputVector += quarter;
+        inputVector += quarter;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_scramblepuppet_8u_generic(uint8_t* outputVector,
+                                                     const uint8_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_scramble_puppet(
+        volk_8u_s32u_scramble_8u_generic, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_scramblepuppet_8u_generic_table(uint8_t* outputVector,
+                                                           const uint8_t* inputVector,
+                                                           unsigned int num_points)
+{
+    volk_scramble_puppet(
+        volk_8u_s32u_scramble_8u_generic_table, outputVector, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_8u_scramblepuppet_8u_H */
@@ -0,0 +1,121 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_s64u_x2_syncword_search_32u.h'
+ */
+
+#ifndef INCLUDED_volk_8u_syncword_searchpuppet_32u_H
+#define INCLUDED_volk_8u_syncword_searchpuppet_32u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_8u_s64u_x2_syncword_search_32u.h>
+
+/*
+ * Searches for the CCSDS attached sync marker with up to 8 bit errors, which
+ * random bits match about once in 300 offsets, and writes the number of matches
+ * and then their offsets, as far as the output goes.
+ */
+static inline void
+volk_8u_syncword_search_puppet(void (*kernel)(uint32_t*,
+                                              uint32_t*,
+                                              const uint8_t*,
+                                              const uint64_t,
+                                              const uint64_t,
+                                              const unsigned int,
+                                              unsigned int),
+                               uint32_t* output,
+                               const uint8_t* inputBits,
+                               unsigned int num_points)
+{
+    uint32_t* offsets =
+        (uint32_t*)volk_malloc(sizeof(uint32_t) * 8 * num_points, volk_get_alignment());
+    uint32_t count = 0, match;
+
+    kernel(offsets, &count, inputBits, 0x1ACFFC1Dull, 0xFFFFFFFFull, 8, num_points);
+
+    memset(output, 0, sizeof(uint32_t) * num_points);
+    if (num_points > 0) {
+        output[0] = count;
+    }
+    for (match = 0; match < count && match + 1 < num_points; match++) {
+        output[match + 1] = offsets[match];
+    }
+
+    volk_free(offsets);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_syncword_searchpuppet_32u_generic(uint32_t* output,
+                                                             const uint8_t* inputBits,
+                                                             unsigned int num_points)
+{
+    volk_8u_syncword_search_puppet(
+        volk_8u_s64u_x2_syncword_search_32u_generic, output, inputBits, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_syncword_searchpuppet_32u_u_avx2(uint32_t* output,
+                                                            const uint8_t* inputBits,
+                                                            unsigned int num_points)
+{
+    volk_8u_syncword_search_puppet(
+        volk_8u_s64u_x2_syncword_search_32u_u_avx2, output, inputBits, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#if LV_HAVE_AVX512BW && LV_HAVE_AVX512VPOPCNTDQ
+
+static inline void
+volk_8u_syncword_searchpuppet_32u_u_avx512vpopcntdq(uint32_t* output,
+                                                    const uint8_t* inputBits,
+                                                    unsigned int num_points)
+{
+    volk_8u_syncword_search_puppet(volk_8u_s64u_x2_syncword_search_32u_u_avx512vpopcntdq,
+                                   output,
+                                   inputBits,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_AVX512BW && LV_HAVE_AVX512VPOPCNTDQ */
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_8u_syncword_searchpuppet_32u_neonv8(uint32_t* output,
+                                                            const uint8_t* inputBits,
+                                                            unsigned int num_points)
+{
+    volk_8u_syncword_search_puppet(
+        volk_8u_s64u_x2_syncword_search_32u_neonv8, output, inputBits, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_syncword_searchpuppet_32u_H */
@@ -0,0 +1,259 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_unpack_16ic
+ *
+ * \b Overview
+ *
+ * Unpacks complex samples of bits wide two's complement components, as
+ * delivered by radios with packed sample formats such as 12 bit SC12 (3 bytes
+ * per sample), 10 bit (5 bytes per 2 samples) or 4 bit SC4 (1 byte per
+ * sample), into 16 bit complex samples. The components form a little-endian
+ * bit stream, I before Q: component n occupies bits n * bits to
+ * (n + 1) * bits - 1, counting from bit 0 of the first byte. Each component is
+ * sign extended, not scaled.
+ *
+ * volk_16ic_pack_8u packs samples back into the same format.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_unpack_16ic(lv_16sc_t* outVector, const uint8_t* inVector,
+ * unsigned int bits, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li inVector: The packed samples, (2 * num_points * bits + 7) / 8 bytes.
+ * \li bits: The width of a component, 1 to 16.
+ * \li num_points: The number of complex samples.
+ *
+ * \b Outputs
+ * \li outVector: The unpacked samples.
+ *
+ * \b Example
+ * Unpack N samples of 12 bits.
+ * \code
+ *   volk_8u_unpack_16ic(samples, packed, 12, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_unpack_16ic_H
+#define INCLUDED_volk_8u_unpack_16ic_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+/* Unpacks and sign extends num_values components of the bit stream in. */
+static inline void volk_packed_unpack(int16_t* out,
+                                      const uint8_t* in,
+                                      unsigned int bits,
+                                      unsigned int num_values)
+{
+    uint32_t bit_buffer = 0;
+    unsigned int buffered = 0, n;
+
+    for (n = 0; n < num_values; n++) {
+        while (buffered < bits) {
+            bit_buffer |= (uint32_t)*in++ << buffered;
+            buffered += 8;
+        }
+        *out++ = (int16_t)((int32_t)(bit_buffer << (32 - bits)) >> (32 - bits));
+        bit_buffer >>= bits;
+        buffered -= bits;
+    }
+}
+
+/*
+ * The number of groups of 8 components, bits bytes each, a SIMD loop can run
+ * over a stream of num_values components when each group accesses the width
+ * bytes from its start.
+ */
+static inline unsigned int
+volk_packed_groups(unsigned int bits, unsigned int num_values, unsigned int width)
+{
+    const uint64_t num_bytes = ((uint64_t)num_values * bits + 7) / 8;
+    const unsigned int groups = num_values / 8;
+    uint64_t fit;
+
+    if (num_bytes < width) {
+        return 0;
+    }
+    fit = (num_bytes - width) / bits + 1;
+    return fit < groups ? (unsigned int)fit : groups;
+}
+
+/*
+ * The SIMD versions unpack a group of 8 components from a 16 byte vector:
+ * 16 bit lane j takes the bytes shuffle[2j] and shuffle[2j + 1] which hold
+ * component j, is multiplied by scale[j] to move the component to its top
+ * bits and shifted back down by 16 - bits, extending the sign. Returns 0 for
+ * the widths with components spanning three bytes, 11 and 13 to 15, which run
+ * generic.
+ */
+static inline int
+volk_packed_unpack_layout(uint8_t* shuffle, int16_t* scale, unsigned int bits)
+{
+    unsigned int j, offset;
+
+    if (bits == 0 || bits > 16) {
+        return 0;
+    }
+    for (j = 0; j < 8; j++) {
+        offset = j * bits;
+        if (offset % 8 + bits > 16) {
+            return 0;
+        }
+        shuffle[2 * j] = (uint8_t)(offset / 8);
+        shuffle[2 * j + 1] = (uint8_t)(offset / 8 + 1);
+        // 2^15 wraps to -2^15, which the low half of the product does not mind
+        scale[j] = (int16_t)(uint16_t)(1u << (16 - bits - offset % 8));
+    }
+    return 1;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_unpack_16ic_generic(lv_16sc_t* outVector,
+                                               const uint8_t* inVector,
+                                               unsigned int bits,
+                                               unsigned int num_points)
+{
+    volk_packed_unpack((int16_t*)outVector, inVector, bits, 2 * num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_unpack_16ic_ssse3(lv_16sc_t* outVector,
+                                             const uint8_t* inVector,
+                                             unsigned int bits,
+                                             unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    int16_t* out = (int16_t*)outVector;
+    __VOLK_ATTR_ALIGNED(16) uint8_t shuffle_bytes[16];
+    __VOLK_ATTR_ALIGNED(16) int16_t scale_words[8];
+    unsigned int groups = 0, number;
+
+    if (volk_packed_unpack_layout(shuffle_bytes, scale_words, bits)) {
+        const __m128i shuffle = _mm_load_si128((const __m128i*)shuffle_bytes);
+        const __m128i scale = _mm_load_si128((const __m128i*)scale_words);
+        const __m128i shift = _mm_cvtsi32_si128(16 - bits);
+        __m128i x;
+
+        groups = volk_packed_groups(bits, num_values, 16);
+        for (number = 0; number < groups; number++) {
+            x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)inVector), shuffle);
+            x = _mm_sra_epi16(_mm_mullo_epi16(x, scale), shift);
+            _mm_storeu_si128((__m128i*)out, x);
+            inVector += bits;
+            out += 8;
+        }
+    }
+
+    volk_packed_unpack(out, inVector, bits, num_values - groups * 8);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_16ic_avx2(lv_16sc_t* outVector,
+                                            const uint8_t* inVector,
+                                            unsigned int bits,
+                                            unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    int16_t* out = (int16_t*)outVector;
+    __VOLK_ATTR_ALIGNED(16) uint8_t shuffle_bytes[16];
+    __VOLK_ATTR_ALIGNED(16) int16_t scale_words[8];
+    unsigned int pairs = 0, number;
+
+    if (volk_packed_unpack_layout(shuffle_bytes, scale_words, bits)) {
+        const __m256i shuffle = _mm256_broadcastsi128_si256(
+            _mm_load_si128((const __m128i*)shuffle_bytes));
+        const __m256i scale =
+            _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)scale_words));
+        const __m128i shift = _mm_cvtsi32_si128(16 - bits);
+        __m256i x;
+
+        // a group in each 128 bit lane
+        pairs = volk_packed_groups(bits, num_values, 16) / 2;
+        for (number = 0; number < pairs; number++) {
+            x = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)inVector)),
+                _mm_loadu_si128((const __m128i*)(inVector + bits)),
+                1);
+            x = _mm256_shuffle_epi8(x, shuffle);
+            x = _mm256_sra_epi16(_mm256_mullo_epi16(x, scale), shift);
+            _mm256_storeu_si256((__m256i*)out, x);
+            inVector += 2 * bits;
+            out += 16;
+        }
+    }
+
+    volk_packed_unpack(out, inVector, bits, num_values - pairs * 16);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_8u_unpack_16ic_neonv8(lv_16sc_t* outVector,
+                                              const uint8_t* inVector,
+                                              unsigned int bits,
+                                              unsigned int num_points)
+{
+    const unsigned int num_values = 2 * num_points;
+    int16_t* out = (int16_t*)outVector;
+    uint8_t shuffle_bytes[16];
+    int16_t scale_words[8];
+    unsigned int groups = 0, number;
+
+    if (volk_packed_unpack_layout(shuffle_bytes, scale_words, bits)) {
+        const uint8x16_t shuffle = vld1q_u8(shuffle_bytes);
+        const int16x8_t scale = vld1q_s16(scale_words);
+        const int16x8_t shift = vdupq_n_s16(-(int16_t)(16 - bits));
+        int16x8_t x;
+
+        groups = volk_packed_groups(bits, num_values, 16);
+        for (number = 0; number < groups; number++) {
+            x = vreinterpretq_s16_u8(vqtbl1q_u8(vld1q_u8(inVector), shuffle));
+            vst1q_s16(out, vshlq_s16(vmulq_s16(x, scale), shift));
+            inVector += bits;
+            out += 8;
+        }
+    }
+
+    volk_packed_unpack(out, inVector, bits, num_values - groups * 8);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_unpack_16ic_H */
@@ -0,0 +1,188 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_unpack_8u
+ *
+ * \b Overview
+ *
+ * Unpacks bytes into their bits, one per output byte as 0 or 1, taking the
+ * first bit of each byte from its most significant bit or, with lsbFirst,
+ * from its least significant bit.
+ *
+ * volk_8u_pack_8u packs bits back into bytes.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_unpack_8u(uint8_t* bitVector, const uint8_t* packedBytes,
+ * const unsigned int lsbFirst, unsigned int num_points) \endcode
+ *
+ * \b Inputs
+ * \li packedBytes: The bytes to unpack, (num_points + 7) / 8 of them.
+ * \li lsbFirst: 0 to unpack the first bit of each byte from its most
+ * significant bit, otherwise from its least significant bit.
+ * \li num_points: The number of bits.
+ *
+ * \b Outputs
+ * \li bitVector: The bits, one per byte.
+ *
+ * \b Example
+ * Unpack the bits of a frame, most significant bit first.
+ * \code
+ *   volk_8u_unpack_8u(bits, bytes, 0, N);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_unpack_8u_H
+#define INCLUDED_volk_8u_unpack_8u_H
+
+#include <inttypes.h>
+#include <string.h>
+
+/* Unpacks num_points bits from (num_points + 7) / 8 bytes. */
+static inline void volk_bits_unpack(uint8_t* bitVector,
+                                    const uint8_t* packedBytes,
+                                    unsigned int lsbFirst,
+                                    unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        bitVector[number] =
+            (packedBytes[number / 8] >> (lsbFirst ? number % 8 : 7 - number % 8)) & 1;
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_unpack_8u_generic(uint8_t* bitVector,
+                                             const uint8_t* packedBytes,
+                                             const unsigned int lsbFirst,
+                                             unsigned int num_points)
+{
+    volk_bits_unpack(bitVector, packedBytes, lsbFirst, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_unpack_8u_u_ssse3(uint8_t* bitVector,
+                                             const uint8_t* packedBytes,
+                                             const unsigned int lsbFirst,
+                                             unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m128i spread = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+    const __m128i select = lsbFirst ? _mm_set1_epi64x(0x8040201008040201LL)
+                                    : _mm_set1_epi64x(0x0102040810204080LL);
+    const __m128i one = _mm_set1_epi8(1);
+    uint16_t word;
+    __m128i x;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        memcpy(&word, packedBytes, 2);
+        // each output byte masks its bit of its byte, which equals select when set
+        x = _mm_shuffle_epi8(_mm_cvtsi32_si128(word), spread);
+        x = _mm_and_si128(x, select);
+        x = _mm_and_si128(_mm_cmpeq_epi8(x, select), one);
+        _mm_storeu_si128((__m128i*)bitVector, x);
+        packedBytes += 2;
+        bitVector += 16;
+    }
+
+    volk_bits_unpack(bitVector, packedBytes, lsbFirst, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_8u_u_avx2(uint8_t* bitVector,
+                                            const uint8_t* packedBytes,
+                                            const unsigned int lsbFirst,
+                                            unsigned int num_points)
+{
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const __m256i spread =
+        _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                         2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i select = lsbFirst ? _mm256_set1_epi64x(0x8040201008040201LL)
+                                    : _mm256_set1_epi64x(0x0102040810204080LL);
+    const __m256i one = _mm256_set1_epi8(1);
+    int32_t word;
+    __m256i x;
+    unsigned int number;
+
+    for (number = 0; number < thirtysecondPoints; number++) {
+        memcpy(&word, packedBytes, 4);
+        // the in lane shuffle reaches bytes 2 and 3 as both lanes hold all 4 bytes
+        x = _mm256_shuffle_epi8(_mm256_set1_epi32(word), spread);
+        x = _mm256_and_si256(x, select);
+        x = _mm256_and_si256(_mm256_cmpeq_epi8(x, select), one);
+        _mm256_storeu_si256((__m256i*)bitVector, x);
+        packedBytes += 4;
+        bitVector += 32;
+    }
+
+    volk_bits_unpack(
+        bitVector, packedBytes, lsbFirst, num_points - thirtysecondPoints * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_unpack_8u_neon(uint8_t* bitVector,
+                                          const uint8_t* packedBytes,
+                                          const unsigned int lsbFirst,
+                                          unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const uint8_t lsbSelect[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8_t msbSelect[8] = { 128, 64, 32, 16, 8, 4, 2, 1 };
+    const uint8x8_t select = vld1_u8(lsbFirst ? lsbSelect : msbSelect);
+    const uint8x16_t one = vdupq_n_u8(1);
+    uint8x16_t x;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = vcombine_u8(vtst_u8(vdup_n_u8(packedBytes[0]), select),
+                        vtst_u8(vdup_n_u8(packedBytes[1]), select));
+        vst1q_u8(bitVector, vandq_u8(x, one));
+        packedBytes += 2;
+        bitVector += 16;
+    }
+
+    volk_bits_unpack(bitVector, packedBytes, lsbFirst, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_unpack_8u_H */
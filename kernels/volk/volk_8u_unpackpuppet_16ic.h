@@ -0,0 +1,112 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This puppet is for VOLK tests only.
+ * For documentation see 'kernels/volk/volk_8u_unpack_16ic.h'
+ */
+
+#ifndef INCLUDED_volk_8u_unpackpuppet_16ic_H
+#define INCLUDED_volk_8u_unpackpuppet_16ic_H
+
+#include <string.h>
+#include <volk/volk_8u_unpack_16ic.h>
+
+/*
+ * Unpacks 4, 10, 12 and 14 bit samples, the last left to the generic
+ * versions, from quarters of the buffers.
+ */
+static inline void
+volk_packed_unpack_puppet(void (*kernel)(lv_16sc_t*,
+                                         const uint8_t*,
+                                         unsigned int,
+                                         unsigned int),
+                          lv_16sc_t* outVector,
+                          const uint8_t* inVector,
+                          unsigned int num_points)
+{
+    const unsigned int widths[4] = { 4, 10, 12, 14 };
+    const unsigned int quarter = num_points / 4;
+    unsigned int k;
+
+    memset(outVector, 0, sizeof(lv_16sc_t) * num_points);
+    for (k = 0; k < 4; k++) {
+        kernel(outVector + k * quarter,
+               inVector + k * quarter,
+               widths[k],
+               quarter * 4 / widths[k]);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_unpackpuppet_16ic_generic(lv_16sc_t* outVector,
+                                                     const uint8_t* inVector,
+                                                     unsigned int num_points)
+{
+    volk_packed_unpack_puppet(
+        volk_8u_unpack_16ic_generic, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_unpackpuppet_16ic_ssse3(lv_16sc_t* outVector,
+                                                   const uint8_t* inVector,
+                                                   unsigned int num_points)
+{
+    volk_packed_unpack_puppet(volk_8u_unpack_16ic_ssse3, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_unpackpuppet_16ic_avx2(lv_16sc_t* outVector,
+                                                  const uint8_t* inVector,
+                                                  unsigned int num_points)
+{
+    volk_packed_unpack_puppet(volk_8u_unpack_16ic_avx2, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_8u_unpackpuppet_16ic_neonv8(lv_16sc_t* outVector,
+                                                    const uint8_t* inVector,
+                                                    unsigned int num_points)
+{
+    volk_packed_unpack_puppet(
+        volk_8u_unpack_16ic_neonv8, outVector, inVector, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_unpackpuppet_16ic_H */
@@ -0,0 +1,89 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_x2_conv_k7_traceback_8u
+ *
+ * \b Overview
+ *
+ * Decodes the bits of a K=7 convolutional code from the decisions which
+ * volk_8u_x4_conv_k7_r2_8u leaves in dec. It starts from the state with
+ * the smallest path metric after the last step, the first one on ties, and
+ * follows the surviving path back to the first step.
+ *
+ * The decision vector of a step is 64 bits, one per state, so dec holds
+ * 8 * num_bits bytes. The traceback follows one state per step, each
+ * depending on the one before, so it is a scalar loop on every machine.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_x2_conv_k7_traceback_8u(unsigned char* data, const unsigned char* dec,
+ * const unsigned char* metrics, unsigned int num_bits) \endcode
+ *
+ * \b Inputs
+ * \li dec: The decisions of num_bits steps of volk_8u_x4_conv_k7_r2_8u.
+ * \li metrics: The 64 path metrics after the last step. volk_8u_x4_conv_k7_r2_8u
+ * leaves them in X after an even number of steps and in Y after an odd one.
+ * \li num_bits: The number of steps to trace back.
+ *
+ * \b Outputs
+ * \li data: The decoded bits, one per byte, data[i] being the input bit of step i.
+ *
+ * \b Example
+ * Decode a frame of N bits followed by 6 tail bits.
+ * \code
+ *   volk_8u_x4_conv_k7_r2_8u(Y, X, syms, dec, N, 6, Branchtab);
+ *   volk_8u_x2_conv_k7_traceback_8u(bits, dec, X, N + 6);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_x2_conv_k7_traceback_8u_H
+#define INCLUDED_volk_8u_x2_conv_k7_traceback_8u_H
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_x2_conv_k7_traceback_8u_generic(unsigned char* data,
+                                                           const unsigned char* dec,
+                                                           const unsigned char* metrics,
+                                                           unsigned int num_bits)
+{
+    unsigned int state = 0, i;
+    const unsigned char* d;
+
+    for (i = 1; i < 64; i++) {
+        if (metrics[i] < metrics[state]) {
+            state = i;
+        }
+    }
+
+    // the input bit of a step is the low bit of the state it leads to, and its
+    // decision is the high bit of the state before
+    while (num_bits-- > 0) {
+        d = dec + 8 * num_bits;
+        data[num_bits] = state & 1;
+        state = (state >> 1) | (((d[state >> 3] >> (state & 7)) & 1) << 5);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_8u_x2_conv_k7_traceback_8u_H */
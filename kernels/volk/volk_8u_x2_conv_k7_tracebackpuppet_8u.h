@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_volk_8u_x2_conv_k7_tracebackpuppet_8u_H
+#define INCLUDED_volk_8u_x2_conv_k7_tracebackpuppet_8u_H
+
+#include <string.h>
+#include <volk/volk_8u_x2_conv_k7_traceback_8u.h>
+
+#ifdef LV_HAVE_GENERIC
+
+/* Traces back through num_points / 8 steps of random decisions. */
+static inline void
+volk_8u_x2_conv_k7_tracebackpuppet_8u_generic(unsigned char* data,
+                                              const unsigned char* dec,
+                                              const unsigned char* metrics,
+                                              unsigned int num_points)
+{
+    const unsigned int num_bits = num_points < 64 ? 0 : num_points / 8;
+    volk_8u_x2_conv_k7_traceback_8u_generic(data, dec, metrics, num_bits);
+    memset(data + num_bits, 0, num_points - num_bits);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_8u_x2_conv_k7_tracebackpuppet_8u_H */
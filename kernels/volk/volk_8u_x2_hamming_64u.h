@@ -0,0 +1,181 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_x2_hamming_64u
+ *
+ * \b Overview
+ *
+ * Computes the Hamming distance of two buffers, the number of bits in which
+ * they differ, as volk_8u_popcnt_64u of their exclusive or without storing it.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_x2_hamming_64u(uint64_t* distance, const uint8_t* inputBufferA,
+ *                             const uint8_t* inputBufferB, unsigned int num_bytes)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBufferA: The first buffer.
+ * \li inputBufferB: The second buffer.
+ * \li num_bytes: The number of bytes in each buffer.
+ *
+ * \b Outputs
+ * \li distance: The number of differing bits.
+ *
+ * \b Example
+ * \code
+ *   uint64_t errors;
+ *   volk_8u_x2_hamming_64u(&errors, received, transmitted, frame_len);
+ *   ber = (double)errors / (8.0 * frame_len);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_x2_hamming_64u_H
+#define INCLUDED_volk_8u_x2_hamming_64u_H
+
+#include <inttypes.h>
+#include <volk/volk_8u_popcnt_64u.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_x2_hamming_64u_generic(uint64_t* distance,
+                                                  const uint8_t* inputBufferA,
+                                                  const uint8_t* inputBufferB,
+                                                  unsigned int num_bytes)
+{
+    *distance = volk_popcnt_bytes(inputBufferA, inputBufferB, num_bytes);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_8u_x2_hamming_64u_u_avx2(uint64_t* distance,
+                                                 const uint8_t* inputBufferA,
+                                                 const uint8_t* inputBufferB,
+                                                 unsigned int num_bytes)
+{
+    const unsigned int thirtysecondPoints = num_bytes / 32;
+    __VOLK_ATTR_ALIGNED(32) uint64_t lanes[4];
+
+    _mm256_store_si256((__m256i*)lanes,
+                       _mm256_popcnt_harley_seal_avx2((const __m256i*)inputBufferA,
+                                                      (const __m256i*)inputBufferB,
+                                                      thirtysecondPoints));
+
+    *distance = lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                volk_popcnt_bytes(inputBufferA + thirtysecondPoints * 32,
+                                  inputBufferB + thirtysecondPoints * 32,
+                                  num_bytes - thirtysecondPoints * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VPOPCNTDQ
+#include <immintrin.h>
+
+static inline void volk_8u_x2_hamming_64u_u_avx512vpopcntdq(uint64_t* distance,
+                                                            const uint8_t* inputBufferA,
+                                                            const uint8_t* inputBufferB,
+                                                            unsigned int num_bytes)
+{
+    const uint8_t* aPtr = inputBufferA;
+    const uint8_t* bPtr = inputBufferB;
+    const unsigned int sixtyfourthPoints = num_bytes / 64;
+    unsigned int number = 0;
+
+    __m512i total0 = _mm512_setzero_si512();
+    __m512i total1 = _mm512_setzero_si512();
+    __m512i total2 = _mm512_setzero_si512();
+    __m512i total3 = _mm512_setzero_si512();
+    __m512i diff0, diff1, diff2, diff3;
+
+    for (; number + 4 <= sixtyfourthPoints; number += 4) {
+        diff0 = _mm512_xor_si512(_mm512_loadu_si512(aPtr), _mm512_loadu_si512(bPtr));
+        diff1 = _mm512_xor_si512(_mm512_loadu_si512(aPtr + 64),
+                                 _mm512_loadu_si512(bPtr + 64));
+        diff2 = _mm512_xor_si512(_mm512_loadu_si512(aPtr + 128),
+                                 _mm512_loadu_si512(bPtr + 128));
+        diff3 = _mm512_xor_si512(_mm512_loadu_si512(aPtr + 192),
+                                 _mm512_loadu_si512(bPtr + 192));
+        total0 = _mm512_add_epi64(total0, _mm512_popcnt_epi64(diff0));
+        total1 = _mm512_add_epi64(total1, _mm512_popcnt_epi64(diff1));
+        total2 = _mm512_add_epi64(total2, _mm512_popcnt_epi64(diff2));
+        total3 = _mm512_add_epi64(total3, _mm512_popcnt_epi64(diff3));
+        aPtr += 256;
+        bPtr += 256;
+    }
+    for (; number < sixtyfourthPoints; number++) {
+        diff0 = _mm512_xor_si512(_mm512_loadu_si512(aPtr), _mm512_loadu_si512(bPtr));
+        total0 = _mm512_add_epi64(total0, _mm512_popcnt_epi64(diff0));
+        aPtr += 64;
+        bPtr += 64;
+    }
+
+    total0 = _mm512_add_epi64(_mm512_add_epi64(total0, total1),
+                              _mm512_add_epi64(total2, total3));
+    *distance = (uint64_t)_mm512_reduce_add_epi64(total0) +
+                volk_popcnt_bytes(aPtr, bPtr, num_bytes - sixtyfourthPoints * 64);
+}
+
+#endif /* LV_HAVE_AVX512VPOPCNTDQ */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_x2_hamming_64u_neon(uint64_t* distance,
+                                               const uint8_t* inputBufferA,
+                                               const uint8_t* inputBufferB,
+                                               unsigned int num_bytes)
+{
+    const uint8_t* aPtr = inputBufferA;
+    const uint8_t* bPtr = inputBufferB;
+    const unsigned int sixteenthPoints = num_bytes / 16;
+    unsigned int number = 0;
+    unsigned int blockEnd;
+
+    uint64x2_t total = vdupq_n_u64(0);
+    uint16x8_t partial;
+    uint8x16_t diff;
+
+    while (number < sixteenthPoints) {
+        // the 16-bit lanes gain at most 16 per vector
+        blockEnd = number + 4095 < sixteenthPoints ? number + 4095 : sixteenthPoints;
+        partial = vdupq_n_u16(0);
+        for (; number < blockEnd; number++) {
+            diff = veorq_u8(vld1q_u8(aPtr), vld1q_u8(bPtr));
+            partial = vpadalq_u8(partial, vcntq_u8(diff));
+            aPtr += 16;
+            bPtr += 16;
+        }
+        total = vpadalq_u32(total, vpaddlq_u16(partial));
+    }
+
+    *distance = vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1) +
+                volk_popcnt_bytes(aPtr, bPtr, num_bytes - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_x2_hamming_64u_H */
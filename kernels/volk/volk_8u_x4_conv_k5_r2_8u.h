@@ -0,0 +1,123 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*!
+ * \page volk_8u_x4_conv_k5_r2_8u
+ *
+ * \b Overview
+ *
+ * Runs the add-compare-select steps of a Viterbi decoder for a K=5, rate 1/2
+ * convolutional code with user defined polynomials, such as the K=5 rate 1/2
+ * code of GSM. The decoder has 16 states; see volk_conv.h for the layout of the
+ * branch table, the path metrics and the decisions, which are those of
+ * volk_8u_x4_conv_k7_r2_8u. volk_conv_branchtab_init() fills the branch table
+ * and volk_conv_traceback_generic() turns the decisions into the decoded bits.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_x4_conv_k5_r2_8u(unsigned char* Y, unsigned char* X, unsigned char* syms,
+ * unsigned char* dec, unsigned int framebits, unsigned int excess, unsigned char*
+ * Branchtab) \endcode
+ *
+ * \b Inputs
+ * \li Y: Scratch space for 16 path metrics.
+ * \li X: The 16 path metrics before the first step.
+ * \li syms: The soft symbols, 2 per step, 0 for a certain 0 bit and 255 for a
+ * certain 1 bit.
+ * \li framebits: The number of data bits.
+ * \li excess: The number of tail bits after them; the decoder runs
+ * framebits + excess steps.
+ * \li Branchtab: The 16 entry branch table of the code.
+ *
+ * \b Outputs
+ * \li X: The 16 path metrics after the last step.
+ * \li dec: The decisions, 2 bytes per step.
+ *
+ * \b Example
+ * Decode a frame of N bits followed by 4 tail bits, with the polynomials
+ * octal 023 and 035.
+ * \code
+ *   const unsigned int polys[2] = { 023, 035 };
+ *   volk_conv_branchtab_init(Branchtab, polys, 16, 2);
+ *   memset(X, 0, 16);
+ *   volk_8u_x4_conv_k5_r2_8u(Y, X, syms, dec, N, 4, Branchtab);
+ *   volk_conv_traceback_generic(bits, dec, X, N + 4, 16);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_x4_conv_k5_r2_8u_H
+#define INCLUDED_volk_8u_x4_conv_k5_r2_8u_H
+
+#include <volk/volk_conv.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_x4_conv_k5_r2_8u_generic(unsigned char* Y,
+                                                    unsigned char* X,
+                                                    unsigned char* syms,
+                                                    unsigned char* dec,
+                                                    unsigned int framebits,
+                                                    unsigned int excess,
+                                                    unsigned char* Branchtab)
+{
+    volk_conv_decode_generic(Y, X, syms, dec, framebits + excess, Branchtab, 16, 2);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_8u_x4_conv_k5_r2_8u_sse3(unsigned char* Y,
+                                                 unsigned char* X,
+                                                 unsigned char* syms,
+                                                 unsigned char* dec,
+                                                 unsigned int framebits,
+                                                 unsigned int excess,
+                                                 unsigned char* Branchtab)
+{
+    _mm_conv_decode_sse3(Y, X, syms, dec, framebits + excess, Branchtab, 16, 2);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_8u_x4_conv_k5_r2_8u_neon(unsigned char* Y,
+                                                 unsigned char* X,
+                                                 unsigned char* syms,
+                                                 unsigned char* dec,
+                                                 unsigned int framebits,
+                                                 unsigned int excess,
+                                                 unsigned char* Branchtab)
+{
+    _vconv_decodeq_u8(Y, X, syms, dec, framebits + excess, Branchtab, 16, 2);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_x4_conv_k5_r2_8u_H */
@@ -28,6 +28,10 @@
  * Performs convolutional decoding for a K=7, rate 1/2 convolutional
  * code. The polynomials user defined.
  *
+ * Each step writes the 64 decisions of its add-compare-select butterflies
+ * as one 64 bit vector to dec. volk_8u_x2_conv_k7_traceback_8u turns the
+ * decisions into the decoded bits.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_8u_x4_conv_k7_r2_8u(unsigned char* Y, unsigned char* X, unsigned char* syms,
@@ -631,6 +635,185 @@ static inline void volk_8u_x4_conv_k7_r2_8u_spiral(unsigned char* Y,
 #endif /*LV_HAVE_SSE3*/
 
 
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512BW
+
+#include <immintrin.h>
+
+static inline void volk_8u_x4_conv_k7_r2_8u_avx512bw(unsigned char* Y,
+                                                     unsigned char* X,
+                                                     unsigned char* syms,
+                                                     unsigned char* dec,
+                                                     unsigned int framebits,
+                                                     unsigned int excess,
+                                                     unsigned char* Branchtab)
+{
+    // All 64 state metrics fit one register. Each step computes the survivors
+    // of the even new states in the low half and of the odd ones in the high
+    // half, then interleaves the halves back into state order.
+    const __m512i branch0 =
+        _mm512_broadcast_i64x4(_mm256_loadu_si256((const __m256i*)Branchtab));
+    const __m512i branch1 =
+        _mm512_broadcast_i64x4(_mm256_loadu_si256((const __m256i*)(Branchtab + 32)));
+    const __m512i max_metric = _mm512_set1_epi8(63);
+    const __m512i lane_order = _mm512_setr_epi64(0, 4, 1, 5, 2, 6, 3, 7);
+    const __m512i byte_order =
+        _mm512_set4_epi32(0x0f070e06, 0x0d050c04, 0x0b030a02, 0x09010800);
+    const __mmask64 high_half = 0xffffffff00000000ull;
+    unsigned char* metrics[2] = { Y, X };
+    __m512i old_metrics = _mm512_loadu_si512((const void*)X);
+    __m512i metric, metric0, metric1, m0, m1, survivors, m;
+    __m128i m7;
+    unsigned int s;
+
+    for (s = 0; s < ((framebits + excess) >> 1) * 2; s++) {
+        metric = _mm512_avg_epu8(
+            _mm512_xor_si512(_mm512_set1_epi8(syms[2 * s]), branch0),
+            _mm512_xor_si512(_mm512_set1_epi8(syms[2 * s + 1]), branch1));
+        metric = _mm512_and_si512(_mm512_srli_epi16(metric, 2), max_metric);
+        // the branch metrics from the states i and i + 32, and their complements
+        metric0 = _mm512_mask_subs_epu8(metric, high_half, max_metric, metric);
+        metric1 = _mm512_mask_subs_epu8(metric, ~high_half, max_metric, metric);
+        m0 = _mm512_adds_epu8(_mm512_shuffle_i64x2(old_metrics, old_metrics, 0x44),
+                              metric0);
+        m1 = _mm512_adds_epu8(_mm512_shuffle_i64x2(old_metrics, old_metrics, 0xee),
+                              metric1);
+        survivors = _mm512_shuffle_epi8(
+            _mm512_permutexvar_epi64(lane_order, _mm512_min_epu8(m0, m1)), byte_order);
+        m1 = _mm512_shuffle_epi8(_mm512_permutexvar_epi64(lane_order, m1), byte_order);
+        ((__mmask64*)dec)[s] = _mm512_cmpeq_epu8_mask(survivors, m1);
+
+        if ((unsigned char)_mm_cvtsi128_si32(_mm512_castsi512_si128(survivors)) > 210) {
+            m = _mm512_min_epu8(survivors,
+                                _mm512_shuffle_i64x2(survivors, survivors, 0x4e));
+            m = _mm512_min_epu8(m, _mm512_shuffle_i64x2(m, m, 0xb1));
+            m7 = _mm512_castsi512_si128(m);
+            m7 = _mm_min_epu8(_mm_srli_si128(m7, 8), m7);
+            m7 = _mm_min_epu8(_mm_srli_epi64(m7, 32), m7);
+            m7 = _mm_min_epu8(_mm_srli_epi64(m7, 16), m7);
+            m7 = _mm_min_epu8(_mm_srli_epi64(m7, 8), m7);
+            survivors = _mm512_subs_epu8(survivors, _mm512_broadcastb_epi8(m7));
+        }
+
+        _mm512_storeu_si512((void*)metrics[s & 1], survivors);
+        old_metrics = survivors;
+    }
+
+    renormalize(X, 210);
+
+    unsigned int j;
+    for (j = 0; j < (framebits + excess) % 2; ++j) {
+        int i;
+        for (i = 0; i < 64 / 2; i++) {
+            BFLY(i,
+                 (((framebits + excess) >> 1) << 1) + j,
+                 syms,
+                 Y,
+                 X,
+                 (decision_t*)dec,
+                 Branchtab);
+        }
+
+        renormalize(Y, 210);
+    }
+}
+
+#endif /*LV_HAVE_AVX512F && LV_HAVE_AVX512BW*/
+
+
+#if LV_HAVE_NEON
+
+#include <arm_neon.h>
+
+static inline void volk_8u_x4_conv_k7_r2_8u_neon(unsigned char* Y,
+                                                 unsigned char* X,
+                                                 unsigned char* syms,
+                                                 unsigned char* dec,
+                                                 unsigned int framebits,
+                                                 unsigned int excess,
+                                                 unsigned char* Branchtab)
+{
+    const uint8x16_t max_metric = vdupq_n_u8(63);
+    // the bits of the two decisions of butterfly i are 2 * i and 2 * i + 1
+    const uint8x16_t weight0 = vreinterpretq_u8_u32(vdupq_n_u32(0x40100401));
+    const uint8x16_t weight1 = vreinterpretq_u8_u32(vdupq_n_u32(0x80200802));
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    uint8x16_t sym0, sym1, s18, s19, t14, t15, m23, m24, m25, m26, d9, d10, bits, m;
+    uint8x16x2_t survivors;
+    uint8x8_t packed;
+    unsigned int s, h;
+
+    for (s = 0; s < ((framebits + excess) >> 1) * 2; s++) {
+        sym0 = vdupq_n_u8(syms[2 * s]);
+        sym1 = vdupq_n_u8(syms[2 * s + 1]);
+        for (h = 0; h < 2; h++) {
+            s18 = vld1q_u8(old_metrics + 16 * h);
+            s19 = vld1q_u8(old_metrics + 32 + 16 * h);
+            t14 = vrhaddq_u8(veorq_u8(sym0, vld1q_u8(Branchtab + 16 * h)),
+                             veorq_u8(sym1, vld1q_u8(Branchtab + 32 + 16 * h)));
+            t14 = vshrq_n_u8(t14, 2);
+            t15 = vsubq_u8(max_metric, t14);
+            m23 = vqaddq_u8(s18, t14);
+            m24 = vqaddq_u8(s19, t15);
+            m25 = vqaddq_u8(s18, t15);
+            m26 = vqaddq_u8(s19, t14);
+            survivors.val[0] = vminq_u8(m24, m23);
+            survivors.val[1] = vminq_u8(m26, m25);
+            d9 = vceqq_u8(survivors.val[0], m24);
+            d10 = vceqq_u8(survivors.val[1], m26);
+            vst2q_u8(new_metrics + 32 * h, survivors);
+
+            bits = vorrq_u8(vandq_u8(d9, weight0), vandq_u8(d10, weight1));
+            packed = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+            packed = vpadd_u8(packed, packed);
+            vst1_lane_u32((uint32_t*)(dec + 8 * s + 4 * h),
+                          vreinterpret_u32_u8(packed),
+                          0);
+        }
+
+        if (new_metrics[0] > 210) {
+            m = vminq_u8(vld1q_u8(new_metrics), vld1q_u8(new_metrics + 16));
+            m = vminq_u8(m, vld1q_u8(new_metrics + 32));
+            m = vminq_u8(m, vld1q_u8(new_metrics + 48));
+            packed = vpmin_u8(vget_low_u8(m), vget_high_u8(m));
+            packed = vpmin_u8(packed, packed);
+            packed = vpmin_u8(packed, packed);
+            packed = vpmin_u8(packed, packed);
+            m = vdupq_lane_u8(packed, 0);
+            for (h = 0; h < 4; h++) {
+                vst1q_u8(new_metrics + 16 * h,
+                         vqsubq_u8(vld1q_u8(new_metrics + 16 * h), m));
+            }
+        }
+
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    renormalize(X, 210);
+
+    unsigned int j;
+    for (j = 0; j < (framebits + excess) % 2; ++j) {
+        int i;
+        for (i = 0; i < 64 / 2; i++) {
+            BFLY(i,
+                 (((framebits + excess) >> 1) << 1) + j,
+                 syms,
+                 Y,
+                 X,
+                 (decision_t*)dec,
+                 Branchtab);
+        }
+
+        renormalize(Y, 210);
+    }
+}
+
+#endif /*LV_HAVE_NEON*/
+
+
 #if LV_HAVE_GENERIC
 
 static inline void volk_8u_x4_conv_k7_r2_8u_generic(unsigned char* Y,
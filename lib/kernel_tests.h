@@ -29,13 +29,32 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     volk_test_params_t test_params_inacc = test_params.make_tol(1e-2);
     volk_test_params_t test_params_inacc_tenth = test_params.make_tol(1e-1);
 
-    volk_test_params_t test_params_power(test_params);
+    // the power scales the rounding of the angle
+    volk_test_params_t test_params_power(test_params.make_tol(1e-5));
     test_params_power.set_scalar(2.5);
 
     volk_test_params_t test_params_rotator(test_params);
     test_params_rotator.set_scalar(std::polar(1.0f, 0.1f));
     test_params_rotator.set_tol(1e-3);
 
+    // the angles cross zero, so they compare absolutely
+    volk_test_params_t test_params_quad_demod(test_params.make_absolute(1e-5));
+    test_params_quad_demod.set_scalar(0.5f);
+
+    // clamp to [-0.5, 0.5] and scale [-1, 1] by enough to clip about a third
+    volk_test_params_t test_params_clamp(test_params);
+    test_params_clamp.set_scalar(0.5f);
+    volk_test_params_t test_params_clip(test_params);
+    test_params_clip.set_scalar(50000.f);
+
+    // the scaled sums cancel near zero, so they compare absolutely
+    volk_test_params_t test_params_axpy(test_params.make_absolute(1e-3));
+    test_params_axpy.set_scalar(lv_32fc_t(327.0f, -0.5f));
+
+    // the lower third of the points, whose mean sums them in any order
+    volk_test_params_t test_params_quantile(test_params.make_tol(1e-4));
+    test_params_quantile.set_scalar(0.3f);
+
     std::vector<volk_test_case_t> test_cases;
     QA(VOLK_INIT_PUPP(volk_64u_popcntpuppet_64u, volk_64u_popcnt, test_params))
     QA(VOLK_INIT_PUPP(volk_64u_popcntpuppet_64u, volk_64u_popcnt, test_params))
@@ -43,38 +62,105 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_PUPP(volk_16u_byteswappuppet_16u, volk_16u_byteswap, test_params))
     QA(VOLK_INIT_PUPP(volk_32u_byteswappuppet_32u, volk_32u_byteswap, test_params))
     QA(VOLK_INIT_PUPP(volk_32u_popcntpuppet_32u, volk_32u_popcnt_32u, test_params))
+    QA(VOLK_INIT_TEST(volk_8u_popcnt_64u, test_params))
+    QA(VOLK_INIT_TEST(volk_8u_x2_hamming_64u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_syncword_searchpuppet_32u,
+                      volk_8u_s64u_x2_syncword_search_32u,
+                      test_params.make_tol(0)))
     QA(VOLK_INIT_PUPP(volk_64u_byteswappuppet_64u, volk_64u_byteswap, test_params))
     QA(VOLK_INIT_PUPP(volk_32fc_s32fc_rotatorpuppet_32fc,
                       volk_32fc_s32fc_x2_rotator_32fc,
                       test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_64fc_s32fc_rotatorpuppet_64fc,
+                      volk_64fc_s64fc_x2_rotator_64fc,
+                      test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_32fc_s32fc_split_rotatorpuppet_32fc,
+                      volk_32f_x2_s32fc_x2_rotator_32f_x2,
+                      test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_16ic_s32fc_q15_rotatorpuppet_16ic,
+                      volk_16ic_s32fc_x2_q15_rotator_16ic,
+                      test_params_rotator.make_tol(2)))
+    QA(VOLK_INIT_PUPP(volk_8ic_s32fc_rotatorpuppet_32fc,
+                      volk_8ic_s32fc_x2_rotator_32fc,
+                      test_params_rotator))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_s32f_ncopuppet_32fc, volk_32fc_s32f_nco_32fc, test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_32fc_s32f_quad_demodpuppet_32f,
+                      volk_32fc_s32f_x2_quad_demod_32f,
+                      test_params_quad_demod))
+    QA(VOLK_INIT_PUPP(volk_32fc_agcpuppet_32fc,
+                      volk_32fc_s32f_x3_agc_32fc,
+                      test_params.make_tol(1e-4)))
     QA(VOLK_INIT_PUPP(
         volk_8u_conv_k7_r2puppet_8u, volk_8u_x4_conv_k7_r2_8u, test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(volk_8u_x2_conv_k7_tracebackpuppet_8u,
+                      volk_8u_x2_conv_k7_traceback_8u,
+                      test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_conv_k5_r2puppet_8u, volk_8u_x4_conv_k5_r2_8u, test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_conv_k7_r3puppet_8u, volk_8u_x4_conv_k7_r3_8u, test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_conv_k9_r2puppet_8u, volk_8u_x4_conv_k9_r2_8u, test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_conv_k9_r3puppet_8u, volk_8u_x4_conv_k9_r3_8u, test_params.make_tol(0)))
     QA(VOLK_INIT_PUPP(
         volk_32f_x2_fm_detectpuppet_32f, volk_32f_s32f_32f_fm_detect_32f, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_s32f_deinterleave_real_32f, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_deinterleave_real_8i, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_deinterleave_16i_x2, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_s32f_deinterleave_32f_x2, test_params))
+    QA(VOLK_INIT_TEST(volk_16ic_s32f_byteswap_deinterleave_32f_x2, test_params))
+    QA(VOLK_INIT_TEST(volk_16ic_s32f_byteswap_convert_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_deinterleave_real_16i, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_magnitude_16i, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_s32f_magnitude_32f, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_convert_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_unpackpuppet_16ic, volk_8u_unpack_16ic, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_s32f_unpackpuppet_32fc, volk_8u_s32f_unpack_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_16ic_packpuppet_8u, volk_16ic_pack_8u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_packpuppet_8u, volk_8u_pack_8u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_unpackpuppet_8u, volk_8u_unpack_8u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_16ic_bfp_compresspuppet_8u, volk_16ic_bfp_compress_8u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_bfp_decompresspuppet_16ic,
+                      volk_8u_s32u_bfp_decompress_16ic,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_scramblepuppet_8u, volk_8u_s32u_scramble_8u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_crcpuppet_32u, volk_8u_crc_32u, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_x2_multiply_16ic, test_params))
+    QA(VOLK_INIT_TEST(volk_16ic_x2_q15_multiply_16ic, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_x2_dot_prod_16ic, test_params))
+    QA(VOLK_INIT_TEST(volk_16ic_x2_dot_prod_32ic, test_params))
+    QA(VOLK_INIT_TEST(volk_16ic_x2_dot_prod_64ic, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_16ic_x2_q15_firpuppet_16ic, volk_16ic_x2_q15_fir_16ic, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_16i_cic_decimatepuppet_32i, volk_16i_cic_decimate_32i, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_16ic_cic_decimatepuppet_32ic, volk_16ic_cic_decimate_32ic, test_params))
     QA(VOLK_INIT_TEST(volk_16i_s32f_convert_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_lutpuppet_32f, volk_8u_32f_lut_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_16u_lutpuppet_32f, volk_16u_32f_lut_32f, test_params))
     QA(VOLK_INIT_TEST(volk_16i_convert_8i, test_params))
     QA(VOLK_INIT_TEST(volk_16i_32fc_dot_prod_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_accumulator_s32f, test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_32f_compensated_accumulator_s32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_x2_add_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_index_max_16u, test_params))
     QA(VOLK_INIT_TEST(volk_32f_index_max_32u, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_index_min_32u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_32f_multiply_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_32f_window_fftshift_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_32f_add_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32f_log2_32f, test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_TEST(volk_32f_exp_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_expfast_32f, test_params_inacc_tenth))
     QA(VOLK_INIT_TEST(volk_32f_x2_pow_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_sin_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_cos_32f, test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_32f_sincos_32f_x2, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_tan_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_atan_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_asin_32f, test_params_inacc))
@@ -82,8 +168,19 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32fc_s32f_power_32fc, test_params_power))
     QA(VOLK_INIT_TEST(volk_32f_s32f_calc_spectral_noise_floor_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_s32f_atan2_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_polar_32f_x2, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_x2_polar_to_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_x2_conjugate_dot_prod_32fc, test_params_inacc_tenth))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_sliding_xcorrpuppet_32fc,
+                      volk_32fc_x2_sliding_xcorr_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_sliding_xcorr_normalizedpuppet_32f,
+                      volk_32fc_x2_sliding_xcorr_normalized_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_goertzelpuppet_32fc, volk_32f_s32f_goertzel_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_deinterleave_32f_x2, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_deinterleave_power_32f_x3, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_deinterleave_64f_x2, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_s32f_deinterleave_real_16i, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_deinterleave_imag_32f, test_params))
@@ -91,26 +188,89 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32fc_deinterleave_real_64f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_dot_prod_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_32f_dot_prod_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_x2_matvecpuppet_32fc, volk_32fc_x2_matvec_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_x2_gemmpuppet_32fc, volk_32fc_x2_gemm_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_index_max_16u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_index_max_32u, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_index_min_32u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_s32f_magnitude_16i, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_magnitude_32f, test_params_inacc_tenth))
+    QA(VOLK_INIT_TEST(volk_32fc_magnitude_approx_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_magnitude_squared_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_add_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_multiply_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_multiply_conjugate_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_gather_multiply_conjugatepuppet_32fc,
+                      volk_32fc_x2_32u_gather_multiply_conjugate_32fc,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_gatherpuppet_32fc, volk_32fc_32u_gather_32fc, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_scatterpuppet_32fc, volk_32fc_32u_scatter_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_delay_correlatepuppet_32fc_32f,
+                      volk_32fc_s32u_x2_delay_correlate_32fc_32f,
+                      test_params.make_absolute(1e-3)))
+    // the estimates cross zero, so they compare absolutely
+    QA(VOLK_INIT_PUPP(volk_32fc_cfo_estimatepuppet_32f,
+                      volk_32fc_s32u_x2_cfo_estimate_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32fc_interp_linearpuppet_32fc,
+                      volk_32fc_s32u_interp_linear_32fc,
+                      test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_interp_linear_multiply_conjugatepuppet_32fc_x2,
+                      volk_32fc_x2_s32u_interp_linear_multiply_conjugate_32fc_x2,
+                      test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_split_multiplypuppet_32fc,
+                      volk_32f_x4_complex_multiply_32f_x2,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_split_dot_prodpuppet_32fc,
+                      volk_32f_x4_complex_dot_prod_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_32f_x2_complex_magnitude_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_divide_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_x2_dividefast_32fc, test_params.make_tol(1e-4)))
+    QA(VOLK_INIT_TEST(volk_32fc_normalize_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_conjugate_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_convert_16i, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_convert_32i, test_params))
     QA(VOLK_INIT_TEST(volk_32f_convert_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_convert_16f, test_params.make_tol(0)))
+    QA(VOLK_INIT_TEST(volk_16f_convert_32f, test_params.make_tol(0)))
+    QA(VOLK_INIT_TEST(volk_32f_convert_16bf, test_params.make_tol(0)))
+    QA(VOLK_INIT_TEST(volk_16bf_convert_32f, test_params.make_tol(0)))
+    QA(VOLK_INIT_TEST(volk_32fc_convert_16fc, test_params.make_tol(0)))
+    QA(VOLK_INIT_TEST(volk_16fc_convert_32fc, test_params.make_tol(0)))
+    QA(VOLK_INIT_TEST(volk_32fc_convert_16bfc, test_params.make_tol(0)))
+    QA(VOLK_INIT_TEST(volk_16bfc_convert_32fc, test_params.make_tol(0)))
     QA(VOLK_INIT_TEST(volk_32f_s32f_convert_8i, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_convert_16ic, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_s32f_clip_convert_16i_32u, test_params_clip))
+    QA(VOLK_INIT_TEST(volk_32fc_s32f_clip_convert_16ic_32u, test_params_clip))
+    QA(VOLK_INIT_PUPP(volk_32f_dither_convertpuppet_8i,
+                      volk_32f_s32f_x2_dither_convert_8i,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_dither_convertpuppet_16i,
+                      volk_32f_s32f_x2_dither_convert_16i,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_rand_uniformpuppet_32f, volk_32f_rand_uniform_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_rand_gaussianpuppet_32fc,
+                      volk_32fc_rand_gaussian_32fc,
+                      test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_PUPP(volk_32fc_add_awgnpuppet_32fc,
+                      volk_32fc_s32f_x2_add_awgn_32fc,
+                      test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_s32f_clamppuppet_32f, volk_32f_s32f_x2_clamp_32f, test_params_clamp))
     QA(VOLK_INIT_TEST(volk_32fc_s32f_power_spectrum_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_square_dist_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_s32f_square_dist_scalar_mult_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_x2_divide_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_x2_dividefast_32f, test_params.make_tol(1e-4)))
     QA(VOLK_INIT_TEST(volk_32f_x2_dot_prod_32f, test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_32f_x2_compensated_dot_prod_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_x2_s32f_interleave_16ic, test_params))
     QA(VOLK_INIT_TEST(volk_32f_x2_interleave_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32f_x2_max_32f, test_params))
@@ -120,20 +280,48 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32f_64f_add_64f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_normalize, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_power_32f, test_params))
+    // the raw estimates are within 1e-2, the refined and exact impls 1e-4
     QA(VOLK_INIT_TEST(volk_32f_sqrt_32f, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32f_sqrt_refinedpuppet_32f,
+                      volk_32f_sqrt_32f,
+                      test_params.make_tol(1e-4)))
+    QA(VOLK_INIT_TEST(volk_32f_invsqrt_32f, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32f_invsqrt_refinedpuppet_32f,
+                      volk_32f_invsqrt_32f,
+                      test_params.make_tol(1e-4)))
     QA(VOLK_INIT_TEST(volk_32f_s32f_stddev_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_stddev_and_mean_32f_x2, test_params_inacc))
+    // a sum of squares misses the stddev by 10% and more on the DC offset
+    QA(VOLK_INIT_PUPP(volk_32f_stddev_and_meanpuppet_32f_x2,
+                      volk_32f_stddev_and_mean_32f_x2,
+                      test_params.make_tol(1e-4)))
     QA(VOLK_INIT_TEST(volk_32f_x2_subtract_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_x3_sum_of_poly_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32i_x2_and_32i, test_params))
     QA(VOLK_INIT_TEST(volk_32i_s32f_convert_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32i_x2_or_32i, test_params))
+    QA(VOLK_INIT_TEST(volk_32i_x2_add_32i, test_params))
+    QA(VOLK_INIT_TEST(volk_32i_x2_subtract_32i, test_params))
+    QA(VOLK_INIT_TEST(volk_32i_x2_multiply_32i, test_params))
+    QA(VOLK_INIT_PUPP(volk_32i_rshiftpuppet_32i, volk_32i_s32u_rshift_32i, test_params))
+    QA(VOLK_INIT_TEST(volk_32i_x2_max_32i, test_params))
+    QA(VOLK_INIT_TEST(volk_32i_x2_min_32i, test_params))
+    QA(VOLK_INIT_TEST(volk_32u_x2_max_32u, test_params))
+    QA(VOLK_INIT_TEST(volk_32u_x2_min_32u, test_params))
+    QA(VOLK_INIT_TEST(volk_32i_x2_add_saturated_32i, test_params))
+    QA(VOLK_INIT_TEST(volk_32u_x2_add_saturated_32u, test_params))
     QA(VOLK_INIT_TEST(volk_32f_x2_dot_prod_16i, test_params))
     QA(VOLK_INIT_TEST(volk_64f_convert_32f, test_params))
     QA(VOLK_INIT_TEST(volk_64f_x2_max_64f, test_params))
     QA(VOLK_INIT_TEST(volk_64f_x2_min_64f, test_params))
     QA(VOLK_INIT_TEST(volk_64f_x2_multiply_64f, test_params))
     QA(VOLK_INIT_TEST(volk_64f_x2_add_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_64fc_x2_multiply_64fc, test_params))
+    QA(VOLK_INIT_TEST(volk_64fc_x2_multiply_conjugate_64fc, test_params))
+    QA(VOLK_INIT_TEST(volk_64fc_x2_dot_prod_64fc, test_params))
+    QA(VOLK_INIT_TEST(volk_64fc_magnitude_squared_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_convert_64fc, test_params))
+    QA(VOLK_INIT_TEST(volk_64fc_convert_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_8ic_deinterleave_16i_x2, test_params))
     QA(VOLK_INIT_TEST(volk_8ic_s32f_deinterleave_32f_x2, test_params))
     QA(VOLK_INIT_TEST(volk_8ic_deinterleave_real_16i, test_params))
@@ -141,6 +329,9 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_8ic_deinterleave_real_8i, test_params))
     QA(VOLK_INIT_TEST(volk_8ic_x2_multiply_conjugate_16ic, test_params))
     QA(VOLK_INIT_TEST(volk_8ic_x2_s32f_multiply_conjugate_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_8ic_s32f_offset_convertpuppet_32fc,
+                      volk_8u_s32f_x2_offset_convert_32fc,
+                      test_params))
     QA(VOLK_INIT_TEST(volk_8i_convert_16i, test_params))
     QA(VOLK_INIT_TEST(volk_8i_s32f_convert_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_s32fc_multiply_32fc, test_params))
@@ -148,9 +339,34 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32f_s32f_add_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_binary_slicer_32i, test_params))
     QA(VOLK_INIT_TEST(volk_32f_binary_slicer_8i, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_qpsk_slicer_8u, test_params))
     QA(VOLK_INIT_TEST(volk_32u_reverse_32u, test_params))
     QA(VOLK_INIT_TEST(volk_32f_tanh_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_x2_s32fc_multiply_conjugate_add_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_x2_s32f_axpy_32f, test_params_axpy))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_s32f_axpbypuppet_32f,
+                      volk_32f_x2_s32f_x2_axpby_32f,
+                      test_params_axpy))
+    QA(VOLK_INIT_TEST(volk_32fc_x2_s32fc_axpy_32fc, test_params_axpy))
+    QA(VOLK_INIT_TEST(volk_32fc_x2_s32f_axpy_32fc, test_params_axpy))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_s32fc_axpbypuppet_32fc,
+                      volk_32fc_x2_s32fc_x2_axpby_32fc,
+                      test_params_axpy))
+    QA(VOLK_INIT_PUPP(
+        volk_64f_x2_s32f_axpypuppet_64f, volk_64f_x2_s64f_axpy_64f, test_params_axpy))
+    QA(VOLK_INIT_PUPP(volk_64f_x2_s32f_axpbypuppet_64f,
+                      volk_64f_x2_s64f_x2_axpby_64f,
+                      test_params_axpy))
+    QA(VOLK_INIT_TEST(volk_64f_x2_dot_prod_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_64f_accumulator_s64f, test_params))
+    QA(VOLK_INIT_TEST(volk_64f_sin_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_64f_cos_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_64f_exp_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_64f_log_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_64f_sqrt_64f, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_s32fc_lms_update_dot_prodpuppet_32fc,
+                      volk_32fc_x3_s32fc_lms_update_dot_prod_32fc_x2,
+                      test_params_inacc))
     QA(VOLK_INIT_PUPP(
         volk_32f_s32f_mod_rangepuppet_32f, volk_32f_s32f_s32f_mod_range_32f, test_params))
     QA(VOLK_INIT_PUPP(
@@ -158,19 +374,168 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_PUPP(volk_32f_8u_polarbutterflypuppet_32f,
                       volk_32f_8u_polarbutterfly_32f,
                       test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_8u_polarsclfpuppet_32f, volk_32f_8u_polarsclf_32f, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_8u_x2_polarsclgpuppet_32f, volk_32f_8u_x2_polarsclg_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_polarsclprunepuppet_32f_8u,
+                      volk_32f_x2_polarsclprune_32f_8u_x2,
+                      test_params))
     QA(VOLK_INIT_PUPP(volk_32fc_s32f_power_spectral_densitypuppet_32f,
                       volk_32fc_s32f_x2_power_spectral_density_32f,
                       test_params))
-    // no one uses these, so don't test them
-    // VOLK_PROFILE(volk_16i_x5_add_quad_16i_x4, 1e-4, 2046, 10000, &results,
-    // benchmark_mode, kernel_regex); VOLK_PROFILE(volk_16i_branch_4_state_8, 1e-4, 2046,
-    // 10000, &results, benchmark_mode, kernel_regex); VOLK_PROFILE(volk_16i_max_star_16i,
-    // 0, 0, 204602, 10000, &results, benchmark_mode, kernel_regex);
-    // VOLK_PROFILE(volk_16i_max_star_horizontal_16i, 0, 0, 204602, 10000, &results,
-    // benchmark_mode, kernel_regex); VOLK_PROFILE(volk_16i_permute_and_scalar_add, 1e-4,
-    // 0, 2046, 10000, &results, benchmark_mode, kernel_regex);
-    // VOLK_PROFILE(volk_16i_x4_quad_max_star_16i, 1e-4, 0, 2046, 10000, &results,
-    // benchmark_mode, kernel_regex);
+    QA(VOLK_INIT_PUPP(volk_32fc_s32f_power_averagepuppet_32f,
+                      volk_32fc_s32f_x2_power_average_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_8i_histogrampuppet_32u, volk_8i_histogram_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_16i_histogrampuppet_32u, volk_16i_histogram_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_histogrampuppet_32u, volk_32f_s32f_x2_histogram_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_cumsumpuppet_32f,
+                      volk_32f_cumsum_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32fc_cumsumpuppet_32fc,
+                      volk_32fc_cumsum_32fc,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32f_unwrappuppet_32f,
+                      volk_32f_s32f_unwrap_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32f_biquad_cascadepuppet_32f,
+                      volk_32f_biquad_cascade_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32f_iir1puppet_32f,
+                      volk_32f_s32f_iir1_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32fc_iir1puppet_32fc,
+                      volk_32fc_s32f_iir1_32fc,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32f_moving_averagepuppet_32f,
+                      volk_32f_s32u_moving_average_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32f_median_filterpuppet_32f,
+                      volk_32f_s32u_median_filter_32f,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_block_sortpuppet_32f, volk_32f_s32u_block_sort_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_s32f_quantile_32f, test_params_quantile))
+    QA(VOLK_INIT_TEST(volk_32f_s32f_percentile_noise_floor_32f, test_params_quantile))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_index_maxpuppet_32f, volk_32f_index_max_64u_32f, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_index_minpuppet_32f, volk_32f_index_min_64u_32f, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_index_maxpuppet_32f, volk_32fc_index_max_64u_32f, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_index_minpuppet_32f, volk_32fc_index_min_64u_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_threshold_compresspuppet_32u,
+                      volk_32f_s32f_threshold_compress_32u,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_topkpuppet_32u, volk_32f_topk_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_mask_violationspuppet_32u,
+                      volk_32f_x2_mask_violations_32u,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_32f_polyvalpuppet_32f,
+                      volk_32f_32f_polyval_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32f_stats_updatepuppet_64f,
+                      volk_32f_stats_update_64f,
+                      test_params.make_absolute(1e-6)))
+    QA(VOLK_INIT_PUPP(volk_32fc_s32f_qam_llrpuppet_32f,
+                      volk_32fc_s32f_qam_llr_32f,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_s32f_qam_llrpuppet_8i, volk_32fc_s32f_qam_llr_8i, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_qam_slicerpuppet_8u, volk_32fc_qam_slicer_8u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_qam_slice_errorpuppet_32fc,
+                      volk_32fc_qam_slice_error_32fc_x2,
+                      test_params.make_absolute(1e-6)))
+    QA(VOLK_INIT_PUPP(volk_32fc_deinterleavepuppet_32fc,
+                      volk_32fc_deinterleave_32fc_xn,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_interleavepuppet_32fc, volk_32fc_xn_interleave_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_multiplystridedpuppet_32fc,
+                      volk_32fc_x2_multiply_strided_32fc,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_fftpuppet_32fc, volk_32fc_fft_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_ifftpuppet_32fc, volk_32fc_ifft_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_fft_batchpuppet_32fc,
+                      volk_32fc_fft_batch_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32f_firpuppet_32f, volk_32f_fir_32f, test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_32f_firpuppet_32fc, volk_32fc_32f_fir_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_x2_firpuppet_32fc, volk_32fc_x2_fir_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_x2_mp_dpdpuppet_32fc, volk_32fc_x2_mp_dpd_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_fir_decimatepuppet_32fc,
+                      volk_32fc_32f_fir_decimate_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_pfb_foldpuppet_32fc,
+                      volk_32fc_32f_pfb_fold_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_halfband_decimate2puppet_32fc,
+                      volk_32fc_32f_halfband_decimate2_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_fir_interpolatepuppet_32fc,
+                      volk_32fc_32f_fir_interpolate_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_fir_resamplepuppet_32fc,
+                      volk_32fc_32f_fir_resample_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_farrow_resamplepuppet_32fc,
+                      volk_32fc_s64f_x2_farrow_resample_32fc,
+                      test_params_inacc))
+    // the errors cancel near zero, so they compare absolutely
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_strobe_gardnerpuppet_32fc_32f,
+                      volk_32fc_32f_x2_strobe_gardner_32fc_32f,
+                      test_params.make_absolute(1e-3)))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_s32fc_rotator_fir_decimatepuppet_32fc,
+                      volk_32fc_32f_s32fc_x2_rotator_fir_decimate_32fc,
+                      test_params_rotator.make_tol(1e-2)))
+    // the turbo decoder helpers, through puppets where they take more vectors
+    // than the harness makes or vectors of other lengths
+    QA(VOLK_INIT_PUPP(volk_16i_x3_add_quadpuppet_16i,
+                      volk_16i_x5_add_quad_16i_x4,
+                      test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(volk_16i_x3_quad_max_starpuppet_16i,
+                      volk_16i_x4_quad_max_star_16i,
+                      test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(volk_16i_x3_add_quad_max_starpuppet_16i,
+                      volk_16i_x5_add_quad_max_star_16i,
+                      test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(volk_16i_x3_permute_and_scalar_addpuppet_16i,
+                      volk_16i_permute_and_scalar_add,
+                      test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(volk_16i_branch_4_state_8puppet_16i,
+                      volk_16i_branch_4_state_8,
+                      test_params.make_tol(0)))
+    QA(VOLK_INIT_TEST(volk_16i_max_star_16i, test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(volk_16i_max_star_horizontalpuppet_16i,
+                      volk_16i_max_star_horizontal_16i,
+                      test_params.make_tol(0)))
+
+    // the kernels out-of-tree modules registered, tested as the core ones are
+    const size_t n_registered = volk_get_registered_kernels(NULL, 0);
+    std::vector<const volk_kernel_registration_t*> registered(n_registered);
+    volk_get_registered_kernels(registered.data(), n_registered);
+    for (const volk_kernel_registration_t* kernel : registered) {
+        volk_func_desc_t desc;
+        desc.impl_names = kernel->impl_names;
+        desc.impl_deps = kernel->impl_deps;
+        desc.impl_alignment = kernel->impl_alignment;
+        desc.impls = kernel->impls;
+        desc.n_impls = kernel->n_impls;
+        desc.inplace_mask = kernel->inplace_mask;
+        // the registration does not say which inputs are read only; their
+        // impls get copies of the inputs each
+        desc.readonly_mask = 0;
+        QA(volk_test_case_t(desc, kernel->manual, kernel->name, test_params))
+    }
 
     return test_cases;
 }
@@ -2,44 +2,99 @@
 #include <volk/volk.h>
 
 #include <volk/volk.h>        // for volk_func_desc_t
+#include <volk/volk_fir.h>    // for volk_fir_32f_init, volk_fir_32f_filter
+#include <volk/volk_half.h>   // for volk_float_to_half, volk_half_to_float
 #include <volk/volk_malloc.h> // for volk_free, volk_m...
+#include <volk/volk_pfb.h>    // for volk_pfb_channelizer_create, volk_pfb_...
+#include <volk/volk_psd.h>    // for volk_psd_welch_create, volk_psd_welch_...
 
 #include <assert.h>    // for assert
 #include <stdint.h>    // for uint16_t, uint64_t
 #include <sys/time.h>  // for CLOCKS_PER_SEC
 #include <sys/types.h> // for int16_t, int32_t
+#include <algorithm> // for sort, max
+#include <atomic>    // for atomic
 #include <chrono>
 #include <cmath>    // for sqrt, fabs, abs
+#include <complex>  // for complex
 #include <cstring>  // for memcpy, memset
 #include <ctime>    // for clock
 #include <fstream>  // for operator<<, basic...
 #include <iostream> // for cout, cerr
 #include <limits>   // for numeric_limits
 #include <map>      // for map, map<>::mappe...
+#include <memory>   // for unique_ptr
 #include <random>
+#include <thread> // for thread
 #include <vector> // for vector, _Bit_refe...
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h> // for __rdtsc
+#define VOLK_QA_HAVE_TSC
+#define VOLK_QA_HAVE_CLFLUSH
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h> // for __rdtsc
+#define VOLK_QA_HAVE_TSC
+#define VOLK_QA_HAVE_CLFLUSH
+#endif
+
+#ifdef __linux__
+#include <dirent.h>           // for opendir, readdir
+#include <linux/perf_event.h> // for perf_event_attr, PERF_*
+#include <sys/ioctl.h>        // for ioctl
+#include <sys/syscall.h>      // for SYS_perf_event_open
+#include <unistd.h>           // for syscall, read, close
+#include <pthread.h>          // for pthread_setaffinity_np
+#include <sched.h>            // for cpu_set_t, CPU_SET
+#define VOLK_QA_HAVE_PERF_EVENTS
+#define VOLK_QA_HAVE_AFFINITY
+#define VOLK_QA_HAVE_ENERGY
+#endif
+
 template <typename T>
-void random_floats(void* buf, unsigned int n, std::default_random_engine& rnd_engine)
+void random_floats(void* buf,
+                   unsigned int n,
+                   std::default_random_engine& rnd_engine,
+                   T scale = T(1))
 {
     T* array = static_cast<T*>(buf);
     std::uniform_real_distribution<T> uniform_dist(T(-1), T(1));
     for (unsigned int i = 0; i < n; i++) {
-        array[i] = uniform_dist(rnd_engine);
+        array[i] = uniform_dist(rnd_engine) * scale;
     }
 }
 
-void load_random_data(void* data, volk_type_t type, unsigned int n)
+// a seed of 0 draws a fresh one from the random device; with denormals the
+// floats are scaled by the smallest normal value of their format, so all but
+// the exact zeros are denormal
+void load_random_data(
+    void* data, volk_type_t type, unsigned int n, unsigned int seed, bool denormals)
 {
     std::random_device rnd_device;
-    std::default_random_engine rnd_engine(rnd_device());
+    std::default_random_engine rnd_engine(seed ? seed : rnd_device());
     if (type.is_complex)
         n *= 2;
     if (type.is_float) {
         if (type.size == 8) {
-            random_floats<double>(data, n, rnd_engine);
+            random_floats<double>(data,
+                                  n,
+                                  rnd_engine,
+                                  denormals ? std::numeric_limits<double>::min() : 1.0);
+        } else if (type.size == 2) {
+            // uniform floats rounded to the 16-bit format, whose smallest normal
+            // is 2^-14 for halves and that of float for bfloat16
+            const float min_normal =
+                type.is_bfloat ? std::numeric_limits<float>::min() : 6.103515625e-05f;
+            std::vector<float> values(n);
+            random_floats<float>(
+                values.data(), n, rnd_engine, denormals ? min_normal : 1.0f);
+            for (unsigned int i = 0; i < n; i++) {
+                ((uint16_t*)data)[i] = type.is_bfloat ? volk_float_to_bfloat16(values[i])
+                                                      : volk_float_to_half(values[i]);
+            }
         } else {
-            random_floats<float>(data, n, rnd_engine);
+            random_floats<float>(
+                data, n, rnd_engine, denormals ? std::numeric_limits<float>::min() : 1.0f);
         }
     } else {
         float int_max = float(uint64_t(2) << (type.size * 8));
@@ -118,6 +173,7 @@ volk_type_t volk_type_from_string(std::string name)
     type.is_scalar = false;
     type.is_complex = false;
     type.is_signed = false;
+    type.is_bfloat = false;
     type.size = 0;
     type.str = name;
 
@@ -156,6 +212,9 @@ volk_type_t volk_type_from_string(std::string name)
         case 'u':
             type.is_signed = false;
             break;
+        case 'b': // bfloat16, as in 16bf
+            type.is_bfloat = true;
+            break;
         default:
             throw std::string("Error: no such type: '") + name[i] + "'";
         }
@@ -182,15 +241,30 @@ std::vector<std::string> split_signature(const std::string& protokernel_signatur
     return signature_tokens;
 }
 
+static bool is_type_name(const std::string& token)
+{
+    try {
+        volk_type_from_string(token);
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
 static void get_signatures_from_name(std::vector<volk_type_t>& inputsig,
                                      std::vector<volk_type_t>& outputsig,
-                                     std::string name)
+                                     std::string name,
+                                     std::string* op_name = NULL)
 {
 
     std::vector<std::string> toked = split_signature(name);
 
     assert(toked[0] == "volk");
     toked.erase(toked.begin());
+    // kernels registered by a module are named volk_<module>_<signature>...;
+    // not the single erase above, which volk_modtool rewrites in its copy
+    if (toked.size() > 1 && !is_type_name(toked[0]) && is_type_name(toked[1]))
+        toked.erase(toked.begin(), toked.begin() + 1);
 
     // ok. we're assuming a string in the form
     //(sig)_(multiplier-opt)_..._(name)_(sig)_(multiplier-opt)_..._(alignment)
@@ -238,112 +312,116 @@ static void get_signatures_from_name(std::vector<volk_type_t>& inputsig,
     // we don't need an output signature (some fn's operate on the input data, "in
     // place"), but we do need at least one input!
     assert(inputsig.size() != 0);
+    if (op_name)
+        *op_name = fn_name;
 }
 
-inline void run_cast_test1(volk_fn_1arg func,
-                           std::vector<void*>& buffs,
-                           unsigned int vlen,
-                           unsigned int iter,
-                           std::string arch)
-{
-    while (iter--)
-        func(buffs[0], vlen, arch.c_str());
-}
-
-inline void run_cast_test2(volk_fn_2arg func,
-                           std::vector<void*>& buffs,
-                           unsigned int vlen,
-                           unsigned int iter,
-                           std::string arch)
+// Arithmetic operations per point of a kernel, from the operation in its name
+// and whether its vector input is complex. The more specific names come first;
+// kernels that only move or convert data count as 0.
+static double flops_from_name(const std::string& op_name,
+                              const std::vector<volk_type_t>& inputsig)
 {
-    while (iter--)
-        func(buffs[0], buffs[1], vlen, arch.c_str());
-}
-
-inline void run_cast_test3(volk_fn_3arg func,
-                           std::vector<void*>& buffs,
-                           unsigned int vlen,
-                           unsigned int iter,
-                           std::string arch)
-{
-    while (iter--)
-        func(buffs[0], buffs[1], buffs[2], vlen, arch.c_str());
-}
-
-inline void run_cast_test4(volk_fn_4arg func,
-                           std::vector<void*>& buffs,
-                           unsigned int vlen,
-                           unsigned int iter,
-                           std::string arch)
-{
-    while (iter--)
-        func(buffs[0], buffs[1], buffs[2], buffs[3], vlen, arch.c_str());
-}
-
-inline void run_cast_test1_s32f(volk_fn_1arg_s32f func,
-                                std::vector<void*>& buffs,
-                                float scalar,
-                                unsigned int vlen,
-                                unsigned int iter,
-                                std::string arch)
-{
-    while (iter--)
-        func(buffs[0], scalar, vlen, arch.c_str());
-}
-
-inline void run_cast_test2_s32f(volk_fn_2arg_s32f func,
-                                std::vector<void*>& buffs,
-                                float scalar,
-                                unsigned int vlen,
-                                unsigned int iter,
-                                std::string arch)
-{
-    while (iter--)
-        func(buffs[0], buffs[1], scalar, vlen, arch.c_str());
+    static const struct {
+        const char* op;
+        double real_flops;
+        double complex_flops;
+    } op_flops[] = {
+        { "_multiply_conjugate", 1, 6 },
+        { "_magnitude_squared", 2, 3 },
+        { "_magnitude", 3, 4 },
+        { "_dot_prod", 2, 8 },
+        { "_conjugate_dot_prod", 2, 8 },
+        { "_stddev_and_mean", 3, 3 },
+        { "_accumulator", 1, 2 },
+        { "_rotator", 6, 6 },
+        { "_multiply", 1, 6 },
+        { "_divide", 1, 11 },
+        { "_add", 1, 2 },
+        { "_subtract", 1, 2 },
+        { "_index_max", 1, 4 },
+        { "_index_min", 1, 4 },
+        { "_max", 1, 1 },
+        { "_min", 1, 1 },
+    };
+    bool is_complex = false;
+    for (size_t i = 0; i < inputsig.size(); i++) {
+        if (!inputsig[i].is_scalar) {
+            is_complex = inputsig[i].is_complex;
+            break;
+        }
+    }
+    for (size_t i = 0; i < sizeof(op_flops) / sizeof(*op_flops); i++) {
+        if (op_name.find(op_flops[i].op) != std::string::npos) {
+            return is_complex ? op_flops[i].complex_flops : op_flops[i].real_flops;
+        }
+    }
+    return 0.0;
 }
 
-inline void run_cast_test3_s32f(volk_fn_3arg_s32f func,
-                                std::vector<void*>& buffs,
-                                float scalar,
-                                unsigned int vlen,
-                                unsigned int iter,
-                                std::string arch)
+double volk_qa_stream_gbps(size_t working_set)
 {
-    while (iter--)
-        func(buffs[0], buffs[1], buffs[2], scalar, vlen, arch.c_str());
-}
+    static std::map<size_t, double> stream_gbps;
+    if (working_set == 0)
+        working_set = 96 << 20;
+    std::map<size_t, double>::iterator cached = stream_gbps.find(working_set);
+    if (cached != stream_gbps.end())
+        return cached->second;
 
-inline void run_cast_test1_s32fc(volk_fn_1arg_s32fc func,
-                                 std::vector<void*>& buffs,
-                                 lv_32fc_t scalar,
-                                 unsigned int vlen,
-                                 unsigned int iter,
-                                 std::string arch)
-{
-    while (iter--)
-        func(buffs[0], scalar, vlen, arch.c_str());
+    // triad a = b + s * c, best of several passes as STREAM does, repeated
+    // until each pass moves at least 96 MiB so small sets time reliably. a and
+    // b swap after every triad so the compiler cannot drop the repeats.
+    const size_t n = std::max<size_t>(working_set / (3 * sizeof(double)), 1024);
+    const size_t repeats = std::max<size_t>((96 << 20) / (3 * sizeof(double) * n), 1);
+    std::vector<double> a(n, 0.0), b(n, 1.0), c(n, 2.0);
+    double* dst = a.data();
+    double* src = b.data();
+    double best_seconds = 0.0;
+    for (int pass = 0; pass < 5; pass++) {
+        const std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        for (size_t r = 0; r < repeats; r++) {
+            for (size_t i = 0; i < n; i++) {
+                dst[i] = src[i] + 0.5 * c[i];
+            }
+            std::swap(dst, src);
+        }
+        const std::chrono::duration<double> elapsed_seconds =
+            std::chrono::steady_clock::now() - start;
+        if (pass == 0 || elapsed_seconds.count() < best_seconds)
+            best_seconds = elapsed_seconds.count();
+    }
+    volatile double sink = src[n / 2];
+    (void)sink;
+    const double gbps =
+        (best_seconds > 0.0) ? 3.0 * sizeof(double) * n * repeats / (1e9 * best_seconds)
+                             : 0.0;
+    stream_gbps[working_set] = gbps;
+    return gbps;
 }
 
-inline void run_cast_test2_s32fc(volk_fn_2arg_s32fc func,
-                                 std::vector<void*>& buffs,
-                                 lv_32fc_t scalar,
-                                 unsigned int vlen,
-                                 unsigned int iter,
-                                 std::string arch)
-{
-    while (iter--)
-        func(buffs[0], buffs[1], scalar, vlen, arch.c_str());
-}
+// an arch under test: its impl, cast to void (*)(), or NULL to call the
+// kernel's _manual by name
+struct qa_arch_t {
+    void (*manual_func)();
+    void (*impl)();
+    std::string name;
+};
 
-inline void run_cast_test3_s32fc(volk_fn_3arg_s32fc func,
-                                 std::vector<void*>& buffs,
-                                 lv_32fc_t scalar,
-                                 unsigned int vlen,
-                                 unsigned int iter,
-                                 std::string arch)
+// the impl is called directly, so the timed loops pay no name lookup per call
+template <typename... Args>
+inline void run_cast_test(const qa_arch_t& arch, unsigned int iter, Args... args)
 {
-    while (iter--)
-        func(buffs[0], buffs[1], buffs[2], scalar, vlen, arch.c_str());
+    if (arch.impl) {
+        const auto func = (void (*)(Args...))(arch.impl);
+        while (iter--)
+            func(args...);
+    } else {
+        const auto func = (void (*)(Args..., const char*))(arch.manual_func);
+        const char* name = arch.name.c_str();
+        while (iter--)
+            func(args..., name);
+    }
 }
 
 template <class t>
@@ -392,10 +470,6 @@ bool fcompare(t* in1, t* in2, unsigned int vlen, float tol, bool absolute_mode)
 template <class t>
 bool ccompare(t* in1, t* in2, unsigned int vlen, float tol, bool absolute_mode)
 {
-    if (absolute_mode) {
-        std::cout << "ccompare does not support absolute mode" << std::endl;
-        return true;
-    }
     bool fail = false;
     int print_max_errs = 10;
     for (unsigned int i = 0; i < 2 * vlen; i += 2) {
@@ -415,8 +489,8 @@ bool ccompare(t* in1, t* in2, unsigned int vlen, float tol, bool absolute_mode)
         t norm = std::sqrt(in1[i] * in1[i] + in1[i + 1] * in1[i + 1]);
 
         // for very small numbers we'll see round off errors due to limited
-        // precision. So a special test case...
-        if (norm < 1e-30) {
+        // precision. So a special test case, as for the absolute mode...
+        if (absolute_mode || norm < 1e-30) {
             if (err > tol) {
                 fail = true;
                 if (print_max_errs-- > 0) {
@@ -466,12 +540,31 @@ bool icompare(t* in1, t* in2, unsigned int vlen, unsigned int tol, bool absolute
     return fail;
 }
 
+// the FNV-1a hash of a buffer, a word at a time, to tell whether an arch wrote
+// to an input the archs share
+static size_t buffer_hash(const void* buff, size_t bytes)
+{
+    const char* bytes_ptr = (const char*)buff;
+    uint64_t hash = 14695981039346656037ull;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= bytes; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes_ptr + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ull;
+    }
+    for (; i < bytes; i++) {
+        hash = (hash ^ (unsigned char)bytes_ptr[i]) * 1099511628211ull;
+    }
+    return (size_t)hash;
+}
+
 class volk_qa_aligned_mem_pool
 {
 public:
-    void* get_new(size_t size)
+    void* get_new(size_t size, size_t alignment = 0)
     {
-        size_t alignment = volk_get_alignment();
+        if (!alignment)
+            alignment = volk_get_alignment();
         void* ptr = volk_malloc(size, alignment);
         memset(ptr, 0x00, size);
         _mems.push_back(ptr);
@@ -505,7 +598,958 @@ bool run_volk_tests(volk_func_desc_t desc,
                           results,
                           puppet_master_name,
                           test_params.absolute_mode(),
-                          test_params.benchmark_mode());
+                          test_params.benchmark_mode(),
+                          test_params.reps(),
+                          test_params.misalign(),
+                          test_params.scalar_work(),
+                          test_params.seed(),
+                          test_params.perf_counters(),
+                          test_params.denormals(),
+                          test_params.fast(),
+                          test_params.offload(),
+                          test_params.latency(),
+                          test_params.cold(),
+                          test_params.concurrent(),
+                          test_params.energy());
+}
+
+// run one arch over the test buffers, dispatching on the kernel signature
+static void run_arch_test(const qa_arch_t& arch,
+                          std::vector<volk_type_t>& both_sigs,
+                          std::vector<volk_type_t>& inputsc,
+                          std::vector<void*>& buffs,
+                          lv_32fc_t scalar,
+                          unsigned int vlen,
+                          unsigned int iter)
+{
+    switch (both_sigs.size()) {
+    case 1:
+        if (inputsc.size() == 0) {
+            run_cast_test(arch, iter, buffs[0], vlen);
+        } else if (inputsc.size() == 1 && inputsc[0].is_float) {
+            if (inputsc[0].is_complex) {
+                run_cast_test(arch, iter, buffs[0], scalar, vlen);
+            } else {
+                run_cast_test(arch, iter, buffs[0], scalar.real(), vlen);
+            }
+        } else
+            throw "unsupported 1 arg function >1 scalars";
+        break;
+    case 2:
+        if (inputsc.size() == 0) {
+            run_cast_test(arch, iter, buffs[0], buffs[1], vlen);
+        } else if (inputsc.size() == 1 && inputsc[0].is_float) {
+            if (inputsc[0].is_complex) {
+                run_cast_test(arch, iter, buffs[0], buffs[1], scalar, vlen);
+            } else {
+                run_cast_test(arch, iter, buffs[0], buffs[1], scalar.real(), vlen);
+            }
+        } else
+            throw "unsupported 2 arg function >1 scalars";
+        break;
+    case 3:
+        if (inputsc.size() == 0) {
+            run_cast_test(arch, iter, buffs[0], buffs[1], buffs[2], vlen);
+        } else if (inputsc.size() == 1 && inputsc[0].is_float) {
+            if (inputsc[0].is_complex) {
+                run_cast_test(arch, iter, buffs[0], buffs[1], buffs[2], scalar, vlen);
+            } else {
+                run_cast_test(
+                    arch, iter, buffs[0], buffs[1], buffs[2], scalar.real(), vlen);
+            }
+        } else
+            throw "unsupported 3 arg function >1 scalars";
+        break;
+    case 4:
+        run_cast_test(arch, iter, buffs[0], buffs[1], buffs[2], buffs[3], vlen);
+        break;
+    default:
+        throw "no function handler for this signature";
+        break;
+    }
+}
+
+static double median_of(std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    const size_t mid = samples.size() / 2;
+    if (samples.size() % 2)
+        return samples[mid];
+    return 0.5 * (samples[mid - 1] + samples[mid]);
+}
+
+static inline uint64_t read_tsc()
+{
+#ifdef VOLK_QA_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static unsigned int rep_iterations(unsigned int iter, unsigned int reps)
+{
+    return (reps > 1) ? std::max(1u, iter / reps) : iter;
+}
+
+// A serial chain of scalar multiply-adds standing in for the code that runs
+// between kernel calls. It runs at whatever clock the last kernel left the
+// core at, so ISAs which lower the clock (AVX-512 licences) are charged for it.
+static double scalar_work(unsigned int n)
+{
+    volatile double x = 1.0;
+    for (unsigned int i = 0; i < n; i++) {
+        x = x * 0.999999 + 1e-6;
+    }
+    return x;
+}
+
+// median time in ms of calls runs of the scalar work, split over reps
+static double time_scalar_work(unsigned int work, unsigned int calls, unsigned int reps)
+{
+    std::vector<double> samples;
+    for (unsigned int rep = 0; rep < reps; rep++) {
+        const std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        for (unsigned int call = 0; call < calls; call++) {
+            scalar_work(work);
+        }
+        const std::chrono::duration<double> elapsed_seconds =
+            std::chrono::steady_clock::now() - start;
+        samples.push_back(1000.0 * elapsed_seconds.count());
+    }
+    return median_of(samples);
+}
+
+// median time in ms of calls copies of bytes, the cost of refreshing an in place buffer
+static double time_restore(
+    void* dst, const void* src, size_t bytes, unsigned int calls, unsigned int reps)
+{
+    std::vector<double> samples;
+    for (unsigned int rep = 0; rep < reps; rep++) {
+        const std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        for (unsigned int call = 0; call < calls; call++) {
+            memcpy(dst, src, bytes);
+        }
+        const std::chrono::duration<double> elapsed_seconds =
+            std::chrono::steady_clock::now() - start;
+        samples.push_back(1000.0 * elapsed_seconds.count());
+    }
+    return median_of(samples);
+}
+
+// the bytes of each buffer a call on vlen points touches
+static std::vector<size_t> kernel_bytes(const std::vector<volk_type_t>& both_sigs,
+                                        unsigned int vlen)
+{
+    std::vector<size_t> bytes;
+    for (size_t j = 0; j < both_sigs.size(); j++) {
+        bytes.push_back((size_t)vlen * both_sigs[j].size *
+                        (both_sigs[j].is_complex ? 2 : 1));
+    }
+    return bytes;
+}
+
+// Evict the buffers from every cache level, so that the next call reads them
+// from memory as data fresh from a NIC or DMA would be. Without a flush
+// instruction, a sweep over twice the last level cache evicts them instead.
+static void flush_buffers(const std::vector<void*>& buffs,
+                          const std::vector<size_t>& bytes)
+{
+#if defined(VOLK_QA_HAVE_CLFLUSH) || defined(__aarch64__)
+    const size_t line = volk_get_cacheline_size();
+    for (size_t j = 0; j < buffs.size(); j++) {
+        for (size_t offset = 0; offset < bytes[j]; offset += line) {
+#ifdef VOLK_QA_HAVE_CLFLUSH
+            _mm_clflush((const char*)buffs[j] + offset);
+#else
+            __asm__ __volatile__("dc civac, %0" ::"r"((const char*)buffs[j] + offset)
+                                 : "memory");
+#endif
+        }
+    }
+#ifdef VOLK_QA_HAVE_CLFLUSH
+    _mm_mfence();
+#else
+    __asm__ __volatile__("dsb ish" ::: "memory");
+#endif
+#else
+    (void)buffs;
+    (void)bytes;
+    const volk_cpu_info_t* info = volk_get_cpu_info();
+    static std::vector<char> sweep(
+        2 * std::max(info->l3_cache_size, info->l2_cache_size * info->n_cores), 1);
+    volatile char sink = 0;
+    for (size_t offset = 0; offset < sweep.size(); offset += info->cacheline_size) {
+        sink += sweep[offset];
+    }
+#endif
+}
+
+// The kernel running on copies of the buffers on n - 1 more threads while
+// one arch is timed, so that it shares the memory bandwidth and the last
+// level cache as it does when every core runs kernels. On Linux the timing
+// thread is pinned to the first allowed cpu and the others each to the next.
+class qa_contention
+{
+public:
+    qa_contention(unsigned int n_threads,
+                  const qa_arch_t& arch,
+                  std::vector<volk_type_t>& both_sigs,
+                  std::vector<volk_type_t>& inputsc,
+                  const std::vector<void*>& buffs,
+                  const std::vector<size_t>& bytes,
+                  lv_32fc_t scalar,
+                  unsigned int vlen,
+                  bool cold)
+        : _stop(false), _running(0)
+    {
+#ifdef VOLK_QA_HAVE_AFFINITY
+        std::vector<int> cpus;
+        pthread_getaffinity_np(pthread_self(), sizeof(_affinity), &_affinity);
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &_affinity))
+                cpus.push_back(cpu);
+        }
+        if (n_threads > 1 && !cpus.empty())
+            pin(pthread_self(), cpus[0]);
+#endif
+        for (unsigned int thread = 1; thread < n_threads; thread++) {
+            std::vector<void*> copies;
+            for (size_t j = 0; j < buffs.size(); j++) {
+                copies.push_back(volk_malloc(bytes[j], volk_get_alignment()));
+                memcpy(copies[j], buffs[j], bytes[j]);
+            }
+            _buffs.push_back(copies);
+            _threads.push_back(std::thread([=, &both_sigs, &inputsc]() {
+                std::vector<void*> own = copies;
+                _running++;
+                while (!_stop) {
+                    if (cold)
+                        flush_buffers(own, bytes);
+                    run_arch_test(arch, both_sigs, inputsc, own, scalar, vlen, 1);
+                }
+            }));
+#ifdef VOLK_QA_HAVE_AFFINITY
+            if (!cpus.empty())
+                pin(_threads.back().native_handle(), cpus[thread % cpus.size()]);
+#endif
+        }
+        while (_running < _threads.size()) {
+            std::this_thread::yield();
+        }
+    }
+
+    ~qa_contention()
+    {
+        _stop = true;
+        for (size_t i = 0; i < _threads.size(); i++) {
+            _threads[i].join();
+            for (size_t j = 0; j < _buffs[i].size(); j++) {
+                volk_free(_buffs[i][j]);
+            }
+        }
+#ifdef VOLK_QA_HAVE_AFFINITY
+        if (!_threads.empty())
+            pthread_setaffinity_np(pthread_self(), sizeof(_affinity), &_affinity);
+#endif
+    }
+
+    qa_contention(const qa_contention&) = delete;
+    qa_contention& operator=(const qa_contention&) = delete;
+
+private:
+#ifdef VOLK_QA_HAVE_AFFINITY
+    static void pin(pthread_t thread, int cpu)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(thread, sizeof(set), &set);
+    }
+    cpu_set_t _affinity;
+#endif
+    std::atomic<bool> _stop;
+    std::atomic<size_t> _running;
+    std::vector<std::thread> _threads;
+    std::vector<std::vector<void*>> _buffs;
+};
+
+// Hardware counters around the timed repetitions of one arch. Each event is
+// opened on its own rather than as a group, so that the kernel multiplexes
+// them when there are fewer counters than events; read() scales the counts
+// by the time each was scheduled. Events the cpu or the perf_event_paranoid
+// setting does not allow are left out.
+class qa_perf_counters
+{
+public:
+    qa_perf_counters()
+    {
+#ifdef VOLK_QA_HAVE_PERF_EVENTS
+        open_event("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        open_event("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        open_event("l1d_misses",
+                   PERF_TYPE_HW_CACHE,
+                   PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+        open_event("llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        open_event("branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+        // raw encodings valid from Sandy Bridge on: MEM_INST_RETIRED.SPLIT_LOADS
+        // and LD_BLOCKS_PARTIAL.ADDRESS_ALIAS
+        if (__builtin_cpu_is("intel")) {
+            open_event("split_loads", PERF_TYPE_RAW, 0x41d0);
+            open_event("4k_aliasing", PERF_TYPE_RAW, 0x0107);
+        }
+#endif
+#endif
+    }
+
+    ~qa_perf_counters()
+    {
+#ifdef VOLK_QA_HAVE_PERF_EVENTS
+        for (size_t i = 0; i < _fds.size(); i++) {
+            close(_fds[i]);
+        }
+#endif
+    }
+
+    qa_perf_counters(const qa_perf_counters&) = delete;
+    qa_perf_counters& operator=(const qa_perf_counters&) = delete;
+
+    bool available() const { return !_fds.empty(); }
+
+    void start()
+    {
+#ifdef VOLK_QA_HAVE_PERF_EVENTS
+        for (size_t i = 0; i < _fds.size(); i++) {
+            ioctl(_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop()
+    {
+#ifdef VOLK_QA_HAVE_PERF_EVENTS
+        for (size_t i = 0; i < _fds.size(); i++) {
+            ioctl(_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+#endif
+    }
+
+    // counts since construction, divided by points
+    std::map<std::string, double> per_point(double points) const
+    {
+        std::map<std::string, double> counts;
+#ifdef VOLK_QA_HAVE_PERF_EVENTS
+        for (size_t i = 0; i < _fds.size(); i++) {
+            uint64_t value[3]; // count, time enabled, time running
+            if (read(_fds[i], value, sizeof(value)) != (ssize_t)sizeof(value) ||
+                value[2] == 0 || points <= 0) {
+                continue;
+            }
+            counts[_names[i]] = (double)value[0] * value[1] / value[2] / points;
+        }
+#endif
+        return counts;
+    }
+
+private:
+#ifdef VOLK_QA_HAVE_PERF_EVENTS
+    void open_event(const char* name, uint32_t type, uint64_t config)
+    {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format =
+            PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        const int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (fd >= 0) {
+            _fds.push_back(fd);
+            _names.push_back(name);
+        }
+    }
+#endif
+
+    std::vector<int> _fds;
+    std::vector<std::string> _names;
+};
+
+// The energy counters of the packages: the package zones of the intel-rapl
+// powercap, which serves RAPL on Intel and, since Linux 5.8, on AMD, and
+// else the energy inputs which platforms without RAPL register as hwmon
+// devices. Both count in uJ; a powercap counter wraps at its
+// max_energy_range_uj. Recent kernels let only root read them.
+class qa_energy_meter
+{
+public:
+    qa_energy_meter()
+    {
+#ifdef VOLK_QA_HAVE_ENERGY
+        const std::string powercap("/sys/class/powercap/");
+        std::vector<std::string> zones = list_dir(powercap);
+        for (size_t i = 0; i < zones.size(); i++) {
+            // intel-rapl:N is a package or the platform (psys), which holds
+            // the packages; intel-rapl:N:M are the domains of a package
+            const std::string& zone = zones[i];
+            if (zone.compare(0, 11, "intel-rapl:") != 0 ||
+                zone.find(':', 11) != std::string::npos ||
+                read_line(powercap + zone + "/name").compare(0, 7, "package") != 0) {
+                continue;
+            }
+            add_counter(powercap + zone + "/energy_uj",
+                        atof(read_line(powercap + zone + "/max_energy_range_uj").c_str()));
+        }
+        if (!_paths.empty())
+            return;
+        const std::string hwmon("/sys/class/hwmon/");
+        std::vector<std::string> devices = list_dir(hwmon);
+        for (size_t i = 0; i < devices.size(); i++) {
+            std::vector<std::string> files = list_dir(hwmon + devices[i]);
+            for (size_t j = 0; j < files.size(); j++) {
+                const std::string& file = files[j];
+                if (file.compare(0, 6, "energy") == 0 && file.size() > 6 &&
+                    file.compare(file.size() - 6, 6, "_input") == 0) {
+                    add_counter(hwmon + devices[i] + "/" + file, 0.0);
+                }
+            }
+        }
+#endif
+    }
+
+    bool available() const { return !_paths.empty(); }
+
+    void start()
+    {
+        for (size_t i = 0; i < _paths.size(); i++) {
+            _start[i] = read_uj(i);
+        }
+    }
+
+    // uJ used by the packages since start()
+    double uj() const
+    {
+        double total = 0.0;
+        for (size_t i = 0; i < _paths.size(); i++) {
+            double used = read_uj(i) - _start[i];
+            if (used < 0)
+                used += _ranges[i];
+            total += std::max(0.0, used);
+        }
+        return total;
+    }
+
+private:
+#ifdef VOLK_QA_HAVE_ENERGY
+    static std::vector<std::string> list_dir(const std::string& path)
+    {
+        std::vector<std::string> names;
+        DIR* dir = opendir(path.c_str());
+        if (!dir)
+            return names;
+        while (struct dirent* entry = readdir(dir)) {
+            if (entry->d_name[0] != '.')
+                names.push_back(entry->d_name);
+        }
+        closedir(dir);
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+
+    static std::string read_line(const std::string& path)
+    {
+        std::ifstream file(path.c_str());
+        std::string line;
+        std::getline(file, line);
+        return line;
+    }
+
+    // counters which cannot be read are left out
+    void add_counter(const std::string& path, double range)
+    {
+        std::ifstream file(path.c_str());
+        double value;
+        if (file >> value) {
+            _paths.push_back(path);
+            _ranges.push_back(range);
+            _start.push_back(value);
+        }
+    }
+#endif
+
+    double read_uj(size_t i) const
+    {
+        std::ifstream file(_paths[i].c_str());
+        double value = _start[i];
+        file >> value;
+        return value;
+    }
+
+    std::vector<std::string> _paths;
+    std::vector<double> _ranges;
+    std::vector<double> _start;
+};
+
+// Time one arch over the buffers. With several repetitions the iterations
+// are split between them, an untimed warm-up pass runs first and the
+// median is reported. With scalar_work every call is followed by that many
+// steps of scalar work; scalar_ms, its cost at full clock, is subtracted.
+// With restore_src the first buffer, which an in place kernel overwrites, is
+// refreshed from it before every call and the cost of the copies subtracted.
+// With cold the buffers are flushed from the caches before every call, and
+// the time of the flushes subtracted. With concurrent above 1 that many - 1
+// threads run the arch on their own buffers meanwhile.
+static volk_test_time_t time_arch_test(const qa_arch_t& arch,
+                                       std::vector<volk_type_t>& both_sigs,
+                                       std::vector<volk_type_t>& inputsc,
+                                       std::vector<void*>& buffs,
+                                       lv_32fc_t scalar,
+                                       unsigned int vlen,
+                                       unsigned int iter,
+                                       unsigned int reps,
+                                       double point_bytes,
+                                       double point_flops,
+                                       unsigned int scalar_work_steps,
+                                       double scalar_ms,
+                                       bool perf_counters,
+                                       bool cold,
+                                       unsigned int concurrent,
+                                       const void* restore_src = NULL,
+                                       size_t restore_bytes = 0)
+{
+    const unsigned int rep_iter = rep_iterations(iter, reps);
+    const double restore_ms =
+        restore_src ? time_restore(buffs[0], restore_src, restore_bytes, rep_iter, reps)
+                    : 0.0;
+    const std::vector<size_t> bytes = kernel_bytes(both_sigs, vlen);
+    qa_contention contention(concurrent,
+                             arch,
+                             both_sigs,
+                             inputsc,
+                             buffs,
+                             bytes,
+                             scalar,
+                             vlen,
+                             cold);
+    std::unique_ptr<qa_perf_counters> counters(perf_counters ? new qa_perf_counters()
+                                                             : nullptr);
+    std::vector<double> samples;
+    uint64_t ticks = 0;
+    if (reps > 1) {
+        run_arch_test(arch, both_sigs, inputsc, buffs, scalar, vlen, 1);
+    }
+    for (unsigned int rep = 0; rep < reps; rep++) {
+        std::chrono::duration<double> flush_seconds(0.0);
+        uint64_t flush_ticks = 0;
+        const std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        const uint64_t start_ticks = read_tsc();
+        if (counters)
+            counters->start();
+        if (scalar_work_steps || restore_src || cold) {
+            for (unsigned int call = 0; call < rep_iter; call++) {
+                if (restore_src)
+                    memcpy(buffs[0], restore_src, restore_bytes);
+                if (cold) {
+                    const std::chrono::steady_clock::time_point flush_start =
+                        std::chrono::steady_clock::now();
+                    const uint64_t flush_start_ticks = read_tsc();
+                    flush_buffers(buffs, bytes);
+                    flush_ticks += read_tsc() - flush_start_ticks;
+                    flush_seconds += std::chrono::steady_clock::now() - flush_start;
+                }
+                run_arch_test(arch, both_sigs, inputsc, buffs, scalar, vlen, 1);
+                if (scalar_work_steps)
+                    scalar_work(scalar_work_steps);
+            }
+        } else {
+            run_arch_test(arch, both_sigs, inputsc, buffs, scalar, vlen, rep_iter);
+        }
+        if (counters)
+            counters->stop();
+        ticks += read_tsc() - start_ticks - flush_ticks;
+        const std::chrono::duration<double> elapsed_seconds =
+            std::chrono::steady_clock::now() - start - flush_seconds;
+        samples.push_back(
+            std::max(0.0, 1000.0 * elapsed_seconds.count() - scalar_ms - restore_ms));
+    }
+
+    const double arch_time = median_of(samples);
+    std::vector<double> deviations;
+    for (size_t rep = 0; rep < samples.size(); rep++) {
+        deviations.push_back(std::fabs(samples[rep] - arch_time));
+    }
+    const double points = (double)vlen * rep_iter;
+
+    volk_test_time_t result;
+    result.name = arch.name;
+    result.time = arch_time;
+    result.units = "ms";
+    result.pass = true;
+    result.reps = reps;
+    result.mad = median_of(deviations);
+    result.ns_per_point = (points > 0) ? 1e6 * arch_time / points : 0.0;
+    result.gbps = (arch_time > 0) ? point_bytes * points / (1e6 * arch_time) : 0.0;
+    result.cycles_per_point = (points > 0) ? ticks / (points * reps) : 0.0;
+    result.misaligned_time = 0.0;
+    result.inplace_time = 0.0;
+    result.gflops = (arch_time > 0) ? point_flops * points / (1e6 * arch_time) : 0.0;
+    // only profiling runs pay for the bandwidth measurement
+    const double stream_gbps =
+        (reps > 1) ? volk_qa_stream_gbps((size_t)(point_bytes * vlen)) : 0.0;
+    result.stream_fraction = (stream_gbps > 0) ? result.gbps / stream_gbps : 0.0;
+    result.p50_ns = result.p99_ns = result.p999_ns = 0.0;
+    result.nj_per_point = 0.0;
+    if (counters) {
+        if (!counters->available()) {
+            static bool warned = false;
+            if (!warned) {
+                std::cerr << "Warning: no hardware counters could be opened, check "
+                             "/proc/sys/kernel/perf_event_paranoid"
+                          << std::endl;
+                warned = true;
+            }
+        }
+        result.counters = counters->per_point(points * reps);
+    }
+    return result;
+}
+
+// Latency mode times at least this many single calls per impl, so that the
+// p99.9 lies among ten samples
+#define VOLK_QA_LATENCY_CALLS 10000
+
+// the TSC where there is one, the steady clock in ns elsewhere
+static inline uint64_t latency_now()
+{
+#ifdef VOLK_QA_HAVE_TSC
+    return read_tsc();
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+// Times calls one by one, as a real time chain makes them, and stores their
+// p50, p99 and p99.9 in result. Each sample is less the median cost of an
+// empty interval, and the ticks are converted to ns by the steady clock over
+// the whole run. Cold and concurrent are as for time_arch_test; the flushes
+// lie outside the samples.
+static void time_arch_latency(const qa_arch_t& arch,
+                              std::vector<volk_type_t>& both_sigs,
+                              std::vector<volk_type_t>& inputsc,
+                              std::vector<void*>& buffs,
+                              lv_32fc_t scalar,
+                              unsigned int vlen,
+                              unsigned int calls,
+                              bool cold,
+                              unsigned int concurrent,
+                              volk_test_time_t& result)
+{
+    const std::vector<size_t> bytes = kernel_bytes(both_sigs, vlen);
+    qa_contention contention(concurrent,
+                             arch,
+                             both_sigs,
+                             inputsc,
+                             buffs,
+                             bytes,
+                             scalar,
+                             vlen,
+                             cold);
+    std::vector<double> empty(1001);
+    for (size_t i = 0; i < empty.size(); i++) {
+        const uint64_t start = latency_now();
+        empty[i] = (double)(latency_now() - start);
+    }
+    const double overhead = median_of(empty);
+
+    std::vector<double> samples(std::max(calls, (unsigned int)VOLK_QA_LATENCY_CALLS));
+    run_arch_test(arch, both_sigs, inputsc, buffs, scalar, vlen, 1);
+    const std::chrono::steady_clock::time_point run_start =
+        std::chrono::steady_clock::now();
+    const uint64_t run_ticks = latency_now();
+    for (size_t i = 0; i < samples.size(); i++) {
+        if (cold)
+            flush_buffers(buffs, bytes);
+        const uint64_t start = latency_now();
+        run_arch_test(arch, both_sigs, inputsc, buffs, scalar, vlen, 1);
+        samples[i] = std::max(0.0, (double)(latency_now() - start) - overhead);
+    }
+    const double ticks = (double)(latency_now() - run_ticks);
+    const std::chrono::duration<double, std::nano> run_ns =
+        std::chrono::steady_clock::now() - run_start;
+    const double ns_per_tick = (ticks > 0) ? run_ns.count() / ticks : 0.0;
+
+    std::sort(samples.begin(), samples.end());
+    const size_t last = samples.size() - 1;
+    result.p50_ns = ns_per_tick * samples[last / 2];
+    result.p99_ns = ns_per_tick * samples[(size_t)(0.99 * last)];
+    result.p999_ns = ns_per_tick * samples[(size_t)(0.999 * last)];
+}
+
+// Energy mode runs an arch for at least this long, far above the ~1 ms in
+// which the counters update, in batches of about this many points
+#define VOLK_QA_ENERGY_MS 250
+#define VOLK_QA_ENERGY_BATCH 65536
+
+// Measures the energy the packages use while the arch runs back to back and
+// stores it per point in result. Idle cores and the uncore count too, so a
+// faster impl is charged less of that static power, as on a receiver which
+// sleeps between blocks.
+static void measure_arch_energy(const qa_arch_t& arch,
+                                std::vector<volk_type_t>& both_sigs,
+                                std::vector<volk_type_t>& inputsc,
+                                std::vector<void*>& buffs,
+                                lv_32fc_t scalar,
+                                unsigned int vlen,
+                                qa_energy_meter& meter,
+                                volk_test_time_t& result)
+{
+    const unsigned int batch = std::max(1u, VOLK_QA_ENERGY_BATCH / std::max(1u, vlen));
+    run_arch_test(arch, both_sigs, inputsc, buffs, scalar, vlen, 1);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    meter.start();
+    double points = 0.0;
+    do {
+        run_arch_test(arch, both_sigs, inputsc, buffs, scalar, vlen, batch);
+        points += (double)batch * vlen;
+    } while (std::chrono::steady_clock::now() - start <
+             std::chrono::milliseconds(VOLK_QA_ENERGY_MS));
+    result.nj_per_point = (points > 0) ? 1e3 * meter.uj() / points : 0.0;
+}
+
+static void print_time_stats(const volk_test_time_t& result)
+{
+    if (result.reps > 1) {
+        std::cout << " (median of " << result.reps << ", MAD " << result.mad << " ms, "
+                  << result.ns_per_point << " ns/point, " << result.gbps << " GB/s";
+        if (result.stream_fraction > 0) {
+            std::cout << " = " << 100.0 * result.stream_fraction << "% of STREAM";
+        }
+        if (result.gflops > 0) {
+            std::cout << ", " << result.gflops << " GFLOP/s";
+        }
+        if (result.stream_fraction >= VOLK_QA_MEMORY_BOUND_FRACTION) {
+            std::cout << ", memory bound";
+        }
+        if (result.cycles_per_point > 0) {
+            std::cout << ", " << result.cycles_per_point << " ticks/point";
+        }
+        std::cout << ")";
+    }
+    if (result.p99_ns > 0) {
+        std::cout << std::endl
+                  << "    latency p50 " << result.p50_ns << " ns, p99 " << result.p99_ns
+                  << " ns, p99.9 " << result.p999_ns << " ns";
+    }
+    if (result.nj_per_point > 0) {
+        std::cout << std::endl << "    energy " << result.nj_per_point << " nJ/point";
+    }
+    if (!result.counters.empty()) {
+        std::cout << std::endl << "    per point:";
+        std::map<std::string, double>::const_iterator counter;
+        for (counter = result.counters.begin(); counter != result.counters.end();
+             ++counter) {
+            std::cout << " " << counter->first << " " << counter->second;
+        }
+    }
+}
+
+// rank by the upper end of a ~95% confidence interval of the median,
+// so an impl has to be clearly faster to beat a steadier one
+static double time_score(const volk_test_time_t& result)
+{
+    return result.time + 2.0 * 1.4826 * result.mad / std::sqrt((double)result.reps);
+}
+
+// the lower end of the interval time_score is the upper end of
+static double time_lower_bound(const volk_test_time_t& result)
+{
+    return result.time - 2.0 * 1.4826 * result.mad / std::sqrt((double)result.reps);
+}
+
+// what an impl is ranked by: its p99 latency, its energy per point, or its
+// time score; with lower the lower end of its interval
+static double rank_score(const volk_test_time_t& result,
+                         bool latency,
+                         bool energy,
+                         bool lower = false)
+{
+    if (latency)
+        return result.p99_ns;
+    if (energy)
+        return result.nj_per_point;
+    return lower ? time_lower_bound(result) : time_score(result);
+}
+
+// Fast profiling times every impl on a short trial, drops those which are
+// clearly slower and times the rest on trials growing by the given factor,
+// up to a quarter of the iterations; the times are scaled to the full count.
+#define VOLK_QA_FAST_FIRST_TRIAL 64
+#define VOLK_QA_FAST_LAST_TRIAL 4
+#define VOLK_QA_FAST_GROWTH 4
+
+static void scale_time(volk_test_time_t& result, double factor)
+{
+    result.time *= factor;
+    result.mad *= factor;
+}
+
+// drop the contenders of one ranking whose interval lies wholly above that
+// of the best one; they are slower whatever the noise
+static void drop_dominated(const std::vector<double>& scores,
+                           const std::vector<double>& lower_bounds,
+                           std::vector<bool>& contending)
+{
+    double best = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < scores.size(); i++) {
+        if (contending[i])
+            best = std::min(best, scores[i]);
+    }
+    for (size_t i = 0; i < scores.size(); i++) {
+        if (contending[i] && lower_bounds[i] > best)
+            contending[i] = false;
+    }
+}
+
+// compare a kernel output to the expected one, true if they differ
+static bool compare_buffer(const volk_type_t& sig,
+                           void* expected,
+                           void* actual,
+                           unsigned int vlen,
+                           float tol_f,
+                           unsigned int tol_i,
+                           bool absolute_mode)
+{
+    bool fail = false;
+    if (sig.is_float && sig.size == 2) {
+        // widen the 16-bit floats, which every float holds exactly
+        const unsigned int n = vlen * (sig.is_complex ? 2 : 1);
+        std::vector<float> expected_f(n), actual_f(n);
+        for (unsigned int i = 0; i < n; i++) {
+            const uint16_t e = ((uint16_t*)expected)[i];
+            const uint16_t a = ((uint16_t*)actual)[i];
+            if (sig.is_bfloat) {
+                expected_f[i] = volk_bfloat16_to_float(e);
+                actual_f[i] = volk_bfloat16_to_float(a);
+            } else {
+                expected_f[i] = volk_half_to_float(e);
+                actual_f[i] = volk_half_to_float(a);
+            }
+        }
+        if (sig.is_complex) {
+            fail = ccompare(
+                expected_f.data(), actual_f.data(), vlen, tol_f, absolute_mode);
+        } else {
+            fail = fcompare(
+                expected_f.data(), actual_f.data(), vlen, tol_f, absolute_mode);
+        }
+    } else if (sig.is_float) {
+        if (sig.size == 8) {
+            if (sig.is_complex) {
+                fail = ccompare((double*)expected,
+                                (double*)actual,
+                                vlen,
+                                tol_f,
+                                absolute_mode);
+            } else {
+                fail = fcompare((double*)expected,
+                                (double*)actual,
+                                vlen,
+                                tol_f,
+                                absolute_mode);
+            }
+        } else {
+            if (sig.is_complex) {
+                fail = ccompare((float*)expected,
+                                (float*)actual,
+                                vlen,
+                                tol_f,
+                                absolute_mode);
+            } else {
+                fail = fcompare((float*)expected,
+                                (float*)actual,
+                                vlen,
+                                tol_f,
+                                absolute_mode);
+            }
+        }
+    } else {
+        // i could replace this whole switch statement with a memcmp if i
+        // wasn't interested in printing the outputs where they differ
+        switch (sig.size) {
+        case 8:
+            if (sig.is_signed) {
+                fail = icompare((int64_t*)expected,
+                                (int64_t*)actual,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            } else {
+                fail = icompare((uint64_t*)expected,
+                                (uint64_t*)actual,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            }
+            break;
+        case 4:
+            if (sig.is_signed) {
+                fail = icompare((int32_t*)expected,
+                                (int32_t*)actual,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            } else {
+                fail = icompare((uint32_t*)expected,
+                                (uint32_t*)actual,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            }
+            break;
+        case 2:
+            if (sig.is_signed) {
+                fail = icompare((int16_t*)expected,
+                                (int16_t*)actual,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            } else {
+                fail = icompare((uint16_t*)expected,
+                                (uint16_t*)actual,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            }
+            break;
+        case 1:
+            if (sig.is_signed) {
+                fail = icompare((int8_t*)expected,
+                                (int8_t*)actual,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            } else {
+                fail = icompare((uint8_t*)expected,
+                                (uint8_t*)actual,
+                                vlen * (sig.is_complex ? 2 : 1),
+                                tol_i,
+                                absolute_mode);
+            }
+            break;
+        default:
+            fail = 1;
+        }
+    }
+    return fail;
 }
 
 bool run_volk_tests(volk_func_desc_t desc,
@@ -518,7 +1562,19 @@ bool run_volk_tests(volk_func_desc_t desc,
                     std::vector<volk_test_results_t>* results,
                     std::string puppet_master_name,
                     bool absolute_mode,
-                    bool benchmark_mode)
+                    bool benchmark_mode,
+                    unsigned int reps,
+                    unsigned int misalign,
+                    unsigned int scalar_work_steps,
+                    unsigned int seed,
+                    bool perf_counters,
+                    bool denormals,
+                    bool fast,
+                    bool offload,
+                    bool latency,
+                    bool cold,
+                    unsigned int concurrent,
+                    bool energy)
 {
     // Initialize this entry in results vector
     results->push_back(volk_test_results_t());
@@ -539,6 +1595,11 @@ bool run_volk_tests(volk_func_desc_t desc,
 
     // first let's get a list of available architectures for the test
     std::vector<std::string> arch_list = get_arch_list(desc);
+    // the impls are looked up once here rather than by name on every call
+    std::vector<qa_arch_t> archs;
+    for (size_t i = 0; i < arch_list.size(); i++) {
+        archs.push_back({ manual_func, desc.impls ? desc.impls[i] : NULL, arch_list[i] });
+    }
 
     if ((!benchmark_mode) && (arch_list.size() < 2)) {
         std::cout << "no architectures to test" << std::endl;
@@ -550,8 +1611,9 @@ bool run_volk_tests(volk_func_desc_t desc,
 
     // now we have to get a function signature by parsing the name
     std::vector<volk_type_t> inputsig, outputsig;
+    std::string op_name;
     try {
-        get_signatures_from_name(inputsig, outputsig, name);
+        get_signatures_from_name(inputsig, outputsig, name, &op_name);
     } catch (std::exception& error) {
         std::cerr << "Error: unable to get function signature from kernel name"
                   << std::endl;
@@ -559,6 +1621,8 @@ bool run_volk_tests(volk_func_desc_t desc,
         return false;
     }
 
+    const double point_flops = flops_from_name(op_name, inputsig);
+
     // pull the input scalars into their own vector
     std::vector<volk_type_t> inputsc;
     for (size_t i = 0; i < inputsig.size(); i++) {
@@ -576,12 +1640,24 @@ bool run_volk_tests(volk_func_desc_t desc,
             inbuffs.push_back(
                 mem_pool.get_new(vlen * sig.size * (sig.is_complex ? 2 : 1)));
     }
+    // a seed is drawn here when none is given, so the inputs can be made again
+    if (!seed)
+        seed = std::random_device()() | 1u;
     for (size_t i = 0; i < inbuffs.size(); i++) {
-        load_random_data(inbuffs[i], inputsig[i], vlen);
+        load_random_data(inbuffs[i], inputsig[i], vlen, seed + i, denormals);
     }
 
     // ok let's make a vector of vector of void buffers, which holds the input/output
-    // vectors for each arch
+    // vectors for each arch. The inputs the kernel only reads are shared by all
+    // archs; the others are copied for each, as an arch may write them
+    std::vector<bool> shared(outputsig.size() + inputsig.size(), false);
+    std::vector<size_t> input_hashes(inputsig.size());
+    for (size_t j = 0; j < inputsig.size(); j++) {
+        shared[outputsig.size() + j] =
+            (desc.readonly_mask >> (outputsig.size() + j)) & 1;
+        input_hashes[j] = buffer_hash(
+            inbuffs[j], vlen * inputsig[j].size * (inputsig[j].is_complex ? 2 : 1));
+    }
     std::vector<std::vector<void*>> test_data;
     for (size_t i = 0; i < arch_list.size(); i++) {
         std::vector<void*> arch_buffs;
@@ -590,6 +1666,10 @@ bool run_volk_tests(volk_func_desc_t desc,
                                                   (outputsig[j].is_complex ? 2 : 1)));
         }
         for (size_t j = 0; j < inputsig.size(); j++) {
+            if (shared[outputsig.size() + j]) {
+                arch_buffs.push_back(inbuffs[j]);
+                continue;
+            }
             void* arch_inbuff = mem_pool.get_new(vlen * inputsig[j].size *
                                                  (inputsig[j].is_complex ? 2 : 1));
             memcpy(arch_inbuff,
@@ -606,102 +1686,207 @@ bool run_volk_tests(volk_func_desc_t desc,
 
     // now run the test
     vlen = vlen - vlen_twiddle;
-    std::chrono::time_point<std::chrono::system_clock> start, end;
-    std::vector<double> profile_times;
+    // bytes moved per point, for the throughput figures
+    double point_bytes = 0.0;
+    for (size_t j = 0; j < both_sigs.size(); j++) {
+        point_bytes += both_sigs[j].size * (both_sigs[j].is_complex ? 2 : 1);
+    }
+
+    // the cost of the interleaved scalar work at full clock, before any arch ran
+    double scalar_ms = 0.0;
+    if (scalar_work_steps) {
+        scalar_ms = time_scalar_work(scalar_work_steps, rep_iterations(iter, reps), reps);
+    }
+
+    // without readable energy counters the impls are ranked by time
+    std::unique_ptr<qa_energy_meter> meter(energy ? new qa_energy_meter() : nullptr);
+    if (meter && !meter->available()) {
+        static bool warned = false;
+        if (!warned) {
+            std::cerr << "Warning: no energy counters could be read, ranking by time; "
+                         "check the permissions of /sys/class/powercap"
+                      << std::endl;
+            warned = true;
+        }
+        meter.reset();
+        energy = false;
+    }
+
+    // the rankings' scores and the lower ends of their intervals, and which
+    // impls are still contending in each; only fast profiling drops any
+    std::vector<double> profile_times(arch_list.size());
+    std::vector<double> profile_times_u(arch_list.size());
+    std::vector<double> lower_bounds(arch_list.size());
+    std::vector<double> lower_bounds_u(arch_list.size());
+    std::vector<bool> contending_a(arch_list.size(), true);
+    std::vector<bool> contending_u(arch_list.size());
     for (size_t i = 0; i < arch_list.size(); i++) {
-        start = std::chrono::system_clock::now();
+        contending_u[i] = !desc.impl_alignment[i];
+    }
+    const unsigned int last_iter =
+        fast ? std::max(1u, iter / VOLK_QA_FAST_LAST_TRIAL) : iter;
+    unsigned int trial_iter =
+        fast ? std::max(1u, iter / VOLK_QA_FAST_FIRST_TRIAL) : iter;
+    // the misaligned copies of the buffers, made for the first unaligned impl
+    // and reused by the others
+    std::vector<void*> misaligned_buffs;
+    std::vector<bool> wrote_input(arch_list.size(), false);
+    while (true) {
+        const double scale =
+            (double)rep_iterations(iter, reps) / rep_iterations(trial_iter, reps);
+        if (fast) {
+            std::cout << "trial of " << trial_iter << " iterations" << std::endl;
+        }
+        for (size_t i = 0; i < arch_list.size(); i++) {
+            if (!contending_a[i] && !contending_u[i])
+                continue;
+            volk_test_time_t result = time_arch_test(archs[i],
+                                                     both_sigs,
+                                                     inputsc,
+                                                     test_data[i],
+                                                     scalar,
+                                                     vlen,
+                                                     trial_iter,
+                                                     reps,
+                                                     point_bytes,
+                                                     point_flops,
+                                                     scalar_work_steps,
+                                                     scalar_ms,
+                                                     perf_counters,
+                                                     cold,
+                                                     concurrent);
+            scale_time(result, scale);
+            // in latency mode the tail of single calls ranks the impls, not the mean
+            if (latency) {
+                time_arch_latency(archs[i],
+                                  both_sigs,
+                                  inputsc,
+                                  test_data[i],
+                                  scalar,
+                                  vlen,
+                                  trial_iter,
+                                  cold,
+                                  concurrent,
+                                  result);
+            }
+            if (meter) {
+                measure_arch_energy(archs[i],
+                                    both_sigs,
+                                    inputsc,
+                                    test_data[i],
+                                    scalar,
+                                    vlen,
+                                    *meter,
+                                    result);
+            }
+            std::cout << arch_list[i] << " completed in " << result.time << " ms";
+            print_time_stats(result);
+            std::cout << std::endl;
+            profile_times[i] = profile_times_u[i] = rank_score(result, latency, energy);
+            lower_bounds[i] = lower_bounds_u[i] =
+                rank_score(result, latency, energy, true);
 
-        switch (both_sigs.size()) {
-        case 1:
-            if (inputsc.size() == 0) {
-                run_cast_test1(
-                    (volk_fn_1arg)(manual_func), test_data[i], vlen, iter, arch_list[i]);
-            } else if (inputsc.size() == 1 && inputsc[0].is_float) {
-                if (inputsc[0].is_complex) {
-                    run_cast_test1_s32fc((volk_fn_1arg_s32fc)(manual_func),
-                                         test_data[i],
-                                         scalar,
-                                         vlen,
-                                         iter,
-                                         arch_list[i]);
-                } else {
-                    run_cast_test1_s32f((volk_fn_1arg_s32f)(manual_func),
-                                        test_data[i],
-                                        scalar.real(),
-                                        vlen,
-                                        iter,
-                                        arch_list[i]);
+            // time unaligned impls again on copies of the buffers which start
+            // misalign bytes past a page boundary, and rank impl_u by that run
+            result.misaligned_time = 0.0;
+            if (misalign && !desc.impl_alignment[i]) {
+                for (size_t j = 0; j < both_sigs.size(); j++) {
+                    const size_t size =
+                        vlen * both_sigs[j].size * (both_sigs[j].is_complex ? 2 : 1);
+                    if (misaligned_buffs.size() == j) {
+                        misaligned_buffs.push_back(
+                            (char*)mem_pool.get_new(size + misalign, 4096) + misalign);
+                    } else if (shared[j]) {
+                        continue;
+                    }
+                    memcpy(misaligned_buffs[j], test_data[i][j], size);
                 }
-            } else
-                throw "unsupported 1 arg function >1 scalars";
-            break;
-        case 2:
-            if (inputsc.size() == 0) {
-                run_cast_test2(
-                    (volk_fn_2arg)(manual_func), test_data[i], vlen, iter, arch_list[i]);
-            } else if (inputsc.size() == 1 && inputsc[0].is_float) {
-                if (inputsc[0].is_complex) {
-                    run_cast_test2_s32fc((volk_fn_2arg_s32fc)(manual_func),
-                                         test_data[i],
-                                         scalar,
-                                         vlen,
-                                         iter,
-                                         arch_list[i]);
-                } else {
-                    run_cast_test2_s32f((volk_fn_2arg_s32f)(manual_func),
-                                        test_data[i],
-                                        scalar.real(),
-                                        vlen,
-                                        iter,
-                                        arch_list[i]);
+                volk_test_time_t misaligned = time_arch_test(archs[i],
+                                                             both_sigs,
+                                                             inputsc,
+                                                             misaligned_buffs,
+                                                             scalar,
+                                                             vlen,
+                                                             trial_iter,
+                                                             reps,
+                                                             point_bytes,
+                                                             point_flops,
+                                                             scalar_work_steps,
+                                                             scalar_ms,
+                                                             perf_counters,
+                                                             cold,
+                                                             concurrent);
+                scale_time(misaligned, scale);
+                if (latency) {
+                    time_arch_latency(archs[i],
+                                      both_sigs,
+                                      inputsc,
+                                      misaligned_buffs,
+                                      scalar,
+                                      vlen,
+                                      trial_iter,
+                                      cold,
+                                      concurrent,
+                                      misaligned);
                 }
-            } else
-                throw "unsupported 2 arg function >1 scalars";
-            break;
-        case 3:
-            if (inputsc.size() == 0) {
-                run_cast_test3(
-                    (volk_fn_3arg)(manual_func), test_data[i], vlen, iter, arch_list[i]);
-            } else if (inputsc.size() == 1 && inputsc[0].is_float) {
-                if (inputsc[0].is_complex) {
-                    run_cast_test3_s32fc((volk_fn_3arg_s32fc)(manual_func),
-                                         test_data[i],
-                                         scalar,
-                                         vlen,
-                                         iter,
-                                         arch_list[i]);
-                } else {
-                    run_cast_test3_s32f((volk_fn_3arg_s32f)(manual_func),
-                                        test_data[i],
-                                        scalar.real(),
+                if (meter) {
+                    measure_arch_energy(archs[i],
+                                        both_sigs,
+                                        inputsc,
+                                        misaligned_buffs,
+                                        scalar,
                                         vlen,
-                                        iter,
-                                        arch_list[i]);
+                                        *meter,
+                                        misaligned);
                 }
-            } else
-                throw "unsupported 3 arg function >1 scalars";
-            break;
-        case 4:
-            run_cast_test4(
-                (volk_fn_4arg)(manual_func), test_data[i], vlen, iter, arch_list[i]);
-            break;
-        default:
-            throw "no function handler for this signature";
+                std::cout << arch_list[i] << " misaligned by " << misalign
+                          << " bytes completed in " << misaligned.time << " ms";
+                print_time_stats(misaligned);
+                std::cout << std::endl;
+                result.misaligned_time = misaligned.time;
+                std::map<std::string, double>::const_iterator counter;
+                for (counter = misaligned.counters.begin();
+                     counter != misaligned.counters.end();
+                     ++counter) {
+                    result.counters["misaligned_" + counter->first] = counter->second;
+                }
+                profile_times_u[i] = rank_score(misaligned, latency, energy);
+                lower_bounds_u[i] = rank_score(misaligned, latency, energy, true);
+            }
+            // an arch which wrote to a shared input fails, and the input is made
+            // again for the archs after it
+            for (size_t j = 0; j < inputsig.size(); j++) {
+                const size_t bytes = (vlen + vlen_twiddle) * inputsig[j].size *
+                                     (inputsig[j].is_complex ? 2 : 1);
+                if (!shared[outputsig.size() + j] ||
+                    buffer_hash(inbuffs[j], bytes) == input_hashes[j]) {
+                    continue;
+                }
+                std::cout << name << ": fail on arch " << arch_list[i]
+                          << ", it wrote to read only input " << j << std::endl;
+                wrote_input[i] = true;
+                load_random_data(
+                    inbuffs[j], inputsig[j], vlen + vlen_twiddle, seed + j, denormals);
+                if (!misaligned_buffs.empty()) {
+                    memcpy(misaligned_buffs[outputsig.size() + j], inbuffs[j], bytes);
+                }
+            }
+            result.pass = result.pass && !wrote_input[i];
+            results->back().results[result.name] = result;
+        }
+        if (trial_iter >= last_iter)
             break;
+        // impls which may not be chosen must not drop those which may
+        for (size_t i = 0; !offload && i < arch_list.size(); i++) {
+            if (desc.impl_deps[i] & VOLK_OFFLOAD_ARCHS)
+                contending_a[i] = contending_u[i] = false;
         }
-
-        end = std::chrono::system_clock::now();
-        std::chrono::duration<double> elapsed_seconds = end - start;
-        double arch_time = 1000.0 * elapsed_seconds.count();
-        std::cout << arch_list[i] << " completed in " << arch_time << " ms" << std::endl;
-        volk_test_time_t result;
-        result.name = arch_list[i];
-        result.time = arch_time;
-        result.units = "ms";
-        result.pass = true;
-        results->back().results[result.name] = result;
-
-        profile_times.push_back(arch_time);
+        drop_dominated(profile_times, lower_bounds, contending_a);
+        drop_dominated(profile_times_u, lower_bounds_u, contending_u);
+        if (std::count(contending_a.begin(), contending_a.end(), true) < 2 &&
+            std::count(contending_u.begin(), contending_u.end(), true) < 2)
+            break;
+        trial_iter = std::min(last_iter, trial_iter * VOLK_QA_FAST_GROWTH);
     }
 
     // and now compare each output to the generic output
@@ -720,122 +1905,20 @@ bool run_volk_tests(volk_func_desc_t desc,
     std::vector<bool> arch_results;
     for (size_t i = 0; i < arch_list.size(); i++) {
         fail = false;
+        fail_global = fail_global || wrote_input[i];
         if (i != generic_offset) {
             for (size_t j = 0; j < both_sigs.size(); j++) {
-                if (both_sigs[j].is_float) {
-                    if (both_sigs[j].size == 8) {
-                        if (both_sigs[j].is_complex) {
-                            fail = ccompare((double*)test_data[generic_offset][j],
-                                            (double*)test_data[i][j],
-                                            vlen,
-                                            tol_f,
-                                            absolute_mode);
-                        } else {
-                            fail = fcompare((double*)test_data[generic_offset][j],
-                                            (double*)test_data[i][j],
-                                            vlen,
-                                            tol_f,
-                                            absolute_mode);
-                        }
-                    } else {
-                        if (both_sigs[j].is_complex) {
-                            fail = ccompare((float*)test_data[generic_offset][j],
-                                            (float*)test_data[i][j],
-                                            vlen,
-                                            tol_f,
-                                            absolute_mode);
-                        } else {
-                            fail = fcompare((float*)test_data[generic_offset][j],
-                                            (float*)test_data[i][j],
-                                            vlen,
-                                            tol_f,
-                                            absolute_mode);
-                        }
-                    }
-                } else {
-                    // i could replace this whole switch statement with a memcmp if i
-                    // wasn't interested in printing the outputs where they differ
-                    switch (both_sigs[j].size) {
-                    case 8:
-                        if (both_sigs[j].is_signed) {
-                            fail = icompare((int64_t*)test_data[generic_offset][j],
-                                            (int64_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        } else {
-                            fail = icompare((uint64_t*)test_data[generic_offset][j],
-                                            (uint64_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        }
-                        break;
-                    case 4:
-                        if (both_sigs[j].is_complex) {
-                            if (both_sigs[j].is_signed) {
-                                fail = icompare((int16_t*)test_data[generic_offset][j],
-                                                (int16_t*)test_data[i][j],
-                                                vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                                tol_i,
-                                                absolute_mode);
-                            } else {
-                                fail = icompare((uint16_t*)test_data[generic_offset][j],
-                                                (uint16_t*)test_data[i][j],
-                                                vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                                tol_i,
-                                                absolute_mode);
-                            }
-                        } else {
-                            if (both_sigs[j].is_signed) {
-                                fail = icompare((int32_t*)test_data[generic_offset][j],
-                                                (int32_t*)test_data[i][j],
-                                                vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                                tol_i,
-                                                absolute_mode);
-                            } else {
-                                fail = icompare((uint32_t*)test_data[generic_offset][j],
-                                                (uint32_t*)test_data[i][j],
-                                                vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                                tol_i,
-                                                absolute_mode);
-                            }
-                        }
-                        break;
-                    case 2:
-                        if (both_sigs[j].is_signed) {
-                            fail = icompare((int16_t*)test_data[generic_offset][j],
-                                            (int16_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        } else {
-                            fail = icompare((uint16_t*)test_data[generic_offset][j],
-                                            (uint16_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        }
-                        break;
-                    case 1:
-                        if (both_sigs[j].is_signed) {
-                            fail = icompare((int8_t*)test_data[generic_offset][j],
-                                            (int8_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        } else {
-                            fail = icompare((uint8_t*)test_data[generic_offset][j],
-                                            (uint8_t*)test_data[i][j],
-                                            vlen * (both_sigs[j].is_complex ? 2 : 1),
-                                            tol_i,
-                                            absolute_mode);
-                        }
-                        break;
-                    default:
-                        fail = 1;
-                    }
+                // a shared input is the same buffer for every arch
+                if (test_data[i][j] == test_data[generic_offset][j]) {
+                    continue;
                 }
+                fail = compare_buffer(both_sigs[j],
+                                      test_data[generic_offset][j],
+                                      test_data[i][j],
+                                      vlen,
+                                      tol_f,
+                                      tol_i,
+                                      absolute_mode);
                 if (fail) {
                     volk_test_time_t* result = &results->back().results[arch_list[i]];
                     result->pass = false;
@@ -844,22 +1927,113 @@ bool run_volk_tests(volk_func_desc_t desc,
                 }
             }
         }
-        arch_results.push_back(!fail);
+        arch_results.push_back(!fail && !wrote_input[i]);
+    }
+
+    // kernels which may run in place are called again with the output on a copy of
+    // the first input it may alias; that must reproduce the generic output
+    size_t inplace_arg = 0;
+    for (size_t j = 1; j < both_sigs.size(); j++) {
+        if (desc.inplace_mask & (1u << j)) {
+            inplace_arg = j;
+            break;
+        }
+    }
+    if (inplace_arg) {
+        vlen = vlen - vlen_twiddle;
+        const volk_type_t& sig = both_sigs[0];
+        const size_t bytes = (vlen + vlen_twiddle) * sig.size * (sig.is_complex ? 2 : 1);
+        const void* input = inbuffs[inplace_arg - outputsig.size()];
+        void* inplace_buff = mem_pool.get_new(bytes);
+        for (size_t i = 0; i < arch_list.size(); i++) {
+            std::vector<void*> inplace_buffs(test_data[i]);
+            inplace_buffs[0] = inplace_buff;
+            inplace_buffs[inplace_arg] = inplace_buffs[0];
+            memcpy(inplace_buffs[0], input, bytes);
+            run_arch_test(archs[i],
+                          both_sigs,
+                          inputsc,
+                          inplace_buffs,
+                          scalar,
+                          vlen,
+                          1);
+            volk_test_time_t* result = &results->back().results[arch_list[i]];
+            if (compare_buffer(sig,
+                               test_data[generic_offset][0],
+                               inplace_buffs[0],
+                               vlen,
+                               tol_f,
+                               tol_i,
+                               absolute_mode)) {
+                result->pass = false;
+                fail_global = true;
+                arch_results[i] = false;
+                std::cout << name << ": fail in place on arch " << arch_list[i]
+                          << std::endl;
+                continue;
+            }
+            // only profiling runs time it, on one buffer less, and fast ones only
+            // for the impls which were not dropped
+            if (reps > 1 && (contending_a[i] || contending_u[i])) {
+                volk_test_time_t inplace =
+                    time_arch_test(archs[i],
+                                   both_sigs,
+                                   inputsc,
+                                   inplace_buffs,
+                                   scalar,
+                                   vlen,
+                                   last_iter,
+                                   reps,
+                                   point_bytes - sig.size * (sig.is_complex ? 2 : 1),
+                                   point_flops,
+                                   scalar_work_steps,
+                                   scalar_ms,
+                                   false,
+                                   cold,
+                                   concurrent,
+                                   input,
+                                   bytes);
+                scale_time(inplace,
+                           (double)rep_iterations(iter, reps) /
+                               rep_iterations(last_iter, reps));
+                std::cout << arch_list[i] << " in place completed in " << inplace.time
+                          << " ms";
+                print_time_stats(inplace);
+                std::cout << std::endl;
+                result->inplace_time = inplace.time;
+            }
+        }
+        vlen = vlen + vlen_twiddle;
     }
 
     double best_time_a = std::numeric_limits<double>::max();
     double best_time_u = std::numeric_limits<double>::max();
     std::string best_arch_a = "generic";
     std::string best_arch_u = "generic";
+    bool best_contending_a = false;
+    bool best_contending_u = false;
     for (size_t i = 0; i < arch_list.size(); i++) {
-        if ((profile_times[i] < best_time_u) && arch_results[i] &&
-            desc.impl_alignment[i] == 0) {
-            best_time_u = profile_times[i];
+        // offloaded impls are only chosen per length bucket, where the profile
+        // shows the lengths they win at
+        if (!offload && (desc.impl_deps[i] & VOLK_OFFLOAD_ARCHS)) {
+            continue;
+        }
+        // an impl timed to the last trial beats the dropped ones, whose scores
+        // come from shorter trials
+        if (arch_results[i] && desc.impl_alignment[i] == 0 &&
+            (contending_u[i] > best_contending_u ||
+             (contending_u[i] == best_contending_u &&
+              profile_times_u[i] < best_time_u))) {
+            best_time_u = profile_times_u[i];
             best_arch_u = arch_list[i];
+            best_contending_u = contending_u[i];
         }
-        if ((profile_times[i] < best_time_a) && arch_results[i]) {
+        if (arch_results[i] &&
+            (contending_a[i] > best_contending_a ||
+             (contending_a[i] == best_contending_a && profile_times[i] < best_time_a))) {
             best_time_a = profile_times[i];
             best_arch_a = arch_list[i];
+            best_contending_a = contending_a[i];
         }
     }
 
@@ -876,3 +2050,669 @@ bool run_volk_tests(volk_func_desc_t desc,
 
     return fail_global;
 }
+
+/*
+ * Checks the index_max _64 variants past 2^24 points, beyond the indices the
+ * float lanes of their SIMD versions count exactly, with the maximum at an
+ * index no float holds.
+ */
+bool run_volk_64_tests()
+{
+    const size_t num_points = ((size_t)1 << 24) + 65536;
+    const size_t target = ((size_t)1 << 24) + 12345;
+    bool fail = false;
+    uint64_t index;
+
+    std::cout << "RUN_VOLK_TESTS: _64 index_max(" << num_points << ")" << std::endl;
+    float* values =
+        (float*)volk_malloc(2 * num_points * sizeof(float), volk_get_alignment());
+    if (!values) {
+        std::cerr << "out of memory for the _64 tests" << std::endl;
+        return true;
+    }
+    for (size_t i = 0; i < 2 * num_points; i++) {
+        values[i] = (float)((uint32_t)(i * 2654435761u) >> 8) / 16777216.0f;
+    }
+    values[target] = 2.0f;
+    volk_32f_index_max_32u_64(&index, values, num_points);
+    if (index != target) {
+        std::cout << "volk_32f_index_max_32u_64: index " << index << ", expected "
+                  << target << std::endl;
+        fail = true;
+    }
+    values[2 * target] = 2.0f;
+    values[2 * target + 1] = 2.0f;
+    volk_32fc_index_max_32u_64(&index, (lv_32fc_t*)values, num_points);
+    if (index != target) {
+        std::cout << "volk_32fc_index_max_32u_64: index " << index << ", expected "
+                  << target << std::endl;
+        fail = true;
+    }
+    volk_free(values);
+    return fail;
+}
+
+/*
+ * Checks the ring buffer, arena and volk_malloc_ex allocators: that both
+ * halves of a ring are the same memory, that an arena runs out at its size
+ * and is whole again after a reset, and that the sizes no allocation can
+ * hold fail with NULL instead of wrapping.
+ */
+bool run_volk_malloc_tests()
+{
+    const size_t huge = std::numeric_limits<size_t>::max();
+    bool fail = false;
+    size_t capacity = 0;
+
+    std::cout << "RUN_VOLK_TESTS: volk_malloc" << std::endl;
+    // item sizes which divide a page and which do not
+    const size_t item_sizes[] = { sizeof(float), 24 };
+    for (size_t item_size : item_sizes) {
+        char* ring = (char*)volk_malloc_ring(1000, item_size, &capacity);
+        if (!ring) {
+            std::cout << "volk_malloc_ring(1000, " << item_size << "): NULL" << std::endl;
+            fail = true;
+            continue;
+        }
+        const size_t bytes = capacity * item_size;
+        if (capacity < 1000 || !volk_is_aligned(ring)) {
+            std::cout << "volk_malloc_ring(1000, " << item_size << "): capacity "
+                      << capacity << ", aligned " << volk_is_aligned(ring) << std::endl;
+            fail = true;
+        }
+        for (size_t i = 0; i < bytes; i++) {
+            ring[i] = (char)(i * 7);
+        }
+        ring[bytes + 5] = 'x';
+        if (memcmp(ring + 6, ring + bytes + 6, bytes - 6) != 0 || ring[5] != 'x' ||
+            ring[0] != ring[bytes]) {
+            std::cout << "volk_malloc_ring(1000, " << item_size
+                      << "): the halves differ" << std::endl;
+            fail = true;
+        }
+        volk_free_ring(ring, capacity, item_size);
+    }
+    // an item size of 0, and counts whose bytes or twice those overflow
+    if (volk_malloc_ring(16, 0, &capacity) ||
+        volk_malloc_ring(huge / 16 + 1, 16, &capacity) ||
+        volk_malloc_ring(huge / 2 - 1, 1, &capacity)) {
+        std::cout << "volk_malloc_ring: no NULL for an impossible size" << std::endl;
+        fail = true;
+    }
+
+    volk_arena_t* arena = volk_arena_create(256);
+    if (!arena) {
+        std::cout << "volk_arena_create(256): NULL" << std::endl;
+        return true;
+    }
+    char* first = (char*)volk_arena_alloc(arena, 100, 64);
+    char* second = (char*)volk_arena_alloc(arena, 100, 64);
+    if (!first || second != first + 128 || volk_arena_alloc(arena, 64, 64) ||
+        volk_arena_used(arena) != 228) {
+        std::cout << "volk_arena_alloc: not exhausted at 256 bytes" << std::endl;
+        fail = true;
+    }
+    volk_arena_reset(arena);
+    if (volk_arena_used(arena) != 0 || volk_arena_alloc(arena, 256, 64) != first ||
+        volk_arena_peak(arena) != 256 || volk_arena_alloc(arena, 1, 1)) {
+        std::cout << "volk_arena_reset: the arena is not whole again" << std::endl;
+        fail = true;
+    }
+    volk_arena_destroy(arena);
+    if (volk_arena_create(huge)) {
+        std::cout << "volk_arena_create: no NULL for an impossible size" << std::endl;
+        fail = true;
+    }
+
+    const unsigned int flag_sets[] = { 0, VOLK_MALLOC_PREFAULT };
+    for (unsigned int flags : flag_sets) {
+        char* block = (char*)volk_malloc_ex(100000, 256, flags);
+        if (!block || ((uintptr_t)block & 255)) {
+            std::cout << "volk_malloc_ex(100000, 256, " << flags
+                      << "): NULL or misaligned" << std::endl;
+            fail = true;
+        } else {
+            memset(block, 1, 100000);
+        }
+        volk_free_ex(block);
+        if (volk_malloc_ex(huge - 8, 64, flags) ||
+            volk_malloc_ex(huge / 2 + 1, 64, flags)) {
+            std::cout << "volk_malloc_ex(" << flags
+                      << "): no NULL for an impossible size" << std::endl;
+            fail = true;
+        }
+    }
+    volk_free_ex(NULL);
+    return fail;
+}
+
+// the chunk sizes the streaming tests split their inputs into: 1 and 2 more
+// than a history, around the kernels' vector widths and past a block
+static const unsigned int volk_stream_splits[] = { 1, 2, 36, 37, 38, 1000 };
+static const size_t volk_stream_num_splits =
+    sizeof(volk_stream_splits) / sizeof(volk_stream_splits[0]);
+
+/*
+ * Feeds input to process in calls of split points, or of every split in
+ * turn for a split of 0, and returns what the calls wrote one after the
+ * other. process(output, input, num_points) returns its output count.
+ */
+template <typename T, typename Process>
+static std::vector<T> volk_stream_in_chunks(const std::vector<T>& input,
+                                            unsigned int split,
+                                            size_t max_outputs,
+                                            Process process)
+{
+    std::vector<T> output(max_outputs);
+    size_t done = 0, written = 0;
+    for (size_t call = 0; done < input.size(); call++) {
+        size_t chunk =
+            split ? split : volk_stream_splits[call % volk_stream_num_splits];
+        if (chunk > input.size() - done)
+            chunk = input.size() - done;
+        written += process(output.data() + written, input.data() + done, chunk);
+        done += chunk;
+    }
+    output.resize(written);
+    return output;
+}
+
+// compares streamed outputs with the reference in double; true on a failure
+template <typename T, typename R>
+static bool volk_stream_check(const std::string& name,
+                              unsigned int split,
+                              const std::vector<T>& got,
+                              const std::vector<R>& expected,
+                              double tol)
+{
+    const std::string chunks =
+        split ? "chunks of " + std::to_string(split) : std::string("uneven chunks");
+    if (got.size() != expected.size()) {
+        std::cout << name << ", " << chunks << ": " << got.size() << " outputs, expected "
+                  << expected.size() << std::endl;
+        return true;
+    }
+    for (size_t i = 0; i < got.size(); i++) {
+        if (std::abs(R(got[i]) - expected[i]) > tol * (1. + std::abs(expected[i]))) {
+            std::cout << name << ", " << chunks << ": output " << i << " is " << got[i]
+                      << ", expected " << expected[i] << std::endl;
+            return true;
+        }
+    }
+    return false;
+}
+
+// the direct convolution sum of taps[k] * x[i - k], with x zero before the first
+template <typename T, typename Tap>
+static std::vector<std::complex<double>>
+volk_stream_convolve(const std::vector<T>& x, const std::vector<Tap>& taps)
+{
+    std::vector<std::complex<double>> y(x.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        for (size_t k = 0; k < taps.size() && k <= i; k++) {
+            y[i] += std::complex<double>(taps[k]) * std::complex<double>(x[i - k]);
+        }
+    }
+    return y;
+}
+
+/*
+ * Checks the streaming filters of volk_fir.h: their outputs for an input
+ * split into calls of every size in volk_stream_splits, and into all of
+ * them in turn, match a direct convolution of the whole input. Every
+ * split crosses the delay lines and decimation offsets between calls at
+ * other points.
+ */
+bool run_volk_fir_tests()
+{
+    const unsigned int num_points = 4000, num_taps = 37;
+    const size_t max_outputs = 5 * num_points + 16;
+    std::mt19937 rng(4000);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> real_input(num_points), taps(num_taps);
+    std::vector<lv_32fc_t> input(num_points), complex_taps(num_taps);
+    bool fail = false;
+
+    std::cout << "RUN_VOLK_TESTS: volk_fir" << std::endl;
+    for (unsigned int i = 0; i < num_points; i++) {
+        real_input[i] = dist(rng);
+        input[i] = lv_32fc_t(dist(rng), dist(rng));
+    }
+    for (unsigned int k = 0; k < num_taps; k++) {
+        taps[k] = 0.5f * dist(rng);
+        complex_taps[k] = lv_32fc_t(0.5f * dist(rng), 0.5f * dist(rng));
+    }
+
+    const std::vector<std::complex<double>> real_filtered =
+        volk_stream_convolve(real_input, taps);
+    std::vector<double> real_expected(num_points);
+    for (unsigned int i = 0; i < num_points; i++) {
+        real_expected[i] = real_filtered[i].real();
+    }
+    const std::vector<std::complex<double>> filtered = volk_stream_convolve(input, taps);
+    const std::vector<std::complex<double>> complex_filtered =
+        volk_stream_convolve(input, complex_taps);
+
+    // the interpolator's outputs are the input with 3 zeros after every
+    // sample filtered; the resampler keeps every third of them, the
+    // decimator every third output of the filter
+    const unsigned int interpolation = 4, decimation = 3;
+    std::vector<lv_32fc_t> upsampled(num_points * interpolation);
+    for (unsigned int i = 0; i < num_points; i++) {
+        upsampled[i * interpolation] = input[i];
+    }
+    const std::vector<std::complex<double>> interpolated =
+        volk_stream_convolve(upsampled, taps);
+    std::vector<std::complex<double>> decimated, resampled;
+    for (unsigned int i = 0; i < num_points; i += decimation) {
+        decimated.push_back(filtered[i]);
+    }
+    for (unsigned int i = 0; i < num_points * interpolation; i += decimation) {
+        resampled.push_back(interpolated[i]);
+    }
+
+    // the cubic through the inputs around each position of the resampler,
+    // the delay line's 3 zeros first, as volk_32fc_s64f_x2_farrow_resample_32fc
+    const double steps[] = { 0.7371, 1.618 };
+    std::vector<lv_32fc_t> delayed(3);
+    delayed.insert(delayed.end(), input.begin(), input.end());
+    std::vector<std::vector<std::complex<double>>> cubics;
+    for (double step : steps) {
+        std::vector<std::complex<double>> cubic;
+        for (unsigned int i = 0; i * step < num_points; i++) {
+            const double t = i * step;
+            const unsigned int n = (unsigned int)t;
+            const double mu = t - n;
+            const std::complex<double> xm1 = delayed[n], x0 = delayed[n + 1],
+                                       x1 = delayed[n + 2], x2 = delayed[n + 3];
+            const std::complex<double> c3 = (x2 - xm1) / 6. + (x0 - x1) / 2.;
+            const std::complex<double> c2 = (xm1 + x1) / 2. - x0;
+            const std::complex<double> c1 = x1 - x0 / 2. - xm1 / 3. - x2 / 6.;
+            cubic.push_back(((c3 * mu + c2) * mu + c1) * mu + x0);
+        }
+        cubics.push_back(cubic);
+    }
+
+    // halfband stages of 11, 7 and 3 taps, each keeping every second output
+    // of its filter; the taps are the outer ones, then the center one
+    const unsigned int num_stages = 3;
+    const unsigned int stage_taps[num_stages] = { 3, 2, 1 };
+    std::vector<std::vector<float>> halfband_taps(num_stages);
+    const float* stage_tap_ptrs[num_stages];
+    std::vector<std::complex<double>> halved(input.begin(), input.end());
+    for (unsigned int s = 0; s < num_stages; s++) {
+        std::vector<float> full(4 * stage_taps[s] - 1);
+        for (unsigned int k = 0; k < stage_taps[s]; k++) {
+            halfband_taps[s].push_back(0.5f * dist(rng));
+            full[2 * k] = full[full.size() - 1 - 2 * k] = halfband_taps[s][k];
+        }
+        halfband_taps[s].push_back(0.5f);
+        full[2 * stage_taps[s] - 1] = 0.5f;
+        stage_tap_ptrs[s] = halfband_taps[s].data();
+        const std::vector<std::complex<double>> stage_filtered =
+            volk_stream_convolve(halved, full);
+        halved.clear();
+        for (size_t i = 0; i < stage_filtered.size(); i += 2) {
+            halved.push_back(stage_filtered[i]);
+        }
+    }
+
+    const double tol = 1e-5;
+    for (size_t t = 0; t <= volk_stream_num_splits; t++) {
+        const unsigned int split = t < volk_stream_num_splits ? volk_stream_splits[t] : 0;
+
+        volk_fir_32f_t fir;
+        if (volk_fir_32f_init(&fir, taps.data(), num_taps)) {
+            fail |= volk_stream_check(
+                "volk_fir_32f_filter",
+                split,
+                volk_stream_in_chunks(
+                    real_input,
+                    split,
+                    max_outputs,
+                    [&](float* out, const float* in, unsigned int n) {
+                        volk_fir_32f_filter(&fir, out, in, n);
+                        return n;
+                    }),
+                real_expected,
+                tol);
+            volk_fir_32f_destroy(&fir);
+        } else {
+            std::cout << "volk_fir_32f_init failed" << std::endl;
+            fail = true;
+        }
+
+        for (bool complex_taps_on : { false, true }) {
+            volk_fir_32fc_t cfir;
+            const bool ok =
+                complex_taps_on
+                    ? volk_fir_32fc_init_complex(&cfir, complex_taps.data(), num_taps)
+                    : volk_fir_32fc_init(&cfir, taps.data(), num_taps);
+            if (!ok) {
+                std::cout << "volk_fir_32fc_init failed" << std::endl;
+                fail = true;
+                continue;
+            }
+            fail |= volk_stream_check(
+                complex_taps_on ? "volk_fir_32fc_filter, complex taps"
+                                : "volk_fir_32fc_filter",
+                split,
+                volk_stream_in_chunks(
+                    input,
+                    split,
+                    max_outputs,
+                    [&](lv_32fc_t* out, const lv_32fc_t* in, unsigned int n) {
+                        volk_fir_32fc_filter(&cfir, out, in, n);
+                        return n;
+                    }),
+                complex_taps_on ? complex_filtered : filtered,
+                tol);
+            volk_fir_32fc_destroy(&cfir);
+        }
+
+        volk_fir_decimator_32fc_t decimator;
+        if (volk_fir_decimator_32fc_init(&decimator, taps.data(), num_taps, decimation)) {
+            fail |= volk_stream_check(
+                "volk_fir_decimator_32fc_filter",
+                split,
+                volk_stream_in_chunks(
+                    input,
+                    split,
+                    max_outputs,
+                    [&](lv_32fc_t* out, const lv_32fc_t* in, unsigned int n) {
+                        return volk_fir_decimator_32fc_filter(&decimator, out, in, n);
+                    }),
+                decimated,
+                tol);
+            volk_fir_decimator_32fc_destroy(&decimator);
+        } else {
+            std::cout << "volk_fir_decimator_32fc_init failed" << std::endl;
+            fail = true;
+        }
+
+        volk_fir_interpolator_32fc_t interpolator;
+        if (volk_fir_interpolator_32fc_init(
+                &interpolator, taps.data(), num_taps, interpolation)) {
+            fail |= volk_stream_check(
+                "volk_fir_interpolator_32fc_filter",
+                split,
+                volk_stream_in_chunks(
+                    input,
+                    split,
+                    max_outputs,
+                    [&](lv_32fc_t* out, const lv_32fc_t* in, unsigned int n) {
+                        volk_fir_interpolator_32fc_filter(&interpolator, out, in, n);
+                        return n * interpolation;
+                    }),
+                interpolated,
+                tol);
+            volk_fir_interpolator_32fc_destroy(&interpolator);
+        } else {
+            std::cout << "volk_fir_interpolator_32fc_init failed" << std::endl;
+            fail = true;
+        }
+
+        volk_fir_resampler_32fc_t resampler;
+        if (volk_fir_resampler_32fc_init(
+                &resampler, taps.data(), num_taps, interpolation, decimation)) {
+            fail |= volk_stream_check(
+                "volk_fir_resampler_32fc_filter",
+                split,
+                volk_stream_in_chunks(
+                    input,
+                    split,
+                    max_outputs,
+                    [&](lv_32fc_t* out, const lv_32fc_t* in, unsigned int n) {
+                        return volk_fir_resampler_32fc_filter(&resampler, out, in, n);
+                    }),
+                resampled,
+                tol);
+            volk_fir_resampler_32fc_destroy(&resampler);
+        } else {
+            std::cout << "volk_fir_resampler_32fc_init failed" << std::endl;
+            fail = true;
+        }
+
+        for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+            volk_farrow_resampler_32fc_t farrow;
+            if (!volk_farrow_resampler_32fc_init(&farrow, steps[i])) {
+                std::cout << "volk_farrow_resampler_32fc_init failed" << std::endl;
+                fail = true;
+                continue;
+            }
+            fail |= volk_stream_check(
+                "volk_farrow_resampler_32fc_filter, step " + std::to_string(steps[i]),
+                split,
+                volk_stream_in_chunks(
+                    input,
+                    split,
+                    max_outputs,
+                    [&](lv_32fc_t* out, const lv_32fc_t* in, unsigned int n) {
+                        return volk_farrow_resampler_32fc_filter(&farrow, out, in, n);
+                    }),
+                cubics[i],
+                tol);
+            volk_farrow_resampler_32fc_destroy(&farrow);
+        }
+
+        volk_halfband_cascade_32fc_t cascade;
+        if (volk_halfband_cascade_32fc_init(
+                &cascade, stage_tap_ptrs, stage_taps, num_stages)) {
+            fail |= volk_stream_check(
+                "volk_halfband_cascade_32fc_filter",
+                split,
+                volk_stream_in_chunks(
+                    input,
+                    split,
+                    max_outputs,
+                    [&](lv_32fc_t* out, const lv_32fc_t* in, unsigned int n) {
+                        return volk_halfband_cascade_32fc_filter(&cascade, out, in, n);
+                    }),
+                halved,
+                tol);
+            volk_halfband_cascade_32fc_destroy(&cascade);
+        } else {
+            std::cout << "volk_halfband_cascade_32fc_init failed" << std::endl;
+            fail = true;
+        }
+    }
+    return fail;
+}
+
+/*
+ * Checks the channelizer of volk_pfb.h, critically and twice oversampled:
+ * its frames for an input split into calls of every size in
+ * volk_stream_splits, and into all of them in turn, match the sum of the
+ * header for each channel after every hop inputs. The calls run on one
+ * thread and on four, which the frames of the longer calls are shared
+ * out between.
+ */
+bool run_volk_pfb_tests()
+{
+    const unsigned int num_points = 8000, num_channels = 64, num_taps = 1000;
+    const unsigned int saved_threads = volk_get_num_threads();
+    std::mt19937 rng(8000);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<lv_32fc_t> input(num_points);
+    std::vector<float> taps(num_taps);
+    std::vector<std::complex<double>> twiddles(num_channels);
+    bool fail = false;
+
+    std::cout << "RUN_VOLK_TESTS: volk_pfb" << std::endl;
+    for (unsigned int i = 0; i < num_points; i++) {
+        input[i] = lv_32fc_t(dist(rng), dist(rng));
+    }
+    // a window, so that the channels hold sums of similar size
+    for (unsigned int n = 0; n < num_taps; n++) {
+        taps[n] = (0.5f + 0.5f * dist(rng)) * (float)sin(M_PI * (n + 0.5) / num_taps);
+    }
+    for (unsigned int k = 0; k < num_channels; k++) {
+        twiddles[k] = std::polar(1., -2. * M_PI * k / num_channels);
+    }
+
+    const unsigned int flag_sets[] = { 0, VOLK_PFB_OVERSAMPLED };
+    for (unsigned int flags : flag_sets) {
+        const unsigned int hop = flags ? num_channels / 2 : num_channels;
+        const std::string name = flags ? "volk_pfb_channelizer_compute, oversampled"
+                                       : "volk_pfb_channelizer_compute";
+        std::vector<std::complex<double>> expected;
+        for (unsigned int t = hop - 1; t < num_points; t += hop) {
+            for (unsigned int k = 0; k < num_channels; k++) {
+                std::complex<double> sum = 0.;
+                for (unsigned int n = 0; n < num_taps && n <= t; n++) {
+                    sum += (double)taps[n] * std::complex<double>(input[t - n]) *
+                           twiddles[(size_t)k * (t - n) % num_channels];
+                }
+                expected.push_back(sum);
+            }
+        }
+
+        volk_pfb_channelizer_t* pfb =
+            volk_pfb_channelizer_create(num_channels, taps.data(), num_taps, flags);
+        if (!pfb) {
+            std::cout << "volk_pfb_channelizer_create failed" << std::endl;
+            fail = true;
+            continue;
+        }
+        for (unsigned int threads : { 1u, 4u }) {
+            volk_set_num_threads(threads);
+            for (size_t t = 0; t <= volk_stream_num_splits; t++) {
+                const unsigned int split =
+                    t < volk_stream_num_splits ? volk_stream_splits[t] : 0;
+                volk_pfb_channelizer_reset(pfb);
+                fail |= volk_stream_check(
+                    name + (threads == 1 ? ", 1 thread" : ", 4 threads"),
+                    split,
+                    volk_stream_in_chunks(
+                        input,
+                        split,
+                        (size_t)(num_points + num_points / hop) * num_channels,
+                        [&](lv_32fc_t* out, const lv_32fc_t* in, size_t n) {
+                            const ptrdiff_t frames =
+                                volk_pfb_channelizer_compute(pfb, out, in, n);
+                            return frames > 0 ? (size_t)frames * num_channels : 0;
+                        }),
+                    expected,
+                    1e-4);
+            }
+        }
+        volk_pfb_channelizer_destroy(pfb);
+    }
+    volk_set_num_threads(saved_threads);
+    return fail;
+}
+
+/*
+ * Checks the Welch estimator of volk_psd.h against the mean of the
+ * segments' powers by a direct DFT: for captures of one segment, with a
+ * tail left out, and, with overlapping segments, long enough to share out
+ * between 1, 3 and 4 threads, whose runs then split the segments unevenly.
+ * A capture shorter than a segment must fail and leave the estimate as it
+ * was.
+ */
+bool run_volk_psd_tests()
+{
+    const unsigned int fft_len = 256;
+    const size_t capture_lengths[] = { fft_len, fft_len + 37, 127 * 100 + fft_len + 37 };
+    const unsigned int saved_threads = volk_get_num_threads();
+    std::mt19937 rng(256);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<lv_32fc_t> input(capture_lengths[2]);
+    std::vector<float> window(fft_len), hann(fft_len), psd(fft_len);
+    std::vector<std::complex<double>> twiddles(fft_len);
+    bool fail = false;
+
+    std::cout << "RUN_VOLK_TESTS: volk_psd" << std::endl;
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = lv_32fc_t(dist(rng), dist(rng));
+    }
+    for (unsigned int n = 0; n < fft_len; n++) {
+        window[n] = 0.5f + 0.5f * dist(rng);
+        hann[n] = (float)(0.5 - 0.5 * cos(2.0 * M_PI * n / fft_len));
+        twiddles[n] = std::polar(1., -2. * M_PI * n / fft_len);
+    }
+
+    // a Hann window overlapping by 100 points, and a window of our own
+    // without overlap, centered
+    struct {
+        unsigned int hop;
+        const float* window;
+        float sample_rate;
+        unsigned int flags;
+    } const configs[] = { { 100, NULL, 2.f, 0 },
+                          { fft_len, window.data(), 1.f, VOLK_PSD_WELCH_CENTERED } };
+    for (const auto& config : configs) {
+        const float* taps = config.window ? config.window : hann.data();
+        const std::string name = config.flags
+                                     ? "volk_psd_welch_compute, centered"
+                                     : "volk_psd_welch_compute, hop " +
+                                           std::to_string(config.hop);
+        double energy = 0.;
+        for (unsigned int n = 0; n < fft_len; n++) {
+            energy += (double)taps[n] * taps[n];
+        }
+        volk_psd_welch_t* welch = volk_psd_welch_create(
+            fft_len, config.hop, config.window, config.sample_rate, config.flags);
+        if (!welch) {
+            std::cout << "volk_psd_welch_create failed" << std::endl;
+            fail = true;
+            continue;
+        }
+
+        for (size_t num_points : capture_lengths) {
+            const size_t segments = (num_points - fft_len) / config.hop + 1;
+            if (volk_psd_welch_segments(welch, num_points) != segments) {
+                std::cout << "volk_psd_welch_segments(" << num_points << ") is "
+                          << volk_psd_welch_segments(welch, num_points) << ", expected "
+                          << segments << std::endl;
+                fail = true;
+            }
+            std::vector<double> expected(fft_len);
+            for (size_t s = 0; s < segments; s++) {
+                const lv_32fc_t* segment = input.data() + s * config.hop;
+                for (unsigned int k = 0; k < fft_len; k++) {
+                    std::complex<double> bin = 0.;
+                    for (unsigned int n = 0; n < fft_len; n++) {
+                        bin += (double)taps[n] * std::complex<double>(segment[n]) *
+                               twiddles[(size_t)k * n % fft_len];
+                    }
+                    const unsigned int out =
+                        config.flags ? (k + fft_len / 2) % fft_len : k;
+                    expected[out] += std::norm(bin) /
+                                     (segments * (double)config.sample_rate * energy);
+                }
+            }
+            for (unsigned int threads : { 1u, 3u, 4u }) {
+                volk_set_num_threads(threads);
+                const std::string run =
+                    name + ", " + std::to_string(num_points) + " points, " +
+                    (threads == 1 ? std::string("1 thread")
+                                  : std::to_string(threads) + " threads");
+                if (volk_psd_welch_compute(welch, psd.data(), input.data(), num_points)) {
+                    std::cout << run << ": failed" << std::endl;
+                    fail = true;
+                    continue;
+                }
+                for (unsigned int k = 0; k < fft_len; k++) {
+                    if (std::abs(psd[k] - expected[k]) > 1e-4 * (1. + expected[k])) {
+                        std::cout << run << ": bin " << k << " is " << psd[k]
+                                  << ", expected " << expected[k] << std::endl;
+                        fail = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        std::vector<float> kept(psd);
+        if (volk_psd_welch_compute(welch, psd.data(), input.data(), fft_len - 1) != -1 ||
+            psd != kept) {
+            std::cout << name << ": a capture shorter than a segment did not fail"
+                      << std::endl;
+            fail = true;
+        }
+        volk_psd_welch_destroy(welch);
+    }
+    volk_set_num_threads(saved_threads);
+    return fail;
+}
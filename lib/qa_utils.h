@@ -18,6 +18,7 @@ struct volk_type_t {
     bool is_scalar;
     bool is_signed;
     bool is_complex;
+    bool is_bfloat; // a 16-bit float is bfloat16 rather than IEEE half
     int size;
     std::string str;
 };
@@ -26,11 +27,35 @@ class volk_test_time_t
 {
 public:
     std::string name;
-    double time;
+    double time; // median over the repetitions
     std::string units;
     bool pass;
+    unsigned int reps;       // number of timed repetitions
+    double mad;              // median absolute deviation of the repetitions
+    double ns_per_point;     // median cost of one point
+    double gbps;             // bytes read and written per second, in GB/s
+    double cycles_per_point; // TSC ticks per point, 0 where there is no TSC
+    double misaligned_time;  // median on misaligned buffers, 0 if not run
+    double inplace_time;     // median with the output on an input buffer, 0 if not run
+    double gflops;           // arithmetic rate, 0 for kernels without a flop count
+    double stream_fraction;  // gbps relative to the STREAM bandwidth, 0 if unmeasured
+    double p50_ns;           // latency percentiles of single calls, 0 if not timed
+    double p99_ns;
+    double p999_ns;
+    double nj_per_point; // package energy of one point in nJ, 0 if not measured
+    std::map<std::string, double> counters; // hardware events per point, if collected
 };
 
+// share of the STREAM bandwidth from which a kernel is reported as memory bound
+#define VOLK_QA_MEMORY_BOUND_FRACTION 0.5
+
+/*!
+ * The host's bandwidth in GB/s for a working set of the given size in bytes,
+ * measured once per size with a STREAM triad. Kernel buffers that fit a cache
+ * are compared to that cache's bandwidth; 0 measures main memory.
+ */
+double volk_qa_stream_gbps(size_t working_set = 0);
+
 class volk_test_results_t
 {
 public:
@@ -41,6 +66,7 @@ public:
     std::map<std::string, volk_test_time_t> results;
     std::string best_arch_a;
     std::string best_arch_u;
+    std::string fingerprint; // of the impls, version, machine and cpu profiled with
 };
 
 class volk_test_params_t
@@ -50,6 +76,18 @@ private:
     lv_32fc_t _scalar;
     unsigned int _vlen;
     unsigned int _iter;
+    unsigned int _reps;
+    unsigned int _misalign;
+    unsigned int _scalar_work;
+    unsigned int _seed;
+    unsigned int _concurrent;
+    bool _perf_counters;
+    bool _denormals;
+    bool _fast;
+    bool _offload;
+    bool _latency;
+    bool _cold;
+    bool _energy;
     bool _benchmark_mode;
     bool _absolute_mode;
     std::string _kernel_regex;
@@ -66,6 +104,18 @@ public:
           _scalar(scalar),
           _vlen(vlen),
           _iter(iter),
+          _reps(1),
+          _misalign(0),
+          _scalar_work(0),
+          _seed(0),
+          _concurrent(1),
+          _perf_counters(false),
+          _denormals(false),
+          _fast(false),
+          _offload(false),
+          _latency(false),
+          _cold(false),
+          _energy(false),
           _benchmark_mode(benchmark_mode),
           _absolute_mode(false),
           _kernel_regex(kernel_regex){};
@@ -74,6 +124,18 @@ public:
     void set_scalar(lv_32fc_t scalar) { _scalar = scalar; };
     void set_vlen(unsigned int vlen) { _vlen = vlen; };
     void set_iter(unsigned int iter) { _iter = iter; };
+    void set_reps(unsigned int reps) { _reps = reps ? reps : 1; };
+    void set_misalign(unsigned int misalign) { _misalign = misalign; };
+    void set_scalar_work(unsigned int steps) { _scalar_work = steps; };
+    void set_seed(unsigned int seed) { _seed = seed; };
+    void set_perf_counters(bool perf_counters) { _perf_counters = perf_counters; };
+    void set_denormals(bool denormals) { _denormals = denormals; };
+    void set_fast(bool fast) { _fast = fast; };
+    void set_offload(bool offload) { _offload = offload; };
+    void set_latency(bool latency) { _latency = latency; };
+    void set_cold(bool cold) { _cold = cold; };
+    void set_energy(bool energy) { _energy = energy; };
+    void set_concurrent(unsigned int threads) { _concurrent = threads ? threads : 1; };
     void set_benchmark(bool benchmark) { _benchmark_mode = benchmark; };
     void set_regex(std::string regex) { _kernel_regex = regex; };
     // getters
@@ -81,6 +143,24 @@ public:
     lv_32fc_t scalar() { return _scalar; };
     unsigned int vlen() { return _vlen; };
     unsigned int iter() { return _iter; };
+    unsigned int reps() { return _reps; };
+    unsigned int misalign() { return _misalign; };
+    unsigned int scalar_work() { return _scalar_work; };
+    unsigned int seed() { return _seed; };
+    bool perf_counters() { return _perf_counters; };
+    bool denormals() { return _denormals; };
+    bool fast() { return _fast; };
+    // whether offloaded impls may be chosen, as for a length bucket
+    bool offload() { return _offload; };
+    // whether single calls are timed and impls ranked by their p99 latency
+    bool latency() { return _latency; };
+    // whether the buffers are flushed from the caches before every timed call
+    bool cold() { return _cold; };
+    // whether impls are ranked by the energy per point of the RAPL or
+    // platform energy counters instead of by time
+    bool energy() { return _energy; };
+    // threads running the kernel at once, the timed one and contending ones
+    unsigned int concurrent() { return _concurrent; };
     bool benchmark_mode() { return _benchmark_mode; };
     bool absolute_mode() { return _absolute_mode; };
     std::string kernel_regex() { return _kernel_regex; };
@@ -162,7 +242,34 @@ bool run_volk_tests(volk_func_desc_t,
                     std::vector<volk_test_results_t>* results = NULL,
                     std::string puppet_master_name = "NULL",
                     bool absolute_mode = false,
-                    bool benchmark_mode = false);
+                    bool benchmark_mode = false,
+                    unsigned int reps = 1,
+                    unsigned int misalign = 0,
+                    unsigned int scalar_work = 0,
+                    unsigned int seed = 0,
+                    bool perf_counters = false,
+                    bool denormals = false,
+                    bool fast = false,
+                    bool offload = false,
+                    bool latency = false,
+                    bool cold = false,
+                    unsigned int concurrent = 1,
+                    bool energy = false);
+
+// checks the _64 variants past the 32-bit kernels' ranges; true on a failure
+bool run_volk_64_tests();
+
+// checks the ring buffer, arena and volk_malloc_ex allocators; true on a failure
+bool run_volk_malloc_tests();
+
+// checks the streaming filters of volk_fir.h against convolution; true on a failure
+bool run_volk_fir_tests();
+
+// checks the channelizer of volk_pfb.h against its definition; true on a failure
+bool run_volk_pfb_tests();
+
+// checks the Welch estimator of volk_psd.h against a direct DFT; true on a failure
+bool run_volk_psd_tests();
 
 #define VOLK_PROFILE(func, test_params, results) \
     run_volk_tests(func##_get_func_desc(),       \
@@ -52,6 +52,21 @@ int main(int argc, char* argv[])
     std::vector<volk_test_results_t> results;
 
     if (argc > 1) {
+        if (std::string(argv[1]) == "volk_64") {
+            return run_volk_64_tests() ? 1 : 0;
+        }
+        if (std::string(argv[1]) == "volk_malloc") {
+            return run_volk_malloc_tests() ? 1 : 0;
+        }
+        if (std::string(argv[1]) == "volk_fir") {
+            return run_volk_fir_tests() ? 1 : 0;
+        }
+        if (std::string(argv[1]) == "volk_pfb") {
+            return run_volk_pfb_tests() ? 1 : 0;
+        }
+        if (std::string(argv[1]) == "volk_psd") {
+            return run_volk_psd_tests() ? 1 : 0;
+        }
         for (unsigned int ii = 0; ii < test_cases.size(); ++ii) {
             if (std::string(argv[1]) == test_cases[ii].name()) {
                 volk_test_case_t test_case = test_cases[ii];
@@ -97,6 +112,11 @@ int main(int argc, char* argv[])
             }
         }
 
+        if (run_volk_64_tests()) {
+            std::cerr << "Failure on volk_64" << std::endl;
+            qa_failures.push_back("volk_64");
+        }
+
         // Generate XML results
         print_qa_xml(results, qa_failures.size());
 
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdbool.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "volk_autotune.h"
+#include "volk_once.h"
+#include "volk_rank_archs.h"
+#include <volk/volk_config_fixed.h>
+
+#if defined(_MSC_VER)
+#define volk_autotune_inc(p) _InterlockedIncrement(p)
+#define volk_autotune_add(p, v) _InterlockedExchangeAdd64((p), (v))
+#else
+#define volk_autotune_inc(p) __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+#define volk_autotune_add(p, v) __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#endif
+
+static bool volk_autotune_claim(volk_autotune_t* tune)
+{
+#if defined(_MSC_VER)
+    return _InterlockedCompareExchange(&tune->state, 1, 0) == 0;
+#else
+    long expected = 0;
+    return __atomic_compare_exchange_n(
+        &tune->state, &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+void volk_autotune_setup(volk_autotune_t* tune,
+                         const char* kern_name,
+                         const char** impl_names,
+                         const uint64_t* impl_deps,
+                         const bool* alignment,
+                         size_t n_impls,
+                         bool align)
+{
+    size_t i;
+    tune->calls = 0;
+    tune->state = 0;
+    tune->impl_names = impl_names;
+    tune->default_index =
+        volk_rank_archs(kern_name, impl_names, impl_deps, alignment, n_impls, align);
+    tune->best = tune->default_index;
+    tune->n_candidates = 0;
+    // one impl is kept for all lengths, which offloaded impls never win
+    for (i = 0; i < n_impls && tune->n_candidates < VOLK_AUTOTUNE_MAX_IMPLS; i++) {
+        if ((align || !alignment[i]) && !(impl_deps[i] & VOLK_OFFLOAD_ARCHS)) {
+            const size_t slot = tune->n_candidates++;
+            tune->candidates[slot] = i;
+            tune->ns[slot] = 0;
+            tune->points[slot] = 0;
+            tune->samples[slot] = 0;
+        }
+    }
+    // nothing to choose between, keep the ranked impl
+    if (tune->n_candidates < 2)
+        tune->state = 2;
+}
+
+int volk_autotune_sample(volk_autotune_t* tune)
+{
+    if (VOLK_ATOMIC_LOAD_ACQ(&tune->state) != 0)
+        return -1;
+    const long call = volk_autotune_inc(&tune->calls);
+    if (call % VOLK_AUTOTUNE_PERIOD)
+        return -1;
+    return (int)((call / VOLK_AUTOTUNE_PERIOD) % tune->n_candidates);
+}
+
+uint64_t volk_autotune_now(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (uint64_t)((double)count.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+bool volk_autotune_record(volk_autotune_t* tune, int slot, uint64_t ns, size_t points)
+{
+    size_t i;
+    volk_autotune_add(&tune->ns[slot], (long long)ns);
+    volk_autotune_add(&tune->points[slot], (long long)(points ? points : 1));
+    if (volk_autotune_inc(&tune->samples[slot]) < VOLK_AUTOTUNE_SAMPLES)
+        return false;
+    for (i = 0; i < tune->n_candidates; i++) {
+        if (VOLK_ATOMIC_LOAD_ACQ(&tune->samples[i]) < VOLK_AUTOTUNE_SAMPLES)
+            return false;
+    }
+    if (!volk_autotune_claim(tune))
+        return false;
+
+    // lowest mean time per point over the sampled calls
+    size_t best = 0;
+    for (i = 1; i < tune->n_candidates; i++) {
+        if ((double)tune->ns[i] / tune->points[i] <
+            (double)tune->ns[best] / tune->points[best])
+            best = i;
+    }
+    tune->best = tune->candidates[best];
+    VOLK_ATOMIC_STORE_REL(&tune->state, 2);
+    return true;
+}
+
+bool volk_autotune_done(const volk_autotune_t* tune)
+{
+    return VOLK_ATOMIC_LOAD_ACQ((volatile long*)&tune->state) == 2;
+}
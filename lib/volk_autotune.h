@@ -0,0 +1,88 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_AUTOTUNE_H
+#define INCLUDED_VOLK_AUTOTUNE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// one in this many calls of a tuning kernel is timed
+#define VOLK_AUTOTUNE_PERIOD 64
+
+// timed calls per candidate before the fastest one is chosen
+#define VOLK_AUTOTUNE_SAMPLES 32
+
+// candidates considered per kernel and alignment, the rest are ignored
+#define VOLK_AUTOTUNE_MAX_IMPLS 32
+
+/*!
+ * Online tuning state of one kernel entry point (aligned or unaligned).
+ * Sampled calls are handed to the candidates in turn; once each has been
+ * timed VOLK_AUTOTUNE_SAMPLES times the one with the lowest time per point
+ * becomes best and the state is done.
+ */
+typedef struct volk_autotune {
+    long calls;
+    long state; // 0 = tuning, 1 = choosing, 2 = done
+    const char** impl_names;
+    size_t default_index; // the ranked impl, used by calls which are not sampled
+    size_t best;          // index into impl_names once done
+    size_t n_candidates;
+    size_t candidates[VOLK_AUTOTUNE_MAX_IMPLS];
+    long long ns[VOLK_AUTOTUNE_MAX_IMPLS];
+    long long points[VOLK_AUTOTUNE_MAX_IMPLS];
+    long samples[VOLK_AUTOTUNE_MAX_IMPLS];
+} volk_autotune_t;
+
+//! Collect the candidates: every impl for align, else only the unaligned ones
+void volk_autotune_setup(volk_autotune_t* tune,
+                         const char* kern_name,
+                         const char** impl_names,
+                         const uint64_t* impl_deps,
+                         const bool* alignment,
+                         size_t n_impls,
+                         bool align);
+
+//! Count a call; returns the candidate slot to time or -1 if it is not sampled
+int volk_autotune_sample(volk_autotune_t* tune);
+
+//! Monotonic time in nanoseconds
+uint64_t volk_autotune_now(void);
+
+/*!
+ * Record a timed call of candidate slot.
+ * \return true for exactly one caller, when best has just been chosen
+ */
+bool volk_autotune_record(volk_autotune_t* tune, int slot, uint64_t ns, size_t points);
+
+//! Has tune chosen its best impl
+bool volk_autotune_done(const volk_autotune_t* tune);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*INCLUDED_VOLK_AUTOTUNE_H*/
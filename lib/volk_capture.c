@@ -0,0 +1,187 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_capture.h>
+
+#include "volk_capture_record.h"
+#include "volk_once.h"
+
+volatile long volk_capture_on = 0;
+
+////////////////////////////////////////////////////////////////////////
+// The records go to a buffer sized by volk_capture_start(). A call
+// reserves its slot with a relaxed atomic add and writes the record
+// there, flags last; the stop clears volk_capture_on first and only
+// writes the records whose flags say they were filled in. The buffer
+// outlives the capture, so a call which read volk_capture_on just
+// before the stop still writes into memory of its own.
+////////////////////////////////////////////////////////////////////////
+static struct {
+    volk_capture_call_t* calls;
+    size_t capacity;  // records allocated
+    size_t max_calls; // records of the running capture
+    long long next;   // slots reserved, including the dropped calls
+    char path[1024];
+    bool atexit_done;
+} volk_capture;
+
+void volk_capture_record(unsigned int kernel,
+                         unsigned int num_points,
+                         uint32_t offsets,
+                         unsigned int in_place,
+                         bool aligned)
+{
+    const long long slot = VOLK_ATOMIC_ADD_RELAXED(&volk_capture.next, 1);
+    if (slot < 0 || (size_t)slot >= volk_capture.max_calls)
+        return;
+    volk_capture_call_t* call = &volk_capture.calls[slot];
+    call->num_points = num_points;
+    call->offsets = offsets;
+    call->kernel = (uint16_t)kernel;
+    call->in_place = (uint8_t)in_place;
+    call->flags = VOLK_CAPTURE_CALL_VALID | (aligned ? VOLK_CAPTURE_CALL_ALIGNED : 0);
+}
+
+static void volk_capture_at_exit(void)
+{
+    if (volk_capture_on)
+        volk_capture_stop();
+}
+
+bool volk_capture_start(const char* path, size_t max_calls)
+{
+    if (volk_capture_on || !path || strlen(path) >= sizeof(volk_capture.path) ||
+        volk_get_kernel_stats(NULL, 0) == 0)
+        return false;
+    if (!max_calls)
+        max_calls = VOLK_CAPTURE_DEFAULT_CALLS;
+    if (max_calls > volk_capture.capacity) {
+        volk_capture_call_t* calls =
+            (volk_capture_call_t*)calloc(max_calls, sizeof(volk_capture_call_t));
+        if (!calls)
+            return false;
+        free(volk_capture.calls);
+        volk_capture.calls = calls;
+        volk_capture.capacity = max_calls;
+    } else {
+        memset(volk_capture.calls, 0, max_calls * sizeof(volk_capture_call_t));
+    }
+    strcpy(volk_capture.path, path);
+    volk_capture.max_calls = max_calls;
+    volk_capture.next = 0;
+    if (!volk_capture.atexit_done) {
+        atexit(&volk_capture_at_exit);
+        volk_capture.atexit_done = true;
+    }
+    VOLK_ATOMIC_STORE_REL(&volk_capture_on, 1);
+    return true;
+}
+
+bool volk_capture_stop(void)
+{
+    volk_capture_header_t header;
+    volk_kernel_stats_t* stats;
+    char name[VOLK_CAPTURE_NAME_LEN];
+    FILE* trace;
+    size_t i, reserved;
+    bool ok;
+
+    if (!volk_capture_on)
+        return false;
+    VOLK_ATOMIC_STORE_REL(&volk_capture_on, 0);
+    reserved = (size_t)VOLK_ATOMIC_ADD_RELAXED(&volk_capture.next, 0);
+
+    memset(&header, 0, sizeof(header));
+    header.magic = VOLK_CAPTURE_MAGIC;
+    header.version = VOLK_CAPTURE_VERSION;
+    header.n_kernels = (uint32_t)volk_get_kernel_stats(NULL, 0);
+    header.alignment = (uint32_t)volk_get_alignment();
+    header.call_size = sizeof(volk_capture_call_t);
+    strncpy(header.machine, volk_get_machine(), sizeof(header.machine) - 1);
+    if (reserved > volk_capture.max_calls) {
+        header.dropped = reserved - volk_capture.max_calls;
+        reserved = volk_capture.max_calls;
+    }
+    // pack the records which were filled in to the front
+    for (i = 0; i < reserved; i++) {
+        if (volk_capture.calls[i].flags & VOLK_CAPTURE_CALL_VALID)
+            volk_capture.calls[header.n_calls++] = volk_capture.calls[i];
+    }
+
+    stats = (volk_kernel_stats_t*)calloc(header.n_kernels, sizeof(volk_kernel_stats_t));
+    trace = fopen(volk_capture.path, "wb");
+    ok = stats && trace && fwrite(&header, sizeof(header), 1, trace) == 1;
+    if (ok)
+        volk_get_kernel_stats(stats, header.n_kernels);
+    for (i = 0; ok && i < header.n_kernels; i++) {
+        memset(name, 0, sizeof(name));
+        strncpy(name, stats[i].name, sizeof(name) - 1);
+        ok = fwrite(name, sizeof(name), 1, trace) == 1;
+    }
+    ok = ok && fwrite(volk_capture.calls,
+                      sizeof(volk_capture_call_t),
+                      (size_t)header.n_calls,
+                      trace) == header.n_calls;
+    if (trace)
+        ok = (fclose(trace) == 0) && ok;
+    free(stats);
+    return ok;
+}
+
+volk_capture_header_t* volk_capture_load(const char* path)
+{
+    volk_capture_header_t header;
+    volk_capture_header_t* trace;
+    FILE* file = fopen(path, "rb");
+    size_t k, bytes;
+    long size;
+
+    if (!file)
+        return NULL;
+    if (fread(&header, sizeof(header), 1, file) != 1 || fseek(file, 0, SEEK_END) ||
+        (size = ftell(file)) < 0 || header.magic != VOLK_CAPTURE_MAGIC ||
+        header.version != VOLK_CAPTURE_VERSION ||
+        header.call_size != sizeof(volk_capture_call_t) || header.n_kernels > 65536 ||
+        header.n_calls > (uint64_t)size / sizeof(volk_capture_call_t)) {
+        fclose(file);
+        return NULL;
+    }
+    bytes = sizeof(header) + (size_t)header.n_kernels * VOLK_CAPTURE_NAME_LEN +
+            (size_t)header.n_calls * sizeof(volk_capture_call_t);
+    trace = (size_t)size == bytes ? (volk_capture_header_t*)malloc(bytes) : NULL;
+    if (!trace || fseek(file, 0, SEEK_SET) || fread(trace, 1, bytes, file) != bytes) {
+        fclose(file);
+        free(trace);
+        return NULL;
+    }
+    fclose(file);
+    for (k = 0; k < header.n_kernels; k++) {
+        ((char*)volk_capture_kernel_name(trace, k))[VOLK_CAPTURE_NAME_LEN - 1] = '\0';
+    }
+    return trace;
+}
+
+void volk_capture_free(volk_capture_header_t* trace) { free(trace); }
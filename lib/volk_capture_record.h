@@ -0,0 +1,53 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_CAPTURE_RECORD_H
+#define INCLUDED_VOLK_CAPTURE_RECORD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The recording side of <volk/volk_capture.h>, called by the tracing
+ * trampolines of the dispatcher. volk_capture_on is only read there, so
+ * that a process which does not capture pays for one load per call.
+ */
+extern volatile long volk_capture_on;
+
+/*!
+ * Append a call to the capture, or count it as dropped when the buffer is
+ * full. kernel is the index of the kernel in volk_get_kernel_stats().
+ */
+void volk_capture_record(unsigned int kernel,
+                         unsigned int num_points,
+                         uint32_t offsets,
+                         unsigned int in_place,
+                         bool aligned);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDED_VOLK_CAPTURE_RECORD_H */
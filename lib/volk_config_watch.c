@@ -0,0 +1,150 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_prefs.h>
+
+#if defined(HAVE_SYS_INOTIFY_H) && defined(HAVE_PTHREAD_H)
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////
+// A thread waiting on inotify for configs written to the config dir and
+// its volk_config.d, which reloads the config after each. Tools which
+// write a new file and rename it over the old one are seen too. The
+// pipe wakes the thread up when watching stops.
+////////////////////////////////////////////////////////////////////////
+static struct {
+    pthread_mutex_t lock;
+    pthread_t thread;
+    bool running;
+    int inotify_fd;
+    int config_wd; // the watch of the config dir, the other is volk_config.d
+    int stop_pipe[2];
+} volk_watch = { PTHREAD_MUTEX_INITIALIZER };
+
+static void* volk_watch_worker(void* arg)
+{
+    char events[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    struct pollfd fds[2] = { { volk_watch.inotify_fd, POLLIN, 0 },
+                             { volk_watch.stop_pipe[0], POLLIN, 0 } };
+    (void)arg;
+
+    for (;;) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (fds[1].revents)
+            break;
+        const ssize_t len = read(volk_watch.inotify_fd, events, sizeof(events));
+        bool changed = false;
+        ssize_t offset = 0;
+        while (offset < len) {
+            const struct inotify_event* event =
+                (const struct inotify_event*)(events + offset);
+            // any volk_config*, and every file of volk_config.d, is a profile
+            changed |= event->len && (event->wd != volk_watch.config_wd ||
+                                      !strncmp(event->name, "volk_config", 11));
+            offset += sizeof(*event) + event->len;
+        }
+        if (changed)
+            volk_reload_config();
+    }
+    return NULL;
+}
+
+static bool volk_watch_start(void)
+{
+    char path[512], dir[512];
+    char* slash;
+    int n;
+
+    volk_get_config_path(path, false);
+    slash = strrchr(path, '/');
+    if (!path[0] || !slash)
+        return false;
+    *slash = '\0';
+    // a cut short dir would watch another one
+    n = snprintf(dir, sizeof(dir), "%s/volk_config.d", path);
+    if (n < 0 || (size_t)n >= sizeof(dir))
+        return false;
+    volk_watch.inotify_fd = inotify_init1(IN_CLOEXEC);
+    if (volk_watch.inotify_fd < 0)
+        return false;
+    const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO;
+    volk_watch.config_wd = inotify_add_watch(volk_watch.inotify_fd, path, mask);
+    if (volk_watch.config_wd < 0 || pipe(volk_watch.stop_pipe) != 0) {
+        close(volk_watch.inotify_fd);
+        return false;
+    }
+    // a cpu profile dir created later is only seen after watching again
+    inotify_add_watch(volk_watch.inotify_fd, dir, mask);
+    if (pthread_create(&volk_watch.thread, NULL, volk_watch_worker, NULL)) {
+        close(volk_watch.stop_pipe[0]);
+        close(volk_watch.stop_pipe[1]);
+        close(volk_watch.inotify_fd);
+        return false;
+    }
+    return true;
+}
+
+static void volk_watch_stop(void)
+{
+    const char wake = 0;
+    if (write(volk_watch.stop_pipe[1], &wake, 1) != 1)
+        fprintf(stderr, "volk_watch_config: cannot stop the watcher\n");
+    pthread_join(volk_watch.thread, NULL);
+    close(volk_watch.stop_pipe[0]);
+    close(volk_watch.stop_pipe[1]);
+    close(volk_watch.inotify_fd);
+}
+
+bool volk_watch_config(bool watch)
+{
+    pthread_mutex_lock(&volk_watch.lock);
+    if (watch && !volk_watch.running) {
+        volk_watch.running = volk_watch_start();
+    } else if (!watch && volk_watch.running) {
+        volk_watch_stop();
+        volk_watch.running = false;
+    }
+    const bool running = volk_watch.running;
+    pthread_mutex_unlock(&volk_watch.lock);
+    return running;
+}
+
+#else
+
+bool volk_watch_config(bool watch)
+{
+    (void)watch;
+    return false;
+}
+
+#endif
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // sched_getcpu
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <volk/volk_cpu.h>
+#include "volk_once.h"
+
+// cpus beyond this all report class 0
+#define VOLK_CORE_CLASS_MAX_CPUS 1024
+
+static struct {
+    volk_once_t detected;
+    unsigned int n_classes;
+    unsigned char classes[VOLK_CORE_CLASS_MAX_CPUS];
+} volk_core_classes = { VOLK_ONCE_INIT, 1, { 0 } };
+
+#if defined(__linux__)
+// mark the cpus of a sysfs cpu list such as "0-7,16-23" as class cls
+static int volk_read_cpu_list(const char* path, unsigned char cls)
+{
+    char list[1024];
+    FILE* file = fopen(path, "r");
+    if (!file)
+        return 0;
+    const char* item = fgets(list, sizeof(list), file);
+    fclose(file);
+    int n_cpus = 0;
+    while (item && *item >= '0' && *item <= '9') {
+        char* end;
+        long first = strtol(item, &end, 10);
+        long last = first;
+        if (*end == '-')
+            last = strtol(end + 1, &end, 10);
+        for (; first <= last && first < VOLK_CORE_CLASS_MAX_CPUS; first++, n_cpus++)
+            volk_core_classes.classes[first] = cls;
+        item = (*end == ',') ? end + 1 : NULL;
+    }
+    return n_cpus;
+}
+
+static void volk_detect_core_classes(void)
+{
+    // hybrid x86 exposes one perf pmu per core type
+    if (volk_read_cpu_list("/sys/devices/cpu_core/cpus", 0) &&
+        volk_read_cpu_list("/sys/devices/cpu_atom/cpus", 1)) {
+        volk_core_classes.n_classes = 2;
+        return;
+    }
+    memset(volk_core_classes.classes, 0, sizeof(volk_core_classes.classes));
+
+    // arm: rank the distinct cpu capacities, the biggest cores are class 0
+    unsigned long capacities[VOLK_CORE_CLASS_MAX_CPUS];
+    unsigned long distinct[VOLK_MAX_CORE_CLASSES];
+    unsigned int n_distinct = 0;
+    int n_cpus, i;
+    unsigned int c, d;
+    for (n_cpus = 0; n_cpus < VOLK_CORE_CLASS_MAX_CPUS; n_cpus++) {
+        char path[96];
+        snprintf(path,
+                 sizeof(path),
+                 "/sys/devices/system/cpu/cpu%d/cpu_capacity",
+                 n_cpus);
+        FILE* file = fopen(path, "r");
+        if (!file)
+            break;
+        if (fscanf(file, "%lu", &capacities[n_cpus]) != 1)
+            capacities[n_cpus] = 0;
+        fclose(file);
+        for (d = 0; d < n_distinct && distinct[d] != capacities[n_cpus]; d++)
+            ;
+        if (d == n_distinct && n_distinct < VOLK_MAX_CORE_CLASSES)
+            distinct[n_distinct++] = capacities[n_cpus];
+    }
+    if (n_distinct < 2)
+        return;
+    for (i = 0; i < n_cpus; i++) {
+        unsigned char cls = 0;
+        for (c = 0; c < n_distinct; c++) {
+            if (distinct[c] > capacities[i])
+                cls++;
+        }
+        volk_core_classes.classes[i] = cls < n_distinct ? cls : n_distinct - 1;
+    }
+    volk_core_classes.n_classes = n_distinct;
+}
+#else
+static void volk_detect_core_classes(void) {}
+#endif
+
+unsigned int volk_get_n_core_classes(void)
+{
+    volk_call_once(&volk_core_classes.detected, &volk_detect_core_classes);
+    return volk_core_classes.n_classes;
+}
+
+unsigned int volk_get_core_class(int cpu)
+{
+    volk_call_once(&volk_core_classes.detected, &volk_detect_core_classes);
+    if (cpu < 0 || cpu >= VOLK_CORE_CLASS_MAX_CPUS)
+        return 0;
+    return volk_core_classes.classes[cpu];
+}
+
+unsigned int volk_get_current_core_class(void)
+{
+#if defined(__linux__)
+    return volk_get_core_class(sched_getcpu());
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,314 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#include <sys/types.h>
+#elif defined(__unix__)
+#include <unistd.h>
+#endif
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#if defined(__GNUC__)
+#include <cpuid.h>
+#define VOLK_CPUID_LEAF4
+#define volk_cpuid(leaf, sub, r) __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3])
+#elif defined(_MSC_VER) && defined(HAVE_INTRIN_H)
+#include <intrin.h>
+#define VOLK_CPUID_LEAF4
+#define volk_cpuid(leaf, sub, r) __cpuidex((int*)r, leaf, sub)
+#endif
+#endif
+
+#include "volk_once.h"
+#include <volk/volk.h>
+#include <volk/volk_cpu.h>
+
+// used where the os does not tell, right for current x86 and most arm cores
+#define VOLK_DEFAULT_CACHELINE_SIZE 64
+// used where the os does not tell, the smallest L1d of current x86 and arm cores
+#define VOLK_DEFAULT_L1D_CACHE_SIZE (32 * 1024)
+// used where the os does not tell, the smallest L2 of current x86 and arm cores
+#define VOLK_DEFAULT_L2_CACHE_SIZE (256 * 1024)
+
+static volk_once_t volk_cpu_info_once = VOLK_ONCE_INIT;
+static volk_cpu_info_t volk_cpu_info;
+
+#if defined(__linux__)
+// the first line of a sysfs file, false if it is missing
+static bool volk_read_sysfs(const char* path, char* value, size_t len)
+{
+    FILE* file = fopen(path, "r");
+    bool ok;
+    if (!file)
+        return false;
+    ok = fgets(value, (int)len, file) != NULL;
+    fclose(file);
+    return ok;
+}
+
+// a value of cpu0's cache entry index, such as its "size"
+static bool
+volk_read_cache_entry(unsigned int index, const char* name, char* value, size_t len)
+{
+    char path[96];
+    snprintf(
+        path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%u/%s", index, name);
+    return volk_read_sysfs(path, value, len);
+}
+
+// a size such as "48K"
+static size_t volk_parse_size(const char* value)
+{
+    char* unit;
+    const unsigned long size = strtoul(value, &unit, 10);
+    if (*unit == 'K')
+        return (size_t)size * 1024;
+    if (*unit == 'M')
+        return (size_t)size * 1024 * 1024;
+    return (size_t)size;
+}
+
+// the number of entries of a list such as "0-7,16-23"
+static unsigned int volk_parse_list(const char* value)
+{
+    unsigned int count = 0;
+    while (*value >= '0' && *value <= '9') {
+        char* end;
+        const unsigned long first = strtoul(value, &end, 10);
+        unsigned long last = first;
+        if (*end == '-')
+            last = strtoul(end + 1, &end, 10);
+        if (last >= first)
+            count += (unsigned int)(last - first + 1);
+        value = *end == ',' ? end + 1 : end;
+    }
+    return count;
+}
+
+static void volk_read_cpu_info(volk_cpu_info_t* info)
+{
+    char value[256];
+    unsigned int index;
+    const long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    // the data and unified caches, from L1d up
+    for (index = 0; index < 8; index++) {
+        unsigned int level;
+        size_t size;
+        if (!volk_read_cache_entry(index, "level", value, sizeof(value)))
+            break;
+        level = (unsigned int)atoi(value);
+        if (!volk_read_cache_entry(index, "type", value, sizeof(value)) ||
+            !strncmp(value, "Instruction", 11))
+            continue;
+        size = volk_read_cache_entry(index, "size", value, sizeof(value))
+                   ? volk_parse_size(value)
+                   : 0;
+        if (level == 1) {
+            info->l1d_cache_size = size;
+            if (volk_read_cache_entry(
+                    index, "coherency_line_size", value, sizeof(value)))
+                info->cacheline_size = (size_t)atol(value);
+        } else if (level == 2) {
+            info->l2_cache_size = size;
+        } else if (level == 3) {
+            info->l3_cache_size = size;
+        }
+    }
+
+    if (n_cpus > 0)
+        info->n_cpus = (unsigned int)n_cpus;
+    if (volk_read_sysfs("/sys/devices/system/cpu/cpu0/topology/thread_siblings_list",
+                        value,
+                        sizeof(value)))
+        info->threads_per_core = volk_parse_list(value);
+    if (volk_read_sysfs("/sys/devices/system/node/online", value, sizeof(value)))
+        info->n_numa_nodes = volk_parse_list(value);
+}
+
+#elif defined(_WIN32)
+static void volk_read_cpu_info(volk_cpu_info_t* info)
+{
+    DWORD bytes = 0;
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION* entries;
+    GetLogicalProcessorInformation(NULL, &bytes);
+    entries = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION*)malloc(bytes);
+    if (entries && GetLogicalProcessorInformation(entries, &bytes)) {
+        for (DWORD i = 0; i < bytes / sizeof(*entries); i++) {
+            const SYSTEM_LOGICAL_PROCESSOR_INFORMATION* entry = &entries[i];
+            if (entry->Relationship == RelationProcessorCore) {
+                ULONG_PTR mask = entry->ProcessorMask;
+                info->n_cores++;
+                for (; mask; mask &= mask - 1)
+                    info->n_cpus++;
+            } else if (entry->Relationship == RelationNumaNode) {
+                info->n_numa_nodes++;
+            } else if (entry->Relationship == RelationCache &&
+                       entry->Cache.Type != CacheInstruction) {
+                // the first entry of a level is the cache of the first core
+                if (entry->Cache.Level == 1 && !info->l1d_cache_size) {
+                    info->l1d_cache_size = entry->Cache.Size;
+                    info->cacheline_size = entry->Cache.LineSize;
+                } else if (entry->Cache.Level == 2 && !info->l2_cache_size) {
+                    info->l2_cache_size = entry->Cache.Size;
+                } else if (entry->Cache.Level == 3 && !info->l3_cache_size) {
+                    info->l3_cache_size = entry->Cache.Size;
+                }
+            }
+        }
+    }
+    free(entries);
+}
+
+#elif defined(__APPLE__)
+static size_t volk_sysctl(const char* name)
+{
+    uint64_t value = 0;
+    size_t len = sizeof(value);
+    // the sizes are 64 bit, the counts 32 bit, little endian either way
+    if (sysctlbyname(name, &value, &len, NULL, 0) != 0)
+        return 0;
+    return len == sizeof(uint32_t) ? (size_t)(uint32_t)value : (size_t)value;
+}
+
+static void volk_read_cpu_info(volk_cpu_info_t* info)
+{
+    // the performance cores' caches on apple silicon; its L2 is per cluster
+    info->l1d_cache_size = volk_sysctl("hw.l1dcachesize");
+    info->l2_cache_size = volk_sysctl("hw.l2cachesize");
+    info->l3_cache_size = volk_sysctl("hw.l3cachesize");
+    info->cacheline_size = volk_sysctl("hw.cachelinesize");
+    info->n_cpus = (unsigned int)volk_sysctl("hw.logicalcpu");
+    info->n_cores = (unsigned int)volk_sysctl("hw.physicalcpu");
+}
+
+#else
+static void volk_read_cpu_info(volk_cpu_info_t* info)
+{
+#if defined(_SC_NPROCESSORS_ONLN)
+    const long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n_cpus > 0)
+        info->n_cpus = (unsigned int)n_cpus;
+#endif
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+    if (sysconf(_SC_LEVEL1_DCACHE_SIZE) > 0)
+        info->l1d_cache_size = (size_t)sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    if (sysconf(_SC_LEVEL1_DCACHE_LINESIZE) > 0)
+        info->cacheline_size = (size_t)sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+    if (sysconf(_SC_LEVEL2_CACHE_SIZE) > 0)
+        info->l2_cache_size = (size_t)sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (sysconf(_SC_LEVEL3_CACHE_SIZE) > 0)
+        info->l3_cache_size = (size_t)sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+    (void)info;
+}
+#endif
+
+#if defined(VOLK_CPUID_LEAF4)
+// the deterministic cache parameters of cpuid leaf 4, at 0x8000001d on amd
+static void volk_read_cpuid_caches(volk_cpu_info_t* info)
+{
+    unsigned int regs[4] = { 0, 0, 0, 0 };
+    unsigned int leaf = 4;
+    unsigned int sub;
+
+    volk_cpuid(0, 0, regs);
+    if (regs[0] < 4 || regs[1] == 0x68747541) { // "Auth"enticAMD
+        volk_cpuid(0x80000000, 0, regs);
+        if (regs[0] < 0x8000001d)
+            return;
+        leaf = 0x8000001d;
+    }
+    for (sub = 0; sub < 16; sub++) {
+        unsigned int type, level;
+        size_t line, size;
+        volk_cpuid(leaf, sub, regs);
+        type = regs[0] & 0x1f;
+        if (type == 0)
+            break;
+        if (type == 2) // instruction
+            continue;
+        level = (regs[0] >> 5) & 0x7;
+        line = (regs[1] & 0xfff) + 1;
+        size = (((regs[1] >> 22) & 0x3ff) + 1) * (((regs[1] >> 12) & 0x3ff) + 1) *
+               line * ((size_t)regs[2] + 1);
+        if (level == 1 && !info->l1d_cache_size) {
+            info->l1d_cache_size = size;
+            if (!info->cacheline_size)
+                info->cacheline_size = line;
+        } else if (level == 2 && !info->l2_cache_size) {
+            info->l2_cache_size = size;
+        } else if (level == 3 && !info->l3_cache_size) {
+            info->l3_cache_size = size;
+        }
+    }
+}
+#endif
+
+static void volk_detect_cpu_info(void)
+{
+    volk_cpu_info_t* info = &volk_cpu_info;
+    size_t line;
+
+    info->archs = volk_get_lvarch();
+    volk_read_cpu_info(info);
+#if defined(VOLK_CPUID_LEAF4)
+    if (!info->l1d_cache_size || !info->l2_cache_size)
+        volk_read_cpuid_caches(info);
+#endif
+    line = info->cacheline_size;
+
+    // only a power of two can serve as an alignment
+    if (line < 16 || line > 4096 || (line & (line - 1)) != 0)
+        info->cacheline_size = VOLK_DEFAULT_CACHELINE_SIZE;
+    if (info->l1d_cache_size < 4 * 1024)
+        info->l1d_cache_size = VOLK_DEFAULT_L1D_CACHE_SIZE;
+    // anything below 64 KiB is a misreport, e.g. of the L1
+    if (info->l2_cache_size < 64 * 1024)
+        info->l2_cache_size = VOLK_DEFAULT_L2_CACHE_SIZE;
+    if (!info->n_cpus)
+        info->n_cpus = 1;
+    if (info->n_cores && !info->threads_per_core)
+        info->threads_per_core = (info->n_cpus + info->n_cores - 1) / info->n_cores;
+    if (!info->threads_per_core || info->threads_per_core > info->n_cpus)
+        info->threads_per_core = 1;
+    if (!info->n_cores)
+        info->n_cores = info->n_cpus / info->threads_per_core;
+    if (!info->n_numa_nodes)
+        info->n_numa_nodes = 1;
+}
+
+const volk_cpu_info_t* volk_get_cpu_info(void)
+{
+    volk_call_once(&volk_cpu_info_once, volk_detect_cpu_info);
+    return &volk_cpu_info;
+}
+
+size_t volk_get_cacheline_size(void) { return volk_get_cpu_info()->cacheline_size; }
+
+size_t volk_get_l2_cache_size(void) { return volk_get_cpu_info()->l2_cache_size; }
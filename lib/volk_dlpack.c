@@ -0,0 +1,107 @@
+/* -*- c -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <volk/volk_dlpack.h>
+
+// the manager_ctx of an exported tensor, which holds its shape and owner
+typedef struct {
+    DLManagedTensor tensor;
+    int64_t shape[2];
+    void (*release)(void* owner);
+    void* owner;
+} volk_dlpack_export_t;
+
+static void volk_dlpack_delete(DLManagedTensor* tensor)
+{
+    volk_dlpack_export_t* ctx = (volk_dlpack_export_t*)tensor->manager_ctx;
+    if (ctx->release)
+        ctx->release(ctx->owner);
+    free(ctx);
+}
+
+DLManagedTensor* volk_dlpack_export(void* data,
+                                    size_t n_items,
+                                    DLDataType dtype,
+                                    size_t n_components,
+                                    void (*release)(void* owner),
+                                    void* owner)
+{
+    volk_dlpack_export_t* ctx = (volk_dlpack_export_t*)calloc(1, sizeof(*ctx));
+    if (!ctx)
+        return NULL;
+    ctx->shape[0] = (int64_t)n_items;
+    ctx->shape[1] = (int64_t)n_components;
+    ctx->release = release;
+    ctx->owner = owner;
+    ctx->tensor.dl_tensor.data = data;
+    ctx->tensor.dl_tensor.device.device_type = kDLCPU;
+    ctx->tensor.dl_tensor.device.device_id = 0;
+    ctx->tensor.dl_tensor.ndim = n_components > 1 ? 2 : 1;
+    ctx->tensor.dl_tensor.dtype = dtype;
+    ctx->tensor.dl_tensor.shape = ctx->shape;
+    ctx->tensor.dl_tensor.strides = NULL; // C contiguous
+    ctx->tensor.dl_tensor.byte_offset = 0;
+    ctx->tensor.manager_ctx = ctx;
+    ctx->tensor.deleter = volk_dlpack_delete;
+    return &ctx->tensor;
+}
+
+void* volk_dlpack_import(const DLTensor* tensor,
+                         DLDataType dtype,
+                         size_t* n_values,
+                         size_t* alignment)
+{
+    int64_t stride = 1, count = 1;
+    int32_t dim;
+    uintptr_t address;
+
+    if (!tensor || (tensor->device.device_type != kDLCPU &&
+                    tensor->device.device_type != kDLCUDAHost))
+        return NULL;
+    if (tensor->dtype.code != dtype.code || tensor->dtype.bits != dtype.bits ||
+        tensor->dtype.lanes != dtype.lanes)
+        return NULL;
+    // C contiguous: strides NULL, or those of the row-major layout, where
+    // dimensions of length 1 may have any stride
+    for (dim = tensor->ndim - 1; dim >= 0; dim--) {
+        const int64_t length = tensor->shape[dim];
+        if (length < 0)
+            return NULL;
+        if (tensor->strides && length > 1 && tensor->strides[dim] != stride)
+            return NULL;
+        stride *= length;
+        count *= length;
+    }
+
+    address = (uintptr_t)tensor->data + (uintptr_t)tensor->byte_offset;
+    *n_values = (size_t)count;
+    if (alignment) {
+        size_t align = 4096;
+        while (align > 1 && address % align)
+            align /= 2;
+        *alignment = align;
+    }
+    return (void*)address;
+}
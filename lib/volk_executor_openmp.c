@@ -0,0 +1,48 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <omp.h>
+#include <volk/volk_executor.h>
+
+// The tasks run on an OpenMP loop inside submit, on the team and thread
+// count of the host's OpenMP runtime, so wait has nothing left to do and
+// volk_async_ calls complete before they return.
+static void* volk_openmp_submit(void* ctx, size_t n_tasks, volk_task_fn fn, void* arg)
+{
+    long task;
+    (void)ctx;
+#pragma omp parallel for schedule(dynamic, 1)
+    for (task = 0; task < (long)n_tasks; task++)
+        fn(arg, (size_t)task);
+    return NULL;
+}
+
+static void volk_openmp_wait(void* ctx, void* handle)
+{
+    (void)ctx;
+    (void)handle;
+}
+
+bool volk_use_openmp_executor(void)
+{
+    volk_set_executor(&volk_openmp_submit, &volk_openmp_wait, NULL);
+    return true;
+}
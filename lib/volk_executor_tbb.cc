@@ -0,0 +1,50 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <tbb/task_group.h>
+#include <volk/volk_executor.h>
+
+// Every submit is a task_group on the host's oneTBB arena, so the chunks
+// share its worker threads with the rest of the application.
+static void* volk_tbb_submit(void* ctx, size_t n_tasks, volk_task_fn fn, void* arg)
+{
+    tbb::task_group* group = new tbb::task_group;
+    (void)ctx;
+    for (size_t task = 0; task < n_tasks; ++task) {
+        group->run([=]() { fn(arg, task); });
+    }
+    return group;
+}
+
+static void volk_tbb_wait(void* ctx, void* handle)
+{
+    tbb::task_group* group = static_cast<tbb::task_group*>(handle);
+    (void)ctx;
+    group->wait();
+    delete group;
+}
+
+bool volk_use_tbb_executor(void)
+{
+    volk_set_executor(&volk_tbb_submit, &volk_tbb_wait, NULL);
+    return true;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <volk/volk.h>
+#include <volk/volk_fft.h>
+#include "volk_once.h"
+#include "volk_plan_cache.h"
+
+// one table per direction and log2 length, published once built
+#define VOLK_FFT_MAX_LOG2 32
+static lv_32fc_t* volk_fft_twiddles[2][VOLK_FFT_MAX_LOG2];
+
+// shorter tables are computed faster than their cache file is opened
+#define VOLK_FFT_CACHE_MIN_POINTS 4096
+
+static lv_32fc_t* volk_fft_make_twiddles(unsigned int num_points, bool inverse)
+{
+    lv_32fc_t* twiddles = (lv_32fc_t*)volk_malloc(num_points * sizeof(lv_32fc_t),
+                                                  volk_get_alignment());
+    if (!twiddles)
+        return NULL;
+
+    const double sign = inverse ? 1.0 : -1.0;
+    unsigned int h, j;
+    twiddles[0] = lv_cmake(1.0f, 0.0f); // unused, keeps the table num_points long
+    for (h = 1; h < num_points; h *= 2) {
+        for (j = 0; j < h; j++) {
+            const double angle = sign * M_PI * j / h;
+            twiddles[h + j] = lv_cmake((float)cos(angle), (float)sin(angle));
+        }
+    }
+    return twiddles;
+}
+
+const lv_32fc_t* volk_fft_get_twiddles(unsigned int num_points, bool inverse)
+{
+    if (num_points == 0 || (num_points & (num_points - 1)) != 0)
+        return NULL;
+
+    unsigned int log2_points = 0;
+    while ((1u << log2_points) < num_points)
+        log2_points++;
+
+    lv_32fc_t** slot = &volk_fft_twiddles[inverse][log2_points];
+    lv_32fc_t* twiddles = (lv_32fc_t*)VOLK_ATOMIC_LOAD_PTR(*slot);
+    if (twiddles)
+        return twiddles;
+
+    // a process started again maps the table an earlier one stored
+    const char* kind = inverse ? "ifft_twiddles" : "fft_twiddles";
+    const size_t bytes = (size_t)num_points * sizeof(lv_32fc_t);
+    const bool cached = num_points >= VOLK_FFT_CACHE_MIN_POINTS;
+    bool mapped = false;
+    if (cached) {
+        twiddles = (lv_32fc_t*)volk_plan_cache_map(kind, num_points, bytes);
+        mapped = twiddles != NULL;
+    }
+    if (!twiddles) {
+        twiddles = volk_fft_make_twiddles(num_points, inverse);
+        if (!twiddles)
+            return NULL;
+        if (cached)
+            volk_plan_cache_store(kind, num_points, twiddles, bytes);
+    }
+
+    // threads racing on the first use each get a table, one is kept
+    if (!VOLK_ATOMIC_CAS_PTR(*slot, NULL, twiddles)) {
+        if (mapped)
+            volk_plan_cache_unmap(twiddles, bytes);
+        else
+            volk_free(twiddles);
+        twiddles = (lv_32fc_t*)VOLK_ATOMIC_LOAD_PTR(*slot);
+    }
+    return twiddles;
+}
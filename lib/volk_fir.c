@@ -0,0 +1,643 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <volk/volk.h>
+#include <volk/volk_fir.h>
+
+/*
+ * The kernels read num_points + num_taps - 1 inputs for num_points
+ * outputs. A call's first num_taps - 1 outputs read the delay line
+ * followed by the first inputs, copied behind it; the others only read
+ * the input. Afterwards the delay line takes the last num_taps - 1 of
+ * the inputs seen so far. Both data types share this; item_size is the
+ * size of one sample.
+ */
+static unsigned int volk_fir_head(void* history,
+                                  const void* input,
+                                  unsigned int num_taps,
+                                  unsigned int num_points,
+                                  size_t item_size)
+{
+    const unsigned int delay = num_taps - 1;
+    const unsigned int head = num_points < delay ? num_points : delay;
+    memcpy((char*)history + delay * item_size, input, head * item_size);
+    return head;
+}
+
+static void volk_fir_keep(void* history,
+                          const void* input,
+                          unsigned int num_taps,
+                          unsigned int num_points,
+                          size_t item_size)
+{
+    const unsigned int delay = num_taps - 1;
+    if (num_points >= delay) {
+        memcpy(history, (const char*)input + (num_points - delay) * item_size,
+               delay * item_size);
+    } else {
+        memmove(history, (char*)history + num_points * item_size, delay * item_size);
+    }
+}
+
+static void* volk_fir_alloc_history(unsigned int num_taps, size_t item_size)
+{
+    // room for the delay line and as many new inputs, at least one item
+    const size_t bytes = (2 * (size_t)(num_taps - 1) + 1) * item_size;
+    void* history = volk_malloc(bytes, volk_get_alignment());
+    if (history)
+        memset(history, 0, bytes);
+    return history;
+}
+
+/*
+ * Splits a prototype filter into interpolation phases of per_phase taps.
+ */
+static float* volk_fir_alloc_phases(const float* taps,
+                                    unsigned int num_taps,
+                                    unsigned int interpolation,
+                                    unsigned int per_phase)
+{
+    const size_t phase_bytes = (size_t)per_phase * interpolation * sizeof(float);
+    float* phases = (float*)volk_malloc(phase_bytes, volk_get_alignment());
+    if (!phases)
+        return NULL;
+    // phase p takes taps p, p + interpolation, ..., zero padded and reversed
+    for (unsigned int p = 0; p < interpolation; p++) {
+        for (unsigned int k = 0; k < per_phase; k++) {
+            const unsigned int tap = p + (per_phase - 1 - k) * interpolation;
+            phases[p * per_phase + k] = tap < num_taps ? taps[tap] : 0.f;
+        }
+    }
+    return phases;
+}
+
+bool volk_fir_32f_init(volk_fir_32f_t* fir, const float* taps, unsigned int num_taps)
+{
+    if (num_taps == 0)
+        return false;
+    float* reversed = (float*)volk_malloc(num_taps * sizeof(float), volk_get_alignment());
+    float* history = (float*)volk_fir_alloc_history(num_taps, sizeof(float));
+    if (!reversed || !history) {
+        volk_free(reversed);
+        volk_free(history);
+        return false;
+    }
+    for (unsigned int k = 0; k < num_taps; k++)
+        reversed[k] = taps[num_taps - 1 - k];
+    fir->taps = reversed;
+    fir->history = history;
+    fir->num_taps = num_taps;
+    return true;
+}
+
+void volk_fir_32f_filter(volk_fir_32f_t* fir,
+                         float* output,
+                         const float* input,
+                         unsigned int num_points)
+{
+    const unsigned int num_taps = fir->num_taps;
+    const unsigned int head =
+        volk_fir_head(fir->history, input, num_taps, num_points, sizeof(float));
+    volk_32f_fir_32f(output, fir->history, fir->taps, num_taps, head);
+    if (num_points > head)
+        volk_32f_fir_32f(output + head, input, fir->taps, num_taps, num_points - head);
+    volk_fir_keep(fir->history, input, num_taps, num_points, sizeof(float));
+}
+
+void volk_fir_32f_reset(volk_fir_32f_t* fir)
+{
+    memset(fir->history, 0, (fir->num_taps - 1) * sizeof(float));
+}
+
+void volk_fir_32f_destroy(volk_fir_32f_t* fir)
+{
+    volk_free(fir->taps);
+    volk_free(fir->history);
+    fir->taps = NULL;
+    fir->history = NULL;
+}
+
+bool volk_fir_32fc_init(volk_fir_32fc_t* fir, const float* taps, unsigned int num_taps)
+{
+    if (num_taps == 0)
+        return false;
+    float* reversed = (float*)volk_malloc(num_taps * sizeof(float), volk_get_alignment());
+    lv_32fc_t* history = (lv_32fc_t*)volk_fir_alloc_history(num_taps, sizeof(lv_32fc_t));
+    if (!reversed || !history) {
+        volk_free(reversed);
+        volk_free(history);
+        return false;
+    }
+    for (unsigned int k = 0; k < num_taps; k++)
+        reversed[k] = taps[num_taps - 1 - k];
+    fir->taps = reversed;
+    fir->complex_taps = NULL;
+    fir->history = history;
+    fir->num_taps = num_taps;
+    return true;
+}
+
+bool volk_fir_32fc_init_complex(volk_fir_32fc_t* fir,
+                                const lv_32fc_t* taps,
+                                unsigned int num_taps)
+{
+    if (num_taps == 0)
+        return false;
+    lv_32fc_t* reversed =
+        (lv_32fc_t*)volk_malloc(num_taps * sizeof(lv_32fc_t), volk_get_alignment());
+    lv_32fc_t* history = (lv_32fc_t*)volk_fir_alloc_history(num_taps, sizeof(lv_32fc_t));
+    if (!reversed || !history) {
+        volk_free(reversed);
+        volk_free(history);
+        return false;
+    }
+    for (unsigned int k = 0; k < num_taps; k++)
+        reversed[k] = taps[num_taps - 1 - k];
+    fir->taps = NULL;
+    fir->complex_taps = reversed;
+    fir->history = history;
+    fir->num_taps = num_taps;
+    return true;
+}
+
+void volk_fir_32fc_filter(volk_fir_32fc_t* fir,
+                          lv_32fc_t* output,
+                          const lv_32fc_t* input,
+                          unsigned int num_points)
+{
+    const unsigned int num_taps = fir->num_taps;
+    const unsigned int head =
+        volk_fir_head(fir->history, input, num_taps, num_points, sizeof(lv_32fc_t));
+    if (fir->complex_taps) {
+        volk_32fc_x2_fir_32fc(output, fir->history, fir->complex_taps, num_taps, head);
+        if (num_points > head)
+            volk_32fc_x2_fir_32fc(
+                output + head, input, fir->complex_taps, num_taps, num_points - head);
+    } else {
+        volk_32fc_32f_fir_32fc(output, fir->history, fir->taps, num_taps, head);
+        if (num_points > head)
+            volk_32fc_32f_fir_32fc(
+                output + head, input, fir->taps, num_taps, num_points - head);
+    }
+    volk_fir_keep(fir->history, input, num_taps, num_points, sizeof(lv_32fc_t));
+}
+
+void volk_fir_32fc_reset(volk_fir_32fc_t* fir)
+{
+    memset(fir->history, 0, (fir->num_taps - 1) * sizeof(lv_32fc_t));
+}
+
+void volk_fir_32fc_destroy(volk_fir_32fc_t* fir)
+{
+    volk_free(fir->taps);
+    volk_free(fir->complex_taps);
+    volk_free(fir->history);
+    fir->taps = NULL;
+    fir->complex_taps = NULL;
+    fir->history = NULL;
+}
+
+bool volk_fir_decimator_32fc_init(volk_fir_decimator_32fc_t* fir,
+                                  const float* taps,
+                                  unsigned int num_taps,
+                                  unsigned int decimation)
+{
+    if (num_taps == 0 || decimation == 0)
+        return false;
+    float* reversed = (float*)volk_malloc(num_taps * sizeof(float), volk_get_alignment());
+    lv_32fc_t* history = (lv_32fc_t*)volk_fir_alloc_history(num_taps, sizeof(lv_32fc_t));
+    if (!reversed || !history) {
+        volk_free(reversed);
+        volk_free(history);
+        return false;
+    }
+    for (unsigned int k = 0; k < num_taps; k++)
+        reversed[k] = taps[num_taps - 1 - k];
+    fir->taps = reversed;
+    fir->history = history;
+    fir->num_taps = num_taps;
+    fir->decimation = decimation;
+    fir->offset = 0;
+    return true;
+}
+
+/*
+ * Window starts count from the start of the delay line, so the window
+ * starting at s ends with input s. Windows starting before head read the
+ * delay line, the others only read the input.
+ */
+unsigned int volk_fir_decimator_32fc_filter(volk_fir_decimator_32fc_t* fir,
+                                            lv_32fc_t* output,
+                                            const lv_32fc_t* input,
+                                            unsigned int num_points)
+{
+    const unsigned int num_taps = fir->num_taps;
+    const unsigned int decimation = fir->decimation;
+    const unsigned int offset = fir->offset;
+    const unsigned int head =
+        volk_fir_head(fir->history, input, num_taps, num_points, sizeof(lv_32fc_t));
+    const unsigned int num_outputs =
+        offset < num_points ? (num_points - 1 - offset) / decimation + 1 : 0;
+    const unsigned int num_head = offset < head ? (head - 1 - offset) / decimation + 1 : 0;
+
+    volk_32fc_32f_fir_decimate_32fc(
+        output, fir->history + offset, fir->taps, num_taps, decimation, num_head);
+    if (num_outputs > num_head) {
+        const unsigned int start = offset + num_head * decimation - (num_taps - 1);
+        volk_32fc_32f_fir_decimate_32fc(output + num_head,
+                                        input + start,
+                                        fir->taps,
+                                        num_taps,
+                                        decimation,
+                                        num_outputs - num_head);
+    }
+    fir->offset = offset + num_outputs * decimation - num_points;
+    volk_fir_keep(fir->history, input, num_taps, num_points, sizeof(lv_32fc_t));
+    return num_outputs;
+}
+
+void volk_fir_decimator_32fc_reset(volk_fir_decimator_32fc_t* fir)
+{
+    memset(fir->history, 0, (fir->num_taps - 1) * sizeof(lv_32fc_t));
+    fir->offset = 0;
+}
+
+void volk_fir_decimator_32fc_destroy(volk_fir_decimator_32fc_t* fir)
+{
+    volk_free(fir->taps);
+    volk_free(fir->history);
+    fir->taps = NULL;
+    fir->history = NULL;
+}
+
+bool volk_fir_interpolator_32fc_init(volk_fir_interpolator_32fc_t* fir,
+                                     const float* taps,
+                                     unsigned int num_taps,
+                                     unsigned int interpolation)
+{
+    if (num_taps == 0 || interpolation == 0)
+        return false;
+    const unsigned int per_phase = (num_taps + interpolation - 1) / interpolation;
+    float* phases = volk_fir_alloc_phases(taps, num_taps, interpolation, per_phase);
+    lv_32fc_t* history = (lv_32fc_t*)volk_fir_alloc_history(per_phase, sizeof(lv_32fc_t));
+    if (!phases || !history) {
+        volk_free(phases);
+        volk_free(history);
+        return false;
+    }
+    fir->taps = phases;
+    fir->history = history;
+    fir->taps_per_phase = per_phase;
+    fir->interpolation = interpolation;
+    return true;
+}
+
+void volk_fir_interpolator_32fc_filter(volk_fir_interpolator_32fc_t* fir,
+                                       lv_32fc_t* output,
+                                       const lv_32fc_t* input,
+                                       unsigned int num_points)
+{
+    const unsigned int num_taps = fir->taps_per_phase;
+    const unsigned int interpolation = fir->interpolation;
+    const unsigned int head =
+        volk_fir_head(fir->history, input, num_taps, num_points, sizeof(lv_32fc_t));
+    volk_32fc_32f_fir_interpolate_32fc(
+        output, fir->history, fir->taps, num_taps, interpolation, head);
+    if (num_points > head)
+        volk_32fc_32f_fir_interpolate_32fc(output + head * interpolation,
+                                           input,
+                                           fir->taps,
+                                           num_taps,
+                                           interpolation,
+                                           num_points - head);
+    volk_fir_keep(fir->history, input, num_taps, num_points, sizeof(lv_32fc_t));
+}
+
+void volk_fir_interpolator_32fc_reset(volk_fir_interpolator_32fc_t* fir)
+{
+    memset(fir->history, 0, (fir->taps_per_phase - 1) * sizeof(lv_32fc_t));
+}
+
+void volk_fir_interpolator_32fc_destroy(volk_fir_interpolator_32fc_t* fir)
+{
+    volk_free(fir->taps);
+    volk_free(fir->history);
+    fir->taps = NULL;
+    fir->history = NULL;
+}
+
+bool volk_fir_resampler_32fc_init(volk_fir_resampler_32fc_t* fir,
+                                  const float* taps,
+                                  unsigned int num_taps,
+                                  unsigned int interpolation,
+                                  unsigned int decimation)
+{
+    if (num_taps == 0 || interpolation == 0 || decimation == 0)
+        return false;
+    const unsigned int per_phase = (num_taps + interpolation - 1) / interpolation;
+    float* phases = volk_fir_alloc_phases(taps, num_taps, interpolation, per_phase);
+    lv_32fc_t* history = (lv_32fc_t*)volk_fir_alloc_history(per_phase, sizeof(lv_32fc_t));
+    if (!phases || !history) {
+        volk_free(phases);
+        volk_free(history);
+        return false;
+    }
+    fir->taps = phases;
+    fir->history = history;
+    fir->taps_per_phase = per_phase;
+    fir->interpolation = interpolation;
+    fir->decimation = decimation;
+    fir->offset = 0;
+    return true;
+}
+
+/*
+ * As for the decimator, with window starts in phases: the window starting
+ * at s phases ends with input s / interpolation.
+ */
+unsigned int volk_fir_resampler_32fc_filter(volk_fir_resampler_32fc_t* fir,
+                                            lv_32fc_t* output,
+                                            const lv_32fc_t* input,
+                                            unsigned int num_points)
+{
+    const unsigned int num_taps = fir->taps_per_phase;
+    const unsigned int interpolation = fir->interpolation;
+    const unsigned int decimation = fir->decimation;
+    const uint64_t offset = fir->offset;
+    const unsigned int head =
+        volk_fir_head(fir->history, input, num_taps, num_points, sizeof(lv_32fc_t));
+    const uint64_t end = (uint64_t)num_points * interpolation;
+    const uint64_t head_end = (uint64_t)head * interpolation;
+    const unsigned int num_outputs =
+        offset < end ? (unsigned int)((end - 1 - offset) / decimation + 1) : 0;
+    const unsigned int num_head =
+        offset < head_end ? (unsigned int)((head_end - 1 - offset) / decimation + 1) : 0;
+
+    volk_32fc_32f_fir_resample_32fc(output,
+                                    fir->history,
+                                    fir->taps,
+                                    num_taps,
+                                    interpolation,
+                                    decimation,
+                                    fir->offset,
+                                    num_head);
+    if (num_outputs > num_head) {
+        const uint64_t next = offset + (uint64_t)num_head * decimation;
+        const unsigned int start = (unsigned int)(next / interpolation);
+        volk_32fc_32f_fir_resample_32fc(output + num_head,
+                                        input + start - (num_taps - 1),
+                                        fir->taps,
+                                        num_taps,
+                                        interpolation,
+                                        decimation,
+                                        (unsigned int)(next % interpolation),
+                                        num_outputs - num_head);
+    }
+    fir->offset = (unsigned int)(offset + (uint64_t)num_outputs * decimation - end);
+    volk_fir_keep(fir->history, input, num_taps, num_points, sizeof(lv_32fc_t));
+    return num_outputs;
+}
+
+void volk_fir_resampler_32fc_reset(volk_fir_resampler_32fc_t* fir)
+{
+    memset(fir->history, 0, (fir->taps_per_phase - 1) * sizeof(lv_32fc_t));
+    fir->offset = 0;
+}
+
+void volk_fir_resampler_32fc_destroy(volk_fir_resampler_32fc_t* fir)
+{
+    volk_free(fir->taps);
+    volk_free(fir->history);
+    fir->taps = NULL;
+    fir->history = NULL;
+}
+
+/* The cubic interpolator reads a window of four inputs */
+#define VOLK_FARROW_TAPS 4
+
+bool volk_farrow_resampler_32fc_init(volk_farrow_resampler_32fc_t* fir, double step)
+{
+    if (!(step > 0.))
+        return false;
+    lv_32fc_t* history =
+        (lv_32fc_t*)volk_fir_alloc_history(VOLK_FARROW_TAPS, sizeof(lv_32fc_t));
+    if (!history)
+        return false;
+    fir->history = history;
+    fir->step = step;
+    fir->offset = 0.;
+    return true;
+}
+
+/*
+ * The number of outputs from offset on whose windows start before limit,
+ * with the positions rounded as the kernel computes them.
+ */
+static unsigned int volk_farrow_count(double offset, double step, unsigned int limit)
+{
+    unsigned int count = offset < limit ? (unsigned int)ceil((limit - offset) / step) : 0;
+    while (count > 0 && offset + (count - 1) * step >= limit)
+        count--;
+    while (offset + count * step < limit)
+        count++;
+    return count;
+}
+
+/*
+ * The windows starting before head read the delay line. The others are
+ * reached from the last whole input before them, so the kernel positions
+ * stay small and the last window ends within the input.
+ */
+unsigned int volk_farrow_resampler_32fc_filter(volk_farrow_resampler_32fc_t* fir,
+                                               lv_32fc_t* output,
+                                               const lv_32fc_t* input,
+                                               unsigned int num_points)
+{
+    const double step = fir->step;
+    const unsigned int head = volk_fir_head(
+        fir->history, input, VOLK_FARROW_TAPS, num_points, sizeof(lv_32fc_t));
+    double offset = fir->offset;
+    unsigned int num_outputs = volk_farrow_count(offset, step, head);
+
+    volk_32fc_s64f_x2_farrow_resample_32fc(
+        output, fir->history, offset, step, num_outputs);
+    offset += num_outputs * step;
+    if (offset < num_points) {
+        const unsigned int start = (unsigned int)offset;
+        const unsigned int num_rest =
+            volk_farrow_count(offset - start, step, num_points - start);
+        volk_32fc_s64f_x2_farrow_resample_32fc(output + num_outputs,
+                                               input + start - (VOLK_FARROW_TAPS - 1),
+                                               offset - start,
+                                               step,
+                                               num_rest);
+        offset = start + (offset - start + num_rest * step);
+        num_outputs += num_rest;
+    }
+    fir->offset = offset - num_points;
+    volk_fir_keep(fir->history, input, VOLK_FARROW_TAPS, num_points, sizeof(lv_32fc_t));
+    return num_outputs;
+}
+
+void volk_farrow_resampler_32fc_reset(volk_farrow_resampler_32fc_t* fir)
+{
+    memset(fir->history, 0, (VOLK_FARROW_TAPS - 1) * sizeof(lv_32fc_t));
+    fir->offset = 0.;
+}
+
+void volk_farrow_resampler_32fc_destroy(volk_farrow_resampler_32fc_t* fir)
+{
+    volk_free(fir->history);
+    fir->history = NULL;
+}
+
+/*
+ * Inputs per block of the cascade: the first stage's outputs for a block
+ * take 4 kB, so a block and its trip through the stages stay in L1.
+ */
+#define VOLK_HALFBAND_BLOCK 1024
+
+bool volk_halfband_cascade_32fc_init(volk_halfband_cascade_32fc_t* cascade,
+                                     const float* const* taps,
+                                     const unsigned int* num_taps,
+                                     unsigned int num_stages)
+{
+    if (num_stages == 0)
+        return false;
+    for (unsigned int s = 0; s < num_stages; s++) {
+        if (num_taps[s] == 0)
+            return false;
+    }
+    volk_halfband_cascade_32fc_t built;
+    built.stages = (volk_halfband_stage_32fc_t*)calloc(
+        num_stages, sizeof(volk_halfband_stage_32fc_t));
+    built.scratch = (lv_32fc_t*)volk_malloc(
+        2 * (VOLK_HALFBAND_BLOCK / 2 + 1) * sizeof(lv_32fc_t), volk_get_alignment());
+    built.num_stages = num_stages;
+    bool ok = built.stages && built.scratch;
+    for (unsigned int s = 0; ok && s < num_stages; s++) {
+        volk_halfband_stage_32fc_t* stage = &built.stages[s];
+        stage->taps = (float*)volk_malloc((num_taps[s] + 1) * sizeof(float),
+                                          volk_get_alignment());
+        stage->history =
+            (lv_32fc_t*)volk_fir_alloc_history(4 * num_taps[s] - 1, sizeof(lv_32fc_t));
+        stage->num_taps = num_taps[s];
+        stage->offset = 0;
+        ok = stage->taps && stage->history;
+        if (stage->taps)
+            memcpy(stage->taps, taps[s], (num_taps[s] + 1) * sizeof(float));
+    }
+    if (!ok) {
+        volk_halfband_cascade_32fc_destroy(&built);
+        return false;
+    }
+    *cascade = built;
+    return true;
+}
+
+/*
+ * As volk_fir_decimator_32fc_filter() with a decimation of 2, on a
+ * filter of 4 * num_taps - 1 taps.
+ */
+static unsigned int volk_halfband_stage_filter(volk_halfband_stage_32fc_t* stage,
+                                               lv_32fc_t* output,
+                                               const lv_32fc_t* input,
+                                               unsigned int num_points)
+{
+    const unsigned int num_taps = stage->num_taps;
+    const unsigned int length = 4 * num_taps - 1;
+    const unsigned int offset = stage->offset;
+    const unsigned int head =
+        volk_fir_head(stage->history, input, length, num_points, sizeof(lv_32fc_t));
+    const unsigned int num_outputs =
+        offset < num_points ? (num_points - 1 - offset) / 2 + 1 : 0;
+    const unsigned int num_head = offset < head ? (head - 1 - offset) / 2 + 1 : 0;
+
+    volk_32fc_32f_halfband_decimate2_32fc(
+        output, stage->history + offset, stage->taps, num_taps, num_head);
+    if (num_outputs > num_head) {
+        const unsigned int start = offset + num_head * 2 - (length - 1);
+        volk_32fc_32f_halfband_decimate2_32fc(output + num_head,
+                                              input + start,
+                                              stage->taps,
+                                              num_taps,
+                                              num_outputs - num_head);
+    }
+    stage->offset = offset + num_outputs * 2 - num_points;
+    volk_fir_keep(stage->history, input, length, num_points, sizeof(lv_32fc_t));
+    return num_outputs;
+}
+
+/*
+ * The stages between the first and the last write into the two halves of
+ * the scratch buffer in turn, each reading what the one before wrote.
+ */
+unsigned int volk_halfband_cascade_32fc_filter(volk_halfband_cascade_32fc_t* cascade,
+                                               lv_32fc_t* output,
+                                               const lv_32fc_t* input,
+                                               unsigned int num_points)
+{
+    const unsigned int last = cascade->num_stages - 1;
+    unsigned int num_outputs = 0;
+    for (unsigned int done = 0; done < num_points; done += VOLK_HALFBAND_BLOCK) {
+        const unsigned int block = num_points - done < VOLK_HALFBAND_BLOCK
+                                       ? num_points - done
+                                       : VOLK_HALFBAND_BLOCK;
+        const lv_32fc_t* in = input + done;
+        unsigned int count = block;
+        for (unsigned int s = 0; s < last; s++) {
+            lv_32fc_t* out = cascade->scratch + (s & 1) * (VOLK_HALFBAND_BLOCK / 2 + 1);
+            count = volk_halfband_stage_filter(&cascade->stages[s], out, in, count);
+            in = out;
+        }
+        num_outputs += volk_halfband_stage_filter(
+            &cascade->stages[last], output + num_outputs, in, count);
+    }
+    return num_outputs;
+}
+
+void volk_halfband_cascade_32fc_reset(volk_halfband_cascade_32fc_t* cascade)
+{
+    for (unsigned int s = 0; s < cascade->num_stages; s++) {
+        volk_halfband_stage_32fc_t* stage = &cascade->stages[s];
+        memset(stage->history, 0, (4 * stage->num_taps - 2) * sizeof(lv_32fc_t));
+        stage->offset = 0;
+    }
+}
+
+void volk_halfband_cascade_32fc_destroy(volk_halfband_cascade_32fc_t* cascade)
+{
+    if (cascade->stages) {
+        for (unsigned int s = 0; s < cascade->num_stages; s++) {
+            volk_free(cascade->stages[s].taps);
+            volk_free(cascade->stages[s].history);
+        }
+    }
+    free(cascade->stages);
+    volk_free(cascade->scratch);
+    cascade->stages = NULL;
+    cascade->scratch = NULL;
+    cascade->num_stages = 0;
+}
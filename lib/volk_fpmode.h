@@ -0,0 +1,99 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_FPMODE_H
+#define INCLUDED_VOLK_FPMODE_H
+
+#include <stdbool.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define VOLK_FPMODE_MXCSR
+#elif defined(__aarch64__) && defined(__GNUC__)
+#define VOLK_FPMODE_FPCR
+#elif defined(__arm__) && defined(__ARM_FP) && defined(__GNUC__)
+#define VOLK_FPMODE_FPSCR
+#endif
+
+#if defined(_MSC_VER)
+#define VOLK_THREAD_LOCAL __declspec(thread)
+#else
+#define VOLK_THREAD_LOCAL __thread
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////////////
+// Denormal control around kernel calls, see volk_set_flush_denormals().
+// The floating point control register is per thread, so the mode a
+// thread asked for is kept in a thread local flag. The dispatchers read
+// it, and when it is set they switch the register to flush denormal
+// results and inputs to zero for the call and restore it afterwards.
+// On cpus without such a mode the switch does nothing.
+////////////////////////////////////////////////////////////////////////
+extern VOLK_THREAD_LOCAL bool volk_flush_denormals_thread;
+
+//! the control register as it was before volk_fpmode_flush_denormals()
+typedef unsigned long volk_fpmode_t;
+
+static inline volk_fpmode_t volk_fpmode_flush_denormals(void)
+{
+#if defined(VOLK_FPMODE_MXCSR)
+    // FTZ flushes denormal results, DAZ treats denormal inputs as zero
+    const unsigned int mode = _mm_getcsr();
+    _mm_setcsr(mode | 0x8040);
+    return mode;
+#elif defined(VOLK_FPMODE_FPCR)
+    // FZ flushes both, for scalar and Advanced SIMD instructions
+    unsigned long mode;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(mode));
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(mode | (1ul << 24)));
+    return mode;
+#elif defined(VOLK_FPMODE_FPSCR)
+    // NEON always flushes on armv7, FZ makes VFP do the same
+    unsigned int mode;
+    __asm__ __volatile__("vmrs %0, fpscr" : "=r"(mode));
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"(mode | (1u << 24)));
+    return mode;
+#else
+    return 0;
+#endif
+}
+
+static inline void volk_fpmode_restore(volk_fpmode_t mode)
+{
+#if defined(VOLK_FPMODE_MXCSR)
+    _mm_setcsr((unsigned int)mode);
+#elif defined(VOLK_FPMODE_FPCR)
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(mode));
+#elif defined(VOLK_FPMODE_FPSCR)
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"((unsigned int)mode));
+#else
+    (void)mode;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*INCLUDED_VOLK_FPMODE_H*/
@@ -0,0 +1,301 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "volk_fpmode.h"
+#include "volk_once.h"
+#include "volk_parallel.h"
+#include <volk/volk.h>
+#include <volk/volk_graph.h>
+
+typedef struct volk_graph_node {
+    volk_graph_node_fn fn;
+    void* ctx;
+} volk_graph_node_t;
+
+/*
+ * A thread's share of the tiles, the next tile in the upper and the end in
+ * the lower 32 bits, so that the owner taking the next tile and a thief
+ * taking the upper half are each a single compare and swap. Each share has
+ * a cache line of its own.
+ */
+typedef struct volk_graph_share {
+    uint64_t tiles;
+    char pad[64 - sizeof(uint64_t)];
+} volk_graph_share_t;
+
+#define VOLK_GRAPH_SHARE(next, end) (((uint64_t)(next) << 32) | (uint32_t)(end))
+#define VOLK_GRAPH_NEXT(tiles) ((uint32_t)((tiles) >> 32))
+#define VOLK_GRAPH_END(tiles) ((uint32_t)(tiles))
+
+struct volk_graph {
+    volk_graph_node_t* nodes;
+    size_t n_nodes;
+    size_t* buffer_bytes; // bytes per point of each buffer
+    size_t n_buffers;
+    size_t io_bytes;      // bytes per point the nodes move in the caller's vectors
+    size_t tile_len;      // set by the caller, 0 = from the L2 size
+    // kept between runs, for scratch_threads threads of scratch_tile_len points
+    volk_graph_share_t* shares;
+    void** buffers;       // n_buffers pointers per thread
+    char* scratch;
+    size_t scratch_threads;
+    size_t scratch_tile_len;
+};
+
+typedef struct volk_graph_run {
+    const volk_graph_t* graph;
+    size_t num_points;
+    size_t tile_len;
+    size_t n_threads;
+    bool flush_denormals; // the caller's volk_set_flush_denormals, for the pool threads
+} volk_graph_run_t;
+
+volk_graph_t* volk_graph_create(void)
+{
+    return (volk_graph_t*)calloc(1, sizeof(volk_graph_t));
+}
+
+static void volk_graph_free_scratch(volk_graph_t* graph)
+{
+    volk_free(graph->shares);
+    volk_free(graph->scratch);
+    free(graph->buffers);
+    graph->shares = NULL;
+    graph->scratch = NULL;
+    graph->buffers = NULL;
+    graph->scratch_threads = 0;
+    graph->scratch_tile_len = 0;
+}
+
+void volk_graph_destroy(volk_graph_t* graph)
+{
+    if (!graph)
+        return;
+    volk_graph_free_scratch(graph);
+    free(graph->nodes);
+    free(graph->buffer_bytes);
+    free(graph);
+}
+
+int volk_graph_add_buffer(volk_graph_t* graph, size_t bytes_per_point)
+{
+    size_t* buffer_bytes =
+        (size_t*)realloc(graph->buffer_bytes, (graph->n_buffers + 1) * sizeof(size_t));
+    if (!buffer_bytes)
+        return -1;
+    graph->buffer_bytes = buffer_bytes;
+    buffer_bytes[graph->n_buffers] = bytes_per_point;
+    // the buffer pointers are laid out per buffer count
+    volk_graph_free_scratch(graph);
+    return (int)graph->n_buffers++;
+}
+
+int volk_graph_add_node(volk_graph_t* graph,
+                        volk_graph_node_fn fn,
+                        void* ctx,
+                        size_t io_bytes_per_point)
+{
+    volk_graph_node_t* nodes = (volk_graph_node_t*)realloc(
+        graph->nodes, (graph->n_nodes + 1) * sizeof(volk_graph_node_t));
+    if (!nodes)
+        return -1;
+    graph->nodes = nodes;
+    nodes[graph->n_nodes].fn = fn;
+    nodes[graph->n_nodes].ctx = ctx;
+    graph->io_bytes += io_bytes_per_point;
+    return (int)graph->n_nodes++;
+}
+
+// a multiple of the alignment in points keeps tiles aligned for any point size
+static size_t volk_graph_round_tile(size_t tile_len)
+{
+    const size_t align = volk_get_alignment();
+    return tile_len < align ? align : (tile_len + align - 1) / align * align;
+}
+
+void volk_graph_set_tile_len(volk_graph_t* graph, size_t tile_len)
+{
+    graph->tile_len = tile_len ? volk_graph_round_tile(tile_len) : 0;
+}
+
+size_t volk_graph_get_tile_len(const volk_graph_t* graph)
+{
+    const size_t align = volk_get_alignment();
+    size_t bytes = graph->io_bytes;
+    size_t i;
+    if (graph->tile_len)
+        return graph->tile_len;
+    for (i = 0; i < graph->n_buffers; i++)
+        bytes += graph->buffer_bytes[i];
+    if (!bytes)
+        bytes = 1;
+    // half the L2 for the tile, the rest for the code, the plans and the stack
+    return volk_graph_round_tile(volk_get_l2_cache_size() / 2 / bytes / align * align);
+}
+
+// bytes of a thread's tile of one buffer, whole cache lines so threads never share one
+static size_t volk_graph_buffer_size(size_t bytes_per_point, size_t tile_len)
+{
+    const size_t line = volk_get_cacheline_size() > volk_get_alignment()
+                            ? volk_get_cacheline_size()
+                            : volk_get_alignment();
+    const size_t bytes = bytes_per_point * tile_len;
+    return bytes ? (bytes + line - 1) / line * line : line;
+}
+
+static bool
+volk_graph_alloc_scratch(volk_graph_t* graph, size_t n_threads, size_t tile_len)
+{
+    const size_t line = volk_get_cacheline_size() > volk_get_alignment()
+                            ? volk_get_cacheline_size()
+                            : volk_get_alignment();
+    size_t stride = 0;
+    size_t thread, i;
+    char* next;
+
+    if (n_threads <= graph->scratch_threads && tile_len == graph->scratch_tile_len)
+        return true;
+    volk_graph_free_scratch(graph);
+    for (i = 0; i < graph->n_buffers; i++)
+        stride += volk_graph_buffer_size(graph->buffer_bytes[i], tile_len);
+
+    graph->shares = (volk_graph_share_t*)volk_malloc(
+        n_threads * sizeof(volk_graph_share_t), line > 64 ? line : 64);
+    graph->buffers = (void**)malloc((n_threads * graph->n_buffers + 1) * sizeof(void*));
+    graph->scratch = stride ? (char*)volk_malloc(n_threads * stride, line) : NULL;
+    if (!graph->shares || !graph->buffers || (stride && !graph->scratch)) {
+        volk_graph_free_scratch(graph);
+        return false;
+    }
+    next = graph->scratch;
+    for (thread = 0; thread < n_threads; thread++) {
+        for (i = 0; i < graph->n_buffers; i++) {
+            graph->buffers[thread * graph->n_buffers + i] = next;
+            next += volk_graph_buffer_size(graph->buffer_bytes[i], tile_len);
+        }
+    }
+    graph->scratch_threads = n_threads;
+    graph->scratch_tile_len = tile_len;
+    return true;
+}
+
+// take the next tile of the thread's share, or steal half of another's
+static bool
+volk_graph_next_tile(const volk_graph_run_t* run, size_t thread, uint32_t* tile)
+{
+    volk_graph_share_t* shares = run->graph->shares;
+    uint64_t tiles, stolen;
+    uint32_t next, end, take;
+    size_t i;
+
+    do {
+        tiles = VOLK_ATOMIC_LOAD_64(&shares[thread].tiles);
+        next = VOLK_GRAPH_NEXT(tiles);
+        end = VOLK_GRAPH_END(tiles);
+        if (next >= end)
+            break;
+        if (VOLK_ATOMIC_CAS_64(
+                &shares[thread].tiles, tiles, VOLK_GRAPH_SHARE(next + 1, end))) {
+            *tile = next;
+            return true;
+        }
+    } while (true);
+
+    for (i = 1; i < run->n_threads; i++) {
+        volk_graph_share_t* victim = &shares[(thread + i) % run->n_threads];
+        do {
+            stolen = VOLK_ATOMIC_LOAD_64(&victim->tiles);
+            next = VOLK_GRAPH_NEXT(stolen);
+            end = VOLK_GRAPH_END(stolen);
+            if (next >= end)
+                break;
+            take = (end - next + 1) / 2;
+        } while (!VOLK_ATOMIC_CAS_64(
+            &victim->tiles, stolen, VOLK_GRAPH_SHARE(next, end - take)));
+        if (next >= end)
+            continue;
+        // the thread's own share is empty, so no thief changes it meanwhile
+        tiles = VOLK_ATOMIC_LOAD_64(&shares[thread].tiles);
+        VOLK_ATOMIC_CAS_64(
+            &shares[thread].tiles, tiles, VOLK_GRAPH_SHARE(end - take + 1, end));
+        *tile = end - take;
+        return true;
+    }
+    return false;
+}
+
+// a chunk of volk_parallel_run is one thread's loop over the tiles
+static void volk_graph_thread(void* ctx, size_t thread, size_t start, size_t count)
+{
+    const volk_graph_run_t* run = (const volk_graph_run_t*)ctx;
+    const volk_graph_t* graph = run->graph;
+    void* const* buffers = graph->buffers + thread * graph->n_buffers;
+    const bool flush = volk_flush_denormals_thread;
+    uint32_t tile;
+    size_t i;
+    (void)start;
+    (void)count;
+
+    volk_flush_denormals_thread = run->flush_denormals;
+    while (volk_graph_next_tile(run, thread, &tile)) {
+        const size_t first = (size_t)tile * run->tile_len;
+        const size_t points = run->num_points - first < run->tile_len
+                                  ? run->num_points - first
+                                  : run->tile_len;
+        for (i = 0; i < graph->n_nodes; i++)
+            graph->nodes[i].fn(graph->nodes[i].ctx, buffers, first, points);
+    }
+    volk_flush_denormals_thread = flush;
+}
+
+int volk_graph_run(volk_graph_t* graph, size_t num_points)
+{
+    volk_graph_run_t run;
+    size_t n_tiles, thread;
+
+    if (!num_points || !graph->n_nodes)
+        return 0;
+    run.graph = graph;
+    run.num_points = num_points;
+    run.tile_len = volk_graph_get_tile_len(graph);
+    // the shares count tiles in 32 bits
+    if ((num_points - 1) / run.tile_len >= UINT32_MAX)
+        run.tile_len = volk_graph_round_tile(num_points / (UINT32_MAX - 1) + 1);
+    n_tiles = (num_points + run.tile_len - 1) / run.tile_len;
+    run.n_threads = volk_get_num_threads();
+    if (run.n_threads > n_tiles)
+        run.n_threads = n_tiles;
+    run.flush_denormals = volk_flush_denormals_thread;
+    if (!volk_graph_alloc_scratch(graph, run.n_threads, run.tile_len))
+        return -1;
+
+    for (thread = 0; thread < run.n_threads; thread++) {
+        graph->shares[thread].tiles =
+            VOLK_GRAPH_SHARE(n_tiles * thread / run.n_threads,
+                             n_tiles * (thread + 1) / run.n_threads);
+    }
+    volk_parallel_run(run.n_threads, &volk_graph_thread, &run);
+    return 0;
+}
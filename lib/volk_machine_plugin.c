@@ -0,0 +1,156 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(HAVE_DLFCN_H)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE // dladdr
+#endif
+#include <dlfcn.h>
+#endif
+
+#include "volk_machine_plugin.h"
+
+#if defined(_WIN32)
+#define VOLK_PATH_SEP '\\'
+#else
+#define VOLK_PATH_SEP '/'
+#endif
+
+#define VOLK_PLUGIN_PATH_MAX 4096
+
+// the directory of the modules next to the library itself, so that both the
+// build tree and a relocated install find theirs
+static int volk_plugin_dir_of_library(char* dir, size_t size)
+{
+#if defined(_WIN32)
+    HMODULE self = NULL;
+    if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+                                GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                            (LPCSTR)&volk_load_machine_plugin,
+                            &self))
+        return 0;
+    DWORD len = GetModuleFileNameA(self, dir, (DWORD)size);
+    if (len == 0 || len >= size)
+        return 0;
+#elif defined(HAVE_DLFCN_H)
+    Dl_info info;
+    if (!dladdr((void*)&volk_load_machine_plugin, &info) || !info.dli_fname ||
+        strlen(info.dli_fname) >= size)
+        return 0;
+    strcpy(dir, info.dli_fname);
+#else
+    return 0;
+#endif
+    char* sep = strrchr(dir, VOLK_PATH_SEP);
+    if (!sep)
+        return 0;
+    sep[1] = '\0';
+    if (strlen(dir) + strlen("volk") >= size)
+        return 0;
+    strcat(dir, "volk");
+    return 1;
+}
+
+static void* volk_plugin_open(const char* path)
+{
+#if defined(_WIN32)
+    return (void*)LoadLibraryA(path);
+#elif defined(HAVE_DLFCN_H)
+    return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+#else
+    (void)path;
+    return NULL;
+#endif
+}
+
+static void* volk_plugin_symbol(void* module, const char* symbol)
+{
+#if defined(_WIN32)
+    return (void*)GetProcAddress((HMODULE)module, symbol);
+#elif defined(HAVE_DLFCN_H)
+    return dlsym(module, symbol);
+#else
+    (void)module;
+    (void)symbol;
+    return NULL;
+#endif
+}
+
+static void volk_plugin_close(void* module)
+{
+#if defined(_WIN32)
+    FreeLibrary((HMODULE)module);
+#elif defined(HAVE_DLFCN_H)
+    dlclose(module);
+#else
+    (void)module;
+#endif
+}
+
+static struct volk_machine* volk_plugin_load_from(const char* dir, const char* name)
+{
+    char path[VOLK_PLUGIN_PATH_MAX];
+    char symbol[128];
+    int len = snprintf(path,
+                       sizeof(path),
+                       "%s%c%svolk_machine_%s%s",
+                       dir,
+                       VOLK_PATH_SEP,
+                       VOLK_PLUGIN_PREFIX,
+                       name,
+                       VOLK_PLUGIN_SUFFIX);
+    if (len < 0 || (size_t)len >= sizeof(path))
+        return NULL;
+    len = snprintf(symbol, sizeof(symbol), "volk_machine_%s", name);
+    if (len < 0 || (size_t)len >= sizeof(symbol))
+        return NULL;
+
+    void* module = volk_plugin_open(path);
+    if (!module)
+        return NULL;
+    // the module stays loaded for the life of the process
+    struct volk_machine* machine = (struct volk_machine*)volk_plugin_symbol(module, symbol);
+    if (!machine)
+        volk_plugin_close(module);
+    return machine;
+}
+
+struct volk_machine* volk_load_machine_plugin(const char* name)
+{
+    char dir[VOLK_PLUGIN_PATH_MAX];
+    const char* env = getenv("VOLK_PLUGIN_PATH");
+    if (env && env[0])
+        return volk_plugin_load_from(env, name);
+
+    struct volk_machine* machine = NULL;
+    if (volk_plugin_dir_of_library(dir, sizeof(dir)))
+        machine = volk_plugin_load_from(dir, name);
+    if (!machine)
+        machine = volk_plugin_load_from(VOLK_PLUGIN_DIR, name);
+    return machine;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef INCLUDED_VOLK_MACHINE_PLUGIN_H
+#define INCLUDED_VOLK_MACHINE_PLUGIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct volk_machine;
+
+/*!
+ * Load the machine of the given name from its module,
+ * <dir>/volk_machine_<name> with the platform's module prefix and suffix.
+ * dir is VOLK_PLUGIN_PATH if set, else the volk directory next to the
+ * library, else the one of the install prefix.
+ * \return the machine, or NULL when the module is missing or unusable
+ */
+struct volk_machine* volk_load_machine_plugin(const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*INCLUDED_VOLK_MACHINE_PLUGIN_H*/
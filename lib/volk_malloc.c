@@ -20,10 +20,32 @@
  * Boston, MA 02110-1301, USA.
  */
 
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+#if defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#if defined(HAVE_SYS_MMAN_H)
+#include <fcntl.h>
+#endif
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include "volk_once.h"
+#include <volk/volk.h>
 #include <volk/volk_malloc.h>
 
 /*
@@ -48,7 +70,7 @@
  */
 
 
-void* volk_malloc(size_t size, size_t alignment)
+static void* volk_aligned_alloc(size_t size, size_t alignment)
 {
 #if HAVE_POSIX_MEMALIGN
     // quoting posix_memalign() man page:
@@ -79,7 +101,7 @@ void* volk_malloc(size_t size, size_t alignment)
     return ptr;
 }
 
-void volk_free(void* ptr)
+static void volk_aligned_free(void* ptr)
 {
 #if defined(_MSC_VER)
     _aligned_free(ptr);
@@ -87,3 +109,796 @@ void volk_free(void* ptr)
     free(ptr);
 #endif
 }
+
+#ifdef HAVE_PTHREAD_H
+
+////////////////////////////////////////////////////////////////////////
+// Pooled mode, enabled by the VOLK_MALLOC_POOL environment variable.
+// Blocks come in power of two size classes from 64 B to 1 MiB and are
+// aligned to VOLK_POOL_ALIGNMENT. A header in front of every block
+// records its class, so volk_free knows where to return it. Freed blocks
+// go to a small cache of the freeing thread, overflow to global lists
+// under a lock and beyond those back to the system. Larger or more
+// strictly aligned requests bypass the classes but carry the header too.
+// The mode is fixed by the first volk_malloc or volk_free call, so every
+// pointer volk_free sees has the layout it expects.
+////////////////////////////////////////////////////////////////////////
+#define VOLK_POOL_ALIGNMENT 64
+#define VOLK_POOL_MIN_SHIFT 6
+#define VOLK_POOL_CLASSES 15
+#define VOLK_POOL_LARGE VOLK_POOL_CLASSES
+#define VOLK_POOL_THREAD_BYTES (1 << 20)  // per class and thread
+#define VOLK_POOL_GLOBAL_BYTES (16 << 20) // per class
+
+typedef struct volk_pool_header {
+    size_t size_class;
+    void* base;
+} volk_pool_header_t;
+
+typedef struct volk_pool_block {
+    struct volk_pool_block* next;
+} volk_pool_block_t;
+
+typedef struct volk_thread_cache {
+    volk_pool_block_t* blocks[VOLK_POOL_CLASSES];
+    size_t n_blocks[VOLK_POOL_CLASSES];
+} volk_thread_cache_t;
+
+static struct {
+    pthread_mutex_t lock; // protects the global lists
+    volk_pool_block_t* blocks[VOLK_POOL_CLASSES];
+    size_t n_blocks[VOLK_POOL_CLASSES];
+    pthread_key_t thread_cache;
+    bool enabled;
+    long long allocations, thread_hits, global_hits, system_allocs;
+    long long frees, system_frees, cached_bytes;
+} volk_pool = { PTHREAD_MUTEX_INITIALIZER };
+
+static volk_once_t volk_pool_once = VOLK_ONCE_INIT;
+
+static size_t volk_pool_class_size(size_t size_class)
+{
+    return (size_t)1 << (size_class + VOLK_POOL_MIN_SHIFT);
+}
+
+static size_t volk_pool_class_blocks(size_t size_class, size_t bytes)
+{
+    const size_t blocks = bytes / volk_pool_class_size(size_class);
+    return blocks > 2 ? blocks : 2;
+}
+
+static volk_pool_header_t* volk_pool_header(void* ptr)
+{
+    return (volk_pool_header_t*)((char*)ptr - sizeof(volk_pool_header_t));
+}
+
+static void volk_pool_system_free(void* ptr)
+{
+    VOLK_ATOMIC_ADD_RELAXED(&volk_pool.system_frees, 1);
+    volk_aligned_free(volk_pool_header(ptr)->base);
+}
+
+// hand a block to the global lists, or back to the system if they are full
+static void volk_pool_push_global(void* ptr, size_t size_class)
+{
+    pthread_mutex_lock(&volk_pool.lock);
+    if (volk_pool.n_blocks[size_class] <
+        volk_pool_class_blocks(size_class, VOLK_POOL_GLOBAL_BYTES)) {
+        volk_pool_block_t* block = (volk_pool_block_t*)ptr;
+        block->next = volk_pool.blocks[size_class];
+        volk_pool.blocks[size_class] = block;
+        volk_pool.n_blocks[size_class]++;
+        ptr = NULL;
+    }
+    pthread_mutex_unlock(&volk_pool.lock);
+    if (ptr) {
+        VOLK_ATOMIC_ADD_RELAXED(&volk_pool.cached_bytes,
+                                -(long long)volk_pool_class_size(size_class));
+        volk_pool_system_free(ptr);
+    }
+}
+
+static void volk_pool_flush_thread_cache(void* arg)
+{
+    volk_thread_cache_t* cache = (volk_thread_cache_t*)arg;
+    for (size_t c = 0; c < VOLK_POOL_CLASSES; c++) {
+        while (cache->blocks[c]) {
+            volk_pool_block_t* block = cache->blocks[c];
+            cache->blocks[c] = block->next;
+            volk_pool_push_global(block, c);
+        }
+        cache->n_blocks[c] = 0;
+    }
+    free(cache);
+}
+
+static void volk_pool_init(void)
+{
+    const char* env = getenv("VOLK_MALLOC_POOL");
+    if (env == NULL || env[0] == '\0' || strcmp(env, "0") == 0)
+        return;
+    if (pthread_key_create(&volk_pool.thread_cache, volk_pool_flush_thread_cache) != 0)
+        return;
+    volk_pool.enabled = true;
+}
+
+static bool volk_pool_enabled(void)
+{
+    volk_call_once(&volk_pool_once, volk_pool_init);
+    return volk_pool.enabled;
+}
+
+static volk_thread_cache_t* volk_pool_get_thread_cache(void)
+{
+    volk_thread_cache_t* cache =
+        (volk_thread_cache_t*)pthread_getspecific(volk_pool.thread_cache);
+    if (cache == NULL) {
+        cache = (volk_thread_cache_t*)calloc(1, sizeof(volk_thread_cache_t));
+        if (cache && pthread_setspecific(volk_pool.thread_cache, cache) != 0) {
+            free(cache);
+            cache = NULL;
+        }
+    }
+    return cache;
+}
+
+// place the header in front of a fresh system block of the given class
+static void* volk_pool_system_alloc(size_t size, size_t alignment, size_t size_class)
+{
+    char* base = (char*)volk_aligned_alloc(alignment + size, alignment);
+    if (base == NULL)
+        return NULL;
+    VOLK_ATOMIC_ADD_RELAXED(&volk_pool.system_allocs, 1);
+    void* ptr = base + alignment;
+    volk_pool_header(ptr)->size_class = size_class;
+    volk_pool_header(ptr)->base = base;
+    return ptr;
+}
+
+static void* volk_pool_malloc(size_t size, size_t alignment)
+{
+    VOLK_ATOMIC_ADD_RELAXED(&volk_pool.allocations, 1);
+    size_t size_class = 0;
+    while (size_class < VOLK_POOL_CLASSES && volk_pool_class_size(size_class) < size)
+        size_class++;
+    if (size_class == VOLK_POOL_CLASSES || alignment > VOLK_POOL_ALIGNMENT) {
+        if (alignment < VOLK_POOL_ALIGNMENT)
+            alignment = VOLK_POOL_ALIGNMENT;
+        return volk_pool_system_alloc(size, alignment, VOLK_POOL_LARGE);
+    }
+
+    void* ptr = NULL;
+    volk_thread_cache_t* cache = volk_pool_get_thread_cache();
+    if (cache && cache->blocks[size_class]) {
+        ptr = cache->blocks[size_class];
+        cache->blocks[size_class] = cache->blocks[size_class]->next;
+        cache->n_blocks[size_class]--;
+        VOLK_ATOMIC_ADD_RELAXED(&volk_pool.thread_hits, 1);
+    } else {
+        pthread_mutex_lock(&volk_pool.lock);
+        if (volk_pool.blocks[size_class]) {
+            ptr = volk_pool.blocks[size_class];
+            volk_pool.blocks[size_class] = volk_pool.blocks[size_class]->next;
+            volk_pool.n_blocks[size_class]--;
+        }
+        pthread_mutex_unlock(&volk_pool.lock);
+        if (ptr)
+            VOLK_ATOMIC_ADD_RELAXED(&volk_pool.global_hits, 1);
+    }
+    if (ptr) {
+        VOLK_ATOMIC_ADD_RELAXED(&volk_pool.cached_bytes,
+                                -(long long)volk_pool_class_size(size_class));
+        return ptr;
+    }
+    return volk_pool_system_alloc(
+        volk_pool_class_size(size_class), VOLK_POOL_ALIGNMENT, size_class);
+}
+
+static void volk_pool_free(void* ptr)
+{
+    VOLK_ATOMIC_ADD_RELAXED(&volk_pool.frees, 1);
+    const size_t size_class = volk_pool_header(ptr)->size_class;
+    if (size_class == VOLK_POOL_LARGE) {
+        volk_pool_system_free(ptr);
+        return;
+    }
+    VOLK_ATOMIC_ADD_RELAXED(&volk_pool.cached_bytes,
+                            (long long)volk_pool_class_size(size_class));
+    volk_thread_cache_t* cache = volk_pool_get_thread_cache();
+    if (cache && cache->n_blocks[size_class] <
+                     volk_pool_class_blocks(size_class, VOLK_POOL_THREAD_BYTES)) {
+        volk_pool_block_t* block = (volk_pool_block_t*)ptr;
+        block->next = cache->blocks[size_class];
+        cache->blocks[size_class] = block;
+        cache->n_blocks[size_class]++;
+        return;
+    }
+    volk_pool_push_global(ptr, size_class);
+}
+
+#endif /* HAVE_PTHREAD_H */
+
+void* volk_malloc(size_t size, size_t alignment)
+{
+#ifdef HAVE_PTHREAD_H
+    if (volk_pool_enabled())
+        return volk_pool_malloc(size, alignment);
+#endif
+    return volk_aligned_alloc(size, alignment);
+}
+
+void volk_free(void* ptr)
+{
+#ifdef HAVE_PTHREAD_H
+    if (volk_pool_enabled()) {
+        if (ptr)
+            volk_pool_free(ptr);
+        return;
+    }
+#endif
+    volk_aligned_free(ptr);
+}
+
+bool volk_get_malloc_pool_stats(volk_malloc_pool_stats_t* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+#ifdef HAVE_PTHREAD_H
+    if (!volk_pool_enabled())
+        return false;
+    stats->allocations = VOLK_ATOMIC_ADD_RELAXED(&volk_pool.allocations, 0);
+    stats->thread_hits = VOLK_ATOMIC_ADD_RELAXED(&volk_pool.thread_hits, 0);
+    stats->global_hits = VOLK_ATOMIC_ADD_RELAXED(&volk_pool.global_hits, 0);
+    stats->system_allocs = VOLK_ATOMIC_ADD_RELAXED(&volk_pool.system_allocs, 0);
+    stats->frees = VOLK_ATOMIC_ADD_RELAXED(&volk_pool.frees, 0);
+    stats->system_frees = VOLK_ATOMIC_ADD_RELAXED(&volk_pool.system_frees, 0);
+    stats->cached_bytes = VOLK_ATOMIC_ADD_RELAXED(&volk_pool.cached_bytes, 0);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void volk_malloc_pool_trim(void)
+{
+#ifdef HAVE_PTHREAD_H
+    if (!volk_pool_enabled())
+        return;
+    volk_thread_cache_t* cache =
+        (volk_thread_cache_t*)pthread_getspecific(volk_pool.thread_cache);
+    volk_pool_block_t* blocks[VOLK_POOL_CLASSES];
+    pthread_mutex_lock(&volk_pool.lock);
+    for (size_t c = 0; c < VOLK_POOL_CLASSES; c++) {
+        blocks[c] = volk_pool.blocks[c];
+        volk_pool.blocks[c] = NULL;
+        volk_pool.n_blocks[c] = 0;
+    }
+    pthread_mutex_unlock(&volk_pool.lock);
+    for (size_t c = 0; c < VOLK_POOL_CLASSES; c++) {
+        if (cache) {
+            while (cache->blocks[c]) {
+                volk_pool_block_t* block = cache->blocks[c];
+                cache->blocks[c] = block->next;
+                block->next = blocks[c];
+                blocks[c] = block;
+            }
+            cache->n_blocks[c] = 0;
+        }
+        while (blocks[c]) {
+            volk_pool_block_t* block = blocks[c];
+            blocks[c] = block->next;
+            VOLK_ATOMIC_ADD_RELAXED(&volk_pool.cached_bytes,
+                                    -(long long)volk_pool_class_size(c));
+            volk_pool_system_free(block);
+        }
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+// volk_malloc_ex: with any flag set the block is an anonymous mapping
+// of its own, so that madvise and mbind apply to it alone. A header in
+// front of the returned pointer records the mapping for volk_free_ex.
+// Without mmap, or with no flags, the block comes from the heap.
+////////////////////////////////////////////////////////////////////////
+#define VOLK_EX_MAGIC 0x564f4c4b45584d4dull /* "VOLKEXMM" */
+#define VOLK_EX_HEAP 0
+#define VOLK_EX_MAPPED 1
+#define VOLK_EX_MIN_OFFSET 64
+#define VOLK_EX_HUGEPAGE_SIZE ((size_t)2 << 20)
+
+typedef struct volk_ex_header {
+    unsigned long long magic;
+    void* base;
+    size_t length; // of the mapping
+    size_t kind;
+} volk_ex_header_t;
+
+static volk_ex_header_t* volk_ex_header(void* ptr)
+{
+    return (volk_ex_header_t*)((char*)ptr - sizeof(volk_ex_header_t));
+}
+
+static size_t volk_ex_round_up(size_t n, size_t multiple)
+{
+    return (n + multiple - 1) / multiple * multiple;
+}
+
+#if defined(__linux__) && defined(SYS_mbind)
+// prefer the given node for the pages of the mapping, a hint like numactl
+// --preferred: it is ignored where the node does not exist or is full.
+// Interleaving spreads the pages round the nodes like numactl --interleave;
+// the kernel leaves out the nodes of the mask the process may not use.
+static void volk_ex_bind_node(void* base, size_t length, unsigned int flags)
+{
+    int node = -1;
+    if (flags & VOLK_MALLOC_NUMA_INTERLEAVE) {
+        const unsigned long nodemask = ~0ul;
+        const int mpol_interleave = 3;
+        syscall(SYS_mbind,
+                base,
+                length,
+                mpol_interleave,
+                &nodemask,
+                (unsigned long)(8 * sizeof(nodemask)),
+                0u);
+        return;
+    }
+    if (flags & VOLK_MALLOC_NUMA_LOCAL) {
+        unsigned int cpu, local_node;
+        if (syscall(SYS_getcpu, &cpu, &local_node, NULL) == 0)
+            node = (int)local_node;
+    } else if (flags & VOLK_MALLOC_NUMA_NODE_MASK) {
+        node = (int)((flags & VOLK_MALLOC_NUMA_NODE_MASK) >> 16) - 1;
+    }
+    if (node < 0 || node >= (int)(8 * sizeof(unsigned long)))
+        return;
+    const unsigned long nodemask = 1ul << node;
+    const int mpol_preferred = 1;
+    syscall(SYS_mbind,
+            base,
+            length,
+            mpol_preferred,
+            &nodemask,
+            (unsigned long)(8 * sizeof(nodemask)),
+            0u);
+}
+#endif
+
+#if defined(HAVE_SYS_MMAN_H)
+static void* volk_ex_map(size_t offset, size_t size, unsigned int flags, size_t align)
+{
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    void* base = MAP_FAILED;
+    size_t length = 0;
+
+#ifdef MAP_HUGETLB
+    if ((flags & VOLK_MALLOC_HUGETLB) && align <= VOLK_EX_HUGEPAGE_SIZE) {
+        // explicit huge pages come from the hugetlbfs pool and are aligned
+        // to their size; fall back to transparent ones when it is empty
+        length = volk_ex_round_up(offset + size, VOLK_EX_HUGEPAGE_SIZE);
+        base = mmap(NULL,
+                    length,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                    -1,
+                    0);
+        if (base == MAP_FAILED)
+            flags |= VOLK_MALLOC_HUGEPAGES;
+    }
+#endif
+    if (base == MAP_FAILED) {
+        // map more than needed and trim, so the start is aligned to align,
+        // or to a huge page for transparent huge pages to back all of it
+        if ((flags & (VOLK_MALLOC_HUGEPAGES | VOLK_MALLOC_HUGETLB)) &&
+            align < VOLK_EX_HUGEPAGE_SIZE)
+            align = VOLK_EX_HUGEPAGE_SIZE;
+        if (align < page)
+            align = page;
+        length = volk_ex_round_up(offset + size, align);
+        const size_t map_length = length + align - page;
+        char* map = (char*)mmap(NULL,
+                                map_length,
+                                PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS,
+                                -1,
+                                0);
+        if (map == (char*)MAP_FAILED) {
+            fprintf(stderr,
+                    "VOLK: Error allocating memory (mmap: error %d: %s)\n",
+                    errno,
+                    strerror(errno));
+            return NULL;
+        }
+        char* start = (char*)volk_ex_round_up((size_t)map, align);
+        if (start > map)
+            munmap(map, (size_t)(start - map));
+        if (start + length < map + map_length)
+            munmap(start + length, (size_t)(map + map_length - (start + length)));
+        base = start;
+#ifdef MADV_HUGEPAGE
+        if (flags & (VOLK_MALLOC_HUGEPAGES | VOLK_MALLOC_HUGETLB))
+            madvise(base, length, MADV_HUGEPAGE);
+#endif
+    }
+
+#if defined(__linux__) && defined(SYS_mbind)
+    volk_ex_bind_node(base, length, flags);
+#endif
+    if (flags & VOLK_MALLOC_PREFAULT) {
+        // first touch from the calling thread, one write per page
+        for (size_t i = 0; i < length; i += page)
+            ((volatile char*)base)[i] = 0;
+    }
+
+    void* ptr = (char*)base + offset;
+    volk_ex_header(ptr)->base = base;
+    volk_ex_header(ptr)->length = length;
+    volk_ex_header(ptr)->kind = VOLK_EX_MAPPED;
+    return ptr;
+}
+#endif
+
+void* volk_malloc_ex(size_t size, size_t alignment, unsigned int flags)
+{
+    if ((flags & VOLK_MALLOC_PREFERRED_ALIGNMENT) &&
+        alignment < volk_get_preferred_alignment())
+        alignment = volk_get_preferred_alignment();
+    flags &= ~VOLK_MALLOC_PREFERRED_ALIGNMENT;
+    // the header sits in the offset, which keeps the pointer aligned
+    const size_t align = alignment > VOLK_EX_MIN_OFFSET ? alignment : VOLK_EX_MIN_OFFSET;
+    const size_t offset = align;
+    void* ptr = NULL;
+    // the offset and the rounding up of a mapping must not wrap the size
+    if (size > (size_t)-1 / 2 || align > (size_t)-1 / 8) {
+        fprintf(stderr,
+                "VOLK: Error allocating memory (%zu bytes aligned to %zu)\n",
+                size,
+                alignment);
+        return NULL;
+    }
+#if defined(HAVE_SYS_MMAN_H)
+    if (flags) {
+        ptr = volk_ex_map(offset, size, flags, align);
+        if (ptr == NULL)
+            return NULL;
+    }
+#endif
+    if (ptr == NULL) {
+        char* base = (char*)volk_aligned_alloc(offset + size, align);
+        if (base == NULL)
+            return NULL;
+        ptr = base + offset;
+        volk_ex_header(ptr)->base = base;
+        volk_ex_header(ptr)->length = offset + size;
+        volk_ex_header(ptr)->kind = VOLK_EX_HEAP;
+        if (flags & VOLK_MALLOC_PREFAULT)
+            memset(ptr, 0, size);
+    }
+    volk_ex_header(ptr)->magic = VOLK_EX_MAGIC;
+    return ptr;
+}
+
+void volk_free_ex(void* ptr)
+{
+    if (ptr == NULL)
+        return;
+    volk_ex_header_t* header = volk_ex_header(ptr);
+    if (header->magic != VOLK_EX_MAGIC) {
+        fprintf(stderr, "VOLK: volk_free_ex called on memory not from volk_malloc_ex\n");
+        return;
+    }
+    header->magic = 0;
+#if defined(HAVE_SYS_MMAN_H)
+    if (header->kind == VOLK_EX_MAPPED) {
+        munmap(header->base, header->length);
+        return;
+    }
+#endif
+    volk_aligned_free(header->base);
+}
+
+////////////////////////////////////////////////////////////////////////
+// volk_malloc_ring: one shared memory object mapped twice, back to back,
+// into a reservation of twice its size. Both halves are the same pages,
+// so a window starting anywhere in the first half runs on contiguously
+// for a full capacity. Mappings are page aligned, which covers every
+// volk_get_alignment().
+////////////////////////////////////////////////////////////////////////
+// the bytes of the ring, 0 where no ring holds the items: for an item_size
+// of 0, or where twice the bytes would not fit a size_t
+static size_t volk_ring_bytes(size_t n_items, size_t item_size, size_t granularity)
+{
+    const size_t max_bytes = (size_t)-1 / 2;
+    size_t gcd = granularity, rest = item_size, step, bytes;
+    if (item_size == 0)
+        return 0;
+    while (rest) {
+        const size_t next = gcd % rest;
+        gcd = rest;
+        rest = next;
+    }
+    // the smallest multiple of the granularity holding whole items
+    if (item_size / gcd > max_bytes / granularity)
+        return 0;
+    step = granularity * (item_size / gcd);
+    if (n_items > max_bytes / item_size)
+        return 0;
+    bytes = n_items ? n_items * item_size : 1;
+    if (bytes > max_bytes - (step - 1))
+        return 0;
+    return volk_ex_round_up(bytes, step);
+}
+
+#if defined(HAVE_SYS_MMAN_H)
+
+static int volk_ring_shared_fd(size_t bytes)
+{
+    int fd = -1;
+#if defined(__linux__) && defined(SYS_memfd_create)
+    fd = (int)syscall(SYS_memfd_create, "volk_ring", 0u);
+#endif
+    if (fd < 0) {
+        char name[64];
+        snprintf(name, sizeof(name), "/volk_ring_%ld_%p", (long)getpid(), (void*)&name);
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd >= 0)
+            shm_unlink(name);
+    }
+    if (fd >= 0 && ftruncate(fd, (off_t)bytes) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+void* volk_malloc_ring(size_t n_items, size_t item_size, size_t* capacity)
+{
+    const size_t bytes =
+        volk_ring_bytes(n_items, item_size, (size_t)sysconf(_SC_PAGESIZE));
+    if (bytes == 0) {
+        fprintf(stderr,
+                "VOLK: Error allocating ring buffer (%zu items of %zu bytes)\n",
+                n_items,
+                item_size);
+        return NULL;
+    }
+    const int fd = volk_ring_shared_fd(bytes);
+    if (fd < 0) {
+        fprintf(stderr,
+                "VOLK: Error allocating ring buffer (shared memory: error %d: %s)\n",
+                errno,
+                strerror(errno));
+        return NULL;
+    }
+    char* base = (char*)mmap(NULL, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    bool mapped = base != (char*)MAP_FAILED;
+    if (mapped) {
+        mapped =
+            mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) ==
+                base &&
+            mmap(base + bytes,
+                 bytes,
+                 PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_FIXED,
+                 fd,
+                 0) == base + bytes;
+        if (!mapped)
+            munmap(base, 2 * bytes);
+    }
+    close(fd);
+    if (!mapped) {
+        fprintf(stderr,
+                "VOLK: Error allocating ring buffer (mmap: error %d: %s)\n",
+                errno,
+                strerror(errno));
+        return NULL;
+    }
+    *capacity = bytes / item_size;
+    return base;
+}
+
+void volk_free_ring(void* ptr, size_t capacity, size_t item_size)
+{
+    if (ptr)
+        munmap(ptr, 2 * capacity * item_size);
+}
+
+#elif defined(_WIN32)
+
+// VirtualAlloc2 and MapViewOfFile3 need Windows 10 1803; they are looked up
+// at run time so that VOLK neither needs onecore.lib nor fails to load
+// on older systems, where volk_malloc_ring returns NULL.
+#ifndef MEM_RESERVE_PLACEHOLDER
+#define MEM_RESERVE_PLACEHOLDER 0x00040000
+#endif
+#ifndef MEM_REPLACE_PLACEHOLDER
+#define MEM_REPLACE_PLACEHOLDER 0x00004000
+#endif
+#ifndef MEM_PRESERVE_PLACEHOLDER
+#define MEM_PRESERVE_PLACEHOLDER 0x00000002
+#endif
+
+typedef PVOID(WINAPI* volk_virtual_alloc2_t)(
+    HANDLE, PVOID, SIZE_T, ULONG, ULONG, void*, ULONG);
+typedef PVOID(WINAPI* volk_map_view_of_file3_t)(
+    HANDLE, HANDLE, PVOID, ULONG64, SIZE_T, ULONG, ULONG, void*, ULONG);
+
+void* volk_malloc_ring(size_t n_items, size_t item_size, size_t* capacity)
+{
+    HMODULE kernelbase = GetModuleHandleA("kernelbase.dll");
+    volk_virtual_alloc2_t virtual_alloc2 =
+        kernelbase ? (volk_virtual_alloc2_t)GetProcAddress(kernelbase, "VirtualAlloc2")
+                   : NULL;
+    volk_map_view_of_file3_t map_view_of_file3 =
+        kernelbase
+            ? (volk_map_view_of_file3_t)GetProcAddress(kernelbase, "MapViewOfFile3")
+            : NULL;
+    if (!virtual_alloc2 || !map_view_of_file3) {
+        fprintf(stderr, "VOLK: Error allocating ring buffer (needs VirtualAlloc2)\n");
+        return NULL;
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const size_t bytes = volk_ring_bytes(n_items, item_size, info.dwAllocationGranularity);
+    if (bytes == 0) {
+        fprintf(stderr,
+                "VOLK: Error allocating ring buffer (%zu items of %zu bytes)\n",
+                n_items,
+                item_size);
+        return NULL;
+    }
+    char* base = (char*)virtual_alloc2(NULL,
+                                       NULL,
+                                       2 * bytes,
+                                       MEM_RESERVE | MEM_RESERVE_PLACEHOLDER,
+                                       PAGE_NOACCESS,
+                                       NULL,
+                                       0);
+    if (base == NULL) {
+        fprintf(stderr, "VOLK: Error allocating ring buffer (VirtualAlloc2)\n");
+        return NULL;
+    }
+    // split the placeholder in two halves, then map the section into each
+    VirtualFree(base, bytes, MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER);
+    HANDLE section = CreateFileMappingA(INVALID_HANDLE_VALUE,
+                                        NULL,
+                                        PAGE_READWRITE,
+                                        (DWORD)((unsigned long long)bytes >> 32),
+                                        (DWORD)(bytes & 0xffffffffu),
+                                        NULL);
+    void* first = NULL;
+    void* second = NULL;
+    if (section) {
+        first = map_view_of_file3(section,
+                                  NULL,
+                                  base,
+                                  0,
+                                  bytes,
+                                  MEM_REPLACE_PLACEHOLDER,
+                                  PAGE_READWRITE,
+                                  NULL,
+                                  0);
+        second = map_view_of_file3(section,
+                                   NULL,
+                                   base + bytes,
+                                   0,
+                                   bytes,
+                                   MEM_REPLACE_PLACEHOLDER,
+                                   PAGE_READWRITE,
+                                   NULL,
+                                   0);
+        CloseHandle(section);
+    }
+    if (!first || !second) {
+        if (first)
+            UnmapViewOfFile(first);
+        else
+            VirtualFree(base, 0, MEM_RELEASE);
+        if (second)
+            UnmapViewOfFile(second);
+        else
+            VirtualFree(base + bytes, 0, MEM_RELEASE);
+        fprintf(stderr, "VOLK: Error allocating ring buffer (MapViewOfFile3)\n");
+        return NULL;
+    }
+    *capacity = bytes / item_size;
+    return base;
+}
+
+void volk_free_ring(void* ptr, size_t capacity, size_t item_size)
+{
+    if (ptr) {
+        UnmapViewOfFile(ptr);
+        UnmapViewOfFile((char*)ptr + capacity * item_size);
+    }
+}
+
+#else
+
+void* volk_malloc_ring(size_t n_items, size_t item_size, size_t* capacity)
+{
+    (void)n_items;
+    (void)item_size;
+    (void)capacity;
+    fprintf(stderr, "VOLK: Error allocating ring buffer (not supported)\n");
+    return NULL;
+}
+
+void volk_free_ring(void* ptr, size_t capacity, size_t item_size)
+{
+    (void)ptr;
+    (void)capacity;
+    (void)item_size;
+}
+
+#endif
+
+
+////////////////////////////////////////////////////////////////////////
+// Arenas: one volk_malloc block with the arena header at its start,
+// padded so that the usable memory behind it stays aligned. Allocations
+// advance an offset; nothing is freed before the reset.
+////////////////////////////////////////////////////////////////////////
+struct volk_arena {
+    char* begin;
+    size_t capacity;
+    size_t used;
+    size_t peak;
+};
+
+#define VOLK_ARENA_HEADER_SIZE \
+    ((sizeof(struct volk_arena) + VOLK_MAX_ALIGNMENT - 1) & ~(size_t)(VOLK_MAX_ALIGNMENT - 1))
+
+volk_arena_t* volk_arena_create(size_t size)
+{
+    if (size > (size_t)-1 - VOLK_ARENA_HEADER_SIZE)
+        return NULL;
+    size_t alignment = volk_get_alignment();
+    if (alignment < VOLK_MAX_ALIGNMENT)
+        alignment = VOLK_MAX_ALIGNMENT;
+    char* block = (char*)volk_malloc(VOLK_ARENA_HEADER_SIZE + size, alignment);
+    if (block == NULL)
+        return NULL;
+    volk_arena_t* arena = (volk_arena_t*)block;
+    arena->begin = block + VOLK_ARENA_HEADER_SIZE;
+    arena->capacity = size;
+    arena->used = 0;
+    arena->peak = 0;
+    return arena;
+}
+
+void volk_arena_destroy(volk_arena_t* arena)
+{
+    volk_free(arena);
+}
+
+void* volk_arena_alloc(volk_arena_t* arena, size_t size, size_t alignment)
+{
+    if (alignment == 0)
+        alignment = volk_get_alignment();
+    const uintptr_t next = (uintptr_t)(arena->begin + arena->used);
+    const size_t offset =
+        ((next + alignment - 1) & ~(uintptr_t)(alignment - 1)) - (uintptr_t)arena->begin;
+    if (offset > arena->capacity || size > arena->capacity - offset)
+        return NULL;
+    arena->used = offset + size;
+    if (arena->peak < arena->used)
+        arena->peak = arena->used;
+    return arena->begin + offset;
+}
+
+void volk_arena_reset(volk_arena_t* arena)
+{
+    arena->used = 0;
+}
+
+size_t volk_arena_used(const volk_arena_t* arena)
+{
+    return arena->used;
+}
+
+size_t volk_arena_peak(const volk_arena_t* arena)
+{
+    return arena->peak;
+}
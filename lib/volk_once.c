@@ -0,0 +1,60 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdbool.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#define volk_once_yield() SwitchToThread()
+#else
+#include <sched.h>
+#define volk_once_yield() sched_yield()
+#endif
+
+#include "volk_once.h"
+
+static bool volk_once_claim(volk_once_t* once)
+{
+#if defined(_MSC_VER)
+    return _InterlockedCompareExchange(&once->state, 1, 0) == 0;
+#else
+    long expected = 0;
+    return __atomic_compare_exchange_n(
+        &once->state, &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+void volk_call_once(volk_once_t* once, void (*fn)(void))
+{
+    if (VOLK_ATOMIC_LOAD_ACQ(&once->state) == 2)
+        return;
+
+    if (volk_once_claim(once)) {
+        fn();
+        VOLK_ATOMIC_STORE_REL(&once->state, 2);
+        return;
+    }
+
+    // another thread is running fn, the inits are short so just wait it out
+    while (VOLK_ATOMIC_LOAD_ACQ(&once->state) != 2) {
+        volk_once_yield();
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_ONCE_H
+#define INCLUDED_VOLK_ONCE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////////////
+// Minimal atomics for the lazy initialisation of the dispatch tables.
+// Stores of resolved pointers are release stores, and the once state
+// is read with acquire semantics, so a thread that sees an init as
+// done also sees everything the init wrote. The relaxed add is only
+// used for the optional kernel statistics counters. The pointer compare
+// and swap publishes a lazily built table; it returns true if it stored.
+// The 64 bit load and compare and swap, both sequentially consistent,
+// update the tile ranges of volk_graph.
+////////////////////////////////////////////////////////////////////////
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define VOLK_ATOMIC_LOAD_ACQ(p) _InterlockedCompareExchange((p), 0, 0)
+#define VOLK_ATOMIC_STORE_REL(p, v) _InterlockedExchange((p), (v))
+#define VOLK_ATOMIC_STORE_PTR(dst, v) \
+    _InterlockedExchangePointer((void* volatile*)&(dst), (void*)(v))
+#define VOLK_ATOMIC_ADD_RELAXED(p, v) _InterlockedExchangeAdd64((p), (v))
+#define VOLK_ATOMIC_LOAD_PTR(src) \
+    _InterlockedCompareExchangePointer((void* volatile*)&(src), NULL, NULL)
+#define VOLK_ATOMIC_CAS_PTR(dst, expected, v)                      \
+    (_InterlockedCompareExchangePointer((void* volatile*)&(dst),   \
+                                        (void*)(v),                \
+                                        (void*)(expected)) == (void*)(expected))
+#define VOLK_ATOMIC_LOAD_64(p) \
+    ((uint64_t)_InterlockedCompareExchange64((volatile __int64*)(p), 0, 0))
+#define VOLK_ATOMIC_CAS_64(p, expected, v)                                \
+    (_InterlockedCompareExchange64((volatile __int64*)(p),                \
+                                   (__int64)(v),                          \
+                                   (__int64)(expected)) == (__int64)(expected))
+#else
+#define VOLK_ATOMIC_LOAD_ACQ(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define VOLK_ATOMIC_STORE_REL(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define VOLK_ATOMIC_STORE_PTR(dst, v) __atomic_store_n(&(dst), (v), __ATOMIC_RELEASE)
+#define VOLK_ATOMIC_ADD_RELAXED(p, v) __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#define VOLK_ATOMIC_LOAD_PTR(src) __atomic_load_n(&(src), __ATOMIC_ACQUIRE)
+#define VOLK_ATOMIC_CAS_PTR(dst, expected, v) \
+    __sync_bool_compare_and_swap(&(dst), (expected), (v))
+#define VOLK_ATOMIC_LOAD_64(p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define VOLK_ATOMIC_CAS_64(p, expected, v) \
+    __sync_bool_compare_and_swap((p), (expected), (v))
+#endif
+
+typedef struct volk_once {
+    volatile long state; // 0 = not run, 1 = running, 2 = done
+} volk_once_t;
+
+#define VOLK_ONCE_INIT \
+    {                  \
+        0              \
+    }
+
+/*!
+ * Run fn exactly once for the given once object.
+ * Concurrent callers wait until the winning caller has finished fn;
+ * once it has, this is a single acquire load.
+ */
+void volk_call_once(volk_once_t* once, void (*fn)(void));
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*INCLUDED_VOLK_ONCE_H*/
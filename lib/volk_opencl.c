@@ -0,0 +1,519 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CL_TARGET_OPENCL_VERSION 120
+#if defined(__APPLE__)
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include "volk_once.h"
+#include <volk/volk.h>
+#include <volk/volk_malloc.h>
+#include <volk/volk_opencl.h>
+
+////////////////////////////////////////////////////////////////////////
+// Device buffers are host allocations the device uses in place
+// (CL_MEM_USE_HOST_PTR), aligned to a page as zero copy drivers want.
+// They are kept mapped, so the host may access them between calls, and
+// are unmapped around each launch that uses them; mapping a buffer made
+// from a host pointer always returns that pointer. Their slots are
+// claimed by compare and swap and filled before the pointer is
+// published, so launches look them up unlocked.
+////////////////////////////////////////////////////////////////////////
+#define VOLK_OPENCL_MAX_BUFFERS 256
+#define VOLK_OPENCL_BUFFER_ALIGNMENT 4096
+#define VOLK_OPENCL_CLAIMED ((void*)1)
+#define VOLK_OPENCL_MAX_ARGS 4
+#define VOLK_OPENCL_LOCAL_SIZE 64
+#define VOLK_OPENCL_DOT_GROUPS 64
+
+typedef struct volk_opencl_buffer {
+    void* host; // NULL when free, VOLK_OPENCL_CLAIMED while being set up
+    size_t size;
+    cl_mem mem;
+} volk_opencl_buffer_t;
+
+// a vector argument of a launch
+typedef struct volk_opencl_arg {
+    const void* ptr;
+    size_t elem_size;
+    size_t n_elems;
+    bool output;
+    cl_mem mem;
+    cl_uint offset;               // in elements, into mem
+    volk_opencl_buffer_t* buffer; // the device buffer of ptr, NULL if wrapped
+    bool owned;                   // mem wraps ptr for this launch only
+    bool unmapped;                // the launch unmapped buffer
+} volk_opencl_arg_t;
+
+static struct {
+    cl_device_id device;
+    cl_context context;
+    cl_command_queue queue;
+    cl_program program;
+    bool found; // a device is present
+    bool ready; // and the kernels are built for it
+} volk_opencl;
+
+static volk_opencl_buffer_t volk_opencl_buffers[VOLK_OPENCL_MAX_BUFFERS];
+static volk_once_t volk_opencl_find_once = VOLK_ONCE_INIT;
+static volk_once_t volk_opencl_init_once = VOLK_ONCE_INIT;
+
+// offsets are in elements, so vectors need not start at an aligned address
+// of the buffer; contraction is off for the results to match the generic impls
+static const char volk_opencl_source[] =
+    "#pragma OPENCL FP_CONTRACT OFF\n"
+    "__kernel void volk_32fc_x2_multiply_32fc(__global float2* c, uint c_off,\n"
+    "                                         __global const float2* a, uint a_off,\n"
+    "                                         __global const float2* b, uint b_off,\n"
+    "                                         uint n)\n"
+    "{\n"
+    "    const uint i = get_global_id(0);\n"
+    "    if (i < n) {\n"
+    "        const float2 x = a[a_off + i];\n"
+    "        const float2 y = b[b_off + i];\n"
+    "        c[c_off + i] = (float2)(x.x * y.x - x.y * y.y, x.x * y.y + x.y * y.x);\n"
+    "    }\n"
+    "}\n"
+    "__kernel void volk_32fc_magnitude_squared_32f(__global float* m, uint m_off,\n"
+    "                                              __global const float2* a,\n"
+    "                                              uint a_off, uint n)\n"
+    "{\n"
+    "    const uint i = get_global_id(0);\n"
+    "    if (i < n) {\n"
+    "        const float2 x = a[a_off + i];\n"
+    "        m[m_off + i] = x.x * x.x + x.y * x.y;\n"
+    "    }\n"
+    "}\n"
+    "__kernel void volk_32f_s32f_convert_16i(__global short* o, uint o_off,\n"
+    "                                        __global const float* a, uint a_off,\n"
+    "                                        float scalar, uint n)\n"
+    "{\n"
+    "    const uint i = get_global_id(0);\n"
+    "    if (i < n) {\n"
+    "        o[o_off + i] = convert_short_sat_rte(a[a_off + i] * scalar);\n"
+    "    }\n"
+    "}\n"
+    "__kernel void volk_32fc_x2_dot_prod_32fc(__global float2* partial, uint p_off,\n"
+    "                                         __global const float2* a, uint a_off,\n"
+    "                                         __global const float2* b, uint b_off,\n"
+    "                                         uint n, __local float2* sums)\n"
+    "{\n"
+    "    const uint lid = get_local_id(0);\n"
+    "    float2 sum = (float2)(0.0f, 0.0f);\n"
+    "    for (uint i = get_global_id(0); i < n; i += get_global_size(0)) {\n"
+    "        const float2 x = a[a_off + i];\n"
+    "        const float2 y = b[b_off + i];\n"
+    "        sum += (float2)(x.x * y.x - x.y * y.y, x.x * y.y + x.y * y.x);\n"
+    "    }\n"
+    "    sums[lid] = sum;\n"
+    "    barrier(CLK_LOCAL_MEM_FENCE);\n"
+    "    for (uint s = get_local_size(0) / 2; s > 0; s /= 2) {\n"
+    "        if (lid < s)\n"
+    "            sums[lid] += sums[lid + s];\n"
+    "        barrier(CLK_LOCAL_MEM_FENCE);\n"
+    "    }\n"
+    "    if (lid == 0)\n"
+    "        partial[p_off + get_group_id(0)] = sums[0];\n"
+    "}\n";
+
+// the first GPU or accelerator of any platform
+static void volk_opencl_find(void)
+{
+    cl_platform_id platforms[16];
+    cl_uint n_platforms = 0;
+    cl_uint i;
+    if (clGetPlatformIDs(16, platforms, &n_platforms) != CL_SUCCESS)
+        return;
+    for (i = 0; i < n_platforms && i < 16; i++) {
+        cl_uint n_devices = 0;
+        if (clGetDeviceIDs(platforms[i],
+                           CL_DEVICE_TYPE_GPU | CL_DEVICE_TYPE_ACCELERATOR,
+                           1,
+                           &volk_opencl.device,
+                           &n_devices) == CL_SUCCESS &&
+            n_devices > 0) {
+            volk_opencl.found = true;
+            return;
+        }
+    }
+}
+
+static void volk_opencl_init(void)
+{
+    const char* source = volk_opencl_source;
+    cl_int err;
+    volk_call_once(&volk_opencl_find_once, volk_opencl_find);
+    if (!volk_opencl.found)
+        return;
+    volk_opencl.context =
+        clCreateContext(NULL, 1, &volk_opencl.device, NULL, NULL, &err);
+    if (err != CL_SUCCESS)
+        return;
+    volk_opencl.queue =
+        clCreateCommandQueue(volk_opencl.context, volk_opencl.device, 0, &err);
+    if (err != CL_SUCCESS)
+        return;
+    volk_opencl.program =
+        clCreateProgramWithSource(volk_opencl.context, 1, &source, NULL, &err);
+    if (err != CL_SUCCESS)
+        return;
+    if (clBuildProgram(volk_opencl.program, 1, &volk_opencl.device, "", NULL, NULL) !=
+        CL_SUCCESS) {
+        char log[4096] = "";
+        clGetProgramBuildInfo(volk_opencl.program,
+                              volk_opencl.device,
+                              CL_PROGRAM_BUILD_LOG,
+                              sizeof(log) - 1,
+                              log,
+                              NULL);
+        fprintf(stderr, "Volk warning: OpenCL kernels failed to build:\n%s\n", log);
+        return;
+    }
+    volk_opencl.ready = true;
+}
+
+static bool volk_opencl_ready(void)
+{
+    volk_call_once(&volk_opencl_init_once, volk_opencl_init);
+    return volk_opencl.ready;
+}
+
+bool volk_opencl_available(void)
+{
+    volk_call_once(&volk_opencl_find_once, volk_opencl_find);
+    return volk_opencl.found;
+}
+
+// the device buffer holding the bytes at ptr, NULL if there is none
+static volk_opencl_buffer_t* volk_opencl_lookup(const void* ptr, size_t bytes)
+{
+    size_t i;
+    for (i = 0; i < VOLK_OPENCL_MAX_BUFFERS; i++) {
+        const char* host = (const char*)VOLK_ATOMIC_LOAD_PTR(volk_opencl_buffers[i].host);
+        if (host && host != (const char*)VOLK_OPENCL_CLAIMED &&
+            (const char*)ptr >= host &&
+            (const char*)ptr + bytes <= host + volk_opencl_buffers[i].size) {
+            return &volk_opencl_buffers[i];
+        }
+    }
+    return NULL;
+}
+
+void* volk_opencl_malloc(size_t size)
+{
+    size_t i;
+    cl_int err;
+    if (!volk_opencl_ready())
+        return volk_malloc(size, volk_get_alignment());
+
+    // drivers copy whole cache lines, so pad to one
+    size = (size + 63) & ~(size_t)63;
+    for (i = 0; i < VOLK_OPENCL_MAX_BUFFERS; i++) {
+        if (VOLK_ATOMIC_CAS_PTR(volk_opencl_buffers[i].host, NULL, VOLK_OPENCL_CLAIMED))
+            break;
+    }
+    if (i == VOLK_OPENCL_MAX_BUFFERS) {
+        fprintf(stderr, "Volk warning: out of OpenCL buffer slots\n");
+        return volk_malloc(size, volk_get_alignment());
+    }
+    volk_opencl_buffer_t* buffer = &volk_opencl_buffers[i];
+    void* host = volk_malloc(size, VOLK_OPENCL_BUFFER_ALIGNMENT);
+    if (!host) {
+        VOLK_ATOMIC_STORE_PTR(buffer->host, NULL);
+        return NULL;
+    }
+    buffer->size = size;
+    buffer->mem = clCreateBuffer(
+        volk_opencl.context, CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, size, host, &err);
+    if (err == CL_SUCCESS) {
+        clEnqueueMapBuffer(volk_opencl.queue,
+                           buffer->mem,
+                           CL_TRUE,
+                           CL_MAP_READ | CL_MAP_WRITE,
+                           0,
+                           size,
+                           0,
+                           NULL,
+                           NULL,
+                           &err);
+        if (err != CL_SUCCESS)
+            clReleaseMemObject(buffer->mem);
+    }
+    if (err != CL_SUCCESS) {
+        // a plain allocation still works with every impl
+        VOLK_ATOMIC_STORE_PTR(buffer->host, NULL);
+        return host;
+    }
+    VOLK_ATOMIC_STORE_PTR(buffer->host, host);
+    return host;
+}
+
+void volk_opencl_free(void* ptr)
+{
+    volk_opencl_buffer_t* buffer;
+    if (!ptr)
+        return;
+    buffer = volk_opencl_lookup(ptr, 0);
+    if (buffer && buffer->host == ptr) {
+        clEnqueueUnmapMemObject(volk_opencl.queue, buffer->mem, ptr, 0, NULL, NULL);
+        clFinish(volk_opencl.queue);
+        clReleaseMemObject(buffer->mem);
+        VOLK_ATOMIC_STORE_PTR(buffer->host, NULL);
+    }
+    volk_free(ptr);
+}
+
+// find or wrap the memory of one vector; a vector another one of the launch
+// already wrapped shares its mem, as in place calls pass the same pointer twice
+static bool volk_opencl_bind(volk_opencl_arg_t* args, size_t i)
+{
+    volk_opencl_arg_t* arg = &args[i];
+    const size_t bytes = arg->elem_size * arg->n_elems;
+    size_t j;
+    cl_int err;
+    arg->buffer = volk_opencl_lookup(arg->ptr, bytes);
+    if (arg->buffer) {
+        const size_t offset = (const char*)arg->ptr - (const char*)arg->buffer->host;
+        if (offset % arg->elem_size == 0) {
+            arg->mem = arg->buffer->mem;
+            arg->offset = (cl_uint)(offset / arg->elem_size);
+            return true;
+        }
+        arg->buffer = NULL;
+    }
+    for (j = 0; j < i; j++) {
+        if (args[j].owned && args[j].ptr == arg->ptr &&
+            args[j].elem_size * args[j].n_elems == bytes) {
+            arg->mem = args[j].mem;
+            arg->offset = 0;
+            return true;
+        }
+    }
+    arg->mem = clCreateBuffer(volk_opencl.context,
+                              (arg->output ? CL_MEM_READ_WRITE : CL_MEM_READ_ONLY) |
+                                  CL_MEM_USE_HOST_PTR,
+                              bytes,
+                              (void*)arg->ptr,
+                              &err);
+    arg->offset = 0;
+    arg->owned = err == CL_SUCCESS;
+    return arg->owned;
+}
+
+// run the kernel over global_size work items, taking the vectors, each as
+// its mem and offset, then the scalar if any, then n, then the local memory
+// if any; on false the outputs are left unchanged
+static bool volk_opencl_run(const char* name,
+                            volk_opencl_arg_t* args,
+                            size_t n_args,
+                            const float* scalar,
+                            unsigned int n,
+                            size_t global_size,
+                            size_t local_bytes)
+{
+    const size_t local_size = VOLK_OPENCL_LOCAL_SIZE;
+    const cl_uint n_arg = n;
+    cl_kernel kernel;
+    cl_uint index = 0;
+    cl_int err;
+    bool ok = true;
+    bool launched = false;
+    size_t i, j;
+
+    if (!volk_opencl_ready())
+        return false;
+    // kernel objects hold their arguments, so every launch has its own
+    kernel = clCreateKernel(volk_opencl.program, name, &err);
+    if (err != CL_SUCCESS)
+        return false;
+    for (i = 0; ok && i < n_args; i++) {
+        ok = volk_opencl_bind(args, i) &&
+             clSetKernelArg(kernel, index++, sizeof(cl_mem), &args[i].mem) ==
+                 CL_SUCCESS &&
+             clSetKernelArg(kernel, index++, sizeof(cl_uint), &args[i].offset) ==
+                 CL_SUCCESS;
+    }
+    if (ok && scalar)
+        ok = clSetKernelArg(kernel, index++, sizeof(float), scalar) == CL_SUCCESS;
+    if (ok)
+        ok = clSetKernelArg(kernel, index++, sizeof(cl_uint), &n_arg) == CL_SUCCESS;
+    if (ok && local_bytes)
+        ok = clSetKernelArg(kernel, index++, local_bytes, NULL) == CL_SUCCESS;
+
+    // hand the device buffers to the device for the launch
+    for (i = 0; ok && i < n_args; i++) {
+        bool first = args[i].buffer != NULL;
+        for (j = 0; first && j < i; j++)
+            first = args[j].buffer != args[i].buffer;
+        if (first) {
+            ok = clEnqueueUnmapMemObject(volk_opencl.queue,
+                                         args[i].buffer->mem,
+                                         args[i].buffer->host,
+                                         0,
+                                         NULL,
+                                         NULL) == CL_SUCCESS;
+            args[i].unmapped = ok;
+        }
+    }
+    if (ok) {
+        global_size = (global_size + local_size - 1) / local_size * local_size;
+        launched = clEnqueueNDRangeKernel(volk_opencl.queue,
+                                          kernel,
+                                          1,
+                                          NULL,
+                                          &global_size,
+                                          &local_size,
+                                          0,
+                                          NULL,
+                                          NULL) == CL_SUCCESS;
+    }
+
+    // and back to the host; a wrapped output is read into the memory it wraps
+    for (i = 0; i < n_args; i++) {
+        if (args[i].unmapped) {
+            clEnqueueMapBuffer(volk_opencl.queue,
+                               args[i].buffer->mem,
+                               CL_TRUE,
+                               CL_MAP_READ | CL_MAP_WRITE,
+                               0,
+                               args[i].buffer->size,
+                               0,
+                               NULL,
+                               NULL,
+                               &err);
+            launched = launched && err == CL_SUCCESS;
+        } else if (launched && args[i].owned && args[i].output) {
+            launched = clEnqueueReadBuffer(volk_opencl.queue,
+                                           args[i].mem,
+                                           CL_TRUE,
+                                           0,
+                                           args[i].elem_size * args[i].n_elems,
+                                           (void*)args[i].ptr,
+                                           0,
+                                           NULL,
+                                           NULL) == CL_SUCCESS;
+        }
+    }
+    clFinish(volk_opencl.queue);
+    for (i = 0; i < n_args; i++) {
+        if (args[i].owned)
+            clReleaseMemObject(args[i].mem);
+    }
+    clReleaseKernel(kernel);
+    return launched;
+}
+
+static void volk_opencl_vector(volk_opencl_arg_t* arg,
+                               const void* ptr,
+                               size_t elem_size,
+                               size_t n_elems,
+                               bool output)
+{
+    memset(arg, 0, sizeof(*arg));
+    arg->ptr = ptr;
+    arg->elem_size = elem_size;
+    arg->n_elems = n_elems;
+    arg->output = output;
+}
+
+bool volk_opencl_32fc_x2_multiply_32fc(lv_32fc_t* cVector,
+                                       const lv_32fc_t* aVector,
+                                       const lv_32fc_t* bVector,
+                                       unsigned int num_points)
+{
+    volk_opencl_arg_t args[VOLK_OPENCL_MAX_ARGS];
+    if (num_points == 0)
+        return true;
+    volk_opencl_vector(&args[0], cVector, sizeof(lv_32fc_t), num_points, true);
+    volk_opencl_vector(&args[1], aVector, sizeof(lv_32fc_t), num_points, false);
+    volk_opencl_vector(&args[2], bVector, sizeof(lv_32fc_t), num_points, false);
+    return volk_opencl_run(
+        "volk_32fc_x2_multiply_32fc", args, 3, NULL, num_points, num_points, 0);
+}
+
+bool volk_opencl_32fc_magnitude_squared_32f(float* magnitudeVector,
+                                            const lv_32fc_t* complexVector,
+                                            unsigned int num_points)
+{
+    volk_opencl_arg_t args[VOLK_OPENCL_MAX_ARGS];
+    if (num_points == 0)
+        return true;
+    volk_opencl_vector(&args[0], magnitudeVector, sizeof(float), num_points, true);
+    volk_opencl_vector(&args[1], complexVector, sizeof(lv_32fc_t), num_points, false);
+    return volk_opencl_run(
+        "volk_32fc_magnitude_squared_32f", args, 2, NULL, num_points, num_points, 0);
+}
+
+bool volk_opencl_32f_s32f_convert_16i(int16_t* outputVector,
+                                      const float* inputVector,
+                                      const float scalar,
+                                      unsigned int num_points)
+{
+    volk_opencl_arg_t args[VOLK_OPENCL_MAX_ARGS];
+    if (num_points == 0)
+        return true;
+    volk_opencl_vector(&args[0], outputVector, sizeof(int16_t), num_points, true);
+    volk_opencl_vector(&args[1], inputVector, sizeof(float), num_points, false);
+    return volk_opencl_run(
+        "volk_32f_s32f_convert_16i", args, 2, &scalar, num_points, num_points, 0);
+}
+
+bool volk_opencl_32fc_x2_dot_prod_32fc(lv_32fc_t* result,
+                                       const lv_32fc_t* input,
+                                       const lv_32fc_t* taps,
+                                       unsigned int num_points)
+{
+    // each work group leaves one partial sum, the host adds them up
+    lv_32fc_t partial[VOLK_OPENCL_DOT_GROUPS];
+    volk_opencl_arg_t args[VOLK_OPENCL_MAX_ARGS];
+    size_t groups = (num_points + VOLK_OPENCL_LOCAL_SIZE - 1) / VOLK_OPENCL_LOCAL_SIZE;
+    size_t i;
+    if (groups > VOLK_OPENCL_DOT_GROUPS)
+        groups = VOLK_OPENCL_DOT_GROUPS;
+    if (num_points == 0) {
+        *result = lv_cmake(0.f, 0.f);
+        return true;
+    }
+    volk_opencl_vector(&args[0], partial, sizeof(lv_32fc_t), groups, true);
+    volk_opencl_vector(&args[1], input, sizeof(lv_32fc_t), num_points, false);
+    volk_opencl_vector(&args[2], taps, sizeof(lv_32fc_t), num_points, false);
+    if (!volk_opencl_run("volk_32fc_x2_dot_prod_32fc",
+                         args,
+                         3,
+                         NULL,
+                         num_points,
+                         groups * VOLK_OPENCL_LOCAL_SIZE,
+                         VOLK_OPENCL_LOCAL_SIZE * sizeof(lv_32fc_t))) {
+        return false;
+    }
+    *result = partial[0];
+    for (i = 1; i < groups; i++)
+        *result += partial[i];
+    return true;
+}
@@ -0,0 +1,772 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // pthread_setaffinity_np
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "volk_parallel.h"
+#include <volk/volk.h>
+#include <volk/volk_executor.h>
+#include <volk/volk_prefs.h>
+
+#ifdef HAVE_PTHREAD_H
+
+#if defined(__linux__) && defined(SYS_move_pages) && defined(SYS_getcpu)
+#define VOLK_PARALLEL_NUMA
+#endif
+
+// nodes with ids at or above this get no worker group of their own
+#define VOLK_PARALLEL_MAX_NODES 64
+
+////////////////////////////////////////////////////////////////////////
+// On a host with several NUMA nodes the workers form a group per node,
+// each pinned to the cpus of its node the process may run on. A job on a
+// buffer asks the kernel where the middle page of every chunk lives and
+// the threads of a node take the chunks on it first; chunks whose pages
+// are not there yet are spread over the nodes in order, so the first
+// touch places them and the next call on the buffer finds them local.
+// Any thread takes the chunks left once those of its node are started.
+////////////////////////////////////////////////////////////////////////
+typedef struct {
+    uint64_t unclaimed;                        // chunks not started, 0 = in order
+    uint64_t on_node[VOLK_PARALLEL_MAX_NODES]; // chunks whose pages are there
+} volk_placement_t;
+
+#ifdef VOLK_PARALLEL_NUMA
+static struct {
+    bool probed;
+    unsigned int n_nodes; // nodes with cpus the process may use
+    unsigned int node_ids[VOLK_PARALLEL_MAX_NODES];
+    bool has_workers[VOLK_PARALLEL_MAX_NODES];
+    cpu_set_t cpus[VOLK_PARALLEL_MAX_NODES];
+} volk_numa;
+
+// parse a sysfs cpu list such as 0-3,8-11 into set
+static void volk_numa_parse_cpus(const char* list, cpu_set_t* set)
+{
+    char* end;
+    CPU_ZERO(set);
+    while (*list >= '0' && *list <= '9') {
+        unsigned long first = strtoul(list, &end, 10), last = first;
+        if (*end == '-')
+            last = strtoul(end + 1, &end, 10);
+        for (; first <= last && first < CPU_SETSIZE; first++)
+            CPU_SET(first, set);
+        list = *end == ',' ? end + 1 : end;
+    }
+}
+
+// find the nodes whose cpus the process may run on, called with job_lock held
+static void volk_numa_probe(void)
+{
+    cpu_set_t allowed;
+    unsigned int node;
+    volk_numa.probed = true;
+    if (volk_get_cpu_info()->n_numa_nodes < 2 ||
+        sched_getaffinity(0, sizeof(allowed), &allowed))
+        return;
+    for (node = 0; node < VOLK_PARALLEL_MAX_NODES; node++) {
+        char path[64], list[1024];
+        FILE* file;
+        size_t length;
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+        if (!(file = fopen(path, "r")))
+            continue;
+        length = fread(list, 1, sizeof(list) - 1, file);
+        fclose(file);
+        list[length] = '\0';
+        volk_numa_parse_cpus(list, &volk_numa.cpus[node]);
+        CPU_AND(&volk_numa.cpus[node], &volk_numa.cpus[node], &allowed);
+        if (CPU_COUNT(&volk_numa.cpus[node]))
+            volk_numa.node_ids[volk_numa.n_nodes++] = node;
+    }
+    if (volk_numa.n_nodes < 2)
+        volk_numa.n_nodes = 0;
+}
+
+// the node the calling thread runs on, -1 without worker groups
+static int volk_numa_current_node(void)
+{
+    unsigned int cpu, node;
+    if (!volk_numa.n_nodes || syscall(SYS_getcpu, &cpu, &node, NULL) ||
+        node >= VOLK_PARALLEL_MAX_NODES)
+        return -1;
+    return (int)node;
+}
+#else
+static int volk_numa_current_node(void) { return -1; }
+#endif
+
+// find the nodes of the chunks of a job on data, stride bytes per point
+static void volk_placement_init(volk_placement_t* placement,
+                                const void* data,
+                                size_t stride,
+                                size_t n,
+                                size_t chunk_len,
+                                size_t n_chunks)
+{
+    placement->unclaimed = 0;
+#ifdef VOLK_PARALLEL_NUMA
+    void* pages[VOLK_PARALLEL_MAX_CHUNKS];
+    int status[VOLK_PARALLEL_MAX_CHUNKS];
+    size_t chunk;
+    if (!volk_numa.n_nodes || !data || n_chunks < 2 ||
+        n_chunks > VOLK_PARALLEL_MAX_CHUNKS)
+        return;
+    for (chunk = 0; chunk < n_chunks; chunk++) {
+        const size_t start = chunk * chunk_len;
+        const size_t count = n - start < chunk_len ? n - start : chunk_len;
+        pages[chunk] = (char*)data + (start + count / 2) * stride;
+    }
+    // with no target nodes move_pages only reports where the pages are
+    if (syscall(SYS_move_pages, 0, (unsigned long)n_chunks, pages, NULL, status, 0))
+        return;
+    memset(placement->on_node, 0, sizeof(placement->on_node));
+    for (chunk = 0; chunk < n_chunks; chunk++) {
+        int node = status[chunk];
+        if (node < 0) // not faulted in yet
+            node = (int)volk_numa.node_ids[chunk * volk_numa.n_nodes / n_chunks];
+        if (node < VOLK_PARALLEL_MAX_NODES && volk_numa.has_workers[node])
+            placement->on_node[node] |= (uint64_t)1 << chunk;
+    }
+    placement->unclaimed = ~(uint64_t)0 >> (64 - n_chunks);
+#else
+    (void)data;
+    (void)stride;
+    (void)n;
+    (void)chunk_len;
+    (void)n_chunks;
+#endif
+}
+
+// the chunk for a thread on node to run next, next when the job is in order
+static size_t volk_placement_claim(volk_placement_t* placement, int node, size_t next)
+{
+#ifdef VOLK_PARALLEL_NUMA
+    if (placement->unclaimed) {
+        uint64_t mask = node >= 0 ? placement->unclaimed & placement->on_node[node] : 0;
+        if (!mask)
+            mask = placement->unclaimed;
+        mask &= ~mask + 1;
+        placement->unclaimed &= ~mask;
+        return (size_t)__builtin_ctzll(mask);
+    }
+#else
+    (void)placement;
+    (void)node;
+#endif
+    return next;
+}
+
+////////////////////////////////////////////////////////////////////////
+// A persistent pool; the calling thread works on the job alongside the
+// num_threads - 1 workers. One job runs at a time, callers queue up on
+// job_lock. Chunks are claimed under the pool lock, which is cheap at
+// the chunk sizes used here. Async calls wait in a FIFO whose chunks
+// the workers run when no job has chunks left, and so do threads
+// waiting for an async call. With an executor set the pool has no
+// threads; jobs and async calls go to the executor, a task per chunk.
+////////////////////////////////////////////////////////////////////////
+struct volk_async {
+    volk_parallel_chunk_fn fn;
+    volk_parallel_finish_fn finish;
+    void* ctx;
+    size_t n, chunk_len, n_chunks, next_chunk, finished;
+    bool done;
+    struct volk_async* next; // in the FIFO, while it has chunks to start
+    volk_executor_wait_fn wait; // the executor's, if it runs the call
+    void* wait_ctx;
+    void* handle;
+    volk_placement_t placement;
+};
+
+static struct {
+    pthread_mutex_t job_lock; // serialises jobs and pool resizes
+    pthread_mutex_t lock;     // protects everything below
+    pthread_cond_t work;
+    pthread_cond_t done;
+    pthread_cond_t async_done;
+    pthread_t* workers;
+    unsigned int n_workers;
+    unsigned int n_threads; // requested thread count, 0 = not set
+    bool shutdown;
+    unsigned long generation;
+    volk_parallel_chunk_fn fn;
+    void* ctx;
+    size_t n, chunk_len, n_chunks, next_chunk, finished;
+    volk_placement_t placement;
+    volk_async_t* async_head;
+    volk_async_t* async_tail;
+    volk_executor_submit_fn submit; // the host's executor, NULL for the pool
+    volk_executor_wait_fn wait;
+    void* executor_ctx;
+} volk_pool = { PTHREAD_MUTEX_INITIALIZER,
+                PTHREAD_MUTEX_INITIALIZER,
+                PTHREAD_COND_INITIALIZER,
+                PTHREAD_COND_INITIALIZER,
+                PTHREAD_COND_INITIALIZER };
+
+// the smallest chunk, about a core's L2 at 32 bytes per point, e.g. two
+// complex float inputs and a float output, and at least VOLK_PARALLEL_GRAIN
+static size_t volk_pool_grain(void)
+{
+    const size_t grain = volk_get_l2_cache_size() / 32;
+    return grain > VOLK_PARALLEL_GRAIN ? grain : VOLK_PARALLEL_GRAIN;
+}
+
+// the threads a job may use: the pool's, or under an executor the thread
+// count set if any, else as many as there can be chunks
+static unsigned int volk_pool_threads(void)
+{
+    if (volk_pool.submit && volk_pool.n_threads <= 1)
+        return VOLK_PARALLEL_MAX_CHUNKS;
+    return volk_pool.n_threads;
+}
+
+// the grain and thread count of a job of the kernel on n points, those
+// volk_profile measured for its length bucket capped by the pool, or the
+// defaults; called with job_lock held
+static void
+volk_pool_tuning(const char* kernel, size_t n, size_t* grain, unsigned int* n_threads)
+{
+    unsigned int tuned_threads;
+    size_t tuned_grain;
+    *grain = volk_pool_grain();
+    *n_threads = volk_pool_threads();
+    if (kernel && volk_get_parallel_grain(
+                      kernel, volk_get_length_bucket(n), &tuned_threads, &tuned_grain)) {
+        *grain = tuned_grain;
+        if (tuned_threads < *n_threads)
+            *n_threads = tuned_threads;
+    }
+}
+
+// at least a grain per chunk and at most VOLK_PARALLEL_MAX_CHUNKS chunks,
+// rounded up to the alignment so that every chunk starts aligned. A job
+// kept to fewer threads than the pool has, or than the executor may use,
+// gets one chunk per thread, so that no more of them can run it at once.
+static size_t volk_pool_chunk_len(size_t n, size_t grain, unsigned int n_threads)
+{
+    const size_t align = volk_get_alignment();
+    const unsigned int max_threads =
+        volk_pool.submit ? VOLK_PARALLEL_MAX_CHUNKS : volk_pool.n_threads;
+    size_t chunk_len = (n + VOLK_PARALLEL_MAX_CHUNKS - 1) / VOLK_PARALLEL_MAX_CHUNKS;
+    if (chunk_len < grain)
+        chunk_len = grain;
+    if (n_threads && n_threads < max_threads &&
+        chunk_len < (n + n_threads - 1) / n_threads)
+        chunk_len = (n + n_threads - 1) / n_threads;
+    return (chunk_len + align - 1) / align * align;
+}
+
+// run the chunks of the current job until none are left, those on node first,
+// called with lock held
+static void volk_pool_drain(int node)
+{
+    while (volk_pool.next_chunk < volk_pool.n_chunks) {
+        const size_t chunk =
+            volk_placement_claim(&volk_pool.placement, node, volk_pool.next_chunk++);
+        const size_t start = chunk * volk_pool.chunk_len;
+        size_t count = volk_pool.n - start;
+        if (count > volk_pool.chunk_len)
+            count = volk_pool.chunk_len;
+        pthread_mutex_unlock(&volk_pool.lock);
+        volk_pool.fn(volk_pool.ctx, chunk, start, count);
+        pthread_mutex_lock(&volk_pool.lock);
+        if (++volk_pool.finished == volk_pool.n_chunks)
+            pthread_cond_signal(&volk_pool.done);
+    }
+}
+
+// run the next chunk of the oldest async call, preferably one on node,
+// called with lock held
+static void volk_pool_run_async(int node)
+{
+    volk_async_t* call = volk_pool.async_head;
+    const size_t chunk = volk_placement_claim(&call->placement, node, call->next_chunk++);
+    const size_t start = chunk * call->chunk_len;
+    size_t count = call->n - start;
+    if (count > call->chunk_len)
+        count = call->chunk_len;
+    if (call->next_chunk == call->n_chunks) {
+        volk_pool.async_head = call->next;
+        if (!volk_pool.async_head)
+            volk_pool.async_tail = NULL;
+    }
+    pthread_mutex_unlock(&volk_pool.lock);
+    call->fn(call->ctx, chunk, start, count);
+    pthread_mutex_lock(&volk_pool.lock);
+    if (++call->finished == call->n_chunks) {
+        pthread_mutex_unlock(&volk_pool.lock);
+        if (call->finish)
+            call->finish(call->ctx, call->n_chunks);
+        free(call->ctx);
+        pthread_mutex_lock(&volk_pool.lock);
+        call->done = true;
+        pthread_cond_broadcast(&volk_pool.async_done);
+    }
+}
+
+// workers leave on shutdown only once the async calls have been started;
+// arg is the node of the worker's group plus one, 0 without groups
+static void* volk_pool_worker(void* arg)
+{
+    unsigned long seen = 0;
+    const int node = (int)(intptr_t)arg - 1;
+#ifdef VOLK_PARALLEL_NUMA
+    if (node >= 0)
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &volk_numa.cpus[node]);
+#endif
+    pthread_mutex_lock(&volk_pool.lock);
+    for (;;) {
+        if (volk_pool.generation != seen) {
+            seen = volk_pool.generation;
+            volk_pool_drain(node);
+        } else if (volk_pool.async_head) {
+            volk_pool_run_async(node);
+        } else if (volk_pool.shutdown) {
+            break;
+        } else {
+            pthread_cond_wait(&volk_pool.work, &volk_pool.lock);
+        }
+    }
+    pthread_mutex_unlock(&volk_pool.lock);
+    return NULL;
+}
+
+static void volk_pool_stop(void)
+{
+    unsigned int i;
+    pthread_mutex_lock(&volk_pool.lock);
+    volk_pool.shutdown = true;
+    pthread_cond_broadcast(&volk_pool.work);
+    pthread_mutex_unlock(&volk_pool.lock);
+    for (i = 0; i < volk_pool.n_workers; i++)
+        pthread_join(volk_pool.workers[i], NULL);
+    free(volk_pool.workers);
+    volk_pool.workers = NULL;
+    volk_pool.n_workers = 0;
+    volk_pool.shutdown = false;
+}
+
+// start the workers for the requested thread count, or the one async calls
+// need at a single thread, dealt round the NUMA nodes from the second on as
+// the calling thread counts for the first, called with job_lock held
+static void volk_pool_start(void)
+{
+    const unsigned int n_workers = volk_pool.n_threads > 1 ? volk_pool.n_threads - 1 : 1;
+    unsigned int i;
+    volk_pool.workers = (pthread_t*)malloc(n_workers * sizeof(pthread_t));
+    if (!volk_pool.workers)
+        return;
+#ifdef VOLK_PARALLEL_NUMA
+    if (!volk_numa.probed)
+        volk_numa_probe();
+    memset(volk_numa.has_workers, 0, sizeof(volk_numa.has_workers));
+    for (i = 0; i <= n_workers && i < volk_numa.n_nodes; i++)
+        volk_numa.has_workers[volk_numa.node_ids[i]] = true;
+#endif
+    for (i = 0; i < n_workers; i++) {
+        intptr_t group = 0;
+#ifdef VOLK_PARALLEL_NUMA
+        if (volk_numa.n_nodes)
+            group = (intptr_t)volk_numa.node_ids[(i + 1) % volk_numa.n_nodes] + 1;
+#endif
+        pthread_mutex_lock(&volk_pool.lock);
+        if (pthread_create(
+                &volk_pool.workers[i], NULL, volk_pool_worker, (void*)group)) {
+            pthread_mutex_unlock(&volk_pool.lock);
+            fprintf(stderr, "Volk warning: failed to start worker thread %u\n", i);
+            break;
+        }
+        volk_pool.n_workers++;
+        pthread_mutex_unlock(&volk_pool.lock);
+    }
+    if (!volk_pool.n_workers) {
+        free(volk_pool.workers);
+        volk_pool.workers = NULL;
+    }
+}
+
+// a job on the executor, whose task i runs chunk i
+typedef struct {
+    volk_parallel_chunk_fn fn;
+    void* ctx;
+    size_t n, chunk_len;
+} volk_executor_job_t;
+
+static void volk_executor_chunk(void* arg, size_t task)
+{
+    const volk_executor_job_t* job = (const volk_executor_job_t*)arg;
+    const size_t start = task * job->chunk_len;
+    size_t count = job->n - start;
+    if (count > job->chunk_len)
+        count = job->chunk_len;
+    job->fn(job->ctx, task, start, count);
+}
+
+// run a job on the executor and wait for it, called with job_lock held, which
+// it releases so that other threads can hand their jobs to the executor too
+static void
+volk_executor_run(size_t n, size_t chunk_len, volk_parallel_chunk_fn fn, void* ctx)
+{
+    const volk_executor_job_t job = { fn, ctx, n, chunk_len };
+    const volk_executor_submit_fn submit = volk_pool.submit;
+    const volk_executor_wait_fn wait = volk_pool.wait;
+    void* const executor_ctx = volk_pool.executor_ctx;
+    pthread_mutex_unlock(&volk_pool.job_lock);
+    wait(executor_ctx,
+         submit(executor_ctx,
+                (n + chunk_len - 1) / chunk_len,
+                &volk_executor_chunk,
+                (void*)&job));
+    pthread_mutex_lock(&volk_pool.job_lock);
+}
+
+// a chunk of an async call on the executor; the last one to finish merges
+static void volk_executor_async_chunk(void* arg, size_t task)
+{
+    volk_async_t* call = (volk_async_t*)arg;
+    const size_t start = task * call->chunk_len;
+    size_t count = call->n - start;
+    if (count > call->chunk_len)
+        count = call->chunk_len;
+    call->fn(call->ctx, task, start, count);
+    pthread_mutex_lock(&volk_pool.lock);
+    if (++call->finished == call->n_chunks) {
+        pthread_mutex_unlock(&volk_pool.lock);
+        if (call->finish)
+            call->finish(call->ctx, call->n_chunks);
+        free(call->ctx);
+        pthread_mutex_lock(&volk_pool.lock);
+        call->done = true;
+        pthread_cond_broadcast(&volk_pool.async_done);
+    }
+    pthread_mutex_unlock(&volk_pool.lock);
+}
+
+void volk_set_executor(volk_executor_submit_fn submit,
+                       volk_executor_wait_fn wait,
+                       void* ctx)
+{
+    pthread_mutex_lock(&volk_pool.job_lock);
+    if (submit && volk_pool.n_workers)
+        volk_pool_stop();
+    volk_pool.submit = submit;
+    volk_pool.wait = submit ? wait : NULL;
+    volk_pool.executor_ctx = submit ? ctx : NULL;
+    pthread_mutex_unlock(&volk_pool.job_lock);
+}
+
+void volk_set_num_threads(unsigned int n_threads)
+{
+    pthread_mutex_lock(&volk_pool.job_lock);
+    if (n_threads != volk_pool.n_threads && volk_pool.n_workers)
+        volk_pool_stop();
+    volk_pool.n_threads = n_threads;
+    pthread_mutex_unlock(&volk_pool.job_lock);
+}
+
+unsigned int volk_get_num_threads(void)
+{
+    unsigned int n_threads;
+    pthread_mutex_lock(&volk_pool.job_lock);
+    n_threads = volk_pool.n_threads ? volk_pool.n_threads : 1;
+    pthread_mutex_unlock(&volk_pool.job_lock);
+    return n_threads;
+}
+
+// run a job on the workers and the calling thread, called with job_lock held
+static void volk_pool_run(const void* data,
+                          size_t stride,
+                          size_t n,
+                          size_t chunk_len,
+                          volk_parallel_chunk_fn fn,
+                          void* ctx)
+{
+    const size_t n_chunks = (n + chunk_len - 1) / chunk_len;
+    const int node = volk_numa_current_node();
+
+    if (!volk_pool.n_workers)
+        volk_pool_start();
+
+    pthread_mutex_lock(&volk_pool.lock);
+    volk_placement_init(&volk_pool.placement, data, stride, n, chunk_len, n_chunks);
+    volk_pool.fn = fn;
+    volk_pool.ctx = ctx;
+    volk_pool.n = n;
+    volk_pool.chunk_len = chunk_len;
+    volk_pool.n_chunks = n_chunks;
+    volk_pool.next_chunk = 0;
+    volk_pool.finished = 0;
+    volk_pool.generation++;
+    pthread_cond_broadcast(&volk_pool.work);
+    volk_pool_drain(node);
+    while (volk_pool.finished < n_chunks)
+        pthread_cond_wait(&volk_pool.done, &volk_pool.lock);
+    pthread_mutex_unlock(&volk_pool.lock);
+}
+
+size_t volk_parallel_for(const char* kernel,
+                         const void* data,
+                         size_t stride,
+                         size_t n,
+                         volk_parallel_chunk_fn fn,
+                         void* ctx)
+{
+    size_t chunk_len, grain = 0;
+    unsigned int n_threads = 0;
+
+    pthread_mutex_lock(&volk_pool.job_lock);
+    if (volk_pool_threads() > 1)
+        volk_pool_tuning(kernel, n, &grain, &n_threads);
+    if (n_threads <= 1 || n < 2 * grain) {
+        pthread_mutex_unlock(&volk_pool.job_lock);
+        fn(ctx, 0, 0, n);
+        return 1;
+    }
+    chunk_len = volk_pool_chunk_len(n, grain, n_threads);
+    if (volk_pool.submit)
+        volk_executor_run(n, chunk_len, fn, ctx);
+    else
+        volk_pool_run(data, stride, n, chunk_len, fn, ctx);
+    pthread_mutex_unlock(&volk_pool.job_lock);
+    return (n + chunk_len - 1) / chunk_len;
+}
+
+void volk_parallel_run(size_t n_tasks, volk_parallel_chunk_fn fn, void* ctx)
+{
+    size_t i;
+
+    pthread_mutex_lock(&volk_pool.job_lock);
+    if (volk_pool_threads() <= 1 || n_tasks <= 1) {
+        pthread_mutex_unlock(&volk_pool.job_lock);
+        for (i = 0; i < n_tasks; i++)
+            fn(ctx, i, i, 1);
+        return;
+    }
+    if (volk_pool.submit)
+        volk_executor_run(n_tasks, 1, fn, ctx);
+    else
+        volk_pool_run(NULL, 0, n_tasks, 1, fn, ctx);
+    pthread_mutex_unlock(&volk_pool.job_lock);
+}
+
+volk_async_t* volk_parallel_submit(const char* kernel,
+                                   const void* data,
+                                   size_t stride,
+                                   size_t n,
+                                   volk_parallel_chunk_fn fn,
+                                   volk_parallel_finish_fn finish,
+                                   void* ctx)
+{
+    volk_async_t* call = (volk_async_t*)calloc(1, sizeof(volk_async_t));
+    if (call) {
+        size_t grain;
+        unsigned int n_threads;
+        call->fn = fn;
+        call->finish = finish;
+        call->ctx = ctx;
+        call->n = n;
+
+        pthread_mutex_lock(&volk_pool.job_lock);
+        volk_pool_tuning(kernel, n, &grain, &n_threads);
+        call->chunk_len = n < 2 * grain ? n : volk_pool_chunk_len(n, grain, n_threads);
+        call->n_chunks = n ? (n + call->chunk_len - 1) / call->chunk_len : 1;
+        if (volk_pool.submit) {
+            const volk_executor_submit_fn submit = volk_pool.submit;
+            call->wait = volk_pool.wait;
+            call->wait_ctx = volk_pool.executor_ctx;
+            pthread_mutex_unlock(&volk_pool.job_lock);
+            call->handle =
+                submit(call->wait_ctx, call->n_chunks, &volk_executor_async_chunk, call);
+            return call;
+        }
+        if (!volk_pool.n_workers)
+            volk_pool_start();
+        if (volk_pool.n_workers) {
+            volk_placement_init(
+                &call->placement, data, stride, n, call->chunk_len, call->n_chunks);
+            pthread_mutex_lock(&volk_pool.lock);
+            if (volk_pool.async_tail)
+                volk_pool.async_tail->next = call;
+            else
+                volk_pool.async_head = call;
+            volk_pool.async_tail = call;
+            pthread_cond_broadcast(&volk_pool.work);
+            pthread_mutex_unlock(&volk_pool.lock);
+            pthread_mutex_unlock(&volk_pool.job_lock);
+            return call;
+        }
+        pthread_mutex_unlock(&volk_pool.job_lock);
+        free(call);
+    }
+
+    // no memory or no worker, run it here
+    fn(ctx, 0, 0, n);
+    if (finish)
+        finish(ctx, 1);
+    free(ctx);
+    return NULL;
+}
+
+void volk_async_wait(volk_async_t* call)
+{
+    if (!call)
+        return;
+    if (call->wait) {
+        call->wait(call->wait_ctx, call->handle);
+        free(call);
+        return;
+    }
+    // help with the queued chunks rather than sleep on them
+    const int node = volk_numa_current_node();
+    pthread_mutex_lock(&volk_pool.lock);
+    while (!call->done) {
+        if (volk_pool.async_head)
+            volk_pool_run_async(node);
+        else
+            pthread_cond_wait(&volk_pool.async_done, &volk_pool.lock);
+    }
+    pthread_mutex_unlock(&volk_pool.lock);
+    free(call);
+}
+
+bool volk_async_done(volk_async_t* call)
+{
+    bool done = true;
+    if (call) {
+        pthread_mutex_lock(&volk_pool.lock);
+        done = call->done;
+        pthread_mutex_unlock(&volk_pool.lock);
+    }
+    return done;
+}
+
+#else /*HAVE_PTHREAD_H*/
+
+// no thread support, the parallel kernels run on the calling thread
+void volk_set_executor(volk_executor_submit_fn submit,
+                       volk_executor_wait_fn wait,
+                       void* ctx)
+{
+    (void)submit;
+    (void)wait;
+    (void)ctx;
+}
+
+void volk_set_num_threads(unsigned int n_threads) { (void)n_threads; }
+
+unsigned int volk_get_num_threads(void) { return 1; }
+
+size_t volk_parallel_for(const char* kernel,
+                         const void* data,
+                         size_t stride,
+                         size_t n,
+                         volk_parallel_chunk_fn fn,
+                         void* ctx)
+{
+    (void)kernel;
+    (void)data;
+    (void)stride;
+    fn(ctx, 0, 0, n);
+    return 1;
+}
+
+void volk_parallel_run(size_t n_tasks, volk_parallel_chunk_fn fn, void* ctx)
+{
+    size_t i;
+    for (i = 0; i < n_tasks; i++)
+        fn(ctx, i, i, 1);
+}
+
+volk_async_t* volk_parallel_submit(const char* kernel,
+                                   const void* data,
+                                   size_t stride,
+                                   size_t n,
+                                   volk_parallel_chunk_fn fn,
+                                   volk_parallel_finish_fn finish,
+                                   void* ctx)
+{
+    (void)kernel;
+    (void)data;
+    (void)stride;
+    fn(ctx, 0, 0, n);
+    if (finish)
+        finish(ctx, 1);
+    free(ctx);
+    return NULL;
+}
+
+// the async calls completed before they returned
+void volk_async_wait(volk_async_t* call) { (void)call; }
+
+bool volk_async_done(volk_async_t* call)
+{
+    (void)call;
+    return true;
+}
+
+#endif /*HAVE_PTHREAD_H*/
+
+// a task of volk_run_tasks, run as a chunk of one point
+typedef struct {
+    volk_task_fn fn;
+    void* arg;
+} volk_run_tasks_t;
+
+static void volk_run_task(void* ctx, size_t chunk, size_t start, size_t count)
+{
+    const volk_run_tasks_t* tasks = (const volk_run_tasks_t*)ctx;
+    (void)start;
+    (void)count;
+    tasks->fn(tasks->arg, chunk);
+}
+
+void volk_run_tasks(size_t n_tasks, volk_task_fn fn, void* arg)
+{
+    volk_run_tasks_t tasks = { fn, arg };
+    volk_parallel_run(n_tasks, &volk_run_task, &tasks);
+}
+
+// the executor adapters built with the library replace these
+#ifndef VOLK_OPENMP_EXECUTOR
+bool volk_use_openmp_executor(void) { return false; }
+#endif
+
+#ifndef VOLK_TBB_EXECUTOR
+bool volk_use_tbb_executor(void) { return false; }
+#endif
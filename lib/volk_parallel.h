@@ -0,0 +1,91 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_PARALLEL_H
+#define INCLUDED_VOLK_PARALLEL_H
+
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// upper bound on the chunks of one job, reductions keep one partial per chunk
+#define VOLK_PARALLEL_MAX_CHUNKS 64
+
+// smallest chunk in points on any cpu, chunks grow to fill larger L2 caches
+#define VOLK_PARALLEL_GRAIN 8192
+
+typedef void (*volk_parallel_chunk_fn)(void* ctx,     // the kernel arguments
+                                       size_t chunk,  // index of this chunk
+                                       size_t start,  // first point of the chunk
+                                       size_t count); // number of points
+
+/*!
+ * Split n points into chunks and run fn on each of them over the pool.
+ * Chunks are multiples of the machine alignment, so aligned buffers stay
+ * aligned in every chunk. With a single thread, or when n is too small to
+ * split, fn runs once on the calling thread over all n points.
+ * Chunks are numbered in order of their start point. The grain and thread
+ * count volk_profile measured for the kernel, see volk_get_parallel_grain,
+ * replace the defaults; kernel may be NULL. On a NUMA host the workers of
+ * the node holding the pages of data, stride bytes per point, take each
+ * chunk first; data may be NULL.
+ * \return the number of chunks fn was run on, at least 1
+ */
+size_t volk_parallel_for(const char* kernel,
+                         const void* data,
+                         size_t stride,
+                         size_t n,
+                         volk_parallel_chunk_fn fn,
+                         void* ctx);
+
+/*!
+ * Run fn(ctx, i, i, 1) for each i below n_tasks on the pool and the calling
+ * thread, without grain or alignment, for callers splitting the work
+ * themselves. Returns once all have returned.
+ */
+void volk_parallel_run(size_t n_tasks, volk_parallel_chunk_fn fn, void* ctx);
+
+typedef void (*volk_parallel_finish_fn)(void* ctx,        // the kernel arguments
+                                        size_t n_chunks); // number of chunks run
+
+/*!
+ * Run fn on the chunks of n points over the pool without waiting for them,
+ * chunked and placed as volk_parallel_for chunks on several threads. Once
+ * the last chunk is done, finish runs if it is not NULL and ctx, which must
+ * come from malloc, is freed. The pool has a worker for this even at one
+ * thread; calls start in the order they were submitted, and
+ * volk_parallel_for jobs go first.
+ * \return the call to wait on, NULL if it ran on the calling thread
+ */
+struct volk_async* volk_parallel_submit(const char* kernel,
+                                        const void* data,
+                                        size_t stride,
+                                        size_t n,
+                                        volk_parallel_chunk_fn fn,
+                                        volk_parallel_finish_fn finish,
+                                        void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*INCLUDED_VOLK_PARALLEL_H*/
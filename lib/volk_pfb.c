@@ -0,0 +1,246 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "volk_fpmode.h"
+#include "volk_parallel.h"
+#include <volk/volk.h>
+#include <volk/volk_pfb.h>
+
+// the frames a thread collects for one volk_32fc_fft_batch_32fc call
+#define VOLK_PFB_BATCH 16
+
+struct volk_pfb_channelizer {
+    unsigned int num_channels;
+    unsigned int hop;
+    unsigned int taps_per_branch;
+    unsigned int window; // taps_per_branch * num_channels
+    float* taps;         // the prototype reversed and zero padded, as the fold takes it
+    lv_32fc_t* history;  // the last window - 1 inputs, then room for as many more
+    unsigned int phase;  // the inputs so far, modulo num_channels
+    volk_plan_t* fold_plan;
+    volk_plan_t* fft_plan;
+    // kept between calls: per thread the branch sums and a batch of their rotations
+    char* scratch;
+    size_t scratch_threads;
+    size_t thread_bytes;
+};
+
+typedef struct volk_pfb_channelizer_run {
+    const volk_pfb_channelizer_t* pfb;
+    lv_32fc_t* output;
+    const lv_32fc_t* input;
+    size_t first;    // the input after which the first frame is due
+    size_t n_frames;
+    size_t n_threads;
+    bool flush_denormals; // the caller's volk_set_flush_denormals, for the pool threads
+} volk_pfb_channelizer_run_t;
+
+volk_pfb_channelizer_t* volk_pfb_channelizer_create(unsigned int num_channels,
+                                                    const float* taps,
+                                                    unsigned int num_taps,
+                                                    unsigned int flags)
+{
+    volk_pfb_channelizer_t* pfb;
+    const size_t align = volk_get_alignment();
+    unsigned int n;
+
+    if (num_channels < 2 || (num_channels & (num_channels - 1)) || !taps ||
+        num_taps == 0)
+        return NULL;
+    pfb = (volk_pfb_channelizer_t*)calloc(1, sizeof(volk_pfb_channelizer_t));
+    if (!pfb)
+        return NULL;
+    pfb->num_channels = num_channels;
+    pfb->hop = (flags & VOLK_PFB_OVERSAMPLED) ? num_channels / 2 : num_channels;
+    pfb->taps_per_branch = (num_taps + num_channels - 1) / num_channels;
+    pfb->window = pfb->taps_per_branch * num_channels;
+    pfb->taps = (float*)volk_malloc(pfb->window * sizeof(float), align);
+    pfb->history =
+        (lv_32fc_t*)volk_malloc(2 * (pfb->window - 1) * sizeof(lv_32fc_t), align);
+    pfb->fold_plan = volk_plan_create("volk_32fc_32f_pfb_fold_32fc", num_channels, 0);
+    pfb->fft_plan = volk_plan_create("volk_32fc_fft_batch_32fc", num_channels, 0);
+    if (!pfb->taps || !pfb->history || !pfb->fold_plan || !pfb->fft_plan) {
+        volk_pfb_channelizer_destroy(pfb);
+        return NULL;
+    }
+
+    for (n = 0; n < pfb->window; n++) {
+        const unsigned int tap = pfb->window - 1 - n;
+        pfb->taps[n] = tap < num_taps ? taps[tap] : 0.f;
+    }
+    volk_pfb_channelizer_reset(pfb);
+    return pfb;
+}
+
+void volk_pfb_channelizer_destroy(volk_pfb_channelizer_t* pfb)
+{
+    if (!pfb)
+        return;
+    volk_plan_destroy(pfb->fold_plan);
+    volk_plan_destroy(pfb->fft_plan);
+    volk_free(pfb->taps);
+    volk_free(pfb->history);
+    volk_free(pfb->scratch);
+    free(pfb);
+}
+
+void volk_pfb_channelizer_reset(volk_pfb_channelizer_t* pfb)
+{
+    memset(pfb->history, 0, (pfb->window - 1) * sizeof(lv_32fc_t));
+    pfb->phase = 0;
+}
+
+// the inputs of the next call up to and including the one its first frame is due after
+static size_t volk_pfb_channelizer_due(const volk_pfb_channelizer_t* pfb)
+{
+    return pfb->hop - pfb->phase % pfb->hop;
+}
+
+size_t volk_pfb_channelizer_frames(const volk_pfb_channelizer_t* pfb, size_t num_points)
+{
+    const size_t due = volk_pfb_channelizer_due(pfb);
+    if (num_points < due)
+        return 0;
+    return (num_points - due) / pfb->hop + 1;
+}
+
+static bool volk_pfb_channelizer_alloc_scratch(volk_pfb_channelizer_t* pfb,
+                                               size_t n_threads)
+{
+    const size_t line = volk_get_cacheline_size() > volk_get_alignment()
+                            ? volk_get_cacheline_size()
+                            : volk_get_alignment();
+    const size_t bytes =
+        (1 + VOLK_PFB_BATCH) * (size_t)pfb->num_channels * sizeof(lv_32fc_t);
+
+    if (n_threads <= pfb->scratch_threads)
+        return true;
+    volk_free(pfb->scratch);
+    // whole cache lines per thread, so threads never share one
+    pfb->thread_bytes = (bytes + line - 1) / line * line;
+    pfb->scratch = (char*)volk_malloc(n_threads * pfb->thread_bytes, line);
+    pfb->scratch_threads = pfb->scratch ? n_threads : 0;
+    return pfb->scratch != NULL;
+}
+
+// the first frame of a thread's run; the runs differ by at most one frame
+static size_t volk_pfb_channelizer_first(const volk_pfb_channelizer_run_t* run,
+                                         size_t thread)
+{
+    return run->n_frames * thread / run->n_threads;
+}
+
+// a chunk of volk_parallel_run is one thread's run of frames
+static void
+volk_pfb_channelizer_thread(void* ctx, size_t thread, size_t start, size_t count)
+{
+    const volk_pfb_channelizer_run_t* run = (const volk_pfb_channelizer_run_t*)ctx;
+    const volk_pfb_channelizer_t* pfb = run->pfb;
+    const unsigned int num_channels = pfb->num_channels;
+    const size_t kept = pfb->window - 1;
+    const size_t end = volk_pfb_channelizer_first(run, thread + 1);
+    const bool flush = volk_flush_denormals_thread;
+    const size_t first = volk_pfb_channelizer_first(run, thread);
+    lv_32fc_t* sums = (lv_32fc_t*)(pfb->scratch + thread * pfb->thread_bytes);
+    lv_32fc_t* batch = sums + num_channels;
+    size_t f;
+    (void)start;
+    (void)count;
+
+    volk_flush_denormals_thread = run->flush_denormals;
+    for (f = first; f < end; f++) {
+        // the window of the frame after input i starts i - window + 1 inputs in,
+        // before the call's inputs while i is below the kept ones
+        const size_t i = run->first + f * pfb->hop;
+        const lv_32fc_t* window = i < kept ? pfb->history + i : run->input + i - kept;
+        const unsigned int rotation = (pfb->phase + i + 1) % num_channels;
+        const size_t batched = (f - first) % VOLK_PFB_BATCH + 1;
+        lv_32fc_t* rotated = batch + (batched - 1) * num_channels;
+
+        volk_plan_execute(volk_32fc_32f_pfb_fold_32fc,
+                          pfb->fold_plan,
+                          sums,
+                          window,
+                          pfb->taps,
+                          pfb->taps_per_branch,
+                          num_channels);
+        // sum q belongs to branch num_channels - 1 - q; the rotation by the
+        // frame's input count mixes channel k down by exp(-2 pi i k t / num_channels)
+        memcpy(rotated + rotation, sums, (num_channels - rotation) * sizeof(lv_32fc_t));
+        memcpy(rotated, sums + num_channels - rotation, rotation * sizeof(lv_32fc_t));
+        // the frames are transformed a batch at a time, straight into the output
+        if (batched == VOLK_PFB_BATCH || f + 1 == end) {
+            volk_plan_execute(volk_32fc_fft_batch_32fc,
+                              pfb->fft_plan,
+                              run->output + (f + 1 - batched) * num_channels,
+                              batch,
+                              (unsigned int)batched,
+                              num_channels);
+        }
+    }
+    volk_flush_denormals_thread = flush;
+}
+
+ptrdiff_t volk_pfb_channelizer_compute(volk_pfb_channelizer_t* pfb,
+                                       lv_32fc_t* output,
+                                       const lv_32fc_t* input,
+                                       size_t num_points)
+{
+    volk_pfb_channelizer_run_t run;
+    const size_t kept = pfb->window - 1;
+    const size_t copied = num_points < kept ? num_points : kept;
+    size_t max_threads;
+
+    run.pfb = pfb;
+    run.output = output;
+    run.input = input;
+    run.first = volk_pfb_channelizer_due(pfb) - 1;
+    run.n_frames = volk_pfb_channelizer_frames(pfb, num_points);
+    // at least a grain of window points per thread
+    max_threads = run.n_frames * pfb->window / VOLK_PARALLEL_GRAIN;
+    if (max_threads > VOLK_PARALLEL_MAX_CHUNKS)
+        max_threads = VOLK_PARALLEL_MAX_CHUNKS;
+    run.n_threads = volk_get_num_threads();
+    if (run.n_threads > max_threads)
+        run.n_threads = max_threads ? max_threads : 1;
+    run.flush_denormals = volk_flush_denormals_thread;
+    if (!volk_pfb_channelizer_alloc_scratch(pfb, run.n_threads))
+        return -1;
+
+    // the windows reaching into the kept inputs read them from a copy
+    memcpy(pfb->history + kept, input, copied * sizeof(lv_32fc_t));
+    if (run.n_frames)
+        volk_parallel_run(run.n_threads, &volk_pfb_channelizer_thread, &run);
+
+    // keep the last window - 1 inputs
+    if (num_points < kept) {
+        memmove(pfb->history, pfb->history + num_points, kept * sizeof(lv_32fc_t));
+    } else {
+        memcpy(pfb->history, input + num_points - kept, kept * sizeof(lv_32fc_t));
+    }
+    pfb->phase = (unsigned int)((pfb->phase + num_points) % pfb->num_channels);
+    return (ptrdiff_t)run.n_frames;
+}
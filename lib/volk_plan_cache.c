@@ -0,0 +1,155 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#include <process.h>
+#define volk_mkdir(path) _mkdir(path)
+#define volk_getpid() _getpid()
+#else
+#include <unistd.h>
+#define volk_mkdir(path) mkdir((path), 0755)
+#define volk_getpid() getpid()
+#endif
+#if defined(HAVE_SYS_MMAN_H)
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
+#include "volk_plan_cache.h"
+#include <volk/constants.h>
+#include <volk/volk_malloc.h>
+#include <volk/volk_prefs.h>
+
+#define VOLK_PLAN_CACHE_MAGIC 0x4e4c504bu /* "KPLN" */
+
+// 64 bytes, so that the table after it keeps the alignment of the mapping
+typedef struct volk_plan_cache_header {
+    uint32_t magic;
+    uint32_t num_points;
+    uint64_t bytes;
+    char version[48]; // volk_version() of the build that wrote the table
+} volk_plan_cache_header_t;
+
+// the file of a table in the cache dir of this cpu, false without a cache
+static bool volk_plan_cache_file(char* path,
+                                 size_t len,
+                                 const char* kind,
+                                 unsigned int num_points,
+                                 bool make_dir)
+{
+    char dir[512];
+    volk_get_cache_path(dir);
+    if (!dir[0])
+        return false;
+    if (make_dir)
+        volk_mkdir(dir); // an existing dir is fine, other errors fail the open
+    return snprintf(path, len, "%s/%s-%u", dir, kind, num_points) < (int)len;
+}
+
+const void* volk_plan_cache_map(const char* kind, unsigned int num_points, size_t bytes)
+{
+    const size_t size = sizeof(volk_plan_cache_header_t) + bytes;
+    char path[600];
+    struct stat st;
+
+    if (!volk_plan_cache_file(path, sizeof(path), kind, num_points, false) ||
+        stat(path, &st) != 0 || (size_t)st.st_size != size)
+        return NULL;
+
+#if defined(HAVE_SYS_MMAN_H)
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return NULL;
+#else
+    void* map = volk_malloc(size, 64);
+    FILE* cache_file = fopen(path, "rb");
+    if (!map || !cache_file || fread(map, 1, size, cache_file) != size) {
+        if (cache_file)
+            fclose(cache_file);
+        volk_free(map);
+        return NULL;
+    }
+    fclose(cache_file);
+#endif
+
+    const volk_plan_cache_header_t* header = (const volk_plan_cache_header_t*)map;
+    const char* table = (const char*)map + sizeof(*header);
+    if (header->magic != VOLK_PLAN_CACHE_MAGIC || header->num_points != num_points ||
+        header->bytes != bytes ||
+        strncmp(header->version, volk_version(), sizeof(header->version)) != 0) {
+        volk_plan_cache_unmap(table, bytes);
+        return NULL;
+    }
+    return table;
+}
+
+void volk_plan_cache_unmap(const void* table, size_t bytes)
+{
+    if (!table)
+        return;
+    char* map = (char*)table - sizeof(volk_plan_cache_header_t);
+#if defined(HAVE_SYS_MMAN_H)
+    munmap(map, sizeof(volk_plan_cache_header_t) + bytes);
+#else
+    (void)bytes;
+    volk_free(map);
+#endif
+}
+
+void volk_plan_cache_store(const char* kind,
+                           unsigned int num_points,
+                           const void* table,
+                           size_t bytes)
+{
+    volk_plan_cache_header_t header;
+    char path[600], tmp_path[620];
+    FILE* cache_file;
+    bool ok;
+
+    if (!volk_plan_cache_file(path, sizeof(path), kind, num_points, true))
+        return;
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%ld", path, (long)volk_getpid());
+    cache_file = fopen(tmp_path, "wb");
+    if (!cache_file)
+        return;
+
+    memset(&header, 0, sizeof(header));
+    header.magic = VOLK_PLAN_CACHE_MAGIC;
+    header.num_points = num_points;
+    header.bytes = bytes;
+    strncpy(header.version, volk_version(), sizeof(header.version) - 1);
+    ok = fwrite(&header, sizeof(header), 1, cache_file) == 1 &&
+         fwrite(table, 1, bytes, cache_file) == bytes;
+    ok = (fclose(cache_file) == 0) && ok;
+    // a process that stored the same table first leaves an equal file
+    if (!ok || rename(tmp_path, path) != 0)
+        remove(tmp_path);
+}
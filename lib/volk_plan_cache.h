@@ -0,0 +1,62 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_PLAN_CACHE_H
+#define INCLUDED_VOLK_PLAN_CACHE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The warm-start cache of plan tables, files in the volk_get_cache_path()
+ * dir named after the kind of table and its length. Each file starts with
+ * a header naming the VOLK version and the table size, so that a table of
+ * another build is computed again and overwritten. The signature of the
+ * cpu is in the dir name.
+ */
+
+/*!
+ * Map the cached table of bytes bytes, read only and 64 byte aligned.
+ * \return the table, NULL when it is not cached, stale or without a cache
+ */
+const void* volk_plan_cache_map(const char* kind, unsigned int num_points, size_t bytes);
+
+//! Unmap a table of volk_plan_cache_map which is no longer needed
+void volk_plan_cache_unmap(const void* table, size_t bytes);
+
+/*!
+ * Store a table just computed, for the next process. The file is written
+ * under a temporary name and renamed, so readers never see half a table;
+ * failures leave the cache as it was.
+ */
+void volk_plan_cache_store(const char* kind,
+                           unsigned int num_points,
+                           const void* table,
+                           size_t bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDED_VOLK_PLAN_CACHE_H */
@@ -1,7 +1,9 @@
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 #if defined(_MSC_VER)
 #include <io.h>
 #define access _access
@@ -9,58 +11,197 @@
 #else
 #include <unistd.h>
 #endif
+#if defined(HAVE_SYS_MMAN_H)
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+#include <volk/volk_cpu.h>
 #include <volk/volk_prefs.h>
+#include "volk_once.h"
 
-void volk_get_config_path(char* path, bool read)
-{
-    if (!path)
-        return;
-    const char* suffix = "/.volk/volk_config";
-    const char* suffix2 = "/volk/volk_config"; // non-hidden
-    char* home = NULL;
-
-    // allows config redirection via env variable
-    home = getenv("VOLK_CONFIGPATH");
-    if (home != NULL) {
-        strncpy(path, home, 512);
-        strcat(path, suffix2);
-        if (!read || access(path, F_OK) != -1) {
-            return;
-        }
-    }
+////////////////////////////////////////////////////////////////////////
+// compiled config layout: a header, the entries sorted by kernel name
+// and a string table holding the NUL terminated names they point to.
+// The file is stored in native byte order; a foreign or stale file
+// fails the magic/version check and the text config is used instead.
+////////////////////////////////////////////////////////////////////////
+#define VOLK_PREFS_BIN_MAGIC 0x564f4c4bu /* "VOLK" */
+#define VOLK_PREFS_BIN_VERSION 1u
 
-    // check for user-local config file
-    home = getenv("HOME");
-    if (home != NULL) {
-        strncpy(path, home, 512);
-        strcat(path, suffix);
-        if (!read || (access(path, F_OK) != -1)) {
-            return;
-        }
+typedef struct volk_prefs_bin_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t n_prefs;
+    uint32_t strtab_size;
+} volk_prefs_bin_header_t;
+
+typedef struct volk_prefs_bin_entry {
+    uint32_t name;   // offset of the kernel name in the string table
+    uint32_t impl_a; // offset of the best aligned impl
+    uint32_t impl_u; // offset of the best unaligned impl
+} volk_prefs_bin_entry_t;
+
+// a cost model of the text config, "<kernel>~<impl>" and a pair per length bucket,
+// or the parallel grain of a kernel, "<kernel>~parallel"
+typedef struct volk_cost_entry {
+    char name[256];
+    double model[2 * VOLK_N_LENGTH_BUCKETS]; // overhead in ns, then ns per point,
+                                             // or thread count, then grain
+} volk_cost_entry_t;
+
+typedef struct volk_cost_models {
+    volk_cost_entry_t* entries; // sorted by name
+    size_t n_entries;
+} volk_cost_models_t;
+
+// a loaded profile, either the mapped binary index or the sorted text prefs
+typedef struct volk_profile {
+    const char* map;
+    size_t map_size;
+    const volk_prefs_bin_entry_t* entries;
+    const char* strtab;
+    size_t n_entries;
+    volk_arch_pref_t* prefs;
+    size_t n_prefs;
+} volk_profile_t;
+
+// The current profile and cost models. volk_reload_preferences publishes
+// new ones and keeps the old, which lookups running at the time may still
+// read; a reload costs the memory of one profile.
+static volk_once_t volk_prefs_loaded = VOLK_ONCE_INIT;
+static volk_profile_t* volk_profile;
+static volk_cost_models_t* volk_cost_models;
+static void volk_load_prefs(void);
+
+unsigned int volk_get_length_bucket_bound(size_t bucket)
+{
+    switch (bucket) {
+    case 0:
+        return VOLK_LENGTH_BUCKET_BOUND_0;
+    case 1:
+        return VOLK_LENGTH_BUCKET_BOUND_1;
+    case 2:
+        return VOLK_LENGTH_BUCKET_BOUND_2;
+    default:
+        return 0; // unbounded
     }
+}
 
-    // check for config file in APPDATA (Windows)
-    home = getenv("APPDATA");
-    if (home != NULL) {
-        strncpy(path, home, 512);
-        strcat(path, suffix);
-        if (!read || (access(path, F_OK) != -1)) {
-            return;
-        }
+// the directories searched for configs, in order of preference;
+// returns false past the last one and leaves dir empty for unset ones and
+// ones too long for it
+static bool volk_get_config_dir(int index, char* dir, size_t len, bool* must_exist)
+{
+    const char* home = NULL;
+    dir[0] = 0;
+    *must_exist = false;
+    switch (index) {
+    case 0: // allows config redirection via env variable, to a non-hidden dir
+        home = getenv("VOLK_CONFIGPATH");
+        if (home != NULL && snprintf(dir, len, "%s/volk", home) >= (int)len)
+            dir[0] = 0;
+        return true;
+    case 1: // user-local config file
+        home = getenv("HOME");
+        if (home != NULL && snprintf(dir, len, "%s/.volk", home) >= (int)len)
+            dir[0] = 0;
+        return true;
+    case 2: // config file in APPDATA (Windows)
+        home = getenv("APPDATA");
+        if (home != NULL && snprintf(dir, len, "%s/.volk", home) >= (int)len)
+            dir[0] = 0;
+        return true;
+    case 3: // system-wide config file, only used where it exists
+        snprintf(dir, len, "/etc/volk");
+        *must_exist = true;
+        return true;
+    default:
+        return false;
     }
+}
 
-    // check for system-wide config file
-    if (access("/etc/volk/volk_config", F_OK) != -1) {
-        strncpy(path, "/etc", 512);
-        strcat(path, suffix2);
-        if (!read || (access(path, F_OK) != -1)) {
-            return;
+// find the first of the files that exists in the config dirs; the files of
+// one dir are tried before moving on to the next. Without read the first
+// candidate is returned as is. Candidates too long for the 512 byte path
+// are skipped rather than cut short, which would name another file.
+static void volk_search_config_path(char* path,
+                                    bool read,
+                                    const char* const* files,
+                                    size_t n_files)
+{
+    char dir[512], candidate[512];
+    bool must_exist;
+    int index, n;
+    size_t i;
+    for (index = 0; volk_get_config_dir(index, dir, sizeof(dir), &must_exist); index++) {
+        if (!dir[0])
+            continue;
+        for (i = 0; i < n_files; i++) {
+            n = snprintf(candidate, sizeof(candidate), "%s/%s", dir, files[i]);
+            if (n < 0 || (size_t)n >= sizeof(candidate))
+                continue;
+            if ((!read && !must_exist) || access(candidate, F_OK) != -1) {
+                memcpy(path, candidate, (size_t)n + 1);
+                return;
+            }
         }
     }
 
     // If still no path was found set path[0] to '0' and fall through
     path[0] = 0;
-    return;
+}
+
+// the per cpu config file name relative to the config dir
+static void volk_get_cpu_config_file(char* file, size_t len)
+{
+    char signature[128];
+    volk_get_cpu_signature(signature, sizeof(signature));
+    snprintf(file, len, "volk_config.d/%s", signature);
+}
+
+void volk_get_config_path(char* path, bool read)
+{
+    const char* files[] = { "volk_config" };
+    if (!path)
+        return;
+    volk_search_config_path(path, read, files, 1);
+}
+
+void volk_get_cpu_config_path(char* path, bool read)
+{
+    char cpu_file[160];
+    const char* files[] = { cpu_file };
+    if (!path)
+        return;
+    volk_get_cpu_config_file(cpu_file, sizeof(cpu_file));
+    volk_search_config_path(path, read, files, 1);
+}
+
+void volk_get_cache_path(char* path)
+{
+    char signature[128];
+    const char* files[] = { "volk_cache" };
+    size_t len;
+    if (!path)
+        return;
+    volk_search_config_path(path, true, files, 1);
+    len = strlen(path);
+    if (path[0]) {
+        volk_get_cpu_signature(signature, sizeof(signature));
+        if (len + 1 + strlen(signature) >= 512)
+            path[0] = 0;
+        else
+            snprintf(path + len, 512 - len, "/%s", signature);
+    }
+}
+
+// the config to load: a profile of this cpu, else the shared volk_config
+static void volk_get_profile_path(char* path)
+{
+    char cpu_file[160];
+    const char* files[] = { cpu_file, "volk_config" };
+    volk_get_cpu_config_file(cpu_file, sizeof(cpu_file));
+    volk_search_config_path(path, true, files, 2);
 }
 
 size_t volk_load_preferences(volk_arch_pref_t** prefs_res)
@@ -71,7 +212,7 @@ size_t volk_load_preferences(volk_arch_pref_t** prefs_res)
     volk_arch_pref_t* prefs = NULL;
 
     // get the config path
-    volk_get_config_path(path, true);
+    volk_get_profile_path(path);
     if (!path[0])
         return n_arch_prefs; // no prefs found
     config_file = fopen(path, "r");
@@ -79,16 +220,22 @@ size_t volk_load_preferences(volk_arch_pref_t** prefs_res)
         return n_arch_prefs; // no prefs found
 
     // reset the file pointer and write the prefs into volk_arch_prefs
+    size_t capacity = 0;
     while (fgets(line, sizeof(line), config_file) != NULL) {
-        void* new_prefs = realloc(prefs, (n_arch_prefs + 1) * sizeof(*prefs));
-        if (!new_prefs) {
-            printf("volk_load_preferences: bad malloc\n");
-            break;
+        if (n_arch_prefs == capacity) {
+            capacity = capacity ? 2 * capacity : 64;
+            void* new_prefs = realloc(prefs, capacity * sizeof(*prefs));
+            if (!new_prefs) {
+                printf("volk_load_preferences: bad malloc\n");
+                break;
+            }
+            prefs = (volk_arch_pref_t*)new_prefs;
         }
-        prefs = (volk_arch_pref_t*)new_prefs;
         volk_arch_pref_t* p = prefs + n_arch_prefs;
+        // cost model lines, "<kernel>~<impl> cost ...", and parallel grain lines,
+        // "<kernel>~parallel grain ...", are read by volk_load_cost_models
         if (sscanf(line, "%s %s %s", p->name, p->impl_a, p->impl_u) == 3 &&
-            !strncmp(p->name, "volk_", 5)) {
+            !strncmp(p->name, "volk_", 5) && !strchr(p->name, '~')) {
             n_arch_prefs++;
         }
     }
@@ -96,3 +243,382 @@ size_t volk_load_preferences(volk_arch_pref_t** prefs_res)
     *prefs_res = prefs;
     return n_arch_prefs;
 }
+
+bool volk_update_preferences(const char* path,
+                             const volk_arch_pref_t* prefs,
+                             size_t n_prefs)
+{
+    char line[512], name[128];
+    char* lines = NULL;
+    size_t n_lines = 0, capacity = 0, i, j;
+    bool* written = (bool*)calloc(n_prefs ? n_prefs : 1, sizeof(*written));
+    FILE* config_file;
+
+    // keep the current contents, a missing file is simply empty
+    config_file = fopen(path, "r");
+    while (config_file && written && fgets(line, sizeof(line), config_file) != NULL) {
+        if (n_lines == capacity) {
+            capacity = capacity ? 2 * capacity : 64;
+            char* new_lines = (char*)realloc(lines, capacity * sizeof(line));
+            if (!new_lines)
+                break;
+            lines = new_lines;
+        }
+        memcpy(lines + n_lines++ * sizeof(line), line, sizeof(line));
+    }
+    if (config_file)
+        fclose(config_file);
+
+    config_file = written ? fopen(path, "w") : NULL;
+    if (!config_file) {
+        fprintf(stderr, "volk_update_preferences: cannot write %s\n", path);
+        free(lines);
+        free(written);
+        return false;
+    }
+    for (i = 0; i < n_lines; i++) {
+        const char* old_line = lines + i * sizeof(line);
+        for (j = 0; j < n_prefs; j++) {
+            if (sscanf(old_line, "%127s", name) == 1 && !strcmp(name, prefs[j].name))
+                break;
+        }
+        if (j == n_prefs) {
+            fputs(old_line, config_file);
+        } else if (!written[j]) {
+            fprintf(config_file,
+                    "%s %s %s\n",
+                    prefs[j].name,
+                    prefs[j].impl_a,
+                    prefs[j].impl_u);
+            written[j] = true;
+        }
+    }
+    for (j = 0; j < n_prefs; j++) {
+        if (!written[j])
+            fprintf(config_file,
+                    "%s %s %s\n",
+                    prefs[j].name,
+                    prefs[j].impl_a,
+                    prefs[j].impl_u);
+    }
+    const bool ok = fclose(config_file) == 0;
+    free(lines);
+    free(written);
+    return ok;
+}
+
+static int volk_compare_prefs(const void* a, const void* b)
+{
+    return strcmp(((const volk_arch_pref_t*)a)->name, ((const volk_arch_pref_t*)b)->name);
+}
+
+bool volk_write_preferences_binary(const char* path,
+                                   const volk_arch_pref_t* prefs,
+                                   size_t n_prefs)
+{
+    // a string table never needs more than the fixed size fields it packs
+    const size_t n_alloc = n_prefs ? n_prefs : 1;
+    volk_arch_pref_t* sorted = (volk_arch_pref_t*)malloc(n_alloc * sizeof(*sorted));
+    volk_prefs_bin_entry_t* entries =
+        (volk_prefs_bin_entry_t*)malloc(n_alloc * sizeof(*entries));
+    char* strtab = (char*)malloc(n_alloc * sizeof(*sorted));
+    FILE* bin_file = NULL;
+    bool ok = false;
+
+    if (sorted && entries && strtab) {
+        memcpy(sorted, prefs, n_prefs * sizeof(*sorted));
+        qsort(sorted, n_prefs, sizeof(*sorted), volk_compare_prefs);
+        bin_file = fopen(path, "wb");
+    } else {
+        fprintf(stderr, "volk_write_preferences_binary: bad malloc\n");
+    }
+
+    if (bin_file) {
+        uint32_t strtab_size = 0;
+        size_t i, f;
+        for (i = 0; i < n_prefs; i++) {
+            const char* fields[3] = { sorted[i].name,
+                                      sorted[i].impl_a,
+                                      sorted[i].impl_u };
+            uint32_t* offsets[3] = { &entries[i].name,
+                                     &entries[i].impl_a,
+                                     &entries[i].impl_u };
+            for (f = 0; f < 3; f++) {
+                const size_t len = strnlen(fields[f], sizeof(sorted[i].name) - 1);
+                *offsets[f] = strtab_size;
+                memcpy(strtab + strtab_size, fields[f], len);
+                strtab[strtab_size + len] = '\0';
+                strtab_size += (uint32_t)(len + 1);
+            }
+        }
+
+        const volk_prefs_bin_header_t header = {
+            VOLK_PREFS_BIN_MAGIC, VOLK_PREFS_BIN_VERSION, (uint32_t)n_prefs, strtab_size
+        };
+        ok = fwrite(&header, sizeof(header), 1, bin_file) == 1 &&
+             fwrite(entries, sizeof(*entries), n_prefs, bin_file) == n_prefs &&
+             fwrite(strtab, 1, strtab_size, bin_file) == strtab_size;
+        ok = (fclose(bin_file) == 0) && ok;
+    } else if (sorted && entries && strtab) {
+        fprintf(stderr, "volk_write_preferences_binary: cannot open %s\n", path);
+    }
+
+    free(sorted);
+    free(entries);
+    free(strtab);
+    return ok;
+}
+
+// map the compiled config and check that every offset stays in bounds,
+// so that lookups never have to validate again
+static bool volk_map_preferences_binary(volk_profile_t* profile, const char* path)
+{
+    struct stat st;
+    if (stat(path, &st) != 0 || (size_t)st.st_size < sizeof(volk_prefs_bin_header_t))
+        return false;
+    const size_t size = (size_t)st.st_size;
+
+#if defined(HAVE_SYS_MMAN_H)
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return false;
+#else
+    void* map = malloc(size);
+    FILE* bin_file = fopen(path, "rb");
+    if (!map || !bin_file || fread(map, 1, size, bin_file) != size) {
+        if (bin_file)
+            fclose(bin_file);
+        free(map);
+        return false;
+    }
+    fclose(bin_file);
+#endif
+
+    const volk_prefs_bin_header_t* header = (const volk_prefs_bin_header_t*)map;
+    const size_t max_prefs = size / sizeof(volk_prefs_bin_entry_t);
+    const size_t entries_size = (size_t)header->n_prefs * sizeof(volk_prefs_bin_entry_t);
+    bool valid = header->magic == VOLK_PREFS_BIN_MAGIC &&
+                 header->version == VOLK_PREFS_BIN_VERSION &&
+                 header->n_prefs <= max_prefs && header->strtab_size <= size &&
+                 size == sizeof(*header) + entries_size + header->strtab_size;
+    const volk_prefs_bin_entry_t* entries =
+        (const volk_prefs_bin_entry_t*)((const char*)map + sizeof(*header));
+    const char* strtab = (const char*)entries + entries_size;
+    if (valid && header->strtab_size)
+        valid = strtab[header->strtab_size - 1] == '\0';
+    size_t i;
+    for (i = 0; valid && i < header->n_prefs; i++) {
+        valid = entries[i].name < header->strtab_size &&
+                entries[i].impl_a < header->strtab_size &&
+                entries[i].impl_u < header->strtab_size;
+    }
+
+    if (!valid) {
+#if defined(HAVE_SYS_MMAN_H)
+        munmap(map, size);
+#else
+        free(map);
+#endif
+        return false;
+    }
+
+    profile->map = (const char*)map;
+    profile->map_size = size;
+    profile->entries = entries;
+    profile->strtab = strtab;
+    profile->n_entries = header->n_prefs;
+    return true;
+}
+
+static void volk_load_profile(volk_profile_t* profile)
+{
+    char path[512], bin_path[520];
+    struct stat text_st, bin_st;
+
+    // prefer the compiled config, unless the text config was edited after it
+    volk_get_profile_path(path);
+    if (path[0]) {
+        snprintf(bin_path, sizeof(bin_path), "%s.bin", path);
+        if (stat(path, &text_st) == 0 && stat(bin_path, &bin_st) == 0 &&
+            bin_st.st_mtime >= text_st.st_mtime &&
+            volk_map_preferences_binary(profile, bin_path)) {
+            return;
+        }
+    }
+
+    profile->n_prefs = volk_load_preferences(&profile->prefs);
+    if (profile->n_prefs) {
+        qsort(profile->prefs, profile->n_prefs, sizeof(*profile->prefs), volk_compare_prefs);
+    }
+}
+
+const char* volk_get_preferred_impl(const char* kern_name, bool align)
+{
+    volk_call_once(&volk_prefs_loaded, &volk_load_prefs);
+    const volk_profile_t* profile = VOLK_ATOMIC_LOAD_PTR(volk_profile);
+    if (!profile)
+        return NULL;
+
+    size_t lo = 0;
+    size_t hi = profile->map ? profile->n_entries : profile->n_prefs;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        int cmp;
+        if (profile->map) {
+            const volk_prefs_bin_entry_t* e = profile->entries + mid;
+            cmp = strcmp(kern_name, profile->strtab + e->name);
+            if (!cmp)
+                return profile->strtab + (align ? e->impl_a : e->impl_u);
+        } else {
+            const volk_arch_pref_t* p = profile->prefs + mid;
+            cmp = strcmp(kern_name, p->name);
+            if (!cmp)
+                return align ? p->impl_a : p->impl_u;
+        }
+        if (cmp < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return NULL;
+}
+
+static bool volk_parse_cost_model(const char* line, volk_cost_entry_t* entry)
+{
+    char tag[8];
+    char* end;
+    int offset = 0;
+    size_t i;
+
+    if (sscanf(line, "%255s %7s%n", entry->name, tag, &offset) != 2 ||
+        (strcmp(tag, "cost") && strcmp(tag, "grain")) || !strchr(entry->name, '~'))
+        return false;
+    line += offset;
+    for (i = 0; i < 2 * VOLK_N_LENGTH_BUCKETS; i++) {
+        entry->model[i] = strtod(line, &end);
+        if (end == line)
+            return false;
+        line = end;
+    }
+    return true;
+}
+
+static int volk_compare_cost_entries(const void* a, const void* b)
+{
+    return strcmp(((const volk_cost_entry_t*)a)->name,
+                  ((const volk_cost_entry_t*)b)->name);
+}
+
+// the compiled config carries no cost models, they always come from the text
+static void volk_load_cost_models(volk_cost_models_t* models)
+{
+    FILE* config_file;
+    char path[512], line[512];
+    size_t capacity = 0;
+
+    volk_get_profile_path(path);
+    config_file = path[0] ? fopen(path, "r") : NULL;
+    if (!config_file)
+        return;
+    while (fgets(line, sizeof(line), config_file) != NULL) {
+        if (models->n_entries == capacity) {
+            capacity = capacity ? 2 * capacity : 64;
+            void* new_entries =
+                realloc(models->entries, capacity * sizeof(volk_cost_entry_t));
+            if (!new_entries) {
+                fprintf(stderr, "volk_load_cost_models: bad malloc\n");
+                break;
+            }
+            models->entries = (volk_cost_entry_t*)new_entries;
+        }
+        if (volk_parse_cost_model(line,
+                                  models->entries + models->n_entries)) {
+            models->n_entries++;
+        }
+    }
+    fclose(config_file);
+    if (models->n_entries) {
+        qsort(models->entries,
+              models->n_entries,
+              sizeof(*models->entries),
+              volk_compare_cost_entries);
+    }
+}
+
+// the "<kernel>~<impl>" entry of the cost models, NULL if there is none
+static const volk_cost_entry_t* volk_find_cost_entry(const char* kern_name,
+                                                     const char* impl_name)
+{
+    volk_cost_entry_t key;
+
+    volk_call_once(&volk_prefs_loaded, &volk_load_prefs);
+    const volk_cost_models_t* models = VOLK_ATOMIC_LOAD_PTR(volk_cost_models);
+    if (!models || !models->n_entries ||
+        snprintf(key.name, sizeof(key.name), "%s~%s", kern_name, impl_name) >=
+            (int)sizeof(key.name))
+        return NULL;
+    return (const volk_cost_entry_t*)bsearch(&key,
+                                             models->entries,
+                                             models->n_entries,
+                                             sizeof(*models->entries),
+                                             volk_compare_cost_entries);
+}
+
+bool volk_get_cost_model(const char* kern_name,
+                         const char* impl_name,
+                         size_t bucket,
+                         double* overhead_ns,
+                         double* ns_per_point)
+{
+    const volk_cost_entry_t* entry;
+
+    if (bucket >= VOLK_N_LENGTH_BUCKETS ||
+        !(entry = volk_find_cost_entry(kern_name, impl_name)))
+        return false;
+    *overhead_ns = entry->model[2 * bucket];
+    *ns_per_point = entry->model[2 * bucket + 1];
+    return true;
+}
+
+bool volk_get_parallel_grain(const char* kern_name,
+                             size_t bucket,
+                             unsigned int* n_threads,
+                             size_t* grain)
+{
+    const volk_cost_entry_t* entry;
+
+    if (bucket >= VOLK_N_LENGTH_BUCKETS ||
+        !(entry = volk_find_cost_entry(kern_name, "parallel")) ||
+        entry->model[2 * bucket] < 1.0 || entry->model[2 * bucket + 1] < 1.0)
+        return false;
+    *n_threads = (unsigned int)entry->model[2 * bucket];
+    *grain = (size_t)entry->model[2 * bucket + 1];
+    return true;
+}
+
+// load a new profile and cost models and publish them
+static void volk_load_prefs(void)
+{
+    volk_profile_t* profile = (volk_profile_t*)calloc(1, sizeof(*profile));
+    volk_cost_models_t* models = (volk_cost_models_t*)calloc(1, sizeof(*models));
+    if (!profile || !models) {
+        fprintf(stderr, "volk_load_prefs: bad malloc\n");
+        free(profile);
+        free(models);
+        return;
+    }
+    volk_load_profile(profile);
+    volk_load_cost_models(models);
+    VOLK_ATOMIC_STORE_PTR(volk_profile, profile);
+    VOLK_ATOMIC_STORE_PTR(volk_cost_models, models);
+}
+
+void volk_reload_preferences(void)
+{
+    volk_call_once(&volk_prefs_loaded, &volk_load_prefs);
+    volk_load_prefs();
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "volk_fpmode.h"
+#include "volk_parallel.h"
+#include <volk/volk.h>
+#include <volk/volk_psd.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+struct volk_psd_welch {
+    unsigned int fft_len;
+    unsigned int hop;
+    float* window;
+    float norm; // sqrt(sample_rate * sum of window[n]^2), divided out of X
+    volk_plan_t* window_plan;
+    volk_plan_t* fft_plan;
+    volk_plan_t* average_plan;
+    bool centered;
+    // kept between runs: per thread a segment, its transform and a mean
+    char* scratch;
+    size_t scratch_threads;
+    size_t thread_bytes;
+};
+
+typedef struct volk_psd_welch_run {
+    const volk_psd_welch_t* welch;
+    const lv_32fc_t* input;
+    size_t n_segments;
+    size_t n_threads;
+    bool flush_denormals; // the caller's volk_set_flush_denormals, for the pool threads
+} volk_psd_welch_run_t;
+
+volk_psd_welch_t* volk_psd_welch_create(unsigned int fft_len,
+                                        unsigned int hop,
+                                        const float* window,
+                                        float sample_rate,
+                                        unsigned int flags)
+{
+    volk_psd_welch_t* welch;
+    const size_t align = volk_get_alignment();
+    double energy = 0.0;
+    unsigned int n;
+
+    if (fft_len < 2 || (fft_len & (fft_len - 1)) || hop == 0 || !(sample_rate > 0.f))
+        return NULL;
+    welch = (volk_psd_welch_t*)calloc(1, sizeof(volk_psd_welch_t));
+    if (!welch)
+        return NULL;
+    welch->fft_len = fft_len;
+    welch->hop = hop;
+    welch->centered = (flags & VOLK_PSD_WELCH_CENTERED) != 0;
+    welch->window = (float*)volk_malloc(fft_len * sizeof(float), align);
+    welch->window_plan =
+        volk_plan_create(welch->centered ? "volk_32fc_32f_window_fftshift_32fc"
+                                         : "volk_32fc_32f_multiply_32fc",
+                         fft_len,
+                         0);
+    welch->fft_plan = volk_plan_create("volk_32fc_fft_32fc", fft_len, VOLK_PLAN_ALIGNED);
+    welch->average_plan = volk_plan_create(
+        "volk_32fc_s32f_x2_power_average_32f", fft_len, VOLK_PLAN_ALIGNED);
+    if (!welch->window || !welch->window_plan || !welch->fft_plan ||
+        !welch->average_plan) {
+        volk_psd_welch_destroy(welch);
+        return NULL;
+    }
+
+    for (n = 0; n < fft_len; n++) {
+        welch->window[n] =
+            window ? window[n] : (float)(0.5 - 0.5 * cos(2.0 * M_PI * n / fft_len));
+        energy += (double)welch->window[n] * welch->window[n];
+    }
+    if (!(energy > 0.0)) {
+        volk_psd_welch_destroy(welch);
+        return NULL;
+    }
+    welch->norm = (float)sqrt(sample_rate * energy);
+    return welch;
+}
+
+void volk_psd_welch_destroy(volk_psd_welch_t* welch)
+{
+    if (!welch)
+        return;
+    volk_plan_destroy(welch->window_plan);
+    volk_plan_destroy(welch->fft_plan);
+    volk_plan_destroy(welch->average_plan);
+    volk_free(welch->window);
+    volk_free(welch->scratch);
+    free(welch);
+}
+
+size_t volk_psd_welch_segments(const volk_psd_welch_t* welch, size_t num_points)
+{
+    if (num_points < welch->fft_len)
+        return 0;
+    return (num_points - welch->fft_len) / welch->hop + 1;
+}
+
+static bool volk_psd_welch_alloc_scratch(volk_psd_welch_t* welch, size_t n_threads)
+{
+    const size_t line = volk_get_cacheline_size() > volk_get_alignment()
+                            ? volk_get_cacheline_size()
+                            : volk_get_alignment();
+    const size_t bytes =
+        (size_t)welch->fft_len * (2 * sizeof(lv_32fc_t) + sizeof(float));
+
+    if (n_threads <= welch->scratch_threads)
+        return true;
+    volk_free(welch->scratch);
+    // whole cache lines per thread, so threads never share one
+    welch->thread_bytes = (bytes + line - 1) / line * line;
+    welch->scratch = (char*)volk_malloc(n_threads * welch->thread_bytes, line);
+    welch->scratch_threads = welch->scratch ? n_threads : 0;
+    return welch->scratch != NULL;
+}
+
+// a thread's buffers: the windowed segment, its transform and its mean
+static void volk_psd_welch_buffers(const volk_psd_welch_t* welch,
+                                   size_t thread,
+                                   lv_32fc_t** segment,
+                                   lv_32fc_t** spectrum,
+                                   float** mean)
+{
+    char* buffers = welch->scratch + thread * welch->thread_bytes;
+    *segment = (lv_32fc_t*)buffers;
+    *spectrum = *segment + welch->fft_len;
+    *mean = (float*)(*spectrum + welch->fft_len);
+}
+
+// the first segment of a thread's run; the runs differ by at most one segment
+static size_t volk_psd_welch_first(const volk_psd_welch_run_t* run, size_t thread)
+{
+    return run->n_segments * thread / run->n_threads;
+}
+
+// a chunk of volk_parallel_run is one thread's run of segments
+static void volk_psd_welch_thread(void* ctx, size_t thread, size_t start, size_t count)
+{
+    const volk_psd_welch_run_t* run = (const volk_psd_welch_run_t*)ctx;
+    const volk_psd_welch_t* welch = run->welch;
+    const unsigned int fft_len = welch->fft_len;
+    const size_t end = volk_psd_welch_first(run, thread + 1);
+    const bool flush = volk_flush_denormals_thread;
+    lv_32fc_t *segment, *spectrum;
+    float* mean;
+    size_t s, k = 0;
+    (void)start;
+    (void)count;
+
+    volk_flush_denormals_thread = run->flush_denormals;
+    volk_psd_welch_buffers(welch, thread, &segment, &spectrum, &mean);
+    memset(mean, 0, fft_len * sizeof(float));
+    for (s = volk_psd_welch_first(run, thread); s < end; s++) {
+        const lv_32fc_t* input = run->input + s * welch->hop;
+        if (welch->centered) {
+            volk_plan_execute(volk_32fc_32f_window_fftshift_32fc,
+                              welch->window_plan,
+                              segment,
+                              input,
+                              welch->window,
+                              fft_len);
+        } else {
+            volk_plan_execute(volk_32fc_32f_multiply_32fc,
+                              welch->window_plan,
+                              segment,
+                              input,
+                              welch->window,
+                              fft_len);
+        }
+        volk_plan_execute(
+            volk_32fc_fft_32fc, welch->fft_plan, spectrum, segment, fft_len);
+        // a weight of 1 / k keeps the mean of the k segments so far
+        volk_plan_execute(volk_32fc_s32f_x2_power_average_32f,
+                          welch->average_plan,
+                          NULL,
+                          mean,
+                          spectrum,
+                          welch->norm,
+                          1.f / (float)++k,
+                          fft_len);
+    }
+    volk_flush_denormals_thread = flush;
+}
+
+int volk_psd_welch_compute(volk_psd_welch_t* welch,
+                           float* psd,
+                           const lv_32fc_t* input,
+                           size_t num_points)
+{
+    volk_psd_welch_run_t run;
+    lv_32fc_t *segment, *spectrum;
+    float* mean;
+    size_t max_threads, thread, segments;
+
+    run.welch = welch;
+    run.input = input;
+    run.n_segments = volk_psd_welch_segments(welch, num_points);
+    if (!run.n_segments)
+        return -1;
+    // at least a grain of transformed points per thread
+    max_threads = run.n_segments * welch->fft_len / VOLK_PARALLEL_GRAIN;
+    if (max_threads > VOLK_PARALLEL_MAX_CHUNKS)
+        max_threads = VOLK_PARALLEL_MAX_CHUNKS;
+    run.n_threads = volk_get_num_threads();
+    if (run.n_threads > max_threads)
+        run.n_threads = max_threads ? max_threads : 1;
+    run.flush_denormals = volk_flush_denormals_thread;
+    if (!volk_psd_welch_alloc_scratch(welch, run.n_threads))
+        return -1;
+
+    volk_parallel_run(run.n_threads, &volk_psd_welch_thread, &run);
+
+    // the overall mean is that of the threads' means, weighted by their segments
+    for (thread = 0; thread < run.n_threads; thread++) {
+        volk_psd_welch_buffers(welch, thread, &segment, &spectrum, &mean);
+        segments =
+            volk_psd_welch_first(&run, thread + 1) - volk_psd_welch_first(&run, thread);
+        const float weight = (float)segments / (float)run.n_segments;
+        if (thread == 0)
+            volk_32f_s32f_multiply_32f(psd, mean, weight, welch->fft_len);
+        else
+            volk_32f_x2_s32f_axpy_32f(psd, mean, psd, weight, welch->fft_len);
+    }
+    return 0;
+}
@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <volk/volk_config_fixed.h>
 #include <volk/volk_prefs.h>
 #include <volk_rank_archs.h>
 
@@ -44,22 +45,27 @@ int volk_get_index(const char* impl_names[], // list of implementations by name
     return volk_get_index(impl_names, n_impls, "generic"); // but we'll fake it for now
 }
 
-int volk_rank_archs(const char* kern_name,    // name of the kernel to rank
-                    const char* impl_names[], // list of implementations by name
-                    const int* impl_deps,     // requirement mask per implementation
-                    const bool* alignment,    // alignment status of each implementation
-                    size_t n_impls,           // number of implementations available
-                    const bool align          // if false, filter aligned implementations
-)
+// the index of impl_name, or -1 when it is NULL or not one of impl_names
+static int volk_find_index(const char* impl_names[], size_t n_impls, const char* impl_name)
 {
     size_t i;
-    static volk_arch_pref_t* volk_arch_prefs;
-    static size_t n_arch_prefs = 0;
-    static int prefs_loaded = 0;
-    if (!prefs_loaded) {
-        n_arch_prefs = volk_load_preferences(&volk_arch_prefs);
-        prefs_loaded = 1;
+    for (i = 0; impl_name && i < n_impls; i++) {
+        if (!strncmp(impl_names[i], impl_name, 20)) {
+            return (int)i;
+        }
     }
+    return -1;
+}
+
+int volk_rank_archs(const char* kern_name,     // name of the kernel to rank
+                    const char* impl_names[],  // list of implementations by name
+                    const uint64_t* impl_deps, // requirement mask per implementation
+                    const bool* alignment,     // alignment status of each implementation
+                    size_t n_impls,            // number of implementations available
+                    const bool align           // if false, filter aligned implementations
+)
+{
+    size_t i;
 
     // If we've defined VOLK_GENERIC to be anything, always return the
     // 'generic' kernel. Used in GR's QA code.
@@ -68,39 +74,137 @@ int volk_rank_archs(const char* kern_name,    // name of the kernel to rank
         return volk_get_index(impl_names, n_impls, "generic");
     }
 
-    // now look for the function name in the prefs list
-    for (i = 0; i < n_arch_prefs; i++) {
-        if (!strncmp(kern_name,
-                     volk_arch_prefs[i].name,
-                     sizeof(volk_arch_prefs[i].name))) // found it
-        {
-            const char* impl_name =
-                align ? volk_arch_prefs[i].impl_a : volk_arch_prefs[i].impl_u;
-            return volk_get_index(impl_names, n_impls, impl_name);
-        }
+    // now look for the function name in the prefs list; a preferred impl which
+    // the machine does not have (e.g. capped by VOLK_MAX_ARCH) is ranked instead
+    const int pref_index =
+        volk_find_index(impl_names, n_impls, volk_get_preferred_impl(kern_name, align));
+    if (pref_index >= 0) {
+        return pref_index;
     }
 
-    // return the best index with the largest deps
+    // then for the defaults the machine was built with
+    const int default_index =
+        volk_find_index(impl_names, n_impls, volk_get_default_impl(kern_name, align));
+    if (default_index >= 0) {
+        return default_index;
+    }
+
+    // return the best index with the largest deps; offloaded impls only pay
+    // off above a profiled length, so only a pref selects them
     size_t best_index_a = 0;
     size_t best_index_u = 0;
-    int best_value_a = -1;
-    int best_value_u = -1;
+    bool found_a = false;
+    bool found_u = false;
+    uint64_t best_value_a = 0;
+    uint64_t best_value_u = 0;
     for (i = 0; i < n_impls; i++) {
-        const signed val = impl_deps[i];
-        if (alignment[i] && val > best_value_a) {
+        const uint64_t val = impl_deps[i];
+        if (val & VOLK_OFFLOAD_ARCHS)
+            continue;
+        if (alignment[i] && (!found_a || val > best_value_a)) {
             best_index_a = i;
             best_value_a = val;
+            found_a = true;
         }
-        if (!alignment[i] && val > best_value_u) {
+        if (!alignment[i] && (!found_u || val > best_value_u)) {
             best_index_u = i;
             best_value_u = val;
+            found_u = true;
         }
     }
 
     // when align and we found a best aligned, use it
-    if (align && best_value_a != -1)
+    if (align && found_a)
         return best_index_a;
 
     // otherwise return the best unaligned
     return best_index_u;
 }
+
+int volk_rank_archs_bucket(const char* kern_name,     // name of the kernel to rank
+                           const char* impl_names[],  // list of implementations by name
+                           const uint64_t* impl_deps, // requirement mask per impl
+                           const bool* alignment,     // alignment status of each impl
+                           size_t n_impls,            // number of impls available
+                           const bool align,   // if false, filter aligned impls
+                           const size_t bucket // vector length bucket to rank for
+)
+{
+    const unsigned int bound = volk_get_length_bucket_bound(bucket);
+
+    // a bucket specific pref wins, everything else falls back to the default;
+    // the unbounded last bucket is named after the bound it starts above
+    if ((bound || bucket == VOLK_N_LENGTH_BUCKETS - 1) && !getenv("VOLK_GENERIC")) {
+        char bucket_name[sizeof(((volk_arch_pref_t*)NULL)->name)];
+        if (bound) {
+            snprintf(bucket_name, sizeof(bucket_name), "%s@%u", kern_name, bound);
+        } else {
+            snprintf(bucket_name,
+                     sizeof(bucket_name),
+                     "%s@>%u",
+                     kern_name,
+                     volk_get_length_bucket_bound(bucket - 1));
+        }
+        const int pref_index = volk_find_index(
+            impl_names, n_impls, volk_get_preferred_impl(bucket_name, align));
+        if (pref_index >= 0) {
+            return pref_index;
+        }
+    }
+
+    return volk_rank_archs(kern_name, impl_names, impl_deps, alignment, n_impls, align);
+}
+
+int volk_rank_archs_core_class(const char* kern_name,
+                               const char* impl_names[],
+                               size_t n_impls,
+                               const bool align,
+                               const unsigned int core_class)
+{
+    if (getenv("VOLK_GENERIC")) {
+        return -1;
+    }
+    char class_name[sizeof(((volk_arch_pref_t*)NULL)->name)];
+    snprintf(class_name, sizeof(class_name), "%s#%u", kern_name, core_class);
+    return volk_find_index(impl_names, n_impls, volk_get_preferred_impl(class_name, align));
+}
+
+int volk_rank_archs_within(const int index,
+                           const uint64_t* impl_deps,
+                           const bool* alignment,
+                           const float* impl_errors,
+                           size_t n_impls,
+                           const bool align,
+                           const float max_error)
+{
+    size_t i;
+    int best_index_a = -1;
+    int best_index_u = -1;
+    int closest_index = -1;
+
+    if (max_error <= 0 || (impl_errors[index] >= 0 && impl_errors[index] <= max_error)) {
+        return index;
+    }
+
+    // rank those meeting the budget as volk_rank_archs does; should none, the
+    // most accurate measured one is the closest to it
+    for (i = 0; i < n_impls; i++) {
+        const uint64_t val = impl_deps[i];
+        if (impl_errors[i] < 0 || (val & VOLK_OFFLOAD_ARCHS) || (alignment[i] && !align))
+            continue;
+        if (closest_index < 0 || impl_errors[i] < impl_errors[closest_index])
+            closest_index = (int)i;
+        if (impl_errors[i] > max_error)
+            continue;
+        if (alignment[i] && (best_index_a < 0 || val > impl_deps[best_index_a]))
+            best_index_a = (int)i;
+        if (!alignment[i] && (best_index_u < 0 || val > impl_deps[best_index_u]))
+            best_index_u = (int)i;
+    }
+
+    if (best_index_a >= 0)
+        return best_index_a;
+    if (best_index_u >= 0)
+        return best_index_u;
+    return closest_index >= 0 ? closest_index : index;
+}
@@ -23,6 +23,7 @@
 #define INCLUDED_VOLK_RANK_ARCHS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #ifdef __cplusplus
@@ -34,12 +35,45 @@ int volk_get_index(const char* impl_names[], // list of implementations by name
                    const char* impl_name     // the implementation name to find
 );
 
-int volk_rank_archs(const char* kern_name,    // name of the kernel to rank
-                    const char* impl_names[], // list of implementations by name
-                    const int* impl_deps,     // requirement mask per implementation
-                    const bool* alignment,    // alignment status of each implementation
-                    size_t n_impls,           // number of implementations available
-                    const bool align          // if false, filter aligned implementations
+// the impl the running machine ranks a kernel with when the profile has
+// none, e.g. one tuned for a micro-architecture; NULL when it has none
+const char* volk_get_default_impl(const char* kern_name, bool align);
+
+int volk_rank_archs(const char* kern_name,     // name of the kernel to rank
+                    const char* impl_names[],  // list of implementations by name
+                    const uint64_t* impl_deps, // requirement mask per implementation
+                    const bool* alignment,     // alignment status of each implementation
+                    size_t n_impls,            // number of implementations available
+                    const bool align           // if false, filter aligned implementations
+);
+
+int volk_rank_archs_bucket(const char* kern_name,     // name of the kernel to rank
+                           const char* impl_names[],  // list of implementations by name
+                           const uint64_t* impl_deps, // requirement mask per impl
+                           const bool* alignment,     // alignment status of each impl
+                           size_t n_impls,            // number of impls available
+                           const bool align,   // if false, filter aligned impls
+                           const size_t bucket // vector length bucket to rank for
+);
+
+// the impl preferred on one core class ("<kernel>#<class>" in the
+// profile), or -1 when the profile has none and the default ranking applies
+int volk_rank_archs_core_class(const char* kern_name,    // name of the kernel
+                               const char* impl_names[], // list of impl names
+                               size_t n_impls,           // number of impls available
+                               const bool align,         // aligned or unaligned pref
+                               const unsigned int core_class // core class to rank for
+);
+
+// index, the ranked impl, when its measured max error is within max_error
+// or max_error is 0; otherwise the impl ranked best of those within it
+int volk_rank_archs_within(const int index,             // the ranked impl
+                           const uint64_t* impl_deps,   // requirement mask per impl
+                           const bool* alignment,       // alignment status of each impl
+                           const float* impl_errors,    // max error per impl, -1 if unknown
+                           size_t n_impls,              // number of impls available
+                           const bool align,            // if false, filter aligned impls
+                           const float max_error        // the budget, 0 for none
 );
 
 #ifdef __cplusplus
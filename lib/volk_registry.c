@@ -0,0 +1,183 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(HAVE_DLFCN_H)
+#include <dlfcn.h>
+#endif
+
+#include "volk_once.h"
+#include "volk_rank_archs.h"
+#include <volk/volk.h>
+#include <volk/volk_cpu.h>
+
+typedef void (*volk_registry_fn_t)(void);
+
+// a registered kernel holding the impls the machine can run; nodes are
+// never changed nor freed once pushed, so readers walk the list unlocked
+typedef struct volk_registry_node {
+    volk_kernel_registration_t kernel;
+    size_t index; // order of registration
+    struct volk_registry_node* next;
+} volk_registry_node_t;
+
+static volk_registry_node_t* volk_registry_head = NULL;
+
+static void volk_registry_free(volk_registry_node_t* node)
+{
+    free((void*)node->kernel.impl_names);
+    free((void*)node->kernel.impl_deps);
+    free((void*)node->kernel.impl_alignment);
+    free((void*)node->kernel.impls);
+    free(node);
+}
+
+// copy the kernel keeping the impls this machine can run, as the machine
+// tables of the core kernels do
+static volk_registry_node_t* volk_registry_filter(const volk_kernel_registration_t* kernel)
+{
+    const uint64_t lvarch = volk_get_lvarch();
+    volk_registry_node_t* node = (volk_registry_node_t*)calloc(1, sizeof(*node));
+    if (!node)
+        return NULL;
+    const size_t n = kernel->n_impls;
+    const char** names = (const char**)malloc(n * sizeof(*names));
+    uint64_t* deps = (uint64_t*)malloc(n * sizeof(*deps));
+    bool* alignment = (bool*)malloc(n * sizeof(*alignment));
+    volk_registry_fn_t* impls = (volk_registry_fn_t*)malloc(n * sizeof(*impls));
+    node->kernel = *kernel;
+    node->kernel.impl_names = names;
+    node->kernel.impl_deps = deps;
+    node->kernel.impl_alignment = alignment;
+    node->kernel.impls = impls;
+    node->kernel.n_impls = 0;
+    if (!names || !deps || !alignment || !impls) {
+        volk_registry_free(node);
+        return NULL;
+    }
+
+    size_t i, n_kept = 0;
+    for (i = 0; i < n; i++) {
+        if (kernel->impl_deps[i] & ~lvarch)
+            continue;
+        names[n_kept] = kernel->impl_names[i];
+        deps[n_kept] = kernel->impl_deps[i];
+        alignment[n_kept] = kernel->impl_alignment[i];
+        impls[n_kept] = kernel->impls[i];
+        n_kept++;
+    }
+    node->kernel.n_impls = n_kept;
+    return node;
+}
+
+static bool volk_registry_has_generic(const volk_kernel_registration_t* kernel)
+{
+    size_t i;
+    for (i = 0; i < kernel->n_impls; i++) {
+        if (!strcmp(kernel->impl_names[i], "generic"))
+            return true;
+    }
+    return false;
+}
+
+bool volk_register_kernel(const volk_kernel_registration_t* kernel)
+{
+    if (!kernel || !kernel->name || !kernel->manual)
+        return false;
+
+    volk_registry_node_t* node = volk_registry_filter(kernel);
+    if (!node)
+        return false;
+    // volk_get_index falls back to the generic impl for unknown prefs
+    if (!volk_registry_has_generic(&node->kernel)) {
+        volk_registry_free(node);
+        return false;
+    }
+
+    volk_registry_node_t* head;
+    do {
+        head = (volk_registry_node_t*)VOLK_ATOMIC_LOAD_PTR(volk_registry_head);
+        const volk_registry_node_t* it;
+        for (it = head; it; it = it->next) {
+            if (!strcmp(it->kernel.name, kernel->name)) {
+                volk_registry_free(node);
+                return false;
+            }
+        }
+        node->index = head ? head->index + 1 : 0;
+        node->next = head;
+    } while (!VOLK_ATOMIC_CAS_PTR(volk_registry_head, head, node));
+
+    // bind the way the core kernels are bound, from the same volk_config
+    const volk_kernel_registration_t* k = &node->kernel;
+    if (k->bind_a) {
+        const int index = volk_rank_archs(
+            k->name, k->impl_names, k->impl_deps, k->impl_alignment, k->n_impls, true);
+        VOLK_ATOMIC_STORE_PTR(*k->bind_a, k->impls[index]);
+    }
+    if (k->bind_u) {
+        const int index = volk_rank_archs(
+            k->name, k->impl_names, k->impl_deps, k->impl_alignment, k->n_impls, false);
+        VOLK_ATOMIC_STORE_PTR(*k->bind_u, k->impls[index]);
+    }
+    return true;
+}
+
+size_t volk_get_registered_kernels(const volk_kernel_registration_t** kernels,
+                                   size_t n_kernels)
+{
+    const volk_registry_node_t* it =
+        (const volk_registry_node_t*)VOLK_ATOMIC_LOAD_PTR(volk_registry_head);
+    const size_t count = it ? it->index + 1 : 0;
+    for (; it && kernels; it = it->next) {
+        if (it->index < n_kernels)
+            kernels[it->index] = &it->kernel;
+    }
+    return count;
+}
+
+bool volk_load_kernel_module(const char* path)
+{
+    typedef bool (*volk_module_register_t)(void);
+    volk_module_register_t module_register;
+    if (!path)
+        return false;
+    // the module stays loaded for the life of the process
+#if defined(_WIN32)
+    HMODULE module = LoadLibraryA(path);
+    if (!module)
+        return false;
+    module_register =
+        (volk_module_register_t)GetProcAddress(module, "volk_module_register");
+#elif defined(HAVE_DLFCN_H)
+    void* module = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!module)
+        return false;
+    *(void**)&module_register = dlsym(module, "volk_module_register");
+#else
+    return false;
+#endif
+    return module_register ? module_register() : true;
+}
@@ -0,0 +1,289 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_stats.h>
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_PTHREAD_H)
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////
+// The publisher: a thread which copies volk_get_kernel_stats() into the
+// segment under the seqlock every period, and once more when it stops.
+// Copies are not atomic with respect to the counting, so one counter may
+// be a few calls ahead of another; the seqlock only keeps a reader from
+// seeing a half written copy.
+////////////////////////////////////////////////////////////////////////
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_t thread;
+    bool running;
+    bool stop;
+    bool atexit_done;
+    char name[256];
+    volk_stats_shm_t* shm;
+    size_t bytes;
+    volk_kernel_stats_t* stats;
+} volk_stats_pub = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER };
+
+static void volk_stats_copy_string(char* dst, size_t size, const char* src)
+{
+    memset(dst, 0, size);
+    if (src)
+        strncpy(dst, src, size - 1);
+}
+
+static void volk_stats_publish(void)
+{
+    volk_stats_shm_t* shm = volk_stats_pub.shm;
+    volk_stats_shm_kernel_t* kernels = volk_stats_shm_kernels(shm);
+    const size_t n = volk_get_kernel_stats(volk_stats_pub.stats, shm->n_kernels);
+    struct timespec now;
+    size_t i;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    const uint64_t seq = shm->seq;
+    __atomic_store_n(&shm->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for (i = 0; i < n && i < shm->n_kernels; i++) {
+        const volk_kernel_stats_t* stats = &volk_stats_pub.stats[i];
+        volk_stats_copy_string(kernels[i].name, sizeof(kernels[i].name), stats->name);
+        volk_stats_copy_string(
+            kernels[i].impl_a, sizeof(kernels[i].impl_a), stats->impl_a);
+        volk_stats_copy_string(
+            kernels[i].impl_u, sizeof(kernels[i].impl_u), stats->impl_u);
+        kernels[i].calls = stats->calls;
+        kernels[i].points = stats->points;
+        kernels[i].bytes = stats->bytes;
+        memcpy(kernels[i].lengths, stats->lengths, sizeof(kernels[i].lengths));
+    }
+    shm->updated = (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+    __atomic_store_n(&shm->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+static void* volk_stats_worker(void* arg)
+{
+    (void)arg;
+    // the machine is only known once the init which may have started
+    // publishing is done, so it is looked up here rather than by the caller
+    volk_stats_copy_string(volk_stats_pub.shm->machine,
+                           sizeof(volk_stats_pub.shm->machine),
+                           volk_get_machine());
+
+    pthread_mutex_lock(&volk_stats_pub.lock);
+    while (!volk_stats_pub.stop) {
+        struct timespec deadline;
+        const unsigned int period_ms = volk_stats_pub.shm->period_ms;
+        volk_stats_publish();
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += period_ms / 1000;
+        deadline.tv_nsec += (long)(period_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        while (!volk_stats_pub.stop &&
+               pthread_cond_timedwait(
+                   &volk_stats_pub.wake, &volk_stats_pub.lock, &deadline) != ETIMEDOUT) {
+        }
+    }
+    volk_stats_publish();
+    pthread_mutex_unlock(&volk_stats_pub.lock);
+    return NULL;
+}
+
+static void volk_stats_stop(void)
+{
+    pthread_mutex_lock(&volk_stats_pub.lock);
+    volk_stats_pub.stop = true;
+    pthread_cond_signal(&volk_stats_pub.wake);
+    pthread_mutex_unlock(&volk_stats_pub.lock);
+    pthread_join(volk_stats_pub.thread, NULL);
+
+    munmap(volk_stats_pub.shm, volk_stats_pub.bytes);
+    shm_unlink(volk_stats_pub.name);
+    free(volk_stats_pub.stats);
+    volk_stats_pub.shm = NULL;
+    volk_stats_pub.stats = NULL;
+    volk_stats_pub.running = false;
+}
+
+static bool volk_stats_start(const char* name, unsigned int period_ms)
+{
+    const size_t n_kernels = volk_get_kernel_stats(NULL, 0);
+    const size_t bytes =
+        sizeof(volk_stats_shm_t) + n_kernels * sizeof(volk_stats_shm_kernel_t);
+    int fd;
+
+    if (!n_kernels)
+        return false;
+    if (!name[0])
+        snprintf(volk_stats_pub.name,
+                 sizeof(volk_stats_pub.name),
+                 VOLK_STATS_SHM_PREFIX "%ld",
+                 (long)getpid());
+    else
+        snprintf(volk_stats_pub.name,
+                 sizeof(volk_stats_pub.name),
+                 "%s%s",
+                 name[0] == '/' ? "" : "/",
+                 name);
+
+    // a segment left behind by a crashed process of the same name is replaced
+    shm_unlink(volk_stats_pub.name);
+    fd = shm_open(volk_stats_pub.name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0)
+        return false;
+    if (ftruncate(fd, (off_t)bytes) != 0) {
+        close(fd);
+        shm_unlink(volk_stats_pub.name);
+        return false;
+    }
+    void* map = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    volk_stats_pub.stats =
+        (volk_kernel_stats_t*)calloc(n_kernels, sizeof(volk_kernel_stats_t));
+    if (map == MAP_FAILED || !volk_stats_pub.stats) {
+        if (map != MAP_FAILED)
+            munmap(map, bytes);
+        free(volk_stats_pub.stats);
+        volk_stats_pub.stats = NULL;
+        shm_unlink(volk_stats_pub.name);
+        return false;
+    }
+
+    // the segment is zero filled, so seq starts out even
+    volk_stats_pub.shm = (volk_stats_shm_t*)map;
+    volk_stats_pub.bytes = bytes;
+    volk_stats_pub.shm->version = VOLK_STATS_SHM_VERSION;
+    volk_stats_pub.shm->n_kernels = (uint32_t)n_kernels;
+    volk_stats_pub.shm->kernel_size = (uint32_t)sizeof(volk_stats_shm_kernel_t);
+    volk_stats_pub.shm->period_ms = period_ms ? period_ms : 1000;
+    volk_stats_pub.shm->pid = (int64_t)getpid();
+#ifdef __linux__
+    FILE* comm = fopen("/proc/self/comm", "r");
+    if (comm) {
+        char* process = volk_stats_pub.shm->process;
+        char* nl;
+        if (fgets(process, sizeof(volk_stats_pub.shm->process), comm) &&
+            (nl = strchr(process, '\n')))
+            *nl = '\0';
+        fclose(comm);
+    }
+#endif
+    // readers check the magic last, so they never take a new segment for one
+    __atomic_store_n(
+        &volk_stats_pub.shm->magic, VOLK_STATS_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    volk_stats_pub.stop = false;
+    if (pthread_create(&volk_stats_pub.thread, NULL, volk_stats_worker, NULL)) {
+        munmap(map, bytes);
+        free(volk_stats_pub.stats);
+        volk_stats_pub.shm = NULL;
+        volk_stats_pub.stats = NULL;
+        shm_unlink(volk_stats_pub.name);
+        return false;
+    }
+    return true;
+}
+
+bool volk_stats_shm_copy(const volk_stats_shm_t* shm,
+                         volk_stats_shm_t* copy,
+                         size_t bytes)
+{
+    unsigned int tries;
+
+    if (bytes < sizeof(volk_stats_shm_t))
+        return false;
+    for (tries = 0; tries < 1000; tries++) {
+        const uint64_t seq = __atomic_load_n(&shm->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1) {
+            sched_yield();
+            continue;
+        }
+        memcpy(copy, (const void*)shm, bytes);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&shm->seq, __ATOMIC_RELAXED) != seq)
+            continue;
+        return copy->magic == VOLK_STATS_SHM_MAGIC &&
+               copy->version == VOLK_STATS_SHM_VERSION &&
+               copy->kernel_size == sizeof(volk_stats_shm_kernel_t) &&
+               sizeof(volk_stats_shm_t) +
+                       (size_t)copy->n_kernels * sizeof(volk_stats_shm_kernel_t) <=
+                   bytes;
+    }
+    return false;
+}
+
+static void volk_stats_atexit(void) { volk_publish_kernel_stats(NULL, 0); }
+
+bool volk_publish_kernel_stats(const char* name, unsigned int period_ms)
+{
+    pthread_mutex_lock(&volk_stats_pub.lock);
+    const bool running = volk_stats_pub.running;
+    pthread_mutex_unlock(&volk_stats_pub.lock);
+    // the worker takes the lock, so it is not held while joining it
+    if (running)
+        volk_stats_stop();
+    if (!name)
+        return true;
+
+    pthread_mutex_lock(&volk_stats_pub.lock);
+    volk_stats_pub.running = volk_stats_start(name, period_ms);
+    if (volk_stats_pub.running && !volk_stats_pub.atexit_done) {
+        volk_stats_pub.atexit_done = true;
+        atexit(&volk_stats_atexit);
+    }
+    const bool ok = volk_stats_pub.running;
+    pthread_mutex_unlock(&volk_stats_pub.lock);
+    return ok;
+}
+
+#else
+
+bool volk_publish_kernel_stats(const char* name, unsigned int period_ms)
+{
+    (void)period_ms;
+    return !name;
+}
+
+bool volk_stats_shm_copy(const volk_stats_shm_t* shm,
+                         volk_stats_shm_t* copy,
+                         size_t bytes)
+{
+    (void)shm;
+    (void)copy;
+    (void)bytes;
+    return false;
+}
+
+#endif
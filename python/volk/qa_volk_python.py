@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 Free Software Foundation, Inc.
+#
+# This file is part of GNU Radio
+#
+# GNU Radio is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3, or (at your option)
+# any later version.
+#
+# GNU Radio is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with GNU Radio; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+
+"""Checks of the arguments of the volk module; array.array keeps it free of NumPy."""
+
+import array
+import unittest
+
+import volk
+
+
+class test_volk_python(unittest.TestCase):
+    def test_add(self):
+        a = array.array('f', [1.0, 2.0, 3.0])
+        b = array.array('f', [4.0, 5.0, 6.0])
+        out = array.array('f', [0.0] * 3)
+        volk.volk_32f_x2_add_32f(out, a, b, 3)
+        self.assertEqual(list(out), [5.0, 7.0, 9.0])
+
+    def test_short_input(self):
+        a = array.array('f', [1.0] * 8)
+        b = array.array('f', [1.0] * 7)
+        out = array.array('f', [0.0] * 8)
+        with self.assertRaises(ValueError):
+            volk.volk_32f_x2_add_32f(out, a, b, 8)
+
+    def test_short_output(self):
+        a = array.array('f', [1.0] * 8)
+        out = array.array('f', [0.0] * 4)
+        with self.assertRaises(ValueError):
+            volk.volk_32f_x2_add_32f(out, a, a, 8)
+
+    def test_reduction_output(self):
+        a = array.array('f', [1.0, 2.0, 3.0])
+        result = array.array('f', [0.0])
+        volk.volk_32f_x2_dot_prod_32f(result, a, a, 3)
+        self.assertEqual(result[0], 14.0)
+        with self.assertRaises(ValueError):
+            volk.volk_32f_x2_dot_prod_32f(array.array('f'), a, a, 3)
+
+    def test_num_points_range(self):
+        a = array.array('f', [1.0] * 4)
+        with self.assertRaises(OverflowError):
+            volk.volk_32f_x2_add_32f(a, a, a, -1)
+        with self.assertRaises(OverflowError):
+            volk.volk_32f_x2_add_32f(a, a, a, 1 << 32)
+
+    def test_item_size(self):
+        a = array.array('d', [1.0] * 4)
+        with self.assertRaises(TypeError):
+            volk.volk_32f_x2_add_32f(a, a, a, 4)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -23,41 +23,222 @@
 #include "volk_machines.h"
 #include <volk/volk_typedefs.h>
 #include <volk/volk_cpu.h>
+#include <volk/volk_prefs.h>
 #include "volk_rank_archs.h"
+#include "volk_once.h"
+#include "volk_parallel.h"
+#include "volk_autotune.h"
+#include "volk_fpmode.h"
+#include "volk_capture_record.h"
+#ifdef VOLK_MACHINE_PLUGINS
+#include "volk_machine_plugin.h"
+#endif
 #include <volk/volk.h>
+#include <volk/volk_fft.h>
+#include <volk/volk_stats.h>
+#include <volk/volk_capture.h>
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <assert.h>
 
 static size_t __alignment = 0;
 static intptr_t __alignment_mask = 0;
+static bool __assume_aligned = false;
+static bool __autotune = false;
+static float __precision = 0.0f; // volk_set_precision
 
-struct volk_machine *get_machine(void)
+// the chunk length of the _64 variants, a power of two below the 32-bit limit
+// so every chunk keeps the alignment of the vectors
+#define VOLK_64_CHUNK ((size_t)1 << 30)
+// the chunk length of the _64 index_max variants: the SIMD versions of those
+// count indices in float lanes, which are exact up to 2^24 only
+#define VOLK_64_ARGMAX_CHUNK ((size_t)1 << 24)
+
+static struct volk_machine *__machine = NULL;
+static volk_once_t __machine_once = VOLK_ONCE_INIT;
+
+struct volk_plan
+{
+    void (*execute)(void); // the <kernel>_execute the plan was made for
+    void (*impl)(void);    // the bound impl, cast back to the kernel's type
+    const char *impl_name;
+    unsigned int num_points;
+    unsigned int flags;
+    void *scratch;
+};
+
+#if defined(VOLK_KERNEL_STATS) || defined(VOLK_SDT_PROBES)
+#define VOLK_TRACE_KERNELS
+#endif
+
+#ifdef VOLK_SDT_PROBES
+// USDT probes volk:kernel_entry and volk:kernel_exit around every dispatched call,
+// with the kernel name, the bound impl name and num_points (0 if there is none)
+#include <sys/sdt.h>
+#define VOLK_PROBE(probe, kernel, impl, n) DTRACE_PROBE3(volk, probe, kernel, impl, n)
+#else
+#define VOLK_PROBE(probe, kernel, impl, n)
+#endif
+
+#ifdef VOLK_TRACE_KERNELS
+// per kernel counters, bumped with relaxed atomics by the tracing trampolines
+typedef struct
+{
+  long long calls;
+  long long points;
+  long long lengths[VOLK_STATS_LENGTH_BINS];
+  const char *impl_a;
+  const char *impl_u;
+} __volk_kernel_counters_t;
+#endif
+
+#ifdef VOLK_KERNEL_STATS
+static inline unsigned int __volk_stats_length_bin(unsigned int n)
+{
+#if defined(_MSC_VER)
+  unsigned long bin = 0;
+  _BitScanReverse(&bin, n | 1);
+  return (unsigned int)bin;
+#else
+  return 31 - __builtin_clz(n | 1);
+#endif
+}
+
+static inline void __volk_stats_count(__volk_kernel_counters_t *counters, unsigned int n)
+{
+  VOLK_ATOMIC_ADD_RELAXED(&counters->calls, 1);
+  VOLK_ATOMIC_ADD_RELAXED(&counters->points, (long long)n);
+  VOLK_ATOMIC_ADD_RELAXED(&counters->lengths[__volk_stats_length_bin(n)], 1);
+}
+
+// records a call of kernel index kernel in the running capture, with the
+// offsets of the first pointer arguments and which of them alias ptrs[0]
+static inline void __volk_capture(unsigned int kernel, unsigned int n,
+                                  const void *const *ptrs, unsigned int n_ptrs,
+                                  bool aligned)
+{
+  uint32_t offsets = 0;
+  unsigned int in_place = 0, k;
+  for(k = 0; k < n_ptrs && k < VOLK_CAPTURE_MAX_POINTERS; k++) {
+    offsets |= (uint32_t)((uintptr_t)ptrs[k] & 63) << (6 * k);
+    if(k && ptrs[k] == ptrs[0]) in_place |= 1u << (k - 1);
+  }
+  volk_capture_record(kernel, n, offsets, in_place, aligned);
+}
+
+static void __volk_print_kernel_stats(void);
+#endif
+
+// The archs allowed by VOLK_MAX_ARCH=<machine>, e.g. avx2: the union of
+// the caps of the machines of that name, whatever their suffixes.
+static uint64_t __max_arch_caps(const char *max_arch)
 {
   extern struct volk_machine *volk_machines[];
   extern unsigned int n_volk_machines;
-  static struct volk_machine *machine = NULL;
-
-  if(machine != NULL)
-    return machine;
-  else {
-    unsigned int max_score = 0;
-    unsigned int i;
-    struct volk_machine *max_machine = NULL;
-    for(i=0; i<n_volk_machines; i++) {
-      if(!(volk_machines[i]->caps & (~volk_get_lvarch()))) {
-        if(volk_machines[i]->caps > max_score) {
-          max_score = volk_machines[i]->caps;
-          max_machine = volk_machines[i];
-        }
+  const size_t len = strlen(max_arch);
+  uint64_t caps = 0;
+  unsigned int i;
+  for(i=0; i<n_volk_machines; i++) {
+    const char *name = volk_machines[i]->name;
+    if(!strncmp(name, max_arch, len) && (name[len] == '\0' || name[len] == '_')) {
+      caps |= volk_machines[i]->caps;
+    }
+  }
+#ifdef VOLK_MACHINE_PLUGINS
+  for(i=0; i<n_volk_machine_plugins; i++) {
+    const char *name = volk_machine_plugins[i].name;
+    if(!strncmp(name, max_arch, len) && (name[len] == '\0' || name[len] == '_')) {
+      caps |= volk_machine_plugins[i].caps;
+    }
+  }
+#endif
+  if(!caps) {
+    fprintf(stderr, "Volk warning: unknown VOLK_MAX_ARCH %s, ignored\n", max_arch);
+    return ~(uint64_t)0;
+  }
+  return caps;
+}
+
+static void __init_machine(void)
+{
+  extern struct volk_machine *volk_machines[];
+  extern unsigned int n_volk_machines;
+  uint64_t max_score = 0;
+  unsigned int i;
+  struct volk_machine *max_machine = NULL;
+  uint64_t lvarch = volk_get_lvarch();
+  const char *max_arch = getenv("VOLK_MAX_ARCH");
+  if(max_arch && max_arch[0]) {
+    lvarch &= __max_arch_caps(max_arch);
+  }
+  for(i=0; i<n_volk_machines; i++) {
+    if(!(volk_machines[i]->caps & (~lvarch))) {
+      if(volk_machines[i]->caps > max_score) {
+        max_score = volk_machines[i]->caps;
+        max_machine = volk_machines[i];
+      }
+    }
+  }
+#ifdef VOLK_MACHINE_PLUGINS
+  // load the best module that beats the built in machines; when it is
+  // missing, fall back to the next best one below it
+  uint64_t ceiling = ~(uint64_t)0;
+  for(;;) {
+    struct volk_machine_plugin *best = NULL;
+    struct volk_machine *machine;
+    for(i=0; i<n_volk_machine_plugins; i++) {
+      const uint64_t caps = volk_machine_plugins[i].caps;
+      if(!(caps & (~lvarch)) && caps > max_score && caps < ceiling &&
+         (!best || caps > best->caps)) {
+        best = &volk_machine_plugins[i];
       }
     }
-    machine = max_machine;
-    //printf("Using Volk machine: %s\n", machine->name);
-    __alignment = machine->alignment;
-    __alignment_mask = (intptr_t)(__alignment-1);
-    return machine;
+    if(!best) break;
+    machine = volk_load_machine_plugin(best->name);
+    if(machine) {
+      max_score = best->caps;
+      max_machine = machine;
+      break;
+    }
+    fprintf(stderr, "Volk warning: no module for machine %s, trying the next best\n", best->name);
+    ceiling = best->caps;
+  }
+#endif
+  //printf("Using Volk machine: %s\n", max_machine->name);
+  __alignment = max_machine->alignment;
+  __alignment_mask = (intptr_t)(__alignment-1);
+#ifdef VOLK_ASSUME_ALIGNED
+  __assume_aligned = true;
+#else
+  __assume_aligned = (getenv("VOLK_ASSUME_ALIGNED") != NULL);
+#endif
+  __autotune = (getenv("VOLK_AUTOTUNE") != NULL);
+  __machine = max_machine;
+#ifdef VOLK_KERNEL_STATS
+  if (getenv("VOLK_KERNEL_STATS") != NULL) {
+    atexit(&__volk_print_kernel_stats);
+  }
+  const char *capture = getenv("VOLK_CAPTURE");
+  const char *capture_calls = getenv("VOLK_CAPTURE_CALLS");
+  const size_t max_calls = capture_calls ? strtoul(capture_calls, NULL, 10) : 0;
+  if (capture != NULL && !volk_capture_start(capture, max_calls)) {
+    fprintf(stderr, "Volk warning: cannot capture the kernel calls to %s\n", capture);
+  }
+  const char *stats_shm = getenv("VOLK_STATS_SHM");
+  if (stats_shm != NULL && !volk_publish_kernel_stats(stats_shm, 0)) {
+    fprintf(stderr, "Volk warning: cannot publish the kernel statistics in %s\n",
+            stats_shm);
   }
+#endif
+}
+
+struct volk_machine *get_machine(void)
+{
+  volk_call_once(&__machine_once, &__init_machine);
+  return __machine;
 }
 
 void volk_list_machines(void)
@@ -65,38 +246,43 @@ void volk_list_machines(void)
   extern struct volk_machine *volk_machines[];
   extern unsigned int n_volk_machines;
 
+  const uint64_t lvarch = volk_get_lvarch();
   unsigned int i;
   for(i=0; i<n_volk_machines; i++) {
-    if(!(volk_machines[i]->caps & (~volk_get_lvarch()))) {
+    if(!(volk_machines[i]->caps & (~lvarch))) {
         printf("%s;", volk_machines[i]->name);
     }
   }
+#ifdef VOLK_MACHINE_PLUGINS
+  for(i=0; i<n_volk_machine_plugins; i++) {
+    if(!(volk_machine_plugins[i].caps & (~lvarch))) {
+        printf("%s;", volk_machine_plugins[i].name);
+    }
+  }
+#endif
   printf("\n");
 }
 
 const char* volk_get_machine(void)
 {
-  extern struct volk_machine *volk_machines[];
-  extern unsigned int n_volk_machines;
-  static struct volk_machine *machine = NULL;
-
-  if(machine != NULL)
-    return machine->name;
-  else {
-    unsigned int max_score = 0;
-    unsigned int i;
-    struct volk_machine *max_machine = NULL;
-    for(i=0; i<n_volk_machines; i++) {
-      if(!(volk_machines[i]->caps & (~volk_get_lvarch()))) {
-        if(volk_machines[i]->caps > max_score) {
-          max_score = volk_machines[i]->caps;
-          max_machine = volk_machines[i];
-        }
-      }
+  return get_machine()->name;
+}
+
+const char* volk_get_default_impl(const char *kern_name, bool align)
+{
+  const struct volk_machine *machine = get_machine();
+  size_t lo = 0;
+  size_t hi = machine->n_defaults;
+  while(lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    const int cmp = strcmp(kern_name, machine->defaults[mid].kern_name);
+    if(!cmp) {
+      return align ? machine->defaults[mid].impl_a : machine->defaults[mid].impl_u;
     }
-    machine = max_machine;
-    return machine->name;
+    if(cmp < 0) hi = mid;
+    else lo = mid + 1;
   }
+  return NULL;
 }
 
 size_t volk_get_alignment(void)
@@ -105,6 +291,16 @@ size_t volk_get_alignment(void)
     return __alignment;
 }
 
+size_t volk_get_preferred_alignment(void)
+{
+    size_t alignment = volk_get_alignment();
+    if (alignment < VOLK_MAX_ALIGNMENT)
+        alignment = VOLK_MAX_ALIGNMENT;
+    if (alignment < volk_get_cacheline_size())
+        alignment = volk_get_cacheline_size();
+    return alignment;
+}
+
 bool volk_is_aligned(const void *ptr)
 {
     return ((intptr_t)(ptr) & __alignment_mask) == 0;
@@ -113,27 +309,46 @@ bool volk_is_aligned(const void *ptr)
 #define LV_HAVE_GENERIC
 #define LV_HAVE_DISPATCHER
 
+#ifdef VOLK_IFUNC
+// the entry points are the IFUNC symbols at the end of this file; up to there
+// the kernel names stand for the pointers their resolvers return
+%for kern in kernels:
+#define ${kern.name} __${kern.name}_ptr
+#define ${kern.name}_a __${kern.name}_a_ptr
+#define ${kern.name}_u __${kern.name}_u_ptr
+static ${kern.pname} ${kern.name}, ${kern.name}_a, ${kern.name}_u;
+%endfor
+#define VOLK_ENTRY_POINTER static
+#else
+#define VOLK_ENTRY_POINTER
+#endif
+
 %for kern in kernels:
 
 %if kern.has_dispatcher:
 #include <volk/${kern.name}.h> //pulls in the dispatcher
 %endif
 
-static inline void __${kern.name}_d(${kern.arglist_full})
+static inline bool __${kern.name}_aligned(${kern.arglist_full})
 {
-    %if kern.has_dispatcher:
-    ${kern.name}_dispatcher(${kern.arglist_names});
-    return;
-    %endif
-
-    if (volk_is_aligned(<% num_open_parens = 0 %>
+    return volk_is_aligned(<% num_open_parens = 0 %>
     %for arg_type, arg_name in kern.args:
         %if '*' in arg_type:
         VOLK_OR_PTR(${arg_name},<% num_open_parens += 1 %>
         %endif
     %endfor
         0<% end_open_parens = ')'*num_open_parens %>${end_open_parens}
-    )){
+    );
+}
+
+static inline void __${kern.name}_dispatch(${kern.arglist_full})
+{
+    %if kern.has_dispatcher:
+    ${kern.name}_dispatcher(${kern.arglist_names});
+    return;
+    %endif
+
+    if (__${kern.name}_aligned(${kern.arglist_names})){
         ${kern.name}_a(${kern.arglist_names});
     }
     else{
@@ -141,22 +356,269 @@ static inline void __${kern.name}_d(${kern.arglist_full})
     }
 }
 
-static inline void __init_${kern.name}(void)
+static inline void __${kern.name}_d(${kern.arglist_full})
+{
+    // with volk_set_flush_denormals on this thread the call runs with FTZ/DAZ
+    if (volk_flush_denormals_thread) {
+        const volk_fpmode_t mode = volk_fpmode_flush_denormals();
+        __${kern.name}_dispatch(${kern.arglist_names});
+        volk_fpmode_restore(mode);
+        return;
+    }
+    __${kern.name}_dispatch(${kern.arglist_names});
+}
+
+#ifndef NDEBUG
+// debug builds route the aligned entry point through an alignment check
+static ${kern.pname} __${kern.name}_a_checked_impl;
+
+static void __${kern.name}_a_checked(${kern.arglist_full})
+{
+    assert(__${kern.name}_aligned(${kern.arglist_names}) && "${kern.name}_a called with unaligned buffers");
+    __${kern.name}_a_checked_impl(${kern.arglist_names});
+}
+#endif
+
+%if kern.length_arg:
+static ${kern.pname} __${kern.name}_a_buckets[VOLK_N_LENGTH_BUCKETS];
+static ${kern.pname} __${kern.name}_u_buckets[VOLK_N_LENGTH_BUCKETS];
+
+static inline void __${kern.name}_a_sized(${kern.arglist_full})
+{
+    __${kern.name}_a_buckets[volk_get_length_bucket(${kern.length_arg})](${kern.arglist_names});
+}
+
+static inline void __${kern.name}_u_sized(${kern.arglist_full})
+{
+    __${kern.name}_u_buckets[volk_get_length_bucket(${kern.length_arg})](${kern.arglist_names});
+}
+
+%endif
+#ifdef VOLK_TRACE_KERNELS
+static __volk_kernel_counters_t __${kern.name}_stats;
+<% capture_ptrs = ['(const void *)' + n for t, n in kern.args if '*' in t] %>
+%for sfx in ['a', 'u']:
+static ${kern.pname} __${kern.name}_${sfx}_traced_impl;
+
+static void __${kern.name}_${sfx}_traced(${kern.arglist_full})
+{
+#ifdef VOLK_KERNEL_STATS
+    if (volk_capture_on) {
+        const void *capture_ptrs[] = { ${', '.join(capture_ptrs) or 'NULL'} };
+        __volk_capture(${kernels.index(kern)}, ${kern.length_arg or 0}, capture_ptrs,
+                       ${len(capture_ptrs)}, ${'true' if sfx == 'a' else 'false'});
+    }
+#endif
+    %if kern.length_arg:
+#ifdef VOLK_KERNEL_STATS
+    __volk_stats_count(&__${kern.name}_stats, ${kern.length_arg});
+#endif
+    VOLK_PROBE(kernel_entry, "${kern.name}", __${kern.name}_stats.impl_${sfx}, ${kern.length_arg});
+    __${kern.name}_${sfx}_traced_impl(${kern.arglist_names});
+    VOLK_PROBE(kernel_exit, "${kern.name}", __${kern.name}_stats.impl_${sfx}, ${kern.length_arg});
+    %else:
+#ifdef VOLK_KERNEL_STATS
+    VOLK_ATOMIC_ADD_RELAXED(&__${kern.name}_stats.calls, 1);
+#endif
+    VOLK_PROBE(kernel_entry, "${kern.name}", __${kern.name}_stats.impl_${sfx}, 0);
+    __${kern.name}_${sfx}_traced_impl(${kern.arglist_names});
+    VOLK_PROBE(kernel_exit, "${kern.name}", __${kern.name}_stats.impl_${sfx}, 0);
+    %endif
+}
+
+%endfor
+#endif
+
+static ${kern.pname} __${kern.name}_a_core_classes[VOLK_MAX_CORE_CLASSES];
+static ${kern.pname} __${kern.name}_u_core_classes[VOLK_MAX_CORE_CLASSES];
+
+// on heterogeneous cpus, run the impl profiled for the core class of the calling thread
+static void __${kern.name}_a_classed(${kern.arglist_full})
+{
+    __${kern.name}_a_core_classes[volk_get_current_core_class()](${kern.arglist_names});
+}
+
+static void __${kern.name}_u_classed(${kern.arglist_full})
+{
+    __${kern.name}_u_core_classes[volk_get_current_core_class()](${kern.arglist_names});
+}
+
+%for sfx in ['a', 'u']:
+// in autotune mode sampled calls time the candidates in turn until one is chosen
+static volk_autotune_t __${kern.name}_${sfx}_tune;
+static ${kern.pname} __${kern.name}_${sfx}_tuned_impl;
+
+static void __${kern.name}_${sfx}_tuned(${kern.arglist_full})
+{
+    const int slot = volk_autotune_sample(&__${kern.name}_${sfx}_tune);
+    if (slot < 0) {
+        __${kern.name}_${sfx}_tuned_impl(${kern.arglist_names});
+        return;
+    }
+    const uint64_t start = volk_autotune_now();
+    get_machine()->${kern.name}_impls[__${kern.name}_${sfx}_tune.candidates[slot]](${kern.arglist_names});
+    if (volk_autotune_record(&__${kern.name}_${sfx}_tune, slot, volk_autotune_now() - start, ${kern.length_arg or 1})) {
+        ${kern.pname} best = get_machine()->${kern.name}_impls[__${kern.name}_${sfx}_tune.best];
+        VOLK_ATOMIC_STORE_PTR(__${kern.name}_${sfx}_tuned_impl, best);
+        // swap the entry points too, unless a debug or tracing trampoline wraps this one
+        if (${kern.name}_${sfx} == &__${kern.name}_${sfx}_tuned) {
+            VOLK_ATOMIC_STORE_PTR(${kern.name}_${sfx}, best);
+        }
+        if (${kern.name} == &__${kern.name}_${sfx}_tuned) {
+            VOLK_ATOMIC_STORE_PTR(${kern.name}, best);
+        }
+    }
+}
+
+%endfor
+%if kern.impl_max_errors:
+// the impl at index, the ranked one, or the fastest meeting the volk_set_precision budget
+static ${kern.pname} __${kern.name}_budgeted(size_t index, bool align, const char **impl_name)
+{
+    const float *impl_errors = get_machine()->${kern.name}_impl_max_error;
+    index = (size_t)volk_rank_archs_within((int)index, get_machine()->${kern.name}_impl_deps,
+                                           get_machine()->${kern.name}_impl_alignment, impl_errors,
+                                           get_machine()->${kern.name}_n_impls, align, __precision);
+    %if kern.fast_variant:
+    // the fast variant's impl is taken when it meets the budget with an
+    // approximation, as it is only less accurate for being faster
+    const char **fast_names = get_machine()->${kern.fast_variant}_impl_names;
+    const float *fast_errors = get_machine()->${kern.fast_variant}_impl_max_error;
+    const size_t n_fast = get_machine()->${kern.fast_variant}_n_impls;
+    int fast = volk_rank_archs(get_machine()->${kern.fast_variant}_name, fast_names,
+                               get_machine()->${kern.fast_variant}_impl_deps,
+                               get_machine()->${kern.fast_variant}_impl_alignment, n_fast, align);
+    fast = volk_rank_archs_within(fast, get_machine()->${kern.fast_variant}_impl_deps,
+                                  get_machine()->${kern.fast_variant}_impl_alignment, fast_errors,
+                                  n_fast, align, __precision);
+    if (__precision > 0 && fast_errors[fast] >= 0 && fast_errors[fast] <= __precision &&
+        fast_errors[fast] > impl_errors[index]) {
+        if (impl_name) *impl_name = fast_names[fast];
+        return (${kern.pname})get_machine()->${kern.fast_variant}_impls[fast];
+    }
+    %endif
+    if (impl_name) *impl_name = get_machine()->${kern.name}_impl_names[index];
+    return get_machine()->${kern.name}_impls[index];
+}
+
+%endif
+static volk_once_t __${kern.name}_once = VOLK_ONCE_INIT;
+
+static void __resolve_${kern.name}(void)
 {
     const char *name = get_machine()->${kern.name}_name;
     const char **impl_names = get_machine()->${kern.name}_impl_names;
-    const int *impl_deps = get_machine()->${kern.name}_impl_deps;
+    const uint64_t *impl_deps = get_machine()->${kern.name}_impl_deps;
     const bool *alignment = get_machine()->${kern.name}_impl_alignment;
     const size_t n_impls = get_machine()->${kern.name}_n_impls;
+    %if kern.length_arg:
+    // bind the bucket dispatchers only when some length bucket differs from the default
+    ${kern.pname} *buckets_a = __${kern.name}_a_buckets;
+    ${kern.pname} *buckets_u = __${kern.name}_u_buckets;
+    const size_t last = VOLK_N_LENGTH_BUCKETS - 1;
+    bool sized_a = false;
+    bool sized_u = false;
+    size_t bucket;
+    for (bucket = 0; bucket < VOLK_N_LENGTH_BUCKETS; bucket++) {
+        const size_t index_a = volk_rank_archs_bucket(name, impl_names, impl_deps, alignment, n_impls, true/*aligned*/, bucket);
+        const size_t index_u = volk_rank_archs_bucket(name, impl_names, impl_deps, alignment, n_impls, false/*unaligned*/, bucket);
+        %if kern.impl_max_errors:
+        buckets_a[bucket] = __${kern.name}_budgeted(index_a, true/*aligned*/, NULL);
+        buckets_u[bucket] = __${kern.name}_budgeted(index_u, false/*unaligned*/, NULL);
+        %else:
+        buckets_a[bucket] = get_machine()->${kern.name}_impls[index_a];
+        buckets_u[bucket] = get_machine()->${kern.name}_impls[index_u];
+        %endif
+    }
+    for (bucket = 0; bucket < last; bucket++) {
+        sized_a |= (buckets_a[bucket] != buckets_a[last]);
+        sized_u |= (buckets_u[bucket] != buckets_u[last]);
+    }
+    ${kern.pname} impl_a = sized_a ? &__${kern.name}_a_sized : buckets_a[last];
+    ${kern.pname} impl_u = sized_u ? &__${kern.name}_u_sized : buckets_u[last];
+    %else:
     const size_t index_a = volk_rank_archs(name, impl_names, impl_deps, alignment, n_impls, true/*aligned*/);
     const size_t index_u = volk_rank_archs(name, impl_names, impl_deps, alignment, n_impls, false/*unaligned*/);
-    ${kern.name}_a = get_machine()->${kern.name}_impls[index_a];
-    ${kern.name}_u = get_machine()->${kern.name}_impls[index_u];
+    %if kern.impl_max_errors:
+    ${kern.pname} impl_a = __${kern.name}_budgeted(index_a, true/*aligned*/, NULL);
+    ${kern.pname} impl_u = __${kern.name}_budgeted(index_u, false/*unaligned*/, NULL);
+    %else:
+    ${kern.pname} impl_a = get_machine()->${kern.name}_impls[index_a];
+    ${kern.pname} impl_u = get_machine()->${kern.name}_impls[index_u];
+    %endif
+    %endif
+
+    assert(impl_a);
+    assert(impl_u);
+
+    // core classes without a profile of their own use the default impls
+    const unsigned int n_core_classes = volk_get_n_core_classes();
+    if (n_core_classes > 1) {
+        bool classed_a = false;
+        bool classed_u = false;
+        unsigned int core_class;
+        for (core_class = 0; core_class < n_core_classes; core_class++) {
+            const int class_index_a = volk_rank_archs_core_class(name, impl_names, n_impls, true/*aligned*/, core_class);
+            const int class_index_u = volk_rank_archs_core_class(name, impl_names, n_impls, false/*unaligned*/, core_class);
+            %if kern.impl_max_errors:
+            __${kern.name}_a_core_classes[core_class] = (class_index_a >= 0) ? __${kern.name}_budgeted(class_index_a, true/*aligned*/, NULL) : impl_a;
+            __${kern.name}_u_core_classes[core_class] = (class_index_u >= 0) ? __${kern.name}_budgeted(class_index_u, false/*unaligned*/, NULL) : impl_u;
+            %else:
+            __${kern.name}_a_core_classes[core_class] = (class_index_a >= 0) ? get_machine()->${kern.name}_impls[class_index_a] : impl_a;
+            __${kern.name}_u_core_classes[core_class] = (class_index_u >= 0) ? get_machine()->${kern.name}_impls[class_index_u] : impl_u;
+            %endif
+            classed_a |= (__${kern.name}_a_core_classes[core_class] != impl_a);
+            classed_u |= (__${kern.name}_u_core_classes[core_class] != impl_u);
+        }
+        if (classed_a) impl_a = &__${kern.name}_a_classed;
+        if (classed_u) impl_u = &__${kern.name}_u_classed;
+    }
+
+    %if kern.impl_max_errors:
+    // the candidates are not all within a budget
+    if (__autotune && __precision <= 0) {
+    %else:
+    if (__autotune) {
+    %endif
+        volk_autotune_setup(&__${kern.name}_a_tune, name, impl_names, impl_deps, alignment, n_impls, true/*aligned*/);
+        volk_autotune_setup(&__${kern.name}_u_tune, name, impl_names, impl_deps, alignment, n_impls, false/*unaligned*/);
+        __${kern.name}_a_tuned_impl = impl_a;
+        __${kern.name}_u_tuned_impl = impl_u;
+        if (!volk_autotune_done(&__${kern.name}_a_tune)) impl_a = &__${kern.name}_a_tuned;
+        if (!volk_autotune_done(&__${kern.name}_u_tune)) impl_u = &__${kern.name}_u_tuned;
+    }
 
-    assert(${kern.name}_a);
-    assert(${kern.name}_u);
+#ifdef VOLK_TRACE_KERNELS
+    // the dispatcher calls through _a and _u, so each call is traced once
+    __${kern.name}_stats.impl_a = "sized";
+    __${kern.name}_stats.impl_u = "sized";
+    for (size_t i = 0; i < n_impls; i++) {
+        if (get_machine()->${kern.name}_impls[i] == impl_a) __${kern.name}_stats.impl_a = impl_names[i];
+        if (get_machine()->${kern.name}_impls[i] == impl_u) __${kern.name}_stats.impl_u = impl_names[i];
+    }
+    __${kern.name}_a_traced_impl = impl_a;
+    __${kern.name}_u_traced_impl = impl_u;
+    impl_a = &__${kern.name}_a_traced;
+    impl_u = &__${kern.name}_u_traced;
+#endif
+#ifndef NDEBUG
+    __${kern.name}_a_checked_impl = impl_a;
+    impl_a = &__${kern.name}_a_checked;
+#endif
+    VOLK_ATOMIC_STORE_PTR(${kern.name}_a, impl_a);
+    VOLK_ATOMIC_STORE_PTR(${kern.name}_u, impl_u);
+    %if kern.has_dispatcher:
+    VOLK_ATOMIC_STORE_PTR(${kern.name}, &__${kern.name}_d);
+    %else:
+    // in assume aligned mode the dispatcher skips the per call pointer check
+    VOLK_ATOMIC_STORE_PTR(${kern.name}, __assume_aligned ? impl_a : &__${kern.name}_d);
+    %endif
+}
 
-    ${kern.name} = &__${kern.name}_d;
+// resolves the pointers on first use; concurrent first calls wait for a single init
+static inline void __init_${kern.name}(void)
+{
+    volk_call_once(&__${kern.name}_once, &__resolve_${kern.name});
 }
 
 static inline void __${kern.name}_a(${kern.arglist_full})
@@ -177,9 +639,9 @@ static inline void __${kern.name}(${kern.arglist_full})
     ${kern.name}(${kern.arglist_names});
 }
 
-${kern.pname} ${kern.name}_a = &__${kern.name}_a;
-${kern.pname} ${kern.name}_u = &__${kern.name}_u;
-${kern.pname} ${kern.name}   = &__${kern.name};
+VOLK_ENTRY_POINTER ${kern.pname} ${kern.name}_a = &__${kern.name}_a;
+VOLK_ENTRY_POINTER ${kern.pname} ${kern.name}_u = &__${kern.name}_u;
+VOLK_ENTRY_POINTER ${kern.pname} ${kern.name}   = &__${kern.name};
 
 void ${kern.name}_manual(${kern.arglist_full}, const char* impl_name)
 {
@@ -193,18 +655,741 @@ void ${kern.name}_manual(${kern.arglist_full}, const char* impl_name)
     );
 }
 
+%if kern.length_arg:
+void ${kern.name}_batch(${kern.batch_arglist_full})
+{
+    size_t i;
+    if (!count) return;
+    __init_${kern.name}();
+    %if kern.has_dispatcher:
+    for (i = 0; i < count; i++) {
+        ${kern.name}(${kern.batch_item_args});
+    }
+    %else:
+    // one alignment test and one length bucket lookup for the whole batch,
+    // then straight calls of the bound impl
+    bool aligned = true;
+    if (!__assume_aligned) {
+        for (i = 0; aligned && i < count; i++) {
+            aligned = __${kern.name}_aligned(${kern.batch_item_args});
+        }
+    }
+    ${kern.pname} impl = aligned ? ${kern.name}_a : ${kern.name}_u;
+    if (impl == &__${kern.name}_a_sized) {
+        impl = __${kern.name}_a_buckets[volk_get_length_bucket(${kern.length_arg})];
+    } else if (impl == &__${kern.name}_u_sized) {
+        impl = __${kern.name}_u_buckets[volk_get_length_bucket(${kern.length_arg})];
+    }
+    // one denormal mode switch for the whole batch too
+    const bool flush = volk_flush_denormals_thread;
+    const volk_fpmode_t mode = flush ? volk_fpmode_flush_denormals() : 0;
+    for (i = 0; i < count; i++) {
+        impl(${kern.batch_item_args});
+    }
+    if (flush) volk_fpmode_restore(mode);
+    %endif
+}
+
+%endif
+%if kern.parallel:
+typedef struct
+{
+    %for arg_type, arg_name in kern.args:
+    ${arg_type} ${arg_name};
+    %endfor
+    %for out_type, out_name in kern.parallel_outputs:
+    ${out_type} partial_${out_name}[VOLK_PARALLEL_MAX_CHUNKS];
+    %endfor
+    %if kern.parallel != 'map':
+    size_t counts[VOLK_PARALLEL_MAX_CHUNKS];
+    %endif
+    bool flush_denormals; // the caller's volk_set_flush_denormals, for the pool threads
+} __${kern.name}_parallel_args_t;
+
+static void __${kern.name}_parallel_chunk(void *ctx, size_t chunk, size_t start, size_t count)
+{
+    __${kern.name}_parallel_args_t *args = (__${kern.name}_parallel_args_t *)ctx;
+    const bool flush = volk_flush_denormals_thread;
+    (void)chunk;
+    volk_flush_denormals_thread = args->flush_denormals;
+    ${kern.name}(${kern.parallel_chunk_args});
+    volk_flush_denormals_thread = flush;
+    %if kern.parallel != 'map':
+    args->counts[chunk] = count;
+    %endif
+    %if kern.parallel == 'argmax':
+    args->partial_${kern.parallel_out}[chunk] += (${kern.parallel_out_type})start;
+    %endif
+}
+
+%if kern.parallel == 'argmax':
+static inline float __${kern.name}_parallel_value(const __${kern.name}_parallel_args_t *args, ${kern.parallel_out_type} index)
+{
+    return ${kern.parallel_value};
+}
+
+%endif
+%if kern.parallel != 'map':
+// merge the partials of the chunks into the caller's outputs
+static void __${kern.name}_parallel_merge(void *ctx, size_t n_chunks)
+{
+    __${kern.name}_parallel_args_t *args = (__${kern.name}_parallel_args_t *)ctx;
+    size_t chunk;
+    %if kern.parallel == 'sum':
+    ${kern.parallel_out_type} sum = args->partial_${kern.parallel_out}[0];
+    for (chunk = 1; chunk < n_chunks; chunk++) {
+        sum += args->partial_${kern.parallel_out}[chunk];
+    }
+    *args->${kern.parallel_out} = sum;
+    %elif kern.parallel == 'argmax':
+    // chunks are in order, so the first of equal maxima wins as in the serial kernel
+    ${kern.parallel_out_type} best = args->partial_${kern.parallel_out}[0];
+    for (chunk = 1; chunk < n_chunks; chunk++) {
+        if (__${kern.name}_parallel_value(args, args->partial_${kern.parallel_out}[chunk]) >
+            __${kern.name}_parallel_value(args, best)) {
+            best = args->partial_${kern.parallel_out}[chunk];
+        }
+    }
+    *args->${kern.parallel_out} = best;
+    %elif kern.parallel == 'mean_stddev':
+    if (n_chunks == 1) {
+        *args->stddev = args->partial_stddev[0];
+        *args->mean = args->partial_mean[0];
+        return;
+    }
+    // Chan et al. pairwise update of the count, mean and sum of squared deviations
+    double n = 0.0, m = 0.0, m2 = 0.0;
+    for (chunk = 0; chunk < n_chunks; chunk++) {
+        const double n_c = (double)args->counts[chunk];
+        const double delta = (double)args->partial_mean[chunk] - m;
+        const double total = n + n_c;
+        m += delta * n_c / total;
+        m2 += (double)args->partial_stddev[chunk] * args->partial_stddev[chunk] * n_c +
+              delta * delta * n * n_c / total;
+        n = total;
+    }
+    *args->stddev = (float)sqrt(m2 / n);
+    *args->mean = (float)m;
+    %endif
+}
+
+%endif
+void volk_parallel_${kern.name}(${kern.arglist_full})
+{
+    __${kern.name}_parallel_args_t args = { ${kern.arglist_names} };
+    args.flush_denormals = volk_flush_denormals_thread;
+    %if kern.parallel == 'map':
+    volk_parallel_for("${kern.name}", args.${kern.parallel_placement}, sizeof(*args.${kern.parallel_placement}), ${kern.length_arg}, &__${kern.name}_parallel_chunk, &args);
+    %else:
+    __${kern.name}_parallel_merge(&args, volk_parallel_for("${kern.name}", args.${kern.parallel_placement}, sizeof(*args.${kern.parallel_placement}), ${kern.length_arg}, &__${kern.name}_parallel_chunk, &args));
+    %endif
+}
+
+volk_async_t *volk_async_${kern.name}(${kern.arglist_full})
+{
+    const __${kern.name}_parallel_args_t init = { ${kern.arglist_names} };
+    __${kern.name}_parallel_args_t *args = (__${kern.name}_parallel_args_t *)malloc(sizeof(*args));
+    if (!args) {
+        volk_parallel_${kern.name}(${kern.arglist_names});
+        return NULL;
+    }
+    memcpy(args, &init, sizeof(init));
+    args->flush_denormals = volk_flush_denormals_thread;
+    %if kern.parallel == 'map':
+    return volk_parallel_submit("${kern.name}", args->${kern.parallel_placement}, sizeof(*args->${kern.parallel_placement}), ${kern.length_arg}, &__${kern.name}_parallel_chunk, NULL, args);
+    %else:
+    return volk_parallel_submit("${kern.name}", args->${kern.parallel_placement}, sizeof(*args->${kern.parallel_placement}), ${kern.length_arg}, &__${kern.name}_parallel_chunk, &__${kern.name}_parallel_merge, args);
+    %endif
+}
+
+void ${kern.name}_64(${kern.long_arglist_full})
+{
+    size_t start = 0, count;
+    %for out_type, out_name in kern.parallel_outputs:
+    ${out_type} partial_${out_name};
+    %endfor
+    %if kern.parallel == 'argmax':
+    const size_t chunk = VOLK_64_ARGMAX_CHUNK;
+    uint64_t index;
+    float value, best_value = 0.0f;
+    %else:
+    const size_t chunk = VOLK_64_CHUNK;
+    %endif
+    %if kern.parallel == 'mean_stddev':
+    double n = 0.0, m = 0.0, m2 = 0.0;
+    %endif
+    do {
+        count = ${kern.length_arg} - start < chunk ? ${kern.length_arg} - start : chunk;
+        ${kern.name}(${kern.long_chunk_args});
+        %if kern.parallel == 'sum':
+        *${kern.parallel_out} = start ? *${kern.parallel_out} + partial_${kern.parallel_out} : partial_${kern.parallel_out};
+        %elif kern.parallel == 'argmax':
+        // the first of equal maxima wins as in the 32-bit kernel
+        index = start + partial_${kern.parallel_out};
+        value = count ? ${kern.long_value} : 0.0f;
+        if (start == 0 || value > best_value) {
+            *${kern.parallel_out} = index;
+            best_value = value;
+        }
+        %elif kern.parallel == 'mean_stddev':
+        if (${kern.length_arg} <= chunk) {
+            *stddev = partial_stddev;
+            *mean = partial_mean;
+            return;
+        }
+        // Chan et al. pairwise update, as in the volk_parallel_ merge
+        const double n_c = (double)count;
+        const double delta = (double)partial_mean - m;
+        const double total = n + n_c;
+        m += delta * n_c / total;
+        m2 += (double)partial_stddev * partial_stddev * n_c + delta * delta * n * n_c / total;
+        n = total;
+        %endif
+        start += count;
+    } while (start < ${kern.length_arg});
+    %if kern.parallel == 'mean_stddev':
+    *stddev = (float)sqrt(m2 / n);
+    *mean = (float)m;
+    %endif
+}
+
+%endif
 volk_func_desc_t ${kern.name}_get_func_desc(void) {
     const char **impl_names = get_machine()->${kern.name}_impl_names;
-    const int *impl_deps = get_machine()->${kern.name}_impl_deps;
+    const uint64_t *impl_deps = get_machine()->${kern.name}_impl_deps;
     const bool *alignment = get_machine()->${kern.name}_impl_alignment;
     const size_t n_impls = get_machine()->${kern.name}_n_impls;
     volk_func_desc_t desc = {
         impl_names,
         impl_deps,
         alignment,
-        n_impls
+        n_impls,
+        ${kern.inplace_mask},
+        ${kern.readonly_mask},
+        (void (*const *)(void))get_machine()->${kern.name}_impls
     };
     return desc;
 }
 
+static bool __plan_${kern.name}(volk_plan_t *plan, const char *impl_name)
+{
+    const char *name = get_machine()->${kern.name}_name;
+    const char **impl_names = get_machine()->${kern.name}_impl_names;
+    const uint64_t *impl_deps = get_machine()->${kern.name}_impl_deps;
+    const bool *alignment = get_machine()->${kern.name}_impl_alignment;
+    const size_t n_impls = get_machine()->${kern.name}_n_impls;
+    const bool aligned = (plan->flags & VOLK_PLAN_ALIGNED) != 0;
+    int index;
+    if (impl_name) {
+        index = volk_get_index(impl_names, n_impls, impl_name);
+    } else {
+    %if kern.length_arg:
+        index = volk_rank_archs_bucket(name, impl_names, impl_deps, alignment, n_impls, aligned,
+                                       volk_get_length_bucket(plan->num_points));
+    %else:
+        index = volk_rank_archs(name, impl_names, impl_deps, alignment, n_impls, aligned);
+    %endif
+    }
+    %if kern.plan_setup:
+    if (!${kern.plan_setup})
+        return false;
+    %endif
+    plan->execute = (void (*)(void))&${kern.name}_execute;
+    plan->impl = (void (*)(void))get_machine()->${kern.name}_impls[index];
+    plan->impl_name = impl_names[index];
+    %if kern.impl_max_errors:
+    if (!impl_name)
+        plan->impl = (void (*)(void))__${kern.name}_budgeted(index, aligned, &plan->impl_name);
+    %endif
+    %for n, length in enumerate(kern.fixed_lengths):
+    if (plan->num_points == ${length})
+        plan->impl = (void (*)(void))get_machine()->${kern.name}_fixed_impls[index][${n}];
+    %endfor
+    return true;
+}
+
+void ${kern.name}_execute(const volk_plan_t *plan, ${kern.arglist_full})
+{
+    assert(plan->execute == (void (*)(void))&${kern.name}_execute && "plan made for another kernel");
+    assert((!(plan->flags & VOLK_PLAN_ALIGNED) || __${kern.name}_aligned(${kern.arglist_names})) &&
+           "${kern.name}_execute called with unaligned buffers on an aligned plan");
+    if (volk_flush_denormals_thread) {
+        const volk_fpmode_t mode = volk_fpmode_flush_denormals();
+        ((${kern.pname})plan->impl)(${kern.arglist_names});
+        volk_fpmode_restore(mode);
+        return;
+    }
+    ((${kern.pname})plan->impl)(${kern.arglist_names});
+}
+
+%endfor
+
+// points per fused tile of the plain call, whose scratch is on the stack; a
+// complex tile is 8 KiB and stays resident in any L1
+#define VOLK_FUSED_TILE_POINTS 1024
+
+// scratch buffers are laid out one after the other, each rounded up to 64 bytes
+#define VOLK_FUSED_SCRATCH_BYTES(type, num_points, tile_points) \
+    ((((num_points) < (tile_points) ? (num_points) : (tile_points)) * \
+      sizeof(type) + 63) & ~(size_t)63)
+
+// points per fused tile with a heap scratch: two complex tiles fill half the
+// L1d, a power of two between VOLK_FUSED_TILE_POINTS and 8 times that
+static unsigned int __volk_fused_tile_points(void)
+{
+    const size_t points =
+        volk_get_cpu_info()->l1d_cache_size / 2 / (2 * sizeof(lv_32fc_t));
+    unsigned int tile_points = VOLK_FUSED_TILE_POINTS;
+    while (tile_points < 8 * VOLK_FUSED_TILE_POINTS && 2 * tile_points <= points)
+        tile_points *= 2;
+    return tile_points;
+}
+
+%for fused in fused_kernels:
+static size_t __${fused.name}_scratch_size(unsigned int num_points, unsigned int tile_points)
+{
+    size_t size = 0;
+    %for scratch_type, scratch_name in fused.scratch:
+    size += VOLK_FUSED_SCRATCH_BYTES(${scratch_type}, num_points, tile_points);
+    %endfor
+    return size;
+}
+
+static void __${fused.name}_tiles(${fused.arglist_full}, void *scratch, unsigned int tile_points)
+{
+    char *scratch_next = (char *)scratch;
+    %for scratch_type, scratch_name in fused.scratch:
+    ${scratch_type} *${scratch_name} = (${scratch_type} *)scratch_next;
+    scratch_next += VOLK_FUSED_SCRATCH_BYTES(${scratch_type}, num_points, tile_points);
+    %endfor
+    unsigned int start;
+    for (start = 0; start < num_points; start += tile_points) {
+        const unsigned int count = (num_points - start < tile_points) ?
+                                   num_points - start : tile_points;
+        %for step in fused.steps:
+        ${step};
+        %endfor
+    }
+}
+
+size_t ${fused.name}_scratch_size(unsigned int num_points)
+{
+    return __${fused.name}_scratch_size(num_points, __volk_fused_tile_points());
+}
+
+void ${fused.name}_scratch(${fused.arglist_full}, void *scratch)
+{
+    __${fused.name}_tiles(${', '.join([n for t, n in fused.args])}, scratch, __volk_fused_tile_points());
+}
+
+void ${fused.name}(${fused.arglist_full})
+{
+    __VOLK_ATTR_ALIGNED(64) char scratch[${' + '.join(['VOLK_FUSED_SCRATCH_BYTES(%s, VOLK_FUSED_TILE_POINTS, VOLK_FUSED_TILE_POINTS)'%t for t, n in fused.scratch])}];
+    __${fused.name}_tiles(${', '.join([n for t, n in fused.args])}, scratch, VOLK_FUSED_TILE_POINTS);
+}
+
+// the scratch is sized for a whole tile, so a plan serves any num_points
+static bool __plan_${fused.name}(volk_plan_t *plan, const char *impl_name)
+{
+    (void)impl_name;
+    plan->execute = (void (*)(void))&${fused.name}_execute;
+    plan->impl_name = "fused";
+    plan->scratch = volk_malloc(${fused.name}_scratch_size(UINT_MAX), volk_get_alignment());
+    return plan->scratch != NULL;
+}
+
+void ${fused.name}_execute(const volk_plan_t *plan, ${fused.arglist_full})
+{
+    assert(plan->execute == (void (*)(void))&${fused.name}_execute && "plan made for another kernel");
+    ${fused.name}_scratch(${', '.join([n for t, n in fused.args])}, plan->scratch);
+}
+
+%endfor
+struct volk_kernel_init
+{
+    const char *name;
+    void (*init)(void);
+};
+
+static const struct volk_kernel_init volk_kernel_inits[] = {
+%for kern in kernels:
+    { "${kern.name}", &__init_${kern.name} },
+%endfor
+};
+
+static const size_t n_volk_kernel_inits = sizeof(volk_kernel_inits)/sizeof(*volk_kernel_inits);
+
+void volk_init_all(void)
+{
+    size_t i;
+    get_machine();
+    for(i = 0; i < n_volk_kernel_inits; i++) {
+        volk_kernel_inits[i].init();
+    }
+}
+
+size_t volk_init_kernels(const char **names)
+{
+    size_t n_unknown = 0;
+    size_t i;
+    get_machine();
+    for(; names && *names; names++) {
+        for(i = 0; i < n_volk_kernel_inits; i++) {
+            if(!strcmp(*names, volk_kernel_inits[i].name)) {
+                volk_kernel_inits[i].init();
+                break;
+            }
+        }
+        if(i == n_volk_kernel_inits) {
+            n_unknown++;
+        }
+    }
+    return n_unknown;
+}
+
+static const char *volk_parallel_kernel_names[] = {
+%for kern in kernels:
+%if kern.parallel:
+    "${kern.name}",
+%endif
+%endfor
+};
+
+bool volk_has_parallel(const char *kernel)
+{
+    size_t i;
+    for(i = 0; i < sizeof(volk_parallel_kernel_names)/sizeof(*volk_parallel_kernel_names); i++) {
+        if(!strcmp(kernel, volk_parallel_kernel_names[i])) return true;
+    }
+    return false;
+}
+
+struct volk_kernel_desc
+{
+    const char *name;
+    volk_func_desc_t (*get_func_desc)(void);
+};
+
+static const struct volk_kernel_desc volk_kernel_descs[] = {
+%for kern in kernels:
+    { "${kern.name}", &${kern.name}_get_func_desc },
+%endfor
+};
+
+static const size_t n_volk_kernel_descs = sizeof(volk_kernel_descs)/sizeof(*volk_kernel_descs);
+
+// the description of a registered kernel, false if there is none by that name
+static bool __volk_registered_desc(const char *kernel, volk_func_desc_t *desc)
+{
+    const size_t n_registered = volk_get_registered_kernels(NULL, 0);
+    const volk_kernel_registration_t **registered;
+    bool found = false;
+    size_t i;
+    if(!n_registered) {
+        return false;
+    }
+    registered = (const volk_kernel_registration_t **)malloc(n_registered * sizeof(*registered));
+    if(!registered) {
+        return false;
+    }
+    volk_get_registered_kernels(registered, n_registered);
+    for(i = 0; !found && i < n_registered; i++) {
+        if(!strcmp(kernel, registered[i]->name)) {
+            desc->impl_names = registered[i]->impl_names;
+            desc->n_impls = registered[i]->n_impls;
+            desc->impls = registered[i]->impls;
+            found = true;
+        }
+    }
+    free((void *)registered);
+    return found;
+}
+
+volk_impl_handle_t volk_get_impl_handle(const char *kernel, const char *impl_name)
+{
+    volk_impl_handle_t handle = { NULL, -1 };
+    volk_func_desc_t desc;
+    size_t i;
+    if(!kernel || !impl_name) {
+        return handle;
+    }
+    for(i = 0; i < n_volk_kernel_descs; i++) {
+        if(!strcmp(kernel, volk_kernel_descs[i].name)) break;
+    }
+    if(i < n_volk_kernel_descs) {
+        desc = volk_kernel_descs[i].get_func_desc();
+    } else if(!__volk_registered_desc(kernel, &desc)) {
+        return handle;
+    }
+    for(i = 0; i < desc.n_impls; i++) {
+        if(!strcmp(impl_name, desc.impl_names[i])) {
+            handle.impl = desc.impls[i];
+            handle.id = (int)i;
+            break;
+        }
+    }
+    return handle;
+}
+
+struct volk_kernel_plan
+{
+    const char *name;
+    bool (*plan)(volk_plan_t *plan, const char *impl_name);
+};
+
+static const struct volk_kernel_plan volk_kernel_plans[] = {
+%for kern in kernels:
+    { "${kern.name}", &__plan_${kern.name} },
+%endfor
+%for fused in fused_kernels:
+    { "${fused.name}", &__plan_${fused.name} },
+%endfor
+};
+
+static const size_t n_volk_kernel_plans = sizeof(volk_kernel_plans)/sizeof(*volk_kernel_plans);
+
+volk_plan_t *volk_plan_create_manual(const char *kernel, const char *impl_name,
+                                     unsigned int num_points, unsigned int flags)
+{
+    size_t i;
+    for(i = 0; kernel && i < n_volk_kernel_plans; i++) {
+        if(!strcmp(kernel, volk_kernel_plans[i].name)) break;
+    }
+    if(!kernel || i == n_volk_kernel_plans) {
+        return NULL;
+    }
+    volk_plan_t *plan = (volk_plan_t *)calloc(1, sizeof(*plan));
+    if(!plan) {
+        return NULL;
+    }
+    plan->num_points = num_points;
+    plan->flags = flags;
+    if(!volk_kernel_plans[i].plan(plan, impl_name)) {
+        volk_plan_destroy(plan);
+        return NULL;
+    }
+    return plan;
+}
+
+volk_plan_t *volk_plan_create(const char *kernel, unsigned int num_points, unsigned int flags)
+{
+    return volk_plan_create_manual(kernel, NULL, num_points, flags);
+}
+
+void volk_plan_destroy(volk_plan_t *plan)
+{
+    if(!plan) return;
+    volk_free(plan->scratch);
+    free(plan);
+}
+
+const char *volk_plan_get_impl_name(const volk_plan_t *plan)
+{
+    return plan->impl_name;
+}
+
+double volk_estimate_cost(const char *kernel, unsigned int num_points)
+{
+    double overhead_ns, ns_per_point;
+    volk_plan_t *plan = volk_plan_create(kernel, num_points, VOLK_PLAN_ALIGNED);
+    if(!plan) return -1.0;
+    const bool found = volk_get_cost_model(kernel, plan->impl_name,
+                                           volk_get_length_bucket(num_points),
+                                           &overhead_ns, &ns_per_point);
+    volk_plan_destroy(plan);
+    return found ? overhead_ns + ns_per_point * num_points : -1.0;
+}
+
+// the kernels with a measured error per impl, resolved again for a new budget
+static void (*const volk_budgeted_resolves[])(void) = {
+%for kern in kernels:
+%if kern.impl_max_errors:
+    &__resolve_${kern.name},
+%endif
+%endfor
+};
+
+void volk_set_precision(float max_error)
+{
+    size_t i;
+    __precision = (max_error > 0.0f) ? max_error : 0.0f;
+    get_machine();
+    for (i = 0; i < sizeof(volk_budgeted_resolves) / sizeof(*volk_budgeted_resolves); i++) {
+        volk_budgeted_resolves[i]();
+    }
+}
+
+float volk_get_precision(void)
+{
+    return __precision;
+}
+
+// every kernel's resolver and the once state of its first resolution
+static const struct volk_kernel_resolve
+{
+    volk_once_t *once;
+    void (*resolve)(void);
+} volk_kernel_resolves[] = {
+%for kern in kernels:
+    { &__${kern.name}_once, &__resolve_${kern.name} },
+%endfor
+};
+
+void volk_reload_config(void)
+{
+    size_t i;
+    volk_reload_preferences();
+    get_machine();
+    // kernels not called yet resolve from the new profile on first use
+    for (i = 0; i < sizeof(volk_kernel_resolves) / sizeof(*volk_kernel_resolves); i++) {
+        if (VOLK_ATOMIC_LOAD_ACQ(&volk_kernel_resolves[i].once->state) == 2) {
+            volk_kernel_resolves[i].resolve();
+        }
+    }
+}
+
+struct volk_kernel_tune
+{
+    const char *name;
+    volk_autotune_t *tune_a;
+    volk_autotune_t *tune_u;
+};
+
+static const struct volk_kernel_tune volk_kernel_tunes[] = {
+%for kern in kernels:
+    { "${kern.name}", &__${kern.name}_a_tune, &__${kern.name}_u_tune },
+%endfor
+};
+
+static const size_t n_volk_kernel_tunes = sizeof(volk_kernel_tunes)/sizeof(*volk_kernel_tunes);
+
+bool volk_autotune_save(const char *path)
+{
+    char config_path[512];
+    size_t n_prefs = 0;
+    size_t i;
+    if (!path) {
+        volk_get_config_path(config_path, false);
+        path = config_path;
+    }
+    volk_arch_pref_t *prefs = (volk_arch_pref_t *)malloc(n_volk_kernel_tunes * sizeof(*prefs));
+    if (!path[0] || !prefs) {
+        free(prefs);
+        return false;
+    }
+    for(i = 0; i < n_volk_kernel_tunes; i++) {
+        const volk_autotune_t *a = volk_kernel_tunes[i].tune_a;
+        const volk_autotune_t *u = volk_kernel_tunes[i].tune_u;
+        // kernels which were never called, or are still tuning, keep their line
+        if (!a->impl_names || !(volk_autotune_done(a) || volk_autotune_done(u))) continue;
+        volk_arch_pref_t *p = prefs + n_prefs++;
+        snprintf(p->name, sizeof(p->name), "%s", volk_kernel_tunes[i].name);
+        snprintf(p->impl_a, sizeof(p->impl_a), "%s",
+                 a->impl_names[volk_autotune_done(a) ? a->best : a->default_index]);
+        snprintf(p->impl_u, sizeof(p->impl_u), "%s",
+                 u->impl_names[volk_autotune_done(u) ? u->best : u->default_index]);
+    }
+    const bool ok = volk_update_preferences(path, prefs, n_prefs);
+    free(prefs);
+    return ok;
+}
+
+#ifdef VOLK_KERNEL_STATS
+struct volk_kernel_stats_entry
+{
+    const char *name;
+    __volk_kernel_counters_t *counters;
+    size_t point_bytes;
+};
+
+static const struct volk_kernel_stats_entry volk_kernel_stats_entries[] = {
+%for kern in kernels:
+    { "${kern.name}", &__${kern.name}_stats, ${kern.point_bytes} },
+%endfor
+};
+
+static const size_t n_volk_kernel_stats_entries =
+    sizeof(volk_kernel_stats_entries)/sizeof(*volk_kernel_stats_entries);
+
+size_t volk_get_kernel_stats(volk_kernel_stats_t *stats, size_t n_stats)
+{
+    size_t i, bin;
+    for(i = 0; stats && i < n_stats && i < n_volk_kernel_stats_entries; i++) {
+        __volk_kernel_counters_t *counters = volk_kernel_stats_entries[i].counters;
+        stats[i].name = volk_kernel_stats_entries[i].name;
+        stats[i].impl_a = counters->impl_a;
+        stats[i].impl_u = counters->impl_u;
+        stats[i].calls = (uint64_t)counters->calls;
+        stats[i].points = (uint64_t)counters->points;
+        stats[i].bytes = stats[i].points * volk_kernel_stats_entries[i].point_bytes;
+        for(bin = 0; bin < VOLK_STATS_LENGTH_BINS; bin++) {
+            stats[i].lengths[bin] = (uint64_t)counters->lengths[bin];
+        }
+    }
+    return n_volk_kernel_stats_entries;
+}
+
+static void __volk_print_kernel_stats(void)
+{
+    size_t i, bin;
+    fprintf(stderr, "VOLK kernel statistics:\n");
+    for(i = 0; i < n_volk_kernel_stats_entries; i++) {
+        const struct volk_kernel_stats_entry *entry = &volk_kernel_stats_entries[i];
+        const __volk_kernel_counters_t *counters = entry->counters;
+        if(!counters->calls) continue;
+        fprintf(stderr, "%s: %lld calls, %lld points, %lld bytes, impl_a %s, impl_u %s\n",
+                entry->name, counters->calls, counters->points,
+                counters->points * (long long)entry->point_bytes,
+                counters->impl_a, counters->impl_u);
+        for(bin = 0; bin < VOLK_STATS_LENGTH_BINS; bin++) {
+            if(counters->lengths[bin]) {
+                fprintf(stderr, "    [%llu, %llu): %lld\n", bin ? 1ull << bin : 0ull,
+                        1ull << (bin + 1), counters->lengths[bin]);
+            }
+        }
+    }
+}
+#else
+size_t volk_get_kernel_stats(volk_kernel_stats_t *stats, size_t n_stats)
+{
+    (void)stats;
+    (void)n_stats;
+    return 0;
+}
+#endif
+
+#ifdef VOLK_IFUNC
+%for kern in kernels:
+#undef ${kern.name}
+#undef ${kern.name}_a
+#undef ${kern.name}_u
+%endfor
+
+// The dynamic linker calls each resolver once, when it binds the symbol: at
+// load time with -z now, else on the first call. The resolver ranks the impls
+// as the first call through a pointer does, and later calls are direct.
+%for kern in kernels:
+%for sfx in ['', '_a', '_u']:
+%if kern.impl_max_errors:
+// volk_set_precision binds the impls again after load, so calls read the pointer
+static void __${kern.name}${sfx}_forward(${kern.arglist_full})
+{
+    __${kern.name}${sfx}_ptr(${kern.arglist_names});
+}
+
+%endif
+static ${kern.pname} __${kern.name}${sfx}_ifunc(void)
+{
+    __init_${kern.name}();
+    %if kern.impl_max_errors:
+    return &__${kern.name}${sfx}_forward;
+    %else:
+    return __${kern.name}${sfx}_ptr;
+    %endif
+}
+
+void ${kern.name}${sfx}(${kern.arglist_full}) __attribute__((ifunc("__${kern.name}${sfx}_ifunc")));
+
+%endfor
 %endfor
+#endif
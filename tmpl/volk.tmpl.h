@@ -22,8 +22,8 @@
 #ifndef INCLUDED_VOLK_RUNTIME
 #define INCLUDED_VOLK_RUNTIME
 
-#include <volk/volk_typedefs.h>
 #include <volk/volk_config_fixed.h>
+#include <volk/volk_typedefs.h>
 #include <volk/volk_common.h>
 #include <volk/volk_complex.h>
 #include <volk/volk_malloc.h>
@@ -31,15 +31,22 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 __VOLK_DECL_BEGIN
 
 typedef struct volk_func_desc
 {
     const char **impl_names;
-    const int *impl_deps;
+    const uint64_t *impl_deps;
     const bool *impl_alignment;
     size_t n_impls;
+    //! bit i is set if pointer argument i may be the same buffer as the first (output)
+    unsigned int inplace_mask;
+    //! bit i is set if pointer argument i is an input the kernel only reads
+    unsigned int readonly_mask;
+    //! the impls, cast to void (*)(void); the index of an impl is its id
+    void (*const *impls)(void);
 } volk_func_desc_t;
 
 //! Prints a list of machines available
@@ -51,6 +58,49 @@ VOLK_API const char* volk_get_machine(void);
 //! Get the machine alignment in bytes
 VOLK_API size_t volk_get_alignment(void);
 
+//! The largest alignment any machine of this build can require, at compile time
+#define VOLK_MAX_ALIGNMENT ${max([m.alignment for m in machines])}
+
+//! What VOLK knows about the cpu, see volk_get_cpu_info()
+typedef struct volk_cpu_info {
+    uint64_t archs;                //!< the archs of the cpu, as volk_get_lvarch()
+    size_t l1d_cache_size;         //!< bytes, 32 KiB where the OS does not report it
+    size_t l2_cache_size;          //!< bytes of a core's L2, 256 KiB where unreported
+    size_t l3_cache_size;          //!< bytes, 0 where there is none or it is unreported
+    size_t cacheline_size;         //!< bytes of an L1d line, 64 where unreported
+    unsigned int n_cpus;           //!< online logical cpus
+    unsigned int n_cores;          //!< physical cores
+    unsigned int threads_per_core; //!< SMT threads per core, 1 without SMT
+    unsigned int n_numa_nodes;     //!< online NUMA nodes, 1 where unreported
+} volk_cpu_info_t;
+
+/*!
+ * Get the features, caches and topology of the cpu.
+ *
+ * Read once, from sysfs on Linux, the system APIs on Windows and macOS
+ * and cpuid leaf 4 where these do not report the caches, and kept for the
+ * process. The caches are those of cpu0, the first P-core on hybrid x86.
+ * Kernel tiles and thread pool chunks are sized from it; callers can size
+ * their own blocks and volk_set_num_threads() from it alike.
+ */
+VOLK_API const volk_cpu_info_t* volk_get_cpu_info(void);
+
+//! Get the L1 data cache line size in bytes, volk_get_cpu_info()->cacheline_size
+VOLK_API size_t volk_get_cacheline_size(void);
+
+//! Get the L2 cache size of a core in bytes, volk_get_cpu_info()->l2_cache_size
+VOLK_API size_t volk_get_l2_cache_size(void);
+
+/*!
+ * Get the alignment for buffers which are split between threads.
+ *
+ * The largest of the machine alignment, VOLK_MAX_ALIGNMENT and the cache
+ * line size. Sub-buffers carved at multiples of it satisfy any machine's
+ * aligned kernels and never share a cache line with their neighbours, so
+ * threads writing to them do not false-share.
+ */
+VOLK_API size_t volk_get_preferred_alignment(void);
+
 /*!
  * The VOLK_OR_PTR macro is a convenience macro
  * for checking the alignment of a set of pointers.
@@ -72,10 +122,335 @@ VOLK_API size_t volk_get_alignment(void);
  */
 VOLK_API bool volk_is_aligned(const void *ptr);
 
+/*!
+ * Resolve the dispatch pointers of all kernels now.
+ *
+ * Normally every kernel pointer is bound on its first call, which
+ * loads the profile and ranks the implementations on the caller's
+ * thread. Calling this once at startup moves that cost out of the
+ * hot path; afterwards no kernel call takes the slow path.
+ */
+VOLK_API void volk_init_all(void);
+
+/*!
+ * Resolve the dispatch pointers of the named kernels now.
+ *
+ * \param names a NULL terminated list of kernel names, e.g. "volk_32f_x2_add_32f"
+ * \return the number of names which did not match any kernel
+ */
+VOLK_API size_t volk_init_kernels(const char **names);
+
+/*!
+ * Set the number of threads used by the volk_parallel_ kernels.
+ *
+ * The default of 1 runs them on the calling thread. Larger values start a
+ * persistent pool on the next parallel call; the calling thread is one of
+ * the n_threads. Must not be called while a parallel kernel is running.
+ */
+VOLK_API void volk_set_num_threads(unsigned int n_threads);
+
+//! Get the number of threads used by the volk_parallel_ kernels
+VOLK_API unsigned int volk_get_num_threads(void);
+
+//! Whether the kernel has volk_parallel_, volk_async_ and _64 variants
+VOLK_API bool volk_has_parallel(const char *kernel);
+
+//! A kernel call started by a volk_async_ kernel
+typedef struct volk_async volk_async_t;
+
+/*!
+ * Wait for a volk_async_ call to finish and release it.
+ *
+ * The outputs, and the result of a reducing kernel, are written once this
+ * returns. The thread helps with the call's remaining chunks while it
+ * waits. A NULL call is one that finished before it was returned.
+ */
+VOLK_API void volk_async_wait(volk_async_t* call);
+
+//! Whether a volk_async_ call has finished, without waiting; it still needs the wait
+VOLK_API bool volk_async_done(volk_async_t* call);
+
+/*!
+ * Flush denormals to zero in the kernels called from this thread.
+ *
+ * Filters whose signal decays into the denormal range can slow down by
+ * 10 to 100 times on x86. With flush set, each kernel call made from
+ * the calling thread through the dispatcher, a _batch, a volk_parallel_
+ * kernel or a plan runs with FTZ and DAZ set in MXCSR (FZ in FPCR on
+ * arm), and the caller's mode is restored when the call returns, so
+ * the code around the kernels keeps IEEE semantics. Denormal results
+ * and inputs are then taken as zero. The _a, _u and _manual entry
+ * points and the dispatcher in VOLK_ASSUME_ALIGNED mode call the
+ * implementation directly and run in the caller's mode.
+ */
+VOLK_API void volk_set_flush_denormals(bool flush);
+
+//! Whether kernels called from this thread flush denormals, see volk_set_flush_denormals()
+VOLK_API bool volk_get_flush_denormals(void);
+
+//! Accuracy budgets for volk_set_precision(), as max relative error
+#define VOLK_PREC_DEFAULT 0.0f //!< no budget, the profiled or fastest impl
+#define VOLK_PREC_EXACT 1e-6f  //!< within a few ulp
+#define VOLK_PREC_FAST_1E5 1e-5f
+#define VOLK_PREC_FAST_1E3 1e-3f
+#define VOLK_PREC_FAST_1E1 1e-1f
+
+/*!
+ * Set the accuracy budget, in max relative error, of the kernels whose
+ * implementations have a measured error, the exp, expfast, sin, cos, tan,
+ * atan, tanh, divide, sqrt, invsqrt and complex magnitude kernels.
+ *
+ * The dispatcher then takes the ranked implementation if it meets the
+ * budget, else the fastest that does, and the most accurate one if none
+ * does. volk_32f_exp_32f takes the impl of volk_32f_expfast_32f instead
+ * when that meets the budget and is the less accurate, and the divide
+ * kernels those of their dividefast variants likewise, and
+ * volk_32fc_magnitude_32f those of volk_32fc_magnitude_approx_32f. The errors were
+ * measured on x86 over inputs in [-1, 1]; implementations without a
+ * measurement, such as the NEON ones, run only with VOLK_PREC_DEFAULT.
+ * Autotuning is off for these kernels while a budget is set.
+ *
+ * The kernels already resolved are resolved again, so set the budget
+ * while none of them runs. A plan keeps the budget it was made under,
+ * which sets a budget for one call site:
+ *   volk_set_precision(VOLK_PREC_FAST_1E3);
+ *   volk_plan_t *plan = volk_plan_create("volk_32f_atan_32f", n, 0);
+ *   volk_set_precision(VOLK_PREC_DEFAULT);
+ */
+VOLK_API void volk_set_precision(float max_error);
+
+//! The accuracy budget set by volk_set_precision(), VOLK_PREC_DEFAULT if none
+VOLK_API float volk_get_precision(void);
+
+/*!
+ * Read volk_config again and rebind the kernels to its preferences.
+ *
+ * Long running programs pick up a new profile this way without a restart.
+ * Each kernel already called is resolved again, as on its first call, and
+ * its entry points are swapped atomically: a call made meanwhile runs the
+ * old or the new implementation. Kernels not called yet resolve from the
+ * new profile on first use. In IFUNC builds the entry points stay bound
+ * to the implementations they were resolved to at load time.
+ */
+VOLK_API void volk_reload_config(void);
+
+/*!
+ * Reload the config whenever a new one is written to the config dir.
+ *
+ * On Linux a thread waits on inotify for files closed after writing or
+ * renamed into the config dir or volk_config.d and calls
+ * volk_reload_config() after each. Other systems have no watcher.
+ *
+ * \param watch true to start watching, false to stop
+ * \return whether the config is watched now
+ */
+VOLK_API bool volk_watch_config(bool watch);
+
+/*!
+ * Write the implementations chosen by online autotuning to a volk_config.
+ *
+ * With the VOLK_AUTOTUNE environment variable set, one in 64 calls of
+ * every kernel is timed, trying each candidate implementation in turn. Once all have been timed often enough
+ * the one with the lowest time per point replaces the profiled choice.
+ * The choices made so far are merged into the config at path, or into
+ * the default volk_config when path is NULL.
+ *
+ * \return false if the config could not be written
+ */
+VOLK_API bool volk_autotune_save(const char *path);
+
+//! Number of log2 length bins in volk_kernel_stats_t
+#define VOLK_STATS_LENGTH_BINS 32
+
+//! Call counters of one kernel, see volk_get_kernel_stats()
+typedef struct volk_kernel_stats
+{
+    const char *name;
+    const char *impl_a; //!< bound aligned impl, "sized" if chosen per length bucket
+    const char *impl_u; //!< bound unaligned impl, NULL until the kernel is resolved
+    uint64_t calls;
+    uint64_t points;
+    uint64_t bytes;     //!< points times the element sizes of the pointer arguments
+    //! bin b counts the calls with 2^b <= num_points < 2^(b+1), bin 0 includes 0
+    uint64_t lengths[VOLK_STATS_LENGTH_BINS];
+} volk_kernel_stats_t;
+
+/*!
+ * Read the kernel call counters.
+ *
+ * The counters only exist when VOLK was configured with
+ * -DENABLE_KERNEL_STATS=ON; otherwise this returns 0 and the
+ * dispatchers carry no counting code at all. Setting the
+ * VOLK_KERNEL_STATS environment variable in such a build prints the
+ * counters of every called kernel to stderr at exit.
+ *
+ * \param stats array to fill, may be NULL to query the count
+ * \param n_stats number of entries in stats
+ * \return the number of kernels with counters
+ */
+VOLK_API size_t volk_get_kernel_stats(volk_kernel_stats_t *stats, size_t n_stats);
+
+//! A kernel bound to one implementation for a given length, see volk_plan_create()
+typedef struct volk_plan volk_plan_t;
+
+//! Plan flags: every buffer passed to the plan is aligned to volk_get_alignment()
+#define VOLK_PLAN_ALIGNED 1u
+
+/*!
+ * Resolve a kernel once for repeated calls on vectors of one length.
+ *
+ * Ranks the implementations of the kernel for the length bucket of
+ * num_points and for the alignment promised by flags, and stores the
+ * winner. <kernel>_execute(plan, ...) then calls it directly, without
+ * the alignment test and bucket lookup of the dispatcher. Fused kernels
+ * are planned too; their plan owns the scratch the tiles run in. For the
+ * fixed lengths of a kernel the impl is built with the length a constant,
+ * fully unrolled, and the plan binds that build.
+ * Calls through a plan bypass autotuning, core class dispatch and the
+ * kernel statistics.
+ *
+ * \param kernel the kernel name, e.g. "volk_32fc_x2_multiply_32fc"
+ * \param num_points the vector length the plan is made for
+ * \param flags 0 or VOLK_PLAN_ALIGNED
+ * \return the plan, or NULL if the kernel is unknown or out of memory
+ */
+VOLK_API volk_plan_t *volk_plan_create(const char *kernel, unsigned int num_points, unsigned int flags);
+
+/*!
+ * Plan a kernel with the implementation given by name, as <kernel>_manual.
+ *
+ * An unknown impl_name falls back to generic. An aligned implementation
+ * must only be used with aligned buffers, whatever the flags say.
+ */
+VOLK_API volk_plan_t *volk_plan_create_manual(const char *kernel, const char *impl_name,
+                                              unsigned int num_points, unsigned int flags);
+
+//! Release a plan and its scratch, NULL is ignored
+VOLK_API void volk_plan_destroy(volk_plan_t *plan);
+
+//! The name of the implementation the plan calls, "fused" for fused kernels
+VOLK_API const char *volk_plan_get_impl_name(const volk_plan_t *plan);
+
+/*!
+ * Estimate the time of one call of a kernel, for schedulers placing work.
+ *
+ * Takes the implementation volk_plan_create() picks for num_points on
+ * aligned buffers and evaluates the cost model volk_profile --sweep
+ * fitted for it in the length bucket of num_points: a fixed overhead
+ * plus a cost per point.
+ *
+ * \param kernel the kernel name, e.g. "volk_32fc_x2_multiply_32fc"
+ * \param num_points the vector length of the call
+ * \return the estimate in ns, or a negative value if the kernel is unknown
+ * or the profile has no model for the implementation
+ */
+VOLK_API double volk_estimate_cost(const char *kernel, unsigned int num_points);
+
+//! An implementation of a kernel resolved once, see volk_get_impl_handle()
+typedef struct volk_impl_handle
+{
+    void (*impl)(void); //!< the impl, to cast to the kernel's p_ type; NULL if not found
+    int id;             //!< its index in the kernel's volk_func_desc_t, -1 if not found
+} volk_impl_handle_t;
+
+/*!
+ * Resolve an implementation of a kernel by name, once.
+ *
+ * <kernel>_manual looks the impl name up in every call; a loop pinning an
+ * impl, such as a benchmark, resolves it here instead and calls the impl
+ * through the pointer, at no cost per call. Unlike <kernel>_manual an
+ * unknown impl_name does not fall back to generic. Kernels registered by
+ * out-of-tree modules are found too. A pointer call bypasses the denormal
+ * mode of volk_set_flush_denormals() and the kernel statistics.
+ *
+ * \param kernel the kernel name, e.g. "volk_32fc_x2_multiply_32fc"
+ * \param impl_name the impl name, e.g. "u_avx2"
+ * \return the impl and its id, NULL and -1 if the kernel or impl is unknown
+ * or the impl cannot run on this machine
+ */
+VOLK_API volk_impl_handle_t volk_get_impl_handle(const char *kernel, const char *impl_name);
+
+//! Call the kernel a plan was made for, e.g. volk_plan_execute(volk_32f_x2_add_32f, plan, c, a, b, n)
+#define volk_plan_execute(kernel, plan, ...) kernel##_execute(plan, __VA_ARGS__)
+
+/*!
+ * A kernel of an out-of-tree module, see volk_register_kernel().
+ *
+ * The impl arrays are parallel, as in volk_func_desc_t, and hold every
+ * impl the module was built with; impl_deps are in the volk_get_lvarch()
+ * format. One impl must be named "generic". manual has the signature of
+ * <kernel>_manual, the kernel's arguments followed by the impl name.
+ */
+typedef struct volk_kernel_registration
+{
+    const char *name;            //!< e.g. "volk_mymod_32f_x2_foo_32f"
+    const char **impl_names;
+    const uint64_t *impl_deps;
+    const bool *impl_alignment;
+    void (*const *impls)(void);  //!< the impls, cast to void (*)(void)
+    size_t n_impls;
+    unsigned int inplace_mask;   //!< as in volk_func_desc_t
+    void (*manual)(void);        //!< <kernel>_manual, for volk_profile and the QA
+    void (**bind_a)(void);       //!< set to the aligned impl to call
+    void (**bind_u)(void);       //!< set to the unaligned impl to call
+} volk_kernel_registration_t;
+
+/*!
+ * Register a kernel of an out-of-tree module into the runtime.
+ *
+ * The runtime keeps the impls the machine can run and ranks them the way
+ * it ranks its own kernels, honouring the kernel's lines in volk_config,
+ * and stores the winners to *bind_a and *bind_u; the module's dispatcher
+ * calls through those. volk_profile tests and ranks registered kernels
+ * with the core ones and writes them to the same config.
+ * The registration and its arrays must outlive the process.
+ *
+ * \return false if the name is taken or no generic impl is given
+ */
+VOLK_API bool volk_register_kernel(const volk_kernel_registration_t *kernel);
+
+/*!
+ * Get the registered kernels, in the order of registration.
+ *
+ * Their impl arrays are those of the impls the machine can run.
+ *
+ * \param kernels array to fill, may be NULL to query the count
+ * \param n_kernels number of entries in kernels
+ * \return the number of registered kernels
+ */
+VOLK_API size_t volk_get_registered_kernels(const volk_kernel_registration_t **kernels,
+                                            size_t n_kernels);
+
+/*!
+ * Load a shared library of kernels and let it register them.
+ *
+ * Calls its volk_module_register() function, bool (void), when it exports
+ * one; a library registering from a static constructor needs none.
+ *
+ * \return false if the library could not be loaded or failed to register
+ */
+VOLK_API bool volk_load_kernel_module(const char *path);
+
 
 %for kern in kernels:
 
+#if defined(VOLK_IFUNC) && !defined(VOLK_STATIC_INLINE)
+//! The dispatcher, bound by the dynamic linker when the program loads
+%if kern.inplace_args:
+//! It may run in place, with ${kern.args[0][1]} equal to ${' or '.join(kern.inplace_args)}
+%endif
+extern VOLK_API void ${kern.name}(${kern.arglist_full});
+
+//! The fastest aligned implementation, bound when the program loads
+extern VOLK_API void ${kern.name}_a(${kern.arglist_full});
+
+//! The fastest unaligned implementation, bound when the program loads
+extern VOLK_API void ${kern.name}_u(${kern.arglist_full});
+#elif !defined(VOLK_STATIC_INLINE)
 //! A function pointer to the dispatcher implementation
+%if kern.inplace_args:
+//! It may run in place, with ${kern.args[0][1]} equal to ${' or '.join(kern.inplace_args)}
+%endif
 extern VOLK_API ${kern.pname} ${kern.name};
 
 //! A function pointer to the fastest aligned implementation
@@ -83,14 +458,62 @@ extern VOLK_API ${kern.pname} ${kern.name}_a;
 
 //! A function pointer to the fastest unaligned implementation
 extern VOLK_API ${kern.pname} ${kern.name}_u;
+#endif
 
 //! Call into a specific implementation given by name
 extern VOLK_API void ${kern.name}_manual(${kern.arglist_full}, const char* impl_name);
 
 //! Get description parameters for this kernel
 extern VOLK_API volk_func_desc_t ${kern.name}_get_func_desc(void);
+
+//! Call the implementation bound by volk_plan_create("${kern.name}", ...)
+extern VOLK_API void ${kern.name}_execute(const volk_plan_t *plan, ${kern.arglist_full});
+%if kern.length_arg:
+
+//! Run the kernel on count vectors of ${kern.length_arg} each, dispatching once for all
+//! of them; every pointer argument is an array holding one pointer per vector
+extern VOLK_API void ${kern.name}_batch(${kern.batch_arglist_full});
+%endif
+%if kern.parallel:
+
+//! Run the kernel over chunks of the vector on the volk_set_num_threads pool
+extern VOLK_API void volk_parallel_${kern.name}(${kern.arglist_full});
+
+/*!
+ * Start the volk_parallel_ kernel on the pool and return at once. The
+ * vectors and result pointer must stay valid and untouched until
+ * volk_async_wait() on the returned call.
+ */
+extern VOLK_API volk_async_t* volk_async_${kern.name}(${kern.arglist_full});
+
+%if kern.parallel == 'argmax':
+//! The kernel on a size_t length with a 64-bit index, run in chunks below the 32-bit limit
+%else:
+//! The kernel on a size_t length, run in chunks below the 32-bit limit whose results are merged
+%endif
+extern VOLK_API void ${kern.name}_64(${kern.long_arglist_full});
+%endif
+%endfor
+%for fused in fused_kernels:
+
+//! Fused ${fused.chain}, run one L1 sized tile at a time
+extern VOLK_API void ${fused.name}(${fused.arglist_full});
+
+//! Bytes of scratch ${fused.name}_scratch needs for num_points
+extern VOLK_API size_t ${fused.name}_scratch_size(unsigned int num_points);
+
+//! ${fused.name} on a caller-provided scratch of the size above, aligned to volk_get_alignment()
+extern VOLK_API void ${fused.name}_scratch(${fused.arglist_full}, void *scratch);
+
+//! ${fused.name} on the scratch held by volk_plan_create("${fused.name}", ...)
+extern VOLK_API void ${fused.name}_execute(const volk_plan_t *plan, ${fused.arglist_full});
 %endfor
 
 __VOLK_DECL_END
 
+#ifdef VOLK_STATIC_INLINE
+// kernels bound at compile time, see the VOLK_STATIC_TARGET build option
+#include <volk/volk_static.h>
+#endif
+
 #endif /*INCLUDED_VOLK_RUNTIME*/
@@ -0,0 +1,136 @@
+/* -*- C++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_HH
+#define INCLUDED_VOLK_HH
+
+#include <volk/volk.h>
+#include <volk/volk_alloc.hh>
+
+/*!
+ * \brief Typed operations on spans
+ *
+ * \details
+ * Kernels doing the same operation on different element types are
+ * overloads of one function, e.g. volk::multiply or volk::convert, so the
+ * compiler picks the kernel from the argument types. The length is the
+ * size of the first vector argument; the others must be at least as long.
+ * Reductions such as volk::dot return their result.
+ *
+ * Each operation has two overloads. The one on aligned_span calls the _a
+ * kernel pointer directly, the one on span the dispatcher. The span overload
+ * is a template, so when the arguments convert to both, e.g. volk::vector,
+ * overload resolution prefers the aligned one.
+ *
+ * example code:
+ *   volk::vector<lv_32fc_t> in(n), out(n);
+ *   volk::multiply(out, in, lv_cmake(0.f, 1.f));
+ *   lv_32fc_t power = volk::conjugate_dot(out, out);
+ *   std::vector<int16_t> pcm(n);
+ *   volk::convert(pcm, volk::vector<float>(n), 32767.f);
+ */
+namespace volk {
+%for kern in kernels:
+%if kern.typed_op:
+
+//! ${kern.typed_op} by ${kern.name}_a
+inline ${kern.typed_result} ${kern.typed_op}(${kern.typed_aligned_arglist})
+{
+    const unsigned int ${kern.length_arg} = static_cast<unsigned int>(${kern.typed_vectors[0]}.size());
+%for name in kern.typed_vectors[1:]:
+    assert(${name}.size() >= ${kern.length_arg});
+%endfor
+%if kern.typed_result != 'void':
+    ${kern.typed_result} result;
+    ::${kern.name}_a(${kern.typed_call_args});
+    return result;
+%else:
+    ::${kern.name}_a(${kern.typed_call_args});
+%endif
+}
+
+//! ${kern.typed_op} by ${kern.name}
+template <class = void>
+inline ${kern.typed_result} ${kern.typed_op}(${kern.typed_span_arglist})
+{
+    const unsigned int ${kern.length_arg} = static_cast<unsigned int>(${kern.typed_vectors[0]}.size());
+%for name in kern.typed_vectors[1:]:
+    assert(${name}.size() >= ${kern.length_arg});
+%endfor
+%if kern.typed_result != 'void':
+    ${kern.typed_result} result;
+    ::${kern.name}(${kern.typed_call_args});
+    return result;
+%else:
+    ::${kern.name}(${kern.typed_call_args});
+%endif
+}
+%endif
+%endfor
+
+/*!
+ * \brief Owns a call started by a volk_async_ kernel
+ *
+ * \details
+ * The destructor waits for the call, so the vectors it works on must
+ * outlive the handle.
+ *
+ * example code:
+ *   volk::async_call call(volk_async_16ic_convert_32fc(out, in, n));
+ *   // ... other work, not touching out or in ...
+ *   call.wait();
+ */
+class async_call
+{
+public:
+    async_call() = default;
+    explicit async_call(volk_async_t* call) : _call(call) {}
+    async_call(async_call&& other) noexcept : _call(other._call) { other._call = nullptr; }
+    async_call& operator=(async_call&& other) noexcept
+    {
+        if (this != &other) {
+            wait();
+            _call = other._call;
+            other._call = nullptr;
+        }
+        return *this;
+    }
+    async_call(const async_call&) = delete;
+    async_call& operator=(const async_call&) = delete;
+    ~async_call() { wait(); }
+
+    //! Whether the call has finished
+    bool ready() const { return volk_async_done(_call); }
+
+    //! Wait for the call to finish; the outputs are written afterwards
+    void wait()
+    {
+        volk_async_wait(_call);
+        _call = nullptr;
+    }
+
+private:
+    volk_async_t* _call = nullptr;
+};
+
+} // namespace volk
+#endif // INCLUDED_VOLK_HH
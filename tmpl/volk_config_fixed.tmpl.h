@@ -26,4 +26,31 @@
 #define LV_${arch.name.upper()} ${i}
 %endfor
 
+//! The archs whose impls run off the CPU, only volk_config prefs select them
+#define VOLK_OFFLOAD_ARCHS (0${''.join([' | (1ULL << LV_%s)'%a.name.upper() for a in archs if a.offload])})
+<% static_args = [arg for arg in args if arg != 'ifunc'] %>
+%if 'ifunc' in args:
+
+//! The dispatchers are ELF IFUNC symbols bound at load time, not pointers
+#define VOLK_IFUNC 1
+%endif
+%if static_args:
+<% static_machine = machine_dict[static_args[0]] %>
+
+#ifdef VOLK_STATIC_INLINE
+// code binding the kernels at compile time sees the archs of the static
+// target; volk_common.h includes this first in that mode so they are set
+// before it is read
+//! The machine volk_static.h binds the kernels to
+#define VOLK_STATIC_MACHINE "${static_machine.name}"
+%for arch in static_machine.archs:
+%if arch.name != 'orc' and not arch.offload:
+#ifndef LV_HAVE_${arch.name.upper()}
+#define LV_HAVE_${arch.name.upper()} 1
+#endif
+%endif
+%endfor
+#endif
+%endif
+
 #endif /*INCLUDED_VOLK_CONFIG_FIXED*/
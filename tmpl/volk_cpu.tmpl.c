@@ -21,6 +21,9 @@
 
 #include <volk/volk_cpu.h>
 #include <volk/volk_config_fixed.h>
+#include "volk_once.h"
+#include <inttypes.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -103,6 +106,36 @@ static inline unsigned int check_extended_cpuid(unsigned int val) {
 #endif
 }
 
+#if defined(VOLK_CPU_x86)
+// the vendor string, and the family and model with their extended fields added in
+static void cpuid_x86_model(char vendor[13], unsigned int *family, unsigned int *model) {
+    unsigned int regs[4] = {0, 0, 0, 0};
+    cpuid_x86(0, regs);
+    memcpy(vendor + 0, &regs[1], 4);
+    memcpy(vendor + 4, &regs[3], 4);
+    memcpy(vendor + 8, &regs[2], 4);
+    vendor[12] = 0;
+    cpuid_x86(1, regs);
+    *family = (regs[0] >> 8) & 0xf;
+    *model = (regs[0] >> 4) & 0xf;
+    if (*family == 0xf) *family += (regs[0] >> 20) & 0xff;
+    if (*family == 0x6 || *family >= 0xf) *model += ((regs[0] >> 16) & 0xf) << 4;
+}
+#endif
+
+// a micro-architecture: the cpus of a vendor and family with a model in [model_min, model_max]
+static inline unsigned int cpu_model_x86(const char *vendor, unsigned int family, unsigned int model_min, unsigned int model_max) {
+#if defined(VOLK_CPU_x86)
+    char this_vendor[13];
+    unsigned int this_family, this_model;
+    cpuid_x86_model(this_vendor, &this_family, &this_model);
+    return !strcmp(this_vendor, vendor) && this_family == family &&
+           this_model >= model_min && this_model <= model_max;
+#else
+    return 0;
+#endif
+}
+
 static inline unsigned int get_avx_enabled(void) {
 #if defined(VOLK_CPU_x86)
     return __xgetbv() & 0x6;
@@ -192,6 +225,66 @@ static int has_neonv8(void){
 #endif
 }
 
+//pmull and sve detection is linux specific as well
+#if defined(VOLK_CPU_ARMV8)
+    #include <sys/auxv.h>
+    #ifndef HWCAP_PMULL
+        #define HWCAP_PMULL (1 << 4)
+    #endif
+    #ifndef HWCAP_SVE
+        #define HWCAP_SVE (1 << 22)
+    #endif
+    #ifndef HWCAP2_SVE2
+        #define HWCAP2_SVE2 (1 << 1)
+    #endif
+#endif
+
+static int has_pmull(void){
+#if defined(VOLK_CPU_ARMV8)
+    return (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+#else
+    return 0;
+#endif
+}
+
+static int has_sve(void){
+#if defined(VOLK_CPU_ARMV8)
+    return (getauxval(AT_HWCAP) & HWCAP_SVE) != 0;
+#else
+    return 0;
+#endif
+}
+
+static int has_sve2(void){
+#if defined(VOLK_CPU_ARMV8) && defined(AT_HWCAP2)
+    return has_sve() && (getauxval(AT_HWCAP2) & HWCAP2_SVE2) != 0;
+#else
+    return 0;
+#endif
+}
+
+#if defined(__riscv) && __riscv_xlen == 64 && defined(__linux__)
+    #define VOLK_CPU_RISCV
+    #include <sys/auxv.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+static int has_rvv(void){
+#if defined(VOLK_CPU_RISCV)
+#if defined(__NR_riscv_hwprobe)
+    //hwprobe (linux 6.5) reports the ratified V 1.0 only, not vendor drafts;
+    //key 4 is RISCV_HWPROBE_KEY_IMA_EXT_0 and bit 2 RISCV_HWPROBE_IMA_V
+    struct { long long key; unsigned long long value; } pair = {4, 0};
+    if (syscall(__NR_riscv_hwprobe, &pair, 1, 0, NULL, 0) == 0 && pair.key == 4)
+        return (pair.value & (1ULL << 2)) != 0;
+#endif
+    return (getauxval(AT_HWCAP) & (1UL << ('V' - 'A'))) != 0;
+#else
+    return 0;
+#endif
+}
+
 static int has_neon(void){
 #if defined(VOLK_CPU_ARMV8) || defined(VOLK_CPU_ARMV7)
     if (has_neonv7() || has_neonv8())
@@ -203,6 +296,19 @@ static int has_neon(void){
 #endif
 }
 
+#if defined(VOLK_OPENCL)
+    #include <volk/volk_opencl.h>
+#endif
+
+//an OpenCL device is an arch too, its impls only run where a profile picks them
+static int has_opencl(void){
+#if defined(VOLK_OPENCL)
+    return volk_opencl_available();
+#else
+    return 0;
+#endif
+}
+
 %for arch in archs:
 static int i_can_has_${arch.name} (void) {
     %for check, params in arch.checks:
@@ -244,11 +350,44 @@ void volk_cpu_init() {
     set_float_rounding();
 }
 
-unsigned int volk_get_lvarch() {
-    unsigned int retval = 0;
+static volk_once_t volk_lvarch_once = VOLK_ONCE_INIT;
+static uint64_t volk_lvarch;
+
+static void volk_detect_lvarch(void) {
     volk_cpu_init();
     %for arch in archs:
-    retval += volk_cpu.has_${arch.name}() << LV_${arch.name.upper()};
+    volk_lvarch += (uint64_t)volk_cpu.has_${arch.name}() << LV_${arch.name.upper()};
     %endfor
-    return retval;
+}
+
+// the cpuid and hwcap checks run once, the machine loops ask for this often
+uint64_t volk_get_lvarch() {
+    volk_call_once(&volk_lvarch_once, &volk_detect_lvarch);
+    return volk_lvarch;
+}
+
+void volk_get_cpu_signature(char* sig, size_t len) {
+    if (!sig || !len) return;
+#if defined(VOLK_CPU_x86)
+    char vendor[13];
+    unsigned int family, model;
+    cpuid_x86_model(vendor, &family, &model);
+    snprintf(sig, len, "%s-%u-%u-%" PRIx64, vendor, family, model, volk_get_lvarch());
+#else
+    unsigned int implementer = 0, part = 0;
+#if defined(__linux__)
+    char line[256];
+    FILE *cpuinfo = fopen("/proc/cpuinfo", "r");
+    if (cpuinfo) {
+        while (fgets(line, sizeof(line), cpuinfo) != NULL) {
+            const char *value = strchr(line, ':');
+            if (!value) continue;
+            if (!strncmp(line, "CPU implementer", 15)) sscanf(value + 1, "%x", &implementer);
+            if (!strncmp(line, "CPU part", 8)) sscanf(value + 1, "%x", &part);
+        }
+        fclose(cpuinfo);
+    }
+#endif
+    snprintf(sig, len, "%x-%x-%" PRIx64, implementer, part, volk_get_lvarch());
+#endif
 }
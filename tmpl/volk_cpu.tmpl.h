@@ -23,6 +23,8 @@
 #define INCLUDED_VOLK_CPU_H
 
 #include <volk/volk_common.h>
+#include <stddef.h>
+#include <stdint.h>
 
 __VOLK_DECL_BEGIN
 
@@ -35,7 +37,32 @@ struct VOLK_CPU {
 extern struct VOLK_CPU volk_cpu;
 
 void volk_cpu_init ();
-unsigned int volk_get_lvarch ();
+//! The archs of this cpu, bit LV_<ARCH> for each, detected on the first call
+uint64_t volk_get_lvarch ();
+
+/*!
+ * Write a signature identifying this cpu model to sig, e.g.
+ * "GenuineIntel-6-85-1ffff": the vendor, family and model on x86 and
+ * the implementer and part on arm, followed by the VOLK arch mask.
+ */
+VOLK_API void volk_get_cpu_signature(char* sig, size_t len);
+
+//! Upper bound on the core classes told apart by volk_get_core_class
+#define VOLK_MAX_CORE_CLASSES 4
+
+/*!
+ * The number of core classes of a heterogeneous cpu: 2 on a hybrid x86
+ * (class 0 the P-cores, class 1 the E-cores), one per distinct
+ * cpu_capacity on arm big.LITTLE (class 0 the biggest), else 1.
+ * Only detected on Linux.
+ */
+VOLK_API unsigned int volk_get_n_core_classes(void);
+
+//! The core class of a cpu number, 0 for unknown cpus
+VOLK_API unsigned int volk_get_core_class(int cpu);
+
+//! The core class of the cpu the calling thread runs on, via sched_getcpu
+VOLK_API unsigned int volk_get_current_core_class(void);
 
 __VOLK_DECL_END
 
@@ -38,10 +38,65 @@
 #include <volk/${kern.name}.h>
 %endfor
 
+//impls built from a template impl, with its last argument a constant
+%for kern in kernels:
+%for impl in kern.get_impls(arch_names):
+%if impl.variant_of:
+static __VOLK_ATTR_FLATTEN void ${kern.name}_${impl.name}(${kern.arglist_full})
+{
+    ${kern.name}_${impl.variant_of}(${kern.arglist_names}, ${impl.variant_value});
+}
+
+%endif
+%endfor
+%endfor
+
+//impls built once more for each fixed length of their kernel; with the length
+//a constant the compiler unrolls them fully
+%for kern in kernels:
+%for impl in kern.get_impls(arch_names):
+%for length in kern.fixed_lengths:
+static __VOLK_ATTR_FLATTEN void ${kern.name}_${impl.name}_n${length}(${kern.arglist_full})
+{
+    if (${kern.length_arg} != ${length}) {
+        ${kern.name}_${impl.name}(${kern.arglist_names});
+        return;
+    }
+    ${kern.name}_${impl.name}(${kern.fixed_arglist_names[length]});
+}
+
+%endfor
+%endfor
+%endfor
+
+<% kern_impls = dict([(kern.name, [i.name for i in kern.get_impls(arch_names)]) for kern in kernels]) %>
+<% defaults = this_machine.defaults %>
+%for kern_name, impl_a, impl_u in defaults:
+<% assert impl_a in kern_impls[kern_name] and impl_u in kern_impls[kern_name], kern_name %>
+%endfor
+%if defaults:
+//the impls this machine ranks first where volk_config names none
+static const struct volk_machine_default volk_machine_${this_machine.name}_defaults[] = {
+%for kern_name, impl_a, impl_u in defaults:
+    {"${kern_name}", "${impl_a}", "${impl_u}"},
+%endfor
+};
+
+%endif
+#ifdef VOLK_MACHINE_PLUGIN
+__VOLK_ATTR_EXPORT
+#endif
 struct volk_machine volk_machine_${this_machine.name} = {
-<% make_arch_have_list = (' | '.join(['(1 << LV_%s)'%a.name.upper() for a in this_machine.archs])) %>    ${make_arch_have_list},
+<% make_arch_have_list = (' | '.join(['(1ull << LV_%s)'%a.name.upper() for a in this_machine.archs])) %>    ${make_arch_have_list},
 <% this_machine_name = "\""+this_machine.name+"\"" %>    ${this_machine_name},
     ${this_machine.alignment},
+%if defaults:
+    volk_machine_${this_machine.name}_defaults,
+    ${len(defaults)},
+%else:
+    NULL,
+    0,
+%endif
 ##//list all kernels
     %for kern in kernels:
 <% impls = kern.get_impls(arch_names) %>
@@ -50,12 +105,20 @@ struct volk_machine volk_machine_${this_machine.name} = {
 ##//list of kernel implementations by name
 <% make_impl_name_list = "{"+', '.join(['"%s"'%i.name for i in impls])+"}" %>    ${make_impl_name_list},
 ##//list of arch dependencies per implementation
-<% make_impl_deps_list = "{"+', '.join([' | '.join(['(1 << LV_%s)'%d.upper() for d in i.deps]) for i in impls])+"}" %>    ${make_impl_deps_list},
+<% make_impl_deps_list = "{"+', '.join(['(' + ' | '.join(['(1ull << LV_%s)'%d.upper() for d in i.deps]) + ')' for i in impls])+"}" %>    ${make_impl_deps_list},
 ##//alignment required? for each implementation
 <% make_impl_align_list = "{"+', '.join(['true' if i.is_aligned else 'false' for i in impls])+"}" %>    ${make_impl_align_list},
 ##//pointer to each implementation
 <% make_impl_fcn_list = "{"+', '.join(['%s_%s'%(kern.name, i.name) for i in impls])+"}" %>    ${make_impl_fcn_list},
 ##//number of implementations listed here
 <% len_impls = len(impls) %>    ${len_impls},
+    %if kern.fixed_lengths:
+##//the impls unrolled for each fixed length
+<% make_fixed_impl_list = "{"+', '.join(["{"+', '.join(['%s_%s_n%d'%(kern.name, i.name, length) for length in kern.fixed_lengths])+"}" for i in impls])+"}" %>    ${make_fixed_impl_list},
+    %endif
+    %if kern.impl_max_errors:
+##//measured max relative error per implementation
+<% make_impl_error_list = "{"+', '.join(['%gf'%kern.impl_max_errors[i.name] if i.name in kern.impl_max_errors else '-1.0f' for i in impls])+"}" %>    ${make_impl_error_list},
+    %endif
     %endfor
 };
@@ -21,6 +21,7 @@
 
 #include <volk/volk_common.h>
 #include <volk/volk_typedefs.h>
+#include <volk/volk_config_fixed.h>
 #include "volk_machines.h"
 
 struct volk_machine *volk_machines[] = {
@@ -32,3 +33,16 @@ struct volk_machine *volk_machines[] = {
 };
 
 unsigned int n_volk_machines = sizeof(volk_machines)/sizeof(*volk_machines);
+
+#ifdef VOLK_MACHINE_PLUGINS
+struct volk_machine_plugin volk_machine_plugins[] = {
+%for machine in machines:
+#ifdef LV_PLUGIN_MACHINE_${machine.name.upper()}
+{${' | '.join(['(1ull << LV_%s)'%a.name.upper() for a in machine.archs])}, "${machine.name}"},
+#endif
+%endfor
+{0, NULL}
+};
+
+unsigned int n_volk_machine_plugins = sizeof(volk_machine_plugins)/sizeof(*volk_machine_plugins) - 1;
+#endif
@@ -30,17 +30,32 @@
 
 __VOLK_DECL_BEGIN
 
+//the impls a kernel is ranked with when volk_config has no entry for it
+struct volk_machine_default {
+    const char *kern_name;
+    const char *impl_a;
+    const char *impl_u;
+};
+
 struct volk_machine {
-    const unsigned int caps; //capabilities (i.e., archs compiled into this machine, in the volk_get_lvarch format)
+    const uint64_t caps; //capabilities (i.e., archs compiled into this machine, in the volk_get_lvarch format)
     const char *name;
     const size_t alignment; //the maximum byte alignment required for functions in this library
+    const struct volk_machine_default *defaults; //sorted by kernel name, e.g. those of a micro-architecture
+    const size_t n_defaults;
     %for kern in kernels:
     const char *${kern.name}_name;
     const char *${kern.name}_impl_names[<%len_archs=len(archs)%>${len_archs}];
-    const int ${kern.name}_impl_deps[${len_archs}];
+    const uint64_t ${kern.name}_impl_deps[${len_archs}];
     const bool ${kern.name}_impl_alignment[${len_archs}];
     const ${kern.pname} ${kern.name}_impls[${len_archs}];
     const size_t ${kern.name}_n_impls;
+    %if kern.fixed_lengths:
+    const ${kern.pname} ${kern.name}_fixed_impls[${len_archs}][${len(kern.fixed_lengths)}]; //per impl, unrolled for each fixed length
+    %endif
+    %if kern.impl_max_errors:
+    const float ${kern.name}_impl_max_error[${len_archs}]; //measured max relative error per impl, -1 if unmeasured
+    %endif
     %endfor
 };
 
@@ -50,6 +65,17 @@ extern struct volk_machine volk_machine_${machine.name};
 #endif
 %endfor
 
+#ifdef VOLK_MACHINE_PLUGINS
+//a machine built as a module, loaded by volk_load_machine_plugin() when it is chosen
+struct volk_machine_plugin {
+    const uint64_t caps;
+    const char *name;
+};
+
+extern struct volk_machine_plugin volk_machine_plugins[];
+extern unsigned int n_volk_machine_plugins;
+#endif
+
 __VOLK_DECL_END
 
 #endif //INCLUDED_LIBVOLK_MACHINES_H
@@ -0,0 +1,255 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * The volk Python module, one function per bound kernel taking the arguments of
+ * the C function. Vectors are any C contiguous object with the buffer
+ * protocol, e.g. NumPy arrays, whose item size is that of the kernel's
+ * element type; they are used in place, never copied. The buffers of the
+ * outputs must be writable and every vector must hold the items the kernel
+ * reads or writes for num_points, else a ValueError is raised. Only the
+ * kernels whose extents gen/volk_kernel_defs.py describes are bound.
+ *
+ * A call runs with the GIL released. When all its buffers are aligned it
+ * calls the _a kernel, otherwise the _u one; both are bound the same way as
+ * for C callers, so the choices of volk_profile in volk_config apply.
+ *
+ * example code:
+ *   import numpy, volk
+ *   a = numpy.ones(1024, numpy.complex64)
+ *   out = numpy.empty_like(a)
+ *   volk.volk_32fc_s32fc_multiply_32fc(out, a, 1j, len(a))
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <limits.h>
+
+#include <volk/volk.h>
+
+typedef struct
+{
+    const char* name;
+    Py_ssize_t itemsize;
+    int writable;
+    // the vector holds per_point * num_points + fixed items
+    size_t per_point;
+    size_t fixed;
+} volk_python_vector_t;
+
+// O& converter of the unsigned int arguments, which raises on negative or
+// too large values where the I format would wrap them
+static int volk_python_uint(PyObject* obj, void* result)
+{
+    const unsigned long value = PyLong_AsUnsignedLong(obj);
+    if (value == (unsigned long)-1 && PyErr_Occurred()) {
+        return 0;
+    }
+    if (value > UINT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "value does not fit an unsigned int");
+        return 0;
+    }
+    *(unsigned int*)result = (unsigned int)value;
+    return 1;
+}
+
+// get the buffers of the vector arguments, each long enough for
+// num_points; on failure none is held
+static int volk_python_get_buffers(const char* kernel,
+                                   const volk_python_vector_t* vectors,
+                                   PyObject** objs,
+                                   Py_buffer* views,
+                                   size_t n,
+                                   unsigned int num_points)
+{
+    unsigned long long items, needed;
+    size_t i;
+    for (i = 0; i < n; i++) {
+        const int flags = PyBUF_C_CONTIGUOUS | (vectors[i].writable ? PyBUF_WRITABLE : 0);
+        if (PyObject_GetBuffer(objs[i], &views[i], flags) < 0) {
+            break;
+        }
+        if (views[i].itemsize != vectors[i].itemsize) {
+            PyErr_Format(PyExc_TypeError,
+                         "%s: %s has items of %zd bytes, the kernel takes %zd",
+                         kernel,
+                         vectors[i].name,
+                         views[i].itemsize,
+                         vectors[i].itemsize);
+            PyBuffer_Release(&views[i]);
+            break;
+        }
+        // cannot overflow: per_point is small and num_points 32 bit
+        needed = (unsigned long long)vectors[i].per_point * num_points + vectors[i].fixed;
+        items = (unsigned long long)views[i].len / views[i].itemsize;
+        if (items < needed) {
+            PyErr_Format(PyExc_ValueError,
+                         "%s: %s holds %llu items, num_points %u needs %llu",
+                         kernel,
+                         vectors[i].name,
+                         items,
+                         num_points,
+                         needed);
+            PyBuffer_Release(&views[i]);
+            break;
+        }
+    }
+    if (i == n) {
+        return 0;
+    }
+    while (i--) {
+        PyBuffer_Release(&views[i]);
+    }
+    return -1;
+}
+
+static void volk_python_release_buffers(Py_buffer* views, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) {
+        PyBuffer_Release(&views[i]);
+    }
+}
+
+static int volk_python_aligned(const Py_buffer* views, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) {
+        if (!volk_is_aligned(views[i].buf)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+%for kern in kernels:
+%if kern.py_bound:
+<% n_vectors = len(kern.py_buffers) %>
+PyDoc_STRVAR(${kern.name}_doc, "${kern.name}(${kern.arglist_names})\n\nBinds ${kern.name}(${', '.join(['%s %s'%(t.strip(), n) for t, n in kern.args])})");
+
+static PyObject* py_${kern.name}(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    static char* kwlist[] = { ${', '.join(['"%s"'%name for _, name in kern.args])}, NULL };
+    static const volk_python_vector_t vectors[] = {
+%for name, base_type, writable, per_point, fixed in kern.py_buffers:
+        { "${name}", sizeof(${base_type}), ${int(writable)}, ${per_point}, ${fixed} },
+%endfor
+    };
+    PyObject* objs[${n_vectors}];
+    Py_buffer views[${n_vectors}];
+%for c_type, name in kern.py_scalars:
+    ${c_type} arg_${name};
+%endfor
+    (void)self;
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "${kern.py_format}:${kern.name}", kwlist, ${kern.py_parse_args})) {
+        return NULL;
+    }
+    if (volk_python_get_buffers("${kern.name}", vectors, objs, views, ${n_vectors}, arg_num_points) < 0) {
+        return NULL;
+    }
+    if (volk_python_aligned(views, ${n_vectors})) {
+        Py_BEGIN_ALLOW_THREADS
+        ${kern.name}_a(${kern.py_call_args});
+        Py_END_ALLOW_THREADS
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        ${kern.name}_u(${kern.py_call_args});
+        Py_END_ALLOW_THREADS
+    }
+    volk_python_release_buffers(views, ${n_vectors});
+    Py_RETURN_NONE;
+}
+%endif
+%endfor
+
+static PyObject* py_get_machine(PyObject* self, PyObject* unused)
+{
+    (void)self;
+    (void)unused;
+    return PyUnicode_FromString(volk_get_machine());
+}
+
+static PyObject* py_get_alignment(PyObject* self, PyObject* unused)
+{
+    (void)self;
+    (void)unused;
+    return PyLong_FromSize_t(volk_get_alignment());
+}
+
+static PyObject* py_is_aligned(PyObject* self, PyObject* obj)
+{
+    Py_buffer view;
+    int aligned;
+    (void)self;
+    if (PyObject_GetBuffer(obj, &view, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+    aligned = volk_is_aligned(view.buf);
+    PyBuffer_Release(&view);
+    return PyBool_FromLong(aligned);
+}
+
+static PyMethodDef volk_python_methods[] = {
+    { "get_machine", py_get_machine, METH_NOARGS,
+      "get_machine()\n\nThe name of the machine the kernels are bound for." },
+    { "get_alignment", py_get_alignment, METH_NOARGS,
+      "get_alignment()\n\nThe buffer alignment in bytes the _a kernels need." },
+    { "is_aligned", py_is_aligned, METH_O,
+      "is_aligned(buffer)\n\nWhether the buffer is aligned for the _a kernels." },
+%for kern in kernels:
+%if kern.py_bound:
+    { "${kern.name}", (PyCFunction)(void (*)(void))py_${kern.name},
+      METH_VARARGS | METH_KEYWORDS, ${kern.name}_doc },
+%endif
+%endfor
+    { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef volk_python_module = {
+    PyModuleDef_HEAD_INIT,
+    "volk",
+    "Vector-Optimized Library of Kernels, on buffer protocol objects in place",
+    -1,
+    volk_python_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+};
+
+PyMODINIT_FUNC PyInit_volk(void)
+{
+    PyObject* module;
+    // bind the machine now; volk_is_aligned relies on its alignment
+    volk_get_alignment();
+    module = PyModule_Create(&volk_python_module);
+    if (module == NULL) {
+        return NULL;
+    }
+    if (PyModule_AddIntConstant(module, "VERSION", VOLK_VERSION) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
+}
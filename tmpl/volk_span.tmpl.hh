@@ -0,0 +1,52 @@
+/* -*- C++ -*- */
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_SPAN_HH
+#define INCLUDED_VOLK_SPAN_HH
+
+#include <volk/volk.h>
+#include <volk/volk_alloc.hh>
+
+/*!
+ * \brief Kernel overloads on volk::aligned_span
+ *
+ * \details
+ * Every kernel has an overload in namespace volk taking aligned spans for
+ * its vector arguments. Their type already guarantees the alignment the
+ * aligned implementations need, so the overloads call the kernel's _a
+ * pointer directly instead of the dispatcher with its volk_is_aligned test.
+ *
+ * example code:
+ *   volk::vector<float> in(n), out(n);
+ *   volk::volk_32f_s32f_multiply_32f(out, in, 2.f, n);
+ */
+namespace volk {
+
+%for kern in kernels:
+inline void ${kern.name}(${kern.span_arglist_full})
+{
+    ::${kern.name}_a(${kern.span_arglist_names});
+}
+
+%endfor
+} // namespace volk
+#endif // INCLUDED_VOLK_SPAN_HH
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * GNU Radio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * GNU Radio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Radio; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_VOLK_STATIC_H
+#define INCLUDED_VOLK_STATIC_H
+
+/*
+ * Kernels bound at compile time to the VOLK_STATIC_MACHINE, which volk.h
+ * includes instead of declaring the dispatch pointers when
+ * VOLK_STATIC_INLINE is defined; volk_config_fixed.h sets the machine's
+ * LV_HAVE_* for it. Each public kernel name is a static inline call of the
+ * implementation the default ranking picks on that machine, so the
+ * compiler can inline it; the code must be built with the machine's
+ * compiler flags. orc impls are left out, they live in the library.
+ */
+
+<% this_machine = machine_dict[args[0]] %>
+<% arch_index = dict([(arch.name, i) for i, arch in enumerate(archs)]) %>
+<% defaults = dict([(d[0], d[1:]) for d in this_machine.defaults]) %>
+<%
+def rank(kern, impls, aligned):
+    # the machine's default for the kernel, else the impl with the largest
+    # requirement mask wins, the first one on ties
+    for impl in impls:
+        if impl.name == defaults.get(kern.name, (None, None))[0 if aligned else 1]:
+            return impl
+    best = None
+    best_value = -1
+    for impl in impls:
+        value = sum([1 << arch_index[dep] for dep in impl.deps])
+        if impl.is_aligned == aligned and value > best_value:
+            best = impl
+            best_value = value
+    return best
+%>
+#include <stdint.h>
+#include <volk/volk.h>
+
+__VOLK_DECL_BEGIN
+
+// declared ahead, some kernels are built on the dispatchers of others
+%for kern in kernels:
+static inline void ${kern.name}(${kern.arglist_full});
+static inline void ${kern.name}_a(${kern.arglist_full});
+static inline void ${kern.name}_u(${kern.arglist_full});
+%endfor
+
+__VOLK_DECL_END
+
+%for kern in kernels:
+#include <volk/${kern.name}.h>
+%endfor
+
+__VOLK_DECL_BEGIN
+%for kern in kernels:
+%for impl in kern.get_impls(this_machine.arch_names):
+%if impl.variant_of:
+static inline void ${kern.name}_${impl.name}(${kern.arglist_full})
+{
+    ${kern.name}_${impl.variant_of}(${kern.arglist_names}, ${impl.variant_value});
+}
+%endif
+%endfor
+%endfor
+%for kern in kernels:
+<% impls = [impl for impl in kern.get_impls(this_machine.arch_names) if 'orc' not in impl.deps] %>
+<% impl_u = rank(kern, impls, False) %>
+<% impl_a = rank(kern, impls, True) or impl_u %>
+<% pointers = ['(intptr_t)%s'%n for t, n in kern.args if '*' in t] %>
+
+static inline void ${kern.name}_a(${kern.arglist_full})
+{
+    ${kern.name}_${impl_a.name}(${kern.arglist_names});
+}
+
+static inline void ${kern.name}_u(${kern.arglist_full})
+{
+    ${kern.name}_${impl_u.name}(${kern.arglist_names});
+}
+
+static inline void ${kern.name}(${kern.arglist_full})
+{
+%if impl_a is impl_u or not pointers:
+    ${kern.name}_${impl_a.name}(${kern.arglist_names});
+%else:
+    if (((${' | '.join(pointers)}) & ${this_machine.alignment - 1}) == 0) {
+        ${kern.name}_${impl_a.name}(${kern.arglist_names});
+    } else {
+        ${kern.name}_${impl_u.name}(${kern.arglist_names});
+    }
+%endif
+}
+%endfor
+
+__VOLK_DECL_END
+
+#endif /*INCLUDED_VOLK_STATIC_H*/